@@ -602,6 +602,7 @@ int amps_create(const char *kanal, enum amps_chan_type chan_type, const char *de
 		LOGP(DAMPS, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	amps->sender.destroy = amps_destroy;
 
 	amps->chan_type = chan_type;
 	memcpy(&amps->si, si, sizeof(amps->si));
@@ -709,7 +710,7 @@ static void amps_release(transaction_t *trans, uint8_t cause)
 	/* release towards call control */
 	if (trans->callref) {
 		call_up_release(trans->callref, cause);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 	}
 	/* change DSP mode to transmit release */
 	if (amps->dsp_mode == DSP_MODE_AUDIO_RX_AUDIO_TX || amps->dsp_mode == DSP_MODE_AUDIO_RX_SILENCE_TX || amps->dsp_mode == DSP_MODE_OFF)
@@ -930,7 +931,6 @@ reject:
 /* Call control starts call towards mobile station. */
 int call_down_setup(int callref, const char __attribute__((unused)) *caller_id, enum number_type __attribute__((unused)) caller_type, const char *dialing)
 {
-	sender_t *sender;
 	amps_t *amps;
 	transaction_t *trans;
 	uint32_t min1;
@@ -946,14 +946,8 @@ int call_down_setup(int callref, const char __attribute__((unused)) *caller_id,
 //	}
 
 	/* 3. check if given number is already in a call, return BUSY */
-	for (sender = sender_head; sender; sender = sender->next) {
-		amps = (amps_t *) sender;
-		/* search transaction for this number */
-		trans = search_transaction_number(amps, min1, min2);
-		if (trans)
-			break;
-	}
-	if (sender) {
+	trans = search_transaction_number_global(min1, min2);
+	if (trans) {
 		LOGP(DAMPS, LOGL_NOTICE, "Outgoing call to busy number, rejecting!\n");
 		return -CAUSE_BUSY;
 	}
@@ -979,7 +973,7 @@ int call_down_setup(int callref, const char __attribute__((unused)) *caller_id,
 		LOGP(DAMPS, LOGL_ERROR, "Failed to create transaction\n");
 		return -CAUSE_TEMPFAIL;
 	}
-	trans->callref = callref;
+	trans_set_callref(trans, callref);
 	trans->page_retry = 1;
 	if (caller_type == TYPE_INTERNATIONAL) {
 		trans->caller_id[0] = '+';
@@ -1000,24 +994,19 @@ void call_down_answer(int __attribute__((unused)) callref, struct timeval __attr
  */
 void call_down_disconnect(int callref, int cause)
 {
-	sender_t *sender;
 	amps_t *amps;
 	transaction_t *trans;
 
 	LOGP(DAMPS, LOGL_INFO, "Call has been disconnected by network.\n");
 
-	for (sender = sender_head; sender; sender = sender->next) {
-		amps = (amps_t *) sender;
-		/* search transaction for this callref */
-		trans = search_transaction_callref(amps, callref);
-		if (trans)
-			break;
-	}
-	if (!sender) {
+	/* search transaction for this callref */
+	trans = search_transaction_callref_global(callref);
+	if (!trans) {
 		LOGP(DAMPS, LOGL_NOTICE, "Outgoing disconnect, but no callref!\n");
 		call_up_release(callref, CAUSE_INVALCALLREF);
 		return;
 	}
+	amps = trans->amps;
 
 	/* Release when not active */
 
@@ -1036,7 +1025,7 @@ void call_down_disconnect(int callref, int cause)
 	default:
 		LOGP_CHAN(DAMPS, LOGL_INFO, "Call control disconnects on control channel, removing transaction.\n");
 		call_up_release(callref, cause);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 		destroy_transaction(trans);
 		amps_go_idle(amps);
 	}
@@ -1045,26 +1034,21 @@ void call_down_disconnect(int callref, int cause)
 /* Call control releases call toward mobile station. */
 void call_down_release(int callref, int cause)
 {
-	sender_t *sender;
 	amps_t *amps;
 	transaction_t *trans;
 
 	LOGP(DAMPS, LOGL_INFO, "Call has been released by network, releasing call.\n");
 
-	for (sender = sender_head; sender; sender = sender->next) {
-		amps = (amps_t *) sender;
-		/* search transaction for this callref */
-		trans = search_transaction_callref(amps, callref);
-		if (trans)
-			break;
-	}
-	if (!sender) {
+	/* search transaction for this callref */
+	trans = search_transaction_callref_global(callref);
+	if (!trans) {
 		LOGP(DAMPS, LOGL_NOTICE, "Outgoing release, but no callref!\n");
 		/* don't send release, because caller already released */
 		return;
 	}
+	amps = trans->amps;
 
-	trans->callref = 0;
+	trans_set_callref(trans, 0);
 
 	switch (amps->dsp_mode) {
 	case DSP_MODE_AUDIO_RX_SILENCE_TX:
@@ -1166,7 +1150,7 @@ static amps_t *assign_voice_channel(transaction_t *trans)
 		sprintf(esn_text, "%u", trans->esn);
 		/* setup call */
 		LOGP(DAMPS, LOGL_INFO, "Setup call to network.\n");
-		trans->callref = call_up_setup(callerid, trans->dialing, OSMO_CC_NETWORK_AMPS_ESN, esn_text);
+		trans_set_callref(trans, call_up_setup(callerid, trans->dialing, OSMO_CC_NETWORK_AMPS_ESN, esn_text));
 	}
 
 	return vc;
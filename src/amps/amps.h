@@ -106,7 +106,7 @@ struct amps {
 	int			fsk_rx_window_end;	/* where to end detecting level */
 	int			fsk_rx_window_pos;	/* current position in buffer */
 	/* the rx buffer received one frame until rx length */
-	char			fsk_rx_frame[FSK_MAX_BITS + 1];	/* +1 because 0-termination */
+	uint8_t			fsk_rx_frame[(FSK_MAX_BITS + 7) / 8]; /* received bits, packed MSB first */
 	int			fsk_rx_frame_length;	/* length of expected frame */
 	int			fsk_rx_frame_count;	/* count number of received bit */
 	double			fsk_rx_frame_level;	/* sum of level of all bits */
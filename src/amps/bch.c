@@ -0,0 +1,132 @@
+/* AMPS BCH(40,28,5) and BCH(48,36,5) coding
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Both codes are shortened from BCH(63,51,5) with the generator polynomial
+ * x^12 + x^10 + x^8 + x^5 + x^4 + x^3 + 1 (0x1539). The redundancy is the
+ * remainder of the data (multiplied by x^12) divided by the generator
+ * polynomial, just like a CRC with zero initial value.
+ *
+ * All data words are MSB first. A code word holds the data bits followed by
+ * the 12 redundancy bits.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "bch.h"
+
+#define POLY	0x539
+
+static uint16_t bch_table[256];		/* redundancy for one byte */
+static uint8_t bch_error[4096][2];	/* error positions for each syndrome */
+
+#define NO_ERROR	0xff
+
+int init_bch(void)
+{
+	uint16_t syndrome[48];
+	uint16_t r, s;
+	int i, j;
+
+	/* table to process one byte at a time */
+	for (i = 0; i < 256; i++) {
+		r = i << 4;
+		for (j = 0; j < 8; j++)
+			r = (r & 0x800) ? ((r << 1) ^ POLY) : (r << 1);
+		bch_table[i] = r & 0xfff;
+	}
+
+	/* table of syndromes for one and two bit errors
+	 * the syndrome of a single error at bit position p (counted from the
+	 * last bit of the code word) is x^p mod g(x), so it is independent of
+	 * the length of the shortened code */
+	r = 1;
+	for (i = 0; i < 48; i++) {
+		syndrome[i] = r;
+		r = (r & 0x800) ? ((r << 1) ^ POLY) & 0xfff : (r << 1);
+	}
+	for (i = 0; i < 4096; i++)
+		bch_error[i][0] = bch_error[i][1] = NO_ERROR;
+	for (i = 0; i < 48; i++) {
+		s = syndrome[i];
+		if (bch_error[s][0] != NO_ERROR) {
+			printf("Overlap, please fix!\n");
+			return -1;
+		}
+		bch_error[s][0] = i;
+		for (j = i + 1; j < 48; j++) {
+			s = syndrome[i] ^ syndrome[j];
+			if (bch_error[s][0] != NO_ERROR) {
+				printf("Overlap, please fix!\n");
+				return -1;
+			}
+			bch_error[s][0] = i;
+			bch_error[s][1] = j;
+		}
+	}
+
+	return 0;
+}
+
+/* return 12 bits of redundancy for given data of given length (up to 56 bits)
+ * data is processed byte by byte, leading zeros do not change the result */
+uint16_t bch_encode(uint64_t data, int length)
+{
+	uint16_t r = 0;
+	int i;
+
+	data &= ((uint64_t)1 << length) - 1;
+	for (i = (length + 7) / 8 - 1; i >= 0; i--)
+		r = ((r << 8) & 0xfff) ^ bch_table[((r >> 4) ^ (data >> (i * 8))) & 0xff];
+
+	return r;
+}
+
+/* return syndrome of code word, 0 if no error is detected
+ * length is the number of data bits (without redundancy) */
+uint16_t bch_syndrome(uint64_t word, int length)
+{
+	return bch_encode(word >> BCH_REDUNDANCY, length) ^ (word & 0xfff);
+}
+
+/* correct up to two bit errors of given code word
+ * return number of corrected bits or -1 if the code word cannot be corrected */
+int bch_correct(uint64_t *word, int length)
+{
+	uint16_t s;
+	const uint8_t *e;
+
+	s = bch_syndrome(*word, length);
+	if (!s)
+		return 0;
+	e = bch_error[s];
+	if (e[0] == NO_ERROR)
+		return -1;
+	/* error must be within shortened code word */
+	if (e[0] >= length + BCH_REDUNDANCY)
+		return -1;
+	if (e[1] == NO_ERROR) {
+		*word ^= (uint64_t)1 << e[0];
+		return 1;
+	}
+	if (e[1] >= length + BCH_REDUNDANCY)
+		return -1;
+	*word ^= ((uint64_t)1 << e[0]) | ((uint64_t)1 << e[1]);
+	return 2;
+}
+
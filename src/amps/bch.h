@@ -0,0 +1,7 @@
+#define BCH_REDUNDANCY	12	/* number of parity bits */
+
+int init_bch(void);
+uint16_t bch_encode(uint64_t data, int length);
+uint16_t bch_syndrome(uint64_t word, int length);
+int bch_correct(uint64_t *word, int length);
+
@@ -625,11 +625,15 @@ prepare_frame:
 		bit = 1 - bit;
 
 	/* read next bit. after all bits, we reset to FSK_SYNC_NONE */
-	amps->fsk_rx_frame[amps->fsk_rx_frame_count++] = bit + '0';
-	if (amps->fsk_rx_frame_count > FSK_MAX_BITS) {
+	if (amps->fsk_rx_frame_count >= FSK_MAX_BITS) {
 		fprintf(stderr, "our fsk_tx_count (%d) is larger than our max bits we can handle, please fix!\n", amps->fsk_rx_frame_count);
 		abort();
 	}
+	/* store bits packed, MSB first */
+	if (!(amps->fsk_rx_frame_count & 7))
+		amps->fsk_rx_frame[amps->fsk_rx_frame_count >> 3] = 0;
+	amps->fsk_rx_frame[amps->fsk_rx_frame_count >> 3] |= bit << (7 - (amps->fsk_rx_frame_count & 7));
+	amps->fsk_rx_frame_count++;
 	if (amps->fsk_rx_frame_count == amps->fsk_rx_frame_length) {
 		int more;
 
@@ -638,7 +642,6 @@ prepare_frame:
 		display_measurements_update(amps->dmp_frame_quality, amps->fsk_rx_frame_quality / (double)amps->fsk_rx_frame_count * 100.0, 0.0);
 
 		/* a complete frame was received, so we process it */
-		amps->fsk_rx_frame[amps->fsk_rx_frame_count] = '\0';
 		more = amps_decode_frame(amps, amps->fsk_rx_frame, amps->fsk_rx_frame_count, amps->fsk_rx_frame_level / (double)amps->fsk_rx_frame_count, amps->fsk_rx_frame_quality / amps->fsk_rx_frame_level, (amps->fsk_rx_sync == FSK_SYNC_NEGATIVE));
 		if (more) {
 			/* switch to next word length without DCC included */
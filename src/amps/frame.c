@@ -29,9 +29,11 @@
 #include "../libsample/sample.h"
 #include "../liblogging/logging.h"
 #include "../libmobile/get_time.h"
+#include "../libmobile/replay.h"
 #include "amps.h"
 #include "dsp.h"
 #include "frame.h"
+#include "bch.h"
 #include "main.h"
 
 /* uncomment this to debug bits */
@@ -53,63 +55,6 @@ static uint64_t cut_bits[37] = {
 	0x1ffffffff, 0x3ffffffff, 0x7ffffffff, 0xfffffffff,
 };
 
-static char gp[12] = { 0, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1 };
-
-/* do BCH(length+12,length,5) encoding:
- * given data and length, return 12 bits redundancy
- * all arrays are MSB first.
- */
-static const char *encode_bch(const char *data, int length)
-{
-	static char redun[13];
-	int i, j, feedback;
-
-	for (i = 0; i < 12; i++)
-		redun[i] = 0;
-
-	for (i = 0; i < length; i++) {
-		feedback = (data[i] & 1) ^ redun[0];
-		if (feedback) {
-			for (j = 11; j > 0; j--) {
-				if (gp[11 - j])
-					redun[11 - j] = redun[12 - j] ^ feedback;
-				else
-					redun[11 - j] = redun[12 - j];
-			}
-			redun[11] = gp[11];
-		} else {
-			for (j = 11; j > 0; j--)
-				redun[11 - j] = redun[12 - j];
-			redun[11] = 0;
-		}
-	}
-	for (i = 0; i < 12; i++)
-		redun[i] += '0';
-	redun[12] = '\0';
-
-	return redun;
-}
-
-/* same as above, but with binary data (without parity space holder) */
-static uint16_t encode_bch_binary(uint64_t value, int length)
-{
-	char data[length + 1];
-	const char *redun;
-	uint16_t p = 0;
-	int i;
-
-	for (i = 0; i < length; i++)
-		data[i] = '0' + ((value >> (length - 1 - i)) & 1);
-	data[i] = '\0';
-
-	redun = encode_bch(data, length);
-
-	for (i = 0; i < 12; i++)
-		p = (p << 1) | ((*redun++) & 1);
-
-	return p;
-}
-
 /*
  * helper
  */
@@ -2693,6 +2638,12 @@ void init_frame(void)
 
 	/* generate table 4 */
 	gen_table4();
+
+	/* generate BCH tables */
+	if (init_bch() < 0) {
+		LOGP(DFRAME, LOGL_ERROR, "BCH tables are wrong, please fix!\n");
+		abort();
+	}
 }
 
 
@@ -2725,7 +2676,7 @@ static uint64_t amps_encode_word(frame_t *frame, struct def_word *w, int debug)
 	for (i = 0; w->ie[i].name; i++) {
 		bits = w->ie[i].bits;
 		if (w->ie[i].name[0] == 'P' && w->ie[i].name[1] == '\0')
-			value = encode_bch_binary(word, sum_bits - bits);
+			value = bch_encode(word, sum_bits - bits);
 		else
 			value = frame->ie[w->ie[i].ie];
 		word = (word << bits) | (value & cut_bits[bits]);
@@ -3100,6 +3051,8 @@ static void amps_decode_word_focc(amps_t *amps, uint64_t word)
 	int t1t2, ohd = -1, act, scc;
 	static frame_t *frame;
 
+	replay_event(amps->sender.kanal, "focc word 0x%010" PRIx64, word);
+
 	t1t2 = (word >> 38) & 3;
 
 	/* control message */
@@ -3207,6 +3160,8 @@ static int amps_decode_word_recc(amps_t *amps, uint64_t word, int first)
 	int msg_count, f, nawc;
 	static frame_t *frame;
 
+	replay_event(amps->sender.kanal, "recc word 0x%012" PRIx64, word);
+
 	f = (word >> 47) & 0x1;
 	nawc = (word >> 44) & 0x7;
 
@@ -3586,32 +3541,71 @@ int amps_encode_frame_fvc(amps_t *amps, char *bits)
 	return 0;
 }
 
+/* get given number of bits (up to 57) at given bit position of packed frame */
+static uint64_t get_bits(const uint8_t *bits, int pos, int num)
+{
+	uint64_t value = 0;
+	int shift = pos & 7, bytes, i;
+
+	bits += pos >> 3;
+	bytes = (shift + num + 7) >> 3;
+	for (i = 0; i < bytes; i++)
+		value = (value << 8) | bits[i];
+
+	return (value >> (bytes * 8 - shift - num)) & (((uint64_t)1 << num) - 1);
+}
+
+/* get 40 bits of FOCC word at given bit position, skip B/I bit after every 10 bits */
+static uint64_t get_focc_word(const uint8_t *bits, int pos, int *idle)
+{
+	uint64_t word = 0;
+	int j;
+
+	for (j = 0; j < 4; j++) {
+		word = (word << 10) | get_bits(bits, pos, 10);
+		*idle += get_bits(bits, pos + 10, 1);
+		pos += 11;
+	}
+
+	return word;
+}
+
+/* render received bits for debugging */
+static void bits2text(char *text, const uint8_t *bits, int pos, int num)
+{
+	int i;
+
+	for (i = 0; i < num; i++)
+		text[i] = get_bits(bits, pos + i, 1) + '0';
+	text[i] = '\0';
+}
+
+/* check word and correct up to two bit errors
+ * return 1, if the word is valid, add number of corrected bits */
+static int check_word(uint64_t *word, int length, int *corrected)
+{
+	int rc;
+
+	rc = bch_correct(word, length);
+	if (rc < 0)
+		return 0;
+	*corrected += rc;
+	return 1;
+}
+
 /* assemble FOCC bits */
-static void amps_decode_bits_focc(amps_t *amps, const char *bits)
+static void amps_decode_bits_focc(amps_t *amps, const uint8_t *bits)
 {
-	char word_string[41];
 	uint64_t word_a[5], word_b[5], word;
 	int crc_a_ok[5], crc_b_ok[5], crc_ok;
-	int idle;
-	int i, j, k, crc_i, crc_j;
+	int idle, corrected = 0;
+	int i, crc_i, crc_j;
 
-	bits++; /* skip B/I after sync */
+	/* skip B/I after sync */
 	idle = 0;
 	for (i = 0; i < 10; i++) {
-		word = 0;
-		for (j = 0, k = 0; j < 44; j++) {
-			if (j % 11 == 10) {
-				idle += (*bits++) & 1;
-				continue;
-			}
-			word_string[k++] = *bits;
-			word = (word << 1) | ((*bits++) & 1);
-		}
-		word_string[k] = '\0';
-		if (!strncmp(encode_bch(word_string, 28), word_string + 28, 12))
-			crc_ok = 1;
-		else
-			crc_ok = 0;
+		word = get_focc_word(bits, 1 + i * 44, &idle);
+		crc_ok = !bch_syndrome(word, 28);
 		if ((i & 1) == 0) {
 			word_a[i >> 1] = word;
 			crc_a_ok[i >> 1] = crc_ok;
@@ -3620,7 +3614,6 @@ static void amps_decode_bits_focc(amps_t *amps, const char *bits)
 			crc_b_ok[i >> 1] = crc_ok;
 		}
 	}
-	bits -= 440;
 
 	if (idle > 20)
 		idle = 1;
@@ -3632,8 +3625,7 @@ static void amps_decode_bits_focc(amps_t *amps, const char *bits)
 		char text[64];
 
 		for (i = 0; i < 10; i++) {
-			strncpy(text, bits + i * 44, 44);
-			text[44] = '\0';
+			bits2text(text, bits, 1 + i * 44, 44);
 			if ((i & 1) == 0)
 				LOGP_CHAN(DFRAME, LOGL_DEBUG, "  word a - %s%s\n", text, (crc_a_ok[i >> 1]) ? " ok" : " BAD CRC!");
 			else
@@ -3641,10 +3633,17 @@ static void amps_decode_bits_focc(amps_t *amps, const char *bits)
 		}
 	}
 
+	/* if no repetition is received without errors, try to correct */
 	for (crc_i = 0; crc_i < 5; crc_i++) {
 		if (crc_a_ok[crc_i])
 			break;
 	}
+	if (crc_i == 5) {
+		for (crc_i = 0; crc_i < 5; crc_i++) {
+			if (check_word(&word_a[crc_i], 28, &corrected))
+				break;
+		}
+	}
 	if (crc_i < 5) {
 		amps_decode_word_focc(amps, word_a[crc_i]);
 	}
@@ -3652,39 +3651,39 @@ static void amps_decode_bits_focc(amps_t *amps, const char *bits)
 		if (crc_b_ok[crc_j])
 			break;
 	}
-	if (crc_j < 5 && word_b[crc_j] != word_a[crc_i]) {
+	if (crc_j == 5) {
+		for (crc_j = 0; crc_j < 5; crc_j++) {
+			if (check_word(&word_b[crc_j], 28, &corrected))
+				break;
+		}
+	}
+	if (crc_j < 5 && (crc_i == 5 || word_b[crc_j] != word_a[crc_i])) {
 		amps_decode_word_focc(amps, word_b[crc_j]);
 	}
+	if (corrected)
+		LOGP_CHAN(DFRAME, LOGL_INFO, "RX FOCC: %d bit error(s) corrected\n", corrected);
 }
 
 /* assemble RECC bits, return true, if more bits are expected */
-static int amps_decode_bits_recc(amps_t *amps, const char *bits, int first)
+static int amps_decode_bits_recc(amps_t *amps, const uint8_t *bits, int first)
 {
-	char word_string[49];
 	int8_t dcc = -1;
 	uint64_t word_a[5], word;
-	int crc_a_ok[5], crc_ok, crc_ok_count = 0;
-	int i, j, k, crc_i;
-	const char *bits_ = bits; /* for extra check */
+	int crc_a_ok[5], crc_ok, crc_ok_count = 0, corrected = 0;
+	int i, crc_i, pos = 0;
+	int idle = 0;
 
 	/* decode color code */
 	if (first) {
-		dcc = 0;
-		for (j = 0; j < 7; j++) {
-			dcc = (dcc << 1) | ((*bits++) & 1);
-		}
+		dcc = get_bits(bits, 0, 7);
 		dcc = dcc_decode[dcc];
+		pos = 7;
 	}
 
 	/* assemble word */
 	for (i = 0; i < 5; i++) {
-		word = 0;
-		for (j = 0, k = 0; j < 48; j++) {
-			word_string[k++] = *bits;
-			word = (word << 1) | ((*bits++) & 1);
-		}
-		word_string[k] = '\0';
-		if (!strncmp(encode_bch(word_string, 36), word_string + 36, 12)) {
+		word = get_bits(bits, pos + i * 48, 48);
+		if (!bch_syndrome(word, 36)) {
 			crc_ok = 1;
 			crc_ok_count++;
 		} else
@@ -3692,31 +3691,20 @@ static int amps_decode_bits_recc(amps_t *amps, const char *bits, int first)
 		word_a[i] = word;
 		crc_a_ok[i] = crc_ok;
 	}
-	bits -= 240;
 
 	if (crc_ok_count == 0) {
 		/* check if we receive frame in a loop */
 		crc_ok = 0;
-		bits_++; /* skip B/I after sync */
 		for (i = 0; i < 5; i++) {
-			word = 0;
-			for (j = 0, k = 0; j < 44; j++) {
-				if (j % 11 == 10) {
-					bits_++;
-					continue;
-				}
-				word_string[k++] = *bits_;
-				word = (word << 1) | ((*bits_++) & 1);
-			}
-			word_string[k] = '\0';
-			if (!strncmp(encode_bch(word_string, 28), word_string + 28, 12))
+			/* skip B/I after sync */
+			word = get_focc_word(bits, 1 + i * 44, &idle);
+			if (!bch_syndrome(word, 28))
 				crc_ok++;
 		}
 		if (crc_ok) {
 			LOGP_CHAN(DFRAME, LOGL_NOTICE, "Seems we RX FOCC frame due to loopback, ignoring!\n");
 			return 0;
 		}
-		bits_ -= 221;
 	}
 
 	for (crc_i = 0; crc_i < 5; crc_i++) {
@@ -3724,9 +3712,20 @@ static int amps_decode_bits_recc(amps_t *amps, const char *bits, int first)
 			break;
 	}
 
+	/* if no repetition is received without errors, try to correct */
+	if (crc_i == 5) {
+		for (crc_i = 0; crc_i < 5; crc_i++) {
+			if (check_word(&word_a[crc_i], 36, &corrected)) {
+				crc_a_ok[crc_i] = 1;
+				crc_ok_count++;
+				break;
+			}
+		}
+	}
+
 	if (first) {
 		if (loglevel == LOGL_DEBUG || crc_ok_count > 0) {
-			LOGP_CHAN(DFRAME, LOGL_INFO, "RX RECC: DCC=%d (%d of 5 CRCs are ok)\n", dcc, crc_ok_count);
+			LOGP_CHAN(DFRAME, LOGL_INFO, "RX RECC: DCC=%d (%d of 5 CRCs are ok, %d bit error(s) corrected)\n", dcc, crc_ok_count, corrected);
 			if (dcc != amps->si.dcc) {
 				LOGP(DFRAME, LOGL_INFO, "received DCC=%d mismatches the base station's DCC=%d\n", dcc, amps->si.dcc);
 				return 0;
@@ -3734,14 +3733,13 @@ static int amps_decode_bits_recc(amps_t *amps, const char *bits, int first)
 		}
 	} else {
 		if (loglevel == LOGL_DEBUG || crc_ok_count > 0)
-			LOGP_CHAN(DFRAME, LOGL_INFO, "RX RECC: (%d of 5 CRCs are ok)\n", crc_ok_count);
+			LOGP_CHAN(DFRAME, LOGL_INFO, "RX RECC: (%d of 5 CRCs are ok, %d bit error(s) corrected)\n", crc_ok_count, corrected);
 	}
 	if (loglevel == LOGL_DEBUG) {
 		char text[64];
 
 		for (i = 0; i < 5; i++) {
-			strncpy(text, bits + i * 48, 48);
-			text[48] = '\0';
+			bits2text(text, bits, pos + i * 48, 48);
 			LOGP_CHAN(DFRAME, LOGL_DEBUG, "  word - %s%s\n", text, (crc_a_ok[i]) ? " ok" : " BAD CRC!");
 		}
 	}
@@ -3751,7 +3749,7 @@ static int amps_decode_bits_recc(amps_t *amps, const char *bits, int first)
 	return 0;
 }
 
-int amps_decode_frame(amps_t *amps, const char *bits, int count, double level, double quality, int negative)
+int amps_decode_frame(amps_t *amps, const uint8_t *bits, int count, double level, double quality, int negative)
 {
 	int more = 0;
 
@@ -0,0 +1,57 @@
+/* TACS tones and announcements from asset pack
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include "../libmobile/asset.h"
+#include "tones.h"
+#include "outoforder.h"
+
+extern int16_t *ringback_spl;
+extern int ringback_size;
+extern int ringback_max;
+
+extern int16_t *busy_spl;
+extern int busy_size;
+extern int busy_max;
+
+extern int16_t *congestion_spl;
+extern int congestion_size;
+extern int congestion_max;
+
+extern int16_t *hangup_spl;
+extern int hangup_size;
+extern int hangup_max;
+
+extern int16_t *outoforder_spl;
+extern int outoforder_size;
+extern int outoforder_max;
+
+void init_tones(void)
+{
+	asset_bind("tacs/ringback", &ringback_spl, &ringback_size, &ringback_max);
+	asset_bind("tacs/busy", &busy_spl, &busy_size, &busy_max);
+	/* congestion uses the busy tone */
+	asset_bind("tacs/busy", &congestion_spl, &congestion_size, &congestion_max);
+	asset_bind("tacs/hangup", &hangup_spl, &hangup_size, &hangup_max);
+}
+
+void init_outoforder(void)
+{
+	asset_bind("tacs/outoforder", &outoforder_spl, &outoforder_size, &outoforder_max);
+}
@@ -27,6 +27,14 @@
 #include "amps.h"
 //#include "database.h"
 
+/* all transactions of all channels, hashed by callref and subscriber */
+static trans_index_t trans_index;
+
+static inline uint64_t min_id(uint32_t min1, uint16_t min2)
+{
+	return ((uint64_t)min2 << 32) | min1;
+}
+
 static const char *trans_state_name(int state)
 {
 	switch (state) {
@@ -117,18 +125,10 @@ const char *trans_short_state_name(int state)
 /* create transaction */
 transaction_t *create_transaction(amps_t *amps, enum amps_trans_state state, uint32_t min1, uint16_t min2, uint32_t esn, uint8_t msg_type, uint8_t ordq, uint8_t order, uint16_t chan)
 {
-	sender_t *sender;
-	transaction_t *trans = NULL;
-	amps_t *search_amps;
+	transaction_t *trans;
 
 	/* search transaction for this subscriber */
-	for (sender = sender_head; sender; sender = sender->next) {
-		search_amps = (amps_t *) sender;
-		/* search transaction for this callref */
-		trans = search_transaction_number(search_amps, min1, min2);
-		if (trans)
-			break;
-	}
+	trans = search_transaction_number_global(min1, min2);
 	if (trans) {
 		const char *number = amps_min2number(trans->min1, trans->min2);
 		int old_callref = trans->callref;
@@ -194,6 +194,7 @@ void link_transaction(transaction_t *trans, amps_t *amps)
 	while (*transp)
 		transp = &((*transp)->next);
 	*transp = trans;
+	trans_index_link(&trans_index, &trans->index, trans, min_id(trans->min1, trans->min2), trans->callref);
 	amps_display_status();
 }
 
@@ -212,44 +213,76 @@ void unlink_transaction(transaction_t *trans)
 		abort();
 	}
 	*transp = trans->next;
+	trans_index_unlink(&trans_index, &trans->index);
 	trans->amps = NULL;
 	amps_display_status();
 }
 
+/* set callref and keep index up to date */
+void trans_set_callref(transaction_t *trans, int callref)
+{
+	trans->callref = callref;
+	if (trans->amps)
+		trans_index_callref(&trans_index, &trans->index, callref);
+}
+
 transaction_t *search_transaction_number(amps_t *amps, uint32_t min1, uint16_t min2)
 {
-	transaction_t *trans = amps->trans_list;
+	trans_index_node_t *node;
+	transaction_t *trans;
 
-	while (trans) {
-		if (trans->min1 == min1
-		 && trans->min2 == min2) {
+	for (node = trans_index_first_id(&trans_index, min_id(min1, min2)); node; node = trans_index_next_id(node)) {
+		trans = node->trans;
+		if (trans->amps == amps) {
 			const char *number = amps_min2number(trans->min1, trans->min2);
 			LOGP(DTRANS, LOGL_DEBUG, "Found transaction for subscriber '%s'\n", number);
 			return trans;
 		}
-		trans = trans->next;
 	}
 
 	return NULL;
 }
 
+transaction_t *search_transaction_number_global(uint32_t min1, uint16_t min2)
+{
+	trans_index_node_t *node;
+	transaction_t *trans;
+
+	node = trans_index_first_id(&trans_index, min_id(min1, min2));
+	if (!node)
+		return NULL;
+	trans = node->trans;
+	const char *number = amps_min2number(trans->min1, trans->min2);
+	LOGP(DTRANS, LOGL_DEBUG, "Found transaction for subscriber '%s'\n", number);
+
+	return trans;
+}
+
 transaction_t *search_transaction_callref(amps_t *amps, int callref)
 {
-	transaction_t *trans = amps->trans_list;
+	transaction_t *trans;
+
+	trans = search_transaction_callref_global(callref);
+	if (trans && trans->amps != amps)
+		return NULL;
+
+	return trans;
+}
+
+transaction_t *search_transaction_callref_global(int callref)
+{
+	transaction_t *trans;
 
 	/* just in case, this should not happen */
 	if (!callref)
 		return NULL;
-	while (trans) {
-		if (trans->callref == callref) {
-			const char *number = amps_min2number(trans->min1, trans->min2);
-			LOGP(DTRANS, LOGL_DEBUG, "Found transaction for subscriber '%s'\n", number);
-			return trans;
-		}
-		trans = trans->next;
+	trans = trans_index_by_callref(&trans_index, callref);
+	if (trans) {
+		const char *number = amps_min2number(trans->min1, trans->min2);
+		LOGP(DTRANS, LOGL_DEBUG, "Found transaction for subscriber '%s'\n", number);
 	}
 
-	return NULL;
+	return trans;
 }
 
 void trans_new_state(transaction_t *trans, int state)
@@ -216,6 +216,7 @@ int anetz_create(const char *kanal, const char *device, int use_sdr, int sampler
 		LOGP(DANETZ, LOGL_ERROR, "Failed to init 'Sender' processing!\n");
 		goto error;
 	}
+	anetz->sender.destroy = anetz_destroy;
 
 	/* init audio processing */
 	rc = dsp_init_sender(anetz, page_gain, page_sequence, squelch_db);
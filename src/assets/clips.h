@@ -0,0 +1,20 @@
+
+/* clip to be stored in the asset pack */
+struct asset_source {
+	const char	*name;		/* name to bind clip to a pattern */
+	const int16_t	*spl;		/* 16 bit samples at 8000 Hz */
+	int		size;		/* number of samples */
+	int		max;		/* samples until the pattern repeats */
+};
+
+extern const struct asset_source testton_clips[];
+extern const struct asset_source usa_tones_clips[];
+extern const struct asset_source usa_noanswer_clips[];
+extern const struct asset_source usa_outoforder_clips[];
+extern const struct asset_source usa_invalidnumber_clips[];
+extern const struct asset_source usa_congestion_clips[];
+extern const struct asset_source tacs_tones_clips[];
+extern const struct asset_source tacs_outoforder_clips[];
+extern const struct asset_source cnetz_ansage_clips[];
+extern const struct asset_source nmt_announcement_clips[];
+
@@ -0,0 +1,5423 @@
+#include <stddef.h>
+#include <stdint.h>
+#include "clips.h"
+
+static const int16_t pattern[] = {
+	0x0012, 0x0019, 0x0016, 0x0019, 0x0015, 0x0008, 0xfffd, 0x0005,
+	0x000e, 0x0018, 0x000d, 0xfff4, 0xfffa, 0x0004, 0x0004, 0x0011,
+	0x0007, 0x0003, 0xffff, 0xffff, 0x0009, 0x000d, 0x001c, 0x0015,
+	0x0011, 0x0009, 0xfff6, 0xfff8, 0x0006, 0x0011, 0x0011, 0xfffd,
+	0xfff3, 0xfff7, 0x0006, 0x0011, 0x0010, 0x0002, 0xfff9, 0xfff5,
+	0x0007, 0x000d, 0x000a, 0x0016, 0x0014, 0xfffe, 0xfff6, 0xfffb,
+	0x0007, 0x0005, 0x0006, 0xfff7, 0xffe9, 0xfffb, 0xfffe, 0x0013,
+	0x0003, 0x0002, 0xfff1, 0xfff8, 0xfffc, 0x000b, 0x0009, 0xfffd,
+	0xfff3, 0xffec, 0xfffb, 0x0000, 0x000b, 0x0011, 0x000f, 0xffee,
+	0xffeb, 0xfff5, 0x000a, 0x000a, 0x0010, 0xffd9, 0xff88, 0xff6d,
+	0xff67, 0xff8f, 0xffac, 0xffce, 0xffd2, 0xffc1, 0xffc9, 0xffc7,
+	0xffe6, 0xffee, 0xfff5, 0xfff1, 0xffe5, 0xffff, 0x0010, 0x0007,
+	0x0010, 0xfffc, 0xfffb, 0x0001, 0x000f, 0x0017, 0x0010, 0x0008,
+	0xfffd, 0x0005, 0x000d, 0x0016, 0x0018, 0x000b, 0x000d, 0xffff,
+	0x0009, 0x0014, 0x001a, 0x0016, 0x0013, 0x0000, 0xfff9, 0xfff5,
+	0x0007, 0x000d, 0x0010, 0x0019, 0x0008, 0x000e, 0x0006, 0x0008,
+	0x000e, 0x0011, 0x001d, 0x0002, 0x0004, 0x0010, 0x0015, 0x0019,
+	0x0013, 0x000a, 0x0000, 0x0002, 0x0009, 0x000e, 0x000d, 0x0022,
+	0x0014, 0x0003, 0xfff4, 0xfff4, 0x000e, 0x001a, 0x0013, 0x0006,
+	0xfff2, 0xfffb, 0x0004, 0x000d, 0x000b, 0x0007, 0xfff1, 0xffed,
+	0xfffa, 0xfffe, 0x000b, 0x000c, 0x000b, 0xfff9, 0xffeb, 0xffeb,
+	0xfffa, 0xfffe, 0x0000, 0x0002, 0xfff5, 0xffe6, 0xfff4, 0x0001,
+	0xffff, 0x000f, 0x0008, 0x000f, 0x0002, 0xfff3, 0xfff5, 0xfff7,
+	0x0002, 0x0002, 0x000f, 0x0013, 0x0004, 0xfff0, 0xffe9, 0xffcb,
+	0xff94, 0xff81, 0xff8e, 0xff95, 0xffa7, 0xffab, 0xffc4, 0xffd2,
+	0xffde, 0xffe7, 0xffe8, 0xffe0, 0xffdc, 0xffe7, 0xfff9, 0x0002,
+	0x0017, 0x0012, 0x0000, 0xfff6, 0xfffd, 0x0011, 0x001a, 0x0024,
+	0x0017, 0x0015, 0x000e, 0x000b, 0x0019, 0x0016, 0x0026, 0x0017,
+	0x000f, 0x0009, 0x000e, 0x000f, 0x0020, 0x0020, 0x0025, 0x000b,
+	0x0002, 0xffff, 0x000d, 0x001b, 0x0014, 0x001b, 0x0008, 0xffff,
+	0x0003, 0x000d, 0x0015, 0x0019, 0x0013, 0xfffe, 0xfff8, 0xfff2,
+	0xffff, 0x0005, 0x0016, 0x001a, 0x0001, 0xfff0, 0xffed, 0xfffd,
+	0x0008, 0x000d, 0x000b, 0xffff, 0xfff1, 0xffe4, 0xfff4, 0x0001,
+	0xffff, 0x0001, 0xfff7, 0xffe8, 0xffea, 0xfff3, 0xfffb, 0x0005,
+	0x000d, 0x0009, 0xfff7, 0xfff4, 0xfff4, 0x0001, 0xfff8, 0x0000,
+	0xfff8, 0xffec, 0xfff4, 0x0001, 0x000e, 0x0000, 0xfffc, 0xfff0,
+	0xfffc, 0x0009, 0x0013, 0x0017, 0x0006, 0xfff5, 0xfff3, 0xffff,
+	0x0000, 0x0009, 0x001b, 0x000b, 0x0001, 0xfffd, 0xfffa, 0x0007,
+	0x000e, 0xffe7, 0xffa5, 0xff75, 0xff78, 0xff8e, 0xffb8, 0xffc7,
+	0xffc2, 0xffb9, 0xffc8, 0xffd8, 0xffee, 0xfff3, 0xffeb, 0xffe7,
+	0xffe9, 0xffee, 0x0002, 0x0004, 0x0018, 0x0018, 0x0002, 0x0001,
+	0x0008, 0x0012, 0x0019, 0x0018, 0x000b, 0x0000, 0x0009, 0x001c,
+	0x001b, 0x002a, 0x0013, 0x0010, 0x0007, 0x0013, 0x0018, 0x0025,
+	0x0020, 0x0027, 0x0017, 0x000a, 0xfffd, 0x000e, 0x000a, 0x0019,
+	0x0016, 0x000c, 0x000d, 0xfffa, 0x0003, 0x0011, 0x0017, 0x0019,
+	0x0010, 0xfffd, 0xfffa, 0x0003, 0x0013, 0x0018, 0x0017, 0x000f,
+	0x0004, 0xfff7, 0xfff0, 0xfff9, 0x0005, 0x0016, 0x0016, 0xfffc,
+	0xffff, 0xfff1, 0x0008, 0x000c, 0x000b, 0x000c, 0xfffb, 0xffeb,
+	0xfff5, 0xfffc, 0x000e, 0x000a, 0x000d, 0x0004, 0xfff1, 0xfff8,
+	0xfffd, 0x0001, 0x000d, 0x0009, 0x0001, 0xffe9, 0xffeb, 0xfffe,
+	0x0001, 0x000f, 0x000a, 0x0007, 0xfffa, 0xffe5, 0xfff7, 0x0001,
+	0x0000, 0x0011, 0xfffa, 0xfff7, 0xfff3, 0xfff4, 0xffff, 0xffff,
+	0x0001, 0xffec, 0xffe9, 0xffbf, 0xff90, 0xff77, 0xff7e, 0xff90,
+	0xffa0, 0xffa3, 0xffaa, 0xffb4, 0xffc3, 0xffe0, 0xffe0, 0xffe3,
+	0xffd8, 0xfff0, 0xfff3, 0x0001, 0x0000, 0xfff3, 0xfff6, 0x0001,
+	0x000e, 0x001a, 0x001d, 0x0015, 0x0002, 0x0003, 0x000e, 0x0016,
+	0x0027, 0x002b, 0x002b, 0x0017, 0x0017, 0x001a, 0x001e, 0x001f,
+	0x0027, 0x0013, 0x000f, 0x0012, 0x002a, 0x001d, 0x0029, 0x0015,
+	0x001a, 0x000e, 0x000b, 0x000c, 0x000b, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x0003, 0x000c, 0x000b, 0x000c, 0x000d, 0x0006, 0x0002,
+	0xfff9, 0xfffd, 0x0001, 0xffff, 0x0001, 0xfffe, 0x0001, 0x0001,
+	0xffff, 0x0001, 0xffff, 0xffff, 0x0003, 0xfffc, 0x0004, 0xfffd,
+	0x0002, 0xffff, 0x0000, 0x0000, 0x0008, 0x0000, 0x0000, 0xffff,
+	0x0003, 0x0007, 0xffff, 0x000a, 0xfffc, 0x0002, 0x0000, 0xffff,
+	0x0001, 0x0000, 0xffff, 0x0000, 0x0002, 0xfffc, 0x0006, 0xfffa,
+	0x0004, 0xfff1, 0xfff7, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff,
+	0xfffc, 0xfff0, 0xfff8, 0xfff9, 0xfffb, 0xffeb, 0xffa5, 0xff83,
+	0xff76, 0xff81, 0xff9e, 0xffad, 0xffb3, 0xffc6, 0xffd4, 0xffd6,
+	0xffe2, 0xffe2, 0xffec, 0xffe8, 0xfff6, 0xfff4, 0x0005, 0x000d,
+	0x000c, 0x000a, 0x0011, 0x0017, 0x0019, 0x0015, 0x001b, 0x0013,
+	0x001b, 0x0015, 0x0018, 0x0018, 0x0017, 0x0018, 0x0014, 0x000b,
+	0x000d, 0x001c, 0x0012, 0x001d, 0x0008, 0x0010, 0x0007, 0x0010,
+	0x0007, 0xffff, 0x0003, 0xfffc, 0x000e, 0x0004, 0x0000, 0xffff,
+	0x0002, 0xfffe, 0x0002, 0xfffe, 0x0002, 0xfffe, 0x0002, 0xffff,
+	0x0000, 0x0000, 0x0001, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0xffff, 0x0002, 0xfffe, 0x0001, 0x0006, 0x000e,
+	0x000a, 0x000e, 0x000a, 0x000c, 0x000c, 0x000c, 0x0006, 0xfffd,
+	0x0002, 0x0008, 0x0010, 0x0008, 0x000e, 0x0008, 0x0001, 0xfffe,
+	0x0008, 0x000b, 0x000b, 0x0005, 0xfffd, 0x0002, 0xffff, 0xffff,
+	0x0002, 0xfffd, 0xfff7, 0xfff9, 0x0003, 0xffff, 0x0000, 0x0001,
+	0xfff2, 0xfff6, 0xfff3, 0xfff5, 0xfff8, 0x0000, 0x0002, 0xffeb,
+	0xffab, 0xff80, 0xff74, 0xff7b, 0xff97, 0xffac, 0xffba, 0xffc8,
+	0xffcf, 0xffd7, 0xffd7, 0xffe2, 0xffea, 0xffed, 0xfff9, 0xffff,
+	0x000b, 0x000b, 0x000c, 0x000c, 0x0014, 0x0019, 0x0017, 0x0017,
+	0x0017, 0x0019, 0x0015, 0x001b, 0x0014, 0x001a, 0x0015, 0x0016,
+	0x0010, 0x000e, 0x0012, 0x0019, 0x0017, 0x0015, 0x000f, 0x0014,
+	0x000f, 0x000a, 0x000e, 0x0009, 0x000f, 0x0013, 0x0009, 0x000f,
+	0x0008, 0x000f, 0x000a, 0x000c, 0x000c, 0x000b, 0x000c, 0x000c,
+	0x000b, 0x0005, 0x000a, 0x000e, 0x0005, 0x0000, 0x000e, 0x000b,
+	0x000b, 0x000d, 0xfffb, 0x0004, 0xffff, 0xffff, 0x0005, 0x000d,
+	0x0006, 0x0001, 0xfffe, 0x0002, 0xfffe, 0x0003, 0xfffc, 0x0004,
+	0xfffc, 0x0003, 0xffff, 0x0000, 0x0000, 0x0000, 0xfffd, 0xfff3,
+	0xfff6, 0xfff2, 0xfff7, 0xfff1, 0xfff7, 0xfff3, 0xfff5, 0xfff4,
+	0xfff4, 0xfff5, 0xfff4, 0xfff3, 0xfff7, 0xfff0, 0xfff9, 0xfff1,
+	0xfff7, 0xfff1, 0xfff8, 0xfff0, 0xfff9, 0xffff, 0xfff8, 0x0001,
+	0x0000, 0xfff5, 0xffb7, 0xff82, 0xff79, 0xff77, 0xff9a, 0xffad,
+	0xffc7, 0xffc6, 0xffd4, 0xffd3, 0xffde, 0xffe0, 0xfff0, 0xfff6,
+	0xfff8, 0x0007, 0x000a, 0x000e, 0x0009, 0x0018, 0x0017, 0x0017,
+	0x0019, 0x0016, 0x0018, 0x0017, 0x0018, 0x0016, 0x0019, 0x0017,
+	0x0016, 0x001a, 0x0014, 0x001a, 0x0017, 0x000e, 0x001a, 0x000d,
+	0x001a, 0x000b, 0x0004, 0x000e, 0x000b, 0x000c, 0x000c, 0x0009,
+	0x0010, 0x0007, 0x0011, 0x0007, 0x0010, 0x0008, 0x000e, 0x0004,
+	0x000a, 0x000d, 0x000b, 0x000b, 0x000c, 0x000d, 0x0009, 0x000e,
+	0x000a, 0x000d, 0x000c, 0x0005, 0x0000, 0xffff, 0x0002, 0x000d,
+	0x000b, 0x0009, 0xfffb, 0x0003, 0xfffe, 0x0002, 0xfffe, 0x0001,
+	0xffff, 0x0001, 0x0000, 0xffff, 0xffff, 0xfff8, 0x0002, 0xfffc,
+	0xfff4, 0xffff, 0x0001, 0xffff, 0x0001, 0xffff, 0x0002, 0xfffd,
+	0x0003, 0xfffe, 0x0001, 0xffff, 0x0001, 0xffff, 0x0001, 0x0000,
+	0xfffa, 0xfffd, 0x0001, 0xfff7, 0x0001, 0x0000, 0x0000, 0x0000,
+	0x0001, 0xfffe, 0x0002, 0xfffb, 0xffbb, 0xff80, 0xff73, 0xff7d,
+	0xff95, 0xffaf, 0xffb9, 0xffc3, 0xffc7, 0xffcc, 0xffd7, 0xffde,
+	0xffe8, 0xfff1, 0xfff6, 0xfff4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0001, 0xffff, 0x000d, 0x0009, 0x000e, 0x000b, 0x000b, 0x000e,
+	0x0008, 0x000f, 0x0009, 0x000f, 0x0007, 0x0011, 0x0007, 0x000f,
+	0x000a, 0x000d, 0x0008, 0x0006, 0x000d, 0x000a, 0x000e, 0x000a,
+	0x000c, 0x000c, 0x000c, 0x000a, 0x000f, 0x000b, 0x001e, 0x0010,
+	0x000b, 0x000c, 0x000c, 0x000c, 0x000b, 0x000c, 0x000c, 0x000a,
+	0x000f, 0x0011, 0x000d, 0x000b, 0x000c, 0x0008, 0x0000, 0x000a,
+	0x000e, 0x000a, 0x000c, 0x000d, 0x0004, 0x0002, 0x000c, 0x0003,
+	0xfffd, 0x0002, 0x0000, 0xfffe, 0x0003, 0xfffd, 0x0002, 0xfffd,
+	0xfff9, 0x0002, 0xffff, 0x0001, 0xffff, 0x0001, 0xffff, 0x0001,
+	0x0000, 0xfffe, 0xfff9, 0xfff9, 0xfff6, 0x0004, 0xfffd, 0x0001,
+	0x0000, 0x0000, 0x0000, 0x0001, 0xfffe, 0x0002, 0xfffe, 0x0003,
+	0xfffd, 0x0002, 0xfffe, 0x0002, 0xffff, 0xfff7, 0xffbb, 0xff88,
+	0xff72, 0xff7b, 0xff92, 0xffa4, 0xffba, 0xffb9, 0xffc6, 0xffcd,
+	0xffd5, 0xffe1, 0xffe4, 0xffee, 0xfff7, 0xfff2, 0xfffd, 0x0003,
+	0xfffe, 0x000e, 0x000b, 0x000e, 0x001c, 0x0013, 0x001b, 0x0015,
+	0x0019, 0x0017, 0x0016, 0x001a, 0x0015, 0x001a, 0x0015, 0x0018,
+	0x0018, 0x0017, 0x0018, 0x0017, 0x0017, 0x0018, 0x0017, 0x0018,
+	0x0011, 0x000b, 0x000c, 0x000b, 0x000c, 0x000c, 0x000b, 0x000e,
+	0x0008, 0x000f, 0x0009, 0x0006, 0x000b, 0x0003, 0xfffe, 0x0002,
+	0x000d, 0x000a, 0x000e, 0x0001, 0x0000, 0x0001, 0xfffc, 0xfffa,
+	0x0003, 0xfffd, 0x0003, 0xfffd, 0x0004, 0xfff5, 0xfff5, 0xfff4,
+	0xfff4, 0xfff6, 0xfff1, 0xfff8, 0xfff0, 0xfff9, 0xfff1, 0xfff5,
+	0xfff6, 0xfff0, 0xfffb, 0xfffe, 0x0001, 0x0000, 0x0000, 0xfffe,
+	0x0004, 0xfff8, 0xfffb, 0xfffb, 0xffff, 0x0002, 0x0007, 0x000f,
+	0x0000, 0x0002, 0xfffd, 0x0003, 0xfffc, 0x0009, 0x0008, 0x0002,
+	0xffff, 0x0000, 0x0001, 0xffff, 0x0000, 0x0001, 0xffff, 0xfffe,
+	0xffcb, 0xff93, 0xff73, 0xff78, 0xff8c, 0xffa8, 0xffb4, 0xffbe,
+	0xffcc, 0xffd5, 0xffdc, 0xffe0, 0xffea, 0xffe7, 0xfff0, 0xfff3,
+	0xfffc, 0xfffe, 0x0008, 0x000c, 0x000b, 0x0016, 0x0013, 0x0011,
+	0x000f, 0x0008, 0x0012, 0x0018, 0x0018, 0x0018, 0x0016, 0x0018,
+	0x0013, 0x0012, 0x001a, 0x0016, 0x0018, 0x0018, 0x0015, 0x001a,
+	0x0015, 0x001a, 0x0009, 0x000e, 0x000a, 0x000d, 0x000b, 0x000c,
+	0x000b, 0x000d, 0x000a, 0x000d, 0x000c, 0x000a, 0x000d, 0x000b,
+	0x000c, 0x000d, 0x000a, 0x000c, 0x000b, 0xfffd, 0x0003, 0xfffd,
+	0x000c, 0x000a, 0x000e, 0x0006, 0xfffd, 0x0003, 0xfffd, 0x0003,
+	0xfffe, 0x0001, 0xffff, 0x0005, 0x000b, 0x000e, 0x0001, 0x0001,
+	0x0000, 0xfffd, 0xfff9, 0x0004, 0xfffd, 0x0002, 0xfffe, 0x0001,
+	0xffff, 0x0002, 0xffff, 0x0001, 0xfffe, 0x0002, 0xfffd, 0x0004,
+	0xfffc, 0x0003, 0xffff, 0xffff, 0xfff3, 0xfffe, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0001, 0xfffd, 0xfff6, 0xfff2, 0xfff6, 0xfff2,
+	0xfff7, 0xfff2, 0xffd0, 0xff82, 0xff71, 0xff65, 0xff7a, 0xff8f,
+	0xffa8, 0xffb5, 0xffbf, 0xffc6, 0xffc9, 0xffd2, 0xffdc, 0xffe4,
+	0xffea, 0xffee, 0xfff7, 0xfff7, 0x0008, 0x000a, 0x000c, 0x000c,
+	0x000b, 0x000d, 0x000d, 0x001a, 0x0015, 0x0018, 0x001f, 0x0017,
+	0x0019, 0x0017, 0x0019, 0x0014, 0x001b, 0x0013, 0x001c, 0x001e,
+	0x0015, 0x001b, 0x0014, 0x001c, 0x0009, 0x0013, 0x0016, 0x0018,
+	0x0017, 0x0019, 0x0011, 0x0011, 0x000d, 0x0008, 0x0010, 0x0007,
+	0x0010, 0x0009, 0x000d, 0x000d, 0x0004, 0xffff, 0x0000, 0xffff,
+	0x0006, 0x000f, 0x000b, 0x0002, 0xfffe, 0x0001, 0xfffe, 0x0003,
+	0xfffd, 0x0003, 0xffff, 0x0000, 0x0006, 0x0001, 0x0000, 0xffff,
+	0x0001, 0x0002, 0xfffe, 0x0003, 0x0002, 0x000a, 0x0001, 0xfffd,
+	0x0003, 0x0000, 0x0001, 0x0002, 0xffff, 0xffff, 0xfffd, 0x0000,
+	0x0000, 0x0003, 0xffff, 0x0004, 0xfff1, 0xfff7, 0xfffa, 0x0002,
+	0xfffd, 0x0002, 0xffff, 0xfffa, 0x0005, 0xfffd, 0xffff, 0xffed,
+	0xfff9, 0xffff, 0x0001, 0x0006, 0xffda, 0xff90, 0xff70, 0xff66,
+	0xff79, 0xffa4, 0xffb0, 0xffc1, 0xffca, 0xffd1, 0xffd3, 0xffda,
+	0xffe5, 0xffe6, 0xfff3, 0xfff6, 0xfff5, 0x0005, 0x000d, 0x000a,
+	0x000b, 0x000c, 0x0009, 0x0011, 0x001a, 0x0016, 0x001b, 0x0013,
+	0x0019, 0x0014, 0x001b, 0x0014, 0x001e, 0x0013, 0x001b, 0x0013,
+	0x0018, 0x0015, 0x001b, 0x000c, 0x000f, 0x000b, 0x000d, 0x0006,
+	0x0005, 0x0008, 0x0002, 0xffff, 0x0006, 0xffff, 0x0002, 0xfffb,
+	0x0001, 0xfffb, 0x0002, 0x0001, 0x0003, 0x0002, 0x0002, 0xfff6,
+	0xfffc, 0x0000, 0xfffc, 0x0003, 0x0002, 0x0002, 0x0003, 0xfffd,
+	0xffff, 0xfffc, 0x0001, 0xfffe, 0x000f, 0x000c, 0x000f, 0x000a,
+	0x0000, 0xfffd, 0x0000, 0x0000, 0x000c, 0x000f, 0x000a, 0x000c,
+	0x0009, 0x000a, 0x000c, 0xffff, 0x0004, 0x0001, 0x0000, 0x000b,
+	0x0007, 0x0008, 0xfffc, 0x0006, 0x0002, 0x0005, 0xfffc, 0x0000,
+	0xfff8, 0xffff, 0x0000, 0x0002, 0x0008, 0x0002, 0x0003, 0xffef,
+	0xfff6, 0xfffc, 0xfffd, 0x0003, 0x0008, 0x0001, 0xffdf, 0xff99,
+	0xff60, 0xff66, 0xff76, 0xffa4, 0xffae, 0xffc7, 0xffc9, 0xffd0,
+	0xffd2, 0xffd6, 0xffdb, 0xffeb, 0xfff7, 0xfffe, 0x0008, 0x0002,
+	0x000a, 0x0005, 0x0003, 0x000d, 0x0016, 0x0020, 0x001c, 0x001c,
+	0x0016, 0x0012, 0x0012, 0x0014, 0x0016, 0x001f, 0x001b, 0x001b,
+	0x0018, 0x000b, 0x0012, 0x000e, 0x000b, 0x0010, 0x0013, 0x001a,
+	0x0017, 0x0013, 0x0011, 0x0008, 0x000d, 0x0011, 0x0011, 0x000f,
+	0x0008, 0x0007, 0x0006, 0x0007, 0x0012, 0x000a, 0x0010, 0x0002,
+	0x0006, 0x0006, 0x0002, 0x0009, 0x000d, 0x0014, 0x0016, 0x0010,
+	0x0003, 0xfff5, 0xfff7, 0xfff9, 0x0007, 0x0017, 0x0017, 0x0010,
+	0x0000, 0xfff7, 0xfff3, 0xfff7, 0xfffe, 0x0007, 0x0011, 0x0007,
+	0x0007, 0xfff5, 0xfff4, 0xfff2, 0xfffd, 0xfffa, 0x0006, 0x000a,
+	0x0008, 0xfff9, 0xffed, 0xffe1, 0xfff0, 0xfff6, 0x0006, 0x0005,
+	0xfffd, 0xfff2, 0xffe2, 0xffe4, 0xffe9, 0xfff4, 0xfffe, 0x0008,
+	0x0002, 0xfff3, 0xffe5, 0xffe6, 0xfff2, 0xffed, 0x0007, 0x0008,
+	0xfff1, 0xff97, 0xff6d, 0xff56, 0xff59, 0xff96, 0xffae, 0xffd6,
+	0xffda, 0xffdd, 0xffc5, 0xffc3, 0xffcf, 0xffe5, 0xfffd, 0x000f,
+	0x001a, 0x0013, 0x0007, 0xfff8, 0xfffb, 0x000a, 0x0018, 0x002c,
+	0x002e, 0x002b, 0x0016, 0x0017, 0xffff, 0x0005, 0x0016, 0x0031,
+	0x0039, 0x0039, 0x0023, 0x0012, 0xfffd, 0xfffa, 0x000d, 0x001f,
+	0x002c, 0x0029, 0x0020, 0x0005, 0xfffb, 0xfff9, 0x0005, 0x000e,
+	0x001e, 0x0017, 0x0019, 0x0003, 0x0003, 0xfffb, 0x0006, 0x0004,
+	0x000b, 0x0017, 0x0011, 0x0008, 0x0003, 0xffff, 0x000a, 0x000e,
+	0x0017, 0x0013, 0x0002, 0xfff9, 0xfff7, 0xffff, 0x000e, 0x0011,
+	0x0014, 0x0007, 0xfffa, 0xfff3, 0xfff5, 0xfff6, 0x0003, 0x0009,
+	0x000f, 0x000b, 0xfffc, 0xfff7, 0xffec, 0xfff8, 0xffff, 0x000f,
+	0x0011, 0x000d, 0x0001, 0xfff1, 0xffee, 0xfff1, 0xfffd, 0x0010,
+	0x0010, 0x0015, 0x0001, 0xfff6, 0xffe9, 0xffef, 0xfff7, 0x000f,
+	0x0011, 0x0017, 0x0007, 0xfff8, 0xffec, 0xffe8, 0xfff9, 0x0003,
+	0x000e, 0x0008, 0xfff7, 0xffa2, 0xff62, 0xff5a, 0xff60, 0xff97,
+	0xffbf, 0xffce, 0xffd4, 0xffc3, 0xffc1, 0xffc6, 0xffcf, 0xffe4,
+	0xfffd, 0x000c, 0x0001, 0x0000, 0xfff2, 0xfffa, 0xfffa, 0x0005,
+	0x0016, 0x001e, 0x001b, 0x0017, 0xffff, 0xffff, 0xfff8, 0x0007,
+	0x001e, 0x0024, 0x002a, 0x0016, 0x0007, 0x0000, 0xfffa, 0x0004,
+	0x000d, 0x0017, 0x001b, 0x0014, 0x000d, 0xffff, 0x0001, 0x0001,
+	0x000d, 0x000d, 0x0014, 0x0017, 0x000a, 0x0008, 0xfffd, 0x0009,
+	0x0004, 0x000f, 0x0014, 0x0012, 0x000a, 0x0009, 0x0002, 0x0003,
+	0x0008, 0x0015, 0x0010, 0x000f, 0x000a, 0x0004, 0x0007, 0x0009,
+	0x0010, 0x0013, 0x0012, 0xfffd, 0x0008, 0xffff, 0x0007, 0x0009,
+	0x0015, 0x0015, 0x000f, 0x0004, 0xfffa, 0xfff1, 0xfff8, 0xfffe,
+	0x0009, 0x000e, 0x000d, 0x0000, 0xfff9, 0xffed, 0xffe3, 0xfff8,
+	0x0008, 0x0010, 0x0011, 0x0001, 0xfffb, 0xffee, 0xffee, 0xfffd,
+	0x0004, 0x0016, 0x000f, 0x0008, 0xfff7, 0xfff0, 0xffeb, 0xfffb,
+	0x0004, 0x0016, 0x0013, 0x0005, 0xffeb, 0xff9e, 0xff67, 0xff5f,
+	0xff75, 0xffac, 0xffbf, 0xffbb, 0xffb4, 0xffb0, 0xffb9, 0xffcd,
+	0xffe1, 0xfffa, 0x0009, 0x0005, 0xfff0, 0xffe7, 0xfff3, 0xfff7,
+	0x000e, 0x0026, 0x003a, 0x0028, 0x001c, 0x0001, 0xfffa, 0x0001,
+	0x0012, 0x0029, 0x003a, 0x0038, 0x001b, 0x000a, 0xfff7, 0xffff,
+	0x000b, 0x0026, 0x0034, 0x0036, 0x0020, 0x0004, 0xfffe, 0xfff9,
+	0x0001, 0x0015, 0x0027, 0x002a, 0x0021, 0x0004, 0xffee, 0xfff0,
+	0xfffa, 0x000c, 0x002c, 0x0029, 0x001c, 0x0005, 0xffea, 0xffee,
+	0xfff4, 0x0010, 0x0025, 0x0025, 0x0017, 0xfff6, 0xffdd, 0xffd5,
+	0xffe3, 0x0008, 0x0024, 0x0029, 0x0016, 0xfff4, 0xffd1, 0xffcd,
+	0xffc9, 0xffee, 0x001a, 0x0033, 0x002e, 0x0003, 0xffd5, 0xffaf,
+	0xffb4, 0xffdd, 0x001a, 0x0045, 0x004e, 0x0025, 0xffe5, 0xffb4,
+	0xffab, 0xffc2, 0xfffe, 0x003a, 0x005e, 0x004b, 0x000e, 0xffcb,
+	0xffa6, 0xffa7, 0xffdc, 0x001d, 0x0061, 0x006b, 0x0038, 0xffee,
+	0xffb0, 0xff9b, 0xffbd, 0x000a, 0x0051, 0x0071, 0x0050, 0xffc8,
+	0xff4d, 0xff12, 0xff1b, 0xff6a, 0xffcd, 0x000f, 0x0023, 0xfff7,
+	0xffbc, 0xff8c, 0xff83, 0xffa8, 0xfffb, 0x0038, 0x0053, 0x0038,
+	0x0009, 0xffcc, 0xffba, 0xffcd, 0x0009, 0x003f, 0x005f, 0x0049,
+	0x0024, 0xffe3, 0xffcd, 0xffdb, 0x000e, 0x0046, 0x005b, 0x0051,
+	0x0024, 0xffe6, 0xffd0, 0xffd7, 0x000f, 0x0045, 0x0065, 0x0058,
+	0x001d, 0xffdb, 0xffc1, 0xffd5, 0x0004, 0x004a, 0x0069, 0x005b,
+	0x0020, 0xffdf, 0xffb5, 0xffb8, 0xffee, 0x0035, 0x0065, 0x0065,
+	0x0031, 0xffe9, 0xffaf, 0xffa7, 0xffd3, 0x001c, 0x0063, 0x006b,
+	0x0044, 0xffed, 0xffb1, 0xff9d, 0xffc5, 0x000c, 0x0057, 0x006f,
+	0x0044, 0xfffa, 0xffba, 0xffa3, 0xffc1, 0x0000, 0x0042, 0x0059,
+	0x0042, 0x0002, 0xffd5, 0xffa9, 0xffc3, 0x0000, 0x003b, 0x0059,
+	0x003b, 0x0001, 0xffc0, 0xffac, 0xffc0, 0x0004, 0x003c, 0x005f,
+	0x003c, 0x0002, 0xffba, 0xffa3, 0xffbb, 0xfffe, 0x0044, 0x0067,
+	0x004a, 0xfffd, 0xffac, 0xff91, 0xffa3, 0xfff0, 0x0040, 0x0062,
+	0x0050, 0xffce, 0xff39, 0xfeee, 0xfeef, 0xff53, 0xffc3, 0x001b,
+	0x0028, 0xfff4, 0xff9e, 0xff5e, 0xff54, 0xff8e, 0xfff4, 0x004a,
+	0x006a, 0x004c, 0xfff9, 0xffb6, 0xff8e, 0xffb0, 0xfff7, 0x0045,
+	0x0082, 0x0079, 0x0041, 0xffed, 0xffb8, 0xffb1, 0xffe3, 0x0028,
+	0x006f, 0x0084, 0x0068, 0x0022, 0xffe7, 0xffc7, 0xffda, 0x000e,
+	0x004a, 0x0062, 0x006c, 0x0037, 0x0008, 0xffd1, 0xffcd, 0xffe1,
+	0x000f, 0x003b, 0x0055, 0x0052, 0x002b, 0xfff8, 0xffca, 0xffc5,
+	0xffe9, 0x0012, 0x0042, 0x0055, 0x0039, 0x000f, 0xffe0, 0xffc0,
+	0xffcd, 0xffee, 0x0020, 0x0049, 0x004b, 0x0029, 0xffeb, 0xffbb,
+	0xffab, 0xffcb, 0x0004, 0x0045, 0x0056, 0x0047, 0x0006, 0xffc5,
+	0xffa0, 0xffaf, 0xffeb, 0x003b, 0x0069, 0x0059, 0x0025, 0xffc3,
+	0xffa0, 0xff90, 0xffde, 0x0028, 0x006c, 0x0073, 0x003c, 0xffdf,
+	0xff92, 0xff7d, 0xffb7, 0x001a, 0x0072, 0x008e, 0x0057, 0xfff4,
+	0xff8a, 0xff67, 0xff83, 0x0004, 0x0072, 0x00a9, 0x007f, 0x000e,
+	0xff92, 0xff4a, 0xff64, 0xff99, 0xffe9, 0x0029, 0x0012, 0xffb5,
+	0xff46, 0xfeed, 0xfef4, 0xff63, 0x000f, 0x0094, 0x00b7, 0x0056,
+	0xffc0, 0xff35, 0xff10, 0xff6a, 0x0013, 0x00bf, 0x00fe, 0x00c1,
+	0x001d, 0xff83, 0xff20, 0xff49, 0xffde, 0x0093, 0x0105, 0x00fb,
+	0x0076, 0xffc1, 0xff3d, 0xff25, 0xff99, 0x003f, 0x00dd, 0x0105,
+	0x00ba, 0x0012, 0xff6a, 0xff29, 0xff52, 0xfff2, 0x0082, 0x00dc,
+	0x00d2, 0x0054, 0xffb8, 0xff4b, 0xff3b, 0xff95, 0x0018, 0x0095,
+	0x00b6, 0x0085, 0x000d, 0xff98, 0xff59, 0xff68, 0xffc9, 0x0040,
+	0x0088, 0x008f, 0x0050, 0xffe8, 0xff97, 0xff77, 0xffa1, 0xfff0,
+	0x0051, 0x0079, 0x006c, 0x002e, 0xffd3, 0xff9e, 0xff8e, 0xffc1,
+	0x000a, 0x0059, 0x007b, 0x005d, 0x001b, 0xffcd, 0xffa1, 0xffb3,
+	0xffe6, 0x003d, 0x006a, 0x0076, 0x0039, 0xffef, 0xffa8, 0xffa2,
+	0xffcf, 0x001a, 0x005c, 0x0076, 0x0053, 0x0003, 0xffa2, 0xff84,
+	0xffa5, 0x000b, 0x005d, 0x0089, 0x006a, 0x0003, 0xff9a, 0xff5e,
+	0xff84, 0xffee, 0x006a, 0x00b1, 0x008a, 0xffea, 0xff1b, 0xfeab,
+	0xfeb6, 0xff3e, 0xfff9, 0x006d, 0x008c, 0x0010, 0xff81, 0xff00,
+	0xfef8, 0xff6d, 0x0017, 0x00bf, 0x00e3, 0x009f, 0xfff6, 0xff5b,
+	0xff12, 0xff5e, 0x0007, 0x00b0, 0x0103, 0x00d7, 0x0044, 0xffa3,
+	0xff42, 0xff61, 0xffde, 0x0065, 0x00c9, 0x00b8, 0x0061, 0xffde,
+	0xff99, 0xff9c, 0xffde, 0x0032, 0x0068, 0x0057, 0x001d, 0xfff5,
+	0xffe4, 0x0009, 0x0044, 0x004f, 0x001b, 0xffc9, 0xff81, 0xff98,
+	0xfff0, 0x0091, 0x00ef, 0x00e4, 0x003a, 0xff5d, 0xfec4, 0xfed0,
+	0xff9b, 0x00bd, 0x01b3, 0x01c1, 0x00d6, 0xff57, 0xfe16, 0xfdda,
+	0xfeb8, 0x0070, 0x0218, 0x02c1, 0x01f7, 0x0003, 0xfdf9, 0xfceb,
+	0xfd88, 0xff7d, 0x01d9, 0x0365, 0x0317, 0x011e, 0xfe78, 0xfc8d,
+	0xfc70, 0xfe3b, 0x00fc, 0x034b, 0x03ed, 0x026f, 0xff9d, 0xfcf9,
+	0xfbef, 0xfcfe, 0xff9d, 0x027b, 0x0409, 0x0371, 0x00fc, 0xfe00,
+	0xfc18, 0xfc33, 0xfe37, 0x0119, 0x0372, 0x03db, 0x0248, 0xff73,
+	0xfd06, 0xfc15, 0xfd33, 0xffa6, 0x0240, 0x039c, 0x0318, 0x00d2,
+	0xfdf7, 0xfc18, 0xfc0d, 0xfdc5, 0x0060, 0x027b, 0x0322, 0x0213,
+	0xffd2, 0xfd9c, 0xfc69, 0xfd10, 0xff20, 0x01a2, 0x0350, 0x035a,
+	0x01ae, 0xff29, 0xfced, 0xfc3b, 0xfd8b, 0x0051, 0x0308, 0x0462,
+	0x038d, 0x00f7, 0xfd9b, 0xfb63, 0xfb99, 0xfe56, 0x022f, 0x052d,
+	0x05ac, 0x0335, 0xfed0, 0xfab7, 0xf952, 0xfb90, 0x008b, 0x057c,
+	0x07f2, 0x0632, 0x0101, 0xfac9, 0xf705, 0xf813, 0xfda5, 0x04d6,
+	0x09e1, 0x09d9, 0x0482, 0xfc32, 0xf57f, 0xf42b, 0xf970, 0x02a2,
+	0x0ad1, 0x0db9, 0x09c3, 0x0008, 0xf46c, 0xef22, 0xf345, 0xfeab,
+	0x0b42, 0x124b, 0x0fce, 0x04cc, 0xf694, 0xecd0, 0xed83, 0xf82e,
+	0x077c, 0x132c, 0x14dd, 0x0b40, 0xfb57, 0xed71, 0xe930, 0xf159,
+	0x01a6, 0x1141, 0x1800, 0x11da, 0x0243, 0xf0cc, 0xe750, 0xeb19,
+	0xfa3f, 0x0cbf, 0x1891, 0x1742, 0x099d, 0xf67d, 0xe839, 0xe6ae,
+	0xf2be, 0x061f, 0x163d, 0x1a95, 0x109a, 0xfdee, 0xebe5, 0xe4bc,
+	0xec3f, 0xfe5e, 0x116e, 0x1b33, 0x166e, 0x059f, 0xf1a9, 0xe57b,
+	0xe761, 0xf662, 0x0a55, 0x1892, 0x198e, 0x0c60, 0xf891, 0xe842,
+	0xe49c, 0xef5c, 0x02d3, 0x14d9, 0x1b70, 0x135b, 0x00c4, 0xedc3,
+	0xe48f, 0xe9b9, 0xfb16, 0x0ef4, 0x1ad4, 0x1874, 0x08f1, 0xf4de,
+	0xe68b, 0xe5ef, 0xf33d, 0x074e, 0x17ba, 0x1b5e, 0x10b9, 0xfcd7,
+	0xeaf0, 0xe417, 0xec0c, 0xfeb7, 0x1215, 0x1c12, 0x16fe, 0x05cf,
+	0xf162, 0xe4c4, 0xe69e, 0xf5ba, 0x0aa9, 0x19f4, 0x1b98, 0x0ea1,
+	0xf9b0, 0xe870, 0xe342, 0xed82, 0x0180, 0x1501, 0x1d6f, 0x164e,
+	0x0355, 0xee93, 0xe2ff, 0xe6b8, 0xf7d7, 0x0d67, 0x1c0c, 0x1bfd,
+	0x0cfb, 0xf701, 0xe5e9, 0xe26b, 0xeeb9, 0x0405, 0x17d2, 0x1e7c,
+	0x15df, 0x00fb, 0xebb6, 0xe18b, 0xe71b, 0xfa47, 0x103f, 0x1dfb,
+	0x1bcd, 0x0a9c, 0xf409, 0xe398, 0xe24b, 0xf0b2, 0x0700, 0x1a46,
+	0x1f0a, 0x1390, 0xfd70, 0xe8de, 0xe059, 0xe8bf, 0xfd94, 0x137c,
+	0x1f55, 0x1a6a, 0x0766, 0xf079, 0xe1a7, 0xe34c, 0xf3d0, 0x0af0,
+	0x1c81, 0x1e77, 0x106d, 0xf966, 0xe648, 0xe068, 0xeb8a, 0x01a1,
+	0x16bd, 0x1fe5, 0x17e4, 0x031c, 0xec9e, 0xe01b, 0xe4a1, 0xf759,
+	0x0eae, 0x1dd4, 0x1cb5, 0x0c50, 0xf50c, 0xe3c3, 0xe12b, 0xef09,
+	0x05ea, 0x198a, 0x1f7b, 0x14ae, 0xfecd, 0xe980, 0xe066, 0xe816,
+	0xfc48, 0x12d3, 0x1f3e, 0x1afb, 0x0865, 0xf15e, 0xe25c, 0xe2dc,
+	0xf32b, 0x0a39, 0x1bf9, 0x1ed0, 0x1134, 0xfad6, 0xe6e3, 0xe09d,
+	0xeb04, 0x0081, 0x1603, 0x1fb5, 0x1879, 0x044a, 0xedfd, 0xe153,
+	0xe4ce, 0xf6f6, 0x0dd9, 0x1da3, 0x1d6a, 0x0dc1, 0xf70e, 0xe4af,
+	0xe140, 0xedea, 0x0469, 0x1899, 0x1fa7, 0x15d0, 0x0083, 0xeb11,
+	0xe098, 0xe6c2, 0xfa93, 0x1117, 0x1ea6, 0x1baa, 0x0a65, 0xf389,
+	0xe30b, 0xe234, 0xf10b, 0x0805, 0x1a86, 0x1f1b, 0x12e6, 0xfcd7,
+	0xe874, 0xe067, 0xe90e, 0xfe40, 0x140b, 0x1f54, 0x19b1, 0x06d0,
+	0xf01c, 0xe1b7, 0xe3aa, 0xf47d, 0x0bad, 0x1c62, 0x1e18, 0x0fc0,
+	0xf91e, 0xe612, 0xe0cc, 0xec0e, 0x0241, 0x16fb, 0x1f88, 0x1736,
+	0x02da, 0xecbe, 0xe0e7, 0xe5bf, 0xf88e, 0x0f6b, 0x1dec, 0x1caa,
+	0x0c0b, 0xf513, 0xe3fa, 0xe1a4, 0xef8e, 0x065b, 0x1955, 0x1ec4,
+	0x1381, 0xfdec, 0xe903, 0xe00c, 0xe7d6, 0xfc71, 0x12df, 0x1ef0,
+	0x1a80, 0x07bf, 0xf0fd, 0xe1fe, 0xe2f7, 0xf34a, 0x0a90, 0x1c26,
+	0x1ea8, 0x10cd, 0xfa39, 0xe698, 0xe082, 0xeb51, 0x0130, 0x1677,
+	0x1fd8, 0x1853, 0x03db, 0xed8f, 0xe0e4, 0xe4fb, 0xf759, 0x0ea6,
+	0x1df9, 0x1d9d, 0x0d5b, 0xf60b, 0xe44f, 0xe128, 0xee9b, 0x0552,
+	0x1945, 0x1fc0, 0x156a, 0xffc2, 0xea57, 0xe058, 0xe76e, 0xfb1a,
+	0x1204, 0x1f10, 0x1b77, 0x0949, 0xf251, 0xe29d, 0xe273, 0xf223,
+	0x0915, 0x1b68, 0x1f03, 0x1221, 0xfbbb, 0xe7a1, 0xe077, 0xea29,
+	0xff2c, 0x152b, 0x1f70, 0x1918, 0x0545, 0xef14, 0xe18e, 0xe43d,
+	0xf5f6, 0x0cc5, 0x1d06, 0x1dc3, 0x0e9d, 0xf7c5, 0xe55b, 0xe111,
+	0xed4a, 0x0331, 0x17e3, 0x1f8d, 0x165a, 0x0142, 0xebbf, 0xe0d3,
+	0xe66b, 0xf9a9, 0x1071, 0x1e5c, 0x1c33, 0x0ae1, 0xf3ef, 0xe35d,
+	0xe1f7, 0xf0a2, 0x073b, 0x1a79, 0x1f2c, 0x1373, 0xfd61, 0xe8af,
+	0xe05c, 0xe8cf, 0xfdb6, 0x13e8, 0x1f45, 0x1a35, 0x06f8, 0xf02a,
+	0xe152, 0xe2b3, 0xf39e, 0x0a97, 0x1c1e, 0x1e00, 0x0fd6, 0xf919,
+	0xe5a4, 0xe04f, 0xeb6f, 0x0199, 0x16e5, 0x1fb8, 0x17ba, 0x02db,
+	0xecb0, 0xe089, 0xe536, 0xf816, 0x0f35, 0x1e77, 0x1d10, 0x0c7d,
+	0xf530, 0xe3d2, 0xe156, 0xef2f, 0x0644, 0x19d6, 0x1ff4, 0x14c9,
+	0xfeef, 0xe98f, 0xe010, 0xe802, 0xfc4e, 0x130a, 0x1f85, 0x1b2a,
+	0x0893, 0xf147, 0xe218, 0xe2ad, 0xf316, 0x0a6d, 0x1c28, 0x1f1b,
+	0x113d, 0xfaaf, 0xe68d, 0xe03c, 0xeae6, 0x00a1, 0x167d, 0x1fed,
+	0x18a0, 0x0417, 0xed91, 0xe0d2, 0xe46e, 0xf728, 0x0e5a, 0x1e02,
+	0x1da4, 0x0d70, 0xf684, 0xe404, 0xe0ef, 0xee35, 0x04fd, 0x1940,
+	0x1fcf, 0x15b6, 0xffdc, 0xea42, 0xe027, 0xe6df, 0xfb29, 0x11e0,
+	0x1f46, 0x1bbd, 0x099d, 0xf282, 0xe247, 0xe231, 0xf1b4, 0x091e,
+	0x1b89, 0x1f52, 0x126d, 0xfbc9, 0xe76e, 0xe00c, 0xe9b4, 0xff1b,
+	0x1547, 0x1fdd, 0x1979, 0x05bd, 0xeecf, 0xe102, 0xe3d7, 0xf579,
+	0x0cbf, 0x1d4b, 0x1e30, 0x0efc, 0xf7d4, 0xe507, 0xe09f, 0xecd2,
+	0x0334, 0x1810, 0x1f85, 0x164c, 0x00f3, 0xeb24, 0xdff2, 0xe594,
+	0xf92c, 0x1019, 0x1e72, 0x1c44, 0x0b07, 0xf3e9, 0xe305, 0xe1a7,
+	0xf02b, 0x070a, 0x1a84, 0x1f69, 0x13cc, 0xfd7f, 0xe8cb, 0xe037,
+	0xe8b8, 0xfd7d, 0x13c1, 0x1fb5, 0x1a7e, 0x078b, 0xf060, 0xe1cf,
+	0xe345, 0xf3d8, 0x0b4e, 0x1c9a, 0x1ec0, 0x1076, 0xf988, 0xe674,
+	0xe059, 0xebb5, 0x016e, 0x16d3, 0x1ff3, 0x1803, 0x0364, 0xed0b,
+	0xe0c4, 0xe52b, 0xf7a2, 0x0e9d, 0x1e29, 0x1d36, 0x0cc8, 0xf59c,
+	0xe406, 0xe11d, 0xeec2, 0x055d, 0x196b, 0x1fb9, 0x1542, 0xff34,
+	0xe9fa, 0xe044, 0xe771, 0xfb84, 0x121a, 0x1f4b, 0x1b84, 0x0921,
+	0xf1e5, 0xe264, 0xe250, 0xf22e, 0x0947, 0x1bad, 0x1f25, 0x1228,
+	0xfb6b, 0xe750, 0xe03b, 0xea2a, 0xff70, 0x1552, 0x1fdf, 0x1946,
+	0x0552, 0xeeb5, 0xe137, 0xe414, 0xf5e2, 0x0cfe, 0x1d79, 0x1df1,
+	0x0ec7, 0xf77f, 0xe4f5, 0xe0ae, 0xed11, 0x0379, 0x1836, 0x1ffc,
+	0x16a8, 0x0152, 0xeb7f, 0xe051, 0xe621, 0xf9b8, 0x109f, 0x1ed4,
+	0x1c60, 0x0b10, 0xf3b8, 0xe30b, 0xe145, 0xeff6, 0x06d8, 0x1a19,
+	0x1f14, 0x134c, 0xfcfd, 0xe817, 0xdfac, 0xe85b, 0xfd8a, 0x13e8,
+	0x1fa3, 0x1a5a, 0x0719, 0xefe9, 0xe143, 0xe314, 0xf423, 0x0b96,
+	0x1cfd, 0x1ec5, 0x1097, 0xf92a, 0xe5d7, 0xe02e, 0xebb2, 0x022a,
+	0x1747, 0x206a, 0x17f2, 0x032c, 0xec9f, 0xe043, 0xe528, 0xf81a,
+	0x0f84, 0x1e9f, 0x1d5a, 0x0cb4, 0xf518, 0xe398, 0xe0ea, 0xef18,
+	0x063c, 0x1a09, 0x2022, 0x14f3, 0xff07, 0xe94e, 0xdfc9, 0xe7b3,
+	0xfc39, 0x131e, 0x1f9f, 0x1b7d, 0x08bc, 0xf121, 0xe1e3, 0xe248,
+	0xf2c4, 0x0a44, 0x1c48, 0x1f3d, 0x1195, 0xfabe, 0xe68e, 0xdffd,
+	0xeaa5, 0x0073, 0x1631, 0x2013, 0x1912, 0x0480, 0xedb1, 0xe0a5,
+	0xe43a, 0xf696, 0x0dea, 0x1e14, 0x1dd7, 0x0df3, 0xf6aa, 0xe435,
+	0xe0a7, 0xedbb, 0x048c, 0x18f9, 0x2000, 0x1611, 0x0049, 0xea82,
+	0xe00c, 0xe6a1, 0xfa8c, 0x1189, 0x1f24, 0x1c0c, 0x0a15, 0xf2c9,
+	0xe264, 0xe1d1, 0xf14d, 0x0866, 0x1b3e, 0x1f7d, 0x12f9, 0xfc1f,
+	0xe7c2, 0xdfea, 0xe962, 0xfe64, 0x14b8, 0x1fd9, 0x1993, 0x05ac,
+	0xeec1, 0xe094, 0xe309, 0xf47f, 0x0bd6, 0x1ce7, 0x1e11, 0x0f38,
+	0xf822, 0xe558, 0xe074, 0xec5e, 0x026b, 0x17ba, 0x1fe8, 0x174d,
+	0x0215, 0xec21, 0xe0a5, 0xe5d8, 0xf918, 0x0ff9, 0x1e96, 0x1cbf,
+	0x0bdd, 0xf499, 0xe3ad, 0xe1cb, 0xeff1, 0x06c1, 0x1a28, 0x1f84,
+	0x1421, 0xfe11, 0xe98d, 0xe071, 0xe8a5, 0xfcf9, 0x1335, 0x1f42,
+	0x1a76, 0x07e6, 0xf106, 0xe23a, 0xe365, 0xf386, 0x0a7a, 0x1c1d,
+	0x1e60, 0x10be, 0xfa19, 0xe710, 0xe0af, 0xeb7f, 0x00ed, 0x161d,
+	0x1f71, 0x17f2, 0x03e9, 0xedaf, 0xe15b, 0xe544, 0xf75b, 0x0e11,
+	0x1d77, 0x1cff, 0x0d11, 0xf664, 0xe4f3, 0xe176, 0xeeba, 0x04dd,
+	0x18b6, 0x1f2e, 0x151e, 0xfff3, 0xeab6, 0xe0cf, 0xe782, 0xfb26,
+	0x116e, 0x1e8b, 0x1b09, 0x097b, 0xf2c8, 0xe324, 0xe2af, 0xf204,
+	0x08be, 0x1ac6, 0x1e78, 0x120f, 0xfc01, 0xe81f, 0xe0e3, 0xea3d,
+	0xff15, 0x1490, 0x1ef9, 0x18d8, 0x0597, 0xef77, 0xe211, 0xe459,
+	0xf5ce, 0x0c4e, 0x1c86, 0x1d4e, 0x0eae, 0xf86e, 0xe5ce, 0xe15a,
+	0xed19, 0x028e, 0x16a1, 0x1e4a, 0x15c7, 0x0163, 0xebf0, 0xe0eb,
+	0xe65e, 0xf93f, 0x0f79, 0x1db3, 0x1b88, 0x0b06, 0xf44b, 0xe3da,
+	0xe269, 0xf08b, 0x0713, 0x19c6, 0x1eb2, 0x1390, 0xfda6, 0xe96d,
+	0xe10b, 0xe926, 0xfdc5, 0x131f, 0x1ed6, 0x19c4, 0x0761, 0xf0f1,
+	0xe271, 0xe415, 0xf450, 0x0ae1, 0x1bbe, 0x1dca, 0x1025, 0xf9ba,
+	0xe6ee, 0xe14a, 0xec28, 0x018d, 0x162a, 0x1f0f, 0x1734, 0x037b,
+	0xed7b, 0xe1b8, 0xe5f8, 0xf80f, 0x0e89, 0x1d2f, 0x1c80, 0x0c77,
+	0xf5fd, 0xe4db, 0xe231, 0xef60, 0x0545, 0x18cb, 0x1eaf, 0x1483,
+	0xff56, 0xeaa0, 0xe148, 0xe866, 0xfbe7, 0x119b, 0x1e3a, 0x1a7f,
+	0x08d4, 0xf25c, 0xe34d, 0xe3a0, 0xf2d1, 0x0927, 0x1ac1, 0x1df4,
+	0x1156, 0xfb54, 0xe817, 0xe165, 0xeb30, 0xffba, 0x14a0, 0x1e91,
+	0x182a, 0x04c2, 0xef04, 0xe24a, 0xe569, 0xf664, 0x0c8a, 0x1c6f,
+	0x1c88, 0x0dd4, 0xf789, 0xe5e0, 0xe20a, 0xee3a, 0x039e, 0x1754,
+	0x1e8a, 0x1574, 0x00d8, 0xebf8, 0xe1a9, 0xe79d, 0xfa20, 0x1012,
+	0x1da0, 0x1aef, 0x0a37, 0xf377, 0xe39f, 0xe26b, 0xf10d, 0x06c0,
+	0x194c, 0x1dc1, 0x120f, 0xfcd9, 0xe922, 0xe176, 0xe9f3, 0xfdee,
+	0x132a, 0x1e1a, 0x18dd, 0x0658, 0xf06f, 0xe309, 0xe4d0, 0xf53f,
+	0x0b25, 0x1b91, 0x1d06, 0x0f1b, 0xf951, 0xe723, 0xe245, 0xed30,
+	0x01ee, 0x164d, 0x1e56, 0x164c, 0x028d, 0xeda6, 0xe283, 0xe6e9,
+	0xf925, 0x0e90, 0x1ccf, 0x1b42, 0x0b97, 0xf5d5, 0xe54c, 0xe354,
+	0xf07a, 0x05d7, 0x1899, 0x1dc1, 0x1341, 0xfe9b, 0xeaf4, 0xe237,
+	0xe96e, 0xfcda, 0x11be, 0x1d7d, 0x1927, 0x07bc, 0xf229, 0xe3f0,
+	0xe4ab, 0xf3e8, 0x0984, 0x1a4c, 0x1ca9, 0x0ffa, 0xfada, 0xe878,
+	0xe278, 0xec35, 0x00ae, 0x1491, 0x1da0, 0x16a0, 0x03f9, 0xeefe,
+	0xe315, 0xe684, 0xf795, 0x0d08, 0x1ba5, 0x1b3c, 0x0c91, 0xf747,
+	0xe677, 0xe33c, 0xef5c, 0x045a, 0x16ff, 0x1d59, 0x13ee, 0x0078,
+	0xec39, 0xe2b8, 0xe8c8, 0xfb4f, 0x1040, 0x1c91, 0x198a, 0x0945,
+	0xf3d2, 0xe4f2, 0xe472, 0xf2b2, 0x07fc, 0x18fb, 0x1cb6, 0x10fe,
+	0xfcce, 0xe9c6, 0xe2e0, 0xeb7d, 0xfeee, 0x12b6, 0x1c4a, 0x16dc,
+	0x051d, 0xf055, 0xe3a1, 0xe5dc, 0xf625, 0x0ad6, 0x1a6f, 0x1b3d,
+	0x0dc6, 0xf916, 0xe769, 0xe380, 0xee4b, 0x02d5, 0x159e, 0x1cf6,
+	0x1503, 0x01de, 0xedbe, 0xe37d, 0xe853, 0xf9f6, 0x0ead, 0x1bcb,
+	0x1a0a, 0x0a86, 0xf57c, 0xe602, 0xe49b, 0xf1c1, 0x067e, 0x17db,
+	0x1ca6, 0x1229, 0xfe20, 0xeb1a, 0xe356, 0xead6, 0xfd9e, 0x11ba,
+	0x1c77, 0x1815, 0x06da, 0xf236, 0xe4c8, 0xe612, 0xf4fe, 0x09db,
+	0x199f, 0x1ba7, 0x0ef9, 0xfa61, 0xe8d7, 0xe3a2, 0xed93, 0x010e,
+	0x1476, 0x1c91, 0x15c3, 0x0315, 0xef1e, 0xe3f9, 0xe7e6, 0xf874,
+	0x0cfb, 0x1af1, 0x1a42, 0x0bac, 0xf6e3, 0xe715, 0xe488, 0xf093,
+	0x045c, 0x16b7, 0x1c3f, 0x131e, 0xff6f, 0xec6e, 0xe3c2, 0xe9fc,
+	0xfbe7, 0x1011, 0x1bcb, 0x1862, 0x082b, 0xf38b, 0xe5ad, 0xe5c6,
+	0xf3a7, 0x0806, 0x1881, 0x1b83, 0x1007, 0xfbd7, 0xea21, 0xe3f4,
+	0xec99, 0xff86, 0x12e3, 0x1c0f, 0x162e, 0x048a, 0xf0a9, 0xe4bd,
+	0xe781, 0xf710, 0x0b76, 0x1a07, 0x1a32, 0x0c9a, 0xf848, 0xe7b9,
+	0xe3f8, 0xeec1, 0x027e, 0x14d1, 0x1b84, 0x1333, 0x0085, 0xedb4,
+	0xe3fe, 0xe957, 0xfa62, 0x0eaf, 0x1ae1, 0x1896, 0x094e, 0xf4cd,
+	0xe6ac, 0xe59e, 0xf293, 0x06ee, 0x1762, 0x1b87, 0x10bf, 0xfda3,
+	0xeb72, 0xe452, 0xec4e, 0xfe20, 0x11e8, 0x1b7f, 0x16c6, 0x05d4,
+	0xf208, 0xe5c9, 0xe727, 0xf662, 0x0a4b, 0x1925, 0x1a7d, 0x0d9b,
+	0xfa32, 0xe924, 0xe4e2, 0xeed3, 0x01ed, 0x1473, 0x1b87, 0x146a,
+	0x0231, 0xef30, 0xe50e, 0xe916, 0xf9d5, 0x0d67, 0x1a4c, 0x18ec,
+	0x0a5a, 0xf6c3, 0xe759, 0xe5d5, 0xf1cb, 0x0585, 0x167e, 0x1b14,
+	0x11a5, 0xfe8d, 0xecad, 0xe4ad, 0xeb50, 0xfd5f, 0x103c, 0x1b11,
+	0x16dd, 0x0705, 0xf38b, 0xe62b, 0xe732, 0xf4df, 0x091f, 0x180a,
+	0x1a3a, 0x0ea9, 0xfb18, 0xea73, 0xe4ee, 0xee11, 0x00cc, 0x12f8,
+	0x1b48, 0x1499, 0x0394, 0xf048, 0xe573, 0xe8eb, 0xf887, 0x0c45,
+	0x1964, 0x190d, 0x0b5b, 0xf7ba, 0xe885, 0xe5b1, 0xf109, 0x043b,
+	0x1546, 0x1af4, 0x1219, 0x000f, 0xed9f, 0xe515, 0xeae5, 0xfc02,
+	0x0f13, 0x19e8, 0x16d0, 0x0791, 0xf3d6, 0xe66b, 0xe670, 0xf3d9,
+	0x0748, 0x16ff, 0x1a20, 0x0f1f, 0xfc7b, 0xeb04, 0xe526, 0xed54,
+	0xff82, 0x11f2, 0x1ad4, 0x155e, 0x0492, 0xf170, 0xe616, 0xe887,
+	0xf75f, 0x0af6, 0x18ef, 0x1951, 0x0c55, 0xf905, 0xe969, 0xe5d6,
+	0xf037, 0x0337, 0x1471, 0x1aea, 0x12fd, 0x011e, 0xee9e, 0xe58a,
+	0xea87, 0xfac5, 0x0e16, 0x19cb, 0x17d1, 0x0928, 0xf5a8, 0xe7c8,
+	0xe6a7, 0xf34e, 0x066a, 0x1677, 0x1a46, 0x104c, 0xfd8a, 0xec1e,
+	0xe562, 0xecbb, 0xfe53, 0x10da, 0x1a60, 0x15c1, 0x0596, 0xf27c,
+	0xe688, 0xe814, 0xf689, 0x0999, 0x1821, 0x1966, 0x0d4e, 0xfa0b,
+	0xea08, 0xe5a9, 0xef5c, 0x0193, 0x1365, 0x1ab8, 0x13a1, 0x023d,
+	0xefa8, 0xe5ce, 0xe9cf, 0xf9d3, 0x0cc7, 0x1967, 0x180b, 0x0a3b,
+	0xf6e7, 0xe84f, 0xe69a, 0xf220, 0x051d, 0x15a5, 0x1a6e, 0x1118,
+	0xfead, 0xed27, 0xe57f, 0xebf3, 0xfd1e, 0x0fbb, 0x1a4c, 0x1662,
+	0x06ff, 0xf399, 0xe6f0, 0xe7b6, 0xf527, 0x086d, 0x1753, 0x19a9,
+	0x0e39, 0xfb50, 0xeac9, 0xe552, 0xedb7, 0xffe7, 0x11bc, 0x1a15,
+	0x13e4, 0x031c, 0xf089, 0xe5dd, 0xe907, 0xf857, 0x0ba2, 0x18c1,
+	0x1876, 0x0b22, 0xf807, 0xe914, 0xe64b, 0xf105, 0x0443, 0x1499,
+	0x1aba, 0x11d1, 0x003f, 0xee54, 0xe59c, 0xeb9b, 0xfbce, 0x0f04,
+	0x19f8, 0x170f, 0x0822, 0xf4d6, 0xe7ba, 0xe746, 0xf44b, 0x079e,
+	0x16d1, 0x1a20, 0x0f11, 0xfcd8, 0xeba8, 0xe5a9, 0xedb6, 0xff4a,
+	0x11d4, 0x1a74, 0x1520, 0x04ba, 0xf1c9, 0xe69a, 0xe890, 0xf791,
+	0x0acd, 0x1865, 0x1912, 0x0c30, 0xf976, 0xe978, 0xe608, 0xf02f,
+	0x02ea, 0x140d, 0x1a82, 0x12e9, 0x0159, 0xeeec, 0xe601, 0xea57,
+	0xfae6, 0x0db3, 0x1998, 0x1796, 0x0905, 0xf63a, 0xe7de, 0xe6f5,
+	0xf2f6, 0x0664, 0x1627, 0x1a29, 0x1064, 0xfdbd, 0xec93, 0xe582,
+	0xeca8, 0xfe4d, 0x1086, 0x1a50, 0x15a1, 0x060d, 0xf2ca, 0xe6a5,
+	0xe828, 0xf621, 0x097e, 0x17c2, 0x194d, 0x0d59, 0xfa62, 0xea57,
+	0xe5b2, 0xef1f, 0x0181, 0x1314, 0x1a84, 0x1390, 0x028b, 0xefe1,
+	0xe5e6, 0xe9a6, 0xf998, 0x0c4c, 0x1946, 0x17a1, 0x09f0, 0xf681,
+	0xe7c9, 0xe600, 0xf166, 0x04ae, 0x14f5, 0x1a32, 0x10f5, 0xff2f,
+	0xed20, 0xe561, 0xebc1, 0xfcc1, 0x0f6c, 0x1a2b, 0x1693, 0x0763,
+	0xf3f1, 0xe726, 0xe7a0, 0xf50d, 0x086d, 0x175b, 0x19f7, 0x0ec8,
+	0xfbc8, 0xeb3d, 0xe5ae, 0xee31, 0x006e, 0x123d, 0x1ac7, 0x14c7,
+	0x0430, 0xf126, 0xe623, 0xe91d, 0xf804, 0x0b81, 0x18d9, 0x18e1,
+	0x0bd7, 0xf866, 0xe951, 0xe5f3, 0xf0f3, 0x0361, 0x1498, 0x1aa8,
+	0x127e, 0x00bb, 0xee37, 0xe59e, 0xeab9, 0xfb3e, 0x0e2b, 0x19f8,
+	0x1782, 0x08ba, 0xf51a, 0xe78f, 0xe6df, 0xf392, 0x06c8, 0x1691,
+	0x1a56, 0x0fe9, 0xfd40, 0xec11, 0xe54b, 0xed11, 0xfe5d, 0x1120,
+	0x1a9f, 0x15ac, 0x0590, 0xf220, 0xe689, 0xe807, 0xf695, 0x09e1,
+	0x184a, 0x1988, 0x0d2f, 0xfa08, 0xe9c3, 0xe58e, 0xef5d, 0x01b1,
+	0x13c1, 0x1ad3, 0x13ac, 0x0228, 0xef45, 0xe5b1, 0xe988, 0xf9af,
+	0x0cf1, 0x197b, 0x1869, 0x0a46, 0xf6bd, 0xe818, 0xe605, 0xf1e9,
+	0x0509, 0x15de, 0x1ae4, 0x113e, 0xfeed, 0xecc8, 0xe52a, 0xeb23,
+	0xfc38, 0x0f42, 0x19c7, 0x1689, 0x06b0, 0xf37b, 0xe656, 0xe6d0,
+	0xf497, 0x081b, 0x17b7, 0x1a08, 0x0ec7, 0xfb68, 0xeac9, 0xe511,
+	0xedb1, 0x0052, 0x1264, 0x1b41, 0x14fc, 0x0413, 0xf0fb, 0xe583,
+	0xe8b3, 0xf7bb, 0x0ba7, 0x197d, 0x1958, 0x0c53, 0xf828, 0xe8f6,
+	0xe554, 0xf065, 0x03a6, 0x14d4, 0x1b62, 0x12b1, 0x0101, 0xee25,
+	0xe4ea, 0xea2f, 0xfae7, 0x0eca, 0x1aa2, 0x1832, 0x0933, 0xf4fd,
+	0xe6fc, 0xe60e, 0xf31a, 0x0705, 0x170b, 0x1b3b, 0x106d, 0xfd99,
+	0xeb9a, 0xe487, 0xec33, 0xfe4b, 0x11c0, 0x1b5e, 0x16a7, 0x05e9,
+	0xf213, 0xe5ac, 0xe72a, 0xf628, 0x0a32, 0x1908, 0x1a8a, 0x0dcd,
+	0xfa37, 0xe93d, 0xe4a0, 0xee81, 0x01e1, 0x144b, 0x1bcb, 0x14b8,
+	0x0271, 0xef27, 0xe496, 0xe8b1, 0xf928, 0x0d4c, 0x1a89, 0x1965,
+	0x0afb, 0xf6bb, 0xe713, 0xe522, 0xf0f4, 0x0534, 0x168b, 0x1be7,
+	0x1264, 0xff0d, 0xec5a, 0xe3f0, 0xea97, 0xfc73, 0x1081, 0x1b73,
+	0x1811, 0x07b0, 0xf386, 0xe5a0, 0xe600, 0xf409, 0x0865, 0x189e,
+	0x1b9c, 0x0faf, 0xfb27, 0xe919, 0xe30a, 0xec15, 0xff68, 0x132a,
+	0x1bed, 0x15f7, 0x0442, 0xf020, 0xe445, 0xe713, 0xf6f1, 0x0bb2,
+	0x1a4f, 0x1ad3, 0x0cfc, 0xf842, 0xe796, 0xe40b, 0xef31, 0x038c,
+	0x1612, 0x1cd6, 0x143c, 0x00dd, 0xed75, 0xe3a9, 0xe91d, 0xfa8b,
+	0x0f27, 0x1bd9, 0x19dd, 0x09ef, 0xf500, 0xe5a7, 0xe4cc, 0xf217,
+	0x06c1, 0x186a, 0x1c80, 0x11cb, 0xfd4c, 0xeaf6, 0xe321, 0xeb2c,
+	0xfdb5, 0x1209, 0x1cdc, 0x1828, 0x06af, 0xf1a9, 0xe434, 0xe5d3,
+	0xf519, 0x0a41, 0x1a51, 0x1bd2, 0x0eeb, 0xf9ac, 0xe8c3, 0xe2fd,
+	0xeda9, 0x0063, 0x1471, 0x1d8c, 0x15de, 0x037d, 0xee2b, 0xe35d,
+	0xe708, 0xf874, 0x0d79, 0x1bde, 0x1ac4, 0x0bb2, 0xf645, 0xe64d,
+	0xe3a3, 0xf014, 0x04da, 0x1727, 0x1d62, 0x139c, 0xffa5, 0xeb72,
+	0xe276, 0xe8fc, 0xfbec, 0x10e1, 0x1d18, 0x193a, 0x0858, 0xf309,
+	0xe4ac, 0xe489, 0xf334, 0x0862, 0x1977, 0x1d1d, 0x10f6, 0xfbff,
+	0xe8e9, 0xe20f, 0xeb59, 0xff7c, 0x1434, 0x1dfa, 0x177a, 0x04cb,
+	0xef9d, 0xe33b, 0xe602, 0xf651, 0x0b3f, 0x1ae2, 0x1b5f, 0x0ddc,
+	0xf7d7, 0xe623, 0xe1cd, 0xed5f, 0x0342, 0x16eb, 0x1e6d, 0x1503,
+	0x0118, 0xec24, 0xe234, 0xe796, 0xfa2a, 0x0f76, 0x1d09, 0x1b32,
+	0x0aef, 0xf4ed, 0xe42f, 0xe2eb, 0xf0af, 0x0745, 0x19ca, 0x1e8c,
+	0x12f8, 0xfd45, 0xe98b, 0xe193, 0xe9be, 0xfe0b, 0x12e6, 0x1e6f,
+	0x197d, 0x0736, 0xf13f, 0xe290, 0xe422, 0xf44e, 0x0b20, 0x1be4,
+	0x1dd9, 0x0fcc, 0xf9a0, 0xe6e9, 0xe155, 0xec62, 0x01aa, 0x163b,
+	0x1f0c, 0x1741, 0x0367, 0xed88, 0xe17a, 0xe597, 0xf821, 0x0ec1,
+	0x1d9a, 0x1cbd, 0x0c4f, 0xf5cc, 0xe447, 0xe1fa, 0xef1f, 0x05b8,
+	0x18f4, 0x1f34, 0x14b6, 0xff65, 0xea53, 0xe08a, 0xe7f8, 0xfbc4,
+	0x1274, 0x1ec2, 0x1b4c, 0x08a5, 0xf213, 0xe286, 0xe2b6, 0xf28d,
+	0x0970, 0x1b9f, 0x1ec9, 0x11e0, 0xfb49, 0xe768, 0xe029, 0xea6f,
+	0xffca, 0x159d, 0x1fc7, 0x192a, 0x0528, 0xee80, 0xe0e0, 0xe3f6,
+	0xf608, 0x0d61, 0x1dc7, 0x1e0c, 0x0ea8, 0xf715, 0xe49f, 0xe050,
+	0xed41, 0x03c7, 0x1868, 0x204e, 0x1686, 0x0137, 0xea54, 0xdf1d,
+	0xe516, 0xf914, 0x10af, 0x1ec9, 0x1c89, 0x0a56, 0xf2f0, 0xe204,
+	0xe121, 0xf05e, 0x07e4, 0x1af0, 0x1ff5, 0x13b8, 0xfce5, 0xe7e0,
+	0xdf21, 0xe891, 0xfdad, 0x1506, 0x20a3, 0x1ae9, 0x06e8, 0xef36,
+	0xe0bf, 0xe2a1, 0xf485, 0x0c3a, 0x1dc3, 0x1f6d, 0x1075, 0xf8e7,
+	0xe4f1, 0xdf87, 0xeb76, 0x0242, 0x1853, 0x2121, 0x18c6, 0x0309,
+	0xebc8, 0xdf77, 0xe44d, 0xf884, 0x0ff6, 0x1fd1, 0x1deb, 0x0cd7,
+	0xf50a, 0xe264, 0xe07d, 0xee56, 0x065b, 0x1abf, 0x213c, 0x15ca,
+	0xfed4, 0xe876, 0xde85, 0xe6b7, 0xfc44, 0x13e7, 0x20b5, 0x1c44,
+	0x08b8, 0xf0f8, 0xe0c5, 0xe138, 0xf1fd, 0x0a02, 0x1d99, 0x20bc,
+	0x12d5, 0xfa3c, 0xe4f5, 0xde98, 0xe985, 0x00f3, 0x16d7, 0x2173,
+	0x1973, 0x04fb, 0xed72, 0xdf5c, 0xe2f7, 0xf586, 0x0e6e, 0x1fa3,
+	0x1fc7, 0x0f1b, 0xf5b7, 0xe255, 0xdeee, 0xed66, 0x0591, 0x19f6,
+	0x2169, 0x1636, 0x00e6, 0xe99f, 0xded2, 0xe523, 0xf9f8, 0x1279,
+	0x20cf, 0x1e11, 0x0a7c, 0xf1c3, 0xe024, 0xe052, 0xf104, 0x0980,
+	0x1c6e, 0x2005, 0x1272, 0xfb13, 0xe601, 0xddf7, 0xe7e7, 0xfe58,
+	0x15ee, 0x21cf, 0x1b0a, 0x0635, 0xed57, 0xdefa, 0xe1b3, 0xf4c4,
+	0x0dbd, 0x1f54, 0x2071, 0x0ff6, 0xf76c, 0xe312, 0xde78, 0xeba8,
+	0x038a, 0x19db, 0x2256, 0x18a4, 0x020a, 0xea1b, 0xde27, 0xe3d3,
+	0xf93e, 0x1197, 0x2146, 0x1f1c, 0x0c67, 0xf320, 0xe066, 0xdf2b,
+	0xeeed, 0x0864, 0x1cc0, 0x225d, 0x155d, 0xfd2d, 0xe6b0, 0xdd36,
+	0xe6a1, 0xfd47, 0x15b3, 0x2231, 0x1cca, 0x07cd, 0xef0d, 0xdee0,
+	0xe070, 0xf2e5, 0x0c26, 0x1f89, 0x2162, 0x11d0, 0xf853, 0xe38f,
+	0xdd60, 0xe9d6, 0x022a, 0x191c, 0x22e3, 0x199f, 0x0362, 0xeb2b,
+	0xdde2, 0xe2aa, 0xf70d, 0x1079, 0x2124, 0x2030, 0x0df6, 0xf484,
+	0xe0f7, 0xddff, 0xed60, 0x066c, 0x1c73, 0x22be, 0x1701, 0xfee6,
+	0xe77e, 0xdd34, 0xe548, 0xfb94, 0x1450, 0x223f, 0x1e44, 0x09c6,
+	0xf0d5, 0xdf14, 0xdf64, 0xf092, 0x0a2b, 0x1f4a, 0x227c, 0x142e,
+	0xfa42, 0xe426, 0xdc89, 0xe819, 0x000a, 0x1802, 0x2302, 0x1b4c,
+	0x05c7, 0xece9, 0xdd8a, 0xe00f, 0xf399, 0x0da2, 0x20ae, 0x214b,
+	0x101d, 0xf602, 0xe0b4, 0xdce3, 0xeb17, 0x0495, 0x1aff, 0x2312,
+	0x18a0, 0x0119, 0xe941, 0xdcad, 0xe3b3, 0xf888, 0x12e9, 0x22d4,
+	0x1ff1, 0x0c3f, 0xf173, 0xdf8d, 0xde78, 0xefa9, 0x0912, 0x1ddd,
+	0x231c, 0x1542, 0xfd39, 0xe59f, 0xdc5a, 0xe65f, 0xfd69, 0x1780,
+	0x23a7, 0x1d36, 0x0715, 0xed57, 0xddfe, 0xe05d, 0xf3e6, 0x0d88,
+	0x202a, 0x21ad, 0x1161, 0xf86b, 0xe26a, 0xdcc7, 0xe9b0, 0x02d2,
+	0x1ab9, 0x2400, 0x1a06, 0x0259, 0xe97c, 0xdca9, 0xe2f3, 0xf854,
+	0x1225, 0x21d4, 0x1feb, 0x0cd3, 0xf342, 0xe024, 0xddf9, 0xee12,
+	0x0791, 0x1d89, 0x2350, 0x1688, 0xfda0, 0xe600, 0xdc4b, 0xe5a4,
+	0xfd58, 0x15b2, 0x2344, 0x1d31, 0x0871, 0xef1c, 0xde1a, 0xdfe5,
+	0xf203, 0x0c4f, 0x1f94, 0x225a, 0x1288, 0xf8fc, 0xe2ea, 0xdc6a,
+	0xe94d, 0x01e3, 0x195e, 0x236b, 0x1a0a, 0x03eb, 0xeaf3, 0xdd48,
+	0xe207, 0xf674, 0x1036, 0x218e, 0x20e8, 0x0e58, 0xf444, 0xdfce,
+	0xdda4, 0xed23, 0x06e6, 0x1c4c, 0x2252, 0x162f, 0xfe55, 0xe70d,
+	0xdc39, 0xe450, 0xfb0c, 0x140e, 0x22d1, 0x1e05, 0x0991, 0xefd3,
+	0xde78, 0xdf3c, 0xf131, 0x0b33, 0x1ec9, 0x2256, 0x134d, 0xfa96,
+	0xe452, 0xdcf7, 0xe843, 0x0063, 0x1845, 0x2346, 0x1b5e, 0x0522,
+	0xec75, 0xde0d, 0xe19f, 0xf59b, 0x0ed7, 0x20d8, 0x2141, 0x0fa3,
+	0xf5eb, 0xe13f, 0xddc6, 0xec24, 0x057d, 0x1b4f, 0x22d6, 0x17c3,
+	0x0078, 0xe946, 0xdd5c, 0xe418, 0xf964, 0x12e2, 0x2256, 0x1f52,
+	0x0b59, 0xf14a, 0xdf70, 0xdec9, 0xf033, 0x097c, 0x1dd6, 0x2225,
+	0x146a, 0xfc20, 0xe5d8, 0xdd05, 0xe6db, 0xfe07, 0x16af, 0x2346,
+	0x1cf1, 0x06d2, 0xed3d, 0xdddb, 0xe06f, 0xf413, 0x0d8e, 0x203b,
+	0x218b, 0x10cf, 0xf774, 0xe29f, 0xdd0b, 0xea6e, 0x0285, 0x1a3c,
+	0x2383, 0x19c9, 0x028f, 0xe9b1, 0xdce1, 0xe241, 0xf7c7, 0x11e9,
+	0x223f, 0x2042, 0x0c9f, 0xf323, 0xdffe, 0xde0f, 0xee1e, 0x06fb,
+	0x1d1b, 0x22e2, 0x16f4, 0xfe4a, 0xe6bf, 0xdbf8, 0xe4be, 0xfbf5,
+	0x15da, 0x23c7, 0x1e0e, 0x08e1, 0xeeb8, 0xde8c, 0xdf15, 0xf120,
+	0x0a4e, 0x1e79, 0x221a, 0x1375, 0xfa2a, 0xe311, 0xdba6, 0xe74f,
+	0x0051, 0x1920, 0x23e3, 0x1b7c, 0x047a, 0xeb82, 0xdd36, 0xe132,
+	0xf51c, 0x0f26, 0x21a8, 0x21c9, 0x1057, 0xf5a0, 0xe082, 0xdc82,
+	0xeb38, 0x058e, 0x1c28, 0x240c, 0x189c, 0x00ba, 0xe884, 0xdbd0,
+	0xe343, 0xf94c, 0x13f2, 0x239b, 0x1fcd, 0x0bb8, 0xf085, 0xde66,
+	0xde09, 0xeffa, 0x0a42, 0x1e53, 0x231c, 0x1514, 0xfc93, 0xe4e1,
+	0xdb64, 0xe5c2, 0xfe66, 0x1842, 0x24fa, 0x1d85, 0x06a1, 0xebe1,
+	0xdc8f, 0xe007, 0xf4ad, 0x0ed5, 0x20cb, 0x225a, 0x112b, 0xf7d3,
+	0xe139, 0xdbd9, 0xe94e, 0x0343, 0x1bbc, 0x2574, 0x1b42, 0x0228,
+	0xe7d2, 0xdabd, 0xe16b, 0xf925, 0x1389, 0x240b, 0x214f, 0x0c6e,
+	0xf229, 0xdde8, 0xdd20, 0xedad, 0x0852, 0x1eae, 0x24e6, 0x1808,
+	0xfdcb, 0xe49c, 0xd9b7, 0xe348, 0xfcd3, 0x17b1, 0x265e, 0x1f88,
+	0x0839, 0xeca6, 0xdbc7, 0xde8d, 0xf271, 0x0d3a, 0x20a9, 0x239c,
+	0x1367, 0xf945, 0xe24b, 0xdaed, 0xe71e, 0x00b4, 0x19f1, 0x2597,
+	0x1c2a, 0x0452, 0xe96c, 0xdaa0, 0xdf92, 0xf569, 0x10cc, 0x21dc,
+	0x212a, 0x0e33, 0xf516, 0xe149, 0xdd89, 0xeb91, 0x038c, 0x1abe,
+	0x235f, 0x19b0, 0x01ec, 0xe8c6, 0xdbf4, 0xe2d8, 0xf966, 0x1401,
+	0x22cb, 0x1f41, 0x0b1b, 0xf1ca, 0xe09f, 0xdf9d, 0xefac, 0x07a2,
+	0x1d39, 0x22a2, 0x176e, 0xfcec, 0xe54b, 0xdc2c, 0xe6cc, 0xff5c,
+	0x16a7, 0x22e3, 0x1be5, 0x078c, 0xee5d, 0xded7, 0xe068, 0xf2a5,
+	0x0d09, 0x20ab, 0x22e0, 0x11a0, 0xf677, 0xe1c0, 0xdd2e, 0xeb0d,
+	0x037e, 0x19e4, 0x2307, 0x1a13, 0x029c, 0xea0d, 0xdbf3, 0xe217,
+	0xf807, 0x1326, 0x237e, 0x1f81, 0x0b60, 0xf14a, 0xe0ab, 0xdf00,
+	0xeeb5, 0x06eb, 0x1cfd, 0x238a, 0x1764, 0xfd37, 0xe434, 0xda7a,
+	0xe5b2, 0xffd8, 0x1896, 0x2354, 0x1a12, 0x04a6, 0xeda5, 0xe082,
+	0xe2cf, 0xf402, 0x0c6f, 0x1e86, 0x1fdf, 0x0f70, 0xf737, 0xe41c,
+	0xe0c9, 0xecf0, 0x02de, 0x17b4, 0x1f62, 0x1722, 0x0191, 0xea4e,
+	0xdee6, 0xe782, 0xff4e, 0x162b, 0x1c6e, 0x10d2, 0xff3d, 0xf37b,
+	0xf05d, 0xf304, 0xf63b, 0xfc80, 0x08a7, 0x14b0, 0x1836, 0x07b6,
+	0xe9f9, 0xdbf2, 0xeb88, 0x0cf9, 0x20dc, 0x1557, 0xf8cc, 0xe8c3,
+	0xf2bf, 0x087d, 0x0f6f, 0xff27, 0xedb9, 0xf1ea, 0x0b83, 0x1d45,
+	0x11ae, 0xeefc, 0xdc25, 0xebf8, 0x109f, 0x2582, 0x1216, 0xee89,
+	0xde6e, 0xf35c, 0x14de, 0x1e27, 0x0448, 0xe5c6, 0xe4e2, 0x0295,
+	0x1fcf, 0x1927, 0xf6cf, 0xdd7e, 0xe90c, 0x0d60, 0x22c6, 0x136b,
+	0xeea4, 0xdec6, 0xf17e, 0x1454, 0x20a3, 0x077e, 0xe762, 0xe10a,
+	0xfdbe, 0x1c6a, 0x1cc2, 0xfe05, 0xe145, 0xe5ea, 0x04ef, 0x1f46,
+	0x1690, 0xf603, 0xe12f, 0xee73, 0x0f00, 0x1e3c, 0x0c67, 0xeb7a,
+	0xe21a, 0xf7c6, 0x1824, 0x1f4d, 0x039f, 0xe519, 0xe144, 0xff7d,
+	0x1ca9, 0x1b80, 0xfd5e, 0xe2b9, 0xe993, 0x070a, 0x1e2f, 0x1166,
+	0xf119, 0xe0f8, 0xf28b, 0x155b, 0x217e, 0x0998, 0xe60d, 0xddbc,
+	0xf851, 0x1bfb, 0x20ac, 0x02ce, 0xe39c, 0xe333, 0x028c, 0x1d83,
+	0x16f8, 0xf5cf, 0xe05c, 0xeda2, 0x103b, 0x22b9, 0x0e1f, 0xea32,
+	0xdc15, 0xf38d, 0x18cf, 0x22cc, 0x075f, 0xe543, 0xdf80, 0xfc42,
+	0x1bd6, 0x1a69, 0xfb8c, 0xe09d, 0xe852, 0x09d3, 0x2116, 0x13d2,
+	0xf0dc, 0xdda5, 0xeec3, 0x121a, 0x21b2, 0x0bd0, 0xea78, 0xe08a,
+	0xf8eb, 0x1a06, 0x1cab, 0x0209, 0xe2fd, 0xe4a8, 0x037a, 0x1f12,
+	0x19db, 0xf752, 0xe0c0, 0xea1a, 0x0cdc, 0x1fb5, 0x1063, 0xefd9,
+	0xe0b4, 0xf559, 0x14ef, 0x1fd4, 0x0536, 0xe6af, 0xe1ea, 0xfe40,
+	0x1da5, 0x1b43, 0xfe54, 0xe18c, 0xe7cb, 0x06ed, 0x1f08, 0x1495,
+	0xf2ce, 0xe119, 0xef93, 0x1242, 0x2035, 0x0b1b, 0xea2d, 0xdfcf,
+	0xf8f0, 0x19e9, 0x1e62, 0x01d8, 0xe3ee, 0xe408, 0x031d, 0x1e65,
+	0x1804, 0xf769, 0xdffd, 0xeb91, 0x0dc6, 0x212a, 0x0fea, 0xed75,
+	0xdf12, 0xf3b2, 0x168a, 0x2024, 0x0722, 0xe73b, 0xe112, 0xfe3b,
+	0x1c43, 0x1b72, 0xfc51, 0xe14f, 0xe7ee, 0x08d8, 0x20b2, 0x1402,
+	0xf2b8, 0xde55, 0xef7f, 0x128b, 0x2189, 0x0c0a, 0xe961, 0xdff9,
+	0xf802, 0x1a1e, 0x1dac, 0x02a5, 0xe45b, 0xe408, 0x03fc, 0x1e2b,
+	0x1866, 0xf626, 0xdf7f, 0xeb46, 0x0e8b, 0x2225, 0x1050, 0xed60,
+	0xdcd9, 0xf25d, 0x14f4, 0x2079, 0x0731, 0xe70f, 0xe18c, 0xfd8f,
+	0x1c5a, 0x1a56, 0xfc2a, 0xe075, 0xe7ab, 0x09c4, 0x219d, 0x1577,
+	0xf1ca, 0xdd80, 0xedd9, 0x11d4, 0x223b, 0x0da4, 0xeb22, 0xdfd0,
+	0xf822, 0x1988, 0x1ddb, 0x01f5, 0xe37f, 0xe40c, 0x040f, 0x1fd0,
+	0x19bf, 0xf7a1, 0xde89, 0xe9aa, 0x0d78, 0x2209, 0x1209, 0xee84,
+	0xdeaa, 0xf338, 0x15e4, 0x20af, 0x0799, 0xe6d2, 0xe0a2, 0xfe01,
+	0x1d04, 0x1c82, 0xfce3, 0xe0b5, 0xe6ec, 0x0841, 0x20bd, 0x14dd,
+	0xf312, 0xde14, 0xef2c, 0x1275, 0x2205, 0x0c6d, 0xe932, 0xdf17,
+	0xf7c3, 0x1a31, 0x1e74, 0x0312, 0xe3d1, 0xe3db, 0x038c, 0x1e7f,
+	0x187d, 0xf6ad, 0xdf57, 0xeb55, 0x0e6c, 0x2229, 0x1145, 0xeddb,
+	0xdd96, 0xf333, 0x1633, 0x20fb, 0x07f5, 0xe6cf, 0xe1c2, 0xfdf5,
+	0x1c74, 0x1b8d, 0xfcc3, 0xe0d0, 0xe736, 0x0982, 0x2168, 0x1614,
+	0xf250, 0xdd84, 0xee46, 0x1146, 0x2218, 0x0daa, 0xeb3c, 0xdfb6,
+	0xf804, 0x192e, 0x1e42, 0x028c, 0xe326, 0xe3c3, 0x0353, 0x1fe9,
+	0x19c3, 0xf75f, 0xdd92, 0xe879, 0x0bd3, 0x218e, 0x1285, 0xeec4,
+	0xde9c, 0xf15f, 0x14a1, 0x2019, 0x0822, 0xe713, 0xe09c, 0xfd6a,
+	0x1cc6, 0x1d3e, 0xfd57, 0xe096, 0xe56b, 0x07bc, 0x2192, 0x16fb,
+	0xf3e5, 0xdddd, 0xedc8, 0x1123, 0x21e7, 0x0d62, 0xea98, 0xdf5f,
+	0xf80f, 0x19df, 0x1f4a, 0x02f9, 0xe30e, 0xe2f7, 0x02a7, 0x1fc9,
+	0x1a45, 0xf875, 0xdee3, 0xe9c7, 0x0d0f, 0x21c3, 0x125b, 0xee5d,
+	0xdeb0, 0xf2c1, 0x15ff, 0x2102, 0x0824, 0xe6b3, 0xe069, 0xfd47,
+	0x1c95, 0x1d67, 0xfda2, 0xe0f2, 0xe633, 0x0772, 0x2106, 0x1648,
+	0xf3ee, 0xde68, 0xedd0, 0x10e8, 0x218a, 0x0dca, 0xea81, 0xdf9e,
+	0xf72d, 0x192a, 0x1f70, 0x0361, 0xe41b, 0xe256, 0x01a0, 0x1ea6,
+	0x1ae5, 0xf972, 0xdf6b, 0xe8f7, 0x0b27, 0x2198, 0x12a9, 0xefd5,
+	0xde92, 0xf1a5, 0x14dc, 0x2108, 0x091a, 0xe70f, 0xe010, 0xfbef,
+	0x1c0a, 0x1e08, 0xfecc, 0xe123, 0xe490, 0x058b, 0x20db, 0x17e2,
+	0xf4d0, 0xde49, 0xec90, 0x0fb8, 0x21b0, 0x0e30, 0xeb2e, 0xdec8,
+	0xf6e4, 0x1911, 0x200f, 0x02f2, 0xe230, 0xe11b, 0x004a, 0x1ef8,
+	0x1b08, 0xf998, 0xdf0b, 0xe801, 0x0a31, 0x212b, 0x1320, 0xef9e,
+	0xdea0, 0xf20a, 0x1502, 0x2180, 0x0856, 0xe694, 0xe006, 0xfc00,
+	0x1cea, 0x1e2f, 0xff26, 0xe145, 0xe557, 0x05e6, 0x205b, 0x175b,
+	0xf45c, 0xdf52, 0xedbf, 0x1050, 0x21dc, 0x0d38, 0xeb15, 0xdf23,
+	0xf6e4, 0x18d5, 0x201e, 0x0458, 0xe3e5, 0xe2a4, 0xffe5, 0x1ecc,
+	0x1a9b, 0xf975, 0xdfe6, 0xe92d, 0x0b6a, 0x2112, 0x12c2, 0xef0d,
+	0xdef6, 0xf11e, 0x1465, 0x21cb, 0x08d7, 0xe791, 0xdff2, 0xfbab,
+	0x1b9e, 0x1d78, 0xfed9, 0xe189, 0xe5dc, 0x04f2, 0x20f5, 0x16eb,
+	0xf48e, 0xde80, 0xec70, 0x104b, 0x21a5, 0x0f06, 0xea70, 0xdfa4,
+	0xf536, 0x18cc, 0x2033, 0x0413, 0xe4bd, 0xe183, 0x00d4, 0x1d9e,
+	0x1bcf, 0xf98d, 0xe076, 0xe87f, 0x0a16, 0x21e6, 0x12a4, 0xf03c,
+	0xddc0, 0xf12b, 0x1422, 0x2295, 0x0a45, 0xe7b3, 0xdf8f, 0xf8f1,
+	0x1bf6, 0x1dbe, 0x007b, 0xe1f4, 0xe561, 0x0539, 0x2015, 0x179a,
+	0xf400, 0xdf0f, 0xeae6, 0x1021, 0x2278, 0x0fd7, 0xeb1c, 0xdd21,
+	0xf30f, 0x16be, 0x209b, 0x0532, 0xe56f, 0xe107, 0xff98, 0x1d7a,
+	0x1ba3, 0xf9b0, 0xdfa7, 0xe774, 0x0a75, 0x2275, 0x142c, 0xf082,
+	0xdd78, 0xefc7, 0x1343, 0x22e9, 0x0a50, 0xe89c, 0xdf40, 0xfa12,
+	0x1b94, 0x1e40, 0x00cd, 0xe17d, 0xe4c8, 0x03dc, 0x20c5, 0x186b,
+	0xf547, 0xdea6, 0xeb3e, 0x0fa2, 0x2248, 0x0ffd, 0xebc6, 0xde6a,
+	0xf3c6, 0x1813, 0x2133, 0x05d2, 0xe568, 0xe092, 0xff62, 0x1dc2,
+	0x1c65, 0xfb0d, 0xdff1, 0xe75b, 0x08fc, 0x225c, 0x1451, 0xf16c,
+	0xddac, 0xef35, 0x136c, 0x2297, 0x0b90, 0xe886, 0xdf04, 0xf8a2,
+	0x1b95, 0x1eed, 0x011a, 0xe1fe, 0xe393, 0x0461, 0x2074, 0x1980,
+	0xf621, 0xde3e, 0xea72, 0x0dbe, 0x2360, 0x1035, 0xed46, 0xddb6,
+	0xf383, 0x17cb, 0x20e3, 0x06f7, 0xe4c1, 0xe0df, 0xfdef, 0x1e6c,
+	0x1c92, 0xfbdc, 0xdf51, 0xe683, 0x0901, 0x2210, 0x15b8, 0xf12c,
+	0xde1e, 0xeddc, 0x1303, 0x2222, 0x0c1b, 0xe8fa, 0xdee0, 0xf8d5,
+	0x1a97, 0x1f5e, 0x0105, 0xe288, 0xe2ba, 0x03f3, 0x2040, 0x1985,
+	0xf627, 0xdd38, 0xe97b, 0x0c52, 0x22bd, 0x1044, 0xede1, 0xdd9a,
+	0xf311, 0x16ec, 0x205f, 0x06bf, 0xe4e6, 0xe137, 0xfda8, 0x1eb6,
+	0x1c7c, 0xfd29, 0xdf89, 0xe5d8, 0x086d, 0x2187, 0x16c4, 0xf173,
+	0xdf63, 0xed66, 0x135e, 0x218a, 0x0c4f, 0xea2f, 0xde78, 0xf997,
+	0x19eb, 0x208f, 0x00ed, 0xe2fe, 0xe28d, 0x0323, 0x209c, 0x19b3,
+	0xf8e0, 0xde0b, 0xea7d, 0x0c93, 0x22bc, 0x1100, 0xed8f, 0xdec4,
+	0xf2cd, 0x1803, 0x2065, 0x07b7, 0xe5d4, 0xe02c, 0xfe16, 0x1d5b,
+	0x1d77, 0xfc66, 0xe06e, 0xe61a, 0x0821, 0x2193, 0x1565, 0xf34a,
+	0xde0b, 0xee80, 0x1253, 0x21da, 0x0c10, 0xe94b, 0xdf2a, 0xf886,
+	0x1ae5, 0x1ea5, 0x0264, 0xe272, 0xe2e6, 0x0387, 0x1fb5, 0x19c1,
+	0xf711, 0xdee8, 0xe9ea, 0x0d8d, 0x21d9, 0x1115, 0xee74, 0xddd5,
+	0xf3be, 0x16b4, 0x20df, 0x06d5, 0xe579, 0xe095, 0xfe34, 0x1e08,
+	0x1c9a, 0xfd42, 0xdf72, 0xe641, 0x085d, 0x21b0, 0x15ec, 0xf264,
+	0xde1e, 0xee31, 0x126e, 0x220a, 0x0cd7, 0xe9d5, 0xde86, 0xf8ac,
+	0x1afc, 0x1f20, 0x01da, 0xe0f8, 0xe224, 0x0244, 0x1fc6, 0x1a16,
+	0xf754, 0xde54, 0xe8ed, 0x0d55, 0x222e, 0x118a, 0xedeb, 0xdda3,
+	0xf31a, 0x16b2, 0x21a3, 0x07f4, 0xe601, 0xdfb1, 0xfdaf, 0x1df1,
+	0x1d6b, 0xfdaf, 0xdf83, 0xe625, 0x07d0, 0x21ce, 0x1692, 0xf32c,
+	0xddfb, 0xed9f, 0x12a5, 0x220b, 0x0d65, 0xe986, 0xde92, 0xf84b,
+	0x1a2b, 0x1fe9, 0x02f0, 0xe306, 0xe244, 0x030e, 0x1fc9, 0x1a78,
+	0xf820, 0xde39, 0xe9f8, 0x0cbf, 0x22a5, 0x1209, 0xeeb5, 0xddc4,
+	0xf2a1, 0x16aa, 0x2120, 0x0872, 0xe5a3, 0xe05b, 0xfd5f, 0x1d3e,
+	0x1db7, 0xfdb0, 0xe07e, 0xe560, 0x07f0, 0x216a, 0x16c1, 0xf369,
+	0xdd9d, 0xedc1, 0x119f, 0x22ac, 0x0d89, 0xea62, 0xde37, 0xf798,
+	0x1a3e, 0x1fc8, 0x0359, 0xe2aa, 0xe271, 0x0266, 0x1fb3, 0x1ada,
+	0xf891, 0xdea7, 0xe8f8, 0x0cc1, 0x2296, 0x1270, 0xeef9, 0xdd53,
+	0xf23b, 0x15c8, 0x21b2, 0x08ca, 0xe65e, 0xdfe3, 0xfccc, 0x1d85,
+	0x1d9d, 0xfe16, 0xdfc8, 0xe551, 0x0776, 0x2163, 0x172e, 0xf39c,
+	0xddcc, 0xed24, 0x1178, 0x21fe, 0x0d1e, 0xe97c, 0xdd56, 0xf6ce,
+	0x195e, 0x1fc8, 0x02f3, 0xe2be, 0xe182, 0x01b6, 0x1f5c, 0x1aac,
+	0xf884, 0xde45, 0xe8f5, 0x0bc5, 0x228e, 0x126e, 0xeeda, 0xdda4,
+	0xf22a, 0x1612, 0x21c1, 0x08b2, 0xe659, 0xdfe2, 0xfc91, 0x1d6e,
+	0x1db2, 0xfe64, 0xe053, 0xe5b9, 0x0716, 0x2184, 0x16f9, 0xf37a,
+	0xde60, 0xecce, 0x11d5, 0x2242, 0x0e28, 0xea4c, 0xde88, 0xf759,
+	0x198f, 0x2078, 0x031f, 0xe3df, 0xe1ca, 0x023b, 0x1f6b, 0x1acc,
+	0xf91c, 0xdea2, 0xe97c, 0x0b89, 0x22cb, 0x1236, 0xef5b, 0xddcf,
+	0xf188, 0x15cd, 0x2145, 0x098c, 0xe63d, 0xe045, 0xfbaf, 0x1cd5,
+	0x1daf, 0xfe51, 0xe13e, 0xe4bc, 0x0728, 0x2092, 0x1778, 0xf39a,
+	0xde2b, 0xece4, 0x1081, 0x22bd, 0x0df7, 0xeaf3, 0xddfa, 0xf674,
+	0x18fc, 0x2066, 0x040c, 0xe38f, 0xe249, 0x00e7, 0x1f43, 0x1ad6,
+	0xf920, 0xdf00, 0xe875, 0x0baf, 0x226f, 0x131d, 0xef00, 0xdda3,
+	0xf11b, 0x14fd, 0x2205, 0x098e, 0xe704, 0xdfd7, 0xfabb, 0x1c71,
+	0x1e13, 0xfeb7, 0xe0fd, 0xe4e8, 0x067b, 0x20cc, 0x16f1, 0xf2ff,
+	0xdd5b, 0xeb4a, 0x0fd4, 0x2279, 0x0e81, 0xeb4c, 0xdd88, 0xf59c,
+	0x189c, 0x2079, 0x0469, 0xe3a6, 0xe1cc, 0xffd0, 0x1f8f, 0x1b4c,
+	0xf99b, 0xdeec, 0xe7f0, 0x0b71, 0x2264, 0x143a, 0xef23, 0xde10,
+	0xf039, 0x14ae, 0x22a5, 0x09ae, 0xe7e3, 0xdf1b, 0xfb5a, 0x1bfa,
+	0x1f02, 0xff7e, 0xe0dc, 0xe4ba, 0x04ac, 0x21f2, 0x17ce, 0xf4c4,
+	0xdde8, 0xebb8, 0x0ff8, 0x2293, 0x0fa2, 0xead2, 0xdeb1, 0xf486,
+	0x18d9, 0x2101, 0x047e, 0xe41d, 0xe0c9, 0x0063, 0x1ebe, 0x1c4a,
+	0xf9d4, 0xdf15, 0xe761, 0x099c, 0x22f2, 0x13ab, 0xf01f, 0xdd7c,
+	0xefb5, 0x148a, 0x2253, 0x0a71, 0xe738, 0xdf5f, 0xf98d, 0x1c6e,
+	0x1f36, 0xff74, 0xe170, 0xe339, 0x0567, 0x20ff, 0x18dd, 0xf4bc,
+	0xde18, 0xeb33, 0x0efa, 0x23cc, 0x0f14, 0xec5e, 0xdd4c, 0xf516,
+	0x189b, 0x210f, 0x0588, 0xe38b, 0xe198, 0xfebc, 0x1fd4, 0x1c29,
+	0xfa5a, 0xdf09, 0xe683, 0x0a75, 0x2285, 0x150f, 0xf02f, 0xdd9e,
+	0xeef5, 0x13f7, 0x22db, 0x0a87, 0xe7e1, 0xdeaf, 0xf9da, 0x1bab,
+	0x1eda, 0xff4e, 0xe042, 0xe278, 0x03bb, 0x2139, 0x18b5, 0xf5c1,
+	0xdd85, 0xea62, 0x0eae, 0x22ac, 0x1007, 0xebe4, 0xddba, 0xf3e6,
+	0x183c, 0x21a2, 0x059f, 0xe4ea, 0xe05c, 0xfece, 0x1f09, 0x1c82,
+	0xfc39, 0xdf04, 0xe6f3, 0x0900, 0x22da, 0x1517, 0xf140, 0xddeb,
+	0xeeb9, 0x13fe, 0x2247, 0x0c04, 0xe82d, 0xdefa, 0xf8c2, 0x1bd2,
+	0x1f88, 0x010d, 0xe220, 0xe2cc, 0x0436, 0x20b3, 0x1982, 0xf722,
+	0xddf5, 0xea26, 0x0e29, 0x2305, 0x1103, 0xec83, 0xde18, 0xf308,
+	0x182a, 0x2125, 0x0730, 0xe570, 0xdf9a, 0xfe96, 0x1d7f, 0x1de1,
+	0xfb93, 0xdfe3, 0xe634, 0x087a, 0x22a6, 0x1527, 0xf303, 0xdcb1,
+	0xeec0, 0x1266, 0x22cc, 0x0c76, 0xe84c, 0xdf44, 0xf7cf, 0x1bba,
+	0x1ef5, 0x0297, 0xe1e0, 0xe27c, 0x0390, 0x201b, 0x1a9b, 0xf63f,
+	0xdecb, 0xe981, 0x0e16, 0x2257, 0x1141, 0xede1, 0xdd3e, 0xf387,
+	0x16c6, 0x21a1, 0x06df, 0xe50a, 0xe021, 0xfe0d, 0x1dff, 0x1d53,
+	0xfc36, 0xdfe7, 0xe5c3, 0x089f, 0x21ca, 0x15a0, 0xf247, 0xdd30,
+	0xeee3, 0x120e, 0x21f3, 0x0b55, 0xe841, 0xddb9, 0xf7e6, 0x1a86,
+	0x1f5c, 0x01ba, 0xe1d1, 0xe271, 0x02d4, 0x206d, 0x199c, 0xf77f,
+	0xde29, 0xe9d5, 0x0db5, 0x225f, 0x11b3, 0xed43, 0xdde3, 0xf315,
+	0x16bf, 0x21f1, 0x07bb, 0xe622, 0xdfbc, 0xfdba, 0x1de8, 0x1dba,
+	0xfd25, 0xdff9, 0xe604, 0x086e, 0x21e8, 0x163d, 0xf350, 0xdd5e,
+	0xee4b, 0x11e2, 0x22da, 0x0cd1, 0xe956, 0xdec1, 0xf7a9, 0x1ad5,
+	0x1f96, 0x035d, 0xe2b1, 0xe284, 0x02c1, 0x1fce, 0x1a7d, 0xf781,
+	0xdeb9, 0xe945, 0x0d77, 0x2248, 0x1263, 0xee24, 0xdd3f, 0xf305,
+	0x1608, 0x220e, 0x0778, 0xe64a, 0xdfed, 0xfd25, 0x1d9c, 0x1d25,
+	0xfe66, 0xdf73, 0xe64b, 0x0785, 0x21d7, 0x1662, 0xf274, 0xde3f,
+	0xecc4, 0x12ca, 0x21d6, 0x0e4c, 0xe973, 0xde34, 0xf7ed, 0x19dd,
+	0x2066, 0x0240, 0xe376, 0xe20d, 0x02f2, 0x1f47, 0x1acb, 0xf865,
+	0xde6d, 0xe944, 0x0ca6, 0x22bd, 0x11fc, 0xeeb4, 0xdd27, 0xf27c,
+	0x160c, 0x2199, 0x0901, 0xe62f, 0xdfeb, 0xfcb6, 0x1d54, 0x1d76,
+	0xfdfa, 0xe02a, 0xe5cb, 0x070e, 0x20cc, 0x15cf, 0xf26c, 0xdd81,
+	0xebee, 0x11e4, 0x2160, 0x0e2e, 0xe999, 0xde49, 0xf6eb, 0x18cb,
+	0x2077, 0x0341, 0xe429, 0xe17c, 0x02a1, 0x1f1f, 0x1b0a, 0xf895,
+	0xde98, 0xe925, 0x0c15, 0x22be, 0x1264, 0xefb7, 0xdd48, 0xf223,
+	0x15b0, 0x217f, 0x094d, 0xe68d, 0xe02c, 0xfc07, 0x1d05, 0x1ddf,
+	0xfeb0, 0xe0d9, 0xe4bd, 0x0728, 0x2124, 0x172f, 0xf42a, 0xdde4,
+	0xece2, 0x1105, 0x225c, 0x0e7c, 0xeaed, 0xde43, 0xf68f, 0x19b9,
+	0x2007, 0x0444, 0xe39d, 0xe1ea, 0x0199, 0x1f19, 0x1b44, 0xf958,
+	0xdf2a, 0xe856, 0x0bfa, 0x2261, 0x1314, 0xef9a, 0xdd9e, 0xf18a,
+	0x1560, 0x21ac, 0x09a6, 0xe73d, 0xdf99, 0xfbb4, 0x1cc6, 0x1e0f,
+	0xff09, 0xe085, 0xe515, 0x067f, 0x20d6, 0x17ab, 0xf444, 0xde7e,
+	0xebd0, 0x10e7, 0x224f, 0x0ebe, 0xeb4c, 0xddf0, 0xf657, 0x18fd,
+	0x2046, 0x04b1, 0xe3ea, 0xe1a5, 0x00aa, 0x1efb, 0x1b90, 0xf96b,
+	0xdf0a, 0xe807, 0x0b36, 0x223c, 0x1379, 0xeff6, 0xddb9, 0xf06f,
+	0x1541, 0x21cc, 0x0a34, 0xe752, 0xdf88, 0xfad3, 0x1b8b, 0x1db5,
+	0xfe9c, 0xe080, 0xe3e0, 0x0550, 0x2070, 0x17f2, 0xf414, 0xde6e,
+	0xead1, 0x1002, 0x2286, 0x0f01, 0xebd9, 0xdd8d, 0xf5df, 0x1869,
+	0x20e9, 0x04ad, 0xe445, 0xe172, 0x002c, 0x1f24, 0x1bce, 0xfa31,
+	0xdf48, 0xe7b8, 0x0a7f, 0x22e8, 0x1407, 0xf056, 0xdda5, 0xf047,
+	0x1517, 0x21fd, 0x0a5f, 0xe765, 0xdf77, 0xfa9d, 0x1c4f, 0x1eff,
+	0xffbf, 0xe12e, 0xe402, 0x054e, 0x20ff, 0x187c, 0xf4e9, 0xde80,
+	0xeb24, 0x0fb4, 0x2331, 0x0fae, 0xebbf, 0xdd9e, 0xf523, 0x18a5,
+	0x212e, 0x04ed, 0xe451, 0xe114, 0xffaa, 0x1e89, 0x1c4c, 0xfa94,
+	0xdf2f, 0xe75b, 0x093b, 0x2327, 0x13ff, 0xf0a0, 0xdd42, 0xefae,
+	0x1450, 0x2228, 0x0b0e, 0xe765, 0xdf6d, 0xf8a4, 0x1c4a, 0x1edc,
+	0x005a, 0xe122, 0xe38d, 0x04dc, 0x2069, 0x198d, 0xf4b8, 0xdef2,
+	0xe9d8, 0x0ed8, 0x236a, 0x0f87, 0xec58, 0xdd2e, 0xf4f6, 0x1791,
+	0x218c, 0x05a3, 0xe477, 0xe0d5, 0xfde4, 0x1f1e, 0x1cac, 0xfb12,
+	0xdf08, 0xe701, 0x0964, 0x22be, 0x14cf, 0xf091, 0xddc0, 0xee65,
+	0x135d, 0x21f5, 0x0a9a, 0xe730, 0xde35, 0xf8ba, 0x1b26, 0x1f92,
+	0x007b, 0xe0fe, 0xe352, 0x0311, 0x2107, 0x1986, 0xf57b, 0xde7a,
+	0xe9a4, 0x0ed6, 0x2354, 0x10e8, 0xec12, 0xdde2, 0xf391, 0x1749,
+	0x2277, 0x063f, 0xe4f5, 0xe021, 0xfea1, 0x1ea6, 0x1d9c, 0xfb59,
+	0xdf6a, 0xe6da, 0x07de, 0x2395, 0x1554, 0xf168, 0xdd34, 0xee39,
+	0x13e1, 0x22f3, 0x0c75, 0xe7b1, 0xdf51, 0xf7ba, 0x1b9c, 0x2086,
+	0x0115, 0xe1e0, 0xe281, 0x03ee, 0x20be, 0x1a96, 0xf5af, 0xdeb0,
+	0xe99f, 0x0d84, 0x242b, 0x10b6, 0xed0f, 0xdcd7, 0xf310, 0x175d,
+	0x2284, 0x06ef, 0xe490, 0xe045, 0xfcd6, 0x1f43, 0x1d67, 0xfbff,
+	0xdf52, 0xe5b4, 0x086f, 0x22ca, 0x168d, 0xf122, 0xddcd, 0xecff,
+	0x12e0, 0x23be, 0x0c29, 0xe8fa, 0xdd91, 0xf7f2, 0x1b5e, 0x20cf,
+	0x01d8, 0xe15e, 0xe289, 0x0251, 0x210f, 0x1a61, 0xf6d0, 0xde69,
+	0xe8be, 0x0d8b, 0x23bd, 0x11f9, 0xed56, 0xdd1e, 0xf1db, 0x1708,
+	0x228e, 0x07b7, 0xe538, 0xdf41, 0xfd22, 0x1e7a, 0x1e25, 0xfc67,
+	0xdf8f, 0xe54d, 0x0716, 0x21d6, 0x15f6, 0xf1a4, 0xdd1f, 0xeb89,
+	0x1226, 0x2361, 0x0d22, 0xe918, 0xdcb5, 0xf792, 0x1a98, 0x2103,
+	0x01d6, 0xe22a, 0xe1e2, 0x01c6, 0x20b7, 0x1adc, 0xf8cb, 0xdde3,
+	0xe82e, 0x0c94, 0x2455, 0x1284, 0xedf2, 0xdcda, 0xf13b, 0x1795,
+	0x2232, 0x096d, 0xe533, 0xdf5a, 0xfc1d, 0x1e61, 0x1ec0, 0xfd0b,
+	0xe0c4, 0xe3c6, 0x07e1, 0x21f6, 0x184f, 0xf3d5, 0xdc81, 0xec31,
+	0x11bb, 0x24bf, 0x0d98, 0xe9bb, 0xdd1c, 0xf6e5, 0x1b51, 0x2047,
+	0x044d, 0xe243, 0xe1a4, 0x0140, 0x2040, 0x1beb, 0xf845, 0xdeac,
+	0xe6f0, 0x0d72, 0x2329, 0x140c, 0xeeae, 0xdbe0, 0xf1d7, 0x15cc,
+	0x237c, 0x0875, 0xe613, 0xdf08, 0xfbae, 0x1e38, 0x1def, 0xff79,
+	0xdf5b, 0xe42b, 0x06e7, 0x220e, 0x18a6, 0xf282, 0xdd8b, 0xeb70,
+	0x1279, 0x232b, 0x0e7d, 0xea9d, 0xdc92, 0xf741, 0x1954, 0x21b1,
+	0x03ab, 0xe2b9, 0xe123, 0x00d9, 0x20bf, 0x1b58, 0xfa19, 0xdd1f,
+	0xe7d2, 0x0c39, 0x23b3, 0x13e3, 0xed96, 0xdcf6, 0xf09b, 0x1715,
+	0x21d2, 0x09a7, 0xe6b6, 0xde67, 0xfbd0, 0x1b6a, 0x1ef0, 0xfe91,
+	0xdf09, 0xe30b, 0x053f, 0x230a, 0x17ed, 0xf373, 0xdc12, 0xeb8c,
+	0x1214, 0x2308, 0x0ec9, 0xea1f, 0xdd38, 0xf637, 0x19da, 0x2176,
+	0x0542, 0xe29b, 0xe078, 0x010e, 0x202d, 0x1cdd, 0xf933, 0xddde,
+	0xe75d, 0x0c4a, 0x23e0, 0x13fe, 0xefd2, 0xdbd3, 0xf0f2, 0x15a8,
+	0x2372, 0x0a9c, 0xe5c7, 0xde0d, 0xfb13, 0x1e4b, 0x1f8c, 0xffb1,
+	0xde7b, 0xe41e, 0x069b, 0x22d9, 0x184c, 0xf368, 0xdd17, 0xeb1f,
+	0x11d3, 0x231f, 0x104f, 0xea67, 0xdc96, 0xf5a2, 0x19e9, 0x2263,
+	0x04e7, 0xe225, 0xdf80, 0x011f, 0x20e2, 0x1ced, 0xf962, 0xdd07,
+	0xe748, 0x0cb7, 0x2374, 0x1441, 0xee86, 0xdc9c, 0xf05d, 0x15a8,
+	0x2348, 0x0ac0, 0xe706, 0xdcf2, 0xfb1d, 0x1d87, 0x20bb, 0xfefd,
+	0xdecf, 0xe343, 0x06c1, 0x2335, 0x1854, 0xf482, 0xdc58, 0xebec,
+	0x113d, 0x23a4, 0x0fc3, 0xea3c, 0xdd06, 0xf539, 0x19d5, 0x21de,
+	0x059c, 0xe33b, 0xdf75, 0x007a, 0x2076, 0x1d65, 0xf994, 0xdd21,
+	0xe6e0, 0x0c04, 0x23fe, 0x1433, 0xef9a, 0xdc68, 0xefb3, 0x14c0,
+	0x21d0, 0x0ab3, 0xe60c, 0xdd6f, 0xf95a, 0x1ca1, 0x2074, 0xff9f,
+	0xdfc3, 0xe1a6, 0x0654, 0x2261, 0x19ce, 0xf3e0, 0xdc48, 0xeac6,
+	0x10f3, 0x249a, 0x0fa2, 0xeb6f, 0xdbce, 0xf57b, 0x196b, 0x2301,
+	0x0562, 0xe2c5, 0xdfc1, 0xfff0, 0x2187, 0x1cdd, 0xfa52, 0xdd55,
+	0xe6b1, 0x0bef, 0x2417, 0x150b, 0xef1f, 0xdc14, 0xefb0, 0x15fc,
+	0x23a2, 0x0af7, 0xe68f, 0xdd88, 0xfa5f, 0x1daf, 0x20e7, 0xff69,
+	0xdf9c, 0xe245, 0x066e, 0x2383, 0x18ca, 0xf471, 0xdc67, 0xeb3a,
+	0x10f7, 0x23e7, 0x0ff4, 0xeb10, 0xdc97, 0xf477, 0x199a, 0x229e,
+	0x05d6, 0xe2e7, 0xdf79, 0xff8f, 0x2104, 0x1d57, 0xfa35, 0xddab,
+	0xe604, 0x0b7b, 0x242c, 0x14e0, 0xefba, 0xdc0c, 0xef59, 0x15d2,
+	0x22ca, 0x0bb3, 0xe67d, 0xde62, 0xf908, 0x1c64, 0x20ca, 0x0013,
+	0xe13b, 0xe16a, 0x054a, 0x21c4, 0x1a5c, 0xf531, 0xdcf3, 0xe927,
+	0x0f0c, 0x253b, 0x1036, 0xec28, 0xdb15, 0xf4a7, 0x18f9, 0x2260,
+	0x0604, 0xe28a, 0xe0e1, 0xfdbb, 0x1ff5, 0x1d39, 0xfb2f, 0xdee3,
+	0xe47d, 0x0967, 0x22db, 0x1503, 0xefcb, 0xdb7b, 0xedc5, 0x143d,
+	0x237e, 0x0bc9, 0xe6f7, 0xdd20, 0xf896, 0x1cd1, 0x20e9, 0x00d3,
+	0xdfed, 0xe1ff, 0x03e6, 0x2302, 0x1ab3, 0xf4e3, 0xdcdc, 0xe8ca,
+	0x10a8, 0x251a, 0x112f, 0xeaca, 0xdbf8, 0xf42d, 0x19a4, 0x233d,
+	0x05ea, 0xe3a7, 0xdf2a, 0xfee1, 0x20ba, 0x1e87, 0xfafa, 0xdd2e,
+	0xe53b, 0x0a72, 0x2501, 0x15fd, 0xefc1, 0xdb90, 0xee28, 0x154d,
+	0x2488, 0x0c3d, 0xe609, 0xdd96, 0xf825, 0x1dbb, 0x2180, 0x0019,
+	0xe070, 0xe0f7, 0x054c, 0x21e0, 0x1b84, 0xf4cd, 0xdcbe, 0xe8b6,
+	0x0e58, 0x265b, 0x1088, 0xec3f, 0xdaef, 0xf38f, 0x18c6, 0x23e5,
+	0x06ea, 0xe2bd, 0xdf1e, 0xfc91, 0x21e1, 0x1dc5, 0xfb88, 0xdd74,
+	0xe528, 0x09eb, 0x2369, 0x174a, 0xefb9, 0xdce8, 0xec1e, 0x143d,
+	0x251d, 0x0c24, 0xe7d7, 0xdc6d, 0xf86a, 0x1c40, 0x21ce, 0x0122,
+	0xe0aa, 0xe134, 0x0284, 0x231e, 0x1acc, 0xf673, 0xdc61, 0xe87e,
+	0x0e95, 0x251d, 0x11e7, 0xeb77, 0xdc8e, 0xf1df, 0x1869, 0x22de,
+	0x07af, 0xe4b6, 0xde65, 0xfb10, 0x1ea8, 0x1f37, 0xfbd5, 0xdd82,
+	0xe298, 0x08a1, 0x24a5, 0x16fb, 0xf123, 0xdb0e, 0xecca, 0x1376,
+	0x2503, 0x0d64, 0xe776, 0xdcb6, 0xf618, 0x1d2a, 0x225e, 0x0206,
+	0xe052, 0xe0ea, 0x037a, 0x225e, 0x1b24, 0xf70c, 0xdd54, 0xe796,
+	0x0ccb, 0x25f2, 0x134f, 0xecec, 0xdab3, 0xf186, 0x1908, 0x23a6,
+	0x07ad, 0xe2f0, 0xe0db, 0xfa76, 0x206c, 0x1d6c, 0xff31, 0xe07a,
+	0xe170, 0x0871, 0x22ba, 0x1a9f, 0xf092, 0xdbf5, 0xeaa4, 0x13cd,
+	0x25c5, 0x0daa, 0xe89d, 0xdbbc, 0xf6f4, 0x1bb6, 0x2319, 0x0246,
+	0xe0eb, 0xdfd3, 0x0235, 0x2337, 0x1bc5, 0xf75e, 0xdcb0, 0xe76b,
+	0x0e1d, 0x24f8, 0x1351, 0xece7, 0xdb56, 0xf0e6, 0x1814, 0x24be,
+	0x084e, 0xe446, 0xdd73, 0xfc8c, 0x2077, 0x1f3d, 0xfcd8, 0xddcf,
+	0xe39a, 0x08a0, 0x2480, 0x17b9, 0xf15a, 0xdbb5, 0xecad, 0x13aa,
+	0x242b, 0x0d43, 0xe8f3, 0xdcc9, 0xf69a, 0x1b28, 0x2259, 0x0332,
+	0xe0c1, 0xe077, 0x01fd, 0x224d, 0x1b40, 0xf7a9, 0xdd7b, 0xe790,
+	0x0d1d, 0x23db, 0x1427, 0xed85, 0xdb75, 0xef5a, 0x168f, 0x2390,
+	0x081b, 0xe48c, 0xdcdb, 0xfc79, 0x1e72, 0x1f77, 0xfce6, 0xdf7d,
+	0xe2cc, 0x06d0, 0x23a5, 0x1832, 0xf426, 0xdab8, 0xec05, 0x1227,
+	0x258e, 0x0ddd, 0xe9e0, 0xdc12, 0xf60c, 0x1b63, 0x21fb, 0x05ae,
+	0xe063, 0xe045, 0x0119, 0x2319, 0x1c5c, 0xf7be, 0xdd47, 0xe695,
+	0x0e61, 0x2403, 0x14a9, 0xede6, 0xdad8, 0xf170, 0x1736, 0x24c1,
+	0x0803, 0xe577, 0xdd9c, 0xfce3, 0x1eed, 0x1e9f, 0xff91, 0xde0d,
+	0xe4ae, 0x064e, 0x23cc, 0x1865, 0xf2fd, 0xdc49, 0xeab9, 0x139b,
+	0x2362, 0x104f, 0xe8fe, 0xdbd5, 0xf6c0, 0x1a60, 0x235a, 0x02ef,
+	0xe1ff, 0xdfac, 0x01fc, 0x2146, 0x1c20, 0xfa08, 0xdbfb, 0xe82a,
+	0x0b73, 0x24f0, 0x142c, 0xee58, 0xdbb2, 0xeebc, 0x179a, 0x2353,
+	0x0bc9, 0xe4a8, 0xdcb3, 0xfb83, 0x1e88, 0x20ff, 0xfe01, 0xded7,
+	0xe1ca, 0x077a, 0x2349, 0x19ab, 0xf405, 0xda82, 0xebc9, 0x113a,
+	0x2553, 0x0f3b, 0xe9fa, 0xdbb0, 0xf4c8, 0x1b35, 0x2261, 0x0640,
+	0xe148, 0xdf2d, 0x00fb, 0x20bc, 0x1dd4, 0xf9e2, 0xdc9d, 0xe520,
+	0x0b35, 0x23bd, 0x1529, 0xee78, 0xda03, 0xefcd, 0x157e, 0x2444,
+	0x0a94, 0xe60d, 0xdce1, 0xf9f6, 0x1df4, 0x2053, 0x0166, 0xde4b,
+	0xe22b, 0x05da, 0x2319, 0x1b21, 0xf3af, 0xdbd6, 0xea4b, 0x1102,
+	0x24f5, 0x10c1, 0xeb34, 0xdabf, 0xf511, 0x1a12, 0x2440, 0x0594,
+	0xe0c9, 0xdfc8, 0x0052, 0x2222, 0x1c97, 0xfa83, 0xdcac, 0xe665,
+	0x0c25, 0x2422, 0x1662, 0xed85, 0xdbdf, 0xef33, 0x16d3, 0x243b,
+	0x0a8d, 0xe68b, 0xdc50, 0xfb9c, 0x1d57, 0x21d0, 0xff3b, 0xdeb3,
+	0xe211, 0x0602, 0x2484, 0x1979, 0xf489, 0xda1f, 0xeb3c, 0x1177,
+	0x2568, 0x1075, 0xe963, 0xdb70, 0xf47e, 0x1b51, 0x2311, 0x0609,
+	0xe116, 0xdee2, 0x0071, 0x2142, 0x1ecb, 0xf962, 0xdc93, 0xe4c4,
+	0x0c4d, 0x256b, 0x15c8, 0xeecb, 0xda0d, 0xf001, 0x15a1, 0x254c,
+	0x0b08, 0xe5ea, 0xdc93, 0xf994, 0x1e6a, 0x2123, 0x00d7, 0xde4c,
+	0xe157, 0x058a, 0x23f6, 0x1b24, 0xf344, 0xdb4f, 0xea27, 0x11a0,
+	0x2518, 0x0faa, 0xeae4, 0xdbed, 0xf4a4, 0x19b3, 0x22b6, 0x0614,
+	0xe229, 0xde9a, 0xfe53, 0x202d, 0x1d4a, 0xf90c, 0xdcaa, 0xe51a,
+	0x0c12, 0x2372, 0x14db, 0xee90, 0xdc6d, 0xee43, 0x1402, 0x24f6,
+	0x0bf3, 0xe73a, 0xda32, 0xf9d9, 0x1f53, 0x2329, 0xfe63, 0xdcf8,
+	0xe1d7, 0x0760, 0x24fb, 0x18d0, 0xf3d5, 0xdb19, 0xeae2, 0x1113,
+	0x261a, 0x10d9, 0xe9f4, 0xda93, 0xf3cb, 0x1bd0, 0x2442, 0x05ea,
+	0xe113, 0xde34, 0xffac, 0x2208, 0x1fd2, 0xfa6f, 0xdbe7, 0xe380,
+	0x0b89, 0x2727, 0x171e, 0xeec2, 0xd927, 0xee09, 0x168e, 0x26ab,
+	0x0c53, 0xe548, 0xdb99, 0xf8f5, 0x1e97, 0x224e, 0x00e1, 0xdf42,
+	0xe095, 0x03f1, 0x23e1, 0x1c20, 0xf5cc, 0xdb46, 0xe782, 0x0f83,
+	0x2659, 0x11f5, 0xebf7, 0xda87, 0xf2ac, 0x18e0, 0x23f3, 0x0825,
+	0xe320, 0xde60, 0xfbb1, 0x20e3, 0x1ffd, 0xfc37, 0xdcd5, 0xe2cc,
+	0x0b31, 0x257d, 0x1638, 0xef53, 0xdbcd, 0xef0d, 0x1405, 0x2306,
+	0x0be0, 0xe95d, 0xdd5f, 0xf7c4, 0x1aeb, 0x2171, 0x032e, 0xe0f6,
+	0xe143, 0x0105, 0x21fb, 0x1b5e, 0xf8a6, 0xdd56, 0xe6d3, 0x0c2d,
+	0x254f, 0x1568, 0xed64, 0xd8c0, 0xee19, 0x18bd, 0x251a, 0x089e,
+	0xe196, 0xdcbe, 0xfd23, 0x1fbd, 0x202f, 0xfbd5, 0xdcfc, 0xe39d,
+	0x0937, 0x25ab, 0x1569, 0xef8b, 0xdcd9, 0xf0b1, 0x146e, 0x2045,
+	0x0a3b, 0xe964, 0xe2e9, 0xf8f7, 0x198d, 0x1c06, 0x000b, 0xe5bd,
+	0xe7bf, 0x0525, 0x1a79, 0x14ed, 0xf7bc, 0xe4b8, 0xec6a, 0x0da3,
+	0x2236, 0x0b65, 0xe44c, 0xdffe, 0x09b3, 0x25c1, 0x08f0, 0xe07f,
+	0xebba, 0x1494, 0x17fe, 0xf316, 0xe6eb, 0x0807, 0x1c16, 0xfc76,
+	0xe115, 0xf941, 0x206f, 0x11e1, 0xe543, 0xe289, 0x1025, 0x23e5,
+	0xfb65, 0xdcfb, 0xf681, 0x200c, 0x126e, 0xe697, 0xe510, 0x109d,
+	0x2075, 0xfa5e, 0xdd50, 0xf8f5, 0x20dc, 0x1224, 0xe6aa, 0xe36a,
+	0x0f72, 0x2099, 0xfbb2, 0xdf8c, 0xf8ff, 0x1e43, 0x0fa0, 0xe6e0,
+	0xe94c, 0x13b1, 0x1b52, 0xf581, 0xdfc5, 0x0114, 0x2280, 0x082d,
+	0xe192, 0xebaf, 0x1958, 0x1ca8, 0xf058, 0xde41, 0x03dd, 0x232a,
+	0x06d5, 0xe048, 0xef25, 0x1a26, 0x1940, 0xecd3, 0xe169, 0x098f,
+	0x2233, 0x01dc, 0xdd86, 0xf272, 0x1da9, 0x17fd, 0xe97e, 0xdfc3,
+	0x0904, 0x21cd, 0x0154, 0xde7d, 0xf317, 0x1bf7, 0x14f7, 0xe9d5,
+	0xe3a9, 0x0cbb, 0x20e2, 0xfdac, 0xdd7f, 0xf58c, 0x1f86, 0x1538,
+	0xe870, 0xe27c, 0x0c7e, 0x21ec, 0xfe17, 0xdfc9, 0xf710, 0x1dee,
+	0x10a9, 0xe6c3, 0xe876, 0x11f1, 0x1f0d, 0xf734, 0xddbb, 0xfd08,
+	0x22b7, 0x0ebf, 0xe472, 0xe593, 0x1335, 0x1f96, 0xf7b9, 0xdf25,
+	0xfd7d, 0x2020, 0x0b9e, 0xe465, 0xea72, 0x1853, 0x1af6, 0xf296,
+	0xdd5e, 0x0354, 0x23a8, 0x091e, 0xe0d3, 0xea79, 0x199c, 0x1b84,
+	0xf2c0, 0xde81, 0x04f4, 0x2133, 0x05c5, 0xe08a, 0xefa3, 0x1c7a,
+	0x1803, 0xec29, 0xe026, 0x096b, 0x2400, 0x0241, 0xdda9, 0xf188,
+	0x1d01, 0x17d6, 0xeb70, 0xe246, 0x0a4b, 0x2175, 0xff04, 0xdfb4,
+	0xf573, 0x1e32, 0x1353, 0xe815, 0xe49b, 0x0eb0, 0x2136, 0xfb4a,
+	0xde47, 0xf842, 0x1f6f, 0x11d1, 0xe697, 0xe57a, 0x10b0, 0x1f7a,
+	0xfa1c, 0xde2a, 0xfaaa, 0x1ffe, 0x0fcd, 0xe49c, 0xe716, 0x1293,
+	0x1ed0, 0xf7ae, 0xde22, 0xfd1e, 0x20cc, 0x0c81, 0xe460, 0xe8d8,
+	0x137c, 0x1ca1, 0xf2e1, 0xe035, 0xfeaf, 0x20f3, 0x0918, 0xe203,
+	0xebea, 0x179a, 0x1b80, 0xf0e0, 0xdf92, 0x02b1, 0x22e2, 0x06e0,
+	0xe13c, 0xed6a, 0x19da, 0x1a01, 0xf07e, 0xe01e, 0x06ad, 0x219e,
+	0x043b, 0xe02a, 0xf0ba, 0x1c56, 0x17b8, 0xec6c, 0xe0e4, 0x0b72,
+	0x2187, 0x0234, 0xddf9, 0xf3c5, 0x1de4, 0x1558, 0xea45, 0xe352,
+	0x0cd5, 0x20f7, 0xfd71, 0xdeae, 0xf7e3, 0x1ef7, 0x1394, 0xe5b0,
+	0xe560, 0x0f51, 0x21e5, 0xfa6c, 0xdd5e, 0xf991, 0x1fca, 0x116c,
+	0xe560, 0xe72d, 0x119c, 0x1ef1, 0xf71f, 0xdf53, 0xfcc2, 0x2163,
+	0x0ce4, 0xe2c6, 0xe947, 0x156d, 0x1e3e, 0xf4e8, 0xddb7, 0xff6f,
+	0x225c, 0x0a72, 0xe343, 0xea3e, 0x16d3, 0x1c48, 0xf259, 0xdf93,
+	0x02ef, 0x21a1, 0x07a0, 0xe129, 0xed0f, 0x19d5, 0x1a95, 0xef2d,
+	0xdfc8, 0x055f, 0x22a0, 0x0547, 0xdf8e, 0xefb8, 0x1ac3, 0x192f,
+	0xedc9, 0xe0fb, 0x081f, 0x21d7, 0x022a, 0xdfeb, 0xf1d6, 0x1cf2,
+	0x1604, 0xea55, 0xe2a4, 0x0c29, 0x224d, 0xfe1b, 0xdddb, 0xf598,
+	0x1fc3, 0x1405, 0xe6de, 0xe263, 0x0da0, 0x2072, 0xfce0, 0xdcb0,
+	0xf87f, 0x1ea3, 0x1230, 0xe5b8, 0xe604, 0x10cd, 0x1fbc, 0xf979,
+	0xdc90, 0xfbf2, 0x1ff6, 0x1130, 0xe385, 0xe854, 0x100d, 0x217b,
+	0xf6be, 0xdfcc, 0xfca1, 0x1c74, 0x1022, 0xe244, 0xec0d, 0x1399,
+	0x1d52, 0xf3bc, 0xdf8e, 0x0199, 0x21b2, 0x091c, 0xe0c0, 0xecb3,
+	0x1846, 0x1c3d, 0xef99, 0xdff4, 0x0439, 0x22b9, 0x0642, 0xe011,
+	0xee89, 0x1aa9, 0x1964, 0xee08, 0xe044, 0x077f, 0x225f, 0x0301,
+	0xdf9f, 0xf1b5, 0x1cd1, 0x165e, 0xebff, 0xe180, 0x0bca, 0x21a1,
+	0xffb1, 0xde0c, 0xf498, 0x1f4b, 0x14d4, 0xe97e, 0xe1bc, 0x0ea2,
+	0x2144, 0xfe0d, 0xdde9, 0xf72a, 0x1ff3, 0x1227, 0xe7c4, 0xe445,
+	0x1177, 0x2020, 0xf96c, 0xde08, 0xf9fc, 0x222e, 0x0fdd, 0xe403,
+	0xe5f7, 0x13ed, 0x2049, 0xf708, 0xdd25, 0xfc97, 0x22df, 0x0cd0,
+	0xe2c0, 0xe936, 0x1580, 0x1ed6, 0xf32b, 0xddcd, 0x0120, 0x2281,
+	0x0b42, 0xdf75, 0xeb6e, 0x1757, 0x1e64, 0xf171, 0xddbe, 0x0268,
+	0x223a, 0x0965, 0xe03d, 0xedf2, 0x168d, 0x1aa1, 0xee0b, 0xe09c,
+	0x0556, 0x212c, 0x0490, 0xde83, 0xf0ba, 0x1bd4, 0x186a, 0xeb92,
+	0xe046, 0x091f, 0x2301, 0x0175, 0xde83, 0xf31c, 0x1d57, 0x1625,
+	0xea87, 0xe2c0, 0x0d22, 0x2019, 0xff15, 0xde38, 0xf70b, 0x1f72,
+	0x126c, 0xe879, 0xe421, 0x1100, 0x1f3b, 0xfbd0, 0xdde0, 0xfaa1,
+	0x2079, 0x0f3e, 0xe66d, 0xe609, 0x13db, 0x1e3a, 0xf880, 0xdda7,
+	0xfd70, 0x213c, 0x0da4, 0xe4e4, 0xe776, 0x15ef, 0x1ccc, 0xf5c6,
+	0xdee7, 0xffff, 0x21d8, 0x099a, 0xe349, 0xead0, 0x1812, 0x1c30,
+	0xf18a, 0xdef3, 0x02ab, 0x233a, 0x0857, 0xe05b, 0xebe1, 0x19aa,
+	0x1bb4, 0xeff9, 0xdf1e, 0x0443, 0x231f, 0x0608, 0xdfc7, 0xef3d,
+	0x1a11, 0x19ea, 0xed00, 0xe104, 0x0811, 0x21ff, 0x02a8, 0xdeac,
+	0xf216, 0x1d0e, 0x16c6, 0xea7d, 0xe1ff, 0x0a9a, 0x223b, 0xff38,
+	0xdf39, 0xf468, 0x1d26, 0x1499, 0xea32, 0xe3fd, 0x0cf5, 0x1f46,
+	0xfdb8, 0xdfbb, 0xf7b7, 0x1e14, 0x115b, 0xe7cc, 0xe5aa, 0x10c1,
+	0x1f12, 0xfa7d, 0xde1b, 0xfb06, 0x1f95, 0x0fcc, 0xe513, 0xe64a,
+	0x11ad, 0x1d16, 0xf828, 0xde8c, 0xfd3e, 0x1f72, 0x0bc4, 0xe497,
+	0xea1d, 0x157b, 0x1afc, 0xf487, 0xdf9e, 0x01ce, 0x20f6, 0x0883,
+	0xe362, 0xec5f, 0x1804, 0x1a38, 0xf2bd, 0xe013, 0x0483, 0x20a9,
+	0x0650, 0xe235, 0xee41, 0x1a4b, 0x17ee, 0xef4f, 0xe1ef, 0x069d,
+	0x21c7, 0x0297, 0xe104, 0xf206, 0x1adb, 0x172f, 0xebbc, 0xe3e3,
+	0x0945, 0x2100, 0x0013, 0xe03d, 0xf50e, 0x1c40, 0x14d7, 0xe9c8,
+	0xe54a, 0x0b90, 0x204c, 0xfd3f, 0xe0b2, 0xf746, 0x1cb1, 0x125c,
+	0xe8c2, 0xe705, 0x0e05, 0x1e65, 0xfb1b, 0xe0bd, 0xf9c2, 0x1e50,
+	0x0ee7, 0xe778, 0xe843, 0x113c, 0x1d35, 0xf80f, 0xe10f, 0xfcb2,
+	0x1f02, 0x0c1a, 0xe60d, 0xea65, 0x1306, 0x1c43, 0xf5a2, 0xe0ff,
+	0xffc0, 0x1f19, 0x0a92, 0xe4c1, 0xebd7, 0x165d, 0x198e, 0xf39f,
+	0xe215, 0x01ec, 0x2041, 0x05b4, 0xe3f7, 0xef41, 0x180b, 0x17fc,
+	0xefa8, 0xe2af, 0x06cb, 0x1ff6, 0x031a, 0xe1fc, 0xf1ad, 0x1aa7,
+	0x1584, 0xed77, 0xe412, 0x08f3, 0x1f6c, 0x00bf, 0xe1c9, 0xf475,
+	0x195c, 0x139b, 0xeb09, 0xe51e, 0x0a23, 0x1d2e, 0xff77, 0xe0a2,
+	0xf760, 0x1af1, 0x1144, 0xea80, 0xe64d, 0x0df5, 0x1d40, 0xfb93,
+	0xe158, 0xf903, 0x1ce4, 0x0fdd, 0xe881, 0xe90d, 0x0ef0, 0x1cca,
+	0xf989, 0xe242, 0xfc9a, 0x1c74, 0x0cc2, 0xe6c6, 0xec42, 0x124c,
+	0x1a8c, 0xf6e6, 0xe229, 0xffaf, 0x1e17, 0x0a06, 0xe6ac, 0xeca1,
+	0x1315, 0x1a57, 0xf4c5, 0xe362, 0x0223, 0x1d2a, 0x0826, 0xe4bb,
+	0xefe6, 0x16cb, 0x16de, 0xf1c4, 0xe370, 0x0610, 0x1e0e, 0x050b,
+	0xe369, 0xf233, 0x1801, 0x152a, 0xf0ea, 0xe40c, 0x08b7, 0x1c74,
+	0x01db, 0xe422, 0xf45d, 0x1a2e, 0x11a1, 0xee0f, 0xe694, 0x0ac7,
+	0x1d2a, 0xfe37, 0xe390, 0xf6a3, 0x1ab2, 0x115d, 0xebce, 0xe7d6,
+	0x0ba5, 0x1c96, 0xfcc1, 0xe34c, 0xf90c, 0x1ad0, 0x0f3d, 0xea57,
+	0xe95a, 0x0e9a, 0x1b47, 0xfa5c, 0xe322, 0xfb16, 0x1beb, 0x0d04,
+	0xe976, 0xeab0, 0x0f4e, 0x1ae1, 0xf885, 0xe41f, 0xfd7d, 0x1b05,
+	0x0b9d, 0xe738, 0xee42, 0x1110, 0x18ee, 0xf5a7, 0xe443, 0x010b,
+	0x1bdc, 0x088d, 0xe574, 0xeed8, 0x11df, 0x171a, 0xf372, 0xe504,
+	0x0235, 0x1ba7, 0x0533, 0xe70d, 0xf117, 0x14f2, 0x1436, 0xf184,
+	0xe7c1, 0x04ac, 0x1c02, 0x026d, 0xe676, 0xf476, 0x1646, 0x1331,
+	0xf0aa, 0xe761, 0x08bc, 0x1a80, 0x0143, 0xe570, 0xf67b, 0x1816,
+	0x10bc, 0xef0d, 0xe89e, 0x0b82, 0x192c, 0xfef2, 0xe590, 0xf94b,
+	0x18dc, 0x0d6b, 0xed8b, 0xea8a, 0x0d2a, 0x1915, 0xfacd, 0xe5f3,
+	0xfb3e, 0x19e8, 0x0c2b, 0xeaee, 0xec38, 0x0eac, 0x185a, 0xf962,
+	0xe5ea, 0xfcfb, 0x1a36, 0x09f8, 0xeaa7, 0xed66, 0x100f, 0x1786,
+	0xf77f, 0xe629, 0xff20, 0x1a42, 0x08a7, 0xe943, 0xef5e, 0x1165,
+	0x1566, 0xf5eb, 0xe741, 0x0218, 0x195c, 0x061a, 0xe8d1, 0xf251,
+	0x1204, 0x147e, 0xf40d, 0xe828, 0x03b0, 0x18b6, 0x04fa, 0xe8e3,
+	0xf3f4, 0x1310, 0x1209, 0xf2f4, 0xea54, 0x0583, 0x1880, 0x0108,
+	0xe92f, 0xf68b, 0x14ed, 0x0fd9, 0xf12d, 0xeaee, 0x07aa, 0x1853,
+	0xff41, 0xe8fe, 0xf7b3, 0x14e8, 0x0eab, 0xefd8, 0xecd2, 0x0a14,
+	0x15c7, 0xfe44, 0xe850, 0xfb90, 0x14b4, 0x0af2, 0xedca, 0xecfd,
+	0x0b84, 0x1541, 0xfb55, 0xe7f7, 0xfc43, 0x15a3, 0x0a91, 0xecbb,
+	0xef98, 0x0d45, 0x142e, 0xf968, 0xe935, 0xff12, 0x1748, 0x06d6,
+	0xed01, 0xf13f, 0x0f2c, 0x1431, 0xf636, 0xea9d, 0x00bf, 0x179e,
+	0x05e5, 0xeb47, 0xf345, 0x1069, 0x1303, 0xf48c, 0xeb1a, 0x02ec,
+	0x1784, 0x0419, 0xea60, 0xf531, 0x10e8, 0x1239, 0xf340, 0xebef,
+	0x03d7, 0x176d, 0x0251, 0xeaab, 0xf669, 0x123f, 0x1056, 0xf246,
+	0xecaf, 0x061a, 0x1703, 0xffa6, 0xeb27, 0xf7b5, 0x1382, 0x0daa,
+	0xf249, 0xedbb, 0x0786, 0x154c, 0xfe7c, 0xebea, 0xf94b, 0x13c9,
+	0x0b85, 0xf0d3, 0xef33, 0x0a3b, 0x13e8, 0xfcbd, 0xeaf5, 0xfc68,
+	0x14c3, 0x090d, 0xf08e, 0xefdc, 0x0b55, 0x131c, 0xfa84, 0xebb1,
+	0xfe92, 0x13c8, 0x087e, 0xee7a, 0xf1ea, 0x0e98, 0x10c5, 0xf939,
+	0xeab8, 0x0147, 0x1512, 0x056e, 0xed64, 0xf37e, 0x0ed7, 0x10f8,
+	0xf70e, 0xeba1, 0x029a, 0x14c2, 0x0495, 0xebf3, 0xf542, 0x0fc4,
+	0x10b3, 0xf482, 0xec52, 0x03ff, 0x1556, 0x0311, 0xead3, 0xf5ec,
+	0x0f1f, 0x0ece, 0xf3a3, 0xed31, 0x03ed, 0x13c0, 0x0190, 0xec1d,
+	0xf87c, 0x1076, 0x0d15, 0xf29b, 0xef3f, 0x06cd, 0x13c6, 0xfef5,
+	0xec5b, 0xfae3, 0x1161, 0x0c10, 0xf22f, 0xf084, 0x0787, 0x136a,
+	0xfdf4, 0xed5e, 0xfb3f, 0x11c8, 0x0ae1, 0xf112, 0xf1d1, 0x09b1,
+	0x125b, 0xfc3a, 0xed30, 0xfd46, 0x1363, 0x0773, 0xf1c9, 0xf1e7,
+	0x0ad8, 0x11b0, 0xfa2d, 0xee0a, 0xff1e, 0x12d9, 0x06c1, 0xefeb,
+	0xf3b8, 0x0d8c, 0x0ef5, 0xf96a, 0xecea, 0x0258, 0x124e, 0x04f0,
+	0xef2d, 0xf555, 0x0e0e, 0x0dc5, 0xf911, 0xed5c, 0x03ac, 0x11d0,
+	0x0312, 0xef60, 0xf698, 0x0f17, 0x0ce4, 0xf57c, 0xeff0, 0x0446,
+	0x12ce, 0x00a5, 0xee54, 0xf938, 0x0eee, 0x0cbf, 0xf442, 0xf028,
+	0x0557, 0x1242, 0xffe7, 0xee6b, 0xf9c8, 0x0fb7, 0x0b76, 0xf35b,
+	0xf1bd, 0x06b5, 0x11c5, 0xfe00, 0xee2b, 0xfc70, 0x0f92, 0x0a50,
+	0xf22f, 0xf291, 0x081d, 0x1130, 0xfd62, 0xee4f, 0xfcf6, 0x1038,
+	0x08a8, 0xf1b8, 0xf412, 0x0921, 0x0fc1, 0xfb4b, 0xef45, 0xff42,
+	0x106d, 0x04b7, 0xf11d, 0xf3db, 0x0a65, 0x0e9b, 0xf933, 0xef34,
+	0xffc6, 0x10e9, 0x04bc, 0xf0b5, 0xf5c5, 0x0c26, 0x0cdb, 0xf8e0,
+	0xefd8, 0x02df, 0x1053, 0x038d, 0xf069, 0xf7cd, 0x0d41, 0x0bd6,
+	0xf8fa, 0xef23, 0x04a9, 0x1056, 0x01c1, 0xf0fc, 0xf7c3, 0x0ee1,
+	0x0a96, 0xf67e, 0xf1a9, 0x04e0, 0x10af, 0xff95, 0xf04a, 0xfa2c,
+	0x0e88, 0x09ec, 0xf576, 0xf1e6, 0x061b, 0x1023, 0xfe90, 0xf041,
+	0xfb33, 0x0f07, 0x0918, 0xf3dd, 0xf3ec, 0x06d1, 0x0ffa, 0xfccb,
+	0xf069, 0xfd87, 0x0e57, 0x0874, 0xf2cf, 0xf538, 0x0798, 0x0f9d,
+	0xfbf6, 0xf093, 0xfe73, 0x0ee8, 0x0762, 0xf24d, 0xf5d6, 0x0976,
+	0x0dc6, 0xfb48, 0xf0f5, 0xffc8, 0x0fae, 0x0491, 0xf357, 0xf5c3,
+	0x0a63, 0x0da2, 0xf98a, 0xf15c, 0x008b, 0x0fff, 0x045d, 0xf1ee,
+	0xf758, 0x0b15, 0x0c4f, 0xf8aa, 0xf1db, 0x023f, 0x0ec3, 0x02fc,
+	0xf164, 0xf965, 0x0ba0, 0x0aa6, 0xf8ee, 0xf126, 0x046b, 0x0ea3,
+	0x00c9, 0xf297, 0xf8a4, 0x0d0c, 0x097f, 0xf6ce, 0xf3eb, 0x040e,
+	0x0e94, 0xff85, 0xf141, 0xfad8, 0x0b6b, 0x079c, 0xf5e2, 0xf360,
+	0x0579, 0x0d69, 0xfe4f, 0xf16b, 0xfc53, 0x0d32, 0x0715, 0xf544,
+	0xf482, 0x07ca, 0x0ceb, 0xfd23, 0xf210, 0xfdad, 0x0e48, 0x057f,
+	0xf4f2, 0xf63f, 0x080d, 0x0d8c, 0xfb2e, 0xf2cd, 0xfefa, 0x0e7c,
+	0x055a, 0xf320, 0xf7c0, 0x08e2, 0x0cd7, 0xfa51, 0xf2ce, 0x0099,
+	0x0e3f, 0x03de, 0xf3bd, 0xf81a, 0x09a4, 0x0beb, 0xf9aa, 0xf300,
+	0x01a7, 0x0e2c, 0x0313, 0xf33e, 0xf8b2, 0x0a91, 0x0a8f, 0xf8d0,
+	0xf459, 0x01f7, 0x0d70, 0x0252, 0xf224, 0xfc73, 0x0834, 0x09aa,
+	0xf911, 0xf345, 0x0550, 0x0bb9, 0x0147, 0xf303, 0xfb04, 0x0b54,
+	0x0880, 0xf75f, 0xf4e0, 0x053b, 0x0c7e, 0xff81, 0xf344, 0xfc30,
+	0x0cb3, 0x0605, 0xf741, 0xf5ab, 0x050c, 0x0d54, 0xfc74, 0xf3dd,
+	0xfd92, 0x0bea, 0x06a8, 0xf4ca, 0xf720, 0x0743, 0x0b74, 0xfca1,
+	0xf2cd, 0xff75, 0x0c91, 0x0442, 0xf5af, 0xf76b, 0x07ef, 0x0b5e,
+	0xfb62, 0xf405, 0xff6d, 0x0cb9, 0x040e, 0xf4cc, 0xf805, 0x08ba,
+	0x0a43, 0xfb03, 0xf3f3, 0x0122, 0x0c64, 0x01b4, 0xf41e, 0xf861,
+	0x08e0, 0x08dc, 0xf9e0, 0xf390, 0x0269, 0x0bc5, 0x024d, 0xf448,
+	0xf976, 0x0a41, 0x088b, 0xf988, 0xf4c5, 0x030d, 0x0c83, 0x00be,
+	0xf41e, 0xfc1b, 0x0a46, 0x0858, 0xf89a, 0xf569, 0x0497, 0x0be7,
+	0x0049, 0xf464, 0xfc14, 0x0a74, 0x07ac, 0xf775, 0xf6be, 0x0593,
+	0x0abb, 0xff72, 0xf3ca, 0xfe2c, 0x0b39, 0x0537, 0xf7bc, 0xf763,
+	0x04d9, 0x0c71, 0xfc53, 0xf646, 0xfcd7, 0x0918, 0x07e3, 0xf4e4,
+	0xf970, 0x0576, 0x0ab9, 0xfcf8, 0xf444, 0xffea, 0x0b73, 0x0396,
+	0xf5e9, 0xf892, 0x0807, 0x09bf, 0xfb76, 0xf4b8, 0x0077, 0x0c3a,
+	0x0245, 0xf637, 0xf89d, 0x08bd, 0x0930, 0xfa3c, 0xf5c2, 0x0145,
+	0x0c0d, 0x019f, 0xf550, 0xfaef, 0x0897, 0x0912, 0xf936, 0xf611,
+	0x01ef, 0x0bbe, 0x015c, 0xf4b3, 0xfb54, 0x090c, 0x088e, 0xf917,
+	0xf63c, 0x0306, 0x0b89, 0xffa7, 0xf54e, 0xfc6d, 0x09ee, 0x06af,
+	0xf8e7, 0xf67b, 0x0482, 0x0ad2, 0xfee1, 0xf559, 0xfc97, 0x0a10,
+	0x0681, 0xf7ff, 0xf6c4, 0x05c8, 0x0994, 0xff75, 0xf3ce, 0xfd76,
+	0x0a10, 0x030d, 0xf7ae, 0xf672, 0x060c, 0x09f5, 0xfc1e, 0xf55f,
+	0xfdc1, 0x0b42, 0x03ec, 0xf66c, 0xf852, 0x065a, 0x0a18, 0xfb76,
+	0xf5a8, 0xff65, 0x0b10, 0x0384, 0xf60f, 0xf9a3, 0x07dc, 0x088a,
+	0xfcb6, 0xf456, 0x01d4, 0x0b08, 0x0233, 0xf73e, 0xf851, 0x0a14,
+	0x0787, 0xfb5c, 0xf5b9, 0x017d, 0x0c6d, 0x0066, 0xf654, 0xfa94,
+	0x0971, 0x081f, 0xf954, 0xf668, 0x026a, 0x0c04, 0xfff7, 0xf586,
+	0xfc07, 0x0987, 0x07fb, 0xf846, 0xf6c2, 0x03f0, 0x0b89, 0xff53,
+	0xf4ce, 0xfd10, 0x0a5e, 0x06cf, 0xf7c6, 0xf744, 0x04a5, 0x0b58,
+	0xfec5, 0xf4a4, 0xfdaa, 0x0a81, 0x061d, 0xf72c, 0xf734, 0x060a,
+	0x0a8b, 0xfd9d, 0xf4e9, 0xfe3a, 0x0b6a, 0x04a0, 0xf6c9, 0xf7d6,
+	0x064a, 0x0ab5, 0xfc82, 0xf4bc, 0xff46, 0x0b67, 0x048e, 0xf60b,
+	0xf824, 0x079c, 0x09e7, 0xfb99, 0xf499, 0x0043, 0x0bc7, 0x035b,
+	0xf4d3, 0xf9ed, 0x088b, 0x0957, 0xfb53, 0xf387, 0x031d, 0x0b4f,
+	0x021f, 0xf4f5, 0xf98d, 0x0aab, 0x07d7, 0xf9de, 0xf45d, 0x0382,
+	0x0bb9, 0xffe1, 0xf38d, 0xf9bb, 0x0a58, 0x0715, 0xf848, 0xf4a5,
+	0x0321, 0x0c81, 0xff90, 0xf3e0, 0xfba8, 0x0abf, 0x081e, 0xf74e,
+	0xf580, 0x04e8, 0x0caa, 0xfec3, 0xf3c0, 0xfcae, 0x0bda, 0x0752,
+	0xf62a, 0xf6a9, 0x0571, 0x0d2f, 0xfd98, 0xf34f, 0xfdfc, 0x0c1a,
+	0x06fc, 0xf515, 0xf6d8, 0x071a, 0x0c84, 0xfc7b, 0xf35f, 0xfeb7,
+	0x0d51, 0x0547, 0xf4f9, 0xf73a, 0x07e5, 0x0c58, 0xfadf, 0xf380,
+	0xff7b, 0x0dfd, 0x03eb, 0xf46b, 0xf7d5, 0x08e3, 0x0bec, 0xf984,
+	0xf392, 0x00a5, 0x0ddf, 0x035b, 0xf2d9, 0xf915, 0x0a43, 0x0aa4,
+	0xf9b7, 0xf200, 0x034e, 0x0e11, 0x0175, 0xf32e, 0xf86d, 0x0c5c,
+	0x0975, 0xf7de, 0xf315, 0x042d, 0x0ecf, 0xffff, 0xf1b5, 0xfabd,
+	0x0d54, 0x08da, 0xf676, 0xf2de, 0x0613, 0x0eb2, 0xfed8, 0xf10c,
+	0xfbf0, 0x0e1d, 0x0892, 0xf4f0, 0xf374, 0x0765, 0x0edc, 0xfd57,
+	0xf0d8, 0xfc86, 0x0f63, 0x0783, 0xf354, 0xf4b2, 0x07a3, 0x0fbc,
+	0xfbe1, 0xf075, 0xfe0e, 0x0f66, 0x0745, 0xf27f, 0xf4bd, 0x0933,
+	0x0e8e, 0xfb79, 0xef62, 0xff29, 0x0ecf, 0x054c, 0xf11e, 0xf493,
+	0x0ab6, 0x0d14, 0xf9ff, 0xeed9, 0x00e2, 0x1093, 0x042c, 0xf141,
+	0xf569, 0x0ca5, 0x0d84, 0xf78c, 0xf0c8, 0x0164, 0x123b, 0x0243,
+	0xefd4, 0xf885, 0x0d24, 0x0db4, 0xf607, 0xf06c, 0x04c4, 0x119d,
+	0x014f, 0xeed0, 0xf937, 0x0f83, 0x0b99, 0xf564, 0xefd8, 0x0763,
+	0x1115, 0x002a, 0xee21, 0xfa2e, 0x1159, 0x09a3, 0xf44a, 0xefd7,
+	0x08d6, 0x11a9, 0xfe88, 0xed00, 0xfc1a, 0x11be, 0x09bf, 0xf2ad,
+	0xf013, 0x0afa, 0x1145, 0xfcaa, 0xec7b, 0xfd09, 0x1391, 0x07f9,
+	0xf09f, 0xf142, 0x0bd6, 0x1227, 0xfa37, 0xec61, 0xfe79, 0x148e,
+	0x06f0, 0xeeee, 0xf283, 0x0ce0, 0x1233, 0xf801, 0xecb2, 0x0010,
+	0x14ea, 0x064a, 0xecff, 0xf483, 0x0dda, 0x11ce, 0xf6c3, 0xebbb,
+	0x0316, 0x1473, 0x0520, 0xebf6, 0xf550, 0x1028, 0x104d, 0xf59f,
+	0xeba8, 0x0491, 0x1540, 0x02c0, 0xeb4f, 0xf684, 0x11c3, 0x0f3d,
+	0xf3a9, 0xec13, 0x0641, 0x15b1, 0x00ae, 0xea69, 0xf7b5, 0x131c,
+	0x0e11, 0xf187, 0xeccb, 0x0871, 0x15bb, 0xfdd1, 0xe8c0, 0xf85a,
+	0x1432, 0x0bc5, 0xef98, 0xecce, 0x0a2c, 0x15f5, 0xfbcd, 0xe91f,
+	0xfa92, 0x16e4, 0x0a97, 0xedc3, 0xee3e, 0x0d56, 0x15ae, 0xf9f6,
+	0xe868, 0xfde4, 0x180b, 0x0951, 0xeca7, 0xef0c, 0x0fec, 0x14b1,
+	0xf8f5, 0xe7ea, 0x001f, 0x1943, 0x06dc, 0xeb36, 0xf0b0, 0x117f,
+	0x1507, 0xf4cb, 0xe8e0, 0x0226, 0x19b9, 0x0560, 0xe8e5, 0xf313,
+	0x128d, 0x145a, 0xf2b6, 0xe924, 0x03fa, 0x19cd, 0x03ca, 0xe796,
+	0xf4ac, 0x1431, 0x1339, 0xf159, 0xe87e, 0x06dd, 0x19f0, 0x01ec,
+	0xe648, 0xf635, 0x1642, 0x113f, 0xefd2, 0xe8e4, 0x091d, 0x19ff,
+	0xff46, 0xe65f, 0xf743, 0x1803, 0x0ffd, 0xed04, 0xea63, 0x0b39,
+	0x1a85, 0xfc96, 0xe547, 0xf9e2, 0x1985, 0x0dcc, 0xeb4c, 0xeb2b,
+	0x0d91, 0x19c8, 0xfa57, 0xe476, 0xfcee, 0x1a86, 0x0c37, 0xe948,
+	0xec0a, 0x119d, 0x1849, 0xf78a, 0xe3d0, 0xfffa, 0x1c24, 0x090b,
+	0xe72a, 0xee9e, 0x1372, 0x177c, 0xf4d8, 0xe445, 0x0288, 0x1c39,
+	0x06d3, 0xe68f, 0xefa0, 0x1595, 0x1614, 0xf316, 0xe430, 0x0386,
+	0x1ca0, 0x0364, 0xe509, 0xefdf, 0x1724, 0x14ee, 0xf081, 0xe4b3,
+	0x059e, 0x1db1, 0x02c4, 0xe327, 0xf351, 0x18d1, 0x1503, 0xedd3,
+	0xe4e2, 0x09a8, 0x1e6e, 0x002f, 0xe1c2, 0xf65d, 0x1aa2, 0x13b1,
+	0xea3b, 0xe73c, 0x0b96, 0x1e65, 0xfda5, 0xe121, 0xf8ae, 0x1bdd,
+	0x11f5, 0xe88a, 0xe789, 0x0f00, 0x1e0a, 0xfabe, 0xe063, 0xfacf,
+	0x1ecd, 0x0e19, 0xe727, 0xe892, 0x1189, 0x1d0c, 0xf76b, 0xe0b5,
+	0xfde4, 0x1f21, 0x0c5e, 0xe4f5, 0xeaab, 0x14d5, 0x1bad, 0xf4ad,
+	0xe066, 0x00fc, 0x1fa9, 0x09da, 0xe2a4, 0xee1c, 0x16de, 0x19ff,
+	0xf28a, 0xe05d, 0x0530, 0x1fee, 0x0634, 0xe226, 0xef08, 0x1a19,
+	0x1840, 0xeec4, 0xe1a4, 0x075d, 0x21a2, 0x02a0, 0xe0b2, 0xf1b9,
+	0x1c39, 0x1644, 0xec14, 0xe2b5, 0x0a2a, 0x2159, 0xffe1, 0xdfe4,
+	0xf443, 0x1d71, 0x14ea, 0xea0f, 0xe319, 0x0d05, 0x211a, 0xfde9,
+	0xde62, 0xf670, 0x1f08, 0x12e1, 0xe7af, 0xe451, 0x0f77, 0x2095,
+	0xfb37, 0xde10, 0xf8ee, 0x20d8, 0x1081, 0xe59a, 0xe58c, 0x11c3,
+	0x2090, 0xf6d4, 0xdcef, 0xfb36, 0x20c1, 0x0e3d, 0xe23e, 0xe7eb,
+	0x14bb, 0x1da7, 0xf528, 0xdceb, 0xfffd, 0x2227, 0x0b04, 0xe237,
+	0xe98c, 0x1866, 0x1d14, 0xf1dc, 0xde93, 0x0210, 0x23a0, 0x0857,
+	0xdfbd, 0xeddd, 0x1a01, 0x1bdd, 0xef4e, 0xde7c, 0x0771, 0x22e0,
+	0x0585, 0xde8c, 0xefb8, 0x1cf0, 0x1940, 0xeccd, 0xdf6f, 0x0a5e,
+	0x22f9, 0x02ef, 0xdd1a, 0xf288, 0x1f77, 0x1674, 0xe9a1, 0xe09f,
+	0x0d62, 0x238c, 0xfe25, 0xdcd7, 0xf532, 0x20e8, 0x14b8, 0xe6ba,
+	0xe274, 0x0fd1, 0x232e, 0xfad3, 0xdcbb, 0xf78c, 0x2298, 0x11ec,
+	0xe45b, 0xe441, 0x126a, 0x2251, 0xf7fb, 0xdc39, 0xfb00, 0x2338,
+	0x0feb, 0xe2b0, 0xe5cb, 0x147e, 0x211d, 0xf613, 0xdb58, 0xfe92,
+	0x2340, 0x0e26, 0xe070, 0xe7ec, 0x17e6, 0x1eb0, 0xf336, 0xdbc2,
+	0x01ca, 0x2416, 0x0a42, 0xdf82, 0xeb0e, 0x1990, 0x1d30, 0xeff8,
+	0xdd9f, 0x0465, 0x23f4, 0x06fc, 0xdec5, 0xeda1, 0x1c2a, 0x1a94,
+	0xedbd, 0xdead, 0x07c2, 0x2475, 0x02b4, 0xdeee, 0xefa3, 0x1e14,
+	0x1816, 0xeb93, 0xe005, 0x0a47, 0x22b4, 0xff1a, 0xdce4, 0xf2d4,
+	0x1f6e, 0x1514, 0xe7eb, 0xe1bf, 0x0d2e, 0x23cb, 0xfc03, 0xdce2,
+	0xf6a6, 0x1ff3, 0x1541, 0xe410, 0xe5b6, 0x0dc4, 0x2293, 0xfaa5,
+	0xdbc9, 0xf9fa, 0x222b, 0x1223, 0xe280, 0xe582, 0x138a, 0x22f8,
+	0xf587, 0xdc22, 0xfc4d, 0x253e, 0x0dfa, 0xe0fc, 0xe703, 0x1706,
+	0x20c2, 0xf2aa, 0xdca5, 0x0042, 0x24fb, 0x0b14, 0xdf51, 0xea0e,
+	0x19d5, 0x1e57, 0xf05f, 0xdc9e, 0x0426, 0x24c4, 0x0837, 0xde5d,
+	0xed11, 0x1ada, 0x1ce5, 0xede9, 0xde73, 0x0605, 0x24c4, 0x051f,
+	0xdd87, 0xef6b, 0x1c8e, 0x1b86, 0xeae1, 0xdf9b, 0x0891, 0x2528,
+	0x027a, 0xdc54, 0xf1d8, 0x1ec5, 0x187d, 0xe8f3, 0xdff2, 0x0d33,
+	0x23b0, 0xff79, 0xdb24, 0xf519, 0x21d8, 0x14ce, 0xe68b, 0xe088,
+	0x1207, 0x22e8, 0xfb82, 0xda27, 0xf890, 0x23ac, 0x123c, 0xe3b0,
+	0xe352, 0x14d7, 0x21cc, 0xf740, 0xdaaf, 0xfcdd, 0x24af, 0x0e7f,
+	0xe0c3, 0xe6db, 0x1728, 0x2127, 0xf343, 0xdb40, 0x0035, 0x24f7,
+	0x0c01, 0xdef2, 0xe94a, 0x1937, 0x1f36, 0xf099, 0xdb36, 0x0267,
+	0x2422, 0x07ed, 0xdd46, 0xebc9, 0x1aa9, 0x1d09, 0xedb3, 0xdcaa,
+	0x062a, 0x2489, 0x069b, 0xdc8c, 0xee05, 0x1d21, 0x1b5b, 0xec50,
+	0xddc2, 0x08e9, 0x2525, 0x02fe, 0xdc22, 0xf0e3, 0x1f63, 0x196c,
+	0xe919, 0xdf33, 0x0c24, 0x254f, 0x0036, 0xdb2b, 0xf3fb, 0x2088,
+	0x17a5, 0xe645, 0xe0f8, 0x0fb8, 0x2435, 0xfcdc, 0xda1b, 0xf8b9,
+	0x225a, 0x1445, 0xe340, 0xe399, 0x13aa, 0x2243, 0xf949, 0xda35,
+	0xfc87, 0x2332, 0x106a, 0xe243, 0xe5f7, 0x162d, 0x2078, 0xf5c5,
+	0xdb6c, 0xff2c, 0x245d, 0x0c8e, 0xe0a8, 0xe8a0, 0x18e5, 0x1f11,
+	0xf1d3, 0xdc4f, 0x023d, 0x24ad, 0x0981, 0xdf22, 0xea9b, 0x1ae6,
+	0x1d33, 0xef92, 0xdcae, 0x0520, 0x253d, 0x06cd, 0xdd79, 0xed3d,
+	0x1d04, 0x1bbd, 0xec94, 0xdd58, 0x0827, 0x252a, 0x041a, 0xdc2a,
+	0xefe6, 0x1e61, 0x1a2f, 0xea50, 0xde5e, 0x0ac4, 0x2549, 0x0133,
+	0xdba5, 0xf1b8, 0x20e7, 0x1788, 0xe812, 0xdfa8, 0x0da2, 0x24d7,
+	0xfd82, 0xdbd7, 0xf495, 0x22c2, 0x1457, 0xe61a, 0xe108, 0x10e2,
+	0x22c7, 0xf988, 0xda4c, 0xf744, 0x239b, 0x1140, 0xe2e9, 0xe346,
+	0x140f, 0x21e3, 0xf6ef, 0xda9c, 0xfd24, 0x2399, 0x0f00, 0xe161,
+	0xe6fb, 0x1754, 0x1feb, 0xf46d, 0xdb57, 0x00f5, 0x246b, 0x0bdb,
+	0xdfb5, 0xe98e, 0x1a67, 0x1dea, 0xf1e2, 0xdbd5, 0x0451, 0x2545,
+	0x07eb, 0xdf08, 0xeb90, 0x1caa, 0x1bfa, 0xeeb9, 0xdd06, 0x0742,
+	0x24ea, 0x058d, 0xdd71, 0xee00, 0x1f52, 0x19c0, 0xebb3, 0xdda4,
+	0x09f8, 0x25a6, 0x0187, 0xdc2e, 0xf0f1, 0x2058, 0x188d, 0xe89e,
+	0xdf0f, 0x0ca6, 0x2561, 0xff28, 0xdacb, 0xf36d, 0x21f1, 0x16e1,
+	0xe602, 0xdfe4, 0x0fcc, 0x24e1, 0xfc8c, 0xd976, 0xf736, 0x2370,
+	0x1426, 0xe3b1, 0xe1ae, 0x137b, 0x238d, 0xf8e5, 0xd9dd, 0xfa64,
+	0x24c1, 0x111c, 0xe15b, 0xe4a4, 0x159d, 0x2257, 0xf537, 0xdaf9,
+	0xfe3b, 0x2538, 0x0cfc, 0xe0ab, 0xe814, 0x1876, 0x1fd7, 0xf1d0,
+	0xdcbe, 0x011c, 0x24cd, 0x0a48, 0xdf30, 0xeb14, 0x1a5a, 0x1d1b,
+	0xf092, 0xdc80, 0x054a, 0x247b, 0x068c, 0xde5c, 0xed73, 0x1ca6,
+	0x1b57, 0xec7f, 0xdd4a, 0x06c1, 0x23c0, 0x036f, 0xdc4c, 0xef36,
+	0x1e3b, 0x194d, 0xe988, 0xdf1b, 0x09f6, 0x25e8, 0xffa8, 0xdb5a,
+	0xf2f8, 0x217b, 0x1706, 0xe682, 0xe05a, 0x0f10, 0x258f, 0xfb6d,
+	0xdbcb, 0xf572, 0x23e6, 0x13f4, 0xe406, 0xe329, 0x1155, 0x2485,
+	0xf86d, 0xdb43, 0xfa3b, 0x23ef, 0x1163, 0xe178, 0xe5c4, 0x14e6,
+	0x2258, 0xf559, 0xdb83, 0xfdcc, 0x2457, 0x0e71, 0xe03b, 0xe7e9,
+	0x1727, 0x20cd, 0xf2a2, 0xdb9d, 0x0092, 0x25aa, 0x0b1b, 0xdf14,
+	0xe969, 0x1a93, 0x1f0a, 0xef3f, 0xdcb8, 0x036d, 0x2603, 0x07ad,
+	0xdd6c, 0xece6, 0x1c2c, 0x1d10, 0xed52, 0xdd27, 0x0721, 0x25e5,
+	0x04d5, 0xdc72, 0xef2c, 0x1d7c, 0x1bc8, 0xe9de, 0xdeac, 0x0ad9,
+	0x24e6, 0x0224, 0xdbb1, 0xf276, 0x203e, 0x1772, 0xe81e, 0xe07c,
+	0x0c8b, 0x24ef, 0xfdfd, 0xdb5f, 0xf5c5, 0x218e, 0x152d, 0xe543,
+	0xe1f9, 0x1157, 0x2353, 0xf9c9, 0xdb32, 0xf983, 0x237b, 0x1148,
+	0xe259, 0xe543, 0x13fd, 0x21ff, 0xf671, 0xdb7d, 0xfca3, 0x2435,
+	0x0e99, 0xe0f8, 0xe6f7, 0x1587, 0x209e, 0xf1c2, 0xdb09, 0xff43,
+	0x2420, 0x0b23, 0xddd8, 0xe9f3, 0x1952, 0x1e73, 0xf004, 0xdbe6,
+	0x0395, 0x2490, 0x08f7, 0xddba, 0xec38, 0x1ad7, 0x1daf, 0xee86,
+	0xdcfc, 0x062c, 0x24ed, 0x0710, 0xdbdb, 0xef4c, 0x1d98, 0x1c2e,
+	0xeb59, 0xdd9b, 0x09b2, 0x2625, 0x03db, 0xdb26, 0xf041, 0x1f8a,
+	0x1b39, 0xe865, 0xddcb, 0x0c7f, 0x26fa, 0x0156, 0xd8fc, 0xf30a,
+	0x22e7, 0x18eb, 0xe580, 0xde97, 0x0ff5, 0x25c5, 0xfda1, 0xd92c,
+	0xf78f, 0x21f2, 0x145e, 0xe56b, 0xe396, 0x123e, 0x1fc2, 0xf941,
+	0xde8a, 0xfc97, 0x1ee3, 0x0c4b, 0xe6fc, 0xecd7, 0x117c, 0x168a,
+	0xf701, 0xe930, 0x00a8, 0x1373, 0x0414, 0xf35e, 0xf914, 0x0892,
+	0x083c, 0xfaed, 0xf8c9, 0x00ad, 0x0616, 0x0104, 0xfbc6, 0xfda3,
+	0x01d7, 0x0278, 0xffdd, 0xfe4f, 0xfea4, 0x006f, 0x01a8, 0x00d2,
+	0xfee2, 0xfdc2, 0x005f, 0x0264, 0x00de, 0xfdf8, 0xfe47, 0x01b2,
+	0x01c3, 0xff89, 0xfdf9, 0x0025, 0x018b, 0x006d, 0xff07, 0xff3e,
+	0x00dc, 0x009f, 0x0005, 0xff34, 0x0004, 0x001a, 0xff79, 0xff12,
+	0xfebe, 0xff7a, 0xff95, 0xff8d, 0xffcc, 0xff90, 0xff72, 0xffca,
+	0x0007, 0x0020, 0xff4a, 0xffa5, 0x00a9, 0x0057, 0xff75, 0xff3f,
+	0x00ba, 0x00e9, 0xffb2, 0xff52, 0x001c, 0x00f2, 0x0019, 0xffce,
+	0xffb0, 0x005e, 0x007a, 0xfff7, 0x0009, 0xffd0, 0x007a, 0x0029,
+	0xffe8, 0xffca, 0x0000, 0x0077, 0x0018, 0xffc7, 0xffbd, 0x0041,
+	0x004c, 0x0023, 0xffb4, 0xff7e, 0x0036, 0x0083, 0x0038, 0xff5e,
+	0xff8d, 0x0095, 0x0087, 0xffd6, 0xff44, 0xfffc, 0x00a9, 0x003f,
+	0xff8f, 0xffb5, 0x0060, 0x0065, 0xffec, 0xffa7, 0x000b, 0x0059,
+	0x003c, 0x0002, 0xffc8, 0x001b, 0x0047, 0x0045, 0x001f, 0xffab,
+	0xfff4, 0x0059, 0x00a2, 0xfffe, 0xff6f, 0x0012, 0x0099, 0x0067,
+	0xff85, 0xffa1, 0x0084, 0x0077, 0xffda, 0xff9f, 0x003c, 0x0067,
+	0x0009, 0xffb9, 0xfff4, 0x0036, 0x001e, 0x0009, 0xfff9, 0xffed,
+	0xffe5, 0x0025, 0x0034, 0xfffd, 0xff8e, 0x0008, 0x0044, 0x0028,
+	0xff9c, 0xffb3, 0x0066, 0x0038, 0xffb6, 0xff5d, 0x003c, 0x002d,
+	0xff32, 0xfe8f, 0xfef4, 0xffbb, 0xff7f, 0xff29, 0xff51, 0xffe5,
+	0xffe1, 0xff83, 0xff90, 0xfff6, 0x001e, 0xffb0, 0xffb7, 0xffe1,
+	0x0035, 0x001e, 0xfff9, 0xfffc, 0x0005, 0x0046, 0x0019, 0x003b,
+	0x0003, 0xfffd, 0x0038, 0x004f, 0x0046, 0xffe9, 0x0024, 0x006e,
+	0x004f, 0xffe2, 0xffd1, 0x0070, 0x00ad, 0x0016, 0xffc5, 0x003b,
+	0x007e, 0x0014, 0xff90, 0xffd9, 0x0080, 0x0091, 0x0009, 0xffca,
+	0x0012, 0x0078, 0x0040, 0xffe2, 0x0023, 0x0068, 0x0073, 0xfff9,
+	0xffd4, 0x001e, 0x0038, 0x0029, 0xfff9, 0xffdc, 0xffee, 0x000c,
+	0x0034, 0x0019, 0xffce, 0xffcc, 0x001a, 0x001e, 0xffdb, 0xffc1,
+	0x002c, 0x0088, 0x001b, 0xff98, 0xffc4, 0x0051, 0x0050, 0xffcc,
+	0xffa3, 0x0010, 0x0019, 0xffea, 0xff86, 0x002c, 0x004c, 0xffe5,
+	0xff73, 0xffd0, 0x0039, 0xfff5, 0xfff3, 0xffea, 0x005c, 0xffda,
+	0xffb1, 0xffe0, 0x0039, 0x004e, 0xffab, 0xffcb, 0x0029, 0x0045,
+	0xfff2, 0xffa8, 0x0023, 0x0024, 0x000a, 0xff8d, 0xffca, 0x0071,
+	0x005e, 0xff9b, 0xfe9e, 0xff39, 0xff62, 0xffb2, 0xff1f, 0xff02,
+	0xffb7, 0x0017, 0xffe1, 0xff5a, 0xffac, 0x0053, 0x004c, 0xff92,
+	0xff68, 0x0018, 0x00b7, 0x005b, 0xffab, 0xffce, 0x0063, 0x0081,
+	0x0029, 0xffbd, 0x0019, 0x0079, 0x0034, 0xfffb, 0xffe3, 0x0042,
+	0x0087, 0x0057, 0xffe5, 0xffe4, 0x0043, 0x0067, 0x0008, 0xffd7,
+	0x0025, 0x0056, 0x0044, 0x000e, 0xffd3, 0xfffb, 0x002a, 0x0059,
+	0x0049, 0xffeb, 0xffe7, 0x0003, 0x002f, 0xfff7, 0xffe4, 0x0053,
+	0x0050, 0xffec, 0xff8f, 0xffe2, 0x0043, 0x004e, 0xfff1, 0xffa0,
+	0x0003, 0x003d, 0x0039, 0xffe1, 0xfff1, 0x005b, 0x0044, 0xffd9,
+	0xffb7, 0xfffe, 0x0048, 0x000b, 0xffe5, 0x0011, 0x003f, 0x001b,
+	0xffd1, 0xffe7, 0x000a, 0x0054, 0x001f, 0xffd7, 0xffd5, 0x0014,
+	0x0035, 0xffea, 0x0011, 0x003e, 0x004d, 0x0010, 0xffb2, 0xfff9,
+	0x0033, 0x005b, 0x0006, 0xffc6, 0xffe4, 0x001b, 0x0041, 0x000c,
+	0xfff2, 0x0013, 0x0024, 0xffe2, 0xffc7, 0x0011, 0x006e, 0xffe6,
+	0xff7f, 0xffcf, 0x0058, 0x0024, 0xff20, 0xfeeb, 0xff30, 0xff5d,
+	0xff34, 0xff3d, 0xffab, 0xffde, 0xffb3, 0xff53, 0xff8b, 0xfff5,
+	0xffdb, 0xffa3, 0xffad, 0x003f, 0x0042, 0xffc3, 0xff9d, 0xfff3,
+	0x005e, 0x0030, 0xffd9, 0xffc8, 0x0010, 0x003d, 0x000b, 0x0006,
+	0x001d, 0x0047, 0x0011, 0xfffe, 0x0025, 0x005f, 0x006d, 0xffe0,
+	0xffc8, 0x0011, 0x0066, 0x0034, 0x0002, 0x002d, 0x0055, 0x0045,
+	0xffdf, 0xfffb, 0x0035, 0x005d, 0x0010, 0xffcd, 0x000a, 0x0044,
+	0x0046, 0x0039, 0x0017, 0x0013, 0x002d, 0x0024, 0x000c, 0x0022,
+	0x0037, 0x0002, 0xffd9, 0xffef, 0x002d, 0x0030, 0x0028, 0x0005,
+	0xffea, 0xffef, 0x000a, 0x002a, 0x0026, 0x0010, 0xfff6, 0x0026,
+	0x003c, 0x0000, 0xffc5, 0x0002, 0x004b, 0x002e, 0xff93, 0xffac,
+	0x0024, 0x0032, 0xfffd, 0xffc9, 0x0017, 0x0049, 0xffe5, 0xffa5,
+	0xffca, 0x004a, 0x005c, 0xffcf, 0xff9e, 0xfff0, 0x0066, 0x0044,
+	0xffeb, 0xffb2, 0x0003, 0x0046, 0x0012, 0xffd1, 0xffd6, 0x0033,
+	0x0035, 0xfff0, 0xffbb, 0x0001, 0x0061, 0xffd8, 0xff07, 0xfec3,
+	0xff31, 0xff72, 0xff6a, 0xff69, 0xff84, 0xffd3, 0xff8c, 0xff88,
+	0xffa5, 0xfff1, 0x000c, 0xffbf, 0xffcb, 0xffe3, 0x0027, 0x0040,
+	0x0039, 0xffda, 0xffdf, 0x002a, 0x0059, 0x003a, 0x001a, 0x0047,
+	0x0058, 0x003c, 0xffeb, 0x0005, 0x0057, 0x0071, 0x0030, 0xffef,
+	0x000c, 0x005b, 0x004b, 0xfff8, 0xfff8, 0x0066, 0x005b, 0xfff2,
+	0xffb9, 0x0035, 0x0056, 0x0013, 0xfff5, 0xfffc, 0x0023, 0x0013,
+	0x0016, 0x0038, 0x0034, 0xffe9, 0xffe6, 0xfffc, 0x0011, 0xfff7,
+	0xffde, 0x0037, 0x0024, 0xffe5, 0xffa2, 0xfff1, 0x003a, 0x001c,
+	0xffc7, 0xffb3, 0x0018, 0x0012, 0xffe0, 0xfff5, 0x0025, 0x0014,
+	0xffb2, 0xffd7, 0x000b, 0x003a, 0x0001, 0x0011, 0x0039, 0x0023,
+	0xffe4, 0xffd3, 0x002d, 0x0034, 0x000a, 0xffcb, 0xffdd, 0x0025,
+	0x0043, 0xffec, 0xffc6, 0xffe5, 0x002a, 0xfffd, 0xffcd, 0x001a,
+	0x0041, 0x003f, 0xffdf, 0xffea, 0x0023, 0x0046, 0x0036, 0x0014,
+	0x001f, 0x000f, 0x000b, 0x0015, 0xfff4, 0xfff1, 0x0030, 0xffeb,
+	0xff19, 0xfeda, 0xff03, 0xff7a, 0xff63, 0xff53, 0xff66, 0xffa4,
+	0xffd2, 0xffc9, 0xffaf, 0xffba, 0xffd0, 0xffec, 0xffe2, 0xffcd,
+	0x0035, 0x0049, 0x0000, 0xffcb, 0xffde, 0x0047, 0x004f, 0x000f,
+	0xfff7, 0x001c, 0x002a, 0x0018, 0x001a, 0x0045, 0x004c, 0x0012,
+	0x000c, 0x0017, 0x0038, 0x004f, 0x0029, 0xffe5, 0xffe3, 0x0033,
+	0x002d, 0x0016, 0x0020, 0x0047, 0x0035, 0x001c, 0xfff4, 0x0000,
+	0x0049, 0x005a, 0x0039, 0xffed, 0x0006, 0x0036, 0x0048, 0x000e,
+	0xffe5, 0xfffd, 0xffff, 0x0010, 0xffef, 0xfff9, 0x0034, 0x002c,
+	0xfffd, 0xffd1, 0xfff8, 0x001c, 0x0042, 0x0011, 0x0000, 0x000e,
+	0x0018, 0x000b, 0x0001, 0x0015, 0x0031, 0x0008, 0xffe3, 0xfffe,
+	0x0013, 0x0024, 0x0013, 0x0018, 0xfff6, 0xffd7, 0xfffd, 0x0017,
+	0xfff6, 0xfff8, 0x0016, 0x0018, 0xfff1, 0xffc5, 0xfff6, 0x0063,
+	0x0046, 0xffd3, 0xff96, 0x0003, 0x004d, 0xffdd, 0xff9c, 0x0000,
+	0x0059, 0xfff3, 0xff91, 0xffac, 0x0058, 0x004e, 0xffc4, 0xff81,
+	0xffe0, 0x0043, 0xff6d, 0xfedd, 0xfee6, 0xff45, 0xff42, 0xff20,
+	0xff50, 0xff90, 0xffd2, 0xffcd, 0xffbc, 0xffb1, 0xffb2, 0xffe0,
+	0x000a, 0x0023, 0xffda, 0xffce, 0x0011, 0x0042, 0x0016, 0xfff6,
+	0x0040, 0x0057, 0x0017, 0xffed, 0x0034, 0x008d, 0x0072, 0xfff9,
+	0xfff2, 0x0033, 0x0071, 0x0027, 0x0012, 0x0043, 0x0059, 0x0012,
+	0xffed, 0x0039, 0x004a, 0x0037, 0x0006, 0x000f, 0x001d, 0x0010,
+	0x0012, 0x003d, 0x004b, 0x0005, 0xffce, 0x0023, 0x0049, 0x001f,
+	0x000b, 0x0031, 0x003b, 0xfffa, 0xffd5, 0xffea, 0x000b, 0xfff3,
+	0xffff, 0x000b, 0x0020, 0xfff6, 0xffd2, 0xffff, 0x0016, 0x002d,
+	0x0014, 0x0007, 0x000a, 0xfffa, 0x0001, 0x0021, 0x0036, 0x003c,
+	0xfffe, 0xffe6, 0xffe6, 0x0003, 0xfff7, 0x000d, 0x0034, 0x0011,
+	0x0003, 0xffd7, 0xffeb, 0xfffe, 0x002e, 0x002b, 0xffe8, 0xffd9,
+	0xffeb, 0x0019, 0x0007, 0xfff0, 0x0016, 0x003c, 0x001b, 0xffba,
+	0xffd6, 0x0027, 0x0034, 0x000f, 0xfff3, 0x0002, 0x0020, 0x000f,
+	0xffb9, 0xffa9, 0x001b, 0x004c, 0xff8b, 0xfed3, 0xfee6, 0xff4e,
+	0xffad, 0xff6c, 0xff3d, 0xff81, 0xffe4, 0xfff4, 0xffac, 0xffb3,
+	0x0000, 0x0036, 0xffe9, 0xff82, 0xffb6, 0x0035, 0x005e, 0x0006,
+	0xffb9, 0xfff2, 0x0061, 0x0036, 0xffe1, 0x0005, 0x007c, 0x0082,
+	0x0012, 0xffe1, 0x001b, 0x005c, 0x0049, 0x000d, 0xffdf, 0x0006,
+	0x0033, 0x0028, 0x0014, 0xfffc, 0x000f, 0x0001, 0xffe2, 0xffda,
+	0x0008, 0x0044, 0x004d, 0x0018, 0xffea, 0xffea, 0x0011, 0x0018,
+	0x0015, 0xfffc, 0xfff3, 0xffe9, 0x0009, 0x0035, 0x0037, 0x0010,
+	0xffe3, 0xfff3, 0x001a, 0x0012, 0x001b, 0x002a, 0x0022, 0xffe5,
+	0xffd3, 0x0014, 0x0042, 0x002d, 0xfff9, 0x0008, 0x0013, 0x001a,
+	0x0014, 0x0001, 0x001d, 0x0011, 0xfffb, 0xffea, 0x000f, 0x0022,
+	0x0027, 0x0008, 0xffe1, 0xfffc, 0x0017, 0x001c, 0x000c, 0x001c,
+	0x000c, 0xffed, 0xffe7, 0x001e, 0x0014, 0x0023, 0x001c, 0x0004,
+	0xffe9, 0xffd1, 0xfff0, 0x000a, 0x0013, 0xffe0, 0xffc3, 0xffe1,
+	0xffff, 0xfff2, 0xffe3, 0x000b, 0x0008, 0xffed, 0xff86, 0xff2e,
+	0xff46, 0xff2a, 0xff38, 0xff49, 0xff8d, 0xffbe, 0xffb6, 0xffc4,
+	0xffeb, 0xffe5, 0xffbe, 0xffba, 0xffd4, 0xfff3, 0x0005, 0x000b,
+	0x0005, 0xffef, 0x0008, 0x001d, 0x0036, 0x003b, 0x0010, 0xfffe,
+	0x002d, 0x0041, 0x0046, 0x0045, 0x0050, 0x0043, 0x0026, 0xfffc,
+	0x0017, 0x0031, 0x004a, 0x003e, 0x0001, 0xffee, 0x0004, 0x0026,
+	0x001b, 0x001f, 0x0031, 0x0043, 0x0013, 0xffeb, 0x000a, 0x002b,
+	0x003e, 0x0011, 0xffe4, 0x0003, 0x0041, 0x0028, 0x001a, 0x0018,
+	0x001e, 0x000a, 0xfffa, 0x000c, 0x0021, 0x0044, 0x0026, 0xfff4,
+	0xffde, 0xfff1, 0x001d, 0x0024, 0x0013, 0x0014, 0x001b, 0x0010,
+	0xfff4, 0xffeb, 0xfffb, 0x0010, 0x0010, 0xffd8, 0xffc1, 0xffe7,
+	0x0011, 0xffef, 0xffe8, 0x0003, 0x0025, 0x000a, 0xffc1, 0xffcc,
+	0x0008, 0x003c, 0x000d, 0xffc6, 0xffe0, 0x000e, 0x0009, 0xffd8,
+	0xffde, 0xffe6, 0xffee, 0xffec, 0xffd9, 0x0004, 0x001a, 0x0003,
+	0xffc2, 0xffce, 0x0004, 0x001f, 0x0027, 0x0017, 0x0017, 0x0031,
+	0xffa8, 0xff21, 0xff08, 0xff3a, 0xff68, 0xff4f, 0xff59, 0xff89,
+	0xffc1, 0xffc9, 0xffba, 0xffa2, 0xffb3, 0xffe0, 0xfff3, 0x0007,
+	0x0018, 0x0043, 0x0029, 0x000d, 0xfff5, 0x0010, 0x003b, 0x003a,
+	0x003d, 0x0046, 0x002f, 0x0015, 0x0022, 0x0036, 0x0017, 0x0031,
+	0x004f, 0x002c, 0xfffc, 0xffed, 0x0006, 0x001a, 0x0026, 0x000d,
+	0x0001, 0x0017, 0x0008, 0x000f, 0x0015, 0x0037, 0x0048, 0x0032,
+	0x0000, 0xfff5, 0x001c, 0x0026, 0x002c, 0x0043, 0x002b, 0x0001,
+	0xfff6, 0xfff3, 0x0007, 0x001a, 0x0029, 0x0020, 0xfff6, 0xffe5,
+	0xffe6, 0x000f, 0x0025, 0x0035, 0x002a, 0x000d, 0xfffa, 0x0003,
+	0x001c, 0x0010, 0x0009, 0x0009, 0xfff6, 0xffdc, 0xffe4, 0x0004,
+	0x002e, 0x0016, 0xffe2, 0xffdd, 0xffee, 0x000d, 0x001c, 0x001d,
+	0x0019, 0x002e, 0x0014, 0xffff, 0x000b, 0x0006, 0x0024, 0x0017,
+	0xffe5, 0xffd3, 0x000c, 0x0025, 0x002b, 0x0008, 0xffdb, 0xffef,
+	0x0003, 0x0008, 0xfff2, 0xfff4, 0xfff9, 0xffee, 0xfff2, 0xffe8,
+	0x000b, 0x0035, 0xffc4, 0xff28, 0xff03, 0xff10, 0xff58, 0xff7b,
+	0xff97, 0xffb1, 0xffa5, 0xff91, 0xff86, 0xffae, 0xffd1, 0xffe9,
+	0xffe4, 0xffce, 0xffb4, 0xffd8, 0xffe6, 0xffec, 0x0009, 0x0023,
+	0xfffc, 0xffe5, 0xfff0, 0x0038, 0x003c, 0x003d, 0x0018, 0xfffc,
+	0x001f, 0x0045, 0x0037, 0x0040, 0x0052, 0x0045, 0x001b, 0xffe6,
+	0x0005, 0x003e, 0x0038, 0x0006, 0xfff3, 0x0009, 0x001c, 0x001b,
+	0x0013, 0x0017, 0x0015, 0x0000, 0x000b, 0x0036, 0x003a, 0x0033,
+	0x002c, 0x000a, 0xfffb, 0x001c, 0x0020, 0x0039, 0x0040, 0x0027,
+	0x0005, 0xfffc, 0x0013, 0x0027, 0x001d, 0xfffe, 0xfff6, 0xfff3,
+	0xffec, 0xffed, 0x0022, 0x0031, 0x0006, 0xffd1, 0xffeb, 0x002c,
+	0x0028, 0x0014, 0x001a, 0x000c, 0xfff9, 0xffdb, 0xffed, 0xffea,
+	0x000f, 0x0014, 0xfff2, 0xffea, 0xfffe, 0x0027, 0x002b, 0xfffe,
+	0xffd7, 0xffe6, 0x0016, 0x001a, 0x0027, 0x0013, 0xfff8, 0xffec,
+	0xfffb, 0x0011, 0x001b, 0x0021, 0xfff4, 0xffe9, 0x0002, 0x001d,
+	0x0013, 0xfff7, 0xffd3, 0xffe5, 0xffa4, 0xff44, 0xff0e, 0xff1b,
+	0xff56, 0xff62, 0xff60, 0xff6e, 0xffa7, 0xffb0, 0xffca, 0xffc6,
+	0xffb9, 0xffd4, 0xffec, 0xfff4, 0x0016, 0x002a, 0x000d, 0xffe8,
+	0xffee, 0x0025, 0x0039, 0x0039, 0x0036, 0x0024, 0x000e, 0x0017,
+	0x001a, 0x002f, 0x004b, 0x0042, 0x0020, 0x0013, 0x0021, 0x0024,
+	0x0028, 0x002e, 0x0046, 0x003c, 0x0003, 0xfffd, 0x001c, 0x001f,
+	0x0034, 0x0023, 0x0001, 0xfff0, 0x0012, 0x0027, 0x002f, 0x0047,
+	0x003d, 0x0022, 0x0002, 0xffe9, 0xfff1, 0x000e, 0x0029, 0x0008,
+	0xffec, 0xffe3, 0xfff9, 0x0003, 0x0002, 0xfff5, 0xffea, 0xffe2,
+	0xffe8, 0x0005, 0x001d, 0x0014, 0xfff6, 0xffc6, 0xffdb, 0x000c,
+	0x0019, 0x0012, 0x0016, 0x0018, 0xfff6, 0xffdb, 0xfffb, 0x000e,
+	0xfffe, 0x0002, 0xfffa, 0x0000, 0x000f, 0x0014, 0x001b, 0x0027,
+	0xfffb, 0xffe1, 0xffed, 0x001e, 0x003d, 0x0023, 0x0017, 0x001c,
+	0x0006, 0xfff3, 0xffea, 0xffe9, 0x0024, 0x0035, 0xfff0, 0xffe2,
+	0xffff, 0x0023, 0x001f, 0x0001, 0xffda, 0xffee, 0xffd9, 0xff62,
+	0xff31, 0xff17, 0xff2b, 0xff42, 0xff71, 0xff9b, 0xffb1, 0xffbd,
+	0xffd0, 0xffc1, 0xffb4, 0xffa9, 0xffc7, 0xffe0, 0xfffe, 0xffe6,
+	0xffd5, 0xfff9, 0x0013, 0x0029, 0x0025, 0x0029, 0x0027, 0x002a,
+	0xffe1, 0xffc8, 0x0001, 0xfff2, 0xffdf, 0xffe8, 0x0006, 0x002b,
+	0x0039, 0x0027, 0x001c, 0x0016, 0x0038, 0x0048, 0x001f, 0xfffd,
+	0x0002, 0x001e, 0x002b, 0x0036, 0x0023, 0x0001, 0x0002, 0x0014,
+	0x0027, 0x0030, 0x0026, 0x0007, 0xffef, 0x000d, 0x001c, 0x002f,
+	0x002e, 0x0011, 0xfff2, 0xfff1, 0x0010, 0x000a, 0x001b, 0x0024,
+	0x0012, 0xfff6, 0xfff2, 0x0001, 0x0012, 0x0018, 0x0014, 0x0009,
+	0xffeb, 0xfffe, 0x0019, 0x0037, 0x002c, 0x000c, 0xffe0, 0xfffb,
+	0x001c, 0x001d, 0x0032, 0x0031, 0x001c, 0xfff4, 0xfff1, 0xffe2,
+	0xfff9, 0x000b, 0x0000, 0xffdf, 0xffd0, 0xffe5, 0x0008, 0x001b,
+	0x0021, 0xfff3, 0xffe0, 0xffe7, 0x0009, 0x002a, 0x0017, 0x0016,
+	0x0010, 0xfff8, 0xffed, 0xfff4, 0xfffe, 0xfff5, 0x0009, 0xffdb,
+	0xffd4, 0xffe5, 0xfffb, 0xffda, 0xff57, 0xfef9, 0xfeca, 0xff03,
+	0xff47, 0xff59, 0xff82, 0xffaf, 0xffa0, 0xff8e, 0xff97, 0xffba,
+	0xffd9, 0xfff1, 0x0005, 0xffee, 0xfff6, 0x000b, 0x0020, 0x0033,
+	0x0027, 0x001c, 0x0016, 0x0023, 0x003d, 0x0040, 0x0037, 0x003f,
+	0x001b, 0x000a, 0x0023, 0x0034, 0x0038, 0x0056, 0x003e, 0x001e,
+	0x0019, 0x002a, 0x0034, 0x003c, 0x002a, 0x0009, 0xfff5, 0x0020,
+	0x0028, 0x0038, 0x002d, 0x000d, 0xfff2, 0x0001, 0x0029, 0x001f,
+	0x0031, 0x0016, 0xfffc, 0x0001, 0x001e, 0x0017, 0x0020, 0x0040,
+	0x0021, 0xffee, 0xffde, 0x0006, 0x001c, 0x0025, 0x0015, 0xffe3,
+	0xffe7, 0xfff5, 0x0001, 0x002a, 0x0021, 0xfffe, 0xfff0, 0x0002,
+	0x0027, 0x0027, 0x0013, 0xfff8, 0xffee, 0xffe8, 0x000d, 0x0022,
+	0x0028, 0x0031, 0x0014, 0x0000, 0xffe0, 0xfffc, 0x001e, 0x0025,
+	0x0011, 0xfff3, 0xffde, 0xfff9, 0x000e, 0x000a, 0x0008, 0xffea,
+	0xffce, 0xffe6, 0xfff9, 0x0009, 0x001f, 0x0019, 0x0008, 0xffee,
+	0xffeb, 0xfff9, 0x0008, 0x0012, 0x0012, 0xffc4, 0xff34, 0xff0a,
+	0xff0f, 0xff2b, 0xff70, 0xff9c, 0xffae, 0xff9b, 0xff97, 0xffbe,
+	0xffca, 0xffd3, 0xffd0, 0xffd0, 0xffe0, 0xfff9, 0x0003, 0x0016,
+	0x0014, 0x000a, 0xfff1, 0xfffe, 0x001a, 0x002d, 0x0047, 0x0045,
+	0x003d, 0x0029, 0x001c, 0x0022, 0x0036, 0x0039, 0x0034, 0x0017,
+	0x0001, 0x0004, 0x0020, 0x0021, 0x0023, 0x0020, 0x0011, 0xffee,
+	0xffdb, 0x0007, 0x002b, 0x0028, 0x0001, 0xfff6, 0xffdc, 0xffec,
+	0x0009, 0x0025, 0x001c, 0x0001, 0x0001, 0x000a, 0x0010, 0x0026,
+	0x0026, 0xfffd, 0xfff7, 0xffee, 0x0007, 0x002d, 0x0030, 0x002f,
+	0x0016, 0x0002, 0x0000, 0x0000, 0x0024, 0x002d, 0x0011, 0xfff9,
+	0xffea, 0xfff1, 0x002c, 0x0026, 0x0016, 0x0010, 0xffe0, 0xffef,
+	0x001d, 0x001b, 0x001c, 0x002c, 0xfff7, 0xffeb, 0xffee, 0xfffb,
+	0x0013, 0x003f, 0x0013, 0xfff6, 0x0008, 0x0000, 0x000d, 0x0028,
+	0x001a, 0xfff6, 0xffed, 0xfffd, 0xfffe, 0x0017, 0x0008, 0xffcf,
+	0xffc2, 0xffd9, 0xffe7, 0xffee, 0x0007, 0x0006, 0xfff9, 0xffd3,
+	0xff4f, 0xff0c, 0xff1c, 0xff44, 0xff5c, 0xff6b, 0xff95, 0xffb1,
+	0xffcc, 0xffe0, 0xffca, 0xffbb, 0xffcf, 0xffd6, 0xffe4, 0xfff9,
+	0x0015, 0x0025, 0x002c, 0xfffe, 0xfff0, 0xfffd, 0x0026, 0x0045,
+	0x001d, 0x0003, 0xfffe, 0x000d, 0x001f, 0x0023, 0x0022, 0x0024,
+	0x0028, 0x0030, 0x0036, 0x0056, 0x0037, 0x0020, 0x001b, 0x0020,
+	0x0029, 0x0038, 0x0053, 0x002f, 0x0011, 0xfff3, 0xfff8, 0x000b,
+	0x001a, 0x0026, 0x002d, 0x0030, 0x0006, 0x0009, 0x0020, 0x0016,
+	0x0026, 0x0031, 0xfffa, 0xffed, 0x0011, 0x0027, 0x0017, 0x0029,
+	0xfff8, 0xffd6, 0xffe5, 0xfffe, 0x000b, 0x001e, 0x002d, 0x000a,
+	0xffea, 0xffec, 0x000d, 0x0015, 0x0026, 0x0028, 0x0018, 0xfffe,
+	0xffff, 0xfff8, 0x000b, 0x0012, 0xffe9, 0xffd0, 0xffda, 0xfffa,
+	0x0009, 0x000a, 0xffee, 0xffd8, 0xffd1, 0xffde, 0xfff5, 0x0008,
+	0x000f, 0xffff, 0xfff3, 0xffce, 0xffda, 0xfff5, 0x0002, 0x0003,
+	0x001d, 0x0010, 0xfff4, 0xffe4, 0xfff0, 0x0017, 0x001e, 0x0002,
+	0xffeb, 0xffdd, 0xff75, 0xff37, 0xff31, 0xff15, 0xff3b, 0xff58,
+	0xff73, 0xff9c, 0xffb6, 0xffc2, 0xffe8, 0xffd2, 0xffbc, 0xffdb,
+	0xfff3, 0xfff9, 0x0018, 0x0026, 0x0006, 0x0001, 0x0018, 0x002f,
+	0x003a, 0x004c, 0x0023, 0x000a, 0x0022, 0x002a, 0x003d, 0x0049,
+	0x002a, 0x0015, 0x001a, 0x002f, 0x0036, 0x003e, 0x0054, 0x0032,
+	0x000a, 0xffff, 0xffe5, 0xffeb, 0x001e, 0x0021, 0x0014, 0x003b,
+	0x002c, 0xffff, 0xfff5, 0xfff1, 0x0002, 0x002c, 0x004e, 0x0040,
+	0x0021, 0x0011, 0xfff6, 0x0011, 0x0038, 0x0037, 0x0027, 0x000f,
+	0xfffe, 0x0012, 0x0026, 0x0024, 0x0019, 0x0000, 0xfff1, 0xfff9,
+	0x0018, 0x0014, 0x0015, 0xfff9, 0xffe0, 0xffde, 0xfffb, 0x001d,
+	0x0023, 0x0016, 0xfff2, 0xffde, 0xffef, 0x0000, 0x0012, 0x0024,
+	0x003e, 0x0025, 0x0000, 0xffef, 0x0002, 0x0014, 0x0025, 0xfffd,
+	0xffcc, 0xffd4, 0xfff5, 0x000f, 0x001d, 0x000c, 0xfff8, 0xffc5,
+	0xffdc, 0x000f, 0x001b, 0x0035, 0x0042, 0x001c, 0xfffd, 0xfff4,
+	0x0001, 0x0014, 0x001b, 0xfff6, 0xff73, 0xff0f, 0xff02, 0xff1c,
+	0xff5e, 0xff63, 0xff46, 0xff64, 0xff89, 0xff9a, 0xffd5, 0xffe4,
+	0xffd2, 0xffcd, 0xffb8, 0xffb5, 0xfff1, 0x0014, 0x000d, 0x0020,
+	0x0016, 0xfffa, 0xffe3, 0x001b, 0x0019, 0x0018, 0x0018, 0x0013,
+	0x0012, 0x0029, 0x002d, 0x0028, 0x0030, 0x0011, 0xfffe, 0x001a,
+	0x0023, 0x002a, 0x003d, 0x001d, 0x000b, 0x0017, 0x002e, 0x002b,
+	0x0021, 0x0033, 0x0033, 0x0010, 0xfffa, 0x000f, 0x001d, 0x002d,
+	0x001d, 0x000c, 0xfff8, 0xfffa, 0x003f, 0x0031, 0x0013, 0x0024,
+	0x000c, 0xffff, 0x0031, 0x002f, 0x0025, 0x0019, 0xfff8, 0xffe3,
+	0x0004, 0x0018, 0x000f, 0x0020, 0x0014, 0xfff1, 0xffff, 0x000b,
+	0x0011, 0x0036, 0x0031, 0xfff1, 0xffe8, 0xffff, 0x0000, 0x001b,
+	0x0023, 0xffdc, 0xffd9, 0x0001, 0x001a, 0x0015, 0x0022, 0xfff1,
+	0xffc8, 0xffd9, 0x0006, 0x0001, 0x0018, 0x0032, 0x0009, 0xfff5,
+	0xffe3, 0xfff1, 0x000e, 0x0038, 0x000f, 0xfffb, 0xfff2, 0xfffc,
+	0x0020, 0x002f, 0x000d, 0xffe4, 0xffe4, 0xffe2, 0xff80, 0xff3c,
+	0xff13, 0xff14, 0xff48, 0xff50, 0xff40, 0xff82, 0xffba, 0xffae,
+	0xffb5, 0xffb8, 0xffad, 0xffca, 0x0004, 0xfff9, 0x0010, 0x0017,
+	0x000a, 0x0021, 0x0036, 0x003d, 0x0043, 0x0019, 0xfffd, 0x0013,
+	0x0019, 0x0028, 0x0044, 0x0047, 0x003d, 0x0021, 0x000e, 0x0024,
+	0x0041, 0x003c, 0x002d, 0x0015, 0x0005, 0x001c, 0x003d, 0x001f,
+	0x001d, 0x0005, 0xffe7, 0xfff2, 0x0023, 0x0015, 0x0026, 0x0050,
+	0x001f, 0xfffe, 0x0011, 0x0020, 0x0014, 0x0035, 0x0034, 0x000a,
+	0xfff1, 0x0003, 0x0000, 0xfffc, 0x0025, 0x0009, 0xffed, 0xfffa,
+	0xffe3, 0xffbe, 0xffea, 0x000a, 0xffe9, 0xffce, 0xffdd, 0xffe8,
+	0xfff4, 0x002d, 0x001b, 0xfff9, 0xfff6, 0xfff2, 0xfff7, 0x0003,
+	0x002d, 0x003c, 0x0045, 0x001e, 0xffee, 0xffe7, 0x0002, 0xfffa,
+	0x0015, 0x001c, 0x0003, 0x000a, 0xffe4, 0xffae, 0xffc9, 0xffeb,
+	0xfff2, 0xfffe, 0x002d, 0x0018, 0xffff, 0x001b, 0x0003, 0x0035,
+	0x004e, 0x001e, 0xfff3, 0x0004, 0x0003, 0x000b, 0x001e, 0x0018,
+	0xffa5, 0xff0c, 0xfee5, 0xfef3, 0xff20, 0xff71, 0xffaa, 0xff95,
+	0xff99, 0xff9c, 0xffaa, 0xffd3, 0xfffc, 0xffea, 0xffcc, 0xffdc,
+	0xffe8, 0x000c, 0x0032, 0x0020, 0xfffc, 0x0000, 0x001c, 0x0029,
+	0x0048, 0x004e, 0x002a, 0x0017, 0x0017, 0x001d, 0x0026, 0x0048,
+	0x0052, 0x002a, 0x0006, 0x0002, 0x0000, 0x0028, 0x003f, 0x0016,
+	0x001d, 0x0012, 0x0025, 0x0024, 0x003b, 0x0025, 0x000d, 0x0019,
+	0x000d, 0x0012, 0x003f, 0x0031, 0xffea, 0x0000, 0x001a, 0x001c,
+	0x0041, 0x0038, 0x0016, 0x0001, 0xfff0, 0x0012, 0x0023, 0x001e,
+	0x0038, 0x0020, 0xffee, 0xffe9, 0xfff8, 0xfff2, 0x0010, 0x0015,
+	0xfff3, 0xfff1, 0x001c, 0x0021, 0x0018, 0x0016, 0x0007, 0xffeb,
+	0xffeb, 0x0013, 0x0026, 0x002b, 0x004c, 0x0028, 0xfff3, 0xfff1,
+	0xfff5, 0xfff4, 0x0011, 0x0011, 0xffea, 0xffdd, 0xffe9, 0x0000,
+	0xfff6, 0x0022, 0x002b, 0x001b, 0x0014, 0xffed, 0xffec, 0x0006,
+	0x000d, 0x000d, 0xffd3, 0xffce, 0xffd1, 0xffea, 0x0017, 0xfff7,
+	0xffd2, 0xffc8, 0xff87, 0xff29, 0xff05, 0xff17, 0xff4a, 0xff71,
+	0xff60, 0xff76, 0xff91, 0xffbb, 0xffb5, 0xffc0, 0xffbf, 0xffb6,
+	0xffd1, 0xfff7, 0x0009, 0x000a, 0xffef, 0xffdc, 0x0005, 0x0026,
+	0x0038, 0x003b, 0x0020, 0x001c, 0x001a, 0x0037, 0x0040, 0x004a,
+	0x004c, 0x0035, 0x0015, 0x0009, 0x0023, 0x0039, 0x0051, 0x0035,
+	0xfffc, 0x001b, 0x0038, 0x003a, 0x0041, 0x003d, 0x0028, 0x0016,
+	0x0009, 0x0015, 0x001f, 0x0027, 0x002b, 0x000d, 0xfffd, 0x000b,
+	0x0017, 0x0022, 0x004f, 0x0017, 0xffe4, 0x000a, 0xfffb, 0x0015,
+	0x0049, 0x0016, 0xffe5, 0xfffa, 0xfffe, 0x000e, 0x0033, 0x0014,
+	0xffee, 0xffff, 0xffea, 0x0001, 0x0024, 0x0010, 0x002a, 0x002c,
+	0x000c, 0xfff6, 0xfff3, 0x0019, 0x0028, 0x0024, 0x0023, 0x000c,
+	0xffeb, 0xffd5, 0xffea, 0xffef, 0x001a, 0x002f, 0xfff9, 0xffe7,
+	0xffcb, 0xffde, 0x000b, 0x000a, 0x0012, 0x0017, 0xfffe, 0xffe8,
+	0x0002, 0x001b, 0x001f, 0x0041, 0x000c, 0xfff2, 0xffee, 0xffe1,
+	0x000e, 0x000e, 0x001a, 0x0032, 0xff7e, 0xff0a, 0xff0d, 0xff08,
+	0xff42, 0xff85, 0xff9a, 0xff84, 0xff7e, 0xffa4, 0xffb9, 0xffb5,
+	0xffd8, 0xfffa, 0xffdb, 0xffcd, 0xffe1, 0xffea, 0xfffb, 0x0022,
+	0x0014, 0x001b, 0xffff, 0x0008, 0x002b, 0x0048, 0x004a, 0x0047,
+	0x0053, 0x0020, 0x0007, 0x003a, 0x002a, 0x004a, 0x004c, 0x0012,
+	0xfffb, 0xffff, 0xfffe, 0x001e, 0x003d, 0x003a, 0x0014, 0xfff3,
+	0xffe4, 0x0002, 0x0028, 0x0026, 0x000d, 0x000e, 0xffff, 0xffee,
+	0x000f, 0x0024, 0x0003, 0x0001, 0xffe6, 0xffdb, 0xffed, 0x000c,
+	0x0029, 0x0038, 0x0006, 0x0003, 0xfffe, 0xffed, 0x0009, 0x0011,
+	0xfffd, 0x0001, 0xfffa, 0xffff, 0x0022, 0x0014, 0x001a, 0x001e,
+	0xffe8, 0x0019, 0x0045, 0x0052, 0x002f, 0xfff6, 0xffde, 0xfff4,
+	0x0036, 0x0014, 0xfff0, 0x000a, 0x0001, 0xffff, 0x0019, 0x0024,
+	0x0019, 0x000f, 0xffef, 0xffe3, 0xfffe, 0x0024, 0x0031, 0x0020,
+	0x0033, 0x000a, 0xffd3, 0x0004, 0x0020, 0x0008, 0xfff6, 0xfff1,
+	0xffe4, 0xfff0, 0x001c, 0x0001, 0xffde, 0xffe0, 0xffab, 0xff35,
+	0xff11, 0xff07, 0xff31, 0xff85, 0xff8a, 0xff76, 0xff78, 0xffa6,
+	0xffcf, 0xffd2, 0xfff2, 0xffdf, 0xffbe, 0xffd8, 0xfffd, 0xfff0,
+	0x0005, 0x001b, 0x0007, 0x001c, 0x002b, 0x0032, 0x003e, 0x0017,
+	0xfffc, 0x0014, 0x0026, 0x002e, 0x0053, 0x0048, 0x003a, 0x0024,
+	0x000a, 0x0017, 0x0033, 0x0042, 0x003e, 0x000f, 0x0001, 0x0018,
+	0x0049, 0x0037, 0x0017, 0x001d, 0x0006, 0xfff8, 0x001b, 0x0025,
+	0x0031, 0x0047, 0x003b, 0xfff8, 0xffe9, 0x0015, 0x0033, 0x002d,
+	0x002b, 0xfffd, 0xffe7, 0x000b, 0x0006, 0x0025, 0x002a, 0x0000,
+	0xffc9, 0xffd5, 0x0007, 0x002a, 0x003e, 0x0035, 0x000f, 0xfff7,
+	0xffe6, 0xfff0, 0x001c, 0x0023, 0x0033, 0x0010, 0xffd4, 0xffe6,
+	0xfff7, 0xffff, 0x000c, 0x000d, 0x0015, 0xfff6, 0xffcf, 0xffed,
+	0x0009, 0x000a, 0xfff6, 0xffb6, 0xffc4, 0xfff9, 0x0009, 0x000b,
+	0xfffd, 0xffe4, 0xffe0, 0xffea, 0xffec, 0x0004, 0x000c, 0xfff3,
+	0xffe7, 0xffdd, 0xfff8, 0x0001, 0xfffc, 0x000e, 0x0008, 0x0008,
+	0xffdb, 0xff5d, 0xff27, 0xff27, 0xff2a, 0xff48, 0xff5e, 0xff7f,
+	0xff90, 0xffbc, 0xffd4, 0xffcd, 0xffab, 0xffc4, 0xffe3, 0xfff9,
+	0xfffe, 0x0029, 0x004a, 0x0020, 0xfffe, 0x0029, 0x003f, 0x0047,
+	0x003f, 0x0027, 0x0020, 0x0028, 0x0029, 0x0044, 0x0043, 0x0023,
+	0x0017, 0x0017, 0x002d, 0x0030, 0x001d, 0x0017, 0x000c, 0x0017,
+	0x0020, 0x0020, 0x001f, 0x0022, 0x0002, 0xfff5, 0x0015, 0x0021,
+	0x0032, 0x0051, 0x0021, 0x0021, 0x0011, 0x0008, 0x0016, 0x0032,
+	0x0028, 0xfffb, 0x0001, 0x000c, 0x0020, 0x0027, 0x0023, 0x000d,
+	0xffed, 0xffd7, 0x000d, 0x0023, 0x0035, 0x002b, 0x000d, 0xfff8,
+	0xffff, 0xffff, 0x0006, 0x0030, 0x002d, 0x0009, 0xffdf, 0xffeb,
+	0x000b, 0x0021, 0x0009, 0xffee, 0xffe2, 0xffeb, 0x001d, 0x001b,
+	0x001e, 0x001e, 0x0001, 0xffff, 0xfffd, 0xfff6, 0x0011, 0x0012,
+	0xffff, 0xffe5, 0xffda, 0xffe3, 0x0026, 0x0017, 0xfff7, 0x0002,
+	0xffed, 0xffee, 0xffff, 0x000e, 0x0028, 0x003e, 0xfff2, 0xffe8,
+	0xffe9, 0x0010, 0x0016, 0xff79, 0xff26, 0xff04, 0xfef1, 0xff42,
+	0xff7f, 0xff8f, 0xffa6, 0xffa4, 0xff87, 0xffb6, 0xffbb, 0xffc9,
+	0xffed, 0xfff5, 0xffcd, 0xffce, 0xffcd, 0xfff7, 0x000f, 0x0003,
+	0x003b, 0x003f, 0xfff0, 0xffdb, 0x0012, 0x003a, 0x0045, 0x0036,
+	0xfffb, 0x0008, 0x0013, 0x0006, 0x003e, 0x004a, 0x0025, 0x000f,
+	0xffe5, 0x0009, 0x002e, 0x0023, 0x004d, 0x0049, 0x0000, 0xffe9,
+	0xfff6, 0x0014, 0x0059, 0x002d, 0xfff1, 0x0007, 0x0012, 0x001a,
+	0x0033, 0x0035, 0x0028, 0x001e, 0x0017, 0x0020, 0x0047, 0x003a,
+	0x0002, 0xfffc, 0x0005, 0x002a, 0x001d, 0x0012, 0x0040, 0x002f,
+	0xfff2, 0xffdc, 0xffea, 0x000a, 0x0028, 0x000f, 0x0009, 0xfff5,
+	0xfff8, 0x0027, 0x001c, 0x000c, 0xffe2, 0xffd4, 0x0008, 0x001a,
+	0x000e, 0x0011, 0xffea, 0xffc4, 0xffe6, 0x0011, 0x003d, 0x0034,
+	0xfff6, 0xffba, 0xfff0, 0x002b, 0x0023, 0x0014, 0x0009, 0x0016,
+	0x0023, 0xffe3, 0xffd4, 0x001f, 0x001f, 0x001b, 0xffe2, 0xffdc,
+	0xffed, 0x0003, 0xfffc, 0x0021, 0x001a, 0xff59, 0xfef0, 0xfef3,
+	0xfefd, 0xff4f, 0xff8e, 0xff95, 0xff82, 0xff86, 0xff9f, 0xffd0,
+	0xffda, 0xffc5, 0xffc5, 0xffe4, 0x000b, 0xfff9, 0x0002, 0x002f,
+	0x001d, 0xffff, 0x0003, 0x000b, 0x0024, 0x002f, 0x0048, 0x004c,
+	0x004c, 0x000a, 0xffe9, 0x0036, 0x0047, 0x004f, 0x001a, 0xfffe,
+	0x0031, 0x003f, 0x0011, 0x0026, 0x0035, 0x000b, 0x001f, 0xfff8,
+	0x002e, 0x004b, 0xfff5, 0xfff5, 0x0005, 0x0018, 0x004e, 0x001f,
+	0x0001, 0x0053, 0x001f, 0xfff4, 0x0041, 0x0018, 0x0010, 0x0027,
+	0xffdd, 0xffe7, 0x000b, 0x0003, 0x001d, 0x0024, 0xffe2, 0xffc0,
+	0xffe0, 0xfff4, 0x0013, 0xffff, 0x0011, 0x0030, 0xfffb, 0xffd4,
+	0xfff7, 0xfffd, 0x0015, 0x0006, 0xff87, 0xfff2, 0x0003, 0xffbb,
+	0x0013, 0x001b, 0xffe9, 0x0006, 0xffb8, 0xffbc, 0x006a, 0x004b,
+	0x000d, 0x0050, 0xffee, 0xffdf, 0x0036, 0x0015, 0x000e, 0x003a,
+	0xffe9, 0xffad, 0x001c, 0x0034, 0x0019, 0x004d, 0x0009, 0xffb5,
+	0x000b, 0x005b, 0x0035, 0x004e, 0xffdf, 0xffab, 0x003d, 0xff95,
+	0xfeda, 0xfedf, 0xff10, 0xff57, 0xff5d, 0xff2f, 0xff62, 0xffd5,
+	0xffcc, 0xffb3, 0xffac, 0xffbe, 0xffdc, 0xffe2, 0x002f, 0x003f,
+	0xfffd, 0xffaa, 0xffde, 0x0034, 0x003f, 0x001f, 0x001e, 0x001a,
+	0xffff, 0x0030, 0x0036, 0x004e, 0x0086, 0x0051, 0x002a, 0x0046,
+	0x001b, 0x0013, 0x0025, 0x0017, 0x004c, 0x007f, 0x0006, 0xffbd,
+	0xffd4, 0xfff0, 0x002b, 0x0033, 0x0038, 0x0023, 0xffe3, 0xffbf,
+	0x0000, 0x004b, 0x0052, 0x0035, 0x0011, 0x0049, 0x0024, 0xffea,
+	0x001e, 0x001e, 0x0040, 0x004b, 0xffd8, 0xffc5, 0xfff5, 0x002d,
+	0x0061, 0x0030, 0xffe9, 0xffc9, 0xfffb, 0x0034, 0x0039, 0x0043,
+	0x0064, 0x0002, 0xff9a, 0xffc7, 0x001c, 0x0051, 0x0025, 0xffca,
+	0xff8d, 0xffbf, 0x0002, 0xffe7, 0x0021, 0x0042, 0xfff4, 0xffdb,
+	0x000a, 0x0000, 0xfff3, 0x005a, 0x0056, 0x0038, 0x001b, 0xff88,
+	0xffab, 0x0048, 0x0033, 0x0014, 0x0075, 0xffe9, 0xff98, 0x0015,
+	0xffdb, 0x0046, 0x00cb, 0x001d, 0xffb8, 0xffff, 0xffd8, 0xffbd,
+	0x005b, 0xff9e, 0xfed0, 0xfec9, 0xfe5c, 0xfe63, 0xff5f, 0xff4c,
+	0xff04, 0xffcc, 0xff90, 0xff3d, 0xffbf, 0xffb5, 0xffcf, 0x006a,
+	0x0050, 0xfffc, 0x002c, 0xffa3, 0xffc3, 0x007e, 0x005b, 0x0059,
+	0x0011, 0xffe7, 0x0027, 0x0030, 0x003d, 0x006d, 0x00ba, 0x00ba,
+	0x0044, 0xffc2, 0x0034, 0x00b2, 0x0090, 0x0071, 0x0005, 0xffc0,
+	0xffbc, 0xffdb, 0x0008, 0x0028, 0x002a, 0xffc8, 0xff9e, 0xffb2,
+	0xffec, 0x002a, 0x006c, 0x0073, 0xfffa, 0x0003, 0x0039, 0x0074,
+	0x0072, 0xffe1, 0x0007, 0x0080, 0x008a, 0xffd1, 0xff5e, 0xffc5,
+	0x002d, 0x0056, 0x0040, 0xffd6, 0xff95, 0x001b, 0x0067, 0x00b3,
+	0x00cc, 0xffef, 0xffb1, 0x0061, 0x004c, 0x001a, 0x000d, 0xffa5,
+	0xff9e, 0xffbe, 0xff8b, 0xff53, 0xffc1, 0x0009, 0xfffa, 0xffee,
+	0xffd1, 0xffe9, 0x0064, 0x00a5, 0x0048, 0x0078, 0x004f, 0xffad,
+	0xffd1, 0x0028, 0x002f, 0xffe3, 0xff78, 0xff48, 0x0015, 0x0052,
+	0xffdb, 0x0047, 0x009f, 0x005e, 0x0078, 0x009b, 0x005e, 0x009b,
+	0x004c, 0xffb6, 0x0021, 0xff75, 0xfe98, 0xfe55, 0xfdee, 0xfee7,
+	0xff44, 0xfec7, 0xff00, 0xff06, 0xff8c, 0x0044, 0x000a, 0x000b,
+	0x0030, 0xfff2, 0x007d, 0x0055, 0x0028, 0x0035, 0xffa1, 0xffd6,
+	0x0033, 0xffd6, 0xffd0, 0x006a, 0x004f, 0x006e, 0x0065, 0x0048,
+	0x00e0, 0x00ff, 0x00a0, 0x0049, 0x00a9, 0x00ac, 0x0024, 0xffd9,
+	0xff8c, 0xffbb, 0xffe7, 0xff65, 0xff27, 0xff84, 0xff78, 0xffac,
+	0x0007, 0xffb6, 0xffac, 0x0016, 0x0060, 0x0061, 0x005b, 0x0038,
+	0xffd2, 0x0031, 0x0026, 0xfff2, 0x0074, 0x0027, 0xff81, 0xff8e,
+	0x0014, 0x0059, 0x007e, 0x0023, 0xffa0, 0x002c, 0x00c8, 0x007d,
+	0x0032, 0x00f3, 0x00df, 0x0058, 0x0021, 0xffa2, 0x0023, 0x007f,
+	0xffc9, 0xff58, 0xff59, 0xff6d, 0xff96, 0xff6f, 0xff84, 0xffa1,
+	0xff73, 0x0000, 0x004a, 0x0024, 0x005e, 0x0022, 0x000c, 0x00c9,
+	0x0086, 0xffd7, 0x0040, 0x0038, 0xfffc, 0x0078, 0xffe1, 0xff7b,
+	0x0054, 0x0036, 0xffbe, 0x008b, 0x0090, 0xffd5, 0x00a2, 0x012d,
+	0x0079, 0x004a, 0xff89, 0xff72, 0x0105, 0x0078, 0xfde6, 0xfd64,
+	0xfe1d, 0xfea6, 0xfedc, 0xfe5b, 0xfe81, 0xff0b, 0xffe4, 0xff1f,
+	0xfee3, 0x0093, 0x0074, 0x00b5, 0x0149, 0xff8a, 0xff90, 0x0148,
+	0x0018, 0x004d, 0x00f0, 0xffa1, 0x004b, 0x0040, 0xff4e, 0x00b1,
+	0x0142, 0x0084, 0x002c, 0xfff8, 0x0156, 0x0191, 0x0036, 0xffce,
+	0x0058, 0x008d, 0x0084, 0xffc9, 0xfe6d, 0xff72, 0xffd9, 0xff3b,
+	0xff35, 0xfeb3, 0xff1a, 0x0007, 0x0049, 0xffbd, 0xff9d, 0xff50,
+	0x0125, 0x01a7, 0xff41, 0x0067, 0x009f, 0x002f, 0x01b8, 0xff6f,
+	0xff1b, 0x01dc, 0x0013, 0xff5b, 0x00db, 0xffb0, 0x0048, 0x012d,
+	0xff20, 0x0181, 0x01e0, 0xffe5, 0x00b5, 0xff9e, 0x0063, 0x00c6,
+	0x002d, 0xffc9, 0xff43, 0xfecd, 0xffa8, 0xfee1, 0xfd4a, 0xff77,
+	0xff98, 0xff8f, 0xff3a, 0xfe2b, 0xff3d, 0x024f, 0x01cd, 0xfeaf,
+	0x0052, 0x00ed, 0x0009, 0x0026, 0xfff4, 0x0027, 0x00d8, 0xffda,
+	0xfdd0, 0xff61, 0x0161, 0x006e, 0xffe2, 0x01ef, 0x0162, 0xff43,
+	0x01d8, 0x022c, 0x017b, 0x019e, 0xfe21, 0xff1b, 0x02dd, 0xffb1,
+	0xf9bd, 0xfce6, 0x0109, 0xfb39, 0xfb62, 0x0025, 0xff93, 0x0032,
+	0xfdc9, 0xf59a, 0x07c8, 0x1092, 0xf3ea, 0xf958, 0x045a, 0xff17,
+	0x0914, 0xfdd4, 0xf222, 0x0b10, 0x0833, 0xf201, 0xff71, 0x0358,
+	0x02ee, 0x0771, 0xfb17, 0xfd2c, 0x0919, 0x03c5, 0xfc75, 0x0183,
+	0x0485, 0x0142, 0xfe90, 0xfd84, 0xff55, 0x009c, 0xfeb8, 0xfb73,
+	0xfdcb, 0x0130, 0xfd7c, 0xfd4d, 0xffb9, 0xffb1, 0xfffe, 0x003a,
+	0x013a, 0x00da, 0x002a, 0xff5a, 0x0022, 0x01f9, 0x014b, 0xff4a,
+	0xff2e, 0x01b7, 0x000f, 0xfee9, 0x0022, 0x0078, 0x015d, 0x00ea,
+	0xff68, 0x003a, 0x02b0, 0x011c, 0x00d9, 0x0108, 0x00a9, 0x016a,
+	0x002c, 0xff3e, 0xfffb, 0x0033, 0xff4b, 0xfe6a, 0xfd03, 0xfed1,
+	0xfed7, 0xfd64, 0xff41, 0xfe6e, 0xff27, 0x014f, 0xfe50, 0xfec3,
+	0x01f0, 0x00a9, 0x00ee, 0x00ab, 0xff42, 0x018c, 0x01a3, 0xff57,
+	0xff73, 0xffac, 0x007a, 0x011d, 0x0007, 0x0023, 0x00b1, 0x0171,
+	0x01a6, 0x0199, 0x0190, 0x0103, 0x01cf, 0x0184, 0xffe4, 0x000f,
+	0x00b8, 0xff25, 0xfdf5, 0xfc9e, 0xfb7c, 0xfdbb, 0xfe0d, 0xfba1,
+	0xfd1c, 0xffe3, 0xff38, 0xfe94, 0xfec9, 0xfe6b, 0x000e, 0x0258,
+	0xff6f, 0xffa8, 0x0296, 0xff18, 0xff9e, 0x01b4, 0xfec3, 0xff8f,
+	0x02af, 0x008f, 0x0070, 0x015c, 0xff8d, 0x019c, 0x035f, 0x0159,
+	0xffdf, 0x016a, 0x0162, 0x004d, 0x00bf, 0x003c, 0xfee2, 0xff75,
+	0xff84, 0xfd6a, 0xfe7f, 0xff37, 0xfda9, 0xfed4, 0x00b0, 0xff34,
+	0xff15, 0xff44, 0xfdef, 0x004d, 0x0233, 0x00cb, 0xfe77, 0xff68,
+	0x00e4, 0x00a3, 0x0124, 0x000a, 0xff50, 0x00f5, 0x0167, 0xff2f,
+	0x013c, 0x02d2, 0x0013, 0x013f, 0x01d9, 0xffb3, 0x00b4, 0x026e,
+	0x0062, 0x0027, 0x0185, 0xfe6e, 0xff73, 0x031f, 0xfdeb, 0xfb91,
+	0xff9f, 0xff0a, 0xff38, 0x0108, 0xfbea, 0xfb3e, 0x00f0, 0xff77,
+	0xff47, 0x006c, 0xfdae, 0xfede, 0x02b6, 0x01d4, 0xffe5, 0x00a1,
+	0xfef4, 0x002d, 0x0305, 0x029d, 0xff74, 0xfe90, 0x00da, 0x01f0,
+	0x03bc, 0x0177, 0xfe77, 0x0018, 0x029a, 0x020c, 0x024f, 0x014f,
+	0xfdca, 0xffb0, 0x00e8, 0xff39, 0xfe1b, 0xfbc9, 0xfa98, 0xfdf3,
+	0xfe1f, 0xfc10, 0xfdd4, 0xfcc3, 0xfdcb, 0xffa3, 0xfdfb, 0x00bf,
+	0x0170, 0xfead, 0x00e2, 0x00b7, 0x0043, 0x02e4, 0xff6c, 0xfea6,
+	0x022c, 0x00f8, 0x0222, 0x0066, 0xfe5d, 0x039a, 0x01ae, 0x012d,
+	0x0337, 0xff03, 0x00b2, 0x03b7, 0x008a, 0x01a7, 0x0133, 0xfcb6,
+	0xffe3, 0xfff3, 0xfe92, 0x0006, 0xfc96, 0xfc94, 0x0083, 0xff3a,
+	0xfe0f, 0xfeb9, 0xfcc9, 0xff37, 0x0269, 0x015f, 0x004e, 0xfe6b,
+	0xfe65, 0x01eb, 0x040c, 0x02b8, 0xfdd5, 0xfc2e, 0x0070, 0x03c9,
+	0x0319, 0xfed2, 0xfd8a, 0xffbd, 0x010d, 0x0231, 0x0280, 0xfe9d,
+	0xfdd2, 0x01b6, 0x0190, 0x0478, 0x02d7, 0xf9ba, 0xfc8f, 0x0242,
+	0x008e, 0x01af, 0xfd44, 0xf7d6, 0xfe74, 0xffb9, 0xfd20, 0x014c,
+	0xff31, 0xfb2f, 0xffe5, 0x0194, 0x01fd, 0x0385, 0xff30, 0xfced,
+	0x020d, 0x04c2, 0xfff1, 0xfe2b, 0xff35, 0xffe8, 0x01da, 0x0234,
+	0xfed0, 0xff39, 0x030c, 0xff8d, 0x0045, 0x05e3, 0x02c9, 0x00bb,
+	0x0268, 0xffc1, 0x0149, 0x021b, 0xff38, 0xff77, 0xfdce, 0xf963,
+	0xfb1e, 0xfdb3, 0xfd99, 0xfd9d, 0xf85b, 0xfbfd, 0x002a, 0x000d,
+	0x017f, 0xfca4, 0xfe14, 0x0309, 0x01e2, 0x01f4, 0x00ce, 0xfa16,
+	0x0066, 0x05dd, 0x007a, 0x017c, 0xfece, 0xfd5e, 0x0146, 0x038b,
+	0x043d, 0x0324, 0xfece, 0xfdfd, 0x0526, 0x06e3, 0x02c0, 0xfe00,
+	0xfdf9, 0x0192, 0x0318, 0x0107, 0xfbda, 0xfc7d, 0xfde2, 0xfca8,
+	0x0132, 0x0057, 0xf9d4, 0xfa8a, 0xfdf7, 0x0161, 0x049e, 0xfe2e,
+	0xfa58, 0xff1a, 0x017b, 0x064e, 0xfed7, 0xfbba, 0x01a5, 0x00c9,
+	0x0344, 0x0299, 0xfd54, 0xfbc9, 0x04c6, 0x01e6, 0x02f5, 0x0258,
+	0xf8c9, 0x0316, 0x076d, 0x030c, 0x006f, 0xff49, 0xfdf2, 0x0487,
+	0x04f4, 0xfc08, 0xfeec, 0xfe7b, 0xfc7e, 0xfea3, 0x02aa, 0xfc98,
+	0xf734, 0xfe9e, 0xfd97, 0x014b, 0x033d, 0xfab6, 0xfa38, 0x01cc,
+	0x03eb, 0xfed6, 0x0186, 0xfe14, 0xfcc1, 0x054c, 0x03f3, 0xfea4,
+	0xffb8, 0x02a8, 0xfef6, 0x0616, 0x0334, 0xfc5f, 0x06d2, 0x017f,
+	0xfe0c, 0x0474, 0x0406, 0xfee5, 0x01a7, 0xfce5, 0xfd26, 0x0755,
+	0xfba6, 0xf8c9, 0xfe05, 0xff3d, 0xfc03, 0xfb57, 0xfb08, 0xfcb7,
+	0x0219, 0xf8db, 0xfd38, 0x011e, 0xfd1f, 0xfcd6, 0xfc9b, 0x0171,
+	0x0393, 0x01e4, 0xfa09, 0x025e, 0x06fa, 0xff47, 0x0459, 0x02e1,
+	0x02ce, 0x0371, 0xffa6, 0xffd6, 0x0639, 0x0703, 0xfb92, 0xfe14,
+	0x00a1, 0x0180, 0x0486, 0xfcaa, 0xf914, 0x0076, 0x04e2, 0xfe01,
+	0xff5a, 0xfbfc, 0xfcd6, 0x03a5, 0xfcfc, 0xfdda, 0x0110, 0x05b7,
+	0xfa11, 0xf29f, 0x03d4, 0x083d, 0x01eb, 0xfbf8, 0xf55a, 0xffbe,
+	0x116c, 0x0311, 0xf98f, 0x0275, 0x00e6, 0x0848, 0x0803, 0xfb0a,
+	0xfff2, 0x0215, 0xfb58, 0x01fc, 0x028a, 0xfb0e, 0xfd40, 0xfb2d,
+	0xfb6a, 0x03b6, 0x0146, 0xfdb4, 0x00be, 0xff54, 0xf989, 0xfe89,
+	0x040d, 0x0241, 0xffe9, 0xf7c5, 0xfa44, 0x03e6, 0x03b3, 0xfdd2,
+	0xff9a, 0x014c, 0x0127, 0x0580, 0x04e3, 0x06f2, 0x0427, 0xfeb5,
+	0xffde, 0x05d3, 0x0803, 0xfc36, 0xf6e4, 0xfb81, 0xff9b, 0x038d,
+	0xffd3, 0xf681, 0xfc1f, 0x0440, 0x02c2, 0x02b6, 0xff1f, 0x008f,
+	0x0615, 0x0275, 0xfc6f, 0xfac5, 0xfaeb, 0xfd66, 0xfd65, 0xfadb,
+	0xfad1, 0xfb78, 0xfbd0, 0xfd9b, 0x025a, 0x05a0, 0x015b, 0xfc73,
+	0x0355, 0x0545, 0x0473, 0x02cb, 0xfa32, 0x0074, 0x04ed, 0xfc98,
+	0xfd16, 0xfc82, 0xfd12, 0x0597, 0x0256, 0x0299, 0x0393, 0xfd26,
+	0x049f, 0x09b3, 0x0542, 0x0319, 0x017d, 0x033f, 0x06cd, 0xffff,
+	0xf7a8, 0xfba0, 0x03ea, 0x058f, 0xfa91, 0xf5f8, 0xfe63, 0x00c3,
+	0xfe80, 0xfc2c, 0xf9eb, 0x00fa, 0x004e, 0xf031, 0xf2de, 0xfde5,
+	0xfba8, 0xf9b5, 0xf589, 0xf513, 0x00fc, 0x01fd, 0xfd85, 0x050a,
+	0x0dba, 0x0dec, 0x09be, 0x0b76, 0x0ddb, 0x0fad, 0x0b6a, 0x0313,
+	0x05be, 0x0c72, 0x0671, 0xfa21, 0xf846, 0xfd27, 0x02ee, 0x04a8,
+	0x0191, 0x0075, 0x0421, 0x040f, 0x0225, 0x0388, 0x00ab, 0xfaba,
+	0xf211, 0xe9ef, 0xe5be, 0xdf53, 0xd992, 0xdb22, 0xdfa6, 0xe1df,
+	0xe335, 0xecef, 0xfeb7, 0x0e93, 0x1761, 0x1f4a, 0x2c5b, 0x31e7,
+	0x2f53, 0x2a47, 0x2615, 0x228a, 0x188d, 0x09f8, 0x020b, 0xffa8,
+	0xeeee, 0xe43a, 0xee4f, 0xfa61, 0x051f, 0x04e4, 0xf7da, 0x0173,
+	0x169f, 0x151d, 0x0fbe, 0xff8b, 0xf0df, 0xed5e, 0xdf09, 0xcd22,
+	0xbccb, 0xb6f7, 0xbbb6, 0xc1a5, 0xc9dd, 0xd22e, 0xdd57, 0xfacc,
+	0x1c5e, 0x31fa, 0x3e2e, 0x438c, 0x4b07, 0x4ee3, 0x4718, 0x3a42,
+	0x2970, 0x1c9b, 0x10c2, 0xfd1a, 0xef5b, 0xddd5, 0xd493, 0xe6b8,
+	0xf5c9, 0xfc6a, 0x016d, 0xfc72, 0x0abb, 0x2481, 0x2250, 0x1aab,
+	0x0a43, 0xf97f, 0xf636, 0xe0f9, 0xc618, 0xb289, 0xab1d, 0xb137,
+	0xb722, 0xb79e, 0xbd7e, 0xd048, 0xf3c6, 0x1bfd, 0x3020, 0x3c33,
+	0x4517, 0x5241, 0x5d27, 0x569e, 0x433b, 0x2ece, 0x24cd, 0x1b43,
+	0x08c2, 0xef84, 0xd4b4, 0xcfd2, 0xea27, 0xf612, 0xf556, 0xf373,
+	0xf08b, 0x0e33, 0x27ea, 0x2088, 0x16d1, 0x064a, 0xfcb8, 0xfc79,
+	0xe59b, 0xc823, 0xb239, 0xafb4, 0xba10, 0xb868, 0xb534, 0xb9aa,
+	0xd108, 0xfd84, 0x1a0e, 0x2695, 0x363c, 0x40dd, 0x537a, 0x5ba7,
+	0x4ecd, 0x3dfe, 0x2e03, 0x2962, 0x1fad, 0x0a01, 0xea7d, 0xd26d,
+	0xde60, 0xf5ca, 0xf5a6, 0xef45, 0xea4b, 0xf339, 0x15fe, 0x1e6d,
+	0x12e0, 0x0c34, 0x0175, 0xfde2, 0xf9f6, 0xe27f, 0xc692, 0xbb26,
+	0xbf25, 0xc8f4, 0xc48f, 0xbd96, 0xc55e, 0xe3d9, 0x0b25, 0x1b93,
+	0x2258, 0x2ee0, 0x3e97, 0x4e54, 0x4d77, 0x3d17, 0x2f9e, 0x27f4,
+	0x24b8, 0x19a0, 0x00e7, 0xe518, 0xda1e, 0xeb21, 0xfa58, 0xf643,
+	0xede7, 0xea88, 0xfeed, 0x19c1, 0x168e, 0x0c26, 0x0339, 0xffef,
+	0x0343, 0xf486, 0xdb92, 0xc71d, 0xc3e5, 0xd01a, 0xd1ba, 0xc6f8,
+	0xc642, 0xd43c, 0xf5a7, 0x12a0, 0x178b, 0x219c, 0x2ee7, 0x3e9b,
+	0x49cb, 0x4139, 0x33b2, 0x2917, 0x237d, 0x20d8, 0x126e, 0xf8d7,
+	0xe3b0, 0xde3d, 0xf114, 0xf9ea, 0xf122, 0xed21, 0xecbc, 0x0425,
+	0x1923, 0x0faa, 0x083e, 0x0321, 0x0176, 0x04dc, 0xf177, 0xd9c1,
+	0xd00c, 0xcc95, 0xd589, 0xd6c1, 0xc858, 0xcce7, 0xdfb4, 0xf942,
+	0x10aa, 0x1429, 0x1d49, 0x2f15, 0x3cee, 0x41e4, 0x397c, 0x2f69,
+	0x292c, 0x23b7, 0x1d3a, 0x0cee, 0xf85b, 0xe96e, 0xe341, 0xf0ba,
+	0xf62c, 0xedf6, 0xed7e, 0xef8b, 0x020a, 0x1257, 0x0bdb, 0x0639,
+	0x0494, 0x036a, 0x0250, 0xf40b, 0xe0a6, 0xd719, 0xd613, 0xda3f,
+	0xd7cd, 0xcead, 0xd133, 0xe309, 0xf82a, 0x08df, 0x0f80, 0x16e9,
+	0x29bb, 0x37c2, 0x3849, 0x348a, 0x2e63, 0x2a1d, 0x25a2, 0x1af8,
+	0x0aed, 0xfc9b, 0xf199, 0xe83d, 0xee4f, 0xf129, 0xed10, 0xee40,
+	0xeeae, 0xfca6, 0x0b98, 0x0a37, 0x06fc, 0x060f, 0x0572, 0x050f,
+	0xf972, 0xe9d5, 0xe1bb, 0xdd88, 0xdeae, 0xdb08, 0xd2cb, 0xd592,
+	0xe24e, 0xf2f3, 0x020f, 0x0a47, 0x1274, 0x2218, 0x2f6f, 0x33ca,
+	0x31f1, 0x2e33, 0x2a5a, 0x2415, 0x1a69, 0x0cf3, 0xfff7, 0xf58a,
+	0xea4d, 0xe8e1, 0xee77, 0xecf5, 0xedc1, 0xeefe, 0xf500, 0x0657,
+	0x0d88, 0x097e, 0x0884, 0x06b2, 0x06ca, 0x0374, 0xf414, 0xe835,
+	0xe1cd, 0xdec2, 0xddb1, 0xd791, 0xd4f4, 0xdd20, 0xe9d6, 0xf9c0,
+	0x0522, 0x0b6e, 0x19e4, 0x27c4, 0x305a, 0x3230, 0x2e20, 0x2d1e,
+	0x2855, 0x1e41, 0x12bc, 0x03c4, 0xfa51, 0xf2e2, 0xe7cc, 0xe887,
+	0xeba8, 0xe976, 0xee7c, 0xf1d8, 0xf9d6, 0x0ac6, 0x0bbf, 0x0874,
+	0x0b9b, 0x08a1, 0x0800, 0x00f7, 0xf013, 0xe8b8, 0xe4a4, 0xdcc5,
+	0xda57, 0xd661, 0xd62a, 0xe238, 0xeb40, 0xf820, 0x055a, 0x0e39,
+	0x1da6, 0x27f2, 0x2e10, 0x32e9, 0x3025, 0x2e17, 0x2784, 0x194f,
+	0x1078, 0x04b2, 0xf9b3, 0xf2b2, 0xe530, 0xe57e, 0xeacf, 0xe72d,
+	0xed1b, 0xf11c, 0xf855, 0x09c0, 0x0922, 0x06d9, 0x0c75, 0x09e6,
+	0x0999, 0x028d, 0xf28a, 0xef25, 0xea79, 0xdff6, 0xdd26, 0xda96,
+	0xdd51, 0xe51b, 0xea9d, 0xf4a8, 0x034e, 0x0f12, 0x17e8, 0x1f25,
+	0x28db, 0x3076, 0x2e50, 0x29ef, 0x2196, 0x1953, 0x142c, 0x0907,
+	0xfc74, 0xf459, 0xec06, 0xe81e, 0xed3e, 0xe964, 0xe8c3, 0xf31d,
+	0xf564, 0xffd4, 0x077c, 0xff13, 0x05bf, 0x0be5, 0x037d, 0x0354,
+	0xfa5a, 0xef4a, 0xf3bd, 0xeb77, 0xe252, 0xe66e, 0xe54d, 0xe8d6,
+	0xf0b0, 0xf369, 0xfce0, 0x091a, 0x0e2d, 0x151a, 0x1db5, 0x2113,
+	0x2324, 0x1fc1, 0x1aa1, 0x1aee, 0x15a9, 0x0ade, 0x0422, 0xfdd9,
+	0xf94e, 0xf7e2, 0xf00e, 0xee13, 0xf314, 0xf33c, 0xf530, 0xf799,
+	0xf887, 0xfc93, 0x000e, 0xff2b, 0xfe9a, 0xfe75, 0xfc15, 0xfa2a,
+	0xf951, 0xf69f, 0xf42d, 0xf495, 0xf46b, 0xf569, 0xf7a7, 0xf99e,
+	0xfcf4, 0x002c, 0x04ab, 0x07e0, 0x0aa3, 0x0da3, 0x0d67, 0x0e63,
+	0x0f38, 0x0e06, 0x0ca1, 0x0975, 0x05e0, 0x0441, 0x028b, 0xfef2,
+	0xfc87, 0xfb7f, 0xfb0b, 0xfac2, 0xf9b8, 0xf931, 0xfa92, 0xfd13,
+	0xfcb0, 0xfc48, 0xfd07, 0xfdfe, 0xff3c, 0xfebf, 0xfe45, 0xfe4d,
+	0xfea8, 0xfecd, 0xfe42, 0xfe1c, 0xfe46, 0xfe4b, 0xfe3d, 0xfecc,
+	0xff1b, 0xff12, 0xff9c, 0xffe8, 0x001e, 0x011b, 0x01d7, 0x01b4,
+	0x0214, 0x01eb, 0x0169, 0x023a, 0x0211, 0x00be, 0x00ec, 0x00ff,
+	0x006b, 0x005b, 0xfff0, 0xffa9, 0x0054, 0x00d9, 0x0075, 0x0060,
+	0x0107, 0x0143, 0x014e, 0x0180, 0x0127, 0x013d, 0x0193, 0x0187,
+	0x0087, 0x0005, 0x001b, 0xff68, 0xff39, 0xfee3, 0xfe54, 0xfdb4,
+	0xfd60, 0xfd48, 0xfd25, 0xfd69, 0xfd5e, 0xfc78, 0xfc64, 0xfd0f,
+	0xfcc5, 0xfd45, 0xfd9a, 0xfd59, 0xfea5, 0xffab, 0xffd6, 0x008d,
+	0x0131, 0x026e, 0x035a, 0x036b, 0x02ca, 0x0335, 0x0427, 0x02ec,
+	0x02a3, 0x022a, 0x0159, 0x0255, 0x020f, 0x014b, 0x013f, 0x012b,
+	0x00b9, 0x00e4, 0x00f0, 0x0006, 0xffb2, 0xff25, 0xfe84, 0xfe43,
+	0xfda4, 0xfcfc, 0xfc3b, 0xfbf3, 0xfbee, 0xfba9, 0xfc1d, 0xfcba,
+	0xfcc3, 0xfdd2, 0xfee7, 0xff12, 0xffce, 0x0072, 0x00cb, 0x017a,
+	0x01c9, 0x013b, 0x00d5, 0x012f, 0x00e9, 0x0086, 0x00b1, 0x0083,
+	0x00aa, 0x0153, 0x01a2, 0x016a, 0x01c0, 0x025c, 0x0249, 0x02a1,
+	0x02b9, 0x01b3, 0x018c, 0x0161, 0x0078, 0x007d, 0x0045, 0xff42,
+	0xfea3, 0xfed2, 0xfe71, 0xfedb, 0xff9d, 0xfef9, 0xff36, 0xffb1,
+	0xffcc, 0xffc5, 0xffe9, 0xff8e, 0xff55, 0xff82, 0xfea4, 0xfe28,
+	0xfdcf, 0xfdbf, 0xfdd1, 0xfd70, 0xfdb6, 0xfdb3, 0xfe92, 0xff97,
+	0xff93, 0x0038, 0x009b, 0x00f5, 0x01ae, 0x01b3, 0x0165, 0x00f4,
+	0x009f, 0x0079, 0x0071, 0x0045, 0xffc9, 0xff24, 0xff35, 0x0021,
+	0x00dd, 0x0194, 0x01d5, 0x0215, 0x02d0, 0x034b, 0x037f, 0x03ba,
+	0x0359, 0x02d0, 0x0239, 0x0160, 0x0018, 0xfe53, 0xfe5a, 0xfd95,
+	0xfc5a, 0xfbee, 0xfb4b, 0xfb12, 0xfbad, 0xfcfc, 0xfc96, 0xfd75,
+	0xff96, 0xff0c, 0xff43, 0x009a, 0xffed, 0xff9a, 0x00b7, 0x0054,
+	0xff83, 0xff30, 0xff0f, 0xfebc, 0xff17, 0xfff7, 0xff9e, 0xffee,
+	0x00d4, 0x0146, 0x01c7, 0x0260, 0x02cd, 0x028c, 0x0395, 0x0372,
+	0x028b, 0x02bc, 0x0105, 0x00dc, 0x010a, 0x0008, 0xfeeb, 0xfe9f,
+	0xfe82, 0xfda2, 0xfee8, 0xfe1d, 0xfe32, 0xffd1, 0xfeee, 0xfffe,
+	0x00bb, 0x0075, 0x008b, 0x0073, 0x00b6, 0x00a9, 0x0074, 0xff96,
+	0xfe14, 0xfef1, 0xff66, 0xfe70, 0xfe28, 0xfd3d, 0xfde9, 0xfdd5,
+	0xfe90, 0xff2b, 0xfe9d, 0xfffa, 0x0058, 0x0063, 0x0058, 0x01b5,
+	0x0199, 0x0087, 0x02bd, 0x01c4, 0xffd2, 0x00b4, 0x004b, 0xffe9,
+	0xfff7, 0xffb4, 0xfe34, 0xfed3, 0x0097, 0xfddd, 0xffb6, 0x01ea,
+	0xfef3, 0xffb9, 0x02f1, 0x032d, 0xffd5, 0x0367, 0x01c9, 0xfd11,
+	0x0cf8, 0x00b5, 0xf59d, 0x0da3, 0xf8f9, 0xf96c, 0x0e0f, 0xf316,
+	0xfdef, 0x04c6, 0xf3f1, 0x0215, 0x00c5, 0xfa84, 0xfe9c, 0x0027,
+	0xffd4, 0xfd51, 0x03d4, 0xfd67, 0xfcaf, 0x055b, 0xf91a, 0x01a0,
+	0x0411, 0xf79e, 0x030e, 0xfee8, 0xfcbf, 0x0282, 0xfbd5, 0xfff7,
+	0xff9a, 0xfe1c, 0x00cb, 0xfd06, 0x02d1, 0x0216, 0xfdb1, 0x0530,
+	0x00ce, 0x0112, 0x076d, 0x01b4, 0x04c2, 0x05d0, 0x00e4, 0x04f8,
+	0x03cd, 0x010c, 0x01a2, 0xfeff, 0xfdf0, 0xfeed, 0xfc49, 0xfa3a,
+	0xfd3a, 0xfd0d, 0xf9b4, 0xfe5c, 0x011a, 0xfc9a, 0x021b, 0x040a,
+	0xfee5, 0x0462, 0x04e8, 0xfe97, 0x0019, 0x01d7, 0xfad6, 0xf88e,
+	0xfcf0, 0xf5ce, 0xf566, 0xfb1f, 0xf3e4, 0xf748, 0xff46, 0xfb70,
+	0xffe0, 0x0681, 0x05fd, 0x098f, 0x0e86, 0x0eac, 0x0c20, 0x0f1a,
+	0x0f09, 0x070c, 0x08d8, 0x0773, 0xfc62, 0xfe12, 0xfd42, 0xf608,
+	0xf801, 0xf741, 0xf671, 0xf873, 0xfab3, 0xfffe, 0xfcba, 0x01a7,
+	0x0a3c, 0x0098, 0x0640, 0x0af5, 0xfd2a, 0x018c, 0x01b8, 0xf49c,
+	0xf72d, 0xf3c4, 0xea2e, 0xed71, 0xedc9, 0xec9f, 0xeff3, 0xf4e4,
+	0xf9eb, 0xff2a, 0x09ce, 0x0d5d, 0x111b, 0x1b65, 0x199b, 0x1ab0,
+	0x1e66, 0x165e, 0x12f8, 0x0f9c, 0x05ae, 0x00ff, 0xfbaa, 0xf534,
+	0xeeea, 0xeffe, 0xf3f5, 0xebe1, 0xf5f5, 0xfde7, 0xf5d0, 0x06b7,
+	0x09d3, 0x0034, 0x0f2d, 0x0b2c, 0xfff5, 0x0634, 0xfc05, 0xf18f,
+	0xef8d, 0xe88f, 0xe390, 0xdf1a, 0xe3fb, 0xe55e, 0xe444, 0xf5cd,
+	0xfc07, 0xff07, 0x1448, 0x1895, 0x1b9f, 0x2b1b, 0x28cb, 0x24f9,
+	0x2655, 0x1f27, 0x15b6, 0x0d7b, 0x08e6, 0xf957, 0xed21, 0xf690,
+	0xe9e4, 0xe3f3, 0xf7f6, 0xeb08, 0xf05f, 0x0a7e, 0xfa06, 0x0317,
+	0x172c, 0x02c9, 0x0948, 0x0ced, 0xf8d2, 0xf8ca, 0xf051, 0xe4ab,
+	0xe12c, 0xdd6a, 0xdcc1, 0xd991, 0xe2ab, 0xedd0, 0xefcb, 0x011d,
+	0x0ddb, 0x1350, 0x257b, 0x29a1, 0x2b42, 0x2fcc, 0x2974, 0x2699,
+	0x1d93, 0x150e, 0x0aff, 0xf757, 0xf93d, 0xf3e8, 0xe2d6, 0xf163,
+	0xeb58, 0xe4f3, 0x00d4, 0xf702, 0xf897, 0x10b1, 0x0315, 0x05b5,
+	0x0df2, 0xff3e, 0xf9d5, 0xf687, 0xec06, 0xe202, 0xe448, 0xde0a,
+	0xd3d3, 0xe417, 0xe5c5, 0xe8b5, 0xfeb5, 0x0048, 0x0ea3, 0x215a,
+	0x20d1, 0x2d4d, 0x2f7b, 0x29ae, 0x2e47, 0x22e0, 0x1a39, 0x14b4,
+	0xff92, 0xfa0c, 0xfba9, 0xe8f3, 0xeb69, 0xf0df, 0xe24b, 0xf5a1,
+	0xfb6a, 0xf0e5, 0x07e7, 0x05ba, 0xfe67, 0x0c33, 0x0053, 0xf94b,
+	0xf9ec, 0xebd1, 0xe73d, 0xe550, 0xde18, 0xdb95, 0xe0ac, 0xe35f,
+	0xeb38, 0xf8f5, 0xfc87, 0x0e56, 0x1b94, 0x1bcc, 0x2d48, 0x2db3,
+	0x270d, 0x3140, 0x25e1, 0x192c, 0x1bc3, 0x0607, 0xf9bc, 0x02e9,
+	0xed95, 0xe932, 0xf72c, 0xe307, 0xf023, 0xffa3, 0xecec, 0x0306,
+	0x0900, 0xf7f8, 0x0a90, 0x038a, 0xf3b4, 0xfbd2, 0xeeba, 0xe4c2,
+	0xe855, 0xe00c, 0xda60, 0xe256, 0xe5ac, 0xe84c, 0xf853, 0xff24,
+	0x08f5, 0x1a5f, 0x1d68, 0x27b1, 0x2eab, 0x2862, 0x2e0a, 0x277b,
+	0x1a9e, 0x1be8, 0x079b, 0xfd66, 0x044d, 0xed0c, 0xecd9, 0xf728,
+	0xe222, 0xf317, 0xfd69, 0xea60, 0x05e3, 0x046c, 0xf504, 0x0e58,
+	0xfc0e, 0xf35c, 0x0089, 0xe6c5, 0xe846, 0xebf8, 0xd83f, 0xe1f6,
+	0xe3cc, 0xe0bd, 0xf14a, 0xf67e, 0xfeb0, 0x0f3d, 0x1701, 0x1f43,
+	0x2901, 0x2ac5, 0x2a6f, 0x2d3c, 0x2355, 0x1b9f, 0x18d1, 0x0357,
+	0x0322, 0x00c1, 0xe86d, 0xf62e, 0xf134, 0xe282, 0xfe6b, 0xf359,
+	0xf070, 0x0c17, 0xf8a1, 0xfdab, 0x0a02, 0xf2a4, 0xf9a8, 0xf3dd,
+	0xe51b, 0xeb53, 0xdf40, 0xde8e, 0xe322, 0xe00d, 0xec5c, 0xf2d5,
+	0xfa60, 0x09b9, 0x11ea, 0x1c40, 0x2475, 0x2840, 0x29d9, 0x29ab,
+	0x2673, 0x1dbc, 0x1842, 0x0b36, 0x03fc, 0x031c, 0xf242, 0xf5fb,
+	0xf6e1, 0xe9b8, 0xfbe7, 0xfa80, 0xf271, 0x07b0, 0xff28, 0xfa36,
+	0x06e8, 0xf75a, 0xf31c, 0xf366, 0xe591, 0xe45c, 0xe08f, 0xdd8f,
+	0xdf97, 0xe141, 0xeaa5, 0xf296, 0xfb40, 0x08a0, 0x1341, 0x1a85,
+	0x237c, 0x293f, 0x2716, 0x28f4, 0x2551, 0x1b80, 0x1797, 0x0b2f,
+	0x0529, 0x0174, 0xf545, 0xfacb, 0xf59f, 0xf0d3, 0xffda, 0xf817,
+	0xfacd, 0x075b, 0xfc49, 0xff81, 0x005d, 0xf3e7, 0xf357, 0xeb8e,
+	0xe3ba, 0xe13d, 0xdb84, 0xde2e, 0xde26, 0xe0a3, 0xee1a, 0xf3c2,
+	0xfd0b, 0x0d6d, 0x143d, 0x1cde, 0x26a3, 0x2672, 0x27c2, 0x286a,
+	0x215a, 0x1b13, 0x1350, 0x0b69, 0x070f, 0xfced, 0xfb53, 0xfd13,
+	0xf43e, 0xfbe7, 0x0050, 0xf83e, 0x035a, 0x026a, 0xf9fa, 0x00d6,
+	0xf7ff, 0xefdd, 0xee0f, 0xe3ca, 0xe03b, 0xdb9a, 0xd9a8, 0xddd3,
+	0xde33, 0xe6b7, 0xf1b1, 0xf931, 0x053d, 0x10a9, 0x1a18, 0x2133,
+	0x25fe, 0x2809, 0x249d, 0x23b5, 0x2036, 0x13ed, 0x0e89, 0x0c8c,
+	0x00be, 0xfdc3, 0x0137, 0xf886, 0xfbaf, 0x02ad, 0xfc76, 0x00ca,
+	0x046d, 0xfdf0, 0xfcea, 0xfa38, 0xf24a, 0xeb4c, 0xe55a, 0xe14f,
+	0xdbf3, 0xd90c, 0xddba, 0xdf76, 0xe339, 0xf092, 0xf93d, 0x00e7,
+	0x0f38, 0x1761, 0x1cb4, 0x24ac, 0x268a, 0x2349, 0x210e, 0x1f97,
+	0x15d3, 0x0e86, 0x0e2c, 0x02ec, 0x00af, 0x034a, 0xfa9e, 0x004a,
+	0x0255, 0xfe1e, 0x045a, 0x01a7, 0xff31, 0xfc9d, 0xf4ed, 0xf317,
+	0xea3b, 0xe200, 0xdffe, 0xda89, 0xda91, 0xdc8d, 0xdf6b, 0xe6cb,
+	0xf047, 0xfba3, 0x034d, 0x0f29, 0x1a5f, 0x1c5e, 0x2268, 0x2555,
+	0x21ec, 0x20b1, 0x1a26, 0x11c0, 0x10ec, 0x0ad4, 0x0166, 0x0404,
+	0x0144, 0xfe12, 0x0533, 0x01fe, 0x0284, 0x07cf, 0x0160, 0x0021,
+	0xfd33, 0xf443, 0xef28, 0xe631, 0xe1d7, 0xdd77, 0xd6c4, 0xd8e4,
+	0xd9f1, 0xe08f, 0xeab3, 0xf0fe, 0xfd4d, 0x0819, 0x1209, 0x1ade,
+	0x1f2f, 0x2428, 0x219e, 0x2076, 0x2025, 0x1423, 0x1137, 0x0f2f,
+	0x023b, 0x049a, 0x04c2, 0xfb83, 0x03c2, 0x04e1, 0x001f, 0x08e9,
+	0x058a, 0x014b, 0x01f2, 0xf8c9, 0xf4d3, 0xede7, 0xe3da, 0xe030,
+	0xda52, 0xda7f, 0xdb67, 0xdc89, 0xe592, 0xeca6, 0xf793, 0x027f,
+	0x0b88, 0x16ec, 0x1b9b, 0x2193, 0x2428, 0x2086, 0x20a5, 0x19fc,
+	0x11f5, 0x106d, 0x0967, 0x01e1, 0x0234, 0xffb9, 0xfdac, 0x0232,
+	0x0194, 0x027b, 0x05d7, 0x02fe, 0x01e1, 0xfee7, 0xf8f5, 0xf30a,
+	0xeb4a, 0xe6e5, 0xe0a2, 0xdcda, 0xddac, 0xdc92, 0xe28a, 0xea1d,
+	0xf021, 0xfad9, 0x04d0, 0x0ea2, 0x168b, 0x1bc1, 0x20aa, 0x205f,
+	0x1f78, 0x1d06, 0x15b5, 0x11c5, 0x0dc6, 0x0689, 0x01cb, 0x00e2,
+	0xfebd, 0xfdb7, 0x0074, 0xfff4, 0x0163, 0x0430, 0x00b1, 0xff85,
+	0xfdd9, 0xf6fc, 0xf322, 0xedd5, 0xe78a, 0xe49a, 0xe19f, 0xe0b3,
+	0xe2f8, 0xe856, 0xedc4, 0xf546, 0xfe4e, 0x0520, 0x0ec8, 0x1587,
+	0x18e7, 0x1c87, 0x1c07, 0x1af9, 0x1889, 0x1459, 0x0e71, 0x08cd,
+	0x06df, 0x0171, 0xff1a, 0xfef8, 0xfc25, 0xff6c, 0xff97, 0xff98,
+	0x01ff, 0xffb4, 0xff72, 0xfbf3, 0xf81e, 0xf5dd, 0xeebb, 0xeb0e,
+	0xe86b, 0xe68c, 0xe76f, 0xe75a, 0xeb8c, 0xf09c, 0xf6bd, 0xfe9e,
+	0x04a2, 0x0ca0, 0x1218, 0x1599, 0x1a01, 0x1a47, 0x18f8, 0x161c,
+	0x11a7, 0x0f85, 0x0adf, 0x0482, 0x02ae, 0xff46, 0xfd40, 0xfe42,
+	0xfb83, 0xfdba, 0x004a, 0xfcc8, 0xfeb4, 0xff79, 0xfc51, 0xfae0,
+	0xf6dc, 0xf480, 0xf2c9, 0xef21, 0xece8, 0xeb69, 0xed6b, 0xef43,
+	0xefff, 0xf572, 0xfaf8, 0x0001, 0x0548, 0x0a4c, 0x0f8a, 0x11d0,
+	0x13ae, 0x1487, 0x13fb, 0x138c, 0x0fe5, 0x0c0b, 0x0909, 0x0681,
+	0x0335, 0xff33, 0xff46, 0xfd2e, 0xfb22, 0xfd56, 0xfb67, 0xfb77,
+	0xfd25, 0xfb5e, 0xfbfb, 0xfb6a, 0xf9a4, 0xf87f, 0xf688, 0xf5e7,
+	0xf42f, 0xf393, 0xf47f, 0xf405, 0xf58f, 0xf889, 0xfb47, 0xfe1c,
+	0x0134, 0x0502, 0x0871, 0x0b3b, 0x0c78, 0x0d76, 0x0e97, 0x0dee,
+	0x0ce5, 0x0b16, 0x08d1, 0x0747, 0x036a, 0x00e6, 0x0102, 0xfe58,
+	0xfc47, 0xfc67, 0xfb5e, 0xfc42, 0xfbe5, 0xf9c4, 0xfb7f, 0xfca7,
+	0xfb8f, 0xfb16, 0xfaf7, 0xfbbd, 0xfb6a, 0xf9df, 0xf9ec, 0xfb0c,
+	0xfb8a, 0xfa98, 0xfae5, 0xfd24, 0xfeb3, 0xfef4, 0xffa8, 0x01fd,
+	0x04bd, 0x05c9, 0x0583, 0x0719, 0x0923, 0x0856, 0x077f, 0x0726,
+	0x06d6, 0x0742, 0x04be, 0x0201, 0x026e, 0x010f, 0xfe5f, 0xfdbc,
+	0xfcd9, 0xfccc, 0xfce5, 0xfb1e, 0xfb89, 0xfc85, 0xfc85, 0xfd30,
+	0xfcb2, 0xfdac, 0xfeed, 0xfd40, 0xfd62, 0xfe10, 0xfd01, 0xfddd,
+	0xfd96, 0xfc7c, 0xfe75, 0xfea9, 0xfdfb, 0xff7d, 0x0026, 0x0151,
+	0x02cb, 0x033f, 0x04b8, 0x058d, 0x05cc, 0x054b, 0x04cc, 0x05a0,
+	0x0445, 0x02e6, 0x029a, 0x006c, 0xffbe, 0xfed7, 0xfd3a, 0xfdb3,
+	0xfdf2, 0xfd9f, 0xfdb4, 0xfe2a, 0xfeb4, 0xfecd, 0xff2c, 0xff6f,
+	0xff6e, 0xffb2, 0xff64, 0xfe79, 0xfde6, 0xfd76, 0xfcc0, 0xfccf,
+	0xfd1e, 0xfd42, 0xfe0f, 0xfed1, 0xff56, 0x0005, 0x0134, 0x02be,
+	0x02d3, 0x0358, 0x03ac, 0x0299, 0x025e, 0x014e, 0x0073, 0x0156,
+	0x0086, 0xff94, 0xffe2, 0xffc1, 0x005a, 0x005d, 0xfffb, 0x00f9,
+	0x0142, 0x0128, 0x00e6, 0x007d, 0x0097, 0xffb2, 0xfed5, 0xfebb,
+	0xfe47, 0xfdab, 0xfd4d, 0xfd41, 0xfd99, 0xfe00, 0xfd99, 0xfe0b,
+	0xffac, 0xffbf, 0xff68, 0xff80, 0xffd0, 0x004a, 0x0078, 0x0077,
+	0x0070, 0x0142, 0x0115, 0x0049, 0x0163, 0x018f, 0x0116, 0x0174,
+	0x01ab, 0x01f6, 0x0238, 0x01e4, 0x0176, 0x0202, 0x0290, 0x0171,
+	0x012a, 0x013a, 0x00bd, 0x006d, 0xffbd, 0xffa4, 0xfefc, 0xfe19,
+	0xfe03, 0xfce9, 0xfcea, 0xfce7, 0xfb6e, 0xfbe6, 0xfd80, 0xfd70,
+	0xfdbf, 0xfed2, 0xfee5, 0xffbb, 0x00c1, 0x0054, 0x0155, 0x0251,
+	0x019d, 0x01b5, 0x01bd, 0x020e, 0x029d, 0x01a3, 0x01cc, 0x02b9,
+	0x0230, 0x0250, 0x0260, 0x0219, 0x0342, 0x02a1, 0x0133, 0x0195,
+	0x0068, 0xff1a, 0xfe1b, 0xfcbb, 0xfcf5, 0xfbf0, 0xfaf1, 0xfb96,
+	0xfbe7, 0xfc7a, 0xfc52, 0xfc9c, 0xfe53, 0xffba, 0x000c, 0x002e,
+	0x01cb, 0x02ad, 0x0205, 0x01e4, 0x02b3, 0x02f0, 0x01b8, 0x011c,
+	0x00a4, 0x0152, 0x022c, 0x006a, 0x009d, 0x0267, 0x0195, 0x0147,
+	0x00c8, 0x0001, 0x0022, 0xff74, 0xfe7f, 0xfe43, 0xfe77, 0xfdca,
+	0xfd47, 0xfd6b, 0xfccd, 0xfcb9, 0xfdc6, 0xfe45, 0xfe6c, 0xff04,
+	0xff8b, 0x0056, 0x010a, 0x00a9, 0x0193, 0x0268, 0x018c, 0x0181,
+	0x0156, 0x01ab, 0x0250, 0x0126, 0x00ed, 0x0229, 0x0143, 0x004a,
+	0x00ec, 0x00b7, 0x0041, 0xffb2, 0xfef2, 0x0037, 0x00a8, 0xfefa,
+	0xfe68, 0xfeeb, 0xfec4, 0xfe04, 0xfdb9, 0xfe5a, 0xff57, 0xfec2,
+	0xfdcd, 0xff88, 0x0083, 0xffb0, 0xff99, 0x0004, 0x01e0, 0x01ab,
+	0xffe5, 0x00da, 0x0230, 0x02d0, 0x0228, 0x00a3, 0x010d, 0x01e8,
+	0x00fc, 0x0044, 0x007b, 0xff86, 0xff42, 0xff50, 0xfee3, 0xff9a,
+	0xfe98, 0xfd28, 0xfdbd, 0xfeef, 0xffc9, 0xff60, 0xfe79, 0xfefd,
+	0x0146, 0x021f, 0x008e, 0xffc0, 0xfff5, 0x006b, 0x0025, 0x0014,
+	0xfff5, 0x003c, 0x0157, 0x008f, 0x0207, 0x0366, 0x000d, 0xff8a,
+	0x0192, 0x01ac, 0x00b6, 0xfe70, 0xfd65, 0xfede, 0xff4a, 0xfc51,
+	0xfa8c, 0xfd38, 0xfdd6, 0xfd2e, 0xfefb, 0x0054, 0x0171, 0x0111,
+	0x0140, 0x03d6, 0x04c3, 0x02e5, 0x00eb, 0x00b8, 0x0237, 0x01e2,
+	0xff9c, 0x0056, 0x0159, 0x0101, 0x013d, 0xff82, 0xfde3, 0xfc8d,
+	0xfb4d, 0xfc9d, 0xfd73, 0xfc0a, 0xfae1, 0xfbf8, 0xfd53, 0xfde0,
+	0xff09, 0x007a, 0x025a, 0x0322, 0x0520, 0x0737, 0x0581, 0x03ec,
+	0x02d2, 0x0479, 0x0655, 0x01aa, 0xfe0d, 0xff18, 0x00bb, 0xff52,
+	0xfcfa, 0xff92, 0x01c0, 0x00cc, 0xfe6e, 0xfd44, 0xff4b, 0xfc15,
+	0xf68e, 0xf895, 0xfd2f, 0xfd21, 0xf962, 0xf8ef, 0xfe91, 0x0336,
+	0x0168, 0xff69, 0x04d6, 0x0946, 0x0669, 0x03b6, 0x04da, 0x0667,
+	0x0460, 0x013e, 0x01a9, 0x0425, 0x0212, 0xfc38, 0xfd66, 0x0330,
+	0x03ef, 0x01c4, 0x005f, 0x0254, 0x028c, 0xfc6a, 0xf7f3, 0xf7ab,
+	0xf848, 0xf634, 0xf3a7, 0xf684, 0xf999, 0xf98a, 0xfa59, 0xfe75,
+	0x05b8, 0x07aa, 0x049d, 0x05e8, 0x0837, 0x0727, 0x0406, 0x019f,
+	0x056a, 0x09b0, 0x04e0, 0x0004, 0x021b, 0x06ae, 0x088f, 0x04b1,
+	0x0441, 0x099f, 0x0afc, 0x0580, 0xfbea, 0xf761, 0xf7d8, 0xf409,
+	0xeea2, 0xecf6, 0xef91, 0xf10d, 0xeeb5, 0xef7d, 0xf653, 0xfeac,
+	0x0095, 0xfc40, 0xfde3, 0x055d, 0x0664, 0x0135, 0xfdcc, 0x0307,
+	0x138e, 0x1b20, 0x14f9, 0x140a, 0x17b5, 0x1d36, 0x1bb0, 0x113e,
+	0x0e2c, 0x0d54, 0x06fe, 0xfb06, 0xecea, 0xe55e, 0xe00c, 0xda4f,
+	0xdada, 0xe2b3, 0xe7a5, 0xe813, 0xeb99, 0xf4ea, 0x011b, 0x0453,
+	0x0211, 0x02e2, 0x0622, 0x0607, 0xfd34, 0xfc58, 0x016b, 0x09db,
+	0x1756, 0x1c06, 0x23de, 0x266e, 0x20ab, 0x22f9, 0x2078, 0x1b4f,
+	0x11f0, 0x05a0, 0x009b, 0xf512, 0xe5ed, 0xd9c7, 0xd5b6, 0xd967,
+	0xd97a, 0xdab7, 0xe142, 0xebc7, 0xf11c, 0xf319, 0xfa96, 0x0395,
+	0x076d, 0x017e, 0xfcf1, 0xfe65, 0x003a, 0x00fb, 0x0262, 0x1217,
+	0x2321, 0x2825, 0x28f1, 0x25a4, 0x2774, 0x258c, 0x198e, 0x0fba,
+	0x084e, 0x03f3, 0xf8f6, 0xe953, 0xe09d, 0xdc9d, 0xdd2c, 0xdc9f,
+	0xdce9, 0xe1b7, 0xe871, 0xee48, 0xf172, 0xf756, 0xfd84, 0x017d,
+	0x01b2, 0xfe92, 0xfcd9, 0xfae3, 0xfa9f, 0xfdaf, 0x09bb, 0x1b4a,
+	0x2502, 0x282e, 0x2739, 0x2724, 0x2646, 0x1cfc, 0x11b8, 0x09f5,
+	0x0768, 0x0213, 0xf475, 0xe811, 0xe2a9, 0xe301, 0xe361, 0xe19e,
+	0xdfc2, 0xe36a, 0xe84b, 0xeb2b, 0xf0ab, 0xf493, 0xf9a8, 0xfd8a,
+	0xfe61, 0x003c, 0xfc72, 0xf989, 0xfae7, 0x04c2, 0x189e, 0x242c,
+	0x2989, 0x2b3e, 0x2a44, 0x2a3b, 0x20f9, 0x14a0, 0x0bc5, 0x068a,
+	0x03d5, 0xfaac, 0xef17, 0xe76b, 0xe45e, 0xe5b6, 0xe635, 0xe2ca,
+	0xe106, 0xe334, 0xe649, 0xeb88, 0xeee9, 0xf2ce, 0xf890, 0xfc52,
+	0x0000, 0xffc5, 0xfd01, 0xfb97, 0xfdec, 0x0dc7, 0x206e, 0x28c7,
+	0x2ba8, 0x28c4, 0x299e, 0x298c, 0x1c51, 0x0df5, 0x051e, 0x0487,
+	0x03a2, 0xf809, 0xec0e, 0xe63b, 0xe762, 0xeadc, 0xe80d, 0xe21f,
+	0xe03c, 0xe24b, 0xe59a, 0xea6f, 0xee50, 0xf2c5, 0xf891, 0xfc72,
+	0x0052, 0x0135, 0xfedc, 0xfca9, 0xffcc, 0x11d9, 0x2563, 0x2bde,
+	0x29db, 0x2301, 0x2554, 0x27ce, 0x1a84, 0x0a01, 0xff9a, 0x0312,
+	0x064a, 0xf9bd, 0xeb77, 0xe4f4, 0xea79, 0xf0e8, 0xeaf1, 0xe26e,
+	0xdeb7, 0xe2bc, 0xe7a7, 0xea21, 0xee7d, 0xf370, 0xf8bd, 0xfbb9,
+	0xfe72, 0x00d6, 0xff26, 0xfb9f, 0xfc60, 0x0e36, 0x24b5, 0x2c99,
+	0x284a, 0x1d48, 0x1fda, 0x26d9, 0x1e21, 0x0e13, 0xff56, 0x0143,
+	0x08b6, 0x0130, 0xf1e7, 0xe564, 0xe72a, 0xf0a6, 0xefe4, 0xe6c4,
+	0xdd91, 0xdf72, 0xe8c8, 0xedff, 0xf101, 0xf27a, 0xf6c5, 0xfc9f,
+	0xfd93, 0xff1a, 0xfecd, 0xfc7d, 0xfdc9, 0x06f7, 0x1c7d, 0x2ad8,
+	0x28fc, 0x1e95, 0x17c1, 0x1f9f, 0x21e5, 0x16bf, 0x0778, 0xff08,
+	0x0445, 0x053b, 0xfc20, 0xee89, 0xe444, 0xe6e8, 0xebac, 0xeb3b,
+	0xe4d1, 0xde57, 0xe1ec, 0xeb9c, 0xf564, 0xf810, 0xf658, 0xf869,
+	0xfc42, 0x00e7, 0x01ca, 0xffb5, 0x009a, 0x04f5, 0x1185, 0x1f0a,
+	0x232c, 0x1f90, 0x16ee, 0x14ea, 0x1994, 0x192c, 0x11fa, 0x07a3,
+	0x03f5, 0x05c8, 0x0404, 0xfc4f, 0xf077, 0xe94b, 0xe83c, 0xe862,
+	0xe671, 0xe252, 0xe0f3, 0xe501, 0xecda, 0xf456, 0xf83f, 0xf949,
+	0xfabc, 0xfdcd, 0x023d, 0x0666, 0x0845, 0x09be, 0x0ccd, 0x119e,
+	0x1651, 0x160d, 0x12be, 0x0eb4, 0x0c2e, 0x0dd5, 0x0f9b, 0x0f6a,
+	0x0ccf, 0x09a1, 0x086d, 0x0871, 0x060f, 0xff34, 0xf686, 0xee8e,
+	0xe9ef, 0xe7ea, 0xe6dd, 0xe6c5, 0xe601, 0xe739, 0xeb85, 0xf037,
+	0xf415, 0xf458, 0xf576, 0xfb03, 0x01ae, 0x0758, 0x0988, 0x0ac8,
+	0x0d8e, 0x0f64, 0x1139, 0x1218, 0x11ad, 0x12b4, 0x129a, 0x1380,
+	0x15c5, 0x1536, 0x13d3, 0x113b, 0x0e29, 0x0b9b, 0x0568, 0xfcc6,
+	0xf3ae, 0xeb70, 0xe7da, 0xe56e, 0xe39f, 0xe354, 0xe319, 0xe409,
+	0xe5e6, 0xe8d0, 0xed39, 0xf242, 0xf75c, 0xfc85, 0x01f2, 0x062f,
+	0x08ec, 0x0b4f, 0x0dc5, 0x110c, 0x12a0, 0x1402, 0x15ea, 0x16ec,
+	0x1835, 0x1706, 0x1632, 0x171c, 0x1689, 0x15e3, 0x0fba, 0x07d4,
+	0x0097, 0xf8ab, 0xf663, 0xf191, 0xeb60, 0xe66a, 0xe1d4, 0xe23a,
+	0xe268, 0xe24c, 0xe271, 0xe356, 0xe8dc, 0xef26, 0xf558, 0xfad0,
+	0xfe15, 0x021a, 0x066b, 0x0ae7, 0x0ebb, 0x118c, 0x1387, 0x1522,
+	0x1696, 0x1805, 0x1a33, 0x1af5, 0x191d, 0x14c5, 0x10d7, 0x1023,
+	0x0f6f, 0x0b87, 0x049e, 0xfd83, 0xf986, 0xf786, 0xf439, 0xef58,
+	0xe980, 0xe49b, 0xe28a, 0xe1d0, 0xe313, 0xe445, 0xe496, 0xe734,
+	0xeb61, 0xf1cc, 0xf7ee, 0xfc0a, 0x0028, 0x04ba, 0x0a77, 0x0fb2,
+	0x131a, 0x15b5, 0x16fc, 0x178e, 0x17fd, 0x1896, 0x1aa0, 0x1a93,
+	0x16a3, 0x1062, 0x0b06, 0x0b0a, 0x0c9c, 0x0aa1, 0x04e0, 0xfcda,
+	0xf7ab, 0xf536, 0xf27c, 0xee6d, 0xe7a9, 0xe27d, 0xdf74, 0xdf1b,
+	0xe220, 0xe4f6, 0xe789, 0xeaa6, 0xef17, 0xf555, 0xfbda, 0x006f,
+	0x03c6, 0x07e5, 0x0d81, 0x12d0, 0x1604, 0x179e, 0x17f6, 0x1731,
+	0x1631, 0x154e, 0x16dc, 0x189e, 0x15e1, 0x0f10, 0x0934, 0x0818,
+	0x096d, 0x07c8, 0x01a5, 0xfa94, 0xf4df, 0xf157, 0xee5d, 0xeb1a,
+	0xe85c, 0xe618, 0xe427, 0xe4d2, 0xe62e, 0xe7e4, 0xead1, 0xed50,
+	0xf1bc, 0xf66c, 0xfb52, 0x0146, 0x062f, 0x0a40, 0x0d48, 0x1028,
+	0x1332, 0x152f, 0x16a1, 0x174e, 0x168b, 0x1563, 0x1535, 0x1614,
+	0x15b3, 0x102e, 0x0888, 0x0367, 0x02cf, 0x0423, 0x005d, 0xfa5f,
+	0xf48e, 0xf1b1, 0xf1fe, 0xf035, 0xec3c, 0xe736, 0xe40c, 0xe522,
+	0xe7b6, 0xea0d, 0xec04, 0xee90, 0xf2e3, 0xf796, 0xfbd7, 0x0016,
+	0x0490, 0x08e4, 0x0c77, 0x0ea0, 0x10f8, 0x1421, 0x171b, 0x18be,
+	0x16a3, 0x12a6, 0x10f1, 0x125f, 0x144b, 0x1193, 0x0997, 0x022e,
+	0xffd0, 0x01e3, 0x027f, 0xfd73, 0xf5e2, 0xf0a6, 0xefb5, 0xf0da,
+	0xef58, 0xeac9, 0xe794, 0xe79b, 0xeaba, 0xed5b, 0xedde, 0xeffa,
+	0xf46d, 0xf9fe, 0xfd94, 0xfe99, 0x0194, 0x068d, 0x0c31, 0x1052,
+	0x10c7, 0x114c, 0x1302, 0x155e, 0x1635, 0x129d, 0x0d64, 0x0a89,
+	0x0ce2, 0x1162, 0x0f8b, 0x0762, 0xfdf0, 0xf9ba, 0xfd9f, 0x0169,
+	0xff35, 0xf809, 0xf19d, 0xf00f, 0xf1d6, 0xf2ce, 0xf028, 0xed0e,
+	0xeb69, 0xed1a, 0xf022, 0xf05a, 0xf182, 0xf2a4, 0xf88c, 0x009d,
+	0x0370, 0x0454, 0x03e0, 0x0781, 0x0d89, 0x1111, 0x1227, 0x1199,
+	0x1238, 0x12d5, 0x124b, 0x0fdc, 0x0bf5, 0x07d4, 0x05ab, 0x07c5,
+	0x0883, 0x0481, 0xfc37, 0xf658, 0xf9e0, 0xff51, 0xff22, 0xf7f1,
+	0xf12c, 0xf1cc, 0xf5c9, 0xf7c1, 0xf4ea, 0xf025, 0xeed2, 0xf020,
+	0xf2c7, 0xf47f, 0xf3ec, 0xf416, 0xf72f, 0xfd5b, 0x032f, 0x0573,
+	0x05b4, 0x0723, 0x0aec, 0x0fd5, 0x1284, 0x1308, 0x1252, 0x10be,
+	0x0fe7, 0x0f31, 0x0d4b, 0x090e, 0x033f, 0x006a, 0x0287, 0x04b3,
+	0x00c5, 0xf708, 0xeff5, 0xf266, 0xfa64, 0xfdea, 0xf8ef, 0xf26a,
+	0xf2b0, 0xf86e, 0xfc87, 0xfa65, 0xf4f1, 0xf2ae, 0xf55c, 0xfa38,
+	0xfc98, 0xfb21, 0xf8ff, 0xf9f6, 0xff18, 0x0524, 0x0819, 0x0729,
+	0x05b2, 0x0648, 0x08ac, 0x0bf1, 0x0db7, 0x0ea1, 0x0eab, 0x0ca0,
+	0x0aa6, 0x0911, 0x083d, 0x053f, 0x002c, 0xfd63, 0xff72, 0x03f2,
+	0x0147, 0xf6f9, 0xedbc, 0xee76, 0xf8d4, 0x001f, 0xfdf4, 0xf71f,
+	0xf49a, 0xf8f0, 0xfe5d, 0xffb9, 0xfca8, 0xf9b5, 0xf9fb, 0xfcbe,
+	0xfee6, 0xfdcc, 0xfaee, 0xf9bd, 0xfc1c, 0x0090, 0x0357, 0x035c,
+	0x0236, 0x0162, 0x02ad, 0x062e, 0x0a11, 0x0d00, 0x0d1f, 0x0a9c,
+	0x0860, 0x06d9, 0x07f5, 0x0962, 0x07a5, 0x0353, 0xfc68, 0xfab4,
+	0xffb2, 0x03da, 0x01c1, 0xf82d, 0xf112, 0xf3d4, 0xfbe0, 0x00b0,
+	0xfd4f, 0xf7ab, 0xf78c, 0xfafe, 0xfe18, 0xfda0, 0xfacc, 0xfa45,
+	0xfad6, 0xfc2f, 0xfdab, 0xfce2, 0xfa9d, 0xf826, 0xf990, 0xfe58,
+	0x01ba, 0x01e9, 0x0208, 0x05c3, 0x0a10, 0x0a97, 0x074f, 0x065a,
+	0x0990, 0x0d06, 0x0d4c, 0x0a1a, 0x0785, 0x0695, 0x07e1, 0x09fe,
+	0x076b, 0xfe85, 0xf299, 0xefbf, 0xf97f, 0x039c, 0x02b9, 0xf68e,
+	0xef1c, 0xf569, 0x006b, 0x02a1, 0xf994, 0xf0fc, 0xf34b, 0xfc23,
+	0x0077, 0xfcb8, 0xf566, 0xf4b5, 0xfc72, 0x03a2, 0x04c4, 0x0076,
+	0xfd5c, 0x0162, 0x0810, 0x0b86, 0x0a6e, 0x06a1, 0x054d, 0x065a,
+	0x0709, 0x07e7, 0x07fd, 0x09b9, 0x0bf1, 0x09f0, 0x059b, 0xffac,
+	0xfc0a, 0xfdfa, 0xfef1, 0xfdaa, 0xfb02, 0xf756, 0xf790, 0xf816,
+	0xf6ff, 0xf6ba, 0xf583, 0xf6a3, 0xf972, 0xfb16, 0xfcfb, 0xfc86,
+	0xfc2d, 0x0108, 0x06a7, 0x0a44, 0x0751, 0xfe5d, 0xfcab, 0x01f7,
+	0x09ed, 0x0dc2, 0x06a7, 0x0056, 0xfd93, 0xff4d, 0x03b9, 0x0299,
+	0x0100, 0xffa0, 0xfe5e, 0xfeb0, 0xfbbb, 0xf98f, 0xfaca, 0xfdfa,
+	0x0521, 0x06d5, 0x012b, 0xf9fe, 0xf5c6, 0xfd7c, 0x0540, 0x0211,
+	0xfa21, 0xf9cd, 0x08fc, 0x0ffa, 0xfe0e, 0xe476, 0xe817, 0x12fc,
+	0x32a9, 0x2433, 0xf646, 0xdd6c, 0xf778, 0x16cc, 0x13ec, 0xf208,
+	0xdcdb, 0xf209, 0x0f5c, 0x11e5, 0xf742, 0xe013, 0xe962, 0x0147,
+	0x0961, 0xfb2f, 0xeb66, 0xf33f, 0x0b22, 0x1666, 0x0bef, 0xfa04,
+	0xf7f7, 0x0708, 0x1036, 0x09ca, 0xfd15, 0xfc9d, 0x0adf, 0x144d,
+	0x0ea3, 0x00b4, 0xfbbe, 0x0394, 0x0977, 0x048e, 0xf93b, 0xf5e5,
+	0xfd59, 0x0432, 0x01f4, 0xf89c, 0xf3c8, 0xf613, 0xfaa9, 0xfb22,
+	0xf8e6, 0xfb3d, 0x003f, 0x0274, 0xfcf7, 0xf683, 0xf588, 0xfbb9,
+	0x0326, 0x0460, 0x048e, 0x0480, 0x0412, 0x0247, 0xffb5, 0x02b0,
+	0x095b, 0x0cc0, 0x07c8, 0xfecf, 0xfbb4, 0x0087, 0x0695, 0x0592,
+	0xff61, 0xfa4b, 0xfa38, 0xfdb7, 0x0018, 0x006b, 0xfdf8, 0xfbb8,
+	0xfabd, 0xfba4, 0xfd69, 0xfef0, 0x02f7, 0x0671, 0x0593, 0xfe89,
+	0xf9f9, 0x0005, 0x057e, 0xff40, 0xf059, 0xf0dd, 0x0ece, 0x26e0,
+	0x1b24, 0xf6fc, 0xe013, 0xf3ef, 0x103d, 0x0df6, 0xf667, 0xe6cd,
+	0xf823, 0x0f11, 0x0c67, 0xf810, 0xe880, 0xf38f, 0x05ff, 0x07a2,
+	0xfccc, 0xf2a5, 0xf9e1, 0x0860, 0x0b51, 0x03f9, 0xfac2, 0xfd42,
+	0x056a, 0x06b8, 0x022b, 0xfe5b, 0x047a, 0x0c7b, 0x0c5b, 0x043e,
+	0xfccd, 0xfe57, 0x0489, 0x0611, 0x0071, 0xf9b9, 0xf95d, 0xff7f,
+	0x04b4, 0x02ed, 0xfb59, 0xf67d, 0xf70f, 0xf95f, 0xfa9f, 0xfc39,
+	0x024b, 0x069e, 0xfeaf, 0xf465, 0xf40d, 0x0210, 0x0efa, 0x06b3,
+	0xf8d7, 0xf578, 0x00ca, 0x0c55, 0x0841, 0xff89, 0xfad9, 0xfe3a,
+	0x0949, 0x11c5, 0x090d, 0xed03, 0xd2e0, 0xe696, 0x23e7, 0x43d8,
+	0x26d9, 0xe42b, 0xcb57, 0xf928, 0x22c5, 0x19fb, 0xec66, 0xdda1,
+	0x023e, 0x1f32, 0x0ed1, 0xe4fc, 0xd84e, 0xf504, 0x105e, 0x096f,
+	0xef70, 0xe8b8, 0xfdb5, 0x12de, 0x0d9d, 0xf997, 0xf355, 0x0068,
+	0x0e86, 0x0849, 0xf9e9, 0xf948, 0x09bb, 0x1818, 0x0fa6, 0xfc8c,
+	0xf38d, 0xfed5, 0x0e6d, 0x0f1c, 0x03ea, 0xfa0a, 0xfbc3, 0x01f8,
+	0xffc3, 0xf811, 0xf438, 0xf8b5, 0x0005, 0xfe9e, 0xf7ac, 0xf483,
+	0xf8ec, 0xfe70, 0xfd5d, 0xf97d, 0xfa76, 0x0157, 0x0731, 0x0592,
+	0x003f, 0xffc9, 0x01db, 0x04bf, 0x03f4, 0x01d6, 0x0652, 0x08ce,
+	0x090a, 0x02be, 0xfb58, 0xfd7b, 0x00dc, 0x04a1, 0x01c3, 0xfda6,
+	0x002f, 0x023e, 0x012f, 0xfa60, 0xf5ee, 0xf9b7, 0x0053, 0x027a,
+	0xfd68, 0xf9d7, 0xfb8b, 0x0152, 0x04d1, 0x01c4, 0xfe83, 0xfcf5,
+	0xff6c, 0x005d, 0xfe82, 0x0039, 0x04e4, 0x08b2, 0x03f2, 0xfac6,
+	0xfc2e, 0x0448, 0x035b, 0xf60c, 0xeb83, 0x0208, 0x214c, 0x21ab,
+	0x0218, 0xdda3, 0xe82b, 0x0ad5, 0x197d, 0x0950, 0xee3e, 0xf3b7,
+	0x0698, 0x0c00, 0xfd96, 0xeaec, 0xf1cc, 0x016a, 0x058c, 0xfc54,
+	0xf0b1, 0xf895, 0x0750, 0x0b3d, 0x03fe, 0xf921, 0xfaf2, 0x0324,
+	0x07e3, 0x0742, 0x04a2, 0x06e2, 0x0922, 0x07fe, 0x046f, 0x0010,
+	0xff9b, 0x028a, 0x0480, 0x0556, 0x0025, 0xfa80, 0xf9dd, 0xfb6a,
+	0xffb3, 0xfc50, 0xf760, 0xf660, 0xf579, 0xfb43, 0xfcdd, 0xfce9,
+	0xfea5, 0xf75f, 0xf934, 0xfea5, 0x0317, 0x096c, 0x0041, 0xfd0c,
+	0x0148, 0x04df, 0x0c77, 0x08e1, 0x0524, 0x04a9, 0x0292, 0x06de,
+	0x0476, 0xf6a7, 0xecc4, 0xf110, 0x1373, 0x2d07, 0x1847, 0xf206,
+	0xd718, 0xeff8, 0x14ff, 0x1076, 0xfb06, 0xeb37, 0xfcc0, 0x0e95,
+	0xfdeb, 0xea68, 0xe7cc, 0xfbe4, 0x0a5c, 0xfe24, 0xf39d, 0xf80a,
+	0x069a, 0x0b5d, 0xff4e, 0xf912, 0xfe86, 0x0994, 0x0bd2, 0x029c,
+	0xff08, 0x03c6, 0x0cca, 0x0f42, 0x03d3, 0xfa54, 0xf869, 0x011b,
+	0x0c23, 0x09ca, 0x057e, 0xfd49, 0xfaf3, 0xfd52, 0xf8d9, 0xfbf1,
+	0xfab2, 0xfb5a, 0xfe2b, 0xf7ad, 0xf6ee, 0xf98c, 0xfdae, 0x03e3,
+	0xfd0b, 0xf6ac, 0xffe4, 0x06e8, 0x048e, 0xef27, 0xe1a5, 0x0505,
+	0x2e6f, 0x2f97, 0x08a7, 0xe00f, 0xeee0, 0x143a, 0x180f, 0x0133,
+	0xee06, 0x015f, 0x1602, 0x067d, 0xeda3, 0xe2a5, 0xf6c8, 0x08fa,
+	0xfe2b, 0xf196, 0xf004, 0xfcc1, 0x069d, 0xff31, 0xf83b, 0xf951,
+	0x0028, 0x0500, 0x0464, 0x064a, 0x08f5, 0x0778, 0x0315, 0x02cc,
+	0x0a1f, 0x0d47, 0x054b, 0xfe8b, 0x01a3, 0x0964, 0x0887, 0xfd07,
+	0xf988, 0xffea, 0xff65, 0xf7b8, 0xfb16, 0x0181, 0xf697, 0xd946,
+	0xcd10, 0x07a9, 0x4239, 0x3138, 0xed50, 0xbe5d, 0xeb68, 0x2282,
+	0x1524, 0xead7, 0xe692, 0x1904, 0x2d90, 0x029b, 0xdb52, 0xe65e,
+	0x0eb0, 0x1384, 0xf3be, 0xedd6, 0x056d, 0x1a3d, 0x0d7e, 0xf1e1,
+	0xf66d, 0x06f2, 0x0ab3, 0xffca, 0xf417, 0xff04, 0x0a7b, 0x06ca,
+	0x02ac, 0x026c, 0x07ae, 0x064b, 0xf6c8, 0xf220, 0xfee7, 0x1102,
+	0x1763, 0xfef1, 0xe9a6, 0xecf5, 0xfb0d, 0x08fd, 0xfd85, 0xf28c,
+	0xfbe1, 0x0005, 0xfd13, 0xf201, 0xf25a, 0x046c, 0x084f, 0xfe38,
+	0xff9e, 0x0a09, 0x07c2, 0xf09c, 0xdb08, 0xff66, 0x3969, 0x39e6,
+	0x0e62, 0xe0fa, 0xecb7, 0x17eb, 0x10a7, 0xefd2, 0xe9aa, 0x0709,
+	0x1e9e, 0x02f3, 0xdfdd, 0xe5ca, 0x0053, 0x09e7, 0xf261, 0xe729,
+	0xfab8, 0x05c8, 0x00a9, 0xf308, 0xfa44, 0x107a, 0x0d6a, 0x009d,
+	0xfbd4, 0x05a3, 0x0db4, 0x0234, 0xfcc8, 0x06e0, 0x1496, 0x119b,
+	0xfd7b, 0xfa32, 0x032c, 0x0a01, 0x043e, 0xf19d, 0xf2a6, 0xfc78,
+	0x0053, 0xfe79, 0xf617, 0xf7aa, 0xfbdf, 0xf87a, 0xf3a0, 0xf7e3,
+	0x0650, 0x0816, 0xf79b, 0xe425, 0xed54, 0x17fc, 0x29d9, 0x11e4,
+	0xf46e, 0xf34f, 0x11f2, 0x19e5, 0xfc00, 0xecdd, 0xfe1b, 0x169e,
+	0x108c, 0xf15e, 0xec69, 0xff9f, 0x074e, 0xf73e, 0xe767, 0xf56f,
+	0x0944, 0x0712, 0xf7c1, 0xf4df, 0x04a5, 0x09db, 0xfff9, 0xfae1,
+	0x015c, 0x09ea, 0x0531, 0xfd04, 0x0858, 0x1488, 0x0e49, 0x0015,
+	0xf24c, 0xfba8, 0x05b9, 0xff0e, 0xfe11, 0xfe2f, 0x05af, 0x02cf,
+	0xf393, 0xf0ab, 0xf3f6, 0xfcad, 0xfe3f, 0xf8c0, 0xfbe9, 0x01e5,
+	0x03af, 0xfa72, 0xede0, 0xf4e3, 0x1106, 0x2521, 0x1b4d, 0xfe0d,
+	0xf0ea, 0x021c, 0x1064, 0x08cd, 0xf93b, 0xfb06, 0x0bb6, 0x0b5b,
+	0xf7ca, 0xeac7, 0xf339, 0x00a9, 0xfc13, 0xf1fa, 0xf5bf, 0x0057,
+	0x04e9, 0xfa6f, 0xf5be, 0x01ae, 0x07e9, 0x0497, 0xfca3, 0xfd19,
+	0x063b, 0x0bdc, 0x0ad9, 0x0817, 0x0bc4, 0x095c, 0x0480, 0x00fc,
+	0xfba6, 0x00fa, 0x0140, 0xff3b, 0x005f, 0xfb61, 0xfb49, 0xf896,
+	0xf48b, 0xf60d, 0xf5d8, 0xf793, 0xfaad, 0xfbf2, 0x00eb, 0xff92,
+	0xf8a4, 0xf772, 0xfb50, 0x0dde, 0x1653, 0x0bf6, 0x0543, 0x00b0,
+	0x0c06, 0x1084, 0x0237, 0xfcba, 0xfcfc, 0x048d, 0x050b, 0xf6e0,
+	0xf23c, 0xf6e3, 0xfc21, 0xfcdc, 0xf70d, 0xf6fa, 0xfd09, 0xfe15,
+	0xfad6, 0xf9f2, 0xfe47, 0x04b4, 0x05b0, 0x00f6, 0x00e2, 0x06dd,
+	0x09ec, 0x0968, 0x07a6, 0x07d0, 0x0c1b, 0x0942, 0x0168, 0xff35,
+	0x0058, 0x03ea, 0x00ba, 0xf8f2, 0xf7b6, 0xf8fa, 0xfa09, 0xf69c,
+	0xf2e9, 0xf5d9, 0xf9c5, 0xfcc3, 0xfd38, 0xfa55, 0xfa28, 0xface,
+	0x0171, 0x0bb7, 0x0cf4, 0x0bdf, 0x08be, 0x0837, 0x0af7, 0x04c7,
+	0xfe80, 0xff96, 0x058e, 0x086a, 0x0080, 0xf6e4, 0xf402, 0xf747,
+	0xf9c4, 0xf6e0, 0xf69b, 0xf9d6, 0xfd4b, 0xfee0, 0xfd5e, 0xfe41,
+	0x0030, 0x018a, 0x0234, 0x037a, 0x058a, 0x0774, 0x087a, 0x0856,
+	0x0a4a, 0x0acb, 0x0977, 0x0715, 0x0365, 0x024a, 0x00d4, 0xfdc6,
+	0xfbb0, 0xf979, 0xf8f7, 0xf75f, 0xf4b1, 0xf422, 0xf409, 0xf75c,
+	0xf9b2, 0xf9ba, 0xfb72, 0xfb9f, 0x0155, 0x07b3, 0x06cd, 0x06d5,
+	0x0628, 0x0873, 0x0e4f, 0x0a96, 0x04c7, 0x0284, 0x017e, 0x0430,
+	0x0014, 0xf95f, 0xf869, 0xf83c, 0xf98e, 0xf6f7, 0xf3de, 0xf71e,
+	0xfabb, 0xfdd8, 0xfe33, 0xfd23, 0xffad, 0x00f0, 0x01b2, 0x045f,
+	0x0582, 0x08b9, 0x0ab0, 0x08da, 0x0b80, 0x0bfb, 0x097d, 0x08e5,
+	0x0623, 0x05cf, 0x051a, 0xfe85, 0xf988, 0xf790, 0xf7a4, 0xf860,
+	0xf597, 0xf365, 0xf2ae, 0xf35d, 0xf57d, 0xf534, 0xf78b, 0xfaca,
+	0xff75, 0x08d7, 0x088f, 0x0702, 0x0730, 0x0425, 0x0bb2, 0x0c48,
+	0x0769, 0x09f4, 0x064f, 0x0607, 0x02d4, 0xf920, 0xf9ec, 0xfa7a,
+	0xf901, 0xf8e1, 0xf453, 0xf62e, 0xfae6, 0xf954, 0xfba6, 0xfcd2,
+	0xff18, 0x03f1, 0x022f, 0x047f, 0x06e5, 0x0816, 0x0a71, 0x0861,
+	0x0948, 0x0b8e, 0x09dc, 0x0900, 0x0707, 0x0461, 0x0353, 0xfea6,
+	0xfa9b, 0xf905, 0xf718, 0xf63a, 0xf4ee, 0xf3ca, 0xf3ad, 0xf3ff,
+	0xf2f5, 0xf288, 0xf5f3, 0xfa98, 0x0318, 0x094c, 0x06fa, 0x07ad,
+	0x07bf, 0x093c, 0x0cb1, 0x07c6, 0x0706, 0x0959, 0x08d7, 0x07b3,
+	0xffdb, 0xfa6d, 0xfb94, 0xf9c7, 0xf85e, 0xf507, 0xf2b6, 0xf7cf,
+	0xf96a, 0xf9e3, 0xf9cd, 0xfa3c, 0xffe7, 0x0241, 0x04a6, 0x0650,
+	0x06f3, 0x0a53, 0x09ed, 0x0959, 0x0a8a, 0x0a4b, 0x0bfb, 0x0ab6,
+	0x07b5, 0x0597, 0x0049, 0xfd47, 0xfa1d, 0xf800, 0xf7c2, 0xf552,
+	0xf414, 0xf321, 0xf34b, 0xf2e7, 0xf21b, 0xf422, 0xf8a8, 0x0057,
+	0x0448, 0x024d, 0x03d4, 0x05ea, 0x09a9, 0x0da5, 0x08d4, 0x08d4,
+	0x0b52, 0x07da, 0x05fb, 0xff13, 0xfb1c, 0xff20, 0xfc7b, 0xfa0d,
+	0xf873, 0xf608, 0xf9fa, 0xf961, 0xf832, 0xf9fc, 0xfb5c, 0xff51,
+	0x0279, 0x040c, 0x0647, 0x07ae, 0x0789, 0x0950, 0x0a36, 0x0b95,
+	0x0bfe, 0x0a17, 0x09ce, 0x0736, 0x0450, 0x0127, 0xfd2e, 0xfaf0,
+	0xf967, 0xf753, 0xf55d, 0xf3e3, 0xf2e7, 0xf31e, 0xf23f, 0xf148,
+	0xf371, 0xf946, 0x0023, 0x01ad, 0x00fb, 0x019c, 0x047a, 0x094b,
+	0x090c, 0x07bc, 0x0aac, 0x0cdf, 0x0c5b, 0x05c7, 0xfeb9, 0xfdc9,
+	0xfe9d, 0xfe54, 0xfb61, 0xf88b, 0xf9eb, 0xfbce, 0xfad0, 0xf9a7,
+	0xf96d, 0xfbf8, 0xff62, 0x00a4, 0x032b, 0x0573, 0x0709, 0x078e,
+	0x0695, 0x07a4, 0x09b0, 0x0abe, 0x0998, 0x0804, 0x0656, 0x03e8,
+	0x0167, 0xfd41, 0xfb0a, 0xfa91, 0xf859, 0xf67a, 0xf4c2, 0xf309,
+	0xf318, 0xf1eb, 0xf196, 0xf5e8, 0xfb7a, 0xff46, 0x002d, 0xffe9,
+	0x0160, 0x0535, 0x06e9, 0x0733, 0x08e5, 0x0ae3, 0x0b63, 0x0756,
+	0x0261, 0xffdd, 0x006f, 0x00dd, 0xfe33, 0xfb40, 0xfa5f, 0xfc13,
+	0xfc2a, 0xfb0d, 0xfa75, 0xfbe2, 0xff89, 0x00f8, 0x0170, 0x0247,
+	0x04a4, 0x0737, 0x07cf, 0x082d, 0x08fd, 0x0994, 0x09d8, 0x089a,
+	0x0645, 0x0486, 0x026a, 0xfff8, 0xfd84, 0xfb5e, 0xf92b, 0xf73f,
+	0xf5a5, 0xf402, 0xf3b4, 0xf364, 0xf2c1, 0xf4a9, 0xf92b, 0xfc0f,
+	0xfdac, 0xfee4, 0x0083, 0x03a3, 0x054a, 0x0473, 0x0650, 0x0a2a,
+	0x0a5a, 0x0810, 0x030f, 0x006c, 0x0194, 0x0109, 0xff4b, 0xfd93,
+	0xfde6, 0xff00, 0xfe3e, 0xfc15, 0xfb1a, 0xfc83, 0xfed7, 0x004b,
+	0x0049, 0x0258, 0x0537, 0x06b7, 0x06ac, 0x05ab, 0x0683, 0x07d4,
+	0x082e, 0x073a, 0x0658, 0x05c3, 0x03cc, 0x00df, 0xfe26, 0xfc68,
+	0xfa12, 0xf752, 0xf558, 0xf377, 0xf3c8, 0xf3a5, 0xf28b, 0xf427,
+	0xf6e5, 0xfa46, 0xfc7c, 0xfdd6, 0xff4e, 0x0226, 0x04f1, 0x054b,
+	0x065a, 0x07fb, 0x095c, 0x095d, 0x0695, 0x037b, 0x0207, 0x0115,
+	0x0029, 0xff49, 0xff10, 0xff35, 0xfe7d, 0xfd15, 0xfc44, 0xfdaf,
+	0xff11, 0xfff8, 0x0040, 0x00f6, 0x0311, 0x04a2, 0x04f8, 0x0526,
+	0x0614, 0x0720, 0x07c7, 0x065c, 0x0555, 0x04aa, 0x02aa, 0x012c,
+	0xff1b, 0xfdbf, 0xfc72, 0xfa94, 0xf7f8, 0xf5e4, 0xf5ae, 0xf451,
+	0xf3f4, 0xf524, 0xf681, 0xf8e9, 0xfaf7, 0xfc0c, 0xfe75, 0x0121,
+	0x02fe, 0x0448, 0x05ad, 0x0793, 0x08cd, 0x092e, 0x07a5, 0x0642,
+	0x043c, 0x02f8, 0x01ce, 0xff93, 0xff85, 0xff0b, 0xfea6, 0xfe60,
+	0xfd15, 0xfcb7, 0xfd9f, 0xfe27, 0xfee5, 0x0001, 0x014a, 0x02aa,
+	0x02f9, 0x0354, 0x0410, 0x04b4, 0x0471, 0x0444, 0x04fd, 0x0544,
+	0x048e, 0x0331, 0x0121, 0xffdb, 0xfe81, 0xfc0f, 0xfb4e, 0xfa36,
+	0xf8af, 0xf7c0, 0xf6be, 0xf72f, 0xf6f8, 0xf6c4, 0xf7f2, 0xfa6f,
+	0xfd16, 0xff0e, 0xff95, 0x00af, 0x02ec, 0x03a6, 0x0473, 0x0607,
+	0x075a, 0x07e0, 0x06ff, 0x051c, 0x02fe, 0x02c4, 0x01e7, 0x0075,
+	0x0091, 0xff6e, 0xfed0, 0xfe5a, 0xfe5b, 0xfd56, 0xfdb4, 0xff62,
+	0xff97, 0x0060, 0x00d2, 0x00e4, 0x01fb, 0x03c7, 0x027a, 0x0276,
+	0x03a2, 0x0362, 0x038a, 0x033a, 0x020d, 0x00c1, 0x005e, 0xfe47,
+	0xfdec, 0xfe08, 0xfba5, 0xfa20, 0xf918, 0xf82e, 0xf7f2, 0xf8b5,
+	0xf8fb, 0xfa92, 0xfc5f, 0xfb82, 0xfc85, 0xff39, 0x0053, 0x0275,
+	0x042d, 0x047e, 0x05dd, 0x06a5, 0x05fb, 0x066f, 0x06a5, 0x047a,
+	0x0442, 0x03e4, 0x01fd, 0x01ec, 0x0145, 0xffe4, 0x007d, 0xfd87,
+	0xfaa1, 0x0024, 0x006d, 0xfb28, 0xfc85, 0xfd6b, 0xfef2, 0x0a80,
+	0xfdf0, 0xf6a5, 0x0924, 0xf9ae, 0x005d, 0x08ea, 0xf777, 0x08a0,
+	0x048e, 0xf743, 0x050e, 0x02bc, 0xfb3a, 0x02c7, 0xfe5d, 0xfc49,
+	0x04b5, 0xf91f, 0xf735, 0x0056, 0xfafc, 0xf8f1, 0xfeeb, 0xf95e,
+	0xfd74, 0x04f8, 0xf6d2, 0xff6d, 0x05a1, 0xfd0f, 0x0879, 0x0579,
+	0xfdda, 0x0b45, 0x04ac, 0xfc79, 0x0929, 0xff97, 0x0053, 0x0881,
+	0xfa1f, 0xffbb, 0x0637, 0xfce5, 0xffc6, 0x0069, 0xfc9c, 0x019a,
+	0x0322, 0xfa3e, 0xffb2, 0x01ef, 0xf91a, 0x0497, 0xfa8e, 0xfe4a,
+	0x0542, 0xf7ba, 0x04e9, 0xfd39, 0xfec8, 0x0447, 0xfb2c, 0x00f2,
+	0x015e, 0xfe87, 0x00ae, 0xfe9f, 0xfdab, 0x01ac, 0xfc24, 0x0156,
+	0xfd4a, 0xff17, 0x0044, 0xfc6b, 0x00b9, 0xfd1f, 0x035f, 0xfbc3,
+	0x0660, 0x0117, 0xfd1e, 0x08ab, 0xfa0d, 0x074d, 0x0378, 0xfc86,
+	0x05f7, 0x00de, 0x01e9, 0x01ab, 0xfef7, 0xff23, 0x0253, 0x0127,
+	0xfb7f, 0x0217, 0xfe4f, 0xfd9c, 0x02b7, 0xf946, 0x0468, 0xfec3,
+	0xff13, 0xffa0, 0xfb7f, 0x07a5, 0xf8d9, 0x058d, 0xffd6, 0xfa7f,
+	0x08a0, 0xf7ba, 0x007c, 0x05f8, 0xfc55, 0x0186, 0x0184, 0xf99c,
+	0x0315, 0x0169, 0xf7b5, 0x032a, 0x0128, 0xf7b2, 0x0747, 0xfbd7,
+	0xf821, 0x0c1e, 0xf29b, 0x028a, 0x05ca, 0xf92f, 0x0923, 0xfc3c,
+	0x02f0, 0x0104, 0x015b, 0x0421, 0x004c, 0x0540, 0xff32, 0x00f9,
+	0x014e, 0x0373, 0xfdb5, 0xff6a, 0x04a4, 0xfb47, 0x05da, 0xf959,
+	0xf91a, 0x089b, 0xf678, 0x01b8, 0xfd03, 0xf983, 0x079d, 0xfb8f,
+	0xffac, 0xfc94, 0x0052, 0x012e, 0xfddc, 0x0696, 0xfb11, 0x01ff,
+	0x03b4, 0xfc23, 0x03d7, 0xffd4, 0xfe26, 0x0098, 0x0224, 0xfa68,
+	0x00c4, 0x05ee, 0xf8a5, 0x049c, 0xfd1b, 0xfbeb, 0x0b40, 0xfaf3,
+	0xfb5b, 0x04e3, 0xfeee, 0x01a7, 0x03ca, 0xfa7f, 0x016e, 0x08ed,
+	0xfb4e, 0xfced, 0x0815, 0xfa28, 0x0189, 0x053f, 0xf3ff, 0x0a74,
+	0x0028, 0xf4a2, 0x0a2d, 0xfbf0, 0xfdf0, 0x04e2, 0xf6e6, 0x02e1,
+	0x0668, 0xf7ae, 0x018f, 0x041f, 0xfbda, 0x064b, 0xff7f, 0xf8e9,
+	0x0a0b, 0xfc5f, 0xfc05, 0x0857, 0xf6a5, 0x05b2, 0x0125, 0xf66d,
+	0x07c5, 0xfd5f, 0xfd60, 0x02d6, 0xfdff, 0xfb43, 0x0796, 0xfc50,
+	0xf9a5, 0x0b94, 0xf489, 0x0617, 0x02b0, 0xf5f1, 0x0c1a, 0xfaf0,
+	0xff65, 0x0298, 0xfc30, 0x075b, 0x0277, 0xfc46, 0x024f, 0x0112,
+	0x0116, 0xfff8, 0xfc9a, 0x0247, 0x00ec, 0x009c, 0xfaaa, 0xfdf2,
+	0x0590, 0xfee7, 0xfdb8, 0xff85, 0xfe9b, 0x039c, 0x01ce, 0xf9ae,
+	0x03ce, 0x0181, 0xfcbb, 0xfe41, 0xfcb9, 0x0364, 0x0057, 0xfd31,
+	0xfb3b, 0xff92, 0x0730, 0xfd2b, 0xfd7a, 0x0322, 0xf990, 0x0752,
+	0x00d0, 0xf853, 0x0ab2, 0xf863, 0x0115, 0x01bb, 0xfa24, 0x0ba9,
+	0xfa4f, 0xffc4, 0x00db, 0xfb00, 0x09a2, 0xff0a, 0xf9c6, 0x03ee,
+	0x00e2, 0xfe2e, 0x0698, 0xf8cf, 0x00c0, 0x071c, 0xf73f, 0x05bd,
+	0xfdd3, 0xff9b, 0x0536, 0xf6c3, 0x026d, 0x0533, 0xfba1, 0x0320,
+	0xfc0b, 0xfa39, 0x0b6e, 0xfb3a, 0xfa6b, 0x0689, 0xf9b1, 0x0730,
+	0x03b9, 0xf432, 0x0b08, 0xfbc9, 0x01b0, 0x0516, 0xf62d, 0x0a1a,
+	0xfa40, 0x0041, 0xff05, 0x015a, 0x01f4, 0xfb84, 0x00b7, 0xf7ef,
+	0x0c5c, 0xfe3b, 0xfb12, 0x0105, 0xfbed, 0x04d7, 0x043c, 0xf9dd,
+	0xfe40, 0x0855, 0xf7dd, 0x054c, 0xfdc9, 0xfe94, 0x08f5, 0xf95a,
+	0xfdc8, 0x02c4, 0x0404, 0xfeaa, 0xffe5, 0xfb37, 0x0422, 0x00f3,
+	0xfa4f, 0x0076, 0xffad, 0x0222, 0xfcc8, 0xff23, 0xffe6, 0x0588,
+	0xfef9, 0xfb4b, 0x0306, 0x013e, 0x031e, 0x02c7, 0xfd1d, 0x0078,
+	0x00be, 0xfead, 0x0176, 0xff15, 0x01a8, 0xf8db, 0xffd5, 0xfeef,
+	0xfdeb, 0x055a, 0xfa34, 0x0073, 0xfee4, 0xff82, 0x0074, 0x0226,
+	0xffd1, 0xfe08, 0x02f8, 0xfb99, 0x0515, 0x0066, 0xfce6, 0x025d,
+	0xfe0c, 0x00ae, 0x0364, 0xfe53, 0xfead, 0x036b, 0xfa39, 0x04b8,
+	0x0133, 0xfca0, 0x05f6, 0xf88f, 0x01e5, 0x0380, 0xfb83, 0x04f4,
+	0xfcca, 0xfe09, 0x05ec, 0xfd3e, 0x0038, 0x00c8, 0xfdc4, 0x05bf,
+	0xff74, 0xfb8f, 0x0062, 0xfd8a, 0x06bb, 0x0258, 0xf989, 0x0009,
+	0xfb48, 0x03fb, 0x0531, 0xfba9, 0xff9b, 0xfa84, 0x010a, 0x057d,
+	0xffe1, 0x01af, 0xfb00, 0xfeee, 0x0331, 0x00cb, 0x0422, 0xfdaa,
+	0xfd12, 0x0037, 0xfe45, 0x03df, 0x00b6, 0xfb94, 0x000a, 0xfd60,
+	0x0193, 0x0271, 0xfc9f, 0x0212, 0x0052, 0x00cb, 0x0078, 0xfe79,
+	0x0147, 0x0164, 0x0029, 0xfe90, 0x01f3, 0xfe8e, 0x01fb, 0xfd06,
+	0xfdc5, 0x063a, 0xfba7, 0x0347, 0xfbc6, 0xfe67, 0x07a5, 0xfab2,
+	0x0150, 0xff42, 0xfe30, 0x04f8, 0x010c, 0xfd74, 0x032f, 0xfffc,
+	0xfda4, 0x05fa, 0xfd41, 0x0158, 0x02cf, 0xf984, 0x0194, 0xfc54,
+	0xfc15, 0x02d6, 0xfb91, 0xfe81, 0xfe55, 0xfc42, 0x046e, 0xffdf,
+	0xfeb8, 0x01db, 0xfeeb, 0x0431, 0xffb2, 0xff12, 0x0340, 0xff61,
+	0x012f, 0xfd32, 0xffc6, 0x02f9, 0xfed8, 0xff86, 0xfd2c, 0x01d4,
+	0x0356, 0xfe5d, 0x0098, 0xff8a, 0xffa6, 0x0235, 0xfe84, 0x017a,
+	0x02fd, 0xfcf2, 0x0023, 0xff83, 0x00e6, 0x0294, 0xfcef, 0x012d,
+	0x00e3, 0xfe83, 0x0135, 0xfcd7, 0x0205, 0x00b9, 0xf9d4, 0x0164,
+	0xff8e, 0x0220, 0x00c8, 0xf973, 0x00c0, 0x022f, 0x01b9, 0x0215,
+	0xfc82, 0x001d, 0x0248, 0xffde, 0x031b, 0xff1e, 0xff93, 0x00a5,
+	0xfe7b, 0x0213, 0x006e, 0x0086, 0xff64, 0xfde2, 0xff8e, 0xff7b,
+	0x0158, 0x00cf, 0xffef, 0xfef2, 0xfe85, 0xff7f, 0x0074, 0x01a3,
+	0x0068, 0xff1c, 0xff02, 0xff04, 0x00bf, 0x01c2, 0xffea, 0xffb2,
+	0x003f, 0x005d, 0x0075, 0x00ae, 0xffbb, 0xffbb, 0x0011, 0xfdcb,
+	0xff55, 0x00b5, 0xff70, 0xff11, 0xfe7a, 0xfedd, 0x012d, 0x028b,
+	0x023e, 0x0173, 0xff9a, 0xff83, 0x005f, 0x02aa, 0x0255, 0xfe81,
+	0xfd7a, 0xfd64, 0xfe82, 0xff33, 0xff26, 0xfe78, 0xfe89, 0xfd93,
+	0xfca4, 0x00f8, 0x0292, 0x0237, 0xffcb, 0xfd6f, 0xfff7, 0x0136,
+	0x0295, 0x0295, 0x01ba, 0x011d, 0xfe63, 0xfe8a, 0x0023, 0x0191,
+	0x027d, 0x00c4, 0xfd87, 0xfc18, 0xfd12, 0x00d0, 0x043e, 0x01c1,
+	0xfde9, 0xfc52, 0xfe97, 0x01dd, 0x0240, 0x015c, 0x019a, 0x004a,
+	0xfd48, 0xffb2, 0x0292, 0x02f3, 0x0001, 0xfb38, 0xfed5, 0x0933,
+	0x0482, 0xf91c, 0xf82d, 0xf835, 0x02dc, 0x05a3, 0xfcf9, 0x009c,
+	0x0144, 0xfe5d, 0xfcc8, 0xfce3, 0x0616, 0x0b50, 0x072f, 0x0045,
+	0xf81e, 0xfd19, 0x045c, 0x0636, 0x051b, 0xf925, 0xf51c, 0xf8d3,
+	0xfdad, 0x00fa, 0xffeb, 0x007f, 0xfe8b, 0xff88, 0xfe3a, 0xff25,
+	0x07fe, 0x0805, 0x03b4, 0x0039, 0xfcf0, 0x006a, 0x0384, 0x018b,
+	0x014f, 0xfe3b, 0xfb14, 0xfb48, 0xfb85, 0xfecb, 0x00ff, 0xff3a,
+	0xfe56, 0xfdf3, 0xfe5b, 0x00c7, 0x02f4, 0x0338, 0x0214, 0x0136,
+	0x0071, 0x02e5, 0x06fa, 0x0510, 0xfc87, 0xf9d1, 0xfb38, 0x05d7,
+	0x1227, 0xfe9e, 0xeee0, 0xeb9a, 0xf3ec, 0x11d7, 0x0f50, 0xfd65,
+	0xf1d3, 0xf0e9, 0x0641, 0x0e5d, 0x09b5, 0xffda, 0xf7c8, 0xfe7a,
+	0x037d, 0x0561, 0x0442, 0xfc50, 0xfa1d, 0xfaf8, 0xff29, 0x03c8,
+	0x006f, 0xfc0a, 0xf9e4, 0xfdd8, 0x0559, 0x05c9, 0x0063, 0xfd6a,
+	0xfd4c, 0x0182, 0x03a6, 0x0070, 0x00ba, 0x01a6, 0x01c5, 0x0040,
+	0xfeaa, 0x0117, 0x02a1, 0x0276, 0xffbc, 0xfd08, 0xff6a, 0xffb2,
+	0xff49, 0x001a, 0xfede, 0x008d, 0x0052, 0xfd78, 0xfeb2, 0x0003,
+	0x024d, 0x01fc, 0xfd89, 0xfc57, 0xfda5, 0x01e2, 0x02a7, 0x0037,
+	0xfcc6, 0xfd1e, 0x00dc, 0xffd2, 0x02ea, 0x00fd, 0x001d, 0x01f7,
+	0xff4c, 0x02e2, 0x0197, 0x004c, 0xff50, 0xfe0f, 0x022d, 0xff65,
+	0xfdb0, 0xfe9d, 0xfe89, 0x0160, 0x00ab, 0xfeba, 0x00c5, 0x0136,
+	0xfedc, 0xfe57, 0x018f, 0x04ad, 0x0368, 0xff68, 0xfaee, 0xfe39,
+	0x037e, 0x006c, 0xfea5, 0xfc95, 0xfcfd, 0x0271, 0x0108, 0xff82,
+	0x005b, 0xffb1, 0x01e2, 0x0337, 0x0197, 0x0143, 0x0052, 0xfede,
+	0xffaf, 0xffa7, 0x0021, 0xff94, 0xfcae, 0xfa7f, 0xfb4f, 0xffab,
+	0x00e1, 0xffad, 0xfbaa, 0xfb44, 0x0185, 0x04af, 0x034b, 0xfee2,
+	0xfd7a, 0x01ea, 0x0681, 0x0404, 0xfeb9, 0xfcc1, 0xffe7, 0x03fd,
+	0x0385, 0xff8f, 0xfb4d, 0xfd22, 0x019d, 0x03e2, 0x03ce, 0xfeda,
+	0xfcab, 0x0069, 0x0437, 0x05f5, 0x027e, 0xfe8b, 0xfd85, 0xfe33,
+	0xfe73, 0xfd60, 0xfcc4, 0xfc36, 0xfc05, 0xfbb1, 0xfdb2, 0xff3f,
+	0xfe6b, 0xfdad, 0xfede, 0x0233, 0x03c1, 0x027c, 0x00e7, 0x014c,
+	0x0228, 0x00a8, 0xfedd, 0xfeeb, 0x00ae, 0x01d6, 0x0170, 0x0132,
+	0x01a0, 0x0331, 0x0409, 0x047f, 0x0505, 0x0398, 0x0219, 0x01cf,
+	0x012b, 0xfffd, 0xfdbc, 0xfb21, 0xfa6d, 0xf9ec, 0xfa15, 0xfbc1,
+	0xfd56, 0xfde1, 0xfc85, 0xfd5e, 0x01e0, 0x040d, 0x026e, 0xfe7b,
+	0xfd27, 0x022c, 0x04e8, 0x0274, 0xfe92, 0xfc57, 0xfdd6, 0xffc4,
+	0x008a, 0x00b3, 0x0141, 0x0117, 0x00e2, 0x000a, 0x004a, 0x017a,
+	0x001a, 0x0000, 0xfdfb, 0xfcf1, 0x001b, 0x02ff, 0x0479, 0x01ed,
+	0xff54, 0x005b, 0x04b8, 0x0731, 0x0474, 0x0096, 0xff11, 0xffd3,
+	0x014c, 0x00a0, 0xfcce, 0xfa40, 0xfa6c, 0xfb7c, 0xfc70, 0xfd33,
+	0xfca0, 0xfe05, 0xfed1, 0xfc20, 0xfc08, 0x0300, 0x0913, 0x0a4f,
+	0x0555, 0xfe06, 0xffc8, 0x0346, 0x0402, 0xfeaf, 0xf96a, 0xf744,
+	0xf4c1, 0xf5d0, 0xf4f4, 0xf491, 0xf6e8, 0xfa9c, 0xff18, 0x03e4,
+	0x06c1, 0x0a46, 0x11fc, 0x165d, 0x1593, 0x10d0, 0x0be0, 0x0a04,
+	0x0738, 0x0225, 0xfd12, 0xf52e, 0xf00a, 0xf1f1, 0xf5d5, 0xf58c,
+	0xedbc, 0xe442, 0xf134, 0x11dd, 0x1bde, 0x1464, 0x0231, 0xfd43,
+	0x17a6, 0x2356, 0x14fc, 0xfe68, 0xed4e, 0xeca7, 0xf456, 0xecf2,
+	0xdbcb, 0xcdbf, 0xce19, 0xe2ff, 0xf8de, 0x02e4, 0xffed, 0x03bd,
+	0x16fa, 0x2c2b, 0x359c, 0x2ea9, 0x225f, 0x19bb, 0x1397, 0x0cc5,
+	0x054c, 0xfb1a, 0xf08d, 0xe828, 0xe548, 0xea89, 0xf1ee, 0xf8c5,
+	0xfe29, 0xfdbf, 0xfcc6, 0x0020, 0x0537, 0x0628, 0xfbfb, 0xea13,
+	0xe546, 0xfb41, 0x0e60, 0x13db, 0x0c88, 0xfbfd, 0x05df, 0x1b4c,
+	0x1f69, 0x1d05, 0x04c1, 0xeb4b, 0xe9d2, 0xe503, 0xe259, 0xd896,
+	0xc75e, 0xcfe4, 0xe706, 0xfd4d, 0x1052, 0x12f7, 0x18e6, 0x2d39,
+	0x3992, 0x3ced, 0x317b, 0x174a, 0x077a, 0x00f3, 0xfb7a, 0xf4be,
+	0xe623, 0xdc1f, 0xdf6d, 0xeaa2, 0xf74d, 0xfd62, 0x0106, 0x01d5,
+	0x00c6, 0x0611, 0x0591, 0xff26, 0xf37a, 0xe0cc, 0xe78e, 0x03ac,
+	0x15e3, 0x2057, 0x1121, 0x00e1, 0x132a, 0x23de, 0x2bd5, 0x1e50,
+	0xf344, 0xda92, 0xd649, 0xd7d2, 0xdf62, 0xd2de, 0xc624, 0xd19a,
+	0xe748, 0x0a45, 0x2222, 0x24da, 0x26ac, 0x2a1b, 0x3440, 0x3769,
+	0x28c0, 0x0ea9, 0xf650, 0xedc5, 0xee69, 0xeeb4, 0xed76, 0xea23,
+	0xeeb7, 0xfa85, 0x051a, 0x0e98, 0x0d2c, 0x0628, 0x0338, 0xfd02,
+	0xf73a, 0xebeb, 0xddea, 0xe7ff, 0xfceb, 0x0e49, 0x17a1, 0x09e2,
+	0x0799, 0x175f, 0x20f5, 0x2885, 0x13f4, 0xf3bd, 0xe072, 0xd22a,
+	0xd4b2, 0xd9f8, 0xd380, 0xd188, 0xd6ce, 0xe89c, 0x0aee, 0x22a9,
+	0x3042, 0x328f, 0x2ea9, 0x31e3, 0x2e56, 0x24fd, 0x112e, 0xf68f,
+	0xe928, 0xe5ef, 0xeb87, 0xf45b, 0xf334, 0xf467, 0xf97b, 0xff3b,
+	0x09d8, 0x0a59, 0x0719, 0x0304, 0xf499, 0xe939, 0xde1e, 0xe02d,
+	0xf7da, 0x08ea, 0x133e, 0x0e96, 0x052c, 0x118d, 0x21cd, 0x2b36,
+	0x2389, 0x0483, 0xe841, 0xda16, 0xd5bb, 0xdaa5, 0xd763, 0xcfd3,
+	0xd12c, 0xdbf7, 0xf826, 0x16e8, 0x2a10, 0x3325, 0x333c, 0x33e6,
+	0x344a, 0x2b30, 0x18e7, 0x01a0, 0xed63, 0xe425, 0xe378, 0xe904,
+	0xef5c, 0xf278, 0xf56f, 0xf7e2, 0xfe04, 0x0502, 0x0b74, 0x0cd5,
+	0x023a, 0xf37a, 0xe39a, 0xe4b9, 0xfd09, 0x0efa, 0x17ac, 0x0d42,
+	0xfc9c, 0x089d, 0x1ac1, 0x28f2, 0x273d, 0x0869, 0xed2b, 0xde24,
+	0xd83b, 0xdfcd, 0xdc9a, 0xd09d, 0xcde5, 0xd45b, 0xf0bd, 0x1313,
+	0x266b, 0x2fb0, 0x2d9d, 0x2aec, 0x2cce, 0x271e, 0x1b51, 0x090e,
+	0xf28c, 0xe68b, 0xe2ba, 0xe94d, 0xf2bf, 0xf6ea, 0xf7ee, 0xf701,
+	0xfb38, 0x03db, 0x0e48, 0x1112, 0x070e, 0xf467, 0xe634, 0xec5c,
+	0x0442, 0x1520, 0x1468, 0x0211, 0xf56d, 0x05ba, 0x1c44, 0x2a88,
+	0x1eae, 0xfc4b, 0xe37d, 0xd894, 0xdc88, 0xe48c, 0xde12, 0xd43b,
+	0xd2a3, 0xdd8e, 0xfc78, 0x18c0, 0x297a, 0x2fd7, 0x27e8, 0x249c,
+	0x235a, 0x2175, 0x1b8c, 0x0824, 0xf0cd, 0xe16f, 0xe077, 0xee09,
+	0xf9e1, 0xfa53, 0xf476, 0xefbe, 0xfa5c, 0x0be4, 0x13e4, 0x0ad7,
+	0xf38e, 0xe81b, 0xf78d, 0x0f1d, 0x1ee3, 0x1580, 0xfc68, 0xf6de,
+	0x0094, 0x145b, 0x1dd4, 0x0aaa, 0xf07f, 0xdd56, 0xd8fb, 0xe548,
+	0xebd6, 0xe6c6, 0xdfe2, 0xdb53, 0xeb68, 0x0786, 0x226c, 0x3174,
+	0x2ac7, 0x203c, 0x18d2, 0x1b6d, 0x1f54, 0x136b, 0xfcfc, 0xe58a,
+	0xdcf5, 0xea22, 0xf9d0, 0x00e2, 0xf9e8, 0xecd4, 0xf0e8, 0xfebb,
+	0x0b53, 0x0afd, 0xf921, 0xf2e7, 0xff08, 0x0f8c, 0x1db2, 0x135d,
+	0x0130, 0xfcb5, 0xfe0e, 0x0be0, 0x10b9, 0x039b, 0xf555, 0xe48e,
+	0xdfd3, 0xe6c5, 0xe80f, 0xeb27, 0xeae1, 0xec47, 0xfb80, 0x09ed,
+	0x197a, 0x22f1, 0x1e7b, 0x1b47, 0x169c, 0x1326, 0x114a, 0x05f3,
+	0xf8b3, 0xf02e, 0xec9b, 0xf2c1, 0xf5e8, 0xf3ac, 0xf4b9, 0xf790,
+	0xfe55, 0x0206, 0xfbfe, 0xf89c, 0x0166, 0x0cbb, 0x18c8, 0x1582,
+	0x0733, 0x02e9, 0x03a1, 0x0be3, 0x10eb, 0x065c, 0xf8de, 0xec03,
+	0xe43c, 0xe835, 0xe88e, 0xe85a, 0xe807, 0xe9e8, 0xf719, 0x0421,
+	0x0ddc, 0x1402, 0x14e5, 0x17b9, 0x19b1, 0x174c, 0x1375, 0x0938,
+	0xffb6, 0xf73a, 0xf16d, 0xf1a2, 0xf04b, 0xf330, 0xf716, 0xf744,
+	0xf771, 0xf3b7, 0xf8b7, 0x0c3a, 0x1977, 0x1e2a, 0x1212, 0x0015,
+	0x024d, 0x09aa, 0x1338, 0x13eb, 0x0375, 0xf662, 0xecc4, 0xe970,
+	0xef6a, 0xebcb, 0xe4e7, 0xe11e, 0xe1f6, 0xf234, 0x0183, 0x0b61,
+	0x10fd, 0x10a0, 0x140e, 0x1878, 0x1a2a, 0x1906, 0x1058, 0x0487,
+	0xfb2e, 0xf3f0, 0xf31c, 0xf4d3, 0xf47d, 0xf23d, 0xea14, 0xe4dd,
+	0xef13, 0x0737, 0x20fa, 0x2916, 0x1947, 0x0538, 0x016f, 0x0dc3,
+	0x1a9f, 0x1639, 0xffef, 0xeab4, 0xe340, 0xe7f5, 0xef59, 0xebea,
+	0xe310, 0xdd88, 0xe303, 0xf2e6, 0x0341, 0x0ecb, 0x1258, 0x1246,
+	0x1346, 0x17ea, 0x1c33, 0x1d3d, 0x130a, 0x031b, 0xf48a, 0xee08,
+	0xf5d1, 0xfcf4, 0xfba9, 0xeed7, 0xdf56, 0xe3e2, 0xfd7a, 0x19fe,
+	0x2835, 0x1b24, 0x0606, 0x0059, 0x0a21, 0x1c55, 0x1d52, 0x0841,
+	0xed59, 0xd9c5, 0xdbcf, 0xe869, 0xeef7, 0xec79, 0xe219, 0xdf6d,
+	0xec1b, 0xfeee, 0x1157, 0x17ed, 0x150b, 0x1216, 0x1285, 0x1810,
+	0x1be7, 0x15cd, 0x0769, 0xf751, 0xf06c, 0xf7a6, 0xfe37, 0xfc4e,
+	0xee4e, 0xe559, 0xf150, 0x082b, 0x1f10, 0x1e6c, 0x0d38, 0x0186,
+	0x00c1, 0x0f72, 0x1607, 0x0b19, 0xf72b, 0xe0ca, 0xdaa2, 0xe0bb,
+	0xe8ad, 0xeeb2, 0xec1b, 0xea01, 0xf06f, 0xfd00, 0x0de6, 0x1866,
+	0x18cb, 0x1469, 0x10dd, 0x1181, 0x1366, 0x1023, 0x051b, 0xfa58,
+	0xf597, 0xf6a4, 0xfb0a, 0xf8fe, 0xf475, 0xf7cf, 0xffa1, 0x0ecf,
+	0x17db, 0x145d, 0x0ee7, 0x0741, 0x0600, 0x0850, 0x04a6, 0xfc33,
+	0xedfc, 0xe222, 0xdfb1, 0xe3bd, 0xe89b, 0xe9e1, 0xe969, 0xed77,
+	0xf867, 0x0643, 0x126b, 0x1878, 0x18cf, 0x1719, 0x1516, 0x131f,
+	0x103a, 0x0933, 0x0140, 0xfb25, 0xf629, 0xf57b, 0xf35e, 0xf3f9,
+	0xfa4a, 0x00ea, 0x0aef, 0x0f92, 0x106c, 0x10f9, 0x0dc0, 0x0c56,
+	0x09e4, 0x04c6, 0xfcf7, 0xf01e, 0xe4f3, 0xe0b2, 0xe251, 0xe6cd,
+	0xe98f, 0xeafa, 0xee3e, 0xf6d4, 0x0217, 0x0c9c, 0x13b4, 0x1637,
+	0x1684, 0x150c, 0x122d, 0x0d21, 0x06ef, 0x0190, 0xfd62, 0xfb08,
+	0xf97b, 0xf7de, 0xf928, 0xfbeb, 0x0168, 0x0976, 0x0da3, 0x104b,
+	0x0e88, 0x0a69, 0x098b, 0x06b1, 0x029e, 0xfaf2, 0xefe8, 0xe91d,
+	0xe599, 0xe561, 0xe797, 0xe8a9, 0xec8e, 0xf277, 0xf9dd, 0x0366,
+	0x0ac2, 0x1063, 0x133e, 0x1370, 0x12aa, 0x105f, 0x0cb2, 0x07cb,
+	0x0316, 0xff53, 0xfda6, 0xfda6, 0xfd53, 0xfde4, 0xfecc, 0x01c5,
+	0x067a, 0x08c1, 0x0a6e, 0x0932, 0x068d, 0x04ee, 0x0146, 0xfe67,
+	0xf9f5, 0xf3a1, 0xeee1, 0xeb3b, 0xeb7b, 0xeda5, 0xefd8, 0xf297,
+	0xf58a, 0xfa8a, 0x008e, 0x0589, 0x099c, 0x0bcf, 0x0d36, 0x0e14,
+	0x0d64, 0x0bf5, 0x093b, 0x0589, 0x0312, 0x01da, 0x0188, 0x00f0,
+	0xff1c, 0xfe3e, 0xffd1, 0x038e, 0x06af, 0x0755, 0x056e, 0x031b,
+	0x01af, 0x011c, 0xff91, 0xfb80, 0xf6fb, 0xf313, 0xf189, 0xf136,
+	0xf0cf, 0xf1a2, 0xf373, 0xf6a5, 0xfb02, 0xfe73, 0x017c, 0x04ac,
+	0x0665, 0x0896, 0x0aef, 0x0b5e, 0x0b1a, 0x08d7, 0x05e7, 0x04e5,
+	0x049f, 0x053b, 0x04a5, 0x0247, 0x0114, 0x0024, 0x00ef, 0x0243,
+	0x01af, 0x00af, 0xff5b, 0xfe79, 0xfe94, 0xfe05, 0xfc72, 0xfa9e,
+	0xf876, 0xf75d, 0xf7bc, 0xf80e, 0xf88e, 0xf92d, 0xf9a7, 0xfaaf,
+	0xfc13, 0xfd71, 0xff7c, 0x01d6, 0x03c7, 0x0484, 0x04d6, 0x0618,
+	0x076d, 0x07b3, 0x06ff, 0x0593, 0x057e, 0x066a, 0x05bc, 0x04a0,
+	0x0375, 0x028a, 0x027a, 0x016c, 0x001d, 0xff4d, 0xfdea, 0xfc74,
+	0xfad1, 0xf9b9, 0xfa56, 0xfad6, 0xfaa8, 0xf9e8, 0xf8c4, 0xf949,
+	0xfb5a, 0xfd99, 0xff8f, 0x0077, 0x008b, 0x0110, 0x0175, 0x0236,
+	0x034c, 0x039e, 0x0363, 0x0254, 0x01b3, 0x0269, 0x0329, 0x035c,
+	0x02a9, 0x0214, 0x02be, 0x02e4, 0x0317, 0x02fa, 0x0211, 0x019b,
+	0x0023, 0xff18, 0xfe1c, 0xfcec, 0xfcb9, 0xfbd8, 0xfb7c, 0xfb93,
+	0xfb2b, 0xfb8c, 0xfc6d, 0xfd1e, 0xfd3d, 0xfd76, 0xfea2, 0x0083,
+	0x0234, 0x0296, 0x024d, 0x028c, 0x033d, 0x041d, 0x045e, 0x03e9,
+	0x02f3, 0x021a, 0x0190, 0x01d8, 0x01d5, 0x012d, 0xffba, 0xfe33,
+	0xfd7f, 0xfda3, 0xfeba, 0xff46, 0xff54, 0xfe45, 0xfd58, 0xfe0c,
+	0xfebe, 0xfee7, 0xfe05, 0xfca4, 0xfc76, 0xfccc, 0xfd6b, 0xfe98,
+	0xff5b, 0xff90, 0xff70, 0xffd0, 0x0174, 0x0394, 0x042f, 0x0371,
+	0x02bd, 0x02d8, 0x03d2, 0x043c, 0x034c, 0x01fa, 0x007f, 0xffa4,
+	0x0003, 0x0002, 0xffc4, 0xff51, 0xfe93, 0xfe86, 0xfe95, 0xfe2c,
+	0xfdf7, 0xfe3a, 0xfe5c, 0xfe6a, 0xfe0d, 0xfdbc, 0xfe80, 0xfedb,
+	0xfefc, 0xfeda, 0xfe70, 0xff42, 0xffc3, 0x001a, 0x00c7, 0x0097,
+	0x011a, 0x01be, 0x01eb, 0x02f1, 0x02dd, 0x02d9, 0x02f8, 0x027b,
+	0x02cc, 0x02aa, 0x0233, 0x0166, 0x001a, 0xff22, 0xfe79, 0xfe17,
+	0xfe06, 0xfda0, 0xfd66, 0xfd51, 0xfd3d, 0xfd85, 0xfdbf, 0xfe1a,
+	0xfeaa, 0xff0a, 0xffb2, 0x0025, 0x0081, 0x0096, 0x0078, 0x008f,
+	0x00b5, 0x00cf, 0x00c4, 0x00d2, 0x0103, 0x00ff, 0x00d1, 0x00a0,
+	0x00a8, 0x0132, 0x01c5, 0x019c, 0x0133, 0x00e2, 0x00bf, 0x0153,
+	0x01ae, 0x012d, 0x004a, 0xff12, 0xfe61, 0xfe66, 0xfeb6, 0xfe63,
+	0xfd47, 0xfcc5, 0xfcca, 0xfd5b, 0xfdf6, 0xfdee, 0xfe85, 0xffb5,
+	0x005a, 0x00c8, 0x00b0, 0x005b, 0x00b3, 0x00d0, 0x0184, 0x01f5,
+	0x01bb, 0x016e, 0x00a2, 0x00d4, 0x019a, 0x0190, 0x012d, 0x00d7,
+	0x0099, 0x00c2, 0x0063, 0xffa7, 0xff7e, 0xff5b, 0xfeea, 0xfe6f,
+	0xfdd9, 0xfdd5, 0xfee0, 0xff4b, 0xff07, 0xfee8, 0xfecb, 0xffac,
+	0x008a, 0x008a, 0x0056, 0xffe4, 0x0009, 0x00de, 0x0119, 0x00d9,
+	0x0064, 0x0016, 0x008f, 0x014b, 0x0154, 0x00eb, 0x0019, 0x0011,
+	0x0120, 0x01aa, 0x01ad, 0x00a3, 0xff1c, 0xff3b, 0xffdf, 0x002a,
+	0x0070, 0xff43, 0xfe3a, 0xfe56, 0xfe4d, 0xff15, 0xff6d, 0xfedc,
+	0xfedf, 0xfe91, 0xfecb, 0xff78, 0xffa7, 0x001c, 0x006e, 0x0047,
+	0x0082, 0x009a, 0x00e9, 0x01ce, 0x017f, 0x00b5, 0x0066, 0x006e,
+	0x011c, 0x0178, 0x00d7, 0x0021, 0x0000, 0x003c, 0x00b6, 0x00b1,
+	0xffe4, 0xff57, 0xff14, 0xff0b, 0xffa5, 0xff96, 0xff23, 0xfec6,
+	0xfe6b, 0xfec0, 0xff9b, 0x0042, 0x008e, 0xffff, 0xff7c, 0xffe0,
+	0x0075, 0x014c, 0x014a, 0xffd4, 0xfebc, 0xfe2a, 0xfebb, 0x003a,
+	0x009d, 0x0013, 0xffa2, 0xff6d, 0x004d, 0x0112, 0x010b, 0x00c6,
+	0x0030, 0xffe6, 0x000d, 0x0054, 0x0093, 0x0036, 0xff65, 0xfeea,
+	0xff6a, 0xffd5, 0xffe4, 0xff86, 0xfed4, 0xff0e, 0xff5f, 0xff95,
+	0x0020, 0x0040, 0x0008, 0xffe4, 0xffda, 0x006a, 0x0141, 0x0172,
+	0x017c, 0x016f, 0x00c7, 0x0066, 0x0088, 0x008c, 0x00de, 0x0003,
+	0xff04, 0xff29, 0xff31, 0xff8d, 0xffc4, 0xff92, 0x001e, 0xffe1,
+	0xff28, 0xff80, 0x0005, 0x0062, 0x003c, 0xff11, 0xfed3, 0xff6d,
+	0xffde, 0x0045, 0xfff0, 0xff8c, 0xff6f, 0xff86, 0x0063, 0x014c,
+	0x00e0, 0x008c, 0x007e, 0x00a7, 0x0199, 0x014a, 0x0068, 0x005e,
+	0x0008, 0x0040, 0x0081, 0x0006, 0x001e, 0xff96, 0xff03, 0xff1d,
+	0xfecf, 0xff42, 0xffd7, 0xff89, 0xff82, 0xffa0, 0xffd2, 0x009b,
+	0x00c7, 0xffde, 0xff33, 0xfeef, 0xff16, 0xffc9, 0xff9b, 0xff57,
+	0xff60, 0xff1b, 0xffcd, 0x00d3, 0x0139, 0x0170, 0x0183, 0x013d,
+	0x019e, 0x020a, 0x01fd, 0x01e6, 0x0069, 0xfeb5, 0xfe46, 0xfdfe,
+	0xfe6d, 0xfeec, 0xfdf3, 0xfe25, 0xfe70, 0xfe66, 0xffa2, 0xffce,
+	0xfffd, 0x0051, 0xff60, 0xffd1, 0x00a6, 0x0047, 0x0053, 0xff95,
+	0xff35, 0x0027, 0xffb2, 0xffe7, 0x008d, 0x004a, 0x00bd, 0x0070,
+	0x0027, 0x0130, 0x0195, 0x0159, 0x0122, 0x009a, 0x0070, 0x00f5,
+	0x00dd, 0x00c1, 0x0088, 0xff38, 0xff3b, 0xffca, 0xffcb, 0xffdc,
+	0xfec5, 0xfe3b, 0xfea2, 0xff1b, 0xffb6, 0xffed, 0xffcc, 0xffab,
+	0xff74, 0xffaa, 0x0086, 0x00a9, 0x0034, 0xffdf, 0xffa2, 0x0004,
+	0x0010, 0xffea, 0x003b, 0x0074, 0x000e, 0xffd7, 0xfff7, 0x0098,
+	0x0175, 0x014d, 0x00e6, 0x00f9, 0x00da, 0x00c3, 0x006d, 0x002f,
+	0x003d, 0x0000, 0xff6b, 0xff4a, 0xff4a, 0xff50, 0xff44, 0xfebb,
+	0xfe9f, 0xfeeb, 0xff29, 0xff81, 0xff8b, 0xffa6, 0x003e, 0x0073,
+	0x0074, 0x007f, 0x0028, 0x0032, 0x0047, 0x0001, 0x0022, 0x0027,
+	0x0029, 0x0056, 0x0013, 0x0022, 0x005c, 0x0096, 0x00e7, 0x0109,
+	0x0116, 0x00ef, 0x00bd, 0x0084, 0x0055, 0x004c, 0xffa2, 0xfeac,
+	0xfdd2, 0xfda6, 0xfe2e, 0xfeb9, 0xfed2, 0xfeef, 0xff19, 0xff5d,
+	0xffa9, 0xffe9, 0x0047, 0x0096, 0x006f, 0x003d, 0x005e, 0x007a,
+	0x00af, 0x005c, 0xfff8, 0x001a, 0x003d, 0x0081, 0x0097, 0x0053,
+	0x0071, 0x007f, 0x0037, 0x0078, 0x0097, 0x0091, 0x0050, 0xff5f,
+	0xff35, 0xffa7, 0xffd4, 0xfff7, 0xff81, 0xff30, 0xff7e, 0xff88,
+	0xffd5, 0x0030, 0x001f, 0x000c, 0xffb8, 0xffbd, 0x002d, 0x0068,
+	0x007c, 0x002f, 0xffb8, 0xffa3, 0xffa1, 0xffdd, 0x0027, 0x0043,
+	0x0023, 0x0002, 0x0016, 0x0084, 0x00c9, 0x00ba, 0x006f, 0x0022,
+	0x002f, 0x004d, 0x0071, 0x0066, 0xfffa, 0xffb9, 0xff89, 0xff9d,
+	0xffdf, 0xffd1, 0x0009, 0x0002, 0xffb3, 0xff7f, 0xff78, 0xffc8,
+	0x0002, 0xffd6, 0xff7d, 0xff5c, 0xffa7, 0x0000, 0x0021, 0x003a,
+	0x0033, 0x0022, 0x001c, 0x002f, 0x0079, 0x0092, 0x001f, 0xffac,
+	0xff99, 0xffde, 0x004f, 0x0035, 0xffce, 0xffd0, 0x0024, 0x0091,
+	0x00f8, 0x011e, 0x00e7, 0x007a, 0x0015, 0x0030, 0x0064, 0x0080,
+	0xffe5, 0xfeca, 0xfe2d, 0xfe2d, 0xfe99, 0xff08, 0xff2c, 0xff4c,
+	0xff5d, 0xff7a, 0xffd2, 0x0063, 0x009d, 0x0077, 0xfff1, 0xffa0,
+	0xffd1, 0xfff5, 0xfff0, 0xffc9, 0xffbf, 0xffcc, 0xffd8, 0xffe8,
+	0x0017, 0x0074, 0x009c, 0x00a4, 0x00aa, 0x00c0, 0x00e3, 0x00cd,
+	0x009e, 0x0034, 0x0014, 0xfff1, 0x0000, 0x003d, 0x000a, 0xfff4,
+	0xfffb, 0xffd8, 0xffd1, 0xffed, 0xffdd, 0xffde, 0xffd2, 0xff9f,
+	0xffb9, 0xffc2, 0xff9c, 0xff97, 0xff6d, 0xff80, 0xffb8, 0xffcb,
+	0xfff3, 0x004d, 0x0088, 0x00a4, 0x0062, 0x005a, 0x00a6, 0x00c4,
+	0x00a9, 0x0040, 0x0013, 0x0031, 0x0032, 0xffeb, 0xff9e, 0xffb3,
+	0xffbd, 0xff8a, 0xff95, 0xffd4, 0x0024, 0xffff, 0xffcf, 0xffdc,
+	0x0007, 0x0033, 0xfff2, 0xffcd, 0xffb7, 0xffad, 0xffb6, 0xffc9,
+	0x0007, 0xfff8, 0xffe7, 0xffce, 0xffb0, 0xfff0, 0x0038, 0x003c,
+	0x0021, 0xffe0, 0xffc6, 0x0002, 0x0043, 0x0052, 0x0035, 0x001e,
+	0x002d, 0x003a, 0x0090, 0x00ea, 0x0117, 0x00cc, 0x0029, 0x000a,
+	0x004e, 0x00b6, 0x0062, 0xff2e, 0xfe57, 0xfe4f, 0xfeac, 0xfed9,
+	0xfebd, 0xfeae, 0xfec1, 0xfec0, 0xff12, 0xff8b, 0xfffb, 0x0034,
+	0x0017, 0x000b, 0x0069, 0x00e4, 0x0105, 0x00fa, 0x00f7, 0x00bd,
+	0x00b0, 0x0078, 0x007b, 0x00aa, 0x00a4, 0x0035, 0xffdc, 0xffb7,
+	0xfff5, 0x004f, 0xfff9, 0xff9f, 0xff31, 0xff5f, 0x000b, 0x0012,
+	0xffc2, 0xff7d, 0xff40, 0xff85, 0x0006, 0x0035, 0x002b, 0xffbb,
+	0xff84, 0xffc7, 0x001e, 0x009b, 0x00b2, 0x0046, 0x0036, 0x005d,
+	0x0073, 0x00be, 0x008d, 0x0071, 0x007c, 0x000f, 0x0011, 0xfff0,
+	0xffd2, 0xfff6, 0xfff1, 0xffd1, 0xffab, 0xffce, 0xffad, 0x0008,
+	0x0060, 0x0011, 0x001e, 0x0005, 0x002a, 0x0067, 0x0039, 0x0021,
+	0xffe2, 0xff46, 0xff00, 0xff29, 0xff4a, 0xff35, 0xfef1, 0xfedc,
+	0xff71, 0xfffe, 0x0019, 0x000c, 0x0001, 0x009a, 0x0174, 0x0153,
+	0x0102, 0x0106, 0x00ca, 0x0089, 0x0062, 0x000c, 0xffa8, 0xff4b,
+	0xff62, 0xffb8, 0xffc3, 0x0018, 0x007b, 0x0068, 0x00e7, 0x0141,
+	0x00c4, 0x00f0, 0x0110, 0x00b2, 0x006f, 0xff32, 0xfe4a, 0xfe47,
+	0xfdd7, 0xfdc1, 0xfddb, 0xfdd1, 0xfe7a, 0xfe9d, 0xfec8, 0xffb8,
+	0x0070, 0x013b, 0x00b5, 0x0018, 0x00dc, 0x00fd, 0x007e, 0x005c,
+	0xffe7, 0xffa7, 0xffc8, 0xff85, 0xffe1, 0x0066, 0x0000, 0x0006,
+	0x009c, 0x0164, 0x01ef, 0x013f, 0x003a, 0x0070, 0x00d7, 0x00a2,
+	0xffb0, 0xfec7, 0xff6e, 0xff85, 0xff27, 0xff83, 0xff88, 0xffd5,
+	0x0066, 0x0082, 0x00ba, 0x00b6, 0x0087, 0x00e5, 0x00f5, 0x0021,
+	0xffd1, 0xff3a, 0xff47, 0xffea, 0xfe45, 0xfe18, 0x0053, 0xffd6,
+	0xfecd, 0xfe17, 0xfe6b, 0x0447, 0x02b2, 0xfc3f, 0xff75, 0x009a,
+	0x016b, 0x01df, 0xfcf7, 0xff7a, 0x0256, 0x0013, 0xff7f, 0xff57,
+	0x0158, 0x02e0, 0xfe83, 0xfec5, 0x03d1, 0x02d1, 0x0071, 0xfdf2,
+	0x0004, 0x04ab, 0x0034, 0xfbe7, 0xfe33, 0x001e, 0x0070, 0xfef9,
+	0xfc91, 0xfefa, 0x013c, 0xfe7d, 0xfd47, 0xff2a, 0x0110, 0x0075,
+	0xff4d, 0x00a2, 0x0356, 0x023b, 0xff39, 0x016b, 0x028f, 0x00f9,
+	0xffde, 0xfeda, 0xff7a, 0xff0f, 0xfcd1, 0xfd09, 0xfebc, 0xfdd4,
+	0xfbf0, 0xfcb6, 0x0025, 0x035b, 0x01b7, 0xfe67, 0x02fe, 0x08e1,
+	0x0455, 0x00a6, 0x0149, 0x023d, 0x03c3, 0xfd5a, 0xfb1d, 0x001e,
+	0xfef5, 0xfca1, 0xfaab, 0xfbce, 0x01f7, 0xfff8, 0xfb52, 0xffd6,
+	0x02c6, 0x0221, 0x0078, 0xfcff, 0x014e, 0x03fd, 0xfe41, 0xfe54,
+	0x0017, 0x005d, 0x01f0, 0xfee5, 0xff2d, 0x0396, 0x018d, 0x0064,
+	0x0109, 0x0002, 0x0260, 0x0068, 0xfcad, 0xff59, 0xff29, 0xfe15,
+	0xfd8d, 0xfb31, 0xfe26, 0xffb3, 0xfdda, 0xfff3, 0x012c, 0x01df,
+	0x0381, 0x0282, 0x0435, 0x05ec, 0x04ec, 0x061e, 0x049a, 0x03d2,
+	0x03fb, 0x00a4, 0xffc0, 0xfe78, 0xfb49, 0xfad2, 0xf9fd, 0xf886,
+	0xf8af, 0xf840, 0xf93c, 0xfbf1, 0xfb67, 0xfccf, 0x0122, 0x02f0,
+	0x0393, 0x0363, 0x0409, 0x0628, 0x0566, 0x0245, 0x00d1, 0x006a,
+	0x00ee, 0xff82, 0xfb99, 0xfc4e, 0xff75, 0x0053, 0xfffb, 0xff79,
+	0x0178, 0x04f8, 0x048b, 0x0120, 0x00b0, 0x028f, 0x0365, 0x001c,
+	0xfaf8, 0xfcae, 0x00e9, 0xff45, 0xfb2d, 0xfce3, 0x04ff, 0x0b01,
+	0x0911, 0x04e7, 0x07b1, 0x0c5a, 0x08fc, 0x00c7, 0xfb1e, 0xfb2d,
+	0xf9bd, 0xf002, 0xe7f8, 0xe852, 0xec25, 0xed54, 0xeb2b, 0xeeec,
+	0xfa2b, 0x04b7, 0x08ce, 0x0ab1, 0x1220, 0x19fd, 0x1b2a, 0x1598,
+	0x1071, 0x10fa, 0x0e53, 0x0438, 0xfb6b, 0xf80c, 0xf7ac, 0xf6d1,
+	0xf381, 0xf3af, 0xf8be, 0xfc09, 0xfe4d, 0x002b, 0x02bd, 0x0417,
+	0x03ca, 0x03c5, 0x00fa, 0xfcea, 0xfab9, 0xfaac, 0xfa1d, 0xf546,
+	0xf33f, 0xffb3, 0x087c, 0x0779, 0x0a46, 0x09af, 0x11b6, 0x1890,
+	0x0a9e, 0x0385, 0x04d8, 0xfe3d, 0xf6a1, 0xe96d, 0xdf3c, 0xe668,
+	0xe5b1, 0xdff9, 0xe71f, 0xf0f9, 0x0047, 0x0bab, 0x0dc7, 0x18b1,
+	0x258f, 0x264a, 0x21a2, 0x19fc, 0x1631, 0x141d, 0x02e5, 0xf409,
+	0xef84, 0xead4, 0xec52, 0xea38, 0xe6ea, 0xf2b5, 0xfbc0, 0xff59,
+	0x0783, 0x07a0, 0x0a77, 0x1098, 0x0942, 0x01bd, 0xfde0, 0xf780,
+	0xf577, 0xf127, 0xe700, 0xf025, 0x0142, 0x04f1, 0x0b15, 0x0cbd,
+	0x1491, 0x2578, 0x1e83, 0x105f, 0x0da6, 0x0704, 0xfe1b, 0xed09,
+	0xd717, 0xd5f2, 0xd8c4, 0xd294, 0xd3f5, 0xde4f, 0xf25a, 0x0651,
+	0x0e03, 0x1a07, 0x2c41, 0x3324, 0x31de, 0x2943, 0x2078, 0x1ed9,
+	0x0d2c, 0xf6f6, 0xee70, 0xe604, 0xe6a2, 0xe671, 0xe03b, 0xeb6c,
+	0xf918, 0xff3c, 0x06fb, 0x083b, 0x0dad, 0x138d, 0x08c2, 0x00e7,
+	0xfa8d, 0xf5cc, 0xf4a4, 0xe32a, 0xe1e2, 0xf3dd, 0xf7f8, 0x04f9,
+	0x0b9d, 0x0d06, 0x259e, 0x2762, 0x1b84, 0x1ed0, 0x1293, 0x0904,
+	0xff90, 0xe341, 0xdc7c, 0xd83c, 0xca57, 0xd098, 0xd4e6, 0xddfe,
+	0xf566, 0x01b5, 0x1055, 0x25b4, 0x2d9a, 0x3248, 0x3302, 0x29a1,
+	0x2568, 0x1a0a, 0x0403, 0xf92e, 0xef5b, 0xe368, 0xe3b9, 0xe3b3,
+	0xe62f, 0xf27a, 0xf8f6, 0x004a, 0x0b30, 0x0d25, 0x0f65, 0x0f05,
+	0x04e0, 0x0101, 0xf779, 0xecf0, 0xee3f, 0xe280, 0xdffd, 0xee54,
+	0xf3fe, 0x029e, 0x0f6d, 0x11e2, 0x242e, 0x2ac0, 0x21ab, 0x2395,
+	0x17df, 0x09d8, 0x017b, 0xebf0, 0xde3d, 0xd745, 0xcd07, 0xce2d,
+	0xd494, 0xdbc9, 0xedcd, 0xfcfa, 0x0d1e, 0x1ef4, 0x273b, 0x2f55,
+	0x3090, 0x2cb1, 0x2548, 0x1774, 0x0dc1, 0xffbc, 0xf121, 0xeabd,
+	0xe55f, 0xe677, 0xeaa1, 0xedfd, 0xf718, 0x0012, 0x0545, 0x09d2,
+	0x0c4d, 0x0b3c, 0x05fb, 0xfe31, 0xf80b, 0xf2bb, 0xed51, 0xe4a1,
+	0xe254, 0xef61, 0xf33c, 0xfac3, 0x0be1, 0x110c, 0x1e09, 0x2592,
+	0x1f9c, 0x2396, 0x1db0, 0x0d02, 0x04aa, 0xf5f4, 0xe7e3, 0xdf47,
+	0xd2aa, 0xd22d, 0xd6ce, 0xdaad, 0xe718, 0xf564, 0x04bd, 0x1483,
+	0x1e54, 0x26c9, 0x2cb6, 0x29c6, 0x26ce, 0x1d36, 0x1075, 0x0ad2,
+	0xfb08, 0xee2a, 0xee63, 0xe9ad, 0xe92e, 0xef5b, 0xf173, 0xfa99,
+	0x02f3, 0x03e8, 0x09bd, 0x0aa6, 0x082c, 0x0430, 0xfb75, 0xf8cc,
+	0xf442, 0xeb3d, 0xe7c9, 0xe811, 0xf19e, 0xf720, 0xf6d2, 0x0ac3,
+	0x139f, 0x1438, 0x20e8, 0x1bb0, 0x1c93, 0x1c46, 0x094b, 0x050b,
+	0xfc1f, 0xeae4, 0xe751, 0xdc81, 0xd801, 0xe15e, 0xdf0d, 0xe8d8,
+	0xf7e8, 0xff08, 0x0f28, 0x1595, 0x1d1c, 0x25db, 0x2134, 0x2034,
+	0x1bab, 0x127b, 0x0b5a, 0xff17, 0xf7f4, 0xf5a4, 0xee89, 0xefae,
+	0xf194, 0xf0c2, 0xf9e7, 0xfcd4, 0xff75, 0x0439, 0x036f, 0x0553,
+	0x0270, 0xfcb1, 0xfa8a, 0xf7b8, 0xf2ee, 0xeff6, 0xee3f, 0xf22e,
+	0xf9b1, 0xf9fa, 0xfff7, 0x08f0, 0x0f22, 0x147c, 0x126e, 0x12fb,
+	0x14ac, 0x0f4b, 0x0635, 0xffb9, 0xf91d, 0xf29f, 0xec1b, 0xe6b6,
+	0xe8ef, 0xe9bf, 0xedc1, 0xf35d, 0xfac3, 0x0413, 0x0a01, 0x1166,
+	0x161d, 0x17f7, 0x170e, 0x1948, 0x1426, 0x09ba, 0x0870, 0x0305,
+	0xfb97, 0xf8c7, 0xf4b6, 0xf2bd, 0xf6a7, 0xf580, 0xf669, 0xfb18,
+	0xfcd5, 0x0006, 0xff93, 0x003c, 0x0207, 0xff55, 0xfc2a, 0xfb8e,
+	0xfa46, 0xf8cf, 0xf7f7, 0xf8ad, 0xfb6f, 0xfc2b, 0xffa8, 0x0598,
+	0x059d, 0x06bb, 0x0ca7, 0x0c4c, 0x0994, 0x0809, 0x06ab, 0x03b0,
+	0xfd47, 0xfa9b, 0xf810, 0xf45e, 0xf490, 0xf300, 0xf2ff, 0xfa8a,
+	0xf980, 0xfc27, 0x053b, 0x04b2, 0x0ac2, 0x0d17, 0x0c3e, 0x0f86,
+	0x0dc5, 0x0a2a, 0x07cd, 0x076f, 0x037a, 0xfd99, 0xfb7f, 0xfd5d,
+	0xf94b, 0xf6f2, 0xf935, 0xf93d, 0xfb8b, 0xfa4a, 0xfbb3, 0xffe2,
+	0xfc86, 0xfe7a, 0x0149, 0xfbf6, 0xff4e, 0xfd7c, 0xfd47, 0x00fc,
+	0xfa2a, 0xfe30, 0xffdd, 0xff5f, 0x00a6, 0xff73, 0x0124, 0x05a6,
+	0x067c, 0xfc28, 0x01f8, 0x0796, 0xffb2, 0xfccf, 0xff61, 0xfe85,
+	0xfe33, 0xfd36, 0xf8c1, 0x015d, 0xff11, 0xfd13, 0x0284, 0x0038,
+	0x0689, 0x04c0, 0x02a7, 0x07c2, 0x04bc, 0x05cd, 0x072d, 0x00b3,
+	0x037e, 0x056e, 0xfe02, 0x0035, 0xfff9, 0xfbb8, 0xfe78, 0xff42,
+	0xf92c, 0xfc9c, 0xfe74, 0xfa02, 0xff32, 0xf7f4, 0xfc66, 0x0179,
+	0xf6bd, 0xfed3, 0xff8b, 0xfab1, 0x00dd, 0xfea3, 0xff72, 0x03fb,
+	0xfb58, 0x0417, 0x08f6, 0xfab7, 0x0488, 0x04b6, 0x0073, 0x04b2,
+	0xfd1d, 0x0074, 0x0462, 0xfda8, 0xfd4b, 0x0075, 0xff03, 0x0311,
+	0xfd12, 0xfd20, 0x07c7, 0x010e, 0x001f, 0x01b2, 0x03d5, 0x061a,
+	0x01bd, 0xff00, 0x0423, 0x0577, 0xfc91, 0x010d, 0xff6f, 0x0081,
+	0xff1c, 0xf889, 0x026b, 0xfbb7, 0xfee6, 0xfd3d, 0xf7ed, 0x0232,
+	0xfd56, 0xfc7d, 0xfb4d, 0xfea8, 0x0088, 0xfe3f, 0xfd5e, 0xfe8e,
+	0x00cf, 0x01e2, 0x0067, 0xfbca, 0x06ef, 0x00e1, 0xffe5, 0x0521,
+	0xfbc1, 0x0724, 0x054d, 0xfaa2, 0x0188, 0x03e1, 0x0308, 0xfd73,
+	0xfa3d, 0x0573, 0x01e3, 0xfbd9, 0xfdad, 0xfd99, 0x035a, 0xff87,
+	0xfae6, 0xfeaa, 0x01de, 0x0350, 0xfef5, 0xfcda, 0x0720, 0x0195,
+	0x00e3, 0x03a7, 0xfc49, 0x0a2f, 0xfb56, 0xfc5e, 0x095c, 0xf6de,
+	0x001e, 0xfe41, 0xfa5d, 0x0240, 0xfa16, 0xfa3f, 0x034c, 0xfcc0,
+	0xfc93, 0x0232, 0xfb59, 0x06cc, 0xfe4d, 0xf9ca, 0x07e6, 0xfeb6,
+	0x033f, 0xfece, 0xfcef, 0x0745, 0x00e2, 0xfffd, 0xff54, 0x0386,
+	0x03ca, 0xffa8, 0xff7c, 0x00cd, 0x04bb, 0xff55, 0xfe71, 0xfc7d,
+	0x02c5, 0x0257, 0xf9b8, 0x0058, 0xfc4e, 0x06a2, 0x002f, 0xf6bc,
+	0x0869, 0xfdfb, 0x0246, 0x04a1, 0xf8c9, 0x010c, 0x0716, 0xfedf,
+	0xf904, 0x028f, 0xfd7c, 0x03e2, 0xfe38, 0xf4f3, 0x0541, 0x01c8,
+	0xfebf, 0xf8aa, 0x0068, 0x04da, 0xfc4f, 0x028d, 0xf94c, 0x006b,
+	0x09b6, 0xf86d, 0xfe2d, 0x07f1, 0xfee4, 0xffc5, 0x00e6, 0x00cf,
+	0x09a5, 0xfe7e, 0xf925, 0x095e, 0x0324, 0xfc81, 0x0080, 0x00a2,
+	0xff2a, 0x0151, 0xfe69, 0xf9e9, 0x053b, 0xfb6a, 0xfca1, 0x0151,
+	0xf8b1, 0x07aa, 0xf83b, 0xfc3c, 0x04e3, 0xfccc, 0x0788, 0xf673,
+	0x006f, 0x088e, 0xffb0, 0xffa4, 0xff0f, 0x00c9, 0x0474, 0x07e1,
+	0xf013, 0x0367, 0x0865, 0xf9fd, 0x00e0, 0xf3f9, 0x054d, 0x0540,
+	0xfc99, 0xf5e9, 0x01d8, 0x0d84, 0xf60d, 0x0460, 0xfeb8, 0xfefb,
+	0x0c49, 0xfb24, 0xfd15, 0x0343, 0x01e8, 0x0273, 0xfe5f, 0xf807,
+	0x0717, 0x01d3, 0xf93a, 0x059f, 0xf5df, 0x085d, 0x0677, 0xf01c,
+	0x0984, 0xfc79, 0x02f3, 0x058d, 0xedf3, 0x084a, 0x0a07, 0xf2d5,
+	0xff1a, 0x044d, 0xfd52, 0x0c57, 0xf128, 0xfb93, 0x17a4, 0xf4c4,
+	0x01f2, 0xfdf9, 0xfcbf, 0x1223, 0xf67d, 0xf550, 0x0898, 0x03a8,
+	0xfc3c, 0xf94b, 0xfdc1, 0x0825, 0xff23, 0xf590, 0xffb8, 0x0748,
+	0x0289, 0xf8f9, 0xfab9, 0x08e3, 0x02f7, 0xfeea, 0xfef0, 0xf911,
+	0x0d00, 0x02d9, 0xf82d, 0x022b, 0xfb2c, 0x09be, 0x0469, 0xf0ac,
+	0x015a, 0x071e, 0xfe57, 0x019c, 0xf522, 0xff86, 0x0f55, 0xf95a,
+	0xfb4f, 0xfdb1, 0x052a, 0x0cbb, 0xf8ee, 0xf3ef, 0x07e1, 0x0afa,
+	0xfa7d, 0xfb10, 0xf7ef, 0x0b10, 0x0434, 0xf221, 0xff33, 0xfedc,
+	0x0a58, 0xfc49, 0xf4aa, 0x01f0, 0x0606, 0x0675, 0xf3a5, 0xf97c,
+	0x0b5c, 0x0365, 0xfa3c, 0xfbf9, 0xffb1, 0x0778, 0x029c, 0xf924,
+	0xfc24, 0x0b95, 0x03b2, 0xf7e6, 0x04e0, 0xfbbb, 0x0c4a, 0xfbd2,
+	0xf57a, 0x0d09, 0xf70d, 0x0826, 0xf9ed, 0xf850, 0x0d7a, 0xf77d,
+	0xfe3b, 0x0709, 0xfa0f, 0xfcf0, 0x0be0, 0xf718, 0x01d4, 0x09c4,
+	0xee0f, 0x0bb1, 0x0634, 0xf21b, 0x06a2, 0xffa4, 0xfd17, 0x0464,
+	0xfece, 0xfb90, 0x031d, 0x084e, 0xf576, 0xff84, 0x0baf, 0xf4de,
+	0x04d2, 0x01ea, 0xf487, 0x092f, 0x036a, 0xf370, 0x054b, 0x0427,
+	0xf60c, 0x0c86, 0xf7f7, 0xff2a, 0x0b0f, 0xf74d, 0x0403, 0xffba,
+	0x0310, 0xfaf9, 0x022d, 0xfe31, 0xfdfb, 0x05f9, 0xf780, 0xff06,
+	0x0118, 0x0a81, 0xefbb, 0x056b, 0x0bb1, 0xed1e, 0x1516, 0xf683,
+	0xf712, 0x15cd, 0xf2bb, 0xfd4d, 0x0838, 0xf9dd, 0x0094, 0x040f,
+	0xfbaa, 0xf931, 0x0e09, 0xffe5, 0xf06c, 0x12dd, 0xf9aa, 0xfbdb,
+	0x0eb6, 0xf0f3, 0x02dc, 0x072b, 0xf9ba, 0xfa4b, 0x0100, 0x0105,
+	0xfdd1, 0xfc7a, 0xfb63, 0x0364, 0x017b, 0x001e, 0xfb3f, 0xffd0,
+	0x0aac, 0xfc24, 0xfd9a, 0x0451, 0xfcc7, 0x068a, 0xfdd4, 0xfb9d,
+	0x017f, 0x03bb, 0xfe79, 0xf9b1, 0x075c, 0xf97a, 0x05fa, 0x0089,
+	0xf831, 0x0a79, 0xf98e, 0x069e, 0xfe1b, 0xfa44, 0x08a4, 0xfe87,
+	0xfe06, 0xfe19, 0x0622, 0xf8ac, 0x054c, 0x03e0, 0xf1cf, 0x0f7b,
+	0xfc28, 0xf7a1, 0x0d3f, 0xf608, 0x026e, 0x057e, 0xf49f, 0x0340,
+	0x0507, 0xf95c, 0xfe60, 0x05f0, 0xf732, 0x05e0, 0x028e, 0xf570,
+	0x0cc4, 0xfb01, 0xfd9d, 0x0954, 0xf790, 0x02e9, 0x06d3, 0xf67b,
+	0x028b, 0x05b9, 0xf66a, 0x062f, 0xffa0, 0xf9f2, 0x05ad, 0xfdd2,
+	0xff65, 0xff6c, 0x01cc, 0xfe8f, 0xffa8, 0x044c, 0xf9e6, 0x02b6,
+	0x02b1, 0xfc57, 0x024b, 0xffd9, 0x005d, 0xff82, 0x01bd, 0xff17,
+	0xfef2, 0x03f5, 0xfbb5, 0x00bb, 0x0172, 0xfd56, 0x0218, 0xfeef,
+	0x0016, 0xfed7, 0x01c2, 0x010c, 0xfe24, 0x026c, 0xff35, 0x016e,
+	0xffd0, 0xff0b, 0x016a, 0xff0a, 0xff78, 0xfee5, 0xfd9e, 0xffa9,
+	0xff22, 0xfdcb, 0xffb2, 0xffa5, 0x0002, 0xffda, 0xff36, 0xffe0,
+	0x010f, 0x008a, 0xfe72, 0x0117, 0x00c3, 0xfe4f, 0x0218, 0xffea,
+	0xfee5, 0x0108, 0x005e, 0x00e7, 0xff5e, 0x00ff, 0x021d, 0xfe33,
+	0x0155, 0x013c, 0xfe35, 0x0204, 0xffbc, 0xfe6a, 0x00ff, 0xff3d,
+	0xff88, 0x010a, 0xfe6e, 0x0034, 0x01a5, 0xfe95, 0x002c, 0x0149,
+	0xfe89, 0x0044, 0x0039, 0xfeec, 0xffe7, 0xff08, 0xff7e, 0xff35,
+	0xffc5, 0xff9c, 0xffd8, 0xfff3, 0x0008, 0x0156, 0xffe9, 0x0153,
+	0x00e1, 0x0072, 0x0147, 0xffb2, 0x011f, 0xffea, 0xff8f, 0x0081,
+	0xff55, 0x002f, 0xfeff, 0xfff0, 0x0030, 0xff79, 0x0037, 0xff38,
+	0x00be, 0xffdf, 0xff75, 0x0061, 0xffd9, 0x00a3, 0xff89, 0xfeec,
+	0x0084, 0x004f, 0xff70, 0x004f, 0x003b, 0xffa2, 0x00bd, 0x003b,
+	0xff84, 0x013d, 0xff44, 0xffcb, 0x0076, 0xfe86, 0x0044, 0xff83,
+	0xff4b, 0xffeb, 0xffe6, 0x0059, 0x0018, 0x00b3, 0x0051, 0x00bd,
+	0x01c2, 0x008a, 0x00ca, 0x0143, 0x0019, 0x004b, 0xffb6, 0xfe8b,
+	0xff32, 0xfe88, 0xfe23, 0xfe50, 0xfe9d, 0xff52, 0xfe5d, 0xff0c,
+	0xffd7, 0xff90, 0x0057, 0xffbb, 0x00b8, 0x012b, 0x004a, 0x0141,
+	0x0010, 0x00c8, 0x0069, 0x000c, 0x00ff, 0xffa9, 0xffe0, 0x0024,
+	0x0050, 0xffa4, 0xffd3, 0x00c5, 0xff64, 0xffd4, 0x0046, 0xffd0,
+	0x0042, 0x000c, 0xffff, 0xff86, 0x0062, 0x0014, 0xff8e, 0x0137,
+	0xffa6, 0x004a, 0x007c, 0xff98, 0x0120, 0xffe7, 0xff8b, 0x0002,
+	0x0052, 0xffd4, 0xfecd, 0x0027, 0xff4c, 0xffad, 0x003c, 0xfed2,
+	0x0082, 0x0028, 0xffee, 0x00ab, 0x007b, 0x00de, 0x005a, 0x005d,
+	0x00ca, 0x0099, 0xff9c, 0x009a, 0x0003, 0xff5e, 0x006a, 0xff27,
+	0xff79, 0xffd3, 0xff68, 0xffd6, 0xff5f, 0xffc3, 0xff9c, 0xffb6,
+	0x004d, 0xff25, 0x0074, 0x0080, 0xff5c, 0x0062, 0xffaf, 0x002c,
+	0x00f5, 0xff9f, 0xffaf, 0x006b, 0xffd5, 0xffe5, 0xffd2, 0xffb9,
+	0x0004, 0xff5a, 0x0032, 0x0019, 0x0028, 0x0089, 0x002e, 0x0102,
+	0x00a6, 0x00ce, 0x0116, 0x00f2, 0x00b1, 0x0073, 0xffec, 0xff92,
+	0xffe1, 0xfe54, 0xfe6d, 0xfe6f, 0xfe3d, 0xff02, 0xfe1a, 0xff45,
+	0x0007, 0xff01, 0x0031, 0x002e, 0x004d, 0x00cb, 0x001c, 0x00e1,
+	0x004d, 0xfffb, 0x0029, 0xffe0, 0x004c, 0xff82, 0x0028, 0x0069,
+	0xff15, 0x0069, 0x0054, 0x001a, 0x008f, 0xffe2, 0x003d, 0x0012,
+	0x0074, 0x0022, 0xff4e, 0x008b, 0x0037, 0xffd8, 0x0039, 0x0036,
+	0x0167, 0x007c, 0x0021, 0x00d5, 0x001d, 0x0087, 0x0014, 0xff35,
+	0xff83, 0xffc0, 0xfef7, 0xfea9, 0xfed9, 0xffc7, 0xffc8, 0xff17,
+	0x00a1, 0x00ae, 0x00c6, 0x0162, 0x0137, 0x00d5, 0x0106, 0x00fc,
+	0xffaf, 0x0015, 0x0048, 0xfece, 0xfeef, 0xffb1, 0xfec8, 0xfe95,
+	0xffbb, 0xffd1, 0xff42, 0x0035, 0x0054, 0xffed, 0x008a, 0x004d,
+	0x007d, 0xfff9, 0x0018, 0x003b, 0xff6b, 0x0040, 0x0025, 0xfff5,
+	0x0082, 0x004c, 0x0078, 0x00b2, 0x0030, 0x0018, 0x0045, 0x0059,
+	0xffbf, 0xfff8, 0xffda, 0xff23, 0x0015, 0xffd3, 0xffee, 0xff94,
+	0xffc7, 0x00ec, 0x00a4, 0x0012, 0x0055, 0x010b, 0x0059, 0x0021,
+	0xffb9, 0x00d6, 0xff8e, 0xfec4, 0xffdb, 0xfdcc, 0xfeba, 0xffa3,
+	0xfe24, 0xfec9, 0xfed5, 0xfebb, 0xfed3, 0xfe89, 0xff47, 0xff9f,
+	0x0059, 0x000d, 0x0090, 0x01db, 0x0101, 0x01a5, 0x02be, 0x01d5,
+	0x00ee, 0x01bd, 0x0166, 0xff71, 0x0026, 0x002d, 0xfe80, 0xfe59,
+	0xffe7, 0xfee9, 0xfdf1, 0xfff7, 0x009f, 0xff68, 0xff3e, 0x0143,
+	0x013a, 0xffb5, 0xff83, 0x0039, 0xffab, 0xfeec, 0xff3c, 0xff56,
+	0xff6e, 0xffc7, 0x0048, 0xff62, 0x00a9, 0x018d, 0x01cc, 0x00c9,
+	0xfe74, 0x0304, 0x0508, 0xf99b, 0xfc10, 0x07f7, 0xf80d, 0xfcc4,
+	0x065d, 0xfa62, 0x0163, 0x01f7, 0x00b0, 0x044d, 0x0199, 0x0014,
+	0x0b4a, 0xff57, 0xf95a, 0x0d8e, 0xf78e, 0xfa2d, 0x0609, 0xf918,
+	0xfc2f, 0xfbf8, 0xff5d, 0xfca9, 0xfcad, 0x0109, 0x0005, 0xffe4,
+	0x018d, 0x0333, 0xffc2, 0x01a6, 0x002d, 0x0038, 0x014c, 0xfc6e,
+	0x01b8, 0x001c, 0xfc88, 0x0203, 0xfda6, 0x0202, 0x00b0, 0xff22,
+	0x03bf, 0xff0e, 0x02c6, 0x00b7, 0x022e, 0xffd5, 0xfffb, 0x039f,
+	0xfe84, 0x0059, 0x0044, 0x02e6, 0xfd32, 0xff30, 0x0191, 0xfd0e,
+	0x017d, 0xfc9a, 0x019e, 0xfe09, 0xfdd5, 0x040a, 0xf84e, 0x029f,
+	0x0300, 0xf7f9, 0x026d, 0x0008, 0xfaed, 0x02ff, 0xfb38, 0xfc81,
+	0x0524, 0xf8a7, 0xff8f, 0x0285, 0xfb74, 0x0538, 0xfe5a, 0x0070,
+	0x0646, 0xfd0c, 0x04d7, 0x02ba, 0xfcc1, 0x057d, 0xfe70, 0xfe89,
+	0x0332, 0xfc21, 0x02cf, 0xff7e, 0xfebc, 0x0727, 0xff01, 0x02af,
+	0x06b5, 0xffae, 0x0679, 0x0292, 0xfd9f, 0x0537, 0xfcc0, 0xfcbc,
+	0xff96, 0xf9e8, 0xfc0b, 0xfa5c, 0xfd06, 0xfd05, 0xf9e5, 0x012f,
+	0xfe78, 0xfd37, 0x01e4, 0xff17, 0x0132, 0x0106, 0xfdce, 0x023a,
+	0xffe2, 0xfd3d, 0x0252, 0x0031, 0xfd9b, 0x0210, 0x035a, 0xfee9,
+	0xff66, 0x05e8, 0xff55, 0xfcaf, 0x06ba, 0xfdb9, 0xfc54, 0x0639,
+	0xfef9, 0xfe1d, 0x063c, 0x02d4, 0x002d, 0x0655, 0x06c0, 0x0017,
+	0x0381, 0x06ab, 0xfc4b, 0xfe87, 0x023d, 0xf78a, 0xfa72, 0xfed4,
+	0xf651, 0xfa5b, 0xfea2, 0xfbac, 0xff11, 0x002b, 0x01a6, 0x037d,
+	0x00db, 0x02a6, 0x034a, 0xfe59, 0xfe73, 0xff52, 0xfa90, 0xfa27,
+	0xfc0d, 0xf9ae, 0xfa53, 0xfe20, 0xff00, 0xfe62, 0x016f, 0x0450,
+	0x03e1, 0x049c, 0x051f, 0x0543, 0x05e1, 0x0451, 0x0548, 0x04f8,
+	0x02d3, 0x04cb, 0x041b, 0x013e, 0x02ee, 0x0210, 0xfe80, 0xfe76,
+	0xfdd4, 0xf9a5, 0xfa23, 0xfdc6, 0xf64b, 0xf96f, 0x03c6, 0xf9cb,
+	0xffcf, 0x0cd7, 0xffd0, 0x05fe, 0x0fc1, 0x0027, 0x030d, 0x05b4,
+	0xf800, 0xf662, 0xf412, 0xed5e, 0xe9f4, 0xeb1a, 0xec99, 0xecc6,
+	0xf34d, 0xfbf2, 0x0026, 0x078c, 0x137b, 0x1462, 0x1856, 0x2055,
+	0x1a60, 0x189c, 0x194e, 0x0f6a, 0x098a, 0x05d5, 0xfd29, 0xf76b,
+	0xf456, 0xf129, 0xef4f, 0xeecc, 0xf00a, 0xf192, 0xf4cb, 0xf85c,
+	0xf778, 0x00f1, 0x0660, 0xfe29, 0x0ef0, 0x0e27, 0x01c2, 0x1746,
+	0x0a2b, 0x00ed, 0x10d5, 0xfd74, 0xf6c1, 0xfba3, 0xebc8, 0xe7c7,
+	0xe874, 0xe0e1, 0xe21c, 0xe561, 0xea28, 0xf1de, 0xf961, 0x0737,
+	0x0f04, 0x1757, 0x2295, 0x25ee, 0x27be, 0x27d0, 0x2680, 0x1bee,
+	0x14b3, 0x1094, 0xff9f, 0xf96f, 0xf61f, 0xe85e, 0xe7eb, 0xe912,
+	0xe39e, 0xe90a, 0xec74, 0xedb7, 0xf61d, 0xf84b, 0xf937, 0x08e3,
+	0x057e, 0x01cb, 0x1713, 0x0884, 0x08ce, 0x1a0c, 0x04b3, 0x0832,
+	0x0f7d, 0xfb63, 0xfaca, 0xfb47, 0xeaab, 0xe845, 0xe867, 0xdfde,
+	0xe07d, 0xe710, 0xe888, 0xef6d, 0xfdb0, 0x037c, 0x0fd4, 0x1cb6,
+	0x1ee7, 0x2943, 0x2adf, 0x24cc, 0x26e5, 0x1d90, 0x11df, 0x0c76,
+	0x013c, 0xf57f, 0xf007, 0xec40, 0xe579, 0xe6ee, 0xeb1d, 0xe917,
+	0xf023, 0xf78a, 0xf4e0, 0x0053, 0x0163, 0xfc13, 0x0ffa, 0x00ef,
+	0x04bd, 0x1664, 0xfa45, 0x0f47, 0x11b4, 0xf8c2, 0x1019, 0x0673,
+	0xf6b0, 0x03e1, 0xf586, 0xeaa5, 0xef40, 0xe694, 0xe19c, 0xe272,
+	0xe8f5, 0xe83e, 0xef47, 0x0212, 0xff3b, 0x111d, 0x20f1, 0x192e,
+	0x2b0c, 0x2d3b, 0x2131, 0x27c2, 0x1f3c, 0x0ead, 0x0d95, 0x020e,
+	0xf36e, 0xf274, 0xeb33, 0xe597, 0xe804, 0xe9c5, 0xe8d4, 0xefe6,
+	0xf68d, 0xf58f, 0xfa79, 0x0306, 0x034d, 0xffbe, 0x0f69, 0x08f2,
+	0x016c, 0x1708, 0x0760, 0x03f9, 0x1398, 0x01f6, 0xff68, 0x049d,
+	0xf4a7, 0xef45, 0xef62, 0xe3e2, 0xdfe4, 0xe2a0, 0xe149, 0xe3bd,
+	0xeee0, 0xf625, 0xff55, 0x0f54, 0x165a, 0x208b, 0x297e, 0x2a89,
+	0x2cc0, 0x27fa, 0x2310, 0x19bc, 0x0d9b, 0x0673, 0xf8dc, 0xf098,
+	0xec98, 0xe426, 0xe534, 0xe750, 0xe5e5, 0xeda1, 0xf1fc, 0xf48f,
+	0xfd90, 0xfbc9, 0x030e, 0x087a, 0x01e2, 0x0e7b, 0x089d, 0x0694,
+	0x1245, 0x0574, 0x09b9, 0x0c72, 0x0104, 0x03ee, 0xfd99, 0xf385,
+	0xf276, 0xe9f1, 0xe45a, 0xe387, 0xdff0, 0xe410, 0xe745, 0xeee4,
+	0xfac7, 0x0365, 0x1037, 0x1b3b, 0x248e, 0x281d, 0x2d0e, 0x2dce,
+	0x239a, 0x225e, 0x1861, 0x0788, 0x040c, 0xf761, 0xeacf, 0xea6f,
+	0xe414, 0xe231, 0xe6c5, 0xe8be, 0xed14, 0xf322, 0xf9b7, 0xfcad,
+	0xfd02, 0x093f, 0x04a7, 0x0436, 0x1291, 0x01b6, 0x0b07, 0x1149,
+	0xff5a, 0x0ec2, 0x0927, 0xfe01, 0x0767, 0xfad5, 0xf2d2, 0xf593,
+	0xe919, 0xe47f, 0xe6d9, 0xe08c, 0xe34c, 0xeb14, 0xef2a, 0xf815,
+	0x072f, 0x0de7, 0x1811, 0x2753, 0x2659, 0x2ab3, 0x2e5e, 0x242e,
+	0x1f50, 0x1980, 0x0a81, 0x0061, 0xf9f3, 0xece3, 0xe6bb, 0xe669,
+	0xe15f, 0xe3b6, 0xea71, 0xea86, 0xf0c4, 0xf9eb, 0xf9d5, 0xfc55,
+	0x07ac, 0x0545, 0x0204, 0x1341, 0x05db, 0x04da, 0x17d4, 0x0090,
+	0x09fd, 0x1126, 0xfb50, 0x0716, 0x0014, 0xef79, 0xf7ef, 0xec2b,
+	0xe0bf, 0xe9d0, 0xe168, 0xe171, 0xec9f, 0xeebc, 0xf732, 0x0472,
+	0x100b, 0x151e, 0x2374, 0x29e9, 0x2604, 0x2ef6, 0x2554, 0x1c5d,
+	0x1ce9, 0x096b, 0x0179, 0xfce2, 0xebe3, 0xe9b7, 0xe785, 0xe080,
+	0xe5c2, 0xe895, 0xea38, 0xf22e, 0xf51d, 0xfce4, 0xfc93, 0x00cc,
+	0x0cba, 0x0073, 0x0d88, 0x1089, 0x00fd, 0x154c, 0x0b09, 0x046c,
+	0x11ff, 0x0223, 0x0204, 0x0270, 0xf448, 0xf3cf, 0xecf6, 0xe477,
+	0xe5e0, 0xe0bd, 0xe2ce, 0xe93f, 0xebd4, 0xf786, 0x0089, 0x0b36,
+	0x17e3, 0x1c63, 0x28c1, 0x2b21, 0x2660, 0x2c6b, 0x1f1c, 0x1643,
+	0x155b, 0x00ba, 0xfa53, 0xf643, 0xe624, 0xe749, 0xe5ca, 0xdfc1,
+	0xe926, 0xeb2b, 0xec65, 0xf5e6, 0xfbbc, 0xfbf3, 0x0022, 0x0bb5,
+	0x028d, 0x0b12, 0x1443, 0x016a, 0x1384, 0x1038, 0x0146, 0x1259,
+	0x04d9, 0xfd71, 0x0445, 0xf728, 0xeebf, 0xf04f, 0xe871, 0xdf00,
+	0xe490, 0xe453, 0xe278, 0xee0d, 0xf5eb, 0xfa3c, 0x0a42, 0x1648,
+	0x1769, 0x276a, 0x2c86, 0x224a, 0x2e29, 0x25b4, 0x1236, 0x1c15,
+	0x08ae, 0xf59c, 0x0018, 0xea1a, 0xe232, 0xee2a, 0xde5b, 0xe3ae,
+	0xef6c, 0xe77d, 0xf26e, 0xfb6d, 0xf8d3, 0xfe21, 0x0818, 0x04c6,
+	0x052f, 0x1479, 0x05a6, 0x0b11, 0x1669, 0x02c6, 0x0eb1, 0x0d94,
+	0xfd8c, 0x0667, 0xfec9, 0xf041, 0xf50c, 0xeb82, 0xe161, 0xe74f,
+	0xe1e7, 0xe250, 0xeb69, 0xf00b, 0xf744, 0x03ee, 0x0df7, 0x1716,
+	0x2028, 0x25ea, 0x2ae4, 0x2801, 0x268a, 0x2012, 0x1606, 0x1006,
+	0x02dc, 0xf9db, 0xf2f6, 0xe9ed, 0xe61c, 0xe4b6, 0xe3a4, 0xe6bb,
+	0xea9c, 0xeea6, 0xf3e6, 0xf923, 0xfe20, 0xfe80, 0x06ab, 0x066b,
+	0x07a2, 0x11ed, 0x058c, 0x0ee0, 0x1340, 0x02a3, 0x11a2, 0x0abf,
+	0xfd6b, 0x094d, 0xf999, 0xf11c, 0xf6a5, 0xe5ff, 0xe498, 0xe780,
+	0xdfa8, 0xe5d2, 0xed3b, 0xef47, 0xfae5, 0x0789, 0x0d48, 0x1a72,
+	0x20ae, 0x25be, 0x2b10, 0x22c0, 0x276d, 0x1ca7, 0x0ede, 0x129f,
+	0xfc31, 0xf55f, 0xf6cd, 0xe361, 0xe68c, 0xe90b, 0xdf31, 0xe9dd,
+	0xef1e, 0xebc7, 0xf74e, 0xfcd7, 0xfbb1, 0x0021, 0x08b6, 0x055f,
+	0x06fc, 0x1273, 0x065f, 0x0c79, 0x138c, 0x0545, 0x0ddf, 0x0b91,
+	0x0035, 0x04b4, 0xfbcb, 0xf188, 0xf27b, 0xe9df, 0xe2e5, 0xe4cd,
+	0xe42b, 0xe428, 0xeb25, 0xf4ea, 0xf9fb, 0x0581, 0x148f, 0x1728,
+	0x1fd8, 0x2c11, 0x247a, 0x26fd, 0x27f1, 0x1545, 0x165f, 0x0d82,
+	0xf9ef, 0xfbab, 0xf0b4, 0xe555, 0xea22, 0xe505, 0xe383, 0xebde,
+	0xec4a, 0xefc0, 0xf743, 0xfb56, 0xfc0b, 0xff7c, 0x09db, 0x00ee,
+	0x097c, 0x1453, 0xfead, 0x1383, 0x1353, 0xff5f, 0x1559, 0x0937,
+	0xfd88, 0x0834, 0xf93a, 0xf02a, 0xf3c1, 0xe645, 0xe1ec, 0xe5f4,
+	0xe07d, 0xe51a, 0xee76, 0xf2c0, 0xfbb9, 0x0b3d, 0x118e, 0x1b00,
+	0x24d5, 0x2723, 0x2aef, 0x253c, 0x2306, 0x1daf, 0x0ebf, 0x0a64,
+	0x0172, 0xf1f3, 0xf0cd, 0xea7d, 0xe1e0, 0xe7a7, 0xe5e8, 0xe692,
+	0xefc3, 0xef34, 0xf3c6, 0xff03, 0xf90d, 0xfe2b, 0x0b3b, 0xff61,
+	0x0aa4, 0x1230, 0x02bf, 0x13d2, 0x1082, 0x04ad, 0x1430, 0x06ed,
+	0xff6d, 0x0766, 0xf56a, 0xf009, 0xf2bf, 0xe2d7, 0xe218, 0xe57f,
+	0xe0e8, 0xe70f, 0xee41, 0xf6d3, 0xff80, 0x0a56, 0x17c0, 0x1d0c,
+	0x2351, 0x2c6f, 0x2693, 0x2467, 0x2732, 0x12ad, 0x11d4, 0x0bff,
+	0xf3d3, 0xf936, 0xef52, 0xe1f5, 0xe9ac, 0xe63c, 0xe2d7, 0xeb96,
+	0xeee5, 0xedd4, 0xf83e, 0xfc5d, 0xf87b, 0x0436, 0x06f6, 0x0090,
+	0x11e7, 0x0a7a, 0x0697, 0x1a86, 0x06ca, 0x0cb8, 0x14d2, 0xff7c,
+	0x0833, 0x0184, 0xf244, 0xf51e, 0xec3d, 0xe2f5, 0xe448, 0xe356,
+	0xe2ad, 0xe8c8, 0xf0fb, 0xf744, 0x017d, 0x101e, 0x1514, 0x1cc9,
+	0x2802, 0x26a1, 0x2488, 0x268e, 0x1f90, 0x1263, 0x1116, 0x062e,
+	0xf5e6, 0xf892, 0xed52, 0xe498, 0xeb93, 0xe4e6, 0xe567, 0xed3e,
+	0xedb2, 0xeeed, 0xf720, 0xfce7, 0xf584, 0x03bb, 0x09a5, 0xfbf5,
+	0x1361, 0x0edb, 0x022c, 0x1c5e, 0x0bf5, 0x0712, 0x1746, 0x028e,
+	0x028b, 0x02af, 0xf3bc, 0xf135, 0xeb7e, 0xe78c, 0xe153, 0xe397,
+	0xea38, 0xe5ed, 0xf42c, 0xfe8e, 0xfeae, 0x1301, 0x16a7, 0x19b9,
+	0x2739, 0x2160, 0x2310, 0x21c4, 0x17b5, 0x13ef, 0x0a37, 0x0195,
+	0xf9e1, 0xf39a, 0xee8f, 0xe86a, 0xeac8, 0xe945, 0xe8b9, 0xf05b,
+	0xef91, 0xf284, 0xfc77, 0xf975, 0xfb15, 0x09d3, 0x017e, 0x02e1,
+	0x13ba, 0x03d7, 0x08a4, 0x13fc, 0x038e, 0x07dc, 0x0b64, 0xff44,
+	0xfd64, 0xfd77, 0xf582, 0xf007, 0xf0b6, 0xeed8, 0xea42, 0xef97,
+	0xf4ea, 0xf42e, 0xfdff, 0x04f6, 0x08fb, 0x100e, 0x1517, 0x18ad,
+	0x17e6, 0x1a91, 0x162e, 0x10c9, 0x1020, 0x06a4, 0x01b5, 0xfe60,
+	0xf71d, 0xf525, 0xf2dd, 0xf05e, 0xf24d, 0xf2d6, 0xf37e, 0xf722,
+	0xf8c1, 0xfa61, 0xfce3, 0xfeb7, 0xffc5, 0x0040, 0x017e, 0x0255,
+	0x01b5, 0x011b, 0x031a, 0x0115, 0xffd7, 0x01ee, 0xfe5b, 0xfed0,
+	0xfeb8, 0xfbb1, 0xfd4a, 0xfc3c, 0xfb82, 0xfce8, 0xfdb8, 0xff36,
+	0x0094, 0x0279, 0x04c7, 0x0593, 0x070b, 0x0853, 0x07b3, 0x07f4,
+	0x079a, 0x064d, 0x03e5, 0x03b9, 0x0296, 0xfecb, 0x00b7, 0xff08,
+	0xfc22, 0xfe4f, 0xfd85, 0xfc5d, 0xfdc9, 0xfde9, 0xfc65, 0xfd25,
+	0xfd19, 0xfba7, 0xfc7c, 0xfbf6, 0xfb78, 0xfc93, 0xfc49, 0xfcae,
+	0xfde5, 0xfe40, 0xfeb3, 0xff6e, 0xffdd, 0xffca, 0xfff8, 0x004d,
+	0xffd3, 0x0011, 0x0061, 0xffe4, 0x00ba, 0x014a, 0x01e2, 0x0269,
+	0x0332, 0x03d2, 0x0324, 0x03f1, 0x03e5, 0x02d7, 0x02ca, 0x0245,
+	0x0140, 0x00e9, 0x009c, 0x003e, 0x0060, 0x00aa, 0x00c7, 0x009f,
+	0x01c4, 0x0127, 0x0093, 0x0149, 0xfff8, 0xff23, 0xfe85, 0xfe01,
+	0xfca7, 0xfc2b, 0xfcd8, 0xfb7a, 0xfc37, 0xfdb1, 0xfcc3, 0xfe29,
+	0xffbc, 0xfecb, 0xff86, 0x0046, 0xffd1, 0xff3e, 0xffa0, 0xffa2,
+	0xfe5c, 0xfee7, 0xff77, 0xff17, 0x0022, 0x015b, 0x0182, 0x026d,
+	0x0389, 0x036d, 0x03ea, 0x03fc, 0x035d, 0x02c6, 0x023c, 0x0180,
+	0x0078, 0x002f, 0xffc8, 0xff45, 0xfeee, 0xff35, 0xff8b, 0xff26,
+	0xfff4, 0x0020, 0xff7e, 0xffe4, 0xffd3, 0xff38, 0xff5b, 0xff6f,
+	0xfe79, 0xfef3, 0xff75, 0xfe8e, 0xff0e, 0xffb8, 0xff4b, 0xff7f,
+	0x0007, 0xff4b, 0xfed6, 0xfe8c, 0xfdbc, 0xfdd0, 0xfdb4, 0xfd9b,
+	0xfe24, 0xfe56, 0xfeac, 0xffad, 0x005e, 0x00f7, 0x020e, 0x028b,
+	0x02d9, 0x033f, 0x02f1, 0x0289, 0x0251, 0x019e, 0x0119, 0x0077,
+	0x001c, 0xffdf, 0xff1d, 0xffaa, 0xffdf, 0xff4f, 0x000b, 0x005c,
+	0xffe2, 0x000e, 0x0062, 0xffbd, 0xffa5, 0xffe3, 0xff25, 0xff19,
+	0xff3f, 0xfeef, 0xff54, 0xff7a, 0xff61, 0xffc1, 0xff9e, 0xffbd,
+	0x0019, 0xff83, 0xffbd, 0xff5c, 0xfeaa, 0xff53, 0xfef0, 0xfee8,
+	0xff7c, 0xff9d, 0xffcb, 0x0062, 0x00f0, 0x00de, 0x018f, 0x01f0,
+	0x017a, 0x018a, 0x017d, 0x011b, 0x00b5, 0x00a2, 0x003f, 0xffba,
+	0xffe7, 0xfff8, 0xff99, 0x0011, 0x0054, 0x0017, 0x0039, 0x0067,
+	0xfff3, 0xffa5, 0xfffb, 0xff69, 0xff3b, 0xff4c, 0xfed2, 0xff3e,
+	0xfed5, 0xff47, 0x000b, 0xff7a, 0xffec, 0x00b2, 0x0020, 0x0037,
+	0x00d3, 0x0057, 0xffdd, 0xffff, 0x001c, 0xff24, 0xff1a, 0xfff8,
+	0xff34, 0xff5e, 0x0062, 0x0046, 0x0011, 0x00a8, 0x0110, 0x00d8,
+	0x014a, 0x00ea, 0x00a9, 0x00fe, 0xff82, 0xff5e, 0xffcf, 0xfed2,
+	0xff23, 0xff57, 0xff60, 0xfef5, 0xff49, 0xffbf, 0xff1b, 0xffd1,
+	0x0023, 0xffce, 0xff8d, 0x0011, 0x00bc, 0xff75, 0xfffc, 0x011f,
+	0xff50, 0xff8e, 0x014d, 0xffbf, 0xffa7, 0x00bd, 0xffc4, 0xffd7,
+	0x0017, 0x0003, 0x0020, 0xff78, 0xffc7, 0x0021, 0xff9d, 0xfffa,
+	0x001c, 0x0041, 0x0048, 0xffe3, 0x00ac, 0x00e3, 0xffc5, 0x0058,
+	0x0156, 0x005e, 0x001a, 0x00ac, 0x0016, 0xff9c, 0x0046, 0xfffa,
+	0xff78, 0xffea, 0xff64, 0xff48, 0xffed, 0xffc4, 0xff7f, 0xff89,
+	0x002e, 0x0053, 0x000c, 0x0068, 0x0136, 0x0032, 0x0008, 0x00fa,
+	0x0037, 0x000e, 0xffcd, 0xff79, 0xffec, 0xff3e, 0xfedd, 0xffbd,
+	0xffd3, 0xfebc, 0x0021, 0x00b9, 0xff4e, 0x0085, 0x005f, 0xffff,
+	0x0113, 0x0080, 0xffd3, 0x00a6, 0x005a, 0xfed0, 0x0044, 0x00ca,
+	0xfee0, 0xffa9, 0x004a, 0xff57, 0xffbf, 0xfffc, 0xffe4, 0x005d,
+	0xff8e, 0x006a, 0x0067, 0xffc2, 0x0104, 0xff75, 0x0083, 0x0199,
+	0xff68, 0x0051, 0x014e, 0xffee, 0xff28, 0xffe3, 0xff53, 0xfe72,
+	0xfdd3, 0xfebd, 0xff92, 0xfdb6, 0xfef0, 0x005c, 0xff60, 0x0057,
+	0x017b, 0x00ec, 0x00ae, 0x0177, 0x00e7, 0x00c7, 0x00c5, 0xffad,
+	0xff29, 0xffc3, 0xfef2, 0xfe06, 0x007c, 0xfe1e, 0xfe86, 0x022f,
+	0xff05, 0x00c5, 0x0251, 0xffa0, 0x00c1, 0x0204, 0x00be, 0xff4a,
+	0xffe9, 0x00c3, 0xff47, 0xfe81, 0xff7a, 0x00e5, 0x004d, 0xfac6,
+	0x050f, 0x07ad, 0xf5c3, 0x02b1, 0x0690, 0xf716, 0x0101, 0x04c5,
+	0xfb4c, 0xfc7e, 0x023f, 0xfce0, 0x0022, 0x02fa, 0xfd3f, 0x042f,
+	0x022e, 0x009e, 0x044b, 0x00fd, 0x00ca, 0x00c5, 0xff17, 0xfe01,
+	0xff11, 0xfe1b, 0xfaea, 0xfe30, 0x0000, 0xfc83, 0x019c, 0xffa2,
+	0x0120, 0x0835, 0xfb65, 0x0452, 0x0871, 0xf83a, 0x01d5, 0x037c,
+	0xfac7, 0xfbfa, 0xffa5, 0xfe26, 0xfa58, 0xff9d, 0x01eb, 0xfede,
+	0x0161, 0x0461, 0x02a7, 0x037b, 0x0200, 0x0252, 0x0296, 0xfdb0,
+	0xffae, 0xfeac, 0xfc75, 0xfda2, 0xfd0e, 0xfdfd, 0xff1a, 0xffda,
+	0xff89, 0x0284, 0x0345, 0x0150, 0x0302, 0x01d7, 0x010d, 0x00dc,
+	0xff0d, 0xfe83, 0xfd4b, 0xfd42, 0xfd91, 0xfc84, 0xfee9, 0x0042,
+	0xfe62, 0xff88, 0x024b, 0x01ba, 0xfe35, 0x029c, 0x037f, 0xfbe3,
+	0x00cf, 0x0259, 0xfd44, 0xfdf8, 0xff9c, 0x01db, 0xfddd, 0xfec1,
+	0x03f0, 0x0057, 0xff68, 0x01c2, 0x01d5, 0xffef, 0xff39, 0x00c2,
+	0xfed6, 0xfe6d, 0x0096, 0xfdda, 0xff4e, 0x013b, 0xfe1b, 0x0124,
+	0x020b, 0x00fb, 0x01b7, 0x00c0, 0x01a9, 0x0056, 0x0045, 0x000d,
+	0xfe6c, 0xffea, 0xfe04, 0xfd75, 0x00c7, 0xff32, 0xfde6, 0x007c,
+	0x019e, 0x0015, 0xfee1, 0x02f3, 0x022b, 0xfc59, 0x017e, 0x038a,
+	0xfc77, 0xfe80, 0x02e6, 0xfec5, 0xfd0d, 0x0205, 0x016a, 0xfcd4,
+	0x00a7, 0x035a, 0xfe21, 0xfef0, 0x02c3, 0xff7b, 0xfdf0, 0x015b,
+	0x008f, 0xfe3b, 0x0030, 0x0124, 0xff79, 0xffbe, 0x016f, 0x00b8,
+	0xfed5, 0x0077, 0x01a0, 0xff09, 0xfed7, 0x00bc, 0xffe3, 0xfe53,
+	0xff3b, 0x0044, 0xff78, 0xff9d, 0x007b, 0x009c, 0x00db, 0xffdd,
+	0x00bc, 0x0200, 0xff0a, 0x003e, 0x016c, 0xfe7b, 0xff51, 0x0045,
+	0xffc4, 0xfec0, 0xff2b, 0xfff5, 0xfedb, 0xff2d, 0x002b, 0xfffd,
+	0xff79, 0x0019, 0x0011, 0xff2d, 0xffbd, 0x0053, 0xff95, 0xfeea,
+	0x006d, 0x008c, 0xff04, 0x0052, 0x0154, 0xffca, 0x004c, 0x00f5,
+	0xffdb, 0xfff7, 0x0082, 0xffbf, 0xffa0, 0x0080, 0xff92, 0xff25,
+	0x00a7, 0xfffe, 0xffa8, 0x0071, 0x0077, 0x0061, 0xffb0, 0x00c6,
+	0x010c, 0xff51, 0x0001, 0x0092, 0xff5f, 0xff78, 0x0096, 0xff87,
+	0xff12, 0x00de, 0x006d, 0xff54, 0x001f, 0x00f2, 0x0047, 0xff68,
+	0x0028, 0x002c, 0xffc0, 0x0016, 0xff89, 0xffae, 0x008c, 0xfff5,
+	0xffba, 0xffb8, 0x0182, 0x00c0, 0xfe8f, 0x0131, 0x00cc, 0xfeea,
+	0xff94, 0x003e, 0xffdd, 0xfe69, 0xffad, 0x0004, 0xff32, 0xffb9,
+	0xfff6, 0x00e3, 0x0029, 0xff65, 0x0155, 0x00c2, 0xfef5, 0x003d,
+	0x011c, 0xffa6, 0xfeec, 0x0095, 0x0066, 0xfeaf, 0x0049, 0x00c9,
+	0xff14, 0xffbd, 0x0132, 0x0038, 0xff2c, 0x00c2, 0x006b, 0xff00,
+	0xfff4, 0x00a1, 0xffad, 0xff96, 0x0137, 0x003b, 0xff82, 0x0174,
+	0x00e9, 0xffe1, 0x005e, 0x00d2, 0x0028, 0xfe4a, 0xfe98, 0xffd8,
+	0xfe3e, 0xfe0e, 0xff47, 0xfed5, 0xff3a, 0xff43, 0xff2e, 0x006c,
+	0x0072, 0x001d, 0x009d, 0x013b, 0x008d, 0x0030, 0x00ce, 0x002b,
+	0xffe9, 0x001e, 0xff8e, 0xffc8, 0xffa4, 0xff10, 0x003d, 0x0001,
+	0xffa5, 0x002e, 0xfff3, 0x007f, 0x0048, 0x0042, 0x00a7, 0x0064,
+	0x002d, 0x0044, 0x00cf, 0x0078, 0xffbf, 0x00ae, 0x00b5, 0xff84,
+	0x0041, 0x00ca, 0xffbb, 0xff8e, 0xffd1, 0xffcd, 0xffa4, 0xff42,
+	0xff23, 0x001c, 0xfff0, 0xff1d, 0xff97, 0x003f, 0x00b0, 0xffc5,
+	0x0050, 0x0179, 0x004e, 0xffd8, 0x0032, 0x0099, 0xffe9, 0xff46,
+	0x0025, 0xffaa, 0xff46, 0xffc1, 0xffa1, 0xffe0, 0xffc6, 0xffb8,
+	0x0045, 0x0045, 0x003e, 0xffd9, 0x00ac, 0x0101, 0xff92, 0xffde,
+	0x00d8, 0x005e, 0xff7f, 0xffe7, 0x00cb, 0xfff1, 0xffae, 0x0010,
+	0x000d, 0x002d, 0xffb3, 0xffbb, 0xffdc, 0xffb2, 0xffdf, 0xfff2,
+	0xffde, 0xffd3, 0xffef, 0x0023, 0x0035, 0x0009, 0x002c, 0x00c5,
+	0x0040, 0xff79, 0x006d, 0x0047, 0xff8e, 0xffdc, 0xff36, 0xff5d,
+	0xff6a, 0xfe2f, 0xfe96, 0xffff, 0xffc9, 0xfebd, 0xffa0, 0x0088,
+	0xfff0, 0xff67, 0x0050, 0x00cc, 0x0006, 0xffe8, 0x0066, 0x0099,
+	0xffe7, 0x0004, 0x0052, 0xffb8, 0xfff6, 0x0034, 0x0015, 0x0013,
+	0x000b, 0x0042, 0xffd1, 0xffe8, 0x009c, 0x0042, 0x001f, 0x004a,
+	0x0046, 0x003d, 0xffe4, 0x000c, 0x0039, 0x000b, 0x006b, 0x0030,
+	0xff79, 0x0033, 0x0041, 0xffd7, 0x0007, 0x000b, 0x001d, 0xffae,
+	0xffa7, 0x0057, 0xffe5, 0xff5f, 0x002b, 0x0033, 0xff9f, 0xffe5,
+	0x002e, 0x0012, 0xffee, 0x0034, 0x006e, 0x0042, 0xffed, 0x0012,
+	0x0069, 0x0019, 0xffe4, 0x0011, 0xffe0, 0x0021, 0xfffc, 0xff93,
+	0x000f, 0x0046, 0x0000, 0xffde, 0x0010, 0x002f, 0x0029, 0xffdc,
+	0xffa2, 0x0066, 0x0047, 0xff74, 0xffc8, 0x005e, 0x0022, 0xffc1,
+	0x004f, 0x004b, 0x0010, 0x003a, 0xffe4, 0xffed, 0x0065, 0x0010,
+	0xff88, 0xff67, 0xffe8, 0x0004, 0xff34, 0xff5a, 0x003f, 0x0049,
+	0xfffd, 0x000a, 0x00c5, 0x00a0, 0x0042, 0x005e, 0x0036, 0x0082,
+	0xffe5, 0xff0a, 0xff11, 0xfef5, 0xfefb, 0xfef3, 0xfecf, 0xff7e,
+	0xffe6, 0xff77, 0xffb9, 0x0061, 0x0075, 0x0021, 0x0066, 0x00a7,
+	0x005b, 0x0042, 0xffc2, 0x0015, 0x0025, 0xffcf, 0xffe3, 0xff94,
+	0xfffa, 0x0034, 0xffee, 0xffe8, 0x006d, 0x0098, 0xff97, 0xffe1,
+	0x008b, 0x002e, 0xffc4, 0xffb2, 0x0047, 0xfffa, 0xff5b, 0x0018,
+	0x003f, 0xfffe, 0x008d, 0xfff1, 0x0035, 0x00c8, 0x001b, 0x0032,
+	0xffca, 0x000b, 0xfffd, 0xff78, 0xffa1, 0xff28, 0xfff8, 0x002e,
+	0xffb4, 0xff9a, 0x0015, 0x00db, 0x004d, 0x003c, 0x005b, 0x0071,
+	0x0090, 0xffe8, 0x0003, 0x0080, 0xffe0, 0xff51, 0xff93, 0xfffe,
+	0x0025, 0xff79, 0xff85, 0xffe1, 0x003e, 0x009f, 0xff81, 0xffb6,
+	0x008f, 0x00aa, 0x0005, 0xff56, 0x0040, 0x0072, 0x0000, 0xffad,
+	0xfff0, 0x0083, 0x004b, 0xff86, 0xff90, 0x00c9, 0x00a9, 0xffb9,
+	0xfef9, 0xff81, 0x0126, 0x003e, 0xfecf, 0xff5c, 0x0112, 0x00c8,
+	0xff5a, 0xffc0, 0x003c, 0x00b9, 0x0080, 0xff6d, 0xffeb, 0x0072,
+	0x0059, 0xffd5, 0xfec5, 0xffa8, 0x0032, 0xfe9d, 0xfeae, 0xff5f,
+	0x003f, 0x0030, 0xfed6, 0xff2f, 0x0014, 0x00f1, 0x0015, 0xfefe,
+	0xffb0, 0x00d9, 0x0107, 0xff15, 0xff85, 0x0107, 0x005a, 0xffc3,
+	0xff70, 0x000d, 0x00bf, 0x0024, 0xffa5, 0xffcb, 0x0024, 0x00b1,
+	0x0012, 0xff87, 0x0036, 0x0077, 0x0076, 0xffb8, 0xffb8, 0x0092,
+	0x009d, 0x000d, 0xff67, 0x0012, 0x0048, 0x003d, 0xfff5, 0xff92,
+	0x0088, 0x005c, 0xffb0, 0xffcf, 0x0015, 0x007a, 0xffc4, 0xff9b,
+	0x0117, 0x000b, 0xff77, 0x00c6, 0xff29, 0xff87, 0x0076, 0xff66,
+	0xff9b, 0xffca, 0x0039, 0xffee, 0x000a, 0x0063, 0x0021, 0x0047,
+	0x0089, 0x008b, 0x000d, 0x004b, 0x003c, 0xffb6, 0xffb8, 0xffaa,
+	0xffd2, 0xff99, 0xffa0, 0xffdd, 0xffb0, 0xff9f, 0x0019, 0x001b,
+	0xffe8, 0x008c, 0x007a, 0x003d, 0xfff3, 0x0019, 0x0083, 0x0007,
+	0xffb8, 0xffcb, 0xffda, 0xffa5, 0xff92, 0xff8a, 0xffc4, 0x002f,
+	0xffd4, 0xffe4, 0xfffb, 0x0047, 0x005b, 0xffe0, 0x003d, 0x008f,
+	0x006a, 0xfff0, 0xffc3, 0x001b, 0xffff, 0xff43, 0xff28, 0xff46,
+	0xff3f, 0xffa6, 0xff66, 0xff45, 0xffcf, 0x0027, 0x0009, 0xff9e,
+	0xfff4, 0x0051, 0x002d, 0x0029, 0x0006, 0x002a, 0x0015, 0xfff0,
+	0xfff2, 0xfff5, 0x0032, 0x0028, 0xfff1, 0x001c, 0x0010, 0x0029,
+	0x005b, 0xffe8, 0x0043, 0x004a, 0xffe4, 0x0013, 0x0000, 0x0030,
+	0x0022, 0xffcb, 0xffda, 0x0004, 0x0021, 0x001f, 0x0018, 0xffec,
+	0x0004, 0x0018, 0x000b, 0x0010, 0x0029, 0x0040, 0x001f, 0xffcc,
+	0xffe6, 0x003c, 0xffd2, 0x000a, 0x002d, 0xffe6, 0x001f, 0x001b,
+	0x0004, 0x0048, 0x0032, 0x0009, 0x0007, 0x001b, 0x0026, 0xffda,
+	0xffea, 0x0034, 0x0000, 0xffdd, 0xffd2, 0x0010, 0x0048, 0xffe2,
+	0xffd6, 0xfffd, 0xfff3, 0x0004, 0x0007, 0x000b, 0xfff9, 0xffe5,
+	0xffac, 0xffad, 0x000d, 0xffee, 0xffe8, 0x001e, 0x0058, 0x002e,
+	0xfff7, 0xfff7, 0x0017, 0x0044, 0x001d, 0x0003, 0xffe0, 0xfff3,
+	0x0018, 0xffcd, 0xfff2, 0x0014, 0xfff7, 0x002e, 0x0023, 0x0023,
+	0x007b, 0xfff9, 0xfff4, 0x003e, 0xfffc, 0x0062, 0x001f, 0xff41,
+	0xff2f, 0xfed8, 0xff10, 0xff6e, 0xff65, 0xffaa, 0xffa0, 0xff9d,
+	0xffb2, 0xff82, 0xffd5, 0xfff8, 0xffd7, 0x005a, 0x0056, 0x0007,
+	0xffea, 0xffc0, 0xfff8, 0x0039, 0x0006, 0xffe8, 0x0026, 0x0003,
+	0x0000, 0x0022, 0x001a, 0x004e, 0xffff, 0xfff2, 0x0080, 0x0091,
+	0x0039, 0xffe9, 0x0023, 0x002a, 0xffeb, 0x002c, 0x0005, 0x001a,
+	0x0071, 0xff66, 0xffea, 0x003a, 0xff51, 0x002f, 0xffe9, 0xffd6,
+	0x007c, 0x003a, 0xffa5, 0xff8b, 0x0067, 0x005c, 0x001b, 0x0046,
+	0x0028, 0x0021, 0x0001, 0xffe2, 0xfff6, 0x004f, 0x0037, 0x000b,
+	0xffed, 0xffb2, 0xfff7, 0x001d, 0x0003, 0x0060, 0x0076, 0x001c,
+	0x0000, 0xffde, 0xffe7, 0xffc9, 0xffbf, 0x004b, 0xffe0, 0xffc3,
+	0xfff1, 0xff8c, 0xffa6, 0xffdc, 0xfff1, 0xffd9, 0xffe2, 0x004d,
+	0x008a, 0x0051, 0x0020, 0x002d, 0xffe2, 0x0018, 0x0025, 0x001a,
+	0x0037, 0xffde, 0x0009, 0xffc8, 0xff5e, 0x001a, 0x0021, 0xffef,
+	0x0077, 0x007a, 0x0057, 0x0039, 0x0016, 0x002b, 0x0006, 0x0051,
+	0x005f, 0xff3a, 0xfe8c, 0xfe8e, 0xfee4, 0xff36, 0xff56, 0xff87,
+	0xff6f, 0xff8e, 0xfff0, 0xfff0, 0xffce, 0x000b, 0x009a, 0x0061,
+	0x000d, 0xffd4, 0x002e, 0x004e, 0xffe6, 0x0040, 0x001b, 0x0002,
+	0x001b, 0xfff1, 0x004b, 0x005c, 0x0046, 0x0068, 0x0011, 0x005a,
+	0x00a7, 0x002a, 0x0032, 0x0021, 0xffc1, 0xfffa, 0xffc9, 0xffd7,
+	0x0046, 0xffe2, 0xffc1, 0xffbb, 0xff68, 0xffb7, 0xffe1, 0xffdc,
+	0x0053, 0x0096, 0x0026, 0xffb8, 0xffe5, 0x0037, 0x003c, 0x0035,
+	0x0057, 0x0036, 0xffed, 0x000c, 0xffcb, 0xffcb, 0x0076, 0x0048,
+	0x0048, 0x0033, 0xffb4, 0x000b, 0x0022, 0x001f, 0x0027, 0x002a,
+	0x0027, 0xffc8, 0xffcd, 0xfff6, 0xff85, 0xffcc, 0xffc1, 0xff89,
+	0x0004, 0xffa2, 0xffa1, 0xffe5, 0xffc5, 0xffab, 0xffc2, 0xffe5,
+	0xffb2, 0xfff4, 0x0069, 0x004e, 0x0008, 0x0001, 0x002d, 0x007c,
+	0x00d1, 0x0055, 0xffd3, 0xffdb, 0xffe7, 0x0042, 0x0073, 0x004b,
+	0x0071, 0x0068, 0x0007, 0x0015, 0x003e, 0x000e, 0x0067, 0x00d7,
+	0x0047, 0x0003, 0xffca, 0xff1a, 0xfec5, 0xfe99, 0xfec3, 0xff1a,
+	0xff56, 0xff3b, 0xffb7, 0xff92, 0xfefa, 0xff73, 0xffcd, 0xfff3,
+	0x0054, 0xffeb, 0xffed, 0x0056, 0x000d, 0x000e, 0x0017, 0x0019,
+	0x00aa, 0x003e, 0x0001, 0x00a9, 0x003c, 0xffe5, 0x003a, 0x004e,
+	0x0175, 0x0172, 0xff8f, 0xffb1, 0x0046, 0x000d, 0x000a, 0xffb0,
+	0x002b, 0x00db, 0xff82, 0xff3a, 0xffde, 0xff3c, 0xff96, 0x0001,
+	0x007d, 0x00db, 0xff60, 0xff2f, 0xffe4, 0xffd5, 0x00a3, 0xffc9,
+	0xfefc, 0x00e9, 0x00be, 0xffd5, 0x0007, 0xff6a, 0x007c, 0x00ed,
+	0xff8f, 0x010d, 0x0113, 0xff0c, 0x0036, 0x0004, 0xff39, 0x0047,
+	0x0011, 0x0046, 0x012b, 0x00e1, 0xff87, 0xfec8, 0xffa4, 0xffae,
+	0xffbc, 0x00bb, 0x006c, 0xffe6, 0xff8d, 0xfee7, 0xffdf, 0xffdd,
+	0xfee4, 0x001e, 0x0125, 0x0027, 0xff78, 0xff15, 0xff66, 0x00ed,
+	0x0085, 0x004c, 0x010c, 0x0147, 0x00ba, 0xfeca, 0xfee4, 0x0020,
+	0x00bd, 0x0102, 0xffcf, 0x0035, 0x005c, 0xffa9, 0xffd7, 0xff1a,
+	0xffb4, 0x012d, 0x0127, 0x0104, 0x0004, 0xfe89, 0xfe7f, 0xfdde,
+	0xfe69, 0xff4c, 0xfee3, 0xffe3, 0xff30, 0xfe4c, 0xffd4, 0x0044,
+	0xffcb, 0xfff5, 0x0067, 0x0051, 0xff98, 0xff0e, 0x004d, 0x00e7,
+	0xff25, 0xfe63, 0xff90, 0x04e6, 0x0640, 0xfcb2, 0xfb1e, 0xfffc,
+	0x01fd, 0x0572, 0xfd2b, 0xfc69, 0x079d, 0xfff6, 0xfcb5, 0xff07,
+	0xfbf5, 0x01d9, 0x03b4, 0x00fb, 0x022e, 0x0093, 0xfe05, 0xfd71,
+	0xfe0f, 0x0149, 0x0151, 0xfe3a, 0xfeb8, 0x00b5, 0x00c2, 0xff50,
+	0xfeb4, 0x007e, 0x018d, 0x0091, 0x0049, 0xffe9, 0xff7a, 0x0094,
+	0xffae, 0xfe63, 0xff71, 0x0055, 0x013b, 0x0025, 0xffc3, 0x00c5,
+	0x0040, 0x00bf, 0x007b, 0xfff4, 0x0168, 0x023d, 0x00c1, 0xfe5b,
+	0xfdcc, 0xfef3, 0xffc6, 0x0031, 0x00b5, 0x005f, 0xff9a, 0xfdf4,
+	0xfd83, 0xff67, 0x0089, 0x00e8, 0x0072, 0xffda, 0x008b, 0x000d,
+	0xff08, 0x0044, 0x011c, 0x00e9, 0x00b2, 0x0039, 0x002c, 0xff63,
+	0xfed0, 0xff9c, 0x003f, 0x004d, 0x00e4, 0x00e1, 0x0076, 0x00e1,
+	0x009b, 0x015c, 0x0147, 0x005d, 0x0056, 0xffc0, 0x00d4, 0xff7d,
+	0xfc7e, 0xfc88, 0xfd60, 0xfefc, 0xff9e, 0xfe79, 0xfee2, 0xffc9,
+	0xff00, 0xff72, 0x0051, 0x0041, 0x0117, 0x00f1, 0x00d7, 0x0102,
+	0xfff7, 0xfe2e, 0xfecd, 0x018c, 0x0135, 0xffd8, 0xff06, 0x003d,
+	0x018c, 0x0130, 0x00ef, 0xffbf, 0x0121, 0x014e, 0x00a8, 0x01ec,
+	0x004e, 0x0047, 0x0085, 0xfedc, 0xff2b, 0xffc6, 0xfe92, 0xfe13,
+	0xff31, 0xff27, 0xfeea, 0xff9d, 0xffd5, 0xffef, 0x006e, 0x0010,
+	0xffcb, 0xff62, 0xffcf, 0x012a, 0x0175, 0x016c, 0xff68, 0xfe06,
+	0xff12, 0xffdf, 0x002e, 0xffdc, 0xffbf, 0x01b0, 0x0179, 0x0000,
+	0x00e5, 0x00bb, 0x00f6, 0x0052, 0x00f9, 0x01a7, 0xffa2, 0x005c,
+	0xff49, 0xff3d, 0x0008, 0xfdf1, 0xfdeb, 0xfe62, 0xffe6, 0x008f,
+	0x0089, 0x0010, 0x0087, 0x005c, 0xfe00, 0xff9c, 0x00b0, 0x0194,
+	0x005a, 0xfe1b, 0xff6a, 0x005c, 0x024d, 0x00b2, 0xfe69, 0xffff,
+	0x0048, 0x000c, 0x0006, 0x00c3, 0x0140, 0xffd2, 0xff81, 0x0028,
+	0xfffd, 0x009c, 0x009b, 0x0029, 0x009e, 0x0198, 0x01d0, 0xfeca,
+	0xfef1, 0xff85, 0x003f, 0x002f, 0xfbad, 0xfc5c, 0xfd9e, 0xfe6a,
+	0xff58, 0xff64, 0x0238, 0x02a2, 0x000f, 0xfcb0, 0xfe24, 0x020a,
+	0x015b, 0x0011, 0xff6b, 0x0248, 0x0269, 0xfe78, 0xfeb8, 0xfea6,
+	0x00b0, 0x0188, 0xfef8, 0xfeac, 0x0051, 0x01bf, 0xff8e, 0x0063,
+	0x01e8, 0xfee5, 0x0012, 0x004a, 0x0201, 0x0379, 0xffab, 0xffde,
+	0xffef, 0x0183, 0x0159, 0xff79, 0xff4f, 0xfd43, 0xfed9, 0xfd57,
+	0xfb6a, 0xfe5a, 0x00dd, 0x0232, 0x02ee, 0x0224, 0xfd49, 0xfd18,
+	0xff1a, 0x0261, 0x014e, 0x013d, 0x07c6, 0x0234, 0xfd83, 0xf976,
+	0xfb2a, 0x02b6, 0xffcd, 0xff4b, 0xfe59, 0x001a, 0x01da, 0xfe5f,
+	0xfef1, 0x015d, 0x05a2, 0x0474, 0x01f9, 0x029f, 0x00b2, 0x01d5,
+	0xff8e, 0xfda3, 0xfef6, 0xfca0, 0xfece, 0xfe69, 0xfcec, 0xfd8d,
+	0xfc31, 0xfd4c, 0xfed3, 0x0280, 0x02f2, 0x02d3, 0x03fb, 0x0236,
+	0xff60, 0xfd43, 0xfe43, 0xfe8a, 0x0098, 0x010a, 0x005c, 0xff0c,
+	0xfd97, 0xfdda, 0xfc70, 0x0033, 0x01b9, 0x038d, 0x03bf, 0xfe88,
+	0xfff2, 0x0184, 0x0409, 0x0391, 0x00ed, 0xff0f, 0xfdf6, 0x0148,
+	0xfea4, 0xfe5d, 0xff0d, 0xfd21, 0xfe27, 0xfe50, 0xff31, 0xfe36,
+	0xfe92, 0xffaf, 0x0040, 0x023c, 0x0044, 0xff0a, 0x017c, 0x02b5,
+	0xffa6, 0xfdfc, 0x0063, 0x000b, 0xff05, 0xfcdb, 0xfd85, 0x02dc,
+	0x0244, 0xfe72, 0xfd1b, 0x007f, 0x02dc, 0x01b3, 0x025f, 0xfdfd,
+	0xff1e, 0x02ad, 0xff41, 0x0078, 0x01cb, 0x031e, 0x0134, 0xfe4c,
+	0x0010, 0xff2f, 0xfee4, 0x00e4, 0x0333, 0x03d1, 0x0030, 0xfab8,
+	0xfc8d, 0x0232, 0x01ff, 0x00be, 0xfe6e, 0xfd5f, 0xffa0, 0x0260,
+	0xffcc, 0xfe65, 0x013b, 0xfeab, 0xffab, 0x0017, 0xfee6, 0xff3a,
+	0xffc3, 0x017f, 0xff24, 0xffdd, 0xfe1f, 0xfb33, 0xfb9e, 0xfd8f,
+	0x01a1, 0x006d, 0x0302, 0x01ce, 0xff00, 0x03d0, 0x0291, 0x01eb,
+	0x02a1, 0x01d9, 0x0099, 0x009b, 0x0104, 0xfe6f, 0x013a, 0x016c,
+	0xfd63, 0xfd70, 0xfb31, 0x0070, 0x08f3, 0x066e, 0x0089, 0xfcc8,
+	0x00ab, 0x03d0, 0x026c, 0x000e, 0xfb3a, 0xfcf4, 0x0014, 0xfe45,
+	0xf9c8, 0xf9e2, 0xfdda, 0xfebc, 0x0183, 0xfbff, 0xf707, 0xfd44,
+	0x00a3, 0xffc5, 0xffa0, 0x00d3, 0x02de, 0x06f1, 0x0576, 0xfe9b,
+	0xfce2, 0x0164, 0x05a6, 0x035f, 0xfc64, 0xfa94, 0xff4e, 0x069f,
+	0x07f1, 0x00a7, 0xfe33, 0xfe65, 0x033d, 0x0868, 0x0253, 0xff27,
+	0x0271, 0x046a, 0x00ad, 0xfbc4, 0xf973, 0xf9c4, 0xfe02, 0xfb48,
+	0xf6c3, 0xfb25, 0x0266, 0x0405, 0xfea9, 0xf9d5, 0xfa09, 0xffb2,
+	0x0514, 0x004a, 0xfb6a, 0xffe0, 0x0564, 0x0b1b, 0x068a, 0xf8d1,
+	0xf5f3, 0xff11, 0x082f, 0x0416, 0xfba1, 0xfa3a, 0xfed0, 0x0607,
+	0x049f, 0xfefa, 0xfe75, 0x0193, 0x0609, 0x0959, 0x06fe, 0xfe23,
+	0xfd49, 0x04b1, 0x08d8, 0x0540, 0xfba2, 0xf636, 0xfc64, 0x0571,
+	0x02d2, 0xfb1c, 0xf831, 0xfb65, 0xfeb5, 0xfc7d, 0xf754, 0xf7a2,
+	0x0048, 0x0509, 0x0547, 0x0319, 0xfd86, 0xfc6c, 0x032c, 0x07bc,
+	0x0281, 0xfd4e, 0xfa3e, 0xff37, 0x0420, 0xfefb, 0xf5dc, 0xeefd,
+	0xf7d0, 0xfeca, 0x00d5, 0xfeec, 0xfc0a, 0x02a9, 0x050f, 0x05d7,
+	0x05a3, 0x09ae, 0x11ff, 0x1505, 0x107c, 0x0544, 0x0305, 0x08c5,
+	0x0a12, 0x022f, 0xf50a, 0xf102, 0xf3da, 0xf4c2, 0xee49, 0xe40b,
+	0xeda5, 0x0653, 0x197f, 0x2153, 0x0f6b, 0xfe56, 0xff0f, 0x0684,
+	0x09ff, 0xf7a8, 0xe798, 0xe277, 0xe841, 0xee6c, 0xe81e, 0xe420,
+	0xe5d8, 0xf48d, 0x032d, 0x0baf, 0x1185, 0x12ac, 0x18b2, 0x197d,
+	0x1b29, 0x1bdf, 0x1613, 0x12dd, 0x0a6b, 0x0253, 0xfab3, 0xfc57,
+	0x090f, 0x0d6a, 0x0530, 0xf5d1, 0xed85, 0xf2a3, 0xf2ff, 0xe4a8,
+	0xde48, 0xf459, 0x1a49, 0x319d, 0x250d, 0x04d4, 0xf6d7, 0x015d,
+	0x0b91, 0xfea6, 0xe402, 0xd6ff, 0xdf34, 0xe9a1, 0xe36c, 0xcc90,
+	0xc5af, 0xdf03, 0x044b, 0x1f63, 0x1c96, 0x10ff, 0x179f, 0x2778,
+	0x3033, 0x284a, 0x18e0, 0x141a, 0x1477, 0x1095, 0xfcf7, 0xea60,
+	0xf36c, 0x05e4, 0x0e0f, 0x00c9, 0xf1ad, 0xf154, 0xf505, 0xeddc,
+	0xdbe4, 0xec52, 0x1020, 0x2ed0, 0x3123, 0x068d, 0xf41a, 0xfca3,
+	0x0ff9, 0x0b2c, 0xe633, 0xd3fe, 0xd5b2, 0xe8cc, 0xea58, 0xd257,
+	0xbf9d, 0xcab9, 0xf2d9, 0x184a, 0x2741, 0x1d61, 0x19eb, 0x242f,
+	0x2bb1, 0x2b33, 0x2076, 0x19df, 0x1741, 0x0eec, 0xfd3c, 0xec0e,
+	0xed44, 0xfb13, 0x02d4, 0xfc88, 0xf303, 0xf43f, 0xf669, 0xec99,
+	0xdaaf, 0xe5b5, 0x1146, 0x3222, 0x39de, 0x1931, 0xfce3, 0xfe85,
+	0x08a3, 0x0b96, 0xf2b8, 0xe1c4, 0xdbc6, 0xdda3, 0xde8a, 0xd0d1,
+	0xca8b, 0xcbf0, 0xdf5f, 0xfdb2, 0x1a12, 0x2b2f, 0x29e0, 0x275e,
+	0x2398, 0x24bd, 0x2647, 0x222a, 0x1a43, 0x0b58, 0xfc80, 0xf010,
+	0xef46, 0xf644, 0xf802, 0xf41e, 0xf4d3, 0xfa2e, 0xf912, 0xe977,
+	0xd302, 0xe27e, 0x1264, 0x3808, 0x3efa, 0x1ff1, 0x0553, 0xffce,
+	0x0883, 0x0eee, 0xfd98, 0xeac0, 0xd9b2, 0xd4a3, 0xd986, 0xd957,
+	0xd831, 0xd117, 0xd401, 0xe979, 0x0fc7, 0x3053, 0x313d, 0x2524,
+	0x1981, 0x1b35, 0x23a1, 0x238b, 0x1b84, 0x094f, 0xfbb5, 0xf4f7,
+	0xf48f, 0xf7f8, 0xf538, 0xf006, 0xef9c, 0xfbd9, 0x02a7, 0xf936,
+	0xdcf1, 0xccfb, 0xf223, 0x24bb, 0x483c, 0x3e64, 0x142c, 0xfb31,
+	0xf644, 0x0cc9, 0x13e2, 0x02a3, 0xe6e8, 0xcacf, 0xcdb6, 0xd8e5,
+	0xe0f4, 0xdaf0, 0xd4cd, 0xe162, 0xfada, 0x1e5a, 0x2cc2, 0x2a5e,
+	0x21bf, 0x1918, 0x1999, 0x1998, 0x1901, 0x0fad, 0x0287, 0xfaf5,
+	0xf815, 0xfbd2, 0xfb62, 0xf4d8, 0xefb7, 0xf196, 0xfd85, 0x00ad,
+	0xf2e9, 0xd786, 0xd01f, 0xf803, 0x281c, 0x4697, 0x392e, 0x10e3,
+	0xf96c, 0xf8ac, 0x0f84, 0x1385, 0x0340, 0xe81b, 0xcf45, 0xd23e,
+	0xd7f5, 0xdf35, 0xdb25, 0xd81d, 0xe83e, 0x0216, 0x216c, 0x2a11,
+	0x25c7, 0x1e2d, 0x1793, 0x19b3, 0x1843, 0x1413, 0x07fa, 0xfe03,
+	0xfd1a, 0xfff4, 0x0548, 0xfe70, 0xf291, 0xed47, 0xf0e8, 0xffec,
+	0x01a1, 0xf058, 0xd616, 0xcefd, 0xf60c, 0x2553, 0x42bb, 0x387a,
+	0x1144, 0xf97b, 0xfa48, 0x1008, 0x15e8, 0x01db, 0xe345, 0xce2e,
+	0xd4af, 0xe0a9, 0xe78e, 0xdff8, 0xd866, 0xe683, 0x02d8, 0x20fd,
+	0x2897, 0x21f3, 0x180f, 0x128a, 0x16ff, 0x1735, 0x1292, 0x0496,
+	0xf979, 0xfa0a, 0x025d, 0x0c4a, 0x05db, 0xf864, 0xee34, 0xf045,
+	0x009a, 0x07ae, 0xfd47, 0xe13a, 0xcb3c, 0xdbf8, 0x081e, 0x348e,
+	0x411f, 0x253b, 0x055d, 0xf71d, 0x037d, 0x13c0, 0x0b16, 0xf1af,
+	0xd36e, 0xcd46, 0xdc14, 0xebf4, 0xee8f, 0xe272, 0xe24c, 0xf2cb,
+	0x10a2, 0x237b, 0x2213, 0x186f, 0x0ce2, 0x10e5, 0x161d, 0x14d2,
+	0x0b72, 0xfc1c, 0xf8cb, 0xfc59, 0x0700, 0x0bda, 0x0572, 0xfb89,
+	0xf3c4, 0xf92f, 0x0142, 0x068a, 0xfcc5, 0xe640, 0xd5ef, 0xd9a8,
+	0xfe11, 0x24fa, 0x36cf, 0x2a67, 0x0dfa, 0xffe4, 0xff8b, 0x08b3,
+	0x03fe, 0xf0d3, 0xdd2e, 0xd429, 0xdf8e, 0xeb18, 0xf0fd, 0xecd8,
+	0xeaf4, 0xf75d, 0x0854, 0x1ab6, 0x1bb1, 0x1251, 0x0ab8, 0x0a41,
+	0x14d4, 0x14bd, 0x0d87, 0x0197, 0xf819, 0xfba6, 0x0110, 0x0930,
+	0x093e, 0x0428, 0xff61, 0xfb08, 0xfeec, 0x00ab, 0xff75, 0xf2ba,
+	0xe35f, 0xdd94, 0xea69, 0x0bee, 0x239e, 0x2ccb, 0x1d98, 0x0950,
+	0x0128, 0xfdc2, 0x0143, 0xf699, 0xeb41, 0xe232, 0xe05d, 0xe858,
+	0xeaae, 0xf022, 0xf068, 0xf693, 0x00e4, 0x0b58, 0x146a, 0x0ff3,
+	0x0cd9, 0x09f4, 0x0d77, 0x1460, 0x1223, 0x0a32, 0xfe66, 0xf81c,
+	0xfa37, 0x023a, 0x0a4c, 0x0adc, 0x0706, 0x0287, 0x0181, 0x00a9,
+	0xfd44, 0xf8c6, 0xf0e4, 0xebbb, 0xe70e, 0xedad, 0x041d, 0x1853,
+	0x232a, 0x1975, 0x095e, 0x0104, 0xfe84, 0xffd6, 0xf7bf, 0xefea,
+	0xea99, 0xe879, 0xe8f0, 0xe7fa, 0xebef, 0xf054, 0xf79d, 0xfdff,
+	0x05bb, 0x0eef, 0x117e, 0x1205, 0x0fd8, 0x10f2, 0x1371, 0x1141,
+	0x09c5, 0xfd1a, 0xf6ec, 0xf750, 0xfe60, 0x0610, 0x073e, 0x0690,
+	0x0322, 0x03a1, 0x040d, 0x021d, 0xfea9, 0xf80e, 0xf3ce, 0xf016,
+	0xef95, 0xf94e, 0x09a5, 0x1712, 0x1759, 0x0a08, 0xff5d, 0xfe69,
+	0x02a8, 0x0180, 0xf70f, 0xef36, 0xec9d, 0xee7e, 0xec73, 0xe77e,
+	0xe7a6, 0xedfe, 0xfa58, 0x0268, 0x08f4, 0x0dbd, 0x124d, 0x1671,
+	0x15dd, 0x1497, 0x1046, 0x0c49, 0x03f5, 0xfb91, 0xf73e, 0xf7c6,
+	0xfee4, 0x02e8, 0x03ff, 0x0133, 0x00e7, 0x03f3, 0x04c1, 0x0335,
+	0xfe39, 0xfa69, 0xf80e, 0xf726, 0xf879, 0xff5b, 0x0858, 0x0cc3,
+	0x0a44, 0x01da, 0xfe58, 0x002a, 0x034e, 0x00e3, 0xf89b, 0xf238,
+	0xefbe, 0xf06c, 0xede1, 0xe915, 0xe8dc, 0xf140, 0xfd88, 0x0596,
+	0x0804, 0x0997, 0x0d9d, 0x13e0, 0x16e9, 0x1372, 0x0e69, 0x07fc,
+	0x0222, 0xfcb9, 0xf887, 0xfa90, 0xfedd, 0x02c1, 0x0153, 0xfe39,
+	0xfefb, 0x02d6, 0x07a9, 0x062a, 0x023e, 0xfdd5, 0xfd62, 0xfff3,
+	0xff9f, 0xff83, 0xfdf3, 0xfd5d, 0xfd77, 0xfbcb, 0xfb0c, 0xfbc0,
+	0xfde9, 0xff58, 0xfea8, 0xfbb6, 0xf834, 0xf701, 0xf713, 0xf892,
+	0xf9f6, 0xfbfd, 0xfdd1, 0xfedc, 0xffa3, 0x00e9, 0x0465, 0x08e5,
+	0x0bb5, 0x0a8c, 0x077e, 0x047a, 0x02d1, 0x024d, 0x0250, 0x0326,
+	0x036d, 0x02be, 0x0173, 0x010f, 0x01e6, 0x0299, 0x02c5, 0x01a6,
+	0x0061, 0xffc7, 0x00b9, 0x0201, 0x01e9, 0x0052, 0xfd1b, 0xfa79,
+	0xf9a9, 0xfa72, 0xfb37, 0xfb5d, 0xfaa0, 0xfa59, 0xfb09, 0xfc2e,
+	0xfd28, 0xfd88, 0xfe14, 0xfecd, 0x0015, 0x00b5, 0x0072, 0xfff8,
+	0x0056, 0x01bc, 0x026a, 0x029b, 0x01f7, 0x01fd, 0x0234, 0x017a,
+	0x00f8, 0x0081, 0x015a, 0x026c, 0x02f1, 0x0255, 0x0167, 0x01c4,
+	0x0273, 0x032a, 0x02fd, 0x02f5, 0x038c, 0x0481, 0x050b, 0x03bb,
+	0x0182, 0xffe7, 0xfe9e, 0xfdd3, 0xfc22, 0xf9e4, 0xf870, 0xf7af,
+	0xf870, 0xfa06, 0xfc27, 0xfd94, 0xfe00, 0xfdf3, 0xfdf7, 0xff3b,
+	0x0097, 0x0178, 0x0116, 0xffbf, 0xff37, 0xfee3, 0xff4d, 0xffcf,
+	0x003e, 0x00e8, 0x00f7, 0x0145, 0x0202, 0x0374, 0x04be, 0x048d,
+	0x0363, 0x015f, 0x0087, 0x013e, 0x01bb, 0x017f, 0x0069, 0x0054,
+	0x0169, 0x026f, 0x02e6, 0x020b, 0x0180, 0x011a, 0x00b0, 0x0030,
+	0xfe31, 0xfcd7, 0xfc04, 0xfc24, 0xfcc5, 0xfc16, 0xfc67, 0xfc7d,
+	0xfcc9, 0xfdf4, 0xfecf, 0xffe6, 0x0068, 0x0051, 0xffb8, 0xffa6,
+	0x0032, 0x00bf, 0x00f1, 0x000d, 0xff92, 0xffa2, 0x00a4, 0x01f0,
+	0x0297, 0x029c, 0x01c5, 0x0190, 0x01c4, 0x01f2, 0x0177, 0x006a,
+	0xffe8, 0xffa7, 0x0033, 0x00ca, 0x0114, 0x0128, 0x005b, 0xfffb,
+	0x0018, 0x0004, 0x002d, 0xff88, 0xfef4, 0xfe80, 0xfe51, 0xfe91,
+	0xfe59, 0xfe86, 0xfebf, 0xfec0, 0xfee1, 0xfeff, 0xff9a, 0x002f,
+	0x0072, 0x010f, 0x0152, 0x012f, 0x0047, 0xff6e, 0xff86, 0xffe8,
+	0x008f, 0x0091, 0xffb9, 0xff47, 0xff69, 0x0073, 0x00d2, 0x0006,
+	0xff53, 0xfebc, 0xfef3, 0xff4b, 0xffa5, 0x0041, 0x0088, 0x00fc,
+	0x0146, 0x011e, 0x0095, 0x001c, 0x0061, 0x0091, 0x0090, 0xffec,
+	0xff40, 0xff19, 0xff2b, 0xff8e, 0xff83, 0xff2f, 0xfed4, 0xfed6,
+	0xff47, 0x0054, 0x0139, 0x01da, 0x01ae, 0x00ff, 0x008d, 0x0045,
+	0x0096, 0x00f7, 0x00be, 0xffe5, 0xfea8, 0xfdd3, 0xfe23, 0xfee3,
+	0xff9f, 0xffcd, 0xff7b, 0xff0e, 0xff0b, 0xffac, 0x004f, 0x00a4,
+	0x00c2, 0x012a, 0x0171, 0x01a4, 0x01a8, 0x013a, 0x007b, 0x0001,
+	0xffa4, 0xff54, 0xff17, 0xfee9, 0xff40, 0xffab, 0xffd9, 0xfffd,
+	0xffd2, 0xffc3, 0xffc7, 0x0077, 0x012b, 0x015e, 0x012b, 0x0095,
+	0x0005, 0xffb1, 0xffdb, 0x0033, 0xffe9, 0xff2a, 0xfe6e, 0xfe08,
+	0xfe95, 0xff44, 0x0037, 0x006c, 0xffa4, 0xff41, 0xff78, 0x0065,
+	0x00b6, 0x00da, 0x0072, 0x0027, 0x0081, 0x00fd, 0x0132, 0x008c,
+	0xffb5, 0xff74, 0xffb9, 0x0010, 0xffef, 0xff93, 0xff6a, 0xff79,
+	0xffb8, 0x0017, 0x000b, 0x0056, 0x00eb, 0x0157, 0x0174, 0x0119,
+	0x0058, 0xff3a, 0xfeaa, 0xfe9e, 0xff3d, 0xffbb, 0xffca, 0xff5f,
+	0xfedf, 0xfe9f, 0xfec8, 0xff86, 0xffde, 0x0022, 0xfff2, 0x0005,
+	0x002c, 0x0058, 0x0098, 0x004e, 0x0005, 0xffdd, 0x0041, 0x00a0,
+	0x00a1, 0x0093, 0x004a, 0x0026, 0x0018, 0xffe9, 0xffd5, 0xffbf,
+	0xffda, 0xffcd, 0xff91, 0xff41, 0xff5c, 0xfffc, 0x00cc, 0x011e,
+	0x0143, 0x00d6, 0xffd8, 0xff57, 0xff8a, 0xfffd, 0x005f, 0x0051,
+	0x0071, 0xfffe, 0xff7c, 0xff18, 0xff30, 0x0008, 0x0001, 0x0019,
+	0xffc7, 0xffb8, 0x0053, 0x00af, 0x00e6, 0x0051, 0x000e, 0x0007,
+	0x0042, 0x0080, 0x0037, 0x0062, 0x0055, 0x0047, 0x0019, 0xff84,
+	0xff4a, 0xff84, 0xff89, 0xff52, 0xff0a, 0xfec2, 0xff3b, 0xffac,
+	0x003d, 0x00de, 0x013d, 0x00cc, 0xfff5, 0xff60, 0xff4b, 0xffd6,
+	0x0071, 0x00a6, 0x0024, 0x0010, 0x000d, 0x0086, 0x008f, 0x0018,
+	0xff9c, 0xff54, 0xffee, 0x000d, 0x0083, 0x00ce, 0x008a, 0x00be,
+	0x002c, 0xffb0, 0xff88, 0xffca, 0x0063, 0x0043, 0x009b, 0x00bf,
+	0x00d0, 0x00c1, 0xffbb, 0xfe69, 0xfda5, 0xfd90, 0xfe6f, 0xfef3,
+	0xff0c, 0xfee3, 0xff6a, 0xffff, 0xffcf, 0xffac, 0xffbd, 0x0002,
+	0x0019, 0x00a3, 0x00bf, 0x0065, 0x002c, 0x004d, 0x00c2, 0x00ee,
+	0x00c7, 0x0007, 0x0028, 0x0072, 0x0011, 0x0066, 0x0078, 0x007e,
+	0x0007, 0xffbf, 0xffb1, 0xffc2, 0x00ce, 0x0095, 0x000e, 0xffd1,
+	0xffac, 0x0008, 0x009c, 0x00fe, 0x0025, 0xff4c, 0xfee0, 0xfec4,
+	0xffd6, 0x0033, 0xff7a, 0xff95, 0xff5d, 0xff2b, 0xff35, 0xffd7,
+	0x00b6, 0x00bb, 0x00b4, 0xffa2, 0xff9b, 0x0075, 0xffff, 0x0031,
+	0x0086, 0x0158, 0x015f, 0x0039, 0xffdd, 0xff91, 0x0061, 0x0063,
+	0xffd1, 0x0047, 0x0031, 0xffbf, 0xff1f, 0xff41, 0xffd5, 0x0075,
+	0x00a9, 0x006c, 0x000c, 0x0008, 0xffe9, 0xfee8, 0xffec, 0x0051,
+	0xffb2, 0xfe7e, 0xfd93, 0x0071, 0x02ff, 0x034e, 0xfd97, 0xfb1b,
+	0xfec1, 0x005a, 0x026e, 0x014e, 0xff5a, 0xff7a, 0x0014, 0x0031,
+	0x0040, 0x004c, 0xffe0, 0xffea, 0x029e, 0x045a, 0x0221, 0x00f2,
+	0xfce6, 0xfd1b, 0x010b, 0x0072, 0xff93, 0xfd44, 0xfcd3, 0xfd4f,
+	0xff01, 0x0025, 0xff9f, 0x00a2, 0x00aa, 0x013f, 0x0165, 0x0187,
+	0x0070, 0xff6c, 0xffc5, 0xffca, 0xffba, 0xff4b, 0xff62, 0xfeb9,
+	0xfecb, 0xfe67, 0xfe6b, 0x001f, 0x0137, 0x012e, 0x006f, 0x0082,
+	0x00eb, 0x016e, 0x01ee, 0x00f8, 0x002b, 0xfff7, 0x0008, 0x00a7,
+	0x0095, 0xff8d, 0xff27, 0xffd0, 0x0008, 0xfffd, 0xffcc, 0xfef8,
+	0xfea2, 0xff28, 0xffb7, 0xff7b, 0x0007, 0x00b3, 0x00ba, 0x00a1,
+	0xffbe, 0xff6a, 0xfff0, 0x0057, 0xffe0, 0x005d, 0x00ee, 0x005a,
+	0x0016, 0xff6b, 0xff50, 0xffc2, 0x0027, 0x0000, 0x0018, 0x006a,
+	0x0007, 0x0021, 0x003e, 0x0060, 0x0068, 0xffe7, 0xff99, 0xffe8,
+	0x0074, 0x0060, 0xff9e, 0xff8f, 0x005f, 0xffd8, 0xff1f, 0xfee7,
+	0xff55, 0x006d, 0x007f, 0xfffe, 0xffd1, 0xfff8, 0x0040, 0xffdf,
+	0xfff2, 0x008c, 0x0099, 0x00b7, 0x0078, 0xffd8, 0xffdd, 0xffcd,
+	0xffac, 0xffd1, 0x0004, 0x0024, 0x009a, 0x00b2, 0xff97, 0xfefc,
+	0xffe3, 0x0038, 0x0073, 0x00ce, 0x00de, 0x018a, 0x00cc, 0xfefd,
+	0xfdb5, 0xfe11, 0xfed5, 0xfecb, 0xffa1, 0xffd8, 0xffca, 0x002d,
+	0xff1f, 0xfe9a, 0xff72, 0x004c, 0x00d2, 0x0096, 0xffc5, 0xff87,
+	0x0052, 0x0096, 0x00ec, 0x0105, 0x0087, 0xffe7, 0xfff3, 0xffb3,
+	0xfeb7, 0xffbd, 0x00ca, 0x011a, 0x0113, 0x0024, 0xff69, 0xff33,
+	0xff79, 0xffd0, 0x00a0, 0x00f8, 0x0044, 0x0054, 0x00b8, 0x0019,
+	0xffbd, 0xff5f, 0xff3a, 0xff42, 0xff24, 0x007e, 0x01a0, 0x011c,
+	0x0018, 0xfea0, 0xfe51, 0x0039, 0x0103, 0x0092, 0x00df, 0x0041,
+	0xffad, 0x0033, 0xff5f, 0xfe59, 0xffb7, 0x007f, 0x008d, 0x0136,
+	0x0092, 0xff98, 0xfffb, 0x006b, 0x001b, 0xfffa, 0x002a, 0xff6d,
+	0xfedc, 0xff79, 0xff85, 0x005e, 0x00d2, 0xff7c, 0xff4d, 0xffa9,
+	0x0009, 0x00eb, 0x013e, 0x0062, 0xffcc, 0xff01, 0xfdc9, 0xff82,
+	0x0128, 0x00ff, 0xffed, 0xff05, 0x0085, 0x0118, 0x00ef, 0x0070,
+	0xff60, 0xff56, 0xff69, 0xfffb, 0x014e, 0x0159, 0x0011, 0xfed4,
+	0xff7d, 0x00d8, 0x0009, 0xffb0, 0xfffb, 0x0081, 0x00b7, 0x0121,
+	0x0032, 0xfec4, 0xff05, 0xfdb9, 0xfddc, 0xfeae, 0xfd9c, 0xfec1,
+	0xffdd, 0xff74, 0x0078, 0x018a, 0x00f4, 0x0014, 0x006a, 0xff87,
+	0x0067, 0x0295, 0x01f5, 0xffc8, 0xfe11, 0xfecb, 0xffae, 0x0096,
+	0x0095, 0xff8d, 0xffc0, 0x008a, 0x008d, 0x017b, 0x0276, 0xffbc,
+	0xfe12, 0xff10, 0xffb1, 0x0109, 0x01f9, 0x0043, 0xffca, 0x0000,
+	0xff7c, 0xfed2, 0xfc80, 0xfd85, 0x01f6, 0x0819, 0x071f, 0xfebc,
+	0xf8e2, 0xf8b7, 0xfe2f, 0x0000, 0xfff5, 0xff12, 0xffac, 0x0155,
+	0xff44, 0xff2c, 0x0030, 0x01c6, 0x032e, 0x03dc, 0x0399, 0x0280,
+	0x0174, 0xffd1, 0xfedf, 0xfd97, 0xfe62, 0xff1c, 0xfe54, 0xfd45,
+	0xfc78, 0xff04, 0x01b8, 0x01ef, 0x004d, 0xffe9, 0x01a9, 0x0248,
+	0x0231, 0x0054, 0xfdd5, 0xfecb, 0xff5f, 0xfffc, 0x007c, 0xff4f,
+	0xfe6a, 0xff43, 0x00a2, 0xfff0, 0xffc1, 0xffca, 0x0025, 0x0195,
+	0x016e, 0xfee7, 0xfed2, 0x0017, 0xff8d, 0xffae, 0x001f, 0x0061,
+	0x0023, 0x011c, 0x0189, 0x0130, 0x0069, 0xff28, 0xffda, 0x012e,
+	0x0303, 0x01df, 0xfedf, 0xfd30, 0xfbcb, 0xfc93, 0xfe44, 0xff66,
+	0x008c, 0x0266, 0x01e5, 0xff3f, 0xfe16, 0xfe25, 0xfeec, 0xffc7,
+	0x0023, 0x00a9, 0x01c4, 0x01ed, 0xff41, 0xfdd0, 0xff42, 0xffdb,
+	0x00a7, 0x0171, 0x006a, 0x004d, 0x0250, 0x01dc, 0x0063, 0xff4e,
+	0xfdca, 0xfdcd, 0x0050, 0x01a7, 0x00a8, 0xff6a, 0xfdc9, 0xff65,
+	0x012a, 0x0115, 0xff8c, 0xff53, 0x0135, 0x00b7, 0x00a2, 0xfffc,
+	0x0016, 0x0122, 0x009d, 0xff1a, 0xfe6c, 0xff97, 0xfe92, 0xfeb4,
+	0x0062, 0x0020, 0xffd1, 0xff6c, 0xff45, 0xfec0, 0xff9d, 0x00fa,
+	0x01fb, 0x0313, 0x0163, 0xffd1, 0xffb8, 0x0089, 0x0011, 0xffd4,
+	0x01cf, 0x0187, 0x00e8, 0xffea, 0xfe4f, 0xfeaf, 0xffc6, 0xffc4,
+	0xff57, 0xffed, 0xff12, 0xfe55, 0xffb3, 0x0047, 0xfffb, 0x001a,
+	0x009b, 0xff83, 0xff79, 0x00f1, 0x0029, 0xffe3, 0xff90, 0xfedd,
+	0xff4b, 0xff4e, 0xfeb8, 0xff8b, 0x011a, 0xffc5, 0xff50, 0x00ef,
+	0x00cd, 0xffdc, 0xffa2, 0x011f, 0x0135, 0x0076, 0x0059, 0xff5b,
+	0x0167, 0x027e, 0x010e, 0x0084, 0x00a5, 0x009a, 0xff0d, 0xfe7e,
+	0xfe8f, 0x0110, 0x03d6, 0x0024, 0xfc1e, 0xfd31, 0xff9d, 0xffa1,
+	0xfe3a, 0xff32, 0x01e3, 0x054c, 0x01f7, 0xfa7c, 0xfa61, 0xfd19,
+	0x0057, 0x00fd, 0x005a, 0xfe17, 0xfd93, 0xff9a, 0xfd8e, 0xfd87,
+	0xfe33, 0x00bb, 0x02ba, 0x0417, 0x0379, 0x029c, 0x031c, 0x00dc,
+	0x0067, 0xffb5, 0xffd3, 0xfdd1, 0xfcfa, 0xffaa, 0x0140, 0x0305,
+	0x01ea, 0x00a3, 0x00d3, 0x01d9, 0x0056, 0xfee9, 0x0129, 0x02fe,
+	0x0404, 0x02a6, 0xff8c, 0xfdf8, 0xfef2, 0xff56, 0xfe6e, 0xfef2,
+	0xfe9e, 0xfce3, 0xfdc7, 0xfe6f, 0xfde0, 0xfe78, 0xfd59, 0xfaf9,
+	0xfdcc, 0x0221, 0x0285, 0x0273, 0x002b, 0xfc8e, 0xfd80, 0x004f,
+	0x00d0, 0x005c, 0xfdec, 0xff20, 0x040d, 0x06ae, 0x0392, 0xfbf3,
+	0xfbc7, 0xfebd, 0x01d3, 0x00e0, 0xfde3, 0x002b, 0x0327, 0x0732,
+	0x0465, 0x0341, 0x049f, 0x03b5, 0x01ec, 0xfe8e, 0xfe7b, 0xfec7,
+	0x0206, 0x0184, 0x0060, 0x00c8, 0xfded, 0xfc8c, 0xfc65, 0xfd0a,
+	0xf8c7, 0xf791, 0xfd16, 0x0203, 0x0428, 0xff69, 0xfbe6, 0xff2a,
+	0x025e, 0xff83, 0xf9c7, 0xfac7, 0xfffd, 0x0221, 0xfe74, 0xfa12,
+	0xfeb5, 0x02d5, 0x004d, 0xf976, 0xf9a9, 0x042b, 0x0901, 0x0720,
+	0x00b4, 0xfeda, 0x01dc, 0x0455, 0x05d1, 0x082d, 0x0cc8, 0x09c1,
+	0x041b, 0x0130, 0x006a, 0x0032, 0x00c8, 0x00fe, 0x0234, 0x0062,
+	0xf714, 0xefab, 0xf135, 0xfb9b, 0x0259, 0x0720, 0x0a3d, 0x08db,
+	0x0491, 0xf828, 0xee40, 0xf11c, 0xf815, 0xfc57, 0xfe95, 0xff0d,
+	0x001d, 0xfb68, 0xf3c1, 0xefe9, 0xf3c3, 0x00da, 0x09c7, 0x0ddc,
+	0x0e3d, 0x09f6, 0x05ca, 0x031b, 0x06e7, 0x0bb0, 0x0c61, 0x0b17,
+	0x060d, 0x0509, 0x03c4, 0xfc0e, 0xf8ec, 0xfc50, 0x02d4, 0x0563,
+	0x0201, 0xfe70, 0xfe2a, 0x00de, 0x0032, 0xfb69, 0xf924, 0xf544,
+	0xee63, 0xf498, 0x010d, 0x11c1, 0x1b00, 0x0d32, 0xfca6, 0xf1ba,
+	0xf175, 0xeefa, 0xec35, 0xf312, 0xf9c0, 0x0371, 0x0188, 0xf7f5,
+	0xf3c5, 0xf21f, 0xf60a, 0xfa75, 0x0286, 0x0f60, 0x152b, 0x1666,
+	0x1226, 0x0b26, 0x0a61, 0x07bd, 0x079b, 0x097d, 0x0a2a, 0x0a97,
+	0x0567, 0x0111, 0xfaa2, 0xf436, 0xf3bf, 0xf423, 0xf82b, 0xfe85,
+	0x03a5, 0x08a4, 0x0721, 0x007e, 0xfbf8, 0xf997, 0xf47e, 0xe467,
+	0xe3a0, 0xfd9e, 0x209f, 0x3368, 0x1a2e, 0xf466, 0xe379, 0xe9a9,
+	0xf335, 0xeb92, 0xecc8, 0xfe15, 0x0e54, 0x0cd3, 0xf25a, 0xe5af,
+	0xef1d, 0xfa79, 0xfea3, 0xff17, 0x0aab, 0x1686, 0x14ee, 0x0824,
+	0x0493, 0x1051, 0x18b4, 0x0d01, 0x02fb, 0x0550, 0x09bc, 0x0aaa,
+	0xffa3, 0xfef2, 0x045b, 0x04ec, 0xf7d3, 0xe7a8, 0xef75, 0x005b,
+	0x0c8f, 0x0789, 0xfa7b, 0xfa13, 0x033b, 0x0349, 0xeb85, 0xd024,
+	0xd7d6, 0x062b, 0x37b5, 0x3fd5, 0x14c2, 0xeacf, 0xde61, 0xe82e,
+	0xf1a3, 0xed5e, 0xf55c, 0x09f9, 0x18f1, 0x0a64, 0xe8d9, 0xdc81,
+	0xe64e, 0xf718, 0x0197, 0x0732, 0x10a4, 0x194c, 0x13ab, 0x0733,
+	0x002e, 0x00ff, 0x0940, 0x116c, 0x1b0f, 0x19d9, 0x0d47, 0xfef4,
+	0xf522, 0xfc49, 0x0402, 0x03e4, 0xff53, 0xf96c, 0xf7c5, 0xf401,
+	0xf539, 0xf85c, 0xfc58, 0x009b, 0x00b8, 0x0324, 0xfbe7, 0xe711,
+	0xce4e, 0xd6f4, 0x10aa, 0x47b7, 0x4be0, 0x1539, 0xd79f, 0xcaaf,
+	0xe77a, 0xfd42, 0xfc31, 0xfbed, 0x0ce8, 0x1e5d, 0x0ad3, 0xe21e,
+	0xcd94, 0xe0c6, 0x0027, 0x0be4, 0x0b5c, 0x0c03, 0x157e, 0x16e6,
+	0x07f2, 0xf90b, 0xf9ea, 0x08da, 0x1696, 0x1a0c, 0x1856, 0x1275,
+	0x055d, 0xf3fc, 0xea71, 0xf31d, 0x048a, 0x1030, 0x0a27, 0xfcf2,
+	0xf2e5, 0xee67, 0xf189, 0xf546, 0xf801, 0xfc88, 0x0461, 0x0c72,
+	0xff82, 0xdb08, 0xc3a8, 0xe46f, 0x30f6, 0x52b6, 0x2f2a, 0xebbb,
+	0xcbbb, 0xe56d, 0xffd7, 0xfbed, 0xf31e, 0x0ca4, 0x2cd2, 0x25cf,
+	0xf1c0, 0xc80d, 0xd1cb, 0xf846, 0x10c6, 0x0a05, 0x038c, 0x091e,
+	0x0ede, 0x04d4, 0xf6ad, 0xfdb9, 0x135e, 0x1f38, 0x12de, 0x00d5,
+	0xfb89, 0x025b, 0x07b7, 0x03a8, 0x0117, 0x0164, 0x0335, 0x0014,
+	0xfa21, 0xfc8a, 0xfe05, 0xf764, 0xe9e0, 0xe5ab, 0xf5b9, 0x0a2e,
+	0x0e17, 0xff0d, 0xf7c1, 0xfeee, 0xfcdf, 0xe467, 0xcf24, 0xede1,
+	0x2fb0, 0x4e27, 0x2974, 0xe696, 0xcdb9, 0xe910, 0x09be, 0x0a04,
+	0xfb71, 0x09da, 0x236b, 0x1cd7, 0xf0ff, 0xcc78, 0xd71c, 0xfd6d,
+	0x12f2, 0x0c8c, 0x040f, 0x079d, 0x0737, 0xfac3, 0xf3a3, 0x0263,
+	0x19bb, 0x1ea6, 0x0c93, 0xf848, 0xf426, 0xf78a, 0xf9cb, 0xfe43,
+	0x0c7b, 0x1c49, 0x14dd, 0xf97a, 0xe0a8, 0xe1e7, 0xf6db, 0x02a8,
+	0xffe4, 0xfbbc, 0xff76, 0x04cd, 0x01eb, 0xf673, 0xed9e, 0xf2c8,
+	0x0419, 0x128f, 0x0b81, 0xec58, 0xd5c6, 0xedf5, 0x28e3, 0x4643,
+	0x28df, 0xeddd, 0xd120, 0xe9cb, 0x072e, 0x085f, 0xfa71, 0x04ef,
+	0x1b2c, 0x1a32, 0xf7e2, 0xd487, 0xdce8, 0xfd0a, 0x13bf, 0x0e48,
+	0x030c, 0x060c, 0x09c6, 0x02bf, 0xf3c4, 0xf424, 0x0801, 0x15a6,
+	0x1094, 0x0060, 0xf5aa, 0xf8b5, 0xfe0d, 0x00e4, 0xfeeb, 0xff08,
+	0x0517, 0x05a2, 0xfdf6, 0xf47a, 0xef60, 0xf493, 0x00e4, 0x07d9,
+	0x0764, 0x002b, 0xf851, 0xf32b, 0xf482, 0xfbcf, 0x02fb, 0x0c7c,
+	0x1375, 0x110d, 0xff16, 0xe156, 0xd55e, 0xf813, 0x2e35, 0x406f,
+	0x1abb, 0xe426, 0xd235, 0xecf3, 0x0ad0, 0x07a0, 0xfec2, 0x0a01,
+	0x1aee, 0x11d1, 0xec2a, 0xd532, 0xe2b9, 0x0531, 0x177f, 0x0e8a,
+	0x044d, 0x053e, 0x059d, 0xfa6f, 0xef56, 0xf296, 0x043f, 0x10e8,
+	0x0c5f, 0x0167, 0xfb04, 0xfbb3, 0xfd0c, 0xfda7, 0xfe2e, 0x004f,
+	0x043e, 0x02e9, 0xfc6a, 0xf98e, 0xfaa8, 0xfe17, 0x0257, 0x0345,
+	0x025a, 0xff95, 0xfa60, 0xf474, 0xf62e, 0x00b1, 0x0990, 0x0e71,
+	0x0dac, 0x0812, 0xf8d3, 0xe429, 0xe1f4, 0x0048, 0x2b06, 0x34d3,
+	0x1109, 0xe53c, 0xda1e, 0xf069, 0x0516, 0x044c, 0x01de, 0x0c0f,
+	0x1497, 0x04fd, 0xe84b, 0xe024, 0xf1ce, 0x0987, 0x1027, 0x06fd,
+	0x0182, 0x042e, 0x01fb, 0xf92c, 0xf611, 0xfd6e, 0x08cc, 0x0de0,
+	0x07e2, 0xfefd, 0xfac1, 0xfa5c, 0xfd17, 0x0043, 0x0292, 0x010f,
+	0xffc3, 0x013d, 0x0027, 0xfde4, 0xf99d, 0xf7c2, 0xfdf8, 0x050e,
+	0x07d3, 0x037c, 0xfb3d, 0xf67c, 0xf734, 0x014d, 0x091a, 0x09b9,
+	0x08a3, 0x04eb, 0x0054, 0xf095, 0xe3bd, 0xee59, 0x1271, 0x32e9,
+	0x24ca, 0xf859, 0xd940, 0xdf0b, 0xfb0e, 0x0974, 0x06dd, 0x0921,
+	0x11e5, 0x0e5a, 0xf5b0, 0xe05e, 0xe5db, 0xfd99, 0x10c5, 0x1000,
+	0x06f5, 0x03fc, 0x01b0, 0xfb14, 0xf4c8, 0xf767, 0x036c, 0x0c13,
+	0x0ada, 0x03da, 0xfd64, 0xfb17, 0xf8ba, 0xfa0d, 0x005c, 0x0520,
+	0x0662, 0x01f4, 0xfcbc, 0xfa9f, 0xfae5, 0xfd1e, 0xfec3, 0x02f4,
+	0x069f, 0x04de, 0xffe0, 0xf93d, 0xf637, 0xfb17, 0x0417, 0x08ce,
+	0x09d2, 0x081e, 0x02a9, 0xf54d, 0xe5e1, 0xe8b0, 0x04ac, 0x27d9,
+	0x2957, 0x0680, 0xe2cf, 0xdd28, 0xf5b4, 0x07f7, 0x06d1, 0x0476,
+	0x0c8b, 0x125b, 0x0120, 0xe8ba, 0xe4c5, 0xf78f, 0x0c6c, 0x0df3,
+	0x05cc, 0x044f, 0x061b, 0x0060, 0xf4c9, 0xf463, 0x016d, 0x0a68,
+	0x0975, 0x028c, 0xff77, 0xff9a, 0xfb5a, 0xf8a2, 0xfbb9, 0x03ac,
+	0x06df, 0x0295, 0xff8d, 0xfe48, 0xfcd7, 0xfb7f, 0xfb8e, 0x0247,
+	0x07ed, 0x0526, 0xffb4, 0xfa45, 0xf942, 0xf975, 0xfbeb, 0x0317,
+	0x08ed, 0x0cf2, 0x0743, 0xf9ac, 0xec9f, 0xe6aa, 0xf553, 0x1114,
+	0x2638, 0x1e65, 0xfc03, 0xe54f, 0xe7e3, 0xf934, 0x03c6, 0x0361,
+	0x0b00, 0x14e6, 0x0ebc, 0xf7a1, 0xe4df, 0xeac6, 0xff24, 0x098d,
+	0x089b, 0x0751, 0x0a8f, 0x06f4, 0xf6b6, 0xee4e, 0xf5a5, 0x03e0,
+	0x0acf, 0x06f8, 0x03ca, 0x0298, 0xfecc, 0xf8a7, 0xf791, 0xff61,
+	0x0621, 0x051c, 0x01c5, 0xff13, 0xfe29, 0xfc21, 0xfb04, 0xff71,
+	0x0443, 0x059e, 0x01a0, 0xfcbd, 0xfa9a, 0xf855, 0xf981, 0xffb1,
+	0x0618, 0x0bcf, 0x0b4f, 0x026f, 0xf4da, 0xe724, 0xea4c, 0x01d0,
+	0x1e41, 0x26a4, 0x0d0e, 0xf237, 0xea4e, 0xf141, 0xfbec, 0xfdf3,
+	0x07a8, 0x13fb, 0x12de, 0x01ba, 0xebe2, 0xe9b5, 0xf53b, 0xff68,
+	0x0519, 0x07c5, 0x0bc6, 0x087c, 0xfc84, 0xf53d, 0xf6f5, 0xfe96,
+	0x0455, 0x069c, 0x08e3, 0x063a, 0xff73, 0xfa3f, 0xf95c, 0xfdf8,
+	0x0110, 0x024f, 0x0485, 0x044a, 0xff71, 0xf84e, 0xf919, 0xfe9f,
+	0x0271, 0x02b7, 0x01c3, 0x02f7, 0x000d, 0xf838, 0xf3d9, 0xfa76,
+	0x04eb, 0x0a78, 0x0abe, 0x077d, 0xffb7, 0xf050, 0xe58f, 0xf270,
+	0x1191, 0x260f, 0x1926, 0xfcfc, 0xf021, 0xf0c2, 0xf4e5, 0xf63a,
+	0xfe83, 0x1093, 0x16bc, 0x0a04, 0xf574, 0xed8e, 0xf335, 0xf840,
+	0xfcef, 0x0492, 0x0c4b, 0x0cb7, 0x037c, 0xfa71, 0xf88f, 0xf9dd,
+	0xfbdc, 0x00e5, 0x08a8, 0x0a17, 0x02a2, 0xfb64, 0xfacc, 0xfecb,
+	0xffa7, 0xff53, 0x0281, 0x058b, 0x01be, 0xf9c6, 0xf8ff, 0xfeaf,
+	0x0318, 0x0294, 0x002b, 0x010d, 0xffb6, 0xfa95, 0xf709, 0xfa94,
+	0x0290, 0x064d, 0x0991, 0x0a47, 0x0460, 0xf456, 0xe5a2, 0xef4c,
+	0x097a, 0x1f2d, 0x1bd6, 0x0568, 0xf78d, 0xf393, 0xf2b3, 0xf3cc,
+	0xfabe, 0x09f2, 0x1248, 0x0ba3, 0xfe07, 0xf4ff, 0xf3a6, 0xf464,
+	0xf83a, 0x0138, 0x08f3, 0x0a91, 0x058e, 0xff9c, 0xfd43, 0xfbe1,
+	0xfb65, 0xfee9, 0x060d, 0x0899, 0x041e, 0xff1a, 0xfd3d, 0xfdc7,
+	0xfe45, 0xffb9, 0x0389, 0x0412, 0xff91, 0xfaa0, 0xfa19, 0xfeda,
+	0x01f4, 0x020e, 0x013d, 0x0107, 0xffd3, 0xfc0e, 0xf89b, 0xf948,
+	0xfe94, 0x0424, 0x0aa7, 0x0cdc, 0x0526, 0xf570, 0xe8be, 0xeefa,
+	0x0390, 0x15e5, 0x19c9, 0x0b41, 0xfed7, 0xf94e, 0xf267, 0xf295,
+	0xf753, 0x048a, 0x0e59, 0x0ae4, 0x03c8, 0xfaf1, 0xf630, 0xf49e,
+	0xf633, 0xfd8b, 0x0434, 0x0616, 0x062c, 0x04c5, 0x029c, 0xfe69,
+	0xfa7a, 0xfd55, 0x0232, 0x040f, 0x020b, 0x00a2, 0x00e9, 0xff63,
+	0xff70, 0x01b2, 0x02bf, 0xffa6, 0xfb8c, 0xfbb3, 0xfe10, 0x002d,
+	0x0121, 0x0179, 0x0284, 0x00d2, 0xfcfb, 0xfaf6, 0xfa2c, 0xfada,
+	0xfda2, 0x02ec, 0x09f2, 0x0c4a, 0x03d1, 0xf722, 0xedd4, 0xf19b,
+	0x0148, 0x1000, 0x16f1, 0x0d89, 0x0237, 0xfc77, 0xf5a6, 0xf433,
+	0xf71b, 0xfebc, 0x0812, 0x093c, 0x05c7, 0xff90, 0xf891, 0xf602,
+	0xf674, 0xfba8, 0x00b4, 0x029c, 0x048f, 0x057e, 0x04b0, 0x0172,
+	0xff38, 0x0038, 0x012c, 0x011a, 0x006f, 0x0078, 0x0148, 0x0068,
+	0x01d9, 0x0565, 0x03a1, 0xfd61, 0xf91c, 0xf9e8, 0xfd7d, 0xffd3,
+	0x0145, 0x02c0, 0x023a, 0x0029, 0xfc71, 0xfa0f, 0xfa73, 0xfb6d,
+	0xfedb, 0x03f2, 0x096a, 0x0a24, 0x0236, 0xf66c, 0xef15, 0xf602,
+	0x0404, 0x0eca, 0x120b, 0x0b1f, 0x03d6, 0xfe51, 0xf751, 0xf4c6,
+	0xf799, 0xfeb0, 0x0556, 0x0638, 0x04b1, 0xff89, 0xfa39, 0xf8a5,
+	0xf912, 0xfb9c, 0xfdc8, 0x015f, 0x051e, 0x0557, 0x042b, 0x023b,
+	0x01a6, 0x026c, 0x013c, 0x005b, 0xfee9, 0xfdc3, 0xfeb0, 0xffcf,
+	0x0378, 0x0567, 0x02a0, 0xfdf3, 0xfb15, 0xfb32, 0xfb2b, 0xfccf,
+	0x0077, 0x02f2, 0x030a, 0x0163, 0xfe00, 0xfb31, 0xf946, 0xf9f7,
+	0xfdc0, 0x03a5, 0x09d3, 0x0a28, 0x03a8, 0xf8cd, 0xf2db, 0xf6f8,
+	0x0173, 0x0b45, 0x0e39, 0x0aa4, 0x05c1, 0x0047, 0xf9e2, 0xf702,
+	0xf7ea, 0xfd0a, 0x0230, 0x0377, 0x02d3, 0xff46, 0xfb6b, 0xfb08,
+	0xfbb0, 0xfc92, 0xfe7d, 0x00f8, 0x040c, 0x0421, 0x02c5, 0x01b4,
+	0x0111, 0x01ed, 0x024f, 0x025b, 0x0228, 0xffbd, 0xfdb3, 0xff73,
+	0x01cd, 0x0406, 0x005e, 0xfbce, 0xfd9c, 0xfdb4, 0xfd57, 0xfd53,
+	0xfe93, 0x01cb, 0x024d, 0x006d, 0xfe82, 0xfc71, 0xfb73, 0xfbed,
+	0xfd55, 0x01a6, 0x066b, 0x076c, 0x02e2, 0xfbed, 0xf826, 0xfab6,
+	0x01c8, 0x0806, 0x0a9c, 0x0791, 0x03a8, 0x010f, 0xfd80, 0xfac1,
+	0xfa60, 0xfc42, 0xff38, 0x006b, 0xff18, 0xfda3, 0xfb6a, 0xfbca,
+	0xfd07, 0xfe0c, 0x00e1, 0x02a6, 0x0431, 0x043f, 0x0380, 0x02c4,
+	0x01c5, 0x01c9, 0x01fc, 0x01e8, 0x0092, 0xfecb, 0xfe6d, 0xfee5,
+	0x00df, 0x0187, 0xff30, 0xfd03, 0xfcb5, 0xfd73, 0xfd51, 0xfd00,
+	0xfddc, 0x005c, 0x01f5, 0x011e, 0xffd1, 0xfef1, 0xfe7b, 0xfe1e,
+	0xfed1, 0x006e, 0x035e, 0x043a, 0x010b, 0xfe72, 0xfd96, 0xfe88,
+	0x0003, 0x02f6, 0x05f6, 0x0421, 0x0168, 0x0039, 0xff65, 0xfe8e,
+	0xfda2, 0xfe79, 0xff47, 0xffb3, 0xff87, 0xfdcb, 0xfce4, 0xfc6e,
+	0xfc69, 0xfd85, 0xffe6, 0x020c, 0x0328, 0x03f6, 0x0418, 0x038e,
+	0x023b, 0x01a8, 0x01d0, 0x018d, 0x00d9, 0x001d, 0x0018, 0x000b,
+	0xff88, 0xfe9b, 0xfd32, 0xfc7e, 0xfcd8, 0xfdad, 0xfdd4, 0xfdf1,
+	0xfeec, 0x0011, 0x007f, 0x0005, 0xffee, 0x0099, 0x0150, 0x0183,
+	0x0147, 0x015a, 0x018d, 0x0152, 0x0077, 0xfff4, 0x0011, 0xffc3,
+	0xffaa, 0xffea, 0x0000, 0xff9b, 0xff1e, 0xff60, 0xff6a, 0xff08,
+	0xfef1, 0xff21, 0xffb3, 0x00a4, 0x0127, 0x010c, 0x00ca, 0x0021,
+	0xffb7, 0xffbe, 0x005e, 0x0121, 0x0150, 0x0151, 0x00ed, 0x0040,
+	0xffae, 0xff64, 0xff5c, 0xffc7, 0x001e, 0x006b, 0x003d, 0xff6f,
+	0xfeb2, 0xfe68, 0xfe28, 0xfe03, 0xfe6a, 0xfee7, 0xff64, 0xff8e,
+	0xfffd, 0x002c, 0xffe0, 0xffd6, 0xfff9, 0x0091, 0x0102, 0x013b,
+	0x017c, 0x0196, 0x0150, 0x00af, 0x002b, 0x0019, 0x0008, 0xffc5,
+	0xff86, 0xff6f, 0xff9a, 0xff9c, 0xffc6, 0xffd6, 0xff94, 0xff35,
+	0xfee6, 0xff64, 0x000d, 0x0080, 0x00f9, 0x010a, 0x00b3, 0x0029,
+	0xffcf, 0x0004, 0x0071, 0x00d4, 0x0102, 0x00e5, 0x00a5, 0x0026,
+	0xff7e, 0xfee3, 0xfeb9, 0xff39, 0xffc1, 0x0026, 0x0076, 0x002e,
+	0xffe4, 0xff76, 0xff2e, 0xff4d, 0xff5e, 0xffb4, 0x0000, 0x006a,
+	0x00d6, 0x00c2, 0x0061, 0x0010, 0xffc8, 0xffdc, 0xfff3, 0x0029,
+	0x0098, 0x00a9, 0x006c, 0xffee, 0xffb0, 0xffa4, 0xffe6, 0xffda,
+	0xffb5, 0xff6a, 0xff72, 0xffe9, 0x0031, 0x0059, 0x002b, 0xffd9,
+	0xffcd, 0x0002, 0x001e, 0x0062, 0x0090, 0x00b6, 0x0073, 0xffbe,
+	0xff2f, 0xff41, 0xffc2, 0x0042, 0x006c, 0x007c, 0x00b1, 0x0065,
+	0xffe1, 0xff52, 0xff4e, 0xffa0, 0xffbb, 0x0018, 0x0084, 0x009f,
+	0x004c, 0xff47, 0xfeaf, 0xfe89, 0xfedf, 0xff9b, 0x0011, 0x0042,
+	0x0085, 0x00ae, 0x00a6, 0x0039, 0xffbb, 0xff90, 0xffd6, 0x004b,
+	0x0065, 0x002a, 0x0001, 0xffc1, 0xffc7, 0xffb2, 0xffa4, 0xffbd,
+	0xff81, 0xffa5, 0xffd9, 0x0021, 0x005a, 0x004d, 0x005f, 0x0032,
+	0x0011, 0x0000, 0x0014, 0x005d, 0x0092, 0x0099, 0x0078, 0x0006,
+	0xffb3, 0xff7f, 0xff84, 0xffab, 0xffdf, 0x0023, 0x0074, 0x005d,
+	0xfffa, 0xffbb, 0xff96, 0xffc3, 0xffc8, 0x000f, 0x0091, 0x00af,
+	0x0061, 0xffc4, 0xff8e, 0xffdf, 0xffce, 0xffc3, 0xffcf, 0x000a,
+	0x005e, 0x004c, 0x0030, 0x0025, 0x0005, 0xffbc, 0xffb8, 0xffe3,
+	0x0036, 0x0057, 0x004f, 0x0026, 0xffdf, 0xffc3, 0xff99, 0xffe5,
+	0xffed, 0xffeb, 0xfff0, 0xfff3, 0x000c, 0x0010, 0x001b, 0x0038,
+	0x0034, 0xfffb, 0xffdd, 0xffe8, 0x0029, 0x005f, 0x0060, 0x0040,
+	0xfff9, 0xffb2, 0xff7d, 0xff7f, 0xffb7, 0xfffb, 0x0031, 0x0055,
+	0x001f, 0xffcd, 0xff99, 0xffac, 0x0009, 0x0040, 0x003f, 0x004d,
+	0x004e, 0x004d, 0x0013, 0xffa3, 0xff6d, 0xff73, 0xff70, 0xff8f,
+	0xffc4, 0xffee, 0x0013, 0x000b, 0xfff2, 0xff9e, 0xff72, 0xff97,
+	0xfff7, 0x0032, 0x003d, 0x0034, 0x0013, 0xfff6, 0xffda, 0xfff6,
+	0x002c, 0x0040, 0x0031, 0xfff3, 0xffdf, 0xfff9, 0x002b, 0x007a,
+	0x006e, 0x0020, 0xffc7, 0xffa3, 0xfffa, 0x0031, 0x0031, 0x0042,
+	0x001a, 0xffec, 0xffb0, 0xffa3, 0xffdb, 0x001a, 0x002d, 0x0036,
+	0x0013, 0xfff6, 0xffea, 0xfff1, 0x002b, 0x0037, 0x002e, 0x000f,
+	0x000e, 0x000a, 0x001f, 0x0038, 0x001c, 0xfff5, 0xffc7, 0xffb5,
+	0xffbc, 0xffbc, 0xfff0, 0x002c, 0x0039, 0x0006, 0xffc2, 0xffa5,
+	0xffd3, 0xfffb, 0x0005, 0x003b, 0x000e, 0xffec, 0xfff2, 0xfff4,
+	0x0040, 0x002e, 0x0006, 0xffec, 0xffaa, 0xffda, 0x0031, 0x0082,
+	0x0078, 0xfff2, 0xffb9, 0xffc2, 0xffe5, 0xffed, 0x0005, 0x0036,
+	0x0007, 0xffce, 0xffad, 0xffab, 0xffd2, 0xffd2, 0x0007, 0x004f,
+	0x0025, 0x0007, 0xfff2, 0x001a, 0x0052, 0x000e, 0x002f, 0x0039,
+	0x001a, 0x0001, 0xfffc, 0x0061, 0x0054, 0xffa8, 0xff23, 0xff02,
+	0xff45, 0xff83, 0xff98, 0xfff0, 0x002a, 0x0039, 0xffd0, 0xff95,
+	0xffce, 0x0019, 0x001a, 0xfff4, 0x0035, 0x0065, 0x0031, 0xffe9,
+	0xffc0, 0x002d, 0x0050, 0xfff1, 0xff89, 0xffb5, 0x0080, 0x00a9,
+	0x0045, 0xffec, 0xffac, 0xffa4, 0xffbb, 0x002d, 0x007f, 0x0049,
+	0xffc8, 0xffbd, 0xfffd, 0x000f, 0xffed, 0xffdc, 0x001c, 0x003a,
+	0x000b, 0x0001, 0xfff6, 0x0046, 0x003e, 0x0036, 0x0042, 0xfff7,
+	0xffe6, 0xffe1, 0x000c, 0x003c, 0x002b, 0x0035, 0xffde, 0xff82,
+	0xff98, 0xffde, 0xfffb, 0xffd3, 0xffe6, 0x0048, 0x0076, 0xffe1,
+	0xff95, 0xfffa, 0x001f, 0xffd9, 0xffcc, 0x0043, 0x0087, 0x0028,
+	0xffae, 0x0032, 0x0091, 0xffce, 0xff1c, 0xff5b, 0x0189, 0x01fb,
+	0xffde, 0xff3e, 0xfe89, 0xff31, 0x004e, 0x0011, 0x0058, 0xfff4,
+	0xff6d, 0xff4f, 0xfff5, 0x0070, 0x0034, 0x003a, 0x005a, 0x00b3,
+	0x006a, 0xffab, 0xffc7, 0x0046, 0x008d, 0x0003, 0xffa6, 0xffc9,
+	0xffc0, 0xff5e, 0xff6b, 0x0032, 0x006c, 0x0036, 0xff7c, 0xff73,
+	0xfff1, 0xff84, 0xff29, 0xffa6, 0x008a, 0x0060, 0xffbb, 0xff9c,
+	0x000c, 0xffe4, 0xff5e, 0xffa0, 0x0043, 0x0061, 0xffc4, 0xff97,
+	0x0076, 0x006c, 0xffb5, 0xffa4, 0x0023, 0x00c9, 0x0093, 0x000a,
+	0x000f, 0x0003, 0xff8d, 0xffa6, 0xfffc, 0x003a, 0x0019, 0xff91,
+	0xfff3, 0xffe8, 0xffed, 0x004d, 0x000d, 0x0042, 0x002e, 0x0066,
+	0x0094, 0xff93, 0xff3e, 0x004b, 0x018a, 0x00fc, 0xff66, 0xff78,
+	0xfff9, 0xff7f, 0xff49, 0xffd7, 0x007d, 0x0048, 0xff3b, 0xff45,
+	0x003c, 0x0068, 0xffef, 0x0007, 0x009f, 0x00ee, 0x007f, 0xffd3,
+	0xffcc, 0x000f, 0xfff5, 0xff76, 0xff50, 0x000f, 0x0008, 0xffbb,
+	0xffe9, 0x000b, 0x0084, 0x0024, 0xff81, 0x002e, 0x00cd, 0x0075,
+	0xff98, 0xff4c, 0x004f, 0x007b, 0xff5a, 0xff55, 0x0036, 0x00ad,
+	0xffd8, 0xff22, 0x0059, 0x0100, 0xff88, 0xff6c, 0x0078, 0x00e1,
+	0xffd2, 0xfebb, 0x0033, 0x0116, 0xffbf, 0xff4a, 0x003b, 0x0102,
+	0xff91, 0xfe82, 0x0095, 0x012d, 0xffa3, 0xff18, 0x0000, 0x013b,
+	0xfffa, 0xfe60, 0xff92, 0x0096, 0xffed, 0xff17, 0xff70, 0x00f8,
+	0x0052, 0xfefb, 0xff87, 0x0069, 0x0065, 0xff9b, 0xff56, 0xffef,
+	0x0075, 0xfffd, 0xfffb, 0xfff5, 0xff9d, 0x0059, 0x0090, 0xffcd,
+	0xff32, 0xffd5, 0x0160, 0x008a, 0xfe9b, 0xff79, 0x0176, 0x0112,
+	0xfee4, 0xfef8, 0x01b0, 0x016f, 0xfebf, 0xfe8e, 0x00b0, 0x0167,
+	0xff5f, 0xfe63, 0x0042, 0x013e, 0x000b, 0xfefa, 0xffb4, 0x0126,
+	0x0040, 0xfee1, 0xffbc, 0x00c5, 0x00b2, 0xffa2, 0xff82, 0x0079,
+	0x0051, 0xffd1, 0xffaa, 0xffb2, 0x0041, 0x008d, 0x0004, 0xff65,
+	0xff2c, 0x005f, 0x010d, 0xff80, 0xfedb, 0x005f, 0x0139, 0xff96,
+	0xfe7a, 0x0054, 0x01b0, 0x000d, 0xfe6c, 0xffde, 0x01b3, 0x0097,
+	0xfe32, 0xff4d, 0x01cc, 0x010e, 0xfeae, 0xfe96, 0x0100, 0x0193,
+	0xff42, 0xfe98, 0x0081, 0x0177, 0x002d, 0xfeb5, 0xffc3, 0x00ec,
+	0xffc3, 0xff18, 0xfff3, 0x008c, 0x0044, 0xff99, 0xffc3, 0x0055,
+	0xfffc, 0xff94, 0x0005, 0x0090, 0x004f, 0xffb9, 0xffdd, 0x0070,
+	0x0026, 0xff8b, 0xffcb, 0x0057, 0x002f, 0xff1c, 0xfee9, 0xfff2,
+	0x0055, 0xff57, 0xfe98, 0xffe7, 0x017c, 0x001e, 0xfe39, 0xff4d,
+	0x0163, 0x00d4, 0xfeae, 0xff4a, 0x018f, 0x010c, 0xff1d, 0xfeee,
+	0x00f4, 0x016e, 0xff36, 0xfec1, 0x00cd, 0x0167, 0xff99, 0xfe6a,
+	0x0012, 0x0199, 0x0042, 0xfeef, 0xffbd, 0x00c9, 0x002d, 0xff3e,
+	0xfff8, 0x0094, 0xff99, 0xff74, 0x00a7, 0x007b, 0xff68, 0xffc2,
+	0x00d0, 0x0035, 0xff00, 0xffee, 0x0172, 0x0087, 0xfea5, 0xff79,
+	0x01b5, 0x00ff, 0xfe47, 0xfebe, 0x01bd, 0x019e, 0xfe92, 0xfe03,
+	0x00ef, 0x01fa, 0xfecc, 0xfdbb, 0x013c, 0x025d, 0xfefc, 0xfd57,
+	0x0063, 0x02cf, 0x001f, 0xfd41, 0xff66, 0x028b, 0x0148, 0xfe1f,
+	0xfed3, 0x01a6, 0x0166, 0xff18, 0xfede, 0x0080, 0x00f9, 0xffba,
+	0xff36, 0x0000, 0x003c, 0xffb6, 0xffb4, 0x001d, 0xffda, 0xffa8,
+	0x001f, 0x0028, 0xffab, 0xffb0, 0x002f, 0x005b, 0xfff9, 0xff88,
+	0xfffc, 0x006a, 0xfffd, 0xffae, 0x0022, 0x0054, 0xffdf, 0xff99,
+	0x003d, 0x00a3, 0xffc7, 0xff4f, 0x000b, 0x0098, 0xffd2, 0xfec8,
+	0xff3c, 0x0060, 0x004a, 0xff51, 0xff15, 0x0012, 0x00a5, 0xfff9,
+	0xff37, 0xffb8, 0x0094, 0x0061, 0xff7d, 0xff9a, 0x00a1, 0x00b7,
+	0xffb0, 0xff55, 0x0063, 0x00e5, 0xfffa, 0xff33, 0xffe4, 0x00c2,
+	0x002a, 0xff63, 0xffde, 0x00a4, 0x0040, 0xff75, 0xffaf, 0x0081,
+	0x0075, 0xffb0, 0xff99, 0x003c, 0x006c, 0xffdd, 0xffc4, 0x001c,
+	0x001d, 0xffe5, 0xfff7, 0x0038, 0x0025, 0xffed, 0x0007, 0x004a,
+	0xfff8, 0xffb9, 0x0019, 0x0072, 0x001c, 0xffa7, 0xffef, 0x0051,
+	0x000c, 0xff95, 0xffbc, 0x0038, 0x001a, 0xffc5, 0xffd2, 0x003b,
+	0x0022, 0xffdd, 0x0008, 0x002a, 0xfff4, 0xffd5, 0x001c, 0x004b,
+	0x0007, 0xffd6, 0x0014, 0x003e, 0xfff2, 0xff9e, 0xffe1, 0x0045,
+	0x0014, 0xffc5, 0xffcd, 0x0014, 0x0007, 0xffe8, 0x0013, 0x0015,
+	0xfffb, 0xffde, 0xfff5, 0x0016, 0xfff1, 0xffda, 0x0012, 0x0010,
+	0xffd4, 0xffd1, 0x002d, 0x003a, 0xfffb, 0xffd7, 0x0002, 0x002f,
+	0x0014, 0xfff9, 0xffff, 0x000e, 0xfff2, 0xfffc, 0x000e, 0xffdd,
+	0xff9f, 0xff8e, 0xff8e, 0xff8c, 0xffaa, 0xffe1, 0xfffc, 0xffe7,
+	0xffd6, 0xffec, 0x0005, 0xfff2, 0xffcc, 0xfffe, 0x0024, 0x000f,
+	0xffd8, 0x0002, 0x001f, 0x000d, 0x0001, 0xffec, 0x000f, 0xffef,
+	0xfff3, 0x0009, 0x000d, 0x000f, 0x000d, 0x0011, 0x0008, 0xffde,
+	0xfffd, 0x0033, 0x0023, 0xffef, 0xffd2, 0x000e, 0x0020, 0xffff,
+	0xffed, 0x0014, 0x0017, 0xffff, 0x0006, 0x0014, 0x0006, 0x001a,
+	0x0023, 0x0020, 0xfff1, 0xffec, 0x001c, 0x002f, 0x001c, 0xffe7,
+	0xfffe, 0x0015, 0xffe4, 0xffc6, 0xfff6, 0x001b, 0x0006, 0xffdf,
+	0x0004, 0x0040, 0x001a, 0xffe2, 0xffde, 0x001c, 0x001c, 0xffef,
+	0xfff9, 0x0020, 0x001d, 0x0006, 0xfff1, 0xfffb, 0xffe9, 0xfffb,
+	0x001e, 0x000c, 0xffde, 0xffe5, 0x0014, 0x000d, 0xffe5, 0xffe7,
+	0x0005, 0x000f, 0xffdc, 0xfff8, 0x0018, 0x0009, 0xffd2, 0xffde,
+	0x0013, 0x0018, 0xffe6, 0xfff7, 0x0018, 0x001e, 0xffee, 0xffdc,
+	0x001b, 0x0026, 0xfff0, 0xfff0, 0x0023, 0x0003, 0xffcc, 0xffe5,
+	0x004f, 0x001f, 0xff4f, 0xff38, 0xffb8, 0x0005, 0xffa9, 0xff78,
+	0x0009, 0x0034, 0xffc3, 0xff81, 0xffe0, 0x0039, 0x000f, 0xffc9,
+	0xffe7, 0x0021, 0x002c, 0xfff6, 0xfff1, 0x0026, 0xfffb, 0xfff6,
+	0x0001, 0x0038, 0x0033, 0xffea, 0xffd5, 0x000a, 0x003e, 0x0003,
+	0xffda, 0x0017, 0x0043, 0x001b, 0xffde, 0xffdc, 0x001d, 0x0040,
+	0x0016, 0xffe9, 0xffe5, 0x0014, 0x0029, 0x0011, 0xffdf, 0xffef,
+	0x0030, 0x0033, 0x0010, 0xffdb, 0xffdb, 0x001e, 0x0037, 0x0026,
+	0xffe5, 0xffe0, 0x0022, 0x0017, 0xffe1, 0xffd4, 0x0011, 0x001c,
+	0xfff9, 0xffdd, 0xfff4, 0x001f, 0xfffc, 0xffd3, 0xfffb, 0x000e,
+	0x0002, 0xfffa, 0x001c, 0x000f, 0xffec, 0xffd9, 0xfff3, 0x0021,
+	0x0015, 0xffde, 0xffd6, 0xfffc, 0x000c, 0xfffe, 0xfff3, 0x0000,
+	0xffef, 0xffed, 0xfffd, 0x002b, 0x0004, 0xffe2, 0xfffc, 0x0006,
+	0x0003, 0xffe9, 0xfff2, 0x001a, 0x0024, 0x000f, 0xffdf, 0xffbe,
+	0xfffa, 0x0058, 0x0030, 0xffd9, 0xffb8, 0xfffb, 0x0044, 0x0023,
+	0xfffb, 0xffeb, 0x0013, 0xffdb, 0xff8e, 0xff92, 0xffb3, 0xffe9,
+	0xffcc, 0xffa7, 0xffbf, 0xffed, 0xffe9, 0xffcc, 0x0007, 0x001e,
+	0xffe9, 0xffc7, 0xffe5, 0x0038, 0x002d, 0xffee, 0xffcf, 0xfffc,
+	0x0037, 0x000d, 0xfffb, 0xffdf, 0xfff8, 0x001b, 0x0025, 0x001c,
+	0x000e, 0xffe7, 0xfff5, 0x0017, 0x002d, 0x0045, 0x000d, 0xffe4,
+	0xfff3, 0x0027, 0x0032, 0x000c, 0xfff5, 0x0010, 0x0023, 0xffe6,
+	0xfff0, 0x0004, 0x0043, 0x001b, 0xffe2, 0xfff2, 0xffff, 0x002c,
+	0x0021, 0x0009, 0xffd4, 0xffe9, 0x002c, 0x004d, 0x0001, 0xffa4,
+	0xffd5, 0x0028, 0x0055, 0xffe6, 0xffaa, 0xffeb, 0x0046, 0x0028,
+	0xffe6, 0xffe9, 0xfff9, 0x0017, 0x0007, 0xfff9, 0x0002, 0x000a,
+	0x0003, 0xfffd, 0xfff9, 0xffe9, 0x0002, 0x003c, 0x0009, 0xffe0,
+	0xffcc, 0xffd6, 0x0027, 0x003c, 0x0028, 0xffe2, 0xffd1, 0xffee,
+	0x0013, 0x001e, 0xfffa, 0xffe7, 0x000d, 0x0006, 0xffd0, 0x0009,
+	0x0011, 0xfff6, 0xffe6, 0xfffd, 0x0041, 0x0012, 0xffad, 0xffd6,
+	0x003d, 0x0017, 0xffbe, 0xffcd, 0x003b, 0xfffe, 0xff88, 0xff80,
+	0xff84, 0xffbd, 0xffda, 0xffaa, 0xff99, 0xffde, 0xfffd, 0xfff8,
+	0xfffd, 0xffc0, 0xffb4, 0xffe6, 0x0045, 0x004b, 0x0004, 0xffa7,
+	0xffc3, 0x0038, 0x002b, 0x002f, 0x002d, 0x0034, 0xffe5, 0xffcb,
+	0x0010, 0x000a, 0x0025, 0x0063, 0x0049, 0xffef, 0xff92, 0xffea,
+	0x005a, 0x0055, 0x0026, 0xff9b, 0xffbf, 0x0033, 0x0047, 0x003b,
+	0x000f, 0xffb1, 0xffcf, 0x0033, 0x002a, 0x0040, 0x002d, 0xffb4,
+	0xffb1, 0x0022, 0x003a, 0x0032, 0x003f, 0x0013, 0xffbe, 0xffc7,
+	0x001e, 0x0041, 0x0038, 0x0007, 0xffdf, 0xffd9, 0xffe5, 0x0041,
+	0x0033, 0xffbe, 0xffb8, 0x0001, 0x006c, 0x002c, 0xffdc, 0xffca,
+	0xff8d, 0xffed, 0x0051, 0x006f, 0x0036, 0xff9a, 0xff81, 0xffe5,
+	0x0038, 0x0016, 0x000e, 0x003d, 0xffdc, 0xff98, 0xffd6, 0x001c,
+	0x001e, 0xfff5, 0x0031, 0xfff5, 0xffd6, 0xfff6, 0xffd4, 0x004c,
+	0x005f, 0xffe0, 0xffc3, 0x0001, 0x002f, 0x0007, 0xfffe, 0x0006,
+	0xffec, 0x0030, 0x0050, 0xffd0, 0xffa2, 0xff96, 0x003f, 0x00df,
+	0xff98, 0xfeda, 0xff66, 0x001e, 0x000d, 0xff99, 0xffc6, 0xff86,
+	0xff9c, 0x003b, 0x0049, 0xffe2, 0xffac, 0xffd4, 0xffdd, 0xffe9,
+	0xffcd, 0x0013, 0x007b, 0x004a, 0xffb8, 0xff9a, 0x001f, 0xfff1,
+	0x0041, 0x007e, 0x002a, 0xffda, 0xffad, 0x0025, 0x008f, 0x0051,
+	0xff9d, 0xff9d, 0x0049, 0x00a5, 0x004e, 0xffe7, 0xffd9, 0xff65,
+	0xff92, 0x007d, 0x012b, 0x0051, 0xff15, 0xff50, 0x0068, 0x00a8,
+	0xfff9, 0xfffd, 0x000e, 0xff30, 0xff6f, 0x0100, 0x00e6, 0xff32,
+	0xfede, 0x0034, 0x00aa, 0x0005, 0xff9e, 0xff62, 0xffee, 0x006b,
+	0x002c, 0x0073, 0xffe9, 0xfe21, 0xffaf, 0x041f, 0x029c, 0xfa70,
+	0xf86e, 0x03e9, 0x0d15, 0x0251, 0xf291, 0xf73d, 0x0885, 0x0bc1,
+	0xfc52, 0xf503, 0x0099, 0x0918, 0x0140, 0xf87b, 0xfe12, 0x05ea,
+	0x027c, 0xfb70, 0xff41, 0x057b, 0x0082, 0xf9df, 0xfeb9, 0x06b6,
+	0x0176, 0xf8ff, 0xfaa8, 0x0674, 0x0a0e, 0xfb0d, 0xf273, 0x0019,
+	0x0d59, 0x0435, 0xf6a9, 0xf8f2, 0x04d5, 0x0795, 0xfe24, 0xf963,
+	0x00a0, 0x0608, 0x001f, 0xf9cd, 0xfc68, 0x0429, 0x05cd, 0xfeaa,
+	0xf91f, 0xfd30, 0x0498, 0x04f7, 0xfeb2, 0xfa3c, 0xfe2a, 0x04a7,
+	0x03bc, 0xfd8f, 0xfad0, 0x00ef, 0x0704, 0x008d, 0xf9a4, 0xfe24,
+	0x054b, 0x0343, 0xfc1b, 0xfd9d, 0x02a9, 0x0033, 0xfb7d, 0xfed8,
+	0x0863, 0x0273, 0xf2cd, 0xfe90, 0x0e69, 0x0210, 0xf2ce, 0xf7a1,
+	0x0b84, 0x0dfd, 0xf889, 0xef2e, 0x03db, 0x1169, 0xfeb7, 0xf131,
+	0xfec1, 0x0b59, 0x025c, 0xf656, 0xfb10, 0x0bbc, 0x074b, 0xf373,
+	0xf8b8, 0x0b0d, 0x09df, 0xf88b, 0xf69c, 0x05e2, 0x09b3, 0xfcb9,
+	0xf5b3, 0xffe6, 0x0a30, 0x03bc, 0xf6d0, 0xfa20, 0x05b6, 0x05b0,
+	0xfd57, 0xfa93, 0xfee3, 0x03fe, 0x039f, 0xfd09, 0xfa9b, 0xff50,
+	0x03cf, 0x02bb, 0xfe98, 0xfcef, 0xff1a, 0x0230, 0x0216, 0xfe0c,
+	0xfe81, 0x0333, 0x0285, 0xff1b, 0xfbea, 0xfd7e, 0x0240, 0x02f1,
+	0xffdc, 0xfeda, 0x00eb, 0xffee, 0xff81, 0x00e2, 0x000c, 0xff96,
+	0x0216, 0x021c, 0xfdfb, 0xfbe1, 0xfec5, 0x0399, 0x0471, 0xff5b,
+	0xfa99, 0xfe02, 0x03e9, 0x017a, 0xfd25, 0xfeae, 0x0089, 0x0156,
+	0xfe3d, 0xfc02, 0x00a9, 0x024f, 0xff36, 0xfe81, 0x013f, 0xffa1,
+	0xfd6d, 0x0080, 0x0259, 0x004a, 0xfe81, 0xffd7, 0x01f0, 0x0191,
+	0xfd37, 0xfe2a, 0x035c, 0x01d9, 0xfc91, 0xfeb3, 0x05a5, 0x024c,
+	0xfa84, 0xfce3, 0x047d, 0x077d, 0xff1c, 0xf591, 0xfec6, 0x08e1,
+	0x036d, 0xf985, 0xfcec, 0x052d, 0x018c, 0xfc1b, 0xfcd1, 0x02be,
+	0x0435, 0xfeff, 0xfb35, 0x0003, 0x03b2, 0xfea2, 0xfdb6, 0xff99,
+	0x0178, 0x03a1, 0xff90, 0xfb59, 0xfccc, 0x0260, 0x049a, 0xfffd,
+	0xfd21, 0xfef9, 0x0338, 0x024d, 0xfb07, 0xfb58, 0x041b, 0x06d8,
+	0xfff9, 0xfb11, 0xfee7, 0x0297, 0xfe7d, 0xfdb5, 0x044b, 0x0552,
+	0xfe32, 0xf902, 0xfeec, 0x04e2, 0x0066, 0xfc1b, 0xffea, 0x0609,
+	0x02a8, 0xf978, 0xfafc, 0x02ae, 0x040c, 0xfe8b, 0xfee2, 0x055e,
+	0xfffb, 0xf7da, 0xfd85, 0x076a, 0x03a7, 0xfad4, 0xfcde, 0x02af,
+	0x043c, 0xfcc3, 0xf873, 0x0307, 0x08ba, 0xff68, 0xf7cf, 0xff8b,
+	0x07ca, 0x005b, 0xf8c0, 0xfe3a, 0x0664, 0x0647, 0xfbea, 0xf706,
+	0x0189, 0x0593, 0x00d7, 0xfca0, 0xfbd1, 0x0256, 0x037e, 0xfe47,
+	0xfc83, 0x0050, 0x04b6, 0x005d, 0xfb18, 0xfe68, 0x02fd, 0x05d3,
+	0xfe9b, 0xf7eb, 0x0044, 0x0641, 0x028b, 0xf991, 0xfc25, 0x0729,
+	0x0607, 0xfb4f, 0xf596, 0x01a2, 0x0ad9, 0x01e3, 0xf5ef, 0xfa07,
+	0x08d2, 0x09ea, 0xfc51, 0xf3a6, 0xfeac, 0x0ae4, 0x0405, 0xf8f8,
+	0xf96b, 0x0601, 0x09b2, 0xfa3b, 0xf493, 0x00df, 0x0c08, 0x04f5,
+	0xf6a5, 0xf92a, 0x038d, 0x07fe, 0xffc4, 0xf705, 0xfeca, 0x0986,
+	0x07b2, 0xf906, 0xf3a1, 0x01b1, 0x08a7, 0x0359, 0xff16, 0xfe1c,
+	0xffb8, 0x0038, 0xfd54, 0xfaf3, 0x0023, 0x0744, 0x06bf, 0x0056,
+	0xf971, 0xf4cc, 0xfb9a, 0x0aa8, 0x0cb0, 0xff48, 0xf397, 0xfcdd,
+	0x07ba, 0x0279, 0xf901, 0xf7fa, 0x06c1, 0x0db3, 0x04ee, 0xf4d1,
+	0xf0a5, 0xfea3, 0x08a7, 0x0ccc, 0x0424, 0xf8e0, 0xf7f8, 0xfad8,
+	0x03fe, 0x06fb, 0x0078, 0xfd55, 0x0024, 0x0612, 0x0030, 0xf4ad,
+	0xf70d, 0x08db, 0x1128, 0x011e, 0xf2af, 0xf66b, 0x04c3, 0x06b8,
+	0x0080, 0xfc5f, 0xfc07, 0x02b2, 0x01ae, 0xffb9, 0xfd79, 0xf9ac,
+	0x017d, 0x09a1, 0x01f2, 0xf73a, 0xfb61, 0x05d9, 0x0704, 0xfc6d,
+	0xf509, 0xfe16, 0x0eeb, 0x0921, 0xf3b9, 0xf2f0, 0x0456, 0x10b0,
+	0x05d1, 0xf026, 0xefc0, 0x079b, 0x16b7, 0x0764, 0xec91, 0xf04e,
+	0x08ac, 0x11bf, 0x02c0, 0xef93, 0xf6f7, 0x091a, 0x1143, 0xfd1a,
+	0xec7b, 0xfb31, 0x0b2b, 0x0e39, 0xfe26, 0xf3ee, 0xf59b, 0x0087,
+	0x0f44, 0x04ee, 0xf8ce, 0xf879, 0xfd64, 0x084a, 0x0649, 0xfd27,
+	0xf894, 0xfe02, 0x043a, 0x05d8, 0x01f4, 0xf5ac, 0xfcd2, 0x0c3e,
+	0x083f, 0xf899, 0xf3b8, 0xfa1a, 0x090f, 0x14d4, 0x05bd, 0xecd2,
+	0xe95e, 0x025a, 0x155f, 0x0fed, 0xf9b3, 0xed0f, 0xf977, 0x0b7a,
+	0x0a88, 0xf34e, 0xf127, 0x08b0, 0x1854, 0x0868, 0xe803, 0xe1bf,
+	0x025f, 0x21a4, 0x13b2, 0xee39, 0xe236, 0x05af, 0x1d40, 0x01e0,
+	0xde38, 0xeed5, 0x224a, 0x2682, 0xf774, 0xcd9c, 0xeaae, 0x2574,
+	0x24bb, 0xf29b, 0xe114, 0x012c, 0x11c4, 0x0655, 0xf6c1, 0xf2b5,
+	0x0454, 0x134b, 0x0113, 0xf4bc, 0xfcf6, 0xfb7f, 0xf92c, 0x07ec,
+	0x1104, 0x02fb, 0xf211, 0xec8c, 0xff32, 0x1514, 0x0716, 0xf2db,
+	0xf7ad, 0x02e1, 0x0c39, 0x0162, 0xef66, 0xfaa0, 0x0c2b, 0x09f5,
+	0xfb40, 0xf14c, 0x013f, 0x0cb7, 0x02dd, 0xfea4, 0xf525, 0xfb8f,
+	0x06fc, 0x043c, 0x0951, 0x0040, 0xf411, 0xf55c, 0x03e3, 0x1027,
+	0x04f5, 0xf72b, 0xff62, 0x0292, 0xf7de, 0xfddc, 0x056d, 0x0d1c,
+	0x0414, 0xee6e, 0xf5c7, 0x0b85, 0x0cc8, 0xf6e6, 0xf1a7, 0x0c27,
+	0x1213, 0xf457, 0xe4ca, 0xffff, 0x1c1a, 0x0839, 0xf088, 0xf683,
+	0x0576, 0x05ef, 0xf798, 0xf5b5, 0x0c26, 0x1139, 0xf74e, 0xefcf,
+	0xfcd8, 0x0bee, 0x069a, 0xf582, 0x020c, 0x0e97, 0xfe54, 0xeac9,
+	0xf1b9, 0x141f, 0x1ea1, 0xfa27, 0xe538, 0xfd1a, 0x0c68, 0x069e,
+	0xf4f8, 0xf8a3, 0x1517, 0x100c, 0xf4b0, 0xe503, 0xf717, 0x0fcd,
+	0x0d2d, 0x0ab4, 0x0021, 0xf207, 0xf2f1, 0xf27a, 0x075a, 0x1c13,
+	0x08ba, 0xf05d, 0xf0b3, 0xff83, 0x03fb, 0xfa94, 0x0586, 0x133a,
+	0x00f1, 0xebde, 0xe9bd, 0x08b5, 0x17ac, 0x00d1, 0xf6a8, 0xfa7b,
+	0x0d36, 0x05fe, 0xe618, 0xedbf, 0x110c, 0x200f, 0x04bd, 0xedca,
+	0xf31e, 0xfada, 0x0264, 0x0d2d, 0x0b66, 0xffb0, 0xf727, 0xf6ce,
+	0x02cb, 0x097e, 0xfcf4, 0xf3e3, 0x0614, 0x13b4, 0x041a, 0xe977,
+	0xea0a, 0x0745, 0x1bf2, 0x0967, 0xef26, 0xeec3, 0xfa71, 0x115f,
+	0x11f3, 0xf696, 0xe98c, 0xfc61, 0x0edf, 0x0dea, 0xfc88, 0xeb8c,
+	0xf5e7, 0x1067, 0x17f9, 0xfa23, 0xe9ed, 0xf736, 0x083b, 0x158d,
+	0x02b1, 0xf2a9, 0xf5f9, 0xf903, 0x14d6, 0x104e, 0xf4da, 0xf5c5,
+	0xfb69, 0x09bc, 0x0b03, 0xfb57, 0xeff3, 0x043e, 0x1896, 0x02f1,
+	0xea2a, 0xf08d, 0x0984, 0x10c8, 0x02e8, 0xf122, 0xf932, 0x054a,
+	0x0525, 0xfed3, 0xf813, 0xffa0, 0xfe18, 0xfe9f, 0x07c2, 0x075b,
+	0xfb32, 0xf036, 0xf3f3, 0x0844, 0x15a4, 0x06cf, 0xf0d0, 0xeed0,
+	0x0566, 0x12e2, 0x03ac, 0xf1b2, 0xf4a3, 0x089d, 0x11a1, 0x0093,
+	0xf284, 0xfbcb, 0x0790, 0x07ac, 0x04c7, 0xfdfd, 0xfab6, 0x0001,
+	0xffb2, 0x01df, 0x06ef, 0x052d, 0xfcf1, 0xfbe8, 0xfc07, 0xfa1f,
+	0x0037, 0x032d, 0x05cd, 0xfece, 0xf3c3, 0xf73c, 0x046f, 0x071e,
+	0xfde5, 0xf67e, 0xffeb, 0x0f27, 0xff5f, 0xed6d, 0xf1bb, 0x0569,
+	0x17a3, 0x0c71, 0xf1fa, 0xeaf9, 0xfc78, 0x0f59, 0x0c08, 0xfd03,
+	0xfdb6, 0x0372, 0xfb3a, 0xf637, 0x0294, 0x0ae3, 0x0b26, 0x07ad,
+	0xfd86, 0xf9b6, 0xf66a, 0xfb92, 0x0a99, 0x1106, 0x0c47, 0xf623,
+	0xef60, 0xf9ea, 0x0598, 0x0d4b, 0xfe45, 0xf4dd, 0xf9de, 0x0414,
+	0x0338, 0xf41b, 0xf564, 0x0590, 0x0e2b, 0x04f7, 0xf3e5, 0xf033,
+	0xff6d, 0x07e4, 0xfecc, 0xf7c2, 0x077a, 0x1277, 0xfa27, 0xe662,
+	0xebf9, 0x1190, 0x27cf, 0x03d6, 0xe489, 0xecaa, 0x0de9, 0x11f5,
+	0xfb39, 0xf6b4, 0x0665, 0x192c, 0x0ba7, 0xed4a, 0xe7bf, 0x0858,
+	0x1b23, 0x0ce5, 0xf97f, 0xf1a6, 0x0054, 0x0534, 0xff12, 0xfb09,
+	0x031e, 0x05ba, 0xf590, 0xf2a9, 0xf902, 0xfeda, 0x0bbc, 0x045f,
+	0xf276, 0x0336, 0x03c4, 0xf595, 0xf521, 0xf998, 0x0f7d, 0x0bdf,
+	0xf6c8, 0xf399, 0xf74a, 0x04d7, 0x058c, 0xfbcf, 0x0533, 0x0988,
+	0x0189, 0xf3fd, 0xf489, 0x0824, 0x0bf9, 0x09e7, 0x04ff, 0xfffb,
+	0x0339, 0xffb3, 0x0061, 0x0503, 0x0a4b, 0x0869, 0xfbca, 0xfb76,
+	0xfdcc, 0x0195, 0x0789, 0x0340, 0xf981, 0xf56e, 0xf71a, 0xfcd5,
+	0xfbb7, 0xea57, 0x0242, 0x1da2, 0x0b3f, 0xfa50, 0xe1b8, 0xe8f3,
+	0x0cdc, 0x0b13, 0x0014, 0xff37, 0x011e, 0xfff0, 0xef60, 0xef8f,
+	0x01d9, 0x0fbf, 0x0f61, 0xfb44, 0xf4e7, 0xf93e, 0x0203, 0x0923,
+	0x08ea, 0x0f72, 0x0627, 0xfc14, 0xfff3, 0x03f8, 0x0c07, 0x0983,
+	0x035a, 0x0392, 0xff8e, 0xfcd5, 0xfde3, 0x03a4, 0x0914, 0x0382,
+	0xfa3e, 0xee60, 0xf642, 0x090a, 0xfc13, 0xe1c0, 0xe5bf, 0x178d,
+	0x32fd, 0x1316, 0xd842, 0xc488, 0xfb6a, 0x2533, 0x0dc1, 0xf238,
+	0xf6a5, 0x058b, 0x0639, 0xe35a, 0xe11b, 0x1146, 0x213c, 0x0bb3,
+	0xea43, 0xe8ca, 0x0666, 0x1123, 0x0dd0, 0x070b, 0x094d, 0x09fa,
+	0xfa81, 0xfaee, 0x08f3, 0x10fe, 0x0e9b, 0xffc3, 0xfaf7, 0xff5b,
+	0xff9d, 0xfe07, 0x0178, 0x0ae7, 0x06b8, 0xf4af, 0xf0ee, 0xfb57,
+	0x0368, 0xf0bc, 0xd38b, 0xfb68, 0x2e4c, 0x2fb9, 0x0849, 0xc47c,
+	0xc61c, 0x02d4, 0x1c00, 0x12ad, 0xfe18, 0xf5e6, 0xfdf3, 0xf26f,
+	0xe937, 0xf409, 0x0cae, 0x15c6, 0x0374, 0xf8e2, 0xf39d, 0xfbe8,
+	0x0cea, 0x1357, 0x1549, 0x0b88, 0xf7f6, 0xf3ed, 0x0453, 0x1420,
+	0x143a, 0x05a4, 0xfc16, 0xfa09, 0xffc3, 0x041b, 0xfec0, 0x030e,
+	0x0773, 0xff92, 0xf910, 0xfd61, 0x0056, 0xf5b6, 0xd744, 0xdca1,
+	0x1ed5, 0x3810, 0x1bfd, 0xedf1, 0xbfe2, 0xe0d0, 0x10d4, 0x1040,
+	0x061a, 0xfc0b, 0x0397, 0xfa1b, 0xe725, 0xecee, 0x0106, 0x11f1,
+	0x0945, 0xf3c2, 0xf823, 0x0393, 0x083b, 0x0eaf, 0x0b4a, 0x0da9,
+	0x0562, 0xf920, 0xfbd1, 0x0ac0, 0x1260, 0x0796, 0x0349, 0x03af,
+	0x02b0, 0xfc31, 0xf69f, 0xfe25, 0x0e6c, 0x0cda, 0xfae6, 0xf38e,
+	0xfbcc, 0x03f0, 0xff0b, 0xdd82, 0xcade, 0x15f7, 0x4295, 0x218c,
+	0xf310, 0xb855, 0xdabf, 0x195c, 0x162e, 0x022c, 0xed63, 0x008d,
+	0x08fc, 0xee3d, 0xedca, 0xf92e, 0x0e1f, 0x09e3, 0xed1e, 0xf805,
+	0x0692, 0x12b8, 0x14a8, 0xff64, 0x0522, 0x079b, 0xfe54, 0xfec4,
+	0x008c, 0x0d8c, 0x0e8b, 0x0608, 0x0288, 0x0108, 0x016c, 0xf906,
+	0xf6d4, 0x05a7, 0x0f19, 0x0521, 0xf8c5, 0xfc5a, 0x0259, 0xf71e,
+	0xdf2a, 0xd38c, 0x0fd9, 0x3f5b, 0x20a5, 0xee4b, 0xc3c0, 0xe6a0,
+	0x12af, 0x0bfc, 0xfa3b, 0xf565, 0x0926, 0x0421, 0xef93, 0xeef4,
+	0xfea7, 0x08c6, 0xfcb1, 0xefe4, 0xfde4, 0x0f51, 0x0c3d, 0x07b4,
+	0x041f, 0x093a, 0x08fb, 0xfb6b, 0xfeb1, 0x05cc, 0x0939, 0x052f,
+	0x03ca, 0x0f35, 0x0e8a, 0xffda, 0xee1f, 0xf279, 0x0791, 0x0efe,
+	0x0770, 0xfdf1, 0x0002, 0x010f, 0xf49f, 0xe3f9, 0xdb1b, 0x02a3,
+	0x33a7, 0x1e78, 0xf5ec, 0xda33, 0xe47c, 0x0a0a, 0x0608, 0xf8c8,
+	0xf6f8, 0x04d7, 0x0a08, 0xf4a5, 0xf252, 0xfc20, 0x00c7, 0xfb59,
+	0xf0f5, 0xfde8, 0x0f04, 0x1033, 0x067f, 0xfaae, 0x036f, 0x0ad5,
+	0x0938, 0x04a0, 0xfe09, 0xffbe, 0x0084, 0x0583, 0x104f, 0x13bb,
+	0x09d6, 0xf80b, 0xeb92, 0xf3c0, 0x09dd, 0x1450, 0x09b9, 0xfa7a,
+	0xf46e, 0xfc74, 0x0122, 0xedf1, 0xde04, 0xfa8e, 0x20b4, 0x1f1f,
+	0x04e2, 0xe0c2, 0xe2ca, 0x001a, 0x0294, 0xfbce, 0xf88b, 0x021b,
+	0x0c1d, 0xff33, 0xf08c, 0xf2f0, 0xf880, 0xfb0d, 0xfe40, 0x0585,
+	0x0e8c, 0x0b6b, 0x01af, 0xfa98, 0x0032, 0x0e7a, 0x09c7, 0x00cb,
+	0xfe01, 0xff44, 0x0966, 0x099b, 0x0d4d, 0x0f42, 0x03ab, 0xf675,
+	0xee73, 0xfb65, 0x0e42, 0x10c7, 0x0322, 0xf7a5, 0xf94d, 0x0155,
+	0xf8ce, 0xe730, 0xe35a, 0x01bd, 0x2445, 0x161d, 0xf9df, 0xe770,
+	0xf487, 0xfeb2, 0xf351, 0xf7fd, 0x0179, 0x1007, 0x088e, 0xf09b,
+	0xf0f1, 0xf788, 0xfa05, 0xfc79, 0x009c, 0x0bfd, 0x0c8a, 0x0464,
+	0xff0e, 0xfed1, 0x01a6, 0x030d, 0x0979, 0x0b33, 0x04cd, 0xffac,
+	0x001f, 0x0adf, 0x104c, 0x086c, 0xff55, 0xf86f, 0xf985, 0xfcbe,
+	0x06b3, 0x0dea, 0x05a0, 0xf809, 0xf27e, 0xff08, 0xfeb3, 0xeafa,
+	0xdd6b, 0xfd6c, 0x2390, 0x1c1b, 0x0504, 0xe876, 0xea9b, 0xfb4d,
+	0xf717, 0xf83a, 0x0531, 0x0b62, 0x05c8, 0xf6b6, 0xeedb, 0xf739,
+	0xf998, 0x0149, 0x0817, 0x044f, 0x042a, 0x01b1, 0x0364, 0x04ea,
+	0xfdc9, 0x0420, 0x0cc4, 0x06dd, 0x0175, 0x0154, 0x06d5, 0x0ceb,
+	0x08b4, 0x031d, 0x00e8, 0xfd77, 0xf9ca, 0xfd3c, 0x0ab5, 0x0a36,
+	0x005c, 0xf6b6, 0xf974, 0x00eb, 0xf1ad, 0xd2ca, 0xea8e, 0x2a38,
+	0x235c, 0x0aad, 0xf221, 0xea53, 0xfd09, 0xed3d, 0xef4c, 0x0322,
+	0x0e58, 0x0a96, 0xf66e, 0xf43d, 0xfd65, 0xf50b, 0xf606, 0x03b6,
+	0x0468, 0x051a, 0x004d, 0x050c, 0x0aca, 0xfe00, 0xfeaa, 0x0998,
+	0x0a6b, 0x0713, 0x0371, 0x057c, 0x0b31, 0x0827, 0x03a6, 0x0496,
+	0x0401, 0xfdf0, 0xf86e, 0x0176, 0x0afc, 0x0518, 0xfb37, 0xf7bc,
+	0xfc71, 0xf233, 0xde21, 0xe2b0, 0x1505, 0x2af5, 0x1307, 0xfffe,
+	0xe54e, 0xf27e, 0xf790, 0xeaf4, 0xff4b, 0x082d, 0x087b, 0x00ef,
+	0xf95d, 0xf8f2, 0xf3b8, 0xf8eb, 0xff3d, 0xfdfc, 0x0576, 0x0149,
+	0x014a, 0x0ba4, 0x02e7, 0x0306, 0x065e, 0x06db, 0x0aa1, 0x0402,
+	0x0508, 0x0727, 0x085f, 0x0b3a, 0x053f, 0x0283, 0xfd86, 0xfa83,
+	0x01e3, 0x061a, 0x01f0, 0x000d, 0xfd60, 0xf8e9, 0xf242, 0xd8bf,
+	0xdebe, 0x1d3c, 0x33b4, 0x0b4b, 0xf4bc, 0xf3a2, 0xf1fa, 0xefc5,
+	0xef15, 0xfe2a, 0x06f3, 0x036f, 0xffa0, 0xfb87, 0xfaf8, 0xf795,
+	0xf66c, 0xfc96, 0xfef6, 0xfdf6, 0xff3e, 0x0528, 0x0a96, 0x056f,
+	0x03b4, 0x0a6b, 0x0c10, 0x0736, 0x0246, 0x04c8, 0x0568, 0x07f4,
+	0x0d82, 0x0a8b, 0x04fc, 0xfc00, 0xf7d5, 0x00b4, 0x0386, 0x0070,
+	0x01fe, 0x01b9, 0xf95c, 0xe525, 0xd24c, 0xf05b, 0x27cc, 0x2586,
+	0x0b60, 0xf99a, 0xeecc, 0xf740, 0xeefd, 0xee01, 0x00b4, 0x0227,
+	0x038e, 0x02e7, 0xfba9, 0xfa2e, 0xf5e9, 0xfc2e, 0x0102, 0xf3eb,
+	0xf85c, 0x02f1, 0x0419, 0x0bc1, 0x0855, 0x0af4, 0x0e8f, 0x0447,
+	0x091a, 0x0556, 0xfc03, 0x0784, 0x0b51, 0x0e41, 0x0e85, 0x00f4,
+	0xfaa9, 0xf91c, 0xfd8c, 0x01c6, 0x0245, 0x0721, 0xff13, 0xea10,
+	0xd474, 0xe024, 0x17ca, 0x265b, 0x1213, 0x03a6, 0xf4ab, 0xf774,
+	0xefda, 0xeb91, 0xfbcb, 0xfeed, 0xfd9e, 0x04ed, 0x009b, 0xf89a,
+	0xfd5d, 0xf9fc, 0xfa82, 0xfac7, 0xf30f, 0xf929, 0x02f7, 0x0aee,
+	0x0c3f, 0x0c57, 0x1113, 0x0a10, 0x0541, 0x0a84, 0xfec2, 0xfc05,
+	0x0a5f, 0x0d2f, 0x0d0e, 0x09cf, 0x016d, 0xf995, 0xfa95, 0xfeb0,
+	0xff49, 0x02f9, 0x0003, 0xf19f, 0xda37, 0xdb84, 0x0d8f, 0x217e,
+	0x0ea1, 0x0946, 0x0119, 0xf34e, 0xee4e, 0xf4b9, 0xf914, 0xfa3e,
+	0xffcb, 0x0102, 0xfc07, 0xfdb3, 0xff0b, 0xfe47, 0xfbea, 0xf332,
+	0xf676, 0xfa1f, 0xfa3d, 0x0623, 0x0d51, 0x1046, 0x0ff3, 0x0b27,
+	0x0c9d, 0x089f, 0xfd95, 0xfd4d, 0x074b, 0x0a22, 0x0c26, 0x0fbe,
+	0x05c2, 0xfced, 0xfdd1, 0xfe1e, 0xfa74, 0xfe71, 0x0190, 0xeee9,
+	0xd895, 0xe182, 0x15d1, 0x21a8, 0x03a5, 0x0797, 0x0683, 0xf19c,
+	0xee1e, 0xf793, 0xf885, 0xfabe, 0x00f6, 0x0194, 0xf844, 0xf678,
+	0x013c, 0xff96, 0xfaea, 0xf6f8, 0xf3a9, 0xf801, 0xfa7b, 0x0484,
+	0x0e0f, 0x0bfd, 0x0e00, 0x105d, 0x0e8e, 0x093e, 0x001f, 0x01cc,
+	0x05d7, 0x061f, 0x0f3e, 0x0c50, 0x0388, 0x0553, 0x0224, 0xfbe8,
+	0xf947, 0xfedf, 0xfb30, 0xe413, 0xd861, 0xfbbc, 0x1991, 0x0ab8,
+	0x0ec1, 0x0b9e, 0xfa40, 0xf1b9, 0xef75, 0xf83c, 0xf55f, 0x009f,
+	0x0477, 0xf6f3, 0xf8f0, 0xfb62, 0xf93f, 0xf7eb, 0xfaa1, 0xfbf9,
+	0xf659, 0xf583, 0xffa5, 0x057f, 0x078e, 0x0e10, 0x0f44, 0x0e43,
+	0x11df, 0x1038, 0xff70, 0x02be, 0x0d68, 0x02ec, 0x0a65, 0x0c18,
+	0x02ac, 0x06a2, 0x037f, 0xfcd2, 0xfa48, 0xf993, 0xf525, 0xe137,
+	0xdccc, 0x065d, 0x180d, 0x058a, 0x0b0f, 0x0ae3, 0xf990, 0xedce,
+	0xf35a, 0xf7ad, 0xf1fe, 0x0383, 0x083d, 0xf806, 0xf780, 0xfc25,
+	0xf824, 0xf34c, 0xfae6, 0xfec8, 0xf8a4, 0xfb40, 0x0498, 0x0711,
+	0x0685, 0x0a5f, 0x0f07, 0x1408, 0x0e1d, 0x07fd, 0x0b63, 0x0561,
+	0x028b, 0x09b0, 0x08bb, 0x038b, 0x063a, 0x090c, 0xff68, 0xfa49,
+	0xfe5a, 0xf69e, 0xe487, 0xdd8c, 0xfee6, 0x103b, 0xfdca, 0x0ab4,
+	0x11fa, 0xfcb3, 0xf4d5, 0xfa89, 0xf3b5, 0xf064, 0xffc2, 0x01c3,
+	0xf855, 0xf900, 0xfd58, 0xf604, 0xf2b6, 0xfcab, 0xfbae, 0xf929,
+	0xff25, 0x015b, 0x047b, 0x0808, 0x0933, 0x0af2, 0x0f11, 0x114c,
+	0x09dc, 0x0746, 0x0bcd, 0x0655, 0x05da, 0x0906, 0x0594, 0x07b3,
+	0x06bb, 0x0055, 0xff03, 0xfeba, 0xf7fb, 0xe666, 0xe153, 0x00b4,
+	0x0892, 0xf95d, 0x0a84, 0x09e3, 0xfccf, 0xfd42, 0xf881, 0xf7a7,
+	0xf6d0, 0xfc54, 0xfbb6, 0xf48a, 0xf871, 0xf7c4, 0xf595, 0xf9c3,
+	0xfcc6, 0xfc19, 0xfb61, 0xfe70, 0x0148, 0x0425, 0x05d5, 0x069c,
+	0x0b00, 0x1003, 0x0ebb, 0x09aa, 0x0b07, 0x08c1, 0x0732, 0x0c8b,
+	0x09c0, 0x057d, 0x0839, 0x08a5, 0x01c5, 0xfef5, 0x0106, 0xf8ff,
+	0xe924, 0xebf9, 0x014e, 0xfd1e, 0xf967, 0x08dd, 0xfe5d, 0xfa10,
+	0xfe62, 0xf640, 0xf80b, 0xfb82, 0xff16, 0xfbe4, 0xf3e6, 0xf8c7,
+	0xf7fc, 0xf24c, 0xfb10, 0xfdeb, 0xfe32, 0xff42, 0xfe28, 0x04bc,
+	0x0230, 0x01ab, 0x0774, 0x07a8, 0x0e94, 0x0f13, 0x08ec, 0x0ce4,
+	0x0915, 0x0736, 0x0c0e, 0x0935, 0x095d, 0x089d, 0x0645, 0x02c5,
+	0xfe9e, 0xff4f, 0xfa54, 0xf044, 0xf3f7, 0xfbd5, 0xf742, 0xf9bf,
+	0xfd2d, 0xf8e4, 0xf95e, 0xf762, 0xf77b, 0xfd66, 0xff84, 0x009f,
+	0xfff5, 0xfe06, 0xfced, 0xf957, 0xf7fe, 0xfa31, 0xfbed, 0xfcff,
+	0xfd6a, 0xfe3d, 0x0091, 0x00de, 0x00af, 0x0145, 0x0452, 0x09c6,
+	0x0a2b, 0x09b6, 0x0ac9, 0x09f7, 0x092e, 0x09b8, 0x09f1, 0x0a30,
+	0x0945, 0x0788, 0x0354, 0xff81, 0xff36, 0xfc29, 0xf9ab, 0xf90c,
+	0xf8df, 0xf920, 0xf948, 0xf8ce, 0xf7a1, 0xf78a, 0xf7d5, 0xf982,
+	0xfe10, 0x0364, 0x042d, 0x0382, 0x01ec, 0xfe5a, 0xfb50, 0xf7e3,
+	0xf649, 0xf685, 0xf770, 0xf7e4, 0xf8a1, 0xf9d2, 0xfb76, 0xfdac,
+	0xffc6, 0x038c, 0x06f1, 0x098b, 0x0bff, 0x0cce, 0x0cda, 0x0d9c,
+	0x0fcf, 0x0f9d, 0x0e9f, 0x0e7e, 0x0a9f, 0x06dd, 0x042b, 0xfff4,
+	0xfcc3, 0xfa82, 0xfa07, 0xfa83, 0xf9aa, 0xf85d, 0xf6bd, 0xf4e8,
+	0xf3b9, 0xf546, 0xf91d, 0xfdf9, 0x0119, 0x0063, 0x00b2, 0x006c,
+	0xfbf8, 0xf6e1, 0xf401, 0xf497, 0xf60d, 0xf6aa, 0xf5e1, 0xf5c3,
+	0xf89a, 0xfbd9, 0xfeb3, 0x0304, 0x07b1, 0x0a82, 0x0cff, 0x0fc6,
+	0x10bc, 0x1053, 0x1247, 0x14a0, 0x13f2, 0x1270, 0x0f91, 0x09cb,
+	0x0484, 0x0124, 0xfc9c, 0xf88f, 0xf747, 0xf797, 0xf6a7, 0xf64d,
+	0xf7b8, 0xf549, 0xf343, 0xf493, 0xf68a, 0xfa0b, 0xfce8, 0xfe30,
+	0xfe15, 0xfdf6, 0xfd25, 0xf9cd, 0xf72c, 0xf63c, 0xf58a, 0xf56a,
+	0xf6b1, 0xf858, 0xf940, 0xfa95, 0xfcbc, 0x006f, 0x05f8, 0x0a7b,
+	0x0d13, 0x10c1, 0x1338, 0x130a, 0x12e9, 0x1381, 0x13f5, 0x12c6,
+	0x10c4, 0x0c4b, 0x0618, 0x00d9, 0xfb80, 0xf5e6, 0xf319, 0xf53a,
+	0xf6a5, 0xf568, 0xf6da, 0xf7be, 0xf59b, 0xf59f, 0xf763, 0xfad2,
+	0xfda5, 0xff97, 0x0063, 0xfeb7, 0xfe55, 0xfbc6, 0xf8d4, 0xf8c1,
+	0xf7f5, 0xf764, 0xf6b1, 0xf63a, 0xf75f, 0xf8e9, 0xfa5f, 0xfd73,
+	0x022f, 0x0728, 0x0b96, 0x0f21, 0x118d, 0x12f4, 0x13c9, 0x13ee,
+	0x1263, 0x110c, 0x10f4, 0x0d5d, 0x0742, 0x0210, 0xfe10, 0xf8ce,
+	0xf3e9, 0xf4a6, 0xf75e, 0xf667, 0xf6a2, 0xf8e3, 0xf80f, 0xf683,
+	0xf7c7, 0xfa84, 0xfd6d, 0x0044, 0x0108, 0xffef, 0xfeff, 0xfe28,
+	0xf9c0, 0xf775, 0xf7ed, 0xf506, 0xf464, 0xf3e4, 0xf443, 0xf64c,
+	0xf7cf, 0xfb60, 0x00a7, 0x0714, 0x0b6c, 0x0f28, 0x1290, 0x13c1,
+	0x13f1, 0x136c, 0x12b9, 0x11bc, 0x0f66, 0x0cbb, 0x0983, 0x045f,
+	0xff54, 0xfab2, 0xf72d, 0xf4c7, 0xf59d, 0xf74e, 0xf607, 0xf73d,
+	0xf7d4, 0xf613, 0xf638, 0xf82b, 0xfcc8, 0x0153, 0x0400, 0x0424,
+	0x0114, 0xfdf0, 0xfa42, 0xf7ac, 0xf78f, 0xf4a7, 0xf20a, 0xf29f,
+	0xf3c0, 0xf5e5, 0xf7bb, 0xfbdb, 0x0140, 0x0653, 0x0c7e, 0x0faa,
+	0x119b, 0x12c3, 0x11c3, 0x0ff7, 0x0f71, 0x0e9e, 0x0c5c, 0x0b2f,
+	0x0807, 0x03c3, 0x0175, 0x0193, 0xfee1, 0xf7d1, 0xf681, 0xf780,
+	0xf639, 0xf72f, 0xf855, 0xf856, 0xf8ca, 0xf99b, 0xfcfd, 0x0178,
+	0x0546, 0x0461, 0x0093, 0xff47, 0xfa4b, 0xf420, 0xf18d, 0xf027,
+	0xf182, 0xf435, 0xf4de, 0xf691, 0xfaf8, 0xfea2, 0x02a1, 0x085e,
+	0x0c84, 0x0da7, 0x0eef, 0x0fd5, 0x0d91, 0x0bac, 0x0beb, 0x0b74,
+	0x0b50, 0x0c5c, 0x0958, 0x03f4, 0x0440, 0x0401, 0xfced, 0xf809,
+	0xfc2f, 0x041a, 0xf7e5, 0xe796, 0xfc51, 0x045a, 0xf708, 0xfcf8,
+	0xfffc, 0x062b, 0xfe27, 0xf9f4, 0x04bb, 0xf2d7, 0xf2c8, 0xf591,
+	0xedd8, 0xf264, 0xebc8, 0xf636, 0xfd68, 0xf84f, 0x0394, 0x05dd,
+	0x0741, 0x0d76, 0x0a2b, 0x0cbf, 0x0c6f, 0x0502, 0x0890, 0x08a8,
+	0x068c, 0x08b5, 0x089c, 0x0e36, 0x09cc, 0x05c5, 0x0bdc, 0x01d4,
+	0xf5a9, 0xf029, 0x0200, 0x0bb4, 0xeff8, 0xfdfb, 0x0d07, 0xfaf7,
+	0xfc9d, 0xfdcf, 0x0046, 0xfc02, 0xf1a5, 0xf8d2, 0xf3b3, 0xe663,
+	0xeec1, 0xedd3, 0xea11, 0xf5b2, 0xf9d0, 0x0054, 0x02e1, 0x0719,
+	0x1238, 0x0dd9, 0x0aad, 0x0f96, 0x0da5, 0x0bec, 0x09de, 0x042a,
+	0x0566, 0x0491, 0x04bb, 0x0ae1, 0x0722, 0x017a, 0x05d5, 0x0732,
+	0xff70, 0xf727, 0xeea7, 0xf487, 0xff68, 0xf916, 0x03be, 0x0aa7,
+	0x0119, 0x0bf3, 0x06a1, 0xfafe, 0xff6c, 0xf5f3, 0xf329, 0xf402,
+	0xea4d, 0xed61, 0xee1d, 0xecab, 0xf537, 0xf9f6, 0x04ee, 0x0a6d,
+	0x09a8, 0x1165, 0x0f4b, 0x0bb5, 0x0bd4, 0x05ea, 0x06c7, 0x0765,
+	0xff3b, 0x0006, 0x027d, 0x042e, 0x07a6, 0xff09, 0xfdf1, 0x0862,
+	0x0592, 0xfafc, 0xf4fa, 0xf47f, 0xff69, 0x00e9, 0xfd50, 0x080e,
+	0x0989, 0x0d21, 0x0d3d, 0x00c0, 0x0208, 0xfcd6, 0xf313, 0xf497,
+	0xedc9, 0xe84a, 0xeba8, 0xecbb, 0xf0b3, 0xf497, 0xfb8d, 0x06dc,
+	0x0980, 0x0cf1, 0x1160, 0x0dab, 0x0b92, 0x086d, 0x0478, 0x0478,
+	0x0186, 0xff5f, 0x014e, 0x0532, 0x078a, 0x0235, 0xfc41, 0x0010,
+	0x0827, 0x01c9, 0xf375, 0xf39d, 0x01ea, 0x0721, 0xff74, 0x01a1,
+	0x0a4e, 0x0ebd, 0x0a0d, 0x03e4, 0x04a6, 0xfeb0, 0xf568, 0xf295,
+	0xee39, 0xe916, 0xe76b, 0xe9d8, 0xf3aa, 0xf5de, 0xf701, 0x0598,
+	0x0cd8, 0x0c4c, 0x0e6c, 0x0f5a, 0x0f47, 0x0a53, 0x0540, 0x0772,
+	0x0221, 0xfac9, 0xff75, 0x0484, 0x06a4, 0x0292, 0xfc57, 0x01f9,
+	0x07ec, 0x0007, 0xf348, 0xf4d8, 0x02be, 0x06cb, 0x0119, 0x0059,
+	0x0908, 0x0fc6, 0x0953, 0x022f, 0x0276, 0x005c, 0xf8d4, 0xf1df,
+	0xee38, 0xea1c, 0xe496, 0xe74e, 0xeec4, 0xf354, 0xfaf4, 0x020d,
+	0x0a86, 0x1167, 0x10d5, 0x12de, 0x1285, 0x0d29, 0x0c0d, 0x0714,
+	0x015c, 0xffec, 0xfca3, 0x017e, 0x04ef, 0xfe6e, 0xfab7, 0x0011,
+	0x093f, 0xff55, 0xee0c, 0xf804, 0x08ef, 0x0528, 0xfcee, 0xfd7a,
+	0x09a2, 0x124d, 0x05ce, 0xfd05, 0x038c, 0x048a, 0xfac8, 0xeedb,
+	0xecb2, 0xeedf, 0xe716, 0xe3c6, 0xeaed, 0xf4aa, 0xfac4, 0xfc34,
+	0x06e5, 0x1429, 0x168e, 0x128e, 0x10bd, 0x1426, 0x132b, 0x089c,
+	0x011f, 0x01f8, 0x02c6, 0x015e, 0xfd36, 0xfa3f, 0xfc3f, 0x007c,
+	0x004a, 0xf7db, 0xf3db, 0xfd4a, 0x03fd, 0x0096, 0xfddf, 0x00e1,
+	0x098c, 0x0c46, 0x0484, 0x0175, 0x0443, 0x03da, 0xfd2a, 0xf253,
+	0xee0f, 0xef78, 0xebe0, 0xe7f1, 0xe9e3, 0xf17f, 0xf960, 0xfe1a,
+	0x03f8, 0x0cf9, 0x1501, 0x1596, 0x1253, 0x1459, 0x1448, 0x0cf4,
+	0x06ba, 0x028a, 0x017a, 0x02da, 0xfea7, 0xfa58, 0xfb19, 0xfb39,
+	0xfddd, 0xfb31, 0xf34a, 0xf891, 0xfe94, 0xffba, 0x01c1, 0xfecd,
+	0x030c, 0x0b9a, 0x078a, 0x042b, 0x0438, 0x01ad, 0x02ef, 0xfaba,
+	0xf0b2, 0xf263, 0xee53, 0xeacb, 0xec40, 0xec11, 0xf3b8, 0xfcdc,
+	0x012a, 0x0787, 0x0cca, 0x119a, 0x152d, 0x1303, 0x11f7, 0x0f7c,
+	0x0a5f, 0x080f, 0x04b3, 0x0165, 0x001e, 0xfd6f, 0xfbe2, 0xfc19,
+	0xfa0a, 0xfb5c, 0xfc46, 0xf6cf, 0xf794, 0xfbe1, 0xfd9d, 0x0219,
+	0x0043, 0x000a, 0x0721, 0x067f, 0x04f1, 0x032b, 0x0070, 0x024b,
+	0xfd66, 0xf53a, 0xf39e, 0xf189, 0xf0e8, 0xf20f, 0xef45, 0xf43e,
+	0xfc7f, 0x0031, 0x0648, 0x088f, 0x0c20, 0x1271, 0x0f83, 0x0be6,
+	0x0bab, 0x0a49, 0x09a7, 0x0562, 0x00cb, 0x00c2, 0xff45, 0xfdf6,
+	0xfd7d, 0xf9f6, 0xf972, 0xfbec, 0xfc69, 0xfd2f, 0xfa64, 0xfa11,
+	0x000e, 0x010b, 0x024a, 0x04bb, 0x0361, 0x05fe, 0x0627, 0x012b,
+	0x0031, 0xfe42, 0xfb05, 0xf9b3, 0xf6da, 0xf56f, 0xf575, 0xf550,
+	0xf8d1, 0xfbab, 0xfc8b, 0x00fe, 0x03e0, 0x05b9, 0x0775, 0x06ea,
+	0x085a, 0x0825, 0x061f, 0x05cb, 0x04dc, 0x044d, 0x037e, 0x0127,
+	0x006b, 0xffa8, 0xfe52, 0xfe3e, 0xfdcc, 0xfd0f, 0xfca7, 0xfd11,
+	0xfec0, 0x005a, 0x0070, 0x00b7, 0x0186, 0x02e7, 0x048b, 0x0380,
+	0x01a1, 0x00dc, 0xff0a, 0xfcc4, 0xfb17, 0xfa2e, 0xf97e, 0xf8e1,
+	0xfa48, 0xfc76, 0xfc92, 0xfd67, 0xff2b, 0x0064, 0x00d1, 0x016d,
+	0x0242, 0x026a, 0x0195, 0x00b8, 0x0285, 0x03cb, 0x02d0, 0x01f6,
+	0x01b3, 0x02d1, 0x02ec, 0x0132, 0x002b, 0xfec3, 0xfef0, 0xffee,
+	0xffe4, 0x0069, 0xffe3, 0x0007, 0x0232, 0x02d8, 0x02d2, 0x032c,
+	0x0213, 0x0189, 0x013d, 0xff20, 0xfdd4, 0xfcdf, 0xfb42, 0xfa92,
+	0xfb31, 0xfcc7, 0xfcf4, 0xfd3c, 0xfde4, 0xfe36, 0xffb2, 0xff7c,
+	0xfee5, 0xff6b, 0x0023, 0x0064, 0xff35, 0x0004, 0x015a, 0x00a8,
+	0x0097, 0x014d, 0x02a2, 0x027a, 0x0145, 0x01ae, 0x012a, 0x0094,
+	0x0154, 0x00fe, 0x0076, 0x00d7, 0x01f1, 0x027d, 0x0266, 0x0255,
+	0x020d, 0x0260, 0x030d, 0x0146, 0xfe7d, 0xfe84, 0xfe8d, 0xfd1f,
+	0xfd53, 0xfdc9, 0xfdc3, 0xfd56, 0xfd3f, 0xff82, 0x001a, 0xfe65,
+	0xfe73, 0xff94, 0xff37, 0xfeca, 0xfece, 0xfe93, 0xfebe, 0xffa3,
+	0x007c, 0x001d, 0xff6e, 0xffce, 0x00a8, 0x00bd, 0x010b, 0x00f8,
+	0x004e, 0x006a, 0x00d9, 0x01a7, 0x018f, 0x00e0, 0x01b3, 0x0237,
+	0x025b, 0x02b7, 0x01dd, 0x00c0, 0x00c9, 0x00a8, 0x007f, 0xffb4,
+	0xfeca, 0xfe81, 0xfe46, 0xff9d, 0x0096, 0xffb1, 0xff7d, 0xfeb9,
+	0xfe9d, 0x004e, 0x0037, 0xff1d, 0xfdce, 0xfcfd, 0xfe06, 0xff71,
+	0xfeda, 0xfd64, 0xfe56, 0xff92, 0xff82, 0xff40, 0xfef5, 0xff10,
+	0xffa4, 0x0029, 0x0066, 0x0070, 0x00bf, 0x00fb, 0x0160, 0x022d,
+	0x026c, 0x0248, 0x025e, 0x0240, 0x01ce, 0x0111, 0x00a8, 0xffc1,
+	0xffe4, 0x017b, 0x0022, 0xfe30, 0xffa2, 0x00ac, 0x0044, 0xfff6,
+	0xff34, 0xff5e, 0xffcf, 0xff10, 0xfede, 0xff1a, 0xfef3, 0xfeca,
+	0xfee6, 0xfee2, 0xff67, 0xff99, 0xfedf, 0xfede, 0xfee0, 0xff80,
+	0x0074, 0x003a, 0xff55, 0xfe5c, 0xff36, 0x018c, 0x021d, 0x0070,
+	0x00e8, 0x0205, 0x022a, 0x026b, 0x01d6, 0x014a, 0x00b1, 0x0055,
+	0x0061, 0x005b, 0x000b, 0xff62, 0xff6e, 0xff8c, 0xffcf, 0x00ed,
+	0xff9f, 0xfea9, 0xfff9, 0xfee3, 0xfec8, 0x0035, 0xffc7, 0xff51,
+	0xfe78, 0xfeb3, 0x007c, 0x0033, 0xff0d, 0xfe5b, 0xfe88, 0x0042,
+	0x0051, 0xff99, 0x00cb, 0xff24, 0xfe34, 0x00a3, 0xfff0, 0x00b2,
+	0x01ec, 0xffc1, 0x00e1, 0x0323, 0x02ce, 0x016d, 0xff19, 0xfff1,
+	0x01f6, 0x00c1, 0x0043, 0xffa5, 0xfef3, 0x001a, 0xfe8e, 0xfe16,
+	0xfff0, 0xff25, 0xfe4b, 0xfe4e, 0xff43, 0x0157, 0xffff, 0xfe0d,
+	0xff74, 0x005c, 0x0067, 0xfff7, 0xff59, 0xff6f, 0xffcf, 0xffce,
+	0xff67, 0x0011, 0x0049, 0xffac, 0xff35, 0x002a, 0x016a, 0x0068,
+	0x0014, 0x00f8, 0x00ba, 0x0138, 0x0180, 0xffd9, 0x008c, 0x01be,
+	0xfffb, 0xff18, 0xffeb, 0x0059, 0x0041, 0xff6a, 0xfee7, 0xfff9,
+	0xffb6, 0xff35, 0xff85, 0xff41, 0x005c, 0x0046, 0xfec3, 0x000b,
+	0x0194, 0x011b, 0xff9a, 0xfe26, 0xffba, 0x01fe, 0x006c, 0xff0f,
+	0xfea0, 0xff32, 0x007e, 0xff86, 0xff40, 0x010a, 0x00cc, 0xff20,
+	0xfff1, 0x0188, 0x016e, 0x00dc, 0x0013, 0xfffb, 0x014b, 0x00c1,
+	0xff28, 0x0095, 0x0041, 0xfe26, 0xff5e, 0x008b, 0x00ec, 0x0020,
+	0xfddc, 0xfe48, 0xff8e, 0x008b, 0x0139, 0xfe9b, 0xfee6, 0x0174,
+	0x0148, 0x00d7, 0xff20, 0xff94, 0x019c, 0x0104, 0xffcf, 0xfe5c,
+	0xff9c, 0x0133, 0xfedc, 0xfe03, 0xfef1, 0xff73, 0x0184, 0x008f,
+	0xfe83, 0x0071, 0x0181, 0x0186, 0x0100, 0x0004, 0x00c1, 0x003f,
+	0xffd3, 0x0074, 0xff64, 0xfec0, 0xfda2, 0xfd52, 0x0046, 0x00ca,
+	0xfe8b, 0xfea8, 0xff88, 0x00bd, 0x015c, 0xff99, 0xff49, 0x008b,
+	0x010c, 0x0143, 0x0097, 0xff71, 0x009a, 0x00d4, 0xfed0, 0xff8d,
+	0x0059, 0xff54, 0xff32, 0xfed8, 0xff0b, 0x00ca, 0x008a, 0xff2a,
+	0xff24, 0xffce, 0x00a2, 0x0083, 0x001d, 0x003d, 0xff55, 0x0059,
+	0x03b5, 0x00c8, 0xfc94, 0xff0d, 0x00fb, 0x00f2, 0xffe9, 0xfe41,
+	0xffc5, 0x00fe, 0xffe3, 0x00b1, 0xff8e, 0xfea2, 0x0168, 0x0013,
+	0xffa0, 0x0158, 0x0012, 0x00a4, 0x0002, 0xff39, 0x0147, 0x002d,
+	0xff8b, 0x00a0, 0xffcb, 0x0074, 0x005d, 0xff94, 0xff6b, 0xfffc,
+	0x01f7, 0xfde3, 0xfc9c, 0x01a1, 0x01c4, 0xffe5, 0xfef2, 0xfe87,
+	0x00b4, 0x0172, 0xff93, 0xff48, 0xff86, 0x016b, 0x00cd, 0xfde8,
+	0xffa8, 0x0120, 0x002c, 0xfe9f, 0xfd95, 0xffd7, 0x01e6, 0x0044,
+	0xff87, 0xff1c, 0xffa0, 0x02e9, 0x013b, 0xfe9b, 0x0001, 0x0045,
+	0x00aa, 0x01e3, 0x0003, 0xff78, 0x006a, 0xfff0, 0x009d, 0x0032,
+	0x0013, 0x003d, 0xff6d, 0xffd4, 0x005f, 0x0096, 0xff9a, 0xfe42,
+	0xfe46, 0xfee5, 0xffb2, 0x00f7, 0xff57, 0xfd76, 0xff16, 0x003a,
+	0x0050, 0xfef9, 0xfe56, 0x0056, 0x005e, 0xff6b, 0xfffd, 0x008a,
+	0x00ae, 0xffea, 0xff3a, 0x0221, 0x02c3, 0xff96, 0xfe18, 0xfefc,
+	0x025a, 0x0340, 0x0012, 0xfee3, 0xfe7c, 0x0011, 0x046d, 0x01dc,
+	0xfd20, 0xfea1, 0x0002, 0x018a, 0x0229, 0xff0e, 0xfe2a, 0xfeb2,
+	0xfe51, 0xffdd, 0x013a, 0x000e, 0xfe45, 0xfd59, 0xffcd, 0x01d8,
+	0x00cc, 0xff3e, 0xfcf8, 0xfe55, 0x038d, 0x0345, 0xfed7, 0xfec3,
+	0xffa7, 0xffdb, 0x01eb, 0x0125, 0xff2f, 0xff68, 0xff76, 0xfedf,
+	0x0117, 0x0347, 0x0146, 0xff45, 0xfe47, 0x0175, 0x04c8, 0xfffd,
+	0xfd7b, 0xff38, 0xff2e, 0x0216, 0x0185, 0xfbd6, 0xfbb6, 0xfed6,
+	0x0123, 0x017d, 0xff9a, 0xfeb2, 0xfe86, 0xffec, 0x0239, 0x00b1,
+	0xff03, 0xffbf, 0xfee9, 0x0142, 0x02d9, 0xfe10, 0xfe59, 0x01f4,
+	0x00fe, 0xff88, 0xff82, 0x0017, 0x003e, 0xff61, 0xffee, 0x029d,
+	0x034e, 0x00de, 0xfe20, 0xfe2d, 0x014d, 0x0365, 0x0183, 0xfeb4,
+	0xfe4c, 0xfdd5, 0xff40, 0xff62, 0xfb28, 0xfda4, 0x01d1, 0xff61,
+	0xff78, 0xfecf, 0xfd67, 0x0151, 0x01c9, 0xff71, 0xffc5, 0x0064,
+	0x0085, 0xfec8, 0xffb2, 0x0210, 0x016d, 0x0107, 0x0001, 0xfed6,
+	0x00c1, 0x0172, 0xfed8, 0x0007, 0x0292, 0x0224, 0x00ae, 0xfe4b,
+	0xfcb4, 0x0097, 0x048a, 0x0169, 0xfe67, 0xfe9a, 0x0071, 0x016f,
+	0xff91, 0xfcd6, 0xfe1b, 0x00ae, 0x00c1, 0x003b, 0xfcca, 0xfcfb,
+	0x0193, 0x000d, 0xff21, 0x019f, 0x0085, 0xff83, 0xfed6, 0xfe15,
+	0x0373, 0x044b, 0xfee8, 0xfe14, 0xffd3, 0x00f4, 0x007e, 0x008d,
+	0x0078, 0x00eb, 0x012c, 0x00e2, 0x0038, 0xff11, 0xfecb, 0xffe4,
+	0x02c8, 0x0231, 0xfe1c, 0xfd77, 0x0092, 0x00c1, 0xffbf, 0xff23,
+	0xff5f, 0x0267, 0xffbe, 0xfb74, 0xfe2a, 0x014e, 0x003a, 0xfe12,
+	0xfc94, 0xff31, 0x034b, 0x003b, 0xfd47, 0xfe98, 0x0158, 0x056b,
+	0x051c, 0xfd26, 0xfcfd, 0x01e5, 0x0083, 0x00aa, 0x00b8, 0x0095,
+	0x00cd, 0xffd5, 0xfccd, 0xfcbd, 0x0360, 0x0467, 0xfe6d, 0xfd52,
+	0x00bf, 0x0360, 0x02af, 0xfd52, 0xf999, 0xfd62, 0x0491, 0x0338,
+	0xfb5f, 0xfda4, 0xff71, 0xfb94, 0xfeaf, 0x0120, 0x0053, 0x0004,
+	0xfe0d, 0xfdc2, 0x0158, 0x040d, 0x03cc, 0xfe95, 0xfdf6, 0x02b4,
+	0x0201, 0x0194, 0x0085, 0xfd51, 0x0085, 0x02ef, 0xfde4, 0xfe5f,
+	0x0152, 0x0181, 0x01a0, 0xfd68, 0xfc57, 0x0202, 0x0627, 0x01c9,
+	0xfb7c, 0xfd33, 0x00cb, 0x0153, 0x01f6, 0x010a, 0xfd4f, 0xfc88,
+	0xff17, 0x0309, 0x02ae, 0xfd7a, 0xfb08, 0xfa1d, 0xfd80, 0x0419,
+	0x045a, 0x000c, 0xfea2, 0xfef0, 0x01a4, 0x05d6, 0x043c, 0xfe83,
+	0xfce1, 0x00fc, 0x04b0, 0x0280, 0xfaa9, 0xf80a, 0xff06, 0x0518,
+	0x03f3, 0xfe25, 0xfd5b, 0x00d6, 0x0337, 0x0519, 0x0246, 0xfdc1,
+	0xfc2d, 0xfde0, 0xff7f, 0x00d3, 0x0048, 0xfb81, 0xfb70, 0x00cd,
+	0x03f8, 0x0273, 0xfd05, 0xf9b8, 0xfe17, 0x04ec, 0x085b, 0x0208,
+	0xfa23, 0xfac5, 0xfd3f, 0x0356, 0x05fd, 0x0088, 0xfe27, 0xff31,
+	0xff0a, 0xfed4, 0x00d4, 0x0415, 0x02aa, 0xffbd, 0xffeb, 0xfd43,
+	0x0104, 0x06a0, 0x01fe, 0x0048, 0xfd56, 0xfb2c, 0x003e, 0xff5e,
+	0xfd6a, 0xfe49, 0xfa85, 0xfafd, 0x0326, 0x0795, 0x033c, 0xf93e,
+	0xf5ea, 0xfc04, 0x06d0, 0x0dac, 0x0312, 0xf562, 0xf638, 0xff79,
+	0x0682, 0x062f, 0xff40, 0xfaf5, 0xff54, 0x03e2, 0x0533, 0x042f,
+	0xff14, 0xfa3a, 0xfdaf, 0x03fa, 0x0585, 0x0266, 0xfcca, 0xfea9,
+	0x04cf, 0x0317, 0xfe74, 0xfda8, 0xfc8a, 0xff9a, 0x0047, 0xfc34,
+	0xffdb, 0xffae, 0xf971, 0xfb2f, 0x027f, 0x05e1, 0x0299, 0xf9c7,
+	0xfa8f, 0x072b, 0x078c, 0x0028, 0xfaa1, 0xf77e, 0xfd8d, 0x0226,
+	0xffb5, 0x00e9, 0x02fc, 0x0439, 0x0544, 0x0011, 0x008a, 0x05a2,
+	0x02ca, 0xffc5, 0xfe4b, 0xffed, 0x03bb, 0x0161, 0xfd00, 0xf8a7,
+	0xf81f, 0xffda, 0x04c0, 0x0503, 0x047e, 0xfe49, 0xf6dd, 0xf95e,
+	0x0593, 0x09d8, 0x00e8, 0xf91f, 0xf74e, 0xfb75, 0x00f2, 0x022a,
+	0x01e8, 0x0196, 0xfc49, 0xfb56, 0x012a, 0x03e9, 0x0199, 0xfcd1,
+	0x0198, 0x0915, 0x086c, 0x028c, 0xfb64, 0xfb35, 0x004a, 0x0118,
+	0x0198, 0x047a, 0x02dc, 0xfe3c, 0xfac4, 0xfcff, 0x01b1, 0xffab,
+	0xfc63, 0xfe59, 0x0235, 0x0159, 0xfbb4, 0xf896, 0xfc6c, 0x033c,
+	0x05ef, 0x0104, 0xfaa0, 0xfabf, 0x0117, 0x05bc, 0x0268, 0xfe24,
+	0xfd02, 0xfd4c, 0xfefc, 0x0099, 0x0471, 0x05ce, 0x0023, 0xfd6a,
+	0x0175, 0x06cb, 0x06aa, 0xfe2e, 0xf801, 0xfdec, 0x0565, 0x02eb,
+	0xfc2e, 0xfb5b, 0xfd52, 0xfdf8, 0x018c, 0x0432, 0x0263, 0xfe8e,
+	0xfc28, 0xfd8c, 0x01f0, 0x0191, 0xfc75, 0xfd67, 0x016e, 0x0141,
+	0xffb2, 0xff2e, 0x009f, 0x0223, 0x0068, 0x004e, 0x0250, 0x0107,
+	0x0069, 0x027b, 0x03fa, 0x0155, 0xfc3e, 0xfb4e, 0xffb6, 0x044e,
+	0x037b, 0xfe17, 0xfa8c, 0xfb8b, 0xfdb5, 0x0175, 0x0236, 0xffba,
+	0xfdb7, 0xfc00, 0xff6d, 0x0450, 0x03ae, 0x0105, 0xff2c, 0xfec5,
+	0x001a, 0x00f4, 0xff19, 0xfb57, 0xfc96, 0x02bf, 0x0570, 0x034d,
+	0x0044, 0xff0b, 0x01aa, 0x035e, 0x0255, 0x029b, 0x047e, 0x02f6,
+	0xfd43, 0xf86f, 0xf8fa, 0xfc41, 0xfe0a, 0xfe06, 0xfd29, 0xfd84,
+	0xff13, 0x0229, 0x05a1, 0x055b, 0x0092, 0xfcd7, 0xfef4, 0x0379,
+	0x03cc, 0xfe58, 0xf82c, 0xf71a, 0xfcb3, 0x0430, 0x083f, 0x0735,
+	0xfee0, 0xf91f, 0xfe0c, 0x063d, 0x08e0, 0x0402, 0xfce3, 0xfbef,
+	0xfea3, 0xffac, 0xfdf4, 0xf8e8, 0xfa28, 0x008c, 0x0469, 0x04f1,
+	0x0151, 0xfa76, 0xf9c0, 0xfee0, 0x03d7, 0x068d, 0x0415, 0xff0d,
+	0xfd1b, 0x0056, 0x035e, 0x03f6, 0x01f1, 0xff4f, 0xff34, 0x0011,
+	0xff63, 0xffb8, 0x01ea, 0x03b8, 0x02fa, 0xff68, 0xfbf8, 0xfa64,
+	0xfa95, 0xfdc5, 0x0140, 0x0041, 0xfb25, 0xf6c6, 0xf634, 0xf94d,
+	0xfe10, 0x01de, 0x0408, 0x04d3, 0x0263, 0xfdb8, 0xfd73, 0x0211,
+	0x085c, 0x0d7c, 0x0e22, 0x09ec, 0x03f6, 0xffd5, 0xff9c, 0x022a,
+	0x056f, 0x0608, 0x03cc, 0x0245, 0xffb0, 0xfb1a, 0xf8e5, 0xfc31,
+	0x0270, 0x04e8, 0x011a, 0xfaac, 0xf54e, 0xf481, 0xf576, 0xf480,
+	0xf263, 0xefb0, 0xee06, 0xef2f, 0xf20e, 0xf5cd, 0xfa4f, 0x002f,
+	0x0802, 0x0fdb, 0x14e0, 0x144c, 0x10f8, 0x105f, 0x1258, 0x13cb,
+	0x1265, 0x0d1b, 0x07ca, 0x0588, 0x0380, 0xfdee, 0xf5fd, 0xf2ca,
+	0xf9d7, 0x0a03, 0x1986, 0x1cbd, 0x109a, 0xfcbe, 0xeaac, 0xe334,
+	0xe5e7, 0xec7d, 0xf18a, 0xef80, 0xe4c5, 0xd6d6, 0xd0b6, 0xd6c0,
+	0xe869, 0xfb78, 0x07d1, 0x0b7d, 0x0a73, 0x0c99, 0x12b6, 0x19f5,
+	0x1e98, 0x1f0b, 0x1b13, 0x14f9, 0x108a, 0x0faf, 0x1144, 0x14c5,
+	0x17d4, 0x15c4, 0x0b0d, 0xf6be, 0xe4b6, 0xe4b2, 0xfbd3, 0x1c18,
+	0x2dba, 0x23ff, 0x044c, 0xe3ab, 0xd0ce, 0xd413, 0xe58b, 0xf500,
+	0xf588, 0xe453, 0xcc3c, 0xbc3a, 0xc0a0, 0xd7c9, 0xf5fb, 0x0bff,
+	0x12d4, 0x0d34, 0x08f9, 0x0eca, 0x1d7e, 0x2d7b, 0x3381, 0x2de8,
+	0x1f08, 0x0e81, 0x0702, 0x08dc, 0x1158, 0x1c6e, 0x2205, 0x1b5e,
+	0x05f2, 0xe823, 0xd8a4, 0xe3db, 0x074a, 0x2c5c, 0x34a9, 0x1f02,
+	0xf4f3, 0xcf6a, 0xc34a, 0xd08d, 0xe849, 0xf87e, 0xf299, 0xdb3b,
+	0xc1de, 0xb6e7, 0xc495, 0xe2f8, 0x03a3, 0x1404, 0x1398, 0x0dbb,
+	0x0d00, 0x166d, 0x25cb, 0x3100, 0x3100, 0x2750, 0x18c7, 0x0cfc,
+	0x07dd, 0x09f8, 0x1219, 0x1c31, 0x225c, 0x1907, 0xffd7, 0xe4c9,
+	0xdb46, 0xecdc, 0x1142, 0x2d23, 0x2bab, 0x0cbe, 0xe122, 0xc487,
+	0xc1af, 0xd5da, 0xef57, 0xfbdf, 0xf41a, 0xdec3, 0xc8ed, 0xc24b,
+	0xd209, 0xed86, 0x07d4, 0x1468, 0x11f0, 0x0abc, 0x0988, 0x1320,
+	0x2166, 0x2b2b, 0x2b21, 0x2416, 0x1b14, 0x12f4, 0x0cb5, 0x09c7,
+	0x0d7b, 0x153d, 0x1a24, 0x12cf, 0xfd7e, 0xe52f, 0xde46, 0xf043,
+	0x107e, 0x2878, 0x251f, 0x07db, 0xe39a, 0xcb71, 0xc783, 0xd70c,
+	0xec59, 0xf9e0, 0xf6d6, 0xe6f7, 0xd71f, 0xd131, 0xdb8f, 0xf061,
+	0x0485, 0x1103, 0x1203, 0x0db1, 0x0c40, 0x1050, 0x1744, 0x1cd7,
+	0x1edd, 0x1e7e, 0x1cc7, 0x19d9, 0x1418, 0x0cd5, 0x096e, 0x0bfa,
+	0x1131, 0x107c, 0x01cc, 0xeb44, 0xe091, 0xebfc, 0x06f3, 0x1dd7,
+	0x1ecc, 0x0a5d, 0xeed0, 0xd9a0, 0xd2b6, 0xd9ad, 0xe861, 0xf37b,
+	0xf501, 0xef3f, 0xe5b6, 0xdf4e, 0xe1ae, 0xebf0, 0xfa26, 0x07df,
+	0x0f26, 0x1082, 0x0f23, 0x0ea7, 0x0fea, 0x11c2, 0x15f6, 0x1a44,
+	0x1d00, 0x1cf4, 0x1863, 0x114e, 0x0b63, 0x0990, 0x0bb4, 0x0c57,
+	0x0515, 0xf55d, 0xe6c6, 0xe7db, 0xf7c8, 0x0d1f, 0x1894, 0x111d,
+	0xfe8f, 0xec17, 0xe1de, 0xe039, 0xe504, 0xeb89, 0xef40, 0xef33,
+	0xed40, 0xe97a, 0xe6f5, 0xe922, 0xef7d, 0xfab7, 0x0731, 0x0f7c,
+	0x11c0, 0x0fd3, 0x0d50, 0x0be0, 0x0d64, 0x1254, 0x182e, 0x1bc3,
+	0x1ad5, 0x15c4, 0x10b2, 0x0e26, 0x0d37, 0x0c27, 0x087d, 0x016a,
+	0xf590, 0xeaff, 0xeac6, 0xf648, 0x05b1, 0x0e04, 0x09c9, 0xfe33,
+	0xf48a, 0xef4b, 0xeca8, 0xeae1, 0xeac2, 0xebaf, 0xed68, 0xefc7,
+	0xefa7, 0xed1b, 0xeb06, 0xeca0, 0xf50c, 0x028c, 0x0db5, 0x1140,
+	0x0eb0, 0x0ad9, 0x095f, 0x0bb4, 0x1087, 0x1482, 0x162d, 0x161d,
+	0x151f, 0x1436, 0x13a8, 0x1158, 0x0c77, 0x0768, 0x0275, 0xfc1d,
+	0xf4b8, 0xefe6, 0xf1da, 0xf9c6, 0x0174, 0x03fa, 0x0061, 0xfa87,
+	0xf617, 0xf266, 0xef96, 0xedeb, 0xedd8, 0xef49, 0xf10f, 0xf157,
+	0xefff, 0xee05, 0xedc4, 0xf1db, 0xfaad, 0x0454, 0x0a4f, 0x0b48,
+	0x0900, 0x0777, 0x0923, 0x0cd3, 0x10a6, 0x12e3, 0x1396, 0x143b,
+	0x153b, 0x168a, 0x1675, 0x127a, 0x0c49, 0x064c, 0x0124, 0xfcde,
+	0xf765, 0xf255, 0xf232, 0xf67d, 0xfb66, 0xfe6d, 0xfc6f, 0xf75b,
+	0xf360, 0xf178, 0xf275, 0xf4dc, 0xf644, 0xf4d8, 0xf1e7, 0xefb7,
+	0xee9f, 0xef61, 0xf260, 0xf69b, 0xfc35, 0x020a, 0x05d2, 0x0683,
+	0x052d, 0x049d, 0x0679, 0x0b56, 0x109e, 0x1368, 0x13f8, 0x1383,
+	0x1367, 0x144e, 0x14b7, 0x1367, 0x0f42, 0x0977, 0x045e, 0xffb2,
+	0xfadf, 0xf647, 0xf37b, 0xf45f, 0xf721, 0xf999, 0xf9ce, 0xf6da,
+	0xf43c, 0xf3e5, 0xf5a2, 0xf92f, 0xfacb, 0xf841, 0xf345, 0xef79,
+	0xef34, 0xf271, 0xf6e8, 0xf9f1, 0xfc28, 0xfe1e, 0xff96, 0x00b7,
+	0x0182, 0x0277, 0x04f9, 0x08fc, 0x0d34, 0x1074, 0x11d0, 0x10fe,
+	0x0f3d, 0x0f0b, 0x114e, 0x13a6, 0x137d, 0x0fbb, 0x0972, 0x03a6,
+	0xffd5, 0xfc3d, 0xf806, 0xf52f, 0xf469, 0xf52c, 0xf6cd, 0xf7d7,
+	0xf745, 0xf700, 0xf775, 0xf7ac, 0xf7b1, 0xf7c2, 0xf727, 0xf634,
+	0xf650, 0xf7b6, 0xf92c, 0xf9a4, 0xf88c, 0xf6e2, 0xf739, 0xfa6e,
+	0xfed1, 0x02c1, 0x04d0, 0x05be, 0x0704, 0x089a, 0x0a18, 0x0b74,
+	0x0cf5, 0x0ee3, 0x114d, 0x1322, 0x1344, 0x10cf, 0x0d0b, 0x0920,
+	0x0653, 0x04da, 0x02ca, 0xfe83, 0xf850, 0xf4a6, 0xf4de, 0xf704,
+	0xf8be, 0xf795, 0xf4dc, 0xf40d, 0xf551, 0xf79b, 0xfa04, 0xfb8f,
+	0xfb6e, 0xfa2e, 0xf8d3, 0xf74d, 0xf59c, 0xf457, 0xf3e3, 0xf5c4,
+	0xf9ec, 0xff0d, 0x0272, 0x0281, 0x00b5, 0xff88, 0x0182, 0x0690,
+	0x0bf4, 0x0fc1, 0x1149, 0x1124, 0x1142, 0x119e, 0x11be, 0x10ac,
+	0x0e54, 0x0c2f, 0x0aa9, 0x092b, 0x05c1, 0xff32, 0xf811, 0xf49d,
+	0xf51d, 0xf6a4, 0xf76b, 0xf5df, 0xf352, 0xf348, 0xf5c5, 0xf83e,
+	0xf94b, 0xf8b0, 0xf6f5, 0xf537, 0xf516, 0xf631, 0xf771, 0xf90d,
+	0xf9b8, 0xf94a, 0xf9c1, 0xfb61, 0xfce5, 0xfe2e, 0xffc9, 0x0218,
+	0x0526, 0x08e7, 0x0c10, 0x0e93, 0x108d, 0x11e1, 0x1367, 0x1503,
+	0x155a, 0x136c, 0x0fb6, 0x0c6d, 0x0a1a, 0x07f1, 0x0521, 0xfff3,
+	0xf867, 0xf306, 0xf21b, 0xf40f, 0xf66f, 0xf63e, 0xf3b0, 0xf226,
+	0xf2f1, 0xf46e, 0xf629, 0xf7e3, 0xf884, 0xf857, 0xf8f1, 0xf996,
+	0xf9bd, 0xf8e9, 0xf798, 0xf7a7, 0xf945, 0xfb0c, 0xfc4f, 0xfe00,
+	0x0011, 0x0205, 0x0406, 0x075f, 0x0bac, 0x0f43, 0x112f, 0x1219,
+	0x12c9, 0x13a3, 0x1443, 0x13cc, 0x1195, 0x0d3e, 0x0859, 0x050c,
+	0x0335, 0x00d0, 0xfb57, 0xf4d7, 0xf182, 0xf223, 0xf4d1, 0xf72c,
+	0xf6bc, 0xf4bc, 0xf3de, 0xf4b3, 0xf77c, 0xf9e4, 0xfacf, 0xf82e,
+	0xf690, 0xf710, 0xf724, 0xf840, 0xf8bb, 0xf8c9, 0xf91e, 0xfa49,
+	0xfca0, 0xffb1, 0x026a, 0x0458, 0x050a, 0x0659, 0x0901, 0x0c32,
+	0x0f4c, 0x110f, 0x10e4, 0x103c, 0x10a6, 0x11fa, 0x11fb, 0x0f7c,
+	0x0aa7, 0x059b, 0x02ad, 0x01ec, 0x008a, 0xfc79, 0xf68c, 0xf27b,
+	0xf2c8, 0xf604, 0xf902, 0xf7fc, 0xf4fe, 0xf351, 0xf423, 0xf6e7,
+	0xf989, 0xfa34, 0xf8a3, 0xf66d, 0xf586, 0xf66f, 0xf840, 0xf9a2,
+	0xf9fb, 0xfa28, 0xfb1f, 0xfd3f, 0x00c0, 0x0436, 0x0633, 0x0665,
+	0x065f, 0x07f2, 0x0b3d, 0x0e7d, 0x0fab, 0x0ef9, 0x0e09, 0x0e1e,
+	0x0ee4, 0x0f90, 0x0eb1, 0x0b43, 0x06c5, 0x040a, 0x036b, 0x02b7,
+	0xff1d, 0xf8db, 0xf394, 0xf214, 0xf446, 0xf787, 0xf840, 0xf5cb,
+	0xf307, 0xf1fa, 0xf41c, 0xf842, 0xfad7, 0xfaa5, 0xf85e, 0xf60f,
+	0xf5a7, 0xf71e, 0xf98a, 0xfb46, 0xfbe9, 0xfc1b, 0xfd43, 0xfffa,
+	0x038d, 0x0637, 0x0758, 0x07ee, 0x0860, 0x09b6, 0x0b8f, 0x0cc1,
+	0x0d2b, 0x0ccc, 0x0ca1, 0x0d9c, 0x0ea6, 0x0e80, 0x0bfe, 0x086f,
+	0x057a, 0x03e8, 0x032e, 0x0122, 0xfc8f, 0xf69a, 0xf26c, 0xf184,
+	0xf361, 0xf660, 0xf742, 0xf607, 0xf515, 0xf531, 0xf753, 0xfa50,
+	0xfc38, 0xfbf2, 0xf9ee, 0xf7df, 0xf759, 0xf870, 0xfa4f, 0xfbef,
+	0xfca2, 0xfd2c, 0xfe5c, 0x008f, 0x03e1, 0x067c, 0x07ae, 0x082c,
+	0x08c0, 0x09f5, 0x0b25, 0x0b77, 0x0ad8, 0x0ab1, 0x0b7e, 0x0cb2,
+	0x0d9b, 0x0ce3, 0x0a8d, 0x0725, 0x040e, 0x0242, 0x0110, 0xff5f,
+	0xfbfe, 0xf7a3, 0xf478, 0xf351, 0xf422, 0xf5f7, 0xf6c7, 0xf6c4,
+	0xf6b1, 0xf724, 0xf8d4, 0xfad7, 0xfc1a, 0xfc1d, 0xfb70, 0xfa0e,
+	0xf8a8, 0xf807, 0xf8cc, 0xfa94, 0xfc66, 0xfe2a, 0xff8a, 0x0137,
+	0x0360, 0x04f0, 0x0636, 0x07bb, 0x0934, 0x0a94, 0x0bb2, 0x0bef,
+	0x0b34, 0x09bf, 0x0846, 0x07dd, 0x08cd, 0x0a0d, 0x09f6, 0x0844,
+	0x058e, 0x033a, 0x0187, 0xffdc, 0xfd59, 0xf9c5, 0xf666, 0xf44e,
+	0xf3ec, 0xf538, 0xf674, 0xf6f9, 0xf745, 0xf728, 0xf805, 0xfa00,
+	0xfba7, 0xfcdd, 0xfce8, 0xfbff, 0xfa46, 0xf8d2, 0xf903, 0xf9e5,
+	0xfb2d, 0xfca5, 0xfdb2, 0xffc1, 0x028e, 0x053c, 0x073d, 0x0839,
+	0x08af, 0x092d, 0x0a5c, 0x0b70, 0x0bab, 0x0b1f, 0x09f1, 0x097d,
+	0x09d7, 0x0a25, 0x09d5, 0x080b, 0x0510, 0x025b, 0x00b6, 0xff76,
+	0xfdbe, 0xfb3b, 0xf855, 0xf58b, 0xf480, 0xf56f, 0xf6b4, 0xf79e,
+	0xf835, 0xf867, 0xf92c, 0xfaa4, 0xfbd5, 0xfc47, 0xfc1b, 0xfad4,
+	0xf93b, 0xf8dc, 0xf966, 0xfa3e, 0xfaf6, 0xfb94, 0xfc98, 0xfeb0,
+	0x0195, 0x0469, 0x06b5, 0x08ac, 0x09ca, 0x0a51, 0x0adb, 0x0b85,
+	0x0bb3, 0x0ac8, 0x0985, 0x082f, 0x07a5, 0x0806, 0x078f, 0x0626,
+	0x047b, 0x02b5, 0x0127, 0x0006, 0xfef5, 0xfd45, 0xfafc, 0xf8e4,
+	0xf784, 0xf6dd, 0xf6f2, 0xf7d1, 0xf869, 0xf89f, 0xf8e8, 0xf951,
+	0xfa74, 0xfbbb, 0xfb94, 0xfa7f, 0xf92b, 0xf8ef, 0xf9a1, 0xfa82,
+	0xfb48, 0xfbcc, 0xfcc8, 0xfebc, 0x010f, 0x0342, 0x054d, 0x06f8,
+	0x0830, 0x0902, 0x0a12, 0x0aa5, 0x0a7c, 0x09ac, 0x08a4, 0x07b1,
+	0x06f1, 0x0651, 0x0592, 0x0522, 0x049b, 0x0385, 0x026c, 0x0146,
+	0x0044, 0xff58, 0xfdd9, 0xfbe1, 0xfa4d, 0xf923, 0xf899, 0xf81b,
+	0xf783, 0xf734, 0xf748, 0xf835, 0xf940, 0xfa1a, 0xfaa8, 0xfb30,
+	0xfb8e, 0xfbe4, 0xfc58, 0xfccd, 0xfdbe, 0xfea9, 0xfefb, 0xff32,
+	0x0027, 0x01ac, 0x03ca, 0x0598, 0x068e, 0x076f, 0x07e3, 0x0836,
+	0x0848, 0x07fa, 0x0782, 0x06b5, 0x060b, 0x058f, 0x049d, 0x03e8,
+	0x037b, 0x02e4, 0x0225, 0x00d0, 0xffb0, 0xff44, 0xfeb6, 0xfd8b,
+	0xfc06, 0xfab2, 0xf9e4, 0xf9c8, 0xf98d, 0xf922, 0xf89d, 0xf84e,
+	0xf900, 0xfa42, 0xfb79, 0xfc0c, 0xfc3f, 0xfca8, 0xfd38, 0xfddc,
+	0xfeb3, 0xffc7, 0x00f7, 0x019c, 0x01a0, 0x01e5, 0x0302, 0x0471,
+	0x0541, 0x0598, 0x0573, 0x0553, 0x0599, 0x0600, 0x05e9, 0x0534,
+	0x0408, 0x031c, 0x02ac, 0x0275, 0x0173, 0xffbf, 0xfed9, 0xfeaa,
+	0xfe99, 0xfe9c, 0xfe40, 0xfdb4, 0xfd40, 0xfcd2, 0xfc84, 0xfc42,
+	0xfc2c, 0xfc5c, 0xfcaa, 0xfcd6, 0xfcad, 0xfc70, 0xfcdc, 0xfdee,
+	0xfead, 0xfee9, 0xff06, 0xff47, 0xffda, 0x0086, 0x00bd, 0x0080,
+	0x0011, 0x0041, 0x0124, 0x0214, 0x02a4, 0x028e, 0x0246, 0x0244,
+	0x026e, 0x02a6, 0x02c3, 0x026b, 0x01cf, 0x013b, 0x00dd, 0x00a9,
+	0x0068, 0x0053, 0x0046, 0xfff9, 0xffdf, 0xffd0, 0xffe7, 0x0033,
+	0x0051, 0x000f, 0xffaa, 0xff8f, 0xff3c, 0xfef3, 0xfed8, 0xfeb2,
+	0xfe99, 0xfeae, 0xfec1, 0xfef7, 0xff27, 0xff7b, 0xffcb, 0xffa8,
+	0xffac, 0xffc2, 0xffbb, 0xffe1, 0xff81, 0xfefd, 0xff05, 0xff78,
+	0xffd6, 0xff55, 0xfe90, 0xfe5d, 0xff76, 0x00dd, 0x01b9, 0x01bd,
+	0x010e, 0x00a3, 0x006d, 0x007a, 0x00af, 0x0126, 0x019b, 0x0164,
+	0x00f4, 0x00d2, 0x00e8, 0x011c, 0x012a, 0x00df, 0x0094, 0x00a1,
+	0x00c3, 0x00a0, 0xfff4, 0xff35, 0xff18, 0xffa7, 0x0000, 0xffb9,
+	0xffa7, 0xffb0, 0xffb1, 0xff4f, 0xfeb2, 0xfe9f, 0xfe76, 0xfdf2,
+	0xfd70, 0xfd72, 0xfdde, 0xfe27, 0xfe3e, 0xfe83, 0xff08, 0xffb2,
+	0x008f, 0x0155, 0x018f, 0x00e4, 0xfff8, 0xff5f, 0xffb7, 0x0098,
+	0x0145, 0x01d8, 0x01c9, 0x0112, 0x006e, 0x0066, 0x005e, 0x00d9,
+	0x0191, 0x01ad, 0x01b4, 0x0134, 0x0023, 0xffeb, 0x000d, 0x0040,
+	0x00a6, 0x00ab, 0x006e, 0xffb9, 0xfec4, 0xfe62, 0xfea3, 0xff7d,
+	0xffed, 0xff1a, 0xfdb6, 0xfd07, 0xfdc5, 0xff63, 0x00de, 0x01bb,
+	0x01ec, 0x0132, 0xff8a, 0xfe3a, 0xfe99, 0x0040, 0x0138, 0x0144,
+	0x006e, 0xfedf, 0xfe7c, 0xff46, 0x009d, 0x01cc, 0x0178, 0x0051,
+	0xffcb, 0xffc7, 0x0032, 0x00ef, 0x013c, 0x00be, 0x006f, 0x00ef,
+	0x0199, 0x005a, 0xfd83, 0xfd39, 0x01ee, 0x070d, 0x05fc, 0xfee1,
+	0xf6d3, 0xf530, 0xfa96, 0x0143, 0x04a1, 0x02b5, 0x0008, 0x0042,
+	0x01a3, 0x01d6, 0x004c, 0xff07, 0x00a7, 0x0359, 0x041d, 0x0174,
+	0xfd12, 0xfb41, 0xfc20, 0xfe88, 0x0025, 0xffed, 0xff85, 0xff51,
+	0xff50, 0xff6b, 0x004d, 0x021e, 0x034f, 0x029e, 0x0138, 0x00bc,
+	0x0049, 0xffbe, 0x0053, 0x006a, 0xff5d, 0xfdf5, 0xfc40, 0xfc90,
+	0xfdf8, 0xff06, 0xff65, 0xfeda, 0xff6b, 0xffd0, 0x0057, 0x025d,
+	0x029c, 0x01a6, 0x0178, 0x00ea, 0x00a0, 0x00c9, 0x0053, 0xffa2,
+	0xffc2, 0x0052, 0xfff4, 0xfed9, 0xfe38, 0xfe21, 0xfe51, 0xff5c,
+	0x0110, 0x00fa, 0x010b, 0x0102, 0xff08, 0xffc4, 0x01d6, 0x017f,
+	0x01e8, 0x0213, 0x0003, 0xfed2, 0xfdc8, 0xfd68, 0xfefc, 0xffa8,
+	0xff60, 0xfed5, 0xfe06, 0xfe5d, 0xff03, 0x0022, 0x01e2, 0x0172,
+	0x0059, 0x01a2, 0x02d0, 0x02f1, 0x0186, 0xfed4, 0xfeb5, 0x0011,
+	0x0075, 0xffed, 0xff19, 0xffbf, 0x0062, 0x0034, 0x0070, 0x0061,
+	0x00bc, 0x0024, 0xff32, 0x0001, 0x007e, 0x0017, 0xffa7, 0xfedf,
+	0xfea1, 0xfeaa, 0xfe2b, 0xff38, 0x021e, 0x0299, 0xffdb, 0xfd9b,
+	0xfce2, 0xff72, 0x0271, 0x009e, 0xff56, 0xff8c, 0xff54, 0x014d,
+	0x00da, 0xff12, 0x001e, 0x006f, 0x028c, 0x02bc, 0xff25, 0xfe98,
+	0xfee6, 0x00d5, 0x0343, 0xffdd, 0xfdd0, 0x020f, 0x02f3, 0xff85,
+	0xfee9, 0xfee1, 0x004a, 0x02ba, 0xfe99, 0xfae3, 0xfc55, 0xfec4,
+	0x0225, 0x00af, 0xfdf8, 0xfd26, 0xfc93, 0x01d7, 0x0345, 0xfdef,
+	0xfe0b, 0x007b, 0x0279, 0x0386, 0xfeed, 0xfa81, 0xfcb9, 0x03af,
+	0x06d4, 0x03ec, 0xfeb7, 0xf91a, 0xfb3d, 0x0395, 0x05fd, 0x0255,
+	0x0173, 0x00dd, 0xfe2f, 0xfdf2, 0xfe8c, 0xfe97, 0x00f6, 0x0326,
+	0x02ce, 0x0056, 0xfbce, 0xfc40, 0xfff4, 0x0319, 0x03d6, 0xfcce,
+	0xfb8d, 0x0394, 0x024a, 0xfcba, 0xfcec, 0xfc8d, 0x00dc, 0x05c2,
+	0x0272, 0xff64, 0xf904, 0xf61e, 0x0280, 0x0ae5, 0x0917, 0x025e,
+	0xf692, 0xf8c9, 0x05ab, 0x0644, 0x0343, 0x0163, 0xfbea, 0xfd15,
+	0x0151, 0xffc7, 0xfe26, 0xfd26, 0xfed1, 0x02f3, 0x028a, 0xfecd,
+	0xfbe1, 0xfdd2, 0x0311, 0x0300, 0xfef6, 0xff43, 0x01de, 0x01ad,
+	0xffbe, 0xfbdc, 0xfaed, 0x0057, 0x0545, 0x032d, 0xfcd4, 0xfc15,
+	0xfe25, 0x0010, 0x041d, 0x0064, 0xfed2, 0x056c, 0xffc4, 0xf9de,
+	0xfcae, 0xff83, 0x0950, 0x0c1c, 0xfcf6, 0xf45c, 0xf7ed, 0x00a8,
+	0x0dd4, 0x0b0c, 0xfb39, 0xf40c, 0xf98f, 0x0670, 0x0a83, 0xfe51,
+	0xf566, 0xf913, 0xfe16, 0x05c5, 0x0623, 0xfc86, 0xfd27, 0xfcc9,
+	0xfb8a, 0x0471, 0x069a, 0x02d7, 0x003a, 0xfa82, 0xf9aa, 0xfe8d,
+	0x053b, 0x0986, 0x0073, 0xf5f9, 0xf706, 0x0103, 0x0c2d, 0x093e,
+	0xfbf7, 0xf63e, 0xfb02, 0x04e6, 0x0975, 0x04d4, 0xfe90, 0xfa5b,
+	0xf9b8, 0xff6d, 0x0571, 0x0495, 0x0097, 0xfb72, 0xf9f3, 0xff5c,
+	0x01bd, 0x01eb, 0x0550, 0x01ee, 0xf975, 0xf886, 0x02b7, 0x0cc1,
+	0x0580, 0xf6a7, 0xf4ba, 0x0029, 0x0ba4, 0x06d7, 0xfa8f, 0xf87f,
+	0xfaf3, 0xfe19, 0x049e, 0x0907, 0x041c, 0xf88a, 0xf5e4, 0x034d,
+	0x0c98, 0x04a6, 0xf9c6, 0xf67d, 0xff2a, 0x0bb1, 0x0591, 0xf964,
+	0xfa80, 0xfc39, 0x021c, 0x083f, 0xfd70, 0xf855, 0xfe3c, 0x0087,
+	0x05b5, 0x044d, 0xfad1, 0xfb35, 0x0018, 0x03aa, 0x05c2, 0xfe7f,
+	0xfa92, 0xffe5, 0xffda, 0x0108, 0x03d6, 0xfe9b, 0x006f, 0x0293,
+	0xfa5f, 0xfe48, 0x06c6, 0x0390, 0xfe55, 0xf942, 0xf9bc, 0x031f,
+	0x094f, 0x0368, 0xfa77, 0xfa1d, 0xff3b, 0x0807, 0x0aea, 0x00b9,
+	0xfa20, 0xf68b, 0xf805, 0x0690, 0x0855, 0xfb01, 0xf3dc, 0xf5e8,
+	0x0246, 0x0b20, 0x04e7, 0xfb54, 0xf92d, 0xff00, 0x055b, 0x0a7d,
+	0x07d0, 0xfb2f, 0xf51c, 0xfa5a, 0x0884, 0x0ab9, 0xf8a5, 0xf394,
+	0xfcd9, 0x05be, 0x09b4, 0xff4c, 0xf9e5, 0x01fd, 0x0333, 0x0101,
+	0x01c6, 0x0085, 0x0135, 0x02d9, 0x0060, 0xfb21, 0xf98d, 0xfe8f,
+	0x03f9, 0x0609, 0xfff2, 0xf6af, 0xfca1, 0x0788, 0x0786, 0xfebe,
+	0xf3f6, 0xf8ab, 0x07b2, 0x0a67, 0x00ad, 0xf6c4, 0xf977, 0x043a,
+	0x04ee, 0x01f8, 0xff50, 0xfe83, 0x03f0, 0x0149, 0xfdce, 0x0168,
+	0x024d, 0x0036, 0xfd2f, 0xfecc, 0x0129, 0x0066, 0x0238, 0xfd62,
+	0xf905, 0x0002, 0x03db, 0x03f7, 0x0075, 0xfb04, 0xfe22, 0x03a9,
+	0x04c1, 0xfeb1, 0xfaa9, 0x00ab, 0x01ba, 0xfdec, 0xfd71, 0xff3a,
+	0x023a, 0x0007, 0xfbbc, 0xfda2, 0x02e2, 0x0534, 0x03f2, 0x01c1,
+	0xffd3, 0xfef5, 0xff84, 0xffaa, 0xfdb5, 0xfb28, 0xff90, 0x0863,
+	0x0545, 0xf9f0, 0xf6fc, 0x013c, 0x0940, 0x0435, 0xfdb0, 0xfc7f,
+	0x019d, 0x02b7, 0xfbf4, 0xfcc7, 0xfe2f, 0xfcaf, 0xff87, 0x01cb,
+	0x0577, 0xff4e, 0xf55b, 0xfcde, 0x04bd, 0x04cb, 0x018f, 0xf9e9,
+	0xfc19, 0x04fb, 0x053d, 0xff58, 0xfa9f, 0xfd84, 0x04d7, 0x071e,
+	0x00e3, 0xfae3, 0xff89, 0x05da, 0x028f, 0xf9ee, 0xf9c0, 0x01a1,
+	0x053d, 0x02ff, 0xfb7c, 0xf857, 0xff9c, 0x0352, 0x03d6, 0x05a3,
+	0xfd58, 0xfa4c, 0x034f, 0x0749, 0x05f7, 0xfbdb, 0xf53a, 0xfe1c,
+	0x0514, 0x03ac, 0xfdfc, 0xf878, 0xfc85, 0x02b5, 0x0127, 0x01f8,
+	0x0273, 0xfd65, 0xfd39, 0x00e4, 0x0533, 0x06af, 0x004c, 0xf8b9,
+	0xf8f6, 0x0415, 0x08b6, 0x015a, 0xfcc9, 0xf972, 0xfea7, 0x090b,
+	0x03bf, 0xfbc2, 0xf928, 0xf9aa, 0x0411, 0x06a3, 0xff39, 0xfb32,
+	0xfad5, 0x0285, 0x05e9, 0xff52, 0xfca4, 0x0079, 0x0543, 0x034f,
+	0xfe5d, 0xfd81, 0xfec8, 0x0233, 0x014b, 0xfdf4, 0x00bc, 0x00b7,
+	0xff3c, 0xfd7a, 0xfaec, 0xff2e, 0x01e8, 0x0377, 0x04f8, 0xfcc9,
+	0xfb74, 0x0159, 0x00da, 0x0398, 0x0233, 0xfe29, 0x0084, 0x009a,
+	0x02f1, 0x0347, 0xfdd0, 0xfd3e, 0xfcde, 0xfef3, 0x03a2, 0xfd14,
+	0xf923, 0xfef8, 0xfc71, 0xfe00, 0x062e, 0x024e, 0xff0f, 0xfe40,
+	0xfc2b, 0x0344, 0x05f5, 0xffdf, 0xfe06, 0xff7c, 0x00f5, 0x00c7,
+	0x0192, 0x01f4, 0xfd88, 0xfb78, 0xfe6f, 0x02d2, 0x02c7, 0xfdc2,
+	0xfe17, 0xfef4, 0xffb4, 0x0357, 0x012a, 0x028b, 0x00d6, 0xf981,
+	0x02ac, 0x0671, 0xfecd, 0xfe9c, 0xfc66, 0x0034, 0x04a4, 0xfea4,
+	0xfd35, 0x0144, 0x044c, 0x0172, 0xfc87, 0xfdb1, 0xfed0, 0x0013,
+	0x0221, 0xff28, 0xfdb2, 0x0040, 0x003a, 0xffdd, 0xfe9a, 0xfca6,
+	0x0188, 0x0343, 0x0156, 0x0199, 0x005d, 0x023b, 0x0229, 0xfe1b,
+	0xfd85, 0xfe5c, 0xfec7, 0xffd8, 0xfe52, 0xff40, 0x0071, 0xfead,
+	0x017b, 0x0087, 0xfdf9, 0xff25, 0x007f, 0x0323, 0x0226, 0x0128,
+	0x00a3, 0xff08, 0x01e9, 0x0108, 0xfdeb, 0x00db, 0xfffc, 0xff61,
+	0x022e, 0xff6d, 0xfdf1, 0xfe3c, 0xff93, 0x01dd, 0x00e9, 0x02cc,
+	0xff93, 0xfc9c, 0xff97, 0xfdb4, 0x0095, 0x0238, 0xfc5f, 0xfd22,
+	0x010e, 0x023f, 0x0277, 0xff30, 0xffaa, 0x02e5, 0x012a, 0xfeef,
+	0xf9b8, 0xfa7f, 0x01ac, 0x00b0, 0xfedb, 0xfde2, 0xfd75, 0x0126,
+	0x0149, 0xfe45, 0x0014, 0x035b, 0x03de, 0x0033, 0xfea0, 0x0326,
+	0x0300, 0x02a1, 0x018e, 0xfbd4, 0xfe92, 0x0136, 0xff7a, 0x01f4,
+	0xfee6, 0xfccc, 0x0196, 0x01d7, 0x0126, 0xffa0, 0xfe98, 0x01d8,
+	0xffbb, 0xff2e, 0x018a, 0xfdf8, 0xfcb3, 0xfbd0, 0xfe85, 0x048a,
+	0x0126, 0xfcbb, 0xfdb8, 0xff3b, 0x0106, 0x00ca, 0x0050, 0x0197,
+	0xfe08, 0xfd42, 0x0076, 0x00a1, 0x014b, 0xfea3, 0xfff9, 0x0396,
+	0xff16, 0xfe9e, 0x0348, 0x0558, 0x04f4, 0xff43, 0xfd1a, 0x034e,
+	0x03e8, 0xffa6, 0xfc90, 0xfd7f, 0x0349, 0x0354, 0x0148, 0x002f,
+	0xfde5, 0xffaa, 0xff23, 0xfc48, 0xfddb, 0xff20, 0xff59, 0xffd8,
+	0xfe94, 0xfd9a, 0xff2c, 0x0081, 0xffe3, 0xfb56, 0xf7f6, 0xfba2,
+	0x0064, 0x024c, 0xffa4, 0xfc95, 0x02a6, 0x08bc, 0x055d, 0x011f,
+	0x008c, 0x025c, 0x024f, 0xfbb1, 0xf7dd, 0xfce1, 0x04a3, 0x0a50,
+	0x0755, 0x01d4, 0x01b7, 0x04d9, 0x0718, 0x0294, 0xfce5, 0xfc48,
+	0xfeac, 0x0009, 0xfc6b, 0xf8b9, 0xfbe5, 0x0079, 0xff49, 0xfd0a,
+	0xfd36, 0xfd64, 0xfca9, 0xf9b0, 0xf95f, 0xfe1a, 0x0007, 0x0050,
+	0x017f, 0x00bd, 0x036a, 0x030a, 0xfd9c, 0x00c4, 0x0385, 0x048c,
+	0x08ac, 0x03a2, 0xfcd0, 0xfa2c, 0xf9fc, 0xfe73, 0xfecc, 0xfa19,
+	0xfb11, 0x0364, 0x0946, 0x06c7, 0xfff7, 0x0034, 0x094a, 0x0c44,
+	0x055c, 0xfe9a, 0xfd04, 0xfff8, 0x0152, 0xfe89, 0xfeb3, 0xfec4,
+	0xfd41, 0xfc79, 0xfa48, 0xfc59, 0xfd3a, 0xfe6f, 0x04d5, 0x02a3,
+	0xfcab, 0xfa78, 0xfaa2, 0x005d, 0xfdfb, 0xf359, 0xf39b, 0xfcd7,
+	0x0c98, 0x1752, 0x0d8f, 0x036e, 0x01de, 0x0088, 0x00af, 0xf725,
+	0xed05, 0xf253, 0xf96c, 0xfebe, 0xff25, 0xfad4, 0x02e5, 0x06d1,
+	0x0158, 0x048b, 0x06bd, 0x0c9d, 0x11d0, 0x0932, 0x061f, 0x0642,
+	0x03e6, 0x0538, 0x015c, 0xfc29, 0xfdbc, 0x014d, 0x01eb, 0xf605,
+	0xdbab, 0xd253, 0xf7ed, 0x2b51, 0x36df, 0x1abb, 0xf403, 0xefa0,
+	0x058b, 0xfc15, 0xe549, 0xdf26, 0xeaa4, 0x0000, 0xfa0a, 0xe81d,
+	0xf0d1, 0xfbd4, 0xff60, 0x053d, 0x04f3, 0x1129, 0x1999, 0x074a,
+	0x0215, 0x06d8, 0x09c7, 0x0f8e, 0x0a4b, 0x0c7f, 0x140e, 0x0b20,
+	0xfd20, 0xf443, 0xf650, 0xff3d, 0x0076, 0xfdd9, 0xfb84, 0xff4b,
+	0x070b, 0xfb39, 0xe4fc, 0xd5ce, 0xe71e, 0x22ab, 0x3f45, 0x251d,
+	0xfed0, 0xefe5, 0x01cf, 0x07c4, 0xea93, 0xd9f3, 0xf0b1, 0x032b,
+	0xf3ad, 0xd4df, 0xd08e, 0xf19d, 0x0a96, 0x03a8, 0xf7cd, 0xfde1,
+	0x102e, 0x1ae0, 0x19cc, 0x1672, 0x1825, 0x18a6, 0x0d98, 0x0958,
+	0x0f64, 0x0b3e, 0x0742, 0x036f, 0xfd49, 0xff62, 0xf494, 0xe930,
+	0xf3c2, 0xfcb1, 0xfc5d, 0xfb08, 0xfca7, 0xfe02, 0xefd8, 0xd4fc,
+	0xde3e, 0x1a5c, 0x41eb, 0x3555, 0x0de7, 0xf4b8, 0x033c, 0x04a9,
+	0xe31a, 0xd6d1, 0xecf3, 0x07af, 0x017c, 0xd99f, 0xd2e1, 0xef87,
+	0xfe4f, 0xf9b9, 0xf70c, 0x0774, 0x16d6, 0x09be, 0xfefa, 0x1840,
+	0x316d, 0x25bb, 0x07ca, 0xfe31, 0x10f5, 0x14d0, 0xf6f1, 0xed61,
+	0x069d, 0x13c0, 0xfecf, 0xdf08, 0xe274, 0x0507, 0x0c20, 0xf562,
+	0xf433, 0x0a62, 0x1262, 0xf80b, 0xca9b, 0xd6bc, 0x1cba, 0x3c2a,
+	0x339e, 0x0b81, 0xee7a, 0x09e0, 0x007f, 0xe1ac, 0xe21d, 0xe796,
+	0x06ca, 0x0282, 0xd6b6, 0xdb7b, 0xe8c9, 0xf329, 0xfa07, 0xf2e7,
+	0x0ef7, 0x1a68, 0x05be, 0x0361, 0x0e7a, 0x2a39, 0x2c04, 0x0e1e,
+	0x058d, 0x07aa, 0x0766, 0xfb46, 0xf248, 0x0b18, 0x18cf, 0x0647,
+	0xee36, 0xe1ee, 0xf426, 0x05aa, 0xfb38, 0xf912, 0x06da, 0x0fbb,
+	0x0362, 0xdc46, 0xcb0c, 0xf945, 0x2f6e, 0x37a1, 0x1c3b, 0xf7f4,
+	0xff36, 0x0ba2, 0xee00, 0xdf25, 0xe64f, 0xf944, 0x0539, 0xea0f,
+	0xdd5a, 0xeddb, 0xed7a, 0xeaf3, 0xf059, 0x0287, 0x1a76, 0x129e,
+	0x0514, 0x0d2e, 0x1ae3, 0x1dd9, 0x12c2, 0x114f, 0x14eb, 0x0b36,
+	0xfc12, 0xf472, 0x01d2, 0x111a, 0x08bb, 0xfc4d, 0xf470, 0xee8c,
+	0xf308, 0xf767, 0xfca7, 0x0501, 0x024f, 0x0259, 0xfe52, 0xe12d,
+	0xd40e, 0xf50b, 0x21cc, 0x3937, 0x2437, 0xfd04, 0x063d, 0x0a9a,
+	0xedcb, 0xe054, 0xde75, 0xf859, 0x07fe, 0xebe1, 0xeb75, 0xfa2f,
+	0xef63, 0xe7d7, 0xe38d, 0xfcf5, 0x1d92, 0x0ff3, 0x0788, 0x0d47,
+	0x15df, 0x1b4e, 0x0449, 0x0454, 0x166b, 0x1606, 0x0f3e, 0xf80a,
+	0xf893, 0x0d2c, 0x00ad, 0xf93b, 0xf83c, 0xf5b3, 0x00b1, 0xf6a2,
+	0xf3eb, 0x0155, 0xfc6d, 0x00ac, 0x0688, 0xfde4, 0xe790, 0xcf06,
+	0xea37, 0x2678, 0x435f, 0x2893, 0x0005, 0x025f, 0x07d6, 0xed5b,
+	0xd65a, 0xdd51, 0xfec3, 0x0850, 0xec98, 0xe8d7, 0xf62e, 0xf627,
+	0xe79e, 0xe5e9, 0x08fd, 0x1a01, 0x0d8f, 0x05e3, 0x0f23, 0x21cf,
+	0x1028, 0xf916, 0x0a19, 0x18e7, 0x1853, 0x06b3, 0xf874, 0x0df9,
+	0x0bec, 0xf22c, 0xf170, 0xf51e, 0xfe81, 0xfc61, 0xf028, 0x014d,
+	0x08df, 0xfd0c, 0xfeff, 0x05a7, 0x047e, 0xe37b, 0xc424, 0xe699,
+	0x2672, 0x4027, 0x266c, 0x08c1, 0x086b, 0xff64, 0xe4ab, 0xd6df,
+	0xe761, 0x045d, 0xfe55, 0xecd8, 0xf2a2, 0xf7e4, 0xf379, 0xe8cd,
+	0xf20e, 0x0ea0, 0x0f3a, 0x068e, 0x08b8, 0x10fb, 0x1845, 0x06f6,
+	0x0015, 0x0d5a, 0x1122, 0x1408, 0x1009, 0x0a18, 0x091c, 0xfdc3,
+	0xf751, 0xf64d, 0xf34e, 0xf700, 0xfa73, 0xff27, 0x00ea, 0xfc36,
+	0xf99f, 0xf9c3, 0x0275, 0x0570, 0xfbca, 0xe14a, 0xcfdb, 0xf790,
+	0x268f, 0x3802, 0x2766, 0x0498, 0x0334, 0xfaba, 0xe0ef, 0xe037,
+	0xea47, 0xff39, 0x0487, 0xf029, 0xf326, 0xf69f, 0xeed9, 0xf42d,
+	0xf9fa, 0x0908, 0x0c49, 0x005e, 0x0a33, 0x1572, 0x1446, 0x0aa1,
+	0x02dc, 0x0d86, 0x1500, 0x0dae, 0x07c5, 0x0679, 0x085b, 0x031f,
+	0xf538, 0xf1e0, 0xf593, 0xf90f, 0xfd59, 0xfd2d, 0xfe10, 0xfbbc,
+	0xf697, 0xfe28, 0x0782, 0x07f3, 0xf960, 0xdb49, 0xd751, 0xf71c,
+	0x19b7, 0x366a, 0x2c79, 0x0dc1, 0x07e1, 0xf657, 0xe8fc, 0xea1b,
+	0xe7d1, 0xfb06, 0x002a, 0xf08d, 0xf0ac, 0xeef7, 0xf35f, 0xf942,
+	0xf584, 0x05cc, 0x0b7b, 0x04c0, 0x0b9a, 0x0c48, 0x10b2, 0x0f6c,
+	0x0751, 0x0ba7, 0x0d84, 0x0e1e, 0x0ed3, 0x0dfe, 0x090a, 0xf992,
+	0xf3ab, 0xf447, 0xf1c2, 0xf7bb, 0xfbda, 0x01d6, 0x06a2, 0xfced,
+	0xf9d7, 0xf958, 0xf880, 0x0152, 0x02a0, 0xf529, 0xdd0b, 0xdcfd,
+	0x0632, 0x3093, 0x3284, 0x1075, 0x05e2, 0x0c9b, 0xfcf7, 0xe9ac,
+	0xe2c6, 0xf5db, 0x0606, 0xef01, 0xe332, 0xf0e8, 0xf595, 0xf5b0,
+	0xf2fe, 0xff32, 0x0ef1, 0x0381, 0xffb8, 0x0c84, 0x137e, 0x1041,
+	0x05b9, 0x0bc9, 0x1756, 0x100e, 0x0a3b, 0x0b01, 0x08ba, 0x003d,
+	0xf35b, 0xf435, 0xfab0, 0xf95d, 0xfbe6, 0x021b, 0x050d, 0xfdc9,
+	0xf1e6, 0xf282, 0xf826, 0xfa3c, 0x00f2, 0x04c1, 0xf480, 0xe02f,
+	0xe90a, 0x0d47, 0x303f, 0x2a6f, 0x095c, 0x050c, 0x0b2d, 0xfd43,
+	0xeced, 0xe787, 0xf6f4, 0x00c8, 0xee96, 0xe795, 0xf22b, 0xf632,
+	0xf4c9, 0xf55b, 0x00d7, 0x0b0b, 0x035d, 0xff74, 0x0d6c, 0x16f0,
+	0x0f6e, 0x0928, 0x0eff, 0x16f2, 0x135a, 0x03d0, 0x044a, 0x0c65,
+	0xfb27, 0xf002, 0xf576, 0xfaa7, 0x026c, 0xfb7d, 0xfb66, 0x0740,
+	0xfca2, 0xf21d, 0xf290, 0xf5e1, 0xfe3e, 0xfc04, 0xfc21, 0xf8ca,
+	0xe523, 0xe946, 0x0a8b, 0x2c80, 0x2dbd, 0x09a2, 0x00e1, 0x1001,
+	0x0554, 0xf217, 0xe783, 0xf463, 0x050c, 0xefb6, 0xdeb2, 0xeb05,
+	0xf599, 0xf81d, 0xf2d8, 0xfcbd, 0x0ff8, 0x0bde, 0x0614, 0x0a98,
+	0x1225, 0x13c2, 0x068a, 0x082f, 0x1333, 0x108d, 0x0e53, 0x0706,
+	0x0163, 0xfffd, 0xf306, 0xf1b8, 0xfa77, 0xfa83, 0xfe7b, 0x0088,
+	0xff0a, 0xff1d, 0xf6d9, 0xf291, 0xf7b3, 0xf7c7, 0xfd2e, 0x0474,
+	0xf6f1, 0xe931, 0xeca5, 0xfd28, 0x2026, 0x246e, 0x0688, 0x0790,
+	0x1181, 0x0f8f, 0x0734, 0xeffa, 0xf312, 0x017f, 0xedf8, 0xde98,
+	0xe0b8, 0xeb65, 0xf80b, 0xf3bb, 0xf9c6, 0x0ec0, 0x13c5, 0x1071,
+	0x0c0c, 0x0fbf, 0x167d, 0x0928, 0x00fa, 0x0af9, 0x1082, 0x0edf,
+	0x02e6, 0xfa8d, 0x02a8, 0xffee, 0xf76c, 0xf95f, 0xfcd2, 0x03ca,
+	0x0210, 0xf65a, 0xf644, 0xf5ff, 0xf294, 0xf53a, 0xf7af, 0x00e6,
+	0x0913, 0xfe7d, 0xf203, 0xf263, 0xfc89, 0x11c9, 0x14df, 0x01d8,
+	0x0198, 0x0a04, 0x0d8f, 0x0c4c, 0xfb9e, 0xf86a, 0x0142, 0xf731,
+	0xeaed, 0xe675, 0xe989, 0xf673, 0xf7da, 0xf5bb, 0x00dc, 0x0a61,
+	0x0f32, 0x111a, 0x1040, 0x135a, 0x14d2, 0x0edd, 0x08ce, 0x0533,
+	0x016d, 0xfee3, 0xfc62, 0xf91d, 0xf92b, 0xfa3b, 0xfc4a, 0x0042,
+	0x03f2, 0x054d, 0x027d, 0xfdcf, 0xfaba, 0xf878, 0xf710, 0xf6e8,
+	0xf802, 0xfb30, 0xfe33, 0xfeaa, 0xfc1f, 0xfbba, 0xfe2d, 0x0143,
+	0x0805, 0x0743, 0xffbc, 0xff6c, 0x00a2, 0x02e4, 0x02e0, 0xfb1f,
+	0xf89e, 0xfcb0, 0xfe4c, 0xfef9, 0xfdbc, 0xfce2, 0xff14, 0xff24,
+	0xff85, 0x018b, 0x025d, 0x0438, 0x0627, 0x07b3, 0x09d1, 0x09e2,
+	0x07e1, 0x05da, 0x0385, 0x0040, 0xfdf7, 0xfcb0, 0xfcf3, 0xfeb7,
+	0x0039, 0xffeb, 0xfffb, 0xffb1, 0xfe78, 0xfe82, 0xfca3, 0xfb78,
+	0xfc08, 0xfc3d, 0xfd57, 0xfca5, 0xfb4d, 0xfbf5, 0xfc70, 0xfd6e,
+	0xfe88, 0xfeeb, 0x00b8, 0x0238, 0x027e, 0x02f6, 0x0223, 0x013a,
+	0xff2e, 0xfd6e, 0xfe40, 0xffa4, 0x0143, 0x01e9, 0x01a5, 0x0173,
+	0x00a3, 0x004b, 0x0178, 0x021c, 0x0220, 0x0263, 0x02ef, 0x032c,
+	0x02b8, 0x0140, 0x0056, 0x0025, 0xff7f, 0xfea5, 0xff2a, 0xffde,
+	0x000e, 0x0002, 0xff8a, 0x00ae, 0x00e4, 0xff82, 0xfeee, 0xfecf,
+	0xfee1, 0xff58, 0xffb0, 0xff98, 0xfedd, 0xfe51, 0xfe84, 0xfe58,
+	0xfe14, 0xfdd8, 0xfd04, 0xfe2e, 0xff99, 0xffba, 0x00d4, 0x01cb,
+	0x0101, 0xff43, 0xfe67, 0xff49, 0x00e3, 0x0108, 0x0107, 0x00b6,
+	0xff7b, 0xff4f, 0xff75, 0xffa0, 0x007c, 0x00b0, 0x0103, 0x02df,
+	0x03da, 0x02b0, 0x00d2, 0xffc2, 0xff8c, 0xfebe, 0xfe49, 0xff2d,
+	0xffd7, 0x0079, 0x00c8, 0x008f, 0x00f2, 0x018f, 0x00dd, 0x0012,
+	0xff44, 0xfe59, 0xfeb2, 0xff4d, 0xffbe, 0x000e, 0xffb6, 0xff92,
+	0xff03, 0xfec8, 0xfedd, 0xff2d, 0xffd2, 0xffcc, 0x0027, 0x008d,
+	0xffc8, 0xff49, 0xff8a, 0xffcc, 0x002e, 0x002b, 0x004b, 0x00dd,
+	0x00d1, 0x0077, 0x0006, 0xffc6, 0x005c, 0x00db, 0x00b5, 0x00f6,
+	0x0194, 0x0153, 0x00d4, 0x001f, 0xfea9, 0xfe44, 0xfeda, 0xff48,
+	0xff92, 0xffec, 0x001e, 0x001e, 0x0072, 0x00c5, 0x0093, 0x0080,
+	0x0012, 0xff06, 0xfedd, 0xff5f, 0x005b, 0x00f0, 0x007c, 0x0016,
+	0xff4e, 0xff6a, 0xffb3, 0xff5b, 0xff67, 0xff9b, 0xffc0, 0x0041,
+	0x0051, 0x002d, 0x00be, 0x00cc, 0x005e, 0xffb7, 0xff84, 0x000e,
+	0x00b3, 0x00b5, 0xffe6, 0xff60, 0xffd6, 0x00c6, 0x0157, 0x0192,
+	0x01aa, 0x0165, 0x0024, 0xfe90, 0xfd0d, 0xfc38, 0xfd56, 0xfe9d,
+	0xff36, 0xff82, 0xff71, 0xff6c, 0x0017, 0x00f0, 0x00e2, 0x00bb,
+	0x0069, 0xff37, 0xfed4, 0xff59, 0xfff3, 0x0147, 0x01d2, 0x019f,
+	0x0149, 0x0002, 0xff9f, 0xffed, 0xffe8, 0x0057, 0xffcc, 0xff2d,
+	0xff86, 0xffe0, 0x0092, 0x0164, 0x0115, 0x0041, 0x0010, 0xff9a,
+	0x0024, 0x009f, 0x0064, 0xffdc, 0xff5b, 0xff7f, 0xffdd, 0x008a,
+	0x00d3, 0x008c, 0x0058, 0x0021, 0xff77, 0xfea9, 0xfe8c, 0xfef1,
+	0xffc0, 0x0064, 0x002b, 0xffd3, 0x0005, 0x00d5, 0x00ae, 0xffd0,
+	0xff50, 0xfe8b, 0xfe49, 0xfee4, 0xff25, 0xff28, 0x0030, 0x00c0,
+	0x009f, 0x00a9, 0x005d, 0x0096, 0x0183, 0x01a1, 0x0121, 0x00cf,
+	0x0042, 0x0062, 0x00b9, 0x00b7, 0x00fc, 0x0097, 0x0045, 0xffa1,
+	0xfeec, 0xfefb, 0xff0a, 0xff3c, 0xff29, 0xfea6, 0xfe78, 0xff76,
+	0x00d0, 0x012a, 0x00c7, 0x0012, 0xfff3, 0xfff8, 0xffc7, 0xff6a,
+	0xffec, 0x009a, 0x007e, 0x0051, 0x0011, 0x00e8, 0x00f1, 0x0009,
+	0xffde, 0xff83, 0xff54, 0xff79, 0xfed3, 0xfdb4, 0xfe4a, 0xfec2,
+	0xfea5, 0xff27, 0xff6c, 0xffd3, 0x00d3, 0x016a, 0x00fb, 0x00ec,
+	0x00aa, 0x00b9, 0x016e, 0x0177, 0x0192, 0x0122, 0x0100, 0x0112,
+	0x0001, 0xff00, 0xfebe, 0xfeb7, 0xfeab, 0xfedb, 0xfe6a, 0xfe9e,
+	0xff87, 0xff2d, 0xff03, 0xff49, 0xff5c, 0xffb6, 0xffa8, 0xff9b,
+	0x00e4, 0x0156, 0x005c, 0x00d1, 0x018e, 0x01d6, 0x01fa, 0x0215,
+	0x0144, 0x006a, 0x00f1, 0x0039, 0xff59, 0xfe8d, 0xfd9c, 0xfd46,
+	0xfd64, 0xfe6b, 0xfec1, 0xfe8b, 0xffb9, 0x004c, 0x008a, 0x02a0,
+	0x02d6, 0x0162, 0x01ee, 0x03c4, 0x0381, 0x01d9, 0x027b, 0x01e6,
+	0x0040, 0xffc5, 0xfd8f, 0xfcaa, 0xfd98, 0xfdf8, 0xfdfc, 0xfd77,
+	0xfda0, 0xfd08, 0xfd06, 0xfdea, 0xfd0d, 0xfcf7, 0xff47, 0x00bf,
+	0xfef7, 0xfec6, 0x0155, 0x03b7, 0x0593, 0x01b3, 0xffe7, 0x09e9,
+	0x0997, 0xffd3, 0xffe5, 0xfe60, 0x0149, 0x0654, 0xfb95, 0xf3e3,
+	0xfb65, 0x013d, 0xff85, 0xfbd6, 0xfa24, 0xff4b, 0x058d, 0x04f3,
+	0xffcb, 0xff8f, 0x07c4, 0x090c, 0xfd59, 0xfd91, 0x065f, 0x02a1,
+	0xfee5, 0xfa7f, 0xfab9, 0x049d, 0x0036, 0xf8e8, 0xfeb8, 0x019f,
+	0x0126, 0xfd5b, 0xf8e0, 0xfd9a, 0xfc68, 0xf5a5, 0xf842, 0xfb04,
+	0xfa0d, 0xfa71, 0xfc3b, 0x0160, 0x051e, 0x0366, 0x0774, 0x0e92,
+	0x0c13, 0x0a62, 0x0b19, 0x0867, 0x082a, 0x0421, 0xff06, 0xff5a,
+	0xfbd5, 0xf7df, 0xf895, 0xf890, 0xf88c, 0xf8a7, 0xf9c8, 0xfd7f,
+	0xfef5, 0x004f, 0x0420, 0x0529, 0xff2e, 0xfdaf, 0x05b9, 0x0594,
+	0x011c, 0x02f3, 0x0365, 0x03f0, 0x0518, 0x0189, 0x024c, 0x0649,
+	0x01ab, 0xfd9f, 0xfdcb, 0xfa2f, 0xf517, 0xf10c, 0xef07, 0xf07e,
+	0xf01e, 0xee79, 0xf498, 0xfb6c, 0xfee9, 0x069a, 0x0d6a, 0x11ad,
+	0x1547, 0x1654, 0x17a6, 0x1815, 0x1142, 0x0c10, 0x091c, 0xff26,
+	0xfb3a, 0xf74a, 0xeea2, 0xf19b, 0xf154, 0xedf3, 0xf319, 0xf430,
+	0xf8b4, 0xff94, 0xff5e, 0x05d2, 0x0932, 0x0420, 0x05af, 0x0340,
+	0x00ba, 0x0946, 0x0ab7, 0xfdf6, 0xffa3, 0x0a1f, 0x0143, 0x00b6,
+	0x074c, 0xff35, 0x01b7, 0x03e2, 0xf6d8, 0xf455, 0xf339, 0xea3b,
+	0xea1a, 0xe8d7, 0xe7e2, 0xf068, 0xf3ca, 0xfac4, 0x091f, 0x0b85,
+	0x120d, 0x1ff3, 0x1cf2, 0x1f13, 0x23b4, 0x1a15, 0x1710, 0x0b92,
+	0x008c, 0x00cb, 0xf022, 0xeb6b, 0xee06, 0xe271, 0xe9ae, 0xef21,
+	0xe99e, 0xf689, 0xfc8b, 0xfcc0, 0x0a36, 0x08ed, 0x05ba, 0x0a24,
+	0x0212, 0x08d6, 0x15e6, 0xff27, 0xff61, 0x1231, 0xf84f, 0x001c,
+	0x10e9, 0xf410, 0x0178, 0x0add, 0xefdb, 0xf925, 0xf5de, 0xe6b8,
+	0xed53, 0xe3d1, 0xe9a3, 0xefb4, 0xe79a, 0xffa0, 0x0434, 0x00dd,
+	0x1c3f, 0x1b5e, 0x1922, 0x2b5b, 0x24a2, 0x1dfe, 0x1f5f, 0x1339,
+	0x08c7, 0xff66, 0xf6a7, 0xed2a, 0xe548, 0xe7e3, 0xe2aa, 0xe2a1,
+	0xefd3, 0xef03, 0xf355, 0x032f, 0x05d5, 0x0501, 0x0cfd, 0x0959,
+	0xffe1, 0x1076, 0x14f6, 0xf850, 0x07f1, 0x121c, 0xebdb, 0x067a,
+	0x10cf, 0xe847, 0x089c, 0x0f33, 0xe745, 0xfebb, 0xfcec, 0xdf9a,
+	0xf11d, 0xf02a, 0xe32d, 0xed32, 0xf52c, 0xf787, 0xfb99, 0x0c0d,
+	0x12f5, 0x11b9, 0x22f4, 0x2380, 0x1d3c, 0x26e9, 0x1c45, 0x0eff,
+	0x10ca, 0x02b9, 0xf658, 0xf3c0, 0xea61, 0xe507, 0xe51f, 0xe8da,
+	0xea5a, 0xec5c, 0xf94e, 0xfc25, 0xff3d, 0x0b1b, 0x04cc, 0x0366,
+	0x0a12, 0x032e, 0x0c15, 0x09b4, 0xfc2f, 0x0bf3, 0xfcdf, 0xf9aa,
+	0x1072, 0xf7ac, 0xfce1, 0x11e9, 0xf502, 0xf96d, 0x019f, 0xe6dd,
+	0xef0f, 0xf263, 0xe45a, 0xec53, 0xf1ab, 0xf41b, 0xfb0e, 0x0549,
+	0x0cd7, 0x1048, 0x1ebf, 0x20ec, 0x1f34, 0x26cf, 0x1cb4, 0x15b6,
+	0x147f, 0x03d7, 0xfe10, 0xf945, 0xeb22, 0xeb7c, 0xe8bc, 0xe577,
+	0xec82, 0xed31, 0xf0f9, 0xfa6b, 0xfee8, 0x0190, 0x0523, 0x0540,
+	0xfece, 0x0592, 0x0ec3, 0xffee, 0x03b9, 0x108e, 0xf811, 0x0344,
+	0x1272, 0xf215, 0x06a3, 0x1343, 0xee67, 0x0014, 0x021b, 0xe21d,
+	0xf2e9, 0xf1f2, 0xded4, 0xedfd, 0xf3d6, 0xec28, 0xfa3c, 0x0995,
+	0x057b, 0x0f06, 0x21b0, 0x19de, 0x1e5a, 0x29ac, 0x1825, 0x1638,
+	0x17de, 0x04d9, 0xfd9d, 0xfd95, 0xf1d3, 0xe91c, 0xef4e, 0xec8a,
+	0xe650, 0xf3ee, 0xf5a9, 0xf1cf, 0x002f, 0x03b7, 0xfd84, 0x02fd,
+	0x0475, 0xf9b1, 0x00fd, 0x0e62, 0xf952, 0x0037, 0x1210, 0xf3c2,
+	0x07dc, 0x137a, 0xf0af, 0x1040, 0x0e7f, 0xecec, 0x06f4, 0xf9ed,
+	0xe3ab, 0xf55b, 0xebb9, 0xe2c9, 0xf02b, 0xf3f9, 0xf255, 0xfeea,
+	0x0d5a, 0x07b3, 0x13fe, 0x2134, 0x13cd, 0x1e78, 0x200d, 0x0f81,
+	0x1361, 0x0bd9, 0xff15, 0xfe13, 0xfa23, 0xf328, 0xf226, 0xf794,
+	0xf3ad, 0xf525, 0xfdf3, 0xf82c, 0xf9f7, 0x0187, 0xfb61, 0xfa78,
+	0xfb01, 0xf440, 0xf469, 0xfbd1, 0xfc89, 0xf931, 0x05c1, 0x0635,
+	0x0279, 0x13f1, 0x0c1a, 0x07f8, 0x15c5, 0x0584, 0xfeea, 0x03aa,
+	0xf0f7, 0xeb22, 0xf038, 0xe4ad, 0xe3d0, 0xefd7, 0xeff5, 0xf4fa,
+	0x057e, 0x0954, 0x0c40, 0x1a4f, 0x1a4e, 0x170f, 0x1c7a, 0x1817,
+	0x0dc9, 0x0be5, 0x090a, 0xfa46, 0xfabe, 0xfe1c, 0xf044, 0xfa14,
+	0xffb5, 0xf40b, 0x019c, 0x02f9, 0xf762, 0x0072, 0xff07, 0xf586,
+	0xf7d8, 0xf4b0, 0xec42, 0xeec7, 0xfb73, 0xf594, 0xf710, 0x0d63,
+	0x01bb, 0x089a, 0x1cef, 0x0695, 0x1028, 0x1a05, 0xff76, 0x02a0,
+	0xffd8, 0xeae8, 0xef17, 0xec46, 0xe2c1, 0xe9b0, 0xf0fa, 0xf441,
+	0xf9b1, 0x0858, 0x0ac7, 0x0df5, 0x1c15, 0x138f, 0x143b, 0x1a8c,
+	0x0b6b, 0x0996, 0x099f, 0xfdbf, 0xfca2, 0xfe1e, 0xf995, 0xfb15,
+	0x0154, 0x0048, 0xffcc, 0x05a3, 0x018b, 0xfc01, 0xffe5, 0xfa24,
+	0xf3ba, 0xf2d6, 0xed46, 0xe94a, 0xef26, 0xf71c, 0xf38b, 0x0010,
+	0x0b16, 0x01d5, 0x1290, 0x1662, 0x073c, 0x1657, 0x0fdd, 0xfd5e,
+	0x069d, 0xf9d2, 0xea29, 0xf2b7, 0xebf3, 0xe6b6, 0xf1a3, 0xf5c1,
+	0xf6af, 0x0242, 0x0b08, 0x0823, 0x0f30, 0x14ab, 0x0db1, 0x108e,
+	0x123b, 0x0692, 0x0530, 0x0877, 0xfde3, 0xffb9, 0x0601, 0xfcdf,
+	0x03b0, 0x09ba, 0x0025, 0x049d, 0x05f8, 0xfb8d, 0xfbb3, 0xf972,
+	0xf218, 0xf084, 0xefb6, 0xeab8, 0xe50e, 0xf350, 0xfacc, 0xf692,
+	0x07af, 0x08c2, 0x0507, 0x17f2, 0x1042, 0x057f, 0x1302, 0x096b,
+	0xfd8f, 0x0226, 0xf650, 0xedea, 0xf401, 0xf179, 0xeccf, 0xf553,
+	0xfcc0, 0xfa57, 0x0364, 0x0ae2, 0x03bf, 0x09e8, 0x102f, 0x0601,
+	0x08ed, 0x0f02, 0x04e9, 0x0443, 0x0b1d, 0x03ae, 0x0306, 0x0e73,
+	0x0676, 0x029e, 0x0def, 0x02c0, 0xfde4, 0x0499, 0xf736, 0xf2b8,
+	0xf5d3, 0xef14, 0xec2c, 0xed56, 0xecca, 0xeb05, 0xf4e6, 0xff22,
+	0xfb97, 0x0844, 0x0e11, 0x038c, 0x1091, 0x0d86, 0x0347, 0x0fb6,
+	0x0526, 0xfbaf, 0x01ee, 0xf6f8, 0xf2bc, 0xf931, 0xf5a3, 0xf538,
+	0xfc31, 0xfc89, 0xfc01, 0x047d, 0x03a1, 0xff9d, 0x0843, 0x03fd,
+	0x01de, 0x0b4d, 0x0546, 0x058b, 0x0bde, 0x0761, 0x08d8, 0x0e8b,
+	0x0d10, 0x0a40, 0x0ce5, 0x08ae, 0x005d, 0x0345, 0xfd6a, 0xf3ef,
+	0xf632, 0xf05e, 0xec5c, 0xef82, 0xeb60, 0xec5e, 0xf0f1, 0xf684,
+	0xfcaf, 0x0032, 0x07f9, 0x0733, 0x063a, 0x0b46, 0x0757, 0x0894,
+	0x0acf, 0x0498, 0x0212, 0xff65, 0xfa6e, 0xf8bb, 0xfa82, 0xfabc,
+	0xf81e, 0xfbc0, 0xfd28, 0xfa75, 0x005a, 0xffa2, 0xfca6, 0x029c,
+	0x025d, 0x0181, 0x06fd, 0x08cb, 0x05ed, 0x0a7f, 0x0d40, 0x0930,
+	0x1014, 0x1112, 0x09e9, 0x0d48, 0x082c, 0x003b, 0x01ab, 0xfc3d,
+	0xf595, 0xf402, 0xf214, 0xee25, 0xec6b, 0xf033, 0xeb9b, 0xeec8,
+	0xfafb, 0xf6bd, 0xffc0, 0x0985, 0x0028, 0x0657, 0x0976, 0x037a,
+	0x0a9e, 0x0c2c, 0x067b, 0x0454, 0x0232, 0xfd84, 0xf966, 0xfd98,
+	0xfba2, 0xf6f3, 0xfcf9, 0xfa2d, 0xf88f, 0xfdfb, 0xfbb9, 0xfc98,
+	0xff2d, 0x0125, 0x031e, 0x047f, 0x0994, 0x08e1, 0x0819, 0x0cf5,
+	0x0bde, 0x0ca7, 0x10b7, 0x0c85, 0x09ea, 0x095b, 0x0381, 0x0015,
+	0xfe9d, 0xf96a, 0xf4f4, 0xf4d7, 0xf173, 0xee9f, 0xf0fc, 0xedef,
+	0xee35, 0xf4f5, 0xf627, 0xfb08, 0x0314, 0x0206, 0x027b, 0x063e,
+	0x0566, 0x0990, 0x0cf4, 0x09fe, 0x0904, 0x05d0, 0x0146, 0xffd5,
+	0xfdf5, 0xfc20, 0xfb6b, 0xf954, 0xf894, 0xf973, 0xf97d, 0xfa4d,
+	0xfb36, 0xfcd6, 0xfec3, 0x013f, 0x04de, 0x071e, 0x0882, 0x093a,
+	0x098e, 0x0a88, 0x0c5f, 0x0d6c, 0x0cb6, 0x0bb4, 0x0906, 0x05e3,
+	0x039e, 0x00c1, 0xfdc9, 0xfa4e, 0xf6da, 0xf431, 0xf27f, 0xf14a,
+	0xeff2, 0xeee0, 0xef3e, 0xf193, 0xf62a, 0xfb89, 0xfec2, 0x0140,
+	0x02a0, 0x0421, 0x082f, 0x0bc8, 0x0d66, 0x0cb7, 0x0a75, 0x06cf,
+	0x03aa, 0x01be, 0xfe42, 0xfb74, 0xf9f6, 0xf7e7, 0xf718, 0xf776,
+	0xf757, 0xf87e, 0xfa6c, 0xfc07, 0xfe7d, 0x0210, 0x0577, 0x0767,
+	0x08b1, 0x0914, 0x0923, 0x0af7, 0x0c05, 0x0cba, 0x0d31, 0x0afb,
+	0x086e, 0x0648, 0x03c2, 0x0149, 0xfe77, 0xfac5, 0xf707, 0xf504,
+	0xf35d, 0xf115, 0xef9a, 0xee1f, 0xedaa, 0xf1b3, 0xf74f, 0xfb31,
+	0xfec5, 0x0091, 0x0147, 0x050d, 0x0a13, 0x0c1d, 0x0d58, 0x0ce2,
+	0x0896, 0x061c, 0x0437, 0x000f, 0xfdcd, 0xfbe6, 0xf8fa, 0xf88c,
+	0xf92c, 0xf906, 0xf98b, 0xfa7e, 0xfb81, 0xfd74, 0x0086, 0x03ad,
+	0x05ab, 0x0777, 0x0834, 0x07f8, 0x08d7, 0x0a1c, 0x0b36, 0x0c01,
+	0x0c21, 0x0a4c, 0x07b5, 0x060a, 0x0325, 0x0046, 0xfda4, 0xf9b1,
+	0xf6d9, 0xf522, 0xf2ee, 0xf110, 0xeef2, 0xed0c, 0xee17, 0xf258,
+	0xf816, 0xfc95, 0xfee7, 0x0032, 0x01d7, 0x05b2, 0x09f6, 0x0cb6,
+	0x0d6b, 0x0bd6, 0x0930, 0x05e5, 0x038e, 0x0129, 0xfdc0, 0xfb1f,
+	0xf9cb, 0xf932, 0xfa03, 0xf9dd, 0xf8cf, 0xf9d3, 0xfb45, 0xfd54,
+	0x00be, 0x0336, 0x0541, 0x0732, 0x07d1, 0x085f, 0x09d5, 0x0aba,
+	0x0ae9, 0x0b6d, 0x0b5b, 0x0a60, 0x0858, 0x05c0, 0x0240, 0xfee4,
+	0xfc0f, 0xf8c4, 0xf661, 0xf504, 0xf33e, 0xf0f6, 0xeebb, 0xecfe,
+	0xedc8, 0xf283, 0xf890, 0xfc82, 0xfec8, 0x00ab, 0x01a0, 0x0559,
+	0x0a63, 0x0c31, 0x0d9f, 0x0d35, 0x0935, 0x06e9, 0x054a, 0x0146,
+	0xfe30, 0xfbaa, 0xf944, 0xf991, 0xfa4b, 0xf950, 0xf885, 0xf90a,
+	0xfabc, 0xfcfa, 0x0033, 0x035e, 0x04cd, 0x0684, 0x0858, 0x090b,
+	0x0a69, 0x0b5c, 0x0a9e, 0x0b2f, 0x0be1, 0x0ae1, 0x094f, 0x0692,
+	0x02f0, 0xff2d, 0xfbe9, 0xf928, 0xf6bb, 0xf567, 0xf3b9, 0xf0d0,
+	0xee59, 0xed0b, 0xed29, 0xf106, 0xf711, 0xfb4d, 0xfe9d, 0x00fb,
+	0x0203, 0x0498, 0x098b, 0x0c9e, 0x0ddf, 0x0e38, 0x0b1d, 0x0829,
+	0x0666, 0x02b8, 0xfeaf, 0xfbdf, 0xfa39, 0xf9d7, 0xf9ae, 0xf975,
+	0xf88d, 0xf804, 0xf9d6, 0xfbfd, 0xfe6b, 0x01f9, 0x03c5, 0x04f3,
+	0x071e, 0x089c, 0x0955, 0x0a54, 0x0a70, 0x0a4f, 0x0b9a, 0x0be0,
+	0x0acd, 0x088d, 0x04a5, 0x00cd, 0xfd5f, 0xfad6, 0xf85b, 0xf570,
+	0xf3e2, 0xf1c5, 0xee71, 0xed0a, 0xebfb, 0xed76, 0xf3f6, 0xf8d4,
+	0xfca5, 0x00c2, 0x01fb, 0x041c, 0x07f4, 0x0ada, 0x0d6c, 0x0f1d,
+	0x0dcc, 0x0a86, 0x07b2, 0x0460, 0x0022, 0xfd58, 0xfb93, 0xfa5b,
+	0xfa54, 0xf95a, 0xf754, 0xf7a6, 0xf906, 0xfa9f, 0xfd36, 0xff51,
+	0x0157, 0x03b7, 0x05c5, 0x07a3, 0x0976, 0x09ce, 0x0a1e, 0x0abf,
+	0x0afc, 0x0c6c, 0x0c4e, 0x09d9, 0x06f6, 0x0321, 0xffa5, 0xfd00,
+	0xf9a5, 0xf672, 0xf4a6, 0xf2b8, 0xf14e, 0xef58, 0xecf3, 0xeceb,
+	0xefb0, 0xf57f, 0xfb1b, 0xff85, 0x0245, 0x0347, 0x057c, 0x0889,
+	0x0b69, 0x0e79, 0x0fe0, 0x0d5c, 0x0939, 0x05c0, 0x02d2, 0x0084,
+	0xfdd6, 0xfb6f, 0xf9f7, 0xf99c, 0xf8d1, 0xf772, 0xf810, 0xf953,
+	0xfae1, 0xfcc1, 0xfe59, 0x0111, 0x0405, 0x0598, 0x06ed, 0x0895,
+	0x0950, 0x0ac8, 0x0b55, 0x0b2c, 0x0b96, 0x0ae8, 0x094a, 0x0681,
+	0x0335, 0xff90, 0xfbba, 0xf883, 0xf5ec, 0xf42c, 0xf30f, 0xf1a0,
+	0xefa0, 0xee62, 0xee04, 0xf056, 0xf66d, 0xfc02, 0x000d, 0x02b9,
+	0x03aa, 0x05cb, 0x09c6, 0x0c04, 0x0d50, 0x0e82, 0x0cb5, 0x09aa,
+	0x064a, 0x02d3, 0xffef, 0xfd33, 0xfb0b, 0xf955, 0xf975, 0xf883,
+	0xf705, 0xf756, 0xf801, 0xfa09, 0xfc37, 0xfdff, 0x00d5, 0x035c,
+	0x04d5, 0x0699, 0x07ed, 0x0a52, 0x0c07, 0x0b7a, 0x0bf7, 0x0b2f,
+	0x0a82, 0x0ab5, 0x0753, 0x0380, 0xffec, 0xfb94, 0xf8c3, 0xf68b,
+	0xf434, 0xf28b, 0xf115, 0xefdc, 0xef34, 0xeeae, 0xf02f, 0xf440,
+	0xf9e1, 0xff21, 0x02b0, 0x04c0, 0x062a, 0x08ba, 0x0b6b, 0x0dd1,
+	0x100e, 0x1001, 0x0d25, 0x085c, 0x042c, 0x0106, 0xfe5e, 0xfc07,
+	0xfa23, 0xf8e6, 0xf7fc, 0xf6de, 0xf5e5, 0xf694, 0xf8a0, 0xfa62,
+	0xfc62, 0xff00, 0x01c4, 0x045f, 0x0605, 0x06c6, 0x086c, 0x0a86,
+	0x0bef, 0x0cbd, 0x0c20, 0x0b56, 0x0a7a, 0x085d, 0x055a, 0x0184,
+	0xfdef, 0xfaf4, 0xf805, 0xf511, 0xf32d, 0xf1fb, 0xf0f8, 0xf067,
+	0xeef9, 0xee69, 0xf1c5, 0xf762, 0xfc70, 0x00ea, 0x031a, 0x040d,
+	0x073c, 0x0a56, 0x0ce9, 0x1038, 0x10f8, 0x0e93, 0x0af9, 0x071a,
+	0x0379, 0x00ae, 0xfd65, 0xfabc, 0xf9b9, 0xf914, 0xf797, 0xf542,
+	0xf4d5, 0xf645, 0xf8bb, 0xfb92, 0xfe0c, 0x0029, 0x0213, 0x039b,
+	0x0499, 0x06e5, 0x0995, 0x0ae9, 0x0bc5, 0x0b93, 0x0a97, 0x0a62,
+	0x099d, 0x0703, 0x040b, 0x0078, 0xfcb5, 0xfa2f, 0xf780, 0xf4cf,
+	0xf353, 0xf215, 0xf0e0, 0xf04c, 0xef3b, 0xf029, 0xf4d5, 0xf9b2,
+	0xfdfe, 0x01ba, 0x036c, 0x0593, 0x08de, 0x0b73, 0x0eab, 0x1146,
+	0x103b, 0x0d0a, 0x08e8, 0x0532, 0x0280, 0xff49, 0xfc87, 0xfa81,
+	0xf90f, 0xf81a, 0xf621, 0xf515, 0xf70d, 0xf8fd, 0xfaf4, 0xfd45,
+	0xfe69, 0x00dd, 0x0325, 0x03f0, 0x05df, 0x076e, 0x08e1, 0x0a5b,
+	0x0a62, 0x0a89, 0x0a7f, 0x097e, 0x0893, 0x064e, 0x02c8, 0xff7a,
+	0xfc01, 0xf98d, 0xf776, 0xf4cf, 0xf320, 0xf1ba, 0xf097, 0xf069,
+	0xf045, 0xf26c, 0xf706, 0xfaf9, 0xfdf3, 0x007b, 0x02d6, 0x068a,
+	0x0a42, 0x0cb0, 0x0ec9, 0x0f7a, 0x0edc, 0x0c64, 0x08bd, 0x05d9,
+	0x0283, 0xff04, 0xfc4d, 0xf9a6, 0xf822, 0xf786, 0xf5e2, 0xf5c6,
+	0xf788, 0xf975, 0xfbaf, 0xfd0d, 0xfe9a, 0x0126, 0x0358, 0x04a4,
+	0x04ea, 0x05eb, 0x07f8, 0x0961, 0x09df, 0x09d7, 0x093f, 0x08e3,
+	0x0818, 0x05da, 0x02fb, 0xff8c, 0xfc67, 0xf9ef, 0xf7be, 0xf566,
+	0xf2b6, 0xf0fb, 0xf04f, 0xf0ea, 0xf249, 0xf3f7, 0xf670, 0xf9b8,
+	0xfd3c, 0x00cb, 0x045a, 0x06fd, 0x0a38, 0x0c8f, 0x0de3, 0x0f16,
+	0x0e84, 0x0ca0, 0x0a39, 0x070a, 0x03d6, 0x00a0, 0xfcc7, 0xf9d0,
+	0xf809, 0xf75d, 0xf723, 0xf677, 0xf707, 0xf7fb, 0xf94b, 0xfb82,
+	0xfd37, 0xffef, 0x028a, 0x0367, 0x049d, 0x05d7, 0x0772, 0x0a16,
+	0x0b11, 0x0b01, 0x0ae7, 0x09cb, 0x08b5, 0x074e, 0x048d, 0x01b1,
+	0xfdcb, 0xfa39, 0xf7a1, 0xf529, 0xf372, 0xf16d, 0xf02d, 0xf104,
+	0xf284, 0xf399, 0xf591, 0xf803, 0xfbc0, 0xfff0, 0x0310, 0x05a8,
+	0x0770, 0x093f, 0x0b16, 0x0cd6, 0x0e4b, 0x0e0c, 0x0c04, 0x0975,
+	0x0651, 0x0388, 0x0160, 0xfea1, 0xfc62, 0xfa65, 0xf836, 0xf6e5,
+	0xf636, 0xf65a, 0xf74e, 0xf8c8, 0xfa84, 0xfc0f, 0xfd78, 0xff6d,
+	0x022b, 0x04c0, 0x0685, 0x0781, 0x0874, 0x0a2d, 0x0bc3, 0x0bc0,
+	0x0a7c, 0x0891, 0x05f7, 0x02fe, 0xffe7, 0xfcc4, 0xfa98, 0xf932,
+	0xf71f, 0xf485, 0xf27a, 0xf124, 0xf1e5, 0xf397, 0xf50d, 0xf74b,
+	0xf918, 0xfa8a, 0xfd15, 0xffb1, 0x02c8, 0x0665, 0x0921, 0x0b6b,
+	0x0c43, 0x0c28, 0x0c10, 0x0c0a, 0x0c39, 0x0a5b, 0x070d, 0x03df,
+	0x0091, 0xfdcd, 0xfb07, 0xf81d, 0xf6ae, 0xf64a, 0xf643, 0xf69e,
+	0xf75e, 0xf90f, 0xfad0, 0xfc6b, 0xfeaf, 0x011c, 0x03ac, 0x0589,
+	0x05bf, 0x065e, 0x0801, 0x08fc, 0x0923, 0x08aa, 0x0780, 0x067d,
+	0x04d9, 0x0218, 0x00a7, 0xffae, 0xfe1b, 0xfb74, 0xf7ec, 0xf5ae,
+	0xf525, 0xf524, 0xf507, 0xf4da, 0xf562, 0xf738, 0xf97a, 0xfbc4,
+	0xfde9, 0x0023, 0x02c3, 0x04fb, 0x06e0, 0x07ed, 0x08bb, 0x097a,
+	0x0995, 0x0a01, 0x09be, 0x08e7, 0x080d, 0x05f3, 0x03a1, 0x016a,
+	0xff01, 0xfdea, 0xfcf5, 0xfae8, 0xf902, 0xf75f, 0xf70e, 0xf855,
+	0xf897, 0xf908, 0xfa4f, 0xfba2, 0xfdaa, 0xffcb, 0x01e5, 0x0403,
+	0x04ee, 0x0492, 0x0535, 0x0651, 0x076c, 0x0748, 0x056f, 0x045c,
+	0x0324, 0x01ba, 0x005f, 0xff1c, 0xfe2a, 0xfc36, 0xf9a2, 0xf89d,
+	0xf990, 0xfb0e, 0xfb2a, 0xf9a0, 0xf9e0, 0xfc00, 0xfd8a, 0xfdf9,
+	0xfd69, 0xfec5, 0x016f, 0x0210, 0x0181, 0x00fb, 0x0217, 0x042a,
+	0x0454, 0x0351, 0x0350, 0x03c5, 0x03d3, 0x037a, 0x0267, 0x0335,
+	0x0541, 0x05b0, 0x0541, 0x03fa, 0x0268, 0x01bb, 0x00cb, 0xff2e,
+	0xfdef, 0xfc29, 0xfa3b, 0xf954, 0xf88a, 0xf87f, 0xf890, 0xf904,
+	0xfab0, 0xfcbe, 0xfdef, 0xfeb1, 0x002c, 0x01a3, 0x0332, 0x0262,
+	0x010a, 0x01e9, 0x0311, 0x044d, 0x041d, 0x0305, 0x035a, 0x0440,
+	0x0454, 0x03b9, 0x038e, 0x0347, 0x02a1, 0x007a, 0xfd49, 0xfb84,
+	0xfb1b, 0xfb48, 0xfb42, 0xfaab, 0xfa0e, 0xfad5, 0xfc6f, 0xfe84,
+	0x0025, 0x0064, 0x0161, 0x033e, 0x054c, 0x0550, 0x0387, 0x0271,
+	0x023e, 0x026e, 0x0076, 0xffa4, 0x01e8, 0x0238, 0x008b, 0xfcfe,
+	0xfc55, 0x0330, 0x06f1, 0x02d0, 0xff03, 0xfb6e, 0xfbf6, 0xfdb8,
+	0xf940, 0xf8cb, 0xfb3c, 0xfaf3, 0xfa39, 0xf985, 0xfd09, 0x0403,
+	0x067b, 0x04dc, 0x06b1, 0x09f3, 0x0b02, 0x0770, 0xfff0, 0xfefc,
+	0x014c, 0xff97, 0xfcc3, 0xf982, 0xfa1d, 0xfcc3, 0xfb7c, 0xfad9,
+	0xfe19, 0x0288, 0x04ea, 0x020e, 0xfdfd, 0xfc46, 0xfd6d, 0x02b5,
+	0x056e, 0x06c2, 0x0520, 0x01cc, 0x0511, 0x06b9, 0x0635, 0x042a,
+	0xfe25, 0xfdaf, 0xfd67, 0xf6c1, 0xf274, 0xeefa, 0xee34, 0xf22c,
+	0xf0d8, 0xf39e, 0xfdc2, 0x058c, 0x0c48, 0x0c02, 0x08b5, 0x0c1e,
+	0x0fa6, 0x10df, 0x112d, 0x0c36, 0x05fe, 0x01c4, 0xfc06, 0xfae4,
+	0xfc52, 0xfb7f, 0xfd6e, 0xfe6c, 0xfe67, 0xff56, 0xfe4e, 0xfd30,
+	0xfc87, 0xf929, 0xf638, 0xf93a, 0xff37, 0xff6c, 0xf484, 0xe805,
+	0xed44, 0x069e, 0x1a43, 0x1597, 0x0768, 0x04dc, 0x1373, 0x1d95,
+	0x0de9, 0xf96b, 0xf764, 0x0085, 0x021c, 0xef91, 0xd9c5, 0xdc4c,
+	0xef5f, 0xf9ec, 0xf73f, 0xf101, 0xf925, 0x0ffb, 0x1a56, 0x1367,
+	0x0a74, 0x08b3, 0x106b, 0x1404, 0x0749, 0xfbed, 0xfba3, 0xffec,
+	0x06e9, 0x02ab, 0xf96e, 0xfb7a, 0x029b, 0x096b, 0x0b4c, 0x030c,
+	0xfcf0, 0xfde6, 0xfba3, 0xf7d8, 0xf11d, 0xea83, 0xef2b, 0xfa2c,
+	0xff5f, 0xf7d8, 0xe766, 0xe253, 0xfb17, 0x2039, 0x2c59, 0x1ac5,
+	0x0273, 0x002c, 0x1768, 0x1fae, 0x0b38, 0xf3a5, 0xeb29, 0xf658,
+	0xfdc3, 0xeabc, 0xd7c1, 0xdab2, 0xed0c, 0x0212, 0x008a, 0xf4e6,
+	0xfc17, 0x0f93, 0x1ec0, 0x1da7, 0x0c13, 0x01d1, 0x0b29, 0x12e6,
+	0x11b6, 0x06c1, 0xf88b, 0xfab7, 0x0533, 0x054a, 0x00be, 0xfc50,
+	0xfeb8, 0x0cf4, 0x0dcd, 0xfef3, 0xf32a, 0xed69, 0xf328, 0xf884,
+	0xee30, 0xe923, 0xf322, 0xfc36, 0xfa01, 0xe6d0, 0xdb13, 0xfb3b,
+	0x2954, 0x378b, 0x22ab, 0xfde8, 0xfa79, 0x1af4, 0x278d, 0x143c,
+	0xf406, 0xdfc7, 0xee44, 0xfc6b, 0xedd6, 0xda39, 0xd0ad, 0xe2fb,
+	0x05a1, 0x0f3c, 0x05c9, 0xfd31, 0x027c, 0x19e8, 0x25e6, 0x18ea,
+	0x06de, 0xfd95, 0x05fa, 0x11e9, 0x0a6c, 0xfb4f, 0xf2c9, 0xf8f9,
+	0x08db, 0x0acd, 0x02b3, 0xfdb2, 0xffe7, 0x0a75, 0x0abf, 0xfc27,
+	0xf04d, 0xe9d6, 0xed75, 0xf31e, 0xed98, 0xefa1, 0xf5ec, 0xf35b,
+	0xed39, 0xe2e3, 0xf24f, 0x1e30, 0x361d, 0x2de4, 0x0ef4, 0xf8b1,
+	0x0ceb, 0x26a3, 0x2168, 0x07d8, 0xe490, 0xdc1b, 0xef80, 0xf4b2,
+	0xeb0d, 0xda79, 0xd4ca, 0xeef8, 0x0bde, 0x11d0, 0x0979, 0xfb7f,
+	0x013d, 0x1893, 0x2046, 0x168a, 0x0395, 0xf6a2, 0x0004, 0x0ba1,
+	0x0b90, 0x071b, 0xff93, 0x001e, 0x074c, 0x0747, 0x0645, 0x0608,
+	0x02da, 0x0119, 0xf914, 0xefe8, 0xf0f4, 0xf2b3, 0xf33d, 0xeddc,
+	0xe6e3, 0xeed3, 0xfb0f, 0xfaee, 0xef6f, 0xe474, 0xf5bf, 0x1dd9,
+	0x3271, 0x2a72, 0x0c91, 0xfb7a, 0x0dd7, 0x2132, 0x1fc0, 0x080a,
+	0xe833, 0xe0d5, 0xed96, 0xf37f, 0xeeef, 0xdf4b, 0xda57, 0xf0c5,
+	0x0af8, 0x17b5, 0x110a, 0xfe0e, 0xfc19, 0x0ca2, 0x1a3f, 0x1cfd,
+	0x0caa, 0xf73b, 0xf29f, 0xf82d, 0x048d, 0x1073, 0x0d19, 0x062d,
+	0xff50, 0xfb22, 0x050d, 0x0cc8, 0x0b1a, 0x0083, 0xee0b, 0xe746,
+	0xf024, 0xfa0a, 0xfd8b, 0xf3fe, 0xe802, 0xee0a, 0xfac3, 0x0099,
+	0xf763, 0xe76f, 0xeeca, 0x0f8e, 0x2b0e, 0x2d0f, 0x139e, 0xf990,
+	0x01b0, 0x183d, 0x2522, 0x1a9f, 0xf5f3, 0xdf1c, 0xe0f4, 0xebf9,
+	0xf939, 0xf132, 0xe27d, 0xe754, 0xf5af, 0x0d8e, 0x19d0, 0x0c9a,
+	0x00fa, 0xfc08, 0x0340, 0x157f, 0x163c, 0x0a51, 0xfa80, 0xebeb,
+	0xf2ca, 0x04f3, 0x14d7, 0x1bee, 0x0f53, 0xfd5c, 0xf846, 0xfd6f,
+	0x0884, 0x0a3d, 0xf9db, 0xea88, 0xe3ef, 0xeb3d, 0xfb17, 0xfeb6,
+	0xf888, 0xf1c1, 0xf22a, 0xfed3, 0x049b, 0xfac1, 0xee9b, 0xed1f,
+	0x0644, 0x2595, 0x2cf3, 0x1d5b, 0x004b, 0xf751, 0x0a52, 0x1bf1,
+	0x1f8f, 0x081e, 0xe76d, 0xdafe, 0xdd04, 0xed4d, 0xfa9a, 0xf7f7,
+	0xf497, 0xf2e4, 0xf962, 0x09df, 0x1299, 0x1381, 0x0d3b, 0x00e0,
+	0xfe82, 0x01e6, 0x06dc, 0x0878, 0xff10, 0xf5ba, 0xf6ab, 0x0363,
+	0x1659, 0x1ebf, 0x1414, 0x01d5, 0xf345, 0xf32d, 0xfdc1, 0x0231,
+	0xfd9a, 0xf206, 0xe80d, 0xea9c, 0xf1e9, 0xf835, 0xfbfc, 0xfbde,
+	0x0221, 0x0667, 0xfdaa, 0xef71, 0xe608, 0xf46c, 0x164c, 0x2bc8,
+	0x2a4c, 0x1295, 0xf913, 0xf850, 0x0668, 0x1843, 0x1ca7, 0x0834,
+	0xeda0, 0xda45, 0xd8d5, 0xeae0, 0xfd52, 0x0535, 0x025a, 0xf813,
+	0xf625, 0xff32, 0x0ace, 0x1514, 0x1254, 0x0571, 0xf96c, 0xf2e7,
+	0xf805, 0x0182, 0x05a8, 0x0660, 0x03c3, 0x0394, 0x0926, 0x0d9b,
+	0x1264, 0x0f89, 0x0257, 0xf58c, 0xec82, 0xee45, 0xf88a, 0xfd5d,
+	0xfdb8, 0xf807, 0xefc1, 0xef27, 0xf1b5, 0xf9d4, 0x0648, 0x0da0,
+	0x0d17, 0xff25, 0xe941, 0xe304, 0xf522, 0x175c, 0x3244, 0x2dfc,
+	0x11af, 0xf3f9, 0xea1b, 0xf9fa, 0x132b, 0x1e80, 0x1272, 0xf5e6,
+	0xdab2, 0xd558, 0xe55e, 0xff6a, 0x12d6, 0x1053, 0x0021, 0xf09e,
+	0xee70, 0xfcd9, 0x0d3f, 0x1311, 0x0acc, 0xf93c, 0xed96, 0xf0bf,
+	0xff6c, 0x1018, 0x160f, 0x10b0, 0x07d1, 0x0261, 0x0518, 0x0b55,
+	0x0d62, 0x0737, 0xfa39, 0xee36, 0xe9e4, 0xef45, 0xfa17, 0x0331,
+	0x042d, 0xfbfb, 0xf1df, 0xec49, 0xf068, 0xfc8a, 0x09ad, 0x1183,
+	0x0bba, 0xf7dc, 0xe476, 0xe3d1, 0xfd19, 0x2295, 0x3680, 0x2b70,
+	0x0a21, 0xe9fc, 0xe29a, 0xf449, 0x1039, 0x2015, 0x171d, 0xfa84,
+	0xdcba, 0xd32d, 0xe2b0, 0x01ce, 0x1ab5, 0x1cf2, 0x0b8a, 0xf208,
+	0xe474, 0xeb31, 0xfe36, 0x1022, 0x1232, 0x0564, 0xf72a, 0xf1c3,
+	0xf8dc, 0x06cd, 0x113f, 0x14b7, 0x0ea6, 0x03e3, 0xfc81, 0xfb0a,
+	0x0102, 0x06ed, 0x0661, 0xff64, 0xf426, 0xee0f, 0xf1f4, 0xfb97,
+	0x052b, 0x0600, 0xfe24, 0xf423, 0xec6e, 0xec9f, 0xf66a, 0x04f3,
+	0x11e1, 0x10e4, 0x0012, 0xed0e, 0xe823, 0xfc03, 0x1bda, 0x3002,
+	0x2a55, 0x0fe2, 0xf179, 0xe2dc, 0xeb4c, 0x00fb, 0x15cd, 0x1933,
+	0x095e, 0xf110, 0xded4, 0xde09, 0xee9e, 0x06e9, 0x16de, 0x1540,
+	0x0325, 0xee79, 0xe595, 0xebeb, 0xfc54, 0x0ae3, 0x10d2, 0x0d18,
+	0x0419, 0xfca8, 0xfbb3, 0x026d, 0x0c93, 0x1359, 0x108e, 0x0562,
+	0xfa0c, 0xf724, 0xfda9, 0x0702, 0x0a1a, 0x0352, 0xf886, 0xeff0,
+	0xef82, 0xf7e9, 0x0079, 0x0432, 0xffe2, 0xf4da, 0xed26, 0xec5f,
+	0xf3fb, 0x0299, 0x0eb7, 0x10fb, 0x095d, 0xf781, 0xec7d, 0xf244,
+	0x0552, 0x1fc8, 0x2797, 0x1a16, 0x03fc, 0xf379, 0xf432, 0x0115,
+	0x0dd2, 0x1365, 0x0d4a, 0xfda2, 0xef6a, 0xe678, 0xe762, 0xf033,
+	0xfa95, 0x029c, 0x0360, 0xfd00, 0xf422, 0xef1c, 0xf13d, 0xfa5c,
+	0x06db, 0x0fed, 0x113a, 0x09de, 0xffeb, 0xfbb1, 0xff63, 0x08ff,
+	0x1158, 0x135b, 0x0ec9, 0x0651, 0xff38, 0xfc87, 0xfe35, 0x018e,
+	0x02ea, 0x009c, 0xfc2e, 0xf6c7, 0xf387, 0xf238, 0xf200, 0xf49f,
+	0xf6ef, 0xf930, 0xf978, 0xf77d, 0xf6e2, 0xf85d, 0xfd69, 0x038a,
+	0x0644, 0x021c, 0xfbf0, 0xfc49, 0x0769, 0x17a7, 0x202b, 0x1c92,
+	0x1163, 0x079a, 0x03ca, 0x0582, 0x07e2, 0x0848, 0x04a9, 0xfcd5,
+	0xf543, 0xef88, 0xedb4, 0xf04c, 0xf447, 0xf7e5, 0xf93a, 0xf758,
+	0xf40e, 0xf0f8, 0xf041, 0xf339, 0xf9bd, 0x00a5, 0x05e1, 0x0877,
+	0x0897, 0x0814, 0x0844, 0x0a81, 0x0e65, 0x11ca, 0x1233, 0x1073,
+	0x0c39, 0x07b1, 0x03da, 0xfff1, 0xfdf8, 0xfd11, 0xfde0, 0xfec4,
+	0xfca7, 0xf750, 0xf0f5, 0xed7c, 0xee7e, 0xf2e5, 0xf7aa, 0xfb45,
+	0xfc10, 0xf9f5, 0xf640, 0xf3ff, 0xf708, 0xfeb9, 0x07c6, 0x0c2e,
+	0x088f, 0x018d, 0xff70, 0x06ed, 0x13a6, 0x1b3e, 0x1886, 0x0f71,
+	0x0759, 0x0523, 0x06c2, 0x0743, 0x0533, 0x005e, 0xfb4c, 0xf846,
+	0xf5e7, 0xf448, 0xf2d0, 0xf15a, 0xf08e, 0xf0b3, 0xf218, 0xf4e0,
+	0xf724, 0xf792, 0xf80b, 0xf96a, 0xfd7f, 0x0226, 0x046c, 0x0505,
+	0x0500, 0x06f3, 0x0afe, 0x0e2f, 0x0ecc, 0x0cf4, 0x09f4, 0x088e,
+	0x08fc, 0x09c9, 0x095c, 0x05d2, 0x0053, 0xfbde, 0xfaca, 0xfcfa,
+	0xff1f, 0xfe8a, 0xfb0d, 0xf68e, 0xf3f4, 0xf411, 0xf64f, 0xf813,
+	0xf804, 0xf678, 0xf5a9, 0xf74a, 0xfac6, 0xfddf, 0xff0e, 0xff5f,
+	0x00c0, 0x0494, 0x0837, 0x0892, 0x05a9, 0x03eb, 0x072d, 0x0db3,
+	0x122f, 0x1095, 0x0ad5, 0x0613, 0x0551, 0x0738, 0x075c, 0x0491,
+	0xff79, 0xfa66, 0xf732, 0xf54d, 0xf43c, 0xf3a0, 0xf2c9, 0xf287,
+	0xf381, 0xf548, 0xf765, 0xf85d, 0xf897, 0xf94c, 0xfb26, 0xfec3,
+	0x0306, 0x0647, 0x0793, 0x075f, 0x07d5, 0x0a37, 0x0d1a, 0x0e28,
+	0x0c72, 0x0954, 0x06c7, 0x065f, 0x06a3, 0x0659, 0x0427, 0x00b9,
+	0xfdf3, 0xfc49, 0xfbac, 0xfac5, 0xf8cc, 0xf607, 0xf3c0, 0xf32a,
+	0xf4f8, 0xf7b1, 0xf971, 0xfa1c, 0xf97f, 0xf9d4, 0xfb6d, 0xfdf3,
+	0x00f2, 0x02ea, 0x040c, 0x0516, 0x06b5, 0x08ce, 0x09f5, 0x088f,
+	0x05d1, 0x0466, 0x05c5, 0x089c, 0x0838, 0x029f, 0xfc27, 0xfae8,
+	0x00fc, 0x0800, 0x0848, 0x01a3, 0xf9ea, 0xf79e, 0xfb5a, 0xff7b,
+	0x001f, 0xfd72, 0xf946, 0xf72e, 0xf758, 0xf7fb, 0xf90b, 0xf8ef,
+	0xf86e, 0xf899, 0xf9ed, 0xfcb3, 0xff55, 0xffac, 0xfee5, 0xfec7,
+	0x00ac, 0x055e, 0x0958, 0x0ab7, 0x09a8, 0x07c9, 0x087d, 0x0bba,
+	0x0e88, 0x0e3d, 0x0a8e, 0x05f5, 0x03a8, 0x0387, 0x03aa, 0x01fc,
+	0xfdd4, 0xf969, 0xf681, 0xf560, 0xf5d3, 0xf5a0, 0xf476, 0xf325,
+	0xf24b, 0xf389, 0xf616, 0xf8de, 0xfaa2, 0xfb19, 0xfb8d, 0xfded,
+	0x019d, 0x0546, 0x0751, 0x0754, 0x07b3, 0x0914, 0x0b55, 0x0d16,
+	0x0cd8, 0x0af4, 0x08ed, 0x074d, 0x0646, 0x0559, 0x0331, 0x00dd,
+	0xfe87, 0xfc57, 0xfb61, 0xfa36, 0xf8d5, 0xf7ae, 0xf611, 0xf501,
+	0xf4fa, 0xf664, 0xfa2e, 0xfd65, 0xfc91, 0xf8ee, 0xf609, 0xfa3a,
+	0x04c8, 0x0c73, 0x0cd3, 0x068d, 0x00f2, 0x032d, 0x0a38, 0x0f48,
+	0x0f03, 0x09e6, 0x0408, 0x00fa, 0x0034, 0x0037, 0xff54, 0xfc4d,
+	0xf8e9, 0xf681, 0xf61a, 0xf75f, 0xf797, 0xf713, 0xf6d8, 0xf7ae,
+	0xfa23, 0xfcca, 0xfdcb, 0xfdc0, 0xfde4, 0xffd8, 0x03e1, 0x07b6,
+	0x0950, 0x0846, 0x0673, 0x060e, 0x07af, 0x09c2, 0x09f5, 0x0736,
+	0x033a, 0x00df, 0x0112, 0x02b7, 0x02df, 0x0050, 0xfc94, 0xf9fd,
+	0xf9c8, 0xfabf, 0xfb48, 0xfa85, 0xf8ea, 0xf7d0, 0xf815, 0xf9c6,
+	0xfbc0, 0xfcd1, 0xfca7, 0xfc70, 0xfd6b, 0xffa3, 0x023e, 0x03cb,
+	0x03e3, 0x033d, 0x02f3, 0x037b, 0x04d6, 0x0603, 0x05fa, 0x0519,
+	0x03e9, 0x0347, 0x035a, 0x0306, 0x023e, 0x0123, 0x001f, 0xff72,
+	0xfee0, 0xfe43, 0xfdeb, 0xfde4, 0xfe21, 0xfe6d, 0xfe05, 0xfd99,
+	0xfd66, 0xfd6b, 0xfd79, 0xfd6f, 0xfd6a, 0xfda5, 0xfe69, 0xfea6,
+	0xfed5, 0xfefa, 0xff42, 0x000e, 0x005a, 0x0077, 0x008e, 0x00cf,
+	0x0176, 0x0213, 0x021e, 0x01b2, 0x012a, 0x0158, 0x029e, 0x03ca,
+	0x0406, 0x033c, 0x0227, 0x01e9, 0x0214, 0x01a6, 0x0066, 0xfef1,
+	0xfdef, 0xfd68, 0xfd1e, 0xfc6d, 0xfbe0, 0xfb74, 0xfb5e, 0xfbfa,
+	0xfce9, 0xfe20, 0xfeee, 0xfe91, 0xfdb6, 0xfd98, 0xfeae, 0x00ca,
+	0x0264, 0x0315, 0x0356, 0x0395, 0x04a0, 0x0575, 0x0598, 0x04fe,
+	0x03f2, 0x0377, 0x033d, 0x029f, 0x0155, 0xff66, 0xfdb3, 0xfce4,
+	0xfcec, 0xfd1f, 0xfcd4, 0xfbae, 0xfa6e, 0xf9ce, 0xfa5a, 0xfba1,
+	0xfc89, 0xfced, 0xfd06, 0xfd4f, 0xfdee, 0xfee7, 0x0036, 0x019e,
+	0x02cc, 0x034a, 0x0395, 0x03e2, 0x047f, 0x0521, 0x0553, 0x0501,
+	0x046d, 0x03ea, 0x035b, 0x02ea, 0x0260, 0x0199, 0x00af, 0x000f,
+	0xffca, 0xff7a, 0xfe71, 0xfca6, 0xfb47, 0xfb72, 0xfcf2, 0xfdf5,
+	0xfda4, 0xfc5f, 0xfb78, 0xfc75, 0xfe6a, 0xffb8, 0xffe3, 0xff20,
+	0xfea5, 0xff1c, 0x0015, 0x00c1, 0x00a6, 0x0033, 0x0025, 0x00b5,
+	0x01a1, 0x0221, 0x01db, 0x016f, 0x0152, 0x01c5, 0x025a, 0x0280,
+	0x0208, 0x013c, 0x00d4, 0x0105, 0x019f, 0x01f9, 0x01a1, 0x00b9,
+	0xff9e, 0xff19, 0xff12, 0xff42, 0xff14, 0xfe41, 0xfd63, 0xfd1f,
+	0xfd62, 0xfdd6, 0xfe11, 0xfe11, 0xfe85, 0xff0e, 0xff9c, 0xffd8,
+	0xff9c, 0xffb4, 0x0013, 0x0108, 0x01ab, 0x0161, 0x008a, 0xffe3,
+	0xffeb, 0x008e, 0x011e, 0x0140, 0x010c, 0x008e, 0x0023, 0xfffc,
+	0x0006, 0x0020, 0x0018, 0xffb4, 0xff61, 0xff35, 0xff58, 0xff8f,
+	0xff5f, 0xff40, 0xff5c, 0xff91, 0xffe3, 0xffc3, 0xff79, 0xff93,
+	0xffd6, 0x005f, 0x00d0, 0x00f5, 0x0111, 0x00c2, 0x00a8, 0x00d4,
+	0x0114, 0x0154, 0x013b, 0x00dc, 0x0078, 0x0027, 0x001e, 0x0009,
+	0xffbf, 0xff6b, 0xff38, 0xff3f, 0xff71, 0xff65, 0xff25, 0xfece,
+	0xfe92, 0xfe91, 0xfec5, 0xff1f, 0xff49, 0xff57, 0xff1e, 0xff28,
+	0xffa8, 0x002d, 0x0093, 0x0065, 0x0043, 0x0057, 0x00a0, 0x00ff,
+	0x0129, 0x014c, 0x019c, 0x01a2, 0x018f, 0x0156, 0x014c, 0x014f,
+	0x0133, 0x00ed, 0x0080, 0x003a, 0x0019, 0xffed, 0xffc8, 0xff8b,
+	0xff42, 0xff07, 0xfeaf, 0xfe81, 0xfe7a, 0xfe7a, 0xfe8b, 0xfe78,
+	0xfe4e, 0xfe4b, 0xfe8f, 0xff29, 0xffc5, 0x0014, 0x0036, 0x004b,
+	0x0076, 0x00d3, 0x0126, 0x0164, 0x01b0, 0x01ae, 0x017f, 0x00e2,
+	0x005d, 0x001b, 0x0030, 0x0040, 0x0045, 0xfffb, 0xff93, 0xff1f,
+	0xfe68, 0xfe4a, 0xfe81, 0xfee9, 0xff58, 0xff72, 0xffb3, 0xffea,
+	0x001f, 0x0070, 0x0091, 0x010a, 0x0197, 0x01d6, 0x01a7, 0x00d5,
+	0x000e, 0x0020, 0x00e9, 0x0196, 0x0152, 0x0027, 0xff34, 0xff0f,
+	0xff60, 0xff8a, 0xff17, 0xfe64, 0xfde4, 0xfdae, 0xfd86, 0xfd3e,
+	0xfcf7, 0xfd03, 0xfd8b, 0xfe1c, 0xfeda, 0xff41, 0xff8e, 0xfffa,
+	0x0095, 0x0191, 0x0298, 0x0338, 0x033b, 0x030e, 0x0317, 0x0388,
+	0x0414, 0x0435, 0x03ac, 0x02e0, 0x0234, 0x01c1, 0x016e, 0x00c5,
+	0xffd4, 0xfec7, 0xfdea, 0xfd6a, 0xfd31, 0xfd0c, 0xfccc, 0xfc65,
+	0xfc16, 0xfc45, 0xfca2, 0xfd3b, 0xfdb7, 0xfdf5, 0xfe2f, 0xfe8e,
+	0xff4e, 0x002e, 0x00ec, 0x0143, 0x016a, 0x0196, 0x0212, 0x02a8,
+	0x0314, 0x0326, 0x02d9, 0x0279, 0x0224, 0x01dd, 0x01ac, 0x0162,
+	0x0145, 0x010a, 0x0094, 0xffdb, 0xff09, 0xfe85, 0xfe83, 0xfed1,
+	0xff28, 0xfef7, 0xfe51, 0xfdad, 0xfd7a, 0xfde4, 0xfeb1, 0xff4a,
+	0xffae, 0xffae, 0xff9e, 0xffab, 0xffe4, 0x005a, 0x00d9, 0x016e,
+	0x0194, 0x012c, 0x002c, 0xff7b, 0xff69, 0xfff1, 0x0095, 0x00d2,
+	0x0093, 0x0015, 0xffa9, 0xff7b, 0xffa3, 0xffd2, 0xfff4, 0xffda,
+	0xff79, 0xff3f, 0xff2c, 0xff4a, 0xff7d, 0xff90, 0xffa6, 0xffa0,
+	0xff97, 0xffbe, 0xffe0, 0xffff, 0x0020, 0x0040, 0x0071, 0x00a0,
+	0x00db, 0x00f2, 0x00ef, 0x00d8, 0x00d5, 0x00fd, 0x011d, 0x011d,
+	0x00d8, 0x0070, 0x0032, 0x0021, 0x0011, 0xfff3, 0xffc7, 0xff85,
+	0xff6f, 0xff2a, 0xff1f, 0xff0b, 0xff1f, 0xff28, 0xff1b, 0xfef6,
+	0xfeea, 0xfeed, 0xff39, 0xff72, 0xffa9, 0xffe1, 0xfff7, 0x000e,
+	0x0037, 0x006b, 0x00b2, 0x00f6, 0x0110, 0x0115, 0x010c, 0x011f,
+	0x012c, 0x011b, 0x00fd, 0x00d7, 0x00a1, 0x0060, 0x0027, 0xfff5,
+	0xffdd, 0xffdb, 0xffb5, 0xff82, 0xff2d, 0xfee7, 0xfebd, 0xfeb4,
+	0xfed3, 0xfef2, 0xff05, 0xff1e, 0xff28, 0xff3f, 0xff6d, 0xffa5,
+	0xfff2, 0x0029, 0x0060, 0x008e, 0x00a3, 0x00c3, 0x00d7, 0x00f3,
+	0x00f8, 0x0109, 0x010b, 0x0129, 0x0112, 0x00de, 0x0095, 0x0060,
+	0x006a, 0x007c, 0x0066, 0xfff2, 0xff1d, 0xfe95, 0xfe70, 0xfe9e,
+	0xfee1, 0xfefa, 0xfee3, 0xfec8, 0xfec4, 0xfeea, 0xff38, 0xff81,
+	0xffb9, 0xffc4, 0xffc1, 0xffdd, 0x0014, 0x004f, 0x007c, 0x008f,
+	0x00b7, 0x00dc, 0x00fd, 0x00fd, 0x00d7, 0x00b0, 0x0087, 0x00a1,
+	0x00b3, 0x00ab, 0x006f, 0x0007, 0xffbf, 0xffae, 0xffb6, 0xffc3,
+	0xffbc, 0xff9d, 0xff8a, 0xff6d, 0xff6b, 0xff79, 0xff98, 0xffab,
+	0xffac, 0xffb7, 0xffbf, 0xffe6, 0x0016, 0x003c, 0x0039, 0x002b,
+	0x002a, 0x0042, 0x006f, 0x0084, 0x0080, 0x0063, 0x0045, 0x002e,
+	0x002b, 0x0036, 0x0043, 0x0028, 0xfffb, 0xffd9, 0xffe1, 0x0008,
+	0x0019, 0x0021, 0xfff6, 0xffcc, 0xffba, 0xffbc, 0xffdb, 0xffdd,
+	0xffeb, 0xffde, 0xffe7, 0xffde, 0xffe3, 0xfff2, 0xfff3, 0xfff3,
+	0xffe3, 0xffd9, 0xffdd, 0xffe9, 0x0001, 0x001b, 0x001e, 0x0011,
+	0xfffd, 0xfffa, 0x000b, 0x002b, 0x004b, 0x0064, 0x0067, 0x004c,
+	0x0014, 0xfff6, 0x000d, 0x002c, 0x005d, 0x0056, 0x002a, 0xffee,
+	0xffc9, 0xffb7, 0xffe4, 0x001c, 0x0022, 0xffca, 0xff2e, 0xfecc,
+	0xfec5, 0xfefa, 0xff46, 0xff69, 0xff56, 0xff6a, 0xffa2, 0xffdf,
+	0xfffd, 0xfff5, 0xfffa, 0x002c, 0x005a, 0x0089, 0x0086, 0x0059,
+	0x002e, 0x0025, 0x003e, 0x0076, 0x0096, 0x0080, 0x0041, 0xfff1,
+	0xffcc, 0xffdd, 0x001b, 0x0025, 0xfffb, 0xffb5, 0xff8d, 0xffac,
+	0xffe0, 0xfff8, 0xfffe, 0xffe0, 0xffd4, 0xffe5, 0x0013, 0x0034,
+	0x003b, 0x003a, 0x0027, 0x0028, 0x0024, 0x0040, 0x0051, 0x0054,
+	0x0062, 0x0063, 0x0058, 0x0022, 0xffef, 0xffc5, 0xffdb, 0xfffb,
+	0x0020, 0x0000, 0xffc2, 0xff78, 0xff74, 0xffb1, 0xfff8, 0x002c,
+	0x0003, 0xffd0, 0xffa5, 0xffc1, 0x001f, 0x0064, 0x0082, 0x0045,
+	0x0001, 0xffe6, 0xfff7, 0x0039, 0x005c, 0x0052, 0x0036, 0x0000,
+	0xffe5, 0xffde, 0xfff2, 0x0001, 0xfff5, 0xffec, 0xffda, 0xffc2,
+	0xffbd, 0xffb5, 0xffbc, 0xffc6, 0xffdd, 0xfffa, 0x0003, 0x0002,
+	0xfffd, 0x0002, 0x001d, 0x0045, 0x0064, 0x004e, 0x002f, 0x0023,
+	0x0040, 0x005a, 0x005c, 0x0027, 0xfff0, 0x0000, 0x0014, 0x002f,
+	0xffd1, 0xff54, 0xff09, 0xfef9, 0xff37, 0xff72, 0xffa3, 0xffb3,
+	0xff98, 0xff80, 0xff76, 0xffb0, 0xffeb, 0x0013, 0x0011, 0xffed,
+	0xffe1, 0xfffd, 0x003c, 0x0062, 0x0072, 0x0048, 0x002b, 0x0021,
+	0x0032, 0x005f, 0x006f, 0x0075, 0x0054, 0x0028, 0x001b, 0x0019,
+	0x0021, 0x002c, 0x000f, 0xfff9, 0xffd4, 0xffbc, 0xffc3, 0xffd1,
+	0xffe0, 0xffe9, 0xfff4, 0xffe6, 0xffbf, 0xffb2, 0xffc7, 0xffe8,
+	0x0022, 0x0024, 0x0007, 0xffd9, 0xffb3, 0xffc9, 0xfff1, 0x0029,
+	0x0053, 0x0035, 0xfffe, 0xffd7, 0xffd9, 0x000e, 0x003b, 0x0060,
+	0x004b, 0x001c, 0x0004, 0x000a, 0x0034, 0x004d, 0x0069, 0x0047,
+	0x0023, 0xffe9, 0xffdf, 0xfffc, 0x0012, 0x0020, 0x0014, 0xffea,
+	0xffc5, 0xffb1, 0xffb1, 0xffcb, 0xffd7, 0xffeb, 0xffdb, 0xffc1,
+	0xffb3, 0xffc0, 0xffe3, 0x000e, 0x0020, 0x0027, 0x0019, 0xfffb,
+	0xfff7, 0x0008, 0x0037, 0x0053, 0x005c, 0x0049, 0x001e, 0x0000,
+	0x0012, 0x0045, 0x004f, 0x0047, 0x0023, 0xfff2, 0xffd5, 0xffe8,
+	0x0002, 0x0009, 0xffbd, 0xff61, 0xff31, 0xff18, 0xff44, 0xff7b,
+	0xff9f, 0xffaf, 0xffb0, 0xffa7, 0xffa5, 0xffb5, 0xffd4, 0xfff6,
+	0x000d, 0x0020, 0x0021, 0x0017, 0x0006, 0x0020, 0x0040, 0x0053,
+	0x0064, 0x004d, 0x0031, 0x001c, 0x0023, 0x0033, 0x0038, 0x0032,
+	0x001a, 0xfff6, 0x0003, 0x0003, 0x0010, 0x0010, 0x0006, 0xffea,
+	0xffe2, 0xffef, 0xfff5, 0xfff3, 0x0001, 0xfff7, 0xfff2, 0xffe5,
+	0xfff8, 0x0005, 0x000a, 0x000c, 0xfff9, 0xffff, 0x000a, 0x0019,
+	0x0015, 0x0018, 0x000a, 0xfffd, 0x000d, 0x000c, 0x0009, 0x0006,
+	0x0012, 0x0018, 0x0021, 0x0018, 0x001d, 0x001b, 0x0022, 0x0030,
+	0x0029, 0x001d, 0x000b, 0x0005, 0x0011, 0x0012, 0x0013, 0x0004,
+	0xffea, 0xffc8, 0xffd5, 0xffde, 0xffe7, 0xffda, 0xffb7, 0xffb1,
+	0xffb3, 0xffd0, 0xffde, 0xffe6, 0xffd8, 0xffb7, 0xffc6, 0xffd9,
+	0x0006, 0x001f, 0x0036, 0x0022, 0x0007, 0x0007, 0x0023, 0x0040,
+	0x0061, 0x0042, 0x003a, 0x0016, 0x002e, 0x0041, 0x003b, 0x0029,
+	0x0003, 0xfff1, 0xfff4, 0xfffd, 0xffcd, 0xff72, 0xff39, 0xff1e,
+	0xff3f, 0xff71, 0xff98, 0xffaa, 0xffb1, 0xffb4, 0xffb4, 0xffb4,
+	0xffcd, 0xffed, 0xffff, 0x0015, 0x0026, 0x0024, 0x0023, 0x0022,
+	0x0038, 0x004b, 0x0061, 0x0069, 0x005d, 0x0044, 0x0027, 0x0029,
+	0x002f, 0x003e, 0x003e, 0x002e, 0x000a, 0xffe2, 0xffe0, 0xffe3,
+	0xfff3, 0xfff1, 0xfff5, 0xffe1, 0xffce, 0xffd3, 0xffe4, 0xfffd,
+	0xfffe, 0xfff5, 0xffed, 0xffed, 0x0003, 0x0015, 0x0023, 0x001f,
+	0x0011, 0x000f, 0x001f, 0x002e, 0x0035, 0x0024, 0x0013, 0x0003,
+	0xfffb, 0x0016, 0x001c, 0x002d, 0x0027, 0x001f, 0x0011, 0x0005,
+	0xffff, 0x000d, 0x0005, 0x0011, 0xffff, 0xfff5, 0xfff2, 0xfffa,
+	0xfff5, 0xfffe, 0xffe7, 0xffd9, 0xffe5, 0xfff3, 0xffee, 0xfff8,
+	0xfff1, 0xffec, 0xffea, 0xffe9, 0xffe2, 0xfff1, 0x0007, 0x0014,
+	0x0000, 0xfff2, 0xfff9, 0x0009, 0x000f, 0x0024, 0x001a, 0x0019,
+	0x0003, 0x001c, 0x0028, 0x0016, 0x0031, 0x0031, 0x0011, 0x0001,
+	0xfff7, 0x0001, 0x0004, 0x0007, 0x0009, 0xffe8, 0xffab, 0xff77,
+	0xff62, 0xff64, 0xff88, 0xffa4, 0xffa5, 0xff98, 0xff9c, 0xffb8,
+	0xffca, 0xffd1, 0xffd6, 0xffd0, 0xffe6, 0xfff9, 0x000b, 0x0017,
+	0x000f, 0x0001, 0x0018, 0x001c, 0x0033, 0x0033, 0x0021, 0x0016,
+	0x000e, 0x001d, 0x001d, 0x0025, 0x0026, 0x001c, 0x0005, 0x000a,
+	0x0005, 0x0008, 0x000c, 0x0002, 0xfff0, 0xffe9, 0xfff3, 0x000c,
+	0x0006, 0x0006, 0xfff6, 0xffec, 0x0006, 0x0017, 0x0017, 0x0009,
+	0x0001, 0xfff4, 0x0007, 0x0014, 0x0023, 0x001b, 0x0017, 0x0021,
+	0x0010, 0x000f, 0x0010, 0x0018, 0x0015, 0x0015, 0x0010, 0x000b,
+	0x000b, 0x0015, 0x0017, 0x0016, 0x0012, 0x0008, 0xfffb, 0x0002,
+	0x000b, 0x0005, 0x0012, 0x000c, 0xfff0, 0xffea, 0xffd9, 0xffe2,
+	0xffef, 0xffed, 0xffdc, 0xffd7, 0xffd5, 0xffe0, 0xfff0, 0x0003,
+	0xfffb, 0xfff1, 0xffef, 0xfffa, 0x0005, 0x0015, 0x0024, 0x0012,
+	0x000f, 0x0015, 0x001e, 0x0028, 0x0035, 0x002e, 0x0015, 0x0003,
+	0x0003, 0x0014, 0x0016, 0x0014, 0x0004, 0xffe9, 0xffed, 0xffe8,
+	0xffce, 0xff93, 0xff62, 0xff50, 0xff6d, 0xff92, 0xffa9, 0xffb8,
+	0xffb3, 0xffac, 0xffb4, 0xffcd, 0xffe3, 0xfff0, 0x0008, 0x0014,
+	0x000d, 0x0006, 0x000d, 0x001f, 0x0033, 0x0031, 0x0024, 0x0021,
+	0x002b, 0x0031, 0x0036, 0x0037, 0x0020, 0x0015, 0x0012, 0x0013,
+	0x001b, 0x0015, 0x002a, 0x0015, 0xffff, 0xfff5, 0xffef, 0x0000,
+	0x0007, 0xfffd, 0xfff2, 0xffe5, 0xffef, 0x0001, 0x0008, 0x0010,
+	0xfffa, 0xfffd, 0x0005, 0x0014, 0x0014, 0x0010, 0x0017, 0x000e,
+	0x0000, 0xfffb, 0x0004, 0x000c, 0x0011, 0x0018, 0x0010, 0x0001,
+	0xfffd, 0xfffa, 0xfffb, 0x0009, 0x000b, 0x000d, 0xffea, 0xfff3,
+	0xfff2, 0x0002, 0xfffe, 0x0002, 0x000b, 0x0000, 0xfff3, 0xffe9,
+	0xfff0, 0xfff5, 0xfffe, 0x0003, 0xfffd, 0xffe6, 0xffe3, 0xffe9,
+	0xfff2, 0x0004, 0x0007, 0x0006, 0xfffa, 0xffec, 0xffec, 0x0005,
+	0x0012, 0x001d, 0x0016, 0x0004, 0x0001, 0xfff8, 0x0017, 0x001e,
+	0x001c, 0x001b, 0x0010, 0x0004, 0xffff, 0x0003, 0x0002, 0x0013,
+	0x0009, 0x0000, 0xffd8, 0xff98, 0xff7b, 0xff82, 0xff93, 0xffb6,
+	0xffb5, 0xffa8, 0xffab, 0xffb9, 0xffcd, 0xffe4, 0xffef, 0xffef,
+	0xffe3, 0xffdc, 0xffe8, 0xfff8, 0x0013, 0x0014, 0x000f, 0x000e,
+	0x001c, 0x0020, 0x0031, 0x002c, 0x001b, 0x000b, 0x000f, 0x0031,
+	0x0025, 0x0030, 0x001b, 0x000c, 0xfffe, 0xfffd, 0x0013, 0x0012,
+	0x0022, 0x0019, 0x000a, 0xfff0, 0xfff9, 0x0004, 0x0018, 0x000f,
+	0xfffc, 0xfff6, 0xffff, 0x0008, 0x000b, 0x0016, 0x0000, 0xfffb,
+	0xfff4, 0xfff5, 0x0007, 0x001b, 0x0019, 0x0017, 0x0009, 0xfffe,
+	0xfffa, 0x000e, 0x0017, 0x0014, 0x0004, 0xfffd, 0x000e, 0x0014,
+	0x001b, 0x0015, 0x000f, 0xfff8, 0xfffa, 0x000a, 0x000a, 0x0009,
+	0x0004, 0x0004, 0xfff8, 0xfff7, 0xfff5, 0xfff4, 0xfff4, 0xfffa,
+	0xffe2, 0xffe4, 0xffee, 0xfff7, 0xfff9, 0xfff9, 0xfffb, 0xfff3,
+	0xfff8, 0x0008, 0x000c, 0x0019, 0x0011, 0x000d, 0x0008, 0xfffc,
+	0x0001, 0x0000, 0x0013, 0x001a, 0x0010, 0xfffa, 0xffef, 0xffed,
+	0xffef, 0xfffa, 0xfffe, 0xffef, 0xffd2, 0xff8d, 0xff7f, 0xff7a,
+	0xff88, 0xff97, 0xff9c, 0xff92, 0xffb0, 0xffc6, 0xffd3, 0xffe9,
+	0xffef, 0xffe4, 0xffda, 0xffe8, 0x0000, 0x0010, 0x0017, 0x000f,
+	0x0009, 0x0012, 0x001b, 0x0031, 0x0029, 0x0017, 0x0015, 0x0010,
+	0x001a, 0x0026, 0x002b, 0x0024, 0x0026, 0x0016, 0x000c, 0x0009,
+	0x0014, 0x001d, 0x0017, 0x0010, 0x0002, 0xfff7, 0x0009, 0x0008,
+	0x000c, 0x000f, 0x0019, 0x0015, 0x0004, 0xffff, 0xfff9, 0x0004,
+	0x000c, 0x000f, 0x001c, 0x0003, 0x0000, 0xfff4, 0xfff8, 0x000a,
+	0x0012, 0x0011, 0x000f, 0xfffd, 0xfff8, 0xfffd, 0x0014, 0x000e,
+	0x0014, 0x0009, 0xfffa, 0xfff8, 0x0006, 0x0018, 0x0017, 0x0008,
+	0xfffd, 0xfff3, 0xfff3, 0x0002, 0x0008, 0x0007, 0x0005, 0x0004,
+	0xfff2, 0xffef, 0x0005, 0x0003, 0x0002, 0xfff3, 0xfff3, 0xffef,
+	0xfff9, 0x0000, 0xfffd, 0x0000, 0xfff3, 0xfffb, 0xfff6, 0x0004,
+	0x0004, 0x0010, 0x000e, 0x0003, 0xfffd, 0xfff8, 0xffff, 0x000e,
+	0x0005, 0xfffa, 0xffef, 0xfff7, 0x0006, 0x000b, 0x0002, 0xffba,
+	0xff84, 0xff77, 0xff82, 0xffa3, 0xffb8, 0xffca, 0xffd3, 0xffcb,
+	0xffcb, 0xffd4, 0xffe8, 0xfff1, 0xfff8, 0xfff7, 0xffeb, 0xfff5,
+	0x0003, 0x0011, 0x0019, 0x0016, 0x0004, 0x0004, 0x000f, 0x0018,
+	0x001d, 0x0032, 0x002e, 0x0016, 0x0005, 0x000f, 0x0018, 0x001a,
+	0x0015, 0x000e, 0xfffd, 0x0006, 0x000a, 0x0016, 0x0014, 0x0002,
+	0xfffa, 0xfff0, 0xfff8, 0x000b, 0x0005, 0x0016, 0x000b, 0x0005,
+	0xfff5, 0xfff0, 0xfffb, 0xffff, 0x0008, 0x0000, 0xfffc, 0xfff4,
+	0x000d, 0x000f, 0x000d, 0x0006, 0xfffe, 0xfff5, 0x0001, 0x000e,
+	0x0010, 0x0019, 0x000d, 0x0009, 0xfff8, 0xfffc, 0x000c, 0x0018,
+	0x0012, 0x0001, 0xffef, 0xffff, 0x0009, 0x000f, 0x0009, 0x0007,
+	0xfffa, 0xfff5, 0xffef, 0x0009, 0x0004, 0x000b, 0x0007, 0x0001,
+	0xfff2, 0xfff2, 0x0004, 0x000e, 0x0008, 0x0002, 0x0003, 0x0003,
+	0x0007, 0x0011, 0x0011, 0x0009, 0xfff2, 0xfff8, 0x0004, 0x0004,
+	0x0002, 0xfff5, 0xffef, 0xfff6, 0xfffd, 0x0007, 0x0001, 0xffff,
+	0xffe8, 0xffae, 0xff91, 0xff86, 0xff89, 0xff98, 0xffa7, 0xffbd,
+	0xffc1, 0xffd4, 0xffdb, 0xffe7, 0xffe6, 0xffdb, 0xffde, 0xffea,
+	0x0002, 0x000e, 0x001e, 0x0007, 0x0005, 0x000d, 0x0016, 0x0029,
+	0x0024, 0x001e, 0x0010, 0x0008, 0x000d, 0x001b, 0x0018, 0x0022,
+	0x0022, 0x000f, 0x000b, 0x0003, 0x0014, 0x0016, 0x0015, 0x000e,
+	0x0002, 0xfffe, 0x000f, 0x0019, 0x001b, 0x000a, 0xfffb, 0x0002,
+	0x0008, 0x0014, 0x0015, 0x0017, 0x000a, 0x0003, 0xfff3, 0x0003,
+	0x0011, 0x0009, 0x0015, 0x000f, 0x0003, 0xfff8, 0xfffa, 0x000b,
+	0x000e, 0x000f, 0xfffe, 0xfff2, 0xfff2, 0x000e, 0x0016, 0x001a,
+	0x000c, 0xfff8, 0xfff3, 0xfff5, 0xfffe, 0x000f, 0x0006, 0x000a,
+	0xfff5, 0xfff7, 0xffee, 0xfff4, 0xfffb, 0xffff, 0xfff3, 0xffe4,
+	0xffeb, 0xfff3, 0x0010, 0x0001, 0x0001, 0xffe5, 0xffec, 0xfff4,
+	0xffff, 0x0000, 0x000d, 0x0008, 0xfffb, 0xffe8, 0xfff3, 0xfffc,
+	0x0001, 0x0004, 0xfff9, 0xfff5, 0xfff7, 0xfffe, 0x0003, 0x0007,
+	0xfff8, 0xffeb, 0xfff0, 0xffc6, 0xff97, 0xff8a, 0xff89, 0xff96,
+	0xffa5, 0xffc5, 0xffd0, 0xffd8, 0xffe3, 0xffe7, 0xffe8, 0xffe7,
+	0xffed, 0xfff9, 0x000c, 0x000b, 0x0000, 0x0002, 0x000c, 0x0018,
+	0x0017, 0x0022, 0x0016, 0x0009, 0x0015, 0x0018, 0x0025, 0x001e,
+	0x0015, 0x0015, 0x0006, 0x0017, 0x0017, 0x0017, 0x0024, 0x001a,
+	0x000a, 0xfff4, 0xfff9, 0x0001, 0x0013, 0x0012, 0x0010, 0x0000,
+	0x0003, 0x000a, 0x000b, 0x0010, 0x000e, 0xfff6, 0x0002, 0x0019,
+	0x0017, 0x0018, 0x000e, 0xfffe, 0xfffa, 0xfffa, 0x0015, 0x0011,
+	0x0005, 0xfffc, 0xfff4, 0x0006, 0x000e, 0x000c, 0x000d, 0xfffc,
+	0xfff4, 0x0001, 0x0000, 0x000c, 0x000b, 0x000a, 0xfff5, 0xfff5,
+	0xfff3, 0x0000, 0x000f, 0x0010, 0x0006, 0xfff0, 0xffe7, 0xfff2,
+	0xffff, 0x000d, 0x0012, 0x000b, 0xffff, 0xffed, 0xffea, 0x0005,
+	0x0009, 0x000e, 0xfff8, 0xfff6, 0xfff7, 0x000e, 0x000b, 0x000b,
+	0x0002, 0xffef, 0xffe9, 0xfffd, 0xfffa, 0x000e, 0x000a, 0x0006,
+	0xfffa, 0xffee, 0xfff2, 0xfffd, 0x0003, 0xffda, 0xff93, 0xff77,
+	0xff76, 0xff9e, 0xffb9, 0xffc9, 0xffcd, 0xffd4, 0xffcc, 0xffd6,
+	0xffd5, 0xffe8, 0xfff1, 0xfff4, 0xfff3, 0xffe6, 0xffec, 0xfff4,
+	0xffff, 0x000e, 0x0009, 0x0001, 0x0002, 0x000c, 0x0015, 0x0019,
+	0x000f, 0xfffd, 0x0005, 0x000a, 0x0016, 0x0018, 0x001f, 0x0018,
+	0x0019, 0x0006, 0xfff9, 0x0002, 0x0014, 0x0019, 0x001b, 0x001b,
+	0xfffc, 0x0002, 0xfff3, 0x0009, 0x000f, 0x0025, 0x001b, 0x0008,
+	0xffff, 0x0002, 0x000d, 0x000c, 0x001a, 0x0015, 0x0015, 0xfffa,
+	0x0003, 0x000c, 0x0011, 0x001b, 0x0011, 0x0002, 0xfff2, 0xfffe,
+	0x0008, 0x000a, 0x0014, 0x000d, 0x0000, 0xfff9, 0xfff0, 0x0002,
+	0x0005, 0x0011, 0x0027, 0x0017, 0xfffa, 0xffdd, 0xffea, 0x000e,
+	0x0009, 0xfff7, 0xfff1, 0xffe5, 0x0006, 0x0000, 0xfffc, 0x000d,
+	0x0001, 0xfffa, 0xffee, 0xffef, 0xfff9, 0x0005, 0x0012, 0x0010,
+	0x0000, 0xffef, 0xffee, 0x0005, 0x000b, 0x0009, 0xfffc, 0xfff4,
+	0x0001, 0x000b, 0x0006, 0x0006, 0xfffe, 0xfff4, 0xfff4, 0xffcf,
+	0xffa5, 0xff91, 0xff83, 0xff89, 0xff95, 0xffb1, 0xffc2, 0xffd9,
+	0xffeb, 0xffe8, 0xffe1, 0xffd0, 0xffea, 0xfff2, 0x000e, 0x0005,
+	0x0001, 0x0000, 0xfffa, 0xfffe, 0x0018, 0x0013, 0x0022, 0x001e,
+	0x000a, 0x0005, 0x000c, 0x0017, 0x0026, 0x0020, 0x0013, 0xffff,
+	0x000b, 0x001b, 0x0015, 0x0022, 0x001f, 0x000c, 0xfffd, 0x000c,
+	0x0009, 0x000f, 0x001a, 0x001e, 0x0010, 0x0006, 0x0008, 0x0015,
+	0x0018, 0x0017, 0x0016, 0x0001, 0x0001, 0xfffe, 0x0002, 0x0004,
+	0x0013, 0x0016, 0x000c, 0xfff0, 0xfff2, 0xfff5, 0x0002, 0x0006,
+	0xfffe, 0xffec, 0xffe8, 0xffee, 0xfff9, 0xffff, 0x0003, 0x000a,
+	0x0006, 0xfff7, 0xffec, 0xffeb, 0xfff9, 0xfffe, 0x0002, 0xffff,
+	0xffff, 0xfff4, 0xfff4, 0xfff7, 0x000c, 0x000a, 0x000e, 0x0007,
+	0xfff6, 0xffe7, 0xfff2, 0x0001, 0x0007, 0x0018, 0x0011, 0x0007,
+	0xfff9, 0xfff3, 0xfff9, 0x0007, 0x000a, 0x0003, 0xfffd, 0x0005,
+	0x000b, 0x000c, 0x000d, 0x0008, 0xfffb, 0xffea, 0xfff5, 0x0000,
+	0x000a, 0xffe4, 0xffa7, 0xff7f, 0xff72, 0xff89, 0xffae, 0xffc7,
+	0xffd1, 0xffd0, 0xffd3, 0xffd8, 0xffdf, 0xffe4, 0xfff8, 0xffef,
+	0xffe1, 0xffe0, 0x0001, 0x000b, 0x001a, 0x000e, 0xffff, 0x0002,
+	0x0009, 0x0014, 0x001b, 0x0025, 0x002b, 0x0022, 0x0016, 0x0004,
+	0x000b, 0x0021, 0x0024, 0x0021, 0x0025, 0x001d, 0x0014, 0x0007,
+	0xfffe, 0x0014, 0x0018, 0x0016, 0x0023, 0x000d, 0x0007, 0xfff6,
+	0x0000, 0x000e, 0x0009, 0x001b, 0x0014, 0x000a, 0xfff4, 0xfffc,
+	0x000f, 0x000d, 0x001b, 0x0006, 0xffff, 0xfff3, 0xfff7, 0xfffd,
+	0x000a, 0x0017, 0x0011, 0x0007, 0xffff, 0xfff7, 0x000a, 0x0009,
+	0x0010, 0xfffa, 0xfff7, 0xfff3, 0x000a, 0x0014, 0x000a, 0x0004,
+	0xfff8, 0xffeb, 0xfffb, 0x000a, 0x000d, 0x000a, 0x000e, 0x0001,
+	0x0000, 0xfff6, 0xfff9, 0x0002, 0x000c, 0x0005, 0xfff8, 0xfff5,
+	0xfff8, 0x000a, 0x0008, 0x0006, 0x000e, 0x0004, 0xffee, 0xfff0,
+	0xfff6, 0xfff3, 0xfff7, 0x000a, 0x0009, 0xfff2, 0xffd8, 0xffe8,
+	0xfff1, 0xfffd, 0x0003, 0xffe0, 0xff8c, 0xff68, 0xff59, 0xff8c,
+	0xffae, 0xffc1, 0xffc6, 0xffb7, 0xffb2, 0xffbf, 0xffda, 0xffe3,
+	0xfff2, 0xfff7, 0xfff1, 0xfff8, 0xfff1, 0x0009, 0x000b, 0x001b,
+	0x0012, 0x000f, 0x000a, 0x000c, 0x0013, 0x001d, 0x0022, 0x0027,
+	0x0017, 0x000e, 0x0009, 0x0010, 0x0020, 0x0024, 0x0029, 0x0030,
+	0x0015, 0x000a, 0x0007, 0x0011, 0x001e, 0x0021, 0x0012, 0x0009,
+	0x000d, 0x000d, 0x0019, 0x0014, 0x000d, 0xfffe, 0xfff5, 0xfffe,
+	0x0013, 0x0018, 0x0017, 0x0017, 0x0007, 0xfff2, 0xffef, 0xfff5,
+	0x0010, 0x0008, 0xfffd, 0xfff2, 0xfff4, 0xffff, 0x000c, 0x000c,
+	0x0007, 0xfff8, 0xfff2, 0xffff, 0x000b, 0x000b, 0x0019, 0x0016,
+	0x000b, 0xfff5, 0xfffb, 0x000e, 0x000b, 0x000c, 0xfffe, 0xfff2,
+	0xfff9, 0x0005, 0x000f, 0x0004, 0xffff, 0xfffc, 0xfff2, 0x0004,
+	0x0007, 0x0010, 0xfffe, 0xffef, 0xffe6, 0xffef, 0x0000, 0x000c,
+	0x0015, 0x0005, 0xffff, 0xffe6, 0xfff2, 0xfffa, 0x0000, 0x000e,
+	0x0002, 0xfffc, 0xfff3, 0xfff5, 0xfff4, 0xffe1, 0xffa8, 0xff88,
+	0xff77, 0xff7f, 0xff9d, 0xffbc, 0xffcf, 0xffd8, 0xffd2, 0xffd0,
+	0xffd8, 0xffeb, 0xfff6, 0xfffd, 0x0002, 0xfff4, 0xfffa, 0x000d,
+	0x000a, 0x000c, 0x000d, 0x0007, 0x0008, 0x0012, 0x0021, 0x0022,
+	0x0023, 0x001c, 0x000f, 0x000e, 0x000d, 0x0024, 0x0022, 0x0022,
+	0x0015, 0x0000, 0xfff4, 0xfffe, 0x000a, 0x000f, 0x0014, 0x001a,
+	0x0008, 0xfffd, 0x0006, 0x000a, 0x000e, 0x0009, 0x0001, 0xfff0,
+	0xfff9, 0x0006, 0x000d, 0x000b, 0x0004, 0xfff1, 0xffe9, 0xfff6,
+	0xfffd, 0x0008, 0x0013, 0x000d, 0xffff, 0xfff3, 0xfff6, 0x0006,
+	0x000d, 0x000b, 0x0002, 0xfff2, 0x0000, 0x000b, 0x0016, 0x0017,
+	0x000f, 0xfffb, 0xfff1, 0x0000, 0x000a, 0x0011, 0x0017, 0x0019,
+	0x0010, 0xfffa, 0xfff5, 0xfffe, 0x0003, 0x0009, 0x000e, 0x0008,
+	0xfff8, 0xfff3, 0xfffc, 0x0001, 0x0004, 0x0012, 0x0016, 0x000d,
+	0xfff8, 0xfff2, 0xfff7, 0xfffc, 0x0001, 0x0003, 0x000b, 0x0002,
+	0xffed, 0xffdf, 0xfff0, 0xfff3, 0xfffa, 0x0009, 0x000c, 0xffd6,
+	0xff91, 0xff74, 0xff76, 0xff95, 0xffb5, 0xffcb, 0xffbe, 0xffbb,
+	0xffc8, 0xffda, 0xffe1, 0xfff1, 0x0003, 0xfff5, 0xffe9, 0xffef,
+	0xfffa, 0x0005, 0x001b, 0x0014, 0x0017, 0x0009, 0x0005, 0x0011,
+	0x001c, 0x0023, 0x0021, 0x0012, 0xffff, 0x0006, 0x0016, 0x001e,
+	0x0025, 0x002c, 0x0014, 0xfffe, 0x0003, 0x000b, 0x0016, 0x0025,
+	0x0021, 0x0015, 0xffff, 0x0005, 0x000e, 0x0016, 0x001b, 0x0011,
+	0x000a, 0x0001, 0x0000, 0x000c, 0x000c, 0x000d, 0x001a, 0x000a,
+	0xfff5, 0xfff5, 0x0001, 0x001a, 0x0016, 0x0018, 0x0017, 0x0004,
+	0xfff6, 0xfff7, 0x0007, 0x000e, 0x0015, 0x0005, 0x0002, 0xfff5,
+	0xfff8, 0x0003, 0x0002, 0x001c, 0x000d, 0x0004, 0xfff0, 0xfff6,
+};
+
+const struct asset_source cnetz_ansage_clips[] = {
+	{ "cnetz/ansage", pattern, sizeof(pattern) / sizeof(pattern[0]), sizeof(pattern) / sizeof(pattern[0]) },
+	{ NULL, NULL, 0, 0 },
+};
@@ -0,0 +1,224 @@
+/* Create asset pack from tones and announcements
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* This tool is run during build. It writes the asset pack that is installed
+ * with the programs, or a C source file that embeds the asset pack.
+ *
+ * Clips are stored as PCM samples, so the programs play them from the mapped
+ * pack without decoding. With '-r', clips are coded lossless, which makes the
+ * pack smaller, but each program decodes the clips it uses at start.
+ *
+ * It is compiled for the build machine (CC_FOR_BUILD), so it only uses the
+ * codec from libmobile, which does not depend on anything else.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../libmobile/asset.h"
+#include "../libmobile/rice.h"
+#include "clips.h"
+
+static const struct asset_source *clip_lists[] = {
+	testton_clips,
+	usa_tones_clips,
+	usa_noanswer_clips,
+	usa_outoforder_clips,
+	usa_invalidnumber_clips,
+	usa_congestion_clips,
+	tacs_tones_clips,
+	tacs_outoforder_clips,
+	cnetz_ansage_clips,
+	nmt_announcement_clips,
+	NULL
+};
+
+static uint8_t *pack;
+static int pack_size;
+static int use_rice = 0;
+
+static void put_le32(uint8_t *p, uint32_t value)
+{
+	p[0] = value;
+	p[1] = value >> 8;
+	p[2] = value >> 16;
+	p[3] = value >> 24;
+}
+
+static void create_pack(void)
+{
+	const struct asset_source *clip;
+	uint8_t *entry;
+	int16_t *check;
+	int i, j, k, count = 0, size = 0, offset, length, codec, pcm_size = 0;
+
+	for (i = 0; clip_lists[i]; i++) {
+		for (j = 0; clip_lists[i][j].name; j++) {
+			clip = &clip_lists[i][j];
+			if (strlen(clip->name) >= ASSET_NAME_LEN) {
+				fprintf(stderr, "Asset name '%s' too long, please fix!\n", clip->name);
+				abort();
+			}
+			count++;
+			/* one byte to align samples */
+			size += RICE_MAX_BYTES(clip->size) + 1;
+		}
+	}
+
+	offset = ASSET_HEADER_SIZE + count * ASSET_ENTRY_SIZE;
+	pack = calloc(1, offset + size);
+	if (!pack) {
+		fprintf(stderr, "No memory!\n");
+		exit(1);
+	}
+	memcpy(pack, ASSET_MAGIC, 8);
+	put_le32(pack + 8, ASSET_VERSION);
+	put_le32(pack + 12, count);
+
+	entry = pack + ASSET_HEADER_SIZE;
+	for (i = 0; clip_lists[i]; i++) {
+		for (j = 0; clip_lists[i][j].name; j++) {
+			clip = &clip_lists[i][j];
+			/* samples are aligned, so they can be used from the pack */
+			offset = (offset + 1) & ~1;
+			length = clip->size * 2;
+			if (use_rice) {
+				length = rice_encode(clip->spl, clip->size, pack + offset);
+				/* the codec must be lossless */
+				check = malloc(clip->size * sizeof(*check));
+				if (!check) {
+					fprintf(stderr, "No memory!\n");
+					exit(1);
+				}
+				if (rice_decode(pack + offset, length, clip->size, check) < 0
+				 || memcmp(check, clip->spl, clip->size * sizeof(*check))) {
+					fprintf(stderr, "Asset '%s' does not decode to its samples, please fix!\n", clip->name);
+					abort();
+				}
+				free(check);
+			}
+			codec = ASSET_CODEC_RICE;
+			/* noise does not compress, store it as it is */
+			if (length >= clip->size * 2) {
+				for (k = 0; k < clip->size; k++) {
+					pack[offset + k * 2] = clip->spl[k];
+					pack[offset + k * 2 + 1] = clip->spl[k] >> 8;
+				}
+				length = clip->size * 2;
+				codec = ASSET_CODEC_PCM;
+			}
+			strcpy((char *)entry, clip->name);
+			put_le32(entry + 32, codec);
+			put_le32(entry + 36, clip->size);
+			put_le32(entry + 40, clip->max);
+			put_le32(entry + 44, offset);
+			put_le32(entry + 48, length);
+			entry += ASSET_ENTRY_SIZE;
+			offset += length;
+			pcm_size += clip->size * 2;
+		}
+	}
+	pack_size = offset;
+
+	fprintf(stderr, "%d clips, %d bytes of PCM samples, asset pack has %d bytes\n", count, pcm_size, pack_size);
+}
+
+static int write_pack(const char *filename)
+{
+	FILE *fp;
+
+	fp = fopen(filename, "w");
+	if (!fp) {
+		fprintf(stderr, "Failed to create '%s'\n", filename);
+		return -1;
+	}
+	if (fwrite(pack, pack_size, 1, fp) != 1) {
+		fprintf(stderr, "Failed to write '%s'\n", filename);
+		fclose(fp);
+		return -1;
+	}
+	fclose(fp);
+
+	return 0;
+}
+
+/* write C source that is linked into the programs */
+static int write_source(const char *filename)
+{
+	FILE *fp;
+	int i;
+
+	fp = fopen(filename, "w");
+	if (!fp) {
+		fprintf(stderr, "Failed to create '%s'\n", filename);
+		return -1;
+	}
+	fprintf(fp, "/* generated by mkassets, do not edit */\n\n");
+	fprintf(fp, "#include <stdint.h>\n\n");
+	fprintf(fp, "extern const uint8_t asset_embedded[];\n");
+	fprintf(fp, "extern const uint32_t asset_embedded_size;\n\n");
+	fprintf(fp, "const uint32_t asset_embedded_size = %d;\n\n", pack_size);
+	/* aligned, so that the samples can be used from the pack */
+	fprintf(fp, "const uint8_t asset_embedded[] __attribute__((aligned(4))) = {");
+	for (i = 0; i < pack_size; i++) {
+		if (!(i % 16))
+			fprintf(fp, "\n\t");
+		fprintf(fp, "0x%02x,", pack[i]);
+	}
+	fprintf(fp, "\n};\n");
+	if (fclose(fp)) {
+		fprintf(stderr, "Failed to write '%s'\n", filename);
+		return -1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	int rc = 0;
+
+	if (argc > 1 && !strcmp(argv[1], "-r")) {
+		use_rice = 1;
+		argc--;
+		argv++;
+	}
+	if (argc == 2)
+		rc = 0;
+	else if (argc == 3 && !strcmp(argv[1], "-c"))
+		rc = 1;
+	else {
+		fprintf(stderr, "Usage: %s [-r] [-c] <file>\n\n", argv[0]);
+		fprintf(stderr, "Write asset pack to file or write C source (-c) that embeds asset pack.\n");
+		fprintf(stderr, "Use lossless coding (-r) to get a smaller pack, that is decoded by the programs.\n");
+		return 1;
+	}
+
+	create_pack();
+
+	if (rc == 0)
+		rc = write_pack(argv[1]);
+	else
+		rc = write_source(argv[2]);
+	free(pack);
+
+	return (rc < 0) ? 1 : 0;
+}
+
@@ -1,7 +1,8 @@
+#include <stddef.h>
 #include <stdint.h>
-#include "tones.h"
+#include "clips.h"
 
-static int16_t pattern_ringback[] = {
+static const int16_t pattern_ringback[] = {
 	0x000b, 0x0008, 0x000d, 0x000e, 0x000d, 0x0012, 0x0011, 0xffcd,
 	0xffce, 0xffcd, 0xffcd, 0x0014, 0x000e, 0x0011, 0x000c, 0x000d,
 	0x000a, 0x0009, 0x0007, 0x0003, 0x0007, 0xfffe, 0x0005, 0xfffe,
@@ -5996,7 +5997,7 @@ static int16_t pattern_ringback[] = {
 	0xfffe, 0x0001, 0xfffc, 0x0002, 0xfffd, 0x0001, 0xffff, 0x0000,
 };
 
-static int16_t pattern_busy[] = {
+static const int16_t pattern_busy[] = {
 	0x0023, 0x0025, 0x0016, 0xfffc, 0xffdd, 0xffbe, 0xffb6, 0xffbe,
 	0xffdf, 0xfffa, 0x001a, 0x0026, 0x0025, 0x001d, 0x000b, 0x0004,
 	0x0001, 0x0002, 0x0008, 0x000a, 0x0007, 0x0003, 0xfffc, 0xfff7,
@@ -10558,7 +10559,7 @@ static int16_t pattern_busy[] = {
 	0x0002, 0xffff, 0xfffd, 0xfffa, 0xfffd, 0xfffd, 0x0003, 0x0000,
 };
 
-static int16_t pattern_hangup[] = {
+static const int16_t pattern_hangup[] = {
 	0x0dfa, 0x14c9, 0x1a20, 0x1d9e, 0x1e48, 0x1ba9, 0x15b4, 0x0d37,
 	0x0186, 0xf5eb, 0xebc2, 0xe436, 0xe0a8, 0xe0d2, 0xe480, 0xea7b,
 	0xf1fa, 0xf8ec, 0x012a, 0x08fe, 0x0fec, 0x1653, 0x1b22, 0x1ddf,
@@ -10682,38 +10683,9 @@ static int16_t pattern_hangup[] = {
 	0xe86b, 0xefe5, 0xf700, 0xff05, 0x06d9,
 };
 
-extern int16_t *ringback_spl;
-extern int ringback_size;
-extern int ringback_max;
-
-extern int16_t *busy_spl;
-extern int busy_size;
-extern int busy_max;
-
-extern int16_t *congestion_spl;
-extern int congestion_size;
-extern int congestion_max;
-
-extern int16_t *hangup_spl;
-extern int hangup_size;
-extern int hangup_max;
-
-void init_tones(void)
-{
-	ringback_spl = pattern_ringback;
-	ringback_size = sizeof(pattern_ringback) / sizeof(pattern_ringback[0]);
-	ringback_max = 8 * 3000;
-
-	busy_spl = pattern_busy;
-	busy_size = sizeof(pattern_busy) / sizeof(pattern_busy[0]);
-	busy_max = 8 * 750;
-
-	congestion_spl = pattern_busy;
-	congestion_size = sizeof(pattern_busy) / sizeof(pattern_busy[0]);
-	congestion_max = 8 * 750;
-
-	hangup_spl = pattern_hangup;
-	hangup_size = sizeof(pattern_hangup) / sizeof(pattern_hangup[0]);
-	hangup_max = hangup_size;
-}
-
+const struct asset_source tacs_tones_clips[] = {
+	{ "tacs/ringback", pattern_ringback, sizeof(pattern_ringback) / sizeof(pattern_ringback[0]), 8 * 3000 },
+	{ "tacs/busy", pattern_busy, sizeof(pattern_busy) / sizeof(pattern_busy[0]), 8 * 750 },
+	{ "tacs/hangup", pattern_hangup, sizeof(pattern_hangup) / sizeof(pattern_hangup[0]), sizeof(pattern_hangup) / sizeof(pattern_hangup[0]) },
+	{ NULL, NULL, 0, 0 },
+};
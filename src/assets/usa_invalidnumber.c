@@ -1,7 +1,8 @@
+#include <stddef.h>
 #include <stdint.h>
-#include "invalidnumber.h"
+#include "clips.h"
 
-static int16_t pattern[] = {
+static const int16_t pattern[] = {
 	0xfffe, 0x0001, 0xffff, 0x0001, 0xffff, 0x0002, 0xfffe, 0x0002,
 	0xfffd, 0x0002, 0xffff, 0xfffe, 0x0002, 0xfffc, 0x0003, 0xfffc,
 	0x0002, 0xfffe, 0x0003, 0xffff, 0x0001, 0xfffc, 0x0002, 0xfffd,
@@ -7209,15 +7210,7 @@ static int16_t pattern[] = {
 	0xfffc, 0x00c0, 0x005c, 0xff41, 0xff90, 0x0021, 0xff10, 0xff27,
 };
 
-extern int16_t *invalidnumber_spl;
-extern int invalidnumber_size;
-extern int invalidnumber_max;
-
-void init_invalidnumber(void)
-{
-	invalidnumber_spl = pattern;
-	invalidnumber_size = sizeof(pattern) / sizeof(pattern[0]);
-	invalidnumber_max = invalidnumber_size;
-}
-
-
+const struct asset_source usa_invalidnumber_clips[] = {
+	{ "usa/invalidnumber", pattern, sizeof(pattern) / sizeof(pattern[0]), sizeof(pattern) / sizeof(pattern[0]) },
+	{ NULL, NULL, 0, 0 },
+};
@@ -1,7 +1,8 @@
+#include <stddef.h>
 #include <stdint.h>
-#include "outoforder.h"
+#include "clips.h"
 
-static int16_t pattern[] = {
+static const int16_t pattern[] = {
 	0xfeae, 0xfde4, 0xfe26, 0xfea7, 0xfe94, 0xfe8a, 0xfeb4, 0xfe3b,
 	0xfe4f, 0xfe8b, 0xfdcb, 0xfe5e, 0xfea9, 0xfe8d, 0xfe12, 0xfdc9,
 	0xfdf0, 0xfdd5, 0xfde6, 0xfdde, 0xfddf, 0xfde5, 0xfdd3, 0xfe1d,
@@ -8169,15 +8170,7 @@ static int16_t pattern[] = {
 	0xfffe, 0xfffe, 0xffff, 0xfffe, 0x0001, 0xfffe, 0x0003, 0xfffe,
 };
 
-extern int16_t *outoforder_spl;
-extern int outoforder_size;
-extern int outoforder_max;
-
-void init_outoforder(void)
-{
-	outoforder_spl = pattern;
-	outoforder_size = sizeof(pattern) / sizeof(pattern[0]);
-	outoforder_max = outoforder_size;
-}
-
-
+const struct asset_source usa_outoforder_clips[] = {
+	{ "usa/outoforder", pattern, sizeof(pattern) / sizeof(pattern[0]), sizeof(pattern) / sizeof(pattern[0]) },
+	{ NULL, NULL, 0, 0 },
+};
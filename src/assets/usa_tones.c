@@ -1,7 +1,8 @@
+#include <stddef.h>
 #include <stdint.h>
-#include "tones.h"
+#include "clips.h"
 
-static int16_t pattern_ringback[] = {
+static const int16_t pattern_ringback[] = {
 	0x0070, 0x00dd, 0x013b, 0x0192, 0x0191, 0x0153, 0x0099, 0xffb2,
 	0xfe95, 0xfd60, 0xfc7f, 0xfbfe, 0xfbd5, 0xfc7e, 0xfdab, 0xff43,
 	0x0139, 0x0329, 0x04da, 0x05fc, 0x06a6, 0x0652, 0x04dd, 0x02ce,
@@ -1003,7 +1004,7 @@ static int16_t pattern_ringback[] = {
 	0x03d6, 0x03d6, 0x0327, 0x0256, 0x0153, 0x0043, 0xff75, 0xfeeb,
 };
 
-static int16_t pattern_busy[] = {
+static const int16_t pattern_busy[] = {
 	0x0006, 0x0004, 0x0008, 0x0002, 0x0008, 0x0006, 0x0004, 0x0007,
 	0x0003, 0x0049, 0x00f3, 0x01d5, 0x0277, 0x02a3, 0x01eb, 0x0079,
 	0xfe9c, 0xfc80, 0xfaf9, 0xfa5d, 0xfab6, 0xfc29, 0xfe85, 0x013c,
@@ -1507,7 +1508,7 @@ static int16_t pattern_busy[] = {
 	0x0137, 0xff93, 0xfe6b, 0xfdec, 0xfe2d, 0xfec3, 0xff88, 0x0002,
 };
 
-static int16_t pattern_hangup[] = {
+static const int16_t pattern_hangup[] = {
 	0x0004, 0x0006, 0x0007, 0x0002, 0x0009, 0x0003, 0x0008, 0x0004,
 	0x0006, 0x0046, 0x00f5, 0x01d3, 0x0279, 0x02a2, 0x01eb, 0x007a,
 	0xfe9b, 0xfc80, 0xfaf9, 0xfa5c, 0xfab8, 0xfc28, 0xfe85, 0x013c,
@@ -1761,31 +1762,9 @@ static int16_t pattern_hangup[] = {
 	0x0137, 0xff94, 0xfe6a, 0xfded, 0xfe2c, 0xfec3, 0xff89, 0x0001,
 };
 
-extern int16_t *ringback_spl;
-extern int ringback_size;
-extern int ringback_max;
-
-extern int16_t *busy_spl;
-extern int busy_size;
-extern int busy_max;
-
-extern int16_t *hangup_spl;
-extern int hangup_size;
-extern int hangup_max;
-
-void init_tones(void)
-{
-	ringback_spl = pattern_ringback;
-	ringback_size = sizeof(pattern_ringback) / sizeof(pattern_ringback[0]);
-	ringback_max = 8 * 5000;
-
-	busy_spl = pattern_busy;
-	busy_size = sizeof(pattern_busy) / sizeof(pattern_busy[0]);
-	busy_max = 8 * 1000;
-
-	hangup_spl = pattern_hangup;
-	hangup_size = sizeof(pattern_hangup) / sizeof(pattern_hangup[0]);
-	hangup_max = 8 * 500;
-}
-
-
+const struct asset_source usa_tones_clips[] = {
+	{ "usa/ringback", pattern_ringback, sizeof(pattern_ringback) / sizeof(pattern_ringback[0]), 8 * 5000 },
+	{ "usa/busy", pattern_busy, sizeof(pattern_busy) / sizeof(pattern_busy[0]), 8 * 1000 },
+	{ "usa/hangup", pattern_hangup, sizeof(pattern_hangup) / sizeof(pattern_hangup[0]), 8 * 500 },
+	{ NULL, NULL, 0, 0 },
+};
@@ -29,6 +29,7 @@
 #include "../libmobile/call.h"
 #include "../libmobile/cause.h"
 #include "../libmobile/get_time.h"
+#include "../libmobile/replay.h"
 #include <osmocom/cc/message.h>
 #include "bnetz.h"
 #include "telegramm.h"
@@ -226,6 +227,7 @@ error_paging:
 		LOGP(DBNETZ, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	bnetz->sender.destroy = bnetz_destroy;
 	bnetz->sender.ruffrequenz = bnetz_kanal2freq(19, 0);
 
 	/* init audio processing */
@@ -384,6 +386,7 @@ void bnetz_receive_tone(bnetz_t *bnetz, int bit)
 		LOGP_CHAN(DBNETZ, LOGL_DEBUG, "Received continuous %d Hz tone.\n", (bit)?1950:2070);
 	else
 		LOGP_CHAN(DBNETZ, LOGL_DEBUG, "Continuous tone is gone.\n");
+	replay_event(bnetz->sender.kanal, "tone %d", (bit < 0) ? 0 : ((bit) ? 1950 : 2070));
 
 	if (bnetz->sender.loopback) {
 		return;
@@ -443,6 +446,7 @@ void bnetz_receive_telegramm(bnetz_t *bnetz, uint16_t telegramm)
 	if (it) {
 		digit = it->digit;
 		LOGP(DBNETZ, (bnetz->sender.loopback) ? LOGL_NOTICE : LOGL_INFO, "Received telegramm '%s'\n", it->description);
+		replay_event(bnetz->sender.kanal, "telegramm 0x%04x (%s)", telegramm, it->description);
 	} else {
 		LOGP(DBNETZ, LOGL_DEBUG, "Received unknown telegramm digit '0x%04x' (might be radio noise)\n", telegramm);
 		return;
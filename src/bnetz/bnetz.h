@@ -3,6 +3,8 @@
 #include "../libmobile/sender.h"
 #include <osmocom/core/timer.h>
 
+#define RX_RING_SIZE		64	/* bits in ring of FSK demodulator */
+
 /* fsk modes of transmission */
 enum dsp_mode {
 	DSP_MODE_SILENCE,	/* sending silence */
@@ -90,10 +92,11 @@ typedef struct bnetz {
 	enum dsp_mode		dsp_mode;		/* current mode: audio, durable tone 0 or 1, "Telegramm" */
 	fsk_mod_t		fsk_mod;		/* fsk modem instance */
 	fsk_demod_t		fsk_demod;
-	uint16_t		rx_telegramm;		/* rx shift register for receiving telegramm */
-	double			rx_telegramm_quality[16];/* quality of each bit in telegramm */
-	double			rx_telegramm_level[16];	/* level of each bit in telegramm */
-	int			rx_telegramm_qualidx;	/* index of quality array above */
+	fsk_rx_ring_t		rx_ring;		/* received bits from FSK demodulator */
+	uint8_t			rx_ring_bits[RX_RING_SIZE / 8];
+	double			rx_ring_level[RX_RING_SIZE];
+	double			rx_ring_quality[RX_RING_SIZE];
+	uint16_t		rx_telegramm;		/* last 16 bits, for receiving telegramm */
 	uint16_t		rx_tone;		/* rx shift register for receiving continuous tone */
 	double			rx_tone_quality[16];	/* quality of tone fragment (100th of second) */
 	double			rx_tone_level[16];	/* level of tone fragment (100th of second) */
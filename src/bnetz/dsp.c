@@ -75,8 +75,8 @@ void dsp_init(void)
 		dsp_metering[i] = sin((double)i / 65536.0 * 2.0 * PI) * TX_PEAK_METER;
 }
 
-static int fsk_send_bit(void *inst);
-static void fsk_receive_bit(void *inst, int bit, double quality, double level);
+static int fsk_send_bits(void *inst, uint8_t *bits, int max);
+static void fsk_receive_bits(void *inst, fsk_rx_ring_t *ring, int pos, int num);
 
 /* Init transceiver instance. */
 int dsp_init_sender(bnetz_t *bnetz, double squelch_db)
@@ -97,14 +97,20 @@ int dsp_init_sender(bnetz_t *bnetz, double squelch_db)
 	LOGP(DDSP, LOGL_DEBUG, "Using FSK level of %.3f (%.3f KHz deviation @ 2000 Hz)\n", TX_PEAK_FSK, 4.0);
 
 	/* init fsk */
-	if (fsk_mod_init(&bnetz->fsk_mod, bnetz, fsk_send_bit, bnetz->sender.samplerate, BIT_RATE, F0, F1, TX_PEAK_FSK, 0, 0) < 0) {
+	if (fsk_mod_init(&bnetz->fsk_mod, bnetz, NULL, bnetz->sender.samplerate, BIT_RATE, F0, F1, TX_PEAK_FSK, 0, 0) < 0) {
 		LOGP_CHAN(DDSP, LOGL_ERROR, "FSK init failed!\n");
 		return -EINVAL;
 	}
-	if (fsk_demod_init(&bnetz->fsk_demod, bnetz, fsk_receive_bit, bnetz->sender.samplerate, BIT_RATE, F0, F1, BIT_ADJUST) < 0) {
+	fsk_mod_set_send_bits(&bnetz->fsk_mod, fsk_send_bits);
+	if (fsk_demod_init(&bnetz->fsk_demod, bnetz, NULL, bnetz->sender.samplerate, BIT_RATE, F0, F1, BIT_ADJUST) < 0) {
 		LOGP_CHAN(DDSP, LOGL_ERROR, "FSK init failed!\n");
 		return -EINVAL;
 	}
+	bnetz->rx_ring.bits = bnetz->rx_ring_bits;
+	bnetz->rx_ring.level = bnetz->rx_ring_level;
+	bnetz->rx_ring.quality = bnetz->rx_ring_quality;
+	bnetz->rx_ring.size = RX_RING_SIZE;
+	fsk_demod_set_receive_bits(&bnetz->fsk_demod, fsk_receive_bits, &bnetz->rx_ring);
 
 	bnetz->tone_detected = -1;
 
@@ -165,11 +171,10 @@ static void fsk_receive_tone(bnetz_t *bnetz, int tone, int goodtone, double leve
 	}
 }
 
-/* Collect 16 data bits (digit) and check for sync mark '01110'. */
-static void fsk_receive_bit(void *inst, int bit, double quality, double level)
+/* Check each bit (100th of second) for continuous tone. */
+static void receive_tone(bnetz_t *bnetz, int bit, double quality, double level)
 {
 	double level_avg, level_stddev, quality_avg;
-	bnetz_t *bnetz = (bnetz_t *)inst;
 	int i, j;
 
 	/* normalize FSK level */
@@ -217,39 +222,32 @@ static void fsk_receive_bit(void *inst, int bit, double quality, double level)
 		fsk_receive_tone(bnetz, bit, 0, level_avg, level_stddev, quality_avg);
 	else
 		fsk_receive_tone(bnetz, bit, 1, level_avg, level_stddev, quality_avg);
+}
 
-	/* store level and quality to telegram buffer */
-	bnetz->rx_telegramm_quality[bnetz->rx_telegramm_qualidx] = quality;
-	bnetz->rx_telegramm_level[bnetz->rx_telegramm_qualidx] = level;
-	if (++bnetz->rx_telegramm_qualidx == 16)
-		bnetz->rx_telegramm_qualidx = 0;
+/* Check level of the 16 bits of a telegramm that ends at given position. */
+static void receive_telegramm(bnetz_t *bnetz, fsk_rx_ring_t *ring, int end, uint16_t telegramm)
+{
+	double level, level_avg, level_stddev, quality_avg;
+	int i, j, p;
 
 	/* average level and quality of frame */
 	level_avg = level_stddev = quality_avg = 0;
-	for (i = 0; i < 16; i++) {
-		level_avg += bnetz->rx_telegramm_level[i];
-		quality_avg += bnetz->rx_telegramm_quality[i];
+	for (i = 0, j = 0; i < 16; i++) {
+		p = fsk_rx_ring_pos(ring, end, -i);
+		level = ring->level[p] / TX_PEAK_FSK;
+		level_avg += level;
+		quality_avg += ring->quality[p];
+		/* collect bits, and check for level */
+		if (level >= TONE_LEVEL_TH)
+			j++;
 	}
 	level_avg /= 16.0; quality_avg /= 16.0;
 	for (i = 0; i < 16; i++) {
-		level = bnetz->rx_telegramm_level[i];
+		level = ring->level[fsk_rx_ring_pos(ring, end, -i)] / TX_PEAK_FSK;
 		level_stddev += (level - level_avg) * (level - level_avg);
 	}
 	level_stddev = sqrt(level_stddev / 16.0);
 
-	/* collect bits */
-	bnetz->rx_telegramm = (bnetz->rx_telegramm << 1) | bit;
-
-	/* check if pattern 01110xxxxxxxxxxx matches */
-	if ((bnetz->rx_telegramm & 0xf800) != 0x7000)
-		return;
-
-	/* collect bits, and check for level */
-	for (i = 0, j = 0; i < 16; i++) {
-		if (bnetz->rx_telegramm_level[i] >= TONE_LEVEL_TH)
-			j++;
-	}
-
 	LOGP_CHAN(DDSP, LOGL_DEBUG, "FSK  Valid bits: %d/%d Level: %.0f%% (threshold %.0f%%)  Stddev: %.0f%% (threshold %.0f%%)\n", j, 16, level_avg * 100.0, TONE_LEVEL_TH * 100.0, level_stddev / level_avg * 100.0, TONE_STDDEV_TH * 100.0);
 
         /* drop any telegramm that is too bad */
@@ -264,7 +262,40 @@ static void fsk_receive_bit(void *inst, int bit, double quality, double level)
 	LOGP_CHAN(DDSP, LOGL_INFO, "Telegramm RX Level: average=%.0f%% (threshold %.0f%%) standard deviation=%.0f%% (threshold %.0f%%) Quality: %.0f%%\n", level_avg * 100.0, TONE_LEVEL_TH * 100.0, level_stddev / level_avg * 100.0, TONE_STDDEV_TH * 100.0, quality_avg * 100.0);
 
 	/* receive telegramm */
-	bnetz_receive_telegramm(bnetz, bnetz->rx_telegramm);
+	bnetz_receive_telegramm(bnetz, telegramm);
+}
+
+/* Check each bit for continuous tone, collect 16 data bits (digit) and check
+ * for sync mark '01110'. The bits are shifted into the telegramm register up
+ * to 16 bits at a time. Each position is compared with the sync mark, level
+ * and quality of the telegramm are only looked at when the sync mark matches.
+ */
+static void fsk_receive_bits(void *inst, fsk_rx_ring_t *ring, int pos, int num)
+{
+	bnetz_t *bnetz = (bnetz_t *)inst;
+	uint32_t window;
+	int n, chunk, shift, done, p;
+
+	for (n = 0; n < num; n += chunk) {
+		chunk = num - n;
+		if (chunk > 16)
+			chunk = 16;
+		window = ((uint32_t)bnetz->rx_telegramm << chunk) | fsk_rx_ring_word(ring, fsk_rx_ring_pos(ring, pos, n), chunk);
+		done = 0;
+		for (shift = chunk - 1; shift >= -1; shift--) {
+			/* check if pattern 01110xxxxxxxxxxx matches, shift -1 processes the rest */
+			if (shift >= 0 && ((window >> shift) & 0xf800) != 0x7000)
+				continue;
+			/* tone detection of all bits up to the end of the telegramm */
+			for (; done < chunk - shift - (shift < 0); done++) {
+				p = fsk_rx_ring_pos(ring, pos, n + done);
+				receive_tone(bnetz, (ring->bits[p >> 3] >> (7 - (p & 7))) & 1, ring->quality[p], ring->level[p]);
+			}
+			if (shift >= 0)
+				receive_telegramm(bnetz, ring, fsk_rx_ring_pos(ring, pos, n + done - 1), window >> shift);
+		}
+		bnetz->rx_telegramm = window;
+	}
 }
 
 /* Process received audio stream from radio unit. */
@@ -309,9 +340,12 @@ void sender_receive(sender_t *sender, sample_t *samples, int length, double rf_l
 		bnetz->sender.rxbuf_pos = 0;
 }
 
-static int fsk_send_bit(void *inst)
+/* provide the rest of the current 'Telegramm' as packed bits
+ * the next 'Telegramm' is requested when its first bit is needed */
+static int fsk_send_bits(void *inst, uint8_t *bits, int max)
 {
 	bnetz_t *bnetz = (bnetz_t *)inst;
+	int count = 0;
 
 	/* send frame bit (prio) */
 	switch (bnetz->dsp_mode) {
@@ -326,11 +360,19 @@ static int fsk_send_bit(void *inst)
 			bnetz->tx_telegramm_pos = 0;
 		}
 
-		return bnetz->tx_telegramm[bnetz->tx_telegramm_pos++];
+		memset(bits, 0, (max + 7) / 8);
+		while (count < max && bnetz->tx_telegramm_pos < 16) {
+			bits[count >> 3] |= (bnetz->tx_telegramm[bnetz->tx_telegramm_pos++] & 1) << (7 - (count & 7));
+			count++;
+		}
+		return count;
+	/* single bits, so that a change of mode applies to the next bit */
 	case DSP_MODE_0:
-		return 0; /* F0 */
+		bits[0] = 0x00; /* F0 */
+		return 1;
 	case DSP_MODE_1:
-		return 1; /* F1 */
+		bits[0] = 0x80; /* F1 */
+		return 1;
 	default:
 		return -1; // should never happen
 	}
@@ -363,6 +363,7 @@ int cnetz_create(const char *kanal_name, enum cnetz_chan_type chan_type, const c
 		LOGP(DCNETZ, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	cnetz->sender.destroy = cnetz_destroy;
 
 #if 0
 	#warning hacking: applying different clock to slave
@@ -639,7 +640,7 @@ int call_down_setup(int callref, const char __attribute__((unused)) *caller_id,
 		LOGP(DCNETZ, LOGL_ERROR, "Failed to create transaction\n");
 		return -CAUSE_TEMPFAIL;
 	}
-	trans->callref = callref;
+	trans_set_callref(trans, callref);
 	trans->try = 1;
 
 	return 0;
@@ -647,22 +648,17 @@ int call_down_setup(int callref, const char __attribute__((unused)) *caller_id,
 
 void call_down_answer(int callref, struct timeval *tv_meter)
 {
-	sender_t *sender;
 	cnetz_t *cnetz;
 	transaction_t *trans;
 
 	LOGP(DCNETZ, LOGL_INFO, "Call has been answered by network.\n");
 
-	for (sender = sender_head; sender; sender = sender->next) {
-		cnetz = (cnetz_t *) sender;
-		trans = search_transaction_callref(cnetz, callref);
-		if (trans)
-			break;
-	}
-	if (!sender) {
+	trans = search_transaction_callref_global(callref);
+	if (!trans) {
 		LOGP(DCNETZ, LOGL_NOTICE, "Incoming answer, but no callref!\n");
 		return;
 	}
+	cnetz = trans->cnetz;
 
 	/* At least tone second! */
 	if (tv_meter->tv_sec) {
@@ -682,24 +678,19 @@ void call_down_answer(int callref, struct timeval *tv_meter)
  */
 void call_down_disconnect(int callref, int cause)
 {
-	sender_t *sender;
 	cnetz_t *cnetz;
 	transaction_t *trans;
 
 	LOGP(DCNETZ, LOGL_INFO, "Call has been disconnected by network.\n");
 
-	for (sender = sender_head; sender; sender = sender->next) {
-		cnetz = (cnetz_t *) sender;
-		/* search transaction for this callref */
-		trans = search_transaction_callref(cnetz, callref);
-		if (trans)
-			break;
-	}
-	if (!sender) {
+	/* search transaction for this callref */
+	trans = search_transaction_callref_global(callref);
+	if (!trans) {
 		LOGP(DCNETZ, LOGL_NOTICE, "Outgoing disconnect, but no callref!\n");
 		call_up_release(callref, CAUSE_INVALCALLREF);
 		return;
 	}
+	cnetz = trans->cnetz;
 
 	/* Release when not active */
 
@@ -712,12 +703,12 @@ void call_down_disconnect(int callref, int cause)
 		LOGP(DCNETZ, LOGL_INFO, "Call control disconnects on speech channel, releasing towards mobile station.\n");
 		cnetz_release(trans, cnetz_cause_isdn2cnetz(cause));
 		call_up_release(callref, cause);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 		break;
 	default:
 		LOGP(DCNETZ, LOGL_INFO, "Call control disconnects on organisation channel, removing transaction.\n");
 		call_up_release(callref, cause);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 		if (trans->state == TRANS_MT_QUEUE || trans->state == TRANS_MT_DELAY) {
 			cnetz_release(trans, cnetz_cause_isdn2cnetz(cause));
 		} else {
@@ -731,26 +722,21 @@ void call_down_disconnect(int callref, int cause)
 /* Call control releases call toward mobile station. */
 void call_down_release(int callref, int cause)
 {
-	sender_t *sender;
 	cnetz_t *cnetz;
 	transaction_t *trans;
 
 	LOGP(DCNETZ, LOGL_INFO, "Call has been released by network, releasing call.\n");
 
-	for (sender = sender_head; sender; sender = sender->next) {
-		cnetz = (cnetz_t *) sender;
-		/* search transaction for this callref */
-		trans = search_transaction_callref(cnetz, callref);
-		if (trans)
-			break;
-	}
-	if (!sender) {
+	/* search transaction for this callref */
+	trans = search_transaction_callref_global(callref);
+	if (!trans) {
 		LOGP(DCNETZ, LOGL_NOTICE, "Outgoing release, but no callref!\n");
 		/* don't send release, because caller already released */
 		return;
 	}
+	cnetz = trans->cnetz;
 
-	trans->callref = 0;
+	trans_set_callref(trans, 0);
 
 	switch (cnetz->dsp_mode) {
 	case DSP_MODE_SPK_K:
@@ -855,7 +841,7 @@ void transaction_timeout(void *data)
 	case TRANS_MT_QUEUE:
 		LOGP_CHAN(DCNETZ, LOGL_NOTICE, "Phone in queue, but still no channel available, releasing call!\n");
 		call_up_release(trans->callref, CAUSE_NOCHANNEL);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 		cnetz_release(trans, CNETZ_CAUSE_GASSENBESETZT);
 		break;
 	case TRANS_MO_QUEUE:
@@ -877,7 +863,7 @@ void transaction_timeout(void *data)
 		LOGP_CHAN(DCNETZ, LOGL_NOTICE, "No response after sending random number 'Zufallszahl'\n");
 		if (trans->callref) {
 			call_up_release(trans->callref, CAUSE_TEMPFAIL);
-			trans->callref = 0;
+			trans_set_callref(trans, 0);
 		}
 		cnetz_release(trans, CNETZ_CAUSE_FUNKTECHNISCH);
 		break;
@@ -885,7 +871,7 @@ void transaction_timeout(void *data)
 		LOGP_CHAN(DCNETZ, LOGL_NOTICE, "No response after waiting for challenge response 'Autorisierungsparameter'\n");
 		if (trans->callref) {
 			call_up_release(trans->callref, CAUSE_TEMPFAIL);
-			trans->callref = 0;
+			trans_set_callref(trans, 0);
 		}
 		cnetz_release(trans, CNETZ_CAUSE_FUNKTECHNISCH);
 		break;
@@ -897,26 +883,26 @@ void transaction_timeout(void *data)
 			LOGP_CHAN(DCNETZ, LOGL_NOTICE, "Lost signal from 'FuTln' (mobile station)\n");
 		if (trans->callref) {
 			call_up_release(trans->callref, CAUSE_TEMPFAIL);
-			trans->callref = 0;
+			trans_set_callref(trans, 0);
 		}
 		cnetz_release(trans, CNETZ_CAUSE_FUNKTECHNISCH);
 		break;
 	case TRANS_DS:
 		LOGP_CHAN(DCNETZ, LOGL_NOTICE, "No response after connect 'Durchschalten'\n");
 		call_up_release(trans->callref, CAUSE_TEMPFAIL);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 		cnetz_release(trans, CNETZ_CAUSE_FUNKTECHNISCH);
 		break;
 	case TRANS_RTA:
 		LOGP_CHAN(DCNETZ, LOGL_NOTICE, "No response after ringing order 'Rufton anschalten'\n");
 		call_up_release(trans->callref, CAUSE_TEMPFAIL);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 		cnetz_release(trans, CNETZ_CAUSE_FUNKTECHNISCH);
 		break;
 	case TRANS_AHQ:
 		LOGP_CHAN(DCNETZ, LOGL_NOTICE, "No response after answer 'Abhebequittung'\n");
 		call_up_release(trans->callref, CAUSE_TEMPFAIL);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 		cnetz_release(trans, CNETZ_CAUSE_FUNKTECHNISCH);
 		break;
 	default:
@@ -1407,7 +1393,7 @@ no_auth:
 		if (!cnetz->sender.loopback && (cnetz->sched_ts & 7) == 7 && cnetz->sched_r_m && !osmo_timer_pending(&trans->timer)) {
 			/* next sub frame */
 			if (trans->mo_call) {
-				trans->callref = call_up_setup(transaction2rufnummer(trans), trans->dialing, OSMO_CC_NETWORK_CNETZ_NONE, "");
+				trans_set_callref(trans, call_up_setup(transaction2rufnummer(trans), trans->dialing, OSMO_CC_NETWORK_CNETZ_NONE, ""));
 				trans_new_state(trans, TRANS_DS);
 				trans->repeat = 0;
 				osmo_timer_schedule(&trans->timer, FLOAT_TO_TIMEOUT(0.0375 * F_DS)); /* F_DS frames */
@@ -1579,7 +1565,7 @@ void cnetz_receive_telegramm_spk_k(cnetz_t *cnetz, telegramm_t *telegramm)
 			LOGP_CHAN(DCNETZ, LOGL_NOTICE, "Received challenge response (0x%016" PRIx64 ") does not match the expected one (0x%016" PRIx64 "), releasing!\n", telegramm->authorisierungsparameter, cnetz->response);
 			if (trans->callref) {
 				call_up_release(trans->callref, CAUSE_TEMPFAIL); /* jolly guesses that */
-				trans->callref = 0;
+				trans_set_callref(trans, 0);
 			}
 			cnetz_release(trans, CNETZ_CAUSE_GASSENBESETZT); /* when authentication is not valid */
 			break;
@@ -1651,7 +1637,7 @@ void cnetz_receive_telegramm_spk_k(cnetz_t *cnetz, telegramm_t *telegramm)
 		osmo_timer_del(&trans->timer);
 		if (trans->callref) {
 			call_up_release(trans->callref, CAUSE_NORMAL);
-			trans->callref = 0;
+			trans_set_callref(trans, 0);
 		}
 		break;
 	default:
@@ -1790,7 +1776,7 @@ void cnetz_receive_telegramm_spk_v(cnetz_t *cnetz, telegramm_t *telegramm)
 		osmo_timer_del(&trans->timer);
 		if (trans->callref) {
 			call_up_release(trans->callref, CAUSE_NORMAL);
-			trans->callref = 0;
+			trans_set_callref(trans, 0);
 		}
 		break;
 	default:
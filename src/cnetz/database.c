@@ -21,9 +21,12 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <errno.h>
 #include "../libsample/sample.h"
 #include "../liblogging/logging.h"
 #include "../libmobile/get_time.h"
+#include "../libmobile/timer_wheel.h"
 #include "cnetz.h"
 #include "database.h"
 #include "sysinfo.h"
@@ -34,9 +37,16 @@
  */
 #define MELDE_WIEDERHOLUNG	60.0 /* when busy */
 
+/* subscribers are found via hash table, the list keeps the order of registration */
+#define DB_HASH_SIZE		4096
+
+/* compact the snapshot file, if it has many more records than subscribers */
+#define SNAPSHOT_COMPACT	1024
+
 typedef struct cnetz_database {
 
-	struct cnetz_database	*next;
+	struct cnetz_database	*next, *prev;
+	struct cnetz_database	*hash_next;
 	int			ogk_kanal;	/* available on which channel */
 	uint8_t			futln_nat;	/* who ... */
 	uint8_t			futln_fuvst;
@@ -46,11 +56,18 @@ typedef struct cnetz_database {
 	int			eingebucht;	/* set if still available */
 	double			last_seen;
 	int			busy;		/* set if currently in a call */
-	struct osmo_timer_list		timer;		/* timer for next availability check */
+	wheel_timer_t		timer;		/* timer for next availability check */
 	int			retry;		/* counts number of retries */
 } cnetz_db_t;
 
 cnetz_db_t *cnetz_db_head;
+static cnetz_db_t *cnetz_db_tail;
+static cnetz_db_t *db_hash[DB_HASH_SIZE];
+
+static const char *snapshot_file;
+static FILE *snapshot_fp;
+static int snapshot_records;
+static int db_count;
 
 static const char *print_meldeaufrufe(int versuche)
 {
@@ -63,24 +80,162 @@ static const char *print_meldeaufrufe(int versuche)
 	return text;
 }
 
+static inline uint32_t db_hash_key(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest)
+{
+	uint32_t key = ((uint32_t)futln_nat << 24) | ((uint32_t)futln_fuvst << 16) | futln_rest;
+
+	return (key * 2654435761u) >> 20; /* 12 bits for DB_HASH_SIZE */
+}
+
+static cnetz_db_t *search_db(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest)
+{
+	cnetz_db_t *db;
+
+	db = db_hash[db_hash_key(futln_nat, futln_fuvst, futln_rest)];
+	while (db) {
+		if (db->futln_nat == futln_nat
+		 && db->futln_fuvst == futln_fuvst
+		 && db->futln_rest == futln_rest)
+			break;
+		db = db->hash_next;
+	}
+
+	return db;
+}
+
+static void db_timeout(void *data);
+
+/*
+ * snapshot file
+ *
+ * Every change of an attached subscriber is appended as a line to the file,
+ * so the database survives a restart or crash. An incomplete last line is
+ * ignored when loading. The file is rewritten after loading and whenever it
+ * holds too many outdated records. The new file is renamed over the old
+ * one, so there is always a complete file on disk.
+ */
+
+static void snapshot_record(cnetz_db_t *db)
+{
+	if (!snapshot_fp)
+		return;
+
+	if (db->eingebucht)
+		fprintf(snapshot_fp, "+ %d,%d,%05d %d %d %d\n", db->futln_nat, db->futln_fuvst, db->futln_rest, db->ogk_kanal, db->futelg_bit, db->extended);
+	else
+		fprintf(snapshot_fp, "- %d,%d,%05d\n", db->futln_nat, db->futln_fuvst, db->futln_rest);
+	fflush(snapshot_fp);
+	snapshot_records++;
+}
+
+static void snapshot_write(void)
+{
+	char tmp_file[256];
+	cnetz_db_t *db;
+	FILE *fp;
+
+	if (snapshot_fp) {
+		fclose(snapshot_fp);
+		snapshot_fp = NULL;
+	}
+
+	snprintf(tmp_file, sizeof(tmp_file), "%s.tmp", snapshot_file);
+	fp = fopen(tmp_file, "w");
+	if (!fp) {
+		LOGP(DDB, LOGL_ERROR, "Failed to write subscriber snapshot '%s'.\n", tmp_file);
+		return;
+	}
+	snapshot_fp = fp;
+	snapshot_records = 0;
+	for (db = cnetz_db_head; db; db = db->next) {
+		if (db->eingebucht)
+			snapshot_record(db);
+	}
+	fsync(fileno(fp));
+	fclose(fp);
+	snapshot_fp = NULL;
+	if (rename(tmp_file, snapshot_file) < 0) {
+		LOGP(DDB, LOGL_ERROR, "Failed to rename subscriber snapshot '%s'.\n", tmp_file);
+		return;
+	}
+
+	snapshot_fp = fopen(snapshot_file, "a");
+	if (!snapshot_fp)
+		LOGP(DDB, LOGL_ERROR, "Failed to open subscriber snapshot '%s'.\n", snapshot_file);
+}
+
+static void snapshot_update(cnetz_db_t *db)
+{
+	snapshot_record(db);
+	if (snapshot_records > db_count * 4 + SNAPSHOT_COMPACT)
+		snapshot_write();
+}
+
+/*
+ * database
+ */
+
+static cnetz_db_t *create_db(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest)
+{
+	cnetz_db_t *db, **hashp;
+
+	db = calloc(1, sizeof(*db));
+	if (!db) {
+		LOGP(DDB, LOGL_ERROR, "No memory!\n");
+		return NULL;
+	}
+
+	db->eingebucht = 1;
+	db->futln_nat = futln_nat;
+	db->futln_fuvst = futln_fuvst;
+	db->futln_rest = futln_rest;
+	wheel_timer_setup(&db->timer, db_timeout, db);
+
+	/* attach to end of list */
+	db->prev = cnetz_db_tail;
+	if (cnetz_db_tail)
+		cnetz_db_tail->next = db;
+	else
+		cnetz_db_head = db;
+	cnetz_db_tail = db;
+
+	/* attach to hash */
+	hashp = &db_hash[db_hash_key(futln_nat, futln_fuvst, futln_rest)];
+	db->hash_next = *hashp;
+	*hashp = db;
+
+	db_count++;
+
+	return db;
+}
+
 /* destroy transaction */
 static void remove_db(cnetz_db_t *db)
 {
-	cnetz_db_t **dbp;
+	cnetz_db_t **hashp;
 
 	/* uinlink */
-	dbp = &cnetz_db_head;
-	while (*dbp && *dbp != db)
-		dbp = &((*dbp)->next);
-	if (!(*dbp)) {
+	hashp = &db_hash[db_hash_key(db->futln_nat, db->futln_fuvst, db->futln_rest)];
+	while (*hashp && *hashp != db)
+		hashp = &((*hashp)->hash_next);
+	if (!(*hashp)) {
 		LOGP(DDB, LOGL_ERROR, "Subscriber not in list, please fix!!\n");
 		abort();
 	}
-	*dbp = db->next;
+	*hashp = db->hash_next;
+	if (db->prev)
+		db->prev->next = db->next;
+	else
+		cnetz_db_head = db->next;
+	if (db->next)
+		db->next->prev = db->prev;
+	else
+		cnetz_db_tail = db->prev;
+	db_count--;
 
 	LOGP(DDB, LOGL_INFO, "Removing subscriber '%d,%d,%05d' from database.\n", db->futln_nat, db->futln_fuvst, db->futln_rest);
 
-	osmo_timer_del(&db->timer);
+	wheel_timer_del(&db->timer);
 
 	free(db);
 }
@@ -99,7 +254,7 @@ static void db_timeout(void *data)
 		 * network. We just assume that the phone has responded and
 		 * assume we had a response. */
 		LOGP(DDB, LOGL_INFO, "OgK busy, so we assume a positive response.\n");
-		osmo_timer_schedule(&db->timer, si.meldeinterval,0); /* when to check avaiability again */
+		wheel_timer_schedule(&db->timer, si.meldeinterval,0); /* when to check avaiability again */
 		db->retry = 0;
 	}
 }
@@ -107,38 +262,23 @@ static void db_timeout(void *data)
 /* create/update db entry */
 int update_db(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest, int ogk_kanal, int *futelg_bit, int *extended, int busy, int failed)
 {
-	cnetz_db_t *db, **dbp;
+	cnetz_db_t *db;
+	int was_eingebucht, old_ogk_kanal, old_futelg_bit, old_extended;
 
 	/* search transaction for this subscriber */
-	db = cnetz_db_head;
-	while (db) {
-		if (db->futln_nat == futln_nat
-		 && db->futln_fuvst == futln_fuvst
-		 && db->futln_rest == futln_rest)
-			break;
-		db = db->next;
-	}
+	db = search_db(futln_nat, futln_fuvst, futln_rest);
 	if (!db) {
-		db = calloc(1, sizeof(*db));
-		if (!db) {
-			LOGP(DDB, LOGL_ERROR, "No memory!\n");
+		db = create_db(futln_nat, futln_fuvst, futln_rest);
+		if (!db)
 			return 0;
-		}
-		osmo_timer_setup(&db->timer, db_timeout, db);
-
-		db->eingebucht = 1;
-		db->futln_nat = futln_nat;
-		db->futln_fuvst = futln_fuvst;
-		db->futln_rest = futln_rest;
-
-		/* attach to end of list */
-		dbp = &cnetz_db_head;
-		while (*dbp)
-			dbp = &((*dbp)->next);
-		*dbp = db;
+		was_eingebucht = 0;
 
 		LOGP(DDB, LOGL_INFO, "Adding subscriber '%d,%d,%05d' to database.\n", db->futln_nat, db->futln_fuvst, db->futln_rest);
-	}
+	} else
+		was_eingebucht = db->eingebucht;
+	old_ogk_kanal = db->ogk_kanal;
+	old_futelg_bit = db->futelg_bit;
+	old_extended = db->extended;
 
 	if (ogk_kanal)
 		db->ogk_kanal = ogk_kanal;
@@ -152,10 +292,10 @@ int update_db(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest, int o
 	db->busy = busy;
 	if (busy) {
 		LOGP(DDB, LOGL_INFO, "Subscriber '%d,%d,%05d' on OGK channel #%d is busy now.\n", db->futln_nat, db->futln_fuvst, db->futln_rest, db->ogk_kanal);
-		osmo_timer_del(&db->timer);
+		wheel_timer_del(&db->timer);
 	} else if (!failed) {
 		LOGP(DDB, LOGL_INFO, "Subscriber '%d,%d,%05d' on OGK channel #%d is idle now.\n", db->futln_nat, db->futln_fuvst, db->futln_rest, db->ogk_kanal);
-		osmo_timer_schedule(&db->timer, si.meldeinterval,0); /* when to check avaiability (again) */
+		wheel_timer_schedule(&db->timer, si.meldeinterval,0); /* when to check avaiability (again) */
 		db->retry = 0;
 		db->eingebucht = 1;
 		db->last_seen = get_time();
@@ -165,11 +305,16 @@ int update_db(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest, int o
 		if (si.meldeaufrufe && db->retry == si.meldeaufrufe) {
 			LOGP(DDB, LOGL_INFO, "Marking subscriber as gone.\n");
 			db->eingebucht = 0;
+			snapshot_update(db);
 			return db->extended;
 		}
-		osmo_timer_schedule(&db->timer, (si.meldeinterval < MELDE_WIEDERHOLUNG) ? si.meldeinterval : MELDE_WIEDERHOLUNG,0); /* when to do retry */
+		wheel_timer_schedule(&db->timer, (si.meldeinterval < MELDE_WIEDERHOLUNG) ? si.meldeinterval : MELDE_WIEDERHOLUNG,0); /* when to do retry */
 	}
 
+	/* only changes are written, not every availability check */
+	if (db->eingebucht != was_eingebucht || db->ogk_kanal != old_ogk_kanal || db->futelg_bit != old_futelg_bit || db->extended != old_extended)
+		snapshot_update(db);
+
 	if (futelg_bit)
 		*futelg_bit = db->futelg_bit;
 	if (extended)
@@ -179,28 +324,79 @@ int update_db(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest, int o
 
 int find_db(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest, int *ogk_kanal, int *futelg_bit, int *extended)
 {
-	cnetz_db_t *db = cnetz_db_head;
+	cnetz_db_t *db;
 
-	while (db) {
-		if (db->eingebucht
-		 && db->futln_nat == futln_nat
-		 && db->futln_fuvst == futln_fuvst
-		 && db->futln_rest == futln_rest) {
-			if (ogk_kanal)
-				*ogk_kanal = db->ogk_kanal;
-			if (futelg_bit)
-				*futelg_bit = db->futelg_bit;
-			if (extended)
-				*extended = db->extended;
-			return 0;
+	db = search_db(futln_nat, futln_fuvst, futln_rest);
+	if (!db || !db->eingebucht)
+		return -1;
+
+	if (ogk_kanal)
+		*ogk_kanal = db->ogk_kanal;
+	if (futelg_bit)
+		*futelg_bit = db->futelg_bit;
+	if (extended)
+		*extended = db->extended;
+	return 0;
+}
+
+/* load subscribers from snapshot file and keep appending changes to it */
+int load_db(const char *filename)
+{
+	char line[256];
+	cnetz_db_t *db;
+	FILE *fp;
+	int nat, fuvst, rest, ogk_kanal, futelg_bit, extended;
+	int count = 0;
+
+	snapshot_file = filename;
+
+	fp = fopen(filename, "r");
+	if (fp) {
+		while (fgets(line, sizeof(line), fp)) {
+			/* skip incomplete line */
+			if (!strchr(line, '\n'))
+				break;
+			if (sscanf(line, "+ %d,%d,%d %d %d %d", &nat, &fuvst, &rest, &ogk_kanal, &futelg_bit, &extended) == 6) {
+				db = search_db(nat, fuvst, rest);
+				if (!db)
+					db = create_db(nat, fuvst, rest);
+				if (!db)
+					break;
+				db->ogk_kanal = ogk_kanal;
+				db->futelg_bit = futelg_bit;
+				db->extended = extended;
+				db->eingebucht = 1;
+				db->last_seen = get_time();
+				/* check soon, if the subscriber is still there */
+				wheel_timer_schedule(&db->timer, si.meldeinterval,0);
+			} else if (sscanf(line, "- %d,%d,%d", &nat, &fuvst, &rest) == 3) {
+				db = search_db(nat, fuvst, rest);
+				if (db)
+					remove_db(db);
+			}
 		}
-		db = db->next;
+		fclose(fp);
+		for (db = cnetz_db_head; db; db = db->next)
+			count++;
+		LOGP(DDB, LOGL_NOTICE, "Loaded %d subscriber(s) from '%s'.\n", count, filename);
 	}
-	return -1;
+
+	/* write compact file and open it for appending */
+	snapshot_write();
+	if (!snapshot_fp)
+		return -EIO;
+
+	return 0;
 }
 
 void flush_db(void)
 {
+	/* exit is not a deregistration, so the snapshot file keeps the subscribers */
+	if (snapshot_fp) {
+		fclose(snapshot_fp);
+		snapshot_fp = NULL;
+	}
+
 	while (cnetz_db_head)
 		remove_db(cnetz_db_head);
 }
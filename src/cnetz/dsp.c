@@ -33,6 +33,7 @@
 #include "sysinfo.h"
 #include "telegramm.h"
 #include "dsp.h"
+#include "speech.h"
 
 /* test function to mirror received audio from ratio back to radio */
 //#define TEST_SCRAMBLE
@@ -284,16 +285,16 @@ static int fsk_nothing_encode(cnetz_t *cnetz)
 }
 
 /* encode one data block into samples
- * input: 184 data bits (including barker code)
+ * input: 184 data bits (including barker code), packed MSB first
  * output: samples
  * return number of samples */
-static int fsk_block_encode(cnetz_t *cnetz, const char *bits, int ogk)
+static int fsk_block_encode(cnetz_t *cnetz, const uint8_t *bits, int ogk)
 {
 	/* alloc samples, add 1 in case there is a rest */
 	sample_t *spl;
 	double phase, bitstep, deviation;
 	int i, count;
-	char last;
+	int bit, last;
 
 	deviation = cnetz->fsk_deviation;
 	spl = cnetz->fsk_tx_buffer;
@@ -309,11 +310,12 @@ static int fsk_block_encode(cnetz_t *cnetz, const char *bits, int ogk)
 		phase -= 256.0;
 	}
 	/* add 184 bits */
-	last = ' ';
+	last = -1;
 	for (i = 0; i < 184; i++) {
+		bit = TELEGRAMM_BIT(bits, i);
 		switch (last) {
-		case ' ':
-			if (bits[i] == '1') {
+		case -1:
+			if (bit) {
 				/* ramp up from 0 */
 				do {
 					*spl++ = cnetz->fsk_ramp_up[(uint8_t)phase] / 2 + deviation / 2;
@@ -329,8 +331,8 @@ static int fsk_block_encode(cnetz_t *cnetz, const char *bits, int ogk)
 				phase -= 256.0;
 			}
 			break;
-		case '1':
-			if (bits[i] == '1') {
+		case 1:
+			if (bit) {
 				/* stay up */
 				do {
 					*spl++ = deviation;
@@ -346,8 +348,8 @@ static int fsk_block_encode(cnetz_t *cnetz, const char *bits, int ogk)
 				phase -= 256.0;
 			}
 			break;
-		case '0':
-			if (bits[i] == '1') {
+		case 0:
+			if (bit) {
 				/* ramp up */
 				do {
 					*spl++ = cnetz->fsk_ramp_up[(uint8_t)phase];
@@ -364,10 +366,10 @@ static int fsk_block_encode(cnetz_t *cnetz, const char *bits, int ogk)
 			}
 			break;
 		}
-		last = bits[i];
+		last = bit;
 	}
 	/* add 7 bits of pause */
-	if (last == '0') {
+	if (last == 0) {
 		/* ramp up to 0 */
 		do {
 			*spl++ = cnetz->fsk_ramp_up[(uint8_t)phase] / 2 - deviation / 2;
@@ -408,7 +410,7 @@ static int fsk_block_encode(cnetz_t *cnetz, const char *bits, int ogk)
 }
 
 /* encode one distributed data block into samples
- * input: 184 data bits (including barker code)
+ * input: 184 data bits (including barker code), packed MSB first
  * output: samples
  * 	if a sample contains a marker, it indicates where to insert speech block
  * return number of samples
@@ -419,13 +421,13 @@ static int fsk_block_encode(cnetz_t *cnetz, const char *bits, int ogk)
  * the marker marks the point where the speech is ramped up, so the phone
  * will see the speech completely ramped up after the 6th bit
  */
-static int fsk_distributed_encode(cnetz_t *cnetz, const char *bits)
+static int fsk_distributed_encode(cnetz_t *cnetz, const uint8_t *bits)
 {
 	/* alloc samples, add 1 in case there is a rest */
 	sample_t *spl, *marker;
 	double phase, bitstep, deviation;
 	int i, j, count;
-	char last;
+	int bit, last;
 
 	deviation = cnetz->fsk_deviation;
 	spl = cnetz->fsk_tx_buffer;
@@ -459,11 +461,12 @@ static int fsk_distributed_encode(cnetz_t *cnetz, const char *bits)
 			phase += bitstep;
 		} while (phase < 256.0);
 		phase -= 256.0;
-		last = ' ';
+		last = -1;
 		for (j = 0; j < 4; j++) {
+			bit = TELEGRAMM_BIT(bits, i * 4 + j);
 			switch (last) {
-			case ' ':
-				if (bits[i * 4 + j] == '1') {
+			case -1:
+				if (bit) {
 					/* ramp up from 0 */
 					do {
 						*spl++ = cnetz->fsk_ramp_up[(uint8_t)phase] / 2 + deviation / 2;
@@ -479,8 +482,8 @@ static int fsk_distributed_encode(cnetz_t *cnetz, const char *bits)
 					phase -= 256.0;
 				}
 				break;
-			case '1':
-				if (bits[i * 4 + j] == '1') {
+			case 1:
+				if (bit) {
 					/* stay up */
 					do {
 						*spl++ = deviation;
@@ -496,8 +499,8 @@ static int fsk_distributed_encode(cnetz_t *cnetz, const char *bits)
 					phase -= 256.0;
 				}
 				break;
-			case '0':
-				if (bits[i * 4 + j] == '1') {
+			case 0:
+				if (bit) {
 					/* ramp up */
 					do {
 						*spl++ = cnetz->fsk_ramp_up[(uint8_t)phase];
@@ -514,10 +517,10 @@ static int fsk_distributed_encode(cnetz_t *cnetz, const char *bits)
 				}
 				break;
 			}
-			last = bits[i * 4 + j];
+			last = bit;
 		}
 		/* ramp down */
-		if (last == '0') {
+		if (last == 0) {
 			/* ramp up to 0 */
 			do {
 				*spl++ = cnetz->fsk_ramp_up[(uint8_t)phase] / 2 - deviation / 2;
@@ -583,32 +586,23 @@ void sender_receive(sender_t *sender, sample_t *samples, int length, double rf_l
 /* shrink audio segment from 12.5 ms to the duration of 60 bits */
 static int shrink_speech(cnetz_t *cnetz, sample_t *speech_buffer)
 {
-	int speech_length;
 	int16_t spl[100];
 
 	jitter_load_samples(&cnetz->sender.dejitter, (uint8_t *)spl, 100, sizeof(*spl), jitter_conceal_s16, NULL);
-	int16_to_samples_speech(speech_buffer, spl, 100);
-	/* 1. compress dynamics */
-	compress_audio(&cnetz->cstate, speech_buffer, 100);
-	/* 2. upsample */
-	speech_length = samplerate_upsample_output_num(&cnetz->sender.srstate, 100);
-	samplerate_upsample(&cnetz->sender.srstate, speech_buffer, 100, speech_buffer, speech_length);
-	/* 3. scramble */
-	if (cnetz->scrambler)
-		scrambler(&cnetz->scrambler_tx, speech_buffer, speech_length);
-	/* 4. pre-emphasis is done by cnetz code, not by common code */
+	/* pre-emphasis is done by cnetz code, not by common code */
 	/* pre-emphasis is only used when scrambler is off, see FTZ 171 TR 60 Clause 4 */
-	if (cnetz->pre_emphasis && !cnetz->scrambler)
-		pre_emphasis(&cnetz->estate, speech_buffer, speech_length);
-
-	return speech_length;
+	return speech_shrink(&cnetz->cstate, &cnetz->sender.srstate,
+		(cnetz->scrambler) ? &cnetz->scrambler_tx : NULL,
+		(cnetz->pre_emphasis && !cnetz->scrambler) ? &cnetz->estate : NULL,
+		spl, 100, speech_buffer);
 }
 
 static int fsk_telegramm(cnetz_t *cnetz, sample_t *samples, uint8_t *power, int length)
 {
 	int count = 0, pos, copy, i, speech_length, speech_pos;
 	sample_t *spl, *speech_buffer;
-	const char *bits;
+	uint8_t tx_bits[TELEGRAMM_TX_BYTES];
+	const uint8_t *bits;
 
 	speech_buffer = cnetz->dsp_speech_buffer;
 	speech_length = cnetz->dsp_speech_length;
@@ -667,14 +661,14 @@ again:
 						cnetz->negative_polarity = (cnetz->sched_ts & 7) >> 2;
 					/* set last time slot, so we know to which time slot the message from mobile station belongs to */
 					cnetz->sched_last_ts = cnetz->sched_ts;
-					bits = cnetz_encode_telegramm(cnetz);
+					bits = cnetz_encode_telegramm(cnetz, tx_bits);
 					if (bits) {
 						LOGP_CHAN(DDSP, LOGL_DEBUG, "Transmitting 'Rufblock' at timeslot %d\n", cnetz->sched_ts);
 						fsk_block_encode(cnetz, bits, 1);
 					} else
 						fsk_nothing_encode(cnetz);
 				} else {
-					bits = cnetz_encode_telegramm(cnetz);
+					bits = cnetz_encode_telegramm(cnetz, tx_bits);
 					if (bits) {
 						LOGP_CHAN(DDSP, LOGL_DEBUG, "Transmitting 'Meldeblock' at timeslot %d\n", cnetz->sched_ts);
 						fsk_block_encode(cnetz, bits, 1);
@@ -686,7 +680,7 @@ again:
 			}
 			break;
 		case DSP_MODE_SPK_K:
-			bits = cnetz_encode_telegramm(cnetz);
+			bits = cnetz_encode_telegramm(cnetz, tx_bits);
 			if (bits) {
 				LOGP_CHAN(DDSP, LOGL_DEBUG, "Transmitting 'Konzentrierte Signalisierung' at timeslot %d.%d\n", cnetz->sched_ts, cnetz->sched_r_m * 5);
 				fsk_block_encode(cnetz, bits, 0);
@@ -694,7 +688,7 @@ again:
 				fsk_nothing_encode(cnetz);
 			break;
 		case DSP_MODE_SPK_V:
-			bits = cnetz_encode_telegramm(cnetz);
+			bits = cnetz_encode_telegramm(cnetz, tx_bits);
 			if (bits) {
 				LOGP_CHAN(DDSP, LOGL_DEBUG, "Transmitting 'Verteilte Signalisierung' starting at timeslot %d\n", cnetz->sched_ts);
 				fsk_distributed_encode(cnetz, bits);
@@ -829,19 +823,12 @@ void unshrink_speech(cnetz_t *cnetz, sample_t *speech_buffer, int count)
 	}
 	cnetz->offset_last = speech_buffer[count - 1];
 
-	/* 4. de-emphasis is done by cnetz code, not by common code */
+	/* de-emphasis is done by cnetz code, not by common code */
 	/* de-emphasis is only used when scrambler is off, see FTZ 171 TR 60 Clause 4 */
-	if (cnetz->de_emphasis)
-		dc_filter(&cnetz->estate, speech_buffer, count);
-	if (cnetz->de_emphasis && !cnetz->scrambler)
-		de_emphasis(&cnetz->estate, speech_buffer, count);
-	/* 3. descramble */
-	if (cnetz->scrambler)
-		scrambler(&cnetz->scrambler_rx, speech_buffer, count);
-	/* 2. decompress time */
-	count = samplerate_downsample(&cnetz->sender.srstate, speech_buffer, count);
-	/* 1. expand dynamics */
-	expand_audio(&cnetz->cstate, speech_buffer, count);
+	count = speech_unshrink(&cnetz->cstate, &cnetz->sender.srstate,
+		(cnetz->scrambler) ? &cnetz->scrambler_rx : NULL,
+		(cnetz->de_emphasis) ? &cnetz->estate : NULL,
+		speech_buffer, count);
 	/* to call control */
 	spl = cnetz->sender.rxbuf;
 	pos = cnetz->sender.rxbuf_pos;
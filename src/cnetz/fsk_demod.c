@@ -384,7 +384,10 @@ got_sync:
 		bit = 1 - bit;
 		/* FALLTHRU */
 	case FSK_SYNC_POSITIVE:
-		fsk->rx_buffer[fsk->rx_buffer_count] = bit + '0';
+		/* store bits packed, MSB first */
+		if (!(fsk->rx_buffer_count & 7))
+			fsk->rx_buffer[fsk->rx_buffer_count >> 3] = 0;
+		fsk->rx_buffer[fsk->rx_buffer_count >> 3] |= bit << (7 - (fsk->rx_buffer_count & 7));
 		if (++fsk->rx_buffer_count == 150) {
 			fsk->sync = FSK_SYNC_NONE;
 #ifdef DEBUG_DECODER
@@ -46,7 +46,7 @@ typedef struct fsk_fm_demod {
 
 	/* bit decoder */
 	uint64_t	rx_sync;		/* sync shift register */
-	char		rx_buffer[151];		/* 150 bits + termination */
+	uint8_t		rx_buffer[19];		/* 150 bits, packed MSB first */
 	int		rx_buffer_count;	/* counter when receiving bits */
 
 	/* statistics */
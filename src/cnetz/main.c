@@ -78,6 +78,7 @@ int meldeaufrufe = 3; /* how many times to ask phone about beeing alive */
 enum demod_type demod = FSK_DEMOD_AUTO;
 int metering = 20;
 double speech_deviation = 2400.0; /* best results with older equipment (not C5) */
+const char *db_file = NULL;
 
 void print_help(const char *arg0)
 {
@@ -246,6 +247,10 @@ void print_help(const char *arg0)
 	printf("        requires a DC coupled signal, which is produced by SDR.\n");
 	printf("        Use 'auto' to select 'slope' for sound card input and 'level' for SDR\n");
 	printf("        input. (default = '%s')\n", (demod == FSK_DEMOD_LEVEL) ? "level" : (demod == FSK_DEMOD_SLOPE) ? "slope" : "auto");
+	printf("    --db-file <filename>\n");
+	printf("        Keep a snapshot of attached subscribers in the given file. The\n");
+	printf("        subscribers are loaded from it at startup, so they don't need to\n");
+	printf("        register again after a restart. (default = no snapshot)\n");
 	main_mobile_print_station_id();
 	main_mobile_print_hotkeys();
 	printf("Press 'i' key to dump list of currently attached subscribers.\n");
@@ -271,6 +276,7 @@ static int atoi_limit(const char *p, int l1, int l2)
 }
 
 #define OPT_WARTESCHLANGE	256
+#define OPT_DB_FILE		257
 
 static void add_options(void)
 {
@@ -287,6 +293,7 @@ static void add_options(void)
 	option_add('V', "voice-deviation", 1);
 	option_add('S', "sysinfo", 1);
 	option_add('D', "demod", 1);
+	option_add(OPT_DB_FILE, "db-file", 1);
 }
 
 static int handle_options(int short_option, int argi, char **argv)
@@ -479,6 +486,9 @@ error_fuz:
 			return -EINVAL;
 		}
 		break;
+	case OPT_DB_FILE:
+		db_file = options_strdup(argv[argi]);
+		break;
 	default:
 		return main_mobile_handle_options(short_option, argi, argv);
 	}
@@ -692,6 +702,15 @@ int main(int argc, char *argv[])
 		}
 	}
 
+	/* restore subscribers from last run */
+	if (db_file) {
+		rc = load_db(db_file);
+		if (rc < 0) {
+			fprintf(stderr, "Failed to open subscriber snapshot file '%s'. Quitting!\n", db_file);
+			goto fail;
+		}
+	}
+
 	main_mobile_loop("cnetz", &quit, NULL, station_id);
 
 fail:
@@ -0,0 +1,267 @@
+/* C-Netz speech time compression and expansion
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Each speech frame of 12.5 ms is compressed in time to fit into 60 bits of
+ * a time slot and expanded when received:
+ *
+ * 1. compandor (at 8000 Hz)
+ * 2. time compression / expansion by linear interpolation with low pass
+ * 3. scrambler (mirrored spectrum)
+ * 4. pre-/de-emphasis, only if scrambler is off (FTZ 171 TR 60 Clause 4)
+ *
+ * The multipass functions process the frame with the common library functions,
+ * one after another. The other functions do steps 2..4 with one loop over
+ * the samples, so each sample passes all filters while it is in a register.
+ * The compandor works on the few samples at 8000 Hz in a scratch buffer. Both
+ * give identical results, because every step does the same operations in the
+ * same order.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "../libsample/sample.h"
+#include "../libcompandor/compandor.h"
+#include "../libsamplerate/samplerate.h"
+#include "../libscrambler/scrambler.h"
+#include "../libemphasis/emphasis.h"
+#include "speech.h"
+
+/* coefficients of IIR filter held in local variables while processing */
+struct iir_local {
+	int iter;
+	double a0, a1, a2, b1, b2;
+	double *z1, *z2;
+};
+
+static inline void iir_local_load(struct iir_local *l, iir_filter_t *filter)
+{
+	l->iter = filter->iter;
+	l->a0 = filter->a0;
+	l->a1 = filter->a1;
+	l->a2 = filter->a2;
+	l->b1 = filter->b1;
+	l->b2 = filter->b2;
+	l->z1 = filter->z1;
+	l->z2 = filter->z2;
+}
+
+/* one sample of iir_process() */
+static inline sample_t iir_local_sample(struct iir_local *l, sample_t sample)
+{
+	double in, out;
+	int j;
+
+	in = sample + 0.000000001;
+	for (j = 0; j < l->iter; j++) {
+		out = in * l->a0 + l->z1[j];
+		l->z1[j] = in * l->a1 + l->z2[j] - l->b1 * out;
+		l->z2[j] = in * l->a2 - l->b2 * out;
+		in = out;
+	}
+
+	return in;
+}
+
+/* Shrink given number of samples at 8000 Hz to speech buffer, return number
+ * of samples. Scrambler and emphasis are not applied, if NULL.
+ */
+int speech_shrink(compandor_t *cstate, samplerate_t *srstate, scrambler_t *scr, emphasis_t *estate, int16_t *spl, int num, sample_t *speech)
+{
+	sample_t in[num];
+	struct iir_local up_lp, scr_lp = {}, emph_lp = {};
+	double factor = 1.0 / srstate->factor, in_index;
+	double phase = 0, phaseshift = 0, emph_factor = 0, amp = 0, x_last = 0;
+	sample_t current_sample, last_sample, s, y;
+	int i, idx;
+
+	/* 1. compress dynamics */
+	int16_to_samples_speech(in, spl, num);
+	compress_audio(cstate, in, num);
+
+	iir_local_load(&up_lp, &srstate->up.lp);
+	current_sample = srstate->up.current_sample;
+	last_sample = srstate->up.last_sample;
+	in_index = srstate->up.in_index;
+	if (scr) {
+		iir_local_load(&scr_lp, &scr->lp);
+		phaseshift = scr->carrier_phaseshift65536;
+		phase = scr->carrier_phase65536;
+	}
+	if (estate) {
+		iir_local_load(&emph_lp, &estate->p.lp);
+		emph_factor = estate->p.factor;
+		amp = estate->p.amp;
+		x_last = estate->p.x_last;
+	}
+
+	/* output until all input samples are used, like samplerate_upsample_output_num() */
+	idx = 0;
+	for (i = 0; idx < num; i++) {
+		/* 2. upsample */
+		s = last_sample * (1.0 - in_index) + current_sample * in_index;
+		in_index += factor;
+		if (in_index >= 1.0) {
+			last_sample = current_sample;
+			current_sample = in[idx++];
+			in_index -= 1.0;
+		}
+		if (srstate->filter_cutoff)
+			s = iir_local_sample(&up_lp, s);
+		/* 3. scramble */
+		if (scr) {
+			s *= scrambler_carrier[(uint16_t)phase];
+			phase += phaseshift;
+			if (phase >= 65536.0)
+				phase -= 65536.0;
+			s = iir_local_sample(&scr_lp, s);
+		}
+		/* 4. pre-emphasis */
+		if (estate) {
+			s = iir_local_sample(&emph_lp, s);
+			y = s - emph_factor * x_last;
+			x_last = s;
+			s = amp * y;
+		}
+		speech[i] = s;
+	}
+
+	srstate->up.last_sample = last_sample;
+	srstate->up.current_sample = current_sample;
+	srstate->up.in_index = in_index;
+	if (scr)
+		scr->carrier_phase65536 = phase;
+	if (estate)
+		estate->p.x_last = x_last;
+
+	return i;
+}
+
+int speech_shrink_multipass(compandor_t *cstate, samplerate_t *srstate, scrambler_t *scr, emphasis_t *estate, int16_t *spl, int num, sample_t *speech)
+{
+	int speech_length;
+
+	int16_to_samples_speech(speech, spl, num);
+	/* 1. compress dynamics */
+	compress_audio(cstate, speech, num);
+	/* 2. upsample */
+	speech_length = samplerate_upsample_output_num(srstate, num);
+	samplerate_upsample(srstate, speech, num, speech, speech_length);
+	/* 3. scramble */
+	if (scr)
+		scrambler(scr, speech, speech_length);
+	/* 4. pre-emphasis */
+	if (estate)
+		pre_emphasis(estate, speech, speech_length);
+
+	return speech_length;
+}
+
+/* Unshrink speech buffer to samples at 8000 Hz, return number of samples.
+ * If estate is given, low frequencies are removed and de-emphasis is applied,
+ * if the scrambler is not used.
+ */
+int speech_unshrink(compandor_t *cstate, samplerate_t *srstate, scrambler_t *scr, emphasis_t *estate, sample_t *speech, int count)
+{
+	struct iir_local dc_hp = {}, scr_lp = {}, down_lp;
+	double factor = srstate->factor, in_index, diff;
+	double phase = 0, phaseshift = 0, emph_factor = 0, amp = 0, y_last = 0;
+	sample_t last_sample, s, y;
+	int output_num = 0, k;
+
+	if (estate) {
+		iir_local_load(&dc_hp, &estate->d.hp);
+		emph_factor = estate->d.factor;
+		amp = estate->d.amp;
+		y_last = estate->d.y_last;
+	}
+	if (scr) {
+		iir_local_load(&scr_lp, &scr->lp);
+		phaseshift = scr->carrier_phaseshift65536;
+		phase = scr->carrier_phase65536;
+	}
+	iir_local_load(&down_lp, &srstate->down.lp);
+	last_sample = srstate->down.last_sample;
+	in_index = srstate->down.in_index;
+
+	/* the output never overtakes the input, so it is written to the same buffer */
+	for (k = 0; k < count; k++) {
+		s = speech[k];
+		/* 4. de-emphasis */
+		if (estate) {
+			s = iir_local_sample(&dc_hp, s);
+			if (!scr) {
+				y = s + emph_factor * y_last;
+				y_last = y;
+				s = amp * y;
+			}
+		}
+		/* 3. descramble */
+		if (scr) {
+			s *= scrambler_carrier[(uint16_t)phase];
+			phase += phaseshift;
+			if (phase >= 65536.0)
+				phase -= 65536.0;
+			s = iir_local_sample(&scr_lp, s);
+		}
+		/* 2. downsample, interpolate between last and this sample */
+		if (srstate->filter_cutoff)
+			s = iir_local_sample(&down_lp, s);
+		while ((int)in_index == k) {
+			diff = in_index - (double)k;
+			speech[output_num++] = last_sample * (1.0 - diff) + s * diff;
+			in_index += factor;
+		}
+		last_sample = s;
+	}
+
+	if (scr)
+		scr->carrier_phase65536 = phase;
+	if (estate && !scr)
+		estate->d.y_last = y_last;
+	srstate->down.last_sample = last_sample;
+	in_index -= (double)count;
+	if ((int)in_index < 0)
+		in_index = 0.0;
+	srstate->down.in_index = in_index;
+
+	/* 1. expand dynamics */
+	expand_audio(cstate, speech, output_num);
+
+	return output_num;
+}
+
+int speech_unshrink_multipass(compandor_t *cstate, samplerate_t *srstate, scrambler_t *scr, emphasis_t *estate, sample_t *speech, int count)
+{
+	/* 4. de-emphasis */
+	if (estate)
+		dc_filter(estate, speech, count);
+	if (estate && !scr)
+		de_emphasis(estate, speech, count);
+	/* 3. descramble */
+	if (scr)
+		scrambler(scr, speech, count);
+	/* 2. decompress time */
+	count = samplerate_downsample(srstate, speech, count);
+	/* 1. expand dynamics */
+	expand_audio(cstate, speech, count);
+
+	return count;
+}
+
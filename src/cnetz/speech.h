@@ -0,0 +1,5 @@
+int speech_shrink(compandor_t *cstate, samplerate_t *srstate, scrambler_t *scr, emphasis_t *estate, int16_t *spl, int num, sample_t *speech);
+int speech_shrink_multipass(compandor_t *cstate, samplerate_t *srstate, scrambler_t *scr, emphasis_t *estate, int16_t *spl, int num, sample_t *speech);
+int speech_unshrink(compandor_t *cstate, samplerate_t *srstate, scrambler_t *scr, emphasis_t *estate, sample_t *speech, int count);
+int speech_unshrink_multipass(compandor_t *cstate, samplerate_t *srstate, scrambler_t *scr, emphasis_t *estate, sample_t *speech, int count);
+
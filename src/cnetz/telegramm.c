@@ -28,6 +28,7 @@
 #include <math.h>
 #include "../libsample/sample.h"
 #include "../liblogging/logging.h"
+#include "../libmobile/replay.h"
 #include "cnetz.h"
 #include "dsp.h"
 #include "sysinfo.h"
@@ -615,15 +616,28 @@ static void debug_parameter(char digit, uint64_t value)
 		LOGP(DFRAME, LOGL_DEBUG, " (%c) %s : %" PRIu64 "\n", digit, parameter->param_name, value);
 }
 
+/* render 6 bits opcode and 64 bits parameter as string for debugging */
+static void debug_bits(char *string, uint8_t opcode, uint64_t data)
+{
+	int i;
+
+	for (i = 0; i < 6; i++)
+		string[i] = ((opcode >> (5 - i)) & 1) + '0';
+	for (i = 0; i < 64; i++)
+		string[6 + i] = ((data >> (63 - i)) & 1) + '0';
+	string[70] = '\0';
+}
+
 /* encode telegram to 70 bits
- * bit order MSB
+ * opcode is taken from telegram, the 64 parameter bits are returned
+ * bit 63 is the first bit after opcode
  */
-static char *assemble_telegramm(const telegramm_t *telegramm, int debug)
+static uint64_t assemble_telegramm(const telegramm_t *telegramm, int debug)
 {
-	static char bits[71]; /* + termination char for debug */
+	uint64_t bits = 0;
 	char parameter;
 	const char *string;
-	uint64_t value, val;
+	uint64_t value, mask;
 	int i, j;
 	int rc;
 
@@ -635,18 +649,12 @@ static char *assemble_telegramm(const telegramm_t *telegramm, int debug)
 	if (debug)
 		LOGP(DFRAME, LOGL_INFO, "Coding %s %s\n", definition_opcode[telegramm->opcode].message_name, definition_opcode[telegramm->opcode].message_text);
 
-	/* copy opcode */
-	for (i = 0; i < 6; i++)
-		bits[5 - i] = (telegramm->opcode & (1 << i)) ? '1' : '0';
-
 	/* copy parameters */
 	string = definition_opcode[telegramm->opcode].no_auth_bits;
 	for (i = 0; i < 64; i++) {
 		parameter = string[63 - i];
-		if (parameter == '-') {
-			bits[69 - i] = '0';
+		if (parameter == '-')
 			continue;
-		}
 		switch (parameter) {
 		case 'A':
 			value = telegramm->fuz_fuvst_nr;
@@ -811,31 +819,32 @@ static char *assemble_telegramm(const telegramm_t *telegramm, int debug)
 		}
 		if (debug && loglevel <= LOGL_DEBUG)
 			debug_parameter(parameter, value);
-		val = value;
-		for (j = 0; string[63 - i - j] == parameter; j++) {
-			bits[69 - i - j] = (val & 1) ? '1' : '0';
-			val >>= 1;
-		}
-		if (val)
+		for (j = 0; i + j < 64 && string[63 - i - j] == parameter; j++)
+			;
+		mask = (j == 64) ? ~(uint64_t)0 : ((uint64_t)1 << j) - 1;
+		if ((value & ~mask))
 			LOGP(DFRAME, LOGL_ERROR, "Parameter '%c' value '0x%" PRIx64 "' exceeds bit range!\n", parameter, value);
+		bits |= (value & mask) << i;
 		i += j - 1;
 	}
-	bits[70] = '\0';
 
-	if (debug) {
+	if (debug && loglevel <= LOGL_DEBUG) {
+		char string_bits[71];
+
+		debug_bits(string_bits, telegramm->opcode, bits);
 		LOGP(DFRAME, LOGL_DEBUG, "OOOOOO%s\n", string);
-		LOGP(DFRAME, LOGL_DEBUG, "%s\n", bits);
+		LOGP(DFRAME, LOGL_DEBUG, "%s\n", string_bits);
 	}
 
 	return bits;
 }
 
 /* decode telegram from 70 bits
- * bit order MSB
+ * opcode and 64 parameter bits, bit 63 is the first bit after opcode
  */
-static void disassemble_telegramm(telegramm_t *telegramm, const char *bits, int auth)
+static void disassemble_telegramm(telegramm_t *telegramm, uint8_t opcode, uint64_t bits, int auth)
 {
-	uint64_t value;
+	uint64_t value, mask;
 	const char *string;
 	char parameter;
 	int i, j;
@@ -843,15 +852,12 @@ static void disassemble_telegramm(telegramm_t *telegramm, const char *bits, int
 	memset(telegramm, 0, sizeof(*telegramm));
 
 	/* copy opcode */
-	value = 0;
-	for (i = 0; i < 6; i++)
-		value = (value << 1) | (bits[i] == '1');
-	telegramm->opcode = value;
+	telegramm->opcode = opcode;
 
 	LOGP(DFRAME, LOGL_INFO, "Decoding %s %s\n", definition_opcode[telegramm->opcode].message_name, definition_opcode[telegramm->opcode].message_text);
 
 	/* copy parameters */
-	if (auth && bits[1]) /* auth flag and chip card flag */
+	if (auth) /* auth flag */
 		string = definition_opcode[telegramm->opcode].auth_bits;
 	else
 		string = definition_opcode[telegramm->opcode].no_auth_bits;
@@ -859,10 +865,10 @@ static void disassemble_telegramm(telegramm_t *telegramm, const char *bits, int
 		parameter = string[63 - i];
 		if (parameter == '-')
 			continue;
-		value = 0;
 		for (j = 0; i + j < 64 && string[63 - i - j] == parameter; j++)
-			value = (value >> 1) | ((uint64_t)(bits[69 - i - j] == '1') << 63);
-		value >>= 64 - j;
+			;
+		mask = (j == 64) ? ~(uint64_t)0 : ((uint64_t)1 << j) - 1;
+		value = (bits >> i) & mask;
 		i += j - 1;
 		if (loglevel <= LOGL_DEBUG)
 			debug_parameter(parameter, value);
@@ -1027,17 +1033,15 @@ static void disassemble_telegramm(telegramm_t *telegramm, const char *bits, int
 	}
 
 	if (loglevel <= LOGL_DEBUG) {
-		char debug_bits[71];
+		char string_bits[71];
 
-		memcpy(debug_bits, bits, 70);
-		debug_bits[70] = '\0';
+		debug_bits(string_bits, opcode, bits);
 		LOGP(DFRAME, LOGL_DEBUG, "OOOOOO%s\n", string);
-		LOGP(DFRAME, LOGL_DEBUG, "%s\n", debug_bits);
+		LOGP(DFRAME, LOGL_DEBUG, "%s\n", string_bits);
 	}
 
 }
 
-static const char *barker_string = "11100010010";
 static int16_t barker_code = 0x712; /* 11 bits: 11100010010 */
 static uint8_t barker_decode[2048]; /* detected bits */
 
@@ -1289,69 +1293,65 @@ int detect_sync(uint64_t bitstream)
 }
 
 /* encode data block
- * input: 70 data bits MSB first
- * output: 10*15 code words (LSB first)
+ * input: 6 bits opcode and 64 bits parameter (70 data bits)
+ * output: 10 code words of 15 bits (bit 0 is transmitted first)
  * FTZ 171 TR 60 / 5.1.1.3 */
-static char *encode(const char *input)
+static void encode(uint8_t opcode, uint64_t data, uint16_t *code)
 {
-	static char output[150];
-	int16_t word;
-	int i, j;
+	uint16_t word;
+	int i;
 
 #ifdef DEBUG_CODER
+	int j;
+
 	printf("Encoding block to transmit:\n");
 	printf("0123456.01234567\n");
 #endif
+	/* the last 7 data bits are encoded into the first code word */
+	for (i = 0; i < 9; i++) {
+		word = (data >> (i * 7)) & 0x7f;
+		code[i] = block_code[word];
+	}
+	word = (data >> 63) | (opcode << 1);
+	code[9] = block_code[word & 0x7f];
+#ifdef DEBUG_CODER
 	for (i = 0; i < 10; i++) {
-		word = 0;
-		for (j = 0; j < 7; j++)
-			word = (word << 1) | (input[(9 - i) * 7 + j] == '1');
-		word = block_code[word];
 		for (j = 0; j < 15; j++) {
-			output[i * 15 + j] = ((word >> j) & 1) + '0';
-#ifdef DEBUG_CODER
-			printf("%c", output[i * 15 + j]);
+			printf("%c", ((code[i] >> j) & 1) + '0');
 			if (j == 6)
 				printf(".");
-#endif
 		}
-#ifdef DEBUG_CODER
 		printf("\n");
-#endif
 	}
-
-	return output;
+#endif
 }
 
 /* decode data block
- * input: 10*15 code words (LSB first)
- * output: 70 data bits MSB first
+ * input: 10 code words of 15 bits (bit 0 is received first)
+ * output: 6 bits opcode and 64 bits parameter (70 data bits)
+ * return -1 if a code word cannot be corrected
  * FTZ 171 TR 60 / 5.1.1.3 */
-static const char *decode(const char *input, int *_bit_errors)
+static int decode(const uint16_t *code, uint8_t *_opcode, uint64_t *_data, int *_bit_errors)
 {
 	int failed = 0, warn = 0;
 	char fail_str[11];
-	static char output[70];
+	uint64_t data = 0;
 	uint16_t word;
-	int i, j;
+	int i;
 
 #ifdef DEBUG_CODER
+	int j;
+
 	printf("Decoding received block:\n");
 	printf("0123456.01234567 Without errors:  Error bits:\n");
 #endif
 	for (i = 0; i < 10; i++) {
-		word = 0;
-		for (j = 0; j < 15; j++) {
-			word = (word << 1) | (input[i * 15 + 14 - j] == '1');
-#ifdef DEBUG_CODER
-			printf("%c", input[i * 15 + j]);
-			if (j == 6)
-				printf(".");
-#endif
-		}
-		word = block_decode[word];
-		for (j = 0; j < 7; j++) {
-			output[(9 - i) * 7 + j] = ((word >> (6 - j)) & 1) + '0';
+		word = block_decode[code[i]];
+		if (i < 9)
+			data |= (uint64_t)(word & 0x7f) << (i * 7);
+		else {
+			data |= (uint64_t)(word & 0x01) << 63;
+			*_opcode = (word & 0x7f) >> 1;
 		}
 		if (word > 0x2ff) {
 			failed = 1;
@@ -1367,6 +1367,11 @@ static const char *decode(const char *input, int *_bit_errors)
 		} else
 			fail_str[i] = '.';
 #ifdef DEBUG_CODER
+		for (j = 0; j < 15; j++) {
+			printf("%c", ((code[i] >> j) & 1) + '0');
+			if (j == 6)
+				printf(".");
+		}
 		if (word > 0x2ff)
 			printf("decode failed");
 		else {
@@ -1378,7 +1383,7 @@ static const char *decode(const char *input, int *_bit_errors)
 			}
 			printf(" ");
 			for (j = 0; j < 15; j++) {
-				if (blockcode[word & 0x7f][j] != input[i * 15 + j])
+				if (((block_code[word & 0x7f] ^ code[i]) >> j) & 1)
 					printf("*");
 				else
 					printf("-");
@@ -1399,113 +1404,156 @@ static const char *decode(const char *input, int *_bit_errors)
 		LOGP(DFRAME, LOGL_DEBUG, "Received Telegram with no block errors.\n");
 
 	if (failed)
-		return NULL;
+		return -1;
+	*_data = data;
 	*_bit_errors = warn;
-	return output;
+	return 0;
+}
+
+/* transpose 16x16 bit matrix at the anti-diagonal
+ * bit c of word r becomes bit 15-r of word 15-c
+ * applying it twice results in the original matrix */
+static void transpose16(uint16_t *m)
+{
+	uint16_t mask, t;
+	int j, k;
+
+	for (j = 8, mask = 0x00ff; j; j >>= 1, mask ^= mask << j) {
+		for (k = 0; k < 16; k = ((k | j) + 1) & ~j) {
+			t = (m[k] ^ (m[k | j] >> j)) & mask;
+			m[k] ^= t;
+			m[k | j] ^= t << j;
+		}
+	}
 }
 
 /* interleving of code words
- * input: 10*15 code words (LSB first)
- * output: stream of 33 sync + 1 + 150 interleaved bits
+ * input: 10 code words of 15 bits
+ * output: stream of 33 sync + 1 + 150 interleaved bits, packed MSB first
  * FTZ 171 TR 60 / 5.1.1.2 and 5.1.1.2 */
-static char *interleave(const char *input)
+static void interleave(const uint16_t *code, uint8_t *output)
 {
-	static char output[185]; /* + termination char for debug */
-	int i, j;
-
-	strcpy(output, barker_string);
-	strcpy(output + 11, barker_string);
-	strcpy(output + 22, barker_string);
+	uint16_t m[16];
+	uint64_t shift;
+	int i, bits;
 
-	output[33] = '1';
+	/* code word i goes to row 6 + i, so that after transposing, bit j of
+	 * all code words is found in row 15 - j, first code word at bit 9 */
+	for (i = 0; i < 6; i++)
+		m[i] = 0;
+	for (i = 0; i < 10; i++)
+		m[6 + i] = code[i];
+	transpose16(m);
 
 #ifdef DEBUG_BLOCK
+	int j;
+
 	printf("Interleaving block to transmit:\n");
-#endif
 	for (i = 0; i < 10; i++) {
-		for (j = 0; j < 15; j++) {
-			output[i + j * 10 + 34] = input[j + i * 15];
-#ifdef DEBUG_BLOCK
-			printf("%c", input[j + i * 15]);
-#endif
-		}
-#ifdef DEBUG_BLOCK
+		for (j = 0; j < 15; j++)
+			printf("%c", ((code[i] >> j) & 1) + '0');
 		printf("\n");
+	}
 #endif
+
+	/* 3 * barker code + 1 bit */
+	shift = ((uint64_t)barker_code << 23) | ((uint64_t)barker_code << 12) | ((uint64_t)barker_code << 1) | 1;
+	bits = 34;
+	for (i = 0; i < 15; i++) {
+		/* append 10 bits of each row */
+		shift = (shift << 10) | (m[15 - i] & 0x3ff);
+		bits += 10;
+		while (bits >= 8) {
+			bits -= 8;
+			*output++ = shift >> bits;
+		}
 	}
 
 #ifdef DEBUG_RAW
-	output[184] = '\0';
-	printf("Raw TX: %s\n", output + 34);
-#endif
+	printf("Raw TX: ");
+	for (i = 0; i < 15; i++) {
+		int j;
 
-	return output;
+		for (j = 0; j < 10; j++)
+			printf("%c", ((m[15 - i] >> (9 - j)) & 1) + '0');
+	}
+	printf("\n");
+#endif
 }
 
 /* deinterleave of code words
- * input: stream of 150 interleaved bits
- * output: 10*15 code words (LSB first)
+ * input: stream of 150 interleaved bits, packed MSB first
+ * output: 10 code words of 15 bits
  * FTZ 171 TR 60 / 5.1.1.4 */
-static const char *deinterleave(const char *input)
+static void deinterleave(const uint8_t *input, uint16_t *code)
 {
-	static char output[150];
-	int i, j;
+	uint16_t m[16];
+	uint64_t shift = 0;
+	int i, bits = 0;
+
+	/* row j of 10 bits goes to word 15 - j */
+	m[0] = 0;
+	for (i = 0; i < 15; i++) {
+		while (bits < 10) {
+			shift = (shift << 8) | *input++;
+			bits += 8;
+		}
+		bits -= 10;
+		m[15 - i] = (shift >> bits) & 0x3ff;
+	}
 
 #ifdef DEBUG_RAW
-	char debug_bits[151];
-
-	memcpy(debug_bits, input, 150);
-	debug_bits[151] = '\0';
-	printf("Raw RX: %s\n", debug_bits);
+	printf("Raw RX: ");
+	for (i = 0; i < 150; i++)
+		printf("%c", ((m[15 - i / 10] >> (9 - i % 10)) & 1) + '0');
+	printf("\n");
 #endif
 
+	transpose16(m);
+	for (i = 0; i < 10; i++)
+		code[i] = m[6 + i] & 0x7fff;
+
 #ifdef DEBUG_BLOCK
+	int j;
+
 	printf("Deinterleaving received block:\n");
-#endif
 	for (i = 0; i < 10; i++) {
-		for (j = 0; j < 15; j++) {
-			output[j + i * 15] = input[i + j * 10];
-#ifdef DEBUG_BLOCK
-			printf("%c", output[j + i * 15]);
-#endif
-		}
-#ifdef DEBUG_BLOCK
+		for (j = 0; j < 15; j++)
+			printf("%c", ((code[i] >> j) & 1) + '0');
 		printf("\n");
-#endif
 	}
-
-	return output;
+#endif
 }
 
-void cnetz_decode_telegramm(cnetz_t *cnetz, const char *bits, double level, double sync_time, double stddev)
+/* decode received telegram
+ * input: 150 interleaved bits, packed MSB first
+ * no static buffers are used, so each channel may decode in parallel */
+void cnetz_decode_telegramm(cnetz_t *cnetz, const uint8_t *bits, double level, double sync_time, double stddev)
 {
 	telegramm_t telegramm;
+	uint16_t code[10];
+	uint64_t data;
 	uint8_t opcode;
-	int i;
 	int block;
 	int bit_errors;
 
-	bits = deinterleave(bits);
-	bits = decode(bits, &bit_errors);
-	if (!bits)
+	deinterleave(bits, code);
+	if (decode(code, &opcode, &data, &bit_errors) < 0)
 		return;
 
 	/* filter out mysterious zero-telegramm */
-	for (i = 0; i < 70; i++) {
-		if (bits[i] != bits[0])
-			break;
-	}
-	if (i == 70) {
+	if ((opcode == 0 && data == 0) || (opcode == 0x3f && data == ~(uint64_t)0)) {
 		LOGP(DFRAME, LOGL_INFO, "Ignoring mysterious unmodulated telegramm (noise from phone's transmitter)\n");
 		return;
 	}
 
+	replay_event(cnetz->sender.kanal, "telegramm opcode %d (%s) data 0x%016" PRIx64 " bit errors %d", opcode, definition_opcode[opcode].message_name, data, bit_errors);
+
 	LOGP_CHAN(DDSP, LOGL_INFO, "RF level: %.1f dB RX Level: %.0f%% Standard deviation: %.0f%% Sync Time: %.2f (TS %.2f) %s\n", cnetz->rf_level_db, fabs(level) / cnetz->fsk_deviation * 100.0, stddev / fabs(level) * 100.0, sync_time, sync_time / 396.0, (level < 0) ? "NEGATIVE (phone's mode)" : "POSITIVE (base station's mode)");
 	if (bit_errors)
 		LOGP_CHAN(DDSP, LOGL_INFO, " -> Frame has %d bit errors.\n", bit_errors);
 
-	disassemble_telegramm(&telegramm, bits, si.authentifikationsbit);
-	opcode = telegramm.opcode;
+	disassemble_telegramm(&telegramm, opcode, data, si.authentifikationsbit);
 	telegramm.level = level;
 	telegramm.sync_time = sync_time;
 
@@ -1574,11 +1622,15 @@ void cnetz_decode_telegramm(cnetz_t *cnetz, const char *bits, double level, doub
 	}
 }
 
-const char *cnetz_encode_telegramm(cnetz_t *cnetz)
+/* encode telegram to transmit
+ * output: 184 bits (sync + interleaved bits), packed MSB first
+ * return NULL, if there is no telegram to transmit */
+const uint8_t *cnetz_encode_telegramm(cnetz_t *cnetz, uint8_t *bits)
 {
 	const telegramm_t *telegramm = NULL;
+	uint16_t code[10];
+	uint64_t data;
 	uint8_t opcode;
-	char *bits;
 	int debug = 1;
 
 	switch (cnetz->dsp_mode) {
@@ -1606,16 +1658,16 @@ const char *cnetz_encode_telegramm(cnetz_t *cnetz)
 		debug = 0;
 	if (opcode == OPCODE_MLR_M && cnetz->sched_mlr_debugged)
 		debug = 0;
-	bits = assemble_telegramm(telegramm, debug);
-	bits = encode(bits);
-	bits = interleave(bits);
+	data = assemble_telegramm(telegramm, debug);
+	encode(opcode, data, code);
+	interleave(code, bits);
 
 	/* invert, if polarity of the cell is negative */
 	if (cnetz->negative_polarity) {
 		int i;
 
-		for (i = 0; i < 184; i++)
-			bits[i] ^= 1;
+		for (i = 0; i < TELEGRAMM_TX_BYTES; i++)
+			bits[i] ^= 0xff;
 	}
 
 	if (opcode == OPCODE_LR_R && !cnetz->sched_lr_debugged)
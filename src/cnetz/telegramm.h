@@ -124,7 +124,12 @@ const char *telegramm2rufnummer(telegramm_t *telegramm);
 int match_fuz(telegramm_t *telegramm);
 int match_futln(telegramm_t *telegramm, uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest);
 
+/* telegrams are transferred as packed bits, MSB of first byte is first bit */
+#define TELEGRAMM_TX_BYTES	23	/* 33 sync + 1 + 150 interleaved bits */
+#define TELEGRAMM_RX_BYTES	19	/* 150 interleaved bits (without sync) */
+#define TELEGRAMM_BIT(bits, i)	(((bits)[(i) >> 3] >> (7 - ((i) & 7))) & 1)
+
 int detect_sync(uint64_t bitstream);
-void cnetz_decode_telegramm(cnetz_t *cnetz, const char *bits, double level, double sync_time, double stddev);
-const char *cnetz_encode_telegramm(cnetz_t *cnetz);
+void cnetz_decode_telegramm(cnetz_t *cnetz, const uint8_t *bits, double level, double sync_time, double stddev);
+const uint8_t *cnetz_encode_telegramm(cnetz_t *cnetz, uint8_t *bits);
 
@@ -31,6 +31,14 @@
 
 static int new_cueue_position = 0;
 
+/* all transactions of all channels, hashed by callref and subscriber */
+static trans_index_t trans_index;
+
+static inline uint64_t futln_id(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest)
+{
+	return ((uint64_t)futln_nat << 24) | ((uint64_t)futln_fuvst << 16) | futln_rest;
+}
+
 const char *transaction2rufnummer(transaction_t *trans)
 {
 	static char rufnummer[32]; /* make GCC happy (overflow check) */
@@ -141,6 +149,7 @@ void link_transaction(transaction_t *trans, cnetz_t *cnetz)
 	while (*transp)
 		transp = &((*transp)->next);
 	*transp = trans;
+	trans_index_link(&trans_index, &trans->index, trans, futln_id(trans->futln_nat, trans->futln_fuvst, trans->futln_rest), trans->callref);
 	cnetz_display_status();
 }
 
@@ -159,10 +168,19 @@ void unlink_transaction(transaction_t *trans)
 		abort();
 	}
 	*transp = trans->next;
+	trans_index_unlink(&trans_index, &trans->index);
 	trans->cnetz = NULL;
 	cnetz_display_status();
 }
 
+/* set callref and keep index up to date */
+void trans_set_callref(transaction_t *trans, int callref)
+{
+	trans->callref = callref;
+	if (trans->cnetz)
+		trans_index_callref(&trans_index, &trans->index, callref);
+}
+
 transaction_t *search_transaction(cnetz_t *cnetz, uint64_t state_mask)
 {
 	transaction_t *trans = cnetz->trans_list;
@@ -181,17 +199,16 @@ transaction_t *search_transaction(cnetz_t *cnetz, uint64_t state_mask)
 
 transaction_t *search_transaction_number(cnetz_t *cnetz, uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest)
 {
-	transaction_t *trans = cnetz->trans_list;
+	trans_index_node_t *node;
+	transaction_t *trans;
 
-	while (trans) {
-		if (trans->futln_nat == futln_nat
-		 && trans->futln_fuvst == futln_fuvst
-		 && trans->futln_rest == futln_rest) {
+	for (node = trans_index_first_id(&trans_index, futln_id(futln_nat, futln_fuvst, futln_rest)); node; node = trans_index_next_id(node)) {
+		trans = node->trans;
+		if (trans->cnetz == cnetz) {
 			const char *rufnummer = transaction2rufnummer(trans);
 			LOGP(DTRANS, LOGL_DEBUG, "Found transaction for subscriber '%s'\n", rufnummer);
 			return trans;
 		}
-		trans = trans->next;
 	}
 
 	return NULL;
@@ -199,38 +216,45 @@ transaction_t *search_transaction_number(cnetz_t *cnetz, uint8_t futln_nat, uint
 
 transaction_t *search_transaction_number_global(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest)
 {
-	sender_t *sender;
-	cnetz_t *cnetz;
-	transaction_t *trans = NULL;
+	trans_index_node_t *node;
+	transaction_t *trans;
 
 	/* search transaction for this subscriber */
-	for (sender = sender_head; sender; sender = sender->next) {
-		cnetz = (cnetz_t *) sender;
-		/* search transaction for this callref */
-		trans = search_transaction_number(cnetz, futln_nat, futln_fuvst, futln_rest);
-		if (trans)
-			break;
-	}
+	node = trans_index_first_id(&trans_index, futln_id(futln_nat, futln_fuvst, futln_rest));
+	if (!node)
+		return NULL;
+	trans = node->trans;
+	const char *rufnummer = transaction2rufnummer(trans);
+	LOGP(DTRANS, LOGL_DEBUG, "Found transaction for subscriber '%s'\n", rufnummer);
 
 	return trans;
 }
+
 transaction_t *search_transaction_callref(cnetz_t *cnetz, int callref)
 {
-	transaction_t *trans = cnetz->trans_list;
+	transaction_t *trans;
+
+	trans = search_transaction_callref_global(callref);
+	if (trans && trans->cnetz != cnetz)
+		return NULL;
+
+	return trans;
+}
+
+transaction_t *search_transaction_callref_global(int callref)
+{
+	transaction_t *trans;
 
 	/* just in case, this should not happen */
 	if (!callref)
 		return NULL;
-	while (trans) {
-		if (trans->callref == callref) {
-			const char *rufnummer = transaction2rufnummer(trans);
-			LOGP(DTRANS, LOGL_DEBUG, "Found transaction for subscriber '%s'\n", rufnummer);
-			return trans;
-		}
-		trans = trans->next;
+	trans = trans_index_by_callref(&trans_index, callref);
+	if (trans) {
+		const char *rufnummer = transaction2rufnummer(trans);
+		LOGP(DTRANS, LOGL_DEBUG, "Found transaction for subscriber '%s'\n", rufnummer);
 	}
 
-	return NULL;
+	return trans;
 }
 
 /* get oldest transaction in queue:
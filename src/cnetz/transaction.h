@@ -1,3 +1,4 @@
+#include "../libmobile/trans_index.h"
 
 	/* login to the network */
 #define	TRANS_EM	(1 << 0)	/* attach request received, sending reply */
@@ -38,6 +39,7 @@
 
 typedef struct transaction {
 	struct transaction	*next;			/* pointer to next node in list */
+	trans_index_node_t	index;			/* node of global transaction index */
 	cnetz_t			*cnetz;			/* pointer to cnetz instance */
 	int			callref;		/* callref for transaction */
 	uint8_t			futln_nat;		/* current station ID (3 values) */
@@ -70,6 +72,8 @@ transaction_t *search_transaction(cnetz_t *cnetz, uint64_t state_mask);
 transaction_t *search_transaction_number(cnetz_t *cnetz, uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest);
 transaction_t *search_transaction_number_global(uint8_t futln_nat, uint8_t futln_fuvst, uint16_t futln_rest);
 transaction_t *search_transaction_callref(cnetz_t *cnetz, int callref);
+transaction_t *search_transaction_callref_global(int callref);
+void trans_set_callref(transaction_t *trans, int callref);
 transaction_t *search_transaction_queue(void);
 void trans_new_state(transaction_t *trans, uint64_t state);
 void cnetz_flush_other_transactions(cnetz_t *cnetz, transaction_t *trans);
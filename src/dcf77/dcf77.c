@@ -28,6 +28,7 @@
 #include <math.h>
 #include "../liblogging/logging.h"
 #include "dcf77.h"
+#include "../libmobile/replay.h"
 #include "weather.h"
 
 double get_time(void);
@@ -1124,9 +1125,11 @@ static void rx_frame(dcf77_rx_t *rx, uint64_t frame)
 
 	if (minute >= 0 && hour >= 0 && day >= 0 && wday >= 0 && month >= 0 && year >= 0) {
 		LOGP(DDCF77, LOGL_NOTICE, "The received time is: %s %s %d %02d:%02d:00 %s 20%02d\n", week_day[wday], month_name[month], day, hour, minute, time_zone[zone], year);
+		replay_event(NULL, "time %s %s %d %02d:%02d:00 %s 20%02d", week_day[wday], month_name[month], day, hour, minute, time_zone[zone], year);
 		rx_weather(rx, minute, hour, zone, frame);
 	} else {
 		LOGP(DDCF77, LOGL_NOTICE, "The received time is invalid!\n");
+		replay_event(NULL, "time invalid");
 		rx_weather_reset(rx);
 	}
 }
@@ -1172,6 +1175,7 @@ static void rx_symbol(dcf77_t *dcf77, char symbol)
 				LOGP(DDSP, LOGL_INFO, "Received complete frame:\n");
 				LOGP(DDSP, LOGL_INFO, "0 Wetterdaten    Info 1 Minute P StundeP Tag    WoT Monat Jahr    P\n");
 				LOGP(DDSP, LOGL_INFO, "%s\n", rx->data_string);
+				replay_event(NULL, "frame %s", rx->data_string);
 				rx_frame(rx, rx->data_frame);
 				second = 0;
 			} else {
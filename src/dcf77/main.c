@@ -32,6 +32,8 @@
 #include "../liboptions/options.h"
 #include "../libsample/sample.h"
 #include "../libaaimage/aaimage.h"
+#include "../libmobile/get_time.h"
+#include "../libmobile/replay.h"
 #include <osmocom/cc/misc.h>
 #include "dcf77.h"
 #include "cities.h"
@@ -59,17 +61,10 @@ static int test_tone = 0;
 static int dsp_interval = 1; /* ms */
 static int rt_prio = 0;
 static int fast_math = 0;
-
-/* not static, in case we add libtimer some day, then compiler hits an error */
-double get_time(void);
-double get_time(void)
-{
-	static struct timespec tv;
-
-	clock_gettime(CLOCK_REALTIME, &tv);
-
-	return (double)tv.tv_sec + (double)tv.tv_nsec / 1000000000.0;
-}
+static const char *write_tx_wave = NULL;
+static const char *read_rx_wave = NULL;
+static wave_rec_t wave_tx_rec;
+static wave_play_t wave_rx_play;
 
 static time_t parse_time(char **argv)
 {
@@ -199,6 +194,18 @@ static void print_help(void)
 	printf("        Set prio: 0 to disable, 99 for maximum (default = %d)\n", rt_prio);
 	printf("    --fast-math\n");
 	printf("        Use fast math approximation for slow CPU / ARM based systems.\n");
+	printf("    --write-tx-wave <file>\n");
+	printf("        Write transmitted audio to given wave file.\n");
+	printf("    --read-rx-wave <file>\n");
+	printf("        Replace received audio by given wave file.\n");
+	printf("    --replay <seconds>\n");
+	printf("        Replace sound device by a virtual device and process given duration\n");
+	printf("        as fast as possible, using virtual time. Use '--read-rx-wave' to\n");
+	printf("        receive a recording, otherwise silence is received. Use 0 to stop at\n");
+	printf("        the end of the recording. Use '--write-tx-wave' to record what is\n");
+	printf("        transmitted.\n");
+	printf("    --event-log <file>\n");
+	printf("        Write received frames and time to given file.\n");
 	printf("\n");
 	printf("Press 'w' key to toggle display of RX wave form.\n");
 	printf("Press 'm' key to toggle display of measurement values.\n");
@@ -213,6 +220,10 @@ static void print_help(void)
 #define OPT_MUENSTER	1007
 #define OPT_TEST_TONE	1008
 #define OPT_FAST_MATH	1009
+#define OPT_WRITE_TX_WAVE	1010
+#define OPT_READ_RX_WAVE	1011
+#define OPT_REPLAY	1012
+#define OPT_EVENT_LOG	1013
 
 static void add_options(void)
 {
@@ -239,6 +250,10 @@ static void add_options(void)
 	option_add(OPT_TEST_TONE, "test-tone", 0);
 	option_add('r', "realtime", 1);
 	option_add(OPT_FAST_MATH, "fast-math", 0);
+	option_add(OPT_WRITE_TX_WAVE, "write-tx-wave", 1);
+	option_add(OPT_READ_RX_WAVE, "read-rx-wave", 1);
+	option_add(OPT_REPLAY, "replay", 1);
+	option_add(OPT_EVENT_LOG, "event-log", 1);
 }
 
 static const char *wind_dirs[8] = { "N", "NE", "E", "SE", "S", "SW", "W", "NW" };
@@ -377,6 +392,25 @@ no_multiple_weathers:
 	case OPT_FAST_MATH:
 		fast_math = 1;
 		break;
+	case OPT_WRITE_TX_WAVE:
+		write_tx_wave = options_strdup(argv[argi]);
+		break;
+	case OPT_READ_RX_WAVE:
+		read_rx_wave = options_strdup(argv[argi]);
+		break;
+	case OPT_REPLAY:
+		if (atof(argv[argi]) < 0.0) {
+			fprintf(stderr, "Replay duration must not be negative.\n");
+			return -EINVAL;
+		}
+		/* virtual time must start before the time stamp is taken */
+		replay_init(atof(argv[argi]));
+		break;
+	case OPT_EVENT_LOG:
+		rc = replay_event_open(argv[argi]);
+		if (rc < 0)
+			return rc;
+		break;
 	default:
 		return -EINVAL;
 	}
@@ -416,6 +450,13 @@ static int soundif_open(const char *audiodev, int samplerate, int buffer_size)
 {
 	enum sound_direction direction = SOUND_DIR_DUPLEX;
 
+	if (replay_on) {
+		soundif = replay_open(direction, audiodev, NULL, NULL, NULL, (double_amplitude) ? 2 : 1, 0.0, samplerate, buffer_size, 1.0, 1.0, 0.0, 2.0);
+		if (!soundif)
+			return -ENOMEM;
+		return 0;
+	}
+
 	if (!audiodev || !audiodev[0]) {
 		LOGP(DDSP, LOGL_ERROR, "No audio device given!\n");
 		return -EINVAL;
@@ -437,7 +478,10 @@ static int soundif_open(const char *audiodev, int samplerate, int buffer_size)
 
 static void soundif_start(void)
 {
-	sound_start(soundif);
+	if (replay_on)
+		replay_start(soundif);
+	else
+		sound_start(soundif);
 	LOGP(DDSP, LOGL_DEBUG, "Starting audio stream!\n");
 }
 
@@ -445,7 +489,10 @@ static void soundif_close(void)
 {
 	/* close audiodev */
 	if (soundif) {
-		sound_close(soundif);
+		if (replay_on)
+			replay_close(soundif);
+		else
+			sound_close(soundif);
 		soundif = NULL;
 	}
 }
@@ -460,18 +507,31 @@ static void soundif_work(int buffer_size)
 
 	if (tx) {
 		/* encode and write */
-		count = sound_get_tosend(soundif, buffer_size);
+		if (replay_on)
+			count = replay_get_tosend(soundif, buffer_size);
+		else
+			count = sound_get_tosend(soundif, buffer_size);
 		if (count < 0) {
 			LOGP(DDSP, LOGL_ERROR, "Failed to get number of samples in buffer (rc = %d)!\n", count);
 			return;
 		}
 		if (count) {
 			dcf77_encode(dcf77, samples[0], count);
+			/* when replaying, the file io thread must keep up with the main loop */
+			if (wave_tx_rec.fp) {
+				if (replay_on)
+					replay_wave_write(&wave_tx_rec, samples, count);
+				else
+					wave_write(&wave_tx_rec, samples, count);
+			}
 			if (double_amplitude) {
 				for (i = 0; i < count; i++)
 					samples[1][i] = -samples[0][i];
 			}
-			rc = sound_write(soundif, samples, NULL, count, NULL, NULL, (double_amplitude) ? 2 : 1);
+			if (replay_on)
+				rc = replay_write(soundif, samples, NULL, count, NULL, NULL, (double_amplitude) ? 2 : 1);
+			else
+				rc = sound_write(soundif, samples, NULL, count, NULL, NULL, (double_amplitude) ? 2 : 1);
 			if (rc < 0) {
 				LOGP(DDSP, LOGL_ERROR, "Failed to write TX data to audio device (rc = %d)\n", rc);
 				return;
@@ -481,12 +541,29 @@ static void soundif_work(int buffer_size)
 
 	if (rx) {
 		/* read */
-		count = sound_read(soundif, samples, buffer_size, 1, rf_level_db);
+		if (replay_on)
+			count = replay_read(soundif, samples, buffer_size, 1, rf_level_db);
+		else
+			count = sound_read(soundif, samples, buffer_size, 1, rf_level_db);
 		if (count < 0) {
+			/* replay wants us to quit */
+			if (count == -EPERM) {
+				quit = 1;
+				return;
+			}
 			LOGP(DDSP, LOGL_ERROR, "Failed to read from audio device (rc = %d)!\n", count);
 			return;
 		}
 
+		if (wave_rx_play.fp) {
+			if (replay_on) {
+				/* replay ends with the recording, process the last chunk */
+				if (replay_wave_read(&wave_rx_play, samples, count) < count)
+					quit = 1;
+			} else
+				wave_read(&wave_rx_play, samples, count);
+		}
+
 		/* decode */
 		dcf77_decode(dcf77, samples[0], count);
 	}
@@ -516,6 +593,11 @@ int main(int argc, char *argv[])
 		goto error;
 	}
 
+	if (replay_on && replay_length == 0.0 && !read_rx_wave) {
+		fprintf(stderr, "You selected replay until end of recording, but no recording is given. Use '--read-rx-wave'.\n");
+		goto error;
+	}
+
 	/* default to TX, if --tx and --rx was not set */
 	if (!tx && !rx)
 		tx = 1;
@@ -526,6 +608,23 @@ int main(int argc, char *argv[])
 	/* size of dsp buffer in samples */
 	buffer_size = dsp_samplerate * dsp_buffer / 1000;
 
+	if (write_tx_wave) {
+		rc = wave_create_record(&wave_tx_rec, write_tx_wave, dsp_samplerate, 1, 1.0);
+		if (rc < 0) {
+			fprintf(stderr, "Failed to create WAVE recoding instance!\n");
+			goto error;
+		}
+	}
+	if (read_rx_wave) {
+		int channels = 1;
+
+		rc = wave_create_playback(&wave_rx_play, read_rx_wave, &dsp_samplerate, &channels, 1.0);
+		if (rc < 0) {
+			fprintf(stderr, "Failed to create WAVE playback instance!\n");
+			goto error;
+		}
+	}
+
 	rc = soundif_open(dsp_device, dsp_samplerate, buffer_size);
 	if (rc < 0) {
 		printf("Failed to open sound for DCF77, use '-h' for help.\n");
@@ -617,7 +716,11 @@ int main(int argc, char *argv[])
 
 		now = get_time();
 
-		/* sleep interval */
+		/* sleep interval, replay does not sleep but advances virtual time */
+		if (replay_on) {
+			replay_tick((double)dsp_interval / 1000.0);
+			continue;
+		}
 		sleep = ((double)dsp_interval / 1000.0) - (now - begin_time);
 		if (sleep > 0)
 			usleep(sleep * 1000000.0);
@@ -648,6 +751,11 @@ error:
 
 	soundif_close();
 
+	wave_destroy_record(&wave_tx_rec);
+	wave_destroy_playback(&wave_rx_play);
+
+	replay_event_close();
+
 	dcf77_exit();
 
 	display_measurements_on(0);
@@ -29,6 +29,7 @@
 #include "../liblogging/logging.h"
 #include "../libmobile/call.h"
 #include "../libmobile/cause.h"
+#include "../libmobile/replay.h"
 #include <osmocom/cc/message.h>
 #include "eurosignal.h"
 #include "dsp.h"
@@ -261,6 +262,7 @@ int euro_create(const char *kanal, const char *device, int use_sdr, int samplera
 		LOGP(DEURO, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	euro->sender.destroy = euro_destroy;
 
 	/* init audio processing */
 	rc = dsp_init_sender(euro, samplerate, fm);
@@ -441,6 +443,7 @@ void euro_receive_id(euro_t *euro, char *id)
 		if (id[i] == 'R')
 			id[i] = id[i - 1];
 	}
+	replay_event(euro->sender.kanal, "id '%s'", id);
 
 	/* loopback display */
 	if (euro->sender.loopback) {
@@ -194,6 +194,7 @@ int fuenf_create(const char *kanal, double frequency, const char *device, int us
 		LOGP(DFUENF, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	fuenf->sender.destroy = fuenf_destroy;
 
 	/* init audio processing */
 	rc = dsp_init_sender(fuenf, samplerate, max_deviation, signal_deviation);
@@ -77,14 +77,40 @@ const char *cnetz_number_valid(const char *number)
 	return NULL;
 }
 
+/* the modem transfers bits, MTP is given octets, so frames are (de-)stuffed octet-wise */
+static int mtp_bit_out(fuvst_t *fuvst)
+{
+	int bit;
+
+	if (!fuvst->tx_bits) {
+		mtp_send_block(&fuvst->mtp, &fuvst->tx_octet, 1);
+		fuvst->tx_bits = 8;
+	}
+	bit = fuvst->tx_octet & 1;
+	fuvst->tx_octet >>= 1;
+	fuvst->tx_bits--;
+
+	return bit;
+}
+
+static void mtp_bit_in(fuvst_t *fuvst, int bit)
+{
+	fuvst->rx_octet |= bit << fuvst->rx_bits;
+	if (++fuvst->rx_bits == 8) {
+		mtp_receive_block(&fuvst->mtp, &fuvst->rx_octet, 1);
+		fuvst->rx_octet = 0;
+		fuvst->rx_bits = 0;
+	}
+}
+
 static int send_bit(void *inst)
 {
-	fuvst_t *fuvst = (fuvst_t *)inst;
+	fuvst_t __attribute__((unused)) *fuvst = (fuvst_t *)inst;
 
 #ifdef DIGITAL_LOOPBACK
 	return 0;
 #else
-	return mtp_send_bit(&fuvst->mtp);
+	return mtp_bit_out(fuvst);
 #endif
 }
 
@@ -92,9 +118,9 @@ static void receive_bit(void *inst, int bit)
 {
 	fuvst_t *fuvst = (fuvst_t *)inst;
 #ifdef DIGITAL_LOOPBACK
-	mtp_receive_bit(&fuvst->mtp, mtp_send_bit(&fuvst->mtp));
+	mtp_bit_in(fuvst, mtp_bit_out(fuvst));
 #else
-	mtp_receive_bit(&fuvst->mtp, bit);
+	mtp_bit_in(fuvst, bit);
 #endif
 }
 
@@ -1196,6 +1222,7 @@ int fuvst_create(const char *kanal, enum fuvst_chan_type chan_type, const char *
 		LOGP(DCNETZ, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	fuvst->sender.destroy = fuvst_destroy;
 	fuvst->chan_num = atoi(kanal);
 	fuvst->chan_type = chan_type;
 
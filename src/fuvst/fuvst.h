@@ -13,6 +13,10 @@ typedef struct fuvst {
 	sender_t		sender;
 	v27modem_t		modem;
 	mtp_t			mtp;
+	uint8_t			tx_octet;	/* octet from MTP, sent to modem bit by bit */
+	int			tx_bits;	/* bits of tx_octet not yet sent */
+	uint8_t			rx_octet;	/* bits from modem, given to MTP as octet */
+	int			rx_bits;	/* bits received in rx_octet */
 
 	int			chan_num; /* number of SPK or ZZK */
 	enum fuvst_chan_type	chan_type; /* ZZK or SPK */
@@ -38,6 +38,10 @@ typedef struct sniffer {
 	sender_t		sender;
 	v27modem_t		modem;
 	mtp_t			mtp;
+	uint8_t			tx_octet;	/* octet from MTP, sent to modem bit by bit */
+	int			tx_bits;	/* bits of tx_octet not yet sent */
+	uint8_t			rx_octet;	/* bits from modem, given to MTP as octet */
+	int			rx_bits;	/* bits received in rx_octet */
 	uint8_t			last_fsn;
 } sniffer_t;
 
@@ -135,23 +139,37 @@ static void receive_msu(mtp_t *mtp, uint8_t bsn, uint8_t bib, uint8_t fsn, uint8
 	sniffer->last_fsn = fsn;
 }
 
-/* a bit is sent to the modem */
+/* a bit is sent to the modem, MTP stuffs a whole octet */
 static int send_bit(void *inst)
 {
 	sniffer_t *sniffer = (sniffer_t *)inst;
+	int bit;
 
-	if (sniffer->sender.loopback)
-		return mtp_send_bit(&sniffer->mtp);
-	else
+	if (!sniffer->sender.loopback)
 		return 0;
+
+	if (!sniffer->tx_bits) {
+		mtp_send_block(&sniffer->mtp, &sniffer->tx_octet, 1);
+		sniffer->tx_bits = 8;
+	}
+	bit = sniffer->tx_octet & 1;
+	sniffer->tx_octet >>= 1;
+	sniffer->tx_bits--;
+
+	return bit;
 }
 
-/* a bit is received from the modem */
+/* a bit is received from the modem, MTP de-stuffs a whole octet */
 static void receive_bit(void *inst, int bit)
 {
 	sniffer_t *sniffer = (sniffer_t *)inst;
 
-	mtp_receive_bit(&sniffer->mtp, bit);
+	sniffer->rx_octet |= bit << sniffer->rx_bits;
+	if (++sniffer->rx_bits == 8) {
+		mtp_receive_block(&sniffer->mtp, &sniffer->rx_octet, 1);
+		sniffer->rx_octet = 0;
+		sniffer->rx_bits = 0;
+	}
 }
 
 /* Destroy transceiver instance and unlink from list. */
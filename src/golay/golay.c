@@ -61,6 +61,7 @@ int golay_create(const char *kanal, double frequency, const char *device, int us
 		LOGP(DGOLAY, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	gsc->sender.destroy = golay_destroy;
 
 	/* init audio processing */
 	rc = dsp_init_sender(gsc, samplerate, deviation, polarity);
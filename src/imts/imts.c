@@ -343,6 +343,7 @@ int imts_create(const char *kanal, const char *device, int use_sdr, int samplera
 		LOGP(DIMTS, LOGL_ERROR, "Failed to init 'Sender' processing!\n");
 		goto error;
 	}
+	imts->sender.destroy = imts_destroy;
 
 	/* init audio processing */
 	rc = dsp_init_transceiver(imts, squelch_db, ptt);
@@ -231,6 +231,7 @@ int jolly_create(const char *kanal, double dl_freq, double ul_freq, double step,
 		LOGP(DJOLLY, LOGL_ERROR, "Failed to init 'Sender' processing!\n");
 		goto error;
 	}
+	jolly->sender.destroy = jolly_destroy;
 
 	/* init audio processing */
 	rc = dsp_init_sender(jolly, nbfm, squelch_db, repeater);
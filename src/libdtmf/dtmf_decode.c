@@ -17,9 +17,31 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+/* The decoder uses a bank of Goertzel filters, one for each DTMF frequency.
+ * A window of 25.6 ms (Hann) is evaluated every quarter of its duration. For
+ * the strongest frequency of each group, these checks are done (ITU-T Q.24):
+ *
+ * - amplitude of both tones within limits
+ * - twist between both tones within limits
+ * - the other frequencies of each group are much lower
+ * - both tones carry most of the signal power (rejects speech and noise)
+ * - the second harmonic of the high tone is low (rejects speech)
+ * - the frequency is within margin, it is measured from the phase change
+ *   since the previous window
+ *
+ * A digit is detected, if consecutive windows pass these checks for the
+ * duration of time_detect and their amplitude is stable. The amplitude of a
+ * window that is only partly filled with the tone is lower, so short tones
+ * are not detected.
+ *
+ * The former decoder, which uses FM demodulators, is kept as dtmf_decode_fm().
+ */
+
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 #include <math.h>
 #include "../libsample/sample.h"
 #include "../liblogging/logging.h"
@@ -41,9 +63,21 @@
 
 static const char dtmf_digit[] = "     123A456B789C*0#D";
 
+static const double dtmf_frequency[DTMF_TONES] = {
+	DTMF_LOW_1, DTMF_LOW_2, DTMF_LOW_3, DTMF_LOW_4,
+	DTMF_HIGH_1, DTMF_HIGH_2, DTMF_HIGH_3, DTMF_HIGH_4,
+};
+
+#define DTMF_WINDOW		0.0256		/* duration of Goertzel window */
+#define DTMF_GROUP_RATIO	db2level(10.0)	/* tone is above other frequencies of its group */
+#define DTMF_POWER_RATIO	0.5		/* part of signal power, both tones must have */
+#define DTMF_HARMONIC_RATIO	db2level(-8.0)	/* second harmonic is below tone */
+#define DTMF_STABLE_RATIO	db2level(1.5)	/* amplitude change between windows of a tone */
+
 int dtmf_decode_init(dtmf_dec_t *dtmf, void *priv, void (*recv_digit)(void *priv, char digit, dtmf_meas_t *meas), int samplerate, double max_amplitude, double min_amplitude, double freq_margin)
 {
-	int rc;
+	double omega;
+	int rc, i;
 
 	memset(dtmf, 0, sizeof(*dtmf));
 	dtmf->priv = priv;
@@ -58,6 +92,38 @@ int dtmf_decode_init(dtmf_dec_t *dtmf, void *priv, void (*recv_digit)(void *priv
 	dtmf->time_meas = (int)(0.015 * (double)samplerate);
 	dtmf->time_pause = (int)(0.010 * (double)samplerate);
 
+	/* init Goertzel bank */
+	dtmf->window_size = (int)(DTMF_WINDOW * (double)samplerate);
+	dtmf->hop = dtmf->window_size / 4;
+	dtmf->window = calloc(dtmf->window_size, sizeof(*dtmf->window));
+	dtmf->buffer = calloc(dtmf->window_size, sizeof(*dtmf->buffer));
+	dtmf->windowed = calloc(dtmf->window_size, sizeof(*dtmf->windowed));
+	if (!dtmf->window || !dtmf->buffer || !dtmf->windowed) {
+		fprintf(stderr, "No mem!\n");
+		rc = -ENOMEM;
+		goto error;
+	}
+	for (i = 0; i < dtmf->window_size; i++) {
+		dtmf->window[i] = 0.5 - 0.5 * cos(2.0 * M_PI * ((double)i + 0.5) / (double)dtmf->window_size);
+		dtmf->window_sum += dtmf->window[i];
+		dtmf->window_square += dtmf->window[i] * dtmf->window[i];
+	}
+	for (i = 0; i < DTMF_TONES; i++) {
+		omega = 2.0 * M_PI * dtmf_frequency[i] / (double)samplerate;
+		dtmf->coeff[i] = 2.0 * cos(omega);
+		dtmf->cos_omega[i] = cos(omega);
+		dtmf->sin_omega[i] = sin(omega);
+		dtmf->coeff_harmonic[i] = 2.0 * cos(2.0 * omega);
+	}
+	/* the Hann window needs a tone for about half of its duration to get
+	 * full amplitude, the following windows are hop samples later */
+	dtmf->detect_windows = 1 + (dtmf->time_detect - dtmf->window_size / 2 + dtmf->hop - 1) / dtmf->hop;
+	if (dtmf->detect_windows < 2)
+		dtmf->detect_windows = 2;
+	dtmf->pause_windows = (dtmf->time_pause + dtmf->hop - 1) / dtmf->hop;
+	if (dtmf->pause_windows < 1)
+		dtmf->pause_windows = 1;
+
 	/* init fm demodulator */
 	rc = fm_demod_init(&dtmf->demod_low, (double)samplerate, (DTMF_LOW_1 + DTMF_LOW_4) / 2.0, DTMF_LOW_4 - DTMF_LOW_1);
 	if (rc < 0)
@@ -79,6 +145,12 @@ error:
 
 void dtmf_decode_exit(dtmf_dec_t *dtmf)
 {
+	free(dtmf->window);
+	dtmf->window = NULL;
+	free(dtmf->buffer);
+	dtmf->buffer = NULL;
+	free(dtmf->windowed);
+	dtmf->windowed = NULL;
 	fm_demod_exit(&dtmf->demod_low);
 	fm_demod_exit(&dtmf->demod_high);
 }
@@ -87,6 +159,8 @@ void dtmf_decode_reset(dtmf_dec_t *dtmf)
 {
 	dtmf->detected = 0;
 	dtmf->count = 0;
+	dtmf->candidate = 0;
+	dtmf->buffer_pos = 0;
 }
 
 void dtmf_decode_filter(dtmf_dec_t *dtmf, sample_t *samples, int length, sample_t *frequency_low, sample_t *frequency_high, sample_t *amplitude_low, sample_t *amplitude_high)
@@ -106,7 +180,209 @@ void dtmf_decode_filter(dtmf_dec_t *dtmf, sample_t *samples, int length, sample_
 	iir_process(&dtmf->freq_lp[0], frequency_low, length);
 	iir_process(&dtmf->freq_lp[1], frequency_high, length);
 }
+/* amplitude response of Hann window at given offset in bins */
+static double hann_response(double bins)
+{
+	double x = fabs(bins);
+
+	if (x < 1e-6)
+		return 1.0;
+	if (fabs(1.0 - x * x) < 1e-6)
+		return 0.5;
+	return fabs(sin(M_PI * x) / (M_PI * x) / (1.0 - x * x));
+}
+
+/* Goertzel power of given coefficient */
+static double goertzel_power(const sample_t *samples, int length, double coeff)
+{
+	double s, s1 = 0.0, s2 = 0.0;
+	int i;
+
+	for (i = 0; i < length; i++) {
+		s = samples[i] + coeff * s1 - s2;
+		s2 = s1;
+		s1 = s;
+	}
+
+	return s1 * s1 + s2 * s2 - coeff * s1 * s2;
+}
+
+/* Evaluate window of samples, return digit or 0. Stable is set, if the
+ * amplitudes did not change since the previous window.
+ */
+static char dtmf_window(dtmf_dec_t *dtmf, double *amplitude, double *offset, int *stable)
+{
+	sample_t *windowed = dtmf->windowed;
+	int n = dtmf->window_size;
+	double s[DTMF_TONES], s1[DTMF_TONES], s2[DTMF_TONES];
+	double re[DTMF_TONES], im[DTMF_TONES], amp[DTMF_TONES], last_amp[DTMF_TONES];
+	double power = 0.0, x, phase, margin, freq, harmonic;
+	int tone[2], measured[2], i, k, g;
+	char digit = 0;
+
+	/* all eight filters in one pass over the windowed samples */
+	for (k = 0; k < DTMF_TONES; k++)
+		s1[k] = s2[k] = 0.0;
+	for (i = 0; i < n; i++) {
+		x = dtmf->buffer[i] * dtmf->window[i];
+		windowed[i] = x;
+		power += x * x;
+		for (k = 0; k < DTMF_TONES; k++) {
+			s[k] = x + dtmf->coeff[k] * s1[k] - s2[k];
+			s2[k] = s1[k];
+			s1[k] = s[k];
+		}
+	}
+	/* power of a sine wave with peak amplitude 1 is 0.5 */
+	power /= dtmf->window_square;
+
+	for (k = 0; k < DTMF_TONES; k++) {
+		re[k] = s1[k] - dtmf->cos_omega[k] * s2[k];
+		im[k] = dtmf->sin_omega[k] * s2[k];
+		amp[k] = sqrt(re[k] * re[k] + im[k] * im[k]) * 2.0 / dtmf->window_sum;
+	}
+
+	/* strongest frequency of each group */
+	for (g = 0; g < 2; g++) {
+		tone[g] = g * 4;
+		for (k = g * 4 + 1; k < g * 4 + 4; k++) {
+			if (amp[k] > amp[tone[g]])
+				tone[g] = k;
+		}
+	}
+
+	*stable = 1;
+	for (g = 0; g < 2; g++) {
+		k = tone[g];
+		last_amp[k] = sqrt(dtmf->last_re[k] * dtmf->last_re[k] + dtmf->last_im[k] * dtmf->last_im[k]) * 2.0 / dtmf->window_sum;
+		if (amp[k] > last_amp[k] * DTMF_STABLE_RATIO || amp[k] * DTMF_STABLE_RATIO < last_amp[k])
+			*stable = 0;
+		/* frequency offset from phase change since the previous window,
+		 * the tone must have been there before */
+		offset[g] = 0.0;
+		measured[g] = 0;
+		if (last_amp[k] > amp[k] * 0.5) {
+			phase = atan2(im[k] * dtmf->last_re[k] - re[k] * dtmf->last_im[k], re[k] * dtmf->last_re[k] + im[k] * dtmf->last_im[k]);
+			phase -= 2.0 * M_PI * dtmf_frequency[k] * (double)dtmf->hop / (double)dtmf->samplerate;
+			phase = remainder(phase, 2.0 * M_PI);
+			offset[g] = phase / 2.0 * M_1_PI * (double)dtmf->samplerate / (double)dtmf->hop;
+			measured[g] = 1;
+		}
+		/* correct amplitude drop of window, when frequency is off */
+		amplitude[g] = amp[k] / hann_response(offset[g] * (double)n / (double)dtmf->samplerate);
+	}
+	memcpy(dtmf->last_re, re, sizeof(re));
+	memcpy(dtmf->last_im, im, sizeof(im));
+
+	/* amplitude limits */
+	if (amplitude[0] > dtmf->max_amplitude || amplitude[0] < dtmf->min_amplitude
+	 || amplitude[1] > dtmf->max_amplitude || amplitude[1] < dtmf->min_amplitude)
+		return 0;
+	/* twist */
+	if (amplitude[1] / amplitude[0] > dtmf->forward_twist || amplitude[0] / amplitude[1] > dtmf->reverse_twist)
+		return 0;
+	margin = dtmf->freq_margin / 100.0 + 1.0;
+	for (g = 0; g < 2; g++) {
+		/* frequency margin, if it can be measured */
+		freq = dtmf_frequency[tone[g]] + offset[g];
+		if (measured[g] && (freq < dtmf_frequency[tone[g]] / margin || freq > dtmf_frequency[tone[g]] * margin))
+			return 0;
+		/* other frequencies of the group */
+		for (k = g * 4; k < g * 4 + 4; k++) {
+			if (k != tone[g] && amp[k] * DTMF_GROUP_RATIO > amp[tone[g]])
+				return 0;
+		}
+	}
+	/* both tones carry the signal power */
+	if ((amp[tone[0]] * amp[tone[0]] + amp[tone[1]] * amp[tone[1]]) / 2.0 < power * DTMF_POWER_RATIO)
+		return 0;
+	/* second harmonic of the high tone, it is only calculated for a tone
+	 * that passed all other checks. (The second harmonics of the low tones
+	 * are too close to the high tones.) */
+	harmonic = sqrt(goertzel_power(windowed, n, dtmf->coeff_harmonic[tone[1]])) * 2.0 / dtmf->window_sum;
+	if (harmonic > amp[tone[1]] * DTMF_HARMONIC_RATIO)
+		return 0;
+
+	digit = dtmf_digit[(tone[0] + 1) * 4 + (tone[1] - 3)];
+#ifdef DEBUG_DTMF
+	printf("DTMF tone='%c' diff frequency=%.1f %.1f amplitude=%.1f %.1f dB twist=%.1f dB\n", digit, offset[0], offset[1], level2db(amplitude[0]), level2db(amplitude[1]), level2db(amplitude[1] / amplitude[0]));
+#endif
+
+	return digit;
+}
+
+/* process window and detect digit */
+static void dtmf_detect(dtmf_dec_t *dtmf)
+{
+	double amplitude[2], offset[2];
+	int stable;
+	char digit;
+
+	digit = dtmf_window(dtmf, amplitude, offset, &stable);
+
+	if (!dtmf->detected) {
+		if (!digit || digit != dtmf->candidate || !stable) {
+			/* this window may be the first of a tone */
+			dtmf->candidate = digit;
+			dtmf->count = (digit) ? 1 : 0;
+			memset(&dtmf->meas, 0, sizeof(dtmf->meas));
+			return;
+		}
+		dtmf->meas.frequency_low += offset[0];
+		dtmf->meas.frequency_high += offset[1];
+		dtmf->meas.amplitude_low += amplitude[0];
+		dtmf->meas.amplitude_high += amplitude[1];
+		dtmf->meas.count++;
+		if (++dtmf->count < dtmf->detect_windows)
+			return;
+		dtmf->detected = digit;
+		dtmf->candidate = 0;
+		dtmf->count = 0;
+		dtmf->meas.frequency_low /= dtmf->meas.count;
+		dtmf->meas.frequency_high /= dtmf->meas.count;
+		dtmf->meas.amplitude_low /= dtmf->meas.count;
+		dtmf->meas.amplitude_high /= dtmf->meas.count;
+		dtmf->meas.count = 1;
+		dtmf->recv_digit(dtmf->priv, digit, &dtmf->meas);
+	} else {
+		if (digit == dtmf->detected) {
+			dtmf->count = 0;
+			return;
+		}
+		if (++dtmf->count >= dtmf->pause_windows) {
+			dtmf->detected = 0;
+			dtmf->count = 0;
+#ifdef DEBUG_DTMF
+			printf("lost!\n");
+#endif
+		}
+	}
+}
+
 void dtmf_decode(dtmf_dec_t *dtmf, sample_t *samples, int length)
+{
+	int pos = dtmf->buffer_pos, copy;
+
+	while (length) {
+		copy = dtmf->window_size - pos;
+		if (copy > length)
+			copy = length;
+		memcpy(dtmf->buffer + pos, samples, copy * sizeof(*samples));
+		samples += copy;
+		length -= copy;
+		pos += copy;
+		if (pos < dtmf->window_size)
+			break;
+		dtmf_detect(dtmf);
+		/* slide window */
+		pos -= dtmf->hop;
+		memmove(dtmf->buffer, dtmf->buffer + dtmf->hop, pos * sizeof(*dtmf->buffer));
+	}
+	dtmf->buffer_pos = pos;
+}
+
+/* former decoder, kept for comparison */
+void dtmf_decode_fm(dtmf_dec_t *dtmf, sample_t *samples, int length)
 {
 	sample_t frequency_low[length], amplitude_low[length];
 	sample_t frequency_high[length], amplitude_high[length];
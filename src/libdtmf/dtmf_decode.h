@@ -2,6 +2,8 @@
 
 #define DTMF_FREQ_MARGIN_PERCENT_DEFAULT	3	/* 1.8 .. 3.5 % */
 
+#define DTMF_TONES	8	/* four low and four high frequencies */
+
 typedef struct dtmf_meas {
 	double		frequency_low;
 	double		frequency_high;
@@ -22,6 +24,25 @@ typedef struct dtmf_dec {
 	int		time_detect;
 	int		time_meas;
 	int		time_pause;
+	/* Goertzel bank */
+	int		window_size;		/* samples of one window */
+	int		hop;			/* a window is evaluated every hop samples */
+	sample_t	*window;		/* window function */
+	double		window_sum;		/* sum of window function (amplitude of a tone) */
+	double		window_square;		/* sum of squared window function (power of signal) */
+	sample_t	*buffer;		/* samples of current window */
+	sample_t	*windowed;		/* samples multiplied with window function */
+	int		buffer_pos;		/* number of samples in buffer */
+	double		coeff[DTMF_TONES];	/* 2 * cos(omega) of each tone */
+	double		cos_omega[DTMF_TONES];	/* cos(omega) of each tone */
+	double		sin_omega[DTMF_TONES];	/* sin(omega) of each tone */
+	double		coeff_harmonic[DTMF_TONES]; /* 2 * cos(2 * omega) of second harmonic */
+	double		last_re[DTMF_TONES];	/* result of previous window to get phase */
+	double		last_im[DTMF_TONES];
+	int		detect_windows;		/* consecutive windows to detect a digit */
+	int		pause_windows;		/* consecutive windows to detect a pause */
+	char		candidate;		/* digit of previous windows, if not yet detected */
+	/* former decoder, using FM demodulators */
 	fm_demod_t	demod_low;		/* demodulator for low frequencies */
 	fm_demod_t	demod_high;		/* demodulator for high frequencies */
 	iir_filter_t	freq_lp[2];		/* low pass to filter the frequency result */
@@ -34,5 +55,6 @@ int dtmf_decode_init(dtmf_dec_t *dtmf, void *priv, void (*recv_digit)(void *priv
 void dtmf_decode_exit(dtmf_dec_t *dtmf);
 void dtmf_decode_reset(dtmf_dec_t *dtmf);
 void dtmf_decode(dtmf_dec_t *dtmf, sample_t *samples, int length);
+void dtmf_decode_fm(dtmf_dec_t *dtmf, sample_t *samples, int length);
 void dtmf_decode_filter(dtmf_dec_t *dtmf, sample_t *samples, int length, sample_t *frequency_low, sample_t *frequency_high, sample_t *amplitude_low, sample_t *amplitude_high);
 
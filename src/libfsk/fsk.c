@@ -47,7 +47,7 @@
  */
 int fsk_mod_init(fsk_mod_t *fsk, void *inst, int (*send_bit)(void *inst), int samplerate, double bitrate, double f0, double f1, double level, int ffsk, int filter)
 {
-	double temp;
+	double temp, samples_per_bit;
 	int i;
 	int rc;
 
@@ -142,6 +142,22 @@ int fsk_mod_init(fsk_mod_t *fsk, void *inst, int (*send_bit)(void *inst), int sa
 		fsk->filter = 1;
 	}
 
+	/* if a bit has an integer number of samples, each bit starts at a
+	 * sample. then the waveform of a bit only depends on the last bit,
+	 * the current bit and the start phase, so it can be cached.
+	 */
+	samples_per_bit = (double)samplerate / bitrate;
+	if (fabs(samples_per_bit - round(samples_per_bit)) < 0.000001) {
+		fsk->cache_samples = (int)round(samples_per_bit);
+		fsk->cache_scratch.samples = calloc(fsk->cache_samples, sizeof(*fsk->cache_scratch.samples));
+		if (!fsk->cache_scratch.samples) {
+			fprintf(stderr, "No mem!\n");
+			rc = -ENOMEM;
+			goto error;
+		}
+		LOGP(DDSP, LOGL_DEBUG, "Use cache for waveforms of %d samples per bit.\n", fsk->cache_samples);
+	}
+
 	/* must reset, because bit states must be initialized */
 	fsk_mod_reset(fsk);
 
@@ -155,8 +171,24 @@ error:
 /* Cleanup transceiver instance. */
 void fsk_mod_cleanup(fsk_mod_t *fsk)
 {
+	int i, j, k;
+
 	LOGP(DDSP, LOGL_DEBUG, "Cleanup FSK for Transmitter.\n");
 
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 2; j++) {
+			for (k = 0; k < fsk->cache_num[i][j]; k++) {
+				free(fsk->cache[i][j][k].samples);
+				fsk->cache[i][j][k].samples = NULL;
+			}
+			fsk->cache_num[i][j] = 0;
+		}
+	}
+	if (fsk->cache_scratch.samples) {
+		free(fsk->cache_scratch.samples);
+		fsk->cache_scratch.samples = NULL;
+	}
+
 	if (fsk->sin_tab) {
 		free(fsk->sin_tab);
 		fsk->sin_tab = NULL;
@@ -168,13 +200,194 @@ void fsk_mod_cleanup(fsk_mod_t *fsk)
 	}
 }
 
+/* Use send_bits() instead of send_bit() to request multiple bits at once.
+ *
+ * The callback function shall store up to 'max' bits into given buffer, MSB
+ * first, and return the number of bits. If there is no (more) data to be
+ * transmitted, it shall return -1.
+ *
+ * Note that bits are requested when the first of them is about to be
+ * transmitted. The remaining bits cannot be changed afterwards, except by
+ * resetting the modulator.
+ */
+void fsk_mod_set_send_bits(fsk_mod_t *fsk, int (*send_bits)(void *inst, uint8_t *bits, int max))
+{
+	fsk->send_bits = send_bits;
+	fsk->tx_bits_num = 0;
+	fsk->tx_bits_pos = 0;
+}
+
+/* get next bit from send_bits() buffer or from send_bit() */
+static int get_bit(fsk_mod_t *fsk)
+{
+	int num, pos;
+
+	if (!fsk->send_bits)
+		return fsk->send_bit(fsk->inst);
+
+	if (fsk->tx_bits_pos == fsk->tx_bits_num) {
+		num = fsk->send_bits(fsk->inst, fsk->tx_bits, FSK_TX_BITS);
+		if (num <= 0) {
+			fsk->tx_bits_num = 0;
+			fsk->tx_bits_pos = 0;
+			return -1;
+		}
+		if (num > FSK_TX_BITS)
+			num = FSK_TX_BITS;
+		fsk->tx_bits_num = num;
+		fsk->tx_bits_pos = 0;
+	}
+
+	pos = fsk->tx_bits_pos++;
+	return (fsk->tx_bits[pos >> 3] >> (7 - (pos & 7))) & 1;
+}
+
+/* render waveform of one bit into given cache entry */
+static void render_wave(fsk_mod_t *fsk, fsk_wave_t *wave, double phase, int last_bit, int bit)
+{
+	double bitpos = 0.0, start = phase;
+	const double *phase_tab = NULL;
+	int i;
+
+	if (fsk->filter && last_bit >= 0 && last_bit != bit)
+		phase_tab = (bit > last_bit) ? fsk->phase_tab_0_1 : fsk->phase_tab_1_0;
+
+	wave->phase = (uint16_t)phase;
+	for (i = 0; i < fsk->cache_samples; i++) {
+		wave->samples[i] = fsk->sin_tab[(uint16_t)phase];
+		if (phase_tab)
+			phase += phase_tab[(uint16_t)bitpos];
+		else
+			phase += fsk->phaseshift65536[bit];
+		if (phase >= 65536.0)
+			phase -= 65536.0;
+		bitpos += fsk->bits65536_per_sample;
+	}
+	phase -= start;
+	if (phase < 0.0)
+		phase += 65536.0;
+	wave->phase_advance = phase;
+}
+
+/* find waveform in cache, add it, if not found */
+static fsk_wave_t *get_wave(fsk_mod_t *fsk, double phase, int last_bit, int bit)
+{
+	fsk_wave_t *wave;
+	uint16_t key = (uint16_t)phase;
+	int l, i, num;
+
+	/* without filter, the last bit does not matter */
+	l = (fsk->filter) ? last_bit + 1 : 0;
+
+	num = fsk->cache_num[l][bit];
+	wave = fsk->cache[l][bit];
+	for (i = 0; i < num; i++, wave++) {
+		if (wave->phase == key)
+			return wave;
+	}
+
+	/* cache is full, render into scratch buffer */
+	if (num == FSK_CACHE_PHASES) {
+		wave = &fsk->cache_scratch;
+		render_wave(fsk, wave, phase, last_bit, bit);
+		return wave;
+	}
+
+	wave->samples = calloc(fsk->cache_samples, sizeof(*wave->samples));
+	if (!wave->samples) {
+		wave = &fsk->cache_scratch;
+		render_wave(fsk, wave, phase, last_bit, bit);
+		return wave;
+	}
+	render_wave(fsk, wave, phase, last_bit, bit);
+	fsk->cache_num[l][bit]++;
+
+	return wave;
+}
+
+/* modulate bits using cached waveforms
+ *
+ * After a bit has been transmitted, the start phase of the bit is advanced by
+ * the phase change of the waveform. When returning within a bit, the current
+ * phase is interpolated, so others (like the am791x STO signal) can continue
+ * with that phase.
+ */
+static int fsk_mod_send_cached(fsk_mod_t *fsk, sample_t *sample, int length, int add)
+{
+	int count = 0, copy, i;
+	const sample_t *spl;
+	double phase;
+
+	phase = fsk->tx_phase65536;
+
+	while (count < length) {
+		/* get next bit */
+		if (!fsk->tx_wave) {
+			fsk->tx_last_bit = fsk->tx_bit;
+			fsk->tx_bit = get_bit(fsk);
+#ifdef DEBUG_MODULATOR
+			printf("bit change from %d to %d\n", fsk->tx_last_bit, fsk->tx_bit);
+#endif
+			if (fsk->tx_bit < 0) {
+				fsk_mod_reset(fsk);
+				return count;
+			}
+			fsk->tx_bit &= 1;
+			/* correct phase when changing bit */
+			if (fsk->ffsk) {
+				/* round phase to nearest zero crossing */
+				if (phase > 16384.0 && phase < 49152.0)
+					phase = 32768.0;
+				else
+					phase = 0;
+			}
+			fsk->tx_wave = get_wave(fsk, phase, fsk->tx_last_bit, fsk->tx_bit);
+			fsk->tx_wave_pos = 0;
+			fsk->tx_wave_phase65536 = phase;
+		}
+
+		/* copy waveform */
+		copy = fsk->cache_samples - fsk->tx_wave_pos;
+		if (copy > length - count)
+			copy = length - count;
+		spl = fsk->tx_wave->samples + fsk->tx_wave_pos;
+		if (add) {
+			for (i = 0; i < copy; i++)
+				sample[count + i] += spl[i];
+		} else
+			memcpy(sample + count, spl, copy * sizeof(*sample));
+		count += copy;
+		fsk->tx_wave_pos += copy;
+
+		/* bit is complete */
+		if (fsk->tx_wave_pos == fsk->cache_samples) {
+			phase = fsk->tx_wave_phase65536 + fsk->tx_wave->phase_advance;
+			if (phase >= 65536.0)
+				phase -= 65536.0;
+			fsk->tx_wave = NULL;
+		}
+	}
+
+	if (fsk->tx_wave) {
+		phase = fsk->tx_wave_phase65536 + fsk->tx_wave->phase_advance * (double)fsk->tx_wave_pos / (double)fsk->cache_samples;
+		if (phase >= 65536.0)
+			phase -= 65536.0;
+	}
+	fsk->tx_phase65536 = phase;
+
+	return count;
+}
+
 /* modulate bits
  *
  * If first/next bit is required, callback function send_bit() is called.
+ * If send_bits() is set, multiple bits are requested at once instead.
  * If there is no (more) data to be transmitted, the callback functions shall
  * return -1. In this case, this function stops and returns the number of
  * samples that have been rendered so far, if any.
  *
+ * If a bit has an integer number of samples, cached waveforms are used.
+ *
  * For FFSK mode, we round the phase on every bit change to the
  * next zero crossing. This prevents phase shifts due to rounding errors.
  */
@@ -183,13 +396,16 @@ int fsk_mod_send(fsk_mod_t *fsk, sample_t *sample, int length, int add)
 	int count = 0;
 	double phase, phaseshift;
 
+	if (fsk->cache_samples)
+		return fsk_mod_send_cached(fsk, sample, length, add);
+
 	phase = fsk->tx_phase65536;
 
 	/* get next bit */
 	if (fsk->tx_bit < 0) {
 next_bit:
 		fsk->tx_last_bit = fsk->tx_bit;
-		fsk->tx_bit = fsk->send_bit(fsk->inst);
+		fsk->tx_bit = get_bit(fsk);
 #ifdef DEBUG_MODULATOR
 		printf("bit change from %d to %d\n", fsk->tx_last_bit, fsk->tx_bit);
 #endif
@@ -298,6 +514,10 @@ void fsk_mod_reset(fsk_mod_t *fsk)
 	fsk->tx_bitpos65536 = 0.0;
 	fsk->tx_bit = -1;
 	fsk->tx_last_bit = -1;
+	fsk->tx_bits_num = 0;
+	fsk->tx_bits_pos = 0;
+	fsk->tx_wave = NULL;
+	fsk->tx_wave_pos = 0;
 }
 
 /*
@@ -358,6 +578,112 @@ void fsk_demod_cleanup(fsk_demod_t *fsk)
 	fm_demod_exit(&fsk->demod);
 }
 
+/* Deliver received bits in chunks instead of calling receive_bit().
+ *
+ * All bits that are received during one call of fsk_demod_receive() are
+ * written into the given ring buffer. Then receive_bits() is called once
+ * with the position of the first new bit and the number of new bits. If half
+ * of the ring buffer is filled, receive_bits() is called earlier. So at least
+ * half of the ring before the first new bit holds previous bits, the user may
+ * look back at them, e.g. to average the quality of a sync word.
+ *
+ * Quality and level are the same values as given to receive_bit(), so a
+ * decoder may use either way and get the same result. Bits that are caused by
+ * a premature level change (see below) get a soft value of 128.
+ */
+void fsk_demod_set_receive_bits(fsk_demod_t *fsk, void (*receive_bits)(void *inst, fsk_rx_ring_t *ring, int pos, int num), fsk_rx_ring_t *ring)
+{
+	if (ring && (ring->size < 16 || (ring->size & 7))) {
+		LOGP(DDSP, LOGL_ERROR, "Size of ring must be a multiple of 8 and at least 16, please fix!\n");
+		abort();
+	}
+	fsk->receive_bits = receive_bits;
+	fsk->ring = ring;
+	fsk->ring_num = 0;
+	if (ring) {
+		ring->pos = 0;
+		memset(ring->bits, 0, ring->size >> 3);
+	}
+}
+
+/* Return num bits (up to 32) from ring, starting at pos, first bit is MSB. */
+uint32_t fsk_rx_ring_word(const fsk_rx_ring_t *ring, int pos, int num)
+{
+	uint32_t word = 0;
+	int shift, take;
+
+	while (num) {
+		shift = pos & 7;
+		take = 8 - shift;
+		if (take > num)
+			take = num;
+		word = (word << take) | ((ring->bits[pos >> 3] >> (8 - shift - take)) & ((1 << take) - 1));
+		num -= take;
+		pos += take;
+		if (pos == ring->size)
+			pos = 0;
+	}
+
+	return word;
+}
+
+/* deliver pending bits of ring */
+static void flush_bits(fsk_demod_t *fsk)
+{
+	fsk_rx_ring_t *ring = fsk->ring;
+	int num = fsk->ring_num;
+
+	if (!num)
+		return;
+	fsk->ring_num = 0;
+	fsk->receive_bits(fsk->inst, ring, fsk_rx_ring_pos(ring, ring->pos, -num), num);
+}
+
+/* forward bit to user: either store to ring or call receive_bit() */
+static inline void output_bit(fsk_demod_t *fsk, int bit, double quality, double level, double f, int premature)
+{
+	fsk_rx_ring_t *ring = fsk->ring;
+	double soft;
+	int pos;
+
+	if (!fsk->receive_bits) {
+		fsk->receive_bit(fsk->inst, bit, quality, level);
+		return;
+	}
+
+	pos = ring->pos;
+	if (bit)
+		ring->bits[pos >> 3] |= 0x80 >> (pos & 7);
+	else
+		ring->bits[pos >> 3] &= ~(0x80 >> (pos & 7));
+	if (ring->soft) {
+		if (premature) {
+			/* unknown, see premature level change */
+			ring->soft[pos] = 128;
+		} else {
+			/* map frequency of bit 0 .. bit 1 to soft value 0 .. 255 */
+			soft = (f - fsk->f0_deviation) / (fsk->f1_deviation - fsk->f0_deviation) * 255.0;
+			if (soft < 0.0)
+				soft = 0.0;
+			if (soft > 255.0)
+				soft = 255.0;
+			ring->soft[pos] = (uint8_t)(soft + 0.5);
+		}
+	}
+	if (ring->quality)
+		ring->quality[pos] = quality;
+	if (ring->level)
+		ring->level[pos] = level;
+	if (ring->time)
+		ring->time[pos] = fsk->rx_sample_count;
+	if (++pos == ring->size)
+		pos = 0;
+	ring->pos = pos;
+
+	if (++fsk->ring_num == ring->size / 2)
+		flush_bits(fsk);
+}
+
 //#define DEBUG_MODULATOR
 //#define DEBUG_FILTER
 
@@ -374,6 +700,8 @@ void fsk_demod_cleanup(fsk_demod_t *fsk)
  * This can cause bit slips.
  * Therefore we change the sample counter only slightly, so bit slips may not
  * happen so quickly.
+ *
+ * If receive_bits() is set, all bits of this call are delivered at once.
  */
 void fsk_demod_receive(fsk_demod_t *fsk, sample_t *sample, int length)
 {
@@ -426,7 +754,7 @@ void fsk_demod_receive(fsk_demod_t *fsk, sample_t *sample, int length)
 				printf("prematurely bit change (level=%.3f)\n", level);
 #endif
 				/* quality is 0.0, because a prematurely level change is caused by noise and has nothing to measure. */
-				fsk->receive_bit(fsk->inst, fsk->rx_bit, 0.0, level);
+				output_bit(fsk, fsk->rx_bit, 0.0, level, f, 1);
 			}
 			fsk->rx_change = 1;
 		}
@@ -446,11 +774,15 @@ void fsk_demod_receive(fsk_demod_t *fsk, sample_t *sample, int length)
 #ifdef DEBUG_FILTER
 			printf("sample (level=%.3f, quality=%.3f)\n", level, quality);
 #endif
-			fsk->receive_bit(fsk->inst, bit, quality, level);
+			output_bit(fsk, bit, quality, level, f, 0);
 			fsk->rx_bitpos -= 1.0;
 			fsk->rx_change = 0;
 		}
 		fsk->rx_bitpos += fsk->bits_per_sample;
+		fsk->rx_sample_count++;
 	}
+
+	if (fsk->receive_bits)
+		flush_bits(fsk);
 }
 
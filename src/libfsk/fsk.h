@@ -3,9 +3,23 @@
 
 #include "../libfm/fm.h"
 
+#define FSK_TX_BITS		256	/* number of bits to request from send_bits() */
+#define FSK_CACHE_PHASES	32	/* number of start phases to cache for each pair of bits */
+
+/* waveform of one bit, starting at given phase */
+typedef struct fsk_wave {
+	uint16_t	phase;			/* start phase of waveform */
+	double		phase_advance;		/* how much the phase changes during one bit */
+	sample_t	*samples;		/* samples of one bit */
+} fsk_wave_t;
+
 typedef struct fsk_mod {
 	void		*inst;
 	int (*send_bit)(void *inst);
+	int (*send_bits)(void *inst, uint8_t *bits, int max);
+	uint8_t		tx_bits[FSK_TX_BITS / 8]; /* packed bits (MSB first) received from send_bits() */
+	int		tx_bits_num;		/* number of bits in buffer */
+	int		tx_bits_pos;		/* next bit to transmit from buffer */
 	double		bits65536_per_sample;	/* fraction of a bit per sample */
 	double		*sin_tab;		/* sine table with correct peak level */
 	double		*phase_tab_0_1;		/* cosine shaped phase table (bit 0 to 1) */
@@ -22,11 +36,35 @@ typedef struct fsk_mod {
 	int		tx_last_bit;		/* last transmitting bit (-1 if not set) */
 	double		tx_bitpos65536;		/* current transmit position in bit */
 	int		filter;			/* set, if filters are used */
+	/* waveform cache, only if a bit has an integer number of samples */
+	int		cache_samples;		/* samples per bit (0 if cache is not used) */
+	fsk_wave_t	cache[3][2][FSK_CACHE_PHASES]; /* cached waveforms [last bit + 1][bit][n] */
+	int		cache_num[3][2];	/* number of cached waveforms */
+	fsk_wave_t	cache_scratch;		/* waveform used, if cache is full */
+	fsk_wave_t	*tx_wave;		/* waveform of current bit */
+	int		tx_wave_pos;		/* current sample position in waveform */
+	double		tx_wave_phase65536;	/* start phase of current waveform */
 } fsk_mod_t;
 
+/* ring buffer for received bits, supplied by the user of the demodulator
+ * all arrays except bits may be NULL, if not needed */
+typedef struct fsk_rx_ring {
+	uint8_t		*bits;			/* packed hard bits, MSB first */
+	uint8_t		*soft;			/* soft value of each bit (0 = bit 0, 255 = bit 1) */
+	double		*quality;		/* quality of each bit, as given to receive_bit() */
+	double		*level;			/* level of each bit, as given to receive_bit() */
+	uint64_t	*time;			/* sample count when each bit was sampled */
+	int		size;			/* number of bits in ring, a multiple of 8, at least 16 */
+	int		pos;			/* position of next bit to write */
+} fsk_rx_ring_t;
+
 typedef struct fsk_demod {
 	void		*inst;
 	void (*receive_bit)(void *inst, int bit, double quality, double level);
+	void (*receive_bits)(void *inst, fsk_rx_ring_t *ring, int pos, int num);
+	fsk_rx_ring_t	*ring;			/* ring buffer for receive_bits() */
+	int		ring_num;		/* number of bits not yet delivered */
+	uint64_t	rx_sample_count;	/* counts received samples */
 	fm_demod_t	demod;
 	double		bits_per_sample;	/* fraction of a bit per sample */
 	double		f0_deviation;		/* deviation of frequencies, relative to center */
@@ -40,10 +78,24 @@ typedef struct fsk_demod {
 
 int fsk_mod_init(fsk_mod_t *fsk, void *inst, int (*send_bit)(void *inst), int samplerate, double bitrate, double f0, double f1, double level, int coherent, int filter);
 void fsk_mod_cleanup(fsk_mod_t *fsk);
+void fsk_mod_set_send_bits(fsk_mod_t *fsk, int (*send_bits)(void *inst, uint8_t *bits, int max));
 int fsk_mod_send(fsk_mod_t *fsk, sample_t *sample, int length, int add);
 void fsk_mod_reset(fsk_mod_t *fsk);
 int fsk_demod_init(fsk_demod_t *fsk, void *inst, void (*receive_bit)(void *inst, int bit, double quality, double level), int samplerate, double bitrate, double f0, double f1, double bitadjust);
 void fsk_demod_cleanup(fsk_demod_t *fsk);
+void fsk_demod_set_receive_bits(fsk_demod_t *fsk, void (*receive_bits)(void *inst, fsk_rx_ring_t *ring, int pos, int num), fsk_rx_ring_t *ring);
 void fsk_demod_receive(fsk_demod_t *fsk, sample_t *sample, int length);
+uint32_t fsk_rx_ring_word(const fsk_rx_ring_t *ring, int pos, int num);
+
+/* position in ring, num bits after given position (num may be negative) */
+static inline int fsk_rx_ring_pos(const fsk_rx_ring_t *ring, int pos, int num)
+{
+	pos += num;
+	while (pos < 0)
+		pos += ring->size;
+	while (pos >= ring->size)
+		pos -= ring->size;
+	return pos;
+}
 
 #endif /* _LIB_FSK_H */
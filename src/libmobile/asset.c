@@ -0,0 +1,346 @@
+/* Tones and announcements from asset pack
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* The asset pack is mapped into memory once, so all processes share the
+ * same pages. A clip is bound to the pattern variables of a network at start.
+ * PCM clips are played directly from the mapped pack, so their pages are
+ * shared by all processes and nothing is decoded. Other clips (and PCM clips
+ * on big endian machines) are decoded when they are bound, so playing a
+ * pattern never waits for decoding. A decoded clip is shared by all patterns
+ * that use it.
+ *
+ * If the pack is embedded (--enable-embedded-assets), it is linked into the
+ * program, so no file is required.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <libgen.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../liblogging/logging.h"
+#include "asset.h"
+#include "rice.h"
+
+#ifdef EMBEDDED_ASSETS
+extern const uint8_t asset_embedded[];
+extern const uint32_t asset_embedded_size;
+#endif
+
+#define MAX_BINDINGS	32
+
+struct asset_clip {
+	const char	*name;
+	int		codec;
+	int		samples;
+	int		max;
+	const uint8_t	*data;
+	int		length;
+	int16_t		*spl;		/* samples, if bound */
+	int		decoded;	/* samples are allocated */
+};
+
+static struct asset_pack {
+	int		opened;		/* we tried to open the pack */
+	const uint8_t	*data;		/* pack in memory */
+	size_t		size;
+	int		mapped;		/* data must be unmapped */
+	struct asset_clip *clip;
+	int		num_clips;
+} pack;
+
+static struct asset_binding {
+	int16_t		**spl;
+	int		*size;
+	struct asset_clip *clip;
+} binding[MAX_BINDINGS];
+static int num_bindings = 0;
+
+static uint32_t get_le32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* check pack and read index */
+static int asset_parse(void)
+{
+	const uint8_t *entry;
+	struct asset_clip *clip;
+	uint32_t version, count, offset, length;
+	int i;
+
+	if (pack.size < ASSET_HEADER_SIZE || memcmp(pack.data, ASSET_MAGIC, 8)) {
+		LOGP(DCALL, LOGL_ERROR, "Asset pack has no valid header.\n");
+		return -EINVAL;
+	}
+	version = get_le32(pack.data + 8);
+	if (version != ASSET_VERSION) {
+		LOGP(DCALL, LOGL_ERROR, "Asset pack has version %u, but version %d is required.\n", version, ASSET_VERSION);
+		return -EINVAL;
+	}
+	count = get_le32(pack.data + 12);
+	if (count > (pack.size - ASSET_HEADER_SIZE) / ASSET_ENTRY_SIZE) {
+		LOGP(DCALL, LOGL_ERROR, "Asset pack is truncated.\n");
+		return -EINVAL;
+	}
+
+	pack.clip = calloc(count, sizeof(*pack.clip));
+	if (!pack.clip) {
+		LOGP(DCALL, LOGL_ERROR, "No memory!\n");
+		return -ENOMEM;
+	}
+	for (i = 0; i < (int)count; i++) {
+		entry = pack.data + ASSET_HEADER_SIZE + i * ASSET_ENTRY_SIZE;
+		clip = &pack.clip[i];
+		if (entry[ASSET_NAME_LEN - 1] != '\0') {
+			LOGP(DCALL, LOGL_ERROR, "Asset pack has invalid clip name.\n");
+			return -EINVAL;
+		}
+		clip->name = (const char *)entry;
+		clip->codec = get_le32(entry + 32);
+		clip->samples = get_le32(entry + 36);
+		clip->max = get_le32(entry + 40);
+		offset = get_le32(entry + 44);
+		length = get_le32(entry + 48);
+		if (offset > pack.size || length > pack.size - offset || clip->samples < 0 || clip->max < 0) {
+			LOGP(DCALL, LOGL_ERROR, "Asset '%s' exceeds the asset pack.\n", clip->name);
+			return -EINVAL;
+		}
+		if ((clip->codec == ASSET_CODEC_PCM && length < (uint32_t)clip->samples * 2)
+		 || (clip->codec == ASSET_CODEC_RICE && clip->samples && !length)
+		 || clip->codec > ASSET_CODEC_RICE) {
+			LOGP(DCALL, LOGL_ERROR, "Asset '%s' has invalid coding.\n", clip->name);
+			return -EINVAL;
+		}
+		clip->data = pack.data + offset;
+		clip->length = length;
+	}
+	pack.num_clips = count;
+
+	return 0;
+}
+
+/* Map pack file into memory, return -errno on failure. */
+static int map_pack(const char *filename)
+{
+	struct stat st;
+	void *data;
+	int fd, rc;
+
+	fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return -errno;
+	if (fstat(fd, &st) < 0) {
+		rc = -errno;
+		close(fd);
+		return rc;
+	}
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		rc = -errno;
+		LOGP(DCALL, LOGL_ERROR, "Failed to map asset pack '%s'! (errno = %d)\n", filename, -rc);
+		return rc;
+	}
+	pack.data = data;
+	pack.size = st.st_size;
+	pack.mapped = 1;
+	LOGP(DCALL, LOGL_DEBUG, "Using asset pack '%s'.\n", filename);
+
+	return 0;
+}
+
+/* Map pack of build tree, if the program runs from it ('src/<network>/'). */
+static int map_build_pack(void)
+{
+	char exe[1024], path[1200];
+	ssize_t len;
+
+	len = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+	if (len < 0)
+		return -ENOENT;
+	exe[len] = '\0';
+	snprintf(path, sizeof(path), "%s/../assets/%s", dirname(exe), ASSET_FILE);
+	return map_pack(path);
+}
+
+/*
+ * Open asset pack, if not already open.
+ * If filename is NULL, the environment variable OSMOCOM_ANALOG_ASSETS is used.
+ * If it is not set, the installed pack is used. If the programs are not
+ * installed, the pack of the build tree is used, then the pack in the current
+ * directory.
+ */
+int asset_open(const char *filename)
+{
+	int rc;
+
+	if (pack.opened)
+		return (pack.num_clips) ? 0 : -ENOENT;
+	pack.opened = 1;
+
+#ifdef EMBEDDED_ASSETS
+	if (!filename) {
+		pack.data = asset_embedded;
+		pack.size = asset_embedded_size;
+		goto parse;
+	}
+#endif
+	if (!filename)
+		filename = getenv("OSMOCOM_ANALOG_ASSETS");
+	if (filename)
+		rc = map_pack(filename);
+	else {
+		rc = -ENOENT;
+#ifdef ASSET_DIR
+		rc = map_pack(filename = ASSET_DIR "/" ASSET_FILE);
+#endif
+		if (rc == -ENOENT)
+			rc = map_build_pack();
+		if (rc == -ENOENT)
+			rc = map_pack(filename = ASSET_FILE);
+	}
+	if (rc < 0) {
+		LOGP(DCALL, LOGL_ERROR, "Failed to open asset pack '%s', tones and announcements are not available! (errno = %d)\n", filename ? : ASSET_FILE, -rc);
+		return rc;
+	}
+
+#ifdef EMBEDDED_ASSETS
+parse:
+#endif
+	rc = asset_parse();
+	if (rc < 0) {
+		asset_exit();
+		/* don't try again */
+		pack.opened = 1;
+		return rc;
+	}
+
+	return 0;
+}
+
+/* Free decoded clips and unmap pack. */
+void asset_exit(void)
+{
+	int i;
+
+	for (i = 0; i < num_bindings; i++) {
+		*binding[i].spl = NULL;
+		*binding[i].size = 0;
+	}
+	num_bindings = 0;
+
+	if (pack.clip) {
+		for (i = 0; i < pack.num_clips; i++) {
+			if (pack.clip[i].decoded)
+				free(pack.clip[i].spl);
+		}
+		free(pack.clip);
+	}
+	if (pack.mapped)
+		munmap((void *)pack.data, pack.size);
+	memset(&pack, 0, sizeof(pack));
+}
+
+/* get samples of clip, if not already */
+static int asset_decode(struct asset_clip *clip)
+{
+	int i;
+
+	if (clip->spl)
+		return 0;
+
+	if (!clip->samples)
+		return -EINVAL;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	/* use samples of pack as they are */
+	if (clip->codec == ASSET_CODEC_PCM && !((uintptr_t)clip->data & 1)) {
+		clip->spl = (int16_t *)clip->data;
+		return 0;
+	}
+#endif
+	clip->spl = malloc(clip->samples * sizeof(*clip->spl));
+	if (!clip->spl) {
+		LOGP(DCALL, LOGL_ERROR, "No memory!\n");
+		return -ENOMEM;
+	}
+	switch (clip->codec) {
+	case ASSET_CODEC_PCM:
+		for (i = 0; i < clip->samples; i++)
+			clip->spl[i] = clip->data[i * 2] | (clip->data[i * 2 + 1] << 8);
+		break;
+	case ASSET_CODEC_RICE:
+		if (rice_decode(clip->data, clip->length, clip->samples, clip->spl) < 0) {
+			LOGP(DCALL, LOGL_ERROR, "Asset '%s' is corrupt.\n", clip->name);
+			free(clip->spl);
+			clip->spl = NULL;
+			return -EINVAL;
+		}
+		break;
+	}
+	clip->decoded = 1;
+	LOGP(DCALL, LOGL_DEBUG, "Decoded asset '%s' with %d samples.\n", clip->name, clip->samples);
+
+	return 0;
+}
+
+/*
+ * Bind clip to pattern variables. The pack is opened, if not already.
+ * The samples must not be written, they may be part of the mapped pack.
+ */
+int asset_bind(const char *name, int16_t **spl, int *size, int *max)
+{
+	int i, rc;
+
+	rc = asset_open(NULL);
+	if (rc < 0)
+		return rc;
+
+	for (i = 0; i < pack.num_clips; i++) {
+		if (!strcmp(pack.clip[i].name, name))
+			break;
+	}
+	if (i == pack.num_clips) {
+		LOGP(DCALL, LOGL_ERROR, "Asset '%s' not found in asset pack.\n", name);
+		return -ENOENT;
+	}
+	rc = asset_decode(&pack.clip[i]);
+	if (rc < 0)
+		return rc;
+	if (num_bindings == MAX_BINDINGS) {
+		LOGP(DCALL, LOGL_ERROR, "Too many assets bound, please fix!\n");
+		abort();
+	}
+
+	binding[num_bindings].spl = spl;
+	binding[num_bindings].size = size;
+	binding[num_bindings].clip = &pack.clip[i];
+	num_bindings++;
+	*spl = pack.clip[i].spl;
+	*size = pack.clip[i].samples;
+	*max = pack.clip[i].max;
+
+	return 0;
+}
+
@@ -0,0 +1,29 @@
+
+/*
+ * Asset pack file format, all values are little endian:
+ *
+ * header (16 bytes):
+ *	magic "OAASSETS", version (uint32), number of clips (uint32)
+ * index entry for each clip (52 bytes):
+ *	name (32 bytes, zero terminated), codec (uint32), number of samples
+ *	(uint32), samples until the pattern repeats (uint32), offset of coded
+ *	data from start of file (uint32), length of coded data (uint32)
+ * coded data of all clips
+ */
+
+#define ASSET_MAGIC		"OAASSETS"
+#define ASSET_VERSION		2
+#define ASSET_HEADER_SIZE	16
+#define ASSET_ENTRY_SIZE	52
+#define ASSET_NAME_LEN		32
+
+#define ASSET_CODEC_PCM		0	/* 16 bit linear samples */
+#define ASSET_CODEC_RICE	1	/* lossless, see rice.c */
+
+/* name of the default asset pack */
+#define ASSET_FILE		"osmocom-analog.assets"
+
+int asset_open(const char *filename);
+void asset_exit(void);
+int asset_bind(const char *name, int16_t **spl, int *size, int *max);
+
@@ -37,6 +37,8 @@
 #include "sender.h"
 #include "call.h"
 #include "console.h"
+#include "shard.h"
+#include "replay.h"
 
 #define DISC_TIMEOUT	30, 0
 
@@ -375,6 +377,38 @@ static void get_process_patterns(process_t *process, int16_t *samples, int lengt
 	process->audio_pos = pos;
 }
 
+/* with sharding, the supervisor forwards calls to the workers, a worker handles its local calls */
+static int down_setup(int callref, const char *caller_id, enum number_type caller_type, const char *dialing)
+{
+	if (shard_worker < 0 && shard_workers)
+		return shard_down_setup(callref, caller_id, caller_type, dialing);
+	return call_down_setup(callref, caller_id, caller_type, dialing);
+}
+
+static void down_answer(int callref, struct timeval *tv_meter)
+{
+	if (shard_worker < 0 && shard_workers)
+		shard_down_answer(callref, tv_meter);
+	else
+		call_down_answer(callref, tv_meter);
+}
+
+static void down_disconnect(int callref, int cause)
+{
+	if (shard_worker < 0 && shard_workers)
+		shard_down_disconnect(callref, cause);
+	else
+		call_down_disconnect(callref, cause);
+}
+
+static void down_release(int callref, int cause)
+{
+	if (shard_worker < 0 && shard_workers)
+		shard_down_release(callref, cause);
+	else
+		call_down_release(callref, cause);
+}
+
 static void process_timeout(void *data)
 {
 	process_t *process = data;
@@ -383,7 +417,7 @@ static void process_timeout(void *data)
 		/* announcement timeout */
 		if (process->state == PROCESS_DISCONNECT) {
 			LOGP(DCALL, LOGL_INFO, "Call released toward mobile network (after timeout)\n");
-			call_down_release(process->callref, process->cause);
+			down_release(process->callref, process->cause);
 		}
 		indicate_disconnect_release(process->callref, process->cause, OSMO_CC_MSG_REL_IND);
 		destroy_process(process->callref);
@@ -405,7 +439,10 @@ static void down_audio(struct osmo_cc_session_codec *codec, uint8_t marker, uint
 	printf("festnetz-level: %s                  %.4f\n", debug_db(lev), (20 * log10(lev)));
 #endif
 #endif
-	call_down_audio(codec->decoder, process, process->callref, marker, sequence_number, timestamp, ssrc, payload, payload_len);
+	if (shard_worker < 0 && shard_workers)
+		shard_down_audio(codec->decoder, process, process->callref, marker, sequence_number, timestamp, ssrc, payload, payload_len);
+	else
+		call_down_audio(codec->decoder, process, process->callref, marker, sequence_number, timestamp, ssrc, payload, payload_len);
 }
 
 static void indicate_setup(process_t *process, const char *callerid, const char *dialing, uint8_t network_type, const char *network_id)
@@ -508,9 +545,14 @@ int call_up_setup(const char *callerid, const char *dialing, uint8_t network, co
 	process_t *process;
 
 	LOGP(DCALL, LOGL_INFO, "Incoming call from '%s' to '%s'\n", callerid ? : "unknown", dialing);
+	replay_event(NULL, "setup from '%s' to '%s'", callerid ? : "unknown", dialing);
 	if (!strcmp(dialing, "010"))
 		LOGP(DCALL, LOGL_INFO, " -> Call to Operator '%s'\n", dialing);
 
+	/* worker forwards to supervisor, unless it has its own call control instance and serves the called subscriber */
+	if (shard_worker >= 0 && !(ep && shard_registry_lookup(mobile_number_remove_prefix(dialing)) == shard_worker))
+		return shard_up_setup(callerid, dialing, network, network_id);
+
 	call = osmo_cc_call_new(ep);
 
 	process = create_process(call->callref, PROCESS_SETUP_RO);
@@ -529,6 +571,12 @@ void call_up_alerting(int callref)
 	}
 
 	LOGP(DCALL, LOGL_INFO, "Call is alerting\n");
+	replay_event(NULL, "alerting");
+
+	if (shard_worker >= 0 && !get_process(callref)) {
+		shard_up_alerting(callref);
+		return;
+	}
 
 	if (!connect_on_setup)
 		indicate_alerting(callref);
@@ -539,6 +587,10 @@ void call_up_alerting(int callref)
 /* Transceiver indicates early audio */
 void call_up_early(int callref)
 {
+	if (shard_worker >= 0 && !get_process(callref)) {
+		shard_up_early(callref);
+		return;
+	}
 	set_pattern_process(callref, PATTERN_NONE);
 }
 
@@ -551,6 +603,12 @@ void call_up_answer(int callref, const char *connect_id)
 	}
 
 	LOGP(DCALL, LOGL_INFO, "Call has been answered by '%s'\n", connect_id);
+	replay_event(NULL, "answer by '%s'", connect_id);
+
+	if (shard_worker >= 0 && !get_process(callref)) {
+		shard_up_answer(callref, connect_id);
+		return;
+	}
 
 	if (!connect_on_setup)
 		indicate_answer(callref, NULL, connect_id);
@@ -569,6 +627,12 @@ void call_up_release(int callref, int cause)
 	}
 
 	LOGP(DCALL, LOGL_INFO, "Call has been released with cause=%d\n", cause);
+	replay_event(NULL, "release with cause %d", cause);
+
+	if (shard_worker >= 0 && !get_process(callref)) {
+		shard_up_release(callref, cause);
+		return;
+	}
 
 	process = get_process(callref);
 	if (process) {
@@ -600,6 +664,10 @@ void call_up_release(int callref, int cause)
 /* turn recall tone on or off */
 void call_tone_recall(int callref, int on)
 {
+	if (shard_worker >= 0 && !get_process(callref)) {
+		shard_up_tone_recall(callref, on);
+		return;
+	}
 	set_pattern_process(callref, (on) ? PATTERN_RECALL : PATTERN_NONE);
 }
 
@@ -618,6 +686,11 @@ void call_up_audio(int callref, sample_t *samples, int len)
 	if (!callref)
 		return;
 
+	if (shard_worker >= 0 && !get_process(callref)) {
+		shard_up_audio(callref, samples, len);
+		return;
+	}
+
 	/* if we are disconnected, ignore audio */
 	process = get_process(callref);
 	if (!process || process->pattern != PATTERN_NONE)
@@ -822,7 +895,7 @@ static void ll_msg_cb(osmo_cc_endpoint_t __attribute__((unused)) *ep, uint32_t c
 		}
 
 		/* setup call */
-		rc = call_down_setup(callref, caller_id, caller_type, suffix);
+		rc = down_setup(callref, caller_id, caller_type, suffix);
 		if (rc < 0) {
 			LOGP(DCALL, LOGL_NOTICE, "Call rejected, cause %d\n", -rc);
 			if (!connect_on_setup) {
@@ -843,7 +916,7 @@ static void ll_msg_cb(osmo_cc_endpoint_t __attribute__((unused)) *ep, uint32_t c
 			destroy_process(callref);
 			indicate_disconnect_release(callref, 47, OSMO_CC_MSG_REL_IND);
 			LOGP(DCALL, LOGL_INFO, "Call released toward mobile network\n");
-			call_down_release(callref, 47);
+			down_release(callref, 47);
 			break;
 		}
 		break;
@@ -873,7 +946,7 @@ static void ll_msg_cb(osmo_cc_endpoint_t __attribute__((unused)) *ep, uint32_t c
 			goto nego_failed;
 		new_state_process(callref, PROCESS_CONNECT);
 		LOGP(DCALL, LOGL_INFO, "Call answered\n");
-		call_down_answer(callref, &tv_meter);
+		down_answer(callref, &tv_meter);
 		indicate_answer_ack(callref);
 		break;
 	case OSMO_CC_MSG_DISC_REQ:
@@ -892,12 +965,12 @@ static void ll_msg_cb(osmo_cc_endpoint_t __attribute__((unused)) *ep, uint32_t c
 			destroy_process(callref);
 			indicate_disconnect_release(callref, isdn_cause, OSMO_CC_MSG_REL_IND);
 			LOGP(DCALL, LOGL_INFO, "Call released toward mobile network\n");
-			call_down_release(callref, isdn_cause);
+			down_release(callref, isdn_cause);
 			break;
 		}
 		new_state_process(callref, PROCESS_DISCONNECT);
 		LOGP(DCALL, LOGL_INFO, "Call disconnected\n");
-		call_down_disconnect(callref, isdn_cause);
+		down_disconnect(callref, isdn_cause);
 		/* we might get released during disconnect handling!!! */
 		process = get_process(callref);
 		if (process && process->state == PROCESS_DISCONNECT)
@@ -915,7 +988,7 @@ static void ll_msg_cb(osmo_cc_endpoint_t __attribute__((unused)) *ep, uint32_t c
 		} else
 			LOGP(DCALL, LOGL_INFO, "Received OSMO-CC reject from fixed network with cause %d\n", isdn_cause);
 		LOGP(DCALL, LOGL_INFO, "Call released toward mobile network\n");
-		call_down_release(callref, isdn_cause);
+		down_release(callref, isdn_cause);
 		break;
 	}
 	osmo_cc_free_msg(msg);
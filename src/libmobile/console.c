@@ -39,6 +39,8 @@
 #include "console.h"
 #include "cause.h"
 #include "../libmobile/call.h"
+#include "shard.h"
+#include "replay.h"
 #ifdef HAVE_ALSA
 #include "../libsound/sound.h"
 #endif
@@ -76,6 +78,8 @@ typedef struct console {
 	int samplerate;		/* sample rate of headphone interface */
 	void *sound;		/* headphone interface */
 	int buffer_size;	/* sample buffer size at headphone interface */
+	int poll_fds_count;	/* descriptors of headphone interface in main loop */
+	int poll_fds_generation; /* generation of descriptors above */
 	samplerate_t srstate;	/* patterns/announcement upsampling */
 	jitter_t dejitter;	/* headphone audio dejittering */
 	int test_audio_pos;	/* position for test tone toward mobile */
@@ -426,6 +430,46 @@ int console_start_audio(void)
 #endif
 }
 
+/* get descriptors of headphone interface to wake up the main loop */
+int console_get_poll_fds(struct pollfd __attribute__((unused)) *fds, int __attribute__((unused)) space)
+{
+#ifdef HAVE_ALSA
+	int rc;
+#endif
+
+	console.poll_fds_count = 0;
+#ifdef HAVE_ALSA
+	if (!console.sound)
+		return 0;
+	console.poll_fds_generation = sound_poll_generation(console.sound);
+	rc = sound_get_poll_fds(console.sound, fds, space);
+	if (rc <= 0)
+		return 0;
+	console.poll_fds_count = rc;
+#endif
+
+	return console.poll_fds_count;
+}
+
+/* after poll() returned, the first descriptor of headphone interface is given */
+void console_poll_revents(struct pollfd __attribute__((unused)) *fds)
+{
+#ifdef HAVE_ALSA
+	if (console.poll_fds_count)
+		sound_poll_revents(console.sound, fds, console.poll_fds_count);
+#endif
+}
+
+/* return 1, if the headphone interface recovered from an xrun and has new descriptors */
+int console_poll_fds_changed(void)
+{
+#ifdef HAVE_ALSA
+	if (console.sound && sound_poll_generation(console.sound) != console.poll_fds_generation)
+		return 1;
+#endif
+	return 0;
+}
+
 void console_cleanup(void)
 {
 #ifdef HAVE_ALSA
@@ -639,6 +683,12 @@ void process_console(int c)
 /* Call this for every inscription. If the console's dial string is empty, it is set to the number that has been inscribed. */
 int console_inscription(const char *station_id)
 {
+	replay_event(NULL, "inscription '%s'", station_id);
+
+	/* tell the supervisor which worker serves the subscriber */
+	if (shard_worker >= 0)
+		shard_up_inscription(station_id);
+
 	if (console.loopback || !console.number_max_length)
 		return -EINVAL;
 
@@ -4,11 +4,16 @@
 #include <osmocom/cc/endpoint.h>
 #include "main_mobile.h"
 
+struct pollfd;
+
 void console_msg(osmo_cc_call_t *call, osmo_cc_msg_t *msg);
 int console_init(const char *audiodev, int samplerate, int buffer, int loopback, int echo_test, const char *digits, const struct number_lengths *lengths, const char *station_id);
 void console_cleanup(void);
 int console_open_audio(int buffer_size, double interval);
 int console_start_audio(void);
+int console_get_poll_fds(struct pollfd *fds, int space);
+void console_poll_revents(struct pollfd *fds);
+int console_poll_fds_changed(void);
 void console_process(int c);
 void process_console(int c);
 int console_inscription(const char *station_id);
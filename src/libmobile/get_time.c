@@ -1,13 +1,27 @@
+
 #include <time.h>
 
 #include "get_time.h"
 
+static int virtual_time_on = 0;
+static double virtual_time;
+
 double get_time(void)
 {
 	static struct timespec tv;
 
+	if (virtual_time_on)
+		return virtual_time;
+
 	clock_gettime(CLOCK_REALTIME, &tv);
 
 	return (double)tv.tv_sec + (double)tv.tv_nsec / 1000000000.0;
 }
 
+/* replace real time, e.g. when processing recordings faster than real time */
+void set_virtual_time(double now)
+{
+	virtual_time = now;
+	virtual_time_on = 1;
+}
+
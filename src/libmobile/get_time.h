@@ -1,3 +1,4 @@
 
 double get_time(void);
+void set_virtual_time(double now);
 
@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -27,6 +28,7 @@
 #include <math.h>
 #include <termios.h>
 #include <errno.h>
+#include <poll.h>
 #include "../libsample/sample.h"
 #include "../liblogging/logging.h"
 #include "sender.h"
@@ -36,6 +38,11 @@
 #include "call.h"
 #include "console.h"
 #include "get_time.h"
+#include "timer_wheel.h"
+#include "asset.h"
+#include "shard.h"
+#include "replay.h"
+#include "../librealtime/realtime.h"
 #ifdef HAVE_SDR
 #include "../libsdr/sdr.h"
 #include "../libsdr/sdr_config.h"
@@ -70,6 +77,7 @@ static int echo_test = 0;
 static int use_osmocc_cross = 0;
 static int use_osmocc_sock = 0;
 #define MAX_CC_ARGS 1024
+#define MAX_POLL_FDS 64
 static int cc_argc = 0;
 static const char *cc_argv[MAX_CC_ARGS];
 int no_l16 = 0;
@@ -77,11 +85,16 @@ int send_patterns = 1;
 static int release_on_disconnect = 1;
 int loopback = 0;
 int rt_prio = 0;
+static const char *rt_cpus = NULL;
+static int rt_mlock = 0;
+static int rt_reserve = 0;
 int fast_math = 0;
 const char *write_tx_wave = NULL;
 const char *write_rx_wave = NULL;
 const char *read_tx_wave = NULL;
 const char *read_rx_wave = NULL;
+static int num_shard = 0;
+static const char *shard_spec[SHARD_MAX_WORKERS];
 
 static const char *number_digits;
 static const struct number_lengths *number_lengths;
@@ -184,6 +197,10 @@ void main_mobile_init(const char *digits, const struct number_lengths lengths[],
 
 void main_mobile_exit(void)
 {
+	shard_exit();
+	asset_exit();
+	replay_event_close();
+
 	if (got_init) {
 		enable_limit_scroll(false);
 		printf("\n\n");
@@ -302,6 +319,15 @@ void main_mobile_print_help(const char *arg0, const char *ext_usage)
 	printf("        Loopback test: 1 = internal | 2 = external | 3 = echo\n");
 	printf(" -r --realtime <prio>\n");
 	printf("        Set prio: 0 to disable, 99 for maximum (default = %d)\n", rt_prio);
+	printf("    --cpu-affinity <cpu>[-<cpu>][,...]\n");
+	printf("        Bind main loop to given CPUs, e.g. '2' or '2-3'. Threads that are\n");
+	printf("        created by the main loop inherit these CPUs, unless given otherwise.\n");
+	printf("    --mlock\n");
+	printf("        Lock all memory, so that processing is not delayed by page faults.\n");
+	printf("        Page faults and context switches are reported every minute.\n");
+	printf("    --mem-reserve <MB>\n");
+	printf("        Lock memory and keep given amount of memory in advance for buffers\n");
+	printf("        that are allocated while streaming (default = %d)\n", rt_reserve);
 	printf("    --fast-math\n");
 	printf("        Use fast math approximation for slow CPU / ARM based systems.\n");
 	printf("    --write-rx-wave <file>\n");
@@ -312,6 +338,22 @@ void main_mobile_print_help(const char *arg0, const char *ext_usage)
 	printf("        Replace received audio by given wave file.\n");
 	printf("    --read-tx-wave <file>\n");
 	printf("        Replace transmitted audio by given wave file.\n");
+	printf("    --replay <seconds>\n");
+	printf("        Replace sound device by a virtual device and process given duration\n");
+	printf("        as fast as possible, using virtual time. Use '--read-rx-wave' to\n");
+	printf("        receive a recording, otherwise silence is received. Use 0 to stop at\n");
+	printf("        the end of the recording. Use '--write-tx-wave' to record what is\n");
+	printf("        transmitted. SDR is not used.\n");
+	printf("    --event-log <file>\n");
+	printf("        Write decoded frames, digits and call states to given file.\n");
+	printf("    --shard <channel>[,<channel>...][/<sdr device args>]\n");
+	printf("        Process given channels in a separate worker process. Give this option\n");
+	printf("        for each worker, every channel must be given in one worker. Channels\n");
+	printf("        that use the same sound card must be given in the same worker. With\n");
+	printf("        SDR, give different SDR device args for each worker. Requires OSMO-CC\n");
+	printf("        socket interface or built-in call forwarding ('-o' or '-x').\n");
+	printf("        With '-x', calls between subscribers of the same worker are connected\n");
+	printf("        by the worker itself, using port 4201 for the first worker and so on.\n");
 #ifdef HAVE_SDR
     if (allow_sdr) {
 	printf("    --limesdr\n");
@@ -378,6 +420,12 @@ void main_mobile_print_hotkeys(void)
 #define	OPT_CALL_BUFFER		1009
 #define	OPT_FAST_MATH		1010
 #define	OPT_NO_L16		1011
+#define	OPT_SHARD		1012
+#define	OPT_CPU_AFFINITY	1013
+#define	OPT_MLOCK		1014
+#define	OPT_MEM_RESERVE		1015
+#define	OPT_REPLAY		1016
+#define	OPT_EVENT_LOG		1017
 #define	OPT_LIMESDR		1100
 #define	OPT_LIMESDR_MINI	1101
 
@@ -406,11 +454,17 @@ void main_mobile_add_options(void)
 	option_add('t', "tones", 1);
 	option_add('l', "loopback", 1);
 	option_add('r', "realtime", 1);
+	option_add(OPT_CPU_AFFINITY, "cpu-affinity", 1);
+	option_add(OPT_MLOCK, "mlock", 0);
+	option_add(OPT_MEM_RESERVE, "mem-reserve", 1);
 	option_add(OPT_FAST_MATH, "fast-math", 0);
 	option_add(OPT_WRITE_RX_WAVE, "write-rx-wave", 1);
 	option_add(OPT_WRITE_TX_WAVE, "write-tx-wave", 1);
 	option_add(OPT_READ_RX_WAVE, "read-rx-wave", 1);
 	option_add(OPT_READ_TX_WAVE, "read-tx-wave", 1);
+	option_add(OPT_REPLAY, "replay", 1);
+	option_add(OPT_EVENT_LOG, "event-log", 1);
+	option_add(OPT_SHARD, "shard", 1);
 #ifdef HAVE_SDR
 	option_add(OPT_LIMESDR, "limesdr", 0);
 	option_add(OPT_LIMESDR_MINI, "limesdr-mini", 0);
@@ -518,6 +572,24 @@ int main_mobile_handle_options(int short_option, int argi, char **argv)
 	case 'r':
 		rt_prio = atoi(argv[argi]);
 		break;
+	case OPT_CPU_AFFINITY:
+		if (rt_check_cpus(argv[argi]) < 0) {
+			fprintf(stderr, "Invalid CPU list '%s', use e.g. '2' or '2-3' or '1,3'.\n", argv[argi]);
+			return -EINVAL;
+		}
+		rt_cpus = options_strdup(argv[argi]);
+		break;
+	case OPT_MLOCK:
+		rt_mlock = 1;
+		break;
+	case OPT_MEM_RESERVE:
+		rt_mlock = 1;
+		rt_reserve = atoi(argv[argi]);
+		if (rt_reserve < 0) {
+			fprintf(stderr, "Memory reserve must not be negative.\n");
+			return -EINVAL;
+		}
+		break;
 	case OPT_FAST_MATH:
 		fast_math = 1;
 		break;
@@ -533,6 +605,26 @@ int main_mobile_handle_options(int short_option, int argi, char **argv)
 	case OPT_READ_TX_WAVE:
 		read_tx_wave = options_strdup(argv[argi]);
 		break;
+	case OPT_REPLAY:
+		if (atof(argv[argi]) < 0.0) {
+			fprintf(stderr, "Replay duration must not be negative.\n");
+			return -EINVAL;
+		}
+		/* virtual time must start before senders are created */
+		replay_init(atof(argv[argi]));
+		break;
+	case OPT_EVENT_LOG:
+		rc = replay_event_open(argv[argi]);
+		if (rc < 0)
+			return rc;
+		break;
+	case OPT_SHARD:
+		if (num_shard == SHARD_MAX_WORKERS) {
+			fprintf(stderr, "Too many shards defined!\n");
+			return -EINVAL;
+		}
+		shard_spec[num_shard++] = options_strdup(argv[argi]);
+		break;
 #ifdef HAVE_SDR
 	case OPT_LIMESDR:
 		if (allow_sdr) {
@@ -618,6 +710,9 @@ void main_mobile_loop(const char *name, int *quit, void (*myhandler)(void), cons
 	sender_t *sender;
 	double last_time_call = 0, begin_time, now, sleep;
 	struct termios term, term_orig;
+	struct pollfd poll_fds[MAX_POLL_FDS];
+	struct timespec timeout;
+	int num_sender_fds, num_poll_fds;
 	int num_chan, i;
 	int c;
 	int rc;
@@ -663,6 +758,14 @@ void main_mobile_loop(const char *name, int *quit, void (*myhandler)(void), cons
 		fprintf(stderr, "You selected built-in call forwarding, but it cannot be used with echo test.\n");
 		return;
 	}
+	if (num_shard && !use_osmocc_sock && !use_osmocc_cross) {
+		fprintf(stderr, "You selected shards, but they require OSMO-CC socket interface or built-in call forwarding.\n");
+		return;
+	}
+	if (replay_on && replay_length == 0.0 && !read_rx_wave) {
+		fprintf(stderr, "You selected replay until end of recording, but no recording is given. Use '--read-rx-wave'.\n");
+		return;
+	}
 
 	/* OSMO-CC crossover */
 	if (use_osmocc_cross) {
@@ -672,15 +775,42 @@ void main_mobile_loop(const char *name, int *quit, void (*myhandler)(void), cons
 		cc_argv[cc_argc++] = options_strdup("remote 127.0.0.1:4200");
 	}
 
+	/* fork workers, the supervisor keeps no sender */
+	if (num_shard) {
+		rc = shard_start(num_shard, shard_spec);
+		if (rc < 0)
+			return;
+	}
+
+	/* lock memory before buffers are allocated, locks are not inherited by workers */
+	if (rt_mlock) {
+		rc = rt_lock_memory(rt_reserve);
+		if (rc < 0)
+			return;
+	}
+
 	/* init OSMO-CC */
 	if (!use_osmocc_sock)
 		console_init(call_device, call_samplerate, call_buffer, loopback, echo_test, number_digits, number_lengths, station_id);
 
-	/* init call control instance */
-	rc = call_init(name, (use_osmocc_sock) ? send_patterns : 0, release_on_disconnect, use_osmocc_sock, cc_argc, cc_argv, no_l16);
-	if (rc < 0) {
-		fprintf(stderr, "Failed to create call control instance. Quitting!\n");
-		return;
+	/* with built-in call forwarding, each worker connects calls between its own subscribers on its own port */
+	if (shard_worker >= 0 && use_osmocc_cross) {
+		char cc_arg[64];
+
+		cc_argc = 0;
+		sprintf(cc_arg, "local 127.0.0.1:%d", 4201 + shard_worker);
+		cc_argv[cc_argc++] = options_strdup(cc_arg);
+		sprintf(cc_arg, "remote 127.0.0.1:%d", 4201 + shard_worker);
+		cc_argv[cc_argc++] = options_strdup(cc_arg);
+	}
+
+	/* init call control instance, other workers use the one of the supervisor */
+	if (shard_worker < 0 || use_osmocc_cross) {
+		rc = call_init(name, (use_osmocc_sock) ? send_patterns : 0, release_on_disconnect, use_osmocc_sock, cc_argc, cc_argv, no_l16);
+		if (rc < 0) {
+			fprintf(stderr, "Failed to create call control instance. Quitting!\n");
+			return;
+		}
 	}
 
 #ifdef HAVE_SDR
@@ -702,6 +832,8 @@ void main_mobile_loop(const char *name, int *quit, void (*myhandler)(void), cons
 	for (i = 0; i < num_chan; i++) {
 		samples[i] = calloc(buffer_size, sizeof(**samples));
 		powers[i] = calloc(buffer_size, sizeof(**powers));
+		rt_prefault(samples[i], buffer_size * sizeof(**samples));
+		rt_prefault(powers[i], buffer_size * sizeof(**powers));
 	}
 
 	/* real time priority */
@@ -718,16 +850,25 @@ void main_mobile_loop(const char *name, int *quit, void (*myhandler)(void), cons
 		}
 	}
 
-	if (!loopback)
+	/* CPU affinity, SDR threads are created later and inherit it */
+	if (rt_cpus) {
+		rc = rt_pin_thread(rt_cpus, "main loop");
+		if (rc < 0)
+			return;
+	}
+
+	if (!loopback && shard_worker < 0)
 		print_aaimage();
 
-	/* prepare terminal */
-	tcgetattr(0, &term_orig);
-	term = term_orig;
-	term.c_lflag &= ~(ISIG|ICANON|ECHO);
-	term.c_cc[VMIN]=1;
-	term.c_cc[VTIME]=2;
-	tcsetattr(0, TCSANOW, &term);
+	/* prepare terminal, workers do not read keys */
+	if (shard_worker < 0) {
+		tcgetattr(0, &term_orig);
+		term = term_orig;
+		term.c_lflag &= ~(ISIG|ICANON|ECHO);
+		term.c_cc[VMIN]=1;
+		term.c_cc[VTIME]=2;
+		tcsetattr(0, TCSANOW, &term);
+	}
 
 	/* catch signals */
 	signal(SIGINT, sighandler);
@@ -741,6 +882,10 @@ void main_mobile_loop(const char *name, int *quit, void (*myhandler)(void), cons
 	if (console_start_audio())
 		*quit = 1;
 
+	/* sound cards wake up the main loop when a period has been captured */
+	num_sender_fds = sender_get_poll_fds(poll_fds, MAX_POLL_FDS);
+	num_poll_fds = num_sender_fds + console_get_poll_fds(poll_fds + num_sender_fds, MAX_POLL_FDS - num_sender_fds);
+
 	while(!(*quit)) {
 		int work;
 		begin_time = get_time();
@@ -764,7 +909,7 @@ void main_mobile_loop(const char *name, int *quit, void (*myhandler)(void), cons
 		}
 
 next_char:
-		c = get_char();
+		c = (shard_worker < 0) ? get_char() : -1;
 		switch (c) {
 		case 3:
 			/* quit */
@@ -839,8 +984,15 @@ next_char:
 			work = 0;
 			work |= osmo_cc_handle();
 			work |= osmo_select_main(1);
+			/* the wheel advances with the time of this DSP interval */
+			work |= timer_wheel_work(now);
+			work |= shard_handle();
 		} while (work);
 
+		/* supervisor or worker is gone */
+		if (shard_quit())
+			*quit = 1;
+
 		if (!use_osmocc_sock)
 			process_console(c);
 
@@ -851,10 +1003,30 @@ next_char:
 
 		now = get_time();
 
-		/* sleep interval */
-		sleep = (dsp_interval / 1000.0) - (now - begin_time);
-		if (sleep > 0)
-			usleep(sleep * 1000000.0);
+		/* page faults and context switches */
+		rt_report(now);
+
+		/* sleep interval, replay does not sleep but advances virtual time */
+		if (replay_on)
+			replay_tick(dsp_interval / 1000.0);
+		else {
+			sleep = (dsp_interval / 1000.0) - (now - begin_time);
+			/* a sound card that recovered from an xrun has been opened again */
+			if (sender_poll_fds_changed() || console_poll_fds_changed()) {
+				num_sender_fds = sender_get_poll_fds(poll_fds, MAX_POLL_FDS);
+				num_poll_fds = num_sender_fds + console_get_poll_fds(poll_fds + num_sender_fds, MAX_POLL_FDS - num_sender_fds);
+			}
+			if (sleep > 0 && num_poll_fds) {
+				/* wake up as soon as a period has been captured, but not later than the interval */
+				timeout.tv_sec = 0;
+				timeout.tv_nsec = sleep * 1e9;
+				if (ppoll(poll_fds, num_poll_fds, &timeout, NULL) > 0) {
+					sender_poll_revents(poll_fds);
+					console_poll_revents(poll_fds + num_sender_fds);
+				}
+			} else if (sleep > 0)
+				usleep(sleep * 1000000.0);
+		}
 
 //		now = get_time();
 //		printf("duration =%.6f\n", now - begin_time);
@@ -872,7 +1044,8 @@ next_char:
 	}
 
 	/* reset terminal */
-	tcsetattr(0, TCSANOW, &term_orig);
+	if (shard_worker < 0)
+		tcsetattr(0, TCSANOW, &term_orig);
 	
 	/* reset real time prio */
 	if (rt_prio > 0) {
@@ -883,8 +1056,13 @@ next_char:
 		sched_setscheduler(0, SCHED_OTHER, &schedp);
 	}
 
+	/* unlock memory */
+	if (rt_mlock)
+		rt_unlock_memory();
+
 	//* cleanup call control */
-	call_exit();
+	if (shard_worker < 0 || use_osmocc_cross)
+		call_exit();
 
 	/* cleanup console */
 	if (!use_osmocc_sock)
@@ -0,0 +1,263 @@
+/* Replay recordings as fast as possible
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* The sound device is replaced by a virtual device that receives silence and
+ * discards transmitted audio. Received audio is replaced by a wave file using
+ * the '--read-rx-wave' option, transmitted audio is recorded by using the
+ * '--write-tx-wave' option.
+ *
+ * The main loop does not sleep. Instead, the time advances by one interval
+ * each time the main loop is processed. get_time() and the timers of
+ * libosmocore use this virtual time, so a replay is independent of the speed
+ * of the machine. The wave files are read and written without dropping
+ * samples, even if the file io thread cannot keep up with the main loop.
+ *
+ * Decoded frames, digits and call states are written to an event log. The
+ * event log of a replay can be compared with the event log of a previous
+ * replay, to prove that a change did not alter the result of the decoders.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <unistd.h>
+#include <time.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include <osmocom/core/timer.h>
+#include "sender.h"
+#include "get_time.h"
+#include "replay.h"
+
+int replay_on = 0;
+double replay_length = 0.0;
+
+static uint64_t replay_ticks = 0;
+static double replay_elapsed = 0.0;
+
+static FILE *event_fp = NULL;
+static double event_start;
+
+typedef struct replay {
+	int		samplerate;
+	uint64_t	rx_count;	/* samples received so far */
+	uint64_t	tx_count;	/* samples transmitted so far */
+} replay_t;
+
+static void set_replay_time(void)
+{
+	uint64_t us = (uint64_t)(replay_elapsed * 1000000.0 + 0.5);
+	struct timespec *ts;
+
+	set_virtual_time(REPLAY_EPOCH + (double)us / 1000000.0);
+
+	/* older versions of libosmocore use gettimeofday() for timers */
+	osmo_gettimeofday_override = true;
+	osmo_gettimeofday_override_time.tv_sec = (time_t)REPLAY_EPOCH + us / 1000000;
+	osmo_gettimeofday_override_time.tv_usec = us % 1000000;
+
+	osmo_clock_override_enable(CLOCK_MONOTONIC, true);
+	ts = osmo_clock_override_gettimespec(CLOCK_MONOTONIC);
+	ts->tv_sec = (time_t)REPLAY_EPOCH + us / 1000000;
+	ts->tv_nsec = (us % 1000000) * 1000;
+}
+
+/* replace sound device and real time, must be called before senders are created */
+void replay_init(double length)
+{
+	replay_on = 1;
+	replay_length = length;
+	replay_ticks = 0;
+	replay_elapsed = 0.0;
+	set_replay_time();
+}
+
+/* advance time by one interval of the main loop */
+void replay_tick(double interval)
+{
+	replay_ticks++;
+	replay_elapsed = (double)replay_ticks * interval;
+	set_replay_time();
+}
+
+/* wait for file io thread rather than returning silence
+ * return less than length at the end of the file */
+int replay_wave_read(struct wave_play *play, sample_t **samples, int length)
+{
+	sample_t *chunk[play->channels];
+	int done = 0, rc, c;
+
+	while (done < length) {
+		for (c = 0; c < play->channels; c++)
+			chunk[c] = samples[c] + done;
+		/* remaining samples are set to 0, if there is not enough data */
+		rc = wave_read(play, chunk, length - done);
+		done += rc;
+		if (!play->left)
+			break;
+		if (rc == 0)
+			usleep(1000);
+	}
+
+	return done;
+}
+
+/* wait for file io thread rather than dropping samples */
+int replay_wave_write(struct wave_rec *rec, sample_t **samples, int length)
+{
+	sample_t *chunk[rec->channels];
+	int done = 0, rc, c;
+
+	while (done < length && !rec->finish) {
+		for (c = 0; c < rec->channels; c++)
+			chunk[c] = samples[c] + done;
+		rc = wave_write(rec, chunk, length - done);
+		done += rc;
+		if (rc == 0)
+			usleep(1000);
+	}
+
+	return done;
+}
+
+void *replay_open(int __attribute__((unused)) direction, const char __attribute__((unused)) *device, double __attribute__((unused)) *tx_frequency, double __attribute__((unused)) *rx_frequency, int __attribute__((unused)) *am, int __attribute__((unused)) channels, double __attribute__((unused)) paging_frequency, int samplerate, int __attribute__((unused)) buffer_size, double __attribute__((unused)) interval, double __attribute__((unused)) max_deviation, double __attribute__((unused)) max_modulation, double __attribute__((unused)) modulation_index)
+{
+	replay_t *replay;
+
+	if (!replay_on) {
+		LOGP(DSENDER, LOGL_ERROR, "Replay is not initialized, please fix!\n");
+		abort();
+	}
+
+	replay = calloc(1, sizeof(*replay));
+	if (!replay) {
+		LOGP(DSENDER, LOGL_ERROR, "No memory!\n");
+		return NULL;
+	}
+	replay->samplerate = samplerate;
+
+	LOGP(DSENDER, LOGL_INFO, "Replacing sound device by replay with %d samples per second.\n", samplerate);
+
+	return replay;
+}
+
+int replay_start(void __attribute__((unused)) *inst)
+{
+	return 0;
+}
+
+void replay_close(void *inst)
+{
+	replay_t *replay = (replay_t *)inst;
+
+	free(replay);
+}
+
+/* samples that are due since replay started */
+static uint64_t replay_due(replay_t *replay)
+{
+	return (uint64_t)(replay_elapsed * (double)replay->samplerate + 0.5);
+}
+
+int replay_write(void *inst, sample_t __attribute__((unused)) **samples, uint8_t __attribute__((unused)) **power, int num, enum paging_signal __attribute__((unused)) *paging_signal, int __attribute__((unused)) *on, int __attribute__((unused)) channels)
+{
+	replay_t *replay = (replay_t *)inst;
+
+	replay->tx_count += num;
+
+	return num;
+}
+
+int replay_read(void *inst, sample_t **samples, int num, int channels, double *rf_level_db)
+{
+	replay_t *replay = (replay_t *)inst;
+	int count, c;
+
+	/* quit main loop */
+	if (replay_length > 0.0 && replay->rx_count >= (uint64_t)(replay_length * (double)replay->samplerate + 0.5))
+		return -EPERM;
+
+	count = replay_due(replay) - replay->rx_count;
+	if (count > num)
+		count = num;
+	for (c = 0; c < channels; c++) {
+		memset(samples[c], 0, count * sizeof(*samples[c]));
+		rf_level_db[c] = 0.0;
+	}
+	replay->rx_count += count;
+
+	return count;
+}
+
+/* keep the TX buffer filled like a sound device does */
+int replay_get_tosend(void *inst, int buffer_size)
+{
+	replay_t *replay = (replay_t *)inst;
+	int fill;
+
+	fill = (int64_t)replay->tx_count - (int64_t)replay_due(replay);
+	if (fill < 0)
+		fill = 0;
+	if (fill >= buffer_size)
+		return 0;
+
+	return buffer_size - fill;
+}
+
+int replay_event_open(const char *filename)
+{
+	event_fp = fopen(filename, "w");
+	if (!event_fp) {
+		fprintf(stderr, "Failed to open event log '%s'!\n", filename);
+		return -EIO;
+	}
+	/* line buffered, so worker processes do not inherit unwritten events */
+	setvbuf(event_fp, NULL, _IOLBF, 0);
+	event_start = get_time();
+
+	return 0;
+}
+
+void replay_event_close(void)
+{
+	if (event_fp) {
+		fclose(event_fp);
+		event_fp = NULL;
+	}
+}
+
+/* write event with time stamp and channel, kanal may be NULL */
+void replay_event(const char *kanal, const char *fmt, ...)
+{
+	va_list args;
+	double now;
+
+	if (!event_fp)
+		return;
+
+	now = get_time() - ((replay_on) ? REPLAY_EPOCH : event_start);
+	fprintf(event_fp, "%.6f %s ", now, (kanal) ? : "-");
+	va_start(args, fmt);
+	vfprintf(event_fp, fmt, args);
+	va_end(args);
+	fputc('\n', event_fp);
+}
@@ -0,0 +1,29 @@
+
+enum paging_signal;
+struct wave_play;
+struct wave_rec;
+
+/* start of virtual time, so replayed events get the same time stamps each time */
+#define REPLAY_EPOCH	1000000.0
+
+extern int replay_on;		/* sound device is replaced by replay */
+extern double replay_length;	/* seconds to replay, 0 = until end of RX wave file */
+
+void replay_init(double length);
+void replay_tick(double interval);
+int replay_wave_read(struct wave_play *play, sample_t **samples, int length);
+int replay_wave_write(struct wave_rec *rec, sample_t **samples, int length);
+
+/* audio interface that replaces sound device or SDR */
+void *replay_open(int direction, const char *device, double *tx_frequency, double *rx_frequency, int *am, int channels, double paging_frequency, int samplerate, int buffer_size, double interval, double max_deviation, double max_modulation, double modulation_index);
+int replay_start(void *inst);
+void replay_close(void *inst);
+int replay_write(void *inst, sample_t **samples, uint8_t **power, int num, enum paging_signal *paging_signal, int *on, int channels);
+int replay_read(void *inst, sample_t **samples, int num, int channels, double *rf_level_db);
+int replay_get_tosend(void *inst, int buffer_size);
+
+/* log of decoded events, to compare the result of a replay */
+int replay_event_open(const char *filename);
+void replay_event_close(void);
+void replay_event(const char *kanal, const char *fmt, ...);
+
@@ -0,0 +1,210 @@
+/* Lossless codec for tones and announcements
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Samples are coded in blocks of RICE_BLOCK samples. Each block starts with a
+ * byte that holds the order of the predictor (bits 5..7) and the Rice
+ * parameter k (bits 0..4). The predictor of order 0, 1 or 2 continues over
+ * the block boundaries, it starts with previous samples of 0. The residual of
+ * each sample is mapped to an unsigned value u (0, -1, 1, -2, ...) and stored
+ * as u >> k in unary coding (ones terminated by a zero), followed by the lower
+ * k bits of u. If u >> k reaches RICE_ESCAPE, the ones are not terminated and
+ * u follows with 20 bits. Bits are stored MSB first.
+ *
+ * The decoded samples are identical to the encoded samples. This file is also
+ * compiled into mkassets, so it must not depend on any other part.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "rice.h"
+
+#define RICE_ESCAPE	32
+#define RICE_RAW_BITS	20
+#define RICE_MAX_K	16
+#define RICE_MAX_ORDER	2
+
+static inline int32_t predict(int order, int32_t s1, int32_t s2)
+{
+	switch (order) {
+	case 1:
+		return s1;
+	case 2:
+		return 2 * s1 - s2;
+	default:
+		return 0;
+	}
+}
+
+static inline uint32_t zigzag(int32_t r)
+{
+	return ((uint32_t)r << 1) ^ (uint32_t)(r >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t u)
+{
+	return (int32_t)(u >> 1) ^ -(int32_t)(u & 1);
+}
+
+static inline int code_bits(uint32_t u, int k)
+{
+	if ((u >> k) >= RICE_ESCAPE)
+		return RICE_ESCAPE + RICE_RAW_BITS;
+	return (u >> k) + 1 + k;
+}
+
+struct bit_writer {
+	uint8_t		*data;
+	int		pos;		/* bit position */
+};
+
+static inline void put_bits(struct bit_writer *w, uint32_t value, int bits)
+{
+	while (bits--) {
+		if ((value >> bits) & 1)
+			w->data[w->pos >> 3] |= 0x80 >> (w->pos & 7);
+		w->pos++;
+	}
+}
+
+struct bit_reader {
+	const uint8_t	*data;
+	int		pos;		/* bit position */
+	int		size;		/* number of bits */
+};
+
+/* return -1, if data is exhausted */
+static inline int get_bit(struct bit_reader *r)
+{
+	int bit;
+
+	if (r->pos == r->size)
+		return -1;
+	bit = (r->data[r->pos >> 3] >> (7 - (r->pos & 7))) & 1;
+	r->pos++;
+	return bit;
+}
+
+static inline int get_bits(struct bit_reader *r, int bits, uint32_t *value)
+{
+	if (r->size - r->pos < bits)
+		return -1;
+	*value = 0;
+	while (bits--)
+		*value = (*value << 1) | get_bit(r);
+	return 0;
+}
+
+/*
+ * Encode samples, return number of bytes written to data. Data must have
+ * space for RICE_MAX_BYTES(samples). For each block, the predictor and the
+ * parameter that result in the fewest bits are selected.
+ */
+int rice_encode(const int16_t *spl, int samples, uint8_t *data)
+{
+	struct bit_writer w = { data, 0 };
+	int32_t s1 = 0, s2 = 0, t1, t2;
+	int i, n, order, k, bits, best_bits, best_order = 0, best_k = 0;
+
+	memset(data, 0, RICE_MAX_BYTES(samples));
+
+	for (i = 0; i < samples; i += n) {
+		n = samples - i;
+		if (n > RICE_BLOCK)
+			n = RICE_BLOCK;
+
+		/* search predictor and parameter */
+		best_bits = -1;
+		for (order = 0; order <= RICE_MAX_ORDER; order++) {
+			for (k = 0; k <= RICE_MAX_K; k++) {
+				t1 = s1;
+				t2 = s2;
+				for (bits = 0, n = 0; n < RICE_BLOCK && i + n < samples; n++) {
+					bits += code_bits(zigzag(spl[i + n] - predict(order, t1, t2)), k);
+					t2 = t1;
+					t1 = spl[i + n];
+				}
+				if (best_bits < 0 || bits < best_bits) {
+					best_bits = bits;
+					best_order = order;
+					best_k = k;
+				}
+			}
+		}
+
+		put_bits(&w, (best_order << 5) | best_k, 8);
+		for (n = 0; n < RICE_BLOCK && i + n < samples; n++) {
+			uint32_t u = zigzag(spl[i + n] - predict(best_order, s1, s2));
+			if ((u >> best_k) >= RICE_ESCAPE) {
+				put_bits(&w, 0xffffffff, RICE_ESCAPE);
+				put_bits(&w, u, RICE_RAW_BITS);
+			} else {
+				put_bits(&w, 0xffffffff, u >> best_k);
+				put_bits(&w, 0, 1);
+				put_bits(&w, u, best_k);
+			}
+			s2 = s1;
+			s1 = spl[i + n];
+		}
+	}
+
+	return (w.pos + 7) >> 3;
+}
+
+/* Decode given number of samples, return -1 if the data is corrupt. */
+int rice_decode(const uint8_t *data, int length, int samples, int16_t *spl)
+{
+	struct bit_reader r = { data, 0, length * 8 };
+	int32_t s1 = 0, s2 = 0, s;
+	uint32_t header, u, low;
+	int i, n, order, k, q, bit;
+
+	for (i = 0; i < samples; i += n) {
+		if (get_bits(&r, 8, &header) < 0)
+			return -1;
+		order = header >> 5;
+		k = header & 0x1f;
+		if (order > RICE_MAX_ORDER || k > RICE_MAX_K)
+			return -1;
+		for (n = 0; n < RICE_BLOCK && i + n < samples; n++) {
+			for (q = 0; q < RICE_ESCAPE; q++) {
+				bit = get_bit(&r);
+				if (bit < 0)
+					return -1;
+				if (!bit)
+					break;
+			}
+			if (q == RICE_ESCAPE) {
+				if (get_bits(&r, RICE_RAW_BITS, &u) < 0)
+					return -1;
+			} else {
+				if (get_bits(&r, k, &low) < 0)
+					return -1;
+				u = ((uint32_t)q << k) | low;
+			}
+			s = predict(order, s1, s2) + unzigzag(u);
+			if (s < -32768 || s > 32767)
+				return -1;
+			spl[i + n] = s;
+			s2 = s1;
+			s1 = s;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,8 @@
+
+#define RICE_BLOCK		256
+/* worst case: 52 bits per sample and one header byte per block */
+#define RICE_MAX_BYTES(samples)	((samples) * 7 + (samples) / RICE_BLOCK + 1)
+
+int rice_encode(const int16_t *spl, int samples, uint8_t *data);
+int rice_decode(const uint8_t *data, int length, int samples, int16_t *spl);
+
@@ -24,9 +24,11 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <string.h>
+#include <poll.h>
 #include "../libsample/sample.h"
 #include "../liblogging/logging.h"
 #include "sender.h"
+#include "replay.h"
 #include <osmocom/core/timer.h>
 #ifdef HAVE_SDR
 #include "../libsdr/sdr_config.h"
@@ -117,6 +119,14 @@ int sender_create(sender_t *sender, const char *kanal, double sendefrequenz, dou
 		slave->slave = sender;
 	} else {
 		/* link audio device */
+		if (replay_on) {
+			sender->audio_open = replay_open;
+			sender->audio_start = replay_start;
+			sender->audio_close = replay_close;
+			sender->audio_read = replay_read;
+			sender->audio_write = replay_write;
+			sender->audio_get_tosend = replay_get_tosend;
+		} else
 #ifdef HAVE_SDR
 		if (use_sdr) {
 			sender->audio_open = sdr_open;
@@ -135,6 +145,9 @@ int sender_create(sender_t *sender, const char *kanal, double sendefrequenz, dou
 			sender->audio_read = sound_read;
 			sender->audio_write = sound_write;
 			sender->audio_get_tosend = sound_get_tosend;
+			sender->audio_get_poll_fds = sound_get_poll_fds;
+			sender->audio_poll_revents = sound_poll_revents;
+			sender->audio_poll_generation = sound_poll_generation;
 #else
 			LOGP(DSENDER, LOGL_ERROR, "No sound card support compiled in!\n");
 			rc = -ENOTSUP;
@@ -270,6 +283,59 @@ int sender_start_audio(void)
 	return rc;
 }
 
+/* Get the descriptors of all audio devices that wake up the main loop when
+ * samples have been captured. SDR and replay do not have any.
+ * Return the number of descriptors stored. */
+int sender_get_poll_fds(struct pollfd *fds, int space)
+{
+	sender_t *master;
+	int num = 0, rc;
+
+	for (master = sender_head; master; master = master->next) {
+		master->poll_fds_count = 0;
+		/* skip audio slaves */
+		if (master->master || !master->audio_get_poll_fds)
+			continue;
+
+		master->poll_fds_generation = master->audio_poll_generation(master->audio);
+		rc = master->audio_get_poll_fds(master->audio, fds + num, space - num);
+		if (rc <= 0)
+			continue;
+		master->poll_fds_index = num;
+		master->poll_fds_count = rc;
+		num += rc;
+	}
+
+	return num;
+}
+
+/* After poll() returned, the audio devices must evaluate their descriptors. */
+void sender_poll_revents(struct pollfd *fds)
+{
+	sender_t *master;
+
+	for (master = sender_head; master; master = master->next) {
+		if (master->poll_fds_count)
+			master->audio_poll_revents(master->audio, fds + master->poll_fds_index, master->poll_fds_count);
+	}
+}
+
+/* An audio device that recovered from an xrun has new descriptors.
+ * Return 1, if the descriptors must be collected again. */
+int sender_poll_fds_changed(void)
+{
+	sender_t *master;
+
+	for (master = sender_head; master; master = master->next) {
+		if (master->master || !master->audio_poll_generation)
+			continue;
+		if (master->audio_poll_generation(master->audio) != master->poll_fds_generation)
+			return 1;
+	}
+
+	return 0;
+}
+
 /* Destroy transceiver instance and unlink from list. */
 void sender_destroy(sender_t *sender)
 {
@@ -398,10 +464,19 @@ cant_recover:
 #ifdef DEBUG_TIME_CONSUMPTION
 		t2 = get_time();
 #endif
-		if (sender->wave_tx_rec.fp)
-			wave_write(&sender->wave_tx_rec, samples, count);
-		if (sender->wave_tx_play.fp)
-			wave_read(&sender->wave_tx_play, samples, count);
+		/* when replaying, the file io thread must keep up with the main loop */
+		if (sender->wave_tx_rec.fp) {
+			if (replay_on)
+				replay_wave_write(&sender->wave_tx_rec, samples, count);
+			else
+				wave_write(&sender->wave_tx_rec, samples, count);
+		}
+		if (sender->wave_tx_play.fp) {
+			if (replay_on)
+				replay_wave_read(&sender->wave_tx_play, samples, count);
+			else
+				wave_read(&sender->wave_tx_play, samples, count);
+		}
 
 		rc = sender->audio_write(sender->audio, samples, power, count, paging_signal, on, num_chan);
 		if (rc < 0) {
@@ -437,10 +512,20 @@ cant_recover:
 	t4 = get_time();
 #endif
 	if (count) {
-		if (sender->wave_rx_rec.fp)
-			wave_write(&sender->wave_rx_rec, samples, count);
-		if (sender->wave_rx_play.fp)
-			wave_read(&sender->wave_rx_play, samples, count);
+		if (sender->wave_rx_rec.fp) {
+			if (replay_on)
+				replay_wave_write(&sender->wave_rx_rec, samples, count);
+			else
+				wave_write(&sender->wave_rx_rec, samples, count);
+		}
+		if (sender->wave_rx_play.fp) {
+			if (replay_on) {
+				/* replay ends with the recording, process the last chunk */
+				if (replay_wave_read(&sender->wave_rx_play, samples, count) < count)
+					*quit = 1;
+			} else
+				wave_read(&sender->wave_rx_play, samples, count);
+		}
 
 		/* loop through all channels */
 		for (i = 0, inst = sender; inst; i++, inst = inst->slave) {
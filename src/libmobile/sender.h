@@ -8,7 +8,7 @@
 #include "../libemphasis/emphasis.h"
 #include "../libdisplay/display.h"
 
-#define MAX_SENDER	16
+#define MAX_SENDER	64
 
 /* how to send a 'paging' signal (trigger transmitter) */
 enum paging_signal {
@@ -30,6 +30,7 @@ typedef struct sender {
 	double			sendefrequenz;		/* transmitter frequency */
 	double			empfangsfrequenz;	/* receiver frequency */
 	double			ruffrequenz;		/* special paging frequency used for B-Netz */
+	void			(*destroy)(struct sender *sender); /* destroys the instance of the network */
 
 	/* FM/AM levels */
 	int			am;			/* use AM instead of FM */
@@ -48,6 +49,12 @@ typedef struct sender {
 	int			(*audio_write)(void *, sample_t **, uint8_t **, int, enum paging_signal *, int *, int);
 	int			(*audio_read)(void *, sample_t **, int, int, double *);
 	int			(*audio_get_tosend)(void *, int);
+	int			(*audio_get_poll_fds)(void *, struct pollfd *, int);
+	int			(*audio_poll_revents)(void *, struct pollfd *, int);
+	int			(*audio_poll_generation)(void *);
+	int			poll_fds_index;		/* descriptors of audio device in main loop */
+	int			poll_fds_count;
+	int			poll_fds_generation;	/* generation of descriptors above */
 	int			samplerate;
 	samplerate_t		srstate;		/* sample rate conversion state */
 	double			rx_gain;		/* factor of level to apply on RX samples */
@@ -100,6 +107,9 @@ void sender_set_fm(sender_t *sender, double max_deviation, double max_modulation
 void sender_set_am(sender_t *sender, double max_modulation, double speech_deviation, double max_display, double modulation_index);
 int sender_open_audio(int buffer_size, double interval);
 int sender_start_audio(void);
+int sender_get_poll_fds(struct pollfd *fds, int space);
+void sender_poll_revents(struct pollfd *fds);
+int sender_poll_fds_changed(void);
 void process_sender_audio(sender_t *sender, int *quit, sample_t **samples, uint8_t **power, int buffer_size);
 void sender_send(sender_t *sender, sample_t *samples, uint8_t *power, int count);
 void sender_receive(sender_t *sender, sample_t *samples, int count, double rf_level_db);
@@ -0,0 +1,1019 @@
+/* Split senders into worker processes
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* All senders run in one main loop, so DSP of all channels uses one CPU core.
+ * With sharding, the supervisor forks one worker process per group of
+ * channels (e.g. per SDR) after the senders have been created. Each worker
+ * destroys the senders of other workers and processes the audio of its own
+ * senders. The supervisor destroys all senders, but owns the OSMO-CC endpoint.
+ *
+ * Call control messages and audio frames between worker and supervisor are
+ * sent through rings in shared memory. Each direction has one ring for call
+ * control and one for audio. Each ring has one writer and one reader, so no
+ * locking is required. Both sides poll the rings in their main loop and read
+ * call control first. If the audio ring is full, the frame is dropped. A call
+ * control message is never dropped: If its ring is full, it is queued by the
+ * writer until the reader has made room.
+ *
+ * A worker uses its own callrefs towards its senders. The supervisor maps
+ * them to the callrefs of the OSMO-CC endpoint.
+ *
+ * If a subscriber registers at a worker, the supervisor stores the worker in
+ * its registry and broadcasts it to all workers. Only networks that call
+ * console_inscription() report registrations: AMPS, C-Netz, FuVSt, MPT1327,
+ * NMT and Radiocom 2000. A call from the fixed network is sent to the worker
+ * of the subscriber. If the subscriber is not in the registry, the call is
+ * offered to one worker after another, until a worker does not reject it.
+ *
+ * With built-in call forwarding, each worker has its own call control
+ * instance. A call to a subscriber of the same worker is connected there, so
+ * its audio does not pass the supervisor. (see call_up_setup())
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <sys/time.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "sender.h"
+#include "call.h"
+#include "cause.h"
+#include "shard.h"
+#ifdef HAVE_SDR
+#include "../libsdr/sdr_config.h"
+#endif
+
+#define CTRL_SLOTS	64		/* call control messages per ring */
+#define AUDIO_SLOTS	256		/* audio frames per ring */
+#define MAX_DATA	2048		/* audio data per message */
+#define REGISTRY_HASH	256
+
+int shard_workers = 0;
+int shard_worker = -1;
+
+enum shard_msg_type {
+	/* worker to supervisor */
+	SHARD_UP_SETUP,
+	SHARD_UP_ALERTING,
+	SHARD_UP_EARLY,
+	SHARD_UP_ANSWER,
+	SHARD_UP_RELEASE,
+	SHARD_UP_TONE_RECALL,
+	SHARD_UP_AUDIO,
+	SHARD_UP_INSCRIPTION,
+	/* supervisor to worker */
+	SHARD_DOWN_SETUP,
+	SHARD_DOWN_ANSWER,
+	SHARD_DOWN_DISCONNECT,
+	SHARD_DOWN_RELEASE,
+	SHARD_DOWN_AUDIO,
+	SHARD_DOWN_REGISTRY,
+};
+
+typedef struct shard_msg {
+	enum shard_msg_type type;
+	int		callref;	/* callref of worker */
+	int		value;		/* cause, caller type, network, on/off, worker */
+	char		number[33];	/* caller ID, connect ID, station ID */
+	char		dialing[33];
+	char		network_id[33];
+	struct timeval	tv_meter;
+	uint16_t	sequence;	/* RTP header of audio */
+	uint8_t		marker;
+	uint32_t	timestamp;
+	uint32_t	ssrc;
+	int		len;
+	uint8_t		data[MAX_DATA];
+} shard_msg_t;
+
+struct shard_ring {
+	volatile int	in, out;	/* in and out pointers (one writer, one reader) */
+	int		slots;
+	shard_msg_t	*msg;		/* messages behind the peers, same address in all processes */
+};
+
+struct shard_peer {
+	pid_t		pid;
+	volatile int	running;
+	struct shard_ring up_ctrl, up_audio;
+	struct shard_ring down_ctrl, down_audio;
+};
+
+/* shared memory, mapped before fork */
+struct shard_shm {
+	volatile int	quit;		/* supervisor tells workers to quit */
+	struct shard_peer peer[0];
+};
+
+static struct shard_shm *shm = NULL;
+static size_t shm_size;
+
+/* call control messages that did not fit into the ring, queued by the writer */
+typedef struct shard_backlog {
+	struct shard_backlog *next;
+	shard_msg_t	msg;
+} shard_backlog_t;
+
+static shard_backlog_t *backlog[SHARD_MAX_WORKERS];	/* per worker */
+
+/*
+ * ring
+ */
+
+static shard_msg_t *ring_setup(struct shard_ring *ring, shard_msg_t *msg, int slots)
+{
+	ring->slots = slots;
+	ring->msg = msg;
+	return msg + slots;
+}
+
+static void msg_init(shard_msg_t *msg, enum shard_msg_type type, int callref)
+{
+	msg->type = type;
+	msg->callref = callref;
+	msg->value = 0;
+	msg->number[0] = msg->dialing[0] = msg->network_id[0] = '\0';
+	msg->len = 0;
+}
+
+/* get next free message, NULL if ring is full */
+static shard_msg_t *ring_alloc(struct shard_ring *ring, enum shard_msg_type type, int callref)
+{
+	shard_msg_t *msg;
+
+	if ((ring->in + 1) % ring->slots == ring->out)
+		return NULL;
+	msg = &ring->msg[ring->in];
+	msg_init(msg, type, callref);
+	return msg;
+}
+
+static void ring_commit(struct shard_ring *ring)
+{
+	/* message must be complete before reader sees it */
+	__sync_synchronize();
+	ring->in = (ring->in + 1) % ring->slots;
+}
+
+/* get next message, NULL if ring is empty */
+static shard_msg_t *ring_get(struct shard_ring *ring)
+{
+	if (ring->out == ring->in)
+		return NULL;
+	__sync_synchronize();
+	return &ring->msg[ring->out];
+}
+
+static void ring_free(struct shard_ring *ring)
+{
+	/* message must be read before writer overwrites it */
+	__sync_synchronize();
+	ring->out = (ring->out + 1) % ring->slots;
+}
+
+/* the worker writes to its up rings, the supervisor to the down rings of each worker */
+static struct shard_ring *tx_ring(int worker, int audio)
+{
+	if (shard_worker >= 0)
+		return (audio) ? &shm->peer[worker].up_audio : &shm->peer[worker].up_ctrl;
+	return (audio) ? &shm->peer[worker].down_audio : &shm->peer[worker].down_ctrl;
+}
+
+/* get next free call control message, queue it if the ring is full */
+static shard_msg_t *ctrl_alloc(int worker, enum shard_msg_type type, int callref)
+{
+	shard_backlog_t *entry, **entryp;
+	shard_msg_t *msg;
+
+	/* nothing must pass queued messages */
+	if (!backlog[worker] && (msg = ring_alloc(tx_ring(worker, 0), type, callref)))
+		return msg;
+
+	if (!backlog[worker])
+		LOGP(DCALL, LOGL_NOTICE, "Shard call control ring of worker %d is full, queueing messages\n", worker);
+	entry = calloc(1, sizeof(*entry));
+	if (!entry) {
+		LOGP(DCALL, LOGL_ERROR, "No memory!\n");
+		abort();
+	}
+	for (entryp = &backlog[worker]; *entryp; entryp = &((*entryp)->next));
+	*entryp = entry;
+	msg_init(&entry->msg, type, callref);
+	return &entry->msg;
+}
+
+static void ctrl_commit(int worker)
+{
+	/* a queued message is sent by backlog_flush() */
+	if (!backlog[worker])
+		ring_commit(tx_ring(worker, 0));
+}
+
+/* move queued call control messages into the ring, as long as there is room */
+static void backlog_flush(int worker)
+{
+	struct shard_ring *ring = tx_ring(worker, 0);
+	shard_backlog_t *entry;
+	shard_msg_t *msg;
+
+	while ((entry = backlog[worker])) {
+		msg = ring_alloc(ring, entry->msg.type, entry->msg.callref);
+		if (!msg)
+			return;
+		/* call control messages carry no data */
+		memcpy(msg, &entry->msg, offsetof(shard_msg_t, data));
+		ring_commit(ring);
+		backlog[worker] = entry->next;
+		free(entry);
+	}
+}
+
+static void backlog_free(void)
+{
+	shard_backlog_t *entry;
+	int i;
+
+	for (i = 0; i < SHARD_MAX_WORKERS; i++) {
+		while ((entry = backlog[i])) {
+			backlog[i] = entry->next;
+			free(entry);
+		}
+	}
+}
+
+/* get next free audio message, NULL if ring is full */
+static shard_msg_t *audio_alloc(int worker, enum shard_msg_type type, int callref)
+{
+	shard_msg_t *msg;
+
+	msg = ring_alloc(tx_ring(worker, 1), type, callref);
+	if (!msg)
+		LOGP(DCALL, LOGL_NOTICE, "Shard audio ring of worker %d is full, dropping frame\n", worker);
+	return msg;
+}
+
+static void copy_string(char *dst, const char *src, size_t size)
+{
+	if (!src)
+		src = "";
+	strncpy(dst, src, size - 1);
+	dst[size - 1] = '\0';
+}
+
+/*
+ * registry of subscribers
+ */
+
+typedef struct shard_subscriber {
+	struct shard_subscriber *next;
+	char		number[33];
+	int		worker;
+} shard_subscriber_t;
+
+static shard_subscriber_t *registry[REGISTRY_HASH];
+
+static uint32_t registry_hash_key(const char *number)
+{
+	uint32_t key = 2166136261u;
+
+	while (*number)
+		key = (key ^ (uint8_t)*number++) * 16777619u;
+	return key % REGISTRY_HASH;
+}
+
+/* return 1, if the worker of the subscriber has changed */
+static int registry_set(const char *number, int worker)
+{
+	shard_subscriber_t *subscr, **subscrp;
+
+	subscrp = &registry[registry_hash_key(number)];
+	for (subscr = *subscrp; subscr; subscr = subscr->next) {
+		if (!strcmp(subscr->number, number))
+			break;
+	}
+	if (!subscr) {
+		subscr = calloc(1, sizeof(*subscr));
+		if (!subscr) {
+			LOGP(DCALL, LOGL_ERROR, "No memory!\n");
+			abort();
+		}
+		copy_string(subscr->number, number, sizeof(subscr->number));
+		subscr->worker = -1;
+		subscr->next = *subscrp;
+		*subscrp = subscr;
+	}
+	if (subscr->worker == worker)
+		return 0;
+	LOGP(DCALL, LOGL_DEBUG, "Subscriber '%s' is served by worker %d\n", number, worker);
+	subscr->worker = worker;
+	return 1;
+}
+
+/* return worker of subscriber, -1 if unknown */
+int shard_registry_lookup(const char *number)
+{
+	shard_subscriber_t *subscr;
+
+	for (subscr = registry[registry_hash_key(number)]; subscr; subscr = subscr->next) {
+		if (!strcmp(subscr->number, number))
+			return subscr->worker;
+	}
+	return -1;
+}
+
+static void registry_flush(void)
+{
+	shard_subscriber_t *subscr;
+	int i;
+
+	for (i = 0; i < REGISTRY_HASH; i++) {
+		while ((subscr = registry[i])) {
+			registry[i] = subscr->next;
+			free(subscr);
+		}
+	}
+}
+
+/*
+ * calls of supervisor
+ */
+
+typedef struct shard_call {
+	struct shard_call *next;
+	int		callref;	/* callref of call control */
+	int		worker;
+	int		wcallref;	/* callref of worker */
+	/* offer call to one worker after another, if subscriber is unknown */
+	int		hunting;
+	uint32_t	tried;		/* bit mask of workers */
+	int		cause;		/* cause to report, if all workers reject */
+	char		caller_id[33];
+	enum number_type caller_type;
+	char		dialing[33];
+} shard_call_t;
+
+static shard_call_t *call_head = NULL;
+static int down_callref = 0;
+
+static shard_call_t *create_call(int callref, int worker, int wcallref)
+{
+	shard_call_t *call;
+
+	call = calloc(1, sizeof(*call));
+	if (!call) {
+		LOGP(DCALL, LOGL_ERROR, "No memory!\n");
+		abort();
+	}
+	call->callref = callref;
+	call->worker = worker;
+	call->wcallref = wcallref;
+	call->next = call_head;
+	call_head = call;
+
+	return call;
+}
+
+static void destroy_call(shard_call_t *call)
+{
+	shard_call_t **callp = &call_head;
+
+	while (*callp) {
+		if (*callp == call) {
+			*callp = call->next;
+			free(call);
+			return;
+		}
+		callp = &((*callp)->next);
+	}
+}
+
+static shard_call_t *get_call(int callref)
+{
+	shard_call_t *call;
+
+	for (call = call_head; call; call = call->next) {
+		if (call->callref == callref)
+			return call;
+	}
+	return NULL;
+}
+
+static shard_call_t *get_call_worker(int worker, int wcallref)
+{
+	shard_call_t *call;
+
+	for (call = call_head; call; call = call->next) {
+		if (call->worker == worker && call->wcallref == wcallref)
+			return call;
+	}
+	return NULL;
+}
+
+/*
+ * start and stop
+ */
+
+/* check if channel is in comma separated list, the list ends at '/' */
+static int in_list(const char *kanal, const char *list)
+{
+	size_t len = strlen(kanal);
+	const char *end;
+
+	while (*list && *list != '/') {
+		end = list + strcspn(list, ",/");
+		if ((size_t)(end - list) == len && !strncmp(list, kanal, len))
+			return 1;
+		list = (*end == ',') ? end + 1 : end;
+	}
+	return 0;
+}
+
+/* destroy senders of other workers, then link senders that share a device again
+ * the supervisor gives no spec and destroys all senders
+ */
+static void keep_senders(const char *spec)
+{
+	sender_t *sender, *next, *master, *slave;
+
+	/* slaves get the audio functions of their master, they may become master */
+	for (sender = sender_head; sender; sender = sender->next) {
+		if (!sender->master)
+			continue;
+		sender->audio_open = sender->master->audio_open;
+		sender->audio_start = sender->master->audio_start;
+		sender->audio_close = sender->master->audio_close;
+		sender->audio_read = sender->master->audio_read;
+		sender->audio_write = sender->master->audio_write;
+		sender->audio_get_tosend = sender->master->audio_get_tosend;
+	}
+
+	for (sender = sender_head; sender; sender = sender->next) {
+		sender->master = NULL;
+		sender->slave = NULL;
+	}
+
+	/* stop timers and DSP of senders that are processed by other workers */
+	for (sender = sender_head; sender; sender = next) {
+		next = sender->next;
+		if (!spec || !in_list(sender->kanal, spec))
+			sender->destroy(sender);
+	}
+
+	for (sender = sender_head; sender; sender = sender->next) {
+		for (master = sender_head; master != sender; master = master->next) {
+			if (!master->master && !strcmp(master->device, sender->device))
+				break;
+		}
+		if (master == sender)
+			continue;
+		sender->master = master;
+		for (slave = master; slave->slave; slave = slave->slave);
+		slave->slave = sender;
+	}
+}
+
+/*
+ * Fork one worker for each spec. A spec is a comma separated list of channels,
+ * optionally followed by '/' and the SDR device args of this worker.
+ */
+int shard_start(int workers, const char *spec[])
+{
+	sender_t *sender;
+	const char *args;
+	shard_msg_t *msg;
+	pid_t pid;
+	int i, found;
+
+	if (workers < 1 || workers > SHARD_MAX_WORKERS) {
+		LOGP(DCALL, LOGL_ERROR, "Number of shards must be 1..%d!\n", SHARD_MAX_WORKERS);
+		return -EINVAL;
+	}
+
+	/* each channel must be assigned to one worker */
+	for (sender = sender_head; sender; sender = sender->next) {
+		for (i = 0, found = 0; i < workers; i++)
+			found += in_list(sender->kanal, spec[i]);
+		if (found != 1) {
+			LOGP(DCALL, LOGL_ERROR, "Channel %s must be given in exactly one shard, but is given in %d shards!\n", sender->kanal, found);
+			return -EINVAL;
+		}
+		if (!sender->destroy) {
+			LOGP(DCALL, LOGL_ERROR, "Channel %s cannot be processed by a worker, because this network does not support it!\n", sender->kanal);
+			return -ENOTSUP;
+		}
+	}
+
+	shm_size = sizeof(*shm) + sizeof(struct shard_peer) * workers + sizeof(shard_msg_t) * (CTRL_SLOTS + AUDIO_SLOTS) * 2 * workers;
+	shm = mmap(NULL, shm_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (shm == MAP_FAILED) {
+		shm = NULL;
+		LOGP(DCALL, LOGL_ERROR, "Failed to map shared memory (%s)!\n", strerror(errno));
+		return -errno;
+	}
+	memset(shm, 0, shm_size);
+	msg = (shard_msg_t *)&shm->peer[workers];
+	for (i = 0; i < workers; i++) {
+		msg = ring_setup(&shm->peer[i].up_ctrl, msg, CTRL_SLOTS);
+		msg = ring_setup(&shm->peer[i].up_audio, msg, AUDIO_SLOTS);
+		msg = ring_setup(&shm->peer[i].down_ctrl, msg, CTRL_SLOTS);
+		msg = ring_setup(&shm->peer[i].down_audio, msg, AUDIO_SLOTS);
+	}
+	shard_workers = workers;
+
+	for (i = 0; i < workers; i++) {
+		shm->peer[i].running = 1;
+		pid = fork();
+		if (pid < 0) {
+			LOGP(DCALL, LOGL_ERROR, "Failed to fork worker %d (%s)!\n", i, strerror(errno));
+			shm->peer[i].running = 0;
+			shard_exit();
+			return -errno;
+		}
+		if (pid == 0) {
+			shard_worker = i;
+			keep_senders(spec[i]);
+			args = strchr(spec[i], '/');
+#ifdef HAVE_SDR
+			if (args)
+				sdr_config->device_args = args + 1;
+#else
+			(void)args;
+#endif
+			LOGP(DCALL, LOGL_INFO, "Worker %d started with channels '%s'.\n", i, spec[i]);
+			return 0;
+		}
+		shm->peer[i].pid = pid;
+	}
+
+	/* supervisor does not process any sender */
+	keep_senders(NULL);
+
+	return 0;
+}
+
+void shard_exit(void)
+{
+	shard_call_t *call;
+	int i;
+
+	if (!shm)
+		return;
+
+	if (shard_worker < 0) {
+		/* tell workers to quit and wait for them */
+		shm->quit = 1;
+		for (i = 0; i < shard_workers; i++) {
+			if (shm->peer[i].pid > 0)
+				waitpid(shm->peer[i].pid, NULL, 0);
+		}
+	} else
+		shm->peer[shard_worker].running = 0;
+
+	while ((call = call_head)) {
+		call_head = call->next;
+		free(call);
+	}
+	registry_flush();
+	backlog_free();
+
+	munmap(shm, shm_size);
+	shm = NULL;
+	shard_workers = 0;
+}
+
+/* return 1, if this process shall quit */
+int shard_quit(void)
+{
+	int i;
+
+	if (!shm)
+		return 0;
+
+	if (shard_worker >= 0)
+		return shm->quit;
+
+	/* supervisor quits, if a worker is gone */
+	for (i = 0; i < shard_workers; i++) {
+		if (shm->peer[i].pid > 0 && waitpid(shm->peer[i].pid, NULL, WNOHANG) == shm->peer[i].pid) {
+			LOGP(DCALL, LOGL_ERROR, "Worker %d terminated!\n", i);
+			shm->peer[i].pid = 0;
+			shm->peer[i].running = 0;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * worker
+ */
+
+int shard_up_setup(const char *callerid, const char *dialing, uint8_t network, const char *network_id)
+{
+	static int seq = 0;
+	shard_msg_t *msg;
+	int callref;
+
+	/* the upper 8 bits are the worker, so callrefs of workers are unique */
+	if (++seq > 0xffffff)
+		seq = 1;
+	callref = ((shard_worker + 1) << 24) | seq;
+
+	if (!shm)
+		return 0;
+	msg = ctrl_alloc(shard_worker, SHARD_UP_SETUP, callref);
+	msg->value = network;
+	copy_string(msg->number, callerid, sizeof(msg->number));
+	copy_string(msg->dialing, dialing, sizeof(msg->dialing));
+	copy_string(msg->network_id, network_id, sizeof(msg->network_id));
+	ctrl_commit(shard_worker);
+
+	return callref;
+}
+
+static void up_msg(enum shard_msg_type type, int callref, int value, const char *number)
+{
+	shard_msg_t *msg;
+
+	if (!shm)
+		return;
+	msg = ctrl_alloc(shard_worker, type, callref);
+	msg->value = value;
+	copy_string(msg->number, number, sizeof(msg->number));
+	ctrl_commit(shard_worker);
+}
+
+void shard_up_alerting(int callref)
+{
+	up_msg(SHARD_UP_ALERTING, callref, 0, NULL);
+}
+
+void shard_up_early(int callref)
+{
+	up_msg(SHARD_UP_EARLY, callref, 0, NULL);
+}
+
+void shard_up_answer(int callref, const char *connect_id)
+{
+	up_msg(SHARD_UP_ANSWER, callref, 0, connect_id);
+}
+
+void shard_up_release(int callref, int cause)
+{
+	up_msg(SHARD_UP_RELEASE, callref, cause, NULL);
+}
+
+void shard_up_tone_recall(int callref, int on)
+{
+	up_msg(SHARD_UP_TONE_RECALL, callref, on, NULL);
+}
+
+void shard_up_inscription(const char *station_id)
+{
+	up_msg(SHARD_UP_INSCRIPTION, 0, 0, station_id);
+}
+
+void shard_up_audio(int callref, sample_t *samples, int count)
+{
+	shard_msg_t *msg;
+
+	if (count * (int)sizeof(*samples) > MAX_DATA) {
+		LOGP(DCALL, LOGL_ERROR, "Too many samples (%d) to forward, please fix!\n", count);
+		abort();
+	}
+	if (!shm)
+		return;
+	msg = audio_alloc(shard_worker, SHARD_UP_AUDIO, callref);
+	if (!msg)
+		return;
+	msg->len = count * sizeof(*samples);
+	memcpy(msg->data, samples, msg->len);
+	ring_commit(tx_ring(shard_worker, 1));
+}
+
+static void worker_msg(shard_msg_t *msg)
+{
+	int rc;
+
+	switch (msg->type) {
+	case SHARD_DOWN_SETUP:
+		rc = call_down_setup(msg->callref, msg->number, msg->value, msg->dialing);
+		/* rejection is reported like a release, the supervisor handles it */
+		if (rc < 0)
+			shard_up_release(msg->callref, -rc);
+		break;
+	case SHARD_DOWN_ANSWER:
+		call_down_answer(msg->callref, &msg->tv_meter);
+		break;
+	case SHARD_DOWN_DISCONNECT:
+		call_down_disconnect(msg->callref, msg->value);
+		break;
+	case SHARD_DOWN_RELEASE:
+		call_down_release(msg->callref, msg->value);
+		break;
+	case SHARD_DOWN_AUDIO:
+		/* already decoded by supervisor */
+		call_down_audio(NULL, NULL, msg->callref, msg->sequence, msg->marker, msg->timestamp, msg->ssrc, msg->data, msg->len);
+		break;
+	case SHARD_DOWN_REGISTRY:
+		registry_set(msg->number, msg->value);
+		break;
+	default:
+		LOGP(DCALL, LOGL_ERROR, "Worker received unexpected message %d!\n", msg->type);
+	}
+}
+
+/*
+ * supervisor
+ */
+
+/* call control towards a worker that is gone is dropped, the supervisor quits anyway */
+static shard_msg_t *down_alloc(int worker, enum shard_msg_type type, int callref)
+{
+	if (!shm->peer[worker].running) {
+		LOGP(DCALL, LOGL_NOTICE, "Worker %d is gone, dropping message %d\n", worker, type);
+		return NULL;
+	}
+	return ctrl_alloc(worker, type, callref);
+}
+
+static int offer_setup(shard_call_t *call)
+{
+	shard_msg_t *msg;
+
+	call->tried |= 1 << call->worker;
+	msg = down_alloc(call->worker, SHARD_DOWN_SETUP, call->wcallref);
+	if (!msg)
+		return -CAUSE_TEMPFAIL;
+	msg->value = call->caller_type;
+	copy_string(msg->number, call->caller_id, sizeof(msg->number));
+	copy_string(msg->dialing, call->dialing, sizeof(msg->dialing));
+	ctrl_commit(call->worker);
+
+	return 0;
+}
+
+/* offer call to next worker, return 0 if there is no worker left */
+static int hunt_next(shard_call_t *call, int cause)
+{
+	int i;
+
+	/* a cause other than 'no channel' is more specific, e.g. 'busy' */
+	if (!call->cause || call->cause == CAUSE_NOCHANNEL)
+		call->cause = cause;
+
+	for (i = 0; i < shard_workers; i++) {
+		if ((call->tried & (1 << i)) || !shm->peer[i].running)
+			continue;
+		LOGP(DCALL, LOGL_DEBUG, "Worker %d rejected call with cause %d, offering to worker %d\n", call->worker, cause, i);
+		call->worker = i;
+		if (offer_setup(call) == 0)
+			return 1;
+	}
+	return 0;
+}
+
+int shard_down_setup(int callref, const char *caller_id, enum number_type caller_type, const char *dialing)
+{
+	shard_call_t *call;
+	int worker, rc, i;
+
+	worker = shard_registry_lookup(dialing);
+	if (worker < 0 || !shm->peer[worker].running) {
+		for (i = 0; i < shard_workers; i++) {
+			if (shm->peer[i].running)
+				break;
+		}
+		if (i == shard_workers)
+			return -CAUSE_OUTOFORDER;
+		worker = i;
+	}
+
+	if (++down_callref > 0xffffff)
+		down_callref = 1;
+	call = create_call(callref, worker, 0x40000000 | down_callref);
+	call->hunting = (shard_registry_lookup(dialing) < 0);
+	copy_string(call->caller_id, caller_id, sizeof(call->caller_id));
+	call->caller_type = caller_type;
+	copy_string(call->dialing, dialing, sizeof(call->dialing));
+
+	rc = offer_setup(call);
+	if (rc < 0)
+		destroy_call(call);
+	return rc;
+}
+
+void shard_down_answer(int callref, struct timeval *tv_meter)
+{
+	shard_call_t *call = get_call(callref);
+	shard_msg_t *msg;
+
+	if (!call)
+		return;
+	msg = down_alloc(call->worker, SHARD_DOWN_ANSWER, call->wcallref);
+	if (!msg)
+		return;
+	msg->tv_meter = *tv_meter;
+	ctrl_commit(call->worker);
+}
+
+static void down_msg(int callref, enum shard_msg_type type, int cause, int destroy)
+{
+	shard_call_t *call = get_call(callref);
+	shard_msg_t *msg;
+
+	if (!call)
+		return;
+	msg = down_alloc(call->worker, type, call->wcallref);
+	if (msg) {
+		msg->value = cause;
+		ctrl_commit(call->worker);
+	}
+	if (destroy)
+		destroy_call(call);
+}
+
+void shard_down_disconnect(int callref, int cause)
+{
+	down_msg(callref, SHARD_DOWN_DISCONNECT, cause, 0);
+}
+
+void shard_down_release(int callref, int cause)
+{
+	down_msg(callref, SHARD_DOWN_RELEASE, cause, 1);
+}
+
+void shard_down_audio(void *decoder, void *decoder_priv, int callref, uint16_t sequence, uint8_t marker, uint32_t timestamp, uint32_t ssrc, uint8_t *payload, int payload_len)
+{
+	void (*decode)(uint8_t *src_data, int src_len, uint8_t **dst_data, int *dst_len, void *priv) = decoder;
+	shard_call_t *call = get_call(callref);
+	shard_msg_t *msg;
+	uint8_t *data = payload;
+	int len = payload_len;
+
+	if (!call)
+		return;
+
+	/* the decoder's private data only exists in the supervisor, so decode here */
+	if (decode)
+		decode(payload, payload_len, &data, &len, decoder_priv);
+	if (len > MAX_DATA) {
+		LOGP(DCALL, LOGL_NOTICE, "Audio frame of %d bytes too large, dropping!\n", len);
+		goto out;
+	}
+	if (!shm->peer[call->worker].running)
+		goto out;
+	msg = audio_alloc(call->worker, SHARD_DOWN_AUDIO, call->wcallref);
+	if (!msg)
+		goto out;
+	msg->sequence = sequence;
+	msg->marker = marker;
+	msg->timestamp = timestamp;
+	msg->ssrc = ssrc;
+	msg->len = len;
+	memcpy(msg->data, data, len);
+	ring_commit(tx_ring(call->worker, 1));
+
+out:
+	if (data != payload)
+		free(data);
+}
+
+/* tell all workers which worker serves the subscriber */
+static void broadcast_registry(const char *number, int worker)
+{
+	shard_msg_t *msg;
+	int i;
+
+	for (i = 0; i < shard_workers; i++) {
+		if (!shm->peer[i].running)
+			continue;
+		msg = down_alloc(i, SHARD_DOWN_REGISTRY, 0);
+		msg->value = worker;
+		copy_string(msg->number, number, sizeof(msg->number));
+		ctrl_commit(i);
+	}
+}
+
+static void supervisor_msg(int worker, shard_msg_t *msg)
+{
+	shard_call_t *call;
+	int callref, cause;
+
+	switch (msg->type) {
+	case SHARD_UP_SETUP:
+		callref = call_up_setup(msg->number, msg->dialing, msg->value, msg->network_id);
+		create_call(callref, worker, msg->callref);
+		return;
+	case SHARD_UP_INSCRIPTION:
+		if (registry_set(msg->number, worker))
+			broadcast_registry(msg->number, worker);
+		return;
+	default:
+		break;
+	}
+
+	call = get_call_worker(worker, msg->callref);
+	if (!call) {
+		if (msg->type != SHARD_UP_AUDIO)
+			LOGP(DCALL, LOGL_DEBUG, "Worker %d sent message %d for unknown callref %d, ignoring\n", worker, msg->type, msg->callref);
+		return;
+	}
+
+	switch (msg->type) {
+	case SHARD_UP_ALERTING:
+		call->hunting = 0;
+		call_up_alerting(call->callref);
+		break;
+	case SHARD_UP_EARLY:
+		call->hunting = 0;
+		call_up_early(call->callref);
+		break;
+	case SHARD_UP_ANSWER:
+		call->hunting = 0;
+		call_up_answer(call->callref, msg->number);
+		break;
+	case SHARD_UP_RELEASE:
+		if (call->hunting && hunt_next(call, msg->value))
+			break;
+		callref = call->callref;
+		cause = (call->hunting) ? call->cause : msg->value;
+		destroy_call(call);
+		call_up_release(callref, cause);
+		break;
+	case SHARD_UP_TONE_RECALL:
+		call_tone_recall(call->callref, msg->value);
+		break;
+	case SHARD_UP_AUDIO:
+		call_up_audio(call->callref, (sample_t *)msg->data, msg->len / sizeof(sample_t));
+		break;
+	default:
+		LOGP(DCALL, LOGL_ERROR, "Supervisor received unexpected message %d!\n", msg->type);
+	}
+}
+
+static int read_ring(struct shard_ring *ring, int worker)
+{
+	shard_msg_t *msg;
+	int work = 0;
+
+	while ((msg = ring_get(ring))) {
+		if (shard_worker >= 0)
+			worker_msg(msg);
+		else
+			supervisor_msg(worker, msg);
+		ring_free(ring);
+		work = 1;
+	}
+	return work;
+}
+
+/* handle messages from the other side, return 1 if work was done
+ * call control is read first, so audio never arrives before its setup
+ */
+int shard_handle(void)
+{
+	int work = 0;
+	int i;
+
+	if (!shm)
+		return 0;
+
+	if (shard_worker >= 0) {
+		backlog_flush(shard_worker);
+		work |= read_ring(&shm->peer[shard_worker].down_ctrl, shard_worker);
+		work |= read_ring(&shm->peer[shard_worker].down_audio, shard_worker);
+		return work;
+	}
+
+	for (i = 0; i < shard_workers; i++) {
+		backlog_flush(i);
+		work |= read_ring(&shm->peer[i].up_ctrl, i);
+		work |= read_ring(&shm->peer[i].up_audio, i);
+	}
+	return work;
+}
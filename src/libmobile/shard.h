@@ -0,0 +1,29 @@
+
+#define SHARD_MAX_WORKERS	16
+
+extern int shard_workers;	/* number of workers, 0 if senders are not split */
+extern int shard_worker;	/* index of this worker, -1 for supervisor or if not split */
+
+int shard_start(int workers, const char *spec[]);
+void shard_exit(void);
+int shard_handle(void);
+int shard_quit(void);
+int shard_registry_lookup(const char *number);
+
+/* worker: call control towards supervisor */
+int shard_up_setup(const char *callerid, const char *dialing, uint8_t network, const char *network_id);
+void shard_up_alerting(int callref);
+void shard_up_early(int callref);
+void shard_up_answer(int callref, const char *connect_id);
+void shard_up_release(int callref, int cause);
+void shard_up_tone_recall(int callref, int on);
+void shard_up_audio(int callref, sample_t *samples, int count);
+void shard_up_inscription(const char *station_id);
+
+/* supervisor: call control towards workers */
+int shard_down_setup(int callref, const char *caller_id, enum number_type caller_type, const char *dialing);
+void shard_down_answer(int callref, struct timeval *tv_meter);
+void shard_down_disconnect(int callref, int cause);
+void shard_down_release(int callref, int cause);
+void shard_down_audio(void *decoder, void *decoder_priv, int callref, uint16_t sequence, uint8_t marker, uint32_t timestamp, uint32_t ssrc, uint8_t *payload, int payload_len);
+
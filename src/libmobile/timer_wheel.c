@@ -0,0 +1,198 @@
+/* Hierarchical timing wheel
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* The wheel has four levels with 256 slots each, one tick is a millisecond.
+ * Level 0 holds timers that expire within the next 256 ticks, one slot per
+ * tick. Each slot of level 1 covers 256 ticks, each slot of level 2 covers
+ * 65536 ticks and so on. When level 0 wraps, the next slot of level 1 is
+ * cascaded: its timers are moved to level 0. Adding and removing a timer
+ * only links or unlinks it in a slot, there is no search or sort.
+ *
+ * The wheel is advanced by the main loop with the time of each DSP interval.
+ * A timer is scheduled relative to the time of the last interval, it expires
+ * in the first interval at or after its expiry tick.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "get_time.h"
+#include "timer_wheel.h"
+
+#define WHEEL_BITS	8
+#define WHEEL_SLOTS	(1 << WHEEL_BITS)
+#define WHEEL_MASK	(WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS	4
+#define WHEEL_MAX	(((uint64_t)1 << (WHEEL_BITS * WHEEL_LEVELS)) - 1)
+#define TICKS_PER_SEC	1000
+
+static struct timer_wheel {
+	int		initialized;
+	double		start;			/* time of tick 0 */
+	uint64_t	tick;			/* all ticks up to this one are processed */
+	uint64_t	now;			/* tick of current time, timers are scheduled from here */
+	int		count;			/* number of scheduled timers */
+	wheel_timer_t	*slot[WHEEL_LEVELS][WHEEL_SLOTS];
+} wheel;
+
+void timer_wheel_init(double now)
+{
+	if (wheel.count) {
+		fprintf(stderr, "Timer wheel initialized while timers are scheduled, please fix!\n");
+		abort();
+	}
+	wheel.start = now;
+	wheel.tick = 0;
+	wheel.now = 0;
+	wheel.initialized = 1;
+}
+
+/* link timer into the slot of its expiry, relative to the current tick */
+static void wheel_link(wheel_timer_t *timer)
+{
+	uint64_t delta = timer->expires - wheel.tick;
+	wheel_timer_t **slot;
+	int level;
+
+	for (level = 0; level < WHEEL_LEVELS - 1; level++) {
+		if (delta < ((uint64_t)1 << (WHEEL_BITS * (level + 1))))
+			break;
+	}
+	slot = &wheel.slot[level][(timer->expires >> (WHEEL_BITS * level)) & WHEEL_MASK];
+	timer->next = *slot;
+	if (timer->next)
+		timer->next->pprev = &timer->next;
+	timer->pprev = slot;
+	*slot = timer;
+}
+
+static void wheel_unlink(wheel_timer_t *timer)
+{
+	*timer->pprev = timer->next;
+	if (timer->next)
+		timer->next->pprev = timer->pprev;
+	timer->next = NULL;
+	timer->pprev = NULL;
+}
+
+void wheel_timer_setup(wheel_timer_t *timer, void (*cb)(void *data), void *data)
+{
+	timer->next = NULL;
+	timer->pprev = NULL;
+	timer->expires = 0;
+	timer->cb = cb;
+	timer->data = data;
+}
+
+void wheel_timer_schedule(wheel_timer_t *timer, int seconds, int microseconds)
+{
+	uint64_t delay;
+
+	if (!wheel.initialized)
+		timer_wheel_init(get_time());
+
+	if (timer->pprev)
+		wheel_unlink(timer);
+	else
+		wheel.count++;
+
+	/* round up to next tick, so a timer never expires early */
+	delay = ((uint64_t)seconds * 1000000 + microseconds + 1000000 / TICKS_PER_SEC - 1) / (1000000 / TICKS_PER_SEC);
+	if (delay < 1)
+		delay = 1;
+	if (delay > WHEEL_MAX - (wheel.now - wheel.tick))
+		delay = WHEEL_MAX - (wheel.now - wheel.tick);
+	timer->expires = wheel.now + delay;
+	wheel_link(timer);
+}
+
+void wheel_timer_del(wheel_timer_t *timer)
+{
+	if (!timer->pprev)
+		return;
+	wheel_unlink(timer);
+	wheel.count--;
+}
+
+int wheel_timer_pending(const wheel_timer_t *timer)
+{
+	return timer->pprev != NULL;
+}
+
+int timer_wheel_count(void)
+{
+	return wheel.count;
+}
+
+/* move timers of the current slot in given level to lower levels */
+static void wheel_cascade(int level)
+{
+	wheel_timer_t **slot, *timer;
+
+	slot = &wheel.slot[level][(wheel.tick >> (WHEEL_BITS * level)) & WHEEL_MASK];
+	while ((timer = *slot)) {
+		wheel_unlink(timer);
+		wheel_link(timer);
+	}
+}
+
+/* advance wheel to given time, return 1, if any timer expired */
+int timer_wheel_work(double now)
+{
+	uint64_t target;
+	wheel_timer_t **slot, *timer;
+	int level, work = 0;
+
+	if (!wheel.initialized)
+		timer_wheel_init(now);
+	if (now <= wheel.start)
+		return 0;
+	target = (uint64_t)((now - wheel.start) * TICKS_PER_SEC);
+	/* a timer that is scheduled by a handler is relative to the current
+	 * time, not relative to the tick of the handler's timer
+	 */
+	if (target > wheel.now)
+		wheel.now = target;
+
+	while (wheel.tick < target) {
+		/* nothing scheduled, so skip all ticks */
+		if (!wheel.count) {
+			wheel.tick = target;
+			break;
+		}
+		wheel.tick++;
+		/* when a level wraps, cascade the next slot of the level above */
+		for (level = 1; level < WHEEL_LEVELS; level++) {
+			if ((wheel.tick & (((uint64_t)1 << (WHEEL_BITS * level)) - 1)))
+				break;
+			wheel_cascade(level);
+		}
+		/* the handler may schedule or delete any timer */
+		slot = &wheel.slot[0][wheel.tick & WHEEL_MASK];
+		while ((timer = *slot)) {
+			wheel_unlink(timer);
+			wheel.count--;
+			timer->cb(timer->data);
+			work = 1;
+		}
+	}
+
+	return work;
+}
+
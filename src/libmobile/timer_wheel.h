@@ -0,0 +1,26 @@
+#ifndef _TIMER_WHEEL_H
+#define _TIMER_WHEEL_H
+
+/* Timer that can be used instead of struct osmo_timer_list. The functions
+ * have the same arguments as osmo_timer_setup(), osmo_timer_schedule(),
+ * osmo_timer_del() and osmo_timer_pending(), so network code can opt in by
+ * replacing type and function names.
+ */
+typedef struct wheel_timer {
+	struct wheel_timer	*next;			/* chain of wheel slot */
+	struct wheel_timer	**pprev;		/* NULL, if not scheduled */
+	uint64_t		expires;		/* tick of expiry */
+	void			(*cb)(void *data);
+	void			*data;
+} wheel_timer_t;
+
+void wheel_timer_setup(wheel_timer_t *timer, void (*cb)(void *data), void *data);
+void wheel_timer_schedule(wheel_timer_t *timer, int seconds, int microseconds);
+void wheel_timer_del(wheel_timer_t *timer);
+int wheel_timer_pending(const wheel_timer_t *timer);
+
+void timer_wheel_init(double now);
+int timer_wheel_work(double now);
+int timer_wheel_count(void);
+
+#endif /* _TIMER_WHEEL_H */
@@ -0,0 +1,143 @@
+/* Transaction index (hashed by callref and subscriber)
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "trans_index.h"
+
+static inline uint32_t hash_callref(int callref)
+{
+	return ((uint32_t)callref * 2654435761u) & (TRANS_INDEX_SIZE - 1);
+}
+
+static inline uint32_t hash_id(uint64_t id)
+{
+	id ^= id >> 33;
+	id *= 0xff51afd7ed558ccdULL;
+	id ^= id >> 33;
+
+	return (uint32_t)id & (TRANS_INDEX_SIZE - 1);
+}
+
+/* append node to the end of a hash chain */
+static void chain_append(trans_index_node_t **chainp, trans_index_node_t *node, int by_callref)
+{
+	if (by_callref) {
+		while (*chainp)
+			chainp = &(*chainp)->callref_next;
+		node->callref_next = NULL;
+		node->callref_pprev = chainp;
+	} else {
+		while (*chainp)
+			chainp = &(*chainp)->id_next;
+		node->id_next = NULL;
+		node->id_pprev = chainp;
+	}
+	*chainp = node;
+}
+
+static void unlink_callref(trans_index_node_t *node)
+{
+	if (!node->callref_pprev)
+		return;
+	*node->callref_pprev = node->callref_next;
+	if (node->callref_next)
+		node->callref_next->callref_pprev = node->callref_pprev;
+	node->callref_next = NULL;
+	node->callref_pprev = NULL;
+}
+
+/* add transaction to index */
+void trans_index_link(trans_index_t *index, trans_index_node_t *node, void *trans, uint64_t id, int callref)
+{
+	node->trans = trans;
+	node->id = id;
+	chain_append(&index->id_hash[hash_id(id)], node, 0);
+	node->callref = 0;
+	node->callref_pprev = NULL;
+	trans_index_callref(index, node, callref);
+}
+
+/* remove transaction from index */
+void trans_index_unlink(trans_index_t __attribute__((unused)) *index, trans_index_node_t *node)
+{
+	unlink_callref(node);
+	if (node->id_pprev) {
+		*node->id_pprev = node->id_next;
+		if (node->id_next)
+			node->id_next->id_pprev = node->id_pprev;
+		node->id_next = NULL;
+		node->id_pprev = NULL;
+	}
+	node->callref = 0;
+}
+
+/* change callref of an indexed transaction, use 0 to remove callref */
+void trans_index_callref(trans_index_t *index, trans_index_node_t *node, int callref)
+{
+	if (node->callref == callref && (!callref || node->callref_pprev))
+		return;
+	unlink_callref(node);
+	node->callref = callref;
+	if (callref)
+		chain_append(&index->callref_hash[hash_callref(callref)], node, 1);
+}
+
+/* return transaction of given callref or NULL */
+void *trans_index_by_callref(trans_index_t *index, int callref)
+{
+	trans_index_node_t *node;
+
+	if (!callref)
+		return NULL;
+	for (node = index->callref_hash[hash_callref(callref)]; node; node = node->callref_next) {
+		if (node->callref == callref)
+			return node->trans;
+	}
+
+	return NULL;
+}
+
+/* iterate nodes of given subscriber identity
+ * The network must compare the subscriber, because different identities
+ * may result in the same 'id' value.
+ */
+trans_index_node_t *trans_index_first_id(trans_index_t *index, uint64_t id)
+{
+	trans_index_node_t *node;
+
+	for (node = index->id_hash[hash_id(id)]; node; node = node->id_next) {
+		if (node->id == id)
+			return node;
+	}
+
+	return NULL;
+}
+
+trans_index_node_t *trans_index_next_id(trans_index_node_t *node)
+{
+	uint64_t id = node->id;
+
+	for (node = node->id_next; node; node = node->id_next) {
+		if (node->id == id)
+			return node;
+	}
+
+	return NULL;
+}
@@ -0,0 +1,34 @@
+#ifndef _TRANS_INDEX_H
+#define _TRANS_INDEX_H
+
+#define TRANS_INDEX_SIZE	1024	/* must be a power of two */
+
+/* index node, embedded in each network's transaction structure */
+typedef struct trans_index_node {
+	struct trans_index_node	*callref_next;		/* chain of callref hash */
+	struct trans_index_node	**callref_pprev;
+	struct trans_index_node	*id_next;		/* chain of subscriber hash */
+	struct trans_index_node	**id_pprev;
+	void			*trans;			/* pointer to transaction that holds this node */
+	int			callref;		/* indexed callref (0 = none) */
+	uint64_t		id;			/* indexed subscriber identity */
+} trans_index_node_t;
+
+/* transactions are found by callref and by subscriber identity
+ *
+ * Nodes are appended to the end of each hash chain, so that the first match
+ * is the transaction that has been linked first, like with a linked list.
+ */
+typedef struct trans_index {
+	trans_index_node_t	*callref_hash[TRANS_INDEX_SIZE];
+	trans_index_node_t	*id_hash[TRANS_INDEX_SIZE];
+} trans_index_t;
+
+void trans_index_link(trans_index_t *index, trans_index_node_t *node, void *trans, uint64_t id, int callref);
+void trans_index_unlink(trans_index_t *index, trans_index_node_t *node);
+void trans_index_callref(trans_index_t *index, trans_index_node_t *node, int callref);
+void *trans_index_by_callref(trans_index_t *index, int callref);
+trans_index_node_t *trans_index_first_id(trans_index_t *index, uint64_t id);
+trans_index_node_t *trans_index_next_id(trans_index_node_t *node);
+
+#endif /* _TRANS_INDEX_H */
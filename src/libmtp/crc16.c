@@ -14,22 +14,57 @@
 
 #define POLY 0x8408
 
-uint16_t calc_crc16(uint8_t *data_p, int length)
+/*
+ * The CRC is calculated with "slicing-by-8": crc_table[0] holds the CRC of
+ * every single byte, crc_table[n] holds the CRC of a byte that is followed
+ * by n zero bytes. This way eight bytes are processed at once with eight
+ * independent table lookups.
+ */
+static uint16_t crc_table[8][256];
+static int crc_table_init = 0;
+
+static void init_crc16(void)
 {
-	int i;
-	uint16_t data;
-	uint16_t crc = 0xffff;
+	int i, j;
+	uint16_t crc;
 
-	while (length--) {
-		data = *data_p++;
-		for (i = 0; i < 8; i++) {
-			if ((crc & 1) ^ (data & 1))
+	for (i = 0; i < 256; i++) {
+		crc = i;
+		for (j = 0; j < 8; j++) {
+			if ((crc & 1))
 				crc = (crc >> 1) ^ POLY;
 			else
 				crc >>= 1;
-			data >>= 1;
 		}
+		crc_table[0][i] = crc;
 	}
+	for (i = 0; i < 256; i++) {
+		for (j = 1; j < 8; j++)
+			crc_table[j][i] = (crc_table[j - 1][i] >> 8) ^ crc_table[0][crc_table[j - 1][i] & 0xff];
+	}
+
+	crc_table_init = 1;
+}
+
+uint16_t calc_crc16(uint8_t *data_p, int length)
+{
+	uint16_t crc = 0xffff;
+
+	if (!crc_table_init)
+		init_crc16();
+
+	while (length >= 8) {
+		crc ^= data_p[0] | (data_p[1] << 8);
+		crc = crc_table[7][crc & 0xff] ^ crc_table[6][crc >> 8]
+		    ^ crc_table[5][data_p[2]] ^ crc_table[4][data_p[3]]
+		    ^ crc_table[3][data_p[4]] ^ crc_table[2][data_p[5]]
+		    ^ crc_table[1][data_p[6]] ^ crc_table[0][data_p[7]];
+		data_p += 8;
+		length -= 8;
+	}
+
+	while (length--)
+		crc = (crc >> 8) ^ crc_table[0][(crc ^ *data_p++) & 0xff];
 
 	crc = ~crc;
 
@@ -1127,6 +1127,20 @@ static int mtp_receive_frame(mtp_t *mtp, uint8_t *data, int len)
 	return 0;
 }
 
+/* after a flag has been sent, get the next frame to transmit, if any */
+static void mtp_next_frame(mtp_t *mtp)
+{
+	/* continuously send flag when power off */
+	if (mtp->l2_state == MTP_L2STATE_POWER_OFF)
+		return;
+	mtp->tx_byte_count = 0;
+	mtp->tx_frame_len = mtp_send_frame(mtp, mtp->tx_frame, sizeof(mtp->tx_frame));
+	/* if no frame, continue with flag (not transmitting) */
+	if (mtp->tx_frame_len)
+		mtp->tx_transmitting = 1;
+	mtp->tx_stream = 0x00;
+}
+
 /*
  * send bit towards layer 1.
  * bit is transmitted from flag (between frames) and from data.
@@ -1136,21 +1150,21 @@ uint8_t mtp_send_bit(mtp_t *mtp)
 {
 	uint8_t bit;
 
+	/* send bits that were already generated by mtp_send_block() */
+	if (mtp->tx_pending_count) {
+		bit = mtp->tx_pending & 1;
+		mtp->tx_pending >>= 1;
+		mtp->tx_pending_count--;
+		return bit;
+	}
+
 	/* send flag, before frame (not transmitting) */
 	if (!mtp->tx_transmitting) {
 		bit = (0x7e >> mtp->tx_bit_count) & 1;
 		/* start frame after flag */
 		if (++mtp->tx_bit_count == 8) {
 			mtp->tx_bit_count = 0;
-			/* continuously send flag when power off */
-			if (mtp->l2_state == MTP_L2STATE_POWER_OFF)
-				return bit;
-			mtp->tx_byte_count = 0;
-			mtp->tx_frame_len = mtp_send_frame(mtp, mtp->tx_frame, sizeof(mtp->tx_frame));
-			/* if no frame, continue with flag (not transmitting) */
-			if (mtp->tx_frame_len)
-				mtp->tx_transmitting = 1;
-			mtp->tx_stream = 0x00;
+			mtp_next_frame(mtp);
 		}
 		return bit;
 	}
@@ -1320,33 +1334,184 @@ void mtp_receive_bit(mtp_t *mtp, uint8_t bit)
 	}
 }
 
-/* layer 1 wants to transmit block of data: the LSB will be sent first */
-void mtp_send_block(mtp_t *mtp, uint8_t *data, int len)
+/*
+ * HDLC tables to process a whole octet at once
+ *
+ * The stuffing table is indexed by the number of consecutive '1' bits that
+ * have been sent (0..5) and by the octet to send. Each entry holds:
+ *  - bits 0..9: stuffed bits, LSB is sent first
+ *  - bits 16..19: number of stuffed bits (8..10)
+ *  - bits 24..31: new tx_stream, that has the same number of trailing '1's
+ *
+ * The de-stuffing table is indexed by the number of consecutive '1' bits that
+ * have been received (0..7, 7 means 7 or more) and by the octet received.
+ * Each entry holds:
+ *  - bits 0..7: data bits after removing stuffed bits, LSB first
+ *  - bits 8..11: number of data bits (0..8)
+ *  - bit 12: flag or abort was found, the octet must be processed bit-wise
+ *  - bits 16..23: new rx_stream
+ */
+#define HDLC_DESTUFF_EVENT	0x1000
+
+static uint32_t hdlc_stuff_table[6][256];
+static uint32_t hdlc_destuff_table[8][256];
+static int hdlc_table_init = 0;
+
+static void init_hdlc_tables(void)
 {
-	int i, j;
-	uint8_t out = 0;
+	int ones, run, i, j, bit, count;
+	uint32_t bits;
+	uint8_t stream;
+
+	for (ones = 0; ones < 6; ones++) {
+		for (i = 0; i < 256; i++) {
+			run = ones;
+			bits = 0;
+			count = 0;
+			for (j = 0; j < 8; j++) {
+				/* if 5 bits are '1', add '0' */
+				if (run == 5) {
+					count++;
+					run = 0;
+				}
+				bit = (i >> j) & 1;
+				bits |= bit << count++;
+				run = (bit) ? run + 1 : 0;
+			}
+			hdlc_stuff_table[ones][i] = bits | (count << 16) | (((1 << run) - 1) << 24);
+		}
+	}
 
-	for (i = 0; i < len; i++) {
-		for (j = 0; j < 8; j++) {
-			out >>= 1;
-			out |= mtp_send_bit(mtp) << 7;
+	for (ones = 0; ones < 8; ones++) {
+		for (i = 0; i < 256; i++) {
+			stream = (ones < 7) ? (1 << ones) - 1 : 0x7f;
+			bits = 0;
+			count = 0;
+			for (j = 0; j < 8; j++) {
+				bit = (i >> j) & 1;
+				stream = (stream << 1) | bit;
+				/* flag or 7 bits of '1' */
+				if (stream == 0x7e || (stream & 0x7f) == 0x7f)
+					bits |= HDLC_DESTUFF_EVENT;
+				/* stuffed bit */
+				else if ((stream & 0x3f) == 0x3e)
+					continue;
+				else
+					bits |= bit << count++;
+			}
+			hdlc_destuff_table[ones][i] = bits | (count << 8) | (stream << 16);
+		}
+	}
+
+	hdlc_table_init = 1;
+}
+
+/*
+ * layer 1 wants to transmit block of data: the LSB will be sent first
+ *
+ * The output is identical to calling mtp_send_bit() for each bit, but frame
+ * octets are stuffed by table lookup. Bits that do not fit into the block are
+ * kept for the next call (or for mtp_send_bit()). The next frame is requested
+ * at the same bit position as mtp_send_bit() would do.
+ */
+void mtp_send_block(mtp_t *mtp, uint8_t *data, int len)
+{
+	uint32_t bits, entry;
+	int count, ones, n, i = 0;
+
+	if (!hdlc_table_init)
+		init_hdlc_tables();
+
+	bits = mtp->tx_pending;
+	count = mtp->tx_pending_count;
+	mtp->tx_pending_count = 0;
+
+	while (i < len) {
+		/* output complete octets */
+		if (count >= 8) {
+			data[i++] = bits;
+			bits >>= 8;
+			count -= 8;
+			continue;
+		}
+		/* send (rest of) flag, before frame (not transmitting) */
+		if (!mtp->tx_transmitting) {
+			bits |= ((0x7e >> mtp->tx_bit_count) & 0xff) << count;
+			n = 8 - mtp->tx_bit_count;
+			/* do not get the next frame before the flag is really sent */
+			if (count + n > (len - i) * 8) {
+				n = (len - i) * 8 - count;
+				bits &= (1 << (count + n)) - 1;
+				count += n;
+				mtp->tx_bit_count += n;
+				continue;
+			}
+			count += n;
+			mtp->tx_bit_count = 0;
+			mtp_next_frame(mtp);
+			continue;
+		}
+		/* complete an octet that mtp_send_bit() has started */
+		if (mtp->tx_bit_count) {
+			bits |= mtp_send_bit(mtp) << count++;
+			continue;
 		}
-		data[i] = out;
+		/* stuff octet, the table tracks consecutive '1's */
+		ones = __builtin_ctz(~mtp->tx_stream | 0x20);
+		entry = hdlc_stuff_table[ones][mtp->tx_frame[mtp->tx_byte_count]];
+		bits |= (entry & 0x3ff) << count;
+		count += (entry >> 16) & 0xf;
+		mtp->tx_stream = entry >> 24;
+		if (++mtp->tx_byte_count == mtp->tx_frame_len)
+			mtp->tx_transmitting = 0;
 	}
+
+	mtp->tx_pending = bits;
+	mtp->tx_pending_count = count;
 }
 
-/* layer 1 received block of data: the LSB was received first */
+/*
+ * layer 1 received block of data: the LSB was received first
+ *
+ * Octets without flag or abort are de-stuffed by table lookup. Octets with a
+ * flag or an abort, and all octets during octet counting, are given to
+ * mtp_receive_bit(), so the result is identical to the bit-wise reception.
+ */
 void mtp_receive_block(mtp_t *mtp, uint8_t *data, int len)
 {
-	int i, j;
+	uint32_t bits, entry;
+	int i, j, count;
 	uint8_t in;
 
+	if (!hdlc_table_init)
+		init_hdlc_tables();
+
 	for (i = 0; i < len; i++) {
 		in = data[i];
+		/* a frame that has reached its maximum length must be aborted bit-wise */
+		if (!mtp->rx_octet_counting && mtp->rx_byte_count < (int)sizeof(mtp->rx_frame)) {
+			entry = hdlc_destuff_table[__builtin_ctz(~mtp->rx_stream | 0x80)][in];
+			if (!(entry & HDLC_DESTUFF_EVENT)) {
+				mtp->rx_stream = entry >> 16;
+				/* if not receiving a frame (i.e. no flag received), drop it */
+				if (!mtp->rx_receiving)
+					continue;
+				count = (entry >> 8) & 0xf;
+				/* append bits to the bits of the current octet */
+				bits = (mtp->rx_byte >> (8 - mtp->rx_bit_count)) | ((entry & 0xff) << mtp->rx_bit_count);
+				mtp->rx_bit_count += count;
+				if (mtp->rx_bit_count >= 8) {
+					mtp->rx_frame[mtp->rx_byte_count++] = bits;
+					bits >>= 8;
+					mtp->rx_bit_count -= 8;
+				}
+				mtp->rx_byte = bits << (8 - mtp->rx_bit_count);
+				continue;
+			}
+		}
 		for (j = 0; j < 8; j++) {
 			mtp_receive_bit(mtp, in & 1);
 			in >>= 1;
 		}
 	}
 }
-
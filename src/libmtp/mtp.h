@@ -85,6 +85,8 @@ typedef struct mtp {
 	int		tx_transmitting;/* transmit frame, if 0: transmit flag */
 	uint8_t		tx_byte;	/* current byte transmitting */
 	uint8_t		tx_stream;	/* output stream to track bit stuffing */
+	uint32_t	tx_pending;	/* bits generated by block function, but not yet sent */
+	int		tx_pending_count; /* number of pending bits */
 
 	/* frame reception */
 	uint8_t		rx_frame[272];	/* frame memory */
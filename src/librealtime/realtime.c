@@ -0,0 +1,218 @@
+/* Real time hardening: CPU affinity, memory locking, page fault statistics
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* A page fault in the DSP loop or in an SDR thread stalls processing for
+ * microseconds (minor fault) up to milliseconds (major fault). The DSP
+ * libraries allocate their buffers when a sender is created and whenever a
+ * filter or jitter buffer is initialized, so the first touch of each page
+ * happens while streaming.
+ *
+ * With memory locking, all pages that are mapped now and in the future are
+ * locked and faulted in when they are mapped. Additionally, a reserve is
+ * allocated from the heap and touched, before it is freed again. Trimming
+ * the heap and using mmap() for large allocations is disabled, so the
+ * reserve stays in the process. All later allocations of the DSP libraries
+ * are taken from this reserve without any page fault.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <malloc.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include "../liblogging/logging.h"
+#include "realtime.h"
+
+#define STACK_PREFAULT	(256 * 1024)	/* stack that is touched in advance */
+#define REPORT_INTERVAL	60.0		/* report statistics every minute */
+
+/* report at info level, if real time options are used */
+static int report_info = 0;
+
+/* parse CPU list like "0-2,5" */
+static int parse_cpus(const char *cpus, cpu_set_t *set)
+{
+	const char *p = cpus;
+	char *end;
+	long first, last;
+
+	CPU_ZERO(set);
+	while (*p) {
+		first = strtol(p, &end, 10);
+		if (end == p || first < 0 || first >= CPU_SETSIZE)
+			return -EINVAL;
+		last = first;
+		p = end;
+		if (*p == '-') {
+			p++;
+			last = strtol(p, &end, 10);
+			if (end == p || last < first || last >= CPU_SETSIZE)
+				return -EINVAL;
+			p = end;
+		}
+		while (first <= last)
+			CPU_SET(first++, set);
+		if (*p == ',')
+			p++;
+		else if (*p)
+			return -EINVAL;
+	}
+	if (!CPU_COUNT(set))
+		return -EINVAL;
+
+	return 0;
+}
+
+int rt_check_cpus(const char *cpus)
+{
+	cpu_set_t set;
+
+	return parse_cpus(cpus, &set);
+}
+
+/* bind calling thread to given CPUs */
+int rt_pin_thread(const char *cpus, const char *name)
+{
+	cpu_set_t set;
+	int rc;
+
+	rc = parse_cpus(cpus, &set);
+	if (rc < 0) {
+		LOGP(DDSP, LOGL_ERROR, "Invalid CPU list '%s' for %s!\n", cpus, name);
+		return rc;
+	}
+	rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+	if (rc) {
+		LOGP(DDSP, LOGL_ERROR, "Failed to bind %s to CPUs '%s' (%s)!\n", name, cpus, strerror(rc));
+		return -rc;
+	}
+	LOGP(DDSP, LOGL_INFO, "Bound %s to CPUs '%s'.\n", name, cpus);
+	report_info = 1;
+
+	return 0;
+}
+
+/* lock all current and future pages and keep a reserve of given size on the heap */
+int rt_lock_memory(int reserve_mb)
+{
+	size_t size = (size_t)reserve_mb * 1024 * 1024;
+	long page = sysconf(_SC_PAGESIZE);
+	volatile uint8_t *reserve;
+	size_t i;
+
+	if (mlockall(MCL_CURRENT | MCL_FUTURE) < 0) {
+		LOGP(DDSP, LOGL_ERROR, "Failed to lock memory (%s), check 'ulimit -l' or run as root!\n", strerror(errno));
+		return -errno;
+	}
+
+	if (size) {
+		/* never give memory back and never use mmap() for large blocks */
+		mallopt(M_TRIM_THRESHOLD, -1);
+		mallopt(M_MMAP_MAX, 0);
+		reserve = malloc(size);
+		if (!reserve) {
+			LOGP(DDSP, LOGL_ERROR, "Failed to reserve %d MB of memory!\n", reserve_mb);
+			munlockall();
+			return -ENOMEM;
+		}
+		for (i = 0; i < size; i += page)
+			reserve[i] = 0;
+		free((void *)reserve);
+	}
+
+	rt_prefault_stack();
+	report_info = 1;
+
+	LOGP(DDSP, LOGL_INFO, "Memory locked, %d MB reserved for DSP buffers.\n", reserve_mb);
+
+	return 0;
+}
+
+void rt_unlock_memory(void)
+{
+	munlockall();
+}
+
+/* write to each page of a buffer, so it is mapped before it is used */
+void rt_prefault(volatile void *buffer, size_t size)
+{
+	volatile uint8_t *p = buffer;
+	long page = sysconf(_SC_PAGESIZE);
+	size_t i;
+
+	if (!buffer || !size)
+		return;
+	for (i = 0; i < size; i += page)
+		p[i] = p[i];
+	p[size - 1] = p[size - 1];
+}
+
+/* touch stack of calling thread, so deeper calls do not fault */
+void rt_prefault_stack(void)
+{
+	uint8_t stack[STACK_PREFAULT];
+
+	rt_prefault(stack, sizeof(stack));
+}
+
+/* faults and involuntary context switches of all threads of this process */
+void rt_usage(long *minflt, long *majflt, long *nivcsw)
+{
+	struct rusage usage;
+
+	getrusage(RUSAGE_SELF, &usage);
+	*minflt = usage.ru_minflt;
+	*majflt = usage.ru_majflt;
+	*nivcsw = usage.ru_nivcsw;
+}
+
+/* call from main loop, report statistics every minute */
+void rt_report(double now)
+{
+	static double last_time = 0.0;
+	static long last_minflt, last_majflt, last_nivcsw;
+	long minflt, majflt, nivcsw;
+	double minutes;
+
+	if (last_time == 0.0) {
+		last_time = now;
+		rt_usage(&last_minflt, &last_majflt, &last_nivcsw);
+		return;
+	}
+	if (now - last_time < REPORT_INTERVAL)
+		return;
+
+	rt_usage(&minflt, &majflt, &nivcsw);
+	minutes = (now - last_time) / 60.0;
+	LOGP(DDSP, (report_info || majflt != last_majflt) ? LOGL_INFO : LOGL_DEBUG, "Per minute: %.0f minor page faults, %.0f major page faults, %.0f involuntary context switches\n", (double)(minflt - last_minflt) / minutes, (double)(majflt - last_majflt) / minutes, (double)(nivcsw - last_nivcsw) / minutes);
+	last_time = now;
+	last_minflt = minflt;
+	last_majflt = majflt;
+	last_nivcsw = nivcsw;
+}
+
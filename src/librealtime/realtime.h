@@ -0,0 +1,10 @@
+
+int rt_check_cpus(const char *cpus);
+int rt_pin_thread(const char *cpus, const char *name);
+int rt_lock_memory(int reserve_mb);
+void rt_unlock_memory(void);
+void rt_prefault(volatile void *buffer, size_t size);
+void rt_prefault_stack(void);
+void rt_usage(long *minflt, long *majflt, long *nivcsw);
+void rt_report(double now);
+
@@ -36,7 +36,7 @@
 #define TEST_1000HZ_DB	55.0
 
 /* sine wave for carrier to modulate to */
-static double carrier[65536];
+double scrambler_carrier[65536];
 
 void scrambler_init(void)
 {
@@ -44,7 +44,7 @@ void scrambler_init(void)
 
 	for (i = 0; i < 65536; i++) {
 		/* our amplitude must be doubled, since we have one spectrum above and one below carrier */
-		carrier[i] = sin((double)i / 65536.0 * 2 * PI) * 2.0;
+		scrambler_carrier[i] = sin((double)i / 65536.0 * 2 * PI) * 2.0;
 	}
 }
 
@@ -68,7 +68,7 @@ void scrambler(scrambler_t *scrambler, sample_t *samples, int length)
 
 	for (i = 0; i < length; i++) {
 		/* modulate samples to carrier */
-		samples[i] *= carrier[(uint16_t)phase];
+		samples[i] *= scrambler_carrier[(uint16_t)phase];
 		phase += phaseshift;
 		if (phase >= 65536.0)
 			phase -= 65536.0;
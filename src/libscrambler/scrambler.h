@@ -6,6 +6,9 @@ typedef struct scrambler {
 	iir_filter_t	lp;			/* filter to remove carrier frequency */
 } scrambler_t;
 
+/* carrier table, so the scrambler can be used within other sample loops */
+extern double scrambler_carrier[65536];
+
 void scrambler_init(void);
 void scrambler_setup(scrambler_t *scrambler, int samplerate);
 void scrambler(scrambler_t *scrambler, sample_t *samples, int length);
@@ -33,8 +33,10 @@ enum paging_signal;
 #include "../libam/am.h"
 #include <osmocom/core/timer.h>
 #include "../libmobile/sender.h"
+#include "../librealtime/realtime.h"
 #include "sdr_config.h"
 #include "sdr.h"
+#include "tx_sched.h"
 #ifdef HAVE_UHD
 #include "uhd.h"
 #endif
@@ -105,6 +107,10 @@ typedef struct sdr {
 	sample_t	*modbuff_carrier;
 	sample_t	*wavespl0;	/* sample buffer for wave generation */
 	sample_t	*wavespl1;
+	int		use_tx_sched;	/* use TX scheduler instead of fixed lead time */
+	sdr_tx_sched_t	tx_sched;
+	double		tx_sched_timer;	/* when counters were reported */
+	unsigned int	tx_sched_reported; /* underruns and late bursts when reported */
 } sdr_t;
 
 static void show_spectrum(const char *direction, double halfbandwidth, double center, double *frequency, double paging_frequency, int num)
@@ -177,6 +183,12 @@ void *sdr_open(int __attribute__((__unused__)) direction, const char __attribute
 	sdr->samplerate = samplerate;
 	sdr->buffer_size = buffer_size;
 	sdr->interval = interval;
+	if (sdr_config->tx_bursts) {
+		/* a burst is what the write thread sends in one interval */
+		sdr->use_tx_sched = 1;
+		sdr_tx_sched_init(&sdr->tx_sched, sdr_config->samplerate, sdr_config->samplerate * interval / 1000.0, sdr_config->tx_bursts, buffer_size * oversample);
+		LOGP(DSDR, LOGL_INFO, "Using TX scheduler with %d bursts of %d samples, lead time is %.1f ms at most.\n", sdr->tx_sched.min_bursts, sdr->tx_sched.burst, (double)(sdr->tx_sched.max_bursts * sdr->tx_sched.burst) / sdr_config->samplerate * 1000.0);
+	}
 	sdr->threads = threads; /* always required, because write may block */
 	sdr->oversample = oversample;
 
@@ -534,7 +546,7 @@ void *sdr_open(int __attribute__((__unused__)) direction, const char __attribute
 
 #ifdef HAVE_SOAPY
 	if (sdr_config->soapy) {
-		rc = soapy_open(sdr_config->channel, sdr_config->device_args, sdr_config->stream_args, sdr_config->tune_args, sdr_config->tx_antenna, sdr_config->rx_antenna, sdr_config->clock_source, tx_center_frequency, rx_center_frequency, sdr_config->lo_offset, sdr_config->samplerate, sdr_config->tx_gain, sdr_config->rx_gain, sdr_config->bandwidth, sdr_config->timestamps);
+		rc = soapy_open(sdr_config->channel, sdr_config->device_args, sdr_config->stream_args, sdr_config->tune_args, sdr_config->tx_antenna, sdr_config->rx_antenna, sdr_config->clock_source, tx_center_frequency, rx_center_frequency, sdr_config->lo_offset, sdr_config->samplerate, sdr_config->tx_gain, sdr_config->rx_gain, sdr_config->bandwidth, sdr_config->timestamps, sdr_config->direct);
 		if (rc)
 			goto error;
 	}
@@ -587,6 +599,10 @@ static void *sdr_write_child(void *arg)
 	int fill, out;
 	int s, ss, o;
 
+	if (sdr_config->tx_cpus)
+		rt_pin_thread(sdr_config->tx_cpus, "SDR TX thread");
+	rt_prefault_stack();
+
 	while (sdr->thread_write.running) {
 		/* write to SDR */
 		fill = (sdr->thread_write.in - sdr->thread_write.out + sdr->thread_write.buffer_size) % sdr->thread_write.buffer_size;
@@ -637,10 +653,37 @@ static void *sdr_read_child(void *arg)
 	int space, in;
 	int s, ss;
 
+	if (sdr_config->rx_cpus)
+		rt_pin_thread(sdr_config->rx_cpus, "SDR RX thread");
+	rt_prefault_stack();
+
 	while (sdr->thread_read.running) {
 		/* read from SDR */
 		space = (sdr->thread_read.out - sdr->thread_read.in - 2 + sdr->thread_read.buffer_size) % sdr->thread_read.buffer_size;
 		num = space / 2;
+#ifdef HAVE_SOAPY
+		/* The driver's buffers are converted directly into the read
+		 * buffer, if there is no filter that requires the intermediate
+		 * buffer.
+		 */
+		if (num && sdr_config->soapy && soapy_receive_direct_access() && sdr->oversample == 1) {
+			in = sdr->thread_read.in;
+			while (num) {
+				s = num;
+				if (s > (sdr->thread_read.buffer_size - in) / 2)
+					s = (sdr->thread_read.buffer_size - in) / 2;
+				count = soapy_receive((float *)sdr->thread_read.buffer + in, s);
+				if (bias_count >= 0)
+					sdr_bias((float *)sdr->thread_read.buffer + in, count);
+				in = (in + count * 2) % sdr->thread_read.buffer_size;
+				num -= count;
+				if (count < s)
+					break;
+			}
+			sdr->thread_read.in = in;
+			num = 0;
+		}
+#endif
 		if (num) {
 #ifdef HAVE_UHD
 			if (sdr_config->uhd)
@@ -682,6 +725,23 @@ static void *sdr_read_child(void *arg)
 	return NULL;
 }
 
+/* map all buffers before streaming, so the first access does not fault */
+static void prefault_buffers(sdr_t *sdr)
+{
+	if (sdr->threads) {
+		rt_prefault(sdr->thread_read.buffer, sdr->thread_read.buffer_size * sizeof(*sdr->thread_read.buffer));
+		rt_prefault(sdr->thread_read.buffer2, sdr->thread_read.buffer_size * sizeof(*sdr->thread_read.buffer2));
+		rt_prefault(sdr->thread_write.buffer, sdr->thread_write.buffer_size * sizeof(*sdr->thread_write.buffer));
+		rt_prefault(sdr->thread_write.buffer2, sdr->thread_write.buffer_size * sdr->oversample * sizeof(*sdr->thread_write.buffer2));
+	}
+	rt_prefault(sdr->modbuff, sdr->buffer_size * 2 * sizeof(*sdr->modbuff));
+	rt_prefault(sdr->modbuff_I, sdr->buffer_size * sizeof(*sdr->modbuff_I));
+	rt_prefault(sdr->modbuff_Q, sdr->buffer_size * sizeof(*sdr->modbuff_Q));
+	rt_prefault(sdr->modbuff_carrier, sdr->buffer_size * sizeof(*sdr->modbuff_carrier));
+	rt_prefault(sdr->wavespl0, sdr->buffer_size * sizeof(*sdr->wavespl0));
+	rt_prefault(sdr->wavespl1, sdr->buffer_size * sizeof(*sdr->wavespl1));
+}
+
 /* start streaming */
 int sdr_start(void *inst)
 {
@@ -699,6 +759,8 @@ int sdr_start(void *inst)
 	if (rc < 0)
 		return rc;
 
+	prefault_buffers(sdr);
+
 	if (sdr->threads) {
 		int rc;
 		pthread_t tid;
@@ -1048,12 +1110,70 @@ int sdr_read(void *inst, sample_t **samples, int num, int channels, double *rf_l
 	return count;
 }
 
+/* how much do we need to send (in audio sample duration) to get the lead time of the scheduler */
+static int sdr_get_tosend_sched(sdr_t *sdr)
+{
+	sdr_tx_sched_t *sched = &sdr->tx_sched;
+	int advance = 0, skip = 0, count, rc = 0;
+
+#ifdef HAVE_UHD
+	if (sdr_config->uhd)
+		rc = uhd_get_advance(sdr_tx_sched_lead(sched), &advance);
+#endif
+#ifdef HAVE_SOAPY
+	if (sdr_config->soapy)
+		rc = soapy_get_advance(sdr_tx_sched_lead(sched), &advance);
+#endif
+	/* no RX time stamp yet */
+	if (rc <= 0)
+		return rc;
+
+	if (sdr->threads) {
+		/* what we have in write buffer is not jet sent to the SDR, but it is queued */
+		int fill;
+
+		fill = (sdr->thread_write.in - sdr->thread_write.out + sdr->thread_write.buffer_size) % sdr->thread_write.buffer_size;
+		advance += fill / 2 * sdr->oversample;
+	}
+
+	count = sdr_tx_sched_tosend(sched, advance, &skip);
+	if (skip) {
+		/* samples between TX time stamp and RX time stamp are lost, don't send them late */
+#ifdef HAVE_UHD
+		if (sdr_config->uhd)
+			uhd_skip_tx(skip);
+#endif
+#ifdef HAVE_SOAPY
+		if (sdr_config->soapy)
+			soapy_skip_tx(skip);
+#endif
+		LOGP(DSDR, LOGL_ERROR, "SDR TX underrun of %.1f ms, seems we are too slow. Raising lead time to %.1f ms.\n", (double)skip / sdr_config->samplerate * 1000.0, (double)sdr_tx_sched_lead(sched) / sdr_config->samplerate * 1000.0);
+	}
+
+	/* report counters once a second, if they have changed */
+	if (sdr->tx_sched_timer == 0.0)
+		sdr->tx_sched_timer = get_time();
+	if (get_time() - sdr->tx_sched_timer > 1.0) {
+		sdr->tx_sched_timer += 1.0;
+		if (sched->underruns + sched->late != sdr->tx_sched_reported) {
+			sdr->tx_sched_reported = sched->underruns + sched->late;
+			LOGP(DSDR, LOGL_INFO, "TX scheduler: lead time %.1f ms (average %.1f ms), %u underruns, %u late bursts\n", (double)sdr_tx_sched_lead(sched) / sdr_config->samplerate * 1000.0, (double)sched->lead_sum / sched->lead_count / sdr_config->samplerate * 1000.0, sched->underruns, sched->late);
+		}
+	}
+
+	/* rounding down, so we never overfill */
+	return count / sdr->oversample;
+}
+
 /* how much do we need to send (in audio sample duration) to get the target delay (buffer size) */
 int sdr_get_tosend(void *inst, int buffer_size)
 {
 	sdr_t *sdr = (sdr_t *)inst;
 	int count = 0;
 
+	if (sdr->use_tx_sched)
+		return sdr_get_tosend_sched(sdr);
+
 #ifdef HAVE_UHD
 	if (sdr_config->uhd)
 		count = uhd_get_tosend(buffer_size * sdr->oversample);
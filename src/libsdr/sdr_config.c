@@ -26,6 +26,7 @@ enum paging_signal;
 #include <errno.h>
 #include "../libsample/sample.h"
 #include "../liboptions/options.h"
+#include "../librealtime/realtime.h"
 #include "sdr.h"
 #include "sdr_config.h"
 
@@ -42,6 +43,7 @@ void sdr_config_init(double lo_offset)
 	sdr_config->tune_args = "";
 	sdr_config->lo_offset = lo_offset;
 	sdr_config->timestamps = 1;
+	sdr_config->direct = 1;
 
 	got_init = 1;
 }
@@ -95,6 +97,21 @@ void sdr_config_print_help(void)
 	printf("        Swap RX and TX frequencies for loopback tests over the air.\n");
 	printf("    --sdr-timestamps 1 | 0\n");
 	printf("        Use TX timestamps on UHD device. (default = %d)\n", sdr_config->timestamps);
+	printf("    --sdr-direct 1 | 0\n");
+	printf("        Use direct access to buffers of SoapySDR driver, if supported by the\n");
+	printf("        driver. Samples are converted from/to the driver's native format,\n");
+	printf("        without copying them. (default = %d)\n", sdr_config->direct);
+	printf("    --sdr-tx-bursts <number> | 0\n");
+	printf("        Use TX scheduler that keeps the given number of bursts queued at the\n");
+	printf("        SDR. A burst is what is sent to the SDR in one interval. If less than\n");
+	printf("        a third of the lead time was left when the main loop woke up, the\n");
+	printf("        lead time is raised, up to the buffer size. It is lowered again when\n");
+	printf("        this did not happen for a while. Use 0 to keep the lead time at\n");
+	printf("        buffer size. (default = %d)\n", sdr_config->tx_bursts);
+	printf("    --sdr-rx-cpu-affinity <cpu>[-<cpu>][,...]\n");
+	printf("    --sdr-tx-cpu-affinity <cpu>[-<cpu>][,...]\n");
+	printf("        Bind RX or TX thread to given CPUs, e.g. '3' or '2-3'. By default the\n");
+	printf("        threads run on the CPUs of the main loop.\n");
 }
 
 void sdr_config_print_hotkeys(void)
@@ -124,6 +141,10 @@ void sdr_config_print_hotkeys(void)
 #define	OPT_READ_IQ_TX_WAVE	1517
 #define	OPT_SDR_SWAP_LINKS	1518
 #define	OPT_SDR_TIMESTAMPS	1519
+#define	OPT_SDR_DIRECT		1520
+#define	OPT_SDR_TX_BURSTS	1521
+#define	OPT_SDR_RX_CPUS		1522
+#define	OPT_SDR_TX_CPUS		1523
 
 void sdr_config_add_options(void)
 {
@@ -147,6 +168,10 @@ void sdr_config_add_options(void)
 	option_add(OPT_READ_IQ_TX_WAVE, "read-iq-tx-wave", 1);
 	option_add(OPT_SDR_SWAP_LINKS, "sdr-swap-links", 0);
 	option_add(OPT_SDR_TIMESTAMPS, "sdr-timestamps", 1);
+	option_add(OPT_SDR_DIRECT, "sdr-direct", 1);
+	option_add(OPT_SDR_TX_BURSTS, "sdr-tx-bursts", 1);
+	option_add(OPT_SDR_RX_CPUS, "sdr-rx-cpu-affinity", 1);
+	option_add(OPT_SDR_TX_CPUS, "sdr-tx-cpu-affinity", 1);
 }
 
 int sdr_config_handle_options(int short_option, int argi, char **argv)
@@ -224,6 +249,25 @@ int sdr_config_handle_options(int short_option, int argi, char **argv)
 	case OPT_SDR_TIMESTAMPS:
 		sdr_config->timestamps = atoi(argv[argi]);
 		break;
+	case OPT_SDR_DIRECT:
+		sdr_config->direct = atoi(argv[argi]);
+		break;
+	case OPT_SDR_TX_BURSTS:
+		sdr_config->tx_bursts = atoi(argv[argi]);
+		if (sdr_config->tx_bursts < 0)
+			sdr_config->tx_bursts = 0;
+		break;
+	case OPT_SDR_RX_CPUS:
+	case OPT_SDR_TX_CPUS:
+		if (rt_check_cpus(argv[argi]) < 0) {
+			fprintf(stderr, "Invalid CPU list '%s', use e.g. '3' or '2-3' or '1,3'.\n", argv[argi]);
+			return -EINVAL;
+		}
+		if (short_option == OPT_SDR_RX_CPUS)
+			sdr_config->rx_cpus = options_strdup(argv[argi]);
+		else
+			sdr_config->tx_cpus = options_strdup(argv[argi]);
+		break;
 	default:
 		return -EINVAL;
 	}
@@ -20,6 +20,10 @@ typedef struct sdr_config {
 	const char	*read_iq_rx_wave;
 	int		swap_links;		/* swap DL and UL frequency */
 	int		timestamps;		/* use time stamps when transmitting */
+	int		direct;			/* use driver's buffers, if supported */
+	int		tx_bursts;		/* bursts to keep queued at the radio, 0 for fixed lead time */
+	const char	*rx_cpus,		/* CPU affinity of RX and TX thread */
+			*tx_cpus;
 } sdr_config_t;
 
 extern sdr_config_t *sdr_config;
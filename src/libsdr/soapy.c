@@ -62,6 +62,12 @@ static long long		rx_timeNs = 0;
 static int			tx_valid = 0;
 static long long		tx_timeNs = 0;
 static long long		Ns_per_sample;
+static int			rx_direct, tx_direct;	/* use buffers of driver */
+static int			rx_cs16, tx_cs16;	/* driver's format is CS16, otherwise CF32 */
+static float			rx_full_scale, tx_full_scale; /* full scale of CS16 samples */
+static size_t			rx_handle;		/* RX buffer that is currently acquired */
+static const void		*rx_buff;		/* pointer to it, NULL if none */
+static int			rx_buff_count, rx_buff_pos; /* samples in it and samples consumed */
 
 static int parse_args(SoapySDRKwargs *args, const char *_args_string)
 {
@@ -87,7 +93,67 @@ static int parse_args(SoapySDRKwargs *args, const char *_args_string)
 	return 0;
 }
 
-int soapy_open(size_t channel, const char *_device_args, const char *_stream_args, const char *_tune_args, const char *tx_antenna, const char *rx_antenna, const char *clock_source, double tx_frequency, double rx_frequency, double lo_offset, double rate, double tx_gain, double rx_gain, double bandwidth, int timestamps)
+/* Set up a stream. If direct access is requested and the driver's native
+ * format is CS16 or CF32, the stream uses the native format, so that the
+ * buffers of the driver can be converted without intermediate copy.
+ * Otherwise let the driver convert into CF32 and copy.
+ */
+static SoapySDRStream *setup_stream(int direction, size_t channel, SoapySDRKwargs *stream_args, int direct, int *use_direct, int *cs16, float *full_scale)
+{
+	SoapySDRStream *stream = NULL;
+	const char *format = SOAPY_SDR_CF32;
+	char *native;
+	double scale = 0.0;
+	int num_buffs;
+
+	*use_direct = 0;
+	*cs16 = 0;
+
+	if (direct) {
+		native = SoapySDRDevice_getNativeStreamFormat(sdr, direction, channel, &scale);
+		if (native && !strcmp(native, SOAPY_SDR_CS16) && scale > 0.0) {
+			format = SOAPY_SDR_CS16;
+			*cs16 = 1;
+			*full_scale = scale;
+		} else if (!native || strcmp(native, SOAPY_SDR_CF32)) {
+			LOGP(DSOAPY, LOGL_INFO, "Native %s format '%s' of driver cannot be accessed directly, copying samples.\n", (direction == SOAPY_SDR_RX) ? "RX" : "TX", (native) ? native : "");
+			direct = 0;
+		}
+#ifdef SOAPY_0_8_0_OR_HIGHER
+		SoapySDR_free(native);
+#else
+		free(native);
+#endif
+	}
+
+#ifdef SOAPY_0_8_0_OR_HIGHER
+	if (!(stream = SoapySDRDevice_setupStream(sdr, direction, format, &channel, 1, stream_args)))
+#else
+	if (SoapySDRDevice_setupStream(sdr, &stream, direction, format, &channel, 1, stream_args) != 0)
+#endif
+		return NULL;
+
+	if (!direct)
+		return stream;
+
+	num_buffs = SoapySDRDevice_getNumDirectAccessBuffers(sdr, stream);
+	if (num_buffs > 0) {
+		LOGP(DSOAPY, LOGL_INFO, "Using direct access to %d %s buffers of driver in %s format.\n", num_buffs, (direction == SOAPY_SDR_RX) ? "RX" : "TX", format);
+		*use_direct = 1;
+		return stream;
+	}
+
+	/* no direct access, so the driver must convert to CF32 */
+	LOGP(DSOAPY, LOGL_INFO, "Driver does not support direct access to %s buffers, copying samples.\n", (direction == SOAPY_SDR_RX) ? "RX" : "TX");
+	if (*cs16) {
+		SoapySDRDevice_closeStream(sdr, stream);
+		return setup_stream(direction, channel, stream_args, 0, use_direct, cs16, full_scale);
+	}
+
+	return stream;
+}
+
+int soapy_open(size_t channel, const char *_device_args, const char *_stream_args, const char *_tune_args, const char *tx_antenna, const char *rx_antenna, const char *clock_source, double tx_frequency, double rx_frequency, double lo_offset, double rate, double tx_gain, double rx_gain, double bandwidth, int timestamps, int direct)
 {
 	double got_frequency, got_rate, got_gain, got_bandwidth;
 	const char *got_antenna, *got_clock;
@@ -104,6 +170,7 @@ int soapy_open(size_t channel, const char *_device_args, const char *_stream_arg
 	}
 	Ns_per_sample = 1000000000LL / (long long)rate;
 	samplerate = rate;
+	rx_valid = tx_valid = 0;
 
 	/* parsing ARGS */
 	LOGP(DSOAPY, LOGL_INFO, "Using device args \"%s\"\n", _device_args);
@@ -279,12 +346,7 @@ int soapy_open(size_t channel, const char *_device_args, const char *_stream_arg
 		}
 
 		/* set up streamer */
-#ifdef SOAPY_0_8_0_OR_HIGHER
-		if (!(rxStream = SoapySDRDevice_setupStream(sdr, SOAPY_SDR_RX, SOAPY_SDR_CF32, &channel, 1, &stream_args)))
-#else
-		if (SoapySDRDevice_setupStream(sdr, &rxStream, SOAPY_SDR_RX, SOAPY_SDR_CF32, &channel, 1, &stream_args) != 0)
-#endif
-		{
+		if (!(rxStream = setup_stream(SOAPY_SDR_RX, channel, &stream_args, direct, &rx_direct, &rx_cs16, &rx_full_scale))) {
 			LOGP(DSOAPY, LOGL_ERROR, "Failed to set RX streamer args\n");
 			soapy_close();
 			return -EIO;
@@ -404,12 +466,7 @@ int soapy_open(size_t channel, const char *_device_args, const char *_stream_arg
 		}
 
 		/* set up streamer */
-#ifdef SOAPY_0_8_0_OR_HIGHER
-		if (!(txStream = SoapySDRDevice_setupStream(sdr, SOAPY_SDR_TX, SOAPY_SDR_CF32, &channel, 1, &stream_args)))
-#else
-		if (SoapySDRDevice_setupStream(sdr, &txStream, SOAPY_SDR_TX, SOAPY_SDR_CF32, &channel, 1, &stream_args) != 0)
-#endif
-		{
+		if (!(txStream = setup_stream(SOAPY_SDR_TX, channel, &stream_args, direct, &tx_direct, &tx_cs16, &tx_full_scale))) {
 			LOGP(DSOAPY, LOGL_ERROR, "Failed to set TX streamer args\n");
 			soapy_close();
 			return -EIO;
@@ -460,6 +517,10 @@ void soapy_close(void)
 		txStream = NULL;
 	}
 	if (rxStream) {
+		if (rx_buff) {
+			SoapySDRDevice_releaseReadBuffer(sdr, rxStream, rx_handle);
+			rx_buff = NULL;
+		}
 		SoapySDRDevice_deactivateStream(sdr, rxStream, 0, 0);
 		SoapySDRDevice_closeStream(sdr, rxStream);
 		rxStream = NULL;
@@ -471,6 +532,92 @@ void soapy_close(void)
 	}
 }
 
+/* process TX time stamp after samples have been written */
+static void tx_time_stamp(int count)
+{
+	if (!tx_valid)
+		LOGP(DSOAPY, LOGL_ERROR, "SDR TX: tosend() was not called before, prease fix!\n");
+	else {
+		pthread_mutex_lock(&timestamp_mutex);
+		tx_timeNs += count * Ns_per_sample;
+		pthread_mutex_unlock(&timestamp_mutex);
+	}
+}
+
+/* process RX time stamp of received chunk, before samples are consumed */
+static void rx_time_stamp(int flags, long long timeNs)
+{
+	if (!use_time_stamps || !(flags & SOAPY_SDR_HAS_TIME)) {
+		if (use_time_stamps) {
+			LOGP(DSOAPY, LOGL_ERROR, "SDR RX: No time stamps available. This may cause little gaps and problems with time slot based networks, like C-Netz.\n");
+			use_time_stamps = 0;
+		}
+		timeNs = rx_timeNs;
+	}
+	if (!rx_valid) {
+		rx_timeNs = timeNs;
+		rx_valid = 1;
+	}
+	pthread_mutex_lock(&timestamp_mutex);
+	if (rx_timeNs != timeNs)
+		LOGP(DSOAPY, LOGL_ERROR, "SDR RX overflow, seems we are too slow. Use lower SDR sample rate, if this happens too often.\n");
+	rx_timeNs = timeNs;
+	pthread_mutex_unlock(&timestamp_mutex);
+}
+
+/* advance RX time stamp by samples that are consumed */
+static void rx_time_consumed(int count)
+{
+	pthread_mutex_lock(&timestamp_mutex);
+	rx_timeNs += count * Ns_per_sample;
+	pthread_mutex_unlock(&timestamp_mutex);
+}
+
+/* convert samples into the driver's buffer and hand it back to the driver */
+static int soapy_send_direct(float *buff, int num)
+{
+	void *buffs_ptr[1];
+	size_t handle;
+	int sent = 0, count, i;
+	float sample;
+	int flags;
+
+	while (num) {
+		/* wait for a free buffer, the driver has the others in flight */
+		count = SoapySDRDevice_acquireWriteBuffer(sdr, txStream, &handle, buffs_ptr, 1000000);
+		if (count <= 0) {
+			LOGP(DSOAPY, LOGL_ERROR, "Failed to acquire TX buffer (error=%d)\n", count);
+			break;
+		}
+		if (count > num)
+			count = num;
+		if (tx_cs16) {
+			int16_t *native = buffs_ptr[0];
+			/* clip to the range of the driver's samples, then round */
+			for (i = 0; i < count * 2; i++) {
+				sample = buff[i] * tx_full_scale;
+				if (sample > tx_full_scale - 1.0f)
+					sample = tx_full_scale - 1.0f;
+				else if (sample < -tx_full_scale)
+					sample = -tx_full_scale;
+				native[i] = lrintf(sample);
+			}
+		} else
+			memcpy(buffs_ptr[0], buff, count * 2 * sizeof(*buff));
+		flags = 0;
+		if (use_time_stamps)
+			flags |= SOAPY_SDR_HAS_TIME;
+		SoapySDRDevice_releaseWriteBuffer(sdr, txStream, handle, count, &flags, tx_timeNs);
+		tx_time_stamp(count);
+		/* increment transmit counters */
+		sent += count;
+		buff += count * 2;
+		num -= count;
+	}
+
+	return sent;
+}
+
 int soapy_send(float *buff, int num)
 {
     	const void *buffs_ptr[1];
@@ -478,6 +625,9 @@ int soapy_send(float *buff, int num)
 	int sent = 0, count;
 	int flags = 0;
 
+	if (tx_direct)
+		return soapy_send_direct(buff, num);
+
 	while (num) {
 		chunk = num;
 		if (chunk > tx_samps_per_buff)
@@ -491,14 +641,7 @@ int soapy_send(float *buff, int num)
 			LOGP(DUHD, LOGL_ERROR, "Failed to write to TX streamer (error=%d)\n", count);
 			break;
 		}
-		/* process TX time stamp */
-		if (!tx_valid)
-			LOGP(DSOAPY, LOGL_ERROR, "SDR TX: tosend() was not called before, prease fix!\n");
-		else {
-			pthread_mutex_lock(&timestamp_mutex);
-			tx_timeNs += count * Ns_per_sample;
-			pthread_mutex_unlock(&timestamp_mutex);
-		}
+		tx_time_stamp(count);
 		/* increment transmit counters */
 		sent += count;
 		buff += count * 2;
@@ -508,6 +651,55 @@ int soapy_send(float *buff, int num)
 	return sent;
 }
 
+/* Convert the driver's buffers into the given buffer. A buffer that is not
+ * consumed completely is kept until the next call, so the given buffer may
+ * be smaller than the buffers of the driver.
+ */
+static int soapy_receive_direct(float *buff, int max)
+{
+	const void *buffs_ptr[1];
+	int got = 0, count, i;
+	long long timeNs;
+	int flags;
+
+	while (max) {
+		if (!rx_buff) {
+			flags = 0;
+			count = SoapySDRDevice_acquireReadBuffer(sdr, rxStream, &rx_handle, buffs_ptr, &flags, &timeNs, 0);
+			if (count <= 0) {
+				/* got nothing this time */
+				break;
+			}
+			rx_time_stamp(flags, timeNs);
+			rx_buff = buffs_ptr[0];
+			rx_buff_count = count;
+			rx_buff_pos = 0;
+		}
+		count = rx_buff_count - rx_buff_pos;
+		if (count > max)
+			count = max;
+		if (rx_cs16) {
+			const int16_t *native = (const int16_t *)rx_buff + rx_buff_pos * 2;
+			float scale = 1.0 / rx_full_scale;
+			for (i = 0; i < count * 2; i++)
+				buff[i] = native[i] * scale;
+		} else
+			memcpy(buff, (const float *)rx_buff + rx_buff_pos * 2, count * 2 * sizeof(*buff));
+		rx_time_consumed(count);
+		rx_buff_pos += count;
+		if (rx_buff_pos == rx_buff_count) {
+			SoapySDRDevice_releaseReadBuffer(sdr, rxStream, rx_handle);
+			rx_buff = NULL;
+		}
+		/* commit received data to buffer */
+		got += count;
+		buff += count * 2;
+		max -= count;
+	}
+
+	return got;
+}
+
 /* read what we got, return 0, if buffer is empty, otherwise return the number of samples */
 int soapy_receive(float *buff, int max)
 {
@@ -516,6 +708,9 @@ int soapy_receive(float *buff, int max)
 	long long timeNs;
 	int flags = 0;
 
+	if (rx_direct)
+		return soapy_receive_direct(buff, max);
+
 	while (1) {
 		if (max < rx_samps_per_buff) {
 			/* no more space this time */
@@ -526,23 +721,8 @@ int soapy_receive(float *buff, int max)
 		buffs_ptr[0] = buff;
 		count = SoapySDRDevice_readStream(sdr, rxStream, buffs_ptr, rx_samps_per_buff, &flags, &timeNs, 0);
 		if (count > 0) {
-			if (!use_time_stamps || !(flags & SOAPY_SDR_HAS_TIME)) {
-				if (use_time_stamps) {
-					LOGP(DSOAPY, LOGL_ERROR, "SDR RX: No time stamps available. This may cause little gaps and problems with time slot based networks, like C-Netz.\n");
-					use_time_stamps = 0;
-				}
-				timeNs = rx_timeNs;
-			}
-			/* process RX time stamp */
-			if (!rx_valid) {
-				rx_timeNs = timeNs;
-				rx_valid = 1;
-			}
-			pthread_mutex_lock(&timestamp_mutex);
-			if (rx_timeNs != timeNs)
-				LOGP(DSOAPY, LOGL_ERROR, "SDR RX overflow, seems we are too slow. Use lower SDR sample rate, if this happens too often.\n");
-			rx_timeNs = timeNs + count * Ns_per_sample;
-			pthread_mutex_unlock(&timestamp_mutex);
+			rx_time_stamp(flags, timeNs);
+			rx_time_consumed(count);
 			/* commit received data to buffer */
 			got += count;
 			buff += count * 2;
@@ -556,6 +736,12 @@ int soapy_receive(float *buff, int max)
 	return got;
 }
 
+/* return 1, if received samples can be converted into any buffer size */
+int soapy_receive_direct_access(void)
+{
+	return rx_direct;
+}
+
 /* estimate number of samples that can be sent */
 int soapy_get_tosend(int buffer_size)
 {
@@ -590,3 +776,32 @@ int soapy_get_tosend(int buffer_size)
 	return tosend;
 }
 
+/* Get advance of TX time stamp in samples, for use with the TX scheduler.
+ * Return 0, if there is no valid RX time stamp yet. When called first, the
+ * TX time stamp is set in advance by given lead time.
+ */
+int soapy_get_advance(int lead, int *advance)
+{
+	if (!rx_valid)
+		return 0;
+
+	if (!tx_valid) {
+		tx_timeNs = rx_timeNs + lead * Ns_per_sample;
+		tx_valid = 1;
+	}
+
+	pthread_mutex_lock(&timestamp_mutex);
+	*advance = (tx_timeNs - rx_timeNs) / Ns_per_sample;
+	pthread_mutex_unlock(&timestamp_mutex);
+
+	return 1;
+}
+
+/* move TX time stamp forward, after samples got lost by an underrun */
+void soapy_skip_tx(int samples)
+{
+	pthread_mutex_lock(&timestamp_mutex);
+	tx_timeNs += samples * Ns_per_sample;
+	pthread_mutex_unlock(&timestamp_mutex);
+}
+
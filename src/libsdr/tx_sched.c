@@ -0,0 +1,123 @@
+/* TX scheduler with adaptive lead time
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Without scheduler, the TX time stamp is kept one buffer size in advance
+ * of the RX time stamp. The buffer size must cover the worst delay of the
+ * main loop, so the latency is always that high.
+ *
+ * The scheduler keeps a number of bursts queued at the radio, where a burst
+ * is what the write thread sends at once. The advance of the TX time stamp
+ * (lead time) is checked whenever the main loop asks how much to send. The
+ * samples consumed since the last call show how late the main loop was:
+ *
+ * - If the lead time is less than three times the consumed samples, it was
+ *   a close call. The lead time is raised to three times the consumed
+ *   samples. Short delays of a busy system come before the long ones, so the
+ *   lead time is raised before the long delays cause underruns.
+ * - If less than one burst is queued, the burst was late. If the TX time
+ *   stamp fell behind the RX time (underrun), the samples in between are
+ *   lost. The TX time stamp is moved to the RX time, so that no samples with
+ *   old time stamps are sent. Both are counted and raise the lead time as a
+ *   close call does.
+ * - If there was no close call for some seconds, the lead time is lowered
+ *   by one burst and by half of what exceeds the configured number of bursts.
+ *   When the system becomes idle, the lead time returns to the configured
+ *   number of bursts within a minute.
+ *
+ * The lead time never exceeds the buffer size, so the scheduler has at most
+ * the latency of the fixed lead time.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "tx_sched.h"
+
+#define RELAX_TIME	10	/* seconds without close call until lead time is reduced */
+#define HEADROOM	3	/* lead time over samples consumed between two calls */
+
+void sdr_tx_sched_init(sdr_tx_sched_t *sched, int samplerate, int burst, int bursts, int buffer_size)
+{
+	memset(sched, 0, sizeof(*sched));
+	if (burst < 1)
+		burst = 1;
+	sched->burst = burst;
+	sched->max_bursts = buffer_size / burst;
+	if (sched->max_bursts < 1)
+		sched->max_bursts = 1;
+	if (bursts > sched->max_bursts)
+		bursts = sched->max_bursts;
+	if (bursts < 1)
+		bursts = 1;
+	sched->min_bursts = bursts;
+	sched->bursts = bursts;
+	sched->relax = samplerate * RELAX_TIME;
+}
+
+/* current lead time in samples */
+int sdr_tx_sched_lead(sdr_tx_sched_t *sched)
+{
+	return sched->bursts * sched->burst;
+}
+
+/*
+ * Return number of samples to send, so that the lead time is reached.
+ * The advance is the TX time stamp minus RX time stamp in samples. If the
+ * TX time stamp must be moved forward, skip is set to the number of samples.
+ */
+int sdr_tx_sched_tosend(sdr_tx_sched_t *sched, int advance, int *skip)
+{
+	int tosend, used, bursts;
+
+	*skip = 0;
+
+	/* samples consumed since the lead time was reached last time */
+	used = sdr_tx_sched_lead(sched) - advance;
+
+	if (advance < 0) {
+		sched->underruns++;
+		*skip = -advance;
+		advance = 0;
+	} else if (advance < sched->burst)
+		sched->late++;
+
+	if (used * HEADROOM > sdr_tx_sched_lead(sched)) {
+		/* less than the headroom was left, raise lead time */
+		bursts = (used * HEADROOM + sched->burst - 1) / sched->burst;
+		if (bursts > sched->max_bursts)
+			bursts = sched->max_bursts;
+		if (bursts > sched->bursts)
+			sched->bursts = bursts;
+		sched->quiet = 0;
+	} else if (sched->quiet >= sched->relax) {
+		if (sched->bursts > sched->min_bursts)
+			sched->bursts -= 1 + (sched->bursts - sched->min_bursts) / 2;
+		sched->quiet = 0;
+	}
+
+	tosend = sdr_tx_sched_lead(sched) - advance;
+	if (tosend < 0)
+		tosend = 0;
+	sched->quiet += tosend;
+
+	sched->lead_sum += sdr_tx_sched_lead(sched);
+	sched->lead_count++;
+
+	return tosend;
+}
@@ -0,0 +1,19 @@
+
+typedef struct sdr_tx_sched {
+	int		burst;		/* samples written to the SDR at once */
+	int		min_bursts;	/* configured number of bursts to keep queued */
+	int		max_bursts;	/* limit given by buffer size */
+	int		bursts;		/* current number of bursts to keep queued */
+	int		quiet;		/* samples sent since last close call */
+	int		relax;		/* quiet samples before lead time is reduced */
+	/* counters */
+	unsigned int	underruns;	/* TX time stamp fell behind RX time */
+	unsigned int	late;		/* less than one burst was queued */
+	long long	lead_sum;	/* sum of lead time, to get the average */
+	unsigned int	lead_count;
+} sdr_tx_sched_t;
+
+void sdr_tx_sched_init(sdr_tx_sched_t *sched, int samplerate, int burst, int bursts, int buffer_size);
+int sdr_tx_sched_tosend(sdr_tx_sched_t *sched, int advance, int *skip);
+int sdr_tx_sched_lead(sdr_tx_sched_t *sched);
+
@@ -667,3 +667,34 @@ int uhd_get_tosend(int buffer_size)
 	return tosend;
 }
 
+/* Get advance of TX time stamp in samples, for use with the TX scheduler.
+ * Return 0, if there is no valid RX time stamp yet. When called first, the
+ * TX time stamp is set in advance by given lead time.
+ */
+int uhd_get_advance(int lead, int *advance)
+{
+	if (rx_time_secs == 0 && rx_time_fract_sec == 0.0)
+		return 0;
+
+	if (tx_time_secs == 0 && tx_time_fract_sec == 0.0) {
+		tx_time_secs = rx_time_secs;
+		tx_time_fract_sec = rx_time_fract_sec;
+		if (tx_timestamps)
+			uhd_skip_tx(lead);
+	}
+
+	*advance = (int)floor((((double)tx_time_secs - (double)rx_time_secs) + (tx_time_fract_sec - rx_time_fract_sec)) * samplerate);
+
+	return 1;
+}
+
+/* move TX time stamp forward, after samples got lost by an underrun */
+void uhd_skip_tx(int samples)
+{
+	tx_time_fract_sec += (double)samples / samplerate;
+	while (tx_time_fract_sec >= 1.0) {
+		tx_time_fract_sec -= 1.0;
+		tx_time_secs++;
+	}
+}
+
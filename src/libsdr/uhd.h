@@ -5,4 +5,6 @@ void uhd_close(void);
 int uhd_send(float *buff, int num);
 int uhd_receive(float *buff, int max);
 int uhd_get_tosend(int buffer_size);
+int uhd_get_advance(int lead, int *advance);
+void uhd_skip_tx(int samples);
 
@@ -17,9 +17,19 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+/* If the sound card supports it, the DMA area of the sound card is accessed
+ * directly (mmap access), so samples are converted from/to the DMA area
+ * without copying them into an intermediate buffer. Set ALSA_MMAP=0 in the
+ * environment to use snd_pcm_readi() and snd_pcm_writei() instead.
+ *
+ * Samples are converted in vectors of four (GCC vector extension), so the
+ * compiler uses SSE or NEON without depending on a certain architecture.
+ */
+
 #include <stdlib.h>
 #include <stdint.h>
 #include <math.h>
+#include <poll.h>
 #include <alsa/asoundlib.h>
 #include "../libsample/sample.h"
 #include "../liblogging/logging.h"
@@ -37,8 +47,14 @@ typedef struct sound {
 	int pchannels, cchannels;
 	int channels;			/* required number of channels */
 	int samplerate;			/* required sample rate */
+	int period;			/* capture period in frames, 0 for default */
 	char *caudiodev, *paudiodev;	/* required device */
 	double spl_deviation;		/* how much deviation is one sample step */
+	int mmap;			/* use mmap access, if supported */
+	int pmmap, cmmap;		/* mmap access is used for playback/capture */
+	int16_t *buff;			/* buffer for readi/writei and paging tone */
+	int buff_size;			/* size of buffer in frames */
+	int generation;			/* incremented when device is opened again */
 #ifdef HAVE_MOBILE
 	double paging_phaseshift;	/* phase to shift every sample */
 	double paging_phase;	 	/* current phase */
@@ -47,11 +63,16 @@ typedef struct sound {
 #endif
 } sound_t;
 
-static int set_hw_params(snd_pcm_t *handle, int samplerate, int *channels)
+typedef int32_t v4si __attribute__((vector_size(16)));
+typedef int64_t v4di __attribute__((vector_size(32)));
+typedef double v4df __attribute__((vector_size(32)));
+
+static int set_hw_params(snd_pcm_t *handle, int samplerate, int *channels, int *mmap, int period)
 {
 	snd_pcm_hw_params_t *hw_params = NULL;
 	int rc;
 	unsigned int rrate;
+	snd_pcm_uframes_t period_size;
 
 	rc = snd_pcm_hw_params_malloc(&hw_params);
 	if (rc < 0) {
@@ -71,7 +92,15 @@ static int set_hw_params(snd_pcm_t *handle, int samplerate, int *channels)
 		goto error;
 	}
 
-	rc = snd_pcm_hw_params_set_access (handle, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED);
+	if (*mmap) {
+		rc = snd_pcm_hw_params_set_access(handle, hw_params, SND_PCM_ACCESS_MMAP_INTERLEAVED);
+		if (rc < 0) {
+			LOGP(DSOUND, LOGL_DEBUG, "mmap access not supported, using read/write access (%s)\n", snd_strerror(rc));
+			*mmap = 0;
+		}
+	}
+	if (!*mmap)
+		rc = snd_pcm_hw_params_set_access(handle, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED);
 	if (rc < 0) {
 		LOGP(DSOUND, LOGL_ERROR, "cannot set access to interleaved (%s)\n", snd_strerror(rc));
 		goto error;
@@ -106,6 +135,16 @@ static int set_hw_params(snd_pcm_t *handle, int samplerate, int *channels)
 		}
 	}
 
+	/* a period is when poll() wakes up, so it should match the interval of the main loop */
+	if (period) {
+		period_size = period;
+		rc = snd_pcm_hw_params_set_period_size_near(handle, hw_params, &period_size, NULL);
+		if (rc < 0)
+			LOGP(DSOUND, LOGL_DEBUG, "cannot set period size of %d frames (%s)\n", period, snd_strerror(rc));
+		else
+			LOGP(DSOUND, LOGL_DEBUG, "Period size is %d frames.\n", (int)period_size);
+	}
+
 	rc = snd_pcm_hw_params(handle, hw_params);
 	if (rc < 0) {
 		LOGP(DSOUND, LOGL_ERROR, "cannot set parameters (%s)\n", snd_strerror(rc));
@@ -142,7 +181,8 @@ static int dev_open(sound_t *sound)
 		return (rc_play < 0) ? rc_play : rc_rec;
 
 	if (sound->direction == SOUND_DIR_PLAY || sound->direction == SOUND_DIR_DUPLEX) {
-		rc = set_hw_params(sound->phandle, sound->samplerate, &sound->pchannels);
+		sound->pmmap = sound->mmap;
+		rc = set_hw_params(sound->phandle, sound->samplerate, &sound->pchannels, &sound->pmmap, 0);
 		if (rc < 0) {
 			LOGP(DSOUND, LOGL_ERROR, "Failed to set playback hw params\n");
 			return rc;
@@ -151,7 +191,7 @@ static int dev_open(sound_t *sound)
 			LOGP(DSOUND, LOGL_ERROR, "Sound card only supports %d channel for playback.\n", sound->pchannels);
 			return rc;
 		}
-		LOGP(DSOUND, LOGL_DEBUG, "Playback with %d channels.\n", sound->pchannels);
+		LOGP(DSOUND, LOGL_DEBUG, "Playback with %d channels%s.\n", sound->pchannels, (sound->pmmap) ? " using mmap access" : "");
 
 		rc = snd_pcm_prepare(sound->phandle);
 		if (rc < 0) {
@@ -161,7 +201,8 @@ static int dev_open(sound_t *sound)
 	}
 
 	if (sound->direction == SOUND_DIR_REC || sound->direction == SOUND_DIR_DUPLEX) {
-		rc = set_hw_params(sound->chandle, sound->samplerate, &sound->cchannels);
+		sound->cmmap = sound->mmap;
+		rc = set_hw_params(sound->chandle, sound->samplerate, &sound->cchannels, &sound->cmmap, sound->period);
 		if (rc < 0) {
 			LOGP(DSOUND, LOGL_ERROR, "Failed to set capture hw params\n");
 			return rc;
@@ -170,7 +211,7 @@ static int dev_open(sound_t *sound)
 			LOGP(DSOUND, LOGL_ERROR, "Sound card only supports %d channel for capture.\n", sound->cchannels);
 			return -EIO;
 		}
-		LOGP(DSOUND, LOGL_DEBUG, "Capture with %d channels.\n", sound->cchannels);
+		LOGP(DSOUND, LOGL_DEBUG, "Capture with %d channels%s.\n", sound->cchannels, (sound->cmmap) ? " using mmap access" : "");
 
 		rc = snd_pcm_prepare(sound->chandle);
 		if (rc < 0) {
@@ -190,7 +231,7 @@ static void dev_close(sound_t *sound)
 		snd_pcm_close(sound->chandle);
 }
 
-void *sound_open(int direction, const char *audiodev, double __attribute__((unused)) *tx_frequency, double __attribute__((unused)) *rx_frequency, int __attribute__((unused)) *am, int channels, double __attribute__((unused)) paging_frequency, int samplerate, int __attribute((unused)) buffer_size, double __attribute__((unused)) interval, double max_deviation, double __attribute__((unused)) max_modulation, double __attribute__((unused)) modulation_index)
+void *sound_open(int direction, const char *audiodev, double __attribute__((unused)) *tx_frequency, double __attribute__((unused)) *rx_frequency, int __attribute__((unused)) *am, int channels, double __attribute__((unused)) paging_frequency, int samplerate, int __attribute((unused)) buffer_size, double interval, double max_deviation, double __attribute__((unused)) max_modulation, double __attribute__((unused)) modulation_index)
 {
 	sound_t *sound;
 	const char *env;
@@ -218,7 +259,11 @@ void *sound_open(int direction, const char *audiodev, double __attribute__((unus
 	sound->direction = direction;
 	sound->channels = channels;
 	sound->samplerate = samplerate;
+	sound->period = (double)samplerate * interval / 1000.0;
 	sound->spl_deviation = max_deviation / 32767.0;
+	sound->mmap = 1;
+	if ((env = getenv("ALSA_MMAP")))
+		sound->mmap = atoi(env);
 #ifdef HAVE_MOBILE
 	sound->paging_phaseshift = 1.0 / ((double)samplerate / 1000.0);
 #endif
@@ -263,7 +308,10 @@ int sound_start(void *inst)
 		return -EINVAL;
 
 	/* trigger capturing */
-	snd_pcm_readi(sound->chandle, buff, 1);
+	if (sound->cmmap)
+		snd_pcm_start(sound->chandle);
+	else
+		snd_pcm_readi(sound->chandle, buff, 1);
 
 	return 0;
 }
@@ -274,13 +322,33 @@ void sound_close(void *inst)
 
 	dev_close(sound);
 	free(sound->paudiodev);
+	free(sound->buff);
 	free(sound);
 }
 
+/* get buffer for readi/writei, the buffer grows if required */
+static int16_t *get_buff(sound_t *sound, int frames)
+{
+	int16_t *buff;
+
+	if (frames <= sound->buff_size)
+		return sound->buff;
+	buff = realloc(sound->buff, frames * 2 * sizeof(*buff));
+	if (!buff) {
+		LOGP(DSOUND, LOGL_ERROR, "Failed to alloc memory!\n");
+		return NULL;
+	}
+	sound->buff = buff;
+	sound->buff_size = frames;
+	return buff;
+}
+
 #ifdef HAVE_MOBILE
-static void gen_paging_tone(sound_t *sound, int16_t *samples, int length, enum paging_signal paging_signal, int on)
+/* generate paging tone, step is the distance between samples */
+static void gen_paging_tone(sound_t *sound, int16_t *samples, int step, int length, enum paging_signal paging_signal, int on)
 {
 	double phaseshift, phase;
+	int16_t value;
 	int i;
 
 	switch (paging_signal) {
@@ -295,16 +363,18 @@ static void gen_paging_tone(sound_t *sound, int16_t *samples, int length, enum p
 			phase = sound->paging_phase;
 			for (i = 0; i < length; i++) {
 				if (phase < 0.5)
-					*samples++ = 30000;
+					samples[i * step] = 30000;
 				else
-					*samples++ = -30000;
+					samples[i * step] = -30000;
 				phase += phaseshift;
 				if (phase >= 1.0)
 					phase -= 1.0;
 			}
 			sound->paging_phase = phase;
-		} else
-			memset(samples, 0, length << 1);
+		} else {
+			for (i = 0; i < length; i++)
+				samples[i * step] = 0;
+		}
 		break;
 	case PAGING_SIGNAL_NEGATIVE:
 		/* negative signal if paging signal is on */
@@ -312,10 +382,9 @@ static void gen_paging_tone(sound_t *sound, int16_t *samples, int length, enum p
 		/* FALLTHRU */
 	case PAGING_SIGNAL_POSITIVE:
 		/* positive signal if paging signal is on */
-		if (on)
-			memset(samples, 127, length << 1);
-		else
-			memset(samples, 128, length << 1);
+		value = (on) ? 0x7f7f : (int16_t)0x8080;
+		for (i = 0; i < length; i++)
+			samples[i * step] = value;
 		break;
 	case PAGING_SIGNAL_NONE:
 		break;
@@ -323,84 +392,219 @@ static void gen_paging_tone(sound_t *sound, int16_t *samples, int length, enum p
 }
 #endif
 
-int sound_write(void *inst, sample_t **samples, uint8_t __attribute__((unused)) **power, int num, enum paging_signal __attribute__((unused)) *paging_signal, int __attribute__((unused)) *on, int channels)
+/* convert samples of one channel for playback and clip them, step is the distance between samples */
+static void play_convert(const sample_t *samples, int num, double spl_deviation, int16_t *buff, int step)
 {
-	sound_t *sound = (sound_t *)inst;
-	double spl_deviation = sound->spl_deviation;
+	const v4df high = { 32767.0, 32767.0, 32767.0, 32767.0 }, low = -high;
 	int32_t value;
-	int16_t buff[num << 1];
-	int rc;
-	int i, ii;
+	v4df d;
+	v4di mask;
+	v4si v;
+	int i;
 
-	if (sound->direction != SOUND_DIR_PLAY && sound->direction != SOUND_DIR_DUPLEX)
-		return -EINVAL;
+	for (i = 0; i + 4 <= num; i += 4, buff += step * 4) {
+		memcpy(&d, samples + i, sizeof(d));
+		d /= spl_deviation;
+		/* clip without branch */
+		mask = d > high;
+		d = (v4df)(((v4di)d & ~mask) | ((v4di)high & mask));
+		mask = d < low;
+		d = (v4df)(((v4di)d & ~mask) | ((v4di)low & mask));
+		v = __builtin_convertvector(d, v4si);
+		buff[0] = v[0];
+		buff[step] = v[1];
+		buff[step * 2] = v[2];
+		buff[step * 3] = v[3];
+	}
+	for (; i < num; i++, buff += step) {
+		value = samples[i] / spl_deviation;
+		if (value > 32767)
+			value = 32767;
+		else if (value < -32767)
+			value = -32767;
+		*buff = value;
+	}
+}
+
+/* convert recorded samples of one channel, step is the distance between
+ * samples, if sum is set, both channels are added, return peak level */
+static int32_t rec_convert(const int16_t *buff, int step, int sum, sample_t *samples, int num, double spl_deviation)
+{
+	v4si v, a, mask, peak = { 0, 0, 0, 0 };
+	v4df d;
+	int32_t spl, max = 0;
+	int i;
+
+	for (i = 0; i + 4 <= num; i += 4, buff += step * 4) {
+		v = (v4si){ buff[0], buff[step], buff[step * 2], buff[step * 3] };
+		if (sum)
+			v += (v4si){ buff[1], buff[step + 1], buff[step * 2 + 1], buff[step * 3 + 1] };
+		d = __builtin_convertvector(v, v4df) * spl_deviation;
+		memcpy(samples + i, &d, sizeof(d));
+		/* peak of absolute value without branch */
+		mask = v >> 31;
+		a = (v ^ mask) - mask;
+		mask = a > peak;
+		peak = (peak & ~mask) | (a & mask);
+	}
+	for (i = 0; i < 4; i++) {
+		if (peak[i] > max)
+			max = peak[i];
+	}
+	for (i = num & ~3; i < num; i++, buff += step) {
+		spl = buff[0];
+		if (sum)
+			spl += buff[1];
+		samples[i] = (double)spl * spl_deviation;
+		if (spl < 0)
+			spl = -spl;
+		if (spl > max)
+			max = spl;
+	}
+
+	return max;
+}
+
+/* convert samples to interleaved frames of sound card */
+static void play_frames(sound_t *sound, int16_t *buff, sample_t **samples, int offset, int num, enum paging_signal __attribute__((unused)) *paging_signal, int __attribute__((unused)) *on, int channels)
+{
+	double spl_deviation = sound->spl_deviation;
+	int i;
 
 	if (sound->pchannels == 2) {
 		/* two channels */
 #ifdef HAVE_MOBILE
 		if (paging_signal && on && paging_signal[0] != PAGING_SIGNAL_NONE) {
-			int16_t paging[num << 1];
-			gen_paging_tone(sound, paging, num, paging_signal[0], on[0]);
-			for (i = 0, ii = 0; i < num; i++) {
-				value = samples[0][i] / spl_deviation;
-				if (value > 32767)
-					value = 32767;
-				else if (value < -32767)
-					value = -32767;
-				buff[ii++] = value;
-				buff[ii++] = paging[i];
-			}
+			play_convert(samples[0] + offset, num, spl_deviation, buff, 2);
+			gen_paging_tone(sound, buff + 1, 2, num, paging_signal[0], on[0]);
 		} else
 #endif
 		if (channels == 2) {
-			for (i = 0, ii = 0; i < num; i++) {
-				value = samples[0][i] / spl_deviation;
-				if (value > 32767)
-					value = 32767;
-				else if (value < -32767)
-					value = -32767;
-				buff[ii++] = value;
-				value = samples[1][i] / spl_deviation;
-				if (value > 32767)
-					value = 32767;
-				else if (value < -32767)
-					value = -32767;
-				buff[ii++] = value;
-			}
+			play_convert(samples[0] + offset, num, spl_deviation, buff, 2);
+			play_convert(samples[1] + offset, num, spl_deviation, buff + 1, 2);
 		} else {
-			for (i = 0, ii = 0; i < num; i++) {
-				value = samples[0][i] / spl_deviation;
-				if (value > 32767)
-					value = 32767;
-				else if (value < -32767)
-					value = -32767;
-				buff[ii++] = value;
-				buff[ii++] = value;
-			}
+			play_convert(samples[0] + offset, num, spl_deviation, buff, 2);
+			for (i = 0; i < num; i++)
+				buff[i * 2 + 1] = buff[i * 2];
 		}
 	} else {
 		/* one channel */
-		for (i = 0, ii = 0; i < num; i++) {
-			value = samples[0][i] / spl_deviation;
-			if (value > 32767)
-				value = 32767;
-			else if (value < -32767)
-				value = -32767;
-			buff[ii++] = value;
+		play_convert(samples[0] + offset, num, spl_deviation, buff, 1);
+	}
+}
+
+/* convert interleaved frames of sound card to samples, update peak levels */
+static void rec_frames(sound_t *sound, const int16_t *buff, sample_t **samples, int offset, int num, int channels, int32_t *max)
+{
+	double spl_deviation = sound->spl_deviation;
+	int32_t peak;
+
+	if (sound->cchannels == 2) {
+		if (channels < 2) {
+			peak = rec_convert(buff, 2, 1, samples[0] + offset, num, spl_deviation);
+			if (peak > max[0])
+				max[0] = peak;
+		} else {
+			peak = rec_convert(buff, 2, 0, samples[0] + offset, num, spl_deviation);
+			if (peak > max[0])
+				max[0] = peak;
+			peak = rec_convert(buff + 1, 2, 0, samples[1] + offset, num, spl_deviation);
+			if (peak > max[1])
+				max[1] = peak;
 		}
+	} else {
+		peak = rec_convert(buff, 1, 0, samples[0] + offset, num, spl_deviation);
+		if (peak > max[0])
+			max[0] = peak;
+	}
+}
+
+/* get pointer to frame in DMA area */
+static int16_t *mmap_frames(const snd_pcm_channel_area_t *areas, snd_pcm_uframes_t offset)
+{
+	return (int16_t *)((uint8_t *)areas[0].addr + areas[0].first / 8 + offset * areas[0].step / 8);
+}
+
+/* recover from xrun by opening the device again */
+static int recover(sound_t *sound)
+{
+	int rc;
+
+	dev_close(sound);
+	/* descriptors of poll() are gone */
+	sound->generation++;
+	rc = dev_open(sound);
+	if (rc < 0)
+		return rc;
+	sound_start(sound);
+	return -EPIPE; /* indicate what happened */
+}
+
+/* convert directly into the DMA area, return number of frames written */
+static int write_mmap(sound_t *sound, sample_t **samples, int num, enum paging_signal *paging_signal, int *on, int channels)
+{
+	const snd_pcm_channel_area_t *areas;
+	snd_pcm_uframes_t offset, frames;
+	snd_pcm_sframes_t avail, committed;
+	int written = 0;
+	int rc;
+
+	avail = snd_pcm_avail_update(sound->phandle);
+	if (avail < 0)
+		return avail;
+	if (avail > num)
+		avail = num;
+
+	/* the DMA area may wrap, so it takes up to two turns */
+	while (written < avail) {
+		frames = avail - written;
+		rc = snd_pcm_mmap_begin(sound->phandle, &areas, &offset, &frames);
+		if (rc < 0)
+			return rc;
+		if (!frames)
+			break;
+		play_frames(sound, mmap_frames(areas, offset), samples, written, frames, paging_signal, on, channels);
+		committed = snd_pcm_mmap_commit(sound->phandle, offset, frames);
+		if (committed < 0)
+			return committed;
+		written += committed;
+		if ((snd_pcm_uframes_t)committed != frames)
+			break;
+	}
+
+	/* unlike writei, mmap access does not start playback */
+	if (written && snd_pcm_state(sound->phandle) == SND_PCM_STATE_PREPARED) {
+		rc = snd_pcm_start(sound->phandle);
+		if (rc < 0)
+			return rc;
+	}
+
+	return written;
+}
+
+int sound_write(void *inst, sample_t **samples, uint8_t __attribute__((unused)) **power, int num, enum paging_signal *paging_signal, int *on, int channels)
+{
+	sound_t *sound = (sound_t *)inst;
+	int16_t *buff;
+	int rc;
+
+	if (sound->direction != SOUND_DIR_PLAY && sound->direction != SOUND_DIR_DUPLEX)
+		return -EINVAL;
+
+	if (sound->pmmap)
+		rc = write_mmap(sound, samples, num, paging_signal, on, channels);
+	else {
+		buff = get_buff(sound, num);
+		if (!buff)
+			return -ENOMEM;
+		play_frames(sound, buff, samples, 0, num, paging_signal, on, channels);
+		rc = snd_pcm_writei(sound->phandle, buff, num);
 	}
-	rc = snd_pcm_writei(sound->phandle, buff, num);
 
 	if (rc < 0) {
 		LOGP(DSOUND, LOGL_ERROR, "failed to write audio to interface (%s)\n", snd_strerror(rc));
-		if (rc == -EPIPE) {
-			dev_close(sound);
-			rc = dev_open(sound);
-			if (rc < 0)
-				return rc;
-			sound_start(sound);
-			return -EPIPE; /* indicate what happened */
-		}
+		if (rc == -EPIPE)
+			return recover(sound);
 		return rc;
 	}
 
@@ -410,84 +614,87 @@ int sound_write(void *inst, sample_t **samples, uint8_t __attribute__((unused))
 	return rc;
 }
 
+/* convert directly from the DMA area, return number of frames read */
+static int read_mmap(sound_t *sound, sample_t **samples, int num, int channels, int32_t *max)
+{
+	const snd_pcm_channel_area_t *areas;
+	snd_pcm_uframes_t offset, frames;
+	snd_pcm_sframes_t avail, committed;
+	int got = 0;
+	int rc;
+
+	avail = snd_pcm_avail_update(sound->chandle);
+	if (avail < 0)
+		return avail;
+	if (avail > num)
+		avail = num;
+
+	/* the DMA area may wrap, so it takes up to two turns */
+	while (got < avail) {
+		frames = avail - got;
+		rc = snd_pcm_mmap_begin(sound->chandle, &areas, &offset, &frames);
+		if (rc < 0)
+			return rc;
+		if (!frames)
+			break;
+		rec_frames(sound, mmap_frames(areas, offset), samples, got, frames, channels, max);
+		committed = snd_pcm_mmap_commit(sound->chandle, offset, frames);
+		if (committed < 0)
+			return committed;
+		got += committed;
+		if ((snd_pcm_uframes_t)committed != frames)
+			break;
+	}
+
+	return got;
+}
+
 int sound_read(void *inst, sample_t **samples, int num, int channels, double *rf_level_db)
 {
 	sound_t *sound = (sound_t *)inst;
-	double spl_deviation = sound->spl_deviation;
-	int16_t buff[num << 1];
-	int32_t spl;
-	int32_t max[2], a;
+	int16_t *buff;
+	int32_t max[2] = { 0, 0 };
 	int in, rc;
-	int i, ii;
+	int i;
 
 	if (sound->direction != SOUND_DIR_REC && sound->direction != SOUND_DIR_DUPLEX)
 		return -EINVAL;
 
-	/* get samples in rx buffer */
-	in = snd_pcm_avail(sound->chandle);
-	/* if not more than KEEP_FRAMES frames available, try next time */
-	if (in <= KEEP_FRAMES)
-		return 0;
-	/* read some frames less than in buffer, because snd_pcm_readi() seems
-	 * to corrupt last frames */
-	in -= KEEP_FRAMES;
-	if (in > num)
-		in = num;
-
-	/* make valgrind happy, because snd_pcm_readi() does not seem to initially fill buffer with values */
-	memset(buff, 0, sizeof(*buff) * sound->cchannels * in);
-
-	rc = snd_pcm_readi(sound->chandle, buff, in);
+	if (sound->cmmap)
+		rc = read_mmap(sound, samples, num, channels, max);
+	else {
+		/* get samples in rx buffer */
+		in = snd_pcm_avail(sound->chandle);
+		/* if not more than KEEP_FRAMES frames available, try next time */
+		if (in <= KEEP_FRAMES)
+			return 0;
+		/* read some frames less than in buffer, because snd_pcm_readi() seems
+		 * to corrupt last frames */
+		in -= KEEP_FRAMES;
+		if (in > num)
+			in = num;
+
+		buff = get_buff(sound, in);
+		if (!buff)
+			return -ENOMEM;
+		/* make valgrind happy, because snd_pcm_readi() does not seem to initially fill buffer with values */
+		memset(buff, 0, sizeof(*buff) * sound->cchannels * in);
+
+		rc = snd_pcm_readi(sound->chandle, buff, in);
+		if (rc > 0)
+			rec_frames(sound, buff, samples, 0, rc, channels, max);
+	}
 	if (rc < 0) {
-		if (errno == EAGAIN)
+		if (rc == -EAGAIN)
 			return 0;
 		LOGP(DSOUND, LOGL_ERROR, "failed to read audio from interface (%s)\n", snd_strerror(rc));
 		/* recover read */
-		if (rc == -EPIPE) {
-			dev_close(sound);
-			rc = dev_open(sound);
-			if (rc < 0)
-				return rc;
-			sound_start(sound);
-			return -EPIPE; /* indicate what happened */
-		}
+		if (rc == -EPIPE)
+			return recover(sound);
 		return rc;
 	}
 	if (rc == 0)
 		return rc;
-	if (sound->cchannels == 2) {
-		if (channels < 2) {
-			for (i = 0, ii = 0; i < rc; i++) {
-				spl = buff[ii++];
-				spl += buff[ii++];
-				a = (spl >= 0) ? spl : -spl;
-				if (i == 0 || a > max[0])
-					max[0] = a;
-				samples[0][i] = (double)spl * spl_deviation;
-			}
-		} else {
-			for (i = 0, ii = 0; i < rc; i++) {
-				spl = buff[ii++];
-				a = (spl >= 0) ? spl : -spl;
-				if (i == 0 || a > max[0])
-					max[0] = a;
-				samples[0][i] = (double)spl * spl_deviation;
-				spl = buff[ii++];
-				a = (spl >= 0) ? spl : -spl;
-				if (i == 0 || a > max[1])
-					max[1] = a;
-				samples[1][i] = (double)spl * spl_deviation;
-			}
-		}
-	} else {
-		for (i = 0, ii = 0; i < rc; i++) {
-			spl = buff[ii++];
-			a = (spl >= 0) ? spl : -spl;
-			if (i == 0 || a > max[0])
-				max[0] = a;
-			samples[0][i] = (double)spl * spl_deviation;
-		}
-	}
 
 #ifdef HAVE_MOBILE
 	sender_t *sender;
@@ -529,14 +736,8 @@ int sound_get_tosend(void *inst, int buffer_size)
 			LOGP(DSOUND, LOGL_ERROR, "Buffer underrun: Please use higher buffer and enable real time scheduling\n");
 		else
 			LOGP(DSOUND, LOGL_ERROR, "failed to get delay from interface (%s)\n", snd_strerror(rc));
-		if (rc == -EPIPE) {
-			dev_close(sound);
-			rc = dev_open(sound);
-			if (rc < 0)
-				return rc;
-			sound_start(sound);
-			return -EPIPE; /* indicate what happened */
-		}
+		if (rc == -EPIPE)
+			return recover(sound);
 		return rc;
 	}
 
@@ -546,6 +747,63 @@ int sound_get_tosend(void *inst, int buffer_size)
 	return tosend;
 }
 
+/*
+ * get file descriptors to wait for captured samples
+ *
+ * The sound card wakes up the poll() once per period, so a main loop may sleep
+ * until samples are available instead of polling at a fixed interval.
+ *
+ * return number of descriptors stored */
+int sound_get_poll_fds(void *inst, struct pollfd *fds, int space)
+{
+	sound_t *sound = (sound_t *)inst;
+	int rc;
+
+	if (sound->direction != SOUND_DIR_REC && sound->direction != SOUND_DIR_DUPLEX)
+		return -EINVAL;
+
+	rc = snd_pcm_poll_descriptors_count(sound->chandle);
+	if (rc < 0)
+		return rc;
+	if (rc > space)
+		return -ENOSPC;
+
+	return snd_pcm_poll_descriptors(sound->chandle, fds, rc);
+}
+
+/*
+ * check descriptors after poll() returned
+ *
+ * return 1 if samples can be read, 0 if not, -EPIPE on overrun */
+int sound_poll_revents(void *inst, struct pollfd *fds, int count)
+{
+	sound_t *sound = (sound_t *)inst;
+	unsigned short revents;
+	int rc;
+
+	rc = snd_pcm_poll_descriptors_revents(sound->chandle, fds, count, &revents);
+	if (rc < 0)
+		return rc;
+	if ((revents & POLLERR))
+		return -EPIPE;
+	if ((revents & POLLIN))
+		return 1;
+	return 0;
+}
+
+/*
+ * get generation of descriptors
+ *
+ * After an xrun, the device is opened again and gets new descriptors. If the
+ * generation changed, the descriptors must be collected again.
+ */
+int sound_poll_generation(void *inst)
+{
+	sound_t *sound = (sound_t *)inst;
+
+	return sound->generation;
+}
+
 int sound_is_stereo_capture(void *inst)
 {
 	sound_t *sound = (sound_t *)inst;
@@ -30,6 +30,14 @@
 
 /* NOTE: No locking required for writing and reading buffer pointers, since 'int' is atomic on >=32 bit machines */
 
+/* wake up a writer that waits for space in the buffer */
+static void record_signal(wave_rec_t *rec)
+{
+	pthread_mutex_lock(&rec->lock);
+	pthread_cond_broadcast(&rec->space_cond);
+	pthread_mutex_unlock(&rec->lock);
+}
+
 static void *record_child(void *arg)
 {
 	wave_rec_t *rec = (wave_rec_t *)arg;
@@ -54,12 +62,14 @@ static void *record_child(void *arg)
 error:
 			LOGP(DWAVE, LOGL_ERROR, "Failed to write to recording WAVE file! (errno %d)\n", errno);
 			rec->finish = 1;
+			record_signal(rec);
 			return NULL;
 		}
 		/* increment read pointer */
 		rec->buffer_readp += len;
 		if (rec->buffer_readp == rec->buffer_size)
 			rec->buffer_readp = 0;
+		record_signal(rec);
 		/* quit on end of file */
 		if (len != to_write)
 			goto error;
@@ -143,10 +153,14 @@ int wave_create_record(wave_rec_t *rec, const char *filename, int samplerate, in
 		rc = ENOMEM;
 		goto error;
 	}
+	pthread_mutex_init(&rec->lock, NULL);
+	pthread_cond_init(&rec->space_cond, NULL);
 
 	rc = pthread_create(&rec->tid, NULL, record_child, rec);
 	if (rc < 0) {
 		LOGP(DWAVE, LOGL_ERROR, "Failed to create thread to record WAVE file! (errno %d)\n", errno);
+		pthread_cond_destroy(&rec->space_cond);
+		pthread_mutex_destroy(&rec->lock);
 		goto error;
 	}
 
@@ -368,6 +382,32 @@ int wave_write(wave_rec_t *rec, sample_t **samples, int length)
 	return to_write;
 }
 
+/* write all samples, wait until the thread has written enough data to the
+ * file to store them. return the number of samples written, which is less on
+ * error. */
+int wave_write_wait(wave_rec_t *rec, sample_t **samples, int length)
+{
+	sample_t *part[rec->channels];
+	int space, done = 0, c, n;
+
+	while (done < length) {
+		pthread_mutex_lock(&rec->lock);
+		while (!rec->finish && !(space = (rec->buffer_size + rec->buffer_readp - rec->buffer_writep - 1) % rec->buffer_size / (2 * rec->channels)))
+			pthread_cond_wait(&rec->space_cond, &rec->lock);
+		pthread_mutex_unlock(&rec->lock);
+		if (rec->finish)
+			break;
+		n = length - done;
+		if (n > space)
+			n = space;
+		for (c = 0; c < rec->channels; c++)
+			part[c] = samples[c] + done;
+		done += wave_write(rec, part, n);
+	}
+
+	return done;
+}
+
 int wave_read(wave_play_t *play, sample_t **samples, int length)
 {
 	double max_deviation = play->max_deviation;
@@ -438,6 +478,9 @@ void wave_destroy_record(wave_rec_t *rec)
 
 	/* on error, thread has terminated */
 	if (rec->finish) {
+		pthread_join(rec->tid, NULL);
+		pthread_cond_destroy(&rec->space_cond);
+		pthread_mutex_destroy(&rec->lock);
 		fclose(rec->fp);
 		rec->fp = NULL;
 		return;
@@ -446,6 +489,8 @@ void wave_destroy_record(wave_rec_t *rec)
 	/* finish thread */
 	rec->finish = 1;
 	pthread_join(rec->tid, NULL);
+	pthread_cond_destroy(&rec->space_cond);
+	pthread_mutex_destroy(&rec->lock);
 
 	/* cue */
 	fprintf(rec->fp, "cue %c%c%c%c%c%c%c%c", 4, 0, 0, 0, 0,0,0,0);
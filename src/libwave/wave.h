@@ -12,6 +12,8 @@ typedef struct wave_rec {
 	int		buffer_size;	/* size of buffer in bytes */
 	int		buffer_readp;	/* read pointer to next byte in buffer */
 	int		buffer_writep;	/* write pointer to next byte in buffer */
+	pthread_mutex_t	lock;
+	pthread_cond_t	space_cond;	/* signals that the thread has written data */
 } wave_rec_t;
 
 typedef struct wave_play {
@@ -32,6 +34,7 @@ int wave_create_record(wave_rec_t *rec, const char *filename, int samplerate, in
 int wave_create_playback(wave_play_t *play, const char *filename, int *samplerate_p, int *channels_p, double max_deviation);
 int wave_read(wave_play_t *play, sample_t **samples, int length);
 int wave_write(wave_rec_t *rec, sample_t **samples, int length);
+int wave_write_wait(wave_rec_t *rec, sample_t **samples, int length);
 void wave_destroy_record(wave_rec_t *rec);
 void wave_destroy_playback(wave_play_t *play);
 
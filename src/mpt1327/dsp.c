@@ -29,6 +29,7 @@
 #include "../libmobile/call.h"
 #include "../liblogging/logging.h"
 #include <osmocom/core/timer.h>
+#include "../libmobile/timer_wheel.h"
 #include "mpt1327.h"
 #include "dsp.h"
 #include "message.h"
@@ -31,6 +31,7 @@
 #include "../libmobile/main_mobile.h"
 #include "../liblogging/logging.h"
 #include <osmocom/core/timer.h>
+#include "../libmobile/timer_wheel.h"
 #include "../anetz/freiton.h"
 #include "../anetz/besetztton.h"
 #include "../liboptions/options.h"
@@ -49,6 +50,7 @@ static int wt = 10;
 static int per = 5;
 static int pon = 1;
 static int timeout = 30;
+static const char *db_file = NULL;
 
 const char *aaimage[] = { NULL };
 
@@ -98,11 +100,17 @@ void print_help(const char *arg0)
 	printf("        and stays below this level, the connection is released.\n");
 	printf("        Use 'auto' to do automatic noise floor calibration to detect loss.\n");
 	printf("        Only works with SDR! (disabled by default)\n");
+	printf("    --db-file <filename>\n");
+	printf("        Keep a snapshot of seen Radio Units in the given file. The units are\n");
+	printf("        loaded from it at startup, so they are known after a restart.\n");
+	printf("        (default = no snapshot)\n");
 	main_mobile_print_station_id();
 	main_mobile_print_hotkeys();
 	printf("Press 'i' key to dump list of seen Radio Units.\n");
 }
 
+#define OPT_DB_FILE		256
+
 static void add_options(void)
 {
 	main_mobile_add_options();
@@ -112,6 +120,7 @@ static void add_options(void)
 	option_add('N', "net", 3);
 	option_add('S', "sysdef", 1);
 	option_add('Q', "squelch", 1);
+	option_add(OPT_DB_FILE, "db-file", 1);
 }
 
 static int read_sys(const char *param, const char *value, int digits)
@@ -243,6 +252,9 @@ sysdef_oor:
 		else
 			squelch_db = atof(argv[argi]);
 		break;
+	case OPT_DB_FILE:
+		db_file = options_strdup(argv[argi]);
+		break;
 	default:
 		return main_mobile_handle_options(short_option, argi, argv);
 	}
@@ -382,6 +394,15 @@ int main(int argc, char *argv[])
 
 	mpt1327_check_channels();
 
+	/* restore Radio Units from last run */
+	if (db_file) {
+		rc = load_units(db_file);
+		if (rc < 0) {
+			fprintf(stderr, "Failed to open Radio Unit snapshot file '%s'. Quitting!\n", db_file);
+			goto fail;
+		}
+	}
+
 	main_mobile_loop("mpt1327", &quit, NULL, station_id);
 
 fail:
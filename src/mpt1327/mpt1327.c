@@ -67,15 +67,18 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include <errno.h>
 #include <math.h>
 #include <inttypes.h>
 #include "../libsample/sample.h"
 #include "../liblogging/logging.h"
 #include <osmocom/core/timer.h>
+#include "../libmobile/timer_wheel.h"
 #include "../libmobile/call.h"
 #include "../libmobile/cause.h"
 #include "../libmobile/console.h"
+#include "../libmobile/replay.h"
 #include <osmocom/cc/message.h>
 #include "mpt1327.h"
 #include "dsp.h"
@@ -135,7 +138,27 @@ void init_sysdef (uint16_t sys, int wt, int per, int pon, int timeout)
  * Units handling
  */
 
+/* units are found via hash table, the list keeps the order of registration */
+#define UNIT_HASH_SIZE		4096
+#define CALLREF_HASH_SIZE	256
+
+/* each state bit has a list of units, so units that need a message are found
+ * without walking through all units
+ */
+#define UNIT_STATE_LISTS	64
+
 static mpt1327_unit_t *unit_list = NULL;
+static mpt1327_unit_t **unit_list_tail = &unit_list;
+static mpt1327_unit_t *unit_hash[UNIT_HASH_SIZE];
+static mpt1327_unit_t *callref_hash[CALLREF_HASH_SIZE];
+static struct unit_state_list {
+	mpt1327_unit_t		*head;
+	mpt1327_unit_t		**tail;
+} unit_state_list[UNIT_STATE_LISTS];
+static uint32_t unit_state_seq;
+
+static const char *snapshot_file;
+static FILE *snapshot_fp;
 
 #define	UNIT_IDLE		0
 #define UNIT_REGISTER_ACK	(1 << 0)	/* need to ack registration */
@@ -194,57 +217,166 @@ static const char *unit_state_name(uint64_t state)
 	return invalid;
 }
 
+static inline uint32_t unit_hash_key(uint8_t prefix, uint16_t ident)
+{
+	uint32_t key = ((uint32_t)prefix << 13) | ident;
+
+	return (key * 2654435761u) >> 20; /* 12 bits for UNIT_HASH_SIZE */
+}
+
+static inline uint32_t callref_hash_key(uint32_t callref)
+{
+	return (callref * 2654435761u) >> 24; /* 8 bits for CALLREF_HASH_SIZE */
+}
+
+/* IDLE units are not listed, because no message is sent to them */
+static void unit_state_link(mpt1327_unit_t *unit)
+{
+	struct unit_state_list *list;
+
+	if (unit->state == UNIT_IDLE)
+		return;
+	list = &unit_state_list[__builtin_ctzll(unit->state)];
+	if (!list->tail)
+		list->tail = &list->head;
+	/* append, so the first unit in the list has waited longest */
+	unit->state_next = NULL;
+	unit->state_pprev = list->tail;
+	*list->tail = unit;
+	list->tail = &unit->state_next;
+	unit->state_seq = unit_state_seq++;
+}
+
+static void unit_state_unlink(mpt1327_unit_t *unit)
+{
+	struct unit_state_list *list;
+
+	if (!unit->state_pprev)
+		return;
+	list = &unit_state_list[__builtin_ctzll(unit->state)];
+	*unit->state_pprev = unit->state_next;
+	if (unit->state_next)
+		unit->state_next->state_pprev = unit->state_pprev;
+	else
+		list->tail = unit->state_pprev;
+	unit->state_next = NULL;
+	unit->state_pprev = NULL;
+}
+
 static void unit_new_state(mpt1327_unit_t *unit, uint64_t new_state)
 {
 	LOGP(DMPT1327, LOGL_DEBUG, "Radio Unit (Prefix:%d Ident:%d) state: %s -> %s\n", unit->prefix, unit->ident, unit_state_name(unit->state), unit_state_name(new_state));
+	unit_state_unlink(unit);
 	unit->state = new_state;
+	unit_state_link(unit);
+}
+
+static void unit_set_callref(mpt1327_unit_t *unit, uint32_t callref)
+{
+	mpt1327_unit_t **hashp;
+
+	if (unit->callref) {
+		hashp = &callref_hash[callref_hash_key(unit->callref)];
+		while (*hashp && *hashp != unit)
+			hashp = &((*hashp)->callref_next);
+		if (!(*hashp)) {
+			LOGP(DMPT1327, LOGL_ERROR, "Radio Unit not in callref hash, please fix!\n");
+			abort();
+		}
+		*hashp = unit->callref_next;
+		unit->callref_next = NULL;
+	}
+
+	unit->callref = callref;
+
+	if (unit->callref) {
+		hashp = &callref_hash[callref_hash_key(unit->callref)];
+		unit->callref_next = *hashp;
+		*hashp = unit;
+	}
 }
 
+static void snapshot_record(mpt1327_unit_t *unit);
+
 static void unit_timeout(void *data);
 
-static mpt1327_unit_t *get_unit(uint8_t prefix, uint16_t ident)
+static mpt1327_unit_t *search_unit(uint8_t prefix, uint16_t ident)
 {
-	mpt1327_unit_t **unitp;
+	mpt1327_unit_t *unit;
 
-	for (unitp = &unit_list; *unitp; unitp = &((*unitp)->next)) {
-		if ((*unitp)->prefix == prefix
-		 && (*unitp)->ident == ident)
+	unit = unit_hash[unit_hash_key(prefix, ident)];
+	while (unit) {
+		if (unit->prefix == prefix
+		 && unit->ident == ident)
 			break;
+		unit = unit->hash_next;
 	}
 
-	if (!(*unitp)) {
-		LOGP(DDB, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) added to database\n", prefix, ident);
-		*unitp = calloc(1, sizeof(mpt1327_unit_t));
-		osmo_timer_setup(&(*unitp)->timer, unit_timeout, (*unitp));
-		(*unitp)->state = UNIT_IDLE;
-		(*unitp)->prefix = prefix;
-		(*unitp)->ident = ident;
-	}
+	return unit;
+}
+
+static mpt1327_unit_t *get_unit(uint8_t prefix, uint16_t ident)
+{
+	mpt1327_unit_t *unit, **hashp;
+
+	unit = search_unit(prefix, ident);
+	if (unit)
+		return unit;
+
+	LOGP(DDB, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) added to database\n", prefix, ident);
+	unit = calloc(1, sizeof(mpt1327_unit_t));
+	wheel_timer_setup(&unit->timer, unit_timeout, unit);
+	unit->state = UNIT_IDLE;
+	unit->prefix = prefix;
+	unit->ident = ident;
 
-	return *unitp;
+	/* attach to end of list */
+	*unit_list_tail = unit;
+	unit_list_tail = &unit->next;
+
+	/* attach to hash */
+	hashp = &unit_hash[unit_hash_key(prefix, ident)];
+	unit->hash_next = *hashp;
+	*hashp = unit;
+
+	snapshot_record(unit);
+
+	return unit;
 }
 
-static mpt1327_unit_t *find_unit_state(uint32_t state, mpt1327_t *tc)
+/* return the unit that waits longest in one of the given states */
+static mpt1327_unit_t *find_unit_state(uint64_t state, mpt1327_t *tc)
 {
-	mpt1327_unit_t *unit;
+	mpt1327_unit_t *unit, *found = NULL;
+	int i;
 
-	for (unit = unit_list; unit; unit = unit->next) {
-		if (tc && unit->tc != tc)
-			continue;
-		if ((unit->state & state))
+	while (state) {
+		i = __builtin_ctzll(state);
+		state &= state - 1;
+		for (unit = unit_state_list[i].head; unit; unit = unit->state_next) {
+			if (tc && unit->tc != tc)
+				continue;
+			if (!found || (int32_t)(unit->state_seq - found->state_seq) < 0)
+				found = unit;
 			break;
+		}
 	}
 
-	return unit;
+	return found;
 }
 
 mpt1327_unit_t *find_unit_callref(uint32_t callref)
 {
 	mpt1327_unit_t *unit;
 
-	for (unit = unit_list; unit; unit = unit->next) {
-		if ((unit->callref & callref))
+	if (!callref)
+		return NULL;
+
+	unit = callref_hash[callref_hash_key(callref)];
+	while (unit) {
+		if (unit->callref == callref)
 			break;
+		unit = unit->callref_next;
 	}
 
 	return unit;
@@ -271,7 +403,7 @@ static void unit_timeout(void *data)
 		mpt1327_release(unit);
 		if (unit->callref) {
 			call_up_release(unit->callref, CAUSE_NORMAL);
-			unit->callref = 0;
+			unit_set_callref(unit, 0);
 		}
 		break;
 	case UNIT_CALLED_ACK:
@@ -285,7 +417,7 @@ static void unit_timeout(void *data)
 		mpt1327_release(unit);
 		if (unit->callref) {
 			call_up_release(unit->callref, CAUSE_NORMAL);
-			unit->callref = 0;
+			unit_set_callref(unit, 0);
 		}
 		break;
 	case UNIT_CALL:
@@ -293,7 +425,7 @@ static void unit_timeout(void *data)
 		mpt1327_release(unit);
 		if (unit->callref) {
 			call_up_release(unit->callref, CAUSE_NORMAL);
-			unit->callref = 0;
+			unit_set_callref(unit, 0);
 		}
 		break;
 	default:
@@ -303,16 +435,111 @@ static void unit_timeout(void *data)
 
 }
 
+/*
+ * snapshot file
+ *
+ * Every Radio Unit that is added to the database is appended as a line to the
+ * file, so the units are known after a restart. Units are never removed. An
+ * incomplete last line is ignored when loading. The file is rewritten after
+ * loading, so it does not grow with each run.
+ */
+
+static void snapshot_record(mpt1327_unit_t *unit)
+{
+	if (!snapshot_fp)
+		return;
+
+	fprintf(snapshot_fp, "%03d%04d\n", unit->prefix, unit->ident);
+	fflush(snapshot_fp);
+}
+
+static void snapshot_write(void)
+{
+	char tmp_file[256];
+	mpt1327_unit_t *unit;
+	FILE *fp;
+
+	snprintf(tmp_file, sizeof(tmp_file), "%s.tmp", snapshot_file);
+	fp = fopen(tmp_file, "w");
+	if (!fp) {
+		LOGP(DDB, LOGL_ERROR, "Failed to write Radio Unit snapshot '%s'.\n", tmp_file);
+		return;
+	}
+	snapshot_fp = fp;
+	for (unit = unit_list; unit; unit = unit->next)
+		snapshot_record(unit);
+	fsync(fileno(fp));
+	fclose(fp);
+	snapshot_fp = NULL;
+	if (rename(tmp_file, snapshot_file) < 0) {
+		LOGP(DDB, LOGL_ERROR, "Failed to rename Radio Unit snapshot '%s'.\n", tmp_file);
+		return;
+	}
+
+	snapshot_fp = fopen(snapshot_file, "a");
+	if (!snapshot_fp)
+		LOGP(DDB, LOGL_ERROR, "Failed to open Radio Unit snapshot '%s'.\n", snapshot_file);
+}
+
+/* load units from snapshot file and keep it for new units, return number of units loaded */
+int load_units(const char *filename)
+{
+	char line[256];
+	FILE *fp;
+	int prefix, ident;
+	int count = 0;
+
+	if (snapshot_fp) {
+		fclose(snapshot_fp);
+		snapshot_fp = NULL;
+	}
+	snapshot_file = filename;
+
+	fp = fopen(filename, "r");
+	if (fp) {
+		while (fgets(line, sizeof(line), fp)) {
+			/* skip incomplete line */
+			if (!strchr(line, '\n'))
+				break;
+			if (sscanf(line, "%3d%4d", &prefix, &ident) != 2
+			 || prefix < 0 || prefix > 127 || ident < 1 || ident > 8191)
+				continue;
+			if (!search_unit(prefix, ident))
+				count++;
+			get_unit(prefix, ident);
+		}
+		fclose(fp);
+		LOGP(DDB, LOGL_NOTICE, "Loaded %d Radio Unit(s) from '%s'.\n", count, filename);
+	}
+
+	/* write compact file and open it for appending */
+	snapshot_write();
+	if (!snapshot_fp)
+		return -EIO;
+
+	return count;
+}
+
 void flush_units(void)
 {
 	mpt1327_unit_t *next;
 
+	/* exit is not a deregistration, so the snapshot file keeps the units */
+	if (snapshot_fp) {
+		fclose(snapshot_fp);
+		snapshot_fp = NULL;
+	}
+
 	while (unit_list) {
 		next = unit_list->next;
-		osmo_timer_del(&unit_list->timer);
+		wheel_timer_del(&unit_list->timer);
 		free(unit_list);
 		unit_list = next;
 	}
+	unit_list_tail = &unit_list;
+	memset(unit_hash, 0, sizeof(unit_hash));
+	memset(callref_hash, 0, sizeof(callref_hash));
+	memset(unit_state_list, 0, sizeof(unit_state_list));
 }
 
 static void dump_units(void)
@@ -636,6 +863,7 @@ int mpt1327_create(enum mpt1327_band band, const char *kanal, enum mpt1327_chan_
 		LOGP(DMPT1327, LOGL_ERROR, "Failed to init 'Sender' processing!\n");
 		goto error;
 	}
+	mpt1327->sender.destroy = mpt1327_destroy;
 
 	/* init audio processing */
 	rc = dsp_init_sender(mpt1327, squelch_db);
@@ -746,7 +974,7 @@ static void mpt1327_go_idle(mpt1327_t *mpt1327)
 
 static void mpt1327_release(mpt1327_unit_t *unit)
 {
-	osmo_timer_del(&unit->timer);
+	wheel_timer_del(&unit->timer);
 
 	if (unit->state == UNIT_CALL && unit->tc) {
 		/* release all units on traffic channel */
@@ -915,7 +1143,7 @@ static int mpt1327_send_codeword_control(mpt1327_t *mpt1327, mpt1327_codeword_t
 				mpt1327->rx_sched.data_prefix = unit->prefix;
 				mpt1327->rx_sched.data_ident = unit->ident;
 				LOGP_CHAN(DMPT1327, LOGL_DEBUG, "Starting timer, waiting for response\n");
-				osmo_timer_schedule(&unit->timer, RESPONSE_TIMEOUT);
+				wheel_timer_schedule(&unit->timer, RESPONSE_TIMEOUT);
 				LOGP_CHAN(DMPT1327, LOGL_INFO, "Sending AHYC, to request SAMIS from Radio Unit (Prefix:%d Ident:%d)\n", unit->prefix, unit->ident);
 				break;
 			case UNIT_CALLED_AHY: /* call to unit and request ACK from unit */
@@ -930,7 +1158,7 @@ static int mpt1327_send_codeword_control(mpt1327_t *mpt1327, mpt1327_codeword_t
 				codeword->params[MPT_AD] = 0; /* no appended data */
 				unit_new_state(unit, UNIT_CALLED_ACK);
 				LOGP_CHAN(DMPT1327, LOGL_DEBUG, "Starting timer, waiting for response\n");
-				osmo_timer_schedule(&unit->timer, RESPONSE_TIMEOUT);
+				wheel_timer_schedule(&unit->timer, RESPONSE_TIMEOUT);
 				LOGP_CHAN(DMPT1327, LOGL_INFO, "Sending AHY, to request ACK from Radio Unit (Prefix:%d Ident:%d)\n", unit->prefix, unit->ident);
 				break;
 			case UNIT_GTC_P: /* channel assignment to unit itself and called unit */
@@ -947,7 +1175,7 @@ static int mpt1327_send_codeword_control(mpt1327_t *mpt1327, mpt1327_codeword_t
 				unit_new_state(unit, UNIT_CALL);
 				mpt1327_set_dsp_mode(unit->tc, DSP_MODE_TRAFFIC, 1);
 				if (sysdef.timeout)
-					osmo_timer_schedule(&unit->timer, sysdef.timeout,0);
+					wheel_timer_schedule(&unit->timer, sysdef.timeout,0);
 				break;
 			case UNIT_GTC_B: /* channel assignment to called unit */
 				/* NOTE GTC to called unit must be sent before GTC to calling unit (1.3.5.3) */
@@ -978,7 +1206,7 @@ static int mpt1327_send_codeword_control(mpt1327_t *mpt1327, mpt1327_codeword_t
 				unit_new_state(unit, UNIT_CALL);
 				mpt1327_set_dsp_mode(unit->tc, DSP_MODE_TRAFFIC, 1);
 				if (sysdef.timeout)
-					osmo_timer_schedule(&unit->timer, sysdef.timeout,0);
+					wheel_timer_schedule(&unit->timer, sysdef.timeout,0);
 				break;
 			case UNIT_CANCEL_ACK:
 				codeword->type = MPT_ACK;
@@ -1122,17 +1350,17 @@ static void out_setup(mpt1327_unit_t *unit, uint8_t network_type, int network_id
 		sprintf(id, "%d", network_id);
 	else
 		id[0] = '\0';
-	unit->callref = call_up_setup(caller_id, unit->called_number, network_type, id);
+	unit_set_callref(unit, call_up_setup(caller_id, unit->called_number, network_type, id));
 }
 
 static void _cancel_pending_call(mpt1327_t *mpt1327, mpt1327_unit_t *unit)
 {
 	LOGP_CHAN(DMPT1327, LOGL_INFO, "We are already in a call, the phone might have restarted, so we free old channel first.\n");
 	mpt1327_go_idle(unit->tc);
-	osmo_timer_del(&unit->timer);
+	wheel_timer_del(&unit->timer);
 	if (unit->callref) {
 		call_up_release(unit->callref, CAUSE_NORMAL);
-		unit->callref = 0;
+		unit_set_callref(unit, 0);
 	}
 }
 
@@ -1276,7 +1504,7 @@ static void mpt1327_receive_codeword_control(mpt1327_t *mpt1327, mpt1327_codewor
 			mpt1327->rx_sched.data_count = 0;
 			mpt1327->rx_sched.data_word = MPT_SAMIS_DT;
 			if (mpt1327->rx_sched.data_num == 0) {
-				osmo_timer_del(&unit->timer);
+				wheel_timer_del(&unit->timer);
 				LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) calls Number %s\n", unit->prefix, unit->ident, unit->called_number);
 				out_setup(unit, OSMO_CC_NETWORK_MPT1327_PSTN, 0);
 				unit_new_state(unit, UNIT_GTC_A);
@@ -1300,7 +1528,7 @@ static void mpt1327_receive_codeword_control(mpt1327_t *mpt1327, mpt1327_codewor
 			unit->called_number[9] = mpt1327_bcd[(codeword->params[MPT_PARAMETERS2] >> 0) & 0xf];
 			unit->called_number[10] = '\0';
 			LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) calls Number %s\n", unit->prefix, unit->ident, unit->called_number);
-			osmo_timer_del(&unit->timer);
+			wheel_timer_del(&unit->timer);
 			out_setup(unit, OSMO_CC_NETWORK_MPT1327_PBX, 0);
 			unit_new_state(unit, UNIT_GTC_A);
 			unit->repeat = REPEAT_GTC;
@@ -1330,7 +1558,7 @@ static void mpt1327_receive_codeword_control(mpt1327_t *mpt1327, mpt1327_codewor
 			unit->called_number[20] = mpt1327_bcd[(codeword->params[MPT_BCD11] >> 0) & 0xf];
 			unit->called_number[21] = '\0';
 			if (mpt1327->rx_sched.data_num == 1) {
-				osmo_timer_del(&unit->timer);
+				wheel_timer_del(&unit->timer);
 				LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) calls Number %s\n", unit->prefix, unit->ident, unit->called_number);
 				out_setup(unit, OSMO_CC_NETWORK_MPT1327_PSTN, 0);
 				unit_new_state(unit, UNIT_GTC_A);
@@ -1350,7 +1578,7 @@ static void mpt1327_receive_codeword_control(mpt1327_t *mpt1327, mpt1327_codewor
 			unit->called_number[31] = mpt1327_bcd[(codeword->params[MPT_BCD11] >> 0) & 0xf];
 			unit->called_number[32] = '\0';
 			mpt1327->rx_sched.data_num = 0; /* just in case it is more than 2 data words */
-			osmo_timer_del(&unit->timer);
+			wheel_timer_del(&unit->timer);
 			LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) calls Number %s\n", unit->prefix, unit->ident, unit->called_number);
 			out_setup(unit, OSMO_CC_NETWORK_MPT1327_PSTN, 0);
 			unit_new_state(unit, UNIT_GTC_A);
@@ -1360,7 +1588,7 @@ static void mpt1327_receive_codeword_control(mpt1327_t *mpt1327, mpt1327_codewor
 	case MPT_RQX: /* call cancel */
 		unit = get_unit(codeword->params[MPT_PFIX], codeword->params[MPT_IDENT2]);
 		unit->called_ident = codeword->params[MPT_IDENT1];
-		osmo_timer_del(&unit->timer);
+		wheel_timer_del(&unit->timer);
 		LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) cancels call to %d\n", unit->prefix, unit->ident, unit->called_ident);
 		unit_new_state(unit, UNIT_CANCEL_ACK);
 		if (unit->tc) {
@@ -1370,7 +1598,7 @@ static void mpt1327_receive_codeword_control(mpt1327_t *mpt1327, mpt1327_codewor
 		break;
 	case MPT_ACKI: /* ack from unit (not ready, wait for RQQ) */
 		unit = get_unit(codeword->params[MPT_PFIX], codeword->params[MPT_IDENT1]);
-		osmo_timer_del(&unit->timer);
+		wheel_timer_del(&unit->timer);
 		if (unit->state == UNIT_CALLED_ACK) {
 			LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) acknowledges call (not yet ready, waiting for RQQ\n", unit->prefix, unit->ident);
 			if (unit->callref)
@@ -1381,7 +1609,7 @@ static void mpt1327_receive_codeword_control(mpt1327_t *mpt1327, mpt1327_codewor
 		break;
 	case MPT_ACK: /* ack from unit */
 		unit = get_unit(codeword->params[MPT_PFIX], codeword->params[MPT_IDENT1]);
-		osmo_timer_del(&unit->timer);
+		wheel_timer_del(&unit->timer);
 		if (unit->state == UNIT_CALLED_ACK) {
 			LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) acknowledges call\n", unit->prefix, unit->ident);
 answer:
@@ -1398,7 +1626,7 @@ answer:
 		break;
 	case MPT_RQQ: /* status from radio */
 		unit = get_unit(codeword->params[MPT_PFIX], codeword->params[MPT_IDENT2]);
-		osmo_timer_del(&unit->timer);
+		wheel_timer_del(&unit->timer);
 		LOGP_CHAN(DMPT1327, LOGL_ERROR, "Radio Unit (Prefix:%d Ident:%d) sends RRQ with STATUS=%d\n", unit->prefix, unit->ident, (int)codeword->params[MPT_STATUS]);
 		switch (codeword->params[MPT_STATUS]) {
 		case 0x00:
@@ -1414,7 +1642,7 @@ answer:
 			mpt1327_release(unit);
 			if (unit->callref) {
 				call_up_release(unit->callref, CAUSE_NORMAL);
-				unit->callref = 0;
+				unit_set_callref(unit, 0);
 			}
 			break;
 		}
@@ -1456,13 +1684,13 @@ static void mpt1327_receive_codeword_traffic(mpt1327_t *mpt1327, mpt1327_codewor
 		switch (codeword->params[MPT_OPER]) {
 		case OPER_PRESSEL_ON:
 			if (sysdef.timeout)
-				osmo_timer_schedule(&unit->timer, sysdef.timeout,0);
+				wheel_timer_schedule(&unit->timer, sysdef.timeout,0);
 			mpt1327->pressel_on = 1;
 			LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) starts transmission\n", unit->prefix, unit->ident);
 			break;
 		case OPER_PRESSEL_OFF:
 			if (sysdef.timeout)
-				osmo_timer_schedule(&unit->timer, sysdef.timeout,0);
+				wheel_timer_schedule(&unit->timer, sysdef.timeout,0);
 			mpt1327->pressel_on = 0;
 			LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) stops transmission\n", unit->prefix, unit->ident);
 			break;
@@ -1472,19 +1700,19 @@ static void mpt1327_receive_codeword_traffic(mpt1327_t *mpt1327, mpt1327_codewor
 				return;
 			LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) disconnects from channel\n", unit->prefix, unit->ident);
 			if (unit->state == UNIT_CALL) {
-				osmo_timer_del(&unit->timer);
+				wheel_timer_del(&unit->timer);
 				LOGP_CHAN(DMPT1327, LOGL_INFO, "Free Traffic Channel %s, because the initiator goes on-hook\n", unit->tc->sender.kanal);
 				mpt1327_go_idle(unit->tc);
 				if (unit->callref) {
 					call_up_release(unit->callref, CAUSE_NORMAL);
-					unit->callref = 0;
+					unit_set_callref(unit, 0);
 				}
 			}
 			unit_new_state(unit, UNIT_IDLE);
 			break;
 		case OPER_PERIODIC:
 			if (sysdef.timeout)
-				osmo_timer_schedule(&unit->timer, sysdef.timeout,0);
+				wheel_timer_schedule(&unit->timer, sysdef.timeout,0);
 			mpt1327->pressel_on = 1;
 			LOGP_CHAN(DMPT1327, LOGL_INFO, "Radio Unit (Prefix:%d Ident:%d) sends periodic message\n", unit->prefix, unit->ident);
 			break;
@@ -1511,6 +1739,8 @@ void mpt1327_receive_codeword(mpt1327_t *mpt1327, uint64_t bits, double quality,
 		return;
 	}
 
+	replay_event(mpt1327->sender.kanal, "codeword 0x%016" PRIx64, bits);
+
 	/* count if we have data words */
 	if (mpt1327->rx_sched.data_num)
 		mpt1327->rx_sched.data_count++;
@@ -1540,7 +1770,7 @@ void mpt1327_signal_indication(mpt1327_t *mpt1327)
 	/* restart timer, if enabled */
 	if (mpt1327->unit && mpt1327->unit->state == UNIT_CALL) {
 		if (sysdef.timeout)
-			osmo_timer_schedule(&mpt1327->unit->timer, sysdef.timeout,0);
+			wheel_timer_schedule(&mpt1327->unit->timer, sysdef.timeout,0);
 	}
 }
 
@@ -1588,7 +1818,7 @@ int call_down_setup(int callref, const char __attribute__((unused)) *caller_id,
 	LOGP(DMPT1327, LOGL_INFO, "Outgoing call to Radio Unit (Prefix:%d Ident:%d)\n", unit->prefix, unit->ident);
 
 	/* 4. trying to reach radio unit */
-	unit->callref = callref;
+	unit_set_callref(unit, callref);
 	mpt1327_new_state(tc, STATE_BUSY, unit);
 	unit_new_state(unit, UNIT_CALLED_AHY);
 	unit->repeat = REPEAT_AHY;
@@ -1624,7 +1854,7 @@ void call_down_disconnect(int callref, int cause)
 		return;
 	LOGP(DMPT1327, LOGL_NOTICE, "Outgoing disconnect, but no call, releasing!\n");
 	mpt1327_release(unit);
-	unit->callref = 0;
+	unit_set_callref(unit, 0);
 
 	call_up_release(callref, cause);
 }
@@ -1645,7 +1875,7 @@ void call_down_release(int callref, __attribute__((unused)) int cause)
 
 	LOGP(DMPT1327, LOGL_NOTICE, "Outgoing release, releasing!\n");
 	mpt1327_release(unit);
-	unit->callref = 0;
+	unit_set_callref(unit, 0);
 }
 
 void dump_info(void)
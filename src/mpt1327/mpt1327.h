@@ -82,9 +82,14 @@ struct mpt1327;
 
 typedef struct mpt1327_unit {
 	struct mpt1327_unit	*next;
+	struct mpt1327_unit	*hash_next;		/* chain of hash by prefix and ident */
+	struct mpt1327_unit	*callref_next;		/* chain of hash by callref */
+	struct mpt1327_unit	*state_next;		/* list of units in same state */
+	struct mpt1327_unit	**state_pprev;
+	uint32_t		state_seq;		/* order of entering the state */
 	uint64_t		state;
 	int			repeat;			/* number of repeating messages / retries after timeout */
-	struct osmo_timer_list		timer;			/* timeout waiting for unit response */
+	wheel_timer_t		timer;			/* timeout waiting for unit response */
 	struct mpt1327		*tc;			/* link to transceiver */
 	uint8_t			prefix;			/* unit's prefix */
 	uint16_t		ident;			/* unit's ident */
@@ -139,6 +144,7 @@ typedef struct mpt1327 {
 } mpt1327_t;
 
 void init_sysdef (uint16_t sys, int wt, int per, int pon, int timeout);
+int load_units(const char *filename);
 void flush_units(void);
 double mpt1327_channel2freq(enum mpt1327_band band, int channel, int uplink);
 const char *mpt1327_number_valid(const char *number);
@@ -1,7161 +1,31 @@
+/* NMT announcement from asset pack
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
 #include <stdint.h>
+#include "../libmobile/asset.h"
 #include "announcement.h"
 
-static int16_t pattern[] = {
-	0x0007, 0x0008, 0x0008, 0x0009, 0x0006, 0x000b, 0x0004, 0x000a,
-	0x0008, 0x0006, 0x000a, 0x0005, 0x0007, 0x0009, 0x0006, 0x0009,
-	0x0006, 0x0008, 0x000a, 0x0005, 0x000b, 0x0004, 0x0009, 0x000a,
-	0x0004, 0x000a, 0x0005, 0x000a, 0x0006, 0x0009, 0x0007, 0x0008,
-	0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0006, 0x0006, 0x000a,
-	0x0005, 0x000a, 0x0006, 0x0008, 0x0007, 0x0009, 0x0006, 0x0008,
-	0x0007, 0x0009, 0x0006, 0x000b, 0x0005, 0x0009, 0x0008, 0x0008,
-	0x0007, 0x0009, 0x0005, 0x000b, 0x0005, 0x0008, 0x0007, 0x0007,
-	0x0008, 0x0007, 0x0008, 0x0007, 0x0009, 0x0005, 0x000b, 0x0006,
-	0x0009, 0x0007, 0x0006, 0x0008, 0x0008, 0x0008, 0x0007, 0x0006,
-	0x0009, 0x0006, 0x0009, 0x0007, 0x0007, 0x0009, 0x0007, 0x0008,
-	0x0008, 0x0007, 0x0008, 0x0007, 0x0008, 0x0008, 0x0006, 0x0009,
-	0x0006, 0x000a, 0x0006, 0x0008, 0x0008, 0x0007, 0x0009, 0x0006,
-	0x000a, 0x0005, 0x000b, 0x0005, 0x000a, 0x0005, 0x0009, 0x0006,
-	0x0009, 0x0006, 0x0008, 0x0008, 0x0006, 0x0009, 0x0006, 0x0009,
-	0x0009, 0x0003, 0x000d, 0x0001, 0x000d, 0x0004, 0x0008, 0x0009,
-	0x0006, 0x0009, 0x0007, 0x0007, 0x000a, 0x0005, 0x0008, 0x0008,
-	0x0006, 0x000a, 0x0005, 0x0009, 0x0007, 0x0008, 0x0008, 0x0006,
-	0x000b, 0x0003, 0x000e, 0x0002, 0x000b, 0x0006, 0x0008, 0x0008,
-	0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0007, 0x0008,
-	0x0008, 0x0008, 0x0007, 0x0007, 0x0008, 0x0008, 0x0007, 0x0009,
-	0x0006, 0x0009, 0x0007, 0x0008, 0x0009, 0x0006, 0x0009, 0x0007,
-	0x0007, 0x000a, 0x0006, 0x0008, 0x0009, 0x0005, 0x0009, 0x0008,
-	0x0006, 0x0009, 0x0006, 0x0009, 0x0008, 0x0007, 0x0008, 0x0007,
-	0x0009, 0x0008, 0x0007, 0x0009, 0x0006, 0x0009, 0x0008, 0x0006,
-	0x000c, 0x0003, 0x000c, 0x0004, 0x000b, 0x0004, 0x000c, 0x0004,
-	0x000a, 0x0005, 0x000a, 0x0007, 0x0008, 0x0008, 0x0008, 0x0007,
-	0x0009, 0x0008, 0x0007, 0x000a, 0x0003, 0x000d, 0x0003, 0x000c,
-	0x0005, 0x000b, 0x0005, 0x000b, 0x0005, 0x000b, 0x0005, 0x000a,
-	0x0006, 0x0009, 0x0008, 0x0006, 0x0009, 0x0006, 0x0009, 0x0007,
-	0x0008, 0x0008, 0x0008, 0x0007, 0x000a, 0x0004, 0x000b, 0x0004,
-	0x000a, 0x0008, 0x0006, 0x000a, 0x0006, 0x0009, 0x0008, 0x0008,
-	0x0007, 0x0009, 0x0006, 0x0009, 0x0008, 0x0007, 0x0008, 0x0009,
-	0x0007, 0x000a, 0x0006, 0x0009, 0x0007, 0x0008, 0x0007, 0x0009,
-	0x0006, 0x0009, 0x0006, 0x0009, 0x0006, 0x0009, 0x0006, 0x0008,
-	0x0007, 0x0006, 0x0009, 0x0006, 0x0007, 0x0009, 0x0007, 0x0009,
-	0x0005, 0x000a, 0x0003, 0x000b, 0x0004, 0x000a, 0x0006, 0x0007,
-	0x0009, 0x0005, 0x000b, 0x0005, 0x0008, 0x0009, 0x0005, 0x000a,
-	0x0006, 0x0009, 0x0008, 0x0007, 0x0008, 0x0008, 0x0008, 0x0007,
-	0x0008, 0x0007, 0x0009, 0x0005, 0x000b, 0x0005, 0x000d, 0x0003,
-	0x000c, 0x0004, 0x000a, 0x0007, 0x0007, 0x0008, 0x0008, 0x0007,
-	0x0007, 0x0008, 0x0008, 0x0008, 0x0007, 0x0008, 0x0007, 0x000a,
-	0x0005, 0x000c, 0x0004, 0x000b, 0x0007, 0x0007, 0x0009, 0x0006,
-	0x000a, 0x0006, 0x0009, 0x0007, 0x0009, 0x0008, 0x0007, 0x000a,
-	0x0006, 0x0009, 0x0007, 0x0007, 0x000a, 0x0006, 0x000a, 0x0007,
-	0x0007, 0x0009, 0x0008, 0x0008, 0x0008, 0x0009, 0x0008, 0x0007,
-	0x0009, 0x0007, 0x0009, 0x0008, 0x0009, 0x0007, 0x0009, 0x0008,
-	0x0007, 0x0008, 0x000a, 0x0006, 0x000a, 0x0006, 0x0009, 0x0007,
-	0x000a, 0x0005, 0x000a, 0x0007, 0x0008, 0x0009, 0x0006, 0x0008,
-	0x0009, 0x0006, 0x0009, 0x0006, 0x0009, 0x0007, 0x0008, 0x0007,
-	0x0008, 0x0007, 0x0008, 0x0008, 0x0007, 0x0008, 0x0005, 0x000a,
-	0x0004, 0x000a, 0x0005, 0x000a, 0x0004, 0x000b, 0x0003, 0x000b,
-	0x0005, 0x0009, 0x0006, 0x0008, 0x0007, 0x0007, 0x0009, 0x0005,
-	0x000a, 0x0005, 0x000a, 0x0006, 0x0009, 0x0006, 0x000a, 0x0005,
-	0x000a, 0x0004, 0x000a, 0x0007, 0x0006, 0x0009, 0x0007, 0x0007,
-	0x000a, 0x0004, 0x000a, 0x0006, 0x0008, 0x0006, 0x0009, 0x0006,
-	0x0007, 0x0007, 0x0007, 0x0009, 0x0007, 0x0007, 0x0006, 0x000a,
-	0x0005, 0x000b, 0x0003, 0x000a, 0x0007, 0x0007, 0x0009, 0x0005,
-	0x0009, 0x0007, 0x0009, 0x0007, 0x0008, 0x0006, 0x0009, 0x0007,
-	0x0008, 0x0008, 0x0006, 0x000a, 0x0005, 0x000a, 0x0004, 0x000a,
-	0x0005, 0x000a, 0x0005, 0x000b, 0x0003, 0x000b, 0x0005, 0x000a,
-	0x0005, 0x0008, 0x0007, 0x0008, 0x0007, 0x0007, 0x0008, 0x0006,
-	0x0009, 0x0006, 0x0007, 0x0009, 0x0006, 0x0007, 0x0009, 0x0004,
-	0x000b, 0x0003, 0x000b, 0x0004, 0x000a, 0x0005, 0x0009, 0x0006,
-	0x0007, 0x0008, 0x0006, 0x0008, 0x0008, 0x0006, 0x0008, 0x0007,
-	0x0006, 0x0009, 0x0007, 0x0008, 0x0006, 0x0009, 0x0007, 0x0008,
-	0x0008, 0x0006, 0x0009, 0x0006, 0x000a, 0x0005, 0x0009, 0x0007,
-	0x0008, 0x0008, 0x0007, 0x0009, 0x0006, 0x0009, 0x0007, 0x0007,
-	0x0009, 0x0008, 0x0007, 0x0009, 0x0007, 0x0007, 0x0009, 0x0006,
-	0x000a, 0x0006, 0x000a, 0x0004, 0x000c, 0x0003, 0x000a, 0x0007,
-	0x0007, 0x000a, 0x0006, 0x0008, 0x0008, 0x0007, 0x0009, 0x0006,
-	0x000a, 0x0005, 0x000a, 0x0006, 0x0008, 0x0008, 0x0007, 0x0009,
-	0x0005, 0x000b, 0x0004, 0x000b, 0x0006, 0x0008, 0x0008, 0x0007,
-	0x0007, 0x0009, 0x0006, 0x0008, 0x0009, 0x0005, 0x000a, 0x0005,
-	0x000b, 0x0004, 0x000b, 0x0004, 0x000b, 0x0005, 0x000a, 0x0005,
-	0x000a, 0x0005, 0x000a, 0x0004, 0x000a, 0x0005, 0x0008, 0x0007,
-	0x0009, 0x0006, 0x000a, 0x0004, 0x000c, 0x0002, 0x000d, 0x0004,
-	0x000a, 0x0005, 0x000a, 0x0005, 0x0009, 0x0006, 0x0007, 0x0008,
-	0x0008, 0x0006, 0x0009, 0x0007, 0x0007, 0x0007, 0x0008, 0x0006,
-	0x0008, 0x0009, 0x0004, 0x0009, 0x0005, 0x0009, 0x0006, 0x0009,
-	0x0006, 0x0009, 0x0006, 0x0009, 0x0006, 0x000a, 0x0005, 0x000a,
-	0x0006, 0x0008, 0x0006, 0x0008, 0x0007, 0x0007, 0x0007, 0x0007,
-	0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0006, 0x0009,
-	0x0005, 0x0009, 0x0006, 0x0007, 0x0008, 0x0006, 0x0009, 0x0004,
-	0x0009, 0x0007, 0x0008, 0x0006, 0x0008, 0x0007, 0x0007, 0x0008,
-	0x0007, 0x0008, 0x0007, 0x0007, 0x0008, 0x0007, 0x0008, 0x0006,
-	0x0008, 0x0007, 0x0005, 0x000a, 0x0003, 0x000a, 0x0005, 0x0008,
-	0x0007, 0x0007, 0x0006, 0x0009, 0x0005, 0x000b, 0x0004, 0x000b,
-	0x0005, 0x000a, 0x0007, 0x0007, 0x0007, 0x0009, 0x0005, 0x0009,
-	0x0005, 0x0007, 0x0007, 0x0005, 0x0008, 0x0005, 0x0008, 0x0006,
-	0x0009, 0x0007, 0x0007, 0x0009, 0x0007, 0x000c, 0x0005, 0x0009,
-	0x0007, 0x0007, 0x0007, 0x0008, 0x0004, 0x0009, 0x0005, 0x0007,
-	0x0006, 0x0006, 0x0008, 0x0004, 0x000a, 0x0003, 0x000c, 0x0003,
-	0x000c, 0x0003, 0x000b, 0x0004, 0x000a, 0x0007, 0x0008, 0x0008,
-	0x0006, 0x0009, 0x0007, 0x0008, 0x0006, 0x0006, 0x0007, 0x0005,
-	0x0009, 0x0003, 0x000b, 0x0002, 0x000c, 0x0006, 0x0008, 0x0009,
-	0x0005, 0x0009, 0x0006, 0x0007, 0x0006, 0x000a, 0x0003, 0x000c,
-	0x0001, 0x000a, 0x0006, 0x0009, 0x0005, 0x000a, 0x0007, 0x0008,
-	0x0009, 0x0002, 0x0007, 0x0004, 0x0002, 0x0008, 0x0005, 0x0007,
-	0x0007, 0x0006, 0x0008, 0x0006, 0x0008, 0x0008, 0x0009, 0x0009,
-	0x000a, 0x0007, 0x0009, 0x0007, 0x0009, 0x000b, 0x0008, 0x000a,
-	0x0008, 0x0006, 0x0008, 0x0008, 0x0008, 0x0009, 0x0007, 0x0009,
-	0x0007, 0x000a, 0x0005, 0x0008, 0x0006, 0x0008, 0x0005, 0x0008,
-	0x0007, 0x0008, 0x0009, 0x0004, 0x0007, 0x0008, 0x0007, 0x0008,
-	0x0006, 0x0006, 0x0005, 0x0006, 0x0005, 0x0007, 0x0008, 0x0008,
-	0x0008, 0x0006, 0x0007, 0x0009, 0x000a, 0x0004, 0x000b, 0x0007,
-	0x000a, 0x0007, 0x0009, 0x000b, 0x0004, 0x0008, 0x0007, 0x0006,
-	0x0006, 0x0008, 0x000a, 0x0009, 0x000a, 0x000b, 0x000b, 0x000b,
-	0x000d, 0x0008, 0x000c, 0x0008, 0x000c, 0x0005, 0x000e, 0x0005,
-	0x0009, 0x000d, 0x0006, 0x000c, 0x0009, 0x0008, 0x0009, 0x0007,
-	0x000a, 0x0006, 0x000d, 0xffc1, 0xff60, 0xff78, 0xff7b, 0xff70,
-	0xff79, 0xff71, 0xff75, 0xff7b, 0xff79, 0xff72, 0xff71, 0xff73,
-	0xff73, 0xff73, 0xff6f, 0xff70, 0xff72, 0xff72, 0xff72, 0xff78,
-	0xff85, 0xff83, 0xff7f, 0xff85, 0xff87, 0xff95, 0xff8f, 0xff8f,
-	0xff8e, 0xff8a, 0xff8e, 0xff8a, 0xff8d, 0xff88, 0xff86, 0xff8e,
-	0xff8d, 0xff87, 0xff87, 0xff82, 0xff80, 0xff86, 0xff80, 0xff84,
-	0xff7a, 0xff7c, 0xff7c, 0xff6f, 0xff73, 0xff7a, 0xff81, 0xff86,
-	0xff7f, 0xff84, 0xff80, 0xff83, 0xff83, 0xff86, 0xff8f, 0xff8a,
-	0xff90, 0xff8b, 0xff8e, 0xff8a, 0xff8a, 0xff8d, 0xff75, 0xff7f,
-	0xff7b, 0xff8a, 0xff85, 0xff81, 0xff85, 0xff81, 0xff83, 0xff83,
-	0xff84, 0xff87, 0xff8f, 0xff8b, 0xff98, 0xff94, 0xff89, 0xff8d,
-	0xff94, 0xffa0, 0xff9d, 0xff9d, 0xff9d, 0xff9c, 0xff9e, 0xffa0,
-	0xffb0, 0xffaa, 0xffae, 0xffb6, 0xffb8, 0xffa3, 0xff9c, 0xff92,
-	0xff93, 0xff9d, 0xff9a, 0xffa1, 0xff99, 0xffa0, 0xff99, 0xff9d,
-	0xff9e, 0xff9e, 0xff9e, 0xffa0, 0xff9a, 0xff9b, 0xff9e, 0xff9d,
-	0xffa0, 0xff92, 0xff93, 0xff8a, 0xff9c, 0xff9d, 0xff9f, 0xffa1,
-	0xff9c, 0xff9e, 0xff9e, 0xff98, 0xff8d, 0xff8e, 0xff8e, 0xff8c,
-	0xff95, 0xff84, 0xff88, 0xff91, 0xff85, 0xff81, 0xff83, 0xff81,
-	0xff86, 0xff80, 0xff81, 0xff80, 0xff81, 0xff80, 0xff7f, 0xff7f,
-	0xff81, 0xff84, 0xff7a, 0xff6c, 0xff75, 0xff6f, 0xff76, 0xff6f,
-	0xff77, 0xff71, 0xff73, 0xff74, 0xff6f, 0xff73, 0xff6f, 0xff74,
-	0xff6d, 0xff60, 0xff68, 0xff72, 0xff70, 0xff71, 0xff70, 0xff76,
-	0xff6a, 0xff66, 0xff62, 0xff66, 0xff60, 0xff6d, 0xff76, 0xff7a,
-	0xff8a, 0xff81, 0xff89, 0xff7d, 0xff85, 0xff80, 0xff82, 0xff7f,
-	0xff89, 0xff90, 0xff8e, 0xff92, 0xff8c, 0xff94, 0xff8b, 0xff91,
-	0xff89, 0xff81, 0xff84, 0xff83, 0xff83, 0xff83, 0xff84, 0xff82,
-	0xff7b, 0xff7b, 0xff88, 0xff80, 0xff88, 0xff7c, 0xff71, 0xff75,
-	0xff70, 0xff7c, 0xff82, 0xff82, 0xff84, 0xff81, 0xff87, 0xff91,
-	0xff88, 0xff9a, 0xff99, 0xff87, 0xff93, 0xff83, 0xff87, 0xff82,
-	0xff83, 0xff83, 0xff88, 0xff90, 0xff85, 0xff88, 0xff91, 0xff89,
-	0xff8f, 0xff8b, 0xff95, 0xffa2, 0xff97, 0xff9d, 0xff97, 0xff97,
-	0xff91, 0xff9e, 0xff9b, 0xff9e, 0xff9c, 0xff9b, 0xff9c, 0xff9a,
-	0xffa3, 0xffb8, 0xffb6, 0xffb0, 0xffc0, 0xffb5, 0xffbf, 0xffb5,
-	0xffad, 0xffae, 0xffab, 0xffa9, 0xff99, 0xff9c, 0xff9c, 0xff9b,
-	0xff9e, 0xff9b, 0xff95, 0xff8a, 0xff8e, 0xff90, 0xff8d, 0xff90,
-	0xff8c, 0xff93, 0xff8e, 0xff8f, 0xff8e, 0xff8f, 0xff8f, 0xff90,
-	0xff8e, 0xff90, 0xff8a, 0xff8f, 0xff89, 0xff81, 0xff84, 0xff80,
-	0xff91, 0xff82, 0xff87, 0xff80, 0xff8c, 0xff7d, 0xff88, 0xff77,
-	0xff7c, 0xff82, 0xff79, 0xff74, 0xff72, 0xff74, 0xff83, 0xff80,
-	0xff88, 0xff7a, 0xff75, 0xff73, 0xff79, 0xff6f, 0xff76, 0xff6f,
-	0xff77, 0xff71, 0xff72, 0xff76, 0xff70, 0xff5d, 0xff52, 0xff56,
-	0xff54, 0xff5b, 0xff6a, 0xff60, 0xff69, 0xff60, 0xff65, 0xff66,
-	0xff76, 0xff6c, 0xff77, 0xff73, 0xff72, 0xff76, 0xff7a, 0xff87,
-	0xff82, 0xff86, 0xff84, 0xff86, 0xff81, 0xff89, 0xff8e, 0xff8d,
-	0xff94, 0xff8d, 0xff91, 0xff8e, 0xff90, 0xff8d, 0xff81, 0xff81,
-	0xff85, 0xff7e, 0xff8a, 0xff8a, 0xff80, 0xff85, 0xff83, 0xff84,
-	0xff7e, 0xff6d, 0xff7a, 0xff84, 0xff7f, 0xff83, 0xff81, 0xff7f,
-	0xff87, 0xff83, 0xff81, 0xff86, 0xff8e, 0xff8c, 0xff8f, 0xff8f,
-	0xff8f, 0xff8b, 0xff89, 0xff8b, 0xff8c, 0xff7f, 0xff7d, 0xff70,
-	0xff7d, 0xff80, 0xff85, 0xff85, 0xff93, 0xff82, 0xff80, 0xff80,
-	0xff7e, 0xff89, 0xff8d, 0xff8b, 0xff93, 0xff8b, 0xff95, 0xff99,
-	0xff90, 0xffa4, 0xff9b, 0xffa2, 0xff9e, 0xff9b, 0xff9a, 0xff9b,
-	0xffa3, 0xffb0, 0xffa9, 0xffb5, 0xffbc, 0xffbb, 0xffb1, 0xffa8,
-	0xffa9, 0xffad, 0xffa3, 0xff9b, 0xff9f, 0xff9d, 0xff9d, 0xff9f,
-	0xff91, 0xff94, 0xff9c, 0xff87, 0xff91, 0xff7f, 0xff82, 0xff81,
-	0xff7d, 0xff85, 0xff80, 0xff83, 0xff7f, 0xff89, 0xff8f, 0xff88,
-	0xff9a, 0xff9f, 0xff98, 0xff8b, 0xff91, 0xff8f, 0xff91, 0xff8d,
-	0xff90, 0xff91, 0xff8b, 0xff94, 0xff88, 0xff81, 0xff8b, 0xff91,
-	0xff93, 0xff8b, 0xff83, 0xff85, 0xff82, 0xff86, 0xff95, 0xff8d,
-	0xff8c, 0xff80, 0xff83, 0xff7c, 0xff72, 0xff7d, 0xff7d, 0xff72,
-	0xff74, 0xff73, 0xff72, 0xff73, 0xff70, 0xff74, 0xff6a, 0xff69,
-	0xff74, 0xff74, 0xff69, 0xff67, 0xff73, 0xff75, 0xff75, 0xff73,
-	0xff6d, 0xff62, 0xff69, 0xff60, 0xff68, 0xff6b, 0xff76, 0xff73,
-	0xff6c, 0xff7c, 0xff86, 0xff85, 0xff8c, 0xff88, 0xff81, 0xff85,
-	0xff84, 0xff83, 0xff83, 0xff85, 0xff84, 0xff8c, 0xff93, 0xff8b,
-	0xff96, 0xff81, 0xff8f, 0xff87, 0xff83, 0xff83, 0xff7f, 0xff7c,
-	0xff6d, 0xff77, 0xff72, 0xff80, 0xff82, 0xff85, 0xff81, 0xff87,
-	0xff85, 0xff7c, 0xff77, 0xff87, 0xff80, 0xff86, 0xff83, 0xff84,
-	0xff8e, 0xff95, 0xff88, 0xff8a, 0xff90, 0xff85, 0xff6e, 0xff65,
-	0xff6a, 0xff78, 0xff7c, 0xff86, 0xff83, 0xff88, 0xff81, 0xff8a,
-	0xff8f, 0xff8c, 0xff8b, 0xff92, 0xff8b, 0xff98, 0xff9d, 0xff9f,
-	0xffa2, 0xff9d, 0xff9d, 0xff9f, 0xffa5, 0xffac, 0xffad, 0xffaa,
-	0xffb5, 0xffbd, 0xffc2, 0xffb9, 0xffc0, 0xffbd, 0xffba, 0xffad,
-	0xffb0, 0xffb1, 0xffbf, 0xffa7, 0xffb4, 0xffa5, 0xffa0, 0xff9c,
-	0xff98, 0xff94, 0xff96, 0xff92, 0xff93, 0xff85, 0xff95, 0xff91,
-	0xff8e, 0xff8f, 0xff8c, 0xff8e, 0xff94, 0xff97, 0xff9b, 0xff9b,
-	0xff9b, 0xff9a, 0xff93, 0xff9e, 0xff92, 0xff94, 0xff8a, 0xff89,
-	0xff8d, 0xff8b, 0xff95, 0xff8e, 0xff98, 0xff8f, 0xff8d, 0xff8d,
-	0xff88, 0xff85, 0xff7d, 0xff81, 0xff7a, 0xff85, 0xff82, 0xff84,
-	0xff80, 0xff7c, 0xff7c, 0xff6a, 0xff73, 0xff69, 0xff71, 0xff6a,
-	0xff71, 0xff71, 0xff74, 0xff78, 0xff71, 0xff76, 0xff72, 0xff6e,
-	0xff71, 0xff6f, 0xff6b, 0xff79, 0xff76, 0xff7c, 0xff78, 0xff84,
-	0xff70, 0xff6d, 0xff77, 0xff66, 0xff5e, 0xff7d, 0xff6c, 0xff7b,
-	0xff79, 0xff81, 0xff77, 0xff6d, 0xff7c, 0xff6f, 0xff6e, 0xff88,
-	0xff74, 0xff84, 0xff8d, 0xff7e, 0xff93, 0xff91, 0xff88, 0xff8e,
-	0xffa0, 0xff95, 0xffaa, 0xffac, 0xff98, 0xff99, 0xff93, 0xff9a,
-	0xff9c, 0xffa3, 0xffbf, 0xffbb, 0xffab, 0xffb8, 0xffa7, 0xff83,
-	0xffa5, 0xff92, 0xff89, 0xff98, 0xff83, 0xff7d, 0xff8a, 0xff60,
-	0xff65, 0xff80, 0xff43, 0xff53, 0xff53, 0xff16, 0xff24, 0xff2d,
-	0xff20, 0xff3f, 0xff4a, 0xff3f, 0xff63, 0xff45, 0xff32, 0xff52,
-	0xff43, 0xff67, 0xff88, 0xff99, 0xffa5, 0xffb1, 0xffae, 0xffb0,
-	0xffb7, 0xffae, 0xffd8, 0xffe8, 0xffc9, 0xffd9, 0xffef, 0xff9d,
-	0x000a, 0x000d, 0xffae, 0x0046, 0xffe9, 0xffd1, 0x0033, 0xff85,
-	0xffb4, 0xff9f, 0xfef9, 0xff6f, 0xff46, 0xff55, 0xffe2, 0xffb4,
-	0x001f, 0xffbf, 0xff53, 0xffec, 0xfe87, 0xfe85, 0xff57, 0xfe3f,
-	0xff2d, 0xffad, 0xff1f, 0xffe9, 0xffbb, 0xff6d, 0xffe9, 0xff50,
-	0xff09, 0xff2d, 0xfef8, 0xffd2, 0x0050, 0x008f, 0x018e, 0x012c,
-	0x00b2, 0x0133, 0x00ed, 0x0091, 0x00f8, 0x00bc, 0x00b1, 0x00b4,
-	0x004b, 0x00cc, 0x0083, 0x003f, 0x006b, 0xffac, 0x005f, 0x00a7,
-	0xffb7, 0x0105, 0x0177, 0x0032, 0x017a, 0x01cb, 0x00bf, 0x022b,
-	0x01d3, 0x0073, 0x010c, 0xff94, 0xfe07, 0xfe6e, 0xfc69, 0xfa13,
-	0xf9df, 0xf868, 0xf727, 0xf6a6, 0xf420, 0xf27f, 0xf1ab, 0xf017,
-	0xf147, 0xf329, 0xf3a5, 0xf674, 0xf901, 0xfa18, 0xfd41, 0xfeb9,
-	0xfebf, 0x01a9, 0x02fd, 0x03b7, 0x0719, 0x0845, 0x08d3, 0x0b90,
-	0x0be1, 0x0ba0, 0x0cb3, 0x0b6f, 0x0aaa, 0x0b00, 0x0910, 0x089f,
-	0x0943, 0x085f, 0x08b8, 0x08ba, 0x073b, 0x0724, 0x062b, 0x03f9,
-	0x0318, 0x01e7, 0x0106, 0x0165, 0x0140, 0x00f2, 0x00d0, 0x0059,
-	0xffa7, 0xfeb9, 0xfdc7, 0xfcfc, 0xfc1c, 0xfb72, 0xfadb, 0xfa6b,
-	0xfa7f, 0xfae3, 0xfafb, 0xfaf5, 0xfb0a, 0xfb45, 0xfb7f, 0xfbb8,
-	0xfbff, 0xfbd9, 0xfb76, 0xfbc5, 0xfbd2, 0xfb77, 0xfc35, 0xfc50,
-	0xfb88, 0xfc63, 0xfc77, 0xfb94, 0xfcbe, 0xfc8c, 0xfb6a, 0xfc91,
-	0xfc63, 0xfc35, 0xfdfd, 0xfd76, 0xfcaf, 0xfc46, 0xf9e8, 0xf93f,
-	0xf9a2, 0xf998, 0xfbec, 0xfd84, 0xfe11, 0x0045, 0x00ab, 0x00cd,
-	0x02bb, 0x02b7, 0x02b5, 0x03de, 0x0318, 0x02a3, 0x0395, 0x0338,
-	0x0351, 0x0439, 0x0367, 0x0286, 0x0248, 0x00ca, 0x0021, 0x005c,
-	0xff7b, 0xffb9, 0x001c, 0xff40, 0xffd1, 0xffa5, 0xfe90, 0xfee6,
-	0xfdaf, 0xfc68, 0xfcae, 0xfbcd, 0xfc62, 0xfde9, 0xfe2d, 0xff77,
-	0x0001, 0xffa0, 0x0034, 0xffac, 0xffc0, 0x0039, 0xffc6, 0x00a2,
-	0x0085, 0x0008, 0x00de, 0xffce, 0xffee, 0x00db, 0xffbb, 0x00dd,
-	0x0153, 0x0028, 0x0218, 0x0290, 0x0338, 0x0710, 0x0842, 0x0a26,
-	0x0d30, 0x0caf, 0x0dd6, 0x0f2e, 0x0e08, 0x0f25, 0x0eb2, 0x0bf5,
-	0x0ac2, 0x073f, 0x0298, 0xff8d, 0xfa41, 0xf46d, 0xefe2, 0xea70,
-	0xe5f0, 0xe3fa, 0xe2ff, 0xe2c7, 0xe409, 0xe5db, 0xe6c6, 0xe8a3,
-	0xeb65, 0xecb3, 0xef06, 0xf21c, 0xf382, 0xf661, 0xf9ff, 0xfbfd,
-	0xff7e, 0x025b, 0x034a, 0x0571, 0x066d, 0x065d, 0x07fa, 0x0892,
-	0x08e1, 0x0a57, 0x0b2e, 0x0b66, 0x0bd6, 0x0c67, 0x0b6f, 0x0a4a,
-	0x0aa6, 0x085e, 0x066d, 0x0716, 0x048e, 0x03c3, 0x05d8, 0x044c,
-	0x0520, 0x06a9, 0x04a6, 0x0587, 0x0534, 0x03b0, 0x0539, 0x03a1,
-	0x0338, 0x04b5, 0x0203, 0x02c3, 0x0387, 0x0088, 0x01c9, 0x018c,
-	0xff74, 0x0153, 0x008c, 0xffc1, 0x00da, 0xfed0, 0xfe6a, 0xfe91,
-	0xfcb1, 0xfcfd, 0xfc8e, 0xfb43, 0xfb44, 0xfae4, 0xfa5c, 0xf9d1,
-	0xfa37, 0xfa11, 0xf93f, 0xfad5, 0xfb53, 0xfa87, 0xfc03, 0xfbb5,
-	0xfb1a, 0xfc85, 0xfc20, 0xfc87, 0xfcc6, 0xfb93, 0xfc5c, 0xfba0,
-	0xfb24, 0xfd29, 0xfd2b, 0xfdf6, 0xfffa, 0x00f8, 0x02a0, 0x0488,
-	0x0650, 0x0785, 0x07e2, 0x06b1, 0x04f6, 0x03b5, 0x0219, 0x01c8,
-	0x0143, 0x00d8, 0x0205, 0x013b, 0x01fb, 0x03c8, 0x028e, 0x02a1,
-	0x0250, 0x0098, 0xffa1, 0xfc95, 0xfa6d, 0xf8e4, 0xf599, 0xf723,
-	0xf896, 0xf7e8, 0xfc3b, 0xfd62, 0xfd78, 0x00a6, 0xfec4, 0xfe57,
-	0xff9b, 0xfcea, 0xfbc4, 0xfd0f, 0xfbe0, 0xf9f0, 0xfd1a, 0xfc51,
-	0xfb88, 0x01bd, 0xfcdb, 0xffdf, 0x0a46, 0x006b, 0x0681, 0x1086,
-	0x01cd, 0x0986, 0x12f8, 0x05fe, 0x0f2d, 0x1409, 0x08b1, 0x114a,
-	0x0fd7, 0x090e, 0x1117, 0x0914, 0x06d5, 0x08f5, 0xfaaf, 0xfd36,
-	0xfad7, 0xeff6, 0xf6b5, 0xef80, 0xeafb, 0xf225, 0xe666, 0xe56d,
-	0xe81a, 0xdc61, 0xe40b, 0xe631, 0xe040, 0xf192, 0xefb4, 0xe9de,
-	0xfa9e, 0xf7c4, 0xfdb8, 0x061a, 0xf828, 0x04f0, 0x0488, 0xf448,
-	0x0a2b, 0x0908, 0xfd59, 0x11f9, 0x0ad7, 0x0425, 0x1856, 0x0aeb,
-	0x028c, 0x11da, 0x0328, 0x01e6, 0x0fb0, 0x02b6, 0x0625, 0x0b00,
-	0x00ba, 0x0849, 0x0501, 0xfdfe, 0x05ca, 0x013a, 0xffb7, 0x06cb,
-	0x0445, 0x036e, 0x064b, 0x0439, 0x0117, 0x024b, 0x022e, 0xfa98,
-	0xfa5e, 0xfefc, 0xf899, 0xfe02, 0x0903, 0x0329, 0x07bb, 0x0b2b,
-	0x01cc, 0x05d9, 0x0411, 0xfe3f, 0x0269, 0xfe25, 0xfd47, 0xff40,
-	0xfc6e, 0xfea8, 0xfcab, 0xfc73, 0xfead, 0xf84b, 0xf686, 0xf6fe,
-	0xf2c1, 0xf63c, 0xf810, 0xf742, 0x0095, 0x0377, 0x0218, 0x062c,
-	0x01d2, 0xfdde, 0xfc48, 0xf5f8, 0xf9b0, 0xf8f4, 0xf365, 0xff31,
-	0x0173, 0xfd1e, 0x091f, 0x0795, 0x01ac, 0x0d7a, 0x076c, 0xfe6f,
-	0x08d3, 0x02f9, 0xfb6e, 0x02f5, 0x015c, 0x0186, 0x07c1, 0x0660,
-	0x0593, 0x01fa, 0xfc78, 0xfd4c, 0xfa91, 0xf859, 0xfccc, 0xfd82,
-	0xf97c, 0xfa0b, 0xfb9f, 0xf885, 0xfbfb, 0x021c, 0xfeb6, 0x0159,
-	0x04ce, 0xfc9d, 0xfedd, 0x0075, 0xf901, 0xfedb, 0xfea0, 0xf821,
-	0xfefa, 0xfc59, 0xf7d1, 0xff6a, 0x0026, 0x0192, 0x06aa, 0x06fb,
-	0x06fc, 0x065e, 0x0aca, 0x0bd2, 0x07a1, 0x0f71, 0x0fcd, 0x0a38,
-	0x12d8, 0x1127, 0x0c3d, 0x1215, 0x0b6a, 0x0597, 0x0665, 0xff31,
-	0xfbdc, 0xf799, 0xf26f, 0xf5b9, 0xf374, 0xf206, 0xf7b4, 0xf440,
-	0xeea3, 0xed72, 0xe6ed, 0xe0ac, 0xe125, 0xdf6c, 0xdbc6, 0xe417,
-	0xeb3c, 0xea72, 0xf538, 0xfad4, 0xf541, 0xfcef, 0xffc3, 0xfbc9,
-	0x05bb, 0x05db, 0x022d, 0x09c8, 0x084b, 0x09ff, 0x13a0, 0x1048,
-	0x0c91, 0x0dda, 0x0900, 0x0730, 0x0764, 0x0653, 0x083b, 0x09bd,
-	0x0ad1, 0x0bc2, 0x09e5, 0x07d8, 0x076a, 0x03eb, 0x031e, 0x0575,
-	0x0370, 0x0326, 0x06e6, 0x04ff, 0x0138, 0x0346, 0x00c7, 0xfa7c,
-	0xfa05, 0xfc60, 0xf9da, 0xfa4d, 0x003e, 0xfc78, 0xfa99, 0x0214,
-	0xff80, 0xfe5f, 0x05ab, 0x01e3, 0x00c6, 0x05fe, 0x0308, 0x0454,
-	0x064a, 0x041a, 0x06b9, 0x0412, 0x0011, 0x0016, 0xfa47, 0xf6f6,
-	0xf5a3, 0xf2dd, 0xf4eb, 0xf4dc, 0xf514, 0xf978, 0xfac1, 0xfcd1,
-	0xfe34, 0xfcd2, 0xfc78, 0xfa55, 0xf8ba, 0xf607, 0xf497, 0xfab1,
-	0xfaec, 0xfbd5, 0x05fb, 0x01c0, 0xfd44, 0x0419, 0x0051, 0x0060,
-	0x0a0b, 0x0881, 0x04f9, 0x0740, 0x021c, 0xfc6e, 0xfecb, 0x02eb,
-	0x03c9, 0x01f3, 0x01e3, 0x01c9, 0xffdd, 0xfd3b, 0xfef3, 0x0032,
-	0xfe43, 0x0186, 0x010a, 0xfe4b, 0x02fa, 0x00e3, 0xfbd7, 0xff8f,
-	0xfd0d, 0xfb6a, 0x016e, 0xfedc, 0xface, 0xfc98, 0xf915, 0xf6a0,
-	0xf848, 0xf82b, 0xf91a, 0xfe82, 0x0384, 0xfe66, 0xfd53, 0xfc17,
-	0xf729, 0xfd55, 0x0323, 0x0165, 0x07d9, 0x0e32, 0x0b15, 0x0e55,
-	0x0d44, 0x0f89, 0x157c, 0x150f, 0x1855, 0x16e4, 0x0fb1, 0x0be5,
-	0x0666, 0x018b, 0x04c3, 0xfe44, 0xf7ed, 0xf823, 0xf2ef, 0xeeb1,
-	0xf0a0, 0xf534, 0xf50e, 0xf2b6, 0xf190, 0xe8a2, 0xdd39, 0xe11b,
-	0xe24c, 0xe544, 0xf647, 0xf9cf, 0xf3eb, 0xf874, 0xf761, 0xf4d9,
-	0xfdc8, 0xfd7a, 0xfdea, 0x03dd, 0xfe47, 0xfcf7, 0x005a, 0xfbad,
-	0x00b7, 0x0c25, 0x0f2e, 0x159c, 0x1308, 0x057e, 0x031d, 0xfebf,
-	0xfc29, 0x052a, 0x0795, 0x0bef, 0x126f, 0x0e56, 0x0c26, 0x0b15,
-	0x00e5, 0xffb0, 0x07ca, 0x0926, 0x072d, 0x04bf, 0x0024, 0xf7ba,
-	0xfa4a, 0x01e2, 0xfc69, 0xfd79, 0x0102, 0xfa54, 0xfb4f, 0xfdc1,
-	0xf7c8, 0xf799, 0xf9ce, 0xf6ce, 0xf80c, 0xf7a7, 0xfacd, 0xff19,
-	0xfe26, 0x02ad, 0x03b3, 0x06f0, 0x0d7b, 0x0e49, 0x0c1d, 0x0af2,
-	0x07ae, 0x02ae, 0xfd28, 0xf78b, 0xf82a, 0xf365, 0xf16f, 0xf5c1,
-	0xfa9c, 0x04b7, 0x0566, 0xffdb, 0x0168, 0xface, 0xf035, 0xf704,
-	0xfa19, 0xf82c, 0x03c5, 0x04f1, 0xffa3, 0x03ae, 0xfd08, 0xfa17,
-	0x09fa, 0x0fb3, 0x0af3, 0x0837, 0xfea5, 0xfb9c, 0x00b3, 0x0131,
-	0x06b4, 0x07c4, 0x0162, 0x023c, 0xfe95, 0xf952, 0xfc4e, 0xf907,
-	0xf644, 0xf9eb, 0xf843, 0xfa2d, 0x0057, 0xfd9b, 0xfbfd, 0xff4e,
-	0xfe02, 0xfb7c, 0xfc48, 0xfee1, 0xfebe, 0x0274, 0x063b, 0xfca1,
-	0xf699, 0xf703, 0xf058, 0xee5d, 0xf537, 0xf7be, 0xfda0, 0x074a,
-	0x0444, 0x000d, 0xfb8e, 0xf67d, 0xf7e1, 0xfcc0, 0x00c0, 0xfe99,
-	0xfda3, 0x011f, 0x06cd, 0x0854, 0x0adb, 0x0fca, 0x160a, 0x1c79,
-	0x18d7, 0x1394, 0x10a7, 0x1182, 0x13e7, 0x1206, 0x108f, 0x08f6,
-	0xfbf2, 0xf767, 0xf51c, 0xf147, 0xf8e8, 0xf832, 0xe7b7, 0xe8a5,
-	0xe640, 0xde6c, 0xeb13, 0xef9f, 0xe9e5, 0xef4e, 0xeebc, 0xe799,
-	0xee5e, 0xf061, 0xf602, 0x0292, 0x01c6, 0x017b, 0x013a, 0xfd5c,
-	0xffd4, 0x02e9, 0x023c, 0x086d, 0x09f3, 0x09b6, 0x10ed, 0x0cae,
-	0x005c, 0xfd7a, 0xfe6e, 0x017c, 0x0702, 0x04ba, 0x00e1, 0x0521,
-	0x098c, 0x068c, 0x086d, 0x0deb, 0x0e73, 0x0f6a, 0x1068, 0x0679,
-	0xfd3d, 0xfe7e, 0xfccd, 0xff7c, 0x0877, 0x083f, 0x05d5, 0x05c7,
-	0xff23, 0xfc8b, 0xfdaa, 0xfb0b, 0xf988, 0xfad8, 0xfaac, 0xfa29,
-	0xf913, 0xf98c, 0xfa14, 0xf724, 0xfa0f, 0xfa40, 0xf9cd, 0xfc79,
-	0xffff, 0x02e0, 0x0285, 0x0528, 0x07e2, 0x0612, 0x0651, 0x07a5,
-	0xfd1c, 0xf956, 0xfc41, 0xfba0, 0x09a1, 0x0d9d, 0xfd52, 0xfb16,
-	0xfdc8, 0xfad5, 0x00a0, 0x00d1, 0xfb75, 0x0538, 0x0740, 0xfef8,
-	0x0008, 0xfe1f, 0xfef6, 0x03cf, 0x0147, 0xfe29, 0xff7b, 0xfc91,
-	0xfdbe, 0x0289, 0x0108, 0x0660, 0x07dc, 0x037b, 0x06e1, 0x0909,
-	0x044c, 0xfd76, 0xf3fd, 0xeebc, 0xf62f, 0xfde1, 0x0045, 0x016a,
-	0x0146, 0xfcc1, 0xf82f, 0xfa9a, 0xf8be, 0xf811, 0xff7f, 0xfce2,
-	0xf9dd, 0xfe19, 0xf5e7, 0xed56, 0xf2e9, 0xf7ec, 0xf9dc, 0xf9e0,
-	0xf87b, 0xfcfe, 0x012f, 0xff80, 0xfb43, 0xf8e0, 0xff91, 0x07bf,
-	0x0688, 0xff99, 0xfb31, 0xfcd6, 0xfbc6, 0xf9b4, 0x0066, 0x0986,
-	0x1057, 0x1202, 0x0f43, 0x13fa, 0x1a85, 0x1445, 0x0d9e, 0x0ca1,
-	0x0a3d, 0x0cf7, 0x09bd, 0xffa2, 0x060a, 0x0f10, 0x038b, 0xf430,
-	0xe89f, 0xdb4e, 0xe04b, 0xe6d5, 0xdf5f, 0xe2fa, 0xeacf, 0xed41,
-	0xf159, 0xf051, 0xeded, 0xf263, 0xeefc, 0xee82, 0xf822, 0xfc85,
-	0x00f7, 0x0230, 0x03d5, 0x0b88, 0x08f4, 0xfe71, 0xff9d, 0x0ca7,
-	0x14c4, 0x0fa2, 0x03ec, 0xfc18, 0x0126, 0x0ecd, 0x0cd6, 0xfe3d,
-	0xffbb, 0x0469, 0x0276, 0x0310, 0x020d, 0x094a, 0x13fe, 0x0fd0,
-	0x0752, 0x0820, 0x074d, 0x0116, 0xf983, 0xf4b1, 0xfc69, 0x0998,
-	0x0c47, 0x0657, 0x0508, 0x03c7, 0xffd9, 0xff5d, 0xfe29, 0xfba2,
-	0xfa72, 0xf957, 0xf8e8, 0xf9f6, 0x0235, 0x0f99, 0x0f1c, 0x0137,
-	0xf852, 0xf31d, 0xe86b, 0xe475, 0xeeab, 0xf6cc, 0xfa0c, 0xfdb6,
-	0xfd1b, 0x063c, 0x1494, 0x0b48, 0x00eb, 0x0642, 0x0715, 0x06da,
-	0x0471, 0xfe6a, 0x03d5, 0x047c, 0xfa9e, 0xf7cc, 0xf6de, 0xf7eb,
-	0xff49, 0x0368, 0x0288, 0xff94, 0xff80, 0x05e4, 0x0a67, 0x09f7,
-	0x07cc, 0x06d2, 0x02cb, 0xfa9c, 0xfbb5, 0x000f, 0xfcb2, 0xfc29,
-	0xff43, 0x0561, 0x0e53, 0x077b, 0xfa33, 0xfb97, 0xfddb, 0xfbef,
-	0xfe8b, 0xfdb1, 0xfb1d, 0xfe5d, 0xfc59, 0xf5a2, 0xf973, 0xff78,
-	0x0118, 0x076c, 0x059b, 0xf6cf, 0xef15, 0xf264, 0xfb3b, 0x0273,
-	0x0087, 0xfd27, 0xf9ec, 0xfacb, 0x0688, 0x0bd4, 0x05de, 0x0220,
-	0xff3c, 0xfc28, 0xfb4d, 0xfb13, 0xf9dc, 0xf9d0, 0x0039, 0x032f,
-	0x02b4, 0x0a1d, 0x0a44, 0x0268, 0xff3e, 0xf9ba, 0xfea8, 0x0ce5,
-	0x0e3e, 0x1126, 0x15bc, 0x0f44, 0x10c3, 0x1879, 0x1971, 0x194a,
-	0x13d7, 0x0646, 0xf6ef, 0xec12, 0xe915, 0xe8a0, 0xe7c9, 0xe50b,
-	0xe19a, 0xe3fb, 0xe766, 0xe652, 0xe32c, 0xe13c, 0xe534, 0xe974,
-	0xed1d, 0xf444, 0xf23e, 0xec30, 0xefa4, 0xf249, 0xf58f, 0xff3f,
-	0x04f2, 0x0a80, 0x14f1, 0x16dc, 0x0f39, 0x0e4f, 0x1122, 0x0b89,
-	0x09a8, 0x0aa5, 0x0233, 0x00d8, 0x0ae4, 0x1383, 0x19ae, 0x1552,
-	0x0c48, 0x0b9e, 0x099e, 0x065d, 0x03db, 0xfeb2, 0x0132, 0x0565,
-	0x039f, 0x04f9, 0x0566, 0x036d, 0x02b4, 0xfebe, 0xf9fa, 0xf4fa,
-	0xf103, 0xf67b, 0x011a, 0x05e2, 0x0270, 0x00b2, 0x0339, 0xfddd,
-	0xfa1a, 0x00d4, 0xff82, 0xf9aa, 0xf8f7, 0xf27b, 0xeebf, 0xf16b,
-	0xed35, 0xee99, 0xf941, 0xf993, 0xf577, 0xfa7f, 0x044f, 0x0e27,
-	0x1437, 0x1961, 0x1f77, 0x1923, 0x083a, 0xfc15, 0xf5d8, 0xf664,
-	0xf960, 0xf55f, 0xf1c5, 0xf13f, 0xf1aa, 0xf9f0, 0x0218, 0xff6a,
-	0xfc8e, 0x0469, 0x0e45, 0x0a89, 0x0265, 0x03ff, 0x0857, 0x0af8,
-	0x0702, 0xff1a, 0x049a, 0x0a63, 0x05f8, 0x0727, 0x0366, 0xfa21,
-	0xfc7d, 0xff91, 0x01ff, 0x0667, 0x0088, 0xf9b4, 0xfa76, 0xfd85,
-	0xfff4, 0xfd54, 0xfbc8, 0xfe9a, 0x0016, 0x00d2, 0xf85b, 0xe79a,
-	0xe36e, 0xef6a, 0xfbf8, 0xfd19, 0xfb30, 0x004a, 0x0143, 0x0050,
-	0x0242, 0xfc2d, 0xfa6e, 0x00b0, 0xfc2c, 0xf3d6, 0xefdf, 0xef06,
-	0xf7cf, 0x04cb, 0x0f09, 0x14d8, 0x0f4b, 0x0169, 0xfa83, 0x041d,
-	0x11fe, 0x1427, 0x0e82, 0x0af2, 0x13df, 0x21f7, 0x1e17, 0x14fa,
-	0x1533, 0x117a, 0x0ea1, 0x0b17, 0xfd7b, 0xf494, 0xf2a4, 0xf3b4,
-	0xf59e, 0xedce, 0xe79f, 0xe5bb, 0xdb53, 0xd5fd, 0xd812, 0xd8e8,
-	0xddf4, 0xe428, 0xebf7, 0xf622, 0xf884, 0xf36a, 0xf065, 0xfc8a,
-	0x0b04, 0x034a, 0xfc21, 0x0244, 0x06fb, 0x1632, 0x24d5, 0x1f56,
-	0x1523, 0x097a, 0x021c, 0x0465, 0x0295, 0x068f, 0x0d9b, 0x057b,
-	0xfeee, 0x0207, 0x06cb, 0x0b0f, 0x077d, 0x056d, 0x0aa6, 0x08d8,
-	0xfe9c, 0xf74b, 0x02f7, 0x18f1, 0x1999, 0x0b16, 0xff15, 0xf62b,
-	0xf9bb, 0x03b4, 0x0600, 0x0085, 0xf7a0, 0xfcb7, 0x099e, 0x0581,
-	0xfefb, 0xfe65, 0xf6ca, 0xf41b, 0xf7a6, 0xf323, 0xed9d, 0xec56,
-	0xea65, 0xec14, 0xef9c, 0xe817, 0xde19, 0xe673, 0xf77b, 0xfdcc,
-	0xfeb6, 0x04b0, 0x124b, 0x212a, 0x2540, 0x1aab, 0x094b, 0x024a,
-	0x09a2, 0x0916, 0xfa83, 0xf224, 0xf5d8, 0xfd48, 0x07a9, 0x0fe1,
-	0x09fe, 0xfc1a, 0xf614, 0xfabc, 0x06fb, 0x0ffd, 0x0d70, 0x0af7,
-	0x0cbb, 0x0907, 0x0281, 0xfdbe, 0xfa6e, 0xfb37, 0xf9da, 0xf3cf,
-	0xf07b, 0xeccd, 0xf0b7, 0x06ca, 0x134e, 0x0622, 0xfbc9, 0xfe32,
-	0xfc31, 0xf66f, 0xf583, 0xf60e, 0xf6b1, 0xf94f, 0xfd5f, 0x007c,
-	0xfe35, 0xf8b2, 0xf606, 0xfa5f, 0x0253, 0x0271, 0xfe42, 0xff83,
-	0x0293, 0x031a, 0x0286, 0x03ca, 0xff8d, 0xf501, 0xf3d7, 0xefaa,
-	0xe327, 0xe84d, 0xf597, 0xfbef, 0x04db, 0x063b, 0xfe5e, 0xfa4a,
-	0xfa7f, 0x0637, 0x1699, 0x14e7, 0x09f3, 0x0782, 0x0efe, 0x1cb4,
-	0x24e4, 0x22eb, 0x1bbb, 0x13b0, 0x1596, 0x1def, 0x1df6, 0x125d,
-	0x0433, 0x00ac, 0xfbbf, 0xeb94, 0xe4f1, 0xe3a2, 0xdc46, 0xd962,
-	0xd735, 0xd3d2, 0xd15e, 0xd297, 0xe29c, 0xf048, 0xe8f3, 0xdf75,
-	0xe36a, 0xf1a7, 0x0058, 0x0343, 0xfd75, 0x0387, 0x1650, 0x216c,
-	0x22c3, 0x1dbd, 0x0f54, 0x080e, 0x1025, 0x121a, 0x0895, 0x0403,
-	0x040d, 0x055d, 0x0a5c, 0x0ce5, 0x0b85, 0x0443, 0xfc25, 0x02d7,
-	0x0d00, 0x0a88, 0x0321, 0x035f, 0x0cbf, 0x0faa, 0x0714, 0xfde5,
-	0xfa07, 0xfbd9, 0xfc78, 0xfcbe, 0xf8e6, 0xec38, 0xee2b, 0xfa40,
-	0xf9b1, 0xfb4b, 0x01ea, 0x0080, 0xfc95, 0xfaf9, 0xfdb5, 0x0122,
-	0xf907, 0xebb0, 0xe988, 0xecd7, 0xed6a, 0xef6f, 0xf460, 0xfef0,
-	0x08a4, 0x0443, 0xfbfc, 0x031c, 0x174e, 0x250e, 0x26cc, 0x209f,
-	0x1296, 0x0abb, 0x0b14, 0x042a, 0xfae0, 0xf3ae, 0xee21, 0xed29,
-	0xed2c, 0xf150, 0xf586, 0xf0b2, 0xed4b, 0xf882, 0x0b01, 0x1399,
-	0x0fa8, 0x0392, 0xfaa8, 0x00eb, 0x05fe, 0x05fd, 0x0aa5, 0x09bf,
-	0x0a4b, 0x1012, 0x0b63, 0x0502, 0x06d7, 0x06b7, 0xffec, 0xfd4c,
-	0x0211, 0x0173, 0xfc51, 0xfd06, 0x014b, 0xffb4, 0xf693, 0xf14b,
-	0xf373, 0xf350, 0xeef2, 0xeb83, 0xe926, 0xeef0, 0xff35, 0x024c,
-	0xf74c, 0xf352, 0xf55d, 0x0084, 0x0a48, 0x00a9, 0xf593, 0xf264,
-	0xf2a8, 0xf2cb, 0xee60, 0xef92, 0xf589, 0xfc5a, 0x08a8, 0x13bc,
-	0x14f9, 0x078a, 0xfd28, 0x0411, 0x09be, 0x0f07, 0x190a, 0x1dfa,
-	0x21f5, 0x202e, 0x173e, 0x15be, 0x19c2, 0x1c98, 0x20d5, 0x202e,
-	0x130c, 0x0300, 0xf9cc, 0xf389, 0xeb2a, 0xe54a, 0xe709, 0xe68d,
-	0xdc94, 0xd314, 0xd315, 0xd893, 0xd6e7, 0xd48b, 0xd9b9, 0xdc9e,
-	0xe3ee, 0xecf8, 0xf27b, 0x00bb, 0x060f, 0xff64, 0x033c, 0x0c7b,
-	0x1620, 0x1e0f, 0x20d1, 0x1f0c, 0x15b7, 0x0dad, 0x0b2f, 0x0a40,
-	0x0a62, 0x0667, 0xfebd, 0xf406, 0xef90, 0xfab6, 0x03c4, 0x02a7,
-	0xffd9, 0xfd39, 0x00e6, 0x0bd5, 0x104c, 0x0ae8, 0x06cb, 0x02cd,
-	0xfcf8, 0xfdc3, 0x016c, 0x043f, 0x0694, 0x073b, 0x0be2, 0x0ff1,
-	0x0af6, 0x009f, 0xf7df, 0xf483, 0xf4b7, 0xf572, 0xf53a, 0xfcd2,
-	0x0bc9, 0x0bfe, 0xfdd6, 0xec36, 0xdd6d, 0xddc5, 0xe30a, 0xe371,
-	0xe621, 0xed22, 0xf5b2, 0xf97f, 0xfe6c, 0x0680, 0x0ba3, 0x15f1,
-	0x1e6e, 0x1e48, 0x1a2e, 0x1019, 0x099f, 0x04df, 0xfd96, 0xfff0,
-	0x002e, 0xf92b, 0xfcdc, 0x05ad, 0x044d, 0xfcc5, 0xf845, 0xfc78,
-	0x0985, 0x122e, 0x0e85, 0x07a9, 0x03dd, 0x024c, 0xff7f, 0xfd4e,
-	0xff82, 0x027e, 0x03d5, 0x02cf, 0x02ba, 0x0012, 0xf4c6, 0xee22,
-	0xeca3, 0xeebd, 0xfacb, 0xfdae, 0xf81b, 0xf9cc, 0xff23, 0x0765,
-	0x094e, 0x0198, 0xfa50, 0xf583, 0xf4db, 0xf295, 0xf4ab, 0x0283,
-	0x09a7, 0x06ba, 0xff1d, 0xf7d4, 0xfb48, 0xff50, 0x0254, 0x0a08,
-	0x0811, 0x0108, 0xfdc8, 0xf5a9, 0xf2c4, 0xf758, 0xf044, 0xe4e4,
-	0xe3c3, 0xebd9, 0xfa09, 0xfef9, 0xfb36, 0xfea1, 0x0808, 0x1624,
-	0x1f11, 0x1d3f, 0x1d44, 0x1d0a, 0x1be4, 0x1898, 0x11c2, 0x14a0,
-	0x1bdf, 0x22e2, 0x297d, 0x222b, 0x1469, 0x062e, 0xf5a6, 0xf007,
-	0xf105, 0xe840, 0xdc4c, 0xdcb2, 0xe60c, 0xebba, 0xe54b, 0xd3ef,
-	0xcaa6, 0xceef, 0xd40d, 0xd808, 0xd858, 0xdcd9, 0xedab, 0xfaa4,
-	0xffe7, 0x05d9, 0x0bd0, 0x163d, 0x22ef, 0x23ac, 0x18b3, 0x0f17,
-	0x0c5d, 0x0c69, 0x091a, 0x044e, 0xff46, 0xf7f3, 0xfa74, 0x0913,
-	0x1412, 0x14cb, 0x0a53, 0x0633, 0x11ba, 0x17fb, 0x167a, 0x0f7c,
-	0x046b, 0x03f8, 0x03bf, 0xfe52, 0xfc28, 0xf6b1, 0xf6da, 0xff19,
-	0xff9e, 0xfb2d, 0xf741, 0xf3c1, 0xf23f, 0xf386, 0xf724, 0xf8ab,
-	0xf868, 0xfa89, 0xfd8d, 0xfb7a, 0xf1f1, 0xe75f, 0xe064, 0xde42,
-	0xe297, 0xe92f, 0xf05f, 0xfc22, 0x09d7, 0x110d, 0x0f70, 0x0b21,
-	0x0a79, 0x0ee4, 0x184d, 0x214f, 0x1faf, 0x18ca, 0x151c, 0x0ef4,
-	0x0aae, 0x071f, 0xfca1, 0xf3a1, 0xec05, 0xec8f, 0xf82d, 0xf7b6,
-	0xf375, 0xf84b, 0xfd61, 0x0663, 0x0821, 0x00db, 0x0035, 0xff62,
-	0x027f, 0x0972, 0x0565, 0x0135, 0x04b4, 0x0dac, 0x19b2, 0x180a,
-	0x0ae2, 0xfef6, 0xf4a4, 0xf62c, 0xfd98, 0xf9c0, 0xf655, 0xfb1b,
-	0x0481, 0x0da3, 0x0822, 0xfad1, 0xf444, 0xf140, 0xf2ea, 0xf4e3,
-	0xf0ef, 0xefe9, 0xf27e, 0xf2a2, 0xf279, 0xf1fc, 0xf0e4, 0xf46c,
-	0xfcb3, 0x0231, 0x01f9, 0xfda5, 0xfa10, 0xfa77, 0xf94b, 0xf5c5,
-	0xf0b7, 0xe85a, 0xe9e3, 0xf877, 0x04b7, 0x0652, 0xfed9, 0x007f,
-	0x0fc1, 0x1707, 0x180d, 0x1a2e, 0x1c0c, 0x23f7, 0x26b7, 0x22a2,
-	0x22e6, 0x1e53, 0x1abe, 0x1cbb, 0x15f2, 0x0e5b, 0x06f7, 0xfa4b,
-	0xf577, 0xf2de, 0xecb6, 0xe927, 0xe432, 0xe578, 0xeca0, 0xea3a,
-	0xdfde, 0xd1cd, 0xc877, 0xcd17, 0xd3e2, 0xd890, 0xe119, 0xeed7,
-	0x00fd, 0x0bcd, 0x0c83, 0x0efa, 0x13bc, 0x18aa, 0x1e9a, 0x22bb,
-	0x254d, 0x2315, 0x1689, 0x06a3, 0xfe14, 0xfaf5, 0xf71a, 0xefe9,
-	0xe7c7, 0xea5a, 0xf51a, 0xf76d, 0xf891, 0x0223, 0x0cc4, 0x1612,
-	0x16d8, 0x109d, 0x10bb, 0x1052, 0x0e5b, 0x0d30, 0x02c1, 0xfab4,
-	0xfbe7, 0xfe34, 0x0507, 0x0a9c, 0x0b74, 0x08f0, 0xff30, 0xfc83,
-	0x02a4, 0x0327, 0x005b, 0xfa52, 0xf688, 0xf964, 0xf3f5, 0xea75,
-	0xe4b9, 0xdfe6, 0xe1d4, 0xe138, 0xdeb0, 0xea36, 0xf5fd, 0xfa51,
-	0xfd83, 0xfc12, 0xfe98, 0x0a4a, 0x176a, 0x20e2, 0x21c1, 0x1e89,
-	0x1aea, 0x12b3, 0x091d, 0x02bd, 0xfcef, 0xf5a4, 0xf545, 0xffc2,
-	0x0930, 0x0b21, 0x05ef, 0xfed6, 0xff17, 0x0176, 0x007a, 0x01a5,
-	0x06ea, 0x0d05, 0x0e0c, 0x0a5d, 0x07ba, 0x06c7, 0x0b0c, 0x0fc3,
-	0x0a5d, 0x00eb, 0xf83c, 0xf1ba, 0xf2c5, 0xf42b, 0xf447, 0xf867,
-	0xf80d, 0xf747, 0xfb4c, 0xfbe7, 0xfe05, 0xfbc9, 0xf0f3, 0xef91,
-	0xf22e, 0xf2de, 0xf8e2, 0xfdf4, 0x0427, 0x0620, 0xffa9, 0xfebe,
-	0xfd9e, 0xfa43, 0xfbeb, 0xfdd3, 0x027f, 0x0724, 0x082e, 0x0510,
-	0xf9d8, 0xf191, 0xebcc, 0xe247, 0xe3a8, 0xed9d, 0xf122, 0xf0f1,
-	0xf465, 0xf95c, 0xfeb5, 0x08b2, 0x1121, 0x12c5, 0x1468, 0x199b,
-	0x202f, 0x20f3, 0x1e98, 0x20ef, 0x1fad, 0x1c85, 0x1e5b, 0x1c70,
-	0x1972, 0x184a, 0x0e08, 0xffdf, 0xf8df, 0xf57f, 0xf39a, 0xf2c8,
-	0xf12c, 0xef6a, 0xe72c, 0xdb79, 0xd751, 0xd565, 0xd447, 0xd2c6,
-	0xcf92, 0xd6e6, 0xe1f4, 0xebd8, 0xf81f, 0xfd12, 0x032d, 0x0b1d,
-	0x0e4d, 0x194c, 0x1f0e, 0x1b08, 0x191b, 0x0e1a, 0x016c, 0xfba2,
-	0xf43e, 0xf047, 0xefdb, 0xf4b0, 0x015c, 0x07cb, 0x08a5, 0x0fc3,
-	0x16f3, 0x1786, 0x1541, 0x0f62, 0x09fa, 0x0f83, 0x175d, 0x15b8,
-	0x1139, 0x0ecc, 0x0a23, 0x01ed, 0xfccb, 0xfbb2, 0xf82c, 0xf5f1,
-	0xf5ea, 0xf0c8, 0xef43, 0xf800, 0xfdc2, 0xfa8f, 0xf64e, 0xf52e,
-	0xf3f3, 0xecf3, 0xe590, 0xe35e, 0xde5e, 0xdb59, 0xe223, 0xeca1,
-	0xfd00, 0x085d, 0x0489, 0x06fc, 0x0f9e, 0x1272, 0x17c4, 0x1c29,
-	0x1fcb, 0x2475, 0x20d2, 0x1c37, 0x1798, 0x0aaa, 0xff2d, 0xf5f1,
-	0xec07, 0xea36, 0xef5e, 0xf590, 0xf694, 0xf1e9, 0xf40e, 0xfa9c,
-	0xfcea, 0xfe72, 0xfd8c, 0xfe5a, 0x04ce, 0x0739, 0x08b0, 0x0e6a,
-	0x1204, 0x0e4b, 0x0446, 0x0211, 0x0c34, 0x10c8, 0x0a85, 0x0471,
-	0x0095, 0xfead, 0x0183, 0x018e, 0x005b, 0x0678, 0x0599, 0xfd04,
-	0xfb5c, 0xf934, 0xf402, 0xedc8, 0xe601, 0xe4dc, 0xe5b7, 0xe69c,
-	0xebd5, 0xef64, 0xf2e3, 0xf598, 0xf3d5, 0xf55a, 0xfbeb, 0x0474,
-	0x0cb0, 0x0d2c, 0x0205, 0xf4e2, 0xf0c1, 0xf0ec, 0xed62, 0xed8d,
-	0xf9cb, 0x02e0, 0xfd8f, 0xfca7, 0x06d6, 0x11ea, 0x1787, 0x1229,
-	0x1045, 0x1650, 0x168f, 0x18fc, 0x1f60, 0x2388, 0x261d, 0x2062,
-	0x15cd, 0x0e96, 0x0de6, 0x0f46, 0x06e5, 0xfa29, 0xf0a9, 0xedda,
-	0xf225, 0xf33f, 0xf027, 0xeb62, 0xe6bb, 0xe3c3, 0xdd53, 0xd9eb,
-	0xda0b, 0xd52f, 0xd1f0, 0xd5ad, 0xe226, 0xee7f, 0xf4c4, 0xff20,
-	0x0a9d, 0x1472, 0x1b69, 0x1917, 0x192d, 0x1ea3, 0x204c, 0x1fc5,
-	0x19d6, 0x0e8c, 0x059f, 0xfe2d, 0xf16d, 0xe813, 0xee95, 0xf8f0,
-	0xfc7f, 0xfd16, 0xfe76, 0x00c5, 0x01ed, 0x04ce, 0x083a, 0x09e0,
-	0x0da2, 0x0f26, 0x0db6, 0x0cd4, 0x0c1b, 0x0b37, 0x040b, 0xffe3,
-	0x067b, 0x0b36, 0x0c52, 0x0724, 0xfcf3, 0xfc2e, 0xfe79, 0xfcab,
-	0xfc8d, 0xfba6, 0xf5a8, 0xecc4, 0xe9ba, 0xe97f, 0xe812, 0xe88b,
-	0xe635, 0xe3f2, 0xe2b4, 0xde3f, 0xe048, 0xea82, 0xf4ed, 0xff12,
-	0x089f, 0x1038, 0x13ea, 0x1621, 0x195e, 0x1bdf, 0x19c7, 0x10fa,
-	0x0a3b, 0x06fe, 0xfeed, 0xfb19, 0x004f, 0x01e4, 0xff12, 0xfa02,
-	0xf9df, 0x0403, 0x0911, 0x03c1, 0x0379, 0x059b, 0x0284, 0x0551,
-	0x0b69, 0x0fe1, 0x14ef, 0x1124, 0x06ee, 0x010a, 0xfc3f, 0xf8f3,
-	0xfd44, 0x054a, 0x0629, 0xfcbe, 0xf31f, 0xf179, 0xf84e, 0x012d,
-	0x03cf, 0x0273, 0xfe8e, 0xf7a6, 0xf2d4, 0xef2a, 0xeb87, 0xed3e,
-	0xeedb, 0xee9a, 0xf0e3, 0xefe0, 0xf039, 0xfb93, 0x065d, 0x0638,
-	0x074e, 0x09ad, 0x086f, 0x08b7, 0x0670, 0x0366, 0x02a8, 0xf87d,
-	0xeb5e, 0xee2a, 0xf46f, 0xf2c1, 0xeee1, 0xec85, 0xf3a2, 0xff4a,
-	0x02bc, 0x06f7, 0x1123, 0x1661, 0x14dc, 0x1195, 0x10d4, 0x14ac,
-	0x19f7, 0x1af9, 0x1a6e, 0x195f, 0x12ee, 0x0e3c, 0x11d9, 0x10b3,
-	0x0ab9, 0x09d2, 0x04d2, 0xfdea, 0xfe33, 0xfb51, 0xf1c4, 0xe5f7,
-	0xd7cb, 0xd585, 0xdf03, 0xdf51, 0xd928, 0xd684, 0xd452, 0xd753,
-	0xdc84, 0xe191, 0xf19b, 0x022e, 0x07b8, 0x0b55, 0x10fe, 0x1397,
-	0x1750, 0x1a08, 0x16ff, 0x145b, 0x0a81, 0xf894, 0xf034, 0xf711,
-	0x02b4, 0x0a2f, 0x072e, 0x00e5, 0x040c, 0x0c74, 0x113a, 0x11fe,
-	0x1353, 0x1523, 0x1741, 0x16f8, 0x1315, 0x1361, 0x175d, 0x14da,
-	0x1127, 0x0df6, 0x0396, 0xfd75, 0xfdef, 0xfbd5, 0xfb4b, 0xf9c3,
-	0xf008, 0xec28, 0xee2b, 0xef1e, 0xf1b1, 0xe92f, 0xde34, 0xe127,
-	0xe349, 0xdf87, 0xdfd7, 0xe375, 0xec0e, 0xf449, 0xefc5, 0xe78f,
-	0xeb9d, 0xf936, 0x0883, 0x18a2, 0x250b, 0x279c, 0x2418, 0x1fc4,
-	0x1bd8, 0x1919, 0x139d, 0x0ccc, 0x09b2, 0x0888, 0x059a, 0x0010,
-	0xf47d, 0xedb9, 0xf5e8, 0xfa81, 0xf62e, 0xf347, 0xf0b6, 0xf748,
-	0x05a4, 0x0888, 0x0670, 0x0ab1, 0x0d40, 0x0bef, 0x0bfd, 0x0bc6,
-	0x0baf, 0x0acf, 0x0642, 0x04df, 0x0531, 0x022b, 0xfefe, 0xfd0c,
-	0xfebb, 0x051c, 0x05d5, 0xfe0a, 0xf9f1, 0xfa4f, 0xf99b, 0xf6f6,
-	0xf2aa, 0xedb2, 0xe9d5, 0xe933, 0xe4f5, 0xe20a, 0xe79d, 0xef36,
-	0xf6d8, 0xfd09, 0xff3c, 0x033f, 0x08ac, 0x0944, 0x08db, 0x04d8,
-	0xf979, 0xed22, 0xe716, 0xeb83, 0xfb08, 0x04d1, 0xfb26, 0xf0a9,
-	0xf30a, 0xf94d, 0x0054, 0x07dd, 0x10dc, 0x1df5, 0x2224, 0x1d60,
-	0x1ae8, 0x1966, 0x196f, 0x1c20, 0x1e07, 0x1e23, 0x1c4c, 0x15bc,
-	0x0fda, 0x0d07, 0x05f6, 0xfe6b, 0xfc19, 0xfb35, 0xfa19, 0xf9b6,
-	0xf5b2, 0xeb4d, 0xe26a, 0xe036, 0xdfdf, 0xdd5a, 0xd423, 0xcc30,
-	0xd5ae, 0xe3d6, 0xe93a, 0xecac, 0xef2f, 0xf702, 0x0288, 0x0a0c,
-	0x1609, 0x20d7, 0x1fb7, 0x1b8c, 0x184f, 0x11ad, 0x0a68, 0x023f,
-	0xfa6f, 0xfa86, 0xfd07, 0xf9ae, 0xf43f, 0xf494, 0xfdbd, 0x06e6,
-	0x08ca, 0x03be, 0xfb56, 0xfc25, 0x034d, 0x0cc7, 0x1646, 0x1518,
-	0x10b5, 0x0d00, 0x0811, 0x0773, 0x0ebb, 0x13ca, 0x115f, 0x0754,
-	0xf6e1, 0xf0c3, 0xf429, 0xf836, 0xfee8, 0x0369, 0xfec1, 0xf519,
-	0xec72, 0xe71c, 0xea6a, 0xed8e, 0xe695, 0xe53e, 0xedc8, 0xf2e6,
-	0xf3a2, 0xf167, 0xee4b, 0xef8d, 0xf5b3, 0xfed7, 0x0aae, 0x138d,
-	0x168a, 0x1b3f, 0x1eb7, 0x1946, 0x1122, 0x0713, 0xfcf7, 0xfd52,
-	0x0544, 0x09e1, 0x0a41, 0x0426, 0xfbd3, 0xfd14, 0xfe44, 0xfa7a,
-	0xf876, 0xfa76, 0xff6e, 0x0574, 0x0880, 0x07e0, 0x0f37, 0x1504,
-	0x1230, 0x1173, 0x0c8d, 0x073d, 0x05be, 0x028c, 0xff85, 0xfbf8,
-	0xf860, 0xf641, 0xf60e, 0xf672, 0xf50c, 0xf40a, 0xf49a, 0xf714,
-	0xfa62, 0xf96d, 0xf311, 0xebdb, 0xec74, 0xf21f, 0xf419, 0xf535,
-	0xf479, 0xf33d, 0xf35a, 0xf442, 0xfd38, 0x079e, 0x0f4a, 0x16a1,
-	0x1212, 0x0448, 0xfd07, 0xf70a, 0xf0ef, 0xf595, 0xfab7, 0xf852,
-	0xf342, 0xed86, 0xed22, 0xf11f, 0xf810, 0xfcc0, 0xfc37, 0xffd4,
-	0x055b, 0x0a83, 0x12e0, 0x18f0, 0x1926, 0x144e, 0x0e42, 0x10d1,
-	0x1801, 0x1e61, 0x2320, 0x1db1, 0x11ec, 0x09db, 0x04be, 0x0492,
-	0x0b08, 0x0c78, 0x0830, 0x02c6, 0xf73b, 0xefb6, 0xf1e7, 0xee1d,
-	0xe53b, 0xdc26, 0xd4bb, 0xd594, 0xd947, 0xdfa5, 0xe99a, 0xefa9,
-	0xf20c, 0xf65f, 0xfcbc, 0x033b, 0x079b, 0x0b33, 0x0e60, 0x10f9,
-	0x10a8, 0x082b, 0xfe79, 0xf865, 0xf7ac, 0xf92c, 0xf986, 0xfb47,
-	0xff32, 0x024b, 0x0335, 0x07d2, 0x0b42, 0x0c52, 0x111e, 0x11be,
-	0x0f1d, 0x11dc, 0x151d, 0x131c, 0x127e, 0x152f, 0x139e, 0x12ad,
-	0x0fdf, 0x079d, 0xfd32, 0xf2a7, 0xeed3, 0xef48, 0xeff9, 0xf210,
-	0xf2b7, 0xee2b, 0xeaa8, 0xeb1a, 0xea9b, 0xe736, 0xe34b, 0xe23a,
-	0xe6fb, 0xf0c1, 0xf4a5, 0xf6aa, 0xfd26, 0xfe86, 0xfad6, 0xfc16,
-	0x0488, 0x0f7e, 0x176b, 0x1c2d, 0x1c6b, 0x1b83, 0x19f6, 0x13fd,
-	0x122d, 0x1124, 0x0e14, 0x0b72, 0x038d, 0xfd57, 0xfaca, 0xf93f,
-	0xfc4b, 0xfcd5, 0xf484, 0xeba5, 0xeb91, 0xefd2, 0xf6b8, 0x01e8,
-	0x0b1a, 0x0c4e, 0x0713, 0x05e9, 0x094b, 0x0e10, 0x1017, 0x0bbc,
-	0x0781, 0x0326, 0xfeea, 0xfe20, 0x000c, 0x0567, 0x0667, 0xfedb,
-	0xf836, 0xf88e, 0xfca7, 0xfb85, 0xf919, 0xf785, 0xf55a, 0xf79c,
-	0xf6d1, 0xf4e4, 0xf3d5, 0xf042, 0xedc3, 0xee19, 0xf37f, 0xf9de,
-	0x00e9, 0x0654, 0x04f5, 0x005b, 0xfb24, 0xf7f5, 0xf709, 0xf50d,
-	0xf471, 0xf893, 0xf59b, 0xeef9, 0xf012, 0xf4a7, 0xf9d0, 0xfa9b,
-	0xfb82, 0x01d4, 0x09c5, 0x0cdf, 0x0caa, 0x0ff3, 0x1792, 0x1b16,
-	0x1703, 0x17e7, 0x1bf5, 0x1af4, 0x1841, 0x171e, 0x1417, 0x0e28,
-	0x0a78, 0x06c9, 0x01e5, 0x0048, 0x0178, 0xff2e, 0xf8fc, 0xf4c1,
-	0xf165, 0xeff1, 0xeab2, 0xdf97, 0xd95f, 0xda66, 0xdfe5, 0xe392,
-	0xe704, 0xee53, 0xf4f5, 0xf4f2, 0xf928, 0x01e8, 0x0407, 0x0b44,
-	0x0f89, 0x0d43, 0x1042, 0x0d49, 0x0753, 0x0766, 0x0844, 0x0953,
-	0x042a, 0xf802, 0xf13b, 0xf432, 0xfbc2, 0x025f, 0x03be, 0x02d1,
-	0x056d, 0x084b, 0x0c32, 0x0f23, 0x0edf, 0x0e12, 0x0b02, 0x0af2,
-	0x1147, 0x1481, 0x155c, 0x13b5, 0x080e, 0xfb9a, 0xf4f4, 0xf62a,
-	0xfcb9, 0xfe79, 0xfbc7, 0xf854, 0xeec2, 0xe730, 0xeb02, 0xeead,
-	0xeec9, 0xead5, 0xe5c3, 0xe7e3, 0xec31, 0xef6c, 0xf3a3, 0xf7c8,
-	0xfb64, 0xf980, 0xf7cb, 0xfe49, 0x01f6, 0x050f, 0x0fd8, 0x147e,
-	0x1401, 0x15a2, 0x148c, 0x1556, 0x1484, 0x0d0a, 0x0549, 0x0209,
-	0x01ce, 0x038e, 0x0544, 0x0410, 0x02d3, 0xfc30, 0xf60f, 0xf921,
-	0xfd4c, 0x00f5, 0x03e9, 0x05e0, 0x05b5, 0x0797, 0x0ce4, 0x0e02,
-	0x0d74, 0x0970, 0x03c0, 0x0160, 0x0059, 0xfd77, 0xfacd, 0xfbc6,
-	0xfa24, 0xf89c, 0xf6e9, 0xf1e1, 0xf16f, 0xf1e0, 0xee4b, 0xf0b4,
-	0xf88d, 0xfe4b, 0xfea9, 0xf9e9, 0xf724, 0xf4a7, 0xf28e, 0xf5ea,
-	0xfce3, 0x02b6, 0x032d, 0x033b, 0x047e, 0x01f8, 0xfde8, 0xfcb4,
-	0xfe3f, 0x011e, 0xff9f, 0xfa6c, 0xf3af, 0xea7d, 0xea32, 0xf09c,
-	0xf80f, 0xff39, 0xfd28, 0xfac0, 0xfa15, 0xf8e1, 0xfc25, 0x027d,
-	0x0dc6, 0x1822, 0x1434, 0x0ca1, 0x0e82, 0x1253, 0x17d1, 0x1be0,
-	0x184c, 0x13be, 0x11f2, 0x1324, 0x1729, 0x1754, 0x12a3, 0x08ea,
-	0xff42, 0xfcfc, 0xfd3a, 0xfbc7, 0xf649, 0xed2e, 0xe450, 0xe156,
-	0xe156, 0xe175, 0xe7c0, 0xece7, 0xebea, 0xea6d, 0xe909, 0xea62,
-	0xefba, 0xf8d0, 0x00d0, 0xfdb7, 0xf759, 0xf9cf, 0xff4c, 0x029a,
-	0x0809, 0x0b3d, 0x05e5, 0xfc13, 0xf3da, 0xf30f, 0xfae1, 0x0420,
-	0x0b0c, 0x0eb2, 0x12f9, 0x131b, 0x0be6, 0x09cc, 0x0ca2, 0x0edf,
-	0x0f53, 0x11ea, 0x17be, 0x1a25, 0x15c5, 0x0f9a, 0x0aa9, 0x037d,
-	0x005b, 0x0576, 0x0603, 0xff08, 0xf48d, 0xe599, 0xdeae, 0xe22f,
-	0xe8bb, 0xefc1, 0xec42, 0xe502, 0xe51f, 0xe9f1, 0xf3da, 0xf773,
-	0xf46d, 0xf621, 0xf83f, 0xfaf9, 0xfc0f, 0xfa8d, 0xfd70, 0x0451,
-	0x0c93, 0x11dd, 0x11ee, 0x14cd, 0x19af, 0x19bf, 0x1935, 0x1823,
-	0x1009, 0x056e, 0x0380, 0x0613, 0x077a, 0x075b, 0x0144, 0xfd30,
-	0xfc57, 0xf689, 0xf225, 0xf2d5, 0xfb1d, 0x013c, 0xfb42, 0xf88a,
-	0xfebd, 0x0656, 0x0e2d, 0x10d9, 0x08c4, 0xfb62, 0xf255, 0xf953,
-	0x05c6, 0x0bf3, 0x0e15, 0x07d9, 0xfce9, 0xf254, 0xedd5, 0xf329,
-	0xfbf4, 0x0088, 0x0142, 0x01d4, 0xfe96, 0xf593, 0xef90, 0xf1c6,
-	0xf867, 0xfbd3, 0xf7eb, 0xf7e4, 0xfa88, 0xf97b, 0xfc78, 0xfbf4,
-	0xf983, 0xfb67, 0xfb0e, 0xfbfd, 0xfc0a, 0xf95d, 0xf581, 0xf074,
-	0xeccd, 0xee60, 0xf47d, 0xf90f, 0xfd69, 0x013a, 0x0434, 0x07a2,
-	0x092d, 0x0c22, 0x11ee, 0x1330, 0x1158, 0x10a8, 0x0d47, 0x08df,
-	0x0810, 0x0996, 0x0b6c, 0x0c83, 0x113e, 0x1a0f, 0x1c77, 0x1939,
-	0x1029, 0x03c6, 0xfdbf, 0xfa79, 0xf800, 0xf909, 0xf3c8, 0xea80,
-	0xe85f, 0xec51, 0xf6bf, 0xfa68, 0xf312, 0xed5b, 0xe7f9, 0xe5bf,
-	0xeced, 0xf89c, 0x0144, 0x0213, 0xfbcf, 0xf5b9, 0xf012, 0xef3c,
-	0xf8e8, 0x0686, 0x1020, 0x0ce2, 0x0414, 0xfd59, 0xf8e0, 0xf975,
-	0xfd14, 0x0257, 0x0596, 0x0a2b, 0x0bf1, 0x0789, 0x01b6, 0xfdbc,
-	0x0219, 0x07ae, 0x075e, 0x068b, 0x0a46, 0x0b9c, 0x0e9b, 0x1457,
-	0x1228, 0x0d69, 0x08af, 0x0759, 0x0aad, 0x0771, 0xfc43, 0xf0bd,
-	0xe6cb, 0xe384, 0xe66c, 0xeb9a, 0xf425, 0xf65b, 0xf516, 0xf686,
-	0xf509, 0xf174, 0xf2d6, 0xfb93, 0x040c, 0x04a0, 0xfef2, 0xfdb9,
-	0xfce7, 0xf8fd, 0xfa38, 0xfba0, 0x00a6, 0x06c6, 0x07a4, 0x0cd8,
-	0x1480, 0x1862, 0x18e6, 0x160d, 0x0f59, 0x0581, 0xfae3, 0xf6ba,
-	0xfbd3, 0x018e, 0x03e4, 0x0534, 0x039c, 0x00e4, 0xfe6d, 0xfe56,
-	0x0067, 0xfeb7, 0x004f, 0x066b, 0x0854, 0x044c, 0xfc46, 0xf7f0,
-	0xfbbf, 0x02d5, 0x09f2, 0x0e15, 0x0ba7, 0x033d, 0xf7fe, 0xf195,
-	0xf4bf, 0xfb67, 0xfdcc, 0xfc4e, 0xfab6, 0xfa55, 0xf9c0, 0xf5ed,
-	0xf233, 0xf306, 0xf28a, 0xf0f0, 0xf67a, 0xfd57, 0x0265, 0x0460,
-	0xffbf, 0xfbbf, 0xf613, 0xf540, 0x01d3, 0x08c8, 0x0560, 0xfc58,
-	0xeef8, 0xe751, 0xe594, 0xe80d, 0xf225, 0xfdc9, 0x0021, 0xff27,
-	0x0187, 0x04c5, 0x0862, 0x0bc2, 0x1161, 0x12c1, 0x08bf, 0xfcc2,
-	0xfac3, 0x02b1, 0x0a84, 0x0d5c, 0x0db8, 0x0e38, 0x0e5f, 0x119f,
-	0x19b0, 0x1e59, 0x1e5a, 0x18eb, 0x1084, 0x0a36, 0xffa6, 0xf7a7,
-	0xfb1e, 0xfe64, 0xfbe5, 0xf579, 0xef88, 0xefe7, 0xedd1, 0xec68,
-	0xf22c, 0xf8d5, 0xfaae, 0xfa0f, 0xfaf6, 0xf7a2, 0xf09c, 0xe62d,
-	0xe0a1, 0xe4f3, 0xe878, 0xeeba, 0xf9ee, 0x0528, 0x0a0f, 0x074c,
-	0x05bc, 0x02cd, 0xfa3c, 0xf78c, 0xfea9, 0x05fb, 0x0b07, 0x0a02,
-	0x03df, 0x02ff, 0x04dc, 0x0678, 0x0b5a, 0x0f5b, 0x0e67, 0x0af5,
-	0x07d4, 0x0a41, 0x0dde, 0x0e03, 0x1175, 0x17c2, 0x1616, 0x0b77,
-	0xfec9, 0xf1cf, 0xe937, 0xe4b1, 0xe326, 0xe5f9, 0xe929, 0xea95,
-	0xee0a, 0xf441, 0xf7c0, 0xf83e, 0xfa85, 0xff81, 0x01fa, 0xfdae,
-	0xf91b, 0xfc98, 0x0324, 0x038c, 0xfde8, 0xfb2f, 0xfab4, 0xfd01,
-	0x06e8, 0x1274, 0x1cfc, 0x2054, 0x1928, 0x11ca, 0x0c7c, 0x029e,
-	0xfa53, 0xfc29, 0x0244, 0x041e, 0xfee2, 0xfc52, 0xff5f, 0x002e,
-	0x0462, 0x06b0, 0xff85, 0xf78a, 0xf4cd, 0xf978, 0x032d, 0x05d8,
-	0xfe38, 0xf84d, 0xf752, 0xf7c1, 0xfb6c, 0x05a0, 0x0f56, 0x0d8c,
-	0x03ca, 0xff70, 0x0122, 0x0264, 0x057d, 0x072f, 0x058c, 0xfcc2,
-	0xef5e, 0xe7ed, 0xe895, 0xf186, 0xf991, 0xfd70, 0x0158, 0x01b6,
-	0xfffd, 0x013a, 0xfff9, 0xfbf4, 0xf90d, 0xf8a7, 0xfc4a, 0xfdce,
-	0xfcfc, 0xfb0e, 0xf8f1, 0xf5ee, 0xf076, 0xec42, 0xe985, 0xeb47,
-	0xf109, 0xf891, 0x016d, 0x07a2, 0x08f3, 0x095d, 0x0cca, 0x0df7,
-	0x0904, 0x01a7, 0x017e, 0x0425, 0x0038, 0xfb09, 0xf8fa, 0xfd94,
-	0x0a60, 0x1512, 0x1a09, 0x2095, 0x226d, 0x1e8b, 0x19b6, 0x1315,
-	0x0976, 0xfe79, 0xf8ea, 0xf912, 0xf7fa, 0xf530, 0xf99a, 0xfc56,
-	0xf9e4, 0xfa41, 0xf899, 0xf6fd, 0xf684, 0xf399, 0xf303, 0xf3fc,
-	0xef4c, 0xe739, 0xe421, 0xe7fb, 0xed97, 0xf1f9, 0xfb8b, 0x0476,
-	0x03d2, 0xff3c, 0xfb3a, 0xfd75, 0x0372, 0x08dd, 0x0cb0, 0x0c8d,
-	0x0737, 0x0060, 0xfbc0, 0xfacf, 0x002e, 0x0501, 0x08dd, 0x0b30,
-	0x067d, 0x0472, 0x0b40, 0x100e, 0x127b, 0x1225, 0x0cc0, 0x0a61,
-	0x0808, 0x0456, 0x0290, 0xff93, 0xf706, 0xeef6, 0xea15, 0xe653,
-	0xe981, 0xf105, 0xf6a3, 0xf829, 0xf52b, 0xf1d9, 0xf11a, 0xf53b,
-	0xfedc, 0x0527, 0x0413, 0x01b9, 0xff83, 0xfe4b, 0xfc7d, 0xf779,
-	0xf507, 0xf81e, 0xfe42, 0x04ed, 0x0d09, 0x181b, 0x1ffa, 0x20c4,
-	0x1b2b, 0x0f4d, 0x00ce, 0xf83f, 0xfa47, 0xff8d, 0x01a2, 0x0299,
-	0x0574, 0x08e2, 0x0954, 0x07b1, 0x0572, 0x0602, 0x0590, 0x0188,
-	0xfd4a, 0xf6c4, 0xefdb, 0xeb36, 0xedbe, 0xf2ed, 0xfa60, 0x049c,
-	0x0a9b, 0x0f9b, 0x0bfd, 0x033b, 0x03e5, 0x0711, 0x0641, 0x0316,
-	0xfbf9, 0xf5be, 0xf4f2, 0xf4d0, 0xf67e, 0xf86b, 0xf737, 0xf81e,
-	0xf961, 0xf933, 0xf9cb, 0xf7d7, 0xf5fe, 0xfbb6, 0x0048, 0x0013,
-	0x042e, 0x080f, 0x0747, 0x02d8, 0xf9c1, 0xef02, 0xe9df, 0xe87b,
-	0xea58, 0xefab, 0xf9c3, 0x03a1, 0x0868, 0x0c43, 0x08d1, 0x015e,
-	0xfc71, 0xfd4b, 0x00ce, 0x0050, 0x0030, 0x048c, 0x081e, 0x0557,
-	0x033a, 0x01cd, 0xffc2, 0xffcb, 0x021a, 0x0b4f, 0x18a2, 0x1ff0,
-	0x2071, 0x1d8b, 0x1457, 0x0736, 0xfd06, 0xf9a6, 0xfc35, 0xfeb8,
-	0xfefc, 0xffd6, 0xfe54, 0xf974, 0xf8d7, 0xfc6d, 0x00b6, 0x0038,
-	0xf991, 0xf256, 0xe9d9, 0xdfdd, 0xdedb, 0xe3e7, 0xe5df, 0xe902,
-	0xed87, 0xf50c, 0xfc7e, 0xfef7, 0x0246, 0x097a, 0x0d26, 0x0b3a,
-	0x0a43, 0x0828, 0x05c8, 0x048d, 0x01d0, 0xfda1, 0xfa93, 0xff60,
-	0x06b1, 0x0d2a, 0x120c, 0x0fc0, 0x0d87, 0x0b00, 0x07b1, 0x069c,
-	0x0517, 0x058f, 0x08dc, 0x0bec, 0x0cdc, 0x0909, 0xff74, 0xf4b8,
-	0xecbd, 0xe861, 0xe659, 0xe8ff, 0xeddb, 0xf2cb, 0xfb7c, 0x012b,
-	0x0069, 0xfeaa, 0xfc48, 0xf9c0, 0xf86d, 0xf72b, 0xf94c, 0xfe8f,
-	0xfefc, 0xf9cc, 0xf72f, 0xf7c4, 0xfa99, 0x02cc, 0x0c7d, 0x1335,
-	0x1257, 0x0e43, 0x0b78, 0x05a6, 0xffbb, 0xfe81, 0x0357, 0x0b07,
-	0x0eef, 0x1081, 0x11a4, 0x0a89, 0x0153, 0xfe94, 0x011d, 0x07de,
-	0x0979, 0x060b, 0x01d7, 0xfb1b, 0xf42d, 0xf00f, 0xee5e, 0xecea,
-	0xed2e, 0xf211, 0xfcf1, 0x051c, 0x0813, 0x0ae4, 0x0d31, 0x0e41,
-	0x0a2b, 0x03d9, 0xff21, 0xf9df, 0xf756, 0xf973, 0xf7a8, 0xf4a3,
-	0xf647, 0xfacd, 0x04ab, 0x09ab, 0x04a5, 0x0147, 0xffc6, 0xfb59,
-	0xf939, 0xf945, 0xf941, 0xfdfb, 0x01a7, 0xfec6, 0xf8cf, 0xf211,
-	0xefdf, 0xf113, 0xef88, 0xef21, 0xf310, 0xf8b4, 0x01f1, 0x0bd7,
-	0x09d1, 0xff35, 0xf894, 0xf74b, 0xf916, 0xfd11, 0x030e, 0x0670,
-	0x077a, 0x07c9, 0x030b, 0xfac4, 0xf507, 0xf58c, 0xff4f, 0x0fc6,
-	0x1d7a, 0x26a2, 0x26a4, 0x1dda, 0x12b3, 0x0430, 0xf8ae, 0xf853,
-	0xfb8d, 0xfb84, 0xff94, 0x06cc, 0x0b91, 0x0d9c, 0x0cdf, 0x08f9,
-	0x0184, 0xfa60, 0xf5a8, 0xf03c, 0xeabc, 0xe563, 0xdff2, 0xe074,
-	0xe265, 0xe4a3, 0xeb93, 0xf09b, 0xf230, 0xf135, 0xf180, 0xf915,
-	0x04be, 0x0c38, 0x11e9, 0x165c, 0x138a, 0x114e, 0x0db9, 0x02c5,
-	0xfc37, 0xfb4e, 0xfd6e, 0x07af, 0x127b, 0x1301, 0x0f68, 0x0ea4,
-	0x0e5c, 0x0a84, 0x036e, 0xfeed, 0xfcc5, 0xfdcf, 0x04d1, 0x0882,
-	0x0305, 0xfbf8, 0xf786, 0xf2ef, 0xeeb0, 0xec1f, 0xeaf6, 0xee01,
-	0xf621, 0xfcfd, 0xfbb1, 0xf7a3, 0xf850, 0xf7d8, 0xf8f4, 0xff88,
-	0x0406, 0x06a9, 0x06fe, 0x027e, 0xfa4c, 0xf28d, 0xf203, 0xf8a0,
-	0x02e0, 0x0ad4, 0x0c6a, 0x0a16, 0x075a, 0x047b, 0x0285, 0x0129,
-	0xff34, 0x011b, 0x0847, 0x0f4e, 0x11fb, 0x0f74, 0x0988, 0x0820,
-	0x090e, 0x09ce, 0x0d2f, 0x0ba3, 0x04c0, 0xfd5e, 0xf4fe, 0xea41,
-	0xe4fc, 0xe64c, 0xea81, 0xf207, 0xfa58, 0x0493, 0x0bfb, 0x0afd,
-	0x0828, 0x0890, 0x0577, 0x0233, 0x01cc, 0xfbda, 0xf868, 0xfa26,
-	0xfa30, 0xfe2d, 0x0640, 0x08ca, 0x07be, 0x05d5, 0x0368, 0x01e6,
-	0xffcd, 0x01ec, 0x03a6, 0xfdf8, 0xf922, 0xf8f6, 0xf9fd, 0xfa3a,
-	0xf92a, 0xf3aa, 0xe8de, 0xe0f8, 0xe1f6, 0xeb4e, 0xf8d0, 0x01b3,
-	0x0606, 0x0cf4, 0x0f07, 0x0678, 0xf9dc, 0xf0b1, 0xee94, 0xf264,
-	0xfaf4, 0x0459, 0x09b7, 0x09f3, 0x08aa, 0x0576, 0xff1d, 0xfaf2,
-	0xfb2f, 0x005c, 0x0baf, 0x1711, 0x1c23, 0x1c48, 0x163c, 0x0cf6,
-	0x054f, 0xffab, 0xfdc8, 0xfd23, 0xfe45, 0x047c, 0x08fd, 0x0880,
-	0x0917, 0x088b, 0x0704, 0x05af, 0x0055, 0xfb2b, 0xf8c5, 0xf481,
-	0xea55, 0xe22d, 0xe104, 0xe0fc, 0xe212, 0xe2e6, 0xe6e9, 0xedc0,
-	0xefe2, 0xf453, 0xfef9, 0x0918, 0x0e96, 0x0f2c, 0x0e55, 0x0eed,
-	0x0c80, 0x0834, 0x05a8, 0x0346, 0x034d, 0x095b, 0x1485, 0x17f0,
-	0x1187, 0x0c37, 0x091e, 0x05ad, 0xfe57, 0xf706, 0xf975, 0xfec1,
-	0x01dc, 0x07eb, 0x0b29, 0x05c7, 0xf8ff, 0xeede, 0xecda, 0xef83,
-	0xf271, 0xf263, 0xf49c, 0xf801, 0xf8eb, 0xfa4f, 0xfca5, 0xfeda,
-	0xfd1c, 0xf9aa, 0xfb52, 0xfe1f, 0xff96, 0x036b, 0x0659, 0x0438,
-	0xfe8a, 0xf817, 0xf898, 0xff40, 0x01d7, 0x016a, 0xff78, 0xfa73,
-	0xf669, 0xf774, 0x0095, 0x0c51, 0x10e9, 0x1190, 0x147b, 0x1540,
-	0x1230, 0x0dfd, 0x0867, 0x0567, 0x07f3, 0x075e, 0x02d9, 0x01dc,
-	0x010d, 0xfc8b, 0xf715, 0xf00a, 0xe84c, 0xe6c7, 0xece9, 0xf6b9,
-	0xfdb6, 0xfddd, 0xfda4, 0x02f9, 0x0728, 0x0598, 0x0467, 0x01cb,
-	0xfdb0, 0xfb4b, 0xf9e0, 0xfeb9, 0x0493, 0x053b, 0x0884, 0x0dc7,
-	0x0f1b, 0x0e2c, 0x0b16, 0x0881, 0x0736, 0x01a6, 0xfab7, 0xf5c1,
-	0xf46b, 0xf2f5, 0xf0f8, 0xed91, 0xe736, 0xe506, 0xe8f7, 0xf23c,
-	0xfa71, 0xfe11, 0xff35, 0x01dc, 0x03ac, 0x0159, 0xfdd8, 0xfae7,
-	0xf856, 0xf5c8, 0xfa8f, 0x0417, 0x08f1, 0x072e, 0x0159, 0xfd48,
-	0xfcec, 0xfd23, 0xfbbe, 0xfebd, 0x07b2, 0x1052, 0x15e3, 0x16e7,
-	0x1474, 0x0fb6, 0x08e8, 0x0175, 0xfeaa, 0xfe0e, 0xff3a, 0x04bc,
-	0x091e, 0x0cb6, 0x0e7c, 0x0f69, 0x0f39, 0x0a54, 0x0064, 0xf718,
-	0xf4c7, 0xf55d, 0xf610, 0xf819, 0xf601, 0xe94a, 0xdec2, 0xdd95,
-	0xe1f2, 0xe620, 0xe33b, 0xe349, 0xec10, 0xf7b0, 0x0284, 0x0c1f,
-	0x1221, 0x157f, 0x1489, 0x0d5b, 0x0821, 0x07ad, 0x09e7, 0x0e26,
-	0x12b2, 0x1246, 0x0d87, 0x0930, 0x089c, 0x0988, 0x06fb, 0x03e9,
-	0xfe73, 0xf981, 0xfb4c, 0xffae, 0x014d, 0xfeb5, 0xf796, 0xf171,
-	0xf2fe, 0xf803, 0xfabd, 0xf9ab, 0xf84d, 0xf8d3, 0xf4cc, 0xf0f7,
-	0xf743, 0x0008, 0x0343, 0x0171, 0xfcee, 0xfb61, 0xfe9a, 0x02a0,
-	0x04f9, 0x05b9, 0x024a, 0xf7ac, 0xefd3, 0xf363, 0xf821, 0xf95a,
-	0xf949, 0xf98e, 0xfe15, 0x0406, 0x09c0, 0x0e0b, 0x0c7c, 0x097a,
-	0x0c01, 0x1061, 0x10df, 0x0f20, 0x0e4c, 0x0f4d, 0x0f07, 0x09c2,
-	0x057b, 0x0666, 0x06e1, 0x0090, 0xf68f, 0xef9f, 0xeaab, 0xea56,
-	0xeec0, 0xf452, 0xf7fe, 0xf540, 0xf2d5, 0xf603, 0xfccb, 0x008c,
-	0xfd7e, 0xfb96, 0xfdb9, 0x0188, 0x0212, 0x0377, 0x0b5d, 0x11b5,
-	0x15da, 0x19ac, 0x160d, 0x0c6a, 0x046b, 0x0253, 0x0394, 0x011b,
-	0xfed1, 0xfe81, 0xfd1e, 0xf893, 0xeeb5, 0xe6cd, 0xe53f, 0xe3b6,
-	0xe130, 0xe59d, 0xf0fe, 0xf908, 0xfc5d, 0x0263, 0x07e9, 0x06b5,
-	0xffce, 0xf9e6, 0xfcb9, 0x0247, 0x02ac, 0x0048, 0xfdf4, 0xfdd7,
-	0xfe71, 0x02cc, 0x075c, 0x0682, 0x0226, 0xfb32, 0xfaa1, 0xfed2,
-	0x0472, 0x0d01, 0x135c, 0x12d2, 0x0c69, 0x0833, 0x0811, 0x070d,
-	0x05cb, 0x0674, 0x070e, 0x04fe, 0x0087, 0x0208, 0x0b50, 0x1367,
-	0x11ad, 0x0522, 0xfb11, 0xfb5c, 0xfee4, 0xfcbc, 0xf718, 0xef5e,
-	0xe550, 0xdfc6, 0xe15a, 0xe382, 0xe041, 0xdf35, 0xe3c8, 0xecb3,
-	0xfa1b, 0x04b9, 0x0a9c, 0x0d8a, 0x0f09, 0x0c59, 0x0838, 0x0ae5,
-	0x0e80, 0x1406, 0x1b33, 0x190c, 0x0fef, 0x0902, 0x0ad3, 0x100b,
-	0x0939, 0xfccb, 0xf96a, 0xfb12, 0xfc7e, 0xfd23, 0xfc35, 0xfc3a,
-	0xfd2b, 0xf8e2, 0xf4c9, 0xf651, 0xf4b1, 0xf222, 0xf3af, 0xf5fe,
-	0xf51d, 0xf579, 0xfda6, 0x0728, 0x0aaf, 0x08cc, 0x04b3, 0x00c8,
-	0xfb4a, 0xf89b, 0xfc74, 0xfc02, 0xf7d1, 0xf788, 0xf832, 0xf8d0,
-	0xf88b, 0xf69e, 0xf773, 0xfc07, 0xfd52, 0xfa51, 0xfea4, 0x077f,
-	0x0cd4, 0x0feb, 0x12d0, 0x1503, 0x11f3, 0x0e01, 0x0bef, 0x0b12,
-	0x0de0, 0x0fd6, 0x0d7b, 0x0826, 0x0221, 0x00b8, 0x00e7, 0x004c,
-	0x00bd, 0x015e, 0x05e1, 0x0822, 0x0365, 0xfb31, 0xf60f, 0xf5f2,
-	0xf390, 0xf014, 0xeee4, 0xf278, 0xf75f, 0xf947, 0xfaa7, 0xfbf7,
-	0xfdb6, 0xfdf3, 0xfe41, 0x042c, 0x0be2, 0x1053, 0x1403, 0x15cc,
-	0x1396, 0x0fb0, 0x0c10, 0x0a17, 0x0c2f, 0x0f01, 0x0e62, 0x0bc0,
-	0x07fc, 0x04f9, 0x02d4, 0xfced, 0xf22e, 0xe8fe, 0xe7da, 0xed6a,
-	0xf1de, 0xf2db, 0xf312, 0xf3b8, 0xf26b, 0xefa2, 0xf0e4, 0xf4b0,
-	0xf682, 0xf801, 0xfa2c, 0xff78, 0x0ba1, 0x1702, 0x1dd3, 0x206e,
-	0x20f8, 0x1ece, 0x1797, 0x1094, 0x0c4e, 0x0965, 0x02a6, 0xfcf2,
-	0xf9c5, 0xf6d7, 0xf70d, 0xf6aa, 0xf27b, 0xeaa9, 0xe427, 0xde41,
-	0xde71, 0xe5c9, 0xedb0, 0xf70e, 0xfc81, 0x0154, 0x0639, 0x05bd,
-	0x01cd, 0xfc01, 0xf91d, 0xfc9e, 0x027e, 0x05f2, 0x0744, 0x0554,
-	0x0359, 0xfde5, 0xf69f, 0xf524, 0xf655, 0xfbd7, 0x027e, 0x0611,
-	0x0888, 0x0b1d, 0x0bbb, 0x0a7e, 0x0870, 0x01cd, 0xfd5c, 0x00fe,
-	0x0601, 0x0c47, 0x12b7, 0x1193, 0x0edc, 0x0f33, 0x1163, 0x11ba,
-	0x0b67, 0x04a5, 0xff63, 0xf80f, 0xf102, 0xed88, 0xf031, 0xf2cb,
-	0xf279, 0xf0cc, 0xea84, 0xe536, 0xe3bc, 0xe1f7, 0xe29d, 0xe97d,
-	0xf07a, 0xf6eb, 0xffe0, 0x05b9, 0x0828, 0x0a0a, 0x0bf2, 0x0f0b,
-	0x128f, 0x17f3, 0x1e2e, 0x1e40, 0x19ce, 0x1559, 0x116e, 0x0b1c,
-	0x03c9, 0xff19, 0xf9d0, 0xf775, 0xf959, 0xfab9, 0xffb6, 0x0246,
-	0xf984, 0xf0e4, 0xeed6, 0xedd9, 0xed42, 0xf03c, 0xf42a, 0xf84d,
-	0xff85, 0x0522, 0x0831, 0x0bc6, 0x0b4e, 0x0714, 0x0132, 0xfc32,
-	0xf9c6, 0xf7e0, 0xf82e, 0xf9ee, 0xf7f1, 0xf3a5, 0xf735, 0xfecb,
-	0x009a, 0xff7d, 0xfd0e, 0xf5a0, 0xf19c, 0xf7a5, 0xffdc, 0x0a43,
-	0x1132, 0x118f, 0x1259, 0x0f34, 0x0914, 0x0536, 0x0468, 0x0850,
-	0x0d6a, 0x0cb1, 0x0924, 0x0556, 0xffa5, 0xfa87, 0xf668, 0xf4e6,
-	0xf2c3, 0xf16f, 0xf423, 0xf631, 0xf726, 0xf503, 0xf170, 0xf2be,
-	0xf470, 0xf0fd, 0xeef9, 0xf19b, 0xf800, 0x0124, 0x0a81, 0x1392,
-	0x1a24, 0x1ea6, 0x215e, 0x2153, 0x1cf4, 0x153d, 0x0e9f, 0x08f5,
-	0x03ea, 0x002d, 0xfc18, 0xf726, 0xf455, 0xf2e5, 0xede2, 0xea34,
-	0xe9e0, 0xe6a8, 0xe629, 0xec8c, 0xf0b9, 0xf18f, 0xf4d5, 0xfb50,
-	0x02ff, 0x04d2, 0x02e6, 0x0450, 0x0538, 0x06e4, 0x0a5d, 0x0bee,
-	0x0b42, 0x0868, 0x030f, 0xfd3a, 0xf9af, 0xf6d5, 0xf4d3, 0xf63a,
-	0xfabe, 0xfe7c, 0x019b, 0x02f7, 0xfead, 0xfa75, 0xf8eb, 0xf982,
-	0xfcb3, 0x0016, 0x03f5, 0x0965, 0x0d73, 0x0f19, 0x1163, 0x14d8,
-	0x1962, 0x18bb, 0x0f28, 0x04d6, 0xff10, 0xfcda, 0xfdad, 0x0059,
-	0xff88, 0xf9d8, 0xf558, 0xf4a2, 0xf5c0, 0xf4f0, 0xee78, 0xe5db,
-	0xe082, 0xe137, 0xe67d, 0xeb5e, 0xf071, 0xf800, 0xfc63, 0xfced,
-	0xfe6f, 0x0202, 0x08c6, 0x119a, 0x19be, 0x1af1, 0x1591, 0x1341,
-	0x154d, 0x15b2, 0x10cd, 0x0977, 0x03ac, 0xfff1, 0xfe0a, 0xfde0,
-	0x003c, 0x0284, 0x0131, 0xfe7a, 0xfb3f, 0xf6af, 0xf2cb, 0xefbe,
-	0xf209, 0xf870, 0xf9e9, 0xfc64, 0x0145, 0x0521, 0x089d, 0x0685,
-	0x004a, 0xf9e8, 0xf40f, 0xf117, 0xf13e, 0xf447, 0xf689, 0xf52b,
-	0xf709, 0xfb0c, 0xfd24, 0xff3f, 0xffa9, 0xff14, 0xfe3a, 0xfd50,
-	0x022e, 0x0929, 0x0bd4, 0x0f00, 0x1241, 0x12ca, 0x103f, 0x0bd6,
-	0x0967, 0x0a9e, 0x0bd9, 0x093d, 0x0732, 0x044a, 0xff4b, 0xfc63,
-	0xf8dd, 0xf459, 0xf275, 0xf25e, 0xf3d4, 0xf7bb, 0xf822, 0xf4f0,
-	0xf380, 0xf3e4, 0xf24a, 0xef61, 0xef89, 0xf042, 0xf53c, 0xfe3a,
-	0x059d, 0x0bf4, 0x115c, 0x17b3, 0x1e51, 0x206e, 0x1a87, 0x1024,
-	0x081d, 0x0653, 0x0756, 0x07e5, 0x0662, 0x0047, 0xf890, 0xf451,
-	0xf5f4, 0xf514, 0xf0dd, 0xf018, 0xee72, 0xec6d, 0xef83, 0xf332,
-	0xf664, 0xfc87, 0xffd6, 0xfe1a, 0xfd06, 0xff00, 0x015b, 0x02f5,
-	0x04dd, 0x05f6, 0x0537, 0x043a, 0x0311, 0x01cb, 0xfea5, 0xf7cd,
-	0xf32a, 0xf2c0, 0xf1e7, 0xf2af, 0xf8c8, 0x0066, 0x0455, 0x033e,
-	0x00dc, 0xfe7a, 0xfb3c, 0xfb6d, 0x043e, 0x0ceb, 0x0f16, 0x122c,
-	0x146f, 0x174f, 0x1b44, 0x19d5, 0x1619, 0x0f89, 0x0338, 0xf976,
-	0xf763, 0xf99f, 0xfb2a, 0xf893, 0xf669, 0xf753, 0xf820, 0xf479,
-	0xed57, 0xe9ee, 0xe74c, 0xe4cc, 0xe79d, 0xeb61, 0xeda9, 0xf2af,
-	0xfa1f, 0xff92, 0x00c2, 0xff20, 0x017c, 0x08f5, 0x1022, 0x1420,
-	0x159a, 0x15f1, 0x16f2, 0x17a4, 0x12ff, 0x0d6a, 0x0878, 0x0197,
-	0xff08, 0xfdeb, 0xf9f3, 0xf973, 0xfa6e, 0xfc78, 0xfed1, 0xf865,
-	0xef1c, 0xecc4, 0xf01b, 0xf508, 0xf85f, 0xfe8d, 0x0533, 0x0708,
-	0x0921, 0x0930, 0x0455, 0xff23, 0xfb3f, 0xfa94, 0xfb4f, 0xf8ef,
-	0xf716, 0xf6ee, 0xf7fe, 0xfa88, 0xfca1, 0xfe87, 0xffb2, 0xffa4,
-	0xfc24, 0xf9eb, 0xfc7a, 0xffc0, 0x0522, 0x0b2b, 0x0d87, 0x0c06,
-	0x06e8, 0x02fd, 0x05a8, 0x083f, 0x07eb, 0x0b02, 0x0afe, 0x07f4,
-	0x06b5, 0x044e, 0xfffb, 0xf827, 0xf1ae, 0xf01d, 0xf2e7, 0xf850,
-	0xf92b, 0xf9ad, 0xfce9, 0xfd82, 0xfd4b, 0xfa89, 0xf47b, 0xf194,
-	0xf20c, 0xf637, 0xfe14, 0x049e, 0x091a, 0x0ed1, 0x1636, 0x1bfa,
-	0x1b4e, 0x13ac, 0x0b27, 0x0727, 0x05a0, 0x0610, 0x072e, 0x0216,
-	0xfbf4, 0xfa4b, 0xf779, 0xf32b, 0xeff9, 0xeea1, 0xef04, 0xf0ec,
-	0xf15f, 0xefb1, 0xf1d4, 0xf979, 0x01bc, 0x05b2, 0x05e0, 0x04e5,
-	0x0508, 0x050e, 0x04b1, 0x06fb, 0x075f, 0x0660, 0x0669, 0x02fa,
-	0xfb3a, 0xf25c, 0xec7c, 0xed98, 0xf179, 0xf273, 0xf115, 0xf12d,
-	0xf685, 0xfb58, 0xfd29, 0xfa6f, 0xf44f, 0xf6ab, 0xfe4b, 0x07b5,
-	0x1116, 0x122a, 0x15ce, 0x1d30, 0x1ff8, 0x20ad, 0x1dbc, 0x1954,
-	0x1439, 0x0e11, 0x08d8, 0x04e2, 0xffb0, 0xf813, 0xf3b9, 0xf34d,
-	0xf356, 0xf3b1, 0xf304, 0xefa5, 0xec68, 0xea3d, 0xe850, 0xe73b,
-	0xe8be, 0xec8d, 0xeda7, 0xedd1, 0xef3a, 0xf33e, 0xfa1c, 0x009e,
-	0x089d, 0x0df2, 0x0eb7, 0x1287, 0x1962, 0x1d93, 0x1c94, 0x172d,
-	0x1024, 0x0a90, 0x06e0, 0x0571, 0x05d6, 0x0375, 0xfeb1, 0xfd14,
-	0xfe8d, 0xfd42, 0xf6d8, 0xf1f9, 0xf23c, 0xf535, 0xf66f, 0xf66e,
-	0xfb0b, 0x02c6, 0x0764, 0x08d0, 0x06d0, 0xffd6, 0xf939, 0xf508,
-	0xf330, 0xf2fc, 0xf1e9, 0xf18f, 0xf386, 0xf922, 0xfac1, 0xfb3c,
-	0x0000, 0x01a2, 0x03b7, 0x03d2, 0x00cb, 0xffd8, 0xfe4d, 0x00b1,
-	0x0953, 0x1099, 0x1242, 0x1059, 0x0e20, 0x0c0c, 0x092d, 0x06ae,
-	0x06e7, 0x0a87, 0x0a62, 0x039a, 0xfd21, 0xf6c6, 0xf0c2, 0xef88,
-	0xf018, 0xf14a, 0xf44a, 0xf510, 0xf6bd, 0xfd0e, 0x0084, 0xfc67,
-	0xf4c1, 0xf13c, 0xf18a, 0xf3cb, 0xf86a, 0xfc93, 0x00e2, 0x0579,
-	0x0bab, 0x14f6, 0x1aac, 0x18a3, 0x1392, 0x0f9f, 0x0e3a, 0x0e02,
-	0x0b46, 0x085a, 0x061d, 0x0091, 0xfaa5, 0xf7e8, 0xf76c, 0xf506,
-	0xf139, 0xf1d6, 0xf31d, 0xf29e, 0xf226, 0xf47b, 0xfc7a, 0x0065,
-	0xfccf, 0xfb52, 0xfea6, 0x01a9, 0x02c0, 0x0320, 0x00f1, 0xfea1,
-	0xfd7b, 0xfe4e, 0x022a, 0x002e, 0xf78e, 0xf1c6, 0xefde, 0xef42,
-	0xf279, 0xf929, 0xffdd, 0x0434, 0x0423, 0x01f2, 0xfef4, 0xf9fe,
-	0xf810, 0xfe54, 0x07ff, 0x0d64, 0x0f7e, 0x138f, 0x1917, 0x1bda,
-	0x180f, 0x121e, 0x0fa8, 0x09b9, 0x028a, 0xfe77, 0xfabc, 0xf76f,
-	0xf2e3, 0xf0f0, 0xf310, 0xf751, 0xf8c3, 0xf5a7, 0xf40b, 0xf1cd,
-	0xeec5, 0xec71, 0xec0e, 0xefa7, 0xf4bb, 0xf891, 0xfa4a, 0xf9bc,
-	0xfa37, 0xff81, 0x05ad, 0x0ba6, 0x102c, 0x125b, 0x1672, 0x194a,
-	0x1725, 0x113b, 0x0c9d, 0x09b4, 0x0537, 0xffe4, 0xfbd7, 0xfa8b,
-	0xf9d8, 0xfaa3, 0xff11, 0x0007, 0xf917, 0xefed, 0xed0d, 0xf1fe,
-	0xf6ae, 0xf81c, 0xfaf1, 0x016d, 0x08ec, 0x0c67, 0x0d25, 0x0c32,
-	0x0669, 0xfefe, 0xfabd, 0xfae3, 0xfbb7, 0xf8d2, 0xf74f, 0xf83e,
-	0xf770, 0xf7e0, 0xfc39, 0x00fc, 0x005b, 0xfbe8, 0xf8b1, 0xf721,
-	0xf64d, 0xf83b, 0xfee5, 0x075d, 0x0c0c, 0x0801, 0x02fc, 0x0370,
-	0x034a, 0x0287, 0x052b, 0x089b, 0x09a2, 0x09c2, 0x0951, 0x07a4,
-	0x0231, 0xf9f1, 0xf5aa, 0xf793, 0xfda1, 0x015d, 0x0266, 0x03bd,
-	0x03a6, 0x01f2, 0xfcee, 0xf91f, 0xf715, 0xf38c, 0xf267, 0xf26f,
-	0xf119, 0xf5ac, 0x0141, 0x0af2, 0x1242, 0x12c7, 0x0bb4, 0x0700,
-	0x05aa, 0x0550, 0x02ba, 0x007b, 0x0058, 0xff45, 0xfd0b, 0xfa71,
-	0xfb37, 0xfbba, 0xf92c, 0xf88f, 0xf909, 0xf903, 0xf9d5, 0xfdcf,
-	0x0561, 0x0a04, 0x07a1, 0x02e7, 0x0360, 0x05f0, 0x0320, 0x00e9,
-	0x0294, 0x0447, 0x0546, 0x03d8, 0x0033, 0xfa49, 0xf16b, 0xea50,
-	0xe756, 0xe5ea, 0xe646, 0xeaca, 0xf4c8, 0xfeff, 0x01b1, 0xfea3,
-	0xfb8a, 0xf8e8, 0xf52a, 0xf513, 0xfd1a, 0x06fe, 0x0c2e, 0x0fc0,
-	0x15e6, 0x1afc, 0x1e8e, 0x2125, 0x1ea7, 0x175a, 0x0da7, 0x05d2,
-	0x0482, 0x04d2, 0x0179, 0xfb1b, 0xf6f6, 0xf836, 0xf73d, 0xf2a2,
-	0xede2, 0xe99f, 0xea76, 0xed49, 0xef6f, 0xf0f5, 0xf0ef, 0xf22f,
-	0xf27f, 0xf084, 0xeef2, 0xef65, 0xf584, 0x01aa, 0x0a60, 0x0bf0,
-	0x0eb8, 0x13cb, 0x1703, 0x16ce, 0x13a0, 0x0ee9, 0x089c, 0x0419,
-	0x0378, 0x04bd, 0x0745, 0x07ac, 0x05fd, 0x0514, 0x0242, 0xfc19,
-	0xf724, 0xf70e, 0xf846, 0xf695, 0xf54d, 0xf941, 0x0129, 0x0707,
-	0x090e, 0x07d7, 0x044b, 0xffc9, 0xfc23, 0xfb5f, 0xfa6b, 0xf5e8,
-	0xef8b, 0xeb53, 0xe9d1, 0xebe5, 0xf3a9, 0xfcb8, 0xffcf, 0xfcdd,
-	0xfa81, 0xfcad, 0x015b, 0x049c, 0x0631, 0x0776, 0x0821, 0x08b8,
-	0x08d8, 0x0986, 0x0b30, 0x0c43, 0x0dbd, 0x0f93, 0x0ef1, 0x0b7d,
-	0x06fd, 0x02fb, 0x0063, 0xfa96, 0xf284, 0xf04e, 0xf311, 0xf522,
-	0xf51e, 0xf54e, 0xf860, 0xfcc4, 0xfe27, 0xfb9a, 0xf5fd, 0xeec5,
-	0xec2e, 0xef83, 0xf520, 0xfa07, 0xfd81, 0x041a, 0x0fe8, 0x1a88,
-	0x1cd0, 0x176f, 0x10a6, 0x0ca9, 0x0c5c, 0x0d2b, 0x0be7, 0x0841,
-	0x029c, 0xfdff, 0xfd29, 0xfb82, 0xf709, 0xf684, 0xfb15, 0xfc77,
-	0xf988, 0xf7dc, 0xfb78, 0x018d, 0x0369, 0x01c8, 0xff66, 0xfacb,
-	0xf4af, 0xf2fb, 0xf7e2, 0xfcb0, 0xfe48, 0xfed2, 0x00e9, 0x0359,
-	0xfff3, 0xf819, 0xf046, 0xea1e, 0xea7c, 0xf0b4, 0xf70e, 0xfde8,
-	0x0357, 0x044d, 0x03df, 0x0328, 0xff4d, 0xfbb5, 0xfbc9, 0xfc4b,
-	0xfd5c, 0x0287, 0x0b20, 0x1400, 0x1b88, 0x20dd, 0x2089, 0x1763,
-	0x0a57, 0x02eb, 0x0361, 0x0534, 0xff77, 0xf2a8, 0xeafb, 0xee56,
-	0xf4dc, 0xf74d, 0xf56e, 0xf2ff, 0xf3da, 0xf74d, 0xfa29, 0xfbf2,
-	0xfca7, 0xfbd6, 0xf800, 0xf326, 0xf265, 0xf472, 0xf89f, 0x012e,
-	0x0909, 0x0b40, 0x0973, 0x08f6, 0x0e30, 0x1407, 0x1319, 0x0b94,
-	0x00d8, 0xf918, 0xf947, 0xfc69, 0xfc0a, 0xfaa7, 0xfcda, 0x023b,
-	0x0404, 0xfe53, 0xf67b, 0xf2e9, 0xf55b, 0xfa40, 0xfdc2, 0x01f1,
-	0x0625, 0x070a, 0x07f0, 0x0b22, 0x0d72, 0x0b75, 0x0492, 0xff2b,
-	0xff56, 0x0013, 0xfdb9, 0xf7d5, 0xf184, 0xefea, 0xefc8, 0xef94,
-	0xf305, 0xf6ca, 0xf9b0, 0xfe19, 0xff40, 0xfc90, 0xfc02, 0xfef2,
-	0x033d, 0x0478, 0x00eb, 0xfd29, 0xfc65, 0x006f, 0x096c, 0x110e,
-	0x1180, 0x0d26, 0x094e, 0x0864, 0x08c0, 0x0653, 0xff25, 0xf827,
-	0xf6e8, 0xf8e5, 0xfa05, 0xfb95, 0x0182, 0x0a17, 0x0c21, 0x04f7,
-	0xfb49, 0xf243, 0xec76, 0xed09, 0xef09, 0xefaa, 0xf3c0, 0xfc46,
-	0x075e, 0x1192, 0x13a2, 0x0d2b, 0x0569, 0x03a8, 0x0762, 0x09b2,
-	0x0730, 0x001d, 0xf6c6, 0xf151, 0xf346, 0xf926, 0xfef8, 0x0227,
-	0x022d, 0x0117, 0x0091, 0x033c, 0x088c, 0x0d77, 0x0fbc, 0x0b6f,
-	0x048b, 0x0122, 0xff44, 0xffc7, 0x024b, 0x01a8, 0xfdf2, 0xf984,
-	0xf90a, 0xfe26, 0x00ac, 0xfc1e, 0xf295, 0xe7c9, 0xe39d, 0xe7a0,
-	0xec64, 0xf0bb, 0xf459, 0xf4d8, 0xf4e3, 0xf657, 0xf8bd, 0xf87a,
-	0xf67b, 0xf9df, 0x00f6, 0x05bf, 0x0c50, 0x1592, 0x1cb5, 0x246a,
-	0x286f, 0x222b, 0x1818, 0x11b0, 0x102e, 0x0eaf, 0x0a17, 0x0307,
-	0xf965, 0xf291, 0xf375, 0xf3ac, 0xf074, 0xf157, 0xf5f8, 0xf9c4,
-	0xfa45, 0xf884, 0xf48a, 0xf04c, 0xef72, 0xef0c, 0xecc2, 0xea10,
-	0xe8ca, 0xec18, 0xf682, 0x0270, 0x0869, 0x0b4a, 0x0ef3, 0x1377,
-	0x140e, 0x0ecb, 0x091e, 0x0496, 0x0125, 0xffde, 0xff3d, 0x004d,
-	0x0633, 0x0d5f, 0x108f, 0x0f2b, 0x074b, 0xfc8a, 0xf870, 0xfb97,
-	0xff0a, 0xffa3, 0x01c5, 0x02e8, 0xff9c, 0xfed5, 0x0327, 0x04ed,
-	0xfdce, 0xf5ec, 0xf395, 0xf30a, 0xf3ff, 0xf467, 0xf0e8, 0xed16,
-	0xece2, 0xede2, 0xf24a, 0xfa41, 0xfde6, 0xfc52, 0xfda5, 0x0325,
-	0x0786, 0x0aa0, 0x0e0f, 0x0fd2, 0x0b69, 0x0483, 0x02d2, 0x0486,
-	0x09c1, 0x102a, 0x11cc, 0x0d87, 0x06e9, 0x03f6, 0x069e, 0x08bb,
-	0x024e, 0xf64e, 0xef2c, 0xf0a3, 0xf33f, 0xf3fb, 0xf746, 0xfbfa,
-	0xff5b, 0xff89, 0xfd1a, 0xf894, 0xf2c7, 0xf108, 0xf2dc, 0xf35c,
-	0xf4bf, 0xf934, 0x011a, 0x0bf9, 0x1499, 0x14c9, 0x0f58, 0x0d12,
-	0x0df2, 0x0e77, 0x0d20, 0x0701, 0xfd5c, 0xf419, 0xf148, 0xf4b4,
-	0xf8cf, 0xfcc6, 0xff3b, 0xffa4, 0x00bc, 0x0356, 0x060e, 0x0a36,
-	0x0d03, 0x0a16, 0x04a6, 0xffbc, 0xfbca, 0xf8ed, 0xf7fe, 0xf916,
-	0xf9f1, 0xfa26, 0xfaa8, 0xfb91, 0xfc46, 0xfaae, 0xf6fa, 0xf3a9,
-	0xf2aa, 0xf3d3, 0xf4dc, 0xf56d, 0xf6b9, 0xf7fb, 0xf939, 0xfc53,
-	0xff26, 0xfd8a, 0xf94a, 0xf868, 0xfd7d, 0x0421, 0x08e0, 0x0d5c,
-	0x128b, 0x1610, 0x195d, 0x1ae4, 0x1562, 0x0c9e, 0x051d, 0x000e,
-	0xfd64, 0xfb15, 0xf882, 0xf8ab, 0xf95a, 0xf751, 0xf65d, 0xf596,
-	0xf6a8, 0xf950, 0xfb5f, 0xfe46, 0xfe52, 0xfdbf, 0xfd5a, 0xfcf6,
-	0xfbee, 0xf7ba, 0xf24d, 0xef78, 0xf33e, 0xfb09, 0x029f, 0x091c,
-	0x0df7, 0x0fa7, 0x1050, 0x0fde, 0x0a2c, 0x02f3, 0xfc81, 0xf7c7,
-	0xf5af, 0xf4a8, 0xf60c, 0xfb3f, 0x0225, 0x0669, 0x07ef, 0x07db,
-	0x04e1, 0x0266, 0x0339, 0x051d, 0x06ba, 0x0703, 0x0740, 0x080c,
-	0x0745, 0x05d5, 0x0159, 0xfa20, 0xf61e, 0xf557, 0xf526, 0xf448,
-	0xf32b, 0xf364, 0xf3cc, 0xf55a, 0xf7e1, 0xf9a6, 0xf988, 0xf5cd,
-	0xf3aa, 0xf61f, 0xfbcc, 0x04d1, 0x0b58, 0x0b83, 0x06f8, 0x00a7,
-	0xfcbc, 0xfee0, 0x04fc, 0x0aa8, 0x0d0f, 0x0a35, 0x06d8, 0x0571,
-	0x06a9, 0x0863, 0x04db, 0xfe9f, 0xfa5f, 0xf9f5, 0xfc3d, 0xff5b,
-	0x0010, 0xff2c, 0x0036, 0x00eb, 0x00e3, 0x0033, 0xfc63, 0xf62c,
-	0xf194, 0xf12b, 0xf440, 0xf867, 0xfdd9, 0x02e8, 0x066e, 0x0966,
-	0x0832, 0x052f, 0x047b, 0x0592, 0x060b, 0x028a, 0xfdb6, 0xfa5e,
-	0xf77b, 0xf557, 0xf515, 0xf4e9, 0xf5cf, 0xf8f5, 0xfe56, 0x074d,
-	0x0f3e, 0x146d, 0x187c, 0x185b, 0x14a0, 0x10b5, 0x0b4d, 0x0485,
-	0xfe33, 0xf899, 0xf70a, 0xf861, 0xf921, 0xf94b, 0xf82a, 0xf538,
-	0xf09b, 0xed4d, 0xed9b, 0xefdb, 0xf1f7, 0xf271, 0xf087, 0xed44,
-	0xed05, 0xf259, 0xf9c4, 0xfe0a, 0xfd99, 0xfabb, 0xf9f6, 0xfef2,
-	0x06d5, 0x0d7d, 0x11c9, 0x1458, 0x1739, 0x19ff, 0x1948, 0x1360,
-	0x0ea1, 0x0c25, 0x088e, 0x0442, 0xfed6, 0xfc9a, 0xfd70, 0xfed3,
-	0xffc5, 0xfe64, 0xfbfe, 0xf8dd, 0xf765, 0xf7b8, 0xf8d5, 0xf96a,
-	0xf817, 0xf603, 0xf1e4, 0xee9e, 0xed14, 0xed4f, 0xf13a, 0xf8d1,
-	0xffd2, 0x02af, 0x042e, 0x05c1, 0x09ac, 0x0e5d, 0x0f26, 0x0a80,
-	0x0226, 0xfa27, 0xf5ec, 0xf794, 0xfb48, 0xff6b, 0x0395, 0x0780,
-	0x0af6, 0x0d49, 0x1003, 0x120c, 0x11e5, 0x0d64, 0x0966, 0x07f4,
-	0x053d, 0x0287, 0xffe9, 0xfe10, 0xfa2c, 0xf2fe, 0xedf0, 0xed4c,
-	0xeec5, 0xf030, 0xf25e, 0xf3b6, 0xf428, 0xf4c5, 0xf543, 0xf653,
-	0xf612, 0xf29f, 0xf0b1, 0xf4b5, 0xfb54, 0x01ae, 0x06d5, 0x0ae0,
-	0x0d6c, 0x0e22, 0x0e6a, 0x0cf5, 0x0ac5, 0x091b, 0x0961, 0x0ae8,
-	0x0b5d, 0x0ba6, 0x0a84, 0x07b6, 0x03ef, 0xfce3, 0xf666, 0xf72a,
-	0xfc3c, 0xff31, 0xff52, 0xfd86, 0xfbb7, 0xfcd1, 0x00ad, 0x02a5,
-	0xff02, 0xf580, 0xeaef, 0xe76e, 0xeaa1, 0xf155, 0xf8ee, 0xfcc7,
-	0xffe6, 0x051f, 0x08d5, 0x0ba8, 0x0e5c, 0x0d3f, 0x09f6, 0x07b6,
-	0x0419, 0xff01, 0xfa80, 0xf8be, 0xf867, 0xf855, 0xf925, 0xf941,
-	0xfc5f, 0x03d9, 0x0bea, 0x13d6, 0x16cf, 0x159c, 0x1459, 0x124f,
-	0x101d, 0x0b55, 0x0188, 0xfab5, 0xf9d3, 0xf740, 0xf2b2, 0xeffb,
-	0xeef8, 0xeee1, 0xf04b, 0xf060, 0xee11, 0xecce, 0xeca4, 0xef55,
-	0xf481, 0xf884, 0xf96b, 0xf8fe, 0xf99c, 0xf78a, 0xf490, 0xf5b6,
-	0xfd8c, 0x0865, 0x0e1a, 0x0ec8, 0x0db9, 0x0b91, 0x0ddd, 0x16cb,
-	0x19d0, 0x13a6, 0x0a6b, 0x0255, 0x00a6, 0x016c, 0x0056, 0xff60,
-	0x00b0, 0x02ea, 0x027b, 0xff5a, 0xfd54, 0xfaee, 0xf737, 0xf685,
-	0xf650, 0xf641, 0xf614, 0xf764, 0xfb23, 0xfa63, 0xf803, 0xf679,
-	0xf5d3, 0xfa03, 0xffe4, 0x0205, 0x01cb, 0x033d, 0x072e, 0x09cb,
-	0x087d, 0x048f, 0xfd72, 0xf841, 0xf71a, 0xf723, 0xf7b5, 0xf8da,
-	0xfc8f, 0x0206, 0x091a, 0x0f5a, 0x118d, 0x10af, 0x0d27, 0x0829,
-	0x0503, 0x07dc, 0x0ac0, 0x07ec, 0x0259, 0xfec4, 0xfb73, 0xf6b5,
-	0xf5fc, 0xf8cb, 0xf9f5, 0xf5ea, 0xef05, 0xeae2, 0xeb73, 0xf1ce,
-	0xf9ca, 0xfdd6, 0xff01, 0xfb2b, 0xf4a8, 0xf464, 0xf6ba, 0xf7c7,
-	0xfbd1, 0x03dc, 0x0c48, 0x0f90, 0x0f42, 0x0d90, 0x0a17, 0x083c,
-	0x0932, 0x0985, 0x0623, 0x0133, 0xff31, 0xfef6, 0xfca6, 0xfa59,
-	0xf8e2, 0xfc4f, 0x0527, 0x07f4, 0x0457, 0x0169, 0x01d9, 0x0342,
-	0x0358, 0x0073, 0xf94d, 0xf3af, 0xf28a, 0xf4fc, 0xf794, 0xf772,
-	0xf809, 0xfbd9, 0x01d4, 0x0833, 0x0c83, 0x0b52, 0x0707, 0x01a1,
-	0xfb21, 0xf79e, 0xf8ed, 0xfc1c, 0xfc87, 0xfa64, 0xf693, 0xf1c8,
-	0xf21d, 0xf917, 0x00f1, 0x06a7, 0x08e9, 0x08f9, 0x0d19, 0x1476,
-	0x1b36, 0x1da5, 0x1c85, 0x1759, 0x0adc, 0xff09, 0xf862, 0xf708,
-	0xf7c6, 0xf83b, 0xfa33, 0xfb2b, 0xf76a, 0xf214, 0xedaf, 0xe977,
-	0xead2, 0xeeb6, 0xf218, 0xf6fb, 0xf871, 0xf65e, 0xf591, 0xf6c1,
-	0xf5ca, 0xf560, 0xf9e4, 0xff0b, 0x00ab, 0x0071, 0x03f0, 0x0b67,
-	0x11f9, 0x14d1, 0x146b, 0x11c5, 0x0b5d, 0x052f, 0x046a, 0x0369,
-	0xffd1, 0xfd94, 0x0052, 0x0891, 0x0e83, 0x0d65, 0x0934, 0x0405,
-	0xfc6c, 0xf5a7, 0xf302, 0xf256, 0xf283, 0xf23f, 0xf41a, 0xf4fe,
-	0xf3cb, 0xf590, 0xfaf1, 0x02c5, 0x0596, 0x0214, 0x011c, 0x01ba,
-	0x0121, 0x0157, 0xffc2, 0xfbd0, 0xf73f, 0xf410, 0xf4b3, 0xf8a9,
-	0xfb9c, 0xfeb8, 0x059c, 0x0a6b, 0x0bf9, 0x0c50, 0x0ba8, 0x0a44,
-	0x0a39, 0x0bac, 0x0d7d, 0x11be, 0x1137, 0x0b24, 0x0644, 0x016d,
-	0xfc3c, 0xf784, 0xf527, 0xf370, 0xf079, 0xec32, 0xeaea, 0xeeac,
-	0xf2ef, 0xf7f1, 0xfa78, 0xf8e0, 0xf64e, 0xf49f, 0xf4ed, 0xf7ba,
-	0xfaa1, 0xf9ca, 0xf888, 0xfd87, 0x07ec, 0x0ff5, 0x1418, 0x131c,
-	0x0e54, 0x0a55, 0x07d3, 0x0762, 0x07ff, 0x0727, 0x05b6, 0x05b1,
-	0x02f3, 0xfcb4, 0xf845, 0xfa28, 0x00eb, 0x03ec, 0x03d2, 0x04c3,
-	0x0452, 0x0247, 0xff8f, 0xfbec, 0xf74a, 0xf1c3, 0xee15, 0xee40,
-	0xf08a, 0xf1e1, 0xf2c0, 0xf791, 0x02d2, 0x0d7e, 0x0e96, 0x08cf,
-	0x034f, 0x0040, 0xfdd7, 0xfba5, 0xfd1c, 0xfe00, 0xfa9d, 0xf92a,
-	0xfa9f, 0xfc12, 0xfed2, 0x03c2, 0x0779, 0x06f5, 0x0447, 0x0359,
-	0x062e, 0x0beb, 0x119f, 0x136c, 0x1134, 0x0f1f, 0x0bf8, 0x07ad,
-	0x0637, 0x03e7, 0xfbc8, 0xf373, 0xf2ea, 0xf5cb, 0xf550, 0xf11d,
-	0xecc3, 0xec12, 0xeb43, 0xeb26, 0xf057, 0xf90b, 0xfdbd, 0xfd55,
-	0xfd78, 0xfc8b, 0xf89b, 0xf53e, 0xf853, 0xfefb, 0x02ce, 0x03e3,
-	0x0567, 0x0942, 0x0e21, 0x1178, 0x114b, 0x0e36, 0x084c, 0x01ec,
-	0xfe3a, 0xfc84, 0xfb51, 0xfadf, 0xffc2, 0x08e8, 0x0d9e, 0x0c46,
-	0x0876, 0x0576, 0x028a, 0xfd17, 0xf835, 0xf4fb, 0xef06, 0xe9aa,
-	0xec5d, 0xf40d, 0xf9ce, 0xfcb4, 0x0053, 0x0498, 0x0607, 0x059e,
-	0x03f1, 0x02cb, 0x0430, 0x0452, 0x02e3, 0xff72, 0xfadd, 0xf73c,
-	0xf4e3, 0xf554, 0xf77f, 0xfb27, 0xffaa, 0x0530, 0x0ae2, 0x0ae6,
-	0x066b, 0x0393, 0x0495, 0x075d, 0x08e1, 0x0929, 0x096f, 0x0762,
-	0x0617, 0x08c2, 0x07e2, 0x01c7, 0xfad7, 0xf417, 0xf0ac, 0xef5d,
-	0xedee, 0xef3c, 0xf457, 0xf8e9, 0xf911, 0xf926, 0xfb2a, 0xfdc2,
-	0xffe1, 0xff43, 0xfd98, 0xfa52, 0xf6d1, 0xfa5c, 0x0275, 0x080b,
-	0x088b, 0x0626, 0x059a, 0x066b, 0x0741, 0x09b3, 0x0c61, 0x0b87,
-	0x0731, 0x0394, 0x0266, 0xff55, 0xfb62, 0xfaee, 0xfc7d, 0xfea6,
-	0xffd4, 0x0396, 0x0a22, 0x0c24, 0x0ae4, 0x0779, 0xff6d, 0xf469,
-	0xec39, 0xeb9a, 0xef37, 0xf301, 0xf65f, 0xfa50, 0x003b, 0x0693,
-	0x0955, 0x07e0, 0x047d, 0xff51, 0xf9f6, 0xf719, 0xf73a, 0xf5f6,
-	0xf439, 0xf822, 0xfc2a, 0xfdd8, 0xff95, 0x021c, 0x055e, 0x05f0,
-	0x0378, 0x0157, 0x0189, 0x0370, 0x0791, 0x0cfe, 0x0fc6, 0x106a,
-	0x1001, 0x1008, 0x10dc, 0x0efd, 0x095d, 0x038b, 0xff40, 0xfb16,
-	0xf73d, 0xf31e, 0xf004, 0xee73, 0xed79, 0xee25, 0xef44, 0xf1e5,
-	0xf64c, 0xf95e, 0xfa88, 0xfa65, 0xf7c5, 0xf490, 0xf54b, 0xf9cf,
-	0xfc7a, 0xfc4b, 0xfe2a, 0x0095, 0x01e6, 0x0494, 0x06cf, 0x069f,
-	0x037b, 0x0022, 0xff4e, 0xffa3, 0x013c, 0x0388, 0x0469, 0x06fd,
-	0x0a69, 0x09a9, 0x0959, 0x0c4f, 0x0e51, 0x0c8a, 0x078a, 0x00fe,
-	0xf82a, 0xf196, 0xf1c9, 0xf73c, 0xfc76, 0xfcdc, 0xfb4c, 0xfc98,
-	0x005c, 0x0542, 0x0a2c, 0x0c16, 0x0af1, 0x07d5, 0x02f2, 0xfd2b,
-	0xf80c, 0xf468, 0xf236, 0xf2c3, 0xf361, 0xf373, 0xf7ba, 0xff90,
-	0x08ff, 0x0f6f, 0x0eee, 0x0adb, 0x065e, 0x037b, 0x018e, 0x00e7,
-	0x0420, 0x070e, 0x06c7, 0x06c6, 0x060f, 0x0269, 0xfe00, 0xf9e9,
-	0xf627, 0xf0e8, 0xebf9, 0xeac2, 0xecd7, 0xf16e, 0xf50d, 0xf70c,
-	0xf8ca, 0xfc40, 0x00ba, 0x0192, 0x007c, 0xfe33, 0xf7f9, 0xf35d,
-	0xf5ec, 0xfc44, 0x01e0, 0x05a7, 0x0934, 0x0d2e, 0x109e, 0x1412,
-	0x14d0, 0x1172, 0x0b17, 0x04e1, 0x0478, 0x0583, 0x025b, 0xfde5,
-	0xfa39, 0xf7be, 0xf8f4, 0xfd74, 0x019a, 0x0554, 0x071a, 0x0576,
-	0x01fa, 0xfb5d, 0xf47f, 0xf24d, 0xf2a6, 0xf334, 0xf583, 0xf6d9,
-	0xf767, 0xfad7, 0xfdce, 0xfd92, 0xfcb9, 0xfdbc, 0xfe19, 0xfd07,
-	0xfee1, 0x019d, 0x02aa, 0x03bd, 0x040e, 0x01bb, 0xff11, 0xfe5c,
-	0x010b, 0x05ee, 0x08f7, 0x0aeb, 0x09c6, 0x0608, 0x0664, 0x0852,
-	0x0759, 0x062b, 0x065d, 0x05a2, 0x05c6, 0x07db, 0x0b03, 0x0c8e,
-	0x09a6, 0x03cb, 0xfe8c, 0xfa8b, 0xf51c, 0xf03f, 0xed6a, 0xe932,
-	0xe5f3, 0xe7f5, 0xed1e, 0xf232, 0xf8b8, 0x01be, 0x08d4, 0x08d7,
-	0x006e, 0xf714, 0xf354, 0xf3da, 0xf816, 0xfe26, 0x00a2, 0x01a5,
-	0x018a, 0xfed1, 0xffeb, 0x02be, 0x0158, 0x0012, 0x01cd, 0x0275,
-	0xff1a, 0xfe7c, 0x04ff, 0x0aa0, 0x0aba, 0x09d5, 0x0bfe, 0x0dfc,
-	0x0d20, 0x0b8e, 0x05ef, 0xfad1, 0xf32e, 0xf1fe, 0xf426, 0xf77d,
-	0xf91e, 0xfbe8, 0x0387, 0x0c65, 0x0fd6, 0x0e59, 0x0b5d, 0x06a6,
-	0x0218, 0xff7a, 0xfe51, 0xfce3, 0xf831, 0xf36d, 0xf2e4, 0xf4d0,
-	0xf640, 0xf8d9, 0xfdcc, 0x0301, 0x05b9, 0x05a8, 0x07a7, 0x09e2,
-	0x092b, 0x0628, 0x031b, 0x01ed, 0xfe95, 0xfdaf, 0x00ea, 0x01ad,
-	0xfe5b, 0xf94e, 0xf4e0, 0xf1d0, 0xf229, 0xf3ca, 0xf693, 0xfb6b,
-	0xfcf9, 0xf96a, 0xf454, 0xf320, 0xf67c, 0xf9f4, 0xfe43, 0x0365,
-	0x02cb, 0xfd7e, 0xfb81, 0xfdd8, 0xfee2, 0xfe48, 0x007d, 0x02d7,
-	0x047f, 0x08ae, 0x0d5b, 0x0fb7, 0x1000, 0x0d65, 0x0bbe, 0x0d7d,
-	0x0a81, 0x02ad, 0xfc63, 0xf8c2, 0xf7fe, 0xf61d, 0xf5b1, 0xfb16,
-	0x0027, 0x03b6, 0x08df, 0x0b99, 0x06a3, 0xfc8f, 0xf500, 0xf357,
-	0xf3c1, 0xf45a, 0xf55b, 0xf736, 0xfabf, 0xfc77, 0xfdcd, 0x004e,
-	0x012c, 0x0004, 0xfe89, 0xfdff, 0xfc76, 0xfb28, 0xff5c, 0x0640,
-	0x0752, 0x036f, 0x0061, 0x00c9, 0x02f7, 0x0402, 0x0560, 0x0748,
-	0x06d2, 0x0471, 0x0097, 0xfe57, 0xffb5, 0x0120, 0x0522, 0x0d8e,
-	0x13c9, 0x1231, 0x0d16, 0x08dd, 0x0406, 0xff44, 0xfa48, 0xf6cf,
-	0xf4aa, 0xf19c, 0xee72, 0xec0a, 0xec07, 0xee44, 0xf1e7, 0xf675,
-	0xfbe0, 0xfd81, 0xfb97, 0xfa42, 0xfbd3, 0xfd01, 0xfad3, 0xfb85,
-	0xfbbe, 0xf880, 0xf8fb, 0xfc71, 0xfd95, 0xfa72, 0xf6e7, 0xf8e3,
-	0xff9a, 0x0523, 0x08ac, 0x0c78, 0x0f21, 0x0ee3, 0x0b1d, 0x0884,
-	0x0a5c, 0x0b9e, 0x0a0b, 0x082f, 0x06ab, 0x01e3, 0xfb37, 0xfa8c,
-	0xfd95, 0xfc7d, 0xf841, 0xf4c4, 0xf5d6, 0xfb6d, 0x0248, 0x08b3,
-	0x0bf1, 0x0b94, 0x0812, 0x06b4, 0x0693, 0x01b4, 0xfb62, 0xf781,
-	0xf680, 0xf3da, 0xf114, 0xf1b1, 0xf542, 0xfaf3, 0x0047, 0x087f,
-	0x0ef7, 0x0eaa, 0x0c27, 0x0831, 0x043b, 0x01d6, 0xfdbe, 0xf9c3,
-	0xfc39, 0x0091, 0x0060, 0xfd9d, 0xfae5, 0xf91e, 0xf6a7, 0xf35a,
-	0xf2b5, 0xf373, 0xf616, 0xf981, 0xfa35, 0xf9ec, 0xf94d, 0xfb4c,
-	0xff11, 0x0131, 0x035e, 0x02c4, 0xfeb1, 0xfd49, 0xfd6c, 0xfd2e,
-	0xff18, 0x0119, 0x02f3, 0x066a, 0x0bae, 0x0f5f, 0x0d96, 0x08f1,
-	0x07bc, 0x0abb, 0x0be2, 0x0706, 0xff93, 0xfae6, 0xf8df, 0xf8ac,
-	0xfab8, 0xfd30, 0xfedc, 0xfeb7, 0xfd92, 0xfd30, 0xfc04, 0xf9e8,
-	0xf9d2, 0xfb71, 0xfba8, 0xf880, 0xf313, 0xf004, 0xf4a5, 0xfd4c,
-	0x0218, 0x01d7, 0xff09, 0xfaff, 0xfa20, 0xfd27, 0x0043, 0x01ed,
-	0x031e, 0x0538, 0x05e3, 0x04b4, 0x019a, 0xff1a, 0xff7d, 0xff40,
-	0xffad, 0x0089, 0x0223, 0x065f, 0x0a88, 0x0adf, 0x0923, 0x063a,
-	0x0246, 0x0237, 0x0665, 0x0ab6, 0x09d1, 0x0637, 0x0496, 0x0583,
-	0x05b9, 0x02b3, 0xff36, 0xfa64, 0xf468, 0xef9a, 0xee7c, 0xef01,
-	0xeecb, 0xf132, 0xf66d, 0xfd39, 0x01c6, 0x0170, 0xff2b, 0xfd25,
-	0xfb41, 0xfa0f, 0xf94b, 0xf83f, 0xf83a, 0xf8e1, 0xf8ce, 0xf9b5,
-	0xfb57, 0xfcf6, 0x0176, 0x0655, 0x059d, 0x020c, 0x01c2, 0x062a,
-	0x0c84, 0x116f, 0x112c, 0x0c5d, 0x084a, 0x05f8, 0x0576, 0x03c5,
-	0xff5c, 0xfad9, 0xf8ac, 0xfa69, 0xfabc, 0xf840, 0xf4ea, 0xf563,
-	0xfc55, 0x0323, 0x069d, 0x06fc, 0x0740, 0x085f, 0x06f6, 0x0222,
-	0xfc1e, 0xf6e3, 0xf33b, 0xf47e, 0xf75d, 0xf611, 0xf3df, 0xf556,
-	0xfb46, 0x0157, 0x0434, 0x061f, 0x07b2, 0x0869, 0x0889, 0x0776,
-	0x052a, 0x01ed, 0xff46, 0x006c, 0x02bc, 0x0040, 0xfa67, 0xf5e7,
-	0xf698, 0xf97b, 0xf872, 0xf77c, 0xf9a4, 0xfbf7, 0xfbf2, 0xfc98,
-	0xfeb3, 0xff39, 0x001e, 0x017e, 0x00e3, 0xfeb8, 0xfc82, 0xfce6,
-	0x01b0, 0x068d, 0x085c, 0x08dc, 0x07af, 0x05af, 0x0502, 0x0668,
-	0x085c, 0x071f, 0x0488, 0x063b, 0x0acf, 0x0a86, 0x05a3, 0x0086,
-	0xfcf5, 0xfcb0, 0xfd54, 0xfd21, 0xfcac, 0xfbd1, 0xf9d3, 0xf8e9,
-	0xf9f6, 0xfa79, 0xf8a1, 0xf63a, 0xf572, 0xf4a6, 0xf326, 0xf201,
-	0xf504, 0xfa37, 0xfd69, 0xfefa, 0xfef2, 0xfeee, 0x005e, 0x0372,
-	0x0335, 0xfe39, 0xf7fe, 0xf5f2, 0xfb4f, 0x0271, 0x05e9, 0x037d,
-	0xfffe, 0xffd5, 0x01a3, 0x0392, 0x0517, 0x05fd, 0x0518, 0x056b,
-	0x0750, 0x08b5, 0x07ce, 0x06a2, 0x07ac, 0x07d4, 0x05ed, 0x03bf,
-	0x05ba, 0x0b02, 0x0e2e, 0x0b20, 0x0452, 0xfe6b, 0xf933, 0xf655,
-	0xf66a, 0xf629, 0xf493, 0xf2c8, 0xf4c9, 0xf8fe, 0xf9a3, 0xf7aa,
-	0xf527, 0xf47d, 0xf753, 0xfab4, 0xfc96, 0xfda7, 0xff45, 0x00ab,
-	0xff9e, 0xfcb5, 0xf988, 0xf73b, 0xf839, 0xfafb, 0xfa46, 0xf7c9,
-	0xf99d, 0x0171, 0x094b, 0x0e35, 0x1123, 0x112b, 0x0f9b, 0x0e21,
-	0x0ce9, 0x0915, 0x02ff, 0xfca4, 0xf8e9, 0xfb21, 0xff40, 0xffb7,
-	0xfbf6, 0xf8ab, 0xf950, 0xfbc8, 0xfdca, 0x003b, 0x034e, 0x0629,
-	0x0956, 0x0a5f, 0x07a2, 0x02e2, 0xfdf6, 0xf9c4, 0xf6e2, 0xf5a2,
-	0xf5b1, 0xf85c, 0xfcec, 0xfec9, 0xfd59, 0xfcad, 0xfdbb, 0xffa2,
-	0x02dc, 0x0679, 0x079e, 0x0463, 0x0082, 0xff78, 0xff6c, 0xfe44,
-	0xfb7b, 0xf7fe, 0xf76c, 0xfa1d, 0xfad0, 0xf83f, 0xf5f8, 0xf513,
-	0xf544, 0xf7cc, 0xfc13, 0xfee2, 0x0060, 0x037a, 0x0570, 0x042c,
-	0x0254, 0x02cf, 0x05ec, 0x08d2, 0x09d9, 0x093e, 0x077e, 0x05c3,
-	0x05b7, 0x05a9, 0x0560, 0x02d0, 0xff04, 0xff5a, 0x01de, 0x0417,
-	0x023c, 0xfbf1, 0xf7e3, 0xf849, 0xfada, 0xfe13, 0x00a9, 0x01c9,
-	0x0328, 0x02bb, 0xfee0, 0xf9bb, 0xf3f0, 0xf07b, 0xf160, 0xf54e,
-	0xfa18, 0xfef5, 0x0228, 0x03c5, 0x0476, 0x0315, 0x0175, 0x0084,
-	0x0118, 0x01d5, 0x0111, 0xfddf, 0xf98c, 0xf8ff, 0xfb2c, 0xfe92,
-	0x02ac, 0x0314, 0x01a4, 0x0270, 0x02eb, 0x01a4, 0xff7e, 0xfd2b,
-	0xfd19, 0x008a, 0x0659, 0x0c3b, 0x0d33, 0x088a, 0x038a, 0x0126,
-	0x017c, 0x037b, 0x0555, 0x077e, 0x09e9, 0x0aeb, 0x09cd, 0x06fd,
-	0x022d, 0xfc4c, 0xf763, 0xf40e, 0xf259, 0xf24b, 0xf39f, 0xf4bc,
-	0xf48e, 0xf2eb, 0xf16a, 0xf0d9, 0xf276, 0xf78e, 0xfd0c, 0x0029,
-	0xff19, 0xfc4c, 0xfc81, 0xfedd, 0xfdbe, 0xf7f2, 0xf4d0, 0xf6bb,
-	0xf954, 0xfb9c, 0xfe94, 0x0075, 0x01db, 0x04cd, 0x09e4, 0x0fcf,
-	0x144d, 0x17ac, 0x1941, 0x1741, 0x0fcd, 0x04df, 0xfd0d, 0xfc20,
-	0x0040, 0x02c4, 0x01fd, 0xfe47, 0xf7fe, 0xf5fe, 0xfb73, 0xffdf,
-	0xfe22, 0xfbfe, 0xfe50, 0x0415, 0x070f, 0x0311, 0xfaef, 0xf530,
-	0xf3e4, 0xf455, 0xf8c2, 0xfead, 0x0061, 0xfec3, 0xfc79, 0xfb1e,
-	0xf9c0, 0xf945, 0xfd5b, 0x051a, 0x0932, 0x08f9, 0x0848, 0x07c4,
-	0x08cd, 0x08ba, 0x0505, 0xff3a, 0xfa32, 0xf6ea, 0xf67d, 0xf843,
-	0xf72d, 0xf397, 0xf1d7, 0xf446, 0xf7e9, 0xf9f4, 0xfb7a, 0xfe43,
-	0x01c6, 0x0304, 0x02b9, 0x016f, 0xfea1, 0xfd67, 0x007f, 0x061e,
-	0x0b3f, 0x0d88, 0x0c95, 0x0b9d, 0x09aa, 0x0456, 0xfe82, 0xfce9,
-	0xffe9, 0x0384, 0x0590, 0x0514, 0x011e, 0xfbf2, 0xf9a4, 0xfbbe,
-	0x0000, 0x013e, 0xfeba, 0xfc7c, 0xfd19, 0xfde4, 0xfab3, 0xf4b4,
-	0xf0d2, 0xf24d, 0xf7db, 0xfd9e, 0xffae, 0xfdc1, 0xfbe2, 0xfd67,
-	0xffc7, 0xffd5, 0xff11, 0xfed6, 0xff60, 0xfe23, 0xfa7e, 0xf711,
-	0xf6d3, 0xfaaf, 0xffaf, 0x04ff, 0x0872, 0x07f3, 0x06f6, 0x07db,
-	0x0897, 0x05e7, 0xffe1, 0xfda1, 0x044f, 0x0c9e, 0x0faf, 0x0be6,
-	0x0675, 0x0608, 0x083f, 0x0994, 0x0734, 0x02f8, 0x009c, 0x0148,
-	0x04c0, 0x0579, 0x011f, 0xfc71, 0xf88d, 0xf407, 0xf16a, 0xf081,
-	0xf2d8, 0xf720, 0xf87b, 0xf768, 0xf413, 0xf11e, 0xef47, 0xf011,
-	0xf511, 0xf984, 0xfb7a, 0xfe20, 0x03f0, 0x095b, 0x08f9, 0x0357,
-	0xfd82, 0xf976, 0xf882, 0xf93c, 0xf8c8, 0xfa83, 0xfd91, 0x011f,
-	0x0680, 0x0cd2, 0x1176, 0x125b, 0x1321, 0x1284, 0x0dc4, 0x0761,
-	0x013d, 0xfdf2, 0xfe8c, 0x0065, 0x0279, 0x0232, 0xfe30, 0xfabb,
-	0xf97a, 0xfb13, 0xfc1a, 0xfa85, 0xfb11, 0xfec0, 0x0353, 0x0314,
-	0xfdef, 0xf9f0, 0xf8b3, 0xfaaa, 0xff12, 0x00d3, 0xfeff, 0xfc5b,
-	0xfb5c, 0xfdf9, 0xffe6, 0xfedf, 0xfd20, 0xfc5b, 0xfe76, 0x0088,
-	0x00cd, 0x0210, 0x048d, 0x07a1, 0x0749, 0x0273, 0xfd9d, 0xf8e3,
-	0xf776, 0xf87d, 0xf56d, 0xf20a, 0xf204, 0xf5a7, 0xfb1d, 0xfe38,
-	0xfe2a, 0xfcdc, 0xfe55, 0x0324, 0x06a6, 0x065a, 0x0312, 0x0051,
-	0x020b, 0x05c8, 0x09b2, 0x0c86, 0x0c0c, 0x0b40, 0x0aa3, 0x0929,
-	0x0605, 0x0277, 0x006e, 0x00cd, 0x01f0, 0xff26, 0xfafd, 0xf9fb,
-	0xfa05, 0xf943, 0xf851, 0xf858, 0xfbd3, 0x00f7, 0x048a, 0x05e1,
-	0x0276, 0xfb9d, 0xf4f0, 0xf1ad, 0xf30b, 0xf5e5, 0xf6b1, 0xf586,
-	0xf6f4, 0xfbe6, 0x01f0, 0x0635, 0x0726, 0x03c1, 0xfeb5, 0xfbf0,
-	0xf82a, 0xf491, 0xf523, 0xfa72, 0x02ce, 0x093f, 0x0a88, 0x0882,
-	0x06e0, 0x0684, 0x0544, 0x0284, 0xfefd, 0xfd3c, 0xff11, 0x041a,
-	0x097a, 0x0b67, 0x094a, 0x07d8, 0x09d7, 0x0bba, 0x09ee, 0x03e6,
-	0xff43, 0x002a, 0x03e7, 0x0529, 0x01d2, 0xfde1, 0xfa2b, 0xf7b5,
-	0xf752, 0xf642, 0xf4fa, 0xf668, 0xfb43, 0xfeb4, 0xfca5, 0xf7ca,
-	0xf401, 0xf1ba, 0xf075, 0xf01c, 0xf185, 0xf598, 0xfbf6, 0x020e,
-	0x03be, 0x0198, 0xfdb5, 0xfb94, 0xfd0e, 0xfd7f, 0xf9ef, 0xf4a9,
-	0xf5ab, 0xfd9d, 0x069b, 0x0e71, 0x1240, 0x115f, 0x0e63, 0x0dc1,
-	0x0f12, 0x0ed2, 0x0cbb, 0x08bb, 0x0638, 0x05fc, 0x04b6, 0x026f,
-	0x003e, 0xfdfe, 0xfadc, 0xf799, 0xf666, 0xf7d6, 0xfa99, 0xfec8,
-	0x0254, 0x008f, 0xfa45, 0xf525, 0xf494, 0xf644, 0xf7e8, 0xf9bf,
-	0xfaac, 0xfc35, 0x0173, 0x06ed, 0x091a, 0x06e5, 0xff9f, 0xf8b4,
-	0xf632, 0xf84c, 0xfad0, 0xfae7, 0xfce6, 0x025c, 0x085b, 0x0a90,
-	0x08a7, 0x04c6, 0xffe1, 0xfb72, 0xf6f4, 0xf26a, 0xf032, 0xf287,
-	0xf6f2, 0xfb49, 0xfeb1, 0xff37, 0x007a, 0x0521, 0x08b5, 0x0677,
-	0x007e, 0xfc7c, 0xfd44, 0x0298, 0x0793, 0x09b0, 0x0860, 0x04e4,
-	0x059b, 0x0908, 0x0ab9, 0x089a, 0x0323, 0xffee, 0x0032, 0xffac,
-	0xfce5, 0xfa58, 0xfa3d, 0xfa55, 0xf9dc, 0xfc78, 0x0124, 0x0415,
-	0x07a7, 0x0ab4, 0x08dd, 0x0217, 0xfacf, 0xf81c, 0xf76e, 0xf44f,
-	0xf0dd, 0xeee4, 0xf0f2, 0xf71a, 0xfc01, 0xfdcf, 0xfc78, 0xfa09,
-	0xf968, 0xfb09, 0xfca0, 0xfa91, 0xf636, 0xf649, 0xfbed, 0x01ab,
-	0x0640, 0x08f6, 0x086e, 0x0620, 0x05f1, 0x07c6, 0x0816, 0x075c,
-	0x0605, 0x077b, 0x0afc, 0x0be9, 0x0b46, 0x0b4c, 0x0d15, 0x0cc6,
-	0x06f8, 0x0192, 0x0078, 0x02a6, 0x0626, 0x0729, 0x035c, 0xfaa0,
-	0xf284, 0xf0b6, 0xf228, 0xf4a0, 0xf674, 0xf680, 0xf79b, 0xfbfe,
-	0xffe3, 0x0046, 0xfd6d, 0xf709, 0xefcf, 0xeca3, 0xede4, 0xef51,
-	0xf0e9, 0xf4f2, 0xfc0f, 0x02b1, 0x03f8, 0x0548, 0x075e, 0x06db,
-	0x0315, 0xfcec, 0xf9a6, 0xfadb, 0xfeff, 0x03d3, 0x078e, 0x0b6d,
-	0x0d03, 0x0db2, 0x10f9, 0x1163, 0x0c9f, 0x066c, 0x0151, 0x0095,
-	0x02ba, 0x040e, 0x034a, 0x002b, 0xfca9, 0xfb59, 0xfd29, 0xff47,
-	0xfe96, 0xfc9a, 0xfbd5, 0xfc9c, 0xfb19, 0xf751, 0xf64f, 0xf804,
-	0xf89f, 0xf86f, 0xfb3e, 0x00be, 0x06dd, 0x0bdc, 0x0db9, 0x0b14,
-	0x0378, 0xfb29, 0xf6be, 0xf761, 0xf94a, 0xf7e7, 0xf7a7, 0xfb10,
-	0xff35, 0x0272, 0x03cd, 0x0394, 0x01b8, 0xfe8a, 0xfc29, 0xfb24,
-	0xf87e, 0xf46c, 0xf397, 0xf6bf, 0xfadd, 0xfd8b, 0xfe6c, 0x0015,
-	0x015f, 0x0105, 0x01c1, 0x041c, 0x05db, 0x0629, 0x06eb, 0x08bd,
-	0x07f4, 0x0624, 0x0806, 0x0a9d, 0x0a14, 0x0654, 0x0123, 0x0025,
-	0x0322, 0x0455, 0x02a2, 0xfdd5, 0xf84f, 0xf3eb, 0xf2e8, 0xf72c,
-	0xfc8b, 0xffb3, 0x0097, 0x03a5, 0x0700, 0x06ec, 0x0550, 0x003f,
-	0xfa22, 0xf4c7, 0xf12f, 0xf0ba, 0xf210, 0xf6c5, 0xf9b4, 0xfb6d,
-	0xfd6c, 0xfd6c, 0xfed0, 0x0440, 0x0982, 0x07b5, 0x027a, 0xfec5,
-	0xfdba, 0xff1e, 0x01ab, 0x036e, 0x037f, 0x04b1, 0x06f9, 0x09c1,
-	0x0a62, 0x0809, 0x03e7, 0x00c6, 0x0266, 0x05a7, 0x06a8, 0x0633,
-	0x0762, 0x065f, 0x02af, 0x023b, 0x049e, 0x05d0, 0x03af, 0xff46,
-	0xfa47, 0xf6be, 0xf487, 0xf543, 0xf776, 0xf943, 0xf9cf, 0xf8f6,
-	0xfdee, 0x0471, 0x0599, 0x063a, 0x02d5, 0xfaf7, 0xf2e2, 0xed70,
-	0xef6c, 0xf23f, 0xf1f0, 0xf362, 0xf5d3, 0xf878, 0xfbb6, 0xfd9d,
-	0xfe94, 0xffe3, 0xfff6, 0xfda9, 0xfd1d, 0xfe3a, 0xfdfb, 0xfdae,
-	0x0134, 0x04ff, 0x049d, 0x042a, 0x05e5, 0x0783, 0x072b, 0xfee9,
-	0xe473, 0xe70a, 0x0b65, 0x1772, 0x15f9, 0x037d, 0xfc79, 0x12d1,
-	0x0ea3, 0x0b10, 0x0a74, 0xf851, 0xf46c, 0xf5e4, 0xfbcc, 0x0155,
-	0xf6d7, 0xee4f, 0xece7, 0xef89, 0xf388, 0xec08, 0xce97, 0xcd9d,
-	0xfe03, 0x0f33, 0x1310, 0x1342, 0x0553, 0x11c0, 0xff64, 0xf78e,
-	0x1656, 0x16df, 0x174e, 0x0ef2, 0x000a, 0x0a85, 0x04b2, 0xf7be,
-	0xfdd9, 0x024b, 0xf5f6, 0xd4a0, 0xceed, 0xf582, 0x0dc0, 0x0c12,
-	0x0dfa, 0x159d, 0x1266, 0x04d7, 0x0574, 0x1a4c, 0x24e6, 0x156e,
-	0x09ce, 0x1315, 0x1e23, 0x1893, 0x0b36, 0x097c, 0x0935, 0x0364,
-	0xf761, 0xf351, 0xfe63, 0xf9b4, 0xee24, 0xf02f, 0xf3c5, 0xfbbc,
-	0x042d, 0x095a, 0x16eb, 0x1f68, 0x1e8e, 0x1be3, 0x1a1e, 0x18a6,
-	0x0e78, 0xff15, 0xf1cf, 0xea14, 0xeab4, 0xec5b, 0xec6f, 0xf00c,
-	0xf422, 0xf80f, 0xfdd4, 0xffc5, 0xfcd9, 0xfe71, 0xfe2f, 0xf8af,
-	0xf55d, 0xf24f, 0xf2f1, 0xf53a, 0xf2d6, 0xf250, 0xf770, 0xfb2b,
-	0xfd06, 0x0076, 0x03a5, 0x042f, 0x008b, 0xfd8c, 0xff4d, 0x01e3,
-	0x0373, 0x03cf, 0x0505, 0x084e, 0x0b20, 0x0d5d, 0x0f55, 0x0f7a,
-	0x0fe2, 0x12b6, 0x1167, 0x097f, 0x0364, 0xfb33, 0xf499, 0xf349,
-	0xe8e1, 0xe576, 0xe856, 0xe051, 0xe12a, 0xe46c, 0xd7df, 0xd606,
-	0xdedd, 0xd9b7, 0xd3f0, 0xcfc9, 0xcee9, 0xd896, 0xdd2c, 0xdfcd,
-	0xe6e6, 0xec15, 0xf494, 0x052e, 0x1270, 0x2057, 0x2ec5, 0x2fb9,
-	0x31ba, 0x3785, 0x3876, 0x37ec, 0x3734, 0x34b6, 0x3589, 0x2e3a,
-	0x1828, 0x0eed, 0x03af, 0xefdd, 0xed11, 0xe869, 0xe305, 0xef47,
-	0xf37d, 0xf010, 0xf66b, 0xf84b, 0xf45f, 0xeb24, 0xde88, 0xddbd,
-	0xdc1a, 0xcd0d, 0xc3d4, 0xc699, 0xcd3b, 0xd4ea, 0xda44, 0xdf5a,
-	0xeaa6, 0xf51a, 0xfa4e, 0x0308, 0x0e19, 0x16ea, 0x19d7, 0x1da5,
-	0x281c, 0x2b6e, 0x2f9c, 0x385c, 0x37ef, 0x3985, 0x37d0, 0x28c3,
-	0x1bbf, 0x12af, 0x0783, 0xfee1, 0xf8aa, 0xf411, 0xfc69, 0x0789,
-	0x0577, 0x06f7, 0x0d1f, 0x09cb, 0x0315, 0xfbd4, 0xf561, 0xf26f,
-	0xece8, 0xe7f7, 0xec1c, 0xf22a, 0xf222, 0xf0ae, 0xf1be, 0xf500,
-	0xf9f4, 0xfaf3, 0xf5ba, 0xf828, 0xfe94, 0xfadc, 0xf92f, 0x0003,
-	0x04d8, 0x0808, 0x11fc, 0x1a7b, 0x1f88, 0x2733, 0x2910, 0x3003,
-	0x3934, 0x300b, 0x1e72, 0x1037, 0x0532, 0xfdc6, 0xf94b, 0xf321,
-	0xf28d, 0xfe27, 0x0367, 0x0184, 0x062b, 0x0823, 0x03a2, 0xfaa5,
-	0xf021, 0xed26, 0xea3c, 0xe207, 0xe344, 0xedbd, 0xf200, 0xf4a1,
-	0xf774, 0xf5c8, 0xf6f1, 0xf8a5, 0xf64b, 0xf541, 0xf5cd, 0xf570,
-	0xf65b, 0xfb29, 0x05a8, 0x0b53, 0x0d09, 0x1958, 0x23d1, 0x24b4,
-	0x2242, 0x270a, 0x30a6, 0x24dd, 0x0c01, 0x0210, 0x00b3, 0xf9cf,
-	0xf310, 0xf341, 0xf81e, 0xffd1, 0x020e, 0x0050, 0x0469, 0x0223,
-	0xf6a6, 0xef8f, 0xeda8, 0xeb7a, 0xe469, 0xdef4, 0xe4a4, 0xf00d,
-	0xf1b0, 0xef0a, 0xf4fd, 0xf4cc, 0xefd0, 0xf272, 0xf28f, 0xf2a3,
-	0xf7aa, 0xf845, 0xfc58, 0x02b6, 0x006e, 0x0269, 0x0af4, 0x1371,
-	0x1bc7, 0x2079, 0x20f8, 0x22bc, 0x2789, 0x21ab, 0x105b, 0x0447,
-	0x0174, 0xfd3c, 0xf4c3, 0xf505, 0xfe8c, 0x0354, 0x0162, 0x017e,
-	0x0605, 0x020e, 0xf514, 0xedfa, 0xebc7, 0xe9ea, 0xe579, 0xe4e8,
-	0xecb1, 0xf1ee, 0xf2c6, 0xf05c, 0xf2bb, 0xf785, 0xefb5, 0xeab9,
-	0xf068, 0xefec, 0xf073, 0xf4bd, 0xf4ed, 0xffba, 0x0a41, 0x07b5,
-	0x0e4d, 0x1804, 0x1a39, 0x22b7, 0x264b, 0x20cf, 0x19e3, 0x0557,
-	0xfc69, 0x02cc, 0xf6e1, 0xf2db, 0xfc81, 0xfeb1, 0x0800, 0x0a36,
-	0x02f8, 0x083c, 0x0320, 0xf1ba, 0xecd3, 0xe97b, 0xe2b9, 0xe579,
-	0xea89, 0xf0f3, 0xfab8, 0xf80d, 0xf287, 0xf5b3, 0xf506, 0xef2e,
-	0xeabe, 0xec3d, 0xf15e, 0xf101, 0xef8b, 0xf778, 0x0090, 0x0095,
-	0x00a7, 0x0b3b, 0x1458, 0x0fb1, 0x106a, 0x1f7e, 0x2973, 0x27dd,
-	0x1d31, 0x08ed, 0xfe03, 0xfe6a, 0xf4d2, 0xefe4, 0xf8af, 0x002e,
-	0x073e, 0x08cd, 0x062e, 0x091f, 0x0373, 0xf59d, 0xef28, 0xed5b,
-	0xe701, 0xe201, 0xe8f1, 0xf226, 0xf9a3, 0xfc7d, 0xf8f9, 0xfa77,
-	0xfa56, 0xf213, 0xef68, 0xf1e1, 0xefdf, 0xf03b, 0xf576, 0xfcb6,
-	0x02a9, 0x01a0, 0x057d, 0x106e, 0x10d3, 0x0cdc, 0x1175, 0x1567,
-	0x15ed, 0x1dd4, 0x2a0b, 0x1d81, 0xff0b, 0xfd9e, 0x03ad, 0xf99f,
-	0xf5e9, 0xf480, 0xfcd3, 0x060f, 0xfc48, 0x0145, 0x0cc9, 0xfb20,
-	0xf07f, 0xf313, 0xecc0, 0xeba0, 0xe8c5, 0xeb53, 0xfb00, 0xfa48,
-	0xf509, 0xfcd8, 0xfcd2, 0xf9ad, 0xf56e, 0xef84, 0xf765, 0xf8a3,
-	0xf29e, 0xfcfc, 0x07ca, 0x09c3, 0x0abb, 0x0d03, 0x0e30, 0x095c,
-	0x09a8, 0x0d28, 0x0b96, 0x110b, 0x154f, 0x1214, 0x1923, 0x1d12,
-	0x1300, 0x088e, 0xfc3b, 0xf614, 0xf701, 0xf074, 0xeeb9, 0xf518,
-	0xf747, 0xfbed, 0x0046, 0xfd25, 0xf908, 0xf53d, 0xf139, 0xecd3,
-	0xeb9c, 0xef32, 0xf1cb, 0xf7ff, 0xfc29, 0xf96b, 0xff91, 0x01ec,
-	0xfb16, 0xfcc3, 0xfe79, 0xfc6e, 0xfcd3, 0xfdfa, 0x0202, 0x04b6,
-	0x0679, 0x0a06, 0x09fd, 0x0a64, 0x0ce0, 0x0d60, 0x0dfe, 0x105d,
-	0x1072, 0x1104, 0x1050, 0x0885, 0x02e2, 0x0197, 0xff77, 0xfbaa,
-	0xf814, 0xf7f5, 0xf873, 0xf6dc, 0xf6bf, 0xf9be, 0xfa6e, 0xf68e,
-	0xf348, 0xf40b, 0xf4cc, 0xf28a, 0xf432, 0xf769, 0xf7b8, 0xf9f7,
-	0xf9dc, 0xfa75, 0xff1f, 0xfd34, 0xfd51, 0x0251, 0xff4b, 0x002b,
-	0x04f5, 0x0373, 0x00e0, 0xfe84, 0x024f, 0x0728, 0x0520, 0x09a5,
-	0x0eda, 0x093d, 0x0a0b, 0x0e3c, 0x09f2, 0x08e1, 0x0bac, 0x09e6,
-	0x0497, 0x042f, 0x0327, 0xfc3e, 0xfb16, 0xfb42, 0xf978, 0xf869,
-	0xf462, 0xf4dd, 0xfa5d, 0xfaed, 0xf892, 0xf979, 0xfb19, 0xf89b,
-	0xf432, 0xf636, 0xfbc6, 0xfc1c, 0xfcc8, 0xffd1, 0x0088, 0x0201,
-	0x01c8, 0x00de, 0x04a6, 0x0595, 0x02da, 0x05fa, 0x096e, 0x0692,
-	0x041e, 0x043e, 0x0623, 0x0164, 0xf73a, 0xfc16, 0x0158, 0xfd5f,
-	0x0309, 0x05b9, 0x00d2, 0x0055, 0x0154, 0x0391, 0xff82, 0xfc6b,
-	0x08af, 0x0a1e, 0x055d, 0x0a83, 0x0258, 0xfadb, 0xfb42, 0xf34f,
-	0xee54, 0xf02e, 0xf8cf, 0x005d, 0xfdbb, 0x03a8, 0x08db, 0x013a,
-	0x01a8, 0x0224, 0xfbc6, 0xf946, 0xfa28, 0xff1a, 0x02b4, 0x06c1,
-	0x0d67, 0x0eeb, 0x0e42, 0x0ab1, 0x05d6, 0x03d3, 0xfcf0, 0xf971,
-	0xf9b3, 0xf5a3, 0xf8bd, 0xfbb8, 0xf8ff, 0xfad3, 0xfbcb, 0xf9d5,
-	0xf4e0, 0xef0b, 0xeffa, 0xf29f, 0xf327, 0xf8da, 0x0187, 0x0407,
-	0x027c, 0x03bd, 0x0498, 0x0264, 0x058f, 0x0a3c, 0x0b63, 0x0ec7,
-	0x0d97, 0x057b, 0x033f, 0x0562, 0x0246, 0xfe8e, 0xff3a, 0x0322,
-	0x06fb, 0x0a44, 0x0bd1, 0x0a98, 0x09d0, 0x08e0, 0x04ed, 0xfd33,
-	0xf7a5, 0xf9e3, 0xfd74, 0xfcf7, 0xfc0b, 0xfdfc, 0xff77, 0xfc68,
-	0xf911, 0xf6e0, 0xf57e, 0xf372, 0xf153, 0xf202, 0xf1fc, 0xf4e7,
-	0xfb8c, 0xfd01, 0xfba6, 0x0080, 0x0364, 0xfd25, 0xfa63, 0xfc74,
-	0xf75c, 0xf148, 0xf6d9, 0xfb1d, 0xfb25, 0x05ce, 0x0a28, 0x07e8,
-	0x0e4a, 0x1198, 0x0e72, 0x097e, 0x0a6a, 0x0ddb, 0x0b66, 0x0e98,
-	0x1495, 0x12e5, 0x1331, 0x0e3a, 0x026e, 0xfc01, 0xf4cf, 0xf2a0,
-	0xf34d, 0xf246, 0xf6d2, 0xf648, 0xf6c3, 0x0005, 0xff7b, 0xfb01,
-	0xfc70, 0xf859, 0xf3c1, 0xf0c5, 0xf23d, 0xf8a8, 0xf6d5, 0xfa14,
-	0x021a, 0x0149, 0x0123, 0x0017, 0x0075, 0x01f4, 0xfa88, 0xf72e,
-	0xfbe0, 0xf93b, 0xf943, 0x0059, 0x00e1, 0x0295, 0x07ab, 0x0709,
-	0x0478, 0x0206, 0x005a, 0x0161, 0xffb7, 0xff01, 0x024b, 0x0404,
-	0x09e3, 0x107c, 0x0f1d, 0x106a, 0x0e7a, 0x040e, 0xff6f, 0xf4ec,
-	0xec1c, 0xeead, 0xece8, 0xf3bc, 0xfc76, 0xfcef, 0x0402, 0x0766,
-	0x04bd, 0x030f, 0xfc44, 0xf761, 0xf36b, 0xef5b, 0xf343, 0xf60e,
-	0xfd2c, 0x05be, 0x03f2, 0x0848, 0x0943, 0xffb9, 0xfd62, 0xf987,
-	0xf28a, 0xf2e5, 0xf2d9, 0xf6e1, 0xfeea, 0xff78, 0x040d, 0x0656,
-	0x03f4, 0x05d1, 0x00a6, 0x0084, 0x01d5, 0xfc6b, 0x044b, 0x0b39,
-	0x0cd7, 0x1761, 0x1945, 0x1651, 0x0d57, 0xf708, 0xf373, 0xf22e,
-	0xe642, 0xef0b, 0xf524, 0xf486, 0xff7f, 0x0460, 0x0649, 0x05f9,
-	0xff5a, 0xf978, 0xf340, 0xf016, 0xeec6, 0xf03b, 0xf62f, 0xfbd2,
-	0x0208, 0x0796, 0x05b7, 0x01d7, 0x0285, 0xfc6b, 0xf5b1, 0xf846,
-	0xf754, 0xf53e, 0xfba7, 0x04cf, 0x0659, 0x0385, 0x09ad, 0x0de5,
-	0x0624, 0x0a4a, 0x1475, 0x1317, 0x1b16, 0x2546, 0x1bcb, 0x03c7,
-	0xf44b, 0xf6a6, 0xed60, 0xe139, 0xee17, 0xf81d, 0xf822, 0x035a,
-	0x0c0f, 0x076a, 0xfec6, 0xfb26, 0xf6ec, 0xe81b, 0xe27b, 0xecf5,
-	0xeeb1, 0xedd2, 0xfdb8, 0x066d, 0xff59, 0xff9d, 0x00a0, 0xf936,
-	0xf129, 0xf1ad, 0xf83b, 0xf37b, 0xf330, 0x01df, 0x03bd, 0x0211,
-	0x0d8d, 0x155e, 0x124b, 0x12be, 0x1f59, 0x2493, 0x25c9, 0x2723,
-	0x1477, 0x0459, 0xfe2b, 0xf526, 0xf22e, 0xee10, 0xf0f0, 0xfd94,
-	0x0204, 0x075d, 0x07e3, 0x0119, 0x0045, 0xf51b, 0xe86c, 0xe509,
-	0xe179, 0xe7ab, 0xecb4, 0xf34e, 0x033c, 0x032f, 0xff51, 0x012d,
-	0xf774, 0xef9c, 0xeeed, 0xed57, 0xf10b, 0xf7e7, 0xfbdc, 0x011c,
-	0x0645, 0x07d0, 0x092d, 0x0991, 0x0f04, 0x12cd, 0x1361, 0x2248,
-	0x2bc8, 0x267f, 0x2015, 0x1623, 0x08da, 0xf959, 0xf3fc, 0xf8c0,
-	0xf065, 0xefac, 0x043e, 0x0499, 0xff11, 0x0b81, 0x0576, 0xf605,
-	0xf27c, 0xec33, 0xe54c, 0xe25c, 0xe51e, 0xf114, 0xf4c0, 0xf60b,
-	0x00ec, 0xfa2f, 0xf206, 0xf6e0, 0xee79, 0xeb3f, 0xf216, 0xf3be,
-	0xf915, 0xfe6c, 0x063b, 0x0cf5, 0x0c0c, 0x118f, 0x1578, 0x1480,
-	0x1bd0, 0x24a8, 0x274c, 0x224b, 0x1fcc, 0x1a91, 0x04cf, 0xf989,
-	0xf8d1, 0xf1d6, 0xf2a7, 0xf6bd, 0xfdd1, 0x0095, 0xff0b, 0x0783,
-	0xfdf5, 0xefd8, 0xf3fc, 0xebb7, 0xe20e, 0xe7ac, 0xe8a8, 0xeb6a,
-	0xf59b, 0xfa38, 0xfc3c, 0xf79d, 0xf378, 0xf62f, 0xee71, 0xec87,
-	0xf4a5, 0xf37c, 0xf714, 0x02cb, 0x060a, 0x05f3, 0x0be6, 0x13cf,
-	0x1490, 0x12ee, 0x1e22, 0x2585, 0x22dc, 0x245a, 0x21a6, 0x1b7c,
-	0x0d3b, 0x010d, 0x01f9, 0xf54c, 0xee1e, 0xf9ff, 0xfdb7, 0xfffe,
-	0x02c4, 0x02a6, 0xfca6, 0xf168, 0xf10e, 0xeb00, 0xe0ca, 0xe3d4,
-	0xe6dc, 0xeddc, 0xf1ae, 0xf31c, 0xfb78, 0xf2b2, 0xee90, 0xf27e,
-	0xe6a3, 0xea61, 0xf0eb, 0xf09e, 0xfca2, 0xff73, 0x04e4, 0x0e69,
-	0x0c02, 0x12e1, 0x16c6, 0x1161, 0x1a9f, 0x22ab, 0x1fdd, 0x20f7,
-	0x21fa, 0x1ed6, 0x1703, 0x0de3, 0x0b3c, 0x0468, 0xf67a, 0xf7bb,
-	0xfd14, 0xf4c0, 0xf8df, 0x01bf, 0xfc5a, 0xf9b7, 0xf737, 0xf3c4,
-	0xee12, 0xe56b, 0xe906, 0xe9fb, 0xe535, 0xec6c, 0xf3aa, 0xf305,
-	0xefde, 0xef3c, 0xef6e, 0xea72, 0xebcd, 0xf14b, 0xf2d3, 0xfa23,
-	0x0098, 0x057c, 0x0ea2, 0x0fad, 0x10be, 0x17bb, 0x1854, 0x1cb7,
-	0x231b, 0x2050, 0x2198, 0x1ffb, 0x1798, 0x184e, 0x1209, 0x0595,
-	0x0424, 0xfbf8, 0xf776, 0xfce0, 0xf944, 0xfd3e, 0xfe30, 0xf56a,
-	0xf97b, 0xf3c3, 0xeb59, 0xee61, 0xe6ee, 0xe6d1, 0xe92c, 0xe4c1,
-	0xedfc, 0xefca, 0xed9f, 0xf2c6, 0xeea0, 0xef9e, 0xefb4, 0xed15,
-	0xf5dd, 0xf84b, 0xfcec, 0x0547, 0x0490, 0x0b54, 0x0f33, 0x0e89,
-	0x1551, 0x169d, 0x1aec, 0x2146, 0x21c3, 0x2619, 0x2386, 0x1d8d,
-	0x1d7f, 0x14b8, 0x07ac, 0x00bf, 0xfaf6, 0xf53f, 0xf4e9, 0xfaa7,
-	0xfbb2, 0xf670, 0xf63b, 0xf988, 0xf3cb, 0xe985, 0xeab1, 0xed4e,
-	0xe5b7, 0xe5b3, 0xefbd, 0xf09f, 0xeaf2, 0xef18, 0xf41e, 0xedcf,
-	0xeb91, 0xf28e, 0xf6f9, 0xf4a9, 0xf603, 0x02d8, 0x03aa, 0xfe87,
-	0x0dbc, 0x128b, 0x0c1c, 0x1383, 0x193c, 0x1ef3, 0x206a, 0x1f35,
-	0x29a3, 0x22c8, 0x191f, 0x2108, 0x1569, 0x051e, 0x009c, 0xf692,
-	0xf3ab, 0xf430, 0xf4ea, 0xfac6, 0xf797, 0xf74f, 0xfd6e, 0xf582,
-	0xeba2, 0xe9ff, 0xe662, 0xe3ff, 0xe793, 0xeaaa, 0xeaca, 0xebcf,
-	0xef3c, 0xf217, 0xf141, 0xef51, 0xf178, 0xf510, 0xf60e, 0xfa4c,
-	0x022f, 0x0443, 0x07ee, 0x105e, 0x0f81, 0x0e9c, 0x1342, 0x15fa,
-	0x1ca0, 0x1d37, 0x1d47, 0x2677, 0x219e, 0x1d7d, 0x20c6, 0x13d6,
-	0x082a, 0xff6a, 0xf5cb, 0xf527, 0xf0e6, 0xf505, 0xfcae, 0xf7bc,
-	0xfc39, 0xfdf8, 0xf428, 0xee6b, 0xe7e9, 0xe6aa, 0xe3c5, 0xe08e,
-	0xeb37, 0xede3, 0xeeef, 0xf807, 0xf708, 0xf51c, 0xf288, 0xef72,
-	0xf307, 0xf2c7, 0xf71a, 0xfd3d, 0xfc0a, 0x01a1, 0x081d, 0x0ba4,
-	0x0fa9, 0x1064, 0x13fc, 0x167b, 0x17c9, 0x1c39, 0x1ca3, 0x1f67,
-	0x2286, 0x1f26, 0x1c78, 0x1421, 0x079f, 0x0156, 0xfb2a, 0xf53b,
-	0xf088, 0xee02, 0xf3b3, 0xf7ae, 0xf7b7, 0xfa8d, 0xf71c, 0xef9d,
-	0xebc8, 0xe7bc, 0xe569, 0xe487, 0xe794, 0xeef0, 0xefcc, 0xf1ae,
-	0xf656, 0xf342, 0xf1b6, 0xf14d, 0xf1ea, 0xf6f1, 0xf701, 0xfe41,
-	0x0818, 0x0660, 0x0b0b, 0x0fb6, 0x0fd2, 0x132c, 0x1134, 0x186c,
-	0x1fe5, 0x1a9e, 0x1f36, 0x1f7b, 0x1a75, 0x1cf2, 0x13b3, 0x0b94,
-	0x0455, 0xf729, 0xf8ef, 0xf4cd, 0xee82, 0xf9ed, 0xfa7a, 0xf96e,
-	0xfd5b, 0xf41b, 0xf20d, 0xef85, 0xe414, 0xe707, 0xe901, 0xe70b,
-	0xeeb3, 0xefbd, 0xf1fb, 0xf8cd, 0xf311, 0xf2e3, 0xf598, 0xeb38,
-	0xed3e, 0xf7ce, 0xf99e, 0x0060, 0x0775, 0x0b08, 0x0d63, 0x0a36,
-	0x0fb6, 0x14fe, 0x107d, 0x1702, 0x1e0c, 0x1bf3, 0x1e9b, 0x22bf,
-	0x22d5, 0x19d2, 0x0ffd, 0x0da0, 0xff80, 0xf11a, 0xf352, 0xf1db,
-	0xf069, 0xf4de, 0xf693, 0xfb28, 0xf9cb, 0xf45a, 0xf594, 0xee5b,
-	0xe77a, 0xeb44, 0xe878, 0xe98b, 0xf2cd, 0xf4a2, 0xf797, 0xf924,
-	0xf57c, 0xf7ca, 0xf576, 0xef1b, 0xf1b5, 0xf5f5, 0xfa20, 0xff02,
-	0x03e8, 0x0acd, 0x0c95, 0x0d54, 0x11b5, 0x12e6, 0x145d, 0x16f2,
-	0x1b7e, 0x201d, 0x1d28, 0x1ecb, 0x21b0, 0x180e, 0x1160, 0x092e,
-	0xf8b8, 0xf287, 0xef1d, 0xec73, 0xf2cc, 0xf428, 0xf7d3, 0x002a,
-	0xfad5, 0xf66a, 0xf5f0, 0xec1e, 0xe872, 0xe803, 0xe3fe, 0xea24,
-	0xedc7, 0xed02, 0xf585, 0xf7cb, 0xf502, 0xf900, 0xf641, 0xf16f,
-	0xf34a, 0xf5bf, 0xfe4f, 0x0691, 0x0675, 0x0ac5, 0x0e15, 0x0bdb,
-	0x0f3f, 0x1082, 0x11cd, 0x19eb, 0x1c42, 0x1c94, 0x1e16, 0x1bb5,
-	0x1d8e, 0x1b59, 0x0ef9, 0x039b, 0xf851, 0xf062, 0xed4b, 0xeae1,
-	0xf142, 0xf7ee, 0xf60b, 0xf893, 0xfad1, 0xf6a4, 0xf41e, 0xf015,
-	0xebbd, 0xe977, 0xe838, 0xee75, 0xf38a, 0xf235, 0xf742, 0xf9f7,
-	0xf4fd, 0xf453, 0xf42c, 0xf28f, 0xf2ec, 0xf628, 0xfc81, 0xfe2d,
-	0x00b0, 0x07f7, 0x089c, 0x098f, 0x0f9a, 0x12bc, 0x15e7, 0x1b27,
-	0x1f98, 0x2127, 0x2190, 0x2150, 0x1b09, 0x144e, 0x1002, 0x0564,
-	0xf7bb, 0xf100, 0xf040, 0xedf7, 0xef6e, 0xf7b0, 0xf8b4, 0xf644,
-	0xf934, 0xf5ea, 0xef51, 0xef8f, 0xef22, 0xebea, 0xebcb, 0xedfa,
-	0xf084, 0xf072, 0xf0f5, 0xf6dc, 0xf759, 0xf2db, 0xf5cb, 0xf629,
-	0xf40b, 0xf9e7, 0xfd1f, 0xfe46, 0x035d, 0x066c, 0x0920, 0x0cb8,
-	0x107f, 0x14dd, 0x17a1, 0x1ab1, 0x1e99, 0x2085, 0x1e1e, 0x1c76,
-	0x1bb4, 0x1152, 0x0897, 0x04c8, 0xf812, 0xf437, 0xf7dd, 0xf20e,
-	0xf4f5, 0xfb3a, 0xf87e, 0xfa1f, 0xf822, 0xf2d8, 0xf2d1, 0xed06,
-	0xeb0a, 0xed6c, 0xe6ea, 0xe8ef, 0xeefe, 0xec35, 0xf195, 0xf51c,
-	0xf162, 0xf5ec, 0xf6e3, 0xf637, 0xfd6c, 0x0143, 0x03d8, 0x0546,
-	0x0424, 0x06e5, 0x0928, 0x0c77, 0x1166, 0x14be, 0x1d38, 0x21da,
-	0x1f42, 0x2141, 0x2081, 0x1c9f, 0x1a77, 0x0f46, 0x0283, 0xfa62,
-	0xf112, 0xed8f, 0xec01, 0xea8d, 0xf0f3, 0xf393, 0xf4ca, 0xfaaf,
-	0xf7e6, 0xf4a4, 0xf64e, 0xf1b1, 0xef66, 0xf192, 0xef2d, 0xee7a,
-	0xf087, 0xeeb3, 0xef65, 0xf3c4, 0xf43f, 0xf700, 0xfc20, 0xfd2e,
-	0x0056, 0x0268, 0x0226, 0x04e0, 0x050c, 0x05a9, 0x0877, 0x0a73,
-	0x0ff5, 0x1531, 0x1973, 0x1d88, 0x1ef2, 0x1fef, 0x1dd5, 0x18e3,
-	0x128d, 0x094d, 0x0110, 0xf8cc, 0xf2bf, 0xf1ce, 0xf058, 0xf06a,
-	0xf508, 0xf7f5, 0xf7f4, 0xf9d0, 0xf7e1, 0xf33d, 0xf575, 0xf1c8,
-	0xeb14, 0xec4c, 0xe72e, 0xe5ae, 0xeb85, 0xea83, 0xeda8, 0xf212,
-	0xf4ed, 0xfaef, 0xfca8, 0x0314, 0x080d, 0x055f, 0x0a55, 0x0c69,
-	0x092a, 0x0c3d, 0x1011, 0x12c4, 0x1730, 0x1eca, 0x2326, 0x2192,
-	0x2247, 0x1fb4, 0x161b, 0x0f44, 0x094a, 0xfd2a, 0xf4ae, 0xf31a,
-	0xecd1, 0xeae5, 0xef7f, 0xef04, 0xf256, 0xf573, 0xf573, 0xf7ea,
-	0xf432, 0xf36d, 0xf312, 0xeb6a, 0xebf7, 0xeb91, 0xe754, 0xe9cb,
-	0xebcb, 0xee7b, 0xf169, 0xf4f7, 0xfb4c, 0xfe8c, 0x0336, 0x07fb,
-	0x09c8, 0x0b85, 0x0b1f, 0x0c5e, 0x0d77, 0x0e8c, 0x15f8, 0x1a8b,
-	0x1bfc, 0x21c6, 0x24a1, 0x217c, 0x211a, 0x1ef8, 0x1321, 0x0a84,
-	0x039f, 0xf6c5, 0xf074, 0xec8c, 0xe7d5, 0xe84d, 0xe8eb, 0xed19,
-	0xf013, 0xefc1, 0xf599, 0xf63a, 0xf338, 0xf738, 0xf677, 0xf231,
-	0xf33e, 0xf1b1, 0xeb82, 0xea84, 0xec1c, 0xeb5b, 0xf110, 0xf8aa,
-	0xfc07, 0x0293, 0x084a, 0x0b0a, 0x0e5a, 0x101a, 0x1283, 0x1404,
-	0x146f, 0x16a8, 0x176b, 0x186f, 0x1ad6, 0x1b0f, 0x1ae7, 0x1a71,
-	0x1668, 0x0feb, 0x099d, 0x0224, 0xf9ef, 0xf48f, 0xf017, 0xebf1,
-	0xec0b, 0xecc0, 0xeb95, 0xed08, 0xef30, 0xee92, 0xf078, 0xf3a5,
-	0xf2d2, 0xf2e5, 0xf3c5, 0xf10e, 0xef04, 0xede5, 0xeb1a, 0xe9e4,
-	0xea88, 0xec8b, 0xf0f8, 0xf601, 0xfc0c, 0x032a, 0x097e, 0x105d,
-	0x1611, 0x18f9, 0x1ab7, 0x1cd9, 0x1f8e, 0x1fae, 0x200d, 0x21cd,
-	0x1f4a, 0x1e0c, 0x1b6d, 0x1315, 0x0e56, 0x06a4, 0xfe6f, 0xfab7,
-	0xf0f6, 0xec74, 0xeb3e, 0xe484, 0xe746, 0xea31, 0xe7d2, 0xeca2,
-	0xef5f, 0xefbf, 0xf25b, 0xf32f, 0xf473, 0xf416, 0xf33f, 0xf502,
-	0xf3ab, 0xf0ec, 0xf328, 0xf3aa, 0xf0f0, 0xf677, 0xfccc, 0xfd1e,
-	0x04a4, 0x0d5c, 0x0de5, 0x10ff, 0x17c9, 0x182e, 0x170a, 0x1dc8,
-	0x1ff1, 0x1cc2, 0x20fa, 0x1faf, 0x189b, 0x1682, 0x1140, 0x09b1,
-	0x01f2, 0xfb64, 0xf611, 0xecaf, 0xe8a9, 0xe7e8, 0xe338, 0xe4d1,
-	0xe930, 0xeacb, 0xeebe, 0xf323, 0xf4fd, 0xf6d4, 0xf98f, 0xf9ac,
-	0xf98a, 0xf825, 0xf42a, 0xf371, 0xeee7, 0xeaa3, 0xee6e, 0xeeb8,
-	0xf171, 0xf8e9, 0xfc97, 0x0276, 0x0a0e, 0x1114, 0x1569, 0x1825,
-	0x1d69, 0x1db3, 0x1e16, 0x2114, 0x1e9d, 0x1dfd, 0x1db5, 0x19ee,
-	0x15ec, 0x1078, 0x0aef, 0x0338, 0xfc0c, 0xf5d0, 0xedfd, 0xeaf5,
-	0xe75a, 0xe4a2, 0xe7b6, 0xe740, 0xe8fb, 0xec94, 0xed2d, 0xf25e,
-	0xf6ad, 0xf8ec, 0xfbd2, 0xfbac, 0xfbd4, 0xf9bc, 0xf5fa, 0xf4e0,
-	0xf23f, 0xf0bf, 0xf223, 0xf175, 0xf344, 0xf8f3, 0xfc16, 0x0123,
-	0x0919, 0x0d42, 0x13e9, 0x1b12, 0x1ccf, 0x206e, 0x22ad, 0x2271,
-	0x2258, 0x2005, 0x1dd7, 0x181b, 0x11b0, 0x0c18, 0x0088, 0xf9e0,
-	0xf503, 0xeb72, 0xe8e5, 0xe5fc, 0xe15b, 0xe300, 0xe3e6, 0xe506,
-	0xe956, 0xed2e, 0xf001, 0xf354, 0xf759, 0xf959, 0xfb45, 0xfc9c,
-	0xfba0, 0xfb5f, 0xf9d8, 0xf833, 0xf6ee, 0xf56d, 0xf7ae, 0xf978,
-	0xfc99, 0x027a, 0x0520, 0x09d3, 0x0e11, 0x0f6f, 0x1406, 0x1733,
-	0x1a3e, 0x1ef3, 0x20c8, 0x20bf, 0x1f14, 0x1c6c, 0x1723, 0x10ef,
-	0x0cb7, 0x03f1, 0xfb73, 0xf612, 0xec68, 0xe5aa, 0xe3c1, 0xe0ed,
-	0xe100, 0xe441, 0xe7b5, 0xeaf7, 0xef21, 0xf41c, 0xf716, 0xf97e,
-	0xfe1c, 0x0145, 0x0176, 0x0272, 0x01bd, 0xfd2c, 0xfa23, 0xf85f,
-	0xf5a6, 0xf4a7, 0xf618, 0xf7eb, 0xf8f0, 0xfd1f, 0x0370, 0x06d8,
-	0x0b34, 0x0f77, 0x11db, 0x15b3, 0x18f7, 0x1ca3, 0x1dcb, 0x1c34,
-	0x1ce2, 0x181b, 0x128b, 0x1048, 0x07f6, 0x00be, 0xf9c4, 0xf062,
-	0xebff, 0xe639, 0xe280, 0xe2a8, 0xdff9, 0xe201, 0xe62c, 0xe8a2,
-	0xedc6, 0xf3d8, 0xfa16, 0xfdbd, 0x00e6, 0x04b6, 0x047f, 0x0548,
-	0x0519, 0x0218, 0x0075, 0xfdba, 0xfc5c, 0xfa81, 0xf844, 0xfb56,
-	0xfcb0, 0xfddd, 0x03a8, 0x0730, 0x09ce, 0x0d85, 0x102b, 0x12b0,
-	0x15e7, 0x1a9e, 0x1db0, 0x1c2e, 0x1a95, 0x1971, 0x11f6, 0x08ea,
-	0x055f, 0xfc88, 0xf28e, 0xf162, 0xeb0e, 0xe223, 0xe31d, 0xe3a0,
-	0xe12e, 0xe49d, 0xeab8, 0xec06, 0xee3e, 0xf6be, 0xfadb, 0xfc1e,
-	0x0337, 0x0611, 0x03b6, 0x065c, 0x080a, 0x0495, 0x0332, 0x0243,
-	0xfea7, 0xfe33, 0xff56, 0xff53, 0xfff6, 0x0263, 0x05b1, 0x047c,
-	0x05ee, 0x0cbb, 0x0b51, 0x0b23, 0x100e, 0x0e68, 0x0e4a, 0x1172,
-	0x1373, 0x1009, 0x093f, 0x0b11, 0x0382, 0xf680, 0xfa30, 0xf2a8,
-	0xe55b, 0xea3d, 0xe839, 0xe18a, 0xe6dc, 0xec76, 0xebcb, 0xec14,
-	0xf4ba, 0xfa77, 0xfb51, 0x04e6, 0x0b26, 0x08c0, 0x0a8c, 0x0c9f,
-	0x08c3, 0x06ea, 0x09cd, 0x06f2, 0x0220, 0x03a1, 0x0123, 0xfd39,
-	0xfeed, 0xff9a, 0xff2a, 0xffd4, 0x0295, 0x03c7, 0x029b, 0x051d,
-	0x04e1, 0x03b7, 0x0713, 0x0670, 0x06c8, 0x08b8, 0x0525, 0x02ec,
-	0x00e5, 0xfdca, 0xfd9f, 0xfca1, 0xfaba, 0xf9ba, 0xf8c9, 0xf6ba,
-	0xf4a9, 0xf609, 0xf64f, 0xf594, 0xf96d, 0xfb1c, 0xfab9, 0xfd9c,
-	0xfecc, 0xff73, 0x01e5, 0x000c, 0xfd35, 0xfeec, 0xfe52, 0xfd36,
-	0x0134, 0x01d5, 0x0111, 0x05c3, 0x062c, 0x0438, 0x0708, 0x05e7,
-	0x02cc, 0x0492, 0x0437, 0x0330, 0x0510, 0x04ab, 0x042b, 0x03f4,
-	0x00e2, 0x00cd, 0x02bd, 0xff6c, 0xfc66, 0xfe5d, 0xfc29, 0xf604,
-	0xf798, 0xf8ef, 0xf30b, 0xf3c3, 0xf722, 0xf2d4, 0xf27d, 0xf688,
-	0xf5a2, 0xf6c1, 0xfcad, 0x0057, 0x0276, 0x05fe, 0x0821, 0x08c8,
-	0x086e, 0x07cc, 0x0984, 0x09e4, 0x0776, 0x084a, 0x088f, 0x03ce,
-	0x0119, 0x01b1, 0xff17, 0xfb47, 0xfb3c, 0xfb79, 0xfa3c, 0xfa77,
-	0xfb43, 0xfca6, 0xfcc1, 0xfb74, 0xfccf, 0xfce2, 0xfb16, 0xfb79,
-	0xfa86, 0xf882, 0xf8a2, 0xf95d, 0xfa20, 0xfb2a, 0xfc81, 0xfcfc,
-	0xfdd9, 0xffa3, 0xfff1, 0x01c3, 0x03d6, 0x0312, 0x04a8, 0x0631,
-	0x040d, 0x038f, 0x04a7, 0x041b, 0x0359, 0x044b, 0x04c3, 0x033e,
-	0x03b7, 0x0600, 0x051e, 0x02f0, 0x0347, 0x0243, 0xfe79, 0xfd27,
-	0xfdc5, 0xfc85, 0xfc23, 0xfde4, 0xffbd, 0x00bc, 0x00d4, 0x003a,
-	0xfed0, 0xfd47, 0xfb4f, 0xf9b6, 0xfb53, 0xfc55, 0xfb29, 0xfbba,
-	0xfc19, 0xfbad, 0xfc8d, 0xfd82, 0xfecf, 0x001c, 0x0046, 0x00cb,
-	0x0270, 0x030c, 0x01b0, 0x0195, 0x01e6, 0xff80, 0xfdb2, 0xfe2f,
-	0xfde8, 0xfd05, 0xfd1b, 0xfd4a, 0xfe75, 0x011d, 0x021e, 0x01fe,
-	0x02ae, 0x0194, 0xffd8, 0xff21, 0xfdf3, 0xfd30, 0xfc5a, 0xfb4d,
-	0xfada, 0xf907, 0xf6cb, 0xf685, 0xf81e, 0xfb66, 0xfec6, 0x0394,
-	0x08d8, 0x0925, 0x07cc, 0x0afa, 0x0d33, 0x07af, 0xff64, 0xfb8d,
-	0xf8ee, 0xf431, 0xf084, 0xf178, 0xf6ee, 0xfb2b, 0xfd05, 0x01c0,
-	0x0709, 0x0a8a, 0x0d37, 0x0d33, 0x0d41, 0x0e87, 0x0af4, 0x03e0,
-	0x0034, 0xfd34, 0xf759, 0xf354, 0xf227, 0xf1bf, 0xf32b, 0xf4cb,
-	0xf5fe, 0xfa0f, 0xfdfc, 0xff5f, 0x01a9, 0x038b, 0x025d, 0x00d0,
-	0xffd5, 0xfcfa, 0xfa98, 0xfa66, 0xf9bd, 0xf94a, 0xfada, 0xfcf1,
-	0xff02, 0x00f0, 0x027c, 0x04cb, 0x06bc, 0x070e, 0x0882, 0x0a9c,
-	0x0988, 0x0769, 0x069e, 0x02e9, 0xfe33, 0xfcd5, 0xfc2f, 0xfc39,
-	0xfdfc, 0xfe55, 0xfea8, 0x00fc, 0x0290, 0x0222, 0x022d, 0x01ff,
-	0xffff, 0xfda2, 0xfb53, 0xf97f, 0xf8c4, 0xf860, 0xf84b, 0xf8a9,
-	0xf8e1, 0xf920, 0xfa79, 0xfcf1, 0xfebf, 0x0010, 0x0274, 0x03a3,
-	0x033f, 0x0313, 0x0225, 0x0068, 0xff83, 0xff36, 0xfdd2, 0xfc05,
-	0xfc6b, 0xfd04, 0xfdd2, 0x0123, 0x0307, 0x0288, 0x0320, 0x02d1,
-	0x01b9, 0x00f7, 0xffcb, 0xfe38, 0xfca4, 0xfc9e, 0xfd94, 0xfde3,
-	0xfe54, 0xfe80, 0xfd9f, 0xfc3a, 0xfaed, 0xfb07, 0xfd2e, 0xff7b,
-	0x0025, 0x004e, 0x011a, 0x014e, 0x00b6, 0x0127, 0x01eb, 0x0112,
-	0x0033, 0x0156, 0x0257, 0x0167, 0x012c, 0x0139, 0xff34, 0xfe6e,
-	0xff53, 0xff73, 0xff8e, 0xfff7, 0xff8a, 0xfee8, 0xff9f, 0x009a,
-	0x00c7, 0x015f, 0x01ec, 0x0163, 0x012f, 0x018d, 0x01fb, 0x01ea,
-	0x00a6, 0xffef, 0xff95, 0xfe5a, 0xfd39, 0xfc3c, 0xfb3b, 0xfa34,
-	0xf991, 0xfa9a, 0xfbad, 0xfb0a, 0xfc3d, 0xfddc, 0xfde1, 0xfec7,
-	0xfee1, 0xfd8a, 0xfc87, 0xfb03, 0xf991, 0xfabb, 0xfd7c, 0x001b,
-	0x02ab, 0x04a8, 0x059c, 0x0625, 0x063c, 0x06a1, 0x07bb, 0x07bc,
-	0x065e, 0x04cc, 0x02ac, 0x0071, 0xffd6, 0xffcf, 0xffa4, 0xff8e,
-	0x0014, 0x00a8, 0x00fe, 0x0193, 0x0137, 0x002e, 0xfec7, 0xfc79,
-	0xfa87, 0xf8ff, 0xf7a6, 0xf836, 0xf93d, 0xfa9f, 0xfd9b, 0x0075,
-	0x0335, 0x0507, 0x05df, 0x05e2, 0x039e, 0x0026, 0xfe3f, 0xfd39,
-	0xfc88, 0xfd32, 0xfe75, 0xff44, 0x00e8, 0x02fc, 0x0415, 0x049e,
-	0x03d3, 0x0187, 0x008c, 0xffe5, 0xff00, 0xff4a, 0xfe55, 0xfcc4,
-	0xfc85, 0xfc44, 0xfd46, 0xff01, 0xff92, 0x005d, 0x01ad, 0x0244,
-	0x01e0, 0x012d, 0x0038, 0xff44, 0xfdcf, 0xfba4, 0xfb30, 0xfca9,
-	0xfe1a, 0xffd2, 0x0108, 0x00d9, 0x007b, 0x0001, 0x005a, 0x00ff,
-	0x0019, 0xffb8, 0xff80, 0xfe96, 0xfec5, 0xfee4, 0xfe95, 0x0005,
-	0x011f, 0x015c, 0x0162, 0x0055, 0xff5c, 0xfe94, 0xfde6, 0xfdb9,
-	0xfdb8, 0xfd78, 0xfdc8, 0xfe5b, 0xfd16, 0xfbdb, 0xfcd2, 0xfe6f,
-	0x000a, 0x0159, 0x0153, 0x0110, 0x00e3, 0x00cd, 0x00d7, 0xffa2,
-	0xfe2a, 0xfde4, 0xfe1e, 0xffa2, 0x016f, 0x0245, 0x02c6, 0x0360,
-	0x03fa, 0x036e, 0x0180, 0xff5a, 0xfd89, 0xfd26, 0xfd7f, 0xfe8f,
-	0x000e, 0xffd6, 0xff2f, 0xff79, 0xff67, 0x00dc, 0x02c4, 0x0345,
-	0x0320, 0x0130, 0xfec4, 0xfdc0, 0xfd2c, 0xfd9a, 0xfe6a, 0xfde2,
-	0xfcfa, 0xfc4e, 0xfc7b, 0xfdd4, 0xfeb7, 0xff73, 0xff7a, 0xfe82,
-	0xfea7, 0xfe80, 0xfdba, 0xfdc2, 0xfd55, 0xfbeb, 0xfb27, 0xfb78,
-	0xfc51, 0xfe14, 0x000a, 0x025f, 0x03fe, 0x02f3, 0x01a0, 0x01e0,
-	0x01fb, 0x0286, 0x02c4, 0x0177, 0x0053, 0xff4e, 0xfe70, 0xff5a,
-	0xfff5, 0xffc2, 0xffed, 0xfedf, 0xfec7, 0xff41, 0xfdde, 0xfdbd,
-	0xfe23, 0xfca3, 0xfc87, 0xfc8b, 0xfbd5, 0xfc86, 0xfcdd, 0xfd8d,
-	0xff81, 0x00b2, 0x012f, 0x01f9, 0x01c8, 0x0105, 0x0022, 0xff8c,
-	0xffb4, 0x0069, 0x0090, 0xff32, 0xfee5, 0xff56, 0xff51, 0x00cd,
-	0x01c1, 0x017e, 0x0205, 0x00c4, 0xffbe, 0xff97, 0xfe9e, 0xff4f,
-	0x0068, 0x0048, 0x009a, 0xff63, 0xfe3b, 0xff04, 0xfe7a, 0xfe9c,
-	0xff6f, 0xff1a, 0xffc6, 0x00c9, 0x00b0, 0x00a4, 0xfffa, 0xff13,
-	0xfed8, 0xfea5, 0xfd4a, 0xfb62, 0xf808, 0xf1fd, 0xeefc, 0xf0ac,
-	0xf654, 0x0032, 0x0662, 0x065b, 0x053c, 0x02cb, 0x059b, 0x0c48,
-	0x0e19, 0x0d4d, 0x07d6, 0xffaa, 0xfc89, 0xf935, 0xf864, 0xfdd0,
-	0x0195, 0x0855, 0x0f08, 0x0eeb, 0x0f74, 0x0dde, 0x0a87, 0x0c32,
-	0x0af4, 0x068d, 0x01c1, 0xf827, 0xf159, 0xf22a, 0xf73e, 0x0210,
-	0x0b9c, 0x0a34, 0x0211, 0xf7b8, 0xf029, 0xf1ba, 0xf6c2, 0xf76e,
-	0xf504, 0xee21, 0xe8d0, 0xed38, 0xf444, 0xfa9b, 0xfe20, 0xf831,
-	0xf1c0, 0xf0ca, 0xf1c6, 0xf9f1, 0x01a9, 0x01d5, 0x0055, 0xfc91,
-	0xfc1b, 0x0593, 0x1003, 0x18f7, 0x1e88, 0x1d3e, 0x1d5f, 0x2227,
-	0x26d0, 0x262f, 0x1974, 0x0105, 0xe884, 0xdad6, 0xdcaa, 0xe956,
-	0xf67a, 0xfb86, 0xf9d6, 0xf806, 0xf9c3, 0x00f8, 0x0714, 0x04b3,
-	0xfaa5, 0xec47, 0xe0c5, 0xdfa4, 0xe620, 0xf027, 0xf7e3, 0xf95f,
-	0xf868, 0xf933, 0xfdc9, 0x04a7, 0x0879, 0x0634, 0xfe14, 0xf579,
-	0xf260, 0xf485, 0xfc76, 0x043f, 0x0722, 0x07d5, 0x0618, 0x05f0,
-	0x0bd0, 0x1101, 0x151b, 0x1691, 0x125c, 0x11b5, 0x1609, 0x1c13,
-	0x2346, 0x2165, 0x13ac, 0x0154, 0xee77, 0xe58d, 0xe975, 0xf282,
-	0xfb7c, 0xff21, 0xfbfb, 0xf941, 0xfa84, 0xfef9, 0x03f2, 0x03fc,
-	0xfcd6, 0xf23c, 0xe994, 0xe634, 0xeae2, 0xf311, 0xf909, 0xfac0,
-	0xf721, 0xf2be, 0xf3e4, 0xf805, 0xfddd, 0x005d, 0xfbb8, 0xf69b,
-	0xf362, 0xf4ec, 0xfc95, 0x03b5, 0x0a21, 0x1073, 0x132a, 0x1886,
-	0x1d94, 0x2024, 0x2387, 0x219a, 0x1c35, 0x1680, 0x0bea, 0x02e7,
-	0xfbbc, 0xf2a9, 0xef6c, 0xee59, 0xee8e, 0xf41f, 0xf817, 0xfac3,
-	0xfdf8, 0xfc89, 0xfa1e, 0xf711, 0xf1a7, 0xee16, 0xec72, 0xeae1,
-	0xeba0, 0xedca, 0xefdd, 0xf44f, 0xf8d4, 0xfb20, 0xfc00, 0xfbc6,
-	0xfa2d, 0xfaf7, 0xfbf0, 0xfbb1, 0xfc5d, 0xfbc5, 0xfb07, 0xfd5a,
-	0x01a7, 0x07a5, 0x104f, 0x1693, 0x1a3f, 0x1dec, 0x1e58, 0x1d81,
-	0x1e78, 0x1ca5, 0x1ac1, 0x17e7, 0x0eb2, 0x0495, 0xfa48, 0xf066,
-	0xf06b, 0xf35f, 0xf436, 0xf692, 0xf321, 0xf0cd, 0xf411, 0xf5b0,
-	0xf900, 0xfa0b, 0xf348, 0xefc9, 0xee77, 0xed62, 0xf2c7, 0xf64e,
-	0xf6d6, 0xf83d, 0xf498, 0xf23c, 0xf468, 0xf603, 0xfa06, 0xfc44,
-	0xfac0, 0xfa03, 0xf9ed, 0xfcbc, 0x0256, 0x061e, 0x0abb, 0x0e33,
-	0x1056, 0x153d, 0x1940, 0x1d2e, 0x1fc9, 0x1e6f, 0x1c4b, 0x19a4,
-	0x1603, 0x12be, 0x0c8f, 0x02f9, 0xf818, 0xef75, 0xed8b, 0xefcd,
-	0xf511, 0xfa12, 0xf95c, 0xf5f3, 0xf33a, 0xf20d, 0xf30d, 0xf487,
-	0xf4b0, 0xf36e, 0xf159, 0xeeae, 0xee2b, 0xf155, 0xf513, 0xf774,
-	0xf8cc, 0xf593, 0xf229, 0xf377, 0xf580, 0xf96b, 0xfca7, 0xfb13,
-	0xfa8f, 0xfcda, 0x01af, 0x0a8d, 0x115d, 0x167f, 0x19ec, 0x191e,
-	0x1a6a, 0x1c13, 0x1b6f, 0x1e8d, 0x1eb3, 0x1b0e, 0x1716, 0x0b75,
-	0x026e, 0xfe70, 0xf67c, 0xf1b3, 0xef5f, 0xeac3, 0xed82, 0xf2e5,
-	0xf509, 0xf82c, 0xf5c1, 0xf20b, 0xf287, 0xf18b, 0xf268, 0xf52f,
-	0xf3ac, 0xf3af, 0xf446, 0xf3ad, 0xf7a1, 0xf980, 0xf943, 0xfad6,
-	0xf6a3, 0xf282, 0xf2b7, 0xf122, 0xf3d9, 0xf93e, 0xfb43, 0xffbe,
-	0x03dc, 0x05c7, 0x0ba4, 0x102d, 0x1370, 0x17f8, 0x19c2, 0x1a12,
-	0x1aff, 0x1cac, 0x1dd2, 0x1b44, 0x12e9, 0x08d7, 0xfe60, 0xf4e1,
-	0xf0da, 0xf019, 0xf2b0, 0xf777, 0xf977, 0xfafb, 0xf95d, 0xf522,
-	0xf471, 0xf3f9, 0xf257, 0xf175, 0xf03a, 0xf0b2, 0xf2fa, 0xf42b,
-	0xf65c, 0xf624, 0xf5be, 0xf783, 0xf8e5, 0xfaf1, 0xf8bd, 0xf498,
-	0xf194, 0xf16a, 0xf6b9, 0xfd77, 0x031a, 0x0801, 0x09ca, 0x0c58,
-	0x117d, 0x15e3, 0x1bb4, 0x1de7, 0x1dbe, 0x1f1a, 0x1ea5, 0x1ed1,
-	0x1c08, 0x1350, 0x092a, 0xfe87, 0xf74b, 0xf322, 0xf0c8, 0xf0fa,
-	0xf31e, 0xf590, 0xf82f, 0xf918, 0xf624, 0xf44b, 0xf332, 0xf260,
-	0xf2d8, 0xf319, 0xf1fa, 0xf1c6, 0xf0e0, 0xf188, 0xf337, 0xf244,
-	0xf43f, 0xf644, 0xf76c, 0xf684, 0xf1ee, 0xef73, 0xf17b, 0xf67d,
-	0x0090, 0x080e, 0x092d, 0x0cad, 0x0efd, 0x1363, 0x1ade, 0x1f99,
-	0x2332, 0x2454, 0x246b, 0x2284, 0x1ffb, 0x1b89, 0x11e6, 0x0731,
-	0xfa64, 0xeef2, 0xeb83, 0xec8b, 0xf02a, 0xf4fa, 0xf65a, 0xf52e,
-	0xf4aa, 0xf69f, 0xf88f, 0xf807, 0xf4bc, 0xeffc, 0xed0b, 0xee1f,
-	0xef5a, 0xf1a7, 0xf36d, 0xf254, 0xf411, 0xf633, 0xf7ae, 0xf790,
-	0xf500, 0xf314, 0xf277, 0xf666, 0xff0e, 0x05ee, 0x0927, 0x0a26,
-	0x0c2f, 0x122b, 0x1a48, 0x1f9a, 0x2031, 0x20bb, 0x2010, 0x1d8b,
-	0x1eb1, 0x18be, 0x0c15, 0x03a1, 0xf76e, 0xef80, 0xf23b, 0xf30b,
-	0xf743, 0xfdb1, 0xfa15, 0xf7fe, 0xf7c8, 0xf42c, 0xf4be, 0xf2c4,
-	0xeaef, 0xea04, 0xea3b, 0xeaae, 0xefb4, 0xeee3, 0xeec9, 0xf1d1,
-	0xf329, 0xf61f, 0xf3f1, 0xec0d, 0xec35, 0xf041, 0xf6bc, 0x00fb,
-	0x0421, 0x04be, 0x0880, 0x0d9f, 0x177e, 0x1fb7, 0x22ca, 0x2557,
-	0x2509, 0x253d, 0x22f8, 0x1e80, 0x189a, 0x0e13, 0x04fd, 0xfb87,
-	0xf3b3, 0xf353, 0xf601, 0xf98f, 0xfe37, 0xfeac, 0xfb5b, 0xf91f,
-	0xf658, 0xf469, 0xf25a, 0xee0e, 0xe92e, 0xe72f, 0xea29, 0xec66,
-	0xee5e, 0xf18b, 0xf152, 0xf22d, 0xf4d6, 0xf305, 0xf2bd, 0xf36b,
-	0xf4d5, 0xfb98, 0x006b, 0x0194, 0x04d2, 0x09ac, 0x1105, 0x1b8a,
-	0x1ffe, 0x21b8, 0x232e, 0x228f, 0x249e, 0x2331, 0x19f1, 0x0f83,
-	0x06e6, 0xfd8e, 0xf6ad, 0xf3db, 0xf340, 0xf73a, 0xfcaf, 0xfdfb,
-	0xfcea, 0xfb46, 0xf722, 0xf3d9, 0xefaf, 0xe98e, 0xe855, 0xe7cb,
-	0xe7b4, 0xe9bd, 0xea49, 0xeb89, 0xefb7, 0xf10b, 0xf0c0, 0xf190,
-	0xf063, 0xf523, 0xfe01, 0x026d, 0x05ce, 0x083e, 0x0b02, 0x12ca,
-	0x18ab, 0x1b5b, 0x207c, 0x24f9, 0x283e, 0x27e9, 0x1f53, 0x1553,
-	0x0d56, 0x0504, 0xffcb, 0xf8f5, 0xf1a3, 0xf4e8, 0xfbcf, 0xff27,
-	0x00af, 0xff50, 0xfcc0, 0xfa44, 0xf609, 0xf158, 0xec77, 0xe797,
-	0xe928, 0xebff, 0xeb12, 0xe9ec, 0xe80e, 0xea24, 0xef8f, 0xeff3,
-	0xed60, 0xed79, 0xf174, 0xf8a0, 0xfe0d, 0xffc0, 0x0173, 0x0737,
-	0x102a, 0x1995, 0x202f, 0x2183, 0x222e, 0x2362, 0x22d2, 0x215a,
-	0x1d40, 0x1504, 0x0b01, 0xfead, 0xf8df, 0xfd09, 0xffe1, 0x0128,
-	0x0020, 0xfbc2, 0xfc2d, 0xfc46, 0xf741, 0xf17e, 0xe971, 0xe511,
-	0xe6fe, 0xe7fb, 0xe764, 0xe509, 0xe30e, 0xe635, 0xe96c, 0xe9d6,
-	0xe97c, 0xe962, 0xeebe, 0xf846, 0xff1b, 0x03f4, 0x08ba, 0x0e3b,
-	0x1732, 0x2256, 0x2919, 0x2848, 0x261f, 0x266b, 0x252a, 0x1f99,
-	0x1457, 0x0726, 0xff7d, 0xfcff, 0xfe56, 0x003f, 0xff2f, 0xffda,
-	0x0060, 0xff42, 0xfff8, 0xfabd, 0xef67, 0xe890, 0xe614, 0xe607,
-	0xe740, 0xe741, 0xe6b5, 0xe720, 0xec31, 0xf158, 0xee1d, 0xeb6d,
-	0xefa1, 0xf5c7, 0xfca3, 0xff5a, 0xfd40, 0xfff3, 0x0821, 0x1048,
-	0x187e, 0x1fd2, 0x2206, 0x221f, 0x23af, 0x21fe, 0x1cc8, 0x1402,
-	0x066f, 0xfd84, 0xfae3, 0xfa3a, 0xfdb1, 0xff1a, 0xffd4, 0x06b3,
-	0x0985, 0x04c4, 0xfdc1, 0xf576, 0xf108, 0xeefd, 0xeaf7, 0xe719,
-	0xe4fc, 0xe6c0, 0xe8f8, 0xe9aa, 0xeba6, 0xeaf3, 0xeb80, 0xf16c,
-	0xf411, 0xf5ea, 0xfb2f, 0xffa1, 0x06b9, 0x0da1, 0x131c, 0x1ce8,
-	0x22f0, 0x2133, 0x2062, 0x1fd5, 0x1afc, 0x11ac, 0x054e, 0xfc89,
-	0xfaf9, 0xfdc5, 0xffe6, 0x010c, 0x0595, 0x0bc2, 0x0de2, 0x09c3,
-	0x01f4, 0xfaf1, 0xf44c, 0xee2b, 0xe926, 0xe346, 0xe37a, 0xe89f,
-	0xe905, 0xea84, 0xed8c, 0xecdd, 0xef17, 0xf1df, 0xf264, 0xf645,
-	0xfb09, 0xfff9, 0x0628, 0x0b3d, 0x1535, 0x20c6, 0x21be, 0x1d52,
-	0x1bfe, 0x189b, 0x0ffa, 0x0571, 0xfb1a, 0xf7ae, 0xfe77, 0x032d,
-	0x0129, 0x0619, 0x0ea5, 0x0ee3, 0x0d82, 0x087b, 0xfd71, 0xf849,
-	0xf4ec, 0xec5c, 0xe752, 0xe543, 0xe4dc, 0xe74c, 0xe998, 0xec80,
-	0xefa3, 0xf274, 0xf483, 0xf61b, 0xf9fc, 0xfeeb, 0x0392, 0x086a,
-	0x0c99, 0x1512, 0x1be1, 0x1a86, 0x19c6, 0x162c, 0x0c79, 0x0379,
-	0xfafa, 0xf69e, 0xfb48, 0xffc6, 0xff9a, 0x01b5, 0x0720, 0x0a17,
-	0x0a28, 0x06ba, 0xff00, 0xf9e0, 0xf596, 0xef1c, 0xec93, 0xec56,
-	0xeb4c, 0xec14, 0xedbc, 0xef7b, 0xf398, 0xf8ab, 0xfc1a, 0x00a6,
-	0x0551, 0x077e, 0x0ada, 0x0d05, 0x0e48, 0x14f3, 0x174b, 0x1370,
-	0x1351, 0x1329, 0x0e7c, 0x0326, 0xf817, 0xf76d, 0xf841, 0xf437,
-	0xf344, 0xf65d, 0xfc98, 0x01be, 0xff8b, 0xfba7, 0xfc5f, 0xfd15,
-	0xf74d, 0xf118, 0xee00, 0xed12, 0xee6a, 0xeeab, 0xef1b, 0xf535,
-	0xfc72, 0x004f, 0x0353, 0x05bb, 0x09e2, 0x0d94, 0x0d5e, 0x0f28,
-	0x19e3, 0x210a, 0x1c73, 0x16df, 0x1378, 0x0e0d, 0x0470, 0xf907,
-	0xf1b4, 0xeed5, 0xeead, 0xf144, 0xf1de, 0xf697, 0xffe9, 0x0219,
-	0x001a, 0xfe5d, 0xfb5d, 0xf59f, 0xee92, 0xead8, 0xe8b3, 0xe890,
-	0xed00, 0xee27, 0xf0e1, 0xf8d4, 0xfd09, 0x029d, 0x0933, 0x0cd8,
-	0x1401, 0x193c, 0x1c96, 0x2263, 0x2247, 0x1ff2, 0x1d6e, 0x1407,
-	0x09da, 0xff58, 0xf6c2, 0xf822, 0xf68d, 0xf1f5, 0xf5fc, 0xfb04,
-	0xfe48, 0x000f, 0xfb42, 0xf7b0, 0xf667, 0xf112, 0xecdf, 0xe9a3,
-	0xe42d, 0xdf42, 0xde00, 0xdede, 0xe6c7, 0xf09c, 0xf1fa, 0xf785,
-	0x04fe, 0x0ca7, 0x12ec, 0x18da, 0x1d92, 0x261a, 0x265c, 0x2330,
-	0x2079, 0x1869, 0x139a, 0x0977, 0xfc94, 0xff1f, 0x001c, 0xfb4d,
-	0xfd5f, 0xffd8, 0x03d1, 0x02ce, 0xfd75, 0xfd06, 0xf8e3, 0xf2af,
-	0xed7a, 0xe427, 0xdf25, 0xe0dd, 0xe071, 0xdda8, 0xe123, 0xeb9e,
-	0xf115, 0xf670, 0x00f9, 0x087e, 0x0fd5, 0x152a, 0x186e, 0x1fac,
-	0x1fe1, 0x1a44, 0x19a0, 0x13f4, 0x09aa, 0x0460, 0xfe84, 0xfc96,
-	0xffcf, 0xfe16, 0xfdb4, 0x02f5, 0x04b1, 0x049e, 0x03c5, 0x0144,
-	0xff86, 0xf83d, 0xf134, 0xebdb, 0xe4f0, 0xe474, 0xe367, 0xe35e,
-	0xee26, 0xf3b3, 0xf595, 0xfeed, 0x052e, 0x0b6a, 0x10af, 0x135c,
-	0x1ab5, 0x1cea, 0x184a, 0x13ac, 0x0a51, 0x02c5, 0xff97, 0xfaa1,
-	0xf999, 0xfa03, 0xfa64, 0xfcff, 0xfdc4, 0xff6e, 0x01e5, 0x0120,
-	0x0168, 0x005b, 0xf9d9, 0xf44e, 0xee03, 0xebc9, 0xedba, 0xe80c,
-	0xeb3b, 0xf6eb, 0xf8c1, 0xfd1c, 0x0513, 0x08f1, 0x0fef, 0x1152,
-	0x1488, 0x1e36, 0x1a52, 0x14cc, 0x1082, 0x0276, 0xfb98, 0xfaaa,
-	0xf65b, 0xf586, 0xf352, 0xf42f, 0xf725, 0xf8c0, 0x00fd, 0x0497,
-	0x01a7, 0x007f, 0xfb86, 0xf5c8, 0xf0b4, 0xe87b, 0xe8db, 0xe99a,
-	0xe9f5, 0xf529, 0xfb37, 0x0068, 0x0bfd, 0x1105, 0x15ad, 0x1a19,
-	0x1b7d, 0x2074, 0x1dd7, 0x16e3, 0x11f9, 0x0698, 0xfe8a, 0xfa0a,
-	0xf3f8, 0xf2d6, 0xeff0, 0xf035, 0xf57a, 0xf62b, 0xf905, 0xfbbe,
-	0xf9be, 0xfac8, 0xf8ce, 0xf08d, 0xeaed, 0xea7b, 0xe710, 0xe1b6,
-	0xea58, 0xf3e4, 0xf88d, 0x03f9, 0x0ce1, 0x14a8, 0x1e14, 0x1f55,
-	0x237f, 0x2955, 0x241f, 0x1e90, 0x1675, 0x0d05, 0x0477, 0xf897,
-	0xf260, 0xf140, 0xeff5, 0xf066, 0xf1f9, 0xf705, 0xfc57, 0xfb32,
-	0xfb6c, 0xfb22, 0xf62f, 0xee74, 0xe5de, 0xe27e, 0xe061, 0xdf2d,
-	0xe5e8, 0xeeda, 0xf822, 0x03f4, 0x0d99, 0x1778, 0x1f0c, 0x2201,
-	0x2865, 0x28ef, 0x219f, 0x1ec5, 0x145f, 0x06ec, 0x021e, 0xf947,
-	0xf0c3, 0xf0d0, 0xef91, 0xf107, 0xf4bf, 0xf5e6, 0xfbd7, 0xff4d,
-	0xfd20, 0xfc58, 0xf745, 0xedbf, 0xea92, 0xe7c7, 0xe215, 0xe442,
-	0xeccf, 0xf177, 0xf895, 0x04db, 0x0e0c, 0x166a, 0x1b97, 0x20d7,
-	0x2757, 0x25e7, 0x2178, 0x1d51, 0x12da, 0x07ed, 0x0053, 0xf605,
-	0xef2c, 0xee8d, 0xed0e, 0xed8c, 0xf0fa, 0xf438, 0xf7f3, 0xfaab,
-	0xfc77, 0xfc42, 0xf748, 0xf172, 0xeff7, 0xeb67, 0xe78c, 0xeb9a,
-	0xee51, 0xf2f9, 0xfbaa, 0x0339, 0x0d5c, 0x1757, 0x1d51, 0x233a,
-	0x277a, 0x2695, 0x1fff, 0x13b8, 0x0b0f, 0x0695, 0xfb34, 0xf232,
-	0xef9d, 0xec1c, 0xeb93, 0xed12, 0xef1f, 0xf29b, 0xf599, 0xf7b2,
-	0xf944, 0xf5f2, 0xf3be, 0xf54e, 0xf0e2, 0xeedf, 0xf2df, 0xf2d6,
-	0xf4bb, 0xfb89, 0x00e2, 0x0933, 0x12ed, 0x1910, 0x20cf, 0x270f,
-	0x2368, 0x1ece, 0x1aaf, 0x1372, 0x0a9f, 0xffb9, 0xf794, 0xf0b2,
-	0xeb2e, 0xe87e, 0xe7d8, 0xe9f1, 0xed4f, 0xef37, 0xf0f1, 0xf430,
-	0xf49c, 0xf53a, 0xf5dc, 0xf2a7, 0xf3af, 0xf638, 0xf5ca, 0xf8b4,
-	0xfdf3, 0x005d, 0x0593, 0x0e0b, 0x135d, 0x1b55, 0x208d, 0x1f19,
-	0x1c99, 0x1873, 0x1388, 0x0ded, 0x05ef, 0xfff9, 0xfb40, 0xf494,
-	0xf0ac, 0xef74, 0xeec3, 0xef75, 0xf0b0, 0xf126, 0xf216, 0xf1b8,
-	0xf2db, 0xf4c5, 0xf48a, 0xf4a2, 0xf614, 0xf8e9, 0xfac7, 0xfdbd,
-	0x001e, 0x01d8, 0x06c2, 0x0b71, 0x0fb3, 0x12d2, 0x1313, 0x11cd,
-	0x0fca, 0x0d1f, 0x0c7f, 0x0b6e, 0x0579, 0x01de, 0xff99, 0xfc62,
-	0xfa32, 0xf726, 0xf56f, 0xf5a0, 0xf56a, 0xf43f, 0xf35f, 0xf2e9,
-	0xf3d1, 0xf4ee, 0xf57f, 0xf780, 0xf9ed, 0xfbdd, 0xfddb, 0xfec9,
-	0x009d, 0x0325, 0x0473, 0x06c9, 0x081d, 0x06e7, 0x06e8, 0x0792,
-	0x073a, 0x06fa, 0x062f, 0x05a5, 0x0630, 0x04bc, 0x0393, 0x0345,
-	0x0173, 0xfffc, 0xfdcf, 0xfc00, 0xfb20, 0xf9a5, 0xf82e, 0xf764,
-	0xf6ca, 0xf6af, 0xf6f8, 0xf74b, 0xf8a3, 0xf9a3, 0xfa5e, 0xfbc5,
-	0xfe53, 0x011c, 0x0218, 0x02ca, 0x03a4, 0x03ea, 0x0488, 0x0497,
-	0x046d, 0x043c, 0x0376, 0x031b, 0x02db, 0x020c, 0x00f9, 0x003f,
-	0xfffc, 0xffff, 0xff45, 0xff20, 0xffdd, 0xff6d, 0xfe3d, 0xfde1,
-	0xfda6, 0xfc71, 0xfc29, 0xfc26, 0xfb5d, 0xfbd5, 0xfcf4, 0xfde7,
-	0xff74, 0xff8e, 0xfeb5, 0xff22, 0xff61, 0x0018, 0x0110, 0x01cc,
-	0x0231, 0x013b, 0x0093, 0x0160, 0x00d2, 0xffbf, 0xfffb, 0xff52,
-	0xfe4a, 0xfe4b, 0xff06, 0xff33, 0xff24, 0xffa6, 0x00cd, 0x012c,
-	0x0082, 0x00db, 0x0074, 0xfdf1, 0xfd23, 0xfe9c, 0xff44, 0xff1d,
-	0xff1f, 0xfed1, 0xfe3c, 0xfd9e, 0xfde7, 0xfeaa, 0xfe84, 0xff38,
-	0xfff6, 0xffb8, 0xff78, 0xff6e, 0xff09, 0xfec6, 0xfdf4, 0xfca9,
-	0xfcca, 0xfd29, 0xfcd4, 0xfdc0, 0xffde, 0x00e5, 0x018e, 0x0249,
-	0x020b, 0x0168, 0x00e7, 0x016c, 0x02e4, 0x0341, 0x02ca, 0x01f3,
-	0x003c, 0xff3d, 0xff57, 0xff29, 0xfef3, 0xfec6, 0xff0b, 0xffbb,
-	0xfff9, 0xff92, 0xfed7, 0xfde5, 0xfcce, 0xfc41, 0xfbc6, 0xfb48,
-	0xfb59, 0xfb13, 0xfb14, 0xfbec, 0xfcf9, 0xfded, 0xff61, 0xffd0,
-	0xff79, 0x000d, 0x00a8, 0x0142, 0x01a2, 0x01d4, 0x01b5, 0x0111,
-	0x00f5, 0x01a2, 0x0194, 0x010c, 0x0118, 0x015d, 0x0195, 0x01dc,
-	0x01cf, 0x00dd, 0x0007, 0xffc7, 0xff93, 0xff43, 0xfea7, 0xfe4f,
-	0xfdf8, 0xfdd2, 0xfe7b, 0xfeb3, 0xfe9e, 0xfedd, 0xfe5d, 0xfda5,
-	0xfe20, 0xff00, 0xff6d, 0xffac, 0xff30, 0xfedb, 0xff28, 0xffa9,
-	0x0027, 0xffc8, 0xff9e, 0x001f, 0x0056, 0x00bb, 0x0155, 0x00ee,
-	0x0026, 0xfed1, 0xfd5b, 0xfcd5, 0xfd18, 0xfdab, 0xfe38, 0xff00,
-	0xff1d, 0xfea7, 0xfe50, 0xfe86, 0xfea4, 0xfe10, 0xfe9a, 0x001e,
-	0x00de, 0x0162, 0x00fb, 0xffe5, 0xff68, 0xff82, 0x000f, 0x00b6,
-	0x00c4, 0x0144, 0x01e8, 0x01c5, 0x019a, 0x0104, 0x0011, 0xff6b,
-	0xff26, 0xfee3, 0xfe73, 0xfde0, 0xfd52, 0xfd77, 0xfdc4, 0xfe01,
-	0xfe37, 0xfe54, 0xfdfe, 0xfd93, 0xfdd6, 0xff0a, 0x000e, 0x012f,
-	0x01fc, 0x0138, 0xfff3, 0xff0b, 0xfeff, 0xff9b, 0xffc3, 0x0004,
-	0x006e, 0x009b, 0x014f, 0x01e2, 0x01b4, 0x0133, 0x004f, 0xfff4,
-	0xffd8, 0xff5d, 0xfee8, 0xfeca, 0xff5e, 0x000f, 0x0033, 0x005a,
-	0x000a, 0xfe53, 0xfce5, 0xfcbd, 0xfd23, 0xfdee, 0xfef3, 0xff9c,
-	0xffaa, 0xff21, 0xfece, 0xfefc, 0xfee3, 0xff44, 0x0019, 0x0098,
-	0x0175, 0x01c7, 0x0154, 0x00b7, 0xffd6, 0xfeff, 0xfea3, 0xfeb2,
-	0xff25, 0xffca, 0x00bc, 0x01ae, 0x01f0, 0x0203, 0x0201, 0x015f,
-	0x0051, 0xffa7, 0xff4f, 0xfef6, 0xff1b, 0xfeeb, 0xfdad, 0xfc9b,
-	0xfc71, 0xfca5, 0xfd19, 0xfdb5, 0xfdf4, 0xfdd1, 0xfe2f, 0xfef8,
-	0xff9b, 0xffc7, 0xff0c, 0xfe17, 0xfd73, 0xfd30, 0xfd46, 0xfd82,
-	0xfea5, 0x008b, 0x01b7, 0x0219, 0x0273, 0x02b8, 0x0272, 0x0230,
-	0x025f, 0x0219, 0x0172, 0x00a7, 0x0036, 0xffb4, 0xff00, 0xfeef,
-	0xff62, 0xffdb, 0x0019, 0xffe9, 0xffb6, 0xffda, 0xffef, 0x001d,
-	0x0010, 0xff39, 0xfe4e, 0xfd5b, 0xfc87, 0xfbbf, 0xfad2, 0xfb42,
-	0xfc3d, 0xfd32, 0xfeba, 0xff2c, 0xfe5e, 0xfe29, 0xfe33, 0xfe9f,
-	0xffa7, 0xfff5, 0xffdd, 0xff0b, 0xfd91, 0xfd07, 0xfd1d, 0xfd93,
-	0xfec8, 0x002b, 0x0192, 0x02f9, 0x037d, 0x0325, 0x0285, 0x01aa,
-	0x00a0, 0xffe1, 0xff77, 0xfe98, 0xfde8, 0xfdca, 0xfe24, 0xfe8f,
-	0xff6d, 0x004f, 0x0026, 0xff9c, 0xfee7, 0xfe44, 0xfe49, 0xfea8,
-	0xff01, 0xfec7, 0xfd71, 0xfc30, 0xfb7d, 0xfb9d, 0xfcbb, 0xfdb9,
-	0xff06, 0x001e, 0x0109, 0x0214, 0x0274, 0x0226, 0x0161, 0x00aa,
-	0x001b, 0xff96, 0xff09, 0xfed0, 0xff1d, 0xff00, 0xff22, 0x0005,
-	0x006a, 0x0040, 0x0064, 0x0059, 0x006a, 0x0058, 0x0078, 0x0107,
-	0x00ca, 0x003f, 0xffb9, 0xfef0, 0xfe60, 0xfe49, 0xfe83, 0xff35,
-	0xffe9, 0x007b, 0x0178, 0x01e9, 0x0168, 0x005e, 0xff6f, 0xfea7,
-	0xfddf, 0xfd9f, 0xfe64, 0xff47, 0xffc6, 0x003a, 0x003b, 0xfff7,
-	0xffb0, 0xff78, 0xffe3, 0x00a0, 0x01c9, 0x0298, 0x021b, 0x0157,
-	0x0126, 0x00d7, 0x0055, 0x0015, 0xff82, 0xfedf, 0xfe81, 0xff17,
-	0x0069, 0x0166, 0x01a7, 0x0160, 0x00bf, 0xfffc, 0xfeec, 0xfd8a,
-	0xfcdb, 0xfcc4, 0xfcf8, 0xfe0f, 0xff21, 0xff75, 0xff6c, 0xffc5,
-	0x005f, 0x00bf, 0x011e, 0x0219, 0x022b, 0x012a, 0x0060, 0x0010,
-	0x0096, 0x0137, 0x014a, 0x017c, 0x016f, 0x00a2, 0x0048, 0x00d4,
-	0x0163, 0x0190, 0x0154, 0x0112, 0x0062, 0xff4c, 0xfe7c, 0xfdea,
-	0xfda2, 0xfe64, 0xff9c, 0x0011, 0xffcb, 0xfec1, 0xfe2a, 0xfe12,
-	0xfe51, 0xff5e, 0x001b, 0xffea, 0xff67, 0xfeae, 0xfe15, 0xfe27,
-	0xfe91, 0xfed1, 0xfee4, 0xfeb2, 0xfe8b, 0xfe73, 0xfe83, 0xfe50,
-	0xfe5a, 0xfeee, 0xfedf, 0xfe5f, 0xfe7c, 0xfebd, 0xfea2, 0xfeb1,
-	0xff48, 0x0001, 0x0034, 0xffd0, 0xffe3, 0xffbf, 0xff62, 0xffc1,
-	0x007e, 0x00ba, 0x005a, 0xffcd, 0xff9b, 0xff85, 0xff3e, 0xfef8,
-	0xfef6, 0xfecc, 0xfe2d, 0xfe18, 0xfe58, 0xfe20, 0xfd44, 0xfcaa,
-	0xfcfc, 0xfd8e, 0xfe16, 0xfebc, 0xfef1, 0xff29, 0xff91, 0xffca,
-	0xffd8, 0xff22, 0xfe7e, 0xfe6e, 0xfe2e, 0xfee0, 0x0007, 0x006f,
-	0x0083, 0x0056, 0x0028, 0x0036, 0x005a, 0x002d, 0xffac, 0xfeed,
-	0xfe9a, 0xff1b, 0x002f, 0x010e, 0x0102, 0x0062, 0xff44, 0xfdb5,
-	0xfcc9, 0xfcbb, 0xfccf, 0xfd40, 0xfe2b, 0xff4d, 0x0055, 0x005a,
-	0xfffd, 0xffd8, 0xff70, 0xff9a, 0x003d, 0x00f7, 0x015e, 0x00aa,
-	0xffea, 0xff92, 0xff61, 0xff81, 0xffdc, 0xffeb, 0xfffe, 0xffff,
-	0x0014, 0x0027, 0x0056, 0x0079, 0x0042, 0xfef0, 0xf993, 0xfa0c,
-	0xfe70, 0xfc91, 0xfc7c, 0xfe03, 0xfedb, 0x0071, 0x0160, 0x00c7,
-	0xfb76, 0xf7a1, 0xf8f3, 0xfdf8, 0x026d, 0xfee4, 0xfb0e, 0xfc43,
-	0x0089, 0x04ed, 0x06df, 0x0533, 0x0253, 0x01bc, 0x02d6, 0x0518,
-	0x04f3, 0x034a, 0x02fe, 0x0315, 0x02f8, 0x01b2, 0x0013, 0xff91,
-	0xff66, 0xff96, 0xfffb, 0x0110, 0x027c, 0x02ba, 0x01d6, 0x0093,
-	0xfff6, 0xffe7, 0xff65, 0xff38, 0xffa6, 0xfffe, 0xffc0, 0xff21,
-	0xff36, 0xffb4, 0xffab, 0xff3f, 0xfefc, 0xff5a, 0xffd7, 0xff75,
-	0xff1d, 0xff15, 0xfed3, 0xfef8, 0xfecd, 0xfeaa, 0xfe3c, 0xfd98,
-	0xfe30, 0xfe71, 0xfefd, 0xffbc, 0xff90, 0xff1e, 0xfeae, 0xff1c,
-	0xffc9, 0xffdd, 0xff9a, 0xfe93, 0xfd4a, 0xfda2, 0xfd33, 0xfb76,
-	0xfbb9, 0xfc6e, 0xfbf6, 0xfbd1, 0xfcab, 0xfdeb, 0xfe44, 0xfdff,
-	0xfd77, 0xfd3d, 0xfdba, 0xfe66, 0xfecb, 0xfe42, 0xff3d, 0x0101,
-	0x0120, 0x0124, 0x025b, 0x046f, 0x04be, 0x0316, 0x018d, 0x0225,
-	0x037f, 0x00da, 0xfc9b, 0xfbfa, 0xfd87, 0xfcdf, 0xf9e2, 0xf8cd,
-	0xf9fc, 0xfa95, 0xf903, 0xf7c8, 0xfa43, 0xfc7f, 0xfb8e, 0xfa46,
-	0xfc94, 0xff4a, 0xfd62, 0xfca5, 0x0097, 0x043f, 0x0578, 0x057d,
-	0x0784, 0x09e8, 0x097e, 0x08dd, 0x091f, 0x0a79, 0x0aea, 0x07c0,
-	0x03bd, 0x01ba, 0x008b, 0xfd6b, 0xf943, 0xf70b, 0xf533, 0xf2ca,
-	0xf12c, 0xf0ea, 0xf26b, 0xf2c2, 0xf179, 0xf23b, 0xf495, 0xf60b,
-	0xf6de, 0xf9fc, 0xff86, 0x037e, 0x0670, 0x0b47, 0x0ff1, 0x115e,
-	0x10cd, 0x11c8, 0x1440, 0x15db, 0x153d, 0x12dc, 0x111b, 0x0f4e,
-	0x0b0a, 0x04ea, 0x0099, 0xfd2b, 0xf7ac, 0xf263, 0xef2a, 0xecfa,
-	0xea96, 0xe7bc, 0xe7d4, 0xe866, 0xe818, 0xe9b6, 0xec39, 0xef87,
-	0xf0e2, 0xf31d, 0xf8a8, 0xfcf2, 0x014e, 0x0659, 0x0ad4, 0x0dac,
-	0x0f19, 0x12a9, 0x16cc, 0x17e7, 0x188b, 0x1aa2, 0x1ba6, 0x1a33,
-	0x1841, 0x1549, 0x1138, 0x0d17, 0x06f6, 0x0176, 0xfe34, 0xf935,
-	0xf3d6, 0xf149, 0xef22, 0xeb61, 0xe806, 0xe732, 0xe70c, 0xe605,
-	0xe6a9, 0xea31, 0xed29, 0xef19, 0xf21a, 0xf5a7, 0xf8f1, 0xfb16,
-	0xfeab, 0x03ec, 0x07f9, 0x0ac5, 0x0d0d, 0x10c9, 0x14d4, 0x165d,
-	0x16d6, 0x17e2, 0x19ec, 0x198b, 0x1724, 0x1628, 0x13a1, 0x0f87,
-	0x097f, 0x03fa, 0xfffb, 0xf91e, 0xf2e2, 0xf020, 0xeed0, 0xec09,
-	0xea61, 0xeab1, 0xeb0c, 0xea42, 0xea3a, 0xed0b, 0xee3e, 0xef60,
-	0xf17b, 0xf33d, 0xf485, 0xf605, 0xf8de, 0xfcaa, 0x008a, 0x045f,
-	0x07f4, 0x0a32, 0x0d12, 0x0fe0, 0x11e9, 0x136b, 0x14b7, 0x16c6,
-	0x1622, 0x1443, 0x141c, 0x1150, 0x0e1c, 0x0a84, 0x06fc, 0x04ca,
-	0xffd9, 0xfbfc, 0xf8ad, 0xf3a8, 0xf18e, 0xf08e, 0xeeca, 0xee5f,
-	0xecd9, 0xed73, 0xed08, 0xecdc, 0xefc0, 0xf049, 0xf18a, 0xf2d4,
-	0xf31b, 0xf4bc, 0xf739, 0xfad4, 0xfd8b, 0xffd3, 0x030f, 0x0585,
-	0x08b5, 0x0add, 0x0cbe, 0x0ef1, 0x128b, 0x1810, 0x1827, 0x18a0,
-	0x18c8, 0x147b, 0x11c8, 0x0e80, 0x0b4c, 0x08a9, 0x0457, 0x005b,
-	0xfc56, 0xf8bd, 0xf4f5, 0xf1ad, 0xeeff, 0xed42, 0xec3c, 0xeb93,
-	0xeb71, 0xeba1, 0xed6e, 0xecfa, 0xed63, 0xee56, 0xee11, 0xf0ea,
-	0xf326, 0xf568, 0xf95f, 0xfc1b, 0x0083, 0x04ba, 0x0901, 0x0c9f,
-	0x0eee, 0x1317, 0x158f, 0x189e, 0x1ab7, 0x1acd, 0x19a7, 0x195a,
-	0x1662, 0x0fc6, 0x0dbe, 0x093b, 0x02b8, 0xfffc, 0xfccf, 0xf9ad,
-	0xf765, 0xf2f7, 0xf10e, 0xee82, 0xea5f, 0xea7d, 0xe7ce, 0xe424,
-	0xe58b, 0xe2f4, 0xdf03, 0xe7ac, 0xedd8, 0xeebf, 0xf834, 0xfdb5,
-	0x009d, 0x083d, 0x0e69, 0x0fff, 0x1218, 0x1644, 0x1719, 0x1a0c,
-	0x195a, 0x1a2f, 0x1caa, 0x15c0, 0x151f, 0x146c, 0x0db4, 0x0b65,
-	0x0599, 0xfec9, 0xfb8e, 0xf3a6, 0xf07a, 0xef85, 0xe8a8, 0xe7ef,
-	0xe92a, 0xe98e, 0xeb0c, 0xe9fa, 0xecf5, 0xf015, 0xefd2, 0xf481,
-	0xf8a8, 0xfa00, 0xfd10, 0xfcaf, 0xfe18, 0x0299, 0xfe61, 0x0066,
-	0x062f, 0x04f9, 0x0b2f, 0x0e6b, 0x117d, 0x1603, 0x16c2, 0x1bd2,
-	0x1b78, 0x17ac, 0x17b0, 0x14c1, 0x0e5c, 0x0643, 0x009f, 0xfdd3,
-	0xf3c3, 0xed8f, 0xedc9, 0xe7ad, 0xe50a, 0xe632, 0xe760, 0xe892,
-	0xe9bb, 0xecb7, 0xed16, 0xed39, 0xf040, 0xf4cf, 0xf713, 0xfb00,
-	0x0090, 0x0303, 0x062f, 0x0a89, 0x0df0, 0x105c, 0x1543, 0x1a30,
-	0x1ca4, 0x1f8f, 0x1d3a, 0x1826, 0x1cdf, 0x1aef, 0x1312, 0x16af,
-	0x0dca, 0x005e, 0xfc05, 0xf36b, 0xedc3, 0xe47d, 0xe01a, 0xe310,
-	0xdd57, 0xdf40, 0xe4bc, 0xe67f, 0xebb1, 0xeedf, 0xf42c, 0xf5ce,
-	0xf796, 0xfff1, 0x00e4, 0x00b6, 0x045e, 0x0278, 0x0082, 0x023a,
-	0x05d1, 0x0b43, 0x0ef8, 0x1411, 0x18b8, 0x202d, 0x2131, 0x1b4d,
-	0x2209, 0x1c9b, 0x111b, 0x129e, 0x0a00, 0x01df, 0xfbcb, 0xf3a7,
-	0xf353, 0xe948, 0xe4ff, 0xe7b0, 0xdfb5, 0xe164, 0xe56c, 0xe74d,
-	0xea9f, 0xebea, 0xf20e, 0xf42f, 0xf5a9, 0xfdcd, 0xffe5, 0xff99,
-	0x02d0, 0x04a1, 0x051f, 0x036e, 0x0529, 0x097f, 0x09da, 0x0e44,
-	0x1538, 0x1cf1, 0x1f94, 0x1cfb, 0x244c, 0x2357, 0x1b45, 0x1c54,
-	0x15d9, 0x0c76, 0x0586, 0xf931, 0xf174, 0xe6d0, 0xdf3b, 0xe168,
-	0xde1e, 0xdebf, 0xe1a5, 0xe269, 0xe592, 0xe9ad, 0xef69, 0xf140,
-	0xf157, 0xf664, 0xf8f1, 0xfa02, 0xfe00, 0xffa2, 0x00d3, 0x0196,
-	0x05af, 0x0b59, 0x0cff, 0x13ee, 0x19a4, 0x1f7b, 0x2459, 0x1d6c,
-	0x22e3, 0x2479, 0x1a5b, 0x1be2, 0x1534, 0x0ab1, 0x039f, 0xf933,
-	0xf2d6, 0xe812, 0xe035, 0xe17b, 0xdba6, 0xda11, 0xdf90, 0xe172,
-	0xe5a0, 0xea20, 0xefdd, 0xf3ff, 0xf3d7, 0xf959, 0xfbdb, 0xfc68,
-	0x002e, 0xff8d, 0x0103, 0x00c1, 0xffc6, 0x05cb, 0x0981, 0x0c3e,
-	0x1457, 0x1945, 0x1f84, 0x207a, 0x1e5a, 0x224f, 0x1b32, 0x162e,
-	0x14cc, 0x0d04, 0x072b, 0xfe91, 0xf764, 0xf25f, 0xe9ad, 0xe736,
-	0xe68f, 0xe1eb, 0xe3b2, 0xe775, 0xe86b, 0xe7fe, 0xeb34, 0xf06b,
-	0xf0b8, 0xf646, 0xfa96, 0xf984, 0xfd3b, 0xfcde, 0xfc06, 0xfd37,
-	0xfb8b, 0xfe04, 0x02d7, 0x0730, 0x0de4, 0x1352, 0x19d3, 0x1f95,
-	0x1e8f, 0x2304, 0x24d4, 0x1d8d, 0x1c5e, 0x1723, 0x0eeb, 0x083d,
-	0xfc78, 0xf624, 0xec97, 0xe455, 0xe747, 0xe4a6, 0xe145, 0xe450,
-	0xe6b8, 0xe976, 0xecfd, 0xeef5, 0xf09c, 0xf081, 0xf1ac, 0xf29d,
-	0xf514, 0xf8bf, 0xf9a5, 0xfd7d, 0xfeb1, 0xff76, 0x0399, 0x0671,
-	0x0c03, 0x125c, 0x16fb, 0x1e58, 0x1f8c, 0x1d09, 0x21a0, 0x213d,
-	0x1cc5, 0x1ad1, 0x14fe, 0x0cf8, 0x0438, 0xfc6f, 0xf4e5, 0xe9e7,
-	0xe73e, 0xe657, 0xe020, 0xe331, 0xe506, 0xe52c, 0xeb43, 0xee0c,
-	0xf13d, 0xf4a6, 0xf7ce, 0xfb3f, 0xfb86, 0xfe02, 0xfcf3, 0xf9bc,
-	0xfa5c, 0xf9da, 0xfcf8, 0x00d8, 0x0448, 0x094b, 0x0d04, 0x12ac,
-	0x1931, 0x1a78, 0x1a02, 0x1e6f, 0x1cc0, 0x183d, 0x17ee, 0x11ca,
-	0x0b33, 0x0527, 0xfdda, 0xf776, 0xed81, 0xe971, 0xe7ff, 0xe37d,
-	0xe70a, 0xe854, 0xe732, 0xeb6d, 0xeef6, 0xf277, 0xf51f, 0xf769,
-	0xf9a1, 0xf8e4, 0xfa2a, 0xfbdc, 0xf82e, 0xf7c7, 0xf90b, 0xf7f6,
-	0xfba4, 0x01a0, 0x05a9, 0x0bbb, 0x13fc, 0x1bab, 0x1de4, 0x1d32,
-	0x21a9, 0x1e92, 0x1a9d, 0x1c45, 0x1234, 0x09b7, 0x0343, 0xf77c,
-	0xf393, 0xeda5, 0xea6f, 0xebfa, 0xe59a, 0xe86c, 0xec44, 0xe96d,
-	0xec8c, 0xef25, 0xefc0, 0xf0cc, 0xf408, 0xf776, 0xf6d4, 0xfa03,
-	0xfe88, 0xfbcc, 0xfd4c, 0x01a4, 0x013f, 0x0590, 0x0b3a, 0x0c7a,
-	0x0ea9, 0x11b2, 0x1758, 0x1b3e, 0x19a2, 0x1e55, 0x1ced, 0x1577,
-	0x16ec, 0x10fb, 0x068c, 0x013f, 0xf97f, 0xf23a, 0xec13, 0xe88b,
-	0xe800, 0xe3e5, 0xe490, 0xe966, 0xe846, 0xeb22, 0xf09f, 0xf0b5,
-	0xf3b9, 0xfa5a, 0xfdb4, 0xfd27, 0xfd2b, 0xfef6, 0xfcfd, 0xfbfc,
-	0xff91, 0xff6d, 0xffd7, 0x06a3, 0x0a11, 0x0c7a, 0x1121, 0x13fd,
-	0x17c7, 0x16a4, 0x1ac4, 0x1ed0, 0x16d9, 0x1945, 0x18c7, 0x0bbc,
-	0x0739, 0x00ca, 0xf5a5, 0xf16a, 0xecfc, 0xea37, 0xe5bd, 0xe07b,
-	0xe4e3, 0xe653, 0xe7b1, 0xeeda, 0xf13f, 0xf30f, 0xf803, 0xfc70,
-	0xfc79, 0xfad6, 0xfefd, 0xfdcf, 0xf998, 0xff09, 0x0044, 0xfdd1,
-	0x03b7, 0x0760, 0x0a10, 0x1088, 0x14a6, 0x1a9b, 0x1c78, 0x1d32,
-	0x225e, 0x1be3, 0x160d, 0x17ea, 0x0d1a, 0x0533, 0x03f0, 0xf94e,
-	0xf1ca, 0xee5d, 0xeaae, 0xe5cd, 0xe129, 0xe293, 0xe239, 0xe11f,
-	0xe6a2, 0xeab5, 0xecfd, 0xf43c, 0xf934, 0xfba7, 0xfea1, 0xfedb,
-	0xff41, 0xff76, 0x011a, 0x0357, 0x023d, 0x0431, 0x069c, 0x079a,
-	0x0e4b, 0x1370, 0x15f4, 0x1a92, 0x1abf, 0x1d1c, 0x1f26, 0x1929,
-	0x171a, 0x104d, 0x0709, 0x0403, 0xfaaa, 0xf2df, 0xf06b, 0xeae4,
-	0xe6c9, 0xe477, 0xe3a2, 0xe600, 0xe605, 0xe8ef, 0xf036, 0xf143,
-	0xf25c, 0xf5de, 0xf743, 0xfa0c, 0xfd3b, 0x0009, 0x003a, 0xff9f,
-	0x032c, 0x0304, 0x012d, 0x0577, 0x0723, 0x081b, 0x0db5, 0x11a4,
-	0x15ef, 0x17e3, 0x1a34, 0x1fb0, 0x1c4f, 0x18e5, 0x18cd, 0x0ffa,
-	0x08cb, 0x06c6, 0xfde4, 0xf459, 0xeff2, 0xeb17, 0xe622, 0xe46c,
-	0xe553, 0xe3da, 0xe251, 0xe85c, 0xec72, 0xebd6, 0xf0bb, 0xf4d0,
-	0xf542, 0xf97d, 0xfcaa, 0xfe88, 0x0242, 0x033c, 0x064c, 0x07c5,
-	0x05f4, 0x095d, 0x0b9a, 0x0ca0, 0x11c9, 0x1545, 0x168c, 0x15fe,
-	0x16f7, 0x1a28, 0x177e, 0x1544, 0x15d9, 0x0ec3, 0x07b2, 0x0604,
-	0xfbea, 0xf184, 0xee1f, 0xe646, 0xe124, 0xe1c5, 0xe0e5, 0xe297,
-	0xe665, 0xea8e, 0xf0cb, 0xf375, 0xf5b3, 0xfa6a, 0xfc1f, 0xfef3,
-	0x0313, 0x026f, 0x01f2, 0x029a, 0x024a, 0x0478, 0x067a, 0x0759,
-	0x0a08, 0x0d7e, 0x0fa5, 0x132e, 0x15d2, 0x148c, 0x14fb, 0x173c,
-	0x12e7, 0x0e45, 0x0ff7, 0x09b3, 0x02e6, 0x02fb, 0xfa97, 0xf3a7,
-	0xf3fe, 0xee8f, 0xebae, 0xede0, 0xea70, 0xe86c, 0xea38, 0xe9ee,
-	0xed5e, 0xf1c1, 0xf24d, 0xf5b4, 0xf9f7, 0xfb96, 0xfca5, 0xff20,
-	0xff15, 0xfd4c, 0xff9a, 0x00e8, 0x00a4, 0x0458, 0x07b9, 0x0a1f,
-	0x0e54, 0x10d8, 0x1371, 0x13b6, 0x1271, 0x174a, 0x16d8, 0x1202,
-	0x1420, 0x0d4e, 0x03b4, 0x0472, 0xfe63, 0xf623, 0xf5e9, 0xf153,
-	0xec88, 0xed1f, 0xeabb, 0xe942, 0xe90b, 0xe999, 0xec83, 0xeca0,
-	0xef38, 0xf42f, 0xf59d, 0xf9fc, 0xfe8f, 0xfe34, 0x0095, 0x0371,
-	0x0314, 0x05bb, 0x06e4, 0x0416, 0x04f8, 0x0657, 0x07d8, 0x0c1d,
-	0x0f38, 0x10ef, 0x1298, 0x1344, 0x140e, 0x12de, 0x0e69, 0x0cf6,
-	0x0920, 0x0174, 0xff67, 0xfc62, 0xf674, 0xf67d, 0xf5cc, 0xf1c7,
-	0xf17d, 0xf11a, 0xeec9, 0xef3c, 0xf0eb, 0xf1da, 0xf1e7, 0xf2f9,
-	0xf568, 0xf55d, 0xf86c, 0xfd31, 0xfcc7, 0xfdd5, 0x01c2, 0x0167,
-	0x0068, 0x0233, 0x01d2, 0x0180, 0x030d, 0x042c, 0x0679, 0x091d,
-	0x0bd9, 0x0fef, 0x10e9, 0x0ff0, 0x12db, 0x11ef, 0x0d8a, 0x0f85,
-	0x0c93, 0x03ed, 0x0208, 0xfc29, 0xf4ca, 0xf5dc, 0xf3fd, 0xeffb,
-	0xf164, 0xf097, 0xefba, 0xf0e2, 0xf045, 0xf1c6, 0xf199, 0xf12d,
-	0xf5eb, 0xf774, 0xf77a, 0xfbbf, 0xfdf9, 0xfeb6, 0x00b9, 0x00b5,
-	0x001d, 0x01fc, 0x0433, 0x065d, 0x08a2, 0x09cb, 0x0a28, 0x0cd8,
-	0x1066, 0x0fda, 0x10da, 0x128e, 0x0f58, 0x0e38, 0x0f39, 0x0957,
-	0x02c5, 0x0119, 0xfb88, 0xf450, 0xf28f, 0xf0c5, 0xee6a, 0xef63,
-	0xf102, 0xf231, 0xf2d2, 0xf32e, 0xf6ca, 0xfac8, 0xfb3b, 0xfd43,
-	0xfd96, 0xfa82, 0xfb2b, 0xfd0f, 0xfcda, 0xfcc5, 0xfdda, 0xff2a,
-	0xff4f, 0x00ae, 0x039e, 0x0386, 0x03c6, 0x071e, 0x08f4, 0x0bd9,
-	0x0eb2, 0x0eb3, 0x11de, 0x12da, 0x0eb3, 0x0d1c, 0x0a00, 0x0418,
-	0x01e5, 0xff57, 0xf96a, 0xf581, 0xf284, 0xefbe, 0xef98, 0xf035,
-	0xf055, 0xf0a3, 0xf259, 0xf51c, 0xf6cd, 0xf7bb, 0xfa20, 0xfa85,
-	0xf879, 0xfa8c, 0xfbce, 0xf8d3, 0xfc34, 0x00c5, 0xffdd, 0x03c8,
-	0x078c, 0x04b6, 0x0802, 0x0e31, 0x0e89, 0x11d7, 0x13f2, 0x0f82,
-	0x0f3c, 0x11b7, 0x0e97, 0x0b8c, 0x0b76, 0x070e, 0x00b6, 0xfec3,
-	0xfbab, 0xf3c6, 0xef2b, 0xef0e, 0xebd6, 0xe89b, 0xeb4d, 0xeed8,
-	0xefa1, 0xf1f5, 0xf64d, 0xf78a, 0xf72d, 0xfa18, 0xfdc1, 0xfea8,
-	0xffb3, 0x01b9, 0x012b, 0x0019, 0x01bb, 0x03ef, 0x050e, 0x067a,
-	0x099f, 0x0cb1, 0x0dc2, 0x1041, 0x1231, 0x0ea0, 0x0d82, 0x1019,
-	0x0b84, 0x06f8, 0x082d, 0x047d, 0x0005, 0xff9b, 0xface, 0xf4d9,
-	0xf2c0, 0xf0c7, 0xf073, 0xf0c2, 0xef19, 0xef35, 0xef4f, 0xef48,
-	0xf3aa, 0xf73f, 0xf7f5, 0xfb42, 0xfe10, 0xfe8c, 0xffc9, 0xff41,
-	0xfe12, 0xfe23, 0xfc17, 0xfc9c, 0x0127, 0x03a3, 0x07df, 0x0e5f,
-	0x124a, 0x1662, 0x172b, 0x14f4, 0x187d, 0x1928, 0x133d, 0x11b6,
-	0x0d95, 0x031c, 0xfe01, 0xfa0e, 0xf26b, 0xee0d, 0xeba2, 0xe958,
-	0xea3e, 0xeb55, 0xeb23, 0xebdc, 0xed8f, 0xefec, 0xf188, 0xf2d1,
-	0xf5ac, 0xf810, 0xfa68, 0xfde4, 0xfe89, 0xfda1, 0xff6d, 0x0074,
-	0x01fd, 0x073f, 0x0a87, 0x0b36, 0x0de8, 0x1248, 0x177e, 0x1a57,
-	0x1a1a, 0x1c86, 0x1d42, 0x17de, 0x137d, 0x0f6a, 0x06e3, 0xfcd5,
-	0xf46b, 0xeecc, 0xe88d, 0xe2ed, 0xe3bd, 0xe520, 0xe597, 0xe9f4,
-	0xec05, 0xedae, 0xf354, 0xf6ab, 0xfa2b, 0xfe59, 0xfd90, 0xfcdd,
-	0xfdc1, 0xfd6e, 0xfd00, 0xfc4a, 0xfced, 0xffbf, 0x0374, 0x0823,
-	0x0c85, 0x0ff9, 0x13c4, 0x18b0, 0x1ace, 0x18a6, 0x1a69, 0x1c74,
-	0x177f, 0x1432, 0x10d9, 0x0852, 0xff9d, 0xf668, 0xf0ef, 0xee60,
-	0xe844, 0xe540, 0xe3c6, 0xe1d3, 0xe53c, 0xe865, 0xed02, 0xf35d,
-	0xf46d, 0xf92c, 0xff39, 0xfe38, 0xfdc1, 0xfd78, 0xfc7c, 0xfc64,
-	0xf9e6, 0xfa75, 0xfe06, 0x012e, 0x06e8, 0x0beb, 0x0fc8, 0x1509,
-	0x195d, 0x1c77, 0x1e93, 0x2028, 0x1edc, 0x199d, 0x14ec, 0x0e9d,
-	0x06e4, 0xff56, 0xf5a1, 0xef78, 0xeb76, 0xe669, 0xe571, 0xe3d2,
-	0xe289, 0xe5f0, 0xe7b3, 0xebc5, 0xf165, 0xf283, 0xf74f, 0xfd9a,
-	0xfed7, 0xfe9e, 0xfdbc, 0xfdca, 0xfe76, 0xfdf5, 0xffbc, 0x0285,
-	0x03d8, 0x068a, 0x0bae, 0x117c, 0x173f, 0x1bf4, 0x1caf, 0x1daf,
-	0x202c, 0x1c20, 0x160f, 0x1181, 0x0853, 0xff15, 0xf6d6, 0xef33,
-	0xeb9b, 0xe775, 0xe5c0, 0xe7bd, 0xe63c, 0xe576, 0xe7e4, 0xebff,
-	0xf125, 0xf3b1, 0xf717, 0xfa13, 0xfa2d, 0xfc02, 0xfc79, 0xfd37,
-	0xff16, 0xfd5d, 0xfec8, 0x0272, 0x0421, 0x0846, 0x0b52, 0x0db6,
-	0x127d, 0x174b, 0x1a31, 0x1874, 0x19a7, 0x1d8f, 0x19a2, 0x1522,
-	0x1098, 0x086b, 0x01f8, 0xf99f, 0xf427, 0xf091, 0xe64f, 0xe1dc,
-	0xe24f, 0xe0ed, 0xe3dd, 0xe6a5, 0xebf0, 0xf233, 0xf289, 0xf757,
-	0xfb1a, 0xf946, 0xfa7b, 0xf96a, 0xf968, 0xfb1a, 0xf8c2, 0xfc0f,
-	0x00ef, 0x041e, 0x0aab, 0x0d61, 0x113d, 0x1907, 0x1d9d, 0x217a,
-	0x220a, 0x2075, 0x1ed6, 0x1907, 0x13e6, 0x0d37, 0x0410, 0xfd64,
-	0xf429, 0xee49, 0xebfe, 0xe570, 0xe2e1, 0xe2be, 0xe21c, 0xe562,
-	0xe70f, 0xeaa9, 0xefc8, 0xf21e, 0xf866, 0xfb68, 0xf9be, 0xfbec,
-	0xfb5b, 0xfaed, 0xfd54, 0xfcaf, 0xfe56, 0x0070, 0x02c0, 0x09fb,
-	0x0eb4, 0x141d, 0x1cf2, 0x1ee1, 0x1ef8, 0x21cb, 0x2042, 0x1b4d,
-	0x1591, 0x0f3b, 0x07e7, 0xfe8e, 0xf6ab, 0xf1a3, 0xecee, 0xe959,
-	0xe7d4, 0xe706, 0xe5d3, 0xe647, 0xea98, 0xef7c, 0xf1e6, 0xf309,
-	0xf4af, 0xf772, 0xf844, 0xf746, 0xf991, 0xfb2d, 0xf8db, 0xf945,
-	0xfd58, 0x00d4, 0x02ed, 0x0602, 0x0c41, 0x104b, 0x1387, 0x19b9,
-	0x1a1f, 0x1951, 0x1e71, 0x1dc1, 0x18df, 0x1469, 0x0d04, 0x07cd,
-	0x00e5, 0xf87d, 0xf55d, 0xef16, 0xe84d, 0xe7b4, 0xe703, 0xe86b,
-	0xea89, 0xec08, 0xf202, 0xf58c, 0xf5d7, 0xf800, 0xf912, 0xf8c5,
-	0xf6bd, 0xf639, 0xf7bf, 0xf566, 0xf57e, 0xfad5, 0xff33, 0x0297,
-	0x05f0, 0x0bfc, 0x13a0, 0x19d9, 0x1f7f, 0x2009, 0x1f7f, 0x20c7,
-	0x1c35, 0x17c4, 0x1306, 0x09a0, 0x02a1, 0xf9da, 0xf26c, 0xeff1,
-	0xe8ff, 0xe5bc, 0xe6b6, 0xe4ac, 0xe7d6, 0xeb6d, 0xec76, 0xf159,
-	0xf570, 0xf9ce, 0xfc7c, 0xfabe, 0xfb1b, 0xfa59, 0xf8af, 0xf930,
-	0xf819, 0xf874, 0xf9ac, 0xfc1f, 0x02da, 0x0939, 0x1076, 0x1916,
-	0x1ed1, 0x2187, 0x2164, 0x219a, 0x1f80, 0x1816, 0x12cb, 0x0c49,
-	0x024b, 0xf9c2, 0xf174, 0xee0d, 0xec02, 0xe65c, 0xe688, 0xe753,
-	0xe5e7, 0xeb05, 0xf0ce, 0xf4a6, 0xf7e8, 0xf828, 0xfa78, 0xfc79,
-	0xfa71, 0xf9b6, 0xf9d4, 0xf8d7, 0xf82a, 0xf939, 0xfb99, 0xfcd3,
-	0xfea5, 0x0378, 0x092b, 0x0f42, 0x161a, 0x1a56, 0x1b69, 0x1f49,
-	0x2238, 0x1ccc, 0x172f, 0x133b, 0x0b70, 0x0383, 0xfacd, 0xf2e5,
-	0xed65, 0xe633, 0xe3c8, 0xe599, 0xe515, 0xe757, 0xeb03, 0xef64,
-	0xf56b, 0xf856, 0xfac1, 0xfca2, 0xfd7e, 0xff61, 0xfd87, 0xfb3c,
-	0xfa37, 0xf8b8, 0xfab8, 0xfaf0, 0xfb68, 0x001c, 0x01b5, 0x077f,
-	0x12c4, 0x1a8d, 0x1e72, 0x1d8b, 0x2039, 0x22f9, 0x1a93, 0x160c,
-	0x12d2, 0x07af, 0xffc0, 0xf7d5, 0xf1c3, 0xed5c, 0xe3c2, 0xe3c3,
-	0xe63c, 0xe216, 0xe61b, 0xea0b, 0xecd1, 0xf4e1, 0xf901, 0xfe50,
-	0x0098, 0xfe22, 0x0313, 0x03db, 0x00b2, 0x01b1, 0xff01, 0xfe5c,
-	0xfd8f, 0xfbaf, 0x00b9, 0x015d, 0x0211, 0x0af7, 0x1067, 0x1386,
-	0x14ea, 0x16fc, 0x1bfb, 0x1864, 0x1570, 0x159a, 0x0c15, 0x03a2,
-	0xfe6d, 0xf76e, 0xf14e, 0xe882, 0xe51e, 0xe57e, 0xe2ad, 0xe737,
-	0xebd1, 0xed15, 0xf3e2, 0xf7db, 0xfc5e, 0x01df, 0x0100, 0x0498,
-	0x07e7, 0x05ab, 0x067b, 0x0434, 0x00bf, 0xff85, 0xfc2f, 0xfc2e,
-	0xfa9d, 0xf7a0, 0xfc20, 0x000f, 0x03e7, 0x0a97, 0x0db1, 0x108c,
-	0x126a, 0x13c1, 0x16d4, 0x1410, 0x0fa7, 0x0cd6, 0x0659, 0x00a9,
-	0xfb3e, 0xf4a7, 0xf042, 0xec84, 0xeb94, 0xec32, 0xec1f, 0xee57,
-	0xf01c, 0xf2ff, 0xf75f, 0xf892, 0xfbc6, 0xfff6, 0x01d3, 0x0550,
-	0x06e9, 0x063b, 0x060e, 0x04f9, 0x0571, 0x05e1, 0x0505, 0x0451,
-	0x0179, 0xff85, 0xff25, 0xfdc8, 0xfdbb, 0xfe08, 0xffbb, 0x031d,
-	0x041f, 0x0541, 0x0669, 0x05b8, 0x05fd, 0x053b, 0x0296, 0xff83,
-	0xfd60, 0xfd24, 0xfba2, 0xfafc, 0xfb31, 0xf77b, 0xf61f, 0xf7fd,
-	0xf7d2, 0xf8be, 0xfa22, 0xfac4, 0xfbc3, 0xfd82, 0x018f, 0x0309,
-	0x0352, 0x0770, 0x09f2, 0x0ba8, 0x0dde, 0x0ce0, 0x0c6c, 0x0bcb,
-	0x09d5, 0x084f, 0x0411, 0xffd1, 0xfc57, 0xf7ff, 0xf5f6, 0xf2c1,
-	0xef09, 0xef1b, 0xef0e, 0xf0aa, 0xf51c, 0xf898, 0xfbba, 0xfd95,
-	0x009d, 0x0477, 0x03ee, 0x047a, 0x0627, 0x042d, 0x038f, 0x0303,
-	0xffef, 0xfd3c, 0xfb47, 0xfa93, 0xf8bb, 0xf5e5, 0xf644, 0xf76a,
-	0xf9b1, 0xfdbe, 0xff6e, 0x008e, 0x01a3, 0x0243, 0x0541, 0x076f,
-	0x075c, 0x077f, 0x0692, 0x05a4, 0x059c, 0x044d, 0x024a, 0x000f,
-	0xfe74, 0xfde0, 0xfcc1, 0xfb55, 0xf9eb, 0xf932, 0xfab5, 0xfb3c,
-	0xfa9b, 0xfbdd, 0xfd47, 0xfef7, 0x022d, 0x03ae, 0x036b, 0x046c,
-	0x0621, 0x0743, 0x07bb, 0x07a1, 0x0664, 0x03ea, 0x0273, 0x015a,
-	0xfe8a, 0xfcc3, 0xfc33, 0xfbad, 0xfcc2, 0xfd80, 0xfceb, 0xfca6,
-	0xfc97, 0xfd77, 0xfe19, 0xfd26, 0xfce8, 0xfd90, 0xff1f, 0x015c,
-	0x01e5, 0x013c, 0xfff7, 0xff08, 0xff69, 0xfed3, 0xfe73, 0xff40,
-	0xfdf2, 0xfcda, 0xfd7f, 0xfd11, 0xfcee, 0xfd6f, 0xfe00, 0xff55,
-	0x002b, 0x0137, 0x01d6, 0x0214, 0x0360, 0x03c1, 0x035d, 0x02dc,
-	0x0164, 0x010d, 0x0137, 0x0014, 0xfeb6, 0xfcf8, 0xfc07, 0xfc44,
-	0xfc59, 0xfda6, 0xff38, 0xfef5, 0xff23, 0xffd3, 0xfee0, 0xfdad,
-	0xfdd4, 0xfe47, 0xfdde, 0xfe3f, 0xfee4, 0xfd0e, 0xfbfe, 0xfd86,
-	0xfdd3, 0xfcf8, 0xfc48, 0xfbde, 0xfc76, 0xfea5, 0x00d7, 0x00e3,
-	0x0004, 0xfff9, 0x006d, 0x01e8, 0x034b, 0x034a, 0x02c2, 0x02a5,
-	0x0271, 0x0172, 0x00f2, 0x004e, 0xfecd, 0xfe72, 0xfebe, 0xfda1,
-	0xfca3, 0xfc85, 0xfcbe, 0xfd2d, 0xfd87, 0xfcfd, 0xfce6, 0xfdd3,
-	0xff83, 0x008e, 0x0042, 0xff56, 0xfee0, 0xffc4, 0x0093, 0x0093,
-	0x015e, 0x012d, 0x005d, 0x00fc, 0x00d7, 0xfff4, 0xffae, 0x0063,
-	0x0224, 0x0392, 0x0449, 0x040b, 0x02b7, 0x01bd, 0x00c9, 0xfef2,
-	0xfd04, 0xfb91, 0xfb0f, 0xfc00, 0xfd93, 0xfe02, 0xfd0e, 0xfcc9,
-	0xfdda, 0xfe8b, 0xff5e, 0x007f, 0x0010, 0xff91, 0x007c, 0x00b7,
-	0x001c, 0xff33, 0xfe82, 0xfe8d, 0xff02, 0xfef9, 0xfe6b, 0xfe86,
-	0xff7f, 0x00a2, 0x0197, 0x014a, 0x004c, 0xffcb, 0x0084, 0x01c3,
-	0x0189, 0x0013, 0xff29, 0xff40, 0xffc7, 0x0092, 0x0121, 0x0067,
-	0x0022, 0x0108, 0x00a8, 0xfed8, 0xfd74, 0xfd04, 0xfda1, 0xfedd,
-	0xff6a, 0xfe8a, 0xfd6b, 0xfd1f, 0xfe22, 0xff56, 0xff0c, 0xfe80,
-	0xfe9d, 0xff9e, 0x00eb, 0x00e2, 0xff80, 0xfe25, 0xfd98, 0xfd9d,
-	0xfe10, 0xfeb5, 0xfeb8, 0xff2c, 0x00a3, 0x0179, 0x00f5, 0x0029,
-	0x000e, 0x0040, 0x00d4, 0x0148, 0x00ee, 0x0068, 0x0045, 0x00d2,
-	0x0134, 0x0034, 0xff13, 0xfe28, 0xfe39, 0xffaf, 0xffdc, 0xfef0,
-	0xfe88, 0xfe7f, 0xfea1, 0xff3d, 0xff8a, 0xfea3, 0xfdf3, 0xfe94,
-	0xff39, 0xff4e, 0xff23, 0xfeec, 0xff7a, 0x011c, 0x0255, 0x0270,
-	0x0215, 0x0157, 0x0157, 0x0143, 0xfff1, 0xfe66, 0xfce3, 0xfc77,
-	0xfde3, 0xff1c, 0xff0c, 0xfe7f, 0xfecd, 0xffa2, 0x00ac, 0x014a,
-	0x008a, 0xffd4, 0x001b, 0x0046, 0xffc5, 0xfeb7, 0xfda2, 0xfd14,
-	0xfd5a, 0xfdea, 0xfdcb, 0xfd41, 0xfd5f, 0xfea9, 0xffb6, 0xff9c,
-	0xff62, 0xff36, 0xff9e, 0x0134, 0x0207, 0x00e2, 0xff7d, 0xff1f,
-	0xff14, 0xffc6, 0x0086, 0x0016, 0x0045, 0x0125, 0x01a3, 0x0160,
-	0x0081, 0xffe6, 0xffb0, 0x000b, 0x00a9, 0x0051, 0xff8f, 0xff59,
-	0xffcc, 0x0055, 0xffe6, 0xfec4, 0xfd4d, 0xfc8c, 0xfd4a, 0xfe1d,
-	0xfdb5, 0xfd70, 0xfd5c, 0xfcc8, 0xfd07, 0xfdc4, 0xfe43, 0xff57,
-	0x0069, 0x0199, 0x0249, 0x0190, 0x0074, 0xffa0, 0xff83, 0xffd0,
-	0xff7e, 0xfefb, 0xfee2, 0xff70, 0x0063, 0x00be, 0x0090, 0xff92,
-	0xfe9a, 0xff44, 0x0008, 0xff33, 0xfe51, 0xfdf7, 0xfd8b, 0xfe56,
-	0xff4a, 0xff21, 0xfed4, 0xfed0, 0xff59, 0xffc7, 0xff60, 0xfe90,
-	0xfdfe, 0xfeed, 0x005d, 0x0083, 0xffd0, 0xff11, 0xfecd, 0xff47,
-	0xff78, 0xfefb, 0xfe16, 0xfdb3, 0xff0e, 0x0110, 0x0197, 0x014e,
-	0x00cd, 0xfff8, 0xfffa, 0x0051, 0xffb7, 0xff1a, 0xff1e, 0xff72,
-	0xff63, 0xff01, 0xfe21, 0xfda2, 0xfe31, 0xfec3, 0xfef7, 0xfecb,
-	0xfe9b, 0xffad, 0x010e, 0x017e, 0x00c1, 0xfeaa, 0xfd3c, 0xfdf5,
-	0xff03, 0xff25, 0xff06, 0xfe92, 0xfdbe, 0xfe10, 0xff4f, 0x0022,
-	0x004a, 0x00a8, 0x0177, 0x0203, 0x0200, 0x014a, 0x00b5, 0x00df,
-	0x00f6, 0x0130, 0x0128, 0x0089, 0x0050, 0x0072, 0x008c, 0xffec,
-	0xfdff, 0xfc73, 0xfc84, 0xfd4f, 0xfd5d, 0xfd64, 0xfd1a, 0xfc1b,
-	0xfc4c, 0xfda0, 0xff40, 0x0080, 0x0177, 0x021e, 0x021f, 0x017b,
-	0x0040, 0xff94, 0xff7b, 0xff81, 0xff7c, 0xfef6, 0xfe49, 0xfeb9,
-	0x0002, 0x0184, 0x0244, 0x0102, 0xff3d, 0xff3e, 0x000f, 0x000b,
-	0x0028, 0xff8f, 0xfdf3, 0xfd8a, 0xfdf4, 0xfe7f, 0xfed6, 0xff41,
-	0x0015, 0x00ad, 0x010c, 0x006b, 0xffac, 0xffb3, 0xfff8, 0x0073,
-	0x0092, 0x0025, 0xffd3, 0x001e, 0x0079, 0x006a, 0xff59, 0xfd9e,
-	0xfd90, 0xfed2, 0xff9d, 0x0045, 0x004f, 0xffa5, 0xff8c, 0xffb4,
-	0xff99, 0xff94, 0xffec, 0x0099, 0x00fb, 0x010d, 0x0060, 0xff60,
-	0xff33, 0xff6f, 0xffbd, 0xff4e, 0xfe47, 0xfe1d, 0xfe80, 0xff82,
-	0x0038, 0xff58, 0xfd48, 0xfc43, 0xfcf2, 0xfdc4, 0xfeef, 0xffc0,
-	0xfeee, 0xfe52, 0xfe8b, 0xff2c, 0xffdd, 0x00b0, 0x0178, 0x0137,
-	0x00e3, 0x0058, 0xffcc, 0xffcf, 0xfff2, 0x0093, 0x0077, 0xffae,
-	0xff30, 0xff50, 0xffc8, 0x000c, 0xffa9, 0xfdc7, 0xfcc0, 0xfd89,
-	0xfdf9, 0xfed9, 0xff5a, 0xfe27, 0xfd4c, 0xfda2, 0xfe62, 0xff4e,
-	0x0033, 0x00ec, 0x0144, 0x017c, 0x00ae, 0xff84, 0xfefa, 0xfedd,
-	0xff28, 0xfef5, 0xfe4a, 0xfe25, 0xff22, 0x0106, 0x02e1, 0x02ed,
-	0x0059, 0xfe55, 0xfe25, 0xfe9e, 0xff7f, 0x0002, 0xfee6, 0xfd38,
-	0xfc69, 0xfd16, 0xfdf9, 0xfeeb, 0xffea, 0x00b5, 0x01a7, 0x0173,
-	0x00ad, 0x00a0, 0x00e8, 0x014a, 0x00b9, 0xff90, 0xfe8a, 0xfe1f,
-	0xfe92, 0xff6b, 0xff3e, 0xfd85, 0xfc8b, 0xfcc7, 0xfd76, 0xfe73,
-	0xff49, 0xff3e, 0xfec6, 0xff1c, 0xff89, 0xffa6, 0x002a, 0x0089,
-	0x0114, 0x01e6, 0x018b, 0x00af, 0xfff0, 0xffad, 0x0014, 0x0027,
-	0xff36, 0xfe30, 0xfdbf, 0xfe40, 0xff89, 0xffb7, 0xfe7e, 0xfda7,
-	0xfda0, 0xfe0a, 0xff82, 0x00d0, 0x00ba, 0xffd1, 0xfef4, 0xfea7,
-	0xfe95, 0xff50, 0xfff1, 0x0076, 0x0113, 0x00c4, 0x004f, 0x0044,
-	0x009c, 0x01be, 0x025f, 0x01a8, 0x00a7, 0xffc9, 0xffd3, 0x0128,
-	0x0102, 0xfebe, 0xfd0a, 0xfc08, 0xfbd7, 0xfd2b, 0xfdba, 0xfdaf,
-	0xfd6a, 0xfd11, 0xfd6c, 0xfdf8, 0xfede, 0xff94, 0x0079, 0x0156,
-	0x0189, 0x00db, 0xffbc, 0xff88, 0x0025, 0x0101, 0x00ee, 0xffa0,
-	0xffa2, 0x004f, 0x01ae, 0x039c, 0x0225, 0xffe3, 0xff14, 0xfe2e,
-	0xfeb5, 0xffa9, 0xfee2, 0xfdf8, 0xfd7c, 0xfc82, 0xfce3, 0xfe1e,
-	0xfefb, 0xffc1, 0x0031, 0x002b, 0xff98, 0xfe7e, 0xff47, 0x0049,
-	0xffab, 0xfff9, 0xff06, 0xfda9, 0xff27, 0x00e2, 0x0176, 0x01a1,
-	0x00c8, 0xff30, 0xfff2, 0x012e, 0x00b0, 0x00be, 0x008e, 0xff8f,
-	0xfe36, 0xfddf, 0xfec5, 0xfe64, 0xffc3, 0x0124, 0x0094, 0x0101,
-	0xffce, 0xfee1, 0xffe9, 0x0119, 0x0143, 0x004a, 0xffc6, 0xfeb2,
-	0xff0a, 0x00bf, 0x0044, 0xfe81, 0xfe22, 0xfdfa, 0xfe87, 0x0002,
-	0xffce, 0xffb8, 0x000f, 0xff14, 0xfe58, 0xffac, 0xff5e, 0xffb2,
-	0x014c, 0x02cd, 0x01e7, 0x0103, 0x0161, 0xfcc8, 0x0541, 0x0375,
-	0xfa0e, 0x05d9, 0xfe7a, 0xfbf2, 0x08b4, 0x00bd, 0xfea0, 0x04bb,
-	0xffe2, 0xfe6f, 0x01f2, 0x01a6, 0xfa63, 0xfb0c, 0x037b, 0xf47d,
-	0xf833, 0x04c6, 0xf4e5, 0xfdf9, 0x06f9, 0xf701, 0x00a8, 0x0731,
-	0xf713, 0x04be, 0x0a6f, 0xf6fe, 0x037f, 0x052b, 0xfa92, 0x08d3,
-	0x01b1, 0xfd24, 0x03e7, 0xffe3, 0xff43, 0xfecb, 0x019f, 0x0023,
-	0xfc34, 0xfb81, 0xfe8f, 0xfb44, 0xfcae, 0x02fb, 0xfd63, 0x037a,
-	0x0354, 0xfe88, 0x0749, 0xfe92, 0x0592, 0x078e, 0xf979, 0x0b24,
-	0xfea8, 0xfaa4, 0x0a65, 0xf532, 0xfd8c, 0x01b3, 0xf494, 0xfed0,
-	0xfb4c, 0xfb90, 0xfa3e, 0xfa3e, 0xfa7e, 0xed6a, 0xfc62, 0xf8b1,
-	0xef4b, 0xff5d, 0xf35e, 0xf357, 0xfd27, 0xf914, 0xfcea, 0xfe01,
-	0x020c, 0xffbe, 0x0481, 0x058f, 0x01de, 0x0ce7, 0x0680, 0x0fdc,
-	0x1333, 0x0604, 0x1c0f, 0x1ad7, 0x1427, 0x2815, 0x15c3, 0x1328,
-	0x1ff7, 0x09e8, 0x0a08, 0x0774, 0xf714, 0xf368, 0xed9c, 0xe63d,
-	0xde34, 0xe03a, 0xde4b, 0xdbe7, 0xe744, 0xe4f3, 0xe34a, 0xf22c,
-	0xf398, 0xf455, 0x0281, 0xfeaf, 0xfc0c, 0x07bb, 0x0188, 0xfd8f,
-	0x0604, 0xfebb, 0xfa3f, 0x001a, 0xfb7c, 0xfb35, 0x05b2, 0x0772,
-	0x0c8f, 0x1ab1, 0x1828, 0x1bf6, 0x2461, 0x1eb0, 0x2079, 0x1dcf,
-	0x14dd, 0x0d98, 0x02d7, 0xfb93, 0xefde, 0xe7ca, 0xe37d, 0xd92d,
-	0xd79d, 0xd61b, 0xd86d, 0xddfc, 0xdf43, 0xe763, 0xeb9b, 0xef90,
-	0xf742, 0xf9c5, 0xfed9, 0x029b, 0x061e, 0x07a0, 0x03ff, 0x05f8,
-	0x0614, 0x085d, 0x0c4c, 0x0d7c, 0x10af, 0x1603, 0x19cd, 0x1b96,
-	0x202a, 0x1cbe, 0x1ba9, 0x1b7e, 0x126c, 0x0e86, 0x078f, 0xfd8b,
-	0xf54d, 0xed24, 0xe72b, 0xe18b, 0xdf4a, 0xddb5, 0xe0cf, 0xe38d,
-	0xe3ff, 0xe9a1, 0xec6c, 0xf16b, 0xf774, 0xf8cc, 0xfb87, 0xfc9b,
-	0xfd68, 0xfe8b, 0xfe9f, 0x0084, 0x00c9, 0x016b, 0x044b, 0x0885,
-	0x0ed1, 0x15af, 0x190f, 0x1c61, 0x2268, 0x2249, 0x21ac, 0x22be,
-	0x1e1b, 0x197d, 0x1433, 0x0ab9, 0x018f, 0xf95c, 0xf206, 0xeb2e,
-	0xe78c, 0xe3c7, 0xdfae, 0xe180, 0xe1f3, 0xe470, 0xe8ce, 0xe983,
-	0xed32, 0xf10f, 0xf394, 0xf608, 0xf7c7, 0xfaf1, 0xf9fc, 0xf85c,
-	0xf9bb, 0xf940, 0xfbf8, 0x0080, 0x0537, 0x0da5, 0x1635, 0x19ce,
-	0x2091, 0x28de, 0x28a0, 0x2a82, 0x2abf, 0x22a9, 0x1cfe, 0x16d8,
-	0x0bae, 0x02ee, 0xfaae, 0xee15, 0xe6bd, 0xe432, 0xde48, 0xde00,
-	0xe08d, 0xdf09, 0xe2a7, 0xe6e5, 0xe816, 0xec29, 0xf1d8, 0xf2d1,
-	0xf35f, 0xf78d, 0xf5d8, 0xf3b6, 0xf7a7, 0xf756, 0xf9ab, 0x000c,
-	0x0061, 0x0665, 0x0fc6, 0x14f0, 0x1ccc, 0x246b, 0x2682, 0x27ca,
-	0x29cd, 0x28aa, 0x247a, 0x1f56, 0x1830, 0x0cab, 0x0476, 0xfcf1,
-	0xf161, 0xed2e, 0xe8a7, 0xe0cb, 0xe261, 0xe202, 0xdf1d, 0xe4dc,
-	0xe744, 0xe78e, 0xed25, 0xee56, 0xeca8, 0xf1cc, 0xf45e, 0xf363,
-	0xf71b, 0xf5bc, 0xf381, 0xf794, 0xfa08, 0xfdfc, 0x0690, 0x0ce9,
-	0x12cb, 0x1993, 0x1e58, 0x225a, 0x25d3, 0x2709, 0x2579, 0x21f3,
-	0x1ce9, 0x1561, 0x0cc5, 0x0652, 0xfdc9, 0xf614, 0xf066, 0xe91b,
-	0xe4d6, 0xe392, 0xe3d8, 0xe460, 0xe577, 0xe798, 0xe876, 0xec21,
-	0xf020, 0xf0a6, 0xf475, 0xf5ac, 0xf494, 0xf7f6, 0xf8dc, 0xfa50,
-	0xfed5, 0x00d7, 0x045f, 0x0b23, 0x0f52, 0x145b, 0x1a47, 0x1f52,
-	0x2444, 0x23e4, 0x2281, 0x21ba, 0x1d5e, 0x1976, 0x1401, 0x0b6e,
-	0x03f1, 0xfb23, 0xf2ec, 0xee94, 0xeaa6, 0xe5a2, 0xe511, 0xe58b,
-	0xe23c, 0xe521, 0xe7b1, 0xe72a, 0xebea, 0xed48, 0xec5f, 0xf0ae,
-	0xf233, 0xf2d0, 0xf817, 0xfadf, 0xfcab, 0x0120, 0x037a, 0x066a,
-	0x0dc7, 0x11d9, 0x14c2, 0x1b11, 0x2078, 0x2372, 0x2620, 0x271b,
-	0x2357, 0x1d5a, 0x15a0, 0x0d69, 0x0568, 0xfe59, 0xf76f, 0xf08d,
-	0xecc0, 0xe6ca, 0xe1ea, 0xe42e, 0xe360, 0xe5d9, 0xeec9, 0xeebb,
-	0xef09, 0xf2c7, 0xf0fa, 0xf2e5, 0xf634, 0xf30d, 0xf430, 0xf6b8,
-	0xf43d, 0xf814, 0xfbdb, 0xfdbd, 0x05b0, 0x0cbf, 0x12a1, 0x1a10,
-	0x1fb9, 0x236e, 0x24c6, 0x254d, 0x22eb, 0x1d26, 0x17cf, 0x10a5,
-	0x08f2, 0x0101, 0xf84a, 0xefe6, 0xeab9, 0xe72a, 0xe3fa, 0xe74f,
-	0xe7d1, 0xe5b3, 0xeac3, 0xebdd, 0xeced, 0xf28e, 0xf1a1, 0xf450,
-	0xf6e7, 0xf2c6, 0xf61b, 0xf879, 0xf7ca, 0xfda9, 0x0198, 0x05fe,
-	0x0d0e, 0x0fde, 0x15e8, 0x1cc7, 0x2153, 0x259c, 0x2521, 0x2342,
-	0x200e, 0x1aeb, 0x15cc, 0x0dad, 0x0544, 0xfd07, 0xf352, 0xed5c,
-	0xe89c, 0xe2eb, 0xe134, 0xe1eb, 0xe20b, 0xe511, 0xe725, 0xe7d4,
-	0xecf6, 0xef22, 0xf155, 0xf5d0, 0xf653, 0xf8e1, 0xfc38, 0xfe77,
-	0x0198, 0x033f, 0x059f, 0x089c, 0x0d73, 0x1402, 0x1848, 0x1daa,
-	0x205c, 0x1fa5, 0x2006, 0x1e66, 0x1ac3, 0x1692, 0x112f, 0x097f,
-	0x031e, 0xfc5a, 0xf42e, 0xf0a9, 0xecc5, 0xe873, 0xe951, 0xe617,
-	0xe400, 0xe78a, 0xe71a, 0xea82, 0xedaa, 0xec1a, 0xef6f, 0xf061,
-	0xf0e5, 0xf61a, 0xf6c0, 0xf8ce, 0xfc68, 0xfdeb, 0x03a6, 0x0882,
-	0x0d36, 0x1426, 0x1938, 0x1d68, 0x2008, 0x1f96, 0x1e0d, 0x1c52,
-	0x1907, 0x14f0, 0x0f22, 0x0796, 0x025f, 0xfbbb, 0xf580, 0xf289,
-	0xecba, 0xeb5a, 0xeb90, 0xea76, 0xee3c, 0xed0c, 0xec76, 0xeefa,
-	0xecce, 0xef28, 0xf11e, 0xf032, 0xf260, 0xf227, 0xf45f, 0xf7de,
-	0xf95f, 0xff4b, 0x04e8, 0x09fe, 0x106d, 0x14a7, 0x18f3, 0x1c35,
-	0x1d40, 0x1f07, 0x1d62, 0x185c, 0x1439, 0x0ec4, 0x09ac, 0x04d6,
-	0xfd04, 0xf764, 0xf30a, 0xed90, 0xed25, 0xebee, 0xeac7, 0xede8,
-	0xec58, 0xed4b, 0xf078, 0xedce, 0xf060, 0xf215, 0xf068, 0xf341,
-	0xf261, 0xf347, 0xf75d, 0xf9b2, 0xff95, 0x03eb, 0x07e6, 0x0c89,
-	0x109e, 0x17a3, 0x1a9e, 0x1c55, 0x1e1d, 0x1a21, 0x17d2, 0x149b,
-	0x0e81, 0x0ac3, 0x0559, 0xff15, 0xfa2f, 0xf570, 0xf16d, 0xef8e,
-	0xef21, 0xee2a, 0xef57, 0xf0a3, 0xef63, 0xf011, 0xf1af, 0xf214,
-	0xf2a4, 0xf2c1, 0xf22e, 0xf318, 0xf5b6, 0xf748, 0xfb1b, 0xfe8f,
-	0xfeb2, 0x0449, 0x09b4, 0x0c84, 0x1335, 0x15a1, 0x1716, 0x197d,
-	0x1678, 0x1522, 0x12b6, 0x0e36, 0x0c6d, 0x07d1, 0x0254, 0xfd0f,
-	0xf83c, 0xf597, 0xf306, 0xf378, 0xf393, 0xf11a, 0xf140, 0xf072,
-	0xeff4, 0xf0ce, 0xeeb8, 0xee0f, 0xef55, 0xef58, 0xf0c4, 0xf318,
-	0xf45c, 0xf85e, 0xfdb8, 0x00d2, 0x062f, 0x0c18, 0x0f99, 0x145d,
-	0x1745, 0x17be, 0x18e4, 0x174b, 0x157c, 0x1462, 0x10e2, 0x0c70,
-	0x0709, 0x01c4, 0xfcd3, 0xf9a5, 0xf701, 0xf22f, 0xefd8, 0xed7d,
-	0xeaf2, 0xeb1d, 0xea2b, 0xeac1, 0xed28, 0xedb4, 0xef07, 0xf17c,
-	0xf316, 0xf522, 0xf8bc, 0xfd46, 0x0076, 0x046a, 0x08c2, 0x0bf6,
-	0x1126, 0x14ad, 0x1737, 0x19c7, 0x18a7, 0x18a5, 0x18ea, 0x157f,
-	0x1150, 0x0cde, 0x0716, 0x012f, 0xfca1, 0xf76f, 0xf358, 0xf088,
-	0xec95, 0xeab6, 0xe95b, 0xe7e0, 0xe914, 0xeabb, 0xec5e, 0xef70,
-	0xf13e, 0xf1e0, 0xf4c2, 0xf941, 0xfcb4, 0x0043, 0x0369, 0x05ea,
-	0x0a56, 0x0e6a, 0x1129, 0x14b8, 0x168c, 0x164c, 0x179e, 0x16c3,
-	0x1470, 0x132f, 0x0f86, 0x0ac8, 0x0618, 0x003d, 0xf9da, 0xf5a2,
-	0xf1f3, 0xeef6, 0xed29, 0xe991, 0xe749, 0xe787, 0xe8ed, 0xebcb,
-	0xeefa, 0xf05a, 0xf25d, 0xf67d, 0xf954, 0xfcf1, 0x00cc, 0x02b5,
-	0x04ef, 0x0819, 0x0b48, 0x0e69, 0x123f, 0x14b4, 0x1727, 0x189b,
-	0x175c, 0x1752, 0x15b9, 0x12b7, 0x1000, 0x0b60, 0x0416, 0xfd5d,
-	0xf768, 0xf1ce, 0xf04a, 0xee11, 0xe9ce, 0xe749, 0xe64d, 0xe6d8,
-	0xe954, 0xebb3, 0xee8a, 0xf1e7, 0xf371, 0xf77a, 0xfbd2, 0xfea0,
-	0x0297, 0x0666, 0x0a33, 0x0dc2, 0x121e, 0x154d, 0x1777, 0x19e5,
-	0x1b56, 0x1b11, 0x1969, 0x17a2, 0x1417, 0x1085, 0x0b46, 0x0370,
-	0xfcb8, 0xf597, 0xf160, 0xee8e, 0xea47, 0xe706, 0xe420, 0xe1d2,
-	0xe1af, 0xe427, 0xe694, 0xe9ed, 0xee3f, 0xf256, 0xf673, 0xfaee,
-	0xff40, 0x0466, 0x0aa9, 0x0f6b, 0x1490, 0x17d3, 0x1a27, 0x1cd8,
-	0x1d4d, 0x1e1f, 0x1c94, 0x18a7, 0x151a, 0x105e, 0x0afb, 0x040a,
-	0xfbfb, 0xf4c9, 0xee96, 0xeafa, 0xe80a, 0xe516, 0xe333, 0xe276,
-	0xe22d, 0xe2e1, 0xe617, 0xe8af, 0xed60, 0xf2d1, 0xf6b2, 0xfc5c,
-	0x0094, 0x04f1, 0x0b63, 0x1182, 0x1744, 0x1c75, 0x1ec8, 0x1f0d,
-	0x20a3, 0x2017, 0x1dc2, 0x1af2, 0x15b4, 0x0fa8, 0x0901, 0x0146,
-	0xf8b7, 0xf241, 0xec7c, 0xe80d, 0xe51f, 0xe19d, 0xe149, 0xdfbd,
-	0xe091, 0xe424, 0xe688, 0xea10, 0xedde, 0xf276, 0xf79b, 0xfdab,
-	0x0281, 0x07c7, 0x0d07, 0x12a8, 0x18e9, 0x1d1a, 0x20cb, 0x21a0,
-	0x21fb, 0x2019, 0x1c83, 0x19fd, 0x1454, 0x0f13, 0x08fd, 0x0163,
-	0xf898, 0xefb6, 0xea40, 0xe55c, 0xe2df, 0xe12b, 0xde28, 0xdd34,
-	0xde25, 0xe13c, 0xe614, 0xeb03, 0xef6b, 0xf3c3, 0xf83d, 0xfe31,
-	0x04a2, 0x0a92, 0x0f41, 0x13ce, 0x1980, 0x1d72, 0x206a, 0x21ba,
-	0x2167, 0x1f34, 0x1c15, 0x1896, 0x12fa, 0x0dcd, 0x07e5, 0x0001,
-	0xf7d1, 0xf0e0, 0xeaab, 0xe543, 0xe26c, 0xe16a, 0xdffa, 0xdeb6,
-	0xdec2, 0xe060, 0xe53b, 0xeaf6, 0xf04e, 0xf545, 0xf9c5, 0xff36,
-	0x052a, 0x0b1f, 0x113b, 0x17a2, 0x1cd0, 0x1ed3, 0x20e7, 0x21aa,
-	0x1f87, 0x1dad, 0x1ae0, 0x16d2, 0x121d, 0x0b58, 0x0374, 0xfbde,
-	0xf4c6, 0xefdb, 0xea2b, 0xe4e5, 0xe2c1, 0xdfee, 0xde89, 0xdec3,
-	0xdf4d, 0xe20e, 0xe5f1, 0xea58, 0xef23, 0xf457, 0xfa65, 0x004b,
-	0x07ca, 0x0e7b, 0x1468, 0x1b34, 0x1e13, 0x21a0, 0x23cd, 0x220a,
-	0x1fdb, 0x1bb9, 0x179c, 0x135e, 0x0dc5, 0x06b6, 0xfdcb, 0xf536,
-	0xef2e, 0xea9b, 0xe653, 0xe330, 0xe10c, 0xdee5, 0xde03, 0xdf7e,
-	0xe1e3, 0xe5de, 0xeb65, 0xf05e, 0xf5bd, 0xfa4a, 0xff9c, 0x06a9,
-	0x0cee, 0x149c, 0x1beb, 0x1fc9, 0x209d, 0x2265, 0x22b5, 0x2020,
-	0x1df4, 0x18f4, 0x134c, 0x0d79, 0x05ca, 0xfe25, 0xf5d8, 0xef26,
-	0xeb0c, 0xe6a9, 0xe2c4, 0xe109, 0xdf64, 0xde65, 0xdfce, 0xe32f,
-	0xe764, 0xebfa, 0xf111, 0xf63f, 0xfc3e, 0x01e5, 0x0709, 0x0d95,
-	0x1462, 0x1b0e, 0x1ff7, 0x20a3, 0x2064, 0x1f8b, 0x1d9c, 0x1b8d,
-	0x1714, 0x123a, 0x0b73, 0x0335, 0xfcb3, 0xf519, 0xef60, 0xeb38,
-	0xe62e, 0xe3f2, 0xe2bb, 0xe145, 0xe061, 0xe17c, 0xe534, 0xe945,
-	0xedf5, 0xf1ee, 0xf61f, 0xfb28, 0x00df, 0x07a3, 0x0d1a, 0x11d4,
-	0x1858, 0x1c31, 0x1da9, 0x1f91, 0x1e15, 0x1b14, 0x17ce, 0x14cc,
-	0x105b, 0x091b, 0x02a6, 0xfb3c, 0xf4f2, 0xf10f, 0xed2d, 0xe9e1,
-	0xe680, 0xe4ce, 0xe3c8, 0xe327, 0xe4b4, 0xe6fe, 0xeb5c, 0xef75,
-	0xf36e, 0xf7d0, 0xfb7d, 0x00ce, 0x071b, 0x0d89, 0x1477, 0x19b0,
-	0x1bca, 0x1e49, 0x1e9c, 0x1cfe, 0x1bc6, 0x1905, 0x150d, 0x0efa,
-	0x088c, 0x0078, 0xf7b8, 0xf259, 0xee4f, 0xea41, 0xe6e9, 0xe458,
-	0xe1e4, 0xe042, 0xe1fe, 0xe5a4, 0xe9fd, 0xee01, 0xf1e6, 0xf625,
-	0xfa49, 0xffb1, 0x0676, 0x0cb2, 0x12b1, 0x192e, 0x1c47, 0x1dd5,
-	0x1e44, 0x1d99, 0x1cda, 0x19d5, 0x162e, 0x114f, 0x0a9a, 0x020d,
-	0xfadb, 0xf4e5, 0xef2a, 0xeba3, 0xe797, 0xe3e7, 0xe1f8, 0xdf91,
-	0xdf68, 0xe1c9, 0xe5ad, 0xec2e, 0xf13c, 0xf561, 0xfa75, 0xff5e,
-	0x05a1, 0x0ba7, 0x1139, 0x178b, 0x1b41, 0x1d84, 0x1e1e, 0x1e2d,
-	0x1d8b, 0x1a18, 0x1786, 0x12c9, 0x0ca7, 0x05e4, 0xfd77, 0xf6af,
-	0xf145, 0xec78, 0xe8a9, 0xe419, 0xe120, 0xe0d0, 0xe0b8, 0xe332,
-	0xe6b2, 0xeb78, 0xf01b, 0xf298, 0xf6aa, 0xfb50, 0x0027, 0x071f,
-	0x0dd4, 0x156a, 0x1b66, 0x1dff, 0x1f5c, 0x1eaa, 0x1d96, 0x1c08,
-	0x197f, 0x1489, 0x0e13, 0x071f, 0xff35, 0xf769, 0xf283, 0xeeee,
-	0xea2f, 0xe717, 0xe414, 0xe1c3, 0xe0f1, 0xe1b9, 0xe46d, 0xe898,
-	0xecc0, 0xf05f, 0xf49e, 0xf94b, 0xff7f, 0x06ea, 0x0e51, 0x150e,
-	0x1a08, 0x1ce8, 0x1de1, 0x1d61, 0x1c83, 0x1aa6, 0x18f1, 0x14f1,
-	0x0ff5, 0x0a30, 0x0116, 0xf9f0, 0xf56a, 0xf0d6, 0xec64, 0xe943,
-	0xe5bb, 0xe21f, 0xdf7d, 0xdfb7, 0xe111, 0xe4bc, 0xeba2, 0xf029,
-	0xf507, 0xfa08, 0xfe84, 0x04be, 0x0b6e, 0x139f, 0x1ad8, 0x1d5c,
-	0x1e6e, 0x1e42, 0x1c9e, 0x1aee, 0x18c5, 0x152b, 0x1052, 0x0b07,
-	0x0378, 0xfb5d, 0xf611, 0xf1f1, 0xed62, 0xeab2, 0xe687, 0xe31a,
-	0xe15e, 0xe06c, 0xe334, 0xe758, 0xec85, 0xf0eb, 0xf44c, 0xf8bd,
-	0xfdfe, 0x0418, 0x0b46, 0x1204, 0x1810, 0x1c00, 0x1c12, 0x1b5d,
-	0x1a71, 0x18dc, 0x17b5, 0x14eb, 0x1032, 0x09fb, 0x01ee, 0xfa97,
-	0xf4f8, 0xf05d, 0xec91, 0xea10, 0xe6a3, 0xe44b, 0xe4df, 0xe555,
-	0xe789, 0xebf8, 0xf05f, 0xf3c4, 0xf7c8, 0xfba1, 0xffc5, 0x04c0,
-	0x09bb, 0x0f92, 0x1382, 0x1692, 0x18ab, 0x183a, 0x1725, 0x157d,
-	0x12f5, 0x0ffb, 0x0cb5, 0x07bb, 0x0143, 0xfa17, 0xf503, 0xf211,
-	0xeeca, 0xedbe, 0xec0a, 0xe95f, 0xe8c8, 0xe89c, 0xe9ff, 0xed58,
-	0xf0fc, 0xf438, 0xf7a2, 0xfa82, 0xfded, 0x02b4, 0x077d, 0x0e2e,
-	0x1496, 0x17a0, 0x1926, 0x1962, 0x17be, 0x152a, 0x12c3, 0x0f8e,
-	0x0b09, 0x05b7, 0x001a, 0xfa71, 0xf5f0, 0xf3d7, 0xf219, 0xefe3,
-	0xee02, 0xec47, 0xeb8c, 0xebe9, 0xecdd, 0xef93, 0xf1e1, 0xf422,
-	0xf773, 0xfa37, 0xfdc3, 0x029d, 0x0780, 0x0bb1, 0x10ca, 0x14ad,
-	0x16bf, 0x16ec, 0x14ae, 0x1226, 0x0f61, 0x0d01, 0x09c2, 0x0655,
-	0x02a5, 0xfd1e, 0xf80a, 0xf404, 0xf0bc, 0xeef1, 0xed9e, 0xebc7,
-	0xea58, 0xea0e, 0xeacc, 0xecd1, 0xeff9, 0xf3da, 0xf8cf, 0xfd2e,
-	0x00d9, 0x047b, 0x0814, 0x0c65, 0x0f3e, 0x11bd, 0x13e9, 0x143c,
-	0x12e0, 0x10c5, 0x0fe9, 0x0e67, 0x0c98, 0x0a1a, 0x0623, 0x0103,
-	0xfbae, 0xf6ec, 0xf290, 0xf007, 0xeda7, 0xeb53, 0xea2d, 0xe9cc,
-	0xeab5, 0xed55, 0xeffa, 0xf2be, 0xf6d7, 0xfb93, 0x0038, 0x04d2,
-	0x0802, 0x0a2f, 0x0d0c, 0x0e94, 0x1031, 0x12d9, 0x1443, 0x142e,
-	0x133a, 0x1138, 0x0e32, 0x0b22, 0x0827, 0x04cf, 0x003f, 0xfb56,
-	0xf65c, 0xf1ab, 0xeebe, 0xed5a, 0xecfe, 0xecec, 0xed15, 0xeeb6,
-	0xf07f, 0xf211, 0xf490, 0xf718, 0xf992, 0xfd8c, 0x0101, 0x0442,
-	0x0819, 0x0b47, 0x0d92, 0x0e70, 0x1012, 0x1125, 0x10f0, 0x10aa,
-	0x0f11, 0x0c5a, 0x0901, 0x05b5, 0x022b, 0xfe4e, 0xfac1, 0xf805,
-	0xf47a, 0xf17d, 0xefef, 0xee77, 0xeeae, 0xf09e, 0xf17f, 0xf167,
-	0xf2ac, 0xf4ac, 0xf75b, 0xfbeb, 0x0094, 0x04ba, 0x0886, 0x0a98,
-	0x0bca, 0x0c82, 0x0d1c, 0x0dd7, 0x0dd4, 0x0ce1, 0x0b4d, 0x08e8,
-	0x05f9, 0x040e, 0x03a0, 0x02ca, 0x00b7, 0xfede, 0xfc57, 0xf95a,
-	0xf6eb, 0xf43a, 0xf254, 0xf27c, 0xf347, 0xf3c9, 0xf550, 0xf748,
-	0xf8ad, 0xfb55, 0xfe8e, 0x0159, 0x03ed, 0x05bd, 0x073e, 0x07f8,
-	0x08d0, 0x0963, 0x087a, 0x0751, 0x063e, 0x05f7, 0x05fd, 0x0500,
-	0x035a, 0x01a0, 0xffd9, 0xfdea, 0xfbac, 0xf94e, 0xf81b, 0xf802,
-	0xf899, 0xfab0, 0xfbde, 0xfbf8, 0xfbf2, 0xfc5c, 0xfd9c, 0xfeef,
-	0x004a, 0x00c3, 0x0155, 0x01d0, 0x01e2, 0x0271, 0x0156, 0x007e,
-	0x0153, 0x0284, 0x02a5, 0x02a9, 0x02d9, 0x0178, 0x0047, 0xfe50,
-	0xfbbc, 0xf9f3, 0xf7f5, 0xf6be, 0xf74d, 0xf847, 0xf98a, 0xfb66,
-	0xfc9e, 0xfd42, 0xfe43, 0xff78, 0x0026, 0x010b, 0x0206, 0x024e,
-	0x0212, 0x00e3, 0x0016, 0x00d9, 0x01ad, 0x0209, 0x02c0, 0x02cc,
-	0x0256, 0x02ea, 0x032a, 0x025a, 0x016f, 0xffd5, 0xfe53, 0xfdad,
-	0xfd90, 0xfe33, 0xff17, 0xffcd, 0x0045, 0x00ac, 0x00d2, 0x00e9,
-	0x011e, 0x012c, 0x018e, 0x01bc, 0x0110, 0x00d2, 0x01d3, 0x02c1,
-	0x033d, 0x0376, 0x02f0, 0x0260, 0x0255, 0x01cb, 0x00d4, 0x002e,
-	0xff56, 0xfeba, 0xff03, 0xff50, 0xff7e, 0x0025, 0x00c8, 0x00fc,
-	0x00fb, 0x00bb, 0x003b, 0x0006, 0x002b, 0x0099, 0x00e9, 0x0051,
-	0xff87, 0xffb4, 0x002d, 0x00c3, 0x01d8, 0x01ec, 0x018f, 0x01a5,
-	0x010d, 0x0020, 0xff53, 0xfe1f, 0xfd52, 0xfd1f, 0xfd68, 0xfe10,
-	0xfec7, 0xff6f, 0xff9f, 0xffc5, 0x0022, 0xffa5, 0xff23, 0xff85,
-	0xffd3, 0xfffb, 0xff7f, 0xfe8a, 0xff1e, 0x004e, 0x0143, 0x021c,
-	0x01ee, 0x019f, 0x01a6, 0x00ba, 0xff7f, 0xfe9f, 0xfdd5, 0xf9ba,
-	0xf20e, 0xf18b, 0xfcf9, 0x07b5, 0x06f4, 0xfc91, 0xf386, 0xf57f,
-	0x002c, 0x07f1, 0x04c7, 0xfa49, 0xf282, 0xf3ca, 0xfd2c, 0x0556,
-	0x0322, 0xfaa2, 0xf605, 0xf99b, 0x03b7, 0x0a5f, 0x05ec, 0xfe2d,
-	0xfb65, 0xfb9b, 0xfc9e, 0xfdd1, 0xff01, 0x0044, 0x0110, 0x012f,
-	0x0087, 0xffe0, 0xfffc, 0xffb0, 0xfedb, 0xfd46, 0xface, 0xf91f,
-	0xf919, 0xfb29, 0xfe14, 0xfe9e, 0xfdbf, 0xfd60, 0xfc94, 0xfc46,
-	0xfd76, 0xfebd, 0x00cc, 0x0339, 0x0381, 0x0284, 0x014d, 0x00f5,
-	0x0219, 0x0378, 0x041c, 0x0317, 0x0122, 0x00f9, 0x018f, 0xffe7,
-	0xfc91, 0xfb2a, 0xfd22, 0xff5a, 0x0055, 0x002a, 0xfd5e, 0xf9e1,
-	0xf921, 0xf9d0, 0xfbb2, 0xfe41, 0xfbd3, 0xf6cf, 0xf6a3, 0xfb11,
-	0x026f, 0x0821, 0x06ea, 0x021c, 0x001d, 0x04fd, 0x0b9e, 0x0b74,
-	0x05ac, 0xfd5f, 0xf815, 0xfba7, 0x0289, 0x04fc, 0xfff7, 0xf7b8,
-	0xf5e5, 0xfb16, 0x01cd, 0x04a6, 0x009f, 0xfb94, 0xfb43, 0xfe81,
-	0x01ca, 0x0150, 0xfc01, 0xf661, 0xf698, 0xfc71, 0x02e1, 0x04ae,
-	0x009d, 0xfcbc, 0xfde5, 0x03fc, 0x09dd, 0x0776, 0xff70, 0xfb65,
-	0xfe91, 0x0507, 0x0702, 0x01ca, 0xf945, 0xf574, 0xfac6, 0xffaa,
-	0xfe10, 0xfa8f, 0xf77a, 0xf7af, 0xfb53, 0xfdbe, 0xfc4b, 0xf883,
-	0xf6f4, 0xf8e1, 0xfd4e, 0x0015, 0xff4f, 0xffff, 0x01e7, 0x04c0,
-	0x074f, 0x062c, 0x04c7, 0x049b, 0x040b, 0x023f, 0xff38, 0xfd5a,
-	0xfd78, 0x0005, 0x01a6, 0xffbc, 0xfd2d, 0xfcac, 0x000b, 0x044b,
-	0x02c3, 0xfc29, 0xf80a, 0xfa37, 0xff9c, 0x02f6, 0x0319, 0x0164,
-	0xff8b, 0x0113, 0x03e2, 0x032d, 0x01ae, 0x02ee, 0x055d, 0x03de,
-	0x01af, 0x01a8, 0x0004, 0x0027, 0x0185, 0x0124, 0x0143, 0x00c2,
-	0xfed5, 0xfd47, 0xfe33, 0xfee6, 0xfd12, 0xfc47, 0xfc97, 0xfd6f,
-	0xfe32, 0xff10, 0x018b, 0x0219, 0xff91, 0x000a, 0x0424, 0x0593,
-	0x0422, 0x0230, 0x006c, 0x01ea, 0x04f0, 0x0444, 0xfff1, 0xfdaa,
-	0xfed9, 0x0055, 0x019c, 0x0078, 0xfd67, 0xfb4a, 0xfabd, 0xfc93,
-	0xfdf8, 0xfdd3, 0xfc0e, 0xf941, 0xfab7, 0xff5c, 0x0123, 0xff5e,
-	0xfe3f, 0xfdbe, 0xfe23, 0x02cc, 0x0651, 0x03bd, 0xffdf, 0xfee7,
-	0x0163, 0x0530, 0x064e, 0x02b9, 0xfeed, 0xfe68, 0x016d, 0x04af,
-	0x03bd, 0xffc3, 0xfbfa, 0xfb4d, 0xfc63, 0xfda1, 0xfd97, 0xfaef,
-	0xf9a4, 0xfacf, 0xfd15, 0xff95, 0xfef1, 0xfce5, 0xfc9a, 0xfd08,
-	0xfde6, 0xfdcd, 0xfcf1, 0xfd66, 0xff4d, 0x014d, 0x0122, 0x0155,
-	0x03a6, 0x0404, 0x02b3, 0x02a8, 0x0225, 0x0158, 0x0166, 0x0197,
-	0x013f, 0xff6f, 0xfe3b, 0xff3f, 0x008e, 0x0148, 0x0031, 0xfe37,
-	0xfc6b, 0xfb47, 0xfc70, 0xfdc6, 0xfe8f, 0xfe33, 0xfb50, 0xf9ce,
-	0xfba4, 0xfe39, 0x007a, 0x01f9, 0x00ce, 0xffcc, 0x00a3, 0x01c3,
-	0x016b, 0x007a, 0x00c2, 0x00c3, 0xff16, 0xfe0b, 0x00a5, 0x021f,
-	0x004f, 0x005a, 0x0167, 0x0097, 0xff63, 0xfe83, 0xfde0, 0xfcb4,
-	0xfb0a, 0xfc21, 0xfe2e, 0xfe28, 0xfd2b, 0xfbe9, 0xfced, 0xfeba,
-	0xfdd5, 0xfe45, 0xff35, 0xfdde, 0xfd0f, 0xfe37, 0x006b, 0x01c7,
-	0x00a7, 0x002a, 0x0131, 0x0179, 0x02db, 0x03a3, 0x02e8, 0x0292,
-	0x0229, 0x012d, 0x0062, 0x001e, 0xfedf, 0xfcf0, 0xfc21, 0xfc86,
-	0xfd09, 0xfdee, 0xfef3, 0xffbb, 0x003b, 0xfeec, 0xfd28, 0xfcd4,
-	0xfd6c, 0xfd8c, 0xfcd0, 0xfc57, 0xfcd6, 0xfdb1, 0xff39, 0x0220,
-	0x037a, 0x0133, 0xff8a, 0x006d, 0x01ce, 0x0259, 0x0196, 0xfeb5,
-	0xfbd6, 0xfafb, 0xfc27, 0xff4f, 0x01d4, 0x0114, 0xfd27, 0xfa26,
-	0xfadd, 0xfdd7, 0xffc0, 0xff18, 0xfd3b, 0xfad9, 0xfa93, 0xfd72,
-	0x00b9, 0x01bb, 0x012f, 0xffb1, 0xfe85, 0xffa0, 0x01d6, 0x02ea,
-	0x01e7, 0x0008, 0xfe86, 0xfdf4, 0xfeda, 0xffa0, 0xfea6, 0xfdbe,
-	0xfef5, 0x0189, 0x02de, 0x0131, 0xfe53, 0xfcde, 0xfcaa, 0xfd20,
-	0xfdb9, 0xfd43, 0xfca7, 0xfd0e, 0xfe43, 0x0031, 0x01cf, 0x00e7,
-	0xfedd, 0xfdee, 0xfed4, 0x0139, 0x022c, 0x0032, 0xfd6d, 0xfcf1,
-	0xfe71, 0x0130, 0x0262, 0x00a3, 0xff77, 0x0010, 0x0113, 0x022a,
-	0x021f, 0x0043, 0xff8a, 0x0027, 0x0080, 0x004a, 0xff8b, 0xff0d,
-	0xff0f, 0xfe86, 0xfee3, 0xffe4, 0xfe5c, 0xfcfe, 0xfd7e, 0xfdb8,
-	0xfdcf, 0xfd0b, 0xfc4a, 0xfc3a, 0xfcb1, 0xff9e, 0x0145, 0x00ef,
-	0x0139, 0x0142, 0x0216, 0x02eb, 0x0268, 0x014e, 0x0040, 0x005d,
-	0x0261, 0x03a3, 0x03a1, 0x0305, 0x022c, 0x0212, 0x01d9, 0x005b,
-	0xfdc4, 0xfca7, 0xfc82, 0xfc5a, 0xfb5a, 0xf90e, 0xf775, 0xf78e,
-	0xf9e8, 0xfc07, 0xfc74, 0xfce0, 0xfd35, 0xfe02, 0xffa6, 0x0144,
-	0x025f, 0x0361, 0x0464, 0x05e0, 0x077e, 0x0800, 0x0913, 0x09f5,
-	0x088b, 0x0778, 0x06de, 0x0415, 0x00a3, 0xfd87, 0xfbc3, 0xfb5a,
-	0xf83a, 0xf50c, 0xf3f5, 0xf3dc, 0xf5a0, 0xf712, 0xf6db, 0xf577,
-	0xf56c, 0xf820, 0xfb8b, 0xfdef, 0xfee3, 0xffcd, 0x0258, 0x05a7,
-	0x08cc, 0x0c40, 0x0e57, 0x0f00, 0x0e45, 0x0d02, 0x0ce8, 0x0b6a,
-	0x084e, 0x0447, 0xff47, 0xfb6b, 0xf8fc, 0xf6a7, 0xf4bc, 0xf26e,
-	0xf15c, 0xf204, 0xf1d1, 0xf1d4, 0xf180, 0xf13e, 0xf3bb, 0xf6ed,
-	0xf9c3, 0xfd22, 0x0002, 0x029c, 0x0538, 0x0960, 0x0de9, 0x10d1,
-	0x1257, 0x1333, 0x1411, 0x13de, 0x1167, 0x0d3d, 0x079e, 0x01bf,
-	0xfd9b, 0xfaaa, 0xf936, 0xf81a, 0xf5d4, 0xf2fd, 0xf024, 0xed2a,
-	0xec24, 0xedfa, 0xef94, 0xf048, 0xf1fb, 0xf686, 0xfc1d, 0x006a,
-	0x043b, 0x06e3, 0x092a, 0x0d3b, 0x1179, 0x155c, 0x17ba, 0x17b1,
-	0x15ec, 0x1196, 0x0db3, 0x09d3, 0x03c7, 0xfdb3, 0xf944, 0xf7f0,
-	0xf88e, 0xf79a, 0xf3e1, 0xed6d, 0xea54, 0xeaf4, 0xeb4c, 0xec85,
-	0xed2e, 0xefef, 0xf5d9, 0xfae3, 0xfe8c, 0xffac, 0x00cf, 0x0575,
-	0x0ad3, 0x111f, 0x1778, 0x1aae, 0x1b3c, 0x1a1a, 0x17ca, 0x14a0,
-	0x106a, 0x0aab, 0x039b, 0xfd8c, 0xf9e9, 0xf8cb, 0xf6a9, 0xf284,
-	0xee14, 0xe89a, 0xe662, 0xe6ad, 0xe80e, 0xeae3, 0xed94, 0xf12d,
-	0xf539, 0xf962, 0xfcac, 0xfea6, 0x01fd, 0x0718, 0x0cd4, 0x1219,
-	0x1573, 0x18a5, 0x1b18, 0x1b6d, 0x1a49, 0x1494, 0x0ef7, 0x0b14,
-	0x05bb, 0x0135, 0xfb28, 0xf671, 0xf3ef, 0xf1a6, 0xef5b, 0xeb61,
-	0xe943, 0xea1c, 0xecae, 0xee54, 0xef0f, 0xf01c, 0xf2f2, 0xf7a8,
-	0xfb9c, 0xfcbb, 0xfcf7, 0xffaa, 0x03a8, 0x0907, 0x0d3a, 0x100f,
-	0x12dd, 0x1524, 0x1738, 0x162b, 0x13c8, 0x10e0, 0x0dcb, 0x09df,
-	0x04f9, 0x0111, 0xfc64, 0xf97b, 0xf61b, 0xf11a, 0xecfa, 0xe948,
-	0xe70c, 0xe5a8, 0xe537, 0xe68f, 0xe8e4, 0xeb1e, 0xef22, 0xf342,
-	0xf84f, 0xff1a, 0x045a, 0x09ff, 0x0fea, 0x16e5, 0x1c96, 0x200d,
-	0x2163, 0x1fbc, 0x1da1, 0x1a9e, 0x1695, 0x1148, 0x0b37, 0x04ad,
-	0xfd9f, 0xf67f, 0xf045, 0xeb12, 0xe656, 0xe3c9, 0xe272, 0xe18a,
-	0xe1c9, 0xe2a2, 0xe523, 0xe956, 0xef50, 0xf5bd, 0xfa81, 0xffe0,
-	0x0699, 0x0cd5, 0x1311, 0x1941, 0x1d0e, 0x1fdc, 0x2080, 0x1ea6,
-	0x1c47, 0x19f7, 0x17a3, 0x132b, 0x0be7, 0x0353, 0xfb61, 0xf4b7,
-	0xef55, 0xea36, 0xe5c1, 0xe347, 0xe211, 0xe108, 0xe10f, 0xe247,
-	0xe528, 0xe9d2, 0xef43, 0xf530, 0xfa66, 0xff93, 0x041a, 0x090d,
-	0x0e71, 0x1474, 0x1aee, 0x1dfd, 0x1f1c, 0x1f16, 0x1cdc, 0x1aab,
-	0x1805, 0x1381, 0x0e5d, 0x080e, 0x009f, 0xf966, 0xf237, 0xecc1,
-	0xe78f, 0xe423, 0xe2f1, 0xe1af, 0xe179, 0xe0f3, 0xe37b, 0xe8a4,
-	0xeecc, 0xf4c7, 0xf820, 0xfbef, 0x008e, 0x0639, 0x0ca8, 0x13e0,
-	0x1a0e, 0x1e36, 0x2043, 0x1fbc, 0x1daa, 0x1a7e, 0x17d8, 0x14cf,
-	0x1082, 0x09d5, 0x0190, 0xf914, 0xf1e1, 0xece0, 0xe74e, 0xe423,
-	0xe0da, 0xded5, 0xe05c, 0xe155, 0xe3e6, 0xe813, 0xed8f, 0xf2c1,
-	0xf7e3, 0xfc7d, 0x010c, 0x086a, 0x0f78, 0x1625, 0x1c51, 0x1f66,
-	0x2114, 0x22b7, 0x2020, 0x1cd6, 0x1a83, 0x157f, 0x1011, 0x092d,
-	0x0135, 0xf8b1, 0xf139, 0xec62, 0xe7c7, 0xe4f4, 0xe375, 0xe231,
-	0xe0f2, 0xe158, 0xe38a, 0xe62e, 0xeab6, 0xf000, 0xf5f9, 0xfb81,
-	0xff9c, 0x041a, 0x0a0e, 0x1178, 0x18dd, 0x1e37, 0x20a7, 0x21cd,
-	0x2055, 0x1dea, 0x1b54, 0x1772, 0x1217, 0x0b97, 0x0504, 0xfd5d,
-	0xf580, 0xee7a, 0xe9a7, 0xe760, 0xe556, 0xe376, 0xe18d, 0xe03a,
-	0xe1d8, 0xe54f, 0xea46, 0xef82, 0xf455, 0xf8b1, 0xfc35, 0x015e,
-	0x081c, 0x0e73, 0x154e, 0x1beb, 0x1f0b, 0x2104, 0x20df, 0x1e2f,
-	0x1c35, 0x1964, 0x14f4, 0x1035, 0x0a61, 0x0253, 0xfa7f, 0xf33a,
-	0xecc3, 0xe885, 0xe56c, 0xe3a2, 0xe18c, 0xdff5, 0xe168, 0xe3d6,
-	0xe6c9, 0xeaee, 0xefd7, 0xf52f, 0xfb31, 0x0047, 0x0565, 0x0b88,
-	0x104b, 0x16f5, 0x1d16, 0x1f4e, 0x2066, 0x20ae, 0x1e32, 0x1b7a,
-	0x190c, 0x134d, 0x0d71, 0x060e, 0xfd53, 0xf54f, 0xee62, 0xe95a,
-	0xe67a, 0xe4eb, 0xe2ab, 0xe157, 0xe0c4, 0xe1df, 0xe5cd, 0xeb27,
-	0xefaa, 0xf3ff, 0xf988, 0xfdbb, 0x01cc, 0x07ef, 0x0dc1, 0x13d5,
-	0x19e8, 0x1e0d, 0x205d, 0x219e, 0x1ff3, 0x1c67, 0x1a23, 0x1655,
-	0x111a, 0x09ed, 0x021e, 0xfa76, 0xf471, 0xeee9, 0xe9bf, 0xe624,
-	0xe221, 0xdf76, 0xdfee, 0xe204, 0xe2fc, 0xe6c3, 0xec48, 0xefd4,
-	0xf446, 0xf8e2, 0xfc45, 0x01fa, 0x09b1, 0x0fbc, 0x1627, 0x1bc4,
-	0x1e33, 0x1fc2, 0x1f62, 0x1d06, 0x1b8f, 0x1852, 0x139c, 0x0eff,
-	0x0998, 0x021c, 0xfa35, 0xf308, 0xee40, 0xeaf2, 0xe764, 0xe501,
-	0xe1a0, 0xe015, 0xe130, 0xe2f9, 0xe61d, 0xeb72, 0xf05b, 0xf4eb,
-	0xfa8a, 0xff3f, 0x0522, 0x0b69, 0x104b, 0x15af, 0x1b21, 0x1d6e,
-	0x1d52, 0x1d8e, 0x1d1c, 0x1af6, 0x1792, 0x1314, 0x0dfe, 0x081b,
-	0x01dd, 0xfab4, 0xf404, 0xeeb7, 0xe96a, 0xe580, 0xe316, 0xe194,
-	0xdff1, 0xdfde, 0xe1c2, 0xe655, 0xebf6, 0xf08c, 0xf5b7, 0xfac1,
-	0xfffa, 0x04c0, 0x09d3, 0x0ebe, 0x13b6, 0x18cb, 0x1c72, 0x1d4d,
-	0x1ca1, 0x1bf9, 0x19af, 0x172b, 0x14cb, 0x10dc, 0x0c24, 0x05fc,
-	0xfe80, 0xf742, 0xf147, 0xec84, 0xe7eb, 0xe3ea, 0xe285, 0xe2e5,
-	0xe1fa, 0xe2c9, 0xe5e6, 0xe97c, 0xee8a, 0xf3dc, 0xf92b, 0xfdfc,
-	0x027f, 0x0758, 0x0d56, 0x110e, 0x13b2, 0x17ab, 0x1a03, 0x1be5,
-	0x1d53, 0x1bb0, 0x17a6, 0x148f, 0x116c, 0x0d92, 0x0835, 0x0105,
-	0xfaf9, 0xf53f, 0xeff0, 0xec29, 0xe8ad, 0xe5d2, 0xe477, 0xe380,
-	0xe34c, 0xe54e, 0xe857, 0xec68, 0xf153, 0xf64c, 0xfb21, 0xfeb3,
-	0x02a5, 0x073d, 0x0c18, 0x1040, 0x12ff, 0x157a, 0x17c6, 0x18ae,
-	0x17ea, 0x16af, 0x1475, 0x1228, 0x0f99, 0x0c71, 0x091a, 0x0430,
-	0xfe5e, 0xf8eb, 0xf496, 0xf042, 0xec34, 0xe97b, 0xe7e4, 0xe734,
-	0xe743, 0xe83e, 0xe99c, 0xec70, 0xf01d, 0xf443, 0xf91f, 0xfd67,
-	0x00a1, 0x037f, 0x06b1, 0x099d, 0x0c21, 0x0dd5, 0x0ed6, 0x104e,
-	0x119f, 0x11fb, 0x114f, 0x0fba, 0x0e77, 0x0e1b, 0x0bdd, 0x0819,
-	0x0472, 0xffe5, 0xfc1b, 0xf92b, 0xf58e, 0xf28c, 0xefe0, 0xeda7,
-	0xedba, 0xeea2, 0xef29, 0xf065, 0xf123, 0xf28d, 0xf592, 0xf84e,
-	0xfaf1, 0xfdac, 0x008e, 0x0378, 0x069c, 0x0946, 0x0aca, 0x0ad8,
-	0x0b09, 0x0ba6, 0x0bd8, 0x0bed, 0x0bb6, 0x0b56, 0x0a81, 0x097b,
-	0x07c8, 0x052a, 0x02e6, 0x0147, 0xffa4, 0xfda9, 0xfb75, 0xf969,
-	0xf7fb, 0xf60a, 0xf3f5, 0xf262, 0xf199, 0xf276, 0xf4c4, 0xf7ba,
-	0xf9a8, 0xfa5c, 0xfbc5, 0xfde3, 0xffd6, 0x012e, 0x01d6, 0x02c3,
-	0x0460, 0x05ad, 0x0685, 0x065f, 0x04f0, 0x045b, 0x04c9, 0x0588,
-	0x0588, 0x0579, 0x05d8, 0x0541, 0x0421, 0x034e, 0x0206, 0x0072,
-	0xffda, 0xff5e, 0xff1d, 0xfe39, 0xfcd2, 0xfc73, 0xfc5e, 0xfc8d,
-	0xfc3f, 0xfb9a, 0xfbce, 0xfcce, 0xfdcb, 0xfeb7, 0xff25, 0xfe40,
-	0xfd3c, 0xfcf1, 0xfe07, 0xfec6, 0xfeb1, 0xfef2, 0xfefd, 0xff0e,
-	0xff5d, 0x0020, 0x008c, 0x005a, 0x0106, 0x0242, 0x02fd, 0x0332,
-	0x038e, 0x034c, 0x0305, 0x023a, 0x0137, 0x0079, 0xffdc, 0x001d,
-	0xff91, 0xfe12, 0xfca4, 0xfc5c, 0xfd6b, 0xff78, 0x00fc, 0x014e,
-	0x0155, 0x0121, 0x00f9, 0x0026, 0xffc4, 0xff7a, 0xfe92, 0xfe45,
-	0xfe15, 0xfdbc, 0xfd16, 0xfc8d, 0xfc7f, 0xfc7e, 0xfc25, 0xfbc7,
-	0xfbc5, 0xfbfd, 0xfd4d, 0xfdfd, 0xfdb4, 0xfd45, 0xfd37, 0xfe49,
-	0xffaa, 0x00da, 0x00fb, 0x00a8, 0x00a6, 0x009d, 0x0085, 0x00bb,
-	0x00eb, 0x00d6, 0x0177, 0x0275, 0x034a, 0x0397, 0x0358, 0x0362,
-	0x0337, 0x0293, 0x012a, 0xff61, 0xfe6c, 0xfec1, 0xfef8, 0xfe95,
-	0xfdd3, 0xfd1c, 0xfd0e, 0xfd6a, 0xfe03, 0xfe3d, 0xfe77, 0xff66,
-	0x0047, 0x0086, 0x0052, 0x000e, 0x0039, 0x0172, 0x0290, 0x0361,
-	0x03bf, 0x03aa, 0x0369, 0x033e, 0x03a5, 0x02e7, 0x01ce, 0x01c3,
-	0x0234, 0x01e5, 0x00b3, 0xff6c, 0xfe42, 0xfdaf, 0xfd3e, 0xfd8f,
-	0xfd9a, 0xfd12, 0xfcdf, 0xfc6d, 0xfc80, 0xfca9, 0xfcc3, 0xfd16,
-	0xfe63, 0xfffd, 0x009d, 0x0110, 0x015e, 0x016a, 0x0154, 0x01e8,
-	0x01a1, 0x00ae, 0x0067, 0x0096, 0x0147, 0x00ce, 0xff94, 0xfedc,
-	0xfe3c, 0xfdfd, 0xfe47, 0xfe69, 0xfe1f, 0xfe66, 0xff23, 0xff76,
-	0xfdfa, 0xfbfc, 0xfb0c, 0xfacd, 0xfac8, 0xfab7, 0xfb69, 0xfcab,
-	0xfdd6, 0xff33, 0xffef, 0xff90, 0xff0b, 0xfeab, 0xfeb8, 0x007b,
-	0x0230, 0x02b3, 0x0206, 0x01bb, 0x02b0, 0x028f, 0x01b2, 0x00be,
-	0xff8f, 0xfe64, 0xfd57, 0xfb9c, 0xf9fe, 0xf950, 0xf996, 0xf9eb,
-	0xf929, 0xf922, 0xf954, 0xf8ee, 0xf9ba, 0xfbe6, 0xfdb3, 0xfd48,
-	0xfd4c, 0xfff9, 0x0244, 0x02b4, 0x02e3, 0x02d1, 0x02db, 0x033e,
-	0x0311, 0x030c, 0x0320, 0x031d, 0x02c2, 0x00ad, 0xff02, 0xfe03,
-	0xfc05, 0xfaac, 0xfb89, 0xfcde, 0xfc9f, 0xfc30, 0xfd81, 0xfeb1,
-	0xfed6, 0xfe9f, 0xfd47, 0xfc3f, 0xfc47, 0xfbe9, 0xfbd6, 0xfc42,
-	0xfc9a, 0xfd35, 0xfd83, 0xfddf, 0xfeae, 0xfea1, 0xff14, 0x001e,
-	0x0177, 0x031b, 0x0354, 0x0304, 0x02f9, 0x0360, 0x02e6, 0x017a,
-	0x00be, 0x0018, 0xfe40, 0xfcda, 0xfc47, 0xfae0, 0xfb2a, 0xfc79,
-	0xfcdb, 0xfdb9, 0xfe5e, 0xfd79, 0xfa7e, 0xfaa3, 0xfec1, 0x0139,
-	0x01e9, 0x0358, 0x04bb, 0x048b, 0x044b, 0x03e3, 0x02cf, 0x00f5,
-	0xffaf, 0xff00, 0xfd4d, 0xfd71, 0xfe28, 0xfdb3, 0xfe4d, 0xfed4,
-	0xfd5a, 0xfa47, 0xfa61, 0xfca3, 0xfd66, 0xfe40, 0xffac, 0x0025,
-	0x006f, 0x01be, 0x024d, 0x0278, 0x01f7, 0x0099, 0x005a, 0xffb9,
-	0xffc8, 0xfff0, 0xffb0, 0x00a1, 0x0179, 0x0107, 0xff55, 0xff52,
-	0x0089, 0x0159, 0x01c1, 0x00ad, 0xfefc, 0xfe42, 0xfe72, 0xfe31,
-	0xfe8d, 0xfdb8, 0xfb37, 0xfa29, 0xf8e5, 0xf8ae, 0xf9c6, 0xfb0c,
-	0xfd75, 0x0018, 0x00ec, 0xff43, 0xff0a, 0x00b2, 0x027d, 0x03f7,
-	0x0479, 0x0530, 0x05e4, 0x0671, 0x065a, 0x064b, 0x0535, 0x0223,
-	0xffd1, 0xfdda, 0xfdad, 0xfddb, 0xfc64, 0xfb03, 0xfb30, 0xfc56,
-	0xfbd6, 0xfb58, 0xfbd6, 0xfc5a, 0xfd55, 0xfe4c, 0xfed5, 0xff22,
-	0x004c, 0x013a, 0x023c, 0x02a6, 0x0206, 0x016c, 0xffad, 0xffe0,
-	0x019d, 0x0195, 0x00a1, 0x0080, 0x01f9, 0x0269, 0x0176, 0x00d3,
-	0x00a6, 0x00af, 0x00dc, 0x00ab, 0x0162, 0x02b8, 0x00fb, 0x005b,
-	0x015a, 0x0005, 0xfe72, 0xfcd4, 0xfba1, 0xfb0e, 0xfb18, 0xfaf0,
-	0xfb44, 0xfe34, 0x0002, 0x0098, 0x009e, 0xff7f, 0xff45, 0x0046,
-	0x011f, 0x021c, 0x0363, 0x027f, 0x021c, 0x0291, 0x0174, 0x016a,
-	0x016a, 0x0040, 0xff04, 0xfe3b, 0xfda4, 0xfc89, 0xfc88, 0xfe5f,
-	0xff49, 0xfdf9, 0xfc7a, 0xfcbf, 0xfe2d, 0xfe41, 0x0009, 0x0191,
-	0xff84, 0x00b8, 0x0186, 0x0114, 0x02d8, 0x02bb, 0x019f, 0xff6c,
-	0xff07, 0x003b, 0xff44, 0xffc1, 0x017e, 0x0184, 0x0010, 0xff88,
-	0xff4c, 0xff22, 0xff91, 0x0077, 0x010f, 0xfed4, 0xfe22, 0xff53,
-	0xff08, 0x0085, 0x0112, 0xfe90, 0xfd0c, 0xfc77, 0xfb97, 0xfc6b,
-	0xfd52, 0xfdf7, 0xff5c, 0xfee5, 0xfe63, 0xff55, 0x00c7, 0x0167,
-	0x0217, 0x02a4, 0x0240, 0x03bc, 0x0242, 0x0028, 0x0246, 0x0282,
-	0x00b6, 0xff39, 0xfe01, 0xfd6d, 0xfe36, 0xfda7, 0xfc96, 0xfd6b,
-	0xfcb0, 0xfb7b, 0xfbd5, 0xfdc8, 0xfe3c, 0xfd33, 0xfe2e, 0xff64,
-	0x0162, 0x011c, 0x00dd, 0x03a3, 0x04b7, 0x0521, 0x03cc, 0x01bd,
-	0x001d, 0xfeb2, 0xfe22, 0xfe2a, 0xfee1, 0xfd6c, 0xfd38, 0xfe9f,
-	0xfe90, 0xffa8, 0x0020, 0xff88, 0x000b, 0x00fa, 0x00f5, 0x02b8,
-	0x03c4, 0x01bf, 0x0294, 0x0269, 0xff32, 0xff52, 0xfe93, 0xfbd2,
-	0xfd00, 0xfcb0, 0xfca9, 0xffc5, 0xfe47, 0xff06, 0x0040, 0xfefe,
-	0x012c, 0x0103, 0x01f8, 0x0327, 0x020c, 0x0117, 0x00d3, 0x03b3,
-	0x020f, 0xffb7, 0x00d4, 0xff4f, 0xfd1a, 0xfbfb, 0xfd09, 0xfdbc,
-	0xfd41, 0xfc15, 0xfc3b, 0xfe52, 0xfdd1, 0xfdf8, 0xfe1e, 0xfe75,
-	0x0079, 0x0044, 0x0049, 0x01c0, 0x0269, 0x0215, 0x01ae, 0x0157,
-	0xfec0, 0xfaea, 0xfbf2, 0xfdff, 0xf8e0, 0xf39a, 0xf4dd, 0xf82e,
-	0xfa0b, 0xff47, 0x0526, 0x0460, 0x04c5, 0x0622, 0x0657, 0x0757,
-	0x054c, 0x02cc, 0x00b9, 0x0090, 0xffa5, 0xfb8c, 0xfa8a, 0xfa9a,
-	0xfa96, 0xfcce, 0xffa9, 0xffa8, 0xff34, 0x0037, 0xff81, 0xfffb,
-	0x011b, 0x01b2, 0x008a, 0xfed1, 0x00eb, 0x017b, 0x012f, 0x04b4,
-	0x0782, 0x05c0, 0x02ca, 0x008b, 0xff5c, 0x0155, 0xffe9, 0xfdf4,
-	0xfe2d, 0xfc29, 0xfd45, 0xfd4a, 0xfd92, 0x0109, 0xff61, 0xfe6c,
-	0xff4d, 0x0086, 0x05e9, 0x05f2, 0x00eb, 0x02a3, 0x0645, 0x04d2,
-	0x00b0, 0xfe4f, 0xfff0, 0xffa5, 0xfc81, 0xfc19, 0xfde3, 0xfe7c,
-	0xfcca, 0xfd38, 0x00b3, 0x0116, 0xfcbb, 0xfc2e, 0x008a, 0x0238,
-	0x0292, 0x0149, 0x0055, 0x008f, 0x0062, 0x0147, 0xff14, 0xfe0c,
-	0xfdb3, 0xfc0d, 0xfc99, 0xfbdc, 0xfe22, 0xff70, 0xfdf5, 0xff4d,
-	0xfe20, 0xfd6f, 0xfd3c, 0xfc8a, 0xfe49, 0x0181, 0x0369, 0xffe2,
-	0xfe3f, 0x0222, 0x028d, 0xff01, 0xfd87, 0xfef0, 0xfd2c, 0xf9c2,
-	0xfad9, 0xfc79, 0xfc54, 0xfcf2, 0xfbc6, 0xfc7a, 0xff78, 0xfeb1,
-	0xfe8d, 0x00db, 0x0368, 0x04f7, 0x03a2, 0x0299, 0x02d3, 0x02ba,
-	0x0107, 0xff87, 0xfdc6, 0xfbc1, 0xfb4a, 0xfa74, 0xfb4c, 0xfcc6,
-	0xfcc8, 0xfb1e, 0xfae8, 0xffb3, 0x0049, 0xff73, 0x0286, 0x03ea,
-	0x051e, 0x0398, 0x0219, 0x04be, 0x0674, 0x068c, 0x04a7, 0x00ea,
-	0x0061, 0x00e2, 0xfdb0, 0xfbcf, 0xffbe, 0x02e8, 0xfd28, 0xf8ec,
-	0xff72, 0x026c, 0xff46, 0xfbee, 0xfcc4, 0x0367, 0x02ed, 0xfe4f,
-	0xfdb6, 0x0147, 0x051a, 0xfec8, 0xfa23, 0xfda9, 0xfeda, 0xfcc6,
-	0xf930, 0xfc7c, 0x01a6, 0xfeb8, 0xfdac, 0xfd96, 0xfe74, 0x0373,
-	0x0228, 0xff95, 0x013d, 0x03d2, 0x04f5, 0x002a, 0xffe2, 0x0442,
-	0x03b3, 0xff1e, 0xf957, 0xfad6, 0xfd74, 0xfb7c, 0xfa19, 0xfb32,
-	0x00e1, 0x009e, 0xfcbd, 0xfd2e, 0xfe0c, 0x01b2, 0xffb0, 0xfb4c,
-	0xff24, 0x0100, 0x01dd, 0x011b, 0xfc83, 0x0074, 0x02ab, 0xfc82,
-	0xfe1d, 0x01cb, 0x0010, 0xfd75, 0xfca0, 0xffcd, 0xfe95, 0xfb82,
-	0xfcdb, 0xfd26, 0xff09, 0x00a7, 0x0070, 0xff10, 0xfe14, 0x046e,
-	0x0472, 0xfc24, 0x0030, 0x054f, 0xfefe, 0xfc89, 0xfeea, 0xfdf1,
-	0xfca1, 0xfced, 0xfcc4, 0xfc83, 0xfe1c, 0xfe39, 0xfc03, 0xfc12,
-	0xfdc3, 0xfecd, 0xfeb8, 0xff94, 0x02ce, 0x0498, 0x008b, 0xfd2d,
-	0xffdc, 0x00d4, 0x012b, 0x0018, 0xfc31, 0xfd2f, 0xfb7c, 0xf954,
-	0xfc45, 0xfd85, 0xff9c, 0xfeb8, 0xfccf, 0x010d, 0x029e, 0x01b5,
-	0x008e, 0x0064, 0x04b0, 0x0502, 0x02ec, 0x03c8, 0x030a, 0x0361,
-	0x0232, 0xfe16, 0xfbd6, 0xfa69, 0xfd18, 0xffa7, 0xfef7, 0x00cb,
-	0x0012, 0xfe17, 0xfe63, 0x007f, 0x03cf, 0x00b6, 0xfe25, 0x0166,
-	0x01cf, 0x01e7, 0x015f, 0xffc6, 0x0339, 0x0465, 0x0091, 0xff90,
-	0x0038, 0xffc5, 0xffba, 0x0166, 0x012a, 0x0075, 0x01f6, 0xff47,
-	0xfd31, 0x0017, 0x012b, 0x00d1, 0xfe3f, 0xfd8f, 0x01f0, 0x019e,
-	0x0008, 0x00c6, 0xff30, 0xffec, 0x00e8, 0x0029, 0x0076, 0xfd8e,
-	0xfd20, 0x0144, 0x016d, 0x00be, 0x010b, 0x028d, 0x059f, 0x0404,
-	0x018d, 0x0139, 0x0158, 0x02a9, 0x01e3, 0x0271, 0x05ea, 0x0528,
-	0x011d, 0xfd8f, 0xfd45, 0xfe79, 0xfbe7, 0xf907, 0xf90c, 0xfb67,
-	0xfdeb, 0xfc15, 0xf9db, 0xfb62, 0xfe0b, 0xff7c, 0xffa2, 0x0221,
-	0x0580, 0x0569, 0x05b6, 0x0997, 0x0b93, 0x0918, 0x0773, 0x0729,
-	0x07a0, 0x0869, 0x0629, 0x0435, 0x043d, 0x051d, 0x0508, 0xff0f,
-	0xfd1b, 0x0001, 0xfba6, 0xf944, 0xfb54, 0xfb0a, 0xf854, 0xf497,
-	0xf857, 0xfca1, 0xf89e, 0xf53a, 0xf174, 0xf036, 0xf25f, 0xf081,
-	0xf13f, 0xf357, 0xf3ab, 0xf5d4, 0xf755, 0xfb83, 0x021d, 0x0756,
-	0x089f, 0x068f, 0x0bf2, 0x1235, 0x1017, 0x0deb, 0x0fb8, 0x16a6,
-	0x1a3c, 0x14f2, 0x106d, 0x0b12, 0x0751, 0x0522, 0xfaa0, 0xf50f,
-	0xfb7b, 0xfca7, 0xf629, 0xf52a, 0xfb05, 0xfbf4, 0xf6c4, 0xf1ed,
-	0xf06e, 0xf217, 0xefa4, 0xe83b, 0xe4e8, 0xeb5b, 0xf470, 0xf333,
-	0xefe9, 0xf321, 0xf66e, 0xf9d1, 0xfaca, 0xfc26, 0x0298, 0x0686,
-	0x0965, 0x0c36, 0x1094, 0x19d0, 0x1b70, 0x19a5, 0x1d55, 0x1d76,
-	0x19f9, 0x1365, 0x0b37, 0x0734, 0x04a2, 0x0099, 0xfb39, 0xfbdc,
-	0x0239, 0x01cc, 0xfd23, 0xf86f, 0xf4fd, 0xf349, 0xebe5, 0xe7d1,
-	0xea94, 0xeaa8, 0xec2c, 0xec6b, 0xec74, 0xf18c, 0xf19c, 0xefca,
-	0xf265, 0xf41c, 0xf6ec, 0xf91f, 0xf97f, 0xfca1, 0x0178, 0x0620,
-	0x0983, 0x0d87, 0x14d0, 0x19c0, 0x1874, 0x17e3, 0x1ca4, 0x1cd3,
-	0x1310, 0x0992, 0x0556, 0x0523, 0x09c2, 0x0bbc, 0x05b6, 0x0125,
-	0x0190, 0xfeb4, 0xf8d3, 0xf3f9, 0xf0ad, 0xef5f, 0xebad, 0xe8f6,
-	0xebbb, 0xea54, 0xe7a3, 0xead2, 0xeb81, 0xe9e1, 0xebaa, 0xef59,
-	0xf099, 0xf0ab, 0xf5db, 0xfab8, 0xfc1d, 0xfd2d, 0xfa84, 0xff18,
-	0x0cd8, 0x1387, 0x167e, 0x1973, 0x1980, 0x1866, 0x1744, 0x1b37,
-	0x19b5, 0x0d3e, 0x078a, 0x05a1, 0x0509, 0x0c10, 0x0a2d, 0x02ab,
-	0x060a, 0x0650, 0xfd86, 0xf6a6, 0xf14d, 0xed39, 0xeddb, 0xee76,
-	0xee12, 0xee05, 0xec2e, 0xea87, 0xe98c, 0xeb40, 0xef12, 0xec89,
-	0xec0b, 0xf388, 0xf49a, 0xf2bc, 0xf810, 0xfe98, 0x026d, 0x03e9,
-	0x0410, 0x0857, 0x1366, 0x1bbd, 0x1c0a, 0x1c36, 0x16f4, 0x0e30,
-	0x14af, 0x1c85, 0x11de, 0x021c, 0xfcec, 0x053e, 0x0d32, 0x09d4,
-	0x068e, 0x078d, 0x062e, 0x01cc, 0xf9e5, 0xf324, 0xf208, 0xf1d1,
-	0xefe2, 0xef88, 0xf0d3, 0xefb0, 0xec39, 0xe9d6, 0xea13, 0xecd4,
-	0xef25, 0xedaf, 0xedbc, 0xf2db, 0xf57e, 0xf649, 0xfbe8, 0x0202,
-	0x05ce, 0x08f6, 0x09db, 0x0d7f, 0x171d, 0x20d9, 0x218e, 0x188f,
-	0x13e7, 0x17e0, 0x18b3, 0x0f65, 0x001f, 0xfc3b, 0x076b, 0x0eb8,
-	0x0d44, 0x072c, 0x01f2, 0x0639, 0x056a, 0xf8bd, 0xf34f, 0xf4e4,
-	0xf525, 0xf3e4, 0xeec5, 0xee15, 0xf189, 0xefb4, 0xee14, 0xec13,
-	0xe9d5, 0xf00c, 0xf1d0, 0xe9b1, 0xec0f, 0xf81c, 0xfd81, 0xfc32,
-	0xfb10, 0xfef2, 0x081a, 0x0d00, 0x09cd, 0x0c31, 0x1910, 0x224a,
-	0x2040, 0x14bd, 0x0a6e, 0x105a, 0x1630, 0x095b, 0xff81, 0x025c,
-	0x061f, 0x0bc9, 0x0b77, 0x02b9, 0x01aa, 0x02bb, 0xfd0c, 0xf983,
-	0xf721, 0xf409, 0xf4b6, 0xf488, 0xf26d, 0xf1b4, 0xef23, 0xedb2,
-	0xefe8, 0xefd9, 0xee0e, 0xedc7, 0xeb65, 0xe851, 0xeca0, 0xf55f,
-	0xfa4e, 0xfd20, 0x002e, 0xffd4, 0xff47, 0x040c, 0x0b4f, 0x1559,
-	0x216b, 0x2835, 0x2560, 0x17f2, 0x0cc4, 0x13c8, 0x185a, 0x0ac5,
-	0x02fa, 0x0455, 0x0697, 0x0e67, 0x0b49, 0xfda1, 0xfe76, 0x031e,
-	0xfd1d, 0xf750, 0xf30a, 0xf2e2, 0xf6ce, 0xf2d0, 0xec29, 0xec7b,
-	0xef70, 0xf114, 0xf1f9, 0xf03b, 0xeb30, 0xeb25, 0xeef2, 0xec12,
-	0xed02, 0xf80b, 0xfbc1, 0xfb55, 0x017e, 0x03d7, 0x0562, 0x0a06,
-	0x0a64, 0x1396, 0x24a7, 0x28ed, 0x2323, 0x18a9, 0x0bf5, 0x0c7a,
-	0x120a, 0x08ac, 0x032b, 0x0811, 0x081a, 0x09f3, 0x0940, 0xff5d,
-	0xfb6c, 0xfc0b, 0xf834, 0xf688, 0xf443, 0xf08f, 0xf11c, 0xee53,
-	0xef3e, 0xf672, 0xf502, 0xef27, 0xecf7, 0xeb52, 0xeb5a, 0xee00,
-	0xecfe, 0xe85e, 0xec37, 0xfa57, 0x019a, 0xfe6c, 0xfc07, 0xfca6,
-	0x0430, 0x0fe1, 0x14bb, 0x18a3, 0x223a, 0x28e5, 0x2400, 0x15fa,
-	0x0e6e, 0x0f26, 0x0b36, 0x0718, 0x06a7, 0x06a0, 0x08f1, 0x0891,
-	0x0360, 0xff96, 0xfbff, 0xf844, 0xf6a2, 0xf3da, 0xf015, 0xee96,
-	0xef27, 0xeed9, 0xef2a, 0xf2f6, 0xf3ae, 0xf0cc, 0xee37, 0xe884,
-	0xe93a, 0xf1a1, 0xeea0, 0xec61, 0xf518, 0xf68e, 0xf7be, 0xff1b,
-	0x00d1, 0x0331, 0x0af1, 0x0fb1, 0x188a, 0x2497, 0x2751, 0x215d,
-	0x1665, 0x136d, 0x151a, 0x0bdc, 0x0529, 0x096f, 0x0b38, 0x0ad3,
-	0x0b1c, 0x022f, 0xf9e9, 0xfa66, 0xf826, 0xf3e1, 0xf134, 0xefdb,
-	0xed1f, 0xe99e, 0xeb67, 0xef4f, 0xf006, 0xf0f3, 0xf24a, 0xefad,
-	0xecbd, 0xeb78, 0xe8c7, 0xe8fb, 0xef27, 0xf797, 0xfd25, 0xfe95,
-	0x0177, 0x0408, 0x04c7, 0x09b0, 0x129f, 0x1c96, 0x2762, 0x2c0e,
-	0x2098, 0x13f0, 0x13ac, 0x126b, 0x0a76, 0x0722, 0x0a62, 0x091e,
-	0x05b0, 0x05f1, 0x0120, 0xf95a, 0xfa7b, 0xf9c1, 0xf006, 0xeef6,
-	0xef85, 0xe8ca, 0xe9de, 0xecd0, 0xecec, 0xf462, 0xf665, 0xee6d,
-	0xee30, 0xf07f, 0xeefb, 0xef8e, 0xf0fa, 0xf2f9, 0xf861, 0xfd8a,
-	0xfc93, 0xfca9, 0x0267, 0x0804, 0x0dce, 0x1730, 0x1f34, 0x224e,
-	0x204d, 0x1a2d, 0x16c8, 0x0df2, 0x030c, 0x07a0, 0x0d24, 0x0bde,
-	0x0e8e, 0x0d2b, 0x05cb, 0x027f, 0xff90, 0xf9d3, 0xf550, 0xf14d,
-	0xee81, 0xec4a, 0xe85c, 0xe74e, 0xec04, 0xf063, 0xee9d, 0xed44,
-	0xeea3, 0xec75, 0xebb0, 0xe97c, 0xe948, 0xf377, 0xf8ec, 0xfa60,
-	0xff9f, 0x00e8, 0x024b, 0x07a7, 0x0afe, 0x149e, 0x2252, 0x21dc,
-	0x1a79, 0x15c1, 0x1655, 0x139c, 0x0777, 0x0615, 0x0bec, 0x0b41,
-	0x0dbd, 0x106a, 0x0be3, 0x0b1d, 0x093a, 0xfc90, 0xf402, 0xf3e9,
-	0xf173, 0xea2a, 0xe71f, 0xeb0d, 0xecad, 0xeb86, 0xe975, 0xe75d,
-	0xea54, 0xec42, 0xea70, 0xed5a, 0xf097, 0xf0a6, 0xf52d, 0xfaf3,
-	0xfdda, 0x02a3, 0x076f, 0x0a3c, 0x10e9, 0x181d, 0x1b23, 0x1b19,
-	0x17a7, 0x1619, 0x17ba, 0x103d, 0x03f2, 0x0409, 0x0862, 0x0a5e,
-	0x0d3a, 0x0a3a, 0x089e, 0x0c19, 0x0636, 0xfe4b, 0xfd6c, 0xf8de,
-	0xf37a, 0xeecc, 0xe8ca, 0xeb61, 0xefb2, 0xea00, 0xe6d7, 0xeb51,
-	0xea18, 0xe698, 0xe6f7, 0xe92d, 0xee39, 0xf4c8, 0xf736, 0xf69a,
-	0xfb2d, 0x0150, 0x0800, 0x103f, 0x159f, 0x1b54, 0x1ef1, 0x1c61,
-	0x1aad, 0x1aa2, 0x12eb, 0x09d7, 0x0852, 0x06e7, 0x0510, 0x04e0,
-	0x0635, 0x0a98, 0x0d04, 0x0a1c, 0x04cf, 0x0055, 0xfd7b, 0xfa24,
-	0xf46b, 0xefeb, 0xf00d, 0xefee, 0xeca3, 0xec00, 0xed99, 0xec8d,
-	0xe8fa, 0xe86c, 0xeabc, 0xebcb, 0xee17, 0xf021, 0xf2c3, 0xf78e,
-	0xfc46, 0x00fb, 0x06ed, 0x0dcb, 0x16b5, 0x1dd1, 0x1ca7, 0x1a9f,
-	0x1c76, 0x1989, 0x11ac, 0x0c35, 0x0954, 0x07f4, 0x063a, 0x03ae,
-	0x0308, 0x0554, 0x071b, 0x03eb, 0x01ab, 0x0236, 0x0115, 0xfcb6,
-	0xf4c0, 0xf1fb, 0xf45f, 0xf321, 0xefe8, 0xefb4, 0xed55, 0xeb83,
-	0xeedb, 0xec7b, 0xeaa0, 0xeeab, 0xf071, 0xf26b, 0xf5c7, 0xf761,
-	0xfa9f, 0x01b9, 0x0753, 0x0b5b, 0x1199, 0x143b, 0x15b2, 0x1b1c,
-	0x1c17, 0x15b3, 0x10d8, 0x0f91, 0x0c58, 0x0a5d, 0x0830, 0x0614,
-	0x070f, 0x057c, 0x0313, 0x0281, 0x00f7, 0xfe80, 0xfb83, 0xf928,
-	0xf862, 0xf881, 0xf621, 0xf2c9, 0xf2b0, 0xf250, 0xf1ca, 0xf16d,
-	0xf06a, 0xeff3, 0xf38b, 0xf5ba, 0xf427, 0xf64b, 0xf76f, 0xf75d,
-	0xf937, 0xfb0b, 0xfc94, 0xff56, 0x0386, 0x06eb, 0x09b3, 0x0bd1,
-	0x0d4a, 0x0dfc, 0x0ee2, 0x1035, 0x1047, 0x1024, 0x0d57, 0x0b1f,
-	0x0abe, 0x0784, 0x048d, 0x02f4, 0x01db, 0xffed, 0xfd4a, 0xfad0,
-	0xf8ad, 0xf7d8, 0xf815, 0xf7b8, 0xf749, 0xf769, 0xf55e, 0xf455,
-	0xf72a, 0xf75c, 0xf638, 0xf577, 0xf356, 0xf3b1, 0xf48b, 0xf522,
-	0xf69e, 0xf719, 0xf7d8, 0xf974, 0xfbaf, 0xfdb5, 0xffce, 0x023d,
-	0x052c, 0x07ef, 0x09aa, 0x0b60, 0x0b5c, 0x0c61, 0x0ece, 0x0f12,
-	0x0cfd, 0x0a40, 0x0a23, 0x0a1d, 0x084b, 0x05df, 0x03bc, 0x0284,
-	0x0065, 0xfe1b, 0xfd26, 0xfbbf, 0xfa87, 0xfa48, 0xf995, 0xf961,
-	0xf99f, 0xf914, 0xf9a6, 0xfb4f, 0xfae6, 0xfa6a, 0xf9ee, 0xf846,
-	0xf75b, 0xf7e7, 0xf849, 0xf878, 0xf9fa, 0xfb8e, 0xfc57, 0xfdb1,
-	0xff68, 0x0031, 0x0198, 0x02ac, 0x04d7, 0x0830, 0x08f4, 0x0941,
-	0x0a79, 0x0bec, 0x0bff, 0x0aed, 0x08b1, 0x073d, 0x074e, 0x05f0,
-	0x03f5, 0x018e, 0x0055, 0xff5c, 0xfd1d, 0xfad6, 0xf934, 0xf8d6,
-	0xf927, 0xf9bf, 0xf9e6, 0xf93d, 0xf8fa, 0xf8bc, 0xf95a, 0xfafe,
-	0xfa8a, 0xf97c, 0xf9ae, 0xfa48, 0xfa67, 0xfacf, 0xfb43, 0xfc0d,
-	0xfd60, 0xfd77, 0xfd7c, 0xfe2b, 0xff77, 0x011b, 0x026e, 0x0519,
-	0x074c, 0x078e, 0x0808, 0x08f8, 0x0a70, 0x0c39, 0x0c40, 0x0986,
-	0x06d9, 0x054e, 0x03ba, 0x01e9, 0xffaf, 0xfdb5, 0xfc04, 0xfa31,
-	0xf7f9, 0xf6cc, 0xf6f8, 0xf6dc, 0xf742, 0xf86e, 0xf874, 0xf7f2,
-	0xf885, 0xfa33, 0xfbd1, 0xfc49, 0xfb89, 0xfaba, 0xfa41, 0xfafa,
-	0xfc22, 0xfc30, 0xfcd2, 0xfe5d, 0xff19, 0xfee4, 0xffec, 0x024d,
-	0x048b, 0x061d, 0x0709, 0x07cf, 0x0803, 0x07d4, 0x07a3, 0x0891,
-	0x0943, 0x07ce, 0x05fe, 0x03dd, 0x0176, 0x0013, 0xff75, 0xfd52,
-	0xfb27, 0xfa02, 0xf85a, 0xf6c5, 0xf5c1, 0xf55d, 0xf4fd, 0xf5ac,
-	0xf745, 0xf8a6, 0xf9c5, 0xfbf7, 0xfe1b, 0xff45, 0x011d, 0x01ae,
-	0x0049, 0xff84, 0xfff7, 0x0072, 0x0106, 0x01a8, 0x01d7, 0x0267,
-	0x031c, 0x0326, 0x036b, 0x0421, 0x0473, 0x04aa, 0x0537, 0x0588,
-	0x0596, 0x05f4, 0x05c5, 0x051f, 0x0492, 0x037f, 0x0196, 0xff59,
-	0xfe1a, 0xfd58, 0xfbd8, 0xf9ba, 0xf841, 0xf7c9, 0xf747, 0xf677,
-	0xf6a3, 0xf817, 0xf99a, 0xfadc, 0xfbc6, 0xfce5, 0xfe95, 0xff93,
-	0xffd1, 0x0127, 0x02ba, 0x0277, 0x0086, 0xff18, 0xffee, 0x00cb,
-	0x0105, 0x01a0, 0x0247, 0x01db, 0x01ae, 0x0191, 0x0194, 0x02bd,
-	0x03e1, 0x03b8, 0x035b, 0x0410, 0x0477, 0x043e, 0x040b, 0x038f,
-	0x0210, 0xff2f, 0xfc80, 0xfa58, 0xf91d, 0xf892, 0xf776, 0xf5ad,
-	0xf512, 0xf500, 0xf409, 0xf521, 0xf80c, 0xfa27, 0xfc66, 0xfe38,
-	0xff04, 0x0087, 0x0334, 0x040a, 0x041b, 0x056f, 0x05a0, 0x03ed,
-	0x0350, 0x03e7, 0x033a, 0x0358, 0x0432, 0x029d, 0x00c0, 0x0121,
-	0x01a3, 0x0151, 0x0265, 0x0367, 0x0230, 0x00f0, 0x0188, 0x0215,
-	0x014e, 0x018a, 0x0215, 0x0040, 0xfe31, 0xfd41, 0xfb82, 0xfa5e,
-	0xfb65, 0xfb25, 0xf9b9, 0xf98b, 0xf961, 0xf926, 0xf9fa, 0xfb9d,
-	0xfcfc, 0xfe29, 0xff3d, 0x001c, 0x01be, 0x03e4, 0x0545, 0x0612,
-	0x06a4, 0x0629, 0x04f5, 0x0457, 0x03b4, 0x0301, 0x0287, 0x019a,
-	0x0090, 0xffcf, 0xfef5, 0xfe63, 0xfec6, 0xffc1, 0x002d, 0x0032,
-	0x001c, 0x0092, 0x0122, 0x00c7, 0x0084, 0x007e, 0xffe8, 0xfece,
-	0xfdcf, 0xfcd3, 0xfc99, 0xfc98, 0xfc17, 0xfc0b, 0xfba5, 0xfadd,
-	0xfad0, 0xfb72, 0xfc49, 0xfda3, 0xfee1, 0xff32, 0x0003, 0x01b2,
-	0x027a, 0x031d, 0x04a5, 0x0568, 0x0506, 0x0472, 0x031f, 0x0217,
-	0x01e8, 0x01b1, 0x0192, 0x00c5, 0xff54, 0xfe28, 0xfd1a, 0xfca4,
-	0xfd60, 0xfe62, 0xfe84, 0xfe78, 0xff44, 0x001f, 0x0043, 0x00ec,
-	0x0165, 0x00a5, 0xfff9, 0xfebf, 0xfcf5, 0xfc45, 0xfc3d, 0xfc0e,
-	0xfb9a, 0xfae1, 0xfa3e, 0xf9bc, 0xf9f1, 0xfbb0, 0xfe14, 0xff01,
-	0xff3b, 0x0014, 0x014a, 0x028c, 0x03ce, 0x04cf, 0x04d4, 0x04ba,
-	0x03c8, 0x0203, 0x0109, 0x007c, 0x000f, 0xffa2, 0xff15, 0xfde0,
-	0xfc8c, 0xfc09, 0xfc16, 0xfd2c, 0xfdb6, 0xfca1, 0xfbf2, 0xfc62,
-	0xfcf2, 0xfe38, 0xffae, 0xffdf, 0xfff4, 0xfff2, 0xff34, 0xfe61,
-	0xfdee, 0xfe46, 0xfec5, 0xfec0, 0xfe2d, 0xfd2d, 0xfc3e, 0xfbd9,
-	0xfcb4, 0xfe1e, 0xfe63, 0xfe09, 0xfeb7, 0xffe5, 0x013b, 0x02e0,
-	0x0378, 0x03be, 0x038e, 0x02d4, 0x0205, 0x013f, 0x008f, 0xfff7,
-	0xff79, 0xff41, 0xfeb4, 0xfd08, 0xfba2, 0xfbf2, 0xfcbb, 0xfcce,
-	0xfd00, 0xfd92, 0xfde3, 0xfede, 0x0075, 0x00b1, 0x011f, 0x017d,
-	0x00a0, 0xff47, 0xfe65, 0xfdb0, 0xfc84, 0xfc77, 0xfd1b, 0xfcfd,
-	0xfc94, 0xfb92, 0xfad6, 0xfb88, 0xfcae, 0xfd45, 0xfe66, 0xff31,
-	0x000e, 0x0204, 0x0349, 0x0497, 0x05c6, 0x0536, 0x043c, 0x0351,
-	0x01e6, 0x007c, 0xfff9, 0xffe8, 0xff33, 0xfdef, 0xfc87, 0xfae2,
-	0xfaa3, 0xfbd6, 0xfca7, 0xfd14, 0xfd78, 0xfde1, 0xfeb5, 0xfff8,
-	0x01c2, 0x02e3, 0x030e, 0x02c8, 0x0249, 0x0119, 0x0060, 0x003e,
-	0xffa6, 0xff0a, 0xfee3, 0xfe54, 0xfcec, 0xfd06, 0xfea5, 0xff9f,
-	0x00c1, 0x0127, 0x00a3, 0x011e, 0x01f7, 0x02f8, 0x03b7, 0x03c1,
-	0x02e6, 0x0185, 0x0083, 0xff9c, 0xff25, 0xfed3, 0xfe74, 0xfe43,
-	0xfe08, 0xfceb, 0xfc43, 0xfd84, 0xfea8, 0xffb1, 0xffe4, 0xfe7a,
-	0xfe08, 0xff1b, 0xffa4, 0x002e, 0x01b5, 0x0260, 0x01c5, 0x0128,
-	0x0056, 0xffa5, 0xff5a, 0xff1b, 0x000b, 0x00f0, 0xff99, 0xfeed,
-	0x000f, 0x0023, 0xffd0, 0xffe8, 0xffbe, 0xff94, 0xff52, 0x0008,
-	0x01dd, 0x0323, 0x0378, 0x022c, 0x0086, 0x007a, 0xfefd, 0xfd49,
-	0xfe37, 0xfe83, 0xfe35, 0xfe45, 0xfdf8, 0xfdb0, 0xfd52, 0xfd79,
-	0xfe39, 0xfe7c, 0xfdca, 0xfddf, 0xfe9e, 0xffbf, 0x01a8, 0x0226,
-	0x018c, 0x0104, 0xfeff, 0xfdcb, 0xff45, 0x0099, 0x000e, 0x0081,
-	0x01e5, 0x015b, 0x0029, 0xff0f, 0xff20, 0x0032, 0x000b, 0xff0c,
-	0xfe8f, 0xff04, 0xff90, 0xffc2, 0x0081, 0x0158, 0x000a, 0xfe82,
-	0xff0b, 0x000f, 0xffdd, 0xff97, 0x0094, 0x0100, 0xffe6, 0xfdbc,
-	0xfc4c, 0xfbee, 0xfb40, 0xfab6, 0xfab7, 0xfaa5, 0xfbc2, 0xfd06,
-	0xfdbe, 0xff6c, 0xffc2, 0xfec0, 0xffd8, 0x0185, 0x01bf, 0x0190,
-	0x0141, 0x020b, 0x02d4, 0x0178, 0xffa3, 0xfe15, 0xfc0a, 0xfa92,
-	0xfa52, 0xfa41, 0xfb64, 0xfc51, 0xfd07, 0xfe54, 0xfe21, 0xfdc7,
-	0xfe7f, 0x0020, 0x00b1, 0x0004, 0x009b, 0x016e, 0x01a3, 0x0181,
-	0x0124, 0x0002, 0xfdb5, 0xfba2, 0xfa9f, 0xfa3b, 0xfbb0, 0xfd21,
-	0xfd9d, 0xfe7e, 0xfe99, 0xfde1, 0xff2e, 0x0202, 0x02fa, 0x031a,
-	0x036f, 0x03c8, 0x0380, 0x029e, 0x0257, 0x0186, 0xff3f, 0xfc9a,
-	0xf9bf, 0xf7e7, 0xf8a6, 0xf988, 0xfab6, 0xfc58, 0xfd20, 0xfc82,
-	0xfce3, 0xffbf, 0x0269, 0x03bf, 0x040e, 0x04ac, 0x05c8, 0x059d,
-	0x043b, 0x0336, 0x01bc, 0xfee0, 0xfb8f, 0xf8d0, 0xf850, 0xf941,
-	0xf9d2, 0xfbf6, 0xfdfd, 0xfd42, 0xfd08, 0xfef2, 0x01a8, 0x034a,
-	0x04f6, 0x062c, 0x06a8, 0x0664, 0x0527, 0x0446, 0x0234, 0x0060,
-	0xfe62, 0xfb8d, 0xfa94, 0xf9af, 0xf8cc, 0xfaa8, 0xfce4, 0xfcc3,
-	0xfc9e, 0xfdf5, 0xff64, 0x0053, 0x00e0, 0x0280, 0x04d2, 0x0454,
-	0x0434, 0x048b, 0x0219, 0x0090, 0xfeb0, 0xfda3, 0xfd70, 0xfc97,
-	0xfc5f, 0xfc72, 0xfdb5, 0xfe25, 0xfd6d, 0xfedd, 0x00af, 0x00cb,
-	0x014f, 0x0205, 0x0421, 0x056c, 0x04da, 0x0588, 0x04d6, 0x0267,
-	0x003e, 0xfe3f, 0xfcaf, 0xfc53, 0xfbb7, 0xfbb1, 0xfc9e, 0xfc7d,
-	0xfc28, 0xfcbf, 0xfe4e, 0xfffa, 0xffa8, 0xffa9, 0x01f4, 0x02c8,
-	0x03af, 0x0585, 0x03a9, 0x0240, 0x0314, 0xffe5, 0xfd0e, 0xfd82,
-	0xfd11, 0xfdd0, 0xfec3, 0xfded, 0xfc66, 0xfb7d, 0xfc5f, 0xfdbe,
-	0xfe55, 0xff00, 0x003c, 0xffcb, 0x0084, 0x02af, 0x0424, 0x0438,
-	0x03cc, 0x0277, 0xffd5, 0xfebf, 0xfcf3, 0xfd0a, 0xff69, 0xfea9,
-	0xfc54, 0xfab6, 0xfad8, 0xfcc6, 0xfd5d, 0xfd89, 0xfee6, 0xff1e,
-	0xff61, 0x00f4, 0x01f3, 0x02f9, 0x0383, 0x01ed, 0x0132, 0x00c7,
-	0xff0d, 0xfe6b, 0xff94, 0x00a4, 0xfff1, 0xfd9b, 0xfc27, 0xfd36,
-	0xfd8b, 0xfd01, 0xfe20, 0xfeb4, 0xff18, 0x00ab, 0x0170, 0x034e,
-	0x04e5, 0x0311, 0x015c, 0x0101, 0x0005, 0xfdc3, 0xfd5a, 0xfeae,
-	0xfeae, 0xfdb9, 0xfd37, 0xfdd8, 0xfdf9, 0xfd33, 0xfdd0, 0xff0a,
-	0xff8d, 0x005e, 0x0227, 0x0392, 0x02d5, 0x0222, 0x01ad, 0x00aa,
-	0xffc0, 0xfe9b, 0xfeb8, 0xff11, 0xfe80, 0xfd1f, 0xfcf1, 0xfec1,
-	0xfe71, 0xfd62, 0xfe38, 0xfef6, 0xff72, 0x0060, 0x007e, 0x0257,
-	0x0307, 0x00d4, 0x0088, 0x00f5, 0x00b3, 0xfe44, 0xfe7a, 0x0094,
-	0xff7d, 0xff18, 0xfd74, 0xfde4, 0xffc3, 0xff39, 0xffad, 0xfff6,
-	0xff36, 0xfeb9, 0xff09, 0x0118, 0x01ed, 0x00d7, 0xffd6, 0xff5c,
-	0xfe7d, 0xfd25, 0xfec6, 0x00fd, 0x0315, 0x0219, 0xff8d, 0x001f,
-	0x006c, 0x00a4, 0x0268, 0x028c, 0x00a2, 0xffcd, 0xffd4, 0x0050,
-	0x01c8, 0x01ed, 0x00e3, 0x003a, 0xfe87, 0xfda7, 0xfc85, 0xfd8e,
-	0x018d, 0x0118, 0xffa4, 0x0192, 0x00a0, 0xff8a, 0x03db, 0x040c,
-	0x01fc, 0x0229, 0x0124, 0x013d, 0x00bf, 0xffc2, 0xff01, 0xfe3f,
-	0xfc55, 0xf9e0, 0xfa41, 0xfacc, 0xfdb6, 0xffd8, 0xffd9, 0x00c9,
-	0x004d, 0x0028, 0x00ac, 0x0185, 0x0186, 0x01fa, 0x01a0, 0x0096,
-	0x0127, 0x005a, 0x008f, 0xff7a, 0xfd87, 0xfd53, 0xfacc, 0xfa20,
-	0xfe4a, 0xff0f, 0xfd2d, 0xff80, 0x006c, 0x0038, 0x0136, 0x0142,
-	0x021a, 0x0258, 0x0230, 0x01e2, 0x0161, 0x00da, 0xfebc, 0xff73,
-	0xff37, 0xfd4c, 0xfc7e, 0xfa12, 0xfdc8, 0x00cd, 0xfe43, 0xff6a,
-	0x0015, 0x0067, 0x027b, 0x0286, 0x035e, 0x03b2, 0x015a, 0x025a,
-	0x02f0, 0x0258, 0x0180, 0xfdb2, 0xfe3b, 0xf98c, 0xf609, 0xfa9b,
-	0xfafe, 0xfe68, 0xff17, 0xfe3a, 0xfe9a, 0xfdef, 0xfe65, 0x0197,
-	0x052e, 0x04ac, 0x0507, 0x033d, 0x057c, 0x06f1, 0x034f, 0x04a0,
-	0x0314, 0xfd89, 0xfb3e, 0xf9aa, 0xf9b5, 0xfc5b, 0xf607, 0xf3f6,
-	0xfb58, 0xfb36, 0x0020, 0x05bd, 0x063f, 0x0ab0, 0x0881, 0x0609,
-	0x09f3, 0x084d, 0x05da, 0x0342, 0x00b4, 0xffd8, 0xf8cb, 0xf804,
-	0xfcf1, 0xfbdd, 0xfb5a, 0xfc9c, 0xfcd2, 0xfd1b, 0xfc1e, 0x0061,
-	0x0435, 0x0058, 0x0283, 0x049c, 0x06ba, 0x048a, 0xfff5, 0x053f,
-	0x01c7, 0xfa7b, 0xfb7f, 0xfab1, 0xfab6, 0xf931, 0xf615, 0xfd54,
-	0xfe3a, 0xf880, 0xfb5f, 0xff97, 0x016a, 0xfddd, 0xff16, 0x06fe,
-	0x0622, 0x0053, 0x0146, 0x0698, 0x04be, 0xfe1e, 0xfdf1, 0x000d,
-	0xfc98, 0xf572, 0xf51c, 0xfc04, 0xfbb9, 0xf6b0, 0xf9c5, 0xffb9,
-	0xfefa, 0xfc44, 0xfeef, 0x0642, 0x05d5, 0xffe6, 0x0346, 0x0686,
-	0x00ff, 0xfdbf, 0x0015, 0x0075, 0xfc17, 0xf886, 0xfad1, 0xfcb3,
-	0xfab0, 0xf976, 0xfacf, 0xfe3a, 0xfeae, 0xfa56, 0xfea9, 0x04e3,
-	0x0072, 0x007f, 0x0437, 0x0524, 0x02a5, 0xff3e, 0x02dd, 0x0437,
-	0xfe85, 0xfe2d, 0xff03, 0xfe1f, 0xfdf0, 0xf921, 0xfc46, 0xff90,
-	0xfb32, 0xfbe7, 0xfd17, 0xffc0, 0x00d7, 0xfee8, 0x0566, 0x07ca,
-	0x0336, 0x0410, 0x025f, 0x00b2, 0x0131, 0xfd40, 0xfd46, 0xffbe,
-	0xff5f, 0xfe17, 0xface, 0xfc99, 0x0098, 0xfbe7, 0xfb71, 0x01ba,
-	0xffbb, 0xfdb5, 0x0100, 0x0363, 0x04a8, 0x01aa, 0x0336, 0x05dd,
-	0xfe0c, 0xfbe1, 0xffb8, 0xfdab, 0xfe05, 0xfcd3, 0xf9f6, 0xfd4b,
-	0xfa94, 0xf9ad, 0xffab, 0xffb6, 0xffed, 0x013d, 0x0278, 0x05c9,
-	0x0314, 0x02b6, 0x060c, 0x0177, 0xfede, 0xfda3, 0xf9ca, 0xfab0,
-	0xfb86, 0xfb42, 0xfc36, 0xfab9, 0xfb5c, 0xfbdd, 0xf918, 0xfce7,
-	0x0032, 0xfe6d, 0x0162, 0x042d, 0x038b, 0x019a, 0x0154, 0x0534,
-	0x01dc, 0xfcb9, 0xff72, 0xfebe, 0xfb52, 0xfcc5, 0xfe5a, 0xfd2a,
-	0xfcec, 0xfe80, 0x0114, 0xffc0, 0xfcf7, 0x00c6, 0x022b, 0xff6b,
-	0x0020, 0x00f9, 0x00da, 0xfcf0, 0xfac2, 0xff44, 0xfba0, 0xf742,
-	0xfcf9, 0xfe05, 0xfaf8, 0xfa2b, 0xfc28, 0xff77, 0xfbf6, 0xf9f3,
-	0x001b, 0x00bd, 0xfcc5, 0xff6d, 0x03f7, 0x0520, 0x0354, 0x0229,
-	0x0589, 0x0577, 0xfe84, 0xfe19, 0x0418, 0x0300, 0xfee1, 0xff7a,
-	0x01cc, 0x01ea, 0xfe86, 0xfef1, 0x0176, 0xfdcd, 0xfafe, 0xfab9,
-	0xfc22, 0xfd50, 0xf927, 0xf820, 0xfbc2, 0xfa9a, 0xf486, 0xf3ff,
-	0xf9cc, 0xfb2f, 0xf720, 0xf7fe, 0xfcfb, 0xfc6c, 0xfa52, 0xfe2a,
-	0x0379, 0x03de, 0x02fb, 0x05c0, 0x0961, 0x0ad8, 0x0a6b, 0x0d8f,
-	0x10ab, 0x0ef6, 0x0d25, 0x0a8e, 0x0962, 0x09ba, 0x0788, 0x0377,
-	0x0163, 0xfe40, 0xf6ec, 0xf2c9, 0xf21f, 0xf02a, 0xed1f, 0xec94,
-	0xecc5, 0xeb36, 0xeb65, 0xee0c, 0xf0dd, 0xf23f, 0xf250, 0xf396,
-	0xf753, 0xfab5, 0xfe96, 0x027f, 0x0583, 0x08d0, 0x0a1f, 0x0cb0,
-	0x11a7, 0x13f4, 0x14f6, 0x1a34, 0x1de4, 0x1c42, 0x1bd1, 0x1b65,
-	0x1ab8, 0x1556, 0x0c4f, 0x050f, 0xfefa, 0xf8d6, 0xf1c8, 0xed75,
-	0xebcf, 0xe8d1, 0xe53d, 0xe43e, 0xe5e8, 0xe855, 0xe849, 0xeb13,
-	0xf171, 0xf469, 0xf4f0, 0xf512, 0xf667, 0xf862, 0xf7d7, 0xf6b2,
-	0xf888, 0xfaf8, 0xfe49, 0x02a4, 0x0678, 0x0b16, 0x1177, 0x176c,
-	0x1c7d, 0x21a3, 0x2323, 0x23ce, 0x2586, 0x20f2, 0x1c42, 0x19f3,
-	0x1243, 0x0a5d, 0x02bc, 0xf880, 0xf0b4, 0xebe2, 0xe7fb, 0xe5fc,
-	0xe6e0, 0xe762, 0xe8b2, 0xec2b, 0xee47, 0xf0c4, 0xf2e1, 0xf3a0,
-	0xf5cf, 0xf753, 0xf5eb, 0xf53a, 0xf640, 0xf782, 0xf69d, 0xf55e,
-	0xf498, 0xf3a0, 0xf848, 0x00c2, 0x091c, 0x1201, 0x1971, 0x1d4d,
-	0x222f, 0x2689, 0x2735, 0x2628, 0x23e7, 0x202c, 0x1b2c, 0x1530,
-	0x0cb9, 0x04d9, 0xfc32, 0xf3ce, 0xee8b, 0xe93d, 0xe580, 0xe4aa,
-	0xe5e7, 0xe829, 0xe9ce, 0xebbb, 0xefc8, 0xf1ac, 0xf24a, 0xf43c,
-	0xf416, 0xf30e, 0xf2b5, 0xf249, 0xf2a3, 0xf553, 0xf713, 0xf7b2,
-	0xf849, 0xfa33, 0xfe16, 0x0300, 0x0948, 0x0f93, 0x1706, 0x1bee,
-	0x2026, 0x2408, 0x2480, 0x23ea, 0x21b5, 0x1f2a, 0x1c01, 0x16b9,
-	0x0fcb, 0x095e, 0x01dd, 0xf8fc, 0xf25e, 0xecdf, 0xe830, 0xe598,
-	0xe3a7, 0xe1bb, 0xe129, 0xe11e, 0xe1a8, 0xe4a6, 0xe743, 0xe7fa,
-	0xe9c7, 0xec27, 0xee53, 0xf092, 0xf2f3, 0xf782, 0xfba1, 0xfd67,
-	0xff1d, 0x0173, 0x04c7, 0x098d, 0x0f0e, 0x15a0, 0x1c89, 0x2135,
-	0x24df, 0x27e0, 0x271a, 0x267d, 0x24b5, 0x2065, 0x1d81, 0x164f,
-	0x0dfc, 0x06f8, 0xfecb, 0xf707, 0xefae, 0xe8ec, 0xe414, 0xe0da,
-	0xdda6, 0xde42, 0xdf6d, 0xdfdd, 0xe1db, 0xe4ed, 0xe850, 0xe9b7,
-	0xebd8, 0xef14, 0xf20d, 0xf5cf, 0xf9ee, 0xfda0, 0x01c7, 0x0427,
-	0x047b, 0x062a, 0x09aa, 0x0db6, 0x1345, 0x1a83, 0x2123, 0x2422,
-	0x25af, 0x26da, 0x2424, 0x21ae, 0x1fac, 0x1b44, 0x1548, 0x0e80,
-	0x068c, 0xfe22, 0xf719, 0xf241, 0xeed2, 0xe9ed, 0xe546, 0xe332,
-	0xe1b1, 0xe0c2, 0xe220, 0xe33b, 0xe4a0, 0xe7d6, 0xea8a, 0xeba0,
-	0xece3, 0xeefd, 0xf0ac, 0xf3ce, 0xf7bd, 0xfbab, 0x0015, 0x03db,
-	0x0750, 0x0b7d, 0x0e1c, 0x1230, 0x17f3, 0x1c19, 0x2248, 0x254c,
-	0x243a, 0x2338, 0x21a1, 0x1f7b, 0x1aab, 0x1471, 0x0f58, 0x0953,
-	0x0141, 0xf910, 0xf32b, 0xf048, 0xeea6, 0xec0d, 0xe85f, 0xe50e,
-	0xe230, 0xe0cb, 0xe1c6, 0xe3fb, 0xe6ae, 0xe844, 0xe9bb, 0xec66,
-	0xed64, 0xeded, 0xf0a4, 0xf402, 0xf747, 0xfab3, 0xfe8d, 0x027b,
-	0x06b5, 0x0b72, 0x0f78, 0x1425, 0x1989, 0x1d1b, 0x20b5, 0x23c0,
-	0x24c7, 0x23e4, 0x218d, 0x1ed6, 0x1adc, 0x1537, 0x0e38, 0x06fd,
-	0xff07, 0xf78a, 0xf2dc, 0xf02b, 0xed85, 0xeac9, 0xe814, 0xe4da,
-	0xe2dc, 0xe261, 0xe35a, 0xe4c8, 0xe725, 0xe9d5, 0xeb93, 0xee0d,
-	0xef74, 0xf09b, 0xf27a, 0xf567, 0xf8de, 0xfb7a, 0xfeae, 0x0319,
-	0x07dd, 0x0c78, 0x10b1, 0x15ae, 0x1b68, 0x1ee5, 0x22af, 0x2507,
-	0x232d, 0x2180, 0x1f95, 0x1dde, 0x1ab5, 0x14b2, 0x0dec, 0x0692,
-	0xfeba, 0xf6c3, 0xf127, 0xef48, 0xed3b, 0xeaf4, 0xe897, 0xe65f,
-	0xe3d9, 0xe165, 0xe3b8, 0xe5e7, 0xe68b, 0xe98c, 0xebbe, 0xed93,
-	0xf02e, 0xf196, 0xf38d, 0xf747, 0xfa84, 0xfccc, 0xff49, 0x02ed,
-	0x0857, 0x0e2a, 0x1254, 0x171c, 0x1bcb, 0x1d7c, 0x2075, 0x2259,
-	0x2224, 0x21b6, 0x1f89, 0x1cff, 0x199f, 0x132c, 0x0c92, 0x0660,
-	0xfe75, 0xf7a0, 0xf304, 0xeef0, 0xec53, 0xea43, 0xe7a9, 0xe6ec,
-	0xe491, 0xe2b5, 0xe3e5, 0xe494, 0xe60e, 0xe81e, 0xea12, 0xec5b,
-	0xef03, 0xf0e0, 0xf239, 0xf54d, 0xf8fa, 0xfc72, 0xff6f, 0x023e,
-	0x075d, 0x0cb4, 0x1121, 0x163c, 0x1b7c, 0x1e22, 0x20c1, 0x2353,
-	0x21fc, 0x1fcb, 0x1e3b, 0x1c15, 0x1928, 0x14cc, 0x0ec6, 0x08d4,
-	0x01bd, 0xfb56, 0xf5cd, 0xf0f1, 0xeedf, 0xec34, 0xe9c5, 0xe7f0,
-	0xe5e8, 0xe459, 0xe29d, 0xe283, 0xe406, 0xe500, 0xe5ae, 0xe774,
-	0xea71, 0xee65, 0xf124, 0xf3a8, 0xf80d, 0xfb59, 0xfee3, 0x01f6,
-	0x06c4, 0x0c3a, 0x10bc, 0x17a1, 0x1bfb, 0x1f79, 0x210a, 0x2150,
-	0x231c, 0x2201, 0x1fba, 0x1e01, 0x1b26, 0x16e8, 0x10e8, 0x0a59,
-	0x03e0, 0xfdda, 0xf87c, 0xf301, 0xef76, 0xec9c, 0xe956, 0xe6fd,
-	0xe556, 0xe348, 0xe248, 0xe247, 0xe26c, 0xe3bf, 0xe4a7, 0xe5e2,
-	0xe7a6, 0xeadc, 0xee53, 0xf10e, 0xf4a4, 0xf952, 0xfdb1, 0x006c,
-	0x04be, 0x0aa4, 0x0f5b, 0x1535, 0x1b5b, 0x1f33, 0x233f, 0x2511,
-	0x23ba, 0x220f, 0x2006, 0x1df6, 0x1b98, 0x181f, 0x128f, 0x0c14,
-	0x051d, 0xff1c, 0xfa16, 0xf402, 0xeff6, 0xed8c, 0xe99f, 0xe6fc,
-	0xe581, 0xe331, 0xe255, 0xe296, 0xe28b, 0xe301, 0xe362, 0xe3f0,
-	0xe5dc, 0xe8be, 0xebc6, 0xeea7, 0xf13b, 0xf507, 0xfa01, 0xfd8e,
-	0x0126, 0x0627, 0x0b8c, 0x1131, 0x18c7, 0x1d67, 0x2044, 0x2418,
-	0x2464, 0x2479, 0x241f, 0x207f, 0x1d88, 0x1b00, 0x1641, 0x10dc,
-	0x09dc, 0x02d0, 0xfd3b, 0xf6a3, 0xf25d, 0xef4a, 0xeba7, 0xe906,
-	0xe6d1, 0xe530, 0xe3e7, 0xe2fa, 0xe23c, 0xe2e6, 0xe41b, 0xe43c,
-	0xe485, 0xe62b, 0xe8a2, 0xeb9d, 0xeea1, 0xf18c, 0xf4f2, 0xf826,
-	0xfbf4, 0x0136, 0x06e1, 0x0c30, 0x12f8, 0x19ea, 0x1f27, 0x2190,
-	0x2468, 0x26d8, 0x257b, 0x23fc, 0x20e1, 0x1d97, 0x1aea, 0x15c6,
-	0x1037, 0x0aa3, 0x0493, 0xfde7, 0xf776, 0xf2ea, 0xeef8, 0xeb1b,
-	0xe8eb, 0xe75e, 0xe4c7, 0xe2e6, 0xe1ce, 0xe0d9, 0xe1cc, 0xe290,
-	0xe2a0, 0xe3cd, 0xe6b1, 0xe94f, 0xeb33, 0xef35, 0xf3ca, 0xf7bb,
-	0xfb4d, 0xffcc, 0x0442, 0x08aa, 0x0e06, 0x14d2, 0x1b5e, 0x1f05,
-	0x235c, 0x250a, 0x25b6, 0x2633, 0x2361, 0x21aa, 0x1f1c, 0x1bf1,
-	0x1738, 0x1109, 0x0ae7, 0x042e, 0xfdf0, 0xf7d2, 0xf227, 0xeddb,
-	0xe9c4, 0xe691, 0xe4b5, 0xe222, 0xe114, 0xe0f0, 0xe08e, 0xe0f4,
-	0xe14b, 0xe357, 0xe591, 0xe78d, 0xea98, 0xed4b, 0xf0da, 0xf55b,
-	0xf8c9, 0xfc52, 0x0076, 0x03f9, 0x0922, 0x0df9, 0x131b, 0x1a6c,
-	0x1db2, 0x209b, 0x23d6, 0x254c, 0x26da, 0x2415, 0x214a, 0x1ef1,
-	0x1b44, 0x1736, 0x11ae, 0x0c06, 0x05a7, 0xff4d, 0xf89d, 0xf36c,
-	0xee8f, 0xea9c, 0xe763, 0xe3c3, 0xe23c, 0xe063, 0xdf84, 0xdf2a,
-	0xdffe, 0xe242, 0xe3dd, 0xe6bc, 0xe960, 0xeb47, 0xeee4, 0xf296,
-	0xf605, 0xf99c, 0xfcae, 0xffab, 0x0312, 0x076a, 0x0bda, 0x1124,
-	0x15ad, 0x1a2b, 0x1dbd, 0x205e, 0x23ab, 0x244a, 0x24ae, 0x2407,
-	0x20a5, 0x1d52, 0x1935, 0x146b, 0x0f96, 0x09d0, 0x0349, 0xfbd2,
-	0xf537, 0xf049, 0xebb9, 0xe8d3, 0xe547, 0xe1fe, 0xe04c, 0xde13,
-	0xdd4b, 0xde0a, 0xe0bf, 0xe3b9, 0xe56c, 0xe7cb, 0xeab8, 0xedec,
-	0xf03d, 0xf3ef, 0xf8b0, 0xfc4d, 0x0023, 0x033b, 0x0739, 0x0c3b,
-	0x1046, 0x13be, 0x16e8, 0x1add, 0x1ecf, 0x22b6, 0x25ad, 0x268e,
-	0x24ee, 0x20d5, 0x1cd5, 0x1943, 0x13ce, 0x0ee4, 0x0a27, 0x0325,
-	0xfc80, 0xf4f7, 0xf02d, 0xed59, 0xe923, 0xe700, 0xe56e, 0xe346,
-	0xe27c, 0xe2b2, 0xe36d, 0xe5ae, 0xe792, 0xe8ff, 0xeabc, 0xeba7,
-	0xecef, 0xefb3, 0xf2bb, 0xf577, 0xf85a, 0xfb8c, 0xffcb, 0x0500,
-	0x0a91, 0x0f91, 0x13c9, 0x1972, 0x1dcf, 0x2008, 0x245b, 0x263c,
-	0x269e, 0x2520, 0x2060, 0x1d52, 0x18da, 0x12ba, 0x0df4, 0x07d6,
-	0x00bf, 0xfac5, 0xf56a, 0xf0e2, 0xed62, 0xeb35, 0xe88e, 0xe689,
-	0xe624, 0xe4a7, 0xe47f, 0xe4dc, 0xe627, 0xe85e, 0xe978, 0xeb90,
-	0xec56, 0xece1, 0xee8e, 0xf000, 0xf31f, 0xf5db, 0xf9d0, 0xff1c,
-	0x048f, 0x0aa9, 0x0e39, 0x12b4, 0x181f, 0x1c66, 0x2095, 0x2392,
-	0x262f, 0x2704, 0x264f, 0x21e7, 0x1d03, 0x186e, 0x11b3, 0x0c95,
-	0x0740, 0x01b3, 0xfba4, 0xf61c, 0xf1cc, 0xee89, 0xebc6, 0xe916,
-	0xe80f, 0xe746, 0xe718, 0xe776, 0xe7bb, 0xe88a, 0xe92f, 0xe9b7,
-	0xeaa2, 0xec0b, 0xee47, 0xef97, 0xf07e, 0xf1c7, 0xf3e2, 0xf7db,
-	0xfc76, 0x01ae, 0x07c1, 0x0ca3, 0x1115, 0x15c2, 0x1913, 0x1cf0,
-	0x20bf, 0x23a4, 0x250c, 0x246b, 0x213c, 0x1cdc, 0x182a, 0x122e,
-	0x0cac, 0x0799, 0x01de, 0xfcbf, 0xf7a1, 0xf365, 0xf017, 0xecab,
-	0xea62, 0xe993, 0xe89f, 0xe806, 0xe85c, 0xe885, 0xe88b, 0xe8e0,
-	0xe97d, 0xeabd, 0xecaa, 0xed84, 0xeea1, 0xefbd, 0xf0bc, 0xf385,
-	0xf762, 0xfcbc, 0x0276, 0x0799, 0x0c54, 0x106b, 0x142b, 0x17d7,
-	0x1b61, 0x1f0b, 0x2205, 0x22f7, 0x2239, 0x2062, 0x1d9b, 0x19b7,
-	0x1469, 0x0eac, 0x09f2, 0x03f8, 0xfe1a, 0xfa0a, 0xf517, 0xf145,
-	0xeedf, 0xebca, 0xe910, 0xe807, 0xe819, 0xe7f0, 0xe818, 0xe7f0,
-	0xe85b, 0xea7d, 0xec3a, 0xed8f, 0xef80, 0xef9c, 0xefcc, 0xf0fd,
-	0xf2b0, 0xf699, 0xfbd9, 0x0174, 0x05f6, 0x09f1, 0x0d4a, 0x1022,
-	0x13e9, 0x18a2, 0x1d3d, 0x2038, 0x221f, 0x2347, 0x2222, 0x1f2f,
-	0x1bee, 0x1715, 0x116d, 0x0b9c, 0x05e7, 0x0120, 0xfbe8, 0xf69d,
-	0xf248, 0xeed8, 0xebbb, 0xe914, 0xe7e3, 0xe81a, 0xe802, 0xe7cc,
-	0xe7fd, 0xe818, 0xea06, 0xec4c, 0xedfc, 0xef70, 0xefa9, 0xefce,
-	0xf014, 0xf18e, 0xf5da, 0xfadd, 0xff80, 0x0402, 0x07cb, 0x0b74,
-	0x0eb4, 0x124c, 0x1748, 0x1bc2, 0x1deb, 0x1f7d, 0x2076, 0x20b7,
-	0x1ff2, 0x1d1a, 0x19e5, 0x153a, 0x0f4b, 0x0926, 0x03aa, 0xfeaa,
-	0xfa09, 0xf586, 0xf093, 0xed3b, 0xea82, 0xe81e, 0xe73e, 0xe6d0,
-	0xe6db, 0xe836, 0xe973, 0xea64, 0xebf7, 0xee07, 0xefb2, 0xefea,
-	0xf004, 0xf0f0, 0xf217, 0xf4a1, 0xf8c5, 0xfd59, 0x0131, 0x046a,
-	0x07a8, 0x0aa3, 0x0e21, 0x1279, 0x1674, 0x1b04, 0x1d64, 0x1d5d,
-	0x1d69, 0x1d8b, 0x1e02, 0x1c17, 0x17c8, 0x1335, 0x0e2a, 0x0929,
-	0x047a, 0xffd9, 0xfb2d, 0xf55d, 0xf048, 0xecce, 0xe957, 0xe6e1,
-	0xe62b, 0xe61e, 0xe5fd, 0xe6ea, 0xe7c1, 0xe924, 0xebda, 0xedfa,
-	0xefa2, 0xf0b6, 0xf237, 0xf41a, 0xf634, 0xf980, 0xfcb6, 0xffd6,
-	0x0316, 0x0522, 0x074e, 0x0a44, 0x0d46, 0x1050, 0x13d3, 0x1797,
-	0x193d, 0x1a17, 0x1b61, 0x1bc7, 0x1ac8, 0x1832, 0x15ae, 0x1247,
-	0x0ec3, 0x0bcc, 0x0715, 0x0214, 0xfcef, 0xf743, 0xf2bc, 0xeea3,
-	0xeb4c, 0xe930, 0xe6f2, 0xe61c, 0xe682, 0xe776, 0xe88e, 0xea5f,
-	0xec14, 0xecb7, 0xee7d, 0xf0ac, 0xf2d2, 0xf63d, 0xf941, 0xfb31,
-	0xfdac, 0x0052, 0x02c5, 0x0509, 0x06fb, 0x0971, 0x0bb1, 0x0d44,
-	0x0faa, 0x11df, 0x1390, 0x1613, 0x1671, 0x151f, 0x146f, 0x139c,
-	0x1289, 0x111f, 0x0f50, 0x0cc1, 0x08b6, 0x03f7, 0xff5c, 0xfaa1,
-	0xf60f, 0xf280, 0xef3c, 0xec26, 0xea1d, 0xe91b, 0xe8da, 0xe9b6,
-	0xea77, 0xeb55, 0xec74, 0xedd1, 0xefbf, 0xf20d, 0xf4e5, 0xf7be,
-	0xfa56, 0xfc89, 0xfead, 0xffc5, 0x0167, 0x03a4, 0x05be, 0x078f,
-	0x094e, 0x0b3c, 0x0cf3, 0x0ee3, 0x100c, 0x1011, 0x1026, 0x0fd0,
-	0x0e72, 0x0e43, 0x0dce, 0x0d13, 0x0b92, 0x0891, 0x0678, 0x03a2,
-	0x008a, 0xfe33, 0xfba1, 0xf8de, 0xf60d, 0xf3fc, 0xf22d, 0xf0d4,
-	0xf0f8, 0xf118, 0xf045, 0xefd0, 0xf030, 0xf13e, 0xf1d7, 0xf34a,
-	0xf584, 0xf6cf, 0xf895, 0xfa65, 0xfc0c, 0xfe38, 0x0036, 0x015a,
-	0x032c, 0x0599, 0x069e, 0x089f, 0x0aec, 0x0bb9, 0x0c32, 0x0c03,
-	0x0b55, 0x0b95, 0x0b53, 0x0b03, 0x0ae1, 0x09a4, 0x07cd, 0x05cb,
-	0x0359, 0x0138, 0xffc3, 0xfd75, 0xfb39, 0xf96f, 0xf782, 0xf6ed,
-	0xf665, 0xf5ae, 0xf5a6, 0xf4fe, 0xf4ad, 0xf4ca, 0xf555, 0xf6ce,
-	0xf818, 0xf912, 0xf99c, 0xf9a5, 0xf989, 0xfa1e, 0xfb8f, 0xfce2,
-	0xfe2b, 0xff9b, 0x00c4, 0x02b3, 0x04a2, 0x063f, 0x077f, 0x0772,
-	0x07eb, 0x08a9, 0x0906, 0x0a48, 0x0b2f, 0x0a3d, 0x08e3, 0x074d,
-	0x044c, 0x0217, 0x00b3, 0xff1a, 0xfded, 0xfca0, 0xfaae, 0xf944,
-	0xf831, 0xf7ba, 0xf7c9, 0xf722, 0xf6e9, 0xf74d, 0xf7f1, 0xf901,
-	0xfa9f, 0xfbb9, 0xfc05, 0xfc19, 0xfb96, 0xfb71, 0xfbe5, 0xfc26,
-	0xfd07, 0xfe26, 0xfedc, 0xff99, 0x00c7, 0x0259, 0x03e9, 0x04c2,
-	0x0565, 0x05a6, 0x05e6, 0x06c3, 0x07ce, 0x0887, 0x0805, 0x0728,
-	0x04e8, 0x0270, 0x011b, 0xff5d, 0xfd90, 0xfc07, 0xfa82, 0xf951,
-	0xf81d, 0xf7a3, 0xf836, 0xf7de, 0xf771, 0xf718, 0xf732, 0xf83d,
-	0xf9b9, 0xfbae, 0xfd46, 0xfe87, 0xfe5b, 0xfdbe, 0xfe5f, 0xfeb7,
-	0xff68, 0xffdf, 0x000d, 0x00d0, 0x017a, 0x023f, 0x03c1, 0x047f,
-	0x0468, 0x043e, 0x042b, 0x048f, 0x0581, 0x06c5, 0x0702, 0x074e,
-	0x0659, 0x040f, 0x02dd, 0x0188, 0x006d, 0xff3e, 0xfdb1, 0xfc22,
-	0xfa6a, 0xf92a, 0xf8ff, 0xf914, 0xf8f1, 0xf878, 0xf84b, 0xf854,
-	0xf890, 0xfa03, 0xfb6a, 0xfcd3, 0xfd51, 0xfd94, 0xfe82, 0xfeda,
-	0xff4b, 0xffc8, 0x001e, 0x00a0, 0x006a, 0x0099, 0x01fb, 0x035f,
-	0x0427, 0x046a, 0x0473, 0x0446, 0x04c0, 0x05bb, 0x064d, 0x0732,
-	0x06d2, 0x0549, 0x0492, 0x031d, 0x0198, 0x002a, 0xfe75, 0xfcf7,
-	0xfb5c, 0xf9ab, 0xf8f2, 0xf93f, 0xf93c, 0xf8cd, 0xf8ba, 0xf86f,
-	0xf89b, 0xf9d1, 0xfb5b, 0xfd30, 0xfe04, 0xfde9, 0xfe48, 0xfe69,
-	0xfe95, 0xff1b, 0xff97, 0x0065, 0x00d6, 0x0149, 0x01f4, 0x02cf,
-	0x034b, 0x03bc, 0x03e7, 0x035e, 0x0368, 0x03e0, 0x04c1, 0x0630,
-	0x0644, 0x0508, 0x0412, 0x02dc, 0x01e8, 0x0149, 0x004a, 0xffb8,
-	0xff1b, 0xfdd9, 0xfcbf, 0xfc9c, 0xfc2a, 0xfbac, 0xfb75, 0xfac4,
-	0xfacd, 0xfb0c, 0xfba7, 0xfd49, 0xfe52, 0xfe38, 0xfe28, 0xfdff,
-	0xfdfa, 0xfe57, 0xfeb3, 0xff30, 0xffa7, 0xffbc, 0x0009, 0x0146,
-	0x0243, 0x0313, 0x035a, 0x02d4, 0x0309, 0x0345, 0x0373, 0x0498,
-	0x0569, 0x054e, 0x04b0, 0x0399, 0x0292, 0x019a, 0x006b, 0xff5b,
-	0xfece, 0xfd91, 0xfc45, 0xfc12, 0xfc2d, 0xfc65, 0xfc39, 0xfb66,
-	0xfb1e, 0xfae1, 0xfb26, 0xfcdf, 0xfe4a, 0xfeed, 0xff09, 0xff0b,
-	0xff00, 0xfea5, 0xfe42, 0xfe2d, 0xfece, 0xfef8, 0xff28, 0xffdb,
-	0x0053, 0x0137, 0x01e0, 0x019f, 0x0182, 0x0101, 0x00f7, 0x027a,
-	0x03c1, 0x0400, 0x03ac, 0x0321, 0x02b4, 0x0253, 0x0197, 0x00ad,
-	0x005d, 0xff97, 0xfe90, 0xfe62, 0xfe35, 0xfe5c, 0xfe80, 0xfe12,
-	0xfde1, 0xfd0e, 0xfc19, 0xfc86, 0xfda2, 0xfe48, 0xfe4e, 0xfe33,
-	0xfe18, 0xfe19, 0xfe18, 0xfdfc, 0xfe08, 0xfdb7, 0xfd5a, 0xfdb0,
-	0xfe3f, 0xff52, 0x0073, 0x00bc, 0x0168, 0x0187, 0x0159, 0x01ed,
-	0x02e7, 0x0396, 0x03c4, 0x037e, 0x0305, 0x02b1, 0x0219, 0x0167,
-	0x00ee, 0x0019, 0xfec0, 0xfdc6, 0xfd2c, 0xfd80, 0xfe39, 0xfe43,
-	0xfe50, 0xfdd8, 0xfcf7, 0xfd2c, 0xfe30, 0xfefb, 0xff3a, 0xff24,
-	0xff07, 0xfecc, 0xfe69, 0xfdf1, 0xfdec, 0xfdc7, 0xfd4c, 0xfd4c,
-	0xfd31, 0xfdb5, 0xfeda, 0xff93, 0x002b, 0x0019, 0xff7b, 0xffa7,
-	0x00d2, 0x0249, 0x031a, 0x02fb, 0x0268, 0x0206, 0x01d3, 0x014a,
-	0x010f, 0x00c1, 0x002a, 0xffd0, 0xff32, 0xfedd, 0xfef5, 0xff1b,
-	0xff7d, 0xff48, 0xfe55, 0xfdb3, 0xfe15, 0xff3f, 0x0043, 0x0064,
-	0xffea, 0xff6a, 0xfecd, 0xfe4c, 0xfe70, 0xfe4a, 0xfdb5, 0xfd5b,
-	0xfcdc, 0xfce5, 0xfd49, 0xfd76, 0xfe0e, 0xfe7b, 0xfe42, 0xfe41,
-	0xff10, 0x004a, 0x01c0, 0x02b2, 0x02aa, 0x0290, 0x0235, 0x016a,
-	0x012a, 0x00fc, 0x004b, 0xffb0, 0xfea5, 0xfe12, 0xfe49, 0xfe8b,
-	0xfed6, 0xff01, 0xfe5d, 0xfdbf, 0xfe17, 0xff0c, 0x0012, 0x010b,
-	0x0189, 0x01ba, 0x0183, 0x0070, 0xffed, 0xff89, 0xfecf, 0xfe0a,
-	0xfd08, 0xfc6c, 0xfc5f, 0xfc9b, 0xfd18, 0xfd8b, 0xfd46, 0xfcae,
-	0xfcb6, 0xfde4, 0xff86, 0x00d0, 0x0145, 0x01bf, 0x0227, 0x01ea,
-	0x01c3, 0x015f, 0x00fb, 0x00b4, 0x0002, 0xff7d, 0xff56, 0xff49,
-	0xffb1, 0x001b, 0xffd0, 0xfef2, 0xfe2f, 0xfe38, 0xff5e, 0x00a8,
-	0x010b, 0x012e, 0x010d, 0x004d, 0x000c, 0xffae, 0xff34, 0xfee8,
-	0xfe02, 0xfd33, 0xfcf0, 0xfce0, 0xfd10, 0xfda2, 0xfdca, 0xfd44,
-	0xfcfe, 0xfd29, 0xfe67, 0x0018, 0x0115, 0x019e, 0x01c8, 0x0156,
-	0x012b, 0x0104, 0x00c2, 0x0069, 0xff86, 0xfeba, 0xfe50, 0xfe15,
-	0xfe37, 0xfecb, 0xff13, 0xfec5, 0xfe52, 0xfe17, 0xfeb9, 0xffc2,
-	0x0041, 0x00cb, 0x0104, 0x0093, 0x001e, 0xffb2, 0xff75, 0xff55,
-	0xfeb4, 0xfe0e, 0xfd87, 0xfcde, 0xfcde, 0xfd75, 0xfddb, 0xfd9d,
-	0xfd2e, 0xfcb4, 0xfd46, 0xfed0, 0xffc5, 0x005b, 0x00b3, 0x00a4,
-	0x00b9, 0x0068, 0x0038, 0x004c, 0x0066, 0x0069, 0x0028, 0xffa4,
-	0xffac, 0x0024, 0x0088, 0x00a2, 0x001d, 0xff3d, 0xfee8, 0xff87,
-	0x001d, 0x009b, 0x00e7, 0x0095, 0x0046, 0xffc3, 0xff4e, 0xff14,
-	0xfe87, 0xfdfc, 0xfda0, 0xfd67, 0xfd16, 0xfd4d, 0xfdfe, 0xfe70,
-	0xfe36, 0xfd9d, 0xfd57, 0xfdf4, 0xfefb, 0x0069, 0x013a, 0x0123,
-	0x013e, 0x00d1, 0x0060, 0x0063, 0x0026, 0xffa6, 0xff6d, 0xff69,
-	0xff5b, 0xffa0, 0x001b, 0x0077, 0x00a5, 0xffe0, 0xffab, 0x001f,
-	0x0078, 0x017e, 0x0224, 0x0242, 0x0214, 0x014d, 0x00a4, 0x002a,
-	0xff7e, 0xfee4, 0xfe4f, 0xfd79, 0xfca3, 0xfcb3, 0xfd70, 0xfe17,
-	0xfe1e, 0xfd9e, 0xfd14, 0xfd56, 0xfdff, 0xff1b, 0xfff5, 0x0057,
-	0x00c4, 0x004b, 0xfff5, 0xfff1, 0xff86, 0xff54, 0xff1b, 0xfece,
-	0xfeb1, 0xff30, 0xffd9, 0x0073, 0x0154, 0x00e2, 0x0025, 0x002c,
-	0x0039, 0x00e8, 0x0155, 0x014a, 0x017e, 0x0103, 0x0072, 0x003d,
-	0xffd3, 0xfefb, 0xfe3c, 0xfda3, 0xfcc4, 0xfc40, 0xfc5f, 0xfd43,
-	0xfe10, 0xfdc5, 0xfd6b, 0xfda9, 0xfd9c, 0xfe7a, 0xfff5, 0x00a2,
-	0x00b2, 0x0021, 0x0032, 0x0025, 0xffd1, 0xff58, 0xfedd, 0xfe8d,
-	0xfde4, 0xfe16, 0xfe1a, 0xfe6d, 0xff88, 0xffa1, 0xff58, 0xff72,
-	0xffbe, 0x003b, 0x00a5, 0x0109, 0x01cc, 0x014d, 0xffcc, 0xffe1,
-	0x0054, 0xffb3, 0xfe0e, 0xfd2f, 0xf600, 0xf0cf, 0xfdf8, 0x037f,
-	0xf75d, 0xf493, 0xfc2a, 0x0216, 0x03db, 0x0337, 0x01d8, 0xfe3f,
-	0x0030, 0x06b1, 0x052d, 0x003d, 0x0066, 0x02c3, 0x01cc, 0x00da,
-	0x033c, 0x0412, 0x01b8, 0x014b, 0x0345, 0x03c9, 0x02f4, 0x0202,
-	0x01fd, 0x029b, 0x026c, 0x01d6, 0x00e6, 0x0192, 0x02fe, 0xff02,
-	0xfc77, 0xfee9, 0xfe9a, 0xfb47, 0xfa8c, 0xfc56, 0xfc60, 0xf9dd,
-	0xfa37, 0xfe3d, 0xfdff, 0xfc17, 0xfd53, 0xfe9e, 0xfefb, 0xffba,
-	0x024c, 0x0483, 0x0265, 0x012c, 0x024e, 0x02ec, 0x027b, 0x00ae,
-	0x00b6, 0x013d, 0xffb6, 0x00b4, 0x0220, 0x007f, 0x00b2, 0x01d5,
-	0x00dd, 0xffd2, 0x0084, 0x01a0, 0x00bf, 0x0000, 0xffe1, 0xff85,
-	0xfd69, 0xfba8, 0xfc14, 0xf9de, 0xf704, 0xf66f, 0xf617, 0xf500,
-	0xf474, 0xf4e9, 0xf71a, 0xf7a6, 0xf691, 0xf840, 0xfba9, 0xfdb6,
-	0xff90, 0x0470, 0x0670, 0x0620, 0x090c, 0x0bd1, 0x0ba3, 0x0b31,
-	0x0d12, 0x0d46, 0x0a4e, 0x0ae7, 0x0b6e, 0x0876, 0x08c4, 0x07cd,
-	0x02d9, 0x0020, 0xfecd, 0xfaaf, 0xf7bf, 0xf731, 0xf45e, 0xf163,
-	0xf104, 0xf026, 0xed8f, 0xecbf, 0xed97, 0xed2e, 0xecdf, 0xedd6,
-	0xeff5, 0xf128, 0xf33b, 0xf70d, 0xf94f, 0xfc66, 0xffdf, 0x0261,
-	0x0686, 0x0b1d, 0x0d84, 0x1011, 0x1441, 0x15e9, 0x1691, 0x16ea,
-	0x1761, 0x1a05, 0x17ce, 0x14a9, 0x14db, 0x1045, 0x0aff, 0x0b01,
-	0x044e, 0xfba8, 0xfb94, 0xf666, 0xf005, 0xf0f9, 0xee8d, 0xe9fe,
-	0xea3e, 0xeab6, 0xe91a, 0xe96c, 0xebeb, 0xebe5, 0xec1f, 0xefed,
-	0xf182, 0xf191, 0xf6c3, 0xfa9a, 0xfa4f, 0xfeae, 0x02b7, 0x0257,
-	0x0613, 0x0a66, 0x0ac5, 0x0d51, 0x0f57, 0x10c0, 0x1330, 0x1639,
-	0x16f1, 0x16be, 0x1b48, 0x1a4c, 0x16ba, 0x1952, 0x15c3, 0x0f65,
-	0x0f26, 0x08c0, 0x005e, 0xff13, 0xfaf7, 0xf3b4, 0xf23f, 0xf0f5,
-	0xea97, 0xe9fa, 0xebb9, 0xe786, 0xe777, 0xe91a, 0xe7ea, 0xe9e8,
-	0xeb5a, 0xecc3, 0xf02c, 0xf2c3, 0xf58d, 0xf932, 0xfb7d, 0xfd51,
-	0x01a1, 0x03a7, 0x0619, 0x0b16, 0x0c33, 0x0d27, 0x108f, 0x10e8,
-	0x13c5, 0x18f5, 0x16ec, 0x1a47, 0x1dd3, 0x183c, 0x1af2, 0x1c31,
-	0x1483, 0x12f4, 0x0fb2, 0x05ac, 0x021f, 0xff61, 0xf743, 0xf37b,
-	0xf1f4, 0xebd5, 0xe82b, 0xe712, 0xe3f6, 0xe2f5, 0xe38f, 0xe320,
-	0xe2d4, 0xe621, 0xe6ff, 0xe9c5, 0xf023, 0xf159, 0xf5c0, 0xf9e0,
-	0xfb45, 0xffea, 0x02c0, 0x05d5, 0x0a0c, 0x0bcd, 0x0f52, 0x105d,
-	0x114f, 0x13f7, 0x1523, 0x186e, 0x177f, 0x1ae5, 0x1cc0, 0x1878,
-	0x1ce8, 0x1ade, 0x14bb, 0x1435, 0x0d38, 0x050c, 0x022f, 0xfcca,
-	0xf64c, 0xf344, 0xef9c, 0xea41, 0xe80d, 0xe557, 0xe13f, 0xe215,
-	0xe14e, 0xe0a4, 0xe30e, 0xe4cc, 0xe760, 0xec01, 0xf081, 0xf288,
-	0xf601, 0xfa28, 0xfe1f, 0x0192, 0x04ec, 0x0888, 0x0a7e, 0x0cc9,
-	0x0f3b, 0x0f72, 0x1192, 0x137b, 0x141d, 0x159c, 0x14c1, 0x1908,
-	0x1a63, 0x190c, 0x1c36, 0x18aa, 0x1443, 0x1213, 0x0c07, 0x06db,
-	0x02e2, 0xfcff, 0xf71f, 0xf2c8, 0xef8a, 0xea0a, 0xe762, 0xe5fb,
-	0xe20e, 0xe25d, 0xe1c4, 0xdefe, 0xe24e, 0xe587, 0xe67a, 0xeacf,
-	0xef07, 0xf10e, 0xf428, 0xf9ea, 0xfcaa, 0xff5d, 0x0472, 0x06bc,
-	0x07c7, 0x0c2d, 0x0e1d, 0x0d43, 0x12c7, 0x12a7, 0x1258, 0x1664,
-	0x147c, 0x186f, 0x1c68, 0x1ad4, 0x1c0d, 0x1ad9, 0x1636, 0x12df,
-	0x0f31, 0x091c, 0x048f, 0x0023, 0xf919, 0xf3e0, 0xf00f, 0xea49,
-	0xe778, 0xe5a3, 0xe111, 0xe04b, 0xe019, 0xdece, 0xe205, 0xe44d,
-	0xe561, 0xe8bd, 0xed6d, 0xf0b2, 0xf3b3, 0xfa1e, 0xfda7, 0x007c,
-	0x05ee, 0x0799, 0x087a, 0x0cea, 0x0e26, 0x0ea4, 0x10db, 0x1246,
-	0x12c7, 0x146f, 0x1789, 0x1661, 0x19eb, 0x1b5d, 0x190c, 0x1add,
-	0x1875, 0x1445, 0x10d7, 0x0d6a, 0x0713, 0x011b, 0xfc84, 0xf4bc,
-	0xf0df, 0xee88, 0xe863, 0xe567, 0xe2ff, 0xe06e, 0xdfb3, 0xe0c2,
-	0xe25d, 0xe226, 0xe562, 0xe7c7, 0xea9e, 0xf155, 0xf38b, 0xf745,
-	0xfdc7, 0xffb7, 0x033b, 0x073b, 0x0934, 0x0be7, 0x0eb0, 0x0f5c,
-	0x0f21, 0x1167, 0x1403, 0x13bf, 0x16ed, 0x1840, 0x1687, 0x1a60,
-	0x1963, 0x18dc, 0x19e2, 0x162b, 0x1245, 0x0f25, 0x0a5c, 0x0257,
-	0xfe4b, 0xf8d9, 0xf203, 0xeea0, 0xe847, 0xe3b0, 0xe38c, 0xe2ba,
-	0xe180, 0xe1b3, 0xe268, 0xe2bd, 0xe484, 0xe814, 0xead3, 0xef29,
-	0xf4c2, 0xf7eb, 0xfb27, 0xff20, 0x01b5, 0x04ea, 0x0952, 0x0a5c,
-	0x0b8b, 0x0ed7, 0x0eb3, 0x0ff3, 0x131c, 0x13f7, 0x13fb, 0x15a2,
-	0x16b0, 0x1569, 0x1800, 0x1788, 0x15da, 0x1787, 0x12ac, 0x0e48,
-	0x0abd, 0x05a0, 0x0065, 0xfb59, 0xf642, 0xefa7, 0xec42, 0xe866,
-	0xe521, 0xe3d1, 0xe270, 0xe170, 0xe1a6, 0xe33f, 0xe3c0, 0xe68c,
-	0xeb00, 0xee1e, 0xf142, 0xf516, 0xf7a6, 0xfb80, 0x00fb, 0x0400,
-	0x06c2, 0x0946, 0x0b2e, 0x0d66, 0x0f9d, 0x10f7, 0x11ec, 0x1320,
-	0x133a, 0x13da, 0x1469, 0x150f, 0x1488, 0x14f5, 0x163c, 0x148f,
-	0x12e0, 0x100e, 0x0d1c, 0x0980, 0x041f, 0xfe2c, 0xf862, 0xf472,
-	0xf039, 0xed82, 0xeabc, 0xe7a4, 0xe590, 0xe464, 0xe3af, 0xe3ef,
-	0xe6dc, 0xe8ba, 0xebf1, 0xeeb2, 0xefbe, 0xf323, 0xf684, 0xf9f4,
-	0xfc84, 0xffe5, 0x0303, 0x0580, 0x0941, 0x0b6c, 0x0dbd, 0x0f17,
-	0x0f46, 0x0f9f, 0x1012, 0x10cc, 0x10ca, 0x128f, 0x12be, 0x10fa,
-	0x10a1, 0x0fab, 0x0f12, 0x0ea9, 0x0de5, 0x0a48, 0x06ba, 0x0423,
-	0xff89, 0xfbf7, 0xf88d, 0xf48e, 0xf1d5, 0xefd0, 0xed8a, 0xeb8e,
-	0xea49, 0xe9d1, 0xe9e0, 0xea76, 0xeb14, 0xebc7, 0xee27, 0xf0c2,
-	0xf232, 0xf52b, 0xf756, 0xf950, 0xfd89, 0x00e0, 0x0481, 0x0710,
-	0x0a0a, 0x0c5e, 0x0d33, 0x0ea0, 0x0ddf, 0x0e89, 0x0f15, 0x0d99,
-	0x0dcf, 0x0d6c, 0x0c6a, 0x0be4, 0x0c2d, 0x0af7, 0x0a42, 0x09c9,
-	0x0864, 0x0824, 0x0615, 0x042c, 0x01ec, 0xff3d, 0xfc39, 0xf8cf,
-	0xf68e, 0xf361, 0xf254, 0xf0ef, 0xef2a, 0xeeac, 0xed51, 0xed83,
-	0xeebc, 0xf029, 0xf0ca, 0xf155, 0xf3e9, 0xf6fd, 0xf937, 0xfc6c,
-	0x0071, 0x025a, 0x04cd, 0x07a1, 0x08db, 0x08b5, 0x08c6, 0x0bc6,
-	0x0c7b, 0x09a9, 0x07e7, 0x08ae, 0x094d, 0x072f, 0x06d3, 0x07d7,
-	0x065f, 0x0547, 0x04e1, 0x05f2, 0x0689, 0x04b6, 0x0655, 0x06d2,
-	0x04c5, 0x036f, 0x00cb, 0xffa3, 0xfc81, 0xf8cf, 0xf6c7, 0xf51f,
-	0xf53f, 0xf3a2, 0xf2b9, 0xf2a4, 0xf0d7, 0xf18e, 0xf394, 0xf4da,
-	0xf705, 0xf939, 0xfc80, 0xfe46, 0xfe95, 0x01b6, 0x0400, 0x056c,
-	0x0616, 0x052a, 0x055e, 0x0444, 0x0484, 0x057a, 0x0419, 0x03e0,
-	0x03ba, 0x03c9, 0x03c8, 0x0423, 0x048c, 0x03dc, 0x04d4, 0x0536,
-	0x04d4, 0x05da, 0x05e9, 0x05cd, 0x0619, 0x050b, 0x042b, 0x02dd,
-	0x0127, 0x0055, 0xfea0, 0xfc68, 0xf98c, 0xf868, 0xf83e, 0xf6a9,
-	0xf701, 0xf6fd, 0xf64a, 0xf6a6, 0xf7bf, 0xf899, 0xf94a, 0xfc28,
-	0xfe4f, 0x0048, 0x0269, 0x029a, 0x02ea, 0x03c7, 0x035d, 0x02d8,
-	0x030f, 0x01d7, 0x00a1, 0x0175, 0x0087, 0xfeaf, 0xff09, 0xfec1,
-	0xfeab, 0xff9a, 0x004a, 0x0120, 0x0106, 0x018d, 0x02d2, 0x02c6,
-	0x0363, 0x0337, 0x02ee, 0x03ac, 0x01e5, 0x00be, 0x0217, 0x01b6,
-	0x01b6, 0x01fd, 0x0068, 0xffed, 0xff8f, 0xfe3e, 0xfcde, 0xfd7e,
-	0xfe8c, 0xfe79, 0xff27, 0xff64, 0xfe4c, 0xfd04, 0xfca3, 0xfc4a,
-	0xfb2b, 0xfa65, 0xfaa2, 0xfa79, 0xfa55, 0xfa94, 0xfaee, 0xfac7,
-	0xf96e, 0xf837, 0xf89a, 0xfa19, 0xfb07, 0xfc59, 0xfe04, 0xfe8d,
-	0xff9d, 0x0106, 0x0141, 0x023e, 0x02a4, 0x0181, 0x0115, 0x01fa,
-	0x03cb, 0x05bc, 0x06c2, 0x07c4, 0x077b, 0x0637, 0x066e, 0x06af,
-	0x077d, 0x07c5, 0x074c, 0x066d, 0x0477, 0x020e, 0x0004, 0xfecc,
-	0xfc9c, 0xf948, 0xf76a, 0xf6e3, 0xf670, 0xf6dd, 0xf6d2, 0xf704,
-	0xf7a4, 0xf7fa, 0xf8b7, 0xfa3b, 0xfd3e, 0xfeab, 0xfe84, 0xfe69,
-	0xff71, 0xffd6, 0xfec1, 0xff48, 0xfe1b, 0xfb3b, 0xfa3d, 0xf99b,
-	0xf9d4, 0xfc97, 0xfe75, 0xffe8, 0x01c1, 0x019b, 0x01dd, 0x037f,
-	0x06c4, 0x08b2, 0x0916, 0x0ad4, 0x0ac8, 0x0a6f, 0x0a67, 0x08b7,
-	0x0734, 0x05a0, 0x0334, 0x006d, 0xff0f, 0xfef4, 0xfdee, 0xfd58,
-	0xfd38, 0xfc04, 0xfaab, 0xfab9, 0xfba9, 0xfbdd, 0xfb1b, 0xfaa9,
-	0xfb53, 0xfbbc, 0xfb7f, 0xfc75, 0xfc19, 0xf96f, 0xf927, 0xf867,
-	0xf744, 0xf8ed, 0xf9f2, 0xfa81, 0xfc8f, 0xfd66, 0xfcba, 0xfde4,
-	0x0066, 0x0270, 0x04da, 0x0728, 0x07e7, 0x08e4, 0x0925, 0x084c,
-	0x07e9, 0x064f, 0x049c, 0x0290, 0x0148, 0x00f0, 0xff91, 0xffab,
-	0xffe7, 0xff91, 0xfff9, 0xfee1, 0xfe60, 0xffeb, 0xff8d, 0xfed8,
-	0x0047, 0x0021, 0xfe54, 0xfe08, 0xfd9f, 0xfbff, 0xfa68, 0xf8bb,
-	0xf7ca, 0xf8d2, 0xfa77, 0xfb58, 0xfe49, 0x00eb, 0x002b, 0x0090,
-	0x01da, 0x0345, 0x056b, 0x069f, 0x072f, 0x082b, 0x0705, 0x056c,
-	0x05fb, 0x046b, 0x02a8, 0x01c1, 0xffb4, 0xfe6b, 0xfef6, 0xff2d,
-	0xff05, 0x0070, 0x005f, 0xfe78, 0xfd2e, 0xfcf8, 0xfa84, 0xf835,
-	0xfd15, 0xfe12, 0xfab7, 0xfe32, 0xfe4a, 0xfb9c, 0xfd75, 0xfb22,
-	0xf6eb, 0xf7f0, 0xf861, 0xf766, 0xfa82, 0xfd54, 0xfc59, 0xfbdc,
-	0xfcaa, 0xfcdf, 0xff7f, 0x02d0, 0x02e4, 0x0393, 0x0522, 0x04ce,
-	0x042f, 0x0601, 0x0669, 0x03ae, 0x02d7, 0x0216, 0x00cc, 0x01c7,
-	0x0327, 0x0486, 0x05ce, 0x053d, 0x03a7, 0x035f, 0x0373, 0x015b,
-	0x003c, 0xff52, 0xfc86, 0xfbb0, 0xfb6e, 0xf9a1, 0xf856, 0xf689,
-	0xf301, 0xf15e, 0xf270, 0xf356, 0xf44d, 0xf768, 0xf99d, 0xfa24,
-	0xfaef, 0xfc2e, 0xfedf, 0xffe2, 0x0098, 0x02d7, 0x02f1, 0x02c4,
-	0x03da, 0x0513, 0x05e9, 0x058a, 0x048c, 0x03e7, 0x02df, 0x01d6,
-	0x014e, 0x01ee, 0x036a, 0x0324, 0x01b3, 0x01f3, 0x0252, 0x010e,
-	0x0146, 0x0215, 0x00c2, 0x01ef, 0x03a3, 0x01de, 0x020b, 0x02be,
-	0xffec, 0xfe01, 0xfd86, 0xfb78, 0xfa04, 0xfabb, 0xfba7, 0xfbe3,
-	0xfb33, 0xfbb1, 0xfd18, 0xfe61, 0x00f8, 0x0340, 0x0433, 0x04d0,
-	0x0541, 0x0506, 0x0560, 0x05fd, 0x04a7, 0x0335, 0x0277, 0x007e,
-	0xfec3, 0xfe6e, 0xfedd, 0xffbc, 0xff6e, 0xfe48, 0xfe2c, 0xfeb3,
-	0xff70, 0x0029, 0x00b8, 0x00e9, 0xffdb, 0xfeea, 0xff0f, 0xff1b,
-	0xfd93, 0xfc1d, 0xfbc8, 0xfa91, 0xf9f4, 0xfafa, 0xfcfa, 0xfec8,
-	0xfe04, 0xfcd8, 0xfd72, 0xfdfc, 0xff8a, 0x018e, 0x024f, 0x031a,
-	0x02fe, 0x01ef, 0x0316, 0x04eb, 0x0473, 0x0318, 0x029f, 0x014b,
-	0x0016, 0x0021, 0x0112, 0x029c, 0x0178, 0xffde, 0x00b6, 0x003c,
-	0xff5f, 0x00ef, 0x019f, 0x00ec, 0x015b, 0x00ac, 0xff76, 0xffe1,
-	0xfe23, 0xfb1b, 0xf956, 0xf720, 0xf5ae, 0xf57a, 0xf5af, 0xf783,
-	0xf7b3, 0xf5ea, 0xf68e, 0xf872, 0xfa09, 0xfbc4, 0xfdfb, 0x008f,
-	0x015c, 0x0158, 0x029d, 0x0375, 0x028e, 0x00e3, 0x004e, 0xffa0,
-	0xfe08, 0xfd95, 0xff43, 0x0174, 0x0359, 0x0518, 0x060c, 0x06f8,
-	0x0834, 0x08a1, 0x0826, 0x07dd, 0x0785, 0x0621, 0x04b4, 0x03cb,
-	0x01ba, 0xfe53, 0xfb9f, 0xfa48, 0xf8b2, 0xf667, 0xf63e, 0xf843,
-	0xf8b4, 0xf7ee, 0xf884, 0xf976, 0xf9ac, 0xfa68, 0xfb84, 0xfcec,
-	0xfdc5, 0xfe3f, 0xff78, 0x00e6, 0x014c, 0x01b0, 0x022c, 0x01d9,
-	0x0164, 0x006a, 0xff9f, 0x00f1, 0x029c, 0x0314, 0x03a3, 0x03df,
-	0x033d, 0x0319, 0x0307, 0x03d2, 0x0512, 0x051b, 0x0532, 0x0549,
-	0x0417, 0x02da, 0x01ae, 0xfffd, 0xfe52, 0xfb8e, 0xf974, 0xf9e6,
-	0xfa8d, 0xfa77, 0xfa9d, 0xfa34, 0xfa0f, 0xfb19, 0xfca8, 0xff23,
-	0x0147, 0x01c1, 0x021a, 0x0322, 0x0366, 0x0342, 0x03ac, 0x0349,
-	0x01bc, 0xffd6, 0xfe02, 0xfde6, 0xff92, 0x0032, 0x0077, 0x00a6,
-	0xffc1, 0xff6d, 0x002f, 0x00ed, 0x0186, 0x0197, 0x00fb, 0x001c,
-	0xff7c, 0xff9b, 0xfed8, 0xfd7f, 0xfcf2, 0xfb68, 0xfa1d, 0xfb3b,
-	0xfc43, 0xfc57, 0xfc8c, 0xfc02, 0xfb7a, 0xfbef, 0xfd34, 0xff1a,
-	0x002d, 0x0014, 0x0041, 0x00fe, 0x021a, 0x0319, 0x0340, 0x02ca,
-	0x01df, 0xffca, 0xfdc1, 0xfe24, 0xff23, 0xfefb, 0xff8f, 0xff87,
-	0xfe58, 0xff36, 0x008e, 0x00c6, 0x01b9, 0x02e7, 0x03e6, 0x04d0,
-	0x056d, 0x05eb, 0x04b8, 0x0347, 0x0225, 0xffc5, 0xfd92, 0xfca0,
-	0xfbf7, 0xfb79, 0xfa98, 0xf93d, 0xf891, 0xf8f4, 0xf9b7, 0xfa94,
-	0xfc49, 0xfcc1, 0xfc59, 0xfd6e, 0xfe48, 0xfe81, 0xfe64, 0xfd15,
-	0xfc7b, 0xfbf9, 0xfae9, 0xfb76, 0xfb61, 0xfb88, 0xff04, 0x00f6,
-	0x0047, 0x012f, 0x02c1, 0x0258, 0x026b, 0x0410, 0x04f9, 0x04fe,
-	0x052a, 0x0540, 0x049c, 0x0354, 0x024c, 0x01b9, 0x004e, 0xfebb,
-	0xfe36, 0xfe82, 0xfeb5, 0xfe21, 0xfdd5, 0xfddc, 0xfd0a, 0xfc4c,
-	0xfd1e, 0xfda3, 0xfd93, 0xfea7, 0xff71, 0xff4b, 0xffe7, 0x000b,
-	0x000e, 0x0023, 0xfe0e, 0xfbc8, 0xfad0, 0xfa87, 0xfb83, 0xfc73,
-	0xfcfd, 0xfde1, 0xfd99, 0xfd5a, 0xfe85, 0xfff2, 0x0111, 0x0220,
-	0x037d, 0x042b, 0x0477, 0x04b6, 0x0402, 0x0319, 0x0129, 0xfef5,
-	0xfe2e, 0xfd51, 0xfd8f, 0xfeb3, 0xfd6d, 0xfc6b, 0xfc97, 0xfcc1,
-	0xfe60, 0xfffc, 0x0147, 0x0252, 0x0282, 0x0306, 0x0397, 0x03ac,
-	0x03dc, 0x0369, 0x0190, 0xfe2e, 0xfc5f, 0xfcf4, 0xfcf5, 0xfdac,
-	0xfecf, 0xfe2d, 0xfde2, 0xfe41, 0xfe87, 0xff22, 0xffb6, 0x0013,
-	0x0038, 0x00c0, 0x01f8, 0x0263, 0x0274, 0x01ca, 0x0087, 0x0005,
-	0xff16, 0xfe5a, 0xff7a, 0xffab, 0xfee3, 0xfee4, 0xfdfe, 0xfd51,
-	0xfeab, 0x0013, 0x001b, 0xff9e, 0xffb2, 0x00e0, 0x020d, 0x02d9,
-	0x0383, 0x035e, 0x01fa, 0xffd8, 0xfdd0, 0xfc22, 0xfb74, 0xfb4d,
-	0xfa9a, 0xfb28, 0xfc7d, 0xfca4, 0xfd71, 0xfea7, 0xffa4, 0x0178,
-	0x0297, 0x03e3, 0x05cf, 0x0606, 0x05df, 0x05b6, 0x0481, 0x02c8,
-	0x00ba, 0xffa1, 0xff86, 0xfe74, 0xfd7f, 0xfd4f, 0xfd05, 0xfc7d,
-	0xfc6a, 0xfd13, 0xfd7f, 0xfd9f, 0xfd84, 0xfe3b, 0xffec, 0xff67,
-	0xfdfa, 0xfedf, 0xff01, 0xfcf4, 0xfad5, 0xf9aa, 0xf9f9, 0xfad6,
-	0xfbcd, 0xfd93, 0xff3c, 0x003a, 0x0040, 0xffe9, 0x0118, 0x00dc,
-	0xfde7, 0x0093, 0x07d8, 0x081e, 0x04aa, 0x0464, 0x02cd, 0x015f,
-	0x02e2, 0x023f, 0xffc7, 0xfe27, 0xfd00, 0xfd8f, 0xfea5, 0xfdbf,
-	0xfca4, 0xfcc2, 0xfc5a, 0xfc3f, 0xfc65, 0xf956, 0xf7ae, 0xfab4,
-	0xfef9, 0x02f5, 0x0366, 0x00e1, 0xff71, 0xfda2, 0xfda3, 0xfed6,
-	0xfe63, 0xff21, 0xffd0, 0xffa5, 0xffde, 0xff9e, 0x011e, 0x0284,
-	0x0216, 0x0260, 0x031d, 0x0410, 0x033e, 0x01cc, 0x030e, 0x0320,
-	0x00af, 0xfdc3, 0xfbda, 0xfcfa, 0xfcfd, 0xfc65, 0xfd97, 0xfce3,
-	0xfc47, 0xfd98, 0xff3f, 0x0106, 0x00f8, 0xffc9, 0xffc3, 0xffc6,
-	0x0048, 0x01b2, 0x014a, 0x0063, 0x0011, 0xfd51, 0xfb13, 0xfb76,
-	0xfa6c, 0xfb44, 0xfdb3, 0xfdaf, 0xfde9, 0xfe3b, 0xfe33, 0xff2e,
-	0xff65, 0xffef, 0x00e0, 0x015a, 0x019e, 0x014e, 0x023c, 0x02ad,
-	0x01a9, 0x00d4, 0xfef1, 0xfed1, 0xff4f, 0xfd88, 0xfe00, 0xfc01,
-	0xf5ea, 0xf72f, 0xfc91, 0x0087, 0x031e, 0x027e, 0x01ae, 0x01a6,
-	0x032b, 0x063b, 0x0639, 0x0504, 0x023a, 0xfe93, 0xfc79, 0xf670,
-	0xf5c2, 0xfa2d, 0xf8ea, 0xfb7b, 0xff25, 0xfde1, 0xfdb5, 0xfda7,
-	0x004e, 0x01d8, 0x0033, 0x0172, 0x0079, 0x0336, 0x067e, 0x03d8,
-	0x085d, 0x0a82, 0x0565, 0x05d5, 0x0361, 0xfe2a, 0xfaf0, 0xf6f7,
-	0xf80f, 0xf87e, 0xf7c8, 0xfa5d, 0xfb39, 0xfe1a, 0x01dd, 0x0361,
-	0x088a, 0x09d1, 0x072b, 0x078b, 0x05d5, 0x04fb, 0x02ff, 0xfceb,
-	0xfa8e, 0xf932, 0xf860, 0xfb97, 0xfc55, 0xfcd8, 0xfceb, 0xfbcc,
-	0xfea3, 0xff69, 0xffce, 0x02e4, 0x03a4, 0x058c, 0x0684, 0x0449,
-	0x052d, 0x03de, 0x0242, 0x0348, 0xff81, 0xfc9b, 0xfd87, 0xfc87,
-	0xfb9a, 0xfbfe, 0xfcb4, 0xfcb3, 0xfb38, 0xfd1d, 0xfda8, 0xfac9,
-	0xfbc3, 0xfd97, 0xfee2, 0x0060, 0x003d, 0x0176, 0x0127, 0xff83,
-	0xff63, 0xfc50, 0xfd4f, 0xfebc, 0xfbf4, 0xfca3, 0xfabf, 0xfa53,
-	0xfccb, 0xfac6, 0xfe4b, 0x012e, 0xff59, 0x0288, 0x008e, 0x00e9,
-	0x05fa, 0x03a6, 0x022f, 0x025b, 0x0045, 0xfccc, 0xf99e, 0xfca7,
-	0xfd42, 0xf9bd, 0xfbe3, 0xfe72, 0x0066, 0x0034, 0xfe96, 0x0073,
-	0x013b, 0x00ab, 0x019c, 0x032e, 0x03f9, 0x01c5, 0x00b5, 0x0312,
-	0x013b, 0xfd00, 0xfd3d, 0xff8c, 0xff0f, 0xfebf, 0xfed9, 0xfdfb,
-	0xfed6, 0xfef8, 0xfdbf, 0xfd09, 0xfca5, 0xfe3e, 0xff54, 0xfe46,
-	0x005e, 0x0127, 0x0093, 0x03ac, 0x0300, 0x0031, 0x00ff, 0xffe2,
-	0xff14, 0x0013, 0xfec9, 0xffa6, 0xfed9, 0xfdbd, 0xff64, 0xfe99,
-	0xff95, 0x01e0, 0x0278, 0x0450, 0x0470, 0x0558, 0x0730, 0x041b,
-	0x00b6, 0xfe8c, 0xfe5e, 0xfc4d, 0xf92e, 0xfb4c, 0xfb03, 0xf8f3,
-	0xfa31, 0xfb17, 0xfdcb, 0xfe8a, 0xfe91, 0x01fb, 0x01fc, 0x02a8,
-	0x02d8, 0x0239, 0x04a1, 0x047b, 0x0482, 0x0269, 0xfe59, 0xff01,
-	0xfc25, 0xfaf2, 0xff09, 0xfda8, 0xfd87, 0xfda6, 0xfe05, 0x0001,
-	0xfc95, 0xfdd6, 0x0163, 0x0018, 0x00fd, 0xff1b, 0x002c, 0x041e,
-	0xfe97, 0xfe24, 0xffba, 0xfc49, 0xfca2, 0xfbc2, 0xfdaf, 0x00ab,
-	0xfe5f, 0x0016, 0x0081, 0x00f2, 0x02a6, 0xff95, 0x02df, 0x02a0,
-	0xfe9c, 0x02f7, 0x0428, 0x0440, 0x03bd, 0x016e, 0x02c2, 0xfe14,
-	0xfd29, 0x006b, 0xfd1f, 0xff6f, 0xfe1a, 0xfb77, 0xff77, 0xfd81,
-	0xfd70, 0xfd4c, 0xfc1b, 0x003c, 0xfe54, 0x00c3, 0x052a, 0x0189,
-	0x03f9, 0x03da, 0x02f7, 0x0353, 0xfcbd, 0xffa1, 0x01ec, 0xfcde,
-	0xfe6c, 0xfc90, 0xfca6, 0xff8e, 0xfbfc, 0xff5a, 0x01a9, 0x004b,
-	0x022e, 0xfe57, 0x00af, 0x0433, 0xfeef, 0x019f, 0x0364, 0xff55,
-	0xfd2b, 0xf9da, 0xfe6a, 0xfd8a, 0xf83c, 0xffb4, 0xff79, 0xfe05,
-	0x0059, 0xfbb4, 0x0044, 0x00c3, 0xfdd7, 0x066a, 0x03c1, 0x01df,
-	0x03f9, 0x0124, 0x061c, 0x0243, 0xfe71, 0x0240, 0xfc64, 0xfd6d,
-	0xfdcc, 0xfacc, 0x0031, 0xfbbf, 0xfbfd, 0xfed5, 0xfa18, 0xff36,
-	0xfe1b, 0xfd55, 0x03a2, 0xfea7, 0x01e8, 0x0570, 0x0127, 0x03eb,
-	0xfdfc, 0xfbcf, 0x001a, 0xfad9, 0xfc72, 0xfed9, 0xfd83, 0x00e3,
-	0xfeac, 0xfead, 0xff29, 0xfddf, 0x0246, 0x0164, 0x0131, 0x02dc,
-	0x00b1, 0x0380, 0x0242, 0xff15, 0xffe4, 0xfbb2, 0xfbcc, 0xfbcf,
-	0xf9ac, 0xfdd3, 0xfb21, 0xf87c, 0xfe3d, 0xfef8, 0xfd88, 0xffc4,
-	0x0430, 0x0581, 0x015f, 0x0183, 0x0512, 0x06c1, 0x0608, 0x025b,
-	0x01fa, 0x00fa, 0xfc70, 0xfb2a, 0xfd28, 0xfec8, 0xfd13, 0xfb63,
-	0xfd44, 0xfeeb, 0xfe4b, 0xfccb, 0xfe11, 0x0214, 0xffda, 0xfcc3,
-	0xff45, 0x01f4, 0x00eb, 0xfd7d, 0xfc44, 0xfd5e, 0xfc4e, 0xf9ae,
-	0xfa8a, 0xfd10, 0xfe29, 0xfc3c, 0xfc0f, 0xff22, 0x005e, 0xff0e,
-	0x0016, 0x0187, 0x0136, 0x002d, 0xfef7, 0x01b0, 0x052c, 0x042d,
-	0x0160, 0x0151, 0x001d, 0xfd7e, 0xfcc9, 0xfd7f, 0xfde1, 0xfde9,
-	0xfc28, 0xfba6, 0xfd12, 0xfb45, 0xfb8b, 0xfe85, 0xfe47, 0xff3b,
-	0x0174, 0x00ed, 0x02b1, 0x0430, 0x0235, 0x01b0, 0x0146, 0xfe27,
-	0xfd30, 0xfeaa, 0xfe3d, 0xfe90, 0xff43, 0xfed4, 0xfe80, 0xfded,
-	0xffe4, 0x0147, 0x0036, 0x0080, 0x003c, 0x00f3, 0x01ff, 0x015b,
-	0x0251, 0x01c8, 0xff7d, 0xfe6a, 0xfcd4, 0xfd1b, 0xfe98, 0xff51,
-	0x0008, 0xff8d, 0xff84, 0x00dd, 0x012a, 0x02c5, 0x0499, 0x0458,
-	0x0447, 0x02d0, 0x02ee, 0x04c5, 0x03dd, 0x02f8, 0x017a, 0xff9f,
-	0xfe79, 0xfc08, 0xfc0d, 0xfcc2, 0xfba9, 0xfb59, 0xfa3b, 0xf97e,
-	0xf95d, 0xf972, 0xfbc2, 0xfc92, 0xfb97, 0xfc05, 0xfdf2, 0x00ce,
-	0x0210, 0x0180, 0x02e3, 0x0202, 0xff5c, 0x00c1, 0x01ae, 0x033b,
-	0x04ff, 0x0424, 0x0495, 0x03ce, 0x03f5, 0x060d, 0x0517, 0x06f8,
-	0x093d, 0x0696, 0x0651, 0x079e, 0x070d, 0x05d4, 0x01b6, 0xfe51,
-	0xfd1e, 0xf953, 0xf5db, 0xf3b0, 0xf1bd, 0xf1e2, 0xf074, 0xef8f,
-	0xf0b1, 0xf0b4, 0xf159, 0xf31a, 0xf58a, 0xf64f, 0xf7ab, 0xfc75,
-	0xfe1b, 0xffb2, 0x019d, 0xfe9d, 0x016b, 0x053c, 0x0345, 0x0644,
-	0x0927, 0x0921, 0x0cea, 0x0cdb, 0x0d94, 0x13c6, 0x1111, 0x0f6c,
-	0x13cf, 0x1298, 0x1053, 0x0d1f, 0x0b2e, 0x0ba2, 0x05fe, 0xfefb,
-	0xfa97, 0xf61b, 0xf2b0, 0xece6, 0xe83b, 0xe91e, 0xe8ef, 0xe745,
-	0xe7ed, 0xe9eb, 0xecaa, 0xee8a, 0xf042, 0xf3d1, 0xf6d6, 0xfab8,
-	0xfc36, 0xfca5, 0xffc8, 0xfe63, 0xfcb6, 0xfd29, 0xfc7e, 0xfeae,
-	0xfff9, 0x006d, 0x05a6, 0x083b, 0x0a48, 0x0fe3, 0x12de, 0x175b,
-	0x1c6b, 0x1d9e, 0x1f33, 0x1f28, 0x1c98, 0x1bf8, 0x189d, 0x1233,
-	0x0aca, 0x02c2, 0xfbda, 0xf2fc, 0xebf7, 0xe95e, 0xe5ec, 0xe445,
-	0xe395, 0xe27b, 0xe660, 0xe941, 0xeb9e, 0xf048, 0xf381, 0xf772,
-	0xfb24, 0xfc7e, 0xfed6, 0x003d, 0xfe99, 0xfe49, 0xfcc7, 0xfbcf,
-	0xfccb, 0xfcf9, 0xff7c, 0x0030, 0x00fd, 0x0522, 0x0667, 0x0a19,
-	0x0fa4, 0x11f1, 0x14b2, 0x167b, 0x191f, 0x1c19, 0x1a32, 0x19e3,
-	0x1a03, 0x1497, 0x1075, 0x0aeb, 0x03f7, 0x00e6, 0xfa46, 0xf29d,
-	0xef3d, 0xeaf1, 0xe7e3, 0xe4ef, 0xe342, 0xe541, 0xe457, 0xe652,
-	0xe9bd, 0xeca3, 0xf2e8, 0xf49b, 0xf531, 0xf90f, 0xfa6f, 0xfbf1,
-	0xfdb6, 0xfdeb, 0x00a5, 0x013d, 0xff1b, 0x00d8, 0x0235, 0x0371,
-	0x0592, 0x04e9, 0x078e, 0x0a9b, 0x0c67, 0x0f5c, 0x110e, 0x1441,
-	0x15d0, 0x1405, 0x1263, 0x11bb, 0x1027, 0x0e6a, 0x0ca0, 0x08af,
-	0x0554, 0x016f, 0xfbc3, 0xf760, 0xf358, 0xf056, 0xeea2, 0xeb92,
-	0xea6b, 0xec2d, 0xec8c, 0xec89, 0xecb9, 0xec94, 0xef56, 0xf0e0,
-	0xf0d0, 0xf3ad, 0xf6b7, 0xfa3c, 0xfc5e, 0xfd5c, 0x00c7, 0x02cc,
-	0x040b, 0x057c, 0x0523, 0x06d9, 0x0880, 0x0803, 0x09d4, 0x0bd8,
-	0x0cae, 0x0d77, 0x0df6, 0x0ed3, 0x0e72, 0x0e12, 0x0e5e, 0x0e32,
-	0x0f85, 0x0fc6, 0x0e95, 0x0cad, 0x08c9, 0x05c8, 0x0242, 0xfd7a,
-	0xfa2b, 0xf62e, 0xf340, 0xf342, 0xefb5, 0xed1d, 0xeca7, 0xe9a1,
-	0xe804, 0xe721, 0xe7c7, 0xea8a, 0xec71, 0xeefd, 0xf266, 0xf448,
-	0xf730, 0xfb46, 0xfe4f, 0x0197, 0x03d2, 0x05c4, 0x0861, 0x0b21,
-	0x0df7, 0x0e8e, 0x0e28, 0x0db3, 0x0b33, 0x0885, 0x09d4, 0x0c01,
-	0x0aff, 0x0ba9, 0x0bed, 0x0b8d, 0x0c71, 0x0c35, 0x0d28, 0x0dae,
-	0x0b02, 0x077f, 0x0550, 0x02c6, 0xfff7, 0xfc14, 0xf5f5, 0xf288,
-	0xeef1, 0xea73, 0xe786, 0xe607, 0xe69d, 0xe813, 0xea15, 0xeaa7,
-	0xed5b, 0xf1fa, 0xf4b6, 0xf739, 0xf860, 0xfa52, 0xfddf, 0x0151,
-	0x0500, 0x0822, 0x0a48, 0x0af6, 0x0a46, 0x0955, 0x0863, 0x0740,
-	0x0753, 0x07ed, 0x086b, 0x0907, 0x0821, 0x0871, 0x097b, 0x09b2,
-	0x0bf5, 0x0baf, 0x0a68, 0x0c52, 0x0c3c, 0x0c33, 0x0a1a, 0x047f,
-	0x0123, 0xfc75, 0xf6ab, 0xf41c, 0xf06f, 0xee6e, 0xeea4, 0xeafd,
-	0xea62, 0xeccf, 0xed02, 0xefaf, 0xf231, 0xf2b2, 0xf61e, 0xf9ce,
-	0xfca1, 0x004f, 0x026a, 0x0553, 0x07c4, 0x0532, 0x03a1, 0x0440,
-	0x0384, 0x02df, 0x023e, 0x0219, 0x033e, 0x0311, 0x02ac, 0x044a,
-	0x060f, 0x09b1, 0x0bba, 0x0c95, 0x0ffb, 0x109a, 0x10aa, 0x1069,
-	0x0e36, 0x0df5, 0x0b9e, 0x0779, 0x0439, 0xfff7, 0xfeae, 0xfd9f,
-	0xf899, 0xf5c0, 0xf3ad, 0xf181, 0xf171, 0xed70, 0xeb6a, 0xed2d,
-	0xedc0, 0xf160, 0xf37f, 0xf621, 0xfa75, 0xf9e5, 0xfaf4, 0xfe0f,
-	0xfdca, 0x0044, 0x030f, 0x047c, 0x06f6, 0x0558, 0x042c, 0x043e,
-	0x03ab, 0x063c, 0x06aa, 0x04bc, 0x05b4, 0x0797, 0x08f1, 0x0a0e,
-	0x0b11, 0x0b7c, 0x08a0, 0x0701, 0x0710, 0x055f, 0x0671, 0x07c9,
-	0x07b4, 0x0714, 0x03c4, 0x0198, 0x0026, 0xfc6f, 0xf9ab, 0xf65b,
-	0xf336, 0xf4f4, 0xf58d, 0xf4bb, 0xf556, 0xf4c0, 0xf371, 0xf205,
-	0xf1ec, 0xf56f, 0xf8a8, 0xf99b, 0xfbc1, 0xfd65, 0xfdfd, 0xffbb,
-	0x00b3, 0x00cc, 0x0099, 0x0068, 0x01d7, 0x0352, 0x038d, 0x0424,
-	0x0589, 0x05da, 0x0592, 0x07b6, 0x094f, 0x099d, 0x0b34, 0x0da4,
-	0x1070, 0x1307, 0x11da, 0x0eb0, 0x0e04, 0x0b94, 0x090f, 0x043d,
-	0xfc9b, 0xfa88, 0xf83a, 0xf2f2, 0xf1d6, 0xf2aa, 0xf23e, 0xf30c,
-	0xf1ef, 0xf07a, 0xf238, 0xf360, 0xf438, 0xf4ae, 0xf40f, 0xf51a,
-	0xf761, 0xf875, 0xf92a, 0xfae8, 0xfbc7, 0xfb98, 0xfd15, 0xff68,
-	0x028d, 0x0401, 0x039a, 0x03c3, 0x041b, 0x060e, 0x0575, 0x031a,
-	0x053b, 0x091f, 0x0c98, 0x1186, 0x1364, 0x1546, 0x1878, 0x1367,
-	0x11b7, 0x13ef, 0x1082, 0x0e37, 0x09f8, 0x02c8, 0xfe23, 0xf837,
-	0xefb5, 0xea0b, 0xe3f2, 0xe09c, 0xe223, 0xe200, 0xe391, 0xe6c0,
-	0xe995, 0xeeb4, 0xf40c, 0xf855, 0xfc51, 0x00c4, 0x03ea, 0x04c5,
-	0x03cf, 0x0362, 0x03ab, 0x002c, 0xfcee, 0xfa1c, 0xf7a3, 0xf920,
-	0xfae2, 0xfeb1, 0x0324, 0x04e9, 0x0898, 0x0f0d, 0x1347, 0x179c,
-	0x1aef, 0x1b42, 0x1d25, 0x19ff, 0x1702, 0x162a, 0x0f8b, 0x0894,
-	0x0105, 0xf894, 0xf4ed, 0xf11c, 0xe93a, 0xe4e5, 0xe4b6, 0xe5cc,
-	0xe5c9, 0xe4eb, 0xea28, 0xf06d, 0xf364, 0xf79c, 0xfaf3, 0xfc7a,
-	0xfe12, 0xfeed, 0xfec2, 0xfcf6, 0xfa5a, 0xf936, 0xf776, 0xf2db,
-	0xf29a, 0xf657, 0xf7a5, 0xfab7, 0x0032, 0x05fe, 0x0b76, 0x0f03,
-	0x1032, 0x13a3, 0x1850, 0x19c1, 0x1c0a, 0x1f13, 0x1efb, 0x1c67,
-	0x194d, 0x1347, 0x0e7c, 0x0b25, 0x0244, 0xfabe, 0xf59b, 0xeef9,
-	0xeba8, 0xe91e, 0xe624, 0xe79f, 0xe729, 0xe57a, 0xe80f, 0xeb39,
-	0xf0f8, 0xf74d, 0xf8c2, 0xf8af, 0xfa3d, 0xfd4d, 0xfe8d, 0xfad8,
-	0xf82e, 0xf7c4, 0xf83d, 0xfb71, 0xfc75, 0xfc14, 0xfdf2, 0xff6d,
-	0xff5d, 0x00ae, 0x03da, 0x0881, 0x0c0f, 0x0e81, 0x1420, 0x1a38,
-	0x1cc6, 0x1e7a, 0x2118, 0x1edd, 0x18ad, 0x13e4, 0x10a4, 0x0b81,
-	0x0428, 0xfce3, 0xf63c, 0xf108, 0xed67, 0xec8f, 0xeafb, 0xe817,
-	0xe8c1, 0xed00, 0xefee, 0xf266, 0xf59d, 0xf689, 0xf875, 0xf95c,
-	0xf7dc, 0xf704, 0xf5f9, 0xf54c, 0xf5b6, 0xf5f8, 0xf6fc, 0xfa3c,
-	0xfb02, 0xf9aa, 0xfb66, 0xff06, 0x017d, 0x03aa, 0x0595, 0x07c2,
-	0x0bf1, 0x0e46, 0x0f69, 0x1254, 0x11ea, 0x1084, 0x1132, 0x0f9f,
-	0x0f1e, 0x0f73, 0x0b8a, 0x07e9, 0x0803, 0x078d, 0x048b, 0x00e1,
-	0xfd85, 0xfbca, 0xf9e3, 0xf7f7, 0xf71f, 0xf629, 0xf3fa, 0xf22a,
-	0xf1cb, 0xee9c, 0xee25, 0xf254, 0xf3f9, 0xf388, 0xf4fc, 0xf6c8,
-	0xf734, 0xf936, 0xfa10, 0xf8c0, 0xf741, 0xf80d, 0xfc05, 0xfed3,
-	0xff7a, 0xff15, 0xff2e, 0x00b1, 0x0476, 0x07a6, 0x07ed, 0x07c6,
-	0x07c0, 0x0a5e, 0x0dd3, 0x0e2b, 0x0e45, 0x0de8, 0x0d9e, 0x0efb,
-	0x0ec1, 0x0cde, 0x0b6f, 0x0a2f, 0x0717, 0x0347, 0x003d, 0xfd62,
-	0xf81e, 0xf4bc, 0xf4ea, 0xf333, 0xf27c, 0xf2eb, 0xf5f5, 0xf877,
-	0xf705, 0xf7c9, 0xf9fd, 0xfa77, 0xf992, 0xfaa4, 0xfc47, 0xfb44,
-	0xfac2, 0xfdcb, 0xff6d, 0xfd55, 0xfca1, 0xfcf7, 0xfdb3, 0xfdbe,
-	0xfd03, 0xfd95, 0xfe49, 0x0025, 0x0157, 0x02ae, 0x0407, 0x01dc,
-	0x021d, 0x0304, 0x023c, 0x05a2, 0x0835, 0x0755, 0x0790, 0x088b,
-	0x0a1a, 0x0a32, 0x06e3, 0x0504, 0x0569, 0x05e9, 0x0708, 0x04c1,
-	0x00c7, 0xff1b, 0xfecf, 0xfcb9, 0xf8b4, 0xf81f, 0xf724, 0xf66d,
-	0xf980, 0xfa65, 0xfac6, 0xfd8e, 0xffc2, 0xffd9, 0xff18, 0xfdce,
-	0xfeac, 0xff1a, 0xfd13, 0xfbea, 0xf95a, 0xf5e0, 0xf578, 0xf76f,
-	0xf78b, 0xf74c, 0xf930, 0xfab7, 0xfde3, 0x02bc, 0x04df, 0x0550,
-	0x05b4, 0x049c, 0x04d2, 0x04b9, 0x0125, 0xff39, 0x0116, 0x0204,
-	0x0090, 0x000b, 0x01d3, 0x0497, 0x0569, 0x038d, 0x0268, 0x034e,
-	0x0227, 0x01b4, 0x05d9, 0x060c, 0x01c7, 0xff86, 0xfea5, 0xff2b,
-	0xfe4b, 0xfaa1, 0xf7cd, 0xf71f, 0xf70a, 0xf6a2, 0xf84c, 0xfa0c,
-	0xf7bb, 0xf6be, 0xfac9, 0xfd90, 0xfdc0, 0xfe59, 0x0128, 0x020e,
-	0x001b, 0x0046, 0xfdbf, 0xfa42, 0xfb46, 0xfa6a, 0xf966, 0xfa91,
-	0xfb8f, 0xfe70, 0xfceb, 0xfcc3, 0x01f0, 0x01c7, 0x00fc, 0x0077,
-	0x0141, 0x05ef, 0x03e1, 0x006f, 0x043e, 0x0442, 0x0329, 0x05d9,
-	0x05c0, 0x0408, 0x01cf, 0x01fe, 0x0252, 0x01a6, 0x0317, 0x0135,
-	0xfed7, 0xff3c, 0x00c8, 0x023a, 0x00cb, 0xfff1, 0xff08, 0xfdbb,
-	0xfef2, 0xfe13, 0xfaaf, 0xf94b, 0xfa3c, 0xfb12, 0xf86f, 0xf817,
-	0xfc6c, 0xfdb9, 0x0070, 0x01aa, 0xff02, 0x00f2, 0x01e1, 0x0132,
-	0x01fa, 0x000d, 0xff30, 0x0115, 0x0117, 0xff92, 0x00c6, 0x0370,
-	0x00db, 0x000a, 0x01d1, 0xffbe, 0x0124, 0x0409, 0x039e, 0x0195,
-	0xfdb9, 0xfdd7, 0xff21, 0xfb57, 0xfb18, 0xfb8a, 0xfc27, 0xfe3e,
-	0xfb0c, 0xfcd9, 0x0064, 0x004b, 0x01bd, 0xfe79, 0xfbf9, 0x00b0,
-	0x0272, 0x04ac, 0x094a, 0x04e8, 0x0035, 0x02c9, 0x035c, 0x0177,
-	0x010c, 0xffc5, 0xfd51, 0xfc97, 0xff31, 0x038b, 0x0535, 0x0482,
-	0x02ff, 0x0241, 0x057f, 0x0662, 0x01c9, 0x003c, 0x00d5, 0xfede,
-	0xfb81, 0xf888, 0xfbf8, 0xfeb9, 0xf95f, 0xf8fb, 0xfc22, 0xfcb6,
-	0x001c, 0x0116, 0xfff9, 0xfffb, 0xff4d, 0x0021, 0xff7e, 0xfe5d,
-	0xfdb2, 0xfa46, 0xf8f9, 0xfba0, 0xfe91, 0x006e, 0xffda, 0xfe1a,
-	0xfe5e, 0x001d, 0x020b, 0x02cd, 0x03dd, 0x0397, 0x00b9, 0x02c4,
-	0x07bf, 0x073c, 0x0360, 0x01a2, 0xfed7, 0xfe74, 0x017f, 0x0120,
-	0x00cd, 0xffac, 0xfd02, 0xfd2e, 0xff3a, 0xffc7, 0xff88, 0xff9d,
-	0x0069, 0x017f, 0x0280, 0x038e, 0x021c, 0xfef1, 0xfba9, 0xf9f6,
-	0xfc99, 0xfd73, 0xf89c, 0xf95c, 0xfdda, 0xffde, 0x006e, 0xfceb,
-	0xfd0b, 0x01b8, 0x032c, 0xff59, 0xfc7c, 0x0017, 0x0402, 0x01f7,
-	0xfd77, 0xfd33, 0x0068, 0x026b, 0x00e6, 0x006e, 0x01d0, 0x00aa,
-	0xff7d, 0x0232, 0x046c, 0x0341, 0x01e1, 0x0019, 0x00fa, 0x0443,
-	0x04f6, 0x02c8, 0xfdea, 0xfbf1, 0xfea7, 0xfe33, 0xfb03, 0xf908,
-	0xf980, 0xfb06, 0xfb92, 0xfc21, 0xfd54, 0x00a6, 0x01a0, 0x01cc,
-	0x03e3, 0x0398, 0x0273, 0x0102, 0xffaa, 0xfed7, 0xfe31, 0xfed6,
-	0xff19, 0xff51, 0xfe5e, 0xfd6c, 0x00b8, 0x0369, 0x0147, 0x00b5,
-	0x01c7, 0x00e9, 0x00c4, 0x0105, 0x0241, 0xff75, 0xf9d0, 0xfa0b,
-	0xfb87, 0xfd7a, 0x0096, 0x0010, 0xfe9d, 0xfde8, 0xfe56, 0x0146,
-	0x016b, 0x01d0, 0x02bf, 0x00cd, 0x000f, 0x0079, 0x01c7, 0x01fd,
-	0x00dd, 0xfe6f, 0xfbfe, 0xfa18, 0xf8b2, 0xfba7, 0xff17, 0xfe71,
-	0xfc70, 0xfcee, 0xffdf, 0x0293, 0x0230, 0x02c9, 0x02d4, 0x007b,
-	0x023c, 0x033a, 0x0000, 0xfdaa, 0xfd4a, 0xfd0c, 0xfca1, 0xfc06,
-	0xfbd1, 0xfd61, 0x008c, 0x0259, 0x01bd, 0x01b5, 0x00ab, 0xfede,
-	0x0057, 0x01e0, 0xff5c, 0xfbc8, 0xfa0e, 0xf9c1, 0xfb2a, 0xfdda,
-	0xff35, 0xfc8d, 0xfa54, 0xfcac, 0xfed4, 0xffc0, 0xfeb8, 0xfd94,
-	0xfe3a, 0xfead, 0x0086, 0x021d, 0x025d, 0xffa3, 0xfd6d, 0xfe68,
-	0xff97, 0x00c8, 0xfe24, 0xfab4, 0xfb30, 0xfcb6, 0xfded, 0xfd89,
-	0xfbd9, 0xfcac, 0xff32, 0x0185, 0x02a8, 0x033d, 0x03a6, 0x0124,
-	0x005c, 0x0105, 0xff12, 0xfc67, 0xfc37, 0xfd16, 0xfa66, 0xfb80,
-	0xfefb, 0xfe07, 0xff1a, 0xfe5c, 0xfcb1, 0xfe5f, 0xfdde, 0xff4e,
-	0x0083, 0xff77, 0xfef2, 0xfcb8, 0xfdc3, 0xff93, 0xff8d, 0xff26,
-	0xfd77, 0xfcaa, 0xfd0e, 0xfdea, 0xff19, 0x002e, 0xfe70, 0xfd59,
-	0xfef7, 0x002e, 0x018e, 0x0181, 0xfff1, 0xff3b, 0xfdbc, 0xfd34,
-	0xfee1, 0xfc75, 0xfa3d, 0xfa25, 0xf885, 0xf93d, 0xfa8c, 0xfad8,
-	0xfdfc, 0x0125, 0x02f2, 0x035b, 0x00fa, 0x00f5, 0x0032, 0x00d8,
-	0x015b, 0xfcdd, 0xfcb7, 0xfd72, 0xfd1c, 0xfdae, 0xfd75, 0xffca,
-	0x01dd, 0x018d, 0x0238, 0x013b, 0x0011, 0x0104, 0x0234, 0x019f,
-	0xfd3d, 0xfb4e, 0xfb45, 0xfc0a, 0xff94, 0x0036, 0xfdde, 0xfc8a,
-	0xfe8d, 0x0025, 0x0150, 0x020b, 0xfee0, 0xfe8b, 0x009d, 0x00c1,
-	0x01ec, 0x0281, 0x0281, 0x0179, 0xfe7a, 0xfe7e, 0xfef0, 0xfc9a,
-	0xfc55, 0xfe9b, 0xff4e, 0xfdd8, 0xfd5d, 0xfe57, 0x00a5, 0x0209,
-	0x007b, 0x01be, 0x037d, 0x0181, 0xff69, 0xfecf, 0xfefb, 0xfe35,
-	0xfd0a, 0xfc25, 0xfd1e, 0xfe84, 0xff14, 0xff63, 0x00af, 0x03dc,
-	0x0423, 0x0285, 0x010f, 0x00d3, 0x0262, 0x0106, 0xfec6, 0xff2f,
-	0xfe74, 0xfda8, 0x00c9, 0x021a, 0xff83, 0xfe9f, 0xfe47, 0xfecc,
-	0x00e0, 0x0041, 0xff06, 0x000d, 0x017e, 0x019d, 0x028c, 0x02c9,
-	0x00f3, 0x00ff, 0x008e, 0xffca, 0x0039, 0x0093, 0xffbe, 0xfea2,
-	0xffc7, 0xfda7, 0xfbbc, 0xfe98, 0xffec, 0x0176, 0x014e, 0x0097,
-	0x0299, 0x04ae, 0x05de, 0x041a, 0x00b3, 0xff99, 0x0019, 0x0001,
-	0xfeb3, 0xfce8, 0xfee1, 0x013b, 0x00b4, 0x0153, 0x00dd, 0xfe9e,
-	0xfdbf, 0x0020, 0x0341, 0x027e, 0x005b, 0x0029, 0xfe87, 0xfd8f,
-	0xff9e, 0x00ca, 0x003a, 0xfe99, 0xfe41, 0xfeb6, 0xffa5, 0x01c7,
-	0x01d3, 0x0136, 0x01a1, 0x0167, 0x0171, 0x0269, 0x0376, 0x02e6,
-	0x011b, 0xff98, 0xfe69, 0xfcf4, 0xfbb7, 0xfc6e, 0xfd80, 0xfd4e,
-	0xfcba, 0xfc2b, 0xfcfd, 0xff8d, 0x02c6, 0x03ee, 0x03e2, 0x040c,
-	0x02e6, 0x01c7, 0xffa1, 0xfef1, 0xffb5, 0xfef5, 0xfe3f, 0xfd28,
-	0xfc3c, 0xfcab, 0xfeae, 0x0132, 0x028a, 0x0193, 0xff13, 0xff30,
-	0x020f, 0x02a4, 0x008b, 0xff3b, 0xfcd7, 0xfbd9, 0xfcb1, 0xfc38,
-	0xfc8b, 0xfc7f, 0xfd03, 0xfdca, 0xfe5e, 0xfea0, 0xfdb1, 0xfe7b,
-	0xfe6a, 0xfe6c, 0x00db, 0x0284, 0x0298, 0x0299, 0x00ea, 0xfe98,
-	0xff1a, 0xff18, 0xfe5c, 0xfea2, 0xfe91, 0xfda2, 0xfd4e, 0xfd1a,
-	0xfced, 0xff57, 0x002f, 0xfe96, 0x001a, 0x0163, 0x00bc, 0x0170,
-	0x01df, 0xffd6, 0xfd63, 0xfd18, 0xfbec, 0xfb79, 0xfd98, 0xfe43,
-	0xfe5b, 0xfeb0, 0xffac, 0xff7e, 0xfe31, 0xfe18, 0xfeda, 0x005d,
-	0x00bd, 0xfeb8, 0xfaea, 0xf9d7, 0xfc92, 0xfe87, 0xff90, 0xfe5c,
-	0xfc6f, 0xfdc9, 0xff43, 0xfe6f, 0xfe9a, 0xff2d, 0xfe2b, 0xff04,
-	0x0188, 0x013b, 0x0002, 0x00f5, 0x0125, 0x009b, 0x0110, 0xffc3,
-	0xfd54, 0xfd64, 0xfeaa, 0xff0b, 0xfe75, 0xfd52, 0xfcb1, 0xfd61,
-	0xfe60, 0xff56, 0x0140, 0x02a2, 0x03a5, 0x0433, 0x028b, 0x00a4,
-	0xfef1, 0xfceb, 0xfd02, 0xfd15, 0xfc4d, 0xfcc9, 0xfdcb, 0xfe0c,
-	0xfe37, 0xfeba, 0xfdd9, 0xfe5b, 0x00be, 0x0140, 0x011b, 0x00ec,
-	0xff66, 0xfe1f, 0xfe5c, 0xffdc, 0x00bb, 0xff62, 0xfe0f, 0xfe9e,
-	0xffa7, 0xffb2, 0x0114, 0x0243, 0x0082, 0x00b0, 0x0209, 0x01b7,
-	0x01ee, 0x022d, 0x016c, 0x0130, 0x013e, 0xffd3, 0xfd5c, 0xfbfe,
-	0xfbfb, 0xfc80, 0xfce7, 0xfc6f, 0xfc96, 0xfe4a, 0xff2e, 0xff2e,
-	0xffe7, 0x019c, 0x0343, 0x0457, 0x043d, 0x01d0, 0xfef0, 0xfdf7,
-	0xfd82, 0xfcaa, 0xfcb4, 0xfe05, 0xfe55, 0xfd95, 0xff0e, 0x002d,
-	0xff3d, 0xfff7, 0x0277, 0x038e, 0x02f6, 0x01dd, 0x0064, 0xff78,
-	0xffe1, 0x012f, 0x00ab, 0xfe62, 0xfd7c, 0xfe8f, 0xffd8, 0x00b6,
-	0x0165, 0x00dc, 0xffc4, 0xff80, 0xff63, 0x0065, 0x0300, 0x03e2,
-	0x0291, 0x0108, 0xffef, 0xff64, 0xfefe, 0xfe14, 0xfd8a, 0xfe09,
-	0xfe0f, 0xfd3e, 0xfc3c, 0xfb86, 0xfcbe, 0xfeea, 0xffdb, 0x0036,
-	0x0135, 0x0275, 0x033e, 0x026a, 0x017a, 0x0153, 0x0019, 0xfeec,
-	0xff99, 0x0085, 0x000e, 0xffe7, 0x00c9, 0x0166, 0x015b, 0x00d6,
-	0x003f, 0x00c4, 0x02a5, 0x03ba, 0x01d3, 0xff01, 0xfe8b, 0xffc9,
-	0x00b7, 0xffcf, 0xfe5e, 0xfe0e, 0xfd96, 0xfd28, 0xfc85, 0xfb45,
-	0xfa74, 0xfa63, 0xfae6, 0xfb7d, 0xfc85, 0xfd31, 0xfcae, 0xfc72,
-	0xfc4f, 0xfcc7, 0xfe49, 0xfe3e, 0xfe40, 0xffc0, 0xffc3, 0xfe84,
-	0xfec8, 0x00a4, 0x028b, 0x0495, 0x06ea, 0x088b, 0x0a62, 0x0c20,
-	0x0c74, 0x0c09, 0x0b28, 0x0a77, 0x0960, 0x076c, 0x06a1, 0x0603,
-	0x0469, 0x0267, 0xffb1, 0xfd71, 0xfb9c, 0xf892, 0xf526, 0xf263,
-	0xf158, 0xf0bb, 0xeebf, 0xec98, 0xeb76, 0xebef, 0xed6f, 0xef75,
-	0xf1b4, 0xf3a1, 0xf6d2, 0xfb3d, 0xfeac, 0x011f, 0x02d3, 0x038b,
-	0x043c, 0x0687, 0x0ac1, 0x0e1a, 0x0f34, 0x109b, 0x1235, 0x13eb,
-	0x1644, 0x1828, 0x1a44, 0x1cc7, 0x1d82, 0x1a98, 0x14fb, 0x0e9d,
-	0x0753, 0x000d, 0xf95e, 0xf31e, 0xef68, 0xecea, 0xe942, 0xe54c,
-	0xe27a, 0xe1ec, 0xe2b2, 0xe526, 0xeaf6, 0xf13d, 0xf645, 0xfabf,
-	0xfd53, 0xfee1, 0x001e, 0xffd2, 0xfdce, 0xfc69, 0xfc1c, 0xfa58,
-	0xf7bf, 0xf582, 0xf3e4, 0xf55d, 0xf858, 0xfb2a, 0xff32, 0x0326,
-	0x0754, 0x0c39, 0x1157, 0x17d7, 0x1dec, 0x2086, 0x20a2, 0x2105,
-	0x2243, 0x2273, 0x21b2, 0x1e2e, 0x15ea, 0x0d07, 0x0463, 0xfabb,
-	0xf2ac, 0xeda6, 0xea35, 0xe66d, 0xe344, 0xe28c, 0xe24d, 0xe391,
-	0xe74d, 0xeb6e, 0xf0d0, 0xf781, 0xfdd4, 0x0242, 0x03c2, 0x03cb,
-	0x0191, 0xfd96, 0xfa8b, 0xf8c5, 0xf7cd, 0xf76d, 0xf75e, 0xf78f,
-	0xf819, 0xf8c0, 0xf874, 0xf99f, 0xfe73, 0x049f, 0x0ac8, 0x0e9f,
-	0x0fca, 0x12aa, 0x1680, 0x1900, 0x1b62, 0x1d68, 0x1e70, 0x1eec,
-	0x1e07, 0x19d1, 0x1228, 0x092c, 0xfed2, 0xf507, 0xef11, 0xeaa7,
-	0xe792, 0xe540, 0xe29a, 0xe16a, 0xe0d3, 0xe145, 0xe3fd, 0xe909,
-	0xefa2, 0xf564, 0xfa64, 0xfe83, 0x00b5, 0x020a, 0x0215, 0x0070,
-	0xff2d, 0xfee6, 0xff3a, 0xff05, 0xfe40, 0xfd8a, 0xfbe9, 0xf9ac,
-	0xf8d7, 0xf9bb, 0xfc49, 0xffdf, 0x0466, 0x096f, 0x0d2a, 0x1020,
-	0x1178, 0x117a, 0x1377, 0x16f5, 0x19c3, 0x1acb, 0x1a25, 0x1750,
-	0x1225, 0x0bdf, 0x042a, 0xfb46, 0xf385, 0xee03, 0xea92, 0xe8aa,
-	0xe878, 0xe853, 0xe6be, 0xe669, 0xe70a, 0xe8b7, 0xed31, 0xf21c,
-	0xf7bc, 0xfe26, 0x025c, 0x041b, 0x0370, 0x01ad, 0x0053, 0xfe4b,
-	0xfc85, 0xfbaf, 0xfbea, 0xfd5c, 0xfe3c, 0xfdc6, 0xfd12, 0xfd52,
-	0xff3c, 0x010d, 0x034d, 0x076d, 0x0b13, 0x0e02, 0x0f9f, 0x1019,
-	0x1161, 0x10fd, 0x0f9e, 0x0f74, 0x0fd8, 0x10a9, 0x110e, 0x0fcc,
-	0x0ce6, 0x08e5, 0x035f, 0xfbc7, 0xf478, 0xef42, 0xec3c, 0xeb71,
-	0xeaf0, 0xead3, 0xeaf7, 0xea45, 0xeabf, 0xeda7, 0xf157, 0xf50c,
-	0xf9cc, 0xfdd2, 0x0186, 0x058e, 0x07a0, 0x06a2, 0x046f, 0x02d8,
-	0x0108, 0xff72, 0xfe14, 0xfd8d, 0xfe15, 0xfe67, 0xfdbc, 0xfbf1,
-	0xfae9, 0xfb5a, 0xfc6c, 0xfe97, 0x0150, 0x0548, 0x0a17, 0x0d3d,
-	0x0f9c, 0x10b1, 0x0ff8, 0x0efe, 0x0d57, 0x0bda, 0x0a8e, 0x08a7,
-	0x06d5, 0x047f, 0x012d, 0xfd8e, 0xf94d, 0xf52a, 0xf2ce, 0xf230,
-	0xf33f, 0xf41a, 0xf35b, 0xf3bd, 0xf523, 0xf6f3, 0xf8fc, 0xfa71,
-	0xfb5e, 0xfc51, 0xfdca, 0xff5a, 0x00a6, 0x0186, 0x00e1, 0xfe52,
-	0xfc52, 0xfbef, 0xfc23, 0xfbfe, 0xfb6e, 0xfb0a, 0xfb0d, 0xfbaf,
-	0xfce5, 0xfe25, 0xff2f, 0x00a5, 0x01e2, 0x02c2, 0x044d, 0x05df,
-	0x07b0, 0x0991, 0x0af3, 0x0c80, 0x0e13, 0x0eb8, 0x0e91, 0x0eaf,
-	0x0de0, 0x0b4b, 0x080a, 0x045f, 0x00d6, 0xfde8, 0xfb1e, 0xf915,
-	0xf882, 0xf853, 0xf7fb, 0xf6c3, 0xf596, 0xf6fd, 0xf9da, 0xf9fa,
-	0xf873, 0xf82e, 0xf8df, 0xfa46, 0xfc5e, 0xfcf9, 0xfab1, 0xf875,
-	0xf78c, 0xf743, 0xf7ef, 0xf967, 0xfa4a, 0xfa0a, 0xfa10, 0xfa4b,
-	0xfb9a, 0xfe04, 0x001e, 0x020c, 0x034d, 0x033c, 0x03af, 0x049b,
-	0x05e0, 0x0808, 0x0a82, 0x0bc1, 0x0cb5, 0x0dbe, 0x0ed1, 0x0f93,
-	0x0f98, 0x1091, 0x115d, 0x1007, 0x0c54, 0x0794, 0x0340, 0xfebc,
-	0xfa80, 0xf6db, 0xf34c, 0xf09d, 0xef7e, 0xeddc, 0xed2f, 0xee54,
-	0xef89, 0xf0e3, 0xf217, 0xf42a, 0xf7d8, 0xfa74, 0xfb6f, 0xfb1a,
-	0xf98b, 0xf8db, 0xf864, 0xf859, 0xf741, 0xf5a4, 0xf4f8, 0xf4b7,
-	0xf6f6, 0xfa18, 0xfcb9, 0xfe4f, 0xff92, 0x02c1, 0x06be, 0x0aa0,
-	0x0d00, 0x0f86, 0x116f, 0x1215, 0x13ce, 0x14e3, 0x159f, 0x1729,
-	0x17b6, 0x155f, 0x10c0, 0x0c19, 0x0659, 0xfff4, 0xfa54, 0xf4f2,
-	0xf213, 0xf0e8, 0xef3a, 0xee37, 0xedaa, 0xedb5, 0xeee7, 0xf06a,
-	0xf113, 0xf1f6, 0xf2fb, 0xf48e, 0xf709, 0xf9a7, 0xfc08, 0xfce8,
-	0xfcd9, 0xfcfe, 0xfdbe, 0xfde4, 0xfd51, 0xfd09, 0xfc1b, 0xfc0a,
-	0xfd1d, 0xfe5d, 0xff9e, 0x00aa, 0x0231, 0x036d, 0x0594, 0x08a3,
-	0x0a86, 0x0c0b, 0x0c11, 0x0c8d, 0x0ee6, 0x115a, 0x13c2, 0x147b,
-	0x1487, 0x143f, 0x123e, 0x0e9c, 0x0955, 0x039a, 0xfea0, 0xfa59,
-	0xf63b, 0xf2d9, 0xf075, 0xedee, 0xebb1, 0xeb7b, 0xee12, 0xf063,
-	0xf1f6, 0xf506, 0xf7d9, 0xf985, 0xfa1c, 0xfac9, 0xfc92, 0xfdc8,
-	0xff46, 0x002c, 0x002a, 0x003a, 0xfffc, 0xfe7b, 0xfc33, 0xfbc4,
-	0xfda6, 0x005e, 0x02e3, 0x03e4, 0x038b, 0x0362, 0x0435, 0x0582,
-	0x05a4, 0x04fe, 0x0425, 0x033e, 0x03df, 0x0599, 0x08a9, 0x0b8a,
-	0x0cce, 0x0e10, 0x0e5e, 0x0eb7, 0x0d8e, 0x09de, 0x05f7, 0x0109,
-	0xfc90, 0xf8a6, 0xf4a3, 0xf1d2, 0xef2a, 0xecfe, 0xeb8d, 0xebe3,
-	0xef51, 0xf1cc, 0xf3ea, 0xf720, 0xfa5c, 0xfd1a, 0xfdef, 0x0013,
-	0x02cf, 0x0449, 0x053e, 0x04e0, 0x0391, 0x0153, 0xfebf, 0xfb92,
-	0xf8eb, 0xf8c5, 0xf8af, 0xf97d, 0xfabc, 0xfad6, 0xfcda, 0x00a4,
-	0x04ed, 0x0802, 0x086c, 0x07d9, 0x0785, 0x0790, 0x0697, 0x059a,
-	0x0579, 0x04fd, 0x05e3, 0x0734, 0x0841, 0x0889, 0x05cc, 0x03a8,
-	0x03de, 0x030e, 0x0159, 0xffa0, 0xfee8, 0xfd90, 0xfa32, 0xf7c3,
-	0xf501, 0xf2e5, 0xf329, 0xf34c, 0xf485, 0xf566, 0xf6c3, 0xf868,
-	0xf8b9, 0xf9c4, 0xfb88, 0xfd7a, 0x004e, 0x02d1, 0x02e3, 0x02aa,
-	0x02d6, 0x0239, 0x00b5, 0xff3a, 0xfdfb, 0xfc0a, 0xfaab, 0xfae6,
-	0xfc3f, 0xfe13, 0x0077, 0x0165, 0x01de, 0x0365, 0x03e1, 0x0469,
-	0x0644, 0x07e0, 0x0906, 0x0ab8, 0x0be0, 0x0ca1, 0x0cba, 0x0ab1,
-	0x085d, 0x072b, 0x061b, 0x03b4, 0x0050, 0xfd15, 0xfc19, 0xfb8f,
-	0xf9c5, 0xf8a8, 0xf691, 0xf3c6, 0xf3f2, 0xf5a9, 0xf693, 0xf764,
-	0xf943, 0xfb55, 0xfc89, 0xfd01, 0xfdc2, 0xfee3, 0xff09, 0xfe8b,
-	0xfd52, 0xfb3b, 0xfa82, 0xfaca, 0xfbd9, 0xfd85, 0xfdae, 0xfd3f,
-	0xfcf5, 0xfe03, 0xffb6, 0x00b7, 0x033c, 0x060b, 0x08c8, 0x0b8b,
-	0x0ada, 0x0835, 0x072b, 0x06d7, 0x06d9, 0x0841, 0x091f, 0x07a4,
-	0x05e5, 0x0576, 0x0412, 0x0372, 0x043e, 0x02a9, 0x0145, 0x0119,
-	0x00f3, 0x00a7, 0x000c, 0xfdc6, 0xfa85, 0xf988, 0xf6cd, 0xf3ad,
-	0xf20d, 0xf0d0, 0xf1d6, 0xf561, 0xf8ac, 0xf99b, 0xfb49, 0xfd26,
-	0xfd6d, 0xfe9b, 0x0037, 0xff59, 0xfe6f, 0xff43, 0x007c, 0xffa1,
-	0xfd62, 0xfc65, 0xfb24, 0xfd3d, 0x0014, 0x00b5, 0x02c5, 0x057e,
-	0x06d1, 0x072a, 0x05d8, 0x0277, 0x0095, 0x014e, 0x0366, 0x03ac,
-	0x02d9, 0x0326, 0x037e, 0x063e, 0x0963, 0x089f, 0x07a9, 0x0907,
-	0x07c6, 0x04fe, 0x0343, 0xff67, 0xfaa3, 0xf8f9, 0xf9f4, 0xfa2f,
-	0xf8e0, 0xf6f3, 0xf4d7, 0xf5b3, 0xf87b, 0xfa74, 0xfd6e, 0xffe9,
-	0x00d0, 0x0113, 0xff6e, 0xfc70, 0xf9b7, 0xf76a, 0xf7d0, 0xf8df,
-	0xf951, 0xf9a8, 0xf7c1, 0xf7bb, 0xf96e, 0xfa9d, 0xfd74, 0x00e2,
-	0x0274, 0x03c8, 0x0502, 0x03cd, 0x025e, 0x01f9, 0x0316, 0x0458,
-	0x0464, 0x030e, 0x017d, 0x041d, 0x085d, 0x0b67, 0x0ef9, 0x1245,
-	0x1231, 0x103f, 0x0ee3, 0x09b8, 0x030c, 0xffe9, 0xfe4d, 0xfc80,
-	0xf9ed, 0xf5fc, 0xef80, 0xecb0, 0xefa1, 0xf119, 0xf3ff, 0xf72d,
-	0xf772, 0xf9fb, 0xfc7b, 0xfd9b, 0xfe19, 0xfe00, 0xffc6, 0x00fa,
-	0x011e, 0x0070, 0xfefe, 0xffba, 0x01be, 0x019c, 0x00dc, 0x0115,
-	0x008d, 0x0026, 0x003e, 0xfeac, 0xfbed, 0xfb13, 0xfd02, 0xfe7f,
-	0x0051, 0x026c, 0x01d4, 0x01d3, 0x02fb, 0x02a5, 0x022a, 0x0347,
-	0x0437, 0x063b, 0x0684, 0x03cc, 0x0003, 0xfb68, 0xfac2, 0xfc0d,
-	0xfe16, 0xffe5, 0xfece, 0xff55, 0x0076, 0xffdb, 0x014b, 0x0350,
-	0x035d, 0x033c, 0x0441, 0x054f, 0x0482, 0x0463, 0x04d5, 0x05c5,
-	0x0857, 0x08d1, 0x067e, 0x045d, 0x045d, 0x04b9, 0x04e7, 0x054d,
-	0x03ca, 0x0165, 0x003b, 0xfe82, 0xfb36, 0xf8b5, 0xf832, 0xf80d,
-	0xf993, 0xfc5d, 0xfbbb, 0xfb97, 0xfe7b, 0xfed8, 0xfed6, 0xffe9,
-	0xff1a, 0xfe5d, 0xfe89, 0xff0c, 0xfcea, 0xf866, 0xf575, 0xf4d0,
-	0xf6fc, 0xf971, 0xf92e, 0xf83c, 0xfa3e, 0xfe3d, 0x0185, 0x0487,
-	0x06ae, 0x074f, 0x07c1, 0x07cc, 0x0594, 0x0277, 0xffd7, 0xfdcf,
-	0xfe4b, 0xff0b, 0xfdd8, 0xfd28, 0xff20, 0x00cb, 0x025e, 0x04f2,
-	0x0623, 0x0818, 0x097b, 0x0a76, 0x099f, 0x04bd, 0xffeb, 0xfb97,
-	0xf8a9, 0xf7d8, 0xf4d0, 0xf27a, 0xf35d, 0xf30a, 0xf36d, 0xf511,
-	0xf63e, 0xf7ce, 0xf94b, 0xfa00, 0xf97b, 0xf94a, 0xf8d8, 0xf7b0,
-	0xf86c, 0xfa7d, 0xf96b, 0xf751, 0xf798, 0xf8fe, 0xfb77, 0xfe7c,
-	0x020d, 0x0359, 0x03a9, 0x0676, 0x0790, 0x07c9, 0x07f9, 0x069c,
-	0x0789, 0x0b54, 0x0c7e, 0x0c70, 0x0def, 0x0e71, 0x0ea5, 0x0f9c,
-	0x0faa, 0x0d77, 0x0b57, 0x096a, 0x07fc, 0x054c, 0xffd8, 0xfa2f,
-	0xf553, 0xf47b, 0xf344, 0xf079, 0xf0c8, 0xf0c8, 0xf167, 0xf2ad,
-	0xf40e, 0xf6ab, 0xf7dc, 0xfa01, 0xfb70, 0xfa02, 0xf816, 0xf62f,
-	0xf881, 0xfd5b, 0xfe33, 0xfebc, 0xff84, 0x001a, 0x025d, 0x040a,
-	0x0626, 0x0725, 0x078f, 0x08ac, 0x07c8, 0x06cb, 0x04cb, 0x006f,
-	0xfdfb, 0xff24, 0xff34, 0xfd72, 0xfe5a, 0xfffd, 0x0061, 0x0163,
-	0x0243, 0x02c6, 0x0340, 0x02f5, 0x01cb, 0x009b, 0xffc0, 0xfdb7,
-	0xfd3f, 0xff54, 0xff35, 0xfecc, 0xff15, 0xff31, 0xff8e, 0xffbc,
-	0x027d, 0x044c, 0x0444, 0x046d, 0x02a2, 0x0106, 0xfff0, 0xfdc5,
-	0xfcc4, 0xff11, 0x00bc, 0x0028, 0x00c3, 0x0273, 0x0369, 0x03ca,
-	0x03fe, 0x0412, 0x03ab, 0x02e2, 0x0270, 0x01cf, 0xffe2, 0xfc2c,
-	0xf918, 0xf9cb, 0xfad2, 0xfb4e, 0xfb73, 0xfb7d, 0xfc60, 0xfd09,
-	0xff06, 0x00ac, 0x00f2, 0x00fd, 0xffca, 0xfe12, 0xfbd2, 0xf71b,
-	0xf465, 0xf615, 0xf6ed, 0xf76d, 0xf816, 0xf952, 0xfcb5, 0xffb0,
-	0x0246, 0x055b, 0x07c2, 0x099f, 0x0a23, 0x0a09, 0x0a52, 0x06c2,
-	0x0297, 0x01c9, 0xffb8, 0xfc9b, 0xfabd, 0xfaf1, 0xfba3, 0xfbd0,
-	0xfd21, 0xfde0, 0xfec4, 0x00f2, 0x01b5, 0x0198, 0x0120, 0xfe7b,
-	0xfca6, 0xfd9d, 0xfe2e, 0xfcc3, 0xf9e8, 0xf856, 0xf73c, 0xf590,
-	0xf5f8, 0xf74c, 0xf7fa, 0xf88f, 0xf7f7, 0xf691, 0xf80a, 0xf798,
-	0xf5b2, 0xf7d8, 0xfa80, 0xfcbc, 0xfee7, 0x019e, 0x043c, 0x057d,
-	0x06d3, 0x081e, 0x08f5, 0x0a38, 0x0b0f, 0x0c06, 0x0d8c, 0x0c64,
-	0x0b9f, 0x0cac, 0x0e3a, 0x0e5c, 0x0bed, 0x0acb, 0x09be, 0x0882,
-	0x079f, 0x04f1, 0x0230, 0xfed9, 0xfa16, 0xf6e5, 0xf431, 0xf00e,
-	0xeb57, 0xeace, 0xedad, 0xeec9, 0xef8e, 0xf053, 0xf349, 0xf70c,
-	0xf97d, 0xfcaa, 0xff03, 0x0171, 0x021d, 0x01a6, 0x0285, 0x0064,
-	0xfd9d, 0xfd71, 0xfd2c, 0xfc08, 0xfa30, 0xfb0b, 0xfdbd, 0x00d0,
-	0x04a9, 0x059c, 0x06c0, 0x0956, 0x0995, 0x0971, 0x094a, 0x06ee,
-	0x042a, 0x0317, 0x04ea, 0x05c5, 0x03f4, 0x0441, 0x0481, 0x0389,
-	0x0283, 0x01b8, 0x02bf, 0x0529, 0x05d3, 0x041e, 0x0305, 0x00b3,
-	0xfdb7, 0xfd03, 0xfe23, 0xff0f, 0xfee8, 0xff72, 0x0133, 0x02bf,
-	0x03e9, 0x03c5, 0x02de, 0x02a5, 0x0010, 0xfd95, 0xfc43, 0xf96d,
-	0xf69e, 0xf366, 0xf2b8, 0xf367, 0xf2af, 0xf43e, 0xf6a0, 0xf8d2,
-	0xfb0e, 0xfc36, 0xff29, 0x0314, 0x03ec, 0x0406, 0x056b, 0x041a,
-	0x0033, 0xfd5f, 0xfcc7, 0xfd4a, 0xfd97, 0xfdd1, 0xfef6, 0x0113,
-	0x0443, 0x0775, 0x0aa5, 0x0efe, 0x0fe4, 0x0efb, 0x0f0b, 0x0caa,
-	0x08a4, 0x0484, 0x022f, 0xfe6a, 0xf816, 0xf30c, 0xf001, 0xef63,
-	0xf08d, 0xf051, 0xf008, 0xf2b2, 0xf496, 0xf647, 0xf8dc, 0xf9dc,
-	0xf804, 0xf5ba, 0xf71a, 0xf8d9, 0xf8f7, 0xf8ea, 0xf9c9, 0xfabe,
-	0xfb5d, 0xfb04, 0xf9ec, 0xfc5f, 0xff70, 0x005c, 0x01bc, 0x01dc,
-	0xfff6, 0xff23, 0x0082, 0x0316, 0x04dd, 0x061e, 0x07be, 0x0a2d,
-	0x0d8a, 0x0ec0, 0x0f4a, 0x110c, 0x103a, 0x0e83, 0x0e22, 0x0d9a,
-	0x0b88, 0x072a, 0x04dc, 0x03ac, 0x0147, 0xffb2, 0xfdc9, 0xfd18,
-	0xfcf0, 0xfb41, 0xfadd, 0xfbb2, 0xfb1e, 0xf997, 0xf969, 0xf960,
-	0xf595, 0xf1ff, 0xefe2, 0xef5c, 0xf1ec, 0xf375, 0xf4fa, 0xf6cd,
-	0xf949, 0xfafd, 0xfbf3, 0x0002, 0x0265, 0x02cc, 0x0422, 0x0526,
-	0x0428, 0x0179, 0x0159, 0x0347, 0x02c5, 0x0186, 0xffdc, 0xff28,
-	0x01f7, 0x034c, 0x0504, 0x083f, 0x0a5e, 0x0cc6, 0x0e41, 0x0ea9,
-	0x0dd3, 0x0ac2, 0x07c8, 0x05e0, 0x0517, 0x0456, 0x01ac, 0xffd6,
-	0xff31, 0xfcd0, 0xf8f6, 0xf628, 0xf546, 0xf540, 0xf720, 0xf864,
-	0xf6b9, 0xf389, 0xf15f, 0xf279, 0xf449, 0xf56d, 0xf666, 0xf7e2,
-	0xfae9, 0xfbff, 0xfd8c, 0x0107, 0x01d9, 0x01bd, 0x0110, 0xff6e,
-	0xfd6c, 0xfa6e, 0xf947, 0xf9d5, 0xfb57, 0xfd5a, 0xfd80, 0xfe19,
-	0x0213, 0x047d, 0x0533, 0x085c, 0x0ad6, 0x0b6d, 0x0d45, 0x0f21,
-	0x0f2e, 0x0dc8, 0x0af0, 0x089b, 0x074a, 0x06c9, 0x058f, 0x0380,
-	0x0369, 0x01db, 0xffd6, 0xffad, 0xfe98, 0xfcf9, 0xfbf5, 0xfc47,
-	0xfb77, 0xf803, 0xf631, 0xf6d4, 0xf7a7, 0xf934, 0xf887, 0xf653,
-	0xf6f0, 0xf85a, 0xfa06, 0xfb92, 0xfc92, 0xfd06, 0xfda7, 0xff8c,
-	0x0046, 0xfeff, 0xfc80, 0xfbe0, 0xfcf9, 0xfd79, 0xfcf1, 0xfcb0,
-	0xff71, 0x01bf, 0x01a2, 0x024d, 0x022c, 0x0188, 0x03ae, 0x0752,
-	0x090b, 0x0800, 0x0641, 0x0544, 0x05c5, 0x07c9, 0x075d, 0x0717,
-	0x08b1, 0x0854, 0x0780, 0x07d6, 0x08af, 0x0812, 0x0588, 0x02cf,
-	0xfe84, 0xf94c, 0xf527, 0xf254, 0xf117, 0xf1fb, 0xf251, 0xf182,
-	0xf300, 0xf50e, 0xf5a7, 0xf841, 0xfc0a, 0xfcfa, 0xfd89, 0xff57,
-	0x0108, 0x00a5, 0xfe5f, 0xfb8f, 0xf856, 0xf77b, 0xf71e, 0xf70a,
-	0xf8c3, 0xf9c9, 0xfb18, 0xfc4b, 0xfe9c, 0x0081, 0x00dd, 0x03aa,
-	0x0723, 0x0907, 0x09aa, 0x083a, 0x08e1, 0x0c4a, 0x0e25, 0x0e00,
-	0x0c57, 0x0a8e, 0x0960, 0x09a6, 0x09cf, 0x0802, 0x06f9, 0x0671,
-	0x05d7, 0x03d8, 0xfee1, 0xfa16, 0xf6cd, 0xf541, 0xf471, 0xf2e0,
-	0xf349, 0xf4a9, 0xf541, 0xf680, 0xf7a6, 0xf6e3, 0xf643, 0xf840,
-	0xfaf0, 0xfb75, 0xfaf0, 0xf911, 0xf7ce, 0xf9e7, 0xf9fa, 0xf895,
-	0xf89e, 0xf9b1, 0xfaec, 0xfbea, 0xfe82, 0x00ca, 0x02ba, 0x056e,
-	0x0745, 0x06c5, 0x04f2, 0x0371, 0x02b8, 0x03d0, 0x0558, 0x05dd,
-	0x0775, 0x0962, 0x09b8, 0x0aa2, 0x0c86, 0x0dcf, 0x0d60, 0x0c38,
-	0x0bd5, 0x0b05, 0x0939, 0x0522, 0x0027, 0xfbf4, 0xf7a1, 0xf465,
-	0xf277, 0xf25b, 0xf251, 0xf18b, 0xf2c8, 0xf4a0, 0xf55e, 0xf691,
-	0xf901, 0xfb49, 0xfcd8, 0xfc4b, 0xfa57, 0xfafc, 0xfd1b, 0xfdeb,
-	0xfe6e, 0xfd7d, 0xfab8, 0xf9ab, 0xf9fa, 0xfa5b, 0xfaa9, 0xfb86,
-	0xfe91, 0x011e, 0x024f, 0x0252, 0x011e, 0x02b3, 0x0526, 0x068b,
-	0x074e, 0x0747, 0x082c, 0x0940, 0x0bb9, 0x0e15, 0x0d33, 0x0c73,
-	0x0c66, 0x0bd3, 0x0b51, 0x081c, 0x041d, 0x01fc, 0xffd6, 0xfcf1,
-	0xf9cc, 0xf7bf, 0xf639, 0xf520, 0xf557, 0xf6a9, 0xf76e, 0xf949,
-	0xfca9, 0xfd46, 0xfc26, 0xfa7a, 0xf7ed, 0xf6fc, 0xf80d, 0xf882,
-	0xf850, 0xf887, 0xf8ad, 0xf8fd, 0xf953, 0xfa82, 0xfbbf, 0xfd66,
-	0xff35, 0x009e, 0x02fb, 0x03c7, 0x024e, 0x0212, 0x019a, 0x0129,
-	0x00e8, 0x0078, 0x0169, 0x0229, 0x0459, 0x072f, 0x082b, 0x0a94,
-	0x0dea, 0x0e65, 0x0e99, 0x0f04, 0x0d55, 0x0aaf, 0x0850, 0x0747,
-	0x06ee, 0x05a4, 0x02dc, 0xff05, 0xfb34, 0xf910, 0xf750, 0xf6e6,
-	0xf7e8, 0xf88f, 0xf964, 0xf8bd, 0xf737, 0xf699, 0xf719, 0xf792,
-	0xf78e, 0xf7e3, 0xf856, 0xf859, 0xf9d8, 0xfc06, 0xfbe1, 0xfc92,
-	0xfccf, 0xfc07, 0xfd04, 0xfd2f, 0xfc54, 0xfc33, 0xfc62, 0xfce6,
-	0xfe0a, 0xff27, 0xffad, 0x003d, 0x01d5, 0x03f4, 0x05a6, 0x0835,
-	0x0c5f, 0x0f02, 0x10f0, 0x1237, 0x0fc6, 0x0c8f, 0x0a38, 0x07c3,
-	0x0507, 0x036e, 0x036b, 0x01af, 0xffff, 0xfef8, 0xfd1d, 0xfd35,
-	0xfd92, 0xfd83, 0xfdbe, 0xfc5c, 0xfb5f, 0xfa86, 0xf92f, 0xf7a7,
-	0xf58d, 0xf481, 0xf3de, 0xf316, 0xf397, 0xf4e6, 0xf578, 0xf6f5,
-	0xf9ad, 0xfb57, 0xfca7, 0xfdf7, 0xfd5d, 0xfc30, 0xfb75, 0xfa19,
-	0xfaa2, 0xfc7e, 0xff1c, 0x00d4, 0x00b5, 0x017b, 0x0289, 0x0456,
-	0x05b1, 0x0770, 0x0a53, 0x0b01, 0x0af6, 0x0af4, 0x0a65, 0x0a12,
-	0x0909, 0x0986, 0x09f0, 0x0804, 0x0768, 0x06b2, 0x0570, 0x053d,
-	0x0456, 0x0219, 0x003a, 0xfe65, 0xfabe, 0xf76a, 0xf531, 0xf318,
-	0xf204, 0xf21e, 0xf30c, 0xf3f7, 0xf4f6, 0xf698, 0xf7a0, 0xf82e,
-	0xfa2e, 0xfcdf, 0xff85, 0x01c8, 0x0195, 0xfef2, 0xfc93, 0xf9d3,
-	0xf6b5, 0xf578, 0xf645, 0xf682, 0xf6d3, 0xf88b, 0xf990, 0xfbd0,
-	0xff0a, 0x0364, 0x07c3, 0x09cd, 0x0b46, 0x0c1d, 0x0ba4, 0x0b77,
-	0x0adf, 0x099d, 0x09c2, 0x092c, 0x07ad, 0x073b, 0x074d, 0x078b,
-	0x079e, 0x07b7, 0x0767, 0x067c, 0x0414, 0x0158, 0xfea5, 0xfb19,
-	0xf875, 0xf7cf, 0xf792, 0xf747, 0xf724, 0xf67a, 0xf685, 0xf6d0,
-	0xf764, 0xf85b, 0xf9e1, 0xfb4c, 0xfaed, 0xf9e5, 0xf88c, 0xf7e5,
-	0xf73e, 0xf7a5, 0xf92c, 0xf835, 0xf7a2, 0xf90f, 0xf9e7, 0xfb88,
-	0xfd92, 0xff2d, 0x0134, 0x0327, 0x03c8, 0x0357, 0x031e, 0x033e,
-	0x0429, 0x0537, 0x069a, 0x0702, 0x0612, 0x0790, 0x09a6, 0x09b9,
-	0x09c0, 0x0a81, 0x0b9e, 0x0d42, 0x0dfa, 0x0c2e, 0x089e, 0x04f3,
-	0x008a, 0xfcc8, 0xfa97, 0xf77f, 0xf603, 0xf566, 0xf52d, 0xf535,
-	0xf478, 0xf568, 0xf850, 0xfaf5, 0xfc54, 0xfc48, 0xfc24, 0xfcad,
-	0xfc85, 0xfbb4, 0xfac4, 0xf948, 0xf6b8, 0xf5f0, 0xf6f1, 0xf696,
-	0xf772, 0xf84f, 0xfab1, 0xfe2d, 0xff31, 0xffeb, 0xffbd, 0xff72,
-	0xffca, 0x005d, 0x01d5, 0x02b8, 0x04b4, 0x06e6, 0x07a9, 0x092b,
-	0x09c9, 0x0a3a, 0x0b62, 0x0ca2, 0x0e30, 0x0c71, 0x0a7d, 0x090b,
-	0x04ef, 0x02de, 0x030c, 0x01a8, 0xff2b, 0xfda0, 0xfc78, 0xfacd,
-	0xfa57, 0xfa3d, 0xfad4, 0xfc4f, 0xfbd9, 0xfa6e, 0xf834, 0xf61f,
-	0xf50c, 0xf4d9, 0xf606, 0xf664, 0xf4f0, 0xf4e9, 0xf713, 0xf939,
-	0xfac7, 0xfad5, 0xfb5c, 0xfdb7, 0x0144, 0x034b, 0x0368, 0x030f,
-	0x0036, 0xfe45, 0xfdf5, 0xfcc5, 0xfbac, 0xfbb9, 0xfd58, 0x007c,
-	0x0244, 0x033e, 0x064f, 0x0ac7, 0x0e66, 0x0f56, 0x0f51, 0x0f1d,
-	0x0de4, 0x0cc7, 0x0cfa, 0x0b52, 0x069a, 0x02c9, 0xff6f, 0xfd4a,
-	0xfc6f, 0xfa99, 0xfa12, 0xfc12, 0xfdec, 0xfd71, 0xfc3c, 0xfac9,
-	0xf975, 0xf970, 0xf9da, 0xf963, 0xf833, 0xf73c, 0xf796, 0xf9a3,
-	0xfa14, 0xf8c7, 0xf812, 0xf98e, 0xfc8f, 0xfd02, 0xfcce, 0xfd31,
-	0xfb66, 0xfa5f, 0xfb8c, 0xfc50, 0xfb97, 0xfc1f, 0xfd5f, 0xfedc,
-	0x01e5, 0x037f, 0x0525, 0x085c, 0x0b11, 0x0c37, 0x0bc6, 0x0a9e,
-	0x0910, 0x07b9, 0x0844, 0x08f8, 0x080f, 0x06fe, 0x0647, 0x06d0,
-	0x06c0, 0x057e, 0x03e5, 0x03be, 0x052d, 0x04ca, 0x047a, 0x034a,
-	0xff9e, 0xfc8e, 0xfaa8, 0xf895, 0xf5cf, 0xf301, 0xf268, 0xf45e,
-	0xf5a3, 0xf5e4, 0xf669, 0xf893, 0xfbf6, 0xfd94, 0xfdee, 0xfd92,
-	0xfcbf, 0xfc4d, 0xfd7c, 0xfec8, 0xfdba, 0xfc32, 0xfa30, 0xf8ee,
-	0xf999, 0xf9a6, 0xfa68, 0xfe41, 0x02c0, 0x04c2, 0x0667, 0x07b6,
-	0x06d8, 0x0694, 0x0770, 0x07dd, 0x07cb, 0x06cd, 0x06eb, 0x08d8,
-	0x09b5, 0x09e4, 0x08ea, 0x0896, 0x0976, 0x081f, 0x0653, 0x050b,
-	0x02e1, 0xffd3, 0xfda5, 0xfbf0, 0xf9bd, 0xf824, 0xf623, 0xf522,
-	0xf535, 0xf5d9, 0xf733, 0xf9bc, 0xfd85, 0xff5b, 0xff90, 0xff9d,
-	0xfd7b, 0xfa5a, 0xf8b4, 0xf8ad, 0xf873, 0xf6c3, 0xf610, 0xf6ca,
-	0xf7f1, 0xf99f, 0xfa44, 0xfc5b, 0xff87, 0x016b, 0x03cd, 0x0676,
-	0x0778, 0x077f, 0x0785, 0x0710, 0x068a, 0x0482, 0x0194, 0x00de,
-	0x01eb, 0x02d2, 0x0321, 0x042b, 0x06a8, 0x08fb, 0x09e0, 0x0a88,
-	0x09eb, 0x074c, 0x05e2, 0x0571, 0x04dc, 0x0352, 0x0089, 0xfd34,
-	0xfa62, 0xf819, 0xf517, 0xf489, 0xf64f, 0xf72d, 0xf86e, 0xfa17,
-	0xfa21, 0xf8da, 0xf87d, 0xf8ba, 0xf936, 0xf931, 0xf857, 0xf80a,
-	0xf8d5, 0xfad8, 0xfb64, 0xfb95, 0xfdbd, 0xff2b, 0xffda, 0x017b,
-	0x0265, 0x0196, 0x0130, 0x01ee, 0x02a4, 0x02a0, 0x0247, 0x0241,
-	0x033e, 0x0443, 0x0519, 0x076c, 0x0a67, 0x0d28, 0x0e3d, 0x0e53,
-	0x0d5d, 0x09f2, 0x062e, 0x03ca, 0x0215, 0xff69, 0xfcf2, 0xfa84,
-	0xf91e, 0xf9bf, 0xf8db, 0xf850, 0xf99d, 0xfa86, 0xfb5c, 0xfca3,
-	0xfd88, 0xfd5f, 0xfca1, 0xfbc8, 0xfb4a, 0xf9a9, 0xf63e, 0xf3c7,
-	0xf3c7, 0xf471, 0xf4b9, 0xf5c7, 0xf84e, 0xfb2a, 0xfdca, 0x00cd,
-	0x0240, 0x01a1, 0x0148, 0x01d4, 0x0389, 0x04ce, 0x058d, 0x0522,
-	0x04a6, 0x0563, 0x03e8, 0x025d, 0x0363, 0x04ff, 0x06eb, 0x08b8,
-	0x0956, 0x08cd, 0x0773, 0x06cb, 0x061d, 0x03c7, 0x0123, 0xfe9e,
-	0xfdda, 0xfed5, 0xfe6d, 0xfd62, 0xfe3a, 0xfeff, 0xfe0a, 0xfdcd,
-	0xfd35, 0xfb5e, 0xf98f, 0xf8c1, 0xf826, 0xf74c, 0xf5f0, 0xf4d1,
-	0xf519, 0xf5a7, 0xf607, 0xf5e9, 0xf7f8, 0xfc20, 0xff90, 0x0268,
-	0x03e0, 0x044d, 0x0276, 0x0004, 0xff20, 0xfd7a, 0xfc16, 0xfb2f,
-	0xfb44, 0xfd7e, 0xfecc, 0xfff6, 0x0379, 0x0709, 0x0994, 0x0af6,
-	0x0b6c, 0x0bde, 0x0be1, 0x0b7a, 0x0a0c, 0x0836, 0x059a, 0x01bd,
-	0xfee6, 0xfc76, 0xfaad, 0xf903, 0xf911, 0xfada, 0xfc60, 0xfe5f,
-	0xff7d, 0xff86, 0xfecb, 0xfd96, 0xfcd2, 0xfc43, 0xfbdd, 0xfaa0,
-	0xfa28, 0xfb17, 0xf941, 0xf622, 0xf589, 0xf69d, 0xf883, 0xfa12,
-	0xfba2, 0xfccc, 0xfcc5, 0xfd94, 0xfe31, 0xfe02, 0xfdc3, 0xfd0e,
-	0xfc37, 0xfcec, 0xfe91, 0xfea6, 0xffe5, 0x02a2, 0x046f, 0x05b1,
-	0x05ea, 0x05d8, 0x0626, 0x0611, 0x057d, 0x0459, 0x0310, 0x01e4,
-	0x0118, 0x01aa, 0x0179, 0xffd2, 0xff51, 0x00ac, 0x02dc, 0x03af,
-	0x04b8, 0x061b, 0x04ce, 0x0276, 0xff67, 0xfbc5, 0xf920, 0xf6c0,
-	0xf58a, 0xf5a2, 0xf594, 0xf55a, 0xf61b, 0xf883, 0xfb8d, 0xfdc4,
-	0xfe78, 0xfe60, 0xff09, 0xff65, 0xff1d, 0xfefe, 0xfe14, 0xfc9c,
-	0xfa92, 0xf9f3, 0xfa21, 0xf8e8, 0xf8d6, 0xfb1b, 0xfe89, 0x01a8,
-	0x042c, 0x05c7, 0x066f, 0x06f9, 0x06c6, 0x05d9, 0x0578, 0x04c0,
-	0x03fd, 0x0596, 0x069b, 0x0565, 0x039e, 0x01f5, 0x01ab, 0x01c4,
-	0x0238, 0x0299, 0x0238, 0x0226, 0x01e1, 0x013d, 0x006a, 0xfefe,
-	0xfbdd, 0xf9dd, 0xfa4d, 0xf98c, 0xf8cc, 0xfa5b, 0xfc44, 0xfe0f,
-	0xff8a, 0xff88, 0xfe64, 0xfd1d, 0xfc48, 0xfc30, 0xfb77, 0xfa32,
-	0xf882, 0xf842, 0xf965, 0xf9bc, 0xf8e2, 0xf8f6, 0xfba7, 0xfeaf,
-	0x0182, 0x03d3, 0x0525, 0x06ec, 0x07c3, 0x0703, 0x05f9, 0x0420,
-	0x0196, 0x0056, 0x0073, 0xffa3, 0xfe61, 0xfe92, 0x0160, 0x054e,
-	0x0825, 0x08ff, 0x08e9, 0x07cd, 0x071d, 0x0738, 0x06a2, 0x0522,
-	0x01cb, 0xfefb, 0xfd17, 0xfa8b, 0xf84c, 0xf6df, 0xf6d1, 0xf7e3,
-	0xf9e8, 0xfb70, 0xfbe5, 0xfd24, 0xfe23, 0xfdfe, 0xfe3a, 0xfd8f,
-	0xfb1e, 0xfa1e, 0xfb2a, 0xfc32, 0xfc08, 0xfaec, 0xfab5, 0xfbaa,
-	0xfd10, 0xfe25, 0xfef0, 0xff3e, 0x0026, 0x01a9, 0x02f7, 0x03db,
-	0x021f, 0x0095, 0x015d, 0x0172, 0x0087, 0x002b, 0x00de, 0x02d7,
-	0x05a5, 0x071a, 0x0670, 0x054c, 0x050f, 0x050d, 0x0516, 0x044b,
-	0x01bc, 0xff65, 0xfe20, 0xfe09, 0xfcb3, 0xfa4a, 0xf9e7, 0xfaca,
-	0xfd06, 0xff2e, 0x0057, 0x00ac, 0x00b8, 0x006c, 0x002b, 0xff28,
-	0xfbb6, 0xf895, 0xf785, 0xf701, 0xf68a, 0xf621, 0xf626, 0xf843,
-	0xfbcf, 0xfee4, 0x0148, 0x01fc, 0x029c, 0x038a, 0x047e, 0x055b,
-	0x0409, 0x0162, 0xff29, 0xfe01, 0xfcb1, 0xfb5c, 0xfb64, 0xfc49,
-	0xfe74, 0x00e5, 0x027a, 0x0426, 0x0585, 0x05a4, 0x069c, 0x06a3,
-	0x042a, 0x019a, 0x0007, 0x0013, 0x0062, 0x003b, 0xffa4, 0xff16,
-	0xff5e, 0x0029, 0x0096, 0xff53, 0xfec8, 0xfea6, 0xfecc, 0xffe0,
-	0xff38, 0xfd69, 0xfbd5, 0xfadf, 0xf9dd, 0xf8f5, 0xf903, 0xfade,
-	0xfdd5, 0x0094, 0x01df, 0x022b, 0x0171, 0x000f, 0x00a2, 0x00dc,
-	0xffb6, 0xfd91, 0xfb46, 0xfb76, 0xfb75, 0xfaf8, 0xfb2e, 0xfbee,
-	0xfdbb, 0x0099, 0x031f, 0x0498, 0x0628, 0x0725, 0x07e1, 0x0807,
-	0x05d7, 0x02ab, 0xffff, 0xfd75, 0xfc3b, 0xfb8d, 0xfa2a, 0xfadc,
-	0xfd26, 0x006d, 0x03b4, 0x0560, 0x0605, 0x052f, 0x0554, 0x0656,
-	0x05e2, 0x0352, 0x0038, 0xfe24, 0xfbcf, 0xf9d1, 0xf93d, 0xf96b,
-	0xf9fa, 0xfbca, 0xfd76, 0xfec6, 0xfffa, 0x000e, 0x0117, 0x0255,
-	0x0203, 0x002d, 0xfdb7, 0xfbff, 0xfc19, 0xfc91, 0xfcc7, 0xfdc8,
-	0xfe55, 0x003c, 0x0285, 0x0344, 0x0374, 0x027f, 0x0195, 0x0226,
-	0x029f, 0x0112, 0xffb6, 0xfeef, 0xfdfc, 0xfd03, 0xfc3d, 0xfd0e,
-	0xff21, 0x017d, 0x03f2, 0x05cd, 0x0528, 0x036e, 0x034a, 0x036b,
-	0x0352, 0x01db, 0xff76, 0xfd82, 0xfc41, 0xfba6, 0xfb4f, 0xfb6d,
-	0xfb41, 0xfc74, 0xfe0c, 0xffc1, 0x0201, 0x02d6, 0x02fb, 0x047f,
-	0x04d0, 0x0205, 0xfef0, 0xfc28, 0xfaa9, 0xf95e, 0xf84f, 0xf867,
-	0xf8b7, 0xfaa0, 0xfda5, 0x00db, 0x0272, 0x0262, 0x0276, 0x03b4,
-	0x05bd, 0x05cf, 0x0425, 0x02a1, 0x004d, 0xfd92, 0xfc28, 0xfb08,
-	0xfaab, 0xfc41, 0xfe36, 0x0012, 0x0112, 0x013b, 0x015c, 0x025c,
-	0x034f, 0x025b, 0xffeb, 0xfd6e, 0xfcf5, 0xfc7a, 0xfcd0, 0xfe94,
-	0xfed3, 0xff5c, 0x0064, 0x0190, 0x026f, 0x018d, 0x003e, 0x0073,
-	0x00dd, 0xffb1, 0xfe67, 0xfd8e, 0xfca7, 0xfb61, 0xfac4, 0xfa23,
-	0xfa8a, 0xfcc0, 0xffd6, 0x0343, 0x050f, 0x0546, 0x0466, 0x03a7,
-	0x0399, 0x026d, 0xffff, 0xfdcc, 0xfc85, 0xfaee, 0xfa8d, 0xfb6a,
-	0xfc1f, 0xfd3b, 0xfe57, 0xffaa, 0x0162, 0x024a, 0x02bb, 0x04a1,
-	0x0689, 0x05e3, 0x035e, 0x00b5, 0xfddb, 0xfb1c, 0xf96e, 0xf84e,
-	0xf7a1, 0xf7f7, 0xfa63, 0xfe27, 0x0119, 0x0373, 0x0412, 0x044e,
-	0x058c, 0x0629, 0x0566, 0x0446, 0x02c7, 0x009c, 0xfe88, 0xfc50,
-	0xfb03, 0xfb14, 0xfbcf, 0xfd7e, 0xff81, 0xfff5, 0xffd2, 0x0124,
-	0x02f5, 0x044a, 0x030a, 0x00d4, 0xfedb, 0xfc4d, 0xfbf3, 0xfd12,
-	0xfdce, 0xfe7c, 0xff78, 0x014d, 0x032a, 0x041c, 0x03ac, 0x02b5,
-	0x0293, 0x0213, 0x0013, 0xfe48, 0xfc99, 0xfba0, 0xfb9f, 0xfa3c,
-	0xf9d2, 0xfa9b, 0xfbf9, 0xff3a, 0x029c, 0x04a1, 0x0453, 0x035f,
-	0x03bd, 0x040c, 0x027e, 0x00ac, 0xfef2, 0xfc59, 0xfac4, 0xfa4f,
-	0xfa33, 0xfb26, 0xfd05, 0xfedd, 0x0107, 0x0210, 0x0251, 0x0358,
-	0x0515, 0x06c1, 0x05f7, 0x03cc, 0x0181, 0xfee3, 0xfc5b, 0xfa25,
-	0xf8da, 0xf8b3, 0xf974, 0xfa93, 0xfcef, 0xfff7, 0x01b6, 0x0225,
-	0x0336, 0x0408, 0x0387, 0x038d, 0x0352, 0x01da, 0xffec, 0xfdd6,
-	0xfc66, 0xfbe3, 0xfbd4, 0xfc6c, 0xfe88, 0xffcc, 0xffd6, 0x0006,
-	0x00d3, 0x02ab, 0x0316, 0x0243, 0x0023, 0xfd1e, 0xfac2, 0xf9a2,
-	0xfa41, 0xfba6, 0xfda8, 0xfef2, 0x00af, 0x0369, 0x0412, 0x02bf,
-	0x0337, 0x03a2, 0x01d7, 0x003b, 0xfe10, 0xfc46, 0xfb3a, 0xfa3d,
-	0xf9ea, 0xf9b4, 0xfa3c, 0xfc4d, 0x0022, 0x0406, 0x0615, 0x061d,
-	0x0609, 0x0655, 0x04e1, 0x02da, 0x00d0, 0xfdea, 0xfb9b, 0xf9aa,
-	0xf813, 0xf899, 0xfa58, 0xfbe2, 0xfe3f, 0x009c, 0x014f, 0x010b,
-	0x0237, 0x04d8, 0x061c, 0x0578, 0x0348, 0x0117, 0xfe7a, 0xfbb3,
-	0xfa38, 0xf930, 0xf8bf, 0xf8d5, 0xfa3b, 0xfd98, 0x0026, 0x0105,
-	0x0339, 0x048e, 0x03c1, 0x039d, 0x02da, 0x0166, 0x0075, 0xff0e,
-	0xfcb0, 0xfbfc, 0xfc2b, 0xfc3d, 0xfda8, 0xffb3, 0x010c, 0x0074,
-	0x0058, 0x01a0, 0x0292, 0x029a, 0x0184, 0xffae, 0xfd29, 0xfadb,
-	0xf96c, 0xfa01, 0xfbcc, 0xfd50, 0xff02, 0x01e3, 0x0404, 0x03a3,
-	0x0436, 0x04d3, 0x0473, 0x0384, 0x00f9, 0xfe41, 0xfc44, 0xfaa9,
-	0xf921, 0xf889, 0xf8dd, 0xf8f3, 0xfa70, 0xfe07, 0x01af, 0x030b,
-	0x03bb, 0x04f1, 0x0563, 0x04c7, 0x02f2, 0x006a, 0xfe78, 0xfc92,
-	0xf9c1, 0xf8e6, 0xf9a7, 0xfa4e, 0xfc47, 0xffa1, 0x016e, 0x00ec,
-	0x0197, 0x0323, 0x0508, 0x067c, 0x0584, 0x038f, 0x016a, 0xff73,
-	0xfd88, 0xfb80, 0xfa9c, 0xfa88, 0xfa10, 0xfb76, 0xfdad, 0xfdfd,
-	0xff03, 0x00e6, 0x0275, 0x033f, 0x02ab, 0x0147, 0x0152, 0x0199,
-	0x001f, 0xff45, 0xfe88, 0xfd6b, 0xfd14, 0xfe55, 0xfffc, 0xffd3,
-	0xff3e, 0xffba, 0x00f8, 0x01d5, 0x01c3, 0x0090, 0xfed8, 0xfcfd,
-	0xfacf, 0xf997, 0xfa66, 0xfc0c, 0xfd72, 0x0052, 0x02a6, 0x0310,
-	0x036b, 0x0335, 0x040f, 0x0518, 0x039e, 0x00df, 0xfe53, 0xfc55,
-	0xfac4, 0xfa2e, 0xfa6e, 0xfa82, 0xfa16, 0xfbf0, 0xffdd, 0x0225,
-	0x0379, 0x0526, 0x0695, 0x0737, 0x06ed, 0x0463, 0x0131, 0xfeaa,
-	0xfbe4, 0xf9ab, 0xf856, 0xf7f5, 0xf8c1, 0xfbbb, 0xff2c, 0x00bc,
-	0x0126, 0x0120, 0x02c9, 0x05dd, 0x0727, 0x05ff, 0x038d, 0x0112,
-	0xfed6, 0xfc2b, 0xfa65, 0xf996, 0xf8b5, 0xf978, 0xfb77, 0xfce0,
-	0xfd8c, 0xff8f, 0x029d, 0x0570, 0x066d, 0x04a1, 0x02bf, 0x01b7,
-	0x00b6, 0xff96, 0xfe44, 0xfcda, 0xfbc8, 0xfc43, 0xfe40, 0xff98,
-	0xffb4, 0xffe9, 0x00c9, 0x02a7, 0x03dc, 0x031a, 0x0172, 0xffec,
-	0xfe5e, 0xfb59, 0xf9d9, 0xfa28, 0xfa15, 0xfc21, 0xff35, 0x0116,
-	0x0200, 0x026a, 0x0390, 0x05b4, 0x06f9, 0x05da, 0x02f5, 0xff12,
-	0xfbdb, 0xf9d9, 0xf8d8, 0xf8c6, 0xf86a, 0xf861, 0xfaaf, 0xfe16,
-	0x0040, 0x020d, 0x034f, 0x0501, 0x071e, 0x0693, 0x03dc, 0x0143,
-	0xfeec, 0xfbd9, 0xf9c4, 0xf8b4, 0xf750, 0xf7cf, 0xfab8, 0xfe92,
-	0x0132, 0x014e, 0x0156, 0x033d, 0x0618, 0x0794, 0x06cf, 0x04a3,
-	0x022d, 0xff8d, 0xfd93, 0xfc70, 0xfa8c, 0xf9a2, 0xfb4d, 0xfd38,
-	0xfde0, 0xfe55, 0xfe69, 0x0039, 0x037b, 0x0406, 0x0240, 0x0037,
-	0xfee0, 0xfe1e, 0xfdc2, 0xfe38, 0xfdd6, 0xfcd8, 0xfd95, 0xff81,
-	0x00bc, 0x00da, 0x0068, 0x00f9, 0x0210, 0x027b, 0x0120, 0xff74,
-	0xfeaf, 0xfc32, 0xfa24, 0xf97c, 0xf890, 0xf979, 0xfca4, 0x002a,
-	0x0292, 0x0379, 0x02d3, 0x0363, 0x057d, 0x064b, 0x0520, 0x0200,
-	0xfee3, 0xfc0f, 0xf9c5, 0xf979, 0xf9be, 0xf90c, 0xf9c2, 0xfc5e,
-	0xfeea, 0x0154, 0x02c9, 0x04a8, 0x0779, 0x086c, 0x06e1, 0x045e,
-	0x01f7, 0xfe5d, 0xfb97, 0xfa36, 0xf7d5, 0xf69a, 0xf740, 0xfa4a,
-	0xfe7a, 0x00df, 0x0161, 0x01c6, 0x0348, 0x0552, 0x05a8, 0x0471,
-	0x0335, 0x00c6, 0xfdc7, 0xfc6f, 0xfb6a, 0xf971, 0xf955, 0xfa99,
-	0xfbd8, 0xfd37, 0xfcfc, 0xfe1c, 0x0211, 0x04c7, 0x04ed, 0x0361,
-	0x01bf, 0x0007, 0xfece, 0xff12, 0xff0c, 0xfdf5, 0xfd77, 0xfebf,
-	0x0084, 0x01ae, 0x01be, 0x0173, 0x01d5, 0x0330, 0x02af, 0x00a4,
-	0xfffd, 0xfe2e, 0xfc15, 0xfb18, 0xf9cd, 0xf8cb, 0xf983, 0xfb85,
-	0xfeb6, 0x0160, 0x0193, 0x0254, 0x042c, 0x05bc, 0x05bc, 0x0414,
-	0x0241, 0xff74, 0xfc00, 0xfa62, 0xf9f6, 0xf919, 0xf92b, 0xfa3b,
-	0xfbe1, 0xfdde, 0xff6b, 0x00c1, 0x0372, 0x06a1, 0x06cb, 0x05a8,
-	0x03f9, 0x0102, 0xfeb9, 0xfd1d, 0xfb6a, 0xf960, 0xf7fb, 0xf7e9,
-	0xfa73, 0xfdac, 0xff73, 0x007f, 0x01e6, 0x0484, 0x0574, 0x0500,
-	0x0534, 0x03ef, 0x0108, 0xff93, 0xfe86, 0xfc60, 0xfbb2, 0xfbe8,
-	0xfd12, 0xfeb2, 0xfe8c, 0xfdf0, 0xfee0, 0x017a, 0x02f6, 0x0291,
-	0x0144, 0xfee9, 0xfd07, 0xfcab, 0xfd25, 0xfde6, 0xfe3f, 0xfed0,
-	0x0038, 0x014f, 0x01ce, 0x0195, 0x01eb, 0x0399, 0x0302, 0x00d8,
-	0xffca, 0xfea9, 0xfd32, 0xfcb1, 0xfbf3, 0xfa7a, 0xf9ae, 0xfa2c,
-	0xfcc0, 0x004c, 0x0219, 0x02a7, 0x03d3, 0x059a, 0x0690, 0x05e6,
-	0x0440, 0x018a, 0xfd9c, 0xfaf5, 0xf93c, 0xf881, 0xf910, 0xf9f2,
-	0xfb90, 0xfd44, 0xff1b, 0xfff6, 0x019a, 0x05ce, 0x07ac, 0x07d2,
-	0x07a2, 0x0537, 0x01e1, 0xfefe, 0xfcce, 0xfad8, 0xf8bf, 0xf6fc,
-	0xf7b5, 0xf9ff, 0xfc40, 0xfe6b, 0x002f, 0x02fc, 0x0560, 0x05e3,
-	0x0609, 0x056b, 0x02e7, 0x0103, 0xffaa, 0xfd91, 0xfc36, 0xfafc,
-	0xfaec, 0xfc59, 0xfd5c, 0xfcc1, 0xfcc3, 0xff15, 0x01a4, 0x03aa,
-	0x0479, 0x0348, 0x0103, 0xfed3, 0xfd9b, 0xfd92, 0xfceb, 0xfc94,
-	0xfe01, 0xffa9, 0x0127, 0x0119, 0x0122, 0x034e, 0x0459, 0x03e0,
-	0x02e5, 0x00a0, 0xfded, 0xfcef, 0xfc53, 0xfb7c, 0xfafb, 0xfa05,
-	0xfa9d, 0xfd3a, 0xff7c, 0x00aa, 0x0182, 0x0363, 0x0558, 0x0593,
-	0x055a, 0x04b3, 0x025b, 0xff66, 0xfc9c, 0xfa26, 0xf8ac, 0xf893,
-	0xf9ae, 0xfbdc, 0xfe25, 0xfe41, 0xfe88, 0x0138, 0x03c4, 0x0590,
-	0x06cc, 0x05dc, 0x033f, 0x00a4, 0xfe12, 0xfc84, 0xfb16, 0xf989,
-	0xf8f1, 0xf970, 0xfb4f, 0xfd22, 0xfea6, 0x00fb, 0x037c, 0x0457,
-	0x04ee, 0x0528, 0x03c6, 0x0286, 0x0117, 0xffca, 0xfe6f, 0xfcdb,
-	0xfbcc, 0xfccc, 0xfedb, 0xff0c, 0xfe94, 0xfef1, 0xffb5, 0x010a,
-	0x0248, 0x0254, 0x00c5, 0xfe4d, 0xfcab, 0xfc0e, 0xfba4, 0xfbfe,
-	0xfd0c, 0xfed7, 0x0177, 0x0290, 0x01e6, 0x0299, 0x0401, 0x0470,
-	0x047a, 0x02af, 0xff9f, 0xfd79, 0xfbbe, 0xfac8, 0xfa80, 0xf97b,
-	0xf948, 0xfb2d, 0xfde1, 0xfff5, 0x011f, 0x02de, 0x04fd, 0x062e,
-	0x0683, 0x05a8, 0x03df, 0x0144, 0xfef5, 0xfc8d, 0xf972, 0xf80a,
-	0xf7d0, 0xf972, 0xfcae, 0xfdcc, 0xfe0b, 0xff45, 0x0165, 0x03b3,
-	0x05e8, 0x06f5, 0x0686, 0x051a, 0x02b8, 0x005a, 0xfe6e, 0xfcbe,
-	0xfb3d, 0xfa8d, 0xfa5f, 0xfa24, 0xf9f3, 0xfbc6, 0xff1c, 0x0153,
-	0x033d, 0x0435, 0x03ec, 0x02f4, 0x0217, 0x0191, 0x0082, 0xff28,
-	0xfd49, 0xfc7c, 0xfd56, 0xfddc, 0xfda5, 0xfd90, 0xfd87, 0xfe2a,
-	0xff8d, 0x00a7, 0x018e, 0x0126, 0x000f, 0xff19, 0xfe22, 0xfda3,
-	0xfdb3, 0xfebf, 0x00fb, 0x024a, 0x0188, 0x010d, 0x018b, 0x0231,
-	0x037b, 0x03c4, 0x01fe, 0xff6e, 0xfd67, 0xfc49, 0xfc07, 0xfb9f,
-	0xfa9a, 0xfae3, 0xfcca, 0xfdfa, 0xfea7, 0xffde, 0x014d, 0x0324,
-	0x0467, 0x04c1, 0x0464, 0x0308, 0x022e, 0x00b8, 0xfdff, 0xfb9b,
-	0xf962, 0xf8ce, 0xfaf3, 0xfcf2, 0xfd11, 0xfd6d, 0xfec0, 0x0028,
-	0x025b, 0x0424, 0x04ea, 0x0496, 0x032f, 0x01c4, 0xffd6, 0xfddf,
-	0xfcce, 0xfc21, 0xfc25, 0xfc2a, 0xfb03, 0xfaf0, 0xfc6a, 0xfe62,
-	0x0068, 0x021c, 0x0323, 0x02fd, 0x02ff, 0x02aa, 0x01b2, 0x00dd,
-	0xff63, 0xfe20, 0xfe30, 0xfe0e, 0xfe10, 0xfe35, 0xfe4c, 0xff19,
-	0xffbf, 0x0073, 0x0187, 0x01c2, 0x0125, 0x0017, 0xfea3, 0xfd1d,
-	0xfbd6, 0xfb6e, 0xfcda, 0xfef9, 0xffdc, 0x0047, 0x00ff, 0x014f,
-	0x02c6, 0x0470, 0x049a, 0x0373, 0x0135, 0xfee3, 0xfcef, 0xfbc4,
-	0xfaca, 0xf9cc, 0xfaa1, 0xfbec, 0xfca5, 0xfd71, 0xfebc, 0x0110,
-	0x0318, 0x04a9, 0x059d, 0x04ae, 0x03a0, 0x02f8, 0x017e, 0xffac,
-	0xfcda, 0xfa3a, 0xf9e8, 0xfae5, 0xfb5e, 0xfbd7, 0xfc9e, 0xfded,
-	0xffb0, 0x01b3, 0x03c0, 0x04ed, 0x0539, 0x04df, 0x040b, 0x01e4,
-	0xff80, 0xfde6, 0xfd32, 0xfd1c, 0xfc0c, 0xfa9c, 0xfa81, 0xfb8e,
-	0xfd6b, 0xffa7, 0x012f, 0x01b9, 0x01bb, 0x016e, 0x015e, 0x018a,
-	0x00d3, 0xff9b, 0xff65, 0xff1e, 0xfe62, 0xfe58, 0xfe6d, 0xfec1,
-	0xfedb, 0xfee8, 0xffa3, 0x0028, 0x0094, 0x00e0, 0x0058, 0xff43,
-	0xfde0, 0xfc6a, 0xfcce, 0xfe9c, 0xffb3, 0x001d, 0x0091, 0x00ba,
-	0x016f, 0x02ef, 0x03fd, 0x0447, 0x0324, 0x00f4, 0xfed1, 0xfd5e,
-	0xfbf5, 0xfa53, 0xfa03, 0xfabf, 0xfbf6, 0xfcca, 0xfe05, 0x0047,
-	0x0203, 0x03eb, 0x0583, 0x054f, 0x0425, 0x0316, 0x01dc, 0x00b3,
-	0xfecc, 0xfbac, 0xfa13, 0xfa6b, 0xfb16, 0xfbc1, 0xfc70, 0xfd49,
-	0xfeb5, 0x002b, 0x018f, 0x0314, 0x03b9, 0x03ae, 0x0391, 0x0262,
-	0x0081, 0xfe4b, 0xfcf4, 0xfd4c, 0xfd70, 0xfc7e, 0xfb76, 0xfb86,
-	0xfc54, 0xfe25, 0x005d, 0x018e, 0x0251, 0x027c, 0x01fb, 0x01ff,
-	0x012e, 0xffa1, 0xff29, 0xff11, 0xfeee, 0xfe8c, 0xfe14, 0xfe6c,
-	0xfee7, 0xff3b, 0xffe1, 0x0051, 0x00a2, 0x00f6, 0x0087, 0xffd0,
-	0xff0e, 0xfd41, 0xfbe9, 0xfc4e, 0xfd7f, 0xfe5f, 0xff7a, 0x003f,
-	0x00a1, 0x0152, 0x0253, 0x0398, 0x043b, 0x03e3, 0x0297, 0x0117,
-	0xff2b, 0xfd30, 0xfbf3, 0xfb6f, 0xfc15, 0xfc13, 0xfbd9, 0xfc92,
-	0xfda6, 0xffed, 0x02cc, 0x0488, 0x04f2, 0x0438, 0x02f6, 0x023a,
-	0x014c, 0xfefe, 0xfc30, 0xfad3, 0xfa5a, 0xfaa8, 0xfb93, 0xfbfc,
-	0xfcde, 0xfdc2, 0xfefd, 0x00ee, 0x0226, 0x0331, 0x03ee, 0x0427,
-	0x03bb, 0x020c, 0x0021, 0xff9c, 0x001e, 0xffe2, 0xfeaa, 0xfd37,
-	0xfbcb, 0xfbc2, 0xfd3e, 0xfea2, 0xfff1, 0x00be, 0x00b1, 0x00e5,
-	0x0107, 0x0050, 0xffeb, 0xffff, 0x0062, 0x005f, 0xff40, 0xfe39,
-	0xfe08, 0xfe13, 0xfe6b, 0xfecf, 0xfee2, 0xff59, 0xffc6, 0x0066,
-	0x00cb, 0xfff0, 0xfe4a, 0xfd8e, 0xfd96, 0xfdc0, 0xfe92, 0xff42,
-	0xfff0, 0x007f, 0x0130, 0x01f1, 0x0308, 0x03be, 0x02f8, 0x01cd,
-	0x0048, 0xfe6c, 0xfc7b, 0xfb60, 0xfbc9, 0xfbf6, 0xfc06, 0xfc63,
-	0xfcef, 0xfe0c, 0xfff5, 0x0277, 0x0480, 0x05b5, 0x0564, 0x0452,
-	0x0389, 0x01b2, 0xff30, 0xfcf8, 0xfb80, 0xfb03, 0xfb10, 0xfb1f,
-	0xfb83, 0xfc7e, 0xfe0c, 0x003a, 0x021a, 0x0302, 0x034b, 0x038f,
-	0x0398, 0x02b9, 0x005e, 0xfdbb, 0xfca0, 0xfc8d, 0xfc9e, 0xfc5f,
-	0xfb74, 0xfb0c, 0xfbfe, 0xfd71, 0xff9f, 0x0192, 0x0259, 0x02f3,
-	0x0351, 0x0255, 0x007a, 0xff73, 0xff1f, 0xff87, 0xff92, 0xfe67,
-	0xfd90, 0xfd7e, 0xfe38, 0xff60, 0xfff7, 0x0077, 0x0100, 0x0172,
-	0x022f, 0x0224, 0x00b3, 0xff32, 0xfe75, 0xfe00, 0xfd8a, 0xfd16,
-	0xfd26, 0xfe1c, 0xff38, 0xffd9, 0x00f6, 0x0293, 0x038d, 0x041c,
-	0x0407, 0x029a, 0x003e, 0xfd9e, 0xfc80, 0xfc72, 0xfc41, 0xfbff,
-	0xfb92, 0xfb61, 0xfbf8, 0xfdca, 0x0085, 0x032c, 0x049c, 0x0472,
-	0x03fd, 0x02f6, 0x0134, 0xff74, 0xfd95, 0xfc92, 0xfc24, 0xfb9a,
-	0xfb91, 0xfc1e, 0xfcb4, 0xfdcd, 0xff87, 0x0132, 0x024d, 0x02fb,
-	0x03d4, 0x0420, 0x030c, 0x00fd, 0xff35, 0xfe9d, 0xfe98, 0xfebf,
-	0xfe1c, 0xfd46, 0xfce0, 0xfd26, 0xfe7f, 0xffe4, 0x0094, 0x010a,
-	0x01b1, 0x01c5, 0x00c3, 0xff2b, 0xfe1a, 0xfe7e, 0xff66, 0xff84,
-	0xfec6, 0xfe08, 0xfdec, 0xfe79, 0xff33, 0xff9c, 0xffbe, 0xff91,
-	0xffe3, 0x0071, 0x000a, 0xfef9, 0xfe3d, 0xfe33, 0xfe54, 0xfe37,
-	0xfd99, 0xfde2, 0xfece, 0xff93, 0x00b5, 0x0182, 0x027d, 0x037c,
-	0x03ed, 0x0367, 0x01c3, 0xff18, 0xfd0a, 0xfc95, 0xfcb8, 0xfcd9,
-	0xfc92, 0xfc53, 0xfc86, 0xfd5a, 0xfed7, 0x013c, 0x03c3, 0x04e4,
-	0x0598, 0x0520, 0x0364, 0x016e, 0xff51, 0xfde7, 0xfcc8, 0xfbc0,
-	0xfac5, 0xfa92, 0xfb0c, 0xfbf4, 0xfdb3, 0xffd3, 0x017d, 0x0263,
-	0x02c9, 0x0384, 0x039d, 0x0240, 0x006a, 0xfe55, 0xfcf4, 0xfcdf,
-	0xfcd9, 0xfcce, 0xfcc0, 0xfc65, 0xfc88, 0xfdc4, 0xff21, 0x0074,
-	0x01b9, 0x02a7, 0x02e5, 0x01d2, 0x002f, 0xffa5, 0xfff6, 0x0025,
-	0xffd8, 0xfe83, 0xfd36, 0xfd0f, 0xfdbd, 0xff19, 0x002c, 0x0070,
-	0x0096, 0x00d7, 0x00fd, 0x0070, 0xff97, 0xff06, 0xff35, 0xff64,
-	0xfe96, 0xfe22, 0xfdcd, 0xfdf6, 0xff3b, 0x0021, 0x00ba, 0x01cd,
-	0x0297, 0x0339, 0x0385, 0x027b, 0x0079, 0xfedb, 0xfe1d, 0xfdf6,
-	0xfd8f, 0xfcb3, 0xfc1d, 0xfbc1, 0xfbf7, 0xfd85, 0xffaa, 0x01a8,
-	0x0367, 0x0411, 0x03a6, 0x026e, 0x00d9, 0xff87, 0xfeb8, 0xfdd9,
-	0xfcb7, 0xfbbf, 0xfadb, 0xfafd, 0xfc26, 0xfdb4, 0xffcc, 0x016a,
-	0x0228, 0x02e2, 0x03b2, 0x03d8, 0x02e1, 0x0123, 0xff9d, 0xfec5,
-	0xfdeb, 0xfd39, 0xfcf6, 0xfcac, 0xfce9, 0xfe1f, 0xff6b, 0x00be,
-	0x01e0, 0x0263, 0x02c2, 0x0217, 0x000d, 0xfe5c, 0xfdb0, 0xfdd3,
-	0xfe8e, 0xff11, 0xfe96, 0xfdde, 0xfdf4, 0xfec3, 0xffe0, 0x00bf,
-	0x00d6, 0x009b, 0x0072, 0x002f, 0xffbc, 0xfeff, 0xfea2, 0xfecb,
-	0xfe6c, 0xfdc5, 0xfcdb, 0xfcab, 0xfda9, 0xff1d, 0x00a9, 0x01e4,
-	0x023e, 0x02c5, 0x0360, 0x0337, 0x01d0, 0xffe9, 0xfe2e, 0xfd26,
-	0xfd30, 0xfd19, 0xfccb, 0xfc81, 0xfc18, 0xfc90, 0xfdbc, 0xff7f,
-	0x01f2, 0x03ec, 0x0511, 0x051d, 0x03be, 0x01bc, 0x0075, 0xff85,
-	0xfe3f, 0xfd18, 0xfb54, 0xfa4f, 0xfb07, 0xfc28, 0xfe28, 0x0063,
-	0x0185, 0x029d, 0x039b, 0x03a4, 0x02f4, 0x01d1, 0x007b, 0xff4c,
-	0xfe33, 0xfce7, 0xfc0e, 0xfb8e, 0xfb76, 0xfc1f, 0xfc7f, 0xfd67,
-	0xfecd, 0x004e, 0x01f2, 0x02c3, 0x022d, 0x00b2, 0xffc5, 0xff7e,
-	0xffb6, 0xfff2, 0xff55, 0xfe4e, 0xfd7e, 0xfd81, 0xfe02, 0xfee8,
-	0xff77, 0xff87, 0xffd7, 0x005d, 0x006a, 0x0020, 0x0064, 0x00fb,
-	0x015c, 0x01b1, 0x00ea, 0xff64, 0xfeca, 0xfec5, 0xff1f, 0xffb2,
-	0xff55, 0xfec9, 0xff70, 0x0031, 0x001d, 0xffb9, 0xff4b, 0xff74,
-	0x00a4, 0x0194, 0x01ae, 0x00cb, 0xff3c, 0xfdc3, 0xfd09, 0xfd22,
-	0xfd8a, 0xfeed, 0x00fb, 0x0232, 0x01a4, 0xff6c, 0xfdb3, 0xfd59,
-	0xfd8a, 0xfe62, 0xff78, 0xfed0, 0xfde7, 0xfeb5, 0x0142, 0x022b,
-	0x015b, 0x026f, 0x0350, 0x0230, 0x0004, 0xffb2, 0x003c, 0x0047,
-	0x007f, 0xfdf6, 0xfb52, 0xfa5e, 0xf895, 0xf93c, 0xfccd, 0xfeed,
-	0xffd1, 0x0236, 0x05bf, 0x07aa, 0x0709, 0x04af, 0x0218, 0xffa0,
-	0xfd16, 0xfc6a, 0xfcde, 0xfce8, 0xfcfb, 0xfbb9, 0xfab1, 0xfb14,
-	0xfa4c, 0xfc08, 0x0174, 0x0467, 0x037e, 0x024e, 0x030a, 0x0346,
-	0x0256, 0x01fe, 0x01f9, 0xffe3, 0xfc5c, 0xfac8, 0xfc81, 0xff15,
-	0x0026, 0xfe9d, 0xfc9b, 0xfcaa, 0xfb58, 0xfa44, 0xfd24, 0x00d8,
-	0x01f8, 0x02a8, 0x0461, 0x0535, 0x0488, 0x0423, 0x03f7, 0x01e0,
-	0xfe96, 0xfc91, 0xfca8, 0xfdf9, 0x00cd, 0x0193, 0xff30, 0xfc78,
-	0xf906, 0xf953, 0xfc53, 0xfdd2, 0xfd9d, 0xfc7f, 0xfdd3, 0x0146,
-	0x0404, 0x0648, 0x0882, 0x0829, 0x03a6, 0xff4c, 0xfc48, 0xfa8b,
-	0xfd76, 0xff1c, 0xfe7b, 0xfddd, 0xf9c7, 0xf640, 0xf790, 0xfc5f,
-	0x013d, 0x03a6, 0x054e, 0x074c, 0x0870, 0x0721, 0x0488, 0x0143,
-	0xfb41, 0xf77a, 0xf5e9, 0xf543, 0xf8b0, 0xfba4, 0xfddb, 0x0047,
-	0x0040, 0xfe5a, 0xff1d, 0x033e, 0x05b5, 0x05bc, 0x05bd, 0x056d,
-	0x0512, 0x056b, 0x06bc, 0x0702, 0x02ad, 0xfd28, 0xf843, 0xf7e9,
-	0xfac9, 0xfaa1, 0xfb55, 0xfbc4, 0xf99b, 0xf733, 0xf7c0, 0xfb87,
-	0xffe3, 0x03fa, 0x0626, 0x06a3, 0x07d6, 0x0653, 0x0547, 0x0769,
-	0x0626, 0x02a4, 0xfbff, 0xf78b, 0xf765, 0xf8a4, 0xfddf, 0x0093,
-	0x002f, 0xff57, 0xff13, 0xff37, 0xfedb, 0xfd45, 0xfa66, 0xfb5e,
-	0xfee5, 0xff39, 0xffdd, 0x0241, 0x005d, 0xff59, 0x00f6, 0xfef4,
-	0xfefe, 0x02d8, 0x0417, 0x0501, 0x04cf, 0xfe3f, 0xf78a, 0xf774,
-	0xfbf9, 0xff71, 0xffd9, 0x005f, 0x0076, 0x0290, 0x0822, 0x093a,
-	0x06e9, 0x056b, 0x0084, 0xfba3, 0xfa0a, 0xf6ea, 0xf458, 0xf6af,
-	0xfacb, 0xfd3f, 0xfcd2, 0xfc71, 0xfdc4, 0x00d0, 0x05e2, 0x0877,
-	0x084b, 0x076e, 0x07a1, 0x07e6, 0x0665, 0x019f, 0xf84c, 0xf276,
-	0xf4c1, 0xf82c, 0xf98d, 0xfba5, 0xfa52, 0xf8e3, 0xfc0a, 0xfdcb,
-	0xffa2, 0x04a5, 0x0686, 0x0714, 0x08c9, 0x0443, 0xff48, 0xfea9,
-	0x007a, 0x0358, 0x0237, 0xfeb9, 0xf95a, 0xf7a1, 0xfbdd, 0xffcd,
-	0x045b, 0x06a7, 0x04aa, 0x045d, 0x045a, 0x007f, 0xfa0b, 0xf5f2,
-	0xf6ee, 0xf8d2, 0xfbae, 0xfed8, 0x001d, 0x01ab, 0x03ef, 0x0361,
-	0x01f8, 0x037b, 0x047e, 0x05f8, 0x0883, 0x04cc, 0xfbcd, 0xf487,
-	0xf39a, 0xf737, 0xfa45, 0xffaf, 0x010b, 0xfe33, 0x0240, 0x054c,
-	0x0582, 0x089c, 0x0711, 0x01d6, 0xfee2, 0xfaf4, 0xf475, 0xf112,
-	0xf52c, 0xf9ee, 0xfd39, 0x006f, 0xfebd, 0xfeb1, 0x01cc, 0x044e,
-	0x066e, 0x0749, 0x06f6, 0x05f6, 0x05fa, 0x0626, 0x031a, 0xfbf2,
-	0xf810, 0xf7c8, 0xf855, 0xfb61, 0xfd70, 0xfce0, 0xfd34, 0xfc80,
-	0xfb2a, 0xfe14, 0x007b, 0x029b, 0x0633, 0x06ef, 0x03c0, 0xfed6,
-	0xfe21, 0x00bf, 0x03cf, 0x05df, 0x02da, 0xfe67, 0xfd5d, 0xfbef,
-	0xfcfa, 0x0244, 0x0347, 0x00c0, 0x00a8, 0x018d, 0xfdd0, 0xf8b2,
-	0xf795, 0xf6a4, 0xf839, 0xfd24, 0xfe07, 0xff5f, 0x04c1, 0x05a9,
-	0x0418, 0x05af, 0x0461, 0x01b4, 0x0349, 0x0568, 0x0367, 0xfbd6,
-	0xf661, 0xf551, 0xf5e0, 0xfbb7, 0x011e, 0x0163, 0x0390, 0x0695,
-	0x0698, 0x0803, 0x0998, 0x0690, 0x018b, 0xff55, 0xf966, 0xf12b,
-	0xf086, 0xf23d, 0xf688, 0xfc1d, 0xfce2, 0xfcdd, 0xff53, 0x02a8,
-	0x05a0, 0x0871, 0x0941, 0x084e, 0x0711, 0x06ca, 0x05bd, 0x0109,
-	0xfb64, 0xf79f, 0xf63e, 0xf865, 0xf947, 0xf942, 0xfdbf, 0xfd3a,
-	0xfacc, 0xfcd1, 0xfdf7, 0x00e3, 0x047c, 0x070b, 0x070d, 0x0394,
-	0x0116, 0xff3c, 0x0055, 0x03e0, 0x02bb, 0xffc3, 0xfebb, 0xfc7d,
-	0xf9b7, 0xfc01, 0x0291, 0x0422, 0x02fa, 0x0502, 0x02f5, 0xfdad,
-	0xfbc6, 0xf8c8, 0xf6bb, 0xfab0, 0xfbfd, 0xfada, 0x0091, 0x0508,
-	0x0458, 0x060c, 0x06a9, 0x04e1, 0x02e4, 0x0373, 0x042a, 0xff3f,
-	0xf959, 0xf4b5, 0xf224, 0xf4fc, 0xf88b, 0xfa7c, 0xfec8, 0x0335,
-	0x060a, 0x0875, 0x0c32, 0x0dc4, 0x0a90, 0x079f, 0x020a, 0xf897,
-	0xf10b, 0xed08, 0xeeb9, 0xf486, 0xf76b, 0xf85e, 0xfc07, 0x0037,
-	0x03a1, 0x06de, 0x0a31, 0x0c02, 0x0c59, 0x0ca6, 0x0ae5, 0x05a1,
-	0x00ae, 0xfb67, 0xf6a1, 0xf7f2, 0xf722, 0xf481, 0xf9a7, 0xfe1b,
-	0xfdc8, 0xfdd2, 0xfe2e, 0xfebc, 0x018e, 0x062f, 0x06ec, 0x049e,
-	0x025a, 0xfda3, 0xfcba, 0x0146, 0x0337, 0x0166, 0x00ad, 0x010f,
-	0xfe61, 0xfb4a, 0xfd60, 0x00db, 0x027d, 0x04f2, 0x0469, 0x0001,
-	0xfcd7, 0xf9e7, 0xf6d7, 0xf96f, 0xfbd1, 0xf8d4, 0xfa6f, 0xff5f,
-	0x028e, 0x0448, 0x05af, 0x05e2, 0x0374, 0x02fd, 0x036d, 0x0212,
-	0x001e, 0xfb3f, 0xf610, 0xf67a, 0xf7b4, 0xf77c, 0xfa55, 0x0097,
-	0x0506, 0x06b0, 0x091f, 0x0a59, 0x0bd1, 0x0d03, 0x0969, 0x02fb,
-	0xfacc, 0xf111, 0xeccd, 0xf139, 0xf609, 0xf843, 0xfaba, 0xfd87,
-	0x0098, 0x02ea, 0x058b, 0x0849, 0x09d5, 0x0b50, 0x0adc, 0x06e8,
-	0x02aa, 0xfcf2, 0xf7b5, 0xf959, 0xfa5d, 0xf659, 0xf58f, 0xfa09,
-	0xfe46, 0xfff0, 0x00b4, 0xfe5d, 0xfd2e, 0x00d3, 0x02aa, 0x0379,
-	0x042b, 0x0098, 0xfca9, 0xff4b, 0x0319, 0x02b9, 0x01d7, 0x02f8,
-	0x0321, 0xfff5, 0xfdcd, 0xfc54, 0xfd84, 0x023f, 0x042f, 0x0274,
-	0x0066, 0xfbd1, 0xf6e1, 0xf911, 0xfbee, 0xfb7b, 0xfab0, 0xfc37,
-	0x00a8, 0x03b5, 0x054f, 0x0665, 0x05e8, 0x0521, 0x0426, 0x0261,
-	0x021c, 0xff23, 0xfa17, 0xf91e, 0xfad2, 0xf9fa, 0xf76c, 0xf9ed,
-	0xfdfd, 0x0107, 0x0454, 0x0537, 0x0674, 0x0a1d, 0x0a46, 0x0744,
-	0x03a3, 0xf981, 0xeef9, 0xede8, 0xf165, 0xf530, 0xf81d, 0xfab6,
-	0xfebe, 0x0210, 0x0435, 0x05dd, 0x0745, 0x0a07, 0x0b85, 0x0afb,
-	0x0a49, 0x048c, 0xfc3d, 0xfb13, 0xfca4, 0xfac7, 0xf6ea, 0xf5d6,
-	0xf8f4, 0xfd5c, 0x0089, 0xff0f, 0xfd25, 0xfe47, 0xff50, 0x007e,
-	0x0340, 0x01e8, 0xfdef, 0xfeae, 0x02c5, 0x054b, 0x0420, 0x0451,
-	0x056b, 0x0441, 0x0308, 0xffa3, 0xfbaf, 0xfe79, 0x018a, 0x0085,
-	0x0167, 0xfd90, 0xf635, 0xf570, 0xf8e8, 0xfac9, 0xfaae, 0xfacc,
-	0xfd05, 0x0083, 0x036b, 0x0500, 0x0607, 0x07ef, 0x06eb, 0x03cf,
-	0x01f1, 0xff4d, 0xfaad, 0xf72e, 0xf851, 0xfa59, 0xf938, 0xf8e3,
-	0xfb82, 0xff42, 0x03ee, 0x067a, 0x07ce, 0x0b79, 0x0da1, 0x0d05,
-	0x0cb2, 0x0647, 0xf9c6, 0xf056, 0xecd9, 0xef25, 0xf1db, 0xf46a,
-	0xf857, 0xfc3a, 0x0089, 0x031c, 0x04ad, 0x08ac, 0x0b4d, 0x0b0e,
-	0x0d9b, 0x0c0f, 0x03c1, 0xfd54, 0xfc4c, 0xfcc7, 0xfa17, 0xf6ae,
-	0xf3c1, 0xf58b, 0xfb43, 0xfde6, 0xfe3c, 0xff37, 0xff1d, 0xfeef,
-	0x0162, 0x0241, 0xff24, 0xfbbe, 0xfddb, 0x02ba, 0x0401, 0x03aa,
-	0x04c5, 0x04a4, 0x04a4, 0x0360, 0xfe0f, 0xfcf0, 0xfe83, 0xfeb3,
-	0x016f, 0x022d, 0xfd96, 0xf8e3, 0xf89c, 0xfc4f, 0xfe29, 0xfdc4,
-	0xfe17, 0xff43, 0x01e9, 0x02be, 0x031f, 0x0583, 0x061c, 0x04c7,
-	0x02e9, 0x0091, 0xfcf6, 0xf836, 0xf75e, 0xf9e0, 0xfbe6, 0xfc18,
-	0xfb1c, 0xfcf5, 0x009b, 0x02f1, 0x03f4, 0x0724, 0x08d2, 0x07e6,
-	0x0a0b, 0x0981, 0x039e, 0xfa2d, 0xf184, 0xef6a, 0xf0c3, 0xf267,
-	0xf514, 0xf814, 0xfdd4, 0x0200, 0x021a, 0x0610, 0x08da, 0x0803,
-	0x0948, 0x0b5b, 0x0871, 0x00d0, 0xfd04, 0xfcac, 0xfd6c, 0xfdf9,
-	0xfa96, 0xf835, 0xfb39, 0xfde8, 0xfedd, 0x0096, 0x0168, 0xffd1,
-	0xff1b, 0x0094, 0xff60, 0xfaea, 0xf820, 0xfb9c, 0xffbd, 0x018f,
-	0x0438, 0x0531, 0x07d8, 0x09ac, 0x05bc, 0x02f7, 0x0173, 0xffdb,
-	0x00f8, 0x01c4, 0x0081, 0xfb0b, 0xf574, 0xf647, 0xf955, 0xfbd6,
-	0xfc6d, 0xfcfb, 0xffda, 0x00d2, 0x0125, 0x030c, 0x051c, 0x060c,
-	0x04f4, 0x0375, 0x0008, 0xfad1, 0xf7ab, 0xf638, 0xf81a, 0xfb50,
-	0xfbd1, 0xfbc6, 0xff56, 0x019c, 0x0051, 0x0409, 0x07cd, 0x0806,
-	0x0af8, 0x0d22, 0x0c42, 0x0749, 0xfdbd, 0xf640, 0xf18e, 0xf118,
-	0xf2a8, 0xf280, 0xf7d1, 0xfd41, 0xfdbd, 0xff91, 0x0382, 0x056a,
-	0x0517, 0x089f, 0x0b2b, 0x070d, 0x02e9, 0xffbf, 0xfdcb, 0xffdb,
-	0xff70, 0xfb90, 0xfa5f, 0xfb27, 0xfaea, 0xfc02, 0xffb8, 0x00d9,
-	0x0013, 0x0054, 0x013a, 0xfebc, 0xf8cd, 0xf7d6, 0xf9c0, 0xfd04,
-	0x00dc, 0x0153, 0x0544, 0x0941, 0x07e0, 0x06bb, 0x0479, 0x019d,
-	0x0039, 0xffe4, 0x0076, 0xfeb6, 0xfade, 0xf778, 0xf7a5, 0xfb22,
-	0xfbc3, 0xfc38, 0x000c, 0x019f, 0x019b, 0x01e6, 0x03e6, 0x05d2,
-	0x0574, 0x05fb, 0x042f, 0xff36, 0xfa32, 0xf6f2, 0xf5c5, 0xf9a6,
-	0xfe06, 0xfce0, 0xff67, 0x029c, 0xff79, 0xff87, 0x02db, 0x036e,
-	0x049c, 0x068f, 0x085b, 0x0826, 0x0517, 0xffbb, 0xf813, 0xf4ea,
-	0xf3e8, 0xf207, 0xf444, 0xf852, 0xfb51, 0xfce4, 0x000b, 0x0337,
-	0x02b4, 0x04c5, 0x0809, 0x07ef, 0x0667, 0x02bb, 0xff78, 0x0055,
-	0x01d1, 0x001e, 0xfe91, 0xfdc5, 0xfc63, 0xfc1a, 0xfd66, 0xff8b,
-	0x010a, 0x0114, 0x0225, 0x01bc, 0xfcca, 0xf88b, 0xf58e, 0xf7f9,
-	0xfd68, 0xfe71, 0x0185, 0x05c6, 0x07cd, 0x087e, 0x0803, 0x0599,
-	0x0309, 0x028f, 0x018a, 0xffbe, 0xfe62, 0xfa05, 0xf69a, 0xf92c,
-	0xf9e0, 0xf9bb, 0xfc8a, 0xff78, 0x01bc, 0x01de, 0x0203, 0x02ed,
-	0x0436, 0x057e, 0x060a, 0x038b, 0xff47, 0xfb69, 0xf6ce, 0xf6dd,
-	0xf9fa, 0xfa42, 0xfca2, 0x0150, 0x018f, 0xfff6, 0xff1a, 0xff7b,
-	0x016b, 0x03c5, 0x06e4, 0x0856, 0x093c, 0x0819, 0x0296, 0xfe37,
-	0xfad4, 0xf718, 0xf4a1, 0xf54a, 0xf7b5, 0xf7ad, 0xf960, 0xfcec,
-	0xfe7d, 0x0170, 0x0416, 0x04be, 0x0680, 0x067b, 0x0352, 0x0260,
-	0x0388, 0x0354, 0x02dd, 0x01d0, 0xff0c, 0xfc0e, 0xf95f, 0xf956,
-	0xfcb4, 0xfe46, 0x007c, 0x01ed, 0x0044, 0xfe2b, 0xf93c, 0xf6c5,
-	0xf902, 0xfbc7, 0xfd7e, 0x009b, 0x0515, 0x06da, 0x07d9, 0x079f,
-	0x0550, 0x043d, 0x0349, 0x00a5, 0xffe4, 0xfd27, 0xf889, 0xf7e5,
-	0xf979, 0xfaaa, 0xfaff, 0xfd37, 0xfff9, 0x0159, 0x0184, 0x0162,
-	0x0283, 0x04f5, 0x0821, 0x07d4, 0x057b, 0x0263, 0xfb9a, 0xf798,
-	0xf87b, 0xf7c0, 0xf80b, 0xfbe6, 0xff45, 0x00aa, 0x0070, 0xff21,
-	0xfeee, 0x0116, 0x03d2, 0x04f0, 0x060f, 0x06e8, 0x05d2, 0x03b7,
-	0x00f5, 0xfd7d, 0xf827, 0xf5a3, 0xf6fe, 0xf5f7, 0xf66c, 0xf97c,
-	0xfb93, 0xff26, 0x03eb, 0x04ba, 0x055b, 0x065e, 0x03a9, 0x01b5,
-	0x022d, 0x01bd, 0x01b4, 0x0301, 0x01bd, 0xffd4, 0xfd0a, 0xfa63,
-	0xfab3, 0xfc61, 0xffd2, 0x026a, 0x039a, 0x0339, 0xff9d, 0xfb63,
-	0xf931, 0xf8f8, 0xf987, 0xfba1, 0xfe68, 0x005d, 0x03d9, 0x0721,
-	0x06bc, 0x07ab, 0x0840, 0x0641, 0x0587, 0x026a, 0xfcff, 0xf96c,
-	0xf864, 0xf82f, 0xf82b, 0xf8ee, 0xfa41, 0xfc90, 0xfec1, 0x004e,
-	0xffc7, 0xffba, 0x048d, 0x080c, 0x093b, 0x0953, 0x036f, 0xfd19,
-	0xfab8, 0xf840, 0xf642, 0xf701, 0xf8e9, 0xfb60, 0xfe6b, 0xffb4,
-	0xfe38, 0xfeea, 0x023a, 0x051e, 0x07a1, 0x0747, 0x06b6, 0x06d9,
-	0x069b, 0x0617, 0x01c5, 0xfc44, 0xf91c, 0xf6d6, 0xf530, 0xf626,
-	0xf654, 0xf81d, 0xfdc3, 0x0140, 0x03b9, 0x050a, 0x031e, 0x01dd,
-	0x0201, 0x009b, 0x0105, 0x01ee, 0x01df, 0x02da, 0x01e2, 0xff89,
-	0xfc2f, 0xfa61, 0xfbd3, 0xfea9, 0x01dd, 0x038b, 0x020f, 0xfe6e,
-	0xfb88, 0xf96c, 0xf83d, 0xf928, 0xfb19, 0xfb9b, 0xff0f, 0x040f,
-	0x0427, 0x055e, 0x077b, 0x0765, 0x0857, 0x0805, 0x0391, 0xfe24,
-	0xfab0, 0xf837, 0xf78d, 0xf7e1, 0xf87a, 0xf9c5, 0xfbee, 0x00af,
-	0x01c7, 0xff28, 0x0138, 0x0512, 0x0848, 0x0bd9, 0x0a3a, 0x0439,
-	0xffdb, 0xfc7b, 0xf987, 0xf78d, 0xf71e, 0xf719, 0xf9ca, 0xfeae,
-	0xff7a, 0xfef9, 0xff0f, 0x022d, 0x0637, 0x0686, 0x05c0, 0x03ca,
-	0x0234, 0x0273, 0x0285, 0x0060, 0xfd83, 0xfa3e, 0xf7a2, 0xf81e,
-	0xf7ba, 0xf674, 0xf86f, 0xfc7a, 0x016a, 0x05f1, 0x04cb, 0x0307,
-	0x0205, 0xff0c, 0xff79, 0x00c9, 0x01c8, 0x024a, 0x0313, 0x03d3,
-	0x01c0, 0xfea1, 0xfc35, 0xfcb5, 0xff4d, 0x022e, 0x03a7, 0x0149,
-	0xfe33, 0xfba6, 0xf866, 0xf8a0, 0xfa0f, 0xf80f, 0xf96e, 0xff59,
-	0x033e, 0x0574, 0x073f, 0x0828, 0x095a, 0x0b36, 0x09b7, 0x05d3,
-	0x00cc, 0xfb9a, 0xf998, 0xf805, 0xf82e, 0xf7a2, 0xf5c7, 0xf942,
-	0xfdb1, 0xfdc2, 0xfd61, 0xff6a, 0x0263, 0x0764, 0x0b31, 0x09c2,
-	0x04d3, 0x0093, 0xfd44, 0xfb48, 0xfab7, 0xf7ae, 0xf6a6, 0xf8bb,
-	0xfc42, 0xfec2, 0xfdb5, 0xfed1, 0x022d, 0x04d9, 0x067d, 0x0696,
-	0x045d, 0x035b, 0x0427, 0x04da, 0x049d, 0x00ea, 0xfb9f, 0xf918,
-	0xf8ad, 0xf710, 0xf636, 0xf5dd, 0xf92b, 0xffd1, 0x028e, 0x0400,
-	0x035c, 0x00de, 0xff53, 0xffae, 0x0231, 0x02e5, 0x0341, 0x0465,
-	0x04c2, 0x0326, 0xfefb, 0xfc3d, 0xfba2, 0xfd68, 0x013b, 0x012c,
-	0xff18, 0xfdd4, 0xfa07, 0xf8b8, 0xfbae, 0xfb52, 0xf915, 0xf9fa,
-	0xfd15, 0x0065, 0x043c, 0x065d, 0x079a, 0x0a2d, 0x0adf, 0x09ba,
-	0x058e, 0x00ac, 0xfcaf, 0xf88a, 0xf879, 0xf894, 0xf583, 0xf51e,
-	0xf8de, 0xfbe1, 0xfd83, 0xfed9, 0x012f, 0x04d0, 0x0a0c, 0x0cf1,
-	0x0b11, 0x0808, 0x01bd, 0xfd5f, 0xfc5a, 0xfa7e, 0xf7ef, 0xf568,
-	0xf6da, 0xfa3a, 0xfbf1, 0xfd13, 0xff93, 0x02f9, 0x05f2, 0x070f,
-	0x05b5, 0x043e, 0x02a9, 0x01dd, 0x0421, 0x0470, 0xff68, 0xfb70,
-	0xf864, 0xf6ae, 0xf757, 0xf615, 0xf6d0, 0xfb5c, 0x0055, 0x03ff,
-	0x05ef, 0x0676, 0x034c, 0x0086, 0x00cb, 0x013c, 0x01c2, 0x01b8,
-	0x0296, 0x0299, 0x0042, 0xfd9e, 0xfad1, 0xfab1, 0xfe7f, 0x0099,
-	0x00fa, 0x0243, 0xff9b, 0xfbb8, 0xfc19, 0xfd40, 0xfbbe, 0xf9ea,
-	0xf909, 0xf9f8, 0xfe21, 0x0146, 0x04a8, 0x0825, 0x0ab8, 0x0bc6,
-	0x09b2, 0x07c9, 0x0404, 0xfebb, 0xfcc3, 0xfcc9, 0xf9ed, 0xf695,
-	0xf57c, 0xf677, 0xf901, 0xfb05, 0xfc3a, 0xfe2e, 0x0327, 0x06de,
-	0x0a2d, 0x0c21, 0x0817, 0x02ab, 0xfefe, 0xfd4c, 0xfb6b, 0xf7be,
-	0xf56c, 0xf709, 0xf86f, 0xf950, 0xfc3d, 0xffbb, 0x0474, 0x07a6,
-	0x074f, 0x065e, 0x045d, 0x013b, 0x0238, 0x0551, 0x0473, 0x01c5,
-	0xfe03, 0xfae7, 0xf9ca, 0xf76a, 0xf647, 0xf851, 0xfbc8, 0xfe92,
-	0x00d1, 0x0323, 0x0239, 0x0081, 0xffb2, 0xff09, 0xff84, 0xff49,
-	0x00b3, 0x03b2, 0x046b, 0x02e8, 0xffb3, 0xfe10, 0xffbe, 0xffd6,
-	0xfff1, 0x017e, 0x00db, 0xfda0, 0xfc17, 0xfc05, 0xfafa, 0xfa9f,
-	0xf951, 0xf879, 0xf93a, 0xfabf, 0xfea6, 0x03e0, 0x095b, 0x0c0d,
-	0x0aaf, 0x0967, 0x07fa, 0x035f, 0xffc3, 0xfe94, 0xfc09, 0xf85e,
-	0xf69a, 0xf6cb, 0xf76a, 0xf9ce, 0xfad8, 0xfc12, 0x009c, 0x036d,
-	0x0626, 0x09b3, 0x0ad8, 0x08e9, 0x044e, 0x00c0, 0xfee4, 0xfb89,
-	0xf87d, 0xf874, 0xf8cc, 0xf75e, 0xf7c5, 0xfb42, 0x00b4, 0x067a,
-	0x0810, 0x069a, 0x0503, 0x0190, 0x003e, 0x01cb, 0x032e, 0x03e6,
-	0x01c6, 0xff37, 0xfd02, 0xfa16, 0xf6b7, 0xf6c6, 0xfb36, 0xfcde,
-	0xfd80, 0xff15, 0xffc1, 0x0069, 0x0037, 0xff13, 0xfd6a, 0xfba6,
-	0xfc89, 0x00df, 0x0559, 0x07b7, 0x0523, 0x029a, 0x0405, 0x03a5,
-	0x00d0, 0xfff9, 0x0078, 0xfe7d, 0xfd08, 0xfc69, 0xfaba, 0xf995,
-	0xf9f9, 0xfa59, 0xf999, 0xf887, 0xf81d, 0xfb1b, 0x02c0, 0x0b81,
-	0x0e23, 0x0ce0, 0x0c56, 0x0921, 0x04cb, 0x02a9, 0x00da, 0xfc3c,
-	0xf86d, 0xf6f1, 0xf53a, 0xf5f6, 0xf5c1, 0xf69a, 0xfbdc, 0xff7c,
-	0x01e1, 0x048f, 0x07b9, 0x0aa6, 0x0a53, 0x0796, 0x0415, 0xff51,
-	0xfa00, 0xf833, 0xf948, 0xf7df, 0xf533, 0xf493, 0xf78d, 0xfea1,
-	0x0473, 0x07d2, 0x0879, 0x05cf, 0x040b, 0x031e, 0x0302, 0x038b,
-	0x042d, 0x035c, 0x01c2, 0x0000, 0xfa13, 0xf4ab, 0xf67a, 0xfa08,
-	0xfbd7, 0xfd1b, 0xfd97, 0xfe62, 0xfff8, 0x01f7, 0x019e, 0xfd94,
-	0xfad1, 0xfa4b, 0xfd15, 0x0360, 0x0601, 0x03e3, 0x04b8, 0x06bb,
-	0x0458, 0x01bc, 0x00c4, 0xff0a, 0xfe01, 0xfd25, 0xfb87, 0xf9ce,
-	0xf8e3, 0xfa48, 0xfbf8, 0xfc11, 0xfa5c, 0xf798, 0xf94e, 0x0203,
-	0x0a71, 0x0d57, 0x0d08, 0x0be5, 0x07d5, 0x0406, 0x0250, 0xfe39,
-	0xfae1, 0xf812, 0xf658, 0xf761, 0xf610, 0xf533, 0xf87a, 0xfd90,
-	0x00c4, 0x02df, 0x051b, 0x077e, 0x0ae0, 0x0bcc, 0x0a2e, 0x06ab,
-	0xffcb, 0xfa72, 0xf8fb, 0xf8cd, 0xf85c, 0xf4a2, 0xf364, 0xf7da,
-	0xfcfd, 0x034a, 0x0754, 0x077b, 0x066a, 0x0444, 0x01c5, 0xffe2,
-	0x005f, 0x005e, 0x00be, 0x02d3, 0x0051, 0xfa8a, 0xf81d, 0xf92f,
-	0xfc8a, 0xff6a, 0xffba, 0xffa8, 0xff44, 0x00ef, 0x03bb, 0x02a0,
-	0xffb0, 0xfc30, 0xf92d, 0xfabd, 0xff96, 0x009b, 0x00a8, 0x04c9,
-	0x06aa, 0x0611, 0x0482, 0x0157, 0xffa4, 0xfeda, 0xfe0e, 0xfd28,
-	0xfab1, 0xf86b, 0xf881, 0xfadf, 0xfd9c, 0xfc02, 0xf7ee, 0xf8e0,
-	0xff8f, 0x06ed, 0x0c52, 0x0f54, 0x0d3c, 0x0963, 0x0635, 0x026e,
-	0xffdd, 0xfc1d, 0xf905, 0xf930, 0xf8d3, 0xf67a, 0xf57e, 0xf754,
-	0xfb43, 0x00ea, 0x032f, 0x0326, 0x0499, 0x05bb, 0x079b, 0x09ed,
-	0x0768, 0x019c, 0xfc83, 0xf893, 0xf953, 0xf83f, 0xf45c, 0xf4e4,
-	0xf7e2, 0xfbe2, 0x00cd, 0x0547, 0x06b2, 0x0710, 0x0566, 0x0209,
-	0x00b8, 0xfe48, 0xfcb8, 0xff8b, 0x0254, 0x00db, 0xfe0c, 0xfbcc,
-	0xfbc6, 0xfefd, 0x0347, 0x0434, 0x000d, 0xfda4, 0xfe66, 0xff02,
-	0xff80, 0x005f, 0xfd70, 0xf910, 0xf9f9, 0xfb2e, 0xfaa8, 0xfd28,
-	0x03ad, 0x0851, 0x086b, 0x081d, 0x0753, 0x03c3, 0xffba, 0xff4f,
-	0xfd85, 0xf7dc, 0xf58b, 0xf743, 0xfad4, 0xfcb7, 0xf90d, 0xf426,
-	0xf2c8, 0xf6d6, 0x01c2, 0x0c5c, 0x0f7d, 0x10ed, 0x107d, 0x0c3e,
-	0x0872, 0x04c5, 0xfec8, 0xf8c0, 0xf683, 0xf4ab, 0xf36f, 0xf36a,
-	0xf481, 0xf93a, 0xfdb1, 0x01e1, 0x06d5, 0x06fa, 0x05f7, 0x09bc,
-	0x0d50, 0x0d3c, 0x0769, 0x00bb, 0xfd32, 0xf932, 0xf4e3, 0xf200,
-	0xf43f, 0xf59e, 0xf775, 0xfc14, 0xfb6d, 0xfdd5, 0x04fb, 0x0975,
-	0x0a9c, 0x0880, 0x06a4, 0x058b, 0x04ac, 0x0564, 0x014c, 0xf84f,
-	0xf2bc, 0xf21b, 0xf7cc, 0xfe5c, 0x00c2, 0xfe95, 0xf8c1, 0xf8bd,
-	0xffdb, 0x0641, 0x05f3, 0x0335, 0x0334, 0x0133, 0xffc9, 0x0247,
-	0x0282, 0x017c, 0x0258, 0x030d, 0x0226, 0xfdeb, 0xfb3c, 0xfa75,
-	0xf740, 0xf6a4, 0xf975, 0xfb34, 0xfc12, 0x01dc, 0x0775, 0x0580,
-	0x0510, 0x03b9, 0x010f, 0x02ac, 0x01fa, 0x0280, 0x067e, 0x07d6,
-	0x0794, 0x043b, 0xfca2, 0xf8f6, 0xf9a3, 0xf8d7, 0xf667, 0xf4e8,
-	0xf4d0, 0xf704, 0xfe1c, 0x04cf, 0x06c3, 0x0544, 0x01ff, 0x0107,
-	0x0439, 0x0944, 0x0c28, 0x077e, 0xfc81, 0xf618, 0xf749, 0xfa1c,
-	0xfc12, 0xfc3d, 0xfe47, 0x0111, 0x01fe, 0x023b, 0x00ea, 0xfe82,
-	0xfc18, 0xfa3f, 0xf87e, 0xf7de, 0xf9a9, 0xffb6, 0x034b, 0x028a,
-	0x04d1, 0x04f8, 0x03f2, 0x0762, 0x093a, 0x05e3, 0x05ef, 0x0626,
-	0x015a, 0xfcb4, 0xf6ee, 0xf3d9, 0xf484, 0xf368, 0xf35b, 0xf520,
-	0xf3ee, 0xf5c0, 0xff69, 0x080b, 0x0ae4, 0x0d63, 0x0ebe, 0x0b38,
-	0x09ef, 0x081e, 0x0547, 0x025f, 0xf969, 0xf4b6, 0xf68f, 0xf8f1,
-	0xfd70, 0xfc74, 0xf60f, 0xf5ba, 0xf9e8, 0xfedc, 0x0353, 0x0507,
-	0x03db, 0x0216, 0x049e, 0x06c6, 0x0650, 0x06a8, 0x04b9, 0xff70,
-	0xf9a9, 0xf602, 0xf70c, 0xfb25, 0xfda5, 0xfcda, 0xfda6, 0xfe90,
-	0xfe48, 0x05b7, 0x0dd2, 0x0f5e, 0x0f8e, 0x0c15, 0x0387, 0xf9cb,
-	0xf18a, 0xeb97, 0xea40, 0xee64, 0xf47e, 0xfba7, 0xfea8, 0xfc30,
-	0x02e0, 0x0b77, 0x0c3d, 0x0d71, 0x0adc, 0x071a, 0x0744, 0x05b4,
-	0x044e, 0x001d, 0xf87c, 0xf75f, 0xf9b9, 0xf98e, 0xf937, 0xf901,
-	0xf80b, 0xf6ef, 0xfa75, 0xfea7, 0x01b1, 0x06f5, 0x0555, 0xfe63,
-	0xf9c2, 0xfa4b, 0x007f, 0x07fe, 0x0bec, 0x087b, 0x0238, 0x0121,
-	0x0428, 0x0650, 0x06ce, 0x0431, 0x016e, 0xfc7a, 0xf36c, 0xebe8,
-	0xeb80, 0xf00d, 0xf529, 0xfc6e, 0xfdf5, 0xfea1, 0x0714, 0x0c89,
-	0x0e50, 0x12b6, 0x1374, 0x0fbe, 0x06f5, 0xfa9e, 0xf3ff, 0xf0f9,
-	0xf1d0, 0xf5ea, 0xf860, 0xf9e5, 0xfce8, 0x03ec, 0x08e3, 0x05a8,
-	0x0226, 0x0023, 0xff79, 0x0158, 0x0217, 0x029e, 0xfea9, 0xf7e4,
-	0xf603, 0xf846, 0xfb64, 0xfe31, 0x0258, 0x0582, 0x0487, 0x0567,
-	0x09cc, 0x0b6d, 0x0afb, 0x0655, 0xfa8d, 0xf304, 0xf280, 0xf1f7,
-	0xf3ad, 0xf709, 0xf6e7, 0xfa99, 0x0039, 0x023d, 0x08fe, 0x0e68,
-	0x0edf, 0x10bf, 0x0ef0, 0x0462, 0xfc2d, 0xf6bb, 0xf0f6, 0xf182,
-	0xf460, 0xf38a, 0xf18e, 0xf66f, 0xfd8a, 0x06b5, 0x0e38, 0x0dee,
-	0x0d41, 0x0b68, 0x0661, 0x0350, 0xff82, 0xf964, 0xfa2e, 0xf866,
-	0xf02c, 0xee3c, 0xf49f, 0xfc67, 0xfecf, 0xffef, 0x0071, 0x0333,
-	0x0b71, 0x1012, 0x10e6, 0x1003, 0x0947, 0x0600, 0x050f, 0xfa97,
-	0xf239, 0xeee6, 0xe98b, 0xea23, 0xf27d, 0xf9ce, 0x0077, 0x08e2,
-	0x08a8, 0x060c, 0x0856, 0x06cc, 0x07dd, 0x0b99, 0x07cf, 0x035e,
-	0x01d6, 0xfd9b, 0xfaf9, 0xfbd0, 0xfaef, 0xfbd7, 0x01b4, 0xff48,
-	0xf726, 0xf467, 0xf33a, 0xf8fa, 0xfec6, 0xfb91, 0xfc2a, 0xfedd,
-	0x005c, 0x05e5, 0x0a96, 0x0cd0, 0x0e5f, 0x0eb4, 0x075d, 0xfcdd,
-	0xfb05, 0xfb02, 0xfa9e, 0xfcc0, 0xf831, 0xf3de, 0xf73a, 0xfa0f,
-	0xfca3, 0xfce8, 0xfbe0, 0xfddf, 0x0209, 0x0658, 0x0841, 0x0979,
-	0x0301, 0xfcfb, 0x02f4, 0x05a9, 0x00e7, 0xfdf6, 0xfb74, 0xf790,
-	0xf7fb, 0xfaa1, 0xfcd5, 0x0214, 0x075d, 0x0915, 0x07f8, 0x00d1,
-	0xf926, 0xfb19, 0xfc0a, 0xfb52, 0xfe01, 0xfe0a, 0xfdff, 0xfeca,
-	0xfecc, 0xfedd, 0xffba, 0x0156, 0x0223, 0x0221, 0xffd3, 0xfdc8,
-	0x01fe, 0x053c, 0x0505, 0x04a5, 0xfe99, 0xfbc1, 0x0163, 0x0461,
-	0x0299, 0xfe10, 0xf874, 0xf436, 0xf2da, 0xf3d7, 0xf686, 0xfd4f,
-	0x0408, 0x044f, 0x03ff, 0x0779, 0x0af5, 0x0bd2, 0x072b, 0xfefa,
-	0xfbe9, 0xfd2a, 0xfcbe, 0xfbd8, 0xfae2, 0xf917, 0xfb75, 0x00b5,
-	0xffa7, 0xfbf7, 0xfe26, 0x042e, 0x05f1, 0x043b, 0x03b5, 0x039a,
-	0x0285, 0xff59, 0xfbf1, 0xf829, 0xf338, 0xf2c1, 0xf862, 0xfc47,
-	0xfd72, 0xff81, 0x050f, 0x0bad, 0x0ea9, 0x100f, 0x107a, 0x0d6a,
-	0x0839, 0xfea2, 0xf0e1, 0xe6ea, 0xe655, 0xed8a, 0xf4e2, 0xf7c6,
-	0xf8a0, 0xfa7c, 0xff63, 0x0a02, 0x12c4, 0x16bd, 0x181e, 0x12ba,
-	0x0921, 0x0149, 0xfa4d, 0xf3e1, 0xf157, 0xeffc, 0xf00a, 0xf436,
-	0xf873, 0xf83f, 0xfb84, 0x0256, 0x037d, 0x0582, 0x07cf, 0x0840,
-	0x0c2e, 0x0bc2, 0x0463, 0xffee, 0xff0e, 0xfcb0, 0xf924, 0xf84c,
-	0xf907, 0xfa8d, 0xfdd6, 0x01ed, 0x059e, 0x077b, 0x0769, 0x04e6,
-	0xfdea, 0xf4f0, 0xf123, 0xf39d, 0xf777, 0xf97f, 0xfe9b, 0x052d,
-	0x0693, 0x04a8, 0x0477, 0x09d2, 0x0e51, 0x0d89, 0x098c, 0xfee2,
-	0xf3d9, 0xf1c0, 0xf450, 0xf67f, 0xf6c2, 0xf8b8, 0xfb9d, 0x00d1,
-	0x097f, 0x09b6, 0x0589, 0x05ae, 0x04f9, 0x051a, 0x0252, 0xf9fd,
-	0xf73d, 0xf8ba, 0xf61c, 0xf2a2, 0xf349, 0xf729, 0xff0e, 0x09e0,
-	0x0d6b, 0x0aa6, 0x0b7f, 0x0ca3, 0x0cd6, 0x0bb3, 0x0518, 0xffd7,
-	0xfc60, 0xf7a3, 0xf043, 0xe9be, 0xe9bb, 0xed84, 0xf308, 0xf952,
-	0x03af, 0x0c92, 0x0e69, 0x11a7, 0x14f5, 0x1194, 0x0969, 0xfff8,
-	0xf982, 0xf761, 0xf573, 0xf5b6, 0xf6f8, 0xf72d, 0xf840, 0xfe48,
-	0x07dc, 0x0856, 0x0584, 0x0622, 0x0297, 0xfe54, 0xfed5, 0xfe61,
-	0xf9e4, 0xf522, 0xf2a1, 0xf1f9, 0xf4fc, 0xfbfb, 0x02df, 0x0a23,
-	0x0e1e, 0x0d89, 0x0b1e, 0x060f, 0x044d, 0x07cb, 0x09d1, 0x0650,
-	0x007a, 0xf9eb, 0xf281, 0xed1c, 0xeb91, 0xedbd, 0xf0cb, 0xf54d,
-	0xff4f, 0x0884, 0x091e, 0x073b, 0x07d8, 0x0b56, 0x0f82, 0x0d9a,
-	0x0569, 0xff8e, 0xfe50, 0xfe12, 0xfbc4, 0xf80e, 0xf5df, 0xf9e8,
-	0x0304, 0x043b, 0xfbb4, 0xf2c9, 0xf2db, 0xfb4f, 0x0141, 0x00e5,
-	0x0083, 0x051f, 0x07d4, 0x0588, 0x04c2, 0x05cb, 0x0302, 0x0170,
-	0x0106, 0xfa8b, 0xf295, 0xf3ad, 0xfc93, 0x027f, 0x0524, 0x04cb,
-	0x0276, 0x010c, 0xfff1, 0x017b, 0x01ab, 0x017c, 0x01fc, 0x0081,
-	0xfe3d, 0xf93c, 0xf5f5, 0xf7f5, 0xfa8a, 0xfd45, 0x0265, 0x050f,
-	0x03e9, 0x01e4, 0x0001, 0xfd92, 0xfe5f, 0x040f, 0x052a, 0x050c,
-	0x058a, 0x059e, 0x0451, 0xfbaa, 0xf460, 0xf41e, 0xf764, 0xfa6c,
-	0xfb23, 0xfb7a, 0xfc93, 0xfe8b, 0x0174, 0x0411, 0x050b, 0x031d,
-	0x0231, 0x04ff, 0x0545, 0x0555, 0x04c3, 0x0209, 0x03e8, 0x044e,
-	0x00f4, 0xff5b, 0xfc10, 0xf6a8, 0xf4af, 0xf5ef, 0xf06c, 0xe941,
-	0xefbd, 0xfce7, 0x0645, 0x095c, 0x089f, 0x0bff, 0x11d2, 0x12d5,
-	0x0fb9, 0x0a0c, 0x03db, 0xfff9, 0xfe96, 0xf992, 0xeecf, 0xec60,
-	0xf17a, 0xf55d, 0xf820, 0xf75e, 0xf937, 0x00b5, 0x09bf, 0x1051,
-	0x0fbc, 0x0aba, 0x0785, 0x0611, 0xffcd, 0xf7cf, 0xf52e, 0xf464,
-	0xf4f6, 0xf8fa, 0xf736, 0xf4f5, 0xfa57, 0x0136, 0x09ff, 0x1082,
-	0x12c4, 0x14fb, 0x13ca, 0x06a8, 0xf56e, 0xecda, 0xe8a5, 0xe99f,
-	0xef22, 0xf2f8, 0xf8bd, 0x016b, 0x03ea, 0x03fe, 0x0aa9, 0x1110,
-	0x149b, 0x1517, 0x0eb4, 0x0269, 0xf7d9, 0xf46b, 0xf3a4, 0xf2d3,
-	0xf240, 0xf553, 0xfabb, 0xfbad, 0xfafd, 0xffe0, 0x0611, 0x0978,
-	0x0c61, 0x0bc6, 0x06b5, 0xfea6, 0xfa44, 0xfb4c, 0xfbb1, 0xf7e0,
-	0xf4ad, 0xf7ee, 0xfa4d, 0xfc19, 0x015c, 0x02de, 0x0595, 0x0f00,
-	0x1294, 0x0ce1, 0x0652, 0xfed3, 0xf82a, 0xf6b6, 0xf492, 0xf1e8,
-	0xf2ee, 0xf486, 0xf747, 0xfcd8, 0xfe7d, 0x0050, 0x09f8, 0x10d7,
-	0x0fe8, 0x0ae7, 0x0251, 0xf95a, 0xf692, 0xf7db, 0xf9c0, 0xfd4d,
-	0x0052, 0x054d, 0x09ab, 0x073c, 0x00c0, 0xfe9e, 0x0119, 0x011c,
-	0xfd04, 0xf745, 0xf6ee, 0xfac0, 0xf9e3, 0xf55b, 0xf3fc, 0xf6ff,
-	0xfce0, 0x0384, 0x098b, 0x0d8b, 0x1083, 0x1291, 0x101f, 0x0a51,
-	0x025f, 0xfd0c, 0xfdb8, 0xf7f6, 0xecc2, 0xe9fe, 0xeb5b, 0xec70,
-	0xf05a, 0xf7bb, 0xff9f, 0x08d0, 0x12ff, 0x16b9, 0x1599, 0x121e,
-	0x0c35, 0x07cf, 0x01ca, 0xf77f, 0xf14c, 0xee00, 0xed93, 0xf230,
-	0xf5bb, 0xf843, 0xfdf8, 0x0752, 0x0ba8, 0x08c6, 0x06a4, 0x06fd,
-	0x07f8, 0x05fd, 0x0214, 0x004f, 0xfc7d, 0xf8ff, 0xf919, 0xf893,
-	0xf84c, 0xf9b3, 0xfed4, 0x00fb, 0xfc05, 0xfa46, 0xfc1f, 0x019b,
-	0x090b, 0x0cab, 0x0f44, 0x0c70, 0x03c3, 0xfbcb, 0xf728, 0xf64c,
-	0xf574, 0xf727, 0xfbf9, 0xff27, 0x0005, 0xfb45, 0xf998, 0x002b,
-	0x0295, 0x0243, 0x054f, 0x0615, 0x04db, 0x0405, 0x018a, 0xfd80,
-	0xfc89, 0x003d, 0x0368, 0x0364, 0xfdfd, 0xf9d0, 0xfb96, 0xfb58,
-	0xf828, 0xf741, 0xf8c9, 0xfbc1, 0x0028, 0x0346, 0x0408, 0x052d,
-	0x08d1, 0x08b1, 0x0492, 0xff71, 0xfa55, 0xf881, 0xf908, 0xfccd,
-	0x015a, 0x0275, 0x0381, 0x0714, 0x0640, 0xff52, 0xfc00, 0xfff6,
-	0x01a8, 0xfdbd, 0xf8e5, 0xf506, 0xf5b1, 0xf777, 0xf7a1, 0xfbe8,
-	0xffc8, 0x014f, 0x06b8, 0x08d9, 0x042b, 0x029d, 0x05f3, 0x0758,
-	0x06a0, 0x04b7, 0x02dc, 0x0397, 0x00bb, 0xf680, 0xf051, 0xf23b,
-	0xf4c2, 0xf7c6, 0xfc4d, 0x00be, 0x051a, 0x0835, 0x0858, 0x0797,
-	0x0466, 0x0002, 0x00fd, 0x04c3, 0x046b, 0xffbd, 0xfc7a, 0xfb52,
-	0xfb0a, 0xfd94, 0x000c, 0x00b9, 0x0145, 0x01e1, 0x0156, 0xfc49,
-	0xf4ee, 0xf0ed, 0xf25d, 0xf580, 0xf99a, 0x0086, 0x0521, 0x0afb,
-	0x1193, 0x0ff7, 0x0a9d, 0x08a7, 0x06e4, 0x029b, 0xfbce, 0xf39e,
-	0xf080, 0xf1ac, 0xf37a, 0xf8a1, 0xfea3, 0xfc69, 0xfa1e, 0x0392,
-	0x0b9f, 0x0c9e, 0x0d5f, 0x0db6, 0x0c18, 0x0803, 0xff82, 0xf6a0,
-	0xf195, 0xef54, 0xf041, 0xf164, 0xf1aa, 0xf1f9, 0xf6e4, 0x0046,
-	0x07ce, 0x0fbc, 0x1891, 0x2015, 0x1f17, 0x12b2, 0x03c1, 0xfa58,
-	0xf3b1, 0xeb3d, 0xe625, 0xe739, 0xeb53, 0xeff9, 0xf498, 0xf8fa,
-	0x0076, 0x08ec, 0x10cc, 0x17d3, 0x1771, 0x11aa, 0x0c63, 0x051d,
-	0xfb3f, 0xf5f2, 0xf542, 0xf604, 0xf935, 0xfafb, 0xf7ad, 0xf6e2,
-	0xfa5e, 0xfe4d, 0x029a, 0x00c1, 0xfd67, 0x010a, 0x03b3, 0x02f1,
-	0x01c4, 0xfe35, 0xf9bb, 0xfb22, 0x01a0, 0x0162, 0xfd67, 0x00c5,
-	0x084a, 0x0cbb, 0x0bce, 0x08ad, 0x05a9, 0xff78, 0xf7f4, 0xf37b,
-	0xf14e, 0xf0c2, 0xf070, 0xf410, 0xf9f0, 0xfde9, 0x01d5, 0x0663,
-	0x0c45, 0x0f30, 0x0e6c, 0x0cf8, 0x08e6, 0x023b, 0xfc47, 0xf78a,
-	0xf2ac, 0xf0ad, 0xf5cc, 0xfe76, 0x052c, 0x064a, 0x0175, 0x0084,
-	0x03fd, 0x0198, 0xfd67, 0xfb69, 0xfadf, 0xfba0, 0xfadb, 0xfaa6,
-	0xf9cf, 0xfa1e, 0xfe07, 0x031c, 0x08bc, 0x0c77, 0x0dfb, 0x0be0,
-	0x04c6, 0xfeeb, 0xfe21, 0xfe6a, 0xfe34, 0xfd54, 0xfaa7, 0xf5c1,
-	0xf2d8, 0xf478, 0xf3ae, 0xf3dc, 0xfb9c, 0x06c9, 0x0d6f, 0x0f37,
-	0x0df0, 0x0940, 0x05fe, 0x0332, 0x006f, 0xfc7a, 0xf554, 0xf26d,
-	0xf559, 0xf76e, 0xf718, 0xfb00, 0x04ff, 0x0c24, 0x09fc, 0x04c6,
-	0x0305, 0x0452, 0x04c6, 0x030a, 0xff16, 0xf97b, 0xf832, 0xf9ad,
-	0xf7fd, 0xf5b2, 0xf790, 0xfc91, 0x0429, 0x0952, 0x0638, 0x0073,
-	0xfeb4, 0xffb7, 0x0261, 0x0861, 0x0ce7, 0x0b90, 0x0568, 0xff14,
-	0xfa70, 0xf549, 0xf1bb, 0xf1dc, 0xf5af, 0xf90d, 0xf7f8, 0xf88e,
-	0xf974, 0xfa8b, 0x01dd, 0x077c, 0x0ae7, 0x0fb7, 0x11c0, 0x0eb0,
-	0x0831, 0x03e8, 0x0242, 0x0158, 0x00ed, 0xfddf, 0xf97f, 0xf3a8,
-	0xed8f, 0xed8d, 0xeec9, 0xef0f, 0xf3ff, 0xfb55, 0x0284, 0x09ef,
-	0x109d, 0x1511, 0x1413, 0x0ea2, 0x0a42, 0x067b, 0xff0c, 0xf72e,
-	0xf54c, 0xf4a0, 0xf2dd, 0xf58f, 0xfb10, 0xfe7b, 0xff12, 0xfe7f,
-	0x005e, 0x0619, 0x09a6, 0x04ce, 0xfe34, 0xfba7, 0xf9e0, 0xfb1c,
-	0xfb02, 0xf91f, 0xfc80, 0x01f7, 0x0635, 0x0672, 0x0345, 0x0257,
-	0x03f8, 0x03f1, 0x004a, 0xfd60, 0x0048, 0x0279, 0x00ad, 0xfc62,
-	0xf68c, 0xf54f, 0xf6e0, 0xf81b, 0xfb57, 0xfe98, 0x02b7, 0x092c,
-	0x0c6e, 0x0a1d, 0x04ff, 0xff95, 0xfbb7, 0xfc9f, 0x0032, 0xff06,
-	0xfa33, 0xf809, 0xf9ae, 0xfcf0, 0xff68, 0x037a, 0x09b3, 0x0bf9,
-	0x089b, 0x03a8, 0xfd97, 0xf4f1, 0xf120, 0xf1e7, 0xf32b, 0xf86e,
-	0xfedd, 0x036d, 0x0428, 0x0213, 0x0430, 0x0966, 0x0c83, 0x0b93,
-	0x06fc, 0x02fa, 0xfe8c, 0xf8b2, 0xf79d, 0xf991, 0xfaaa, 0xfb05,
-	0xfa4b, 0xfc4f, 0x002d, 0x02b9, 0x047f, 0x05ad, 0x0662, 0x048e,
-	0x005f, 0xfacd, 0xf71a, 0xf6e6, 0xf758, 0xf793, 0xf9cf, 0xfc2e,
-	0xfd17, 0xfdf6, 0xfeaa, 0x0401, 0x106e, 0x1b65, 0x1aef, 0x128c,
-	0x070a, 0xfb75, 0xf46b, 0xec4b, 0xe527, 0xe412, 0xe9b3, 0xf2a7,
-	0xf81c, 0xfc16, 0x0082, 0x0888, 0x119b, 0x16d9, 0x1a22, 0x1849,
-	0x0ea1, 0x059e, 0xffe2, 0xf709, 0xf158, 0xf16d, 0xf3ed, 0xf53a,
-	0xf329, 0xf240, 0xf641, 0xfe17, 0x02bf, 0x0383, 0x028b, 0x02c0,
-	0x0718, 0x0b59, 0x09f4, 0x0494, 0x01e1, 0x0152, 0x0018, 0xfd23,
-	0xf7fe, 0xf826, 0xfd80, 0xff17, 0xff65, 0x0158, 0x01b5, 0x0162,
-	0x001a, 0xfd53, 0xfe41, 0x00b5, 0x0038, 0xfe58, 0xfd75, 0xfd63,
-	0xfe04, 0x01ab, 0x02b2, 0x024e, 0x02da, 0x0090, 0xfee0, 0xfe81,
-	0xfb6b, 0xf639, 0xf40b, 0xf5b8, 0xfb41, 0x03ce, 0x08df, 0x0902,
-	0x09e9, 0x095d, 0x05f2, 0x026b, 0xfd4f, 0xf8e0, 0xf86b, 0xfa46,
-	0xf98c, 0xf825, 0xf96d, 0xf990, 0xf973, 0xf9e9, 0xfdfa, 0x07b5,
-	0x0c2c, 0x0a74, 0x0877, 0x02f7, 0xfdbf, 0xfedb, 0x02d4, 0x065c,
-	0x05e9, 0x021a, 0xff33, 0xfc80, 0xf784, 0xf2cf, 0xf437, 0xf89b,
-	0xfda2, 0x02d0, 0x0275, 0xfed4, 0xff46, 0x011a, 0x01db, 0x027f,
-	0xffef, 0xfe78, 0xffa8, 0xfe93, 0xfc14, 0xffc7, 0x0764, 0x0a14,
-	0x0874, 0x023e, 0xfd1d, 0xfdf7, 0xfd30, 0xfa67, 0xf7e5, 0xf7ca,
-	0xfa3a, 0xfc6e, 0xfda1, 0xfc00, 0xfd47, 0x026b, 0x05aa, 0x084f,
-	0x061f, 0xff44, 0xfaed, 0xf8ff, 0xfb54, 0x0134, 0x0673, 0x0a9f,
-	0x0c06, 0x07b3, 0xff45, 0xf9b4, 0xf7b0, 0xf75f, 0xf98b, 0xfaf4,
-	0xf881, 0xf5d2, 0xf5c6, 0xf729, 0xfa94, 0xfdab, 0x031f, 0x0e17,
-	0x129a, 0x0e38, 0x0a3e, 0x06f0, 0x02bf, 0x003e, 0xff6a, 0xfd36,
-	0xfa21, 0xf6ad, 0xf53c, 0xf516, 0xf3e2, 0xf2d5, 0xf459, 0xf94f,
-	0xffde, 0x07f8, 0x0f54, 0x129d, 0x1128, 0x0f14, 0x09c5, 0x0220,
-	0xfc87, 0xf512, 0xf004, 0xedb3, 0xed0f, 0xf053, 0xf8bf, 0x00ce,
-	0x0385, 0x06ad, 0x0b5c, 0x1046, 0x119f, 0x0d04, 0x04ea, 0xff16,
-	0xfc5d, 0xf82e, 0xf3f4, 0xf078, 0xf271, 0xf885, 0xfaae, 0xfb89,
-	0xfe4d, 0x0091, 0x034f, 0x0604, 0x0633, 0x0722, 0x099c, 0x0d60,
-	0x0d97, 0x07c1, 0xffbd, 0xf87e, 0xf661, 0xf49d, 0xf142, 0xf310,
-	0xf944, 0x001e, 0x0509, 0x04f3, 0x0012, 0xf9aa, 0xfa42, 0x0261,
-	0x07f9, 0x052a, 0xfe53, 0xfc91, 0xfbf2, 0xfb3b, 0xfe14, 0x0338,
-	0x093e, 0x0d65, 0x0ea9, 0x0a2e, 0x00a5, 0xf855, 0xf110, 0xebd0,
-	0xed27, 0xf144, 0xf749, 0xfd90, 0x00a4, 0x03a7, 0x068d, 0x0992,
-	0x0cab, 0x0cea, 0x0bad, 0x08ab, 0x0314, 0xfefa, 0xfc6b, 0xfbaf,
-	0xfa20, 0xf720, 0xf657, 0xf680, 0xf9b8, 0xfe0f, 0xff56, 0x01e1,
-	0x0585, 0x0700, 0x05fe, 0x02bd, 0x0044, 0xfe52, 0xfc11, 0xfbab,
-	0xfc80, 0xfd54, 0xf7c6, 0xf0d0, 0xf21b, 0xfa36, 0x06c8, 0x106e,
-	0x1537, 0x12b9, 0x0bda, 0x07a6, 0x02d2, 0xfb27, 0xf16f, 0xebd8,
-	0xef45, 0xf44d, 0xf73e, 0xfa58, 0xfb53, 0xfe69, 0x043c, 0x0b29,
-	0x1094, 0x0f58, 0x0ce2, 0x0a17, 0x03bc, 0xfa4a, 0xf197, 0xf118,
-	0xf758, 0xfb46, 0xfc1e, 0xfc2b, 0xfe14, 0x02d4, 0x0422, 0x00fa,
-	0xfd80, 0xff10, 0x05e7, 0x09c4, 0x0794, 0x025e, 0xfdc6, 0xfb56,
-	0xfa49, 0xf905, 0xf599, 0xf3f6, 0xf793, 0xfdcc, 0x0422, 0x0819,
-	0x0896, 0x06d1, 0x04d6, 0x05bd, 0x0655, 0x04f5, 0x0202, 0xfc4c,
-	0xf8b3, 0xf99c, 0xfa34, 0xf93a, 0xf977, 0xfb17, 0xfb9b, 0xfcd4,
-	0x0199, 0x0476, 0x0200, 0xfc55, 0xf87f, 0xfa3b, 0xfd79, 0x0286,
-	0x0a65, 0x0f52, 0x0fc9, 0x0da8, 0x0760, 0xff99, 0xf9ae, 0xf581,
-	0xf3d5, 0xf375, 0xf42a, 0xf6bd, 0xfa80, 0xfb1b, 0xf954, 0xfab5,
-	0x00b6, 0x0815, 0x0c4d, 0x0d71, 0x09ef, 0x048d, 0x026d, 0x024f,
-	0x01fc, 0xffd5, 0xfdd1, 0xfe6d, 0xff5d, 0xff38, 0xfb27, 0xf1b7,
-	0xeca1, 0xf2a3, 0xfc60, 0x00cb, 0x0149, 0x025e, 0x049b, 0x07e3,
-	0x08b9, 0x059f, 0x0281, 0x0092, 0xff20, 0xfd5e, 0xfc42, 0xfd69,
-	0x00a2, 0x02dc, 0x0055, 0xfbfb, 0xf9d3, 0xfbce, 0x005b, 0x00de,
-	0xfe1a, 0xfe1c, 0xffe8, 0x0146, 0x0279, 0x0416, 0x039f, 0x0230,
-	0x0482, 0x060d, 0x0323, 0xfb94, 0xf37a, 0xf078, 0xf239, 0xf621,
-	0xfcb8, 0x0589, 0x0c00, 0x0e73, 0x0e94, 0x0b75, 0x057b, 0x0082,
-	0xfb73, 0xf722, 0xf671, 0xf7b6, 0xf883, 0xf4fc, 0xf0b3, 0xf381,
-	0xfbb6, 0x0356, 0x07fa, 0x0a77, 0x0a6b, 0x09f4, 0x0ae0, 0x0932,
-	0x04a5, 0x011a, 0xfea4, 0xfbef, 0xf905, 0xf6cf, 0xf692, 0xf5bf,
-	0xf31f, 0xf420, 0xfa34, 0x015a, 0x08b1, 0x0ecb, 0x108f, 0x0dc2,
-	0x088e, 0x0302, 0xfec9, 0xfaf5, 0xf45e, 0xecfc, 0xea78, 0xeee8,
-	0xf789, 0x0031, 0x05b6, 0x094b, 0x0e5e, 0x13f3, 0x13ce, 0x0f44,
-	0x089b, 0x021a, 0xff99, 0xf9b1, 0xf0d2, 0xeb94, 0xea62, 0xed1e,
-	0xf3ea, 0xfe08, 0x04e0, 0x07ce, 0x0931, 0x083d, 0x076e, 0x06c5,
-	0x073b, 0x0a9e, 0x0a3b, 0x057f, 0x0111, 0xfbfe, 0xf648, 0xf1de,
-	0xf00f, 0xef4a, 0xf339, 0xfd85, 0x0546, 0x075f, 0x0429, 0x0055,
-	0x0191, 0x0421, 0x04d3, 0x050f, 0x0312, 0xfeb2, 0xfa5c, 0xf8bf,
-	0xfab6, 0xff48, 0x064c, 0x0972, 0x0706, 0x04ec, 0x0358, 0x023b,
-	0xfd9b, 0xf55b, 0xf2b1, 0xf4a7, 0xf606, 0xf8c1, 0xfcde, 0x0036,
-	0x048e, 0x0a26, 0x0d0b, 0x0c46, 0x0777, 0x00b2, 0xfd0e, 0xfc7d,
-	0xfb5c, 0xf8a2, 0xf7c4, 0xf7db, 0xf887, 0xfbd9, 0xff66, 0x0305,
-	0x05d1, 0x06fa, 0x09b5, 0x0970, 0x04c3, 0x0227, 0xff50, 0xf941,
-	0xf44d, 0xf5d4, 0xf99b, 0xfa4a, 0xf92a, 0xf5f3, 0xf357, 0xf674,
-	0x0053, 0x0b57, 0x120c, 0x13e4, 0x122f, 0x0f66, 0x0a7c, 0x0365,
-	0xfbe2, 0xf238, 0xecc5, 0xef24, 0xf386, 0xf666, 0xf873, 0xfb03,
-	0xfecf, 0x03e9, 0x0642, 0x0858, 0x0d23, 0x0e76, 0x09cd, 0x03d5,
-	0xfea3, 0xfa39, 0xf994, 0xf9a7, 0xf878, 0xfb43, 0xff8d, 0x01ae,
-	0x0037, 0xfa87, 0xf8ad, 0xfcc1, 0x0218, 0x050d, 0x03c4, 0x0201,
-	0x01d2, 0x01ee, 0x00fa, 0xff4f, 0xfd68, 0xf960, 0xf5c4, 0xf665,
-	0xf8f9, 0xfc45, 0x0138, 0x0588, 0x0742, 0x07e9, 0x091a, 0x0962,
-	0x07e6, 0x051e, 0x0043, 0xfca7, 0xfb04, 0xfab5, 0xfa3d, 0xf556,
-	0xf101, 0xf3f5, 0xfadd, 0xffae, 0x01b6, 0x0273, 0x0020, 0xff04,
-	0x0223, 0x055d, 0x0977, 0x0e15, 0x1018, 0x0f2e, 0x0862, 0xfed8,
-	0xf8a8, 0xf368, 0xef69, 0xf00b, 0xf43a, 0xf723, 0xf772, 0xf93e,
-	0xfb72, 0xfe79, 0x052e, 0x0ca2, 0x107f, 0x0eab, 0x0935, 0x0322,
-	0xfe8e, 0xfc2c, 0xfa8d, 0xf8f0, 0xf7af, 0xfa02, 0xff5f, 0x02d6,
-	0x02e0, 0xff6b, 0xfbee, 0xfca6, 0xfe8b, 0xfed3, 0xfea9, 0xfee3,
-	0xff6c, 0xff8b, 0xffe6, 0x005f, 0x00c5, 0x018a, 0xffc6, 0xfc8e,
-	0xfbef, 0xfe6e, 0x03b7, 0x0862, 0x0792, 0x03eb, 0x014c, 0xff1f,
-	0xfc55, 0xf94c, 0xf77d, 0xf791, 0xfb6d, 0x0051, 0x030c, 0x0342,
-	0x0119, 0x020d, 0x0667, 0x065d, 0x0080, 0xfb7a, 0xf7c8, 0xf2e8,
-	0xf2c8, 0xf78c, 0xfb26, 0xfff2, 0x06c6, 0x0c46, 0x0e1c, 0x0ce9,
-	0x0b34, 0x0640, 0xfe89, 0xf81b, 0xf49b, 0xf383, 0xf2af, 0xf1a7,
-	0xf22b, 0xf347, 0xf84c, 0x00bd, 0x074d, 0x0d1d, 0x0f8a, 0x0f0a,
-	0x0cac, 0x0884, 0x057a, 0x045a, 0x02a4, 0xfe55, 0xfa5e, 0xf7d7,
-	0xf5aa, 0xf547, 0xf570, 0xf59e, 0xf8e8, 0xfd15, 0x0226, 0x083c,
-	0x0ccb, 0x0b5f, 0x071e, 0x07bd, 0x05d5, 0xff11, 0xf926, 0xf37e,
-	0xf004, 0xf39a, 0xfa22, 0xfe81, 0xfe30, 0xfe71, 0x043d, 0x08db,
-	0x0d26, 0x0ab7, 0x0566, 0x0717, 0x0647, 0x02b6, 0xfdb1, 0xf617,
-	0xef22, 0xed7d, 0xf20f, 0xf5f3, 0xf6bb, 0xfaee, 0xfdf2, 0xfd68,
-	0x027c, 0x04c5, 0x05fa, 0x0d48, 0x1252, 0x12aa, 0x0e5d, 0x07a9,
-	0x00f4, 0xfc34, 0xf8aa, 0xf295, 0xedf5, 0xeef0, 0xf0db, 0xf1cc,
-	0xf98b, 0xffd7, 0x0278, 0x0b8d, 0x10bc, 0x0efb, 0x0f02, 0x0afe,
-	0x00ea, 0xfa33, 0xf95f, 0xfcfe, 0x0181, 0x05f8, 0x02f1, 0xfba6,
-	0xfffd, 0x02f3, 0xfcd5, 0xf90f, 0xfa7c, 0xfd5d, 0xff2d, 0xfe5b,
-	0xf6a5, 0xf111, 0xf6ed, 0xfdbe, 0x0214, 0x067e, 0x00bf, 0xf804,
-	0xfca0, 0x0351, 0x04e9, 0x094d, 0x0b85, 0x0aeb, 0x0bad, 0x0492,
-	0xfa2b, 0xf69a, 0xf986, 0xfda3, 0xfbae, 0xf755, 0xf1b3, 0xeafd,
-	0xee6f, 0xf8a0, 0xfe99, 0x03a1, 0x0b04, 0x14ea, 0x1b64, 0x1520,
-	0x06a4, 0xfbc7, 0xf982, 0xf983, 0xf9f7, 0xff09, 0xffac, 0xfcef,
-	0xfea2, 0xfe3e, 0xfaac, 0xf754, 0xf901, 0xff22, 0x0487, 0x02b2,
-	0xfaf4, 0xf935, 0xfefb, 0x03e6, 0x04de, 0x06e5, 0x03a9, 0xfa19,
-	0xf879, 0xf96e, 0xf857, 0x0030, 0x068f, 0x066e, 0x096f, 0x047b,
-	0xfb06, 0xf925, 0xfb11, 0xfae4, 0xfa1b, 0xff52, 0x0180, 0xfe04,
-	0xfeeb, 0x00bc, 0x01f9, 0x032f, 0x01e0, 0x0183, 0x0310, 0x0569,
-	0x008c, 0xf5a0, 0xf4fe, 0xf640, 0xf42c, 0xfd04, 0x054e, 0x03f4,
-	0x059f, 0x0b2c, 0x0bbe, 0x0bc6, 0x0bad, 0x0951, 0x09b6, 0x0416,
-	0xf790, 0xe9bd, 0xe2f1, 0xe7b6, 0xecbc, 0xf619, 0x0084, 0xfe35,
-	0xf9b8, 0xfc0e, 0x0162, 0x0c84, 0x13e5, 0x1bdc, 0x2ac9, 0x29e0,
-	0x1a51, 0x077d, 0xf6f3, 0xe9a5, 0xdfbf, 0xdb35, 0xd50c, 0xd25f,
-	0xe193, 0xf4bd, 0x0150, 0x11ff, 0x16af, 0x18da, 0x20ea, 0x1c55,
-	0x11ff, 0x067e, 0xfba3, 0xf3d3, 0xecb3, 0xeff7, 0xfb25, 0xfb92,
-	0x0045, 0x097b, 0x0780, 0x086b, 0x0780, 0x01e7, 0x0387, 0x0515,
-	0xfa4d, 0xe88e, 0xe2ee, 0xedb0, 0xf737, 0xff35, 0x09ef, 0x0d74,
-	0x0fe9, 0x102e, 0x0850, 0x0317, 0x048b, 0x04ab, 0x01a2, 0xfd60,
-	0xf77b, 0xf648, 0xf94a, 0xfa0a, 0xf6f2, 0xf813, 0xfaee, 0xf4a4,
-	0xefbc, 0xf1f6, 0xfa65, 0x09c7, 0x0eee, 0x0bad, 0x13f4, 0x1b5f,
-	0x16f8, 0x0bd0, 0xfd7c, 0xf369, 0xeb92, 0xe793, 0xecc9, 0xf1ac,
-	0xf510, 0xfb09, 0xfd57, 0x02e2, 0x0c69, 0x0f09, 0x12f3, 0x1c09,
-	0x1a72, 0x0db2, 0xfdb2, 0xeaed, 0xe157, 0xe34d, 0xe7c4, 0xe89a,
-	0xeb48, 0xf9ef, 0x093c, 0x1278, 0x188f, 0x19ab, 0x1a04, 0x1ad7,
-	0x1048, 0xfd40, 0xf381, 0xeed6, 0xec26, 0xeee2, 0xf18a, 0xf4c2,
-	0xf948, 0xfec7, 0x037e, 0x08ef, 0x0c76, 0x0602, 0xfef3, 0x0293,
-	0x023a, 0xfa71, 0xf36f, 0xea79, 0xedce, 0xf92b, 0x0250, 0x0bdd,
-	0x1188, 0x164d, 0x15a3, 0x0cca, 0x0388, 0xfe0c, 0xfcb8, 0xff33,
-	0xf83f, 0xeba3, 0xea8c, 0xee6a, 0xf103, 0xf8ad, 0x03f2, 0x0a75,
-	0x0c6b, 0x0645, 0x0235, 0x0323, 0x0812, 0x0e2d, 0x0ad1, 0x0f13,
-	0x1177, 0x0727, 0xfda7, 0xf427, 0xeca3, 0xedf4, 0xefcc, 0xf00e,
-	0xf0ed, 0xf1e6, 0xf734, 0xfa21, 0x0176, 0x09d3, 0x0c61, 0x12e9,
-	0x1593, 0x14ab, 0x1297, 0x05ab, 0xf70f, 0xf310, 0xf224, 0xf30c,
-	0xf2f6, 0xecb6, 0xefa7, 0xfc2e, 0x0487, 0x08b6, 0x094c, 0x0c17,
-	0x1154, 0x07ff, 0xfb21, 0xf50a, 0xf2b6, 0xfc45, 0x00a7, 0xfd83,
-	0x0013, 0x022a, 0x03f8, 0x050c, 0x06e2, 0x09e0, 0x0578, 0x0474,
-	0x05d8, 0xfb94, 0xf5be, 0xf135, 0xe7f5, 0xec1c, 0xf5b4, 0xfc1c,
-	0x018c, 0x04f2, 0x0c72, 0x12f4, 0x123f, 0x0eae, 0x05e4, 0x02b6,
-	0x05b4, 0xfcc7, 0xf454, 0xf263, 0xef8d, 0xf55a, 0xf914, 0xfa76,
-	0x02c7, 0x02c1, 0xffb8, 0xfd31, 0xf7b4, 0xfd39, 0x041e, 0x0626,
-	0x0cbb, 0x1036, 0x0f02, 0x08f3, 0x007b, 0xfdcf, 0xfac4, 0xf426,
-	0xef40, 0xecbf, 0xebf8, 0xee8a, 0xf19a, 0xf5ad, 0xfe8e, 0x0a76,
-	0x169d, 0x1d17, 0x1f0d, 0x1df4, 0x0ff1, 0x0207, 0xf717, 0xe8e0,
-	0xe7a6, 0xe60f, 0xe0eb, 0xe637, 0xf51d, 0x0737, 0x0f12, 0x13e7,
-	0x1c5b, 0x1d1a, 0x15a5, 0x0804, 0xf194, 0xe81d, 0xef39, 0xf25f,
-	0xf4f5, 0xfb7a, 0x0131, 0x0450, 0x090c, 0x099c, 0x0943, 0x09a8,
-	0x074d, 0x0247, 0xf6a4, 0xee45, 0xe60b, 0xe21a, 0xeb8a, 0xf763,
-	0x001b, 0x092a, 0x10f3, 0x197b, 0x1d77, 0x18fe, 0x12f2, 0x087c,
-	0x049f, 0x0273, 0xf7ec, 0xea90, 0xe0a6, 0xe33b, 0xebc3, 0xf19e,
-	0xf699, 0xffc2, 0x05ee, 0x07df, 0x072b, 0x0747, 0x0e4b, 0x136c,
-	0x1398, 0x12d4, 0x1192, 0x09fe, 0xfba3, 0xf109, 0xf099, 0xefff,
-	0xecf2, 0xef22, 0xee02, 0xed7a, 0xf811, 0xfe7a, 0x0019, 0x0afd,
-	0x1364, 0x142d, 0x149b, 0x10ec, 0x0931, 0x0454, 0x0028, 0xf65d,
-	0xece3, 0xed12, 0xef06, 0xec3c, 0xefb3, 0xfa8b, 0x058d, 0x0d8e,
-	0x0ff7, 0x137f, 0x15e0, 0x0f4a, 0x0155, 0xedcd, 0xe70f, 0xef00,
-	0xf05c, 0xf2ec, 0xfa39, 0x004e, 0x09cc, 0x1004, 0x1164, 0x11f8,
-	0x0f25, 0x0dd0, 0x09b6, 0xfcf0, 0xefda, 0xe444, 0xe102, 0xe7fc,
-	0xeec3, 0xf98c, 0x06a3, 0x0ed0, 0x19b3, 0x20b9, 0x1b4d, 0x1506,
-	0x07b0, 0xfbbb, 0xfc70, 0xf1ee, 0xe150, 0xdeff, 0xe76f, 0xf18a,
-	0xf6e2, 0xfcf9, 0x06c6, 0x0d52, 0x124f, 0x0ce1, 0x0277, 0x03e8,
-	0x069a, 0x06af, 0x0784, 0x04e6, 0x000b, 0xfa84, 0xf850, 0xfb14,
-	0xf98d, 0xf9dc, 0xfd3c, 0xf67e, 0xf25a, 0xf7c1, 0xf749, 0xf7de,
-	0xfe50, 0x0311, 0x0bd2, 0x0f4f, 0x0ca6, 0x0a92, 0x07d5, 0x0a41,
-	0x05f4, 0xfc3f, 0xfbaa, 0xf8bc, 0xf2bc, 0xf0e7, 0xf0c6, 0xf912,
-	0x0082, 0xfff7, 0x0632, 0x0bc1, 0x07f6, 0xffd3, 0xf6d6, 0xf5b8,
-	0xfd24, 0x02b4, 0x04d7, 0x0676, 0x06e7, 0x08ad, 0x05e7, 0x02df,
-	0x018d, 0xff08, 0x0529, 0x0444, 0xf62b, 0xec78, 0xeaa8, 0xed5a,
-	0xf0da, 0xf326, 0xfb5c, 0x01b0, 0x0563, 0x104b, 0x1436, 0x16e9,
-	0x16c6, 0x0b1c, 0x0552, 0x04a5, 0xfbbc, 0xed2b, 0xe6f6, 0xec5f,
-	0xf4f9, 0xf9a6, 0xfd3a, 0x0182, 0x0619, 0x0c02, 0x0942, 0xff9c,
-	0xfda4, 0x0154, 0x053f, 0x0823, 0x0436, 0xff14, 0xfec2, 0xfee5,
-	0xff24, 0xfc35, 0xfc25, 0xfe4c, 0xf9fb, 0xf490, 0xf05a, 0xf1a2,
-	0xf81c, 0xfca7, 0x045e, 0x1033, 0x11e2, 0x0e7c, 0x0d8d, 0x0cf5,
-	0x0bdc, 0x030e, 0xf6c0, 0xefd2, 0xed79, 0xe94f, 0xe7f4, 0xedc9,
-	0xf9a2, 0x041f, 0x0954, 0x15b4, 0x1b2d, 0x12d8, 0x0c2e, 0x00bc,
-	0xf263, 0xefb3, 0xf3ca, 0xf605, 0xf72b, 0xfa62, 0x00c7, 0x0546,
-	0x073e, 0x0837, 0x099f, 0x0ff1, 0x10c2, 0x00c6, 0xf116, 0xed30,
-	0xeaa0, 0xe90d, 0xec5c, 0xf374, 0xfb07, 0x021c, 0x0b2d, 0x1387,
-	0x19e2, 0x1dc9, 0x1a5f, 0x13df, 0x0dc7, 0xffbf, 0xf108, 0xe67d,
-	0xe279, 0xe7a5, 0xe87c, 0xea3f, 0xf35d, 0xfbd9, 0x05be, 0x0d63,
-	0x0c92, 0x0c2e, 0x0fad, 0x1850, 0x1b5f, 0x0fec, 0x042f, 0xfc7d,
-	0xf4c6, 0xf0b3, 0xee44, 0xeb81, 0xf3ea, 0xf7f5, 0xf1b3, 0xf36d,
-	0xfa48, 0xfed3, 0x0089, 0x08ca, 0x10f5, 0x0a31, 0x0300, 0x060b,
-	0x05aa, 0x05f1, 0x0876, 0x01f3, 0xfcb5, 0xfa74, 0xf6b3, 0xf368,
-	0xf3af, 0xfcaa, 0x0342, 0x0670, 0x0ddd, 0x0c11, 0x04dd, 0x043e,
-	0xfd65, 0xf030, 0xeb40, 0xedcc, 0xf5cf, 0xfba8, 0xfe1d, 0x0860,
-	0x0f60, 0x0f8e, 0x0f3f, 0x0b66, 0x0c22, 0x0d5d, 0xfe93, 0xed34,
-	0xe40d, 0xe213, 0xe6f1, 0xea5e, 0xf394, 0xff60, 0x05f7, 0x1013,
-	0x1a62, 0x1e10, 0x1f4f, 0x1cd5, 0x1336, 0x0635, 0xf60f, 0xe6bc,
-	0xdbe3, 0xddc7, 0xe73a, 0xeb8a, 0xf60c, 0x042b, 0x0a34, 0x10d7,
-	0x1b7b, 0x18a9, 0x0b3c, 0x05f7, 0x0b24, 0x0b3f, 0xfe29, 0xf758,
-	0xf3f7, 0xf0b5, 0xf3c6, 0xf118, 0xf24f, 0xff82, 0x0569, 0x01a4,
-	0xfeb7, 0xfc5f, 0xfc19, 0xfccf, 0x02bc, 0x085e, 0x0262, 0xfe18,
-	0xffe8, 0x003a, 0x04f5, 0x0c27, 0x0c8a, 0x094c, 0x03b2, 0xfc74,
-	0xf595, 0xf08b, 0xf130, 0xf38a, 0xf7da, 0xfeb8, 0xfd64, 0xfac6,
-	0x0073, 0x0419, 0x00f9, 0xfb7a, 0xfe1c, 0x08c4, 0x0b2b, 0x084f,
-	0x095d, 0x07d2, 0x05e6, 0x029a, 0xfbd8, 0xfe97, 0x04c0, 0xffa8,
-	0xf402, 0xedcc, 0xeffd, 0xf15d, 0xf35e, 0xfc32, 0xff04, 0xfb90,
-	0x0384, 0x0da5, 0x0da1, 0x129f, 0x1b16, 0x19d8, 0x0fc8, 0xffd7,
-	0xf1bb, 0xeae7, 0xeb35, 0xef7d, 0xf38b, 0xfa2c, 0xfef8, 0xfcd3,
-	0xffe0, 0x08ce, 0x07ba, 0xfe8b, 0xfd5b, 0x02d5, 0x023f, 0xffa6,
-	0xffa5, 0x0064, 0x02f1, 0x0536, 0x00f6, 0xfcf6, 0x019c, 0x0341,
-	0xfe96, 0xf778, 0xf149, 0xf1b1, 0xf5f7, 0xfdee, 0x04dc, 0x0234,
-	0x0009, 0x0557, 0x0715, 0x0902, 0x0e51, 0x0f29, 0x0a53, 0xfd5e,
-	0xf27d, 0xed82, 0xe973, 0xed9b, 0xf61b, 0xfd43, 0x0815, 0x0d8e,
-	0x085f, 0x0b1d, 0x11b7, 0x0bcc, 0xff11, 0xf930, 0xf9f8, 0xf604,
-	0xf315, 0xf940, 0xfdbf, 0xfed6, 0x0372, 0x0419, 0x04e4, 0x08b7,
-	0x0881, 0x03e3, 0xfb1b, 0xf40d, 0xf020, 0xf0ea, 0xf62b, 0xf3e9,
-	0xeff9, 0xf859, 0x0072, 0x0648, 0x1356, 0x1fff, 0x270d, 0x217b,
-	0x10bd, 0xffbf, 0xf149, 0xe896, 0xe788, 0xe661, 0xe70e, 0xeba4,
-	0xec7d, 0xf542, 0x046f, 0x0c77, 0x106d, 0x12ee, 0x177a, 0x1a29,
-	0x10e5, 0x0654, 0x0292, 0xfd84, 0xf9ac, 0xf5a7, 0xf12e, 0xf0e2,
-	0xf56a, 0xfba3, 0xfa1b, 0xf674, 0xf91a, 0xfdc9, 0x04f3, 0x08e6,
-	0x0215, 0xfbb7, 0xfe05, 0xff8b, 0xfef7, 0x041b, 0x0dbd, 0x105c,
-	0x068d, 0xfd5d, 0xf7c1, 0xf1d6, 0xf539, 0xfc06, 0x01ed, 0x0800,
-	0x03e4, 0xfe66, 0x018d, 0x03a0, 0x00dc, 0xfa69, 0xf402, 0xf1a3,
-	0xef3c, 0xf2a7, 0xfc00, 0x0071, 0x07b2, 0x116a, 0x1302, 0x1296,
-	0x118c, 0x0d6c, 0x0728, 0xfd2d, 0xf259, 0xeccb, 0xed01, 0xecfd,
-	0xeb0f, 0xec24, 0xf40c, 0xfe1d, 0x085b, 0x1381, 0x20bb, 0x29ba,
-	0x2200, 0x0ed5, 0xfefa, 0xefc3, 0xe400, 0xe263, 0xe48f, 0xeb7f,
-	0xf0f5, 0xf710, 0x0098, 0x0909, 0x13e4, 0x1867, 0x15c8, 0x13c6,
-	0x0cc0, 0xff6f, 0xf898, 0xf526, 0xf0cc, 0xf216, 0xf2b7, 0xf126,
-	0xf285, 0xfb1a, 0x0685, 0x092f, 0x03cb, 0x010f, 0x02fd, 0x0579,
-	0x0417, 0xf880, 0xf184, 0xf4e2, 0xf63b, 0xf822, 0x03ac, 0x134c,
-	0x1a7e, 0x1a63, 0x13c7, 0x06bc, 0xf9ee, 0xf4d7, 0xf489, 0xf4fb,
-	0xf3b5, 0xef9e, 0xf04b, 0xf36e, 0xfaa4, 0x04d4, 0x085f, 0x094f,
-	0x0941, 0x053c, 0x018b, 0x017f, 0x0273, 0x048d, 0x0713, 0x07c0,
-	0x0323, 0xfa9c, 0xfab3, 0xfe2d, 0xf7cd, 0xf1d1, 0xf298, 0xf2ab,
-	0xf399, 0xf511, 0xf530, 0xf870, 0xfda2, 0x0184, 0x0804, 0x16da,
-	0x244f, 0x2303, 0x16af, 0x0989, 0xfc8d, 0xeffc, 0xed70, 0xeec3,
-	0xee37, 0xf1da, 0xf666, 0xf8cb, 0xfceb, 0x0623, 0x0d11, 0x0fbe,
-	0x0e71, 0x046e, 0xfa9b, 0xf950, 0xfa0b, 0xfa53, 0xfdd2, 0x01d9,
-	0x01c6, 0xfc67, 0xfe80, 0x07bd, 0x0707, 0x00b7, 0xfd61, 0xfcac,
-	0xfbc1, 0xf911, 0xf49e, 0xf2e7, 0xf5c7, 0xf9b3, 0xfe9c, 0x041d,
-	0x0d2c, 0x1727, 0x173c, 0x0e0b, 0x042a, 0xf67a, 0xee94, 0xf29d,
-	0xf485, 0xf40b, 0xf580, 0xf95c, 0xfde7, 0x04c1, 0x0db7, 0x1085,
-	0x0c11, 0x05a1, 0xfcf9, 0xf5f2, 0xf348, 0xf2a0, 0xf569, 0xfd2f,
-	0x05f0, 0x031f, 0xfeae, 0x0678, 0x0c73, 0x09b8, 0x05f6, 0x013b,
-	0xfaad, 0xf648, 0xf1bc, 0xec91, 0xecab, 0xf206, 0xf7e3, 0x001b,
-	0x0e59, 0x1ed3, 0x24da, 0x20ce, 0x190e, 0x07e9, 0xf86a, 0xf1ab,
-	0xe9f9, 0xe30f, 0xe36f, 0xe6f3, 0xea4a, 0xee71, 0xf91e, 0x0c2f,
-	0x18a8, 0x1a33, 0x1494, 0x0c59, 0x06ce, 0x0481, 0x035a, 0x002c,
-	0xfe1d, 0xf875, 0xf068, 0xef83, 0xf514, 0xf9cc, 0xfc16, 0x00be,
-	0x0448, 0x0574, 0x0261, 0xfd59, 0xfa6b, 0xf983, 0xfce1, 0xfc8c,
-	0xfac2, 0x0369, 0x0caf, 0x0dcf, 0x0eaf, 0x0a0d, 0x00e3, 0xff91,
-	0x029e, 0x012f, 0xfcd5, 0xfc9e, 0xfb2b, 0xf64f, 0xf5be, 0xfb4f,
-	0xfe1d, 0xfa37, 0xf7ff, 0xf351, 0xef49, 0xf469, 0xf97f, 0x02ed,
-	0x1436, 0x1de4, 0x170e, 0x0cb7, 0x0931, 0x08d3, 0x04b3, 0xfd29,
-	0xf435, 0xeb29, 0xe7fc, 0xe631, 0xe75f, 0xea8e, 0xf2c6, 0xff75,
-	0x0816, 0x12c0, 0x1bab, 0x211c, 0x20a4, 0x1649, 0x07b5, 0xfb1c,
-	0xf185, 0xe97d, 0xe566, 0xe771, 0xedf2, 0xf3c9, 0xf8bd, 0x02bb,
-	0x1330, 0x1ab1, 0x1948, 0x143c, 0x0687, 0xfe3d, 0xf9d9, 0xf35b,
-	0xf1cb, 0xf34b, 0xf49a, 0xf29f, 0xf35e, 0xfd25, 0x0558, 0x0956,
-	0x0fc8, 0x11bd, 0x0c38, 0x052b, 0xfc90, 0xf279, 0xf085, 0xf368,
-	0xf0a5, 0xefd7, 0xf6f6, 0x0408, 0x0ffb, 0x1441, 0x1159, 0x0b7a,
-	0x0a5f, 0x095b, 0x00b5, 0xf7ee, 0xf27e, 0xef94, 0xed80, 0xeca1,
-	0xf43c, 0xfdd2, 0x03d7, 0x0749, 0x04ac, 0x032d, 0x04a8, 0x0506,
-	0x0a82, 0x10bd, 0x0f81, 0x09e3, 0xfe37, 0xf4c0, 0xf691, 0xf90c,
-	0xf7fc, 0xf770, 0xf46e, 0xf537, 0xf82f, 0xf4f9, 0xf534, 0xf9b6,
-	0x01aa, 0x088e, 0x0941, 0x0d6b, 0x129a, 0x12b3, 0x11b0, 0x0b16,
-	0x0026, 0xf8ec, 0xf3cf, 0xf235, 0xf18e, 0xf381, 0xf52e, 0xf32c,
-	0xf932, 0x0358, 0x0937, 0x0993, 0x040e, 0xfdad, 0xfc14, 0xfd25,
-	0xfe31, 0x03dc, 0x07a6, 0x07c0, 0x0514, 0xfcd7, 0xfd54, 0x02b3,
-	0x053f, 0x0791, 0x013b, 0xfb57, 0xf7ff, 0xef7e, 0xef3a, 0xf33c,
-	0xf5a4, 0xfb34, 0xfb16, 0xfd1e, 0x07fe, 0x12a1, 0x16f5, 0x10fd,
-	0x0b9c, 0x0928, 0x0386, 0xfcb1, 0xf5a8, 0xf1df, 0xf2ce, 0xf59d,
-	0xf684, 0xf986, 0x00c4, 0x083b, 0x0a1d, 0x04a3, 0xfc78, 0xf6d6,
-	0xf70a, 0xfc86, 0x01b7, 0x051b, 0x0716, 0xff9a, 0xfc0f, 0x00ee,
-	0x0390, 0x07d3, 0x060f, 0x00aa, 0xfd46, 0xf613, 0xf029, 0xeda8,
-	0xef8b, 0xf6e8, 0xfae7, 0xfc8d, 0x03e4, 0x0df8, 0x1840, 0x1d39,
-	0x1878, 0x0dd6, 0x03d9, 0xf9de, 0xf038, 0xec8a, 0xea4f, 0xe9f6,
-	0xeccf, 0xf283, 0xfd52, 0x090d, 0x112a, 0x10cb, 0x0d4f, 0x0bb4,
-	0x0907, 0x0720, 0x04dd, 0x032d, 0x01e3, 0xfb76, 0xf207, 0xebcb,
-	0xeeba, 0xf91b, 0x0006, 0x0279, 0x03b8, 0x01ae, 0xfeda, 0xfd13,
-	0xfc86, 0xff37, 0x02cc, 0xff9d, 0xfad9, 0xfec4, 0x02ef, 0x060b,
-	0x0afa, 0x0ae6, 0x08bd, 0x078d, 0x0585, 0x0028, 0xf962, 0xfab6,
-	0xfcaf, 0xf58c, 0xf130, 0xf29e, 0xf555, 0xf8dd, 0xf89c, 0xf39c,
-	0xf213, 0xfa94, 0x0405, 0x0ddf, 0x180b, 0x1a71, 0x1645, 0x0e49,
-	0x0873, 0x0402, 0xfd91, 0xf824, 0xf25c, 0xeddd, 0xeb25, 0xe73d,
-	0xe7c8, 0xedca, 0xf9c2, 0x0512, 0x0905, 0x0d7d, 0x120a, 0x1921,
-	0x1e6c, 0x191b, 0x0eef, 0x022e, 0xf561, 0xedd7, 0xe69e, 0xe2dd,
-	0xea6d, 0xf413, 0xfa09, 0x02b1, 0x0cde, 0x114e, 0x12a4, 0x0e59,
-	0x06f9, 0x00ff, 0xf9fd, 0xf4aa, 0xf0d8, 0xf42e, 0xf953, 0xf473,
-	0xf164, 0xf9fa, 0x0424, 0x0d38, 0x161c, 0x160b, 0x0eac, 0x0784,
-	0x01e9, 0xf7e1, 0xef9d, 0xeee1, 0xecfe, 0xeda6, 0xf0f5, 0xf766,
-	0x034a, 0x0eea, 0x167f, 0x17ea, 0x163b, 0x112c, 0x07a5, 0xfd9f,
-	0xf904, 0xf515, 0xeda0, 0xe93e, 0xe9ac, 0xeea8, 0xf91b, 0xfd3d,
-	0xfcd4, 0x033a, 0x084d, 0x0d8e, 0x11c8, 0x1392, 0x1543, 0x0faf,
-	0x05ab, 0xfc11, 0xf4d9, 0xf112, 0xf00e, 0xf129, 0xf292, 0xf29e,
-	0xf209, 0xf47e, 0xf9ca, 0x01c8, 0x0907, 0x09db, 0x0691, 0x05d4,
-	0x0b64, 0x1034, 0x11ee, 0x0d4d, 0x04ab, 0x0050, 0xfc10, 0xf260,
-	0xeb54, 0xf0b1, 0xf663, 0xf8de, 0xfc7f, 0xff51, 0x037b, 0x0503,
-	0x036f, 0x00da, 0xfdf6, 0xfe83, 0x0057, 0x0265, 0x0939, 0x0a67,
-	0x0484, 0x01da, 0xffef, 0x0005, 0x0542, 0x0848, 0x01bc, 0xfaea,
-	0xf81b, 0xf3f3, 0xefca, 0xeebe, 0xf132, 0xf3e1, 0xf7ba, 0xfbcc,
-	0xffcf, 0x08c5, 0x14cc, 0x1aeb, 0x18ba, 0x12ff, 0x0ac8, 0xffa7,
-	0xf649, 0xf420, 0xf3b8, 0xf27c, 0xf0f4, 0xf0ed, 0xf8ca, 0xffa5,
-	0x00e6, 0x01b1, 0x0040, 0x001b, 0x019b, 0x014e, 0x02a1, 0x05c6,
-	0x06ce, 0x03cd, 0xfef5, 0xfbea, 0xfcad, 0x018f, 0x061e, 0x05e3,
-	0x007f, 0xfd2c, 0xfc63, 0xf996, 0xf9f8, 0xfc1c, 0xf968, 0xf4e2,
-	0xf4a1, 0xfb6b, 0x07b4, 0x1095, 0x10b7, 0x0df8, 0x0d97, 0x078a,
-	0xfaf8, 0xf38f, 0xf143, 0xf255, 0xf50b, 0xf5d3, 0xf773, 0xfb13,
-	0x02db, 0x0991, 0x083b, 0x064b, 0x0633, 0x05a0, 0x079a, 0x08f7,
-	0x05e3, 0xff62, 0xf7b4, 0xf121, 0xf001, 0xf5a3, 0xfaf0, 0xff63,
-	0x024e, 0x02c1, 0x04a9, 0x0350, 0xffbc, 0xfe3a, 0xff56, 0xfd58,
-	0xf547, 0xf0df, 0xf797, 0x0474, 0x0deb, 0x12c5, 0x12c3, 0x0f63,
-	0x0a28, 0x0463, 0xff47, 0xfd24, 0xf9aa, 0xf266, 0xf005, 0xef3e,
-	0xf00e, 0xf2be, 0xf47d, 0xf674, 0xfb38, 0x0236, 0x08d2, 0x0eee,
-	0x124a, 0x16a9, 0x1885, 0x11e8, 0x0589, 0xfc7c, 0xfa86, 0xf968,
-	0xf321, 0xea59, 0xe941, 0xeb15, 0xee8f, 0xf574, 0xfc29, 0x01b3,
-	0x03a3, 0x045d, 0x082e, 0x0fe4, 0x1565, 0x1674, 0x1364, 0x0b07,
-	0xffb1, 0xf461, 0xea6e, 0xe85a, 0xef6a, 0xf5b2, 0xf8ed, 0xfb16,
-	0x00d0, 0x0994, 0x1056, 0x11e4, 0x0c40, 0x02a9, 0xfd09, 0xfd4c,
-	0xfa20, 0xf781, 0xf8d2, 0xf78a, 0xf675, 0xf6f7, 0xfb6a, 0x0515,
-	0x0ad3, 0x0c89, 0x0e7a, 0x0def, 0x07d4, 0xfd14, 0xf5e9, 0xf4e4,
-	0xf28c, 0xec04, 0xe846, 0xef50, 0xfd84, 0x0bbd, 0x166b, 0x198a,
-	0x17ea, 0x13b2, 0x0b08, 0x0250, 0xf9f7, 0xf275, 0xedb0, 0xea3c,
-	0xe7a1, 0xe984, 0xf194, 0xfad7, 0x035e, 0x08fb, 0x0e5b, 0x1465,
-	0x123f, 0x0fc0, 0x12bc, 0x102f, 0x05f2, 0xf75d, 0xeba2, 0xe9f2,
-	0xece5, 0xef59, 0xf0ca, 0xf300, 0xfb29, 0x044a, 0x08f5, 0x0ccb,
-	0x101e, 0x0e97, 0x07b6, 0x0431, 0x02ae, 0x00f6, 0x02aa, 0x01e4,
-	0xfeb2, 0xfaf1, 0xf511, 0xf0d7, 0xf1ac, 0xf7d7, 0xfedd, 0x02fb,
-	0x038f, 0x019c, 0x025a, 0x057d, 0x044c, 0xfc65, 0xf515, 0xf830,
-	0xfb2a, 0xfa04, 0xfedc, 0x04dd, 0x0b0b, 0x0dd0, 0x0b54, 0x08d3,
-	0x0606, 0x0366, 0x007c, 0xfd8a, 0xfbfe, 0xf918, 0xf1c5, 0xeed6,
-	0xf282, 0xf400, 0xf327, 0xf498, 0xf857, 0x01f2, 0x1114, 0x197b,
-	0x1971, 0x1411, 0x0f7b, 0x0beb, 0x0256, 0xf95b, 0xf5bb, 0xf5b3,
-	0xf2c3, 0xee59, 0xed0e, 0xef20, 0xf7be, 0xffd7, 0x01a6, 0x0410,
-	0x0760, 0x058d, 0x053b, 0x0804, 0x0a7c, 0x0a0a, 0x020c, 0xfb37,
-	0xf939, 0xf970, 0xfa5c, 0xf913, 0xf9d9, 0x00e5, 0x04a8, 0x017b,
-	0x00d4, 0xfe61, 0xfa9e, 0xfa72, 0xf9f0, 0xf9cc, 0xfcf9, 0x04d7,
-	0x0b7d, 0x09e5, 0x0787, 0x0754, 0x00fc, 0xfb31, 0xfa63, 0xfaba,
-	0xfa76, 0xf7f4, 0xf5d8, 0xf901, 0x033c, 0x08ae, 0x053c, 0x0429,
-	0x0668, 0x06ac, 0x0443, 0x0188, 0x01c6, 0x046a, 0x02cd, 0xfbe3,
-	0xf69b, 0xf2a6, 0xf33e, 0xf8da, 0xfa90, 0xfccd, 0x0054, 0x003e,
-	0x0180, 0x01a7, 0x0062, 0x00aa, 0xfbfc, 0xf9b1, 0xfead, 0x0560,
-	0x0c15, 0x0c40, 0x08cf, 0x08e7, 0x08a6, 0x037f, 0xfc68, 0xf87a,
-	0xf792, 0xf729, 0xf364, 0xeed8, 0xef4a, 0xf4ec, 0xfb5b, 0xfd5f,
-	0x01b0, 0x082a, 0x0912, 0x0a33, 0x0f8e, 0x126d, 0x1069, 0x0bcc,
-	0x05ef, 0xfe1e, 0xf7a8, 0xf4f6, 0xef2e, 0xeda5, 0xf336, 0xf582,
-	0xf957, 0xfca7, 0xfdd7, 0x03ce, 0x0798, 0x0624, 0x04d9, 0x056a,
-	0x0aaa, 0x0d6f, 0x07cb, 0x0344, 0xff4b, 0xf8f6, 0xf4e0, 0xf3ff,
-	0xf674, 0xfba1, 0xfcc6, 0xfb72, 0x00a9, 0x0788, 0x0a8c, 0x07a6,
-	0x025a, 0xff26, 0xfae2, 0xf666, 0xf217, 0xf209, 0xf7f0, 0xfe01,
-	0x016d, 0x0277, 0x03c4, 0x09a5, 0x0f75, 0x1002, 0x0f61, 0x0c44,
-	0x0763, 0xff41, 0xf4b8, 0xed3d, 0xe6d8, 0xe4b0, 0xe7d2, 0xeda0,
-	0xf915, 0x095b, 0x11bf, 0x1483, 0x1a53, 0x1ac0, 0x13da, 0x0875,
-	0xfdc3, 0xf8a0, 0xf3fc, 0xecab, 0xe6bc, 0xe71a, 0xef1f, 0xfa20,
-	0x00bb, 0x075a, 0x0d5e, 0x0e75, 0x1007, 0x112c, 0x0f67, 0x0b21,
-	0x044d, 0xf9b8, 0xf0b0, 0xed6c, 0xecc9, 0xed54, 0xef93, 0xf65e,
-	0xfeec, 0x052a, 0x07b3, 0x08c4, 0x0d1e, 0x1011, 0x0c39, 0x0355,
-	0xfca5, 0xfd2d, 0xfeab, 0xfbf1, 0xf98c, 0xf97c, 0xfb75, 0xfcfb,
-	0xfb6c, 0xfd6d, 0x01e7, 0x0315, 0x0494, 0x04ab, 0x02c7, 0x0440,
-	0x00f7, 0xf83c, 0xf658, 0xf776, 0xf6d6, 0xf7c1, 0xfc6d, 0x059d,
-	0x0e4c, 0x1185, 0x0ff4, 0x09fe, 0x05d2, 0x0645, 0x00c4, 0xf8b5,
-	0xf437, 0xf032, 0xee75, 0xeca5, 0xebf1, 0xee98, 0xf3f6, 0xfa53,
-	0x0121, 0x0bbb, 0x1787, 0x1bed, 0x1a13, 0x191c, 0x1411, 0x0a42,
-	0xfe68, 0xf2b9, 0xee77, 0xec15, 0xe97e, 0xe888, 0xe9f3, 0xf3b0,
-	0xffc7, 0x063e, 0x0a38, 0x0c37, 0x0d54, 0x0f18, 0x0a30, 0x0542,
-	0x0521, 0xff55, 0xf99d, 0xf46a, 0xef1d, 0xf257, 0xf7fc, 0xfbf6,
-	0x0386, 0x0c65, 0x0fbd, 0x0bdf, 0x067d, 0x0579, 0x0357, 0xfe70,
-	0xf8f8, 0xf0af, 0xefae, 0xf686, 0xf95d, 0xfa41, 0xfec3, 0x04d5,
-	0x07f9, 0x0724, 0x062f, 0x0429, 0x0192, 0x0247, 0xffe2, 0xfddf,
-	0x00b4, 0xfe9c, 0xfad6, 0xf97e, 0xf768, 0xf738, 0xf913, 0xfc3f,
-	0x0293, 0x0792, 0x09f5, 0x0734, 0xfefd, 0xff25, 0x029c, 0x0059,
-	0xff4c, 0xff96, 0xff48, 0xff16, 0xfade, 0xf5de, 0xf703, 0xf84f,
-	0xf927, 0xfbf5, 0xfeed, 0x0459, 0x09a5, 0x0d51, 0x0f0f, 0x0f3d,
-	0x0c8d, 0x031c, 0xf922, 0xf5bf, 0xf4c0, 0xf44d, 0xf425, 0xf258,
-	0xf477, 0xfb60, 0xffdc, 0xff6c, 0xffe6, 0x05df, 0x0b57, 0x0c57,
-	0x0dbc, 0x0d3c, 0x09f1, 0x0882, 0x0229, 0xf832, 0xf4cf, 0xf482,
-	0xf2c8, 0xf3ce, 0xf6ff, 0xf9bf, 0xfb15, 0xfb00, 0xfe1f, 0x0176,
-	0x039e, 0x037c, 0xfdb1, 0xfe25, 0x0581, 0x06af, 0x0598, 0x0749,
-	0x0724, 0x0642, 0x0517, 0xff49, 0xf8fe, 0xf83d, 0xfad1, 0xfc68,
-	0xfbf8, 0xfd43, 0xff30, 0xff6b, 0xfe43, 0xfc32, 0xfab7, 0xf8f6,
-	0xf813, 0xfbb7, 0x0369, 0x0907, 0x0b35, 0x09be, 0x0849, 0x0a0a,
-	0x08d8, 0x0517, 0x012f, 0xff9a, 0xfeb8, 0xf75d, 0xf07e, 0xedbc,
-	0xec7a, 0xf020, 0xf430, 0xf60f, 0xfd87, 0x0993, 0x109d, 0x1520,
-	0x17c5, 0x172f, 0x1257, 0x0689, 0xfbf8, 0xf3bd, 0xed8d, 0xec45,
-	0xea8e, 0xeb9c, 0xf71a, 0xffea, 0x009d, 0x046d, 0x0929, 0x0dd4,
-	0x1183, 0x0f81, 0x092d, 0x032c, 0x0060, 0xfa15, 0xf09b, 0xee34,
-	0xf00e, 0xf20d, 0xf7ed, 0xfdf2, 0x02df, 0x067a, 0x08b0, 0x0c3d,
-	0x0d75, 0x0cbc, 0x0918, 0xffb9, 0xf6fb, 0xf533, 0xf4ea, 0xf4f3,
-	0xf675, 0xf9cf, 0x01ff, 0x0498, 0x0149, 0x007d, 0x0163, 0x06e7,
-	0x0aad, 0x0564, 0x01b3, 0xfffe, 0xfb77, 0xf828, 0xf407, 0xf2cd,
-	0xf4f7, 0xf70a, 0xfdc3, 0x044a, 0x0829, 0x0d15, 0x0ee1, 0x0e50,
-	0x0f54, 0x0d65, 0x0554, 0xfca4, 0xf7ff, 0xf46d, 0xf0cb, 0xee86,
-	0xeaa8, 0xe930, 0xf14c, 0xf889, 0xfa4c, 0x018d, 0x0d03, 0x166c,
-	0x1c51, 0x1bc5, 0x176d, 0x0ebc, 0x030a, 0xf8fd, 0xee57, 0xea5b,
-	0xeceb, 0xec0d, 0xee37, 0xf5e8, 0xfc3e, 0x01ef, 0x05a6, 0x0918,
-	0x0e0b, 0x0dfb, 0x0ae1, 0x05ee, 0xff56, 0xfd1b, 0xfc14, 0xf7fa,
-	0xf448, 0xf5b6, 0xfb19, 0x00d3, 0x04cd, 0x066f, 0x0842, 0x08a7,
-	0x06f0, 0x028b, 0xfc4a, 0xf660, 0xeffa, 0xed32, 0xef7c, 0xf53a,
-	0xf9d2, 0xfce4, 0x0709, 0x1194, 0x12c0, 0x10f1, 0x0be1, 0x05b1,
-	0x068e, 0x04e0, 0xfd6d, 0xf834, 0xf5dc, 0xf423, 0xf25c, 0xf246,
-	0xf386, 0xf581, 0xfca1, 0x0627, 0x08ca, 0x09ff, 0x0e3e, 0x0e2f,
-	0x0ab3, 0x0873, 0x04a0, 0xfed8, 0xf948, 0xf505, 0xf463, 0xf4a8,
-	0xf488, 0xf404, 0xf662, 0xfe1f, 0x02a2, 0x008f, 0xff65, 0x039c,
-	0x0a7a, 0x0dee, 0x0dca, 0x0c8b, 0x07c1, 0x0243, 0xfb9e, 0xf458,
-	0xf1cd, 0xf18d, 0xf4c4, 0xfa51, 0xfddc, 0xff66, 0x0000, 0xff8e,
-	0x019d, 0x06b8, 0x090a, 0x0a44, 0x0808, 0x0019, 0xfcd7, 0xfe7d,
-	0xfb0d, 0xf7f5, 0xf9c3, 0xfd11, 0xfe3a, 0xfc8a, 0xfd20, 0xfe81,
-	0x0178, 0x0514, 0x036b, 0x0063, 0xffec, 0xfbd3, 0xf6b9, 0xf987,
-	0xfe84, 0xffcb, 0x0202, 0x079a, 0x0b43, 0x0a5e, 0x064f, 0x00ae,
-	0xfc14, 0xfc32, 0xfebe, 0xfb6a, 0xf756, 0xf72d, 0xf90d, 0xfc1e,
-	0xfb0b, 0xf92c, 0xfa01, 0xffb9, 0x060b, 0x038f, 0x0006, 0x02c4,
-	0x062e, 0x094a, 0x0b3e, 0x0866, 0x066f, 0x01ec, 0xfc92, 0xfcd5,
-	0xfc1f, 0xf9c5, 0xf6c8, 0xf338, 0xf2c5, 0xf414, 0xf1df, 0xf451,
-	0xfeb0, 0x0820, 0x0e45, 0x0fe7, 0x1100, 0x0fe8, 0x0a4f, 0x0607,
-	0xfdaa, 0xf310, 0xf18e, 0xf2e5, 0xf3f0, 0xf7da, 0xfb6e, 0xffaa,
-	0x0237, 0x04b0, 0x071e, 0x07cd, 0x0adf, 0x0965, 0x023a, 0xff81,
-	0xff31, 0xf97b, 0xf39c, 0xf3e4, 0xf881, 0xfc20, 0xfc32, 0xfe4f,
-	0x014b, 0x0560, 0x0b2b, 0x092b, 0x0339, 0x0072, 0xfaaf, 0xf66b,
-	0xf62c, 0xf475, 0xf65b, 0xf9fb, 0xfe0b, 0x0454, 0x0796, 0x0a19,
-	0x0b21, 0x078e, 0x05ea, 0x0637, 0x03df, 0xff78, 0xfab6, 0xf913,
-	0xf857, 0xf477, 0xf13e, 0xf217, 0xf947, 0x035a, 0x05e4, 0x041f,
-	0x082b, 0x0efb, 0x10bc, 0x0eab, 0x0c4c, 0x06de, 0xfd23, 0xf59a,
-	0xf248, 0xedc6, 0xedb9, 0xf144, 0xf30f, 0xf7a5, 0xfa30, 0xfb6a,
-	0x0011, 0x0877, 0x1250, 0x1602, 0x14b7, 0x11fe, 0x0a92, 0x02f0,
-	0xff79, 0xf681, 0xeb93, 0xe9d4, 0xece4, 0xf079, 0xf489, 0xf9de,
-	0x01df, 0x0985, 0x0c25, 0x0bf3, 0x0bcb, 0x0b8e, 0x08ba, 0x00f5,
-	0xfbec, 0xfa4b, 0xf7ec, 0xf6fe, 0xf81b, 0xfc88, 0xff22, 0xffab,
-	0x00fd, 0x031b, 0x07f0, 0x0b1b, 0x08a9, 0x0135, 0xf923, 0xf43f,
-	0xf23f, 0xf0da, 0xf2b0, 0xf7ab, 0xfca2, 0x042a, 0x0997, 0x09e0,
-	0x0c43, 0x10b3, 0x0dcc, 0x0887, 0x043d, 0xfde1, 0xf618, 0xef34,
-	0xf025, 0xf2d8, 0xf1f2, 0xf2b8, 0xf639, 0xfc54, 0x06a0, 0x0bff,
-	0x0aa5, 0x0daa, 0x108e, 0x0f1e, 0x0bc9, 0x0723, 0xff47, 0xf818,
-	0xf526, 0xf252, 0xf0d8, 0xf2e5, 0xf8e8, 0xfd3d, 0xfe88, 0xff5b,
-	0xff07, 0x016a, 0x059b, 0x08e7, 0x0ab6, 0x09c9, 0x062a, 0xffc9,
-	0xfdcc, 0xfefe, 0xf8ec, 0xf22d, 0xf215, 0xf63a, 0xfc91, 0xfea6,
-	0xff23, 0x054b, 0x09e5, 0x0a4a, 0x08b9, 0x0462, 0x02ee, 0x039f,
-	0xffad, 0xfad7, 0xf900, 0xf7db, 0xf9bb, 0xfcf2, 0xffd1, 0x01d5,
-	0xffa0, 0x00c0, 0x02f8, 0x00dc, 0x03b3, 0x067f, 0xffc3, 0xf71c,
-	0xf290, 0xf156, 0xf12c, 0xf35c, 0xf9b8, 0x01fe, 0x0aaf, 0x0d47,
-	0x0a0a, 0x0b76, 0x0f3d, 0x0d19, 0x080f, 0x03b8, 0xfe88, 0xf806,
-	0xf3d9, 0xf502, 0xf550, 0xf3c8, 0xf526, 0xf68b, 0xfa40, 0x01a6,
-	0x0381, 0x03a7, 0x07a5, 0x0a30, 0x0db2, 0x0f79, 0x0ad6, 0x0665,
-	0x008f, 0xfb8b, 0xf969, 0xf39c, 0xf30e, 0xf983, 0xfc69, 0xfa7b,
-	0xf68a, 0xf622, 0xfa25, 0xfde4, 0x02b6, 0x08d8, 0x0a89, 0x09db,
-	0x0886, 0x0645, 0x06ae, 0x05fd, 0xff72, 0xf8bd, 0xf8b3, 0xf8a5,
-	0xf3ee, 0xf33b, 0xf9bd, 0xfe7b, 0x017f, 0x03c8, 0x0060, 0x005f,
-	0x041b, 0x0670, 0x05f9, 0x00ef, 0xff36, 0x0036, 0x000c, 0xffe4,
-	0xfc1d, 0xf85b, 0xfb9d, 0xfbbc, 0xfaba, 0x0291, 0x0787, 0x05e7,
-	0x01c8, 0xfd8d, 0xfc05, 0xf9e9, 0xf789, 0xf92b, 0xfcd4, 0xff65,
-	0x0145, 0x0173, 0x052b, 0x0c11, 0x0da4, 0x0b2b, 0x0613, 0x0040,
-	0xfb11, 0xf6d2, 0xf60c, 0xf572, 0xf2fc, 0xf2f9, 0xf56d, 0xf96c,
-	0xfe23, 0x0358, 0x08b1, 0x0923, 0x0b2d, 0x0f9e, 0x0d76, 0x094d,
-	0x0563, 0xff8c, 0xfb11, 0xf622, 0xee64, 0xecf2, 0xf4a0, 0xfce5,
-	0xfe4b, 0xfaf3, 0xfd76, 0x02d8, 0x04e3, 0x0939, 0x0d40, 0x0c5b,
-	0x0b96, 0x0763, 0x00b9, 0xff22, 0xfc38, 0xf6ed, 0xf47b, 0xf3f4,
-	0xf270, 0xf169, 0xf68c, 0xfe15, 0x047e, 0x0a76, 0x0d5b, 0x0b09,
-	0x068e, 0x0612, 0x05c2, 0x0087, 0xfa9d, 0xf814, 0xf8d8, 0xfc3a,
-	0xfd39, 0xfae7, 0xfc47, 0x00de, 0x0347, 0x04a1, 0x071f, 0x088f,
-	0x06e9, 0xff92, 0xf7b6, 0xf3a4, 0xeeed, 0xedfd, 0xf39a, 0xf91d,
-	0xfd4a, 0x013e, 0x04fc, 0x0b7e, 0x120e, 0x1607, 0x148e, 0x0e36,
-	0x071c, 0xfe7e, 0xf6cc, 0xf2a1, 0xf15c, 0xee61, 0xee56, 0xf1e0,
-	0xf246, 0xf715, 0x01e7, 0x09d6, 0x0dca, 0x10a9, 0x11d6, 0x1022,
-	0x0d38, 0x0873, 0x0190, 0xfc20, 0xf5fb, 0xedc4, 0xeb53, 0xf305,
-	0xfb99, 0xfc65, 0xfc6e, 0x0024, 0x0248, 0x055b, 0x09df, 0x0880,
-	0x057f, 0x04f6, 0x0359, 0xfff1, 0xfd93, 0xfcc9, 0xfc4e, 0xfc5f,
-	0xfa15, 0xf792, 0xf61b, 0xf83b, 0xff1e, 0x0337, 0x0567, 0x0609,
-	0x01e7, 0xfe9f, 0xfff0, 0x020d, 0x00f2, 0xfd9a, 0xfcea, 0x0072,
-	0x0292, 0x02f8, 0x03c0, 0x033a, 0x025a, 0x00d0, 0xfd38, 0xfb46,
-	0xfe67, 0xffdb, 0xfc98, 0xfa19, 0xf767, 0xf331, 0xf358, 0xfa77,
-	0x00bc, 0x04cb, 0x08c8, 0x093a, 0x08b9, 0x0b21, 0x0e66, 0x0c48,
-	0x0489, 0xfdb5, 0xf701, 0xf136, 0xf156, 0xf0dd, 0xef88, 0xf603,
-	0xfd18, 0xfdfc, 0x00b8, 0x06e3, 0x0c2e, 0x0db9, 0x0d08, 0x0c7c,
-	0x0950, 0x04f4, 0x0231, 0xfed1, 0xfb12, 0xf826, 0xf30b, 0xefe6,
-	0xf31b, 0xf968, 0xfe76, 0x0037, 0x0058, 0x017d, 0x036b, 0x053b,
-	0x05ef, 0x04a1, 0x030f, 0x01c7, 0xfffe, 0xfcb0, 0xfc42, 0x0101,
-	0x03a6, 0x01b1, 0xfdea, 0xf8d7, 0xf6ac, 0xfa3d, 0xfe89, 0x0221,
-	0x0313, 0x00a9, 0xfe5f, 0xfec9, 0x02e3, 0x04c9, 0x0254, 0x0287,
-	0x0462, 0x0216, 0xfff0, 0xff8a, 0xfe36, 0xff53, 0x00a1, 0xfcb3,
-	0xf9fc, 0xfcef, 0x006d, 0x014f, 0xffa8, 0xfc6c, 0xf809, 0xf63c,
-	0xf7b6, 0xf880, 0xf949, 0xfd4f, 0x0119, 0x01d8, 0x0557, 0x0b85,
-	0x0ed4, 0x0eeb, 0x0c5e, 0x0680, 0x010b, 0xfc3e, 0xf6fe, 0xf551,
-	0xf5b7, 0xf575, 0xf356, 0xf206, 0xf6a0, 0xffdf, 0x0840, 0x0c1f,
-	0x0cf0, 0x0bd8, 0x09b9, 0x086d, 0x0639, 0x027a, 0xfdec, 0xf7dd,
-	0xf2e0, 0xf13c, 0xf344, 0xf82e, 0xfb4e, 0xfc6b, 0xfec7, 0x0154,
-	0x031b, 0x0595, 0x066d, 0x0688, 0x088b, 0x05e1, 0x0048, 0xffa8,
-	0x01dc, 0x0203, 0xffed, 0xfc1e, 0xf788, 0xf490, 0xf5ed, 0xfa39,
-	0xfda5, 0x015f, 0x0343, 0x0100, 0x003b, 0x0250, 0x02f7, 0x0174,
-	0x01b8, 0x023c, 0x015d, 0x0044, 0xfdc9, 0xfda8, 0x00ae, 0x02a2,
-	0x00bd, 0xfcf2, 0xfc33, 0xffd6, 0x0354, 0x00bc, 0xfb1f, 0xf6be,
-	0xf53d, 0xf66e, 0xf797, 0xf944, 0xfcee, 0x00fc, 0x049f, 0x0a0c,
-	0x0d91, 0x11d8, 0x139a, 0x0e4a, 0x06fb, 0xfd1d, 0xf43c, 0xeee8,
-	0xedee, 0xeeb4, 0xf003, 0xf250, 0xf415, 0xf97a, 0x0309, 0x0c25,
-	0x1285, 0x14ef, 0x12ba, 0x0ef2, 0x09db, 0x0367, 0xfc84, 0xf761,
-	0xf45c, 0xf029, 0xedf5, 0xf0f8, 0xf669, 0xfb40, 0x00b8, 0x066a,
-	0x08fb, 0x0a38, 0x09b5, 0x06e2, 0x0582, 0x02f4, 0xfd86, 0xf8b3,
-	0xf67b, 0xf941, 0xfdb1, 0xfecd, 0xfe13, 0xfcf4, 0xfcc0, 0xfefa,
-	0x0260, 0x049e, 0x05ec, 0x0557, 0x0213, 0xfe92, 0xfc7e, 0xfcc6,
-	0xfe46, 0xfd3f, 0xfbc4, 0xfcf1, 0xfd40, 0xfdaf, 0x0034, 0x03cb,
-	0x07cc, 0x08bd, 0x04f3, 0x00c7, 0x0149, 0x020d, 0xfe5d, 0xf86b,
-	0xf2db, 0xf0be, 0xf21d, 0xf4d6, 0xf757, 0xfb2b, 0x0268, 0x08be,
-	0x0b26, 0x0dc8, 0x1059, 0x0fe1, 0x0e49, 0x0921, 0xff3b, 0xf64e,
-	0xf298, 0xf160, 0xf0fc, 0xf240, 0xf349, 0xf479, 0xf814, 0xfef1,
-	0x0892, 0x0e2c, 0x0f46, 0x0fe0, 0x0d90, 0x09f7, 0x04a4, 0xfdf1,
-	0xfa51, 0xf812, 0xf477, 0xf1f0, 0xf394, 0xf87d, 0xfea1, 0x0267,
-	0x0356, 0x0461, 0x0439, 0x0311, 0x027e, 0x01c1, 0x0061, 0xff59,
-	0xfd48, 0xfb66, 0xfe60, 0x0399, 0x060e, 0x042e, 0x008f, 0xfd82,
-	0xfcc7, 0xfd57, 0xfbff, 0xfaaf, 0xfb0b, 0xfade, 0xf6dc, 0xf44e,
-	0xf8e1, 0xfebc, 0x0329, 0x0776, 0x07c9, 0x071d, 0x0817, 0x07a4,
-	0x0702, 0x06e6, 0x04fb, 0xff63, 0xfa89, 0xf976, 0xfae9, 0xfb78,
-	0xf931, 0xf7ae, 0xf622, 0xf674, 0xf91a, 0xf983, 0xfb8b, 0x0159,
-	0x0598, 0x07c3, 0x09b8, 0x0bee, 0x0e32, 0x0dd5, 0x07dd, 0xfe41,
-	0xf6d1, 0xf309, 0xf190, 0xf224, 0xf356, 0xf594, 0xf6e1, 0xf80e,
-	0xfe1a, 0x068f, 0x0d5b, 0x0f4f, 0x0e31, 0x0c81, 0x0950, 0x0487,
-	0xff3c, 0xfcae, 0xfb7c, 0xf96b, 0xf530, 0xf1c8, 0xf4a0, 0xfb10,
-	0x000a, 0x03a4, 0x03e8, 0x0227, 0x03cd, 0x0467, 0x022a, 0x0126,
-	0x0089, 0xfec3, 0xfb94, 0xf9a9, 0xfc1b, 0x0063, 0x0158, 0xfec0,
-	0xfc60, 0xfc0f, 0xfe75, 0xfff7, 0xff9c, 0x0266, 0x03ce, 0x0053,
-	0xfd79, 0xfd16, 0xff44, 0x034a, 0x046c, 0x0169, 0xfe00, 0xfcb1,
-	0xfdc3, 0x0160, 0x0456, 0x0499, 0x039e, 0x0239, 0x00dd, 0x002b,
-	0xff46, 0xfdb4, 0xfa77, 0xf57a, 0xf313, 0xf21f, 0xf1af, 0xf503,
-	0xfb23, 0x0239, 0x072a, 0x08d2, 0x0c5e, 0x12f6, 0x15d4, 0x11dd,
-	0x093b, 0xff18, 0xf88f, 0xf489, 0xf0ea, 0xf05f, 0xf0a0, 0xf09f,
-	0xf1fc, 0xf588, 0xfd32, 0x06e6, 0x0edf, 0x12e6, 0x12a9, 0x0f74,
-	0x09c2, 0x04a6, 0xffb4, 0xfbf3, 0xf9ea, 0xf4cb, 0xf064, 0xf02a,
-	0xf4d0, 0xfd8d, 0x0371, 0x03c3, 0x02e0, 0x041b, 0x04ea, 0x032d,
-	0x00f4, 0xffe5, 0xffc4, 0xfdf6, 0xfb3c, 0xfc11, 0xff4b, 0x01ce,
-	0x020c, 0x0034, 0x0037, 0x0195, 0x01a8, 0x0280, 0x0300, 0x011d,
-	0xfd7f, 0xf80d, 0xf38e, 0xf4a5, 0xf919, 0xfcca, 0xfeaf, 0xfe4a,
-	0xffdb, 0x0538, 0x096f, 0x0bbb, 0x0c7e, 0x09b5, 0x05bb, 0x005d,
-	0xfab5, 0xf973, 0xf8d6, 0xf70c, 0xf52f, 0xf420, 0xf448, 0xf51c,
-	0xf838, 0xfe60, 0x06bb, 0x0b8c, 0x0a9d, 0x0b04, 0x0dc3, 0x0f49,
-	0x0c81, 0x0359, 0xf9d8, 0xf431, 0xf1a5, 0xf102, 0xf0e6, 0xf29b,
-	0xf6c5, 0xfb8f, 0xfe69, 0x024f, 0x0881, 0x0d50, 0x10f2, 0x0fa8,
-	0x0a00, 0x0580, 0x0073, 0xfbed, 0xf94a, 0xf648, 0xf46e, 0xf228,
-	0xf0f2, 0xf6b2, 0xffe3, 0x070c, 0x0936, 0x080f, 0x0810, 0x081e,
-	0x04ef, 0xffee, 0xfd6b, 0xfbb9, 0xf8d3, 0xf65d, 0xf671, 0xf9f5,
-	0x0005, 0x0483, 0x05dc, 0x05e2, 0x0462, 0x0382, 0x0342, 0x0155,
-	0xfe74, 0xfba7, 0xf66c, 0xf233, 0xf3db, 0xf860, 0xfe52, 0x0181,
-	0x011a, 0x036b, 0x0750, 0x0b0e, 0x0d63, 0x0be9, 0x0afc, 0x078e,
-	0xff86, 0xf9bb, 0xf799, 0xf77c, 0xf74a, 0xf5bd, 0xf414, 0xf439,
-	0xf567, 0xf75d, 0xfd2b, 0x0485, 0x08b5, 0x090d, 0x07ef, 0x0939,
-	0x0c27, 0x0c5b, 0x0786, 0x007d, 0xfbfa, 0xfa82, 0xf9e6, 0xf7ca,
-	0xf5cd, 0xf6bb, 0xf88f, 0xf964, 0xf988, 0xfb60, 0x02f2, 0x0a45,
-	0x0a8f, 0x07ea, 0x04d3, 0x0397, 0x044e, 0x02bb, 0x0122, 0xfedb,
-	0xf96a, 0xf573, 0xf6cd, 0xfc05, 0x00cf, 0x02fd, 0x02f7, 0x027b,
-	0x01c4, 0xffdd, 0xff22, 0xff63, 0xffdd, 0xff71, 0xfbd0, 0xf944,
-	0xfab8, 0xfec1, 0x0304, 0x049c, 0x033f, 0x01fa, 0x0273, 0x025e,
-	0x00d2, 0xff56, 0xfcb7, 0xf894, 0xf4c4, 0xf291, 0xf66d, 0xfd55,
-	0x007a, 0x0157, 0x0300, 0x07da, 0x0c13, 0x0c23, 0x0bb4, 0x0ad9,
-	0x06e8, 0xffa8, 0xf867, 0xf470, 0xf4e6, 0xf7c8, 0xf7d9, 0xf622,
-	0xf56d, 0xf591, 0xf8c3, 0xfe30, 0x0371, 0x07d1, 0x092c, 0x082e,
-	0x07c5, 0x088f, 0x0a04, 0x0888, 0x0244, 0xfb83, 0xf748, 0xf4d3,
-	0xf30d, 0xf201, 0xf3a5, 0xf8b0, 0xfbbd, 0xfb72, 0xff27, 0x0722,
-	0x0e07, 0x10d6, 0x0df8, 0x0919, 0x060b, 0x03f3, 0x018a, 0xfe3b,
-	0xfaa1, 0xf594, 0xf1d9, 0xf2a3, 0xf762, 0xfe43, 0x03af, 0x064f,
-	0x06a5, 0x058a, 0x03f9, 0x0181, 0xff38, 0xfefb, 0xfd58, 0xf913,
-	0xf518, 0xf306, 0xf6aa, 0xff7c, 0x0473, 0x0520, 0x0676, 0x0865,
-	0x0970, 0x0868, 0x057f, 0x0269, 0xfe1f, 0xf6cb, 0xf19b, 0xf030,
-	0xf39c, 0xf922, 0xfb0c, 0xfe05, 0x02bc, 0x0863, 0x0d1e, 0x1045,
-	0x11d5, 0x1050, 0x0afe, 0x00f0, 0xf83f, 0xf583, 0xf562, 0xf412,
-	0xf1c8, 0xeefd, 0xef1b, 0xf43d, 0xfae7, 0x0212, 0x07c7, 0x0b2a,
-	0x0bff, 0x0a28, 0x086b, 0x092e, 0x0920, 0x04c8, 0xffda, 0xfc2f,
-	0xf997, 0xf7d7, 0xf557, 0xf6ec, 0xfc49, 0xfe20, 0xfcd8, 0xfb64,
-	0xfe20, 0x05af, 0x0a16, 0x08d4, 0x0546, 0x0304, 0x01e6, 0x0003,
-	0xfe91, 0xfc90, 0xfa4b, 0xf92c, 0xf870, 0xf9c4, 0xfe9b, 0x04de,
-	0x0867, 0x075d, 0x043d, 0x00c1, 0xfcca, 0xfa92, 0xf9ce, 0xfa1c,
-	0xfb0a, 0xf958, 0xf68c, 0xf941, 0x029c, 0x0953, 0x0b27, 0x0b00,
-	0x08e4, 0x084f, 0x05f9, 0x015f, 0xfdf9, 0xfa70, 0xf5b5, 0xf002,
-	0xed69, 0xf01d, 0xf66e, 0xfce5, 0x0276, 0x07b4, 0x0c73, 0x0fc6,
-	0x107b, 0x0f88, 0x0d44, 0x0874, 0xffdc, 0xf63b, 0xefb9, 0xef1b,
-	0xf2e4, 0xf4b3, 0xf3ce, 0xf463, 0xf8c9, 0xfedc, 0x047e, 0x095f,
-	0x0c22, 0x0c47, 0x0889, 0x0349, 0x01a1, 0x023a, 0x013c, 0xfe37,
-	0xfba4, 0xfa50, 0xf871, 0xf890, 0xfc1a, 0x0015, 0x02aa, 0x0199,
-	0xfd33, 0xfb27, 0xfeee, 0x0275, 0x0238, 0x01c3, 0x000a, 0x009b,
-	0x0366, 0x037c, 0x0282, 0x018d, 0x009b, 0xfe5a, 0xfae3, 0xfb05,
-	0xff49, 0x0317, 0x047d, 0x02e4, 0x004a, 0xfef5, 0xfec7, 0xfdd5,
-	0xfd36, 0xfd37, 0xf917, 0xf432, 0xf4a9, 0xfa8b, 0x027d, 0x07f3,
-	0x099b, 0x09f4, 0x09a6, 0x0879, 0x05c1, 0x0294, 0xff0e, 0xf9a1,
-	0xf455, 0xef65, 0xeeff, 0xf378, 0xf914, 0xff72, 0x0331, 0x06fd,
-	0x0b8d, 0x0d30, 0x0e3c, 0x0d13, 0x095b, 0x046f, 0xfbdf, 0xf570,
-	0xf623, 0xf8b5, 0xf8e6, 0xf6e7, 0xf58f, 0xf7a6, 0xfcea, 0x0127,
-	0x0384, 0x0650, 0x06cd, 0x04ab, 0x0140, 0x004a, 0x0275, 0x0332,
-	0x02ca, 0x0184, 0xfea2, 0xfcc1, 0xfceb, 0xfe4c, 0xffd4, 0x0010,
-	0xfde0, 0xf9bf, 0xf844, 0xfb2a, 0xff6b, 0x02d3, 0x0230, 0x00f6,
-	0x01b6, 0x0228, 0x011b, 0xfee5, 0xfede, 0x0000, 0xfe32, 0xfd2c,
-	0x009d, 0x03c1, 0x05af, 0x0656, 0x0186, 0xfcec, 0xfe76, 0xfee2,
-	0xfbe6, 0xfb2a, 0xfa83, 0xf8f0, 0xf6d4, 0xf6f5, 0xfc96, 0x0352,
-	0x08fd, 0x0b52, 0x0b66, 0x09d7, 0x0797, 0x057b, 0x021a, 0xfed7,
-	0xf8db, 0xf183, 0xed36, 0xec03, 0xedfb, 0xf46a, 0xfb77, 0x002e,
-	0x068c, 0x1003, 0x15fc, 0x142c, 0x1167, 0x0ea6, 0x07bb, 0xfd0f,
-	0xf45b, 0xf1fc, 0xf222, 0xf248, 0xf259, 0xf1d4, 0xf457, 0xfac9,
-	0x00c3, 0x04f9, 0x07ff, 0x0a7d, 0x0905, 0x06fb, 0x069c, 0x0340,
-	0x01ac, 0x00c1, 0xfc41, 0xf7b0, 0xf85a, 0xfb47, 0xfb07, 0xfd6e,
-	0x007e, 0x0078, 0xff7b, 0xfe46, 0xffbf, 0x0220, 0x02e9, 0x01ef,
-	0xff66, 0xfefc, 0x00fc, 0x0008, 0xfe3c, 0xff9b, 0x0179, 0x015c,
-	0x0061, 0x018d, 0x030b, 0x054a, 0x077c, 0x0492, 0xff59, 0xfd32,
-	0xfccf, 0xfa59, 0xf73f, 0xf576, 0xf465, 0xf3e9, 0xf5ed, 0xfb2b,
-	0x01e7, 0x0802, 0x0bee, 0x0c07, 0x0a57, 0x0a53, 0x0831, 0x0342,
-	0xfebb, 0xfb4d, 0xf689, 0xf038, 0xeed7, 0xf135, 0xf502, 0xfbc0,
-	0x00f7, 0x0424, 0x0a1f, 0x1002, 0x110a, 0x0f95, 0x0d0c, 0x07eb,
-	0x005a, 0xf9bf, 0xf541, 0xf251, 0xf192, 0xf285, 0xf356, 0xf5bf,
-	0xfc51, 0x026b, 0x059f, 0x07b4, 0x092a, 0x0844, 0x045f, 0x015c,
-	0xffb4, 0xff4a, 0x002c, 0xfe49, 0xfa50, 0xfa20, 0xfd7f, 0x017d,
-	0x0372, 0x0461, 0x04ae, 0x004d, 0xfbf8, 0xfb02, 0xfacc, 0xfaed,
-	0xfbb4, 0xfd29, 0xfdef, 0xff88, 0x0158, 0x01d0, 0x026e, 0x0421,
-	0x04c3, 0x0219, 0x00ea, 0x020f, 0x018d, 0x01d5, 0x011b, 0xfc18,
-	0xf941, 0xfb71, 0xfcbd, 0xfa38, 0xf7d3, 0xf808, 0xf7f4, 0xf961,
-	0xfde3, 0x02f2, 0x07c6, 0x0bb0, 0x0c95, 0x0b48, 0x0975, 0x07fe,
-	0x0433, 0xffe5, 0xfe01, 0xf7df, 0xf009, 0xec6e, 0xee12, 0xf2ad,
-	0xf89f, 0xff51, 0x0334, 0x0768, 0x0c6e, 0x0fcd, 0x0f77, 0x0ba4,
-	0x082c, 0x02a7, 0xfbcf, 0xf70c, 0xf405, 0xf314, 0xf4e0, 0xf5a6,
-	0xf5f5, 0xf942, 0xff99, 0x0414, 0x0441, 0x05a4, 0x06a4, 0x03f2,
-	0x00ef, 0x017a, 0x0284, 0x00f0, 0x000b, 0xfd16, 0xfa5e, 0xfc84,
-	0x001e, 0x01a3, 0x02ec, 0x0400, 0x0171, 0xfd5f, 0xfc50, 0xfbe0,
-	0xfa0a, 0xfb31, 0xfc98, 0xfc20, 0xfc9f, 0xff8b, 0x02bf, 0x033c,
-	0x05c1, 0x087d, 0x06b0, 0x03eb, 0x02c1, 0x0262, 0x02d8, 0x01ad,
-	0xfca7, 0xf8fb, 0xfa8b, 0xfc9b, 0xfb4b, 0xf9c0, 0xfa0d, 0xfac8,
-	0xf9d4, 0xfb2c, 0x0000, 0x0411, 0x07e3, 0x0941, 0x07d8, 0x05a4,
-	0x043a, 0x04b0, 0x02f0, 0xfee8, 0xfb1f, 0xf48b, 0xef49, 0xefda,
-	0xf26c, 0xf6f7, 0xfd31, 0x0254, 0x0512, 0x098f, 0x0ff8, 0x10a8,
-	0x0d68, 0x0af1, 0x0781, 0xfffa, 0xf83d, 0xf3be, 0xf153, 0xf237,
-	0xf3f0, 0xf4ee, 0xf893, 0xff45, 0x05c4, 0x07d3, 0x090f, 0x0b04,
-	0x06b2, 0x01e8, 0x0148, 0xff0f, 0xfca3, 0xfb90, 0xf9ae, 0xf845,
-	0xf9fe, 0xff23, 0x047a, 0x06b6, 0x0759, 0x059c, 0x016b, 0xfdb8,
-	0xfad4, 0xf9a6, 0xfa63, 0xfa9b, 0xf861, 0xf6cc, 0xf993, 0xfea2,
-	0x01c5, 0x0451, 0x095f, 0x0ad2, 0x07aa, 0x066d, 0x066e, 0x0640,
-	0x03a5, 0xfe85, 0xf99a, 0xf631, 0xf6e1, 0xf709, 0xf46f, 0xf648,
-	0xf9aa, 0xfb1a, 0xfe78, 0x02c7, 0x069a, 0x0963, 0x0bce, 0x0b83,
-	0x063d, 0x02e1, 0x036c, 0x01dd, 0xfd9d, 0xfa4b, 0xf573, 0xf080,
-	0xf01c, 0xf16d, 0xf617, 0xfd44, 0x01d7, 0x0442, 0x079c, 0x0d48,
-	0x0f1e, 0x0c89, 0x0be1, 0x09a8, 0x01ee, 0xf97a, 0xf3e0, 0xf1c0,
-	0xf212, 0xf3e8, 0xf68c, 0xf7f9, 0xfbe6, 0x026d, 0x064d, 0x0900,
-	0x09dc, 0x0728, 0x02d8, 0xffc4, 0xfe7c, 0xfc4c, 0xfa81, 0xfa69,
-	0xf9d2, 0xf90b, 0xfde1, 0x04fc, 0x070a, 0x07df, 0x08b5, 0x054e,
-	0xff15, 0xf9a6, 0xf790, 0xf86d, 0xf991, 0xf9b6, 0xf7ae, 0xf951,
-	0xffa0, 0x0379, 0x06d8, 0x0c54, 0x0e9c, 0x0aaf, 0x06b1, 0x058e,
-	0x02a9, 0xff21, 0xfcf8, 0xf92b, 0xf558, 0xf557, 0xf6c6, 0xf6e6,
-	0xf81d, 0xfb9a, 0xfe01, 0xffff, 0x029d, 0x0417, 0x063d, 0x09aa,
-	0x0992, 0x03a5, 0xff59, 0x0102, 0x0142, 0xfe1a, 0xfb7e, 0xf890,
-	0xf4b5, 0xf201, 0xf411, 0xf8ec, 0xfd56, 0x01a2, 0x0430, 0x058c,
-	0x0858, 0x0b49, 0x0abe, 0x0a07, 0x0a62, 0x053a, 0xfc89, 0xf751,
-	0xf583, 0xf4f3, 0xf68c, 0xf92a, 0xfa49, 0xfa9f, 0xff39, 0x0482,
-	0x04c5, 0x059b, 0x067b, 0x0489, 0x0177, 0xfea6, 0xfbee, 0xfa67,
-	0xfbbe, 0xfbb1, 0xfa75, 0xfe95, 0x05a9, 0x0828, 0x08b3, 0x0a4c,
-	0x0824, 0x014f, 0xfb6f, 0xf8c0, 0xf6fd, 0xf637, 0xf55a, 0xf3b8,
-	0xf3b5, 0xf8ba, 0xff64, 0x045b, 0x0ae4, 0x0e44, 0x0cbb, 0x0a82,
-	0x084c, 0x05d6, 0x01f3, 0xfe9b, 0xfb58, 0xf569, 0xf1fa, 0xf40a,
-	0xf547, 0xf625, 0xfa10, 0xfe61, 0x00d5, 0x0236, 0x04e6, 0x0866,
-	0x0b17, 0x0b39, 0x0771, 0x02dd, 0x02c8, 0x03f8, 0x0054, 0xfc83,
-	0xfa1c, 0xf5c1, 0xf170, 0xf16e, 0xf521, 0xf8df, 0xfd89, 0x0304,
-	0x052c, 0x069e, 0x0a39, 0x0bed, 0x0c7b, 0x0bf7, 0x06ef, 0xfee5,
-	0xf74c, 0xf3be, 0xf318, 0xf475, 0xf7e9, 0xf88d, 0xf824, 0xfd15,
-	0x034e, 0x0512, 0x05b1, 0x06ec, 0x0700, 0x0438, 0xffdb, 0xfcca,
-	0xfba6, 0xfb90, 0xfb2f, 0xf9ae, 0xfaed, 0x014f, 0x06a2, 0x08e3,
-	0x0a5a, 0x0924, 0x0466, 0xfe42, 0xfaf8, 0xf9fe, 0xf7a9, 0xf685,
-	0xf54b, 0xf39f, 0xf5c4, 0xfbde, 0x036e, 0x08f0, 0x0cfd, 0x0f24,
-	0x0d57, 0x0a5c, 0x079a, 0x0465, 0x022c, 0x0069, 0xfaaa, 0xf3a4,
-	0xf1c5, 0xf2b2, 0xf3ba, 0xf6bd, 0xfc37, 0x006d, 0x0129, 0x02f7,
-	0x06c1, 0x0902, 0x09d5, 0x07c0, 0x02c5, 0x0057, 0x0071, 0xfec6,
-	0xfc05, 0xfa31, 0xf893, 0xf5ef, 0xf507, 0xf686, 0xf8bb, 0xfcbd,
-	0x016f, 0x0368, 0x02fe, 0x0433, 0x082b, 0x0ad4, 0x0b16, 0x0963,
-	0x03f0, 0xfcd4, 0xf828, 0xf728, 0xf830, 0xfa51, 0xfb93, 0xfaf5,
-	0xfce9, 0x0150, 0x0400, 0x041a, 0x044d, 0x063e, 0x04bc, 0xff16,
-	0xfb8c, 0xf9f7, 0xfa04, 0xfc2c, 0xfd18, 0xfd56, 0x0007, 0x05c6,
-	0x0a7e, 0x0b6d, 0x0a4b, 0x063c, 0x0003, 0xfaf6, 0xf7c0, 0xf44d,
-	0xf1f7, 0xf22f, 0xf142, 0xf1b0, 0xf7cd, 0xffbf, 0x06c5, 0x0c74,
-	0x10b0, 0x10fb, 0x0cb9, 0x08dc, 0x05b3, 0x02b4, 0xffd0, 0xf9ae,
-	0xf337, 0xf083, 0xf0bb, 0xf270, 0xf5d9, 0xfc0f, 0x014b, 0x034b,
-	0x05c9, 0x08f3, 0x0ae1, 0x0b42, 0x09e1, 0x059c, 0x019c, 0x000e,
-	0xfe7d, 0xfc10, 0xf949, 0xf7ea, 0xf6fb, 0xf50d, 0xf5bc, 0xf8c8,
-	0xfcb3, 0x01df, 0x03d3, 0x0274, 0x02ae, 0x05dc, 0x09aa, 0x0a7a,
-	0x0910, 0x05e8, 0xff3a, 0xf975, 0xf84d, 0xf928, 0xfaaa, 0xfc47,
-	0xfc3a, 0xfbac, 0xfcec, 0xfec8, 0xffec, 0x0162, 0x0425, 0x0400,
-	0xff7f, 0xfbbe, 0xfa0e, 0xf9ea, 0xfcc3, 0xfe33, 0xfd2d, 0xfed0,
-	0x03be, 0x0922, 0x0aac, 0x0979, 0x07b6, 0x02dd, 0xfdf6, 0xfa4b,
-	0xf5ba, 0xf3ce, 0xf330, 0xf1cf, 0xf314, 0xf788, 0xfee1, 0x0709,
-	0x0cf5, 0x1153, 0x11e0, 0x0dac, 0x098a, 0x069f, 0x03a9, 0x00c1,
-	0xfbf9, 0xf4d0, 0xf114, 0xf0dc, 0xf33f, 0xf76b, 0xfb5f, 0x00e3,
-	0x0382, 0x03b4, 0x04ec, 0x05ac, 0x06a6, 0x06b3, 0x03cb, 0xff8d,
-	0xfc81, 0xfce0, 0xfce2, 0xfac8, 0xfb1c, 0xfb9e, 0xfa1b, 0xf95a,
-	0xf9ec, 0xfc8c, 0x001a, 0x01d4, 0x00c1, 0xff38, 0x013b, 0x058c,
-	0x0808, 0x0842, 0x0688, 0x0206, 0xfdf2, 0xfcb1, 0xfbd7, 0xfccf,
-	0xff09, 0xfedb, 0xfd94, 0xfce5, 0xfdac, 0xff36, 0x0072, 0x02c9,
-	0x0320, 0x0011, 0xfc66, 0xf9e8, 0xfb09, 0xfe56, 0x0027, 0x003c,
-	0x00cb, 0x0481, 0x0919, 0x0adc, 0x0a42, 0x0846, 0x04c4, 0xff51,
-	0xf9be, 0xf517, 0xf1ce, 0xf0bf, 0xf0de, 0xf11c, 0xf2e5, 0xf900,
-	0x017f, 0x0950, 0x0fb8, 0x11d6, 0x0f92, 0x0bb3, 0x07bd, 0x04f4,
-	0x0246, 0xfd43, 0xf60e, 0xef5c, 0xecc3, 0xee71, 0xf22a, 0xf7e5,
-	0xff78, 0x0537, 0x0780, 0x0869, 0x091b, 0x0a4e, 0x0ad1, 0x0882,
-	0x036e, 0xfea1, 0xfc1d, 0xfaa4, 0xf967, 0xf9db, 0xfb6a, 0xfaee,
-	0xfa9d, 0xfb9a, 0xfd14, 0x00a2, 0x0330, 0x0286, 0x010b, 0x0155,
-	0x0437, 0x061d, 0x05e6, 0x047f, 0x00e4, 0xfd69, 0xfaea, 0xf9ba,
-	0xfb31, 0xfd60, 0xfe8a, 0xfdd5, 0xfc3d, 0xfbfd, 0xfd30, 0xff5a,
-	0x022d, 0x0426, 0x01b1, 0xfd18, 0xfa29, 0xfa36, 0xfd1e, 0xfeac,
-	0xfee9, 0xff89, 0x00de, 0x0543, 0x08b2, 0x08ed, 0x09f2, 0x08ac,
-	0x0465, 0xfeca, 0xf864, 0xf459, 0xf344, 0xf334, 0xf344, 0xf3d5,
-	0xf800, 0xff86, 0x06f9, 0x0d89, 0x104e, 0x0f13, 0x0be0, 0x080a,
-	0x051a, 0x0315, 0xffcf, 0xfa30, 0xf40f, 0xf0b0, 0xf135, 0xf326,
-	0xf787, 0xfe8b, 0x03b7, 0x067c, 0x078b, 0x0687, 0x0708, 0x07f3,
-	0x064d, 0x02d9, 0xfd48, 0xf94f, 0xf804, 0xf7cb, 0xf9e7, 0xfbc8,
-	0xfcb8, 0xfdad, 0xfd6d, 0xfddb, 0xffe9, 0x00f4, 0x00b5, 0xff17,
-	0xfdc8, 0xff60, 0x0164, 0x026a, 0x0349, 0x02c6, 0x0136, 0xff9f,
-	0xfe6d, 0xffa0, 0x021f, 0x0358, 0x024b, 0xfee8, 0xfc38, 0xfba5,
-	0xfc29, 0xfeba, 0x00a1, 0xff1b, 0xfca2, 0xfa98, 0xfb1c, 0xfe3c,
-	0x0147, 0x0329, 0x03c7, 0x0504, 0x06da, 0x0772, 0x07b9, 0x07f1,
-	0x067d, 0x0371, 0xfe70, 0xf76f, 0xf27f, 0xf1a9, 0xf23a, 0xf22e,
-	0xf2e8, 0xf697, 0xfd77, 0x04ac, 0x0adf, 0x0e48, 0x0deb, 0x0bc9,
-	0x079a, 0x03c3, 0x017b, 0xfe18, 0xf9e1, 0xf52b, 0xf220, 0xf1f0,
-	0xf3fa, 0xf8fe, 0xff79, 0x0518, 0x087d, 0x08ac, 0x0750, 0x06f3,
-	0x076b, 0x06d1, 0x0375, 0xfde3, 0xf94e, 0xf7d0, 0xf82e, 0xfa45,
-	0xfd09, 0xfef9, 0x0062, 0x0049, 0x0006, 0x00e5, 0x01da, 0x01bc,
-	0xffe0, 0xfda5, 0xfdd8, 0xfe52, 0xfead, 0xffab, 0xffdb, 0x000d,
-	0xff43, 0xfe23, 0xff7d, 0x02e0, 0x04e3, 0x03f7, 0x00ac, 0xfd17,
-	0xfb46, 0xfad8, 0xfbea, 0xfccb, 0xfc48, 0xfb5d, 0xfa4a, 0xfa2b,
-	0xfcb1, 0x0028, 0x02dc, 0x0447, 0x0429, 0x04b1, 0x05b7, 0x0664,
-	0x0719, 0x06ae, 0x051d, 0x00e9, 0xfa64, 0xf5f6, 0xf46e, 0xf4f3,
-	0xf57d, 0xf533, 0xf71b, 0xfcae, 0x0369, 0x0901, 0x0cdf, 0x0dee,
-	0x0cbe, 0x09c2, 0x0670, 0x040f, 0x013f, 0xfdd6, 0xf9c4, 0xf50f,
-	0xf2c7, 0xf35f, 0xf649, 0xfc54, 0x017e, 0x04af, 0x05c9, 0x04f9,
-	0x04cc, 0x0560, 0x055c, 0x0316, 0xfde3, 0xf90c, 0xf6f7, 0xf6e7,
-	0xf935, 0xfc56, 0xff41, 0x01c4, 0x0259, 0x011c, 0x00cb, 0x015d,
-	0x00e6, 0xfedb, 0xfc2b, 0xfb83, 0xfc15, 0xfccd, 0xfee9, 0x00c7,
-	0x01ea, 0x0206, 0x00b6, 0x014b, 0x0444, 0x065d, 0x06de, 0x03c1,
-	0xff89, 0xfd21, 0xfc44, 0xfd46, 0xfd17, 0xfba1, 0xfaa5, 0xf956,
-	0xf8ae, 0xfa25, 0xfdc9, 0x0209, 0x048c, 0x0490, 0x0468, 0x052c,
-	0x0627, 0x07b5, 0x0886, 0x0748, 0x03a0, 0xfcee, 0xf740, 0xf4db,
-	0xf47f, 0xf4c1, 0xf406, 0xf503, 0xf9ba, 0xfefc, 0x0485, 0x08da,
-	0x0aa6, 0x0b1f, 0x0920, 0x061c, 0x02ec, 0xffe9, 0xfd68, 0xf9fa,
-	0xf5c1, 0xf332, 0xf313, 0xf5e8, 0xfbac, 0x00e5, 0x04b6, 0x0721,
-	0x0757, 0x06b3, 0x0730, 0x07dd, 0x0634, 0x013d, 0xfbb4, 0xf91d,
-	0xf890, 0xf9c0, 0xfc2b, 0xfe31, 0x00de, 0x01bf, 0x0080, 0xffca,
-	0x0040, 0x0122, 0x0086, 0xfe4e, 0xfce9, 0xfc19, 0xfc61, 0xfe5b,
-	0xfff8, 0x00cb, 0x00ed, 0x00bf, 0x010b, 0x0275, 0x0477, 0x04f9,
-	0x027d, 0xfe89, 0xfc04, 0xfaa2, 0xfa89, 0xfafe, 0xfa24, 0xf9a3,
-	0xf9b3, 0xf9bf, 0xfac7, 0xfd99, 0x024d, 0x04e4, 0x042d, 0x040a,
-	0x0412, 0x04ac, 0x06b8, 0x07f1, 0x07f2, 0x05bb, 0x00ba, 0xfaec,
-	0xf73f, 0xf6ba, 0xf6c0, 0xf601, 0xf6de, 0xfa03, 0xfde3, 0x02fb,
-	0x06ff, 0x0887, 0x0954, 0x0916, 0x06f0, 0x03f0, 0x0196, 0x004e,
-	0xfe98, 0xfaf8, 0xf7ed, 0xf647, 0xf737, 0xfbbd, 0xff31, 0x0190,
-	0x034c, 0x0346, 0x02ec, 0x02c6, 0x03d4, 0x03cb, 0xff9a, 0xfaff,
-	0xf863, 0xf7c4, 0xf96e, 0xfc7d, 0x001c, 0x0379, 0x0518, 0x03e9,
-	0x0130, 0xffbd, 0x002f, 0xff89, 0xfcf9, 0xfa3c, 0xf839, 0xf7c0,
-	0xfa09, 0xfcad, 0xfe64, 0x00dd, 0x034a, 0x04f1, 0x05fa, 0x07b5,
-	0x08d5, 0x06fc, 0x03e7, 0xffe7, 0xfc37, 0xfada, 0xfa2a, 0xf8c4,
-	0xf7c8, 0xf84a, 0xf91a, 0xfa47, 0xfdf1, 0x03ac, 0x0731, 0x0793,
-	0x06f4, 0x0557, 0x0474, 0x0577, 0x068a, 0x05dd, 0x03eb, 0xffba,
-	0xfa50, 0xf65c, 0xf581, 0xf68b, 0xf6c6, 0xf7e3, 0xf9cb, 0xfbf5,
-	0xffde, 0x0422, 0x0661, 0x0781, 0x07a6, 0x0636, 0x0305, 0xff3b,
-	0xfe34, 0xfdaf, 0xfb6a, 0xf88b, 0xf606, 0xf5ed, 0xf915, 0xfd5d,
-	0x001e, 0x029b, 0x0485, 0x0529, 0x0595, 0x0618, 0x06cd, 0x047e,
-	0x0069, 0xfd8f, 0xfaba, 0xfa11, 0xfc83, 0xff59, 0x02b4, 0x04cb,
-	0x03dc, 0x012c, 0xfe7a, 0xfe9d, 0xff09, 0xfd41, 0xfb13, 0xf89b,
-	0xf7cf, 0xf9e4, 0xfc9b, 0xfe98, 0x00e0, 0x03e1, 0x05c5, 0x0628,
-	0x0692, 0x077b, 0x075a, 0x04bb, 0x0044, 0xfbe7, 0xf99e, 0xf8c3,
-	0xf777, 0xf68a, 0xf65a, 0xf6be, 0xf7ee, 0xfa78, 0xffcd, 0x050a,
-	0x06a7, 0x0679, 0x04e3, 0x0377, 0x03f3, 0x04fa, 0x0625, 0x05dd,
-	0x0357, 0xff7b, 0xfae0, 0xf80d, 0xf834, 0xf897, 0xf8dc, 0xf9d1,
-	0xfb42, 0xfe78, 0x0290, 0x056f, 0x079b, 0x08b6, 0x0801, 0x053b,
-	0x0111, 0xff05, 0xffcc, 0xff1f, 0xfcce, 0xfaa5, 0xf9c9, 0xfc17,
-	0xfef6, 0x008b, 0x01b5, 0x0220, 0x023a, 0x0194, 0x013a, 0x01cf,
-	0x00bb, 0xfe01, 0xfad6, 0xf85f, 0xf7c9, 0xf9aa, 0xfde1, 0x028f,
-	0x05ad, 0x0572, 0x035f, 0x0108, 0xffd5, 0x006e, 0xff42, 0xfc05,
-	0xf8a4, 0xf640, 0xf768, 0xf99e, 0xfc12, 0xff95, 0x02d2, 0x064b,
-	0x0760, 0x072f, 0x087e, 0x0973, 0x07b2, 0x03f0, 0xff68, 0xfb67,
-	0xf8fd, 0xf798, 0xf702, 0xf5ef, 0xf5f8, 0xf751, 0xf986, 0xfdff,
-	0x03e3, 0x07b8, 0x081b, 0x07d9, 0x0624, 0x0530, 0x05d4, 0x061d,
-	0x05b1, 0x034f, 0xfff3, 0xfbac, 0xf7e6, 0xf715, 0xf795, 0xf7d0,
-	0xf8b2, 0xf936, 0xfb05, 0xfed6, 0x01f8, 0x05c9, 0x076f, 0x0733,
-	0x05ce, 0x0179, 0xff04, 0xff6f, 0xff09, 0xfc8f, 0xf99d, 0xf830,
-	0xf987, 0xfb93, 0xfdc3, 0x0004, 0x00e1, 0x0257, 0x0345, 0x025d,
-	0x0291, 0x02db, 0x00f8, 0xfeba, 0xfba1, 0xf978, 0xfafa, 0xfebd,
-	0x040b, 0x06d6, 0x06f7, 0x0631, 0x02b5, 0x0057, 0x0073, 0xff80,
-	0xfc4b, 0xf8ee, 0xf69f, 0xf643, 0xf7e1, 0xfa5e, 0xfdda, 0x0190,
-	0x05b7, 0x070f, 0x05ad, 0x0666, 0x07d9, 0x0796, 0x056d, 0x0123,
-	0xfc6c, 0xf98e, 0xf77c, 0xf6ef, 0xf60f, 0xf554, 0xf71f, 0xf84c,
-	0xfba4, 0x00ec, 0x0483, 0x0674, 0x061f, 0x0492, 0x036f, 0x02eb,
-	0x039c, 0x0410, 0x029d, 0x0149, 0xfe9b, 0xfad1, 0xf98e, 0xfb4b,
-	0xfd05, 0xfd3a, 0xfd12, 0xfda0, 0xffc0, 0x0224, 0x0520, 0x0703,
-	0x06a1, 0x0534, 0x012e, 0xfda4, 0xfde5, 0xfed4, 0xfe9a, 0xfd7d,
-	0xfcd6, 0xfc76, 0xfca9, 0xfe90, 0x000b, 0x005a, 0x01e5, 0x026a,
-	0x00b6, 0x0054, 0x009e, 0x0030, 0xfea7, 0xfb94, 0xf8cb, 0xf85f,
-	0xfbb2, 0x00f9, 0x0505, 0x072b, 0x0768, 0x04c4, 0x01db, 0x00f7,
-	0xff6d, 0xfc4f, 0xf896, 0xf546, 0xf456, 0xf51e, 0xf76f, 0xfc28,
-	0x00fd, 0x0613, 0x08a1, 0x076c, 0x07d6, 0x08fa, 0x091f, 0x0722,
-	0x0234, 0xfd8f, 0xf95d, 0xf734, 0xf754, 0xf699, 0xf5f5, 0xf75b,
-	0xf963, 0xfc0a, 0x003e, 0x044c, 0x072e, 0x0789, 0x06b8, 0x0579,
-	0x03c0, 0x03f8, 0x04de, 0x0420, 0x0331, 0x00f1, 0xfc1c, 0xf9fa,
-	0xfa9f, 0xfb37, 0xfb42, 0xfa4a, 0xfa40, 0xfb2d, 0xfd0f, 0x0057,
-	0x02c1, 0x0444, 0x04b8, 0x01ec, 0xfe7d, 0xfdc4, 0xfdb4, 0xfde4,
-	0xfdf8, 0xfd64, 0xfd30, 0xfd54, 0xfe30, 0xff69, 0xffb1, 0x0087,
-	0x017f, 0x007d, 0x0029, 0x007a, 0x007d, 0x0095, 0xfe73, 0xfc35,
-	0xfb66, 0xfcaf, 0x00fc, 0x047f, 0x061d, 0x069e, 0x04d3, 0x02a1,
-	0x013b, 0xffb4, 0xfe19, 0xfaad, 0xf7c5, 0xf74c, 0xf670, 0xf714,
-	0xfae0, 0xff7d, 0x0474, 0x076e, 0x0710, 0x06be, 0x07a1, 0x082f,
-	0x0745, 0x0389, 0xfeb7, 0xfa2f, 0xf6f1, 0xf664, 0xf56f, 0xf4b8,
-	0xf6f0, 0xf915, 0xfb65, 0xfe9f, 0x0191, 0x049c, 0x05ec, 0x0564,
-	0x041c, 0x01ee, 0x0158, 0x01f7, 0x0288, 0x02b5, 0x014e, 0xfe52,
-	0xfc5e, 0xfc82, 0xfd1e, 0xfd85, 0xfc4a, 0xfbc9, 0xfcab, 0xfdc8,
-	0x008c, 0x0346, 0x0575, 0x0688, 0x04d9, 0x0261, 0x005d, 0xff12,
-	0xffcf, 0xff4e, 0xfdf4, 0xfe15, 0xfd39, 0xfd22, 0xfe66, 0xfeeb,
-	0xffab, 0x0089, 0x00a3, 0xffcf, 0xff35, 0xffe5, 0x003a, 0xfe0b,
-	0xfc16, 0xfb32, 0xfb57, 0xfead, 0x024e, 0x049c, 0x0652, 0x05ec,
-	0x03f9, 0x01b2, 0xff21, 0xfcc6, 0xf9be, 0xf6dc, 0xf64b, 0xf582,
-	0xf58c, 0xf8ab, 0xfd3b, 0x02a1, 0x069d, 0x07c2, 0x080b, 0x083e,
-	0x0905, 0x0932, 0x0622, 0x01ff, 0xfe5a, 0xfa7e, 0xf84f, 0xf61f,
-	0xf4b9, 0xf5fb, 0xf87a, 0xfbb1, 0xfe2e, 0x007e, 0x0441, 0x0686,
-	0x0681, 0x062b, 0x0477, 0x024c, 0x01f1, 0x01e7, 0x0182, 0x0086,
-	0xfeb2, 0xfcf5, 0xfc24, 0xfd4e, 0xfe0c, 0xfc65, 0xfc45, 0xfccd,
-	0xfc59, 0xfd53, 0xff49, 0x00e1, 0x027b, 0x02c4, 0x0148, 0xfecb,
-	0xfd3a, 0xfde3, 0xfe71, 0xfe6c, 0xfebb, 0xfe3a, 0xfd9d, 0xfe3c,
-	0xfebb, 0xff8b, 0x0115, 0x017e, 0x009c, 0xff58, 0xffc0, 0x0081,
-	0xfe6e, 0xfd30, 0xfcd2, 0xfcb8, 0xfebb, 0x015a, 0x0424, 0x06d7,
-	0x07e3, 0x0715, 0x0468, 0x00dd, 0xfe5e, 0xfb03, 0xf803, 0xf6e7,
-	0xf5f8, 0xf5c2, 0xf83f, 0xfcfc, 0x01b1, 0x05d2, 0x0890, 0x0988,
-	0x08e9, 0x092a, 0x094a, 0x0591, 0x0189, 0xfe26, 0xfa41, 0xf6b5,
-	0xf3f7, 0xf27f, 0xf37d, 0xf719, 0xfaed, 0xfcda, 0xfee7, 0x02e7,
-	0x04be, 0x046c, 0x048c, 0x02f3, 0x00f2, 0x00a8, 0x00b6, 0x007a,
-	0x0049, 0xffd3, 0xff31, 0xfe6e, 0xff03, 0xffb5, 0xfe7e, 0xfecf,
-	0xff65, 0xfeca, 0xff26, 0x000a, 0x0091, 0x01e5, 0x02d4, 0x0267,
-	0x00a0, 0xfed7, 0xfff4, 0x0114, 0x010f, 0x0187, 0x012a, 0x00a5,
-	0xffd7, 0xfe71, 0xfdca, 0xfdbc, 0xfe25, 0xfe86, 0xfdc0, 0xfdf3,
-	0xfedd, 0xfda1, 0xfc9a, 0xfceb, 0xfcd6, 0xfd98, 0xff69, 0x01cd,
-	0x042a, 0x05cc, 0x069b, 0x0531, 0x01e0, 0xffa2, 0xfca9, 0xf8b4,
-	0xf6e0, 0xf57b, 0xf4e3, 0xf71b, 0xfaf6, 0xff6e, 0x0395, 0x0738,
-	0x0950, 0x0867, 0x082e, 0x08b6, 0x0649, 0x034a, 0x007b, 0xfcc3,
-	0xf982, 0xf62f, 0xf40c, 0xf53a, 0xf87e, 0xfc23, 0xfe9a, 0x0076,
-	0x02dc, 0x04c6, 0x0533, 0x0518, 0x03b0, 0x01cf, 0x00e1, 0x002a,
-	0x0008, 0xff82, 0xff62, 0x0096, 0x0080, 0xffc9, 0xffae, 0xfe68,
-	0xfd7a, 0xfd59, 0xfd1c, 0xfd20, 0xfce8, 0xfdfd, 0xffb5, 0x00ed,
-	0x01e4, 0x00e3, 0xfecc, 0xff01, 0x0030, 0xff8e, 0xff77, 0xfff0,
-	0xfffb, 0xffcf, 0xfeac, 0xfde2, 0xfd40, 0xfd7f, 0xfe9c, 0xfe1d,
-	0xfdbd, 0xfe7e, 0xfdf3, 0xfdbb, 0xfed3, 0xff5f, 0x0060, 0x01da,
-	0x03e2, 0x0599, 0x0681, 0x0759, 0x0667, 0x03af, 0x00f0, 0xfdeb,
-	0xfa42, 0xf75e, 0xf4f0, 0xf4bd, 0xf6f9, 0xf984, 0xfd81, 0x01c4,
-	0x05d2, 0x08dd, 0x0952, 0x094c, 0x0972, 0x07c1, 0x04c0, 0x01a4,
-	0xfe4d, 0xfab7, 0xf637, 0xf35a, 0xf3cf, 0xf4ff, 0xf842, 0xfc2b,
-	0xfe06, 0x004d, 0x0329, 0x0440, 0x0406, 0x0323, 0x0240, 0x0162,
-	0x0071, 0x0015, 0xfeba, 0xfe3f, 0xfffa, 0x006a, 0xfffe, 0x0054,
-	0x0045, 0xff82, 0xff66, 0xff90, 0xff3b, 0xfea4, 0xfeb9, 0xffd6,
-	0x0086, 0x0167, 0x0109, 0xff37, 0xffb4, 0x0110, 0x0143, 0x0173,
-	0x01b2, 0x024f, 0x0222, 0x0008, 0xfe58, 0xfd45, 0xfc69, 0xfdab,
-	0xfe43, 0xfd71, 0xfce8, 0xfc97, 0xfcf7, 0xfd87, 0xfe49, 0xff8a,
-	0x009f, 0x017b, 0x031e, 0x0433, 0x0509, 0x0611, 0x046a, 0x0156,
-	0xfebb, 0xfb14, 0xf6ac, 0xf3bb, 0xf472, 0xf661, 0xf7f6, 0xfbd5,
-	0x0066, 0x03c2, 0x07b4, 0x09ea, 0x0970, 0x08b7, 0x0790, 0x057d,
-	0x02ac, 0x0084, 0xfdf6, 0xf9ff, 0xf70e, 0xf629, 0xf61d, 0xf7dd,
-	0xfbe2, 0xfea8, 0x00fe, 0x0433, 0x057f, 0x054a, 0x040b, 0x0309,
-	0x0226, 0x0050, 0xfeb9, 0xfd2e, 0xfc89, 0xfea1, 0x00a7, 0x011b,
-	0x01a2, 0x0189, 0x00aa, 0xff41, 0xfe1b, 0xfd91, 0xfc51, 0xfb6f,
-	0xfc19, 0xfd1c, 0xfd87, 0xfe20, 0xfe7c, 0xff53, 0x00da, 0x01a3,
-	0x01e3, 0x01e7, 0x0306, 0x03a6, 0x01c3, 0xffa6, 0xfd91, 0xfb91,
-	0xfc1a, 0xfd19, 0xfbfd, 0xfb01, 0xfbb8, 0xfd2d, 0xfe1e, 0xff5c,
-	0x01cb, 0x02da, 0x039e, 0x04ad, 0x0428, 0x0432, 0x056e, 0x04e3,
-	0x0337, 0x019f, 0xfe22, 0xf988, 0xf650, 0xf606, 0xf6ed, 0xf818,
-	0xfaec, 0xfe32, 0x016c, 0x0567, 0x087f, 0x092c, 0x092e, 0x0837,
-	0x0610, 0x03b5, 0x00c9, 0xfe49, 0xfb61, 0xf8f0, 0xf764, 0xf625,
-	0xf6dc, 0xf9e3, 0xfca9, 0xfef5, 0x00f6, 0x01f4, 0x0253, 0x0109,
-	0x009e, 0x0139, 0x0000, 0xfe32, 0xfc91, 0xfbf3, 0xfd97, 0x0033,
-	0x018d, 0x0292, 0x02ce, 0x01df, 0x008c, 0xff5e, 0xff81, 0xfea0,
-	0xfdfc, 0xfed5, 0xfe5d, 0xfd6d, 0xfe89, 0xffe7, 0x0146, 0x032e,
-	0x0406, 0x0441, 0x03df, 0x03ee, 0x03fb, 0x0235, 0x0011, 0xfd14,
-	0xfa36, 0xfa6d, 0xfb53, 0xfaac, 0xfaa9, 0xfb9d, 0xfc7f, 0xfd9e,
-	0xfe76, 0x0053, 0x020d, 0x02c7, 0x036f, 0x026b, 0x01cc, 0x0269,
-	0x029c, 0x02d0, 0x01bd, 0xfe3d, 0xfa66, 0xf74e, 0xf62d, 0xf702,
-	0xf7e3, 0xfa3b, 0xfd16, 0xffb3, 0x0332, 0x05f9, 0x07c9, 0x0843,
-	0x074e, 0x0610, 0x046b, 0x01c6, 0xffe6, 0xfe65, 0xfca5, 0xfb3a,
-	0xf934, 0xf8b2, 0xfa63, 0xfc85, 0xfef9, 0x0107, 0x023f, 0x029c,
-	0x01c7, 0x01a7, 0x0258, 0x0116, 0xff20, 0xfd76, 0xfc33, 0xfd4e,
-	0xff87, 0x023b, 0x04c7, 0x051d, 0x0413, 0x01e3, 0xff40, 0xfda5,
-	0xfc49, 0xfbb1, 0xfc24, 0xfb50, 0xfa83, 0xfaf8, 0xfc56, 0xfefd,
-	0x010b, 0x01d3, 0x027a, 0x027b, 0x02c7, 0x037f, 0x0385, 0x0223,
-	0xff18, 0xfc25, 0xfb4e, 0xfaa1, 0xf9c5, 0xf9f8, 0xfa4e, 0xfb2e,
-	0xfc34, 0xfda3, 0x006e, 0x03b1, 0x05ff, 0x070c, 0x0647, 0x0484,
-	0x0301, 0x02a0, 0x03cf, 0x036a, 0x004c, 0xfc7d, 0xf91b, 0xf732,
-	0xf72e, 0xf819, 0xfa39, 0xfd28, 0xff3e, 0x0234, 0x051b, 0x07bc,
-	0x0953, 0x08e9, 0x0805, 0x0508, 0x0035, 0xfd21, 0xfc14, 0xfb1c,
-	0xfa1e, 0xf88e, 0xf7e1, 0xf868, 0xf9ed, 0xfd4b, 0xffb7, 0x00ad,
-	0x0089, 0xffd6, 0xfff6, 0x00d2, 0x00cc, 0xffb7, 0xfeab, 0xfd1f,
-	0xfcbf, 0xfd86, 0x0000, 0x038e, 0x04b3, 0x0449, 0x0335, 0x00d9,
-	0xff12, 0xfe93, 0xfea0, 0xfefb, 0xfd8b, 0xfc08, 0xfbc2, 0xfc45,
-	0xfefe, 0x018f, 0x02f9, 0x0445, 0x0445, 0x03dc, 0x0457, 0x0467,
-	0x02ae, 0xfff6, 0xfd7e, 0xfbaf, 0xfa10, 0xf9d7, 0xfb1f, 0xfbd9,
-	0xfc77, 0xfcd2, 0xfca2, 0xfe52, 0x0110, 0x034e, 0x054c, 0x05b2,
-	0x03ef, 0x021d, 0x01a9, 0x033f, 0x033e, 0x007d, 0xfd85, 0xf96e,
-	0xf6c1, 0xf62a, 0xf6b7, 0xf8fb, 0xfb4e, 0xfd25, 0xff59, 0x0126,
-	0x02eb, 0x053a, 0x06ed, 0x0772, 0x0573, 0x01bb, 0xff77, 0xfea9,
-	0xfe9b, 0xfe45, 0xfce6, 0xfba5, 0xfb3b, 0xfb54, 0xfd97, 0x0081,
-	0x0169, 0x01ff, 0x0186, 0x0108, 0x0104, 0x0014, 0xffbc, 0xff1b,
-	0xfdee, 0xfd08, 0xfcc0, 0xff24, 0x0318, 0x054e, 0x0605, 0x0473,
-	0x0053, 0xfcf7, 0xfb7e, 0xfbac, 0xfbf3, 0xfb4f, 0xfa6d, 0xf984,
-	0xfa03, 0xfc88, 0xff98, 0x0285, 0x04ef, 0x04f1, 0x0450, 0x052a,
-	0x04fd, 0x041f, 0x02b7, 0x0026, 0xfcbe, 0xf961, 0xf7c7, 0xf86a,
-	0xfa1e, 0xfbc2, 0xfc4d, 0xfcb1, 0xfecf, 0x010d, 0x03f9, 0x06e8,
-	0x0729, 0x0531, 0x02e2, 0x021e, 0x0264, 0x02a0, 0x01a9, 0xff27,
-	0xfb82, 0xf8bc, 0xf6f1, 0xf68f, 0xf907, 0xfb06, 0xfd21, 0xffda,
-	0x0155, 0x02f1, 0x05ec, 0x091a, 0x0a8c, 0x08ef, 0x0468, 0x0094,
-	0xfe74, 0xfda8, 0xfd71, 0xfc73, 0xfb81, 0xfa55, 0xfa02, 0xfbcc,
-	0xfdc7, 0xfeeb, 0xff67, 0xff1f, 0xfe62, 0xfdf5, 0xfdcc, 0xfe9b,
-	0xffa1, 0xfee6, 0xfce9, 0xfbf0, 0xfd20, 0xfff1, 0x036a, 0x05ab,
-	0x04ab, 0x0172, 0xff1c, 0xfdf3, 0xfd9f, 0xfe3f, 0xfdc6, 0xfcaa,
-	0xfc2f, 0xfc05, 0xfcf6, 0xffad, 0x03fb, 0x0687, 0x06bb, 0x06d1,
-	0x0601, 0x0446, 0x03cd, 0x037a, 0x0145, 0xfe4c, 0xfab5, 0xf82e,
-	0xf7f1, 0xf9ee, 0xfc36, 0xfcd2, 0xfd3b, 0xfdb3, 0xfe91, 0x0106,
-	0x047d, 0x0531, 0x03af, 0x0254, 0x0087, 0xffde, 0x001e, 0x004a,
-	0xff8e, 0xfd26, 0xfa46, 0xf856, 0xf873, 0xfa65, 0xfd2b, 0xff57,
-	0x0051, 0xff8a, 0xfeea, 0x00b0, 0x040e, 0x0717, 0x06d3, 0x03a6,
-	0x0134, 0xff66, 0xfe60, 0xfeee, 0xfef6, 0xfda6, 0xfc75, 0xfc12,
-	0xfd0d, 0xfe16, 0xffc0, 0x017e, 0x013d, 0x0066, 0xff12, 0xfd09,
-	0xfda2, 0xff53, 0xfec2, 0xfd83, 0xfd0d, 0xfd30, 0xffac, 0x043a,
-	0x07ba, 0x075d, 0x044e, 0x0162, 0xfe77, 0xfcad, 0xfca9, 0xfbbd,
-	0xface, 0xfa4a, 0xf934, 0xf9ad, 0xfc9d, 0x0119, 0x04c0, 0x0619,
-	0x0657, 0x04fe, 0x035f, 0x03df, 0x043a, 0x0260, 0xfefd, 0xfa65,
-	0xf6ce, 0xf5cf, 0xf6bd, 0xf949, 0xfb53, 0xfca6, 0xfe15, 0xff92,
-	0x0234, 0x0590, 0x071a, 0x06a2, 0x0517, 0x02bb, 0x0171, 0x00bf,
-	0x0113, 0x014c, 0xfec6, 0xfbff, 0xf9b8, 0xf82f, 0xf93d, 0xfc5b,
-	0xff8f, 0x0100, 0x00c4, 0x001f, 0x00ae, 0x034b, 0x0680, 0x06e2,
-	0x0496, 0x0206, 0xff13, 0xfd2f, 0xfddb, 0xfecf, 0xfe7b, 0xfdc1,
-	0xfd1c, 0xfc1f, 0xfb84, 0xfcea, 0xfed4, 0xff6e, 0xff08, 0xfd4d,
-	0xfb6d, 0xfc6c, 0xfeb8, 0xfff6, 0x001a, 0xfebe, 0xfd41, 0xfe52,
-	0x0196, 0x0548, 0x0662, 0x048a, 0x0277, 0xffed, 0xfde0, 0xfcff,
-	0xfca4, 0xfcad, 0xfc1b, 0xfac8, 0xfab7, 0xfca3, 0x0069, 0x051f,
-	0x07d6, 0x07b8, 0x0559, 0x02c1, 0x01e3, 0x0256, 0x0273, 0x0010,
-	0xfc45, 0xf939, 0xf71e, 0xf73a, 0xf9f4, 0xfcf7, 0xfeee, 0x002a,
-	0x0121, 0x0250, 0x0424, 0x05fc, 0x06be, 0x0554, 0x0275, 0xff8e,
-	0xfdff, 0xfed4, 0x0029, 0xff45, 0xfd04, 0xfac6, 0xf898, 0xf8d6,
-	0xfbe5, 0xff51, 0x00ea, 0x0034, 0xfe80, 0xfde8, 0xff50, 0x01bd,
-	0x0396, 0x034b, 0x0170, 0xfeae, 0xfca5, 0xfd58, 0xfee7, 0x0003,
-	0x00c4, 0x0074, 0xff37, 0xfea9, 0xff69, 0x018c, 0x02fc, 0x01c1,
-	0xfef9, 0xfc30, 0xfb24, 0xfc37, 0xfe65, 0x002f, 0xff96, 0xfe74,
-	0xfef0, 0x0123, 0x0449, 0x064d, 0x0610, 0x0446, 0x014e, 0xfd75,
-	0xfadb, 0xfa4d, 0xfb13, 0xfa8b, 0xf8e0, 0xf88a, 0xf8e3, 0xfbce,
-	0x01d6, 0x0699, 0x07f8, 0x0682, 0x0376, 0x01ed, 0x02d4, 0x03a8,
-	0x02d0, 0xfffa, 0xfc7b, 0xf8d9, 0xf68d, 0xf779, 0xfa23, 0xfc6d,
-	0xfe90, 0x0069, 0x00af, 0x0182, 0x03b1, 0x05f0, 0x06d3, 0x04ce,
-	0x0165, 0xfee5, 0xfecd, 0xffe0, 0x004d, 0xffc3, 0xfdbf, 0xfb00,
-	0xf93e, 0xfa3f, 0xfcfd, 0xff98, 0x001c, 0xff47, 0xfee2, 0xfea5,
-	0x0038, 0x0343, 0x0596, 0x0582, 0x0326, 0x00d5, 0xff78, 0xff88,
-	0x011d, 0x021b, 0x0102, 0xff62, 0xfd44, 0xfc18, 0xfdf0, 0x0009,
-	0xffae, 0xfe2b, 0xfc3f, 0xf9ee, 0xf9b8, 0xfc62, 0xff1c, 0xff76,
-	0xfe90, 0xfe61, 0xfe73, 0x0013, 0x02af, 0x0399, 0x03f7, 0x02f9,
-	0xffbb, 0xfcbb, 0xfc23, 0xfcb9, 0xfc6b, 0xfb8d, 0xfad3, 0xfa38,
-	0xfc1c, 0x0189, 0x067f, 0x0979, 0x0932, 0x0634, 0x03ce, 0x024b,
-	0x01da, 0x0188, 0x0023, 0xfd5f, 0xf9ed, 0xf791, 0xf7b8, 0xf9be,
-	0xfcce, 0xffd0, 0x0132, 0x0174, 0x016b, 0x025a, 0x04fd, 0x06a2,
-	0x047d, 0x00fa, 0xfea1, 0xfd00, 0xfd21, 0xfe61, 0xfeaa, 0xfd11,
-	0xfb5c, 0xfa74, 0xfa9d, 0xfd62, 0x0021, 0x0106, 0x00b6, 0xff96,
-	0xfdcb, 0xfd25, 0xff71, 0x01ef, 0x0244, 0x01bc, 0x00c8, 0xfee0,
-	0xff15, 0x01a1, 0x0324, 0x0320, 0x017e, 0xfeb5, 0xfd2e, 0xfe5f,
-	0x000b, 0x00d8, 0x00c4, 0xfeb7, 0xfb8d, 0xf9c7, 0xfaf8, 0xfd3e,
-	0xfe99, 0xff36, 0xff48, 0xff69, 0x002d, 0x022a, 0x0499, 0x0600,
-	0x04fb, 0x018a, 0xfe34, 0xfc4b, 0xfb97, 0xfc32, 0xfbc9, 0xf9b5,
-	0xf8af, 0xf9a8, 0xfd85, 0x0330, 0x06df, 0x0751, 0x062e, 0x0474,
-	0x0230, 0x0184, 0x021b, 0x0186, 0xfedc, 0xfb41, 0xf835, 0xf5b1,
-	0xf684, 0xfa37, 0xfdba, 0x0057, 0x0119, 0x0045, 0x00d6, 0x040c,
-	0x05c6, 0x04b2, 0x0299, 0x0007, 0xfd4b, 0xfd4b, 0xffb7, 0x010b,
-	0x015a, 0x0075, 0xfe95, 0xfcfc, 0xfcd1, 0xfe64, 0x0020, 0x0105,
-	0x0042, 0xfdfa, 0xfd28, 0xff5d, 0x019f, 0x0368, 0x03f1, 0x01ec,
-	0xff7b, 0xfee3, 0x00fc, 0x03b5, 0x049d, 0x0296, 0xff9a, 0xfd74,
-	0xfc1e, 0xfc7b, 0xfdbd, 0xfe12, 0xfcab, 0xfa4c, 0xf90c, 0xfa0f,
-	0xfccd, 0xff9f, 0x0150, 0x01d6, 0x011f, 0xffc8, 0x0008, 0x0255,
-	0x03e4, 0x0369, 0x01bd, 0xfefe, 0xfc10, 0xfb9d, 0xfd1d, 0xfd24,
-	0xfbf1, 0xfacb, 0xfa8d, 0xfd61, 0x0234, 0x060c, 0x0833, 0x08cc,
-	0x06e5, 0x034e, 0x00c5, 0x0029, 0xff9b, 0xfe1a, 0xfc25, 0xf92f,
-	0xf656, 0xf678, 0xf9ca, 0xfe55, 0x0200, 0x029b, 0x0174, 0x021e,
-	0x043f, 0x061a, 0x06a5, 0x0529, 0x01ef, 0xfec6, 0xfd4e, 0xfd6e,
-	0xfe56, 0xff13, 0xff20, 0xfe47, 0xfce9, 0xfc26, 0xfd50, 0xffbf,
-	0x00f2, 0xff82, 0xfcf0, 0xfb40, 0xfb1f, 0xfd09, 0xffd1, 0x0142,
-	0x009d, 0xff67, 0xfeb2, 0xffd4, 0x02aa, 0x03af, 0x02a1, 0x012e,
-	0xff2d, 0xfd48, 0xfdb8, 0xffd3, 0x01a7, 0x0189, 0xffa6, 0xfd4c,
-	0xfb6b, 0xfbfa, 0xfe37, 0x0005, 0x009e, 0x005f, 0xff66, 0xffc7,
-	0x01e9, 0x0352, 0x0400, 0x02db, 0xff7f, 0xfc34, 0xfb3e, 0xfc7c,
-	0xfd7e, 0xfce2, 0xfb8d, 0xfb23, 0xfc6f, 0xfeef, 0x01f7, 0x049e,
-	0x05cf, 0x04ad, 0x025e, 0x0081, 0x0001, 0x0067, 0x0055, 0xff0e,
-	0xfc16, 0xf8ad, 0xf758, 0xf910, 0xfd0c, 0x005d, 0x0106, 0x013d,
-	0x01aa, 0x01f1, 0x039d, 0x04b9, 0x0354, 0x0121, 0xfeff, 0xfd39,
-	0xfca2, 0xfd72, 0xff91, 0x0177, 0x01a6, 0x002e, 0xfdd0, 0xfd89,
-	0xfff8, 0x00e5, 0xffdd, 0xfe72, 0xfc86, 0xfb8c, 0xfce7, 0xff88,
-	0x0153, 0x0187, 0x00ca, 0x002d, 0x0113, 0x0369, 0x0502, 0x057b,
-	0x04c1, 0x01c8, 0xfe37, 0xfc74, 0xfca1, 0xfda0, 0xfdf1, 0xfd00,
-	0xfb6a, 0xf9bf, 0xfa6c, 0xfd7b, 0x0058, 0x01bf, 0x013a, 0x0032,
-	0x0002, 0x0012, 0x011a, 0x02a8, 0x0255, 0x0048, 0xfd8c, 0xfb4a,
-	0xfb74, 0xfc86, 0xfc2e, 0xfb9b, 0xfbbc, 0xfc96, 0xfe24, 0x01bb,
-	0x0685, 0x090d, 0x08ec, 0x0730, 0x0409, 0x0110, 0x0003, 0xff84,
-	0xfe34, 0xfbdf, 0xf8da, 0xf6fe, 0xf86e, 0xfc5b, 0xff70, 0x014b,
-	0x0243, 0x01cb, 0x017e, 0x033f, 0x0513, 0x04cc, 0x0366, 0x013d,
-	0xfec2, 0xfca9, 0xfba4, 0xfcbf, 0xfeda, 0xfff4, 0xfecd, 0xfcea,
-	0xfd36, 0xff4e, 0x0086, 0x006a, 0xff2d, 0xfcb4, 0xfb38, 0xfb5f,
-	0xfd25, 0xff44, 0xffec, 0x0001, 0x00b5, 0x013f, 0x01e3, 0x035d,
-	0x04a6, 0x0448, 0x01fc, 0xff2a, 0xfd44, 0xfcf5, 0xfe69, 0xfff7,
-	0x0003, 0xfeb0, 0xfc5a, 0xfb51, 0xfd4a, 0x0000, 0x00df, 0x00ea,
-	0x00ee, 0x0050, 0xff73, 0xffae, 0x00ee, 0x010c, 0xffda, 0xfda2,
-	0xfb98, 0xfbe2, 0xfd1e, 0xfdd4, 0xfeb4, 0xfef9, 0xfe30, 0xfe37,
-	0x0020, 0x0346, 0x0570, 0x061a, 0x0580, 0x0309, 0x007a, 0xffb1,
-	0xffa6, 0xff2b, 0xfd47, 0xf9d9, 0xf7f7, 0xf84a, 0xf9a5, 0xfcc0,
-	0xffb2, 0x014e, 0x0124, 0x003a, 0x00c1, 0x01f6, 0x026b, 0x01a5,
-	0x002f, 0xfe84, 0xfcf6, 0xfbe3, 0xfdd6, 0x01ef, 0x03fa, 0x03a9,
-	0x01cf, 0x0061, 0x0011, 0x008c, 0x00c7, 0xff92, 0xfda4, 0xfc00,
-	0xfb6f, 0xfcab, 0xfee1, 0xffcf, 0x00eb, 0x0204, 0x01b2, 0x01fc,
-	0x038a, 0x058b, 0x05d9, 0x03c6, 0x008e, 0xfd97, 0xfb72, 0xfb83,
-	0xfcc2, 0xfd04, 0xfc7d, 0xf9e0, 0xf8cc, 0xfb80, 0xfe9c, 0x00f4,
-	0x0216, 0x0255, 0x01db, 0x00c0, 0xfff3, 0x00ed, 0x01d3, 0x0155,
-	0xff79, 0xfd1a, 0xfbf2, 0xfb7e, 0xfc87, 0xfe05, 0xfe1f, 0xfd80,
-	0xfd77, 0xff10, 0x021e, 0x0543, 0x071f, 0x071f, 0x0525, 0x02a8,
-	0x0075, 0xfff3, 0xffff, 0xfd9c, 0xfacd, 0xf95d, 0xf82f, 0xf835,
-	0xfaa0, 0xfda4, 0xffe8, 0x00c8, 0x004a, 0x0105, 0x02e4, 0x04d8,
-	0x05bb, 0x04a4, 0x02fa, 0xffe6, 0xfccc, 0xfd20, 0xff5c, 0x008a,
-	0x0103, 0x0044, 0xfeb8, 0xfe3a, 0xfeb4, 0xff64, 0xfef9, 0xfd76,
-	0xfba5, 0xfa83, 0xfad6, 0xfbb2, 0xfd6c, 0x001c, 0x01df, 0x0235,
-	0x01eb, 0x02a8, 0x041b, 0x0424, 0x0254, 0xfff1, 0xfd57, 0xfb7d,
-	0xfb75, 0xfd67, 0xffb1, 0xffc0, 0xfe09, 0xfd30, 0xfdf6, 0xff48,
-	0x01a0, 0x033b, 0x036d, 0x032a, 0x0120, 0xff1a, 0xff76, 0x001d,
-	0x0003, 0xff60, 0xfd40, 0xfad1, 0xf9bd, 0xfb5a, 0xfe2e, 0xfee5,
-	0xff1f, 0xff8d, 0xff92, 0x00d1, 0x02f3, 0x04cd, 0x05c1, 0x050e,
-	0x0234, 0xffc9, 0xffa0, 0xff72, 0xfe15, 0xfcb2, 0xfb8f, 0xf9be,
-	0xf931, 0xfadd, 0xfdde, 0x008a, 0x014c, 0x0080, 0xffbc, 0x0029,
-	0x0158, 0x02aa, 0x0307, 0x01eb, 0xff19, 0xfca2, 0xfcd2, 0xfe81,
-	0x00d0, 0x0332, 0x02f7, 0x0143, 0xffdd, 0xfed9, 0xffd8, 0x0074,
-	0xff19, 0xfdfe, 0xfc87, 0xfb15, 0xfab6, 0xfbb5, 0xfe4d, 0x00a4,
-	0x0137, 0x0191, 0x02bd, 0x04e6, 0x069b, 0x0602, 0x0419, 0x0194,
-	0xfdc6, 0xfb7a, 0xfbcb, 0xfc92, 0xfc61, 0xfc02, 0xfbde, 0xfbfd,
-	0xfdaa, 0x0088, 0x02e3, 0x0406, 0x03bb, 0x015c, 0xff27, 0xfe89,
-	0xfe61, 0xff17, 0xffb8, 0xfe75, 0xfbfb, 0xfa30, 0xfacf, 0xfcaa,
-	0xfd2f, 0xfdb2, 0xfe42, 0xfe6e, 0xffe3, 0x016a, 0x0386, 0x067e,
-	0x06c9, 0x04fa, 0x0359, 0x01ce, 0x0062, 0xff4f, 0xfe04, 0xfcc7,
-	0xfb03, 0xf9b8, 0xfaa9, 0xfc6c, 0xfe8d, 0xffc5, 0xffa6, 0xffab,
-	0xfffb, 0x014f, 0x03c6, 0x0534, 0x0467, 0x0240, 0xffda, 0xfe2d,
-	0xfe0b, 0xff87, 0x0184, 0x022a, 0x013c, 0xfecb, 0xfca0, 0xfcf2,
-	0xfd54, 0xfcdf, 0xfc93, 0xfbdc, 0xfadb, 0xfaa3, 0xfbbf, 0xfe52,
-	0x010f, 0x0252, 0x029b, 0x0248, 0x02b5, 0x03e1, 0x03b8, 0x0353,
-	0x01e3, 0xfec7, 0xfcf2, 0xfcdf, 0xfcd8, 0xfd93, 0xfe12, 0xfd50,
-	0xfd03, 0xfd89, 0xff76, 0x0213, 0x03e1, 0x0470, 0x02f9, 0x00a3,
-	0xfe9c, 0xfd26, 0xfd21, 0xfe00, 0xfd7b, 0xfb7a, 0xf9ba, 0xf9f5,
-	0xfc34, 0xfea0, 0x0047, 0x00fe, 0x0141, 0x00f3, 0x008e, 0x01b8,
-	0x03ef, 0x04f3, 0x0503, 0x0456, 0x024a, 0x00c2, 0xfff4, 0xff2a,
-	0xfe87, 0xfcc0, 0xfae1, 0xfa9f, 0xfb6a, 0xfc8c, 0xfe3f, 0xfeea,
-	0xff07, 0xfeb2, 0xfef8, 0x0141, 0x023a, 0x01bd, 0x00d6, 0xfedb,
-	0xfd33, 0xfcd7, 0xfd78, 0xffca, 0x0268, 0x02c6, 0x0188, 0xffe2,
-	0xff9a, 0xff9e, 0xff53, 0xff87, 0xfef9, 0xfd82, 0xfc2b, 0xfc69,
-	0xfe05, 0xffdf, 0x01a0, 0x0312, 0x032c, 0x02ee, 0x0384, 0x040c,
-	0x044a, 0x02ca, 0x004b, 0xfe7d, 0xfcbe, 0xfb79, 0xfba5, 0xfc11,
-	0xfc19, 0xfc08, 0xfbbf, 0xfd4f, 0xffde, 0x0181, 0x02c9, 0x0241,
-	0x00c2, 0xffc2, 0xff05, 0xff6b, 0x00c2, 0x0035, 0xfe67, 0xfc16,
-	0xfa6d, 0xfb45, 0xfcd0, 0xfe64, 0x0032, 0x0058, 0xffc4, 0xffde,
-	0x00bb, 0x01f3, 0x036f, 0x0529, 0x04fd, 0x02b6, 0x00f8, 0xffea,
-	0xff49, 0xff53, 0xfe8a, 0xfd55, 0xfc4a, 0xfc00, 0xfc9f, 0xfc99,
-	0xfd32, 0xfdad, 0xfc9d, 0xfcef, 0xff4b, 0x016b, 0x035b, 0x0403,
-	0x0325, 0x01d5, 0xff9f, 0xfe8d, 0x0018, 0x0233, 0x035a, 0x02c8,
-	0x00fa, 0xff70, 0xfeed, 0xfeb0, 0xfe67, 0xfd83, 0xfba2, 0xf9fd,
-	0xf9ae, 0xfb0f, 0xfd8d, 0x0045, 0x030a, 0x0477, 0x0377, 0x02a2,
-	0x031b, 0x02f9, 0x0212, 0x007e, 0xfe85, 0xfcd9, 0xfb70, 0xfa7e,
-	0xfaec, 0xfcb5, 0xfd90, 0xfdda, 0xffa8, 0x021d, 0x038f, 0x0474,
-	0x0454, 0x02d3, 0x00d5, 0xfeef, 0xfe77, 0xfe64, 0xfdd8, 0xfcd0,
-	0xfab2, 0xf99d, 0xfa6b, 0xfb90, 0xfde5, 0x00ac, 0x00e0, 0x006c,
-	0x0090, 0x0068, 0x0133, 0x0294, 0x0441, 0x0519, 0x0383, 0x0181,
-	0x00a5, 0xffa4, 0xfefe, 0xfe2f, 0xfce9, 0xfcbf, 0xfc7c, 0xfc81,
-	0xfdce, 0xfee4, 0xfe9c, 0xfe0e, 0xfdb7, 0xfde8, 0xfee7, 0x0034,
-	0x0139, 0x015b, 0x00b5, 0xff6f, 0xff16, 0x0037, 0x0128, 0x0225,
-	0x0207, 0x0063, 0xff39, 0xfe90, 0xfef1, 0x002a, 0x0049, 0xff23,
-	0xfd91, 0xfbc7, 0xfb8e, 0xfc7e, 0xfe16, 0x01a9, 0x0439, 0x0488,
-	0x04bc, 0x0357, 0x01b7, 0x01fc, 0x015f, 0x001d, 0xfeac, 0xfbff,
-	0xfa17, 0xfa3f, 0xfb96, 0xfc74, 0xfd01, 0xfee2, 0x00e6, 0x0176,
-	0x029e, 0x02d0, 0x018e, 0x02ec, 0x03d2, 0x0131, 0xfedc, 0xfde1,
-	0xfbc6, 0xfaa9, 0xfe54, 0x0001, 0xfcdb, 0xfcab, 0xfe71, 0xfebe,
-	0xff01, 0xfee9, 0xfe56, 0xfe2b, 0xfede, 0x014e, 0x02e7, 0x0224,
-	0x022f, 0x021a, 0x0113, 0x00ac, 0xffac, 0xfe03, 0xfcea, 0xfea0,
-	0x01d3, 0x004e, 0xfd18, 0xfcd8, 0xfba3, 0xfa86, 0xfed0, 0x0351,
-	0x01a4, 0x0010, 0x018e, 0x01cc, 0x013e, 0x0144, 0x0170, 0x01cb,
-	0x0234, 0x0214, 0x00a5, 0xfe8e, 0xfd84, 0xfe9e, 0xff48, 0xfdd2,
-	0xfbc5, 0xf97d, 0xf851, 0xf905, 0xfc83, 0x010e, 0x031a, 0x0392,
-	0x03e1, 0x0292, 0x0067, 0x02ce, 0x0565, 0x02d5, 0x0092, 0xff9f,
-	0xfd51, 0xfb1a, 0xfa7d, 0xfb73, 0xfcb5, 0xfdce, 0xff80, 0xfff9,
-	0xff93, 0x0218, 0x05dc, 0x067a, 0x04b1, 0x0221, 0xff76, 0xfd16,
-	0xfbd2, 0xfd29, 0xfd11, 0xf983, 0xf832, 0xf923, 0xf98a, 0xfbbe,
-	0x00f8, 0x03c4, 0x0213, 0x00a4, 0xffac, 0xfee9, 0x0027, 0x0316,
-	0x052c, 0x04ee, 0x033b, 0x018f, 0x00d2, 0x001d, 0x010e, 0x0238,
-	0x006b, 0xfe51, 0xfc94, 0xfaea, 0xfa8d, 0xfc1d, 0xff28, 0x002c,
-	0xfe02, 0xfd65, 0xfe0a, 0xfd82, 0xff23, 0x0250, 0x02e5, 0x0114,
-	0xffa2, 0xff7f, 0xff13, 0xfdfe, 0xff94, 0x0192, 0x0092, 0x0010,
-	0x000b, 0xfe4a, 0xfce3, 0xfd62, 0xfe13, 0xfd72, 0xfe51, 0x00e8,
-	0x0247, 0x02a4, 0x0413, 0x054e, 0x0449, 0x02ea, 0x0269, 0x00b0,
-	0xfd7d, 0xfcec, 0xfe15, 0xfc3a, 0xfa6c, 0xfb22, 0xfc85, 0xfe43,
-	0x0081, 0x0354, 0x048f, 0x0320, 0x023c, 0x0138, 0xfef0, 0xfe7c,
-	0xff35, 0xfefc, 0xfe94, 0xfd69, 0xfbd8, 0xfad1, 0xfa69, 0xfcad,
-	0xffcb, 0x0015, 0x000b, 0xff9e, 0xfde5, 0xfd2a, 0xfe97, 0x017c,
-	0x02b2, 0x020b, 0x01c2, 0x00d9, 0xff08, 0xffd6, 0x02cf, 0x037f,
-	0x0254, 0x0135, 0xffbd, 0xfce2, 0xfb3f, 0xfc9a, 0xfd67, 0xfcec,
-	0xfc6a, 0xfba3, 0xfae2, 0xfbb6, 0xffa3, 0x035b, 0x03b4, 0x03bc,
-	0x03b9, 0x01ac, 0x0119, 0x0269, 0x02af, 0x01d6, 0x00b2, 0xffce,
-	0xfe91, 0xfd3b, 0xfdec, 0xff0e, 0xfcf4, 0xfb08, 0xfa87, 0xfa76,
-	0xfcda, 0x0114, 0x0523, 0x05ba, 0x033d, 0x01af, 0x015a, 0x006f,
-	0x00a5, 0x020e, 0x0101, 0xfe3f, 0xfb44, 0xf900, 0xf870, 0xfa25,
-	0xfe21, 0x013c, 0x0205, 0x01fb, 0x0265, 0x02bc, 0x0305, 0x045d,
-	0x04b2, 0x018b, 0xfdcf, 0xfc19, 0xfa00, 0xf8ea, 0xfaa6, 0xfcf4,
-	0xfdb6, 0xfdde, 0xff2f, 0xffcb, 0xfe80, 0xfec2, 0x0112, 0x00d8,
-	0x0004, 0x0102, 0x011a, 0x00ec, 0x01ca, 0x034e, 0x03af, 0x0289,
-	0x01ce, 0x00ff, 0xfef1, 0xfe49, 0xff5d, 0xfe72, 0xfd54, 0xfd7a,
-	0xfd49, 0xfbfe, 0xfb15, 0xfbd7, 0xfd09, 0xfdb9, 0xff04, 0x005d,
-	0x006f, 0x0146, 0x034b, 0x049b, 0x03bd, 0x01c2, 0x007a, 0xfeea,
-	0xfdd4, 0xfe41, 0xff86, 0x0059, 0xff66, 0xfdc3, 0xfcae, 0xfbc8,
-	0xfc39, 0x0006, 0x0347, 0x03ee, 0x036f, 0x015a, 0xff55, 0xff4a,
-	0x0134, 0x0290, 0x0139, 0xffcd, 0xfecf, 0xfbad, 0xf9ef, 0xfbff,
-	0xfdfe, 0xff39, 0x00f3, 0x0183, 0x005d, 0xff9e, 0x0208, 0x054c,
-	0x053b, 0x0383, 0x01b2, 0xfe1f, 0xfb48, 0xfb21, 0xfc82, 0xfd2c,
-	0xfcb3, 0xfc85, 0xfc4f, 0xfcc0, 0xfeb0, 0x00b1, 0x0132, 0x00b0,
-	0xff95, 0xfdae, 0xfc5b, 0xfd4c, 0x0004, 0x013f, 0x00f7, 0x013d,
-	0x00ac, 0x0092, 0x01ae, 0x0376, 0x048f, 0x0238, 0xfeb3, 0xfcef,
-	0xfb9a, 0xfb0a, 0xfc78, 0xfdef, 0xfdbb, 0xfcf5, 0xfd1f, 0xfea1,
-	0xff5e, 0x0112, 0x04f2, 0x05ad, 0x03df, 0x022d, 0x0021, 0xff2a,
-	0x0053, 0x01cd, 0x0154, 0xff8f, 0xfe70, 0xfcd8, 0xfa49, 0xfa0c,
-	0xfbc4, 0xfc43, 0xfd0c, 0x0008, 0x0261, 0x0225, 0x01b5, 0x033b,
-	0x03fc, 0x028f, 0x014d, 0x0017, 0xfeaa, 0xfd80, 0xfd8a, 0xfe42,
-	0xfd02, 0xfc78, 0xfe3f, 0xff7e, 0xffb7, 0x0086, 0x0173, 0x0288,
-	0x03a4, 0x038b, 0x028b, 0x00c5, 0xff67, 0xfedf, 0xfd6f, 0xfc4d,
-	0xfbda, 0xfa7f, 0xf9c4, 0xfad5, 0xfd1b, 0xfedb, 0xfee5, 0xff27,
-	0x002d, 0xff55, 0xfdb1, 0xfeff, 0x0172, 0x01ac, 0x0195, 0x01fd,
-	0x012b, 0x003c, 0x01f2, 0x04d6, 0x0565, 0x046e, 0x02b3, 0xffce,
-	0xfcec, 0xfc7f, 0xfddf, 0xfdcb, 0xfcf6, 0xfba0, 0xf958, 0xf867,
-	0xfaac, 0xfe4c, 0x012e, 0x03e0, 0x056e, 0x03cd, 0x0042, 0xfe71,
-	0xffde, 0x00d6, 0xffd8, 0xff29, 0xfe7a, 0xfcd3, 0xfc29, 0xfdee,
-	0xffe3, 0xff99, 0xfe31, 0xfdf1, 0xfe9d, 0xff55, 0x01aa, 0x041f,
-	0x04a5, 0x043d, 0x02fd, 0x0100, 0xffb5, 0xffc3, 0x0096, 0x0027,
-	0xfdd5, 0xfb37, 0xf9bd, 0xfa4c, 0xfd32, 0x00e6, 0x0223, 0x015b,
-	0x0198, 0x0258, 0x0194, 0x012f, 0x031c, 0x0357, 0x00a2, 0xfdda,
-	0xfc89, 0xfb76, 0xfaf9, 0xfd6b, 0xffe5, 0xff6b, 0xfe27, 0xfd63,
-	0xfc9e, 0xfd46, 0xfef6, 0xffa0, 0xff58, 0xfeae, 0xfe69, 0xfe45,
-	0xfe28, 0xffd0, 0x0219, 0x0319, 0x0392, 0x03be, 0x028d, 0x00ee,
-	0x002b, 0x006f, 0xff5b, 0xfd5e, 0xfd04, 0xfcad, 0xfa9b, 0xf93b,
-	0xfab0, 0xfc66, 0xfd74, 0xff68, 0x024c, 0x0448, 0x0461, 0x03f8,
-	0x0353, 0x02c5, 0x01b3, 0x0077, 0xff65, 0xfd9a, 0xfcfa, 0xfde5,
-	0xfe17, 0xfdbe, 0xfdf4, 0xfd72, 0xfd21, 0xfea5, 0x0125, 0x02eb,
-	0x02ff, 0x03af, 0x0395, 0x00e0, 0xff9c, 0x0080, 0x007d, 0x000b,
-	0x0029, 0xfec2, 0xfbd0, 0xfa22, 0xfc36, 0xff34, 0xff98, 0xfec6,
-	0xfe19, 0xfddf, 0xfee6, 0x011f, 0x0363, 0x04b2, 0x0455, 0x01f1,
-	0xfe32, 0xfb2e, 0xfb1d, 0xfc91, 0xfe0e, 0xfefc, 0xfe93, 0xfca5,
-	0xfb09, 0xfc9e, 0xffdb, 0x00de, 0x005f, 0xffab, 0xfe1f, 0xfd3d,
-	0xfe33, 0x00cd, 0x034e, 0x03c5, 0x041f, 0x0443, 0x02e7, 0x018f,
-	0x0222, 0x02e5, 0x01d3, 0xfee8, 0xfc7d, 0xfb6e, 0xfa87, 0xfb3a,
-	0xfc4d, 0xfbaa, 0xfb5a, 0xfbd4, 0xfc31, 0xfe33, 0x0275, 0x0563,
-	0x04d6, 0x033f, 0x0223, 0x0028, 0xfdef, 0xfe3a, 0xffc6, 0xffae,
-	0xfebd, 0xfe49, 0xfd77, 0xfc89, 0xfd6d, 0xffbb, 0x0152, 0x0164,
-	0x0101, 0x0172, 0x01d8, 0x0220, 0x0318, 0x0361, 0x01b3, 0xffba,
-	0xfe73, 0xfd48, 0xfcc1, 0xfd42, 0xfd98, 0xfe30, 0xff37, 0xfef2,
-	0xfd63, 0xfca4, 0xfe9e, 0x012f, 0x01b0, 0x0204, 0x02e2, 0x02c5,
-	0x018d, 0x0083, 0x0039, 0xffd1, 0xff3d, 0xff4a, 0xffc1, 0xfe1e,
-	0xfc36, 0xfd25, 0xfe38, 0xfe21, 0xfe42, 0xfe18, 0xfd09, 0xfc47,
-	0xfd0a, 0xfe6c, 0xfeea, 0xff73, 0x005b, 0x004b, 0x00eb, 0x0276,
-	0x032b, 0x0390, 0x0400, 0x02e6, 0xff41, 0xfbe6, 0xfb9f, 0xfcad,
-	0xfce4, 0xfc8c, 0xfbf9, 0xfb63, 0xfac9, 0xfc4f, 0x00fd, 0x0498,
-	0x05eb, 0x062f, 0x0494, 0x01b7, 0xffd6, 0xffd0, 0x0055, 0xffe6,
-	0xfe80, 0xfd1a, 0xfb01, 0xfa74, 0xfc8d, 0xfe6c, 0xffc9, 0x0051,
-	0xff45, 0xfeb9, 0x0002, 0x027f, 0x04e1, 0x0530, 0x0427, 0x0236,
-	0xfefb, 0xfccb, 0xfd55, 0xff3e, 0xff47, 0xfe30, 0xfe38, 0xfe09,
-	0xfcd7, 0xfd19, 0xff56, 0x0096, 0x00ef, 0x00cc, 0x0067, 0x0006,
-	0x00cc, 0x02b9, 0x023b, 0x001e, 0xfe58, 0xfca3, 0xfc24, 0xfd0b,
-	0xfe02, 0xfeb1, 0xfeb1, 0xfdb3, 0xfcfb, 0xfba5, 0xfb38, 0xfd01,
-	0xfea8, 0xff72, 0xffbe, 0x004a, 0x0012, 0xfff7, 0x0228, 0x0516,
-	0x04fe, 0x0394, 0x0378, 0x02d7, 0x010d, 0xffe8, 0xff81, 0xfed0,
-	0xfe63, 0xfdeb, 0xfc60, 0xfa9d, 0xfa47, 0xfba4, 0xfd69, 0xff4c,
-	0x00d0, 0x01ed, 0x0255, 0x0247, 0x02cd, 0x0268, 0x00eb, 0xffb2,
-	0xfe6e, 0xfc96, 0xfb1e, 0xfb86, 0xfd43, 0xfe2a, 0xff3e, 0x00be,
-	0xffab, 0xfdf5, 0xfeed, 0x015c, 0x02f5, 0x03a3, 0x03a2, 0x0280,
-	0x006f, 0xfee4, 0xfedf, 0xffaf, 0xffd4, 0xffb6, 0xfeb9, 0xfd75,
-	0xfd8b, 0xfed9, 0x0006, 0x0073, 0x0043, 0xff78, 0xfdae, 0xfce4,
-	0xff5a, 0x0278, 0x03a8, 0x03e5, 0x0240, 0xfeb3, 0xfd03, 0xfecf,
-	0x00c4, 0x00f5, 0x00a2, 0xff67, 0xfcf1, 0xfabe, 0xfb12, 0xfcb5,
-	0xfdaf, 0xfd84, 0xfcc5, 0xfbfd, 0xfb81, 0xfd18, 0x004f, 0x037a,
-	0x0543, 0x04ad, 0x030b, 0x01d5, 0x01f8, 0x0344, 0x02dc, 0x0006,
-	0xfe2a, 0xfc94, 0xfa71, 0xfa66, 0xfbbb, 0xfcff, 0xfda7, 0xfe71,
-	0xfee8, 0xfeb4, 0xffa1, 0x02b9, 0x052c, 0x049f, 0x0359, 0x018b,
-	0xff49, 0xfd88, 0xfcdf, 0xfd56, 0xfd0a, 0xfc08, 0xfbf4, 0xfc6a,
-	0xfcb7, 0xfde0, 0xff8a, 0x0114, 0x0208, 0x031a, 0x0350, 0x021a,
-	0x02bd, 0x03a3, 0x02a0, 0x0118, 0xffed, 0xfefd, 0xfd8d, 0xfd25,
-	0xfe7e, 0xffc8, 0xffd5, 0x004b, 0xffdb, 0xfe26, 0xfd55, 0xfd84,
-	0xfeda, 0x0016, 0x00d3, 0x01e5, 0x01b3, 0xff73, 0xfe91, 0xff6a,
-	0xffa5, 0xffb7, 0xff69, 0xfe50, 0xfceb, 0xfc8b, 0xfd28, 0xfcfc,
-	0xfd2d, 0xfde4, 0xfd34, 0xfbd3, 0xfc5a, 0xfe63, 0x004f, 0x0236,
-	0x042e, 0x044c, 0x0264, 0x0152, 0x01ca, 0x0340, 0x0413, 0x02f5,
-	0x011e, 0xfe7f, 0xfc17, 0xfbd6, 0xfcdf, 0xfcb1, 0xfccd, 0xfd3c,
-	0xfca0, 0xfc32, 0xfd5e, 0x00c2, 0x03c5, 0x04b9, 0x0404, 0x011f,
-	0xfe2c, 0xfdf8, 0xfee7, 0xfef5, 0xfeed, 0xfe5d, 0xfce9, 0xfbed,
-	0xfd04, 0xff71, 0x0112, 0x012b, 0x00d9, 0x0063, 0xff0d, 0xfed8,
-	0x0145, 0x039a, 0x03df, 0x02bd, 0x0090, 0xfdcd, 0xfc91, 0xfe07,
-	0xffad, 0x0010, 0x0014, 0x003d, 0xff5a, 0xfea3, 0xff63, 0xff94,
-	0xff1a, 0xff0b, 0xfe3f, 0xfd73, 0xfe8d, 0x0092, 0x0233, 0x02c9,
-	0x0259, 0x01b2, 0x00bb, 0xff91, 0xff3e, 0x001f, 0x0047, 0xfecc,
-	0xfd6b, 0xfc75, 0xfb56, 0xfa72, 0xfb32, 0xfc76, 0xfc77, 0xfd6c,
-	0xff8f, 0x006c, 0x0167, 0x0339, 0x03a3, 0x035b, 0x0397, 0x0325,
-	0x014c, 0xff5f, 0xfe78, 0xfe1a, 0xfd9a, 0xfcfd, 0xfcc5, 0xfba7,
-	0xfb31, 0xfc38, 0xfd9a, 0xfece, 0x0075, 0x02df, 0x03fd, 0x030e,
-	0x0201, 0x01d4, 0x017e, 0x00fd, 0x0075, 0xfece, 0xfc0e, 0xfab2,
-	0xfb6b, 0xfc2a, 0xfde4, 0xff5e, 0xff57, 0xff43, 0xff33, 0xff6f,
-	0x008a, 0x0231, 0x0366, 0x03d5, 0x024e, 0x000d, 0xff02, 0xff78,
-	0x00da, 0x010b, 0x007f, 0xff4f, 0xfd69, 0xfd49, 0xff38, 0xffcb,
-	0xff6d, 0xffc8, 0xfea9, 0xfce6, 0xfce0, 0xff4c, 0x01d1, 0x031b,
-	0x037c, 0x017a, 0xfed3, 0xfe05, 0xfec8, 0xffd3, 0x0045, 0xffeb,
-	0xfe25, 0xfb69, 0xfa44, 0xfb32, 0xfc0f, 0xfcf4, 0xfd83, 0xfd6a,
-	0xfd83, 0xfe61, 0x0121, 0x0489, 0x05d0, 0x0536, 0x03de, 0x013d,
-	0xff7c, 0xffcb, 0x0051, 0x009c, 0x003c, 0xff14, 0xfdae, 0xfbf4,
-	0xfbf8, 0xfd8f, 0xfeb8, 0xff83, 0xff85, 0xff71, 0x0070, 0x0202,
-	0x0366, 0x0373, 0x022c, 0x0069, 0xfed6, 0xfd3a, 0xfc04, 0xfc6c,
-	0xfda3, 0xfdc1, 0xfe17, 0xff30, 0xfefd, 0xfec4, 0xfff2, 0x00bd,
-	0x004b, 0x0055, 0x00d6, 0x00fa, 0x00fc, 0x0128, 0x0113, 0xffd9,
-	0xff94, 0x002e, 0xff91, 0xfef9, 0xff0a, 0xff45, 0x0079, 0x0161,
-	0x011f, 0x0055, 0xfe8d, 0xfd17, 0xfcc4, 0xfcfc, 0xfdce, 0xfff4,
-	0x01d6, 0x01b4, 0x0109, 0x00ee, 0x0158, 0x0175, 0x01cc, 0x0171,
-	0xff3e, 0xfd0f, 0xfc50, 0xfc86, 0xfcef, 0xfdad, 0xfd62, 0xfbf4,
-	0xfa82, 0xfa7f, 0xfc46, 0xff2c, 0x0258, 0x0401, 0x0410, 0x024e,
-	0x00e6, 0x0191, 0x0224, 0x0203, 0x0175, 0xffa2, 0xfcfc, 0xfbad,
-	0xfc31, 0xfd6d, 0xfea6, 0xff86, 0xff35, 0xfd36, 0xfc66, 0xfe6b,
-	0x016d, 0x034a, 0x0444, 0x0329, 0x00c8, 0xffa7, 0xff15, 0xff79,
-	0xff61, 0xfe82, 0xfd8f, 0xfbed, 0xfaf5, 0xfbf8, 0xfe40, 0xffd4,
-	0x00a8, 0x008f, 0xff66, 0xfe67, 0xff15, 0x0173, 0x02e6, 0x02b8,
-	0x0218, 0x00e9, 0xffb4, 0x001a, 0x0168, 0x01fe, 0x01f4, 0x01ca,
-	0x00d2, 0xff08, 0xfdfd, 0xfddc, 0xfdfd, 0xfe46, 0xfdc0, 0xfd41,
-	0xfdc8, 0xfea6, 0x007b, 0x020e, 0x021a, 0x01d6, 0x012f, 0x0026,
-	0xfef0, 0xfdd2, 0xfdb8, 0xfd2a, 0xfbe4, 0xfbf2, 0xfbb6, 0xfa58,
-	0xfa77, 0xfbd7, 0xfcbb, 0xfe58, 0x00b1, 0x02af, 0x03a5, 0x03b4,
-	0x041f, 0x03f6, 0x02fe, 0x02d2, 0x024f, 0x0098, 0xfef5, 0xfdde,
-	0xfda5, 0xfd80, 0xfdc7, 0xfe72, 0xfdbf, 0xfd0d, 0xfd22, 0xfdd4,
-	0xff31, 0x017b, 0x03d6, 0x0378, 0x0132, 0x0022, 0xff96, 0xff03,
-	0xff2d, 0xff10, 0xfdc2, 0xfc93, 0xfc22, 0xfcc2, 0xfeb4, 0x0043,
-	0x0198, 0x0191, 0xff67, 0xfd8d, 0xfd73, 0xff61, 0x021a, 0x0387,
-	0x039e, 0x01eb, 0xfee5, 0xfe44, 0xff7f, 0x004c, 0x0143, 0x01c8,
-	0x009d, 0xff2f, 0xff85, 0x003e, 0x0048, 0x008f, 0xfff1, 0xfd0f,
-	0xfa2a, 0xfa82, 0xfda1, 0x00ca, 0x02f6, 0x03f5, 0x02b7, 0x0086,
-	0xffd3, 0x004f, 0x0088, 0x0062, 0xff74, 0xfd73, 0xfb6b, 0xfa72,
-	0xfb88, 0xfd42, 0xfdc9, 0xfe19, 0xfdb0, 0xfca8, 0xfdfa, 0x00c4,
-	0x02fa, 0x0495, 0x04aa, 0x0322, 0x00bc, 0xff46, 0xff8a, 0xffeb,
-	0xffb0, 0xfef6, 0xfe11, 0xfcc2, 0xfc1b, 0xfcef, 0xfe6a, 0xffb5,
-	0xff0d, 0xfe52, 0xfebb, 0xff03, 0xffd2, 0x017b, 0x02b0, 0x0269,
-	0x01fd, 0x0123, 0xfef3, 0xfdd6, 0xfe07, 0xfdd3, 0xfd99, 0xfe55,
-	0xfef6, 0xff05, 0xff05, 0xff46, 0xfea0, 0xfdcb, 0xfed5, 0x0015,
-	0x001b, 0x0048, 0x00c9, 0x010a, 0x0138, 0x01a3, 0x0256, 0x02b7,
-	0x017d, 0x0092, 0x00be, 0x0058, 0x000a, 0x0021, 0xff5e, 0xfdf2,
-	0xfc64, 0xfb9f, 0xfc54, 0xfe36, 0x00d5, 0x01f8, 0x0121, 0x00c0,
-	0x00c2, 0x00be, 0x0158, 0x01d3, 0x00d8, 0xfe7d, 0xfc53, 0xfad9,
-	0xfa73, 0xfb25, 0xfc42, 0xfcf0, 0xfc55, 0xfb6f, 0xfc2c, 0xff83,
-	0x0275, 0x04a4, 0x064d, 0x0514, 0x0210, 0xffe1, 0xffa1, 0x00a3,
-	0x0144, 0x00d1, 0xff61, 0xfc9b, 0xfb66, 0xfc65, 0xfd7f, 0xffab,
-	0x00d4, 0xff4c, 0xfd80, 0xfcf8, 0xfe67, 0x00f3, 0x02c6, 0x03f7,
-	0x037d, 0x00cd, 0xfea2, 0xfe5e, 0xfed3, 0xff8f, 0xffe2, 0xff74,
-	0xfdc3, 0xfc31, 0xfdb9, 0xffe9, 0x0024, 0xffdb, 0xfeec, 0xfdb6,
-	0xfd62, 0xfe86, 0x00a4, 0x0213, 0x02db, 0x023f, 0xff73, 0xfe46,
-	0xfedd, 0xffbf, 0x01a1, 0x02dc, 0x0243, 0x00c5, 0xff1c, 0xfeac,
-	0xff3e, 0xfeb4, 0xfdc8, 0xfd31, 0xfd21, 0xfe40, 0xff82, 0x0171,
-	0x03ae, 0x03e2, 0x034c, 0x029e, 0x001b, 0xfe2c, 0xfe15, 0xfe36,
-	0xfde6, 0xfcd0, 0xfc5e, 0xfc40, 0xfbbb, 0xfbdd, 0xfc34, 0xfcdc,
-	0xfe72, 0x0048, 0x015f, 0x01fc, 0x0250, 0x0265, 0x01b4, 0x0126,
-	0x017a, 0x009d, 0xfef0, 0xfdd0, 0xfd7c, 0xfd29, 0xfd5d, 0xff07,
-	0x0037, 0xff5b, 0xfe6d, 0xfe5e, 0xfdee, 0xfeaa, 0x00c3, 0x017b,
-	0x01a2, 0x0161, 0x0084, 0x006c, 0x0076, 0x0081, 0x0045, 0xff4e,
-	0xfe53, 0xfd08, 0xfc7d, 0xfe20, 0xffbf, 0xffcc, 0xfe75, 0xfc61,
-	0xfb17, 0xfc41, 0xfe41, 0xfff6, 0x021f, 0x02d7, 0x0193, 0x0061,
-	0x0082, 0x016a, 0x0261, 0x03bd, 0x03f6, 0x0198, 0xff66, 0xff15,
-	0xffdc, 0x00be, 0x00c7, 0xff6d, 0xfcbc, 0xfb0a, 0xfc2a, 0xfeb1,
-	0x0186, 0x0370, 0x03da, 0x0298, 0x009d, 0xff17, 0xfe90, 0xfec1,
-	0xff4f, 0xfef9, 0xfbbc, 0xf893, 0xf8b3, 0xfa06, 0xfb7e, 0xfd2c,
-	0xfe1d, 0xfe65, 0xff01, 0x005c, 0x02bf, 0x0451, 0x04d1, 0x04ce,
-	0x02d5, 0x00d0, 0xff9c, 0xfef2, 0xffe2, 0x0074, 0xffaf, 0xfe74,
-	0xfdaf, 0xfd6f, 0xfe06, 0xff27, 0xff52, 0xfef0, 0xfeb5, 0xfec9,
-	0xff3c, 0x0091, 0x01d7, 0x01e2, 0x01d9, 0x0180, 0xff8a, 0xfe1f,
-	0xfe5f, 0xff42, 0xff39, 0xfe8f, 0xff26, 0xff1d, 0xfe22, 0xfde7,
-	0xfd3e, 0xfd0f, 0xfda8, 0xfe49, 0xff67, 0x0020, 0x007d, 0x0143,
-	0x0181, 0x0156, 0x01de, 0x01aa, 0x0131, 0x00fb, 0x0030, 0xff91,
-	0xff97, 0x006f, 0x00f8, 0xffae, 0xfdae, 0xfca0, 0xfbe1, 0xfcc2,
-	0xffe1, 0x0240, 0x0328, 0x02bc, 0x0219, 0x014d, 0x0036, 0xffdb,
-	0xffd0, 0xffba, 0xfe90, 0xfbd6, 0xfa7c, 0xfb08, 0xfbfd, 0xfd48,
-	0xfd5e, 0xfc59, 0xfc18, 0xfcfe, 0xff89, 0x027c, 0x04c5, 0x0573,
-	0x0407, 0x01f0, 0x00aa, 0xff80, 0xff08, 0x0047, 0x0037, 0xfe9b,
-	0xfd1c, 0xfc68, 0xfd8c, 0xff26, 0x004f, 0x0090, 0xfe83, 0xfc19,
-	0xfc22, 0xfe15, 0x0089, 0x024a, 0x0308, 0x02b2, 0x00c2, 0xfef5,
-	0xfe96, 0xff8a, 0x00a7, 0x00d9, 0xff9e, 0xfd81, 0xfca7, 0xfd1b,
-	0xfd9b, 0xfe6a, 0xfef4, 0xfdd7, 0xfc5c, 0xfcd1, 0xfe63, 0x006f,
-	0x0269, 0x0387, 0x0378, 0x022e, 0x00c1, 0x00e9, 0x0174, 0x014a,
-	0x0181, 0x0157, 0x00b8, 0xffac, 0xfeaf, 0xfec9, 0xfe60, 0xfd7c,
-	0xfdbc, 0xfe6f, 0xff36, 0x00cb, 0x0243, 0x0318, 0x0358, 0x0234,
-	0x001d, 0xfe6d, 0xfd9d, 0xfcd6, 0xfbcf, 0xfafa, 0xfb7b, 0xfc00,
-	0xfb84, 0xfb9f, 0xfbef, 0xfc95, 0xfdab, 0xffa5, 0x01ce, 0x026d,
-	0x028e, 0x0314, 0x036e, 0x02a4, 0x01f1, 0x01e8, 0x00f5, 0xff3b,
-	0xfe13, 0xfd64, 0xfd39, 0xfeaa, 0xfff0, 0xffe6, 0xff34, 0xfd79,
-	0xfc23, 0xfced, 0xfefc, 0x015a, 0x0220, 0x0175, 0x011c, 0x006e,
-	0xffc2, 0x009e, 0x01a5, 0x0221, 0x013e, 0xfefd, 0xfdce, 0xfd7e,
-	0xfd9d, 0xff0c, 0xffd3, 0xfe54, 0xfc53, 0xfb91, 0xfc69, 0xfe7c,
-	0x00b8, 0x02ab, 0x02e7, 0x0168, 0x0064, 0x002e, 0x00f1, 0x0204,
-	0x0243, 0x0127, 0xff8c, 0xfe89, 0xfe60, 0xfef6, 0xffe4, 0x004b,
-	0xfe8c, 0xfcb2, 0xfc4a, 0xfdd1, 0x00d6, 0x0311, 0x0569, 0x0537,
-	0x0203, 0x0003, 0xff6c, 0xff44, 0xffd8, 0xff5a, 0xfd9b, 0xfb92,
-	0xf9a2, 0xf9c6, 0xfb47, 0xfc74, 0xfdce, 0xfe60, 0xfe20, 0xfe62,
-	0xff21, 0x00e4, 0x037a, 0x0472, 0x039f, 0x0187, 0xff28, 0xfe60,
-	0xfe75, 0xfec9, 0xff3b, 0xff7d, 0xff3e, 0xfe89, 0xfe3c, 0xfe9a,
-	0xfe19, 0xfd76, 0xfe4c, 0xfef8, 0xff25, 0xff97, 0x00fe, 0x0252,
-	0x0248, 0x021a, 0x0184, 0x002d, 0xffce, 0xffaf, 0xfeee, 0xfebb,
-	0xfe54, 0xfe74, 0xfedb, 0xfdeb, 0xfd13, 0xfc4e, 0xfb91, 0xfca3,
-	0xfe0b, 0xfe9b, 0xffdb, 0x011e, 0x01a9, 0x0219, 0x028f, 0x0376,
-	0x0321, 0x0187, 0x007b, 0xfff4, 0xff88, 0xffe9, 0x0158, 0x01f6,
-	0x00cf, 0xfea8, 0xfcf4, 0xfd29, 0xfee7, 0x0130, 0x034d, 0x03e7,
-	0x0291, 0x00c8, 0xffc5, 0xff95, 0x0015, 0x0012, 0xfe80, 0xfbda,
-	0xf9b4, 0xf8d2, 0xf9af, 0xfbaf, 0xfd65, 0xfda0, 0xfc84, 0xfc58,
-	0xfcdb, 0xfdda, 0x010c, 0x0468, 0x0516, 0x0333, 0x0102, 0x000e,
-	0x0059, 0x010e, 0x018d, 0x0141, 0xff8f, 0xfe33, 0xfe6c, 0xff4e,
-	0xffee, 0x005b, 0xff92, 0xfdef, 0xfcdb, 0xfc59, 0xfdcd, 0x0066,
-	0x02bb, 0x0390, 0x019b, 0xffa6, 0xff3a, 0xffd0, 0x00e7, 0x01b5,
-	0x00c6, 0xfe80, 0xfcd8, 0xfcb5, 0xfd3b, 0xfd4f, 0xfd91, 0xfe26,
-	0xfe02, 0xfcf4, 0xfcb4, 0xfe88, 0x00d7, 0x029d, 0x03b1, 0x033f,
-	0x01aa, 0x007e, 0x004b, 0x00d3, 0x00fd, 0x00ac, 0x008e, 0xffc2,
-	0xfed0, 0xfe6d, 0xfd83, 0xfcde, 0xfdbf, 0xfeee, 0x0030, 0x017a,
-	0x0268, 0x0322, 0x02c8, 0x0245, 0x0204, 0x00a2, 0xfeeb, 0xfe07,
-	0xfd23, 0xfc15, 0xfbce, 0xfc2f, 0xfd22, 0xfd0e, 0xfc9b, 0xfcc4,
-	0xfcc5, 0xfd1b, 0xfe63, 0x008f, 0x0246, 0x02ab, 0x028b, 0x01ac,
-	0x0140, 0x01d2, 0x01b1, 0x007d, 0xff1d, 0xfd8f, 0xfd66, 0xfe41,
-	0xff68, 0x00aa, 0xffbc, 0xfe3c, 0xfd2d, 0xfc13, 0xfbf1, 0xfdc5,
-	0x008c, 0x024c, 0x0229, 0x007c, 0xffbf, 0xff8c, 0x0075, 0x0256,
-	0x025b, 0x0021, 0xfd8a, 0xfc53, 0xfcbc, 0xfdd8, 0xfed2, 0xff05,
-	0xfe0e, 0xfcd4, 0xfbc6, 0xfba2, 0xfdac, 0x00e7, 0x039a, 0x040f,
-	0x02c5, 0x015f, 0x003a, 0x0084, 0x01f2, 0x0230, 0x00fb, 0xff6d,
-	0xfec4, 0xff67, 0xffc5, 0x002c, 0x00cd, 0x0003, 0xfe7c, 0xfe24,
-	0xfee4, 0x0096, 0x02a4, 0x03f1, 0x03f0, 0x01ef, 0xff64, 0xfe61,
-	0xfe2d, 0xfe32, 0xfdf4, 0xfcdb, 0xfb8a, 0xfadb, 0xfb63, 0xfcae,
-	0xfe32, 0xff3e, 0xff20, 0xfe26, 0xfdaa, 0xfea9, 0x0044, 0x013d,
-	0x0257, 0x02e1, 0x0204, 0x00f4, 0x005c, 0x0009, 0xfffd, 0x0042,
-	0x0102, 0x0096, 0xfee7, 0xfdba, 0xfd64, 0xfd58, 0xfd52, 0xfdf6,
-	0xfe51, 0xfea1, 0xffcc, 0x0054, 0x0080, 0x00dd, 0x0178, 0x0249,
-	0x0269, 0x01a5, 0x0060, 0xfee6, 0xfe7b, 0xff6e, 0xffc4, 0xfeae,
-	0xfd35, 0xfc54, 0xfba6, 0xfbad, 0xfc42, 0xfddd, 0xffc5, 0x00c0,
-	0x01b0, 0x01af, 0x00c9, 0x0125, 0x021c, 0x021d, 0x00b7, 0xfeaf,
-	0xfdb9, 0xfe00, 0xfec6, 0x0011, 0x0054, 0xff44, 0xfe3c, 0xfdf2,
-	0xfe72, 0xfff7, 0x0240, 0x03f2, 0x0434, 0x0353, 0x01a6, 0x0033,
-	0xffe1, 0x0099, 0x00c7, 0xff1a, 0xfcec, 0xfbc0, 0xfbac, 0xfc29,
-	0xfdd1, 0xff2f, 0xfe8d, 0xfd5d, 0xfc4a, 0xfc52, 0xfdf7, 0x004e,
-	0x02a9, 0x035e, 0x01c8, 0x0004, 0xfed3, 0xfea3, 0xffbc, 0x009b,
-	0x00c6, 0x0077, 0xff3a, 0xfe3c, 0xfe51, 0xfeaa, 0xff63, 0xff48,
-	0xfd9e, 0xfc5b, 0xfc97, 0xfe00, 0x006e, 0x02a4, 0x03b2, 0x02d6,
-	0x0114, 0x009b, 0x0024, 0xff3f, 0xfefa, 0xff44, 0xfef8, 0xfdac,
-	0xfd1d, 0xfd2d, 0xfd10, 0xfda6, 0xfdfc, 0xfd1d, 0xfc79, 0xfcdb,
-	0xfe86, 0x0096, 0x01ee, 0x02ef, 0x02fa, 0x0222, 0x019c, 0x0089,
-	0xff27, 0xff6f, 0x007f, 0x0102, 0x00e1, 0x004b, 0xffdf, 0xffa0,
-	0xffc9, 0x00ee, 0x0188, 0x0109, 0x0119, 0x0167, 0x0129, 0x00e3,
-	0x009b, 0x00a6, 0x0077, 0xfef4, 0xfcef, 0xfb93, 0xfb89, 0xfc92,
-	0xfe28, 0xff3c, 0xfe8b, 0xfd0a, 0xfc31, 0xfbf4, 0xfc2e, 0xfd86,
-	0xff40, 0x0040, 0x0067, 0x0071, 0x0038, 0x008e, 0x0252, 0x0350,
-	0x021b, 0x00e7, 0x0043, 0xff93, 0xffb5, 0x00ca, 0x0168, 0x0090,
-	0xfeb7, 0xfd6f, 0xfc83, 0xfc29, 0xfdaf, 0xfffb, 0x012b, 0x011f,
-	0x00a1, 0x002b, 0x00aa, 0x01ad, 0x020b, 0x015c, 0xff80, 0xfde5,
-	0xfcd5, 0xfc5e, 0xfd36, 0xfe60, 0xfe49, 0xfda4, 0xfcdb, 0xfc0f,
-	0xfc8e, 0xfed6, 0x01a7, 0x0310, 0x0264, 0x0106, 0x0038, 0x0021,
-	0x0068, 0x012e, 0x01b4, 0x00f5, 0xff54, 0xfe3e, 0xfe10, 0xfea3,
-	0xff93, 0x00b8, 0x00f0, 0xffa7, 0xff00, 0xffe4, 0x0135, 0x0290,
-	0x037e, 0x0296, 0x00d7, 0xff82, 0xfe28, 0xfd53, 0xfd74, 0xfe63,
-	0xfeea, 0xfeb8, 0xfe61, 0xfe20, 0xfd9b, 0xfdc9, 0xfeb3, 0xfe44,
-	0xfd58, 0xfd60, 0xfe5c, 0xff70, 0x001e, 0x00d9, 0x01cd, 0x0197,
-	0x00a1, 0xfff3, 0xff4e, 0xff1b, 0xffd9, 0x00ac, 0x00a7, 0xff89,
-	0xfe6c, 0xfd7e, 0xfd1c, 0xfd9f, 0xfe46, 0xfeeb, 0xffa7, 0x001b,
-	0x004d, 0x0068, 0x00ea, 0x01f5, 0x01fc, 0x010c, 0xff79, 0xfdbe,
-	0xfd25, 0xfdb2, 0xfef0, 0xffeb, 0xff00, 0xfd49, 0xfc9b, 0xfc30,
-	0xfc1b, 0xfdc8, 0x0004, 0x0184, 0x0199, 0x00ee, 0x00b1, 0x008c,
-	0x0119, 0x0208, 0x0166, 0x0006, 0xff14, 0xfe8b, 0xfeeb, 0x0053,
-	0x01cd, 0x023b, 0x0163, 0x0024, 0xfef1, 0xfe62, 0xff67, 0x0166,
-	0x026c, 0x01c6, 0x00af, 0xfffe, 0xff09, 0xfe86, 0xff48, 0xfef5,
-	0xfdc2, 0xfceb, 0xfcc8, 0xfd53, 0xfe19, 0xff6c, 0x0077, 0xffac,
-	0xfda9, 0xfc2c, 0xfbbb, 0xfd0a, 0xff5f, 0x0081, 0x0115, 0x00e2,
-	0x0045, 0x0055, 0x00a9, 0x013b, 0x0208, 0x021e, 0x0105, 0xffd0,
-	0xfea7, 0xfe13, 0xfe6f, 0xff46, 0xff2f, 0xfdca, 0xfd03, 0xfde4,
-	0xff2f, 0x007e, 0x0227, 0x032b, 0x026c, 0x013d, 0x007f, 0xff95,
-	0xfee2, 0xfef6, 0xff73, 0xff43, 0xfe6a, 0xfd38, 0xfce8, 0xfd4b,
-	0xfdf4, 0xfe8c, 0xfe36, 0xfe39, 0xff06, 0xff78, 0xffcc, 0x00f6,
-	0x01d8, 0x01c9, 0x010f, 0xfffa, 0xfeee, 0xfdda, 0xfdfb, 0xff62,
-	0xffdf, 0xff87, 0xff82, 0xff2d, 0xfee5, 0xff60, 0x0036, 0x016f,
-	0x020d, 0x01a7, 0x010e, 0x00e2, 0x00e3, 0x014b, 0x0199, 0x00f2,
-	0xff70, 0xfdc9, 0xfd25, 0xfd60, 0xfe79, 0xffe9, 0x003c, 0xff79,
-	0xfe5a, 0xfcfc, 0xfbc2, 0xfc6a, 0xfe9a, 0xffb8, 0xff72, 0xff4c,
-	0xff14, 0xfec0, 0xff9c, 0x00a4, 0x00b9, 0x0028, 0xff6d, 0xff4d,
-	0xfefa, 0xfebb, 0xffa2, 0x007b, 0xffc2, 0xfe54, 0xfcb5, 0xfc74,
-	0xfe28, 0x006f, 0x02a9, 0x0347, 0x0270, 0x01db, 0x00f8, 0x0055,
-	0x0086, 0x0030, 0xfeee, 0xfe10, 0xfd33, 0xfc82, 0xfc7d, 0xfd7f,
-	0xff4a, 0xff90, 0xfe81, 0xfd2c, 0xfcb1, 0xfd8f, 0xff14, 0x00d2,
-	0x01dd, 0x0167, 0x0087, 0x004b, 0x0027, 0xffeb, 0x004a, 0x0137,
-	0x013c, 0x002c, 0xffbe, 0xffe4, 0x0058, 0x01bb, 0x0227, 0x0118,
-	0x0070, 0xfffe, 0xffb5, 0x0023, 0x0106, 0x01d1, 0x0159, 0x0008,
-	0xff23, 0xfdbf, 0xfcd5, 0xfd75, 0xfe4e, 0xfe96, 0xfe6f, 0xfe18,
-	0xfe52, 0xfe62, 0xfddc, 0xfe21, 0xfe46, 0xfd89, 0xfd5a, 0xfdd3,
-	0xfe66, 0xff34, 0x00c9, 0x0224, 0x0220, 0x012c, 0x004c, 0x001b,
-	0x009d, 0x0167, 0x0136, 0x0054, 0xff98, 0xfee3, 0xfda7, 0xfcf4,
-	0xfdc8, 0xff55, 0x007b, 0x0119, 0x00d7, 0x0088, 0x00bb, 0x014c,
-	0x0235, 0x01f0, 0xfffd, 0xfe87, 0xfdcd, 0xfcef, 0xfcd1, 0xfd95,
-	0xfe66, 0xfe9f, 0xfe1f, 0xfdad, 0xfd63, 0xfd96, 0xff48, 0x011d,
-	0x0183, 0x00fc, 0xffda, 0xfef1, 0xff78, 0x0042, 0x007d, 0x0055,
-	0xffc5, 0xff7b, 0xff08, 0xfe8e, 0xff47, 0x00ae, 0x00fc, 0x000e,
-	0xff34, 0xfe96, 0xfea0, 0x0010, 0x022c, 0x02c2, 0x01c6, 0x00ff,
-	0x0039, 0xff42, 0xfede, 0xff63, 0xff9b, 0xff06, 0xfe87, 0xfdcd,
-	0xfda6, 0xfef6, 0x003d, 0x003b, 0xff78, 0xfde5, 0xfc6e, 0xfc58,
-	0xfd48, 0xff10, 0x009e, 0x00a7, 0x000b, 0xff6d, 0xfe6b, 0xfe50,
-	0xff44, 0x00d6, 0x015d, 0xffce, 0xfe9d, 0xfe35, 0xfde1, 0xfe67,
-	0xff45, 0xfee8, 0xfe5e, 0xfeb1, 0xff68, 0x008d, 0x0185, 0x02ad,
-	0x034a, 0x0250, 0x0073, 0xfe90, 0xfd8a, 0xfd68, 0xfe05, 0xfeaa,
-	0xfe46, 0xfdc9, 0xfe14, 0xfe47, 0xfe6b, 0xff4e, 0xfff0, 0xffd3,
-	0xffaf, 0xffff, 0x002e, 0xffba, 0x0081, 0x01a5, 0x00fa, 0x001d,
-	0xffae, 0xfef8, 0xff3e, 0x001c, 0x0073, 0x0116, 0x00ec, 0x0089,
-	0x001f, 0xff6a, 0xff57, 0xffab, 0x001f, 0x0080, 0x002c, 0xffb7,
-	0x000d, 0x001a, 0x0056, 0x00ae, 0xffbd, 0xfec6, 0xfdf5, 0xfcf6,
-	0xfc87, 0xfd8b, 0xff79, 0x004b, 0x000e, 0xff77, 0xfe28, 0xfd60,
-	0xfe05, 0xff49, 0x0035, 0x0036, 0xffcb, 0xffb5, 0xff6a, 0xff70,
-	0x0046, 0x0089, 0x00c3, 0x0092, 0xff71, 0xfea0, 0xfe58, 0xff19,
-	0x004b, 0xffc2, 0xfe7d, 0xfdb8, 0xfd37, 0xfe51, 0x00af, 0x0206,
-	0x02b0, 0x02b8, 0x01c8, 0x005b, 0xff1e, 0xfef5, 0xff7e, 0xff2c,
-	0xfe3f, 0xfd1f, 0xfc40, 0xfcb4, 0xfe30, 0xfffd, 0x00e0, 0x004b,
-	0xff06, 0xfe48, 0xfe6e, 0xff31, 0x0052, 0x00d0, 0x0015, 0xfeea,
-	0xfe51, 0xfe0c, 0xfe9c, 0x0065, 0x0127, 0x00bd, 0xfff0, 0xff41,
-	0xff25, 0xffb4, 0x0082, 0x013c, 0x00fe, 0x0060, 0x0048, 0xfff5,
-	0x0066, 0x01d3, 0x02ca, 0x028d, 0x0108, 0xff4c, 0xfec3, 0xfeb2,
-	0xfed0, 0xffb3, 0xfff3, 0xff76, 0xff48, 0xfedf, 0xfe33, 0xfded,
-	0xfe26, 0xfe2f, 0xfdfc, 0xfdf7, 0xfe1f, 0xfe2a, 0xfeb3, 0xffe0,
-	0xffe6, 0xff02, 0xfe3f, 0xfe2f, 0xfe69, 0xfee5, 0xff82, 0xffdc,
-	0xffd4, 0xff7f, 0xfed3, 0xfe13, 0xfda8, 0xfe4c, 0x004a, 0x01a4,
-	0x01ad, 0x01d1, 0x01e5, 0x0181, 0x014e, 0x0114, 0x0044, 0xff28,
-	0xfdf0, 0xfd11, 0xfca5, 0xfcc3, 0xfe00, 0xfecd, 0xfeeb, 0xff02,
-	0xfe62, 0xfdd3, 0xfe64, 0xff57, 0x0056, 0x00de, 0x0047, 0xffc9,
-	0xff71, 0xff0c, 0xff97, 0x0078, 0x00e9, 0x00e9, 0x00ab, 0x003b,
-	0xffca, 0x004e, 0x0190, 0x0184, 0x0081, 0xffe7, 0xff0a, 0xfe8a,
-	0xff2a, 0x00c5, 0x020f, 0x0225, 0x01b5, 0x002f, 0xfe7e, 0xfe34,
-	0xfe8b, 0xfe74, 0xfe56, 0xfd8d, 0xfd1f, 0xfddc, 0xfe95, 0xffaf,
-	0x0041, 0xff9c, 0xfeb7, 0xfdac, 0xfd57, 0xfe6d, 0xffed, 0x019f,
-	0x022e, 0x00f0, 0xff9f, 0xfe80, 0xfe3a, 0xffad, 0x00d0, 0x0090,
-	0xffb7, 0xfed0, 0xfe9d, 0xfec4, 0xff07, 0xffb8, 0xffff, 0x0008,
-	0xfff1, 0xffd6, 0x004a, 0x013c, 0x025b, 0x0283, 0x00c8, 0xfed9,
-	0xfdc8, 0xfd09, 0xfd3d, 0xfdf9, 0xfe2c, 0xfe0e, 0xfdcc, 0xfe27,
-	0xfe51, 0xfe5e, 0xff55, 0xffcd, 0xff6b, 0xff9b, 0xff5f, 0xfe96,
-	0xfece, 0xff59, 0x0002, 0x0033, 0xffba, 0xff6e, 0xff82, 0xff95,
-	0xfffe, 0x007d, 0x00f8, 0x0122, 0x0074, 0xfff6, 0xffc6, 0xffb8,
-	0x0061, 0x00d7, 0x00a2, 0x0089, 0x009a, 0x0065, 0x007e, 0x00ed,
-	0x0110, 0x006c, 0xff77, 0xfe57, 0xfd53, 0xfdc0, 0xff1a, 0x0002,
-	0xfff3, 0xff2d, 0xfe52, 0xfd98, 0xfd3e, 0xfdd9, 0xff46, 0x0003,
-	0x004e, 0x0020, 0xff6c, 0xfe8d, 0xfe21, 0xfeed, 0xfff1, 0xffd8,
-	0xff41, 0xfe9b, 0xfdfd, 0xfeaa, 0xffad, 0xff82, 0xff2f, 0xfed1,
-	0xfeac, 0xff20, 0xffec, 0x0126, 0x028e, 0x0311, 0x0279, 0x0095,
-	0xfe69, 0xfdba, 0xfe1c, 0xfeda, 0xff00, 0xfdfc, 0xfd4f, 0xfd50,
-	0xfd7b, 0xfe6d, 0xffbc, 0xffee, 0xff48, 0xfef4, 0xff0f, 0xff26,
-	0xffe4, 0x0156, 0x01b3, 0x00e4, 0xffae, 0xfe5c, 0xfe5c, 0xffd5,
-	0x0161, 0x01c7, 0x00d6, 0xffe0, 0xff56, 0xfef5, 0xffaa, 0x006f,
-	0x005d, 0x003c, 0xffcd, 0xff12, 0xff58, 0x0021, 0x017f, 0x0274,
-	0x0147, 0xffde, 0xfea3, 0xfd5d, 0xfce6, 0xfd3f, 0xfe42, 0xff3f,
-	0xff72, 0xff50, 0xff55, 0xff0f, 0xff25, 0xff79, 0xffab, 0xfff3,
-	0xfff9, 0x003d, 0x00ae, 0x00e0, 0x00c3, 0x002d, 0xff61, 0xfed3,
-	0xfe27, 0xfdc7, 0xfdc1, 0xfecb, 0x0011, 0xffde, 0xff5b, 0xfefd,
-	0xfe34, 0xfe4f, 0xffb7, 0x006e, 0x009a, 0x00f5, 0x0180, 0x018f,
-	0x0078, 0xfffb, 0xffff, 0xff82, 0xff15, 0xfe01, 0xfcb0, 0xfd31,
-	0xfe83, 0xff91, 0x0048, 0xffe1, 0xfea5, 0xfdd9, 0xfe19, 0xff09,
-	0xffe1, 0x0026, 0x002d, 0xffc6, 0xfef2, 0xfddb, 0xfd5d, 0xfeaf,
-	0x0043, 0x00c2, 0x004b, 0xff5e, 0xfea7, 0xfea1, 0xfff0, 0x010d,
-	0x00cc, 0x003c, 0xffef, 0xff62, 0xff10, 0xff78, 0x0099, 0x025e,
-	0x02fa, 0x0217, 0x00fe, 0xffca, 0xff94, 0xfff5, 0xffd0, 0xff48,
-	0xfea7, 0xfdd3, 0xfdc8, 0xfeb6, 0xffbb, 0xffec, 0xff0c, 0xfe84,
-	0xfe41, 0xfdf6, 0xfeca, 0x0092, 0x0133, 0x00a6, 0xff83, 0xfe1f,
-	0xfdad, 0xfe17, 0xfef3, 0xff91, 0xffa1, 0xfee2, 0xfe06, 0xfe10,
-	0xfe52, 0xfec5, 0xffae, 0x003a, 0xffce, 0xff5a, 0xffc0, 0x00ee,
-	0x027e, 0x0302, 0x0215, 0x0057, 0xff0e, 0xfe1a, 0xfcf5, 0xfd3f,
-	0xfed1, 0xff3f, 0xfefa, 0xfeee, 0xfded, 0xfd29, 0xfdb4, 0xfefe,
-	0x0032, 0x005a, 0xfff4, 0xffe8, 0xffee, 0xffea, 0xffe2, 0xff97,
-	0xffdd, 0x0033, 0x001a, 0x000a, 0xff85, 0xff7b, 0x0050, 0x0110,
-	0x0103, 0x0044, 0xff31, 0xff02, 0xffb2, 0x0023, 0xfff6, 0x0004,
-	0x00a1, 0x00d0, 0x0090, 0x008f, 0x0084, 0x0042, 0xff9a, 0xfe52,
-	0xfd63, 0xfcfe, 0xfd16, 0xfe8f, 0xffe4, 0x0008, 0xff38, 0xfe64,
-	0xfe7d, 0xff24, 0xfffb, 0x0131, 0x017f, 0x00e6, 0x00ae, 0xff83,
-	0xfe90, 0xff0a, 0xff47, 0xff48, 0xff66, 0xfeb7, 0xfded, 0xfe17,
-	0xff4b, 0x009a, 0x00a1, 0x0020, 0xff73, 0xfe21, 0xfdb8, 0xfeb3,
-	0x00c7, 0x02ca, 0x0314, 0x0184, 0x001b, 0xfee2, 0xfe08, 0xfe2a,
-	0xfee2, 0xff46, 0xfebc, 0xfe60, 0xfe03, 0xfd8e, 0xfe33, 0xfeee,
-	0xff19, 0xff27, 0xfe61, 0xfda0, 0xfe1e, 0xff10, 0xffe5, 0xffc8,
-	0xff00, 0xfed7, 0xfeab, 0xff14, 0x005a, 0x00ba, 0x0095, 0x0099,
-	0x0025, 0x0012, 0xff9d, 0xff54, 0x00cb, 0x017a, 0x008d, 0xff7c,
-	0xff0d, 0xffc3, 0x0150, 0x028c, 0x02e7, 0x0215, 0x00ac, 0xff8c,
-	0xfe86, 0xfe24, 0xfe52, 0xfe36, 0xfe9a, 0xfe90, 0xfdfd, 0xfd50,
-	0xfd61, 0xfe6e, 0xff93, 0x0033, 0x001c, 0xffc3, 0xffbb, 0xffec,
-	0xffed, 0x009d, 0x008e, 0xff65, 0xff2e, 0xfe9a, 0xfd7b, 0xfd93,
-	0xfef5, 0x0028, 0x0060, 0xffa8, 0xfee1, 0xfe15, 0xfdf6, 0xfeef,
-	0xffb1, 0x0092, 0x01a8, 0x010c, 0x0021, 0x0033, 0x0015, 0xffc8,
-	0xff83, 0xfec3, 0xfddc, 0xfd75, 0xfda5, 0xfe0a, 0xfe72, 0xfe90,
-	0xfe52, 0xfe22, 0xfe17, 0xfe4a, 0xff16, 0x00ca, 0x01bc, 0x015e,
-	0x0069, 0xffab, 0xff2a, 0xff62, 0x00c8, 0x01bc, 0x0141, 0x0053,
-	0xff9d, 0xff91, 0xffff, 0x003b, 0x008a, 0x00b6, 0x0004, 0xfed8,
-	0xfdd0, 0xfd84, 0xff61, 0x01a3, 0x021f, 0x01c3, 0x00e8, 0xffab,
-	0xfee9, 0xfee0, 0xfef4, 0xfe45, 0xfda5, 0xfdf6, 0xfda3, 0xfd3e,
-	0xfe4f, 0xffa4, 0x0048, 0x00ce, 0x007d, 0xff99, 0xffb6, 0x007d,
-	0x016c, 0x0224, 0x020b, 0x00a1, 0xff2a, 0xff16, 0xff12, 0xfea1,
-	0xfec9, 0xff2f, 0xff53, 0xff0d, 0xfe85, 0xfe40, 0xfeba, 0xff7f,
-	0xff4b, 0xfe7e, 0xfeaf, 0xff74, 0xffbf, 0x00ed, 0x01f2, 0x014e,
-	0x0080, 0xff8e, 0xfe83, 0xfde3, 0xfde1, 0xfedc, 0xff93, 0xfeec,
-	0xfe3e, 0xfda7, 0xfd61, 0xfe05, 0xff06, 0xffd8, 0x0013, 0xff6f,
-	0xfea4, 0xfe4d, 0xfe82, 0xffa8, 0x0060, 0x008d, 0x00ca, 0xffb9,
-	0xfe4f, 0xfe1a, 0xff5d, 0x0056, 0x0054, 0x0079, 0x0031, 0xff93,
-	0xff40, 0xff55, 0xffc4, 0x00d0, 0x0161, 0x0122, 0x00fa, 0x0096,
-	0x00cd, 0x016a, 0x01da, 0x0141, 0xff64, 0xfe3c, 0xfdda, 0xfd75,
-	0xfdab, 0xfea9, 0xfedb, 0xff06, 0xfeed, 0xfe66, 0xfee5, 0xffdb,
-	0x008e, 0x00bf, 0x009a, 0xffe2, 0xfeb7, 0xfe51, 0xff3c, 0x001b,
-	0xffaa, 0xfefd, 0xfe6c, 0xfe67, 0xfe9d, 0xfee3, 0xff9a, 0xffd9,
-	0xff43, 0xfe57, 0xfdc4, 0xfdb5, 0xfeb5, 0x0085, 0x01f9, 0x01d2,
-	0x009f, 0xff9f, 0xfef9, 0xff64, 0x0015, 0x0026, 0xffeb, 0xff4d,
-	0xfdec, 0xfcca, 0xfcd3, 0xfdc4, 0xfe9e, 0xfef0, 0xff5c, 0xff72,
-	0xfec9, 0xfecb, 0xff95, 0x007d, 0x010a, 0x00b1, 0x0036, 0x0064,
-	0x0011, 0xffe6, 0x006b, 0x00a5, 0x007c, 0x0008, 0xff7d, 0xff31,
-	0xff28, 0xff21, 0xff5e, 0xff7a, 0xff81, 0xff95, 0xffe6, 0x00c6,
-	0x0170, 0x01ce, 0x01e9, 0x0125, 0xffbb, 0xfe48, 0xfdbb, 0xfe32,
-	0xfec4, 0xfe9d, 0xfe40, 0xfe29, 0xfe21, 0xfddb, 0xfe26, 0xff99,
-	0x004d, 0x002c, 0x0092, 0x009b, 0x003b, 0x00a7, 0x0156, 0x01b7,
-	0x00d7, 0xff48, 0xfdd0, 0xfd16, 0xfe01, 0xff67, 0x0000, 0x006d,
-	0x0068, 0xfefa, 0xfde1, 0xfdcc, 0xfe1c, 0xff37, 0x0079, 0x012a,
-	0x00cb, 0xffc0, 0xff95, 0x0050, 0x00f4, 0x00d8, 0xffe8, 0xfec3,
-	0xfdca, 0xfcd6, 0xfc9c, 0xfd4d, 0xfe06, 0xfe0c, 0xfddf, 0xfdfe,
-	0xfe23, 0xfe18, 0xfedd, 0xffe1, 0x0017, 0xffaf, 0xff0f, 0xff26,
-	0xffc2, 0x0078, 0x00ed, 0x007f, 0xffa1, 0xfef0, 0xfe79, 0xfeda,
-	0x007d, 0x0181, 0x012d, 0x00bb, 0x0000, 0xff1c, 0xfefe, 0x004f,
-	0x01bf, 0x01aa, 0x012a, 0x0109, 0x002c, 0xff8b, 0xffd7, 0xffef,
-	0xffaf, 0xfeb0, 0xfd1d, 0xfc2e, 0xfcd6, 0xfe1c, 0xff16, 0xffd4,
-	0xffd1, 0xff21, 0xfe33, 0xfe48, 0xff27, 0xffda, 0x008d, 0x0104,
-	0x00e6, 0x0048, 0xff73, 0xff14, 0xffb4, 0x0091, 0x00aa, 0x002a,
-	0xfffd, 0xff90, 0xfec2, 0xfece, 0xfef1, 0xfea0, 0xfe8e, 0xff0a,
-	0xff78, 0xff27, 0xfea8, 0xff23, 0xffd3, 0x0001, 0xffe9, 0xff90,
-	0xff70, 0xffc5, 0xffcb, 0xff34, 0xfe5f, 0xfd80, 0xfcaa, 0xfc40,
-	0xfccc, 0xfe17, 0xfee4, 0xff7f, 0x00ac, 0x00a5, 0xffec, 0x001b,
-	0x00ef, 0x01fd, 0x0234, 0x01ce, 0x00ec, 0x001f, 0xffc0, 0xffe5,
-	0x0068, 0x00cd, 0x0052, 0xff50, 0xfe4b, 0xfdb5, 0xfda5, 0xfebc,
-	0x005a, 0x00fa, 0x006b, 0xffdc, 0xffa4, 0xffd9, 0x009c, 0x0110,
-	0x00be, 0x0014, 0xfead, 0xfce5, 0xfcaa, 0xfdb4, 0xfeab, 0xff43,
-	0xff29, 0xfec9, 0xfe0b, 0xfde7, 0xff68, 0x011c, 0x01f8, 0x023d,
-	0x0200, 0x0180, 0x00ba, 0x0018, 0x0010, 0x0007, 0xff6c, 0xfebe,
-	0xfe2e, 0xfe24, 0xfeef, 0xffe3, 0xffb6, 0xfec7, 0xfd6b, 0xfc87,
-	0xfd35, 0xfeea, 0x0071, 0x00dc, 0x00c2, 0x006c, 0xff9c, 0xfef5,
-	0xfefd, 0xffd5, 0x001f, 0xff83, 0xfe83, 0xfd98, 0xfd11, 0xfd7d,
-	0xfe5d, 0xff1f, 0xff04, 0xfdf5, 0xfe1e, 0xfed6, 0xff7f, 0x0046,
-	0x0101, 0x0151, 0x0143, 0x00be, 0xff85, 0xfec5, 0xfe87, 0xfe9a,
-	0xfed0, 0xfed6, 0xfeed, 0xff02, 0xff73, 0x0038, 0x008d, 0x0050,
-	0x006d, 0x0089, 0x0061, 0xffdd, 0xff1d, 0xff84, 0x0032, 0x00a9,
-	0x00f3, 0x010a, 0x0095, 0xff34, 0xfea9, 0xfe81, 0xfe48, 0xfe6e,
-	0xfedc, 0xff14, 0xfee5, 0xfeca, 0xff14, 0xff6e, 0xffbb, 0xffd0,
-	0xff32, 0xfee9, 0xffa3, 0x0055, 0x00ad, 0x00f5, 0x0070, 0xff3d,
-	0xfea5, 0xfeca, 0xff83, 0x0060, 0x00a2, 0x0069, 0xff2e, 0xfd66,
-	0xfccb, 0xfdb8, 0xff16, 0xffe0, 0xffa5, 0xff0b, 0xfeba, 0xfea4,
-	0xff4d, 0x0075, 0x0168, 0x0165, 0x007a, 0xff1b, 0xfdfe, 0xfdb4,
-	0xfe39, 0xff06, 0xfef1, 0xfdaa, 0xfc84, 0xfc4b, 0xfd94, 0xffa8,
-	0x0119, 0x015e, 0x0117, 0x00d4, 0x0014, 0x001f, 0x0110, 0x0186,
-	0x0155, 0x0098, 0xff8a, 0xfe33, 0xfdd7, 0xff20, 0x0005, 0xff8b,
-	0xfee4, 0xfe7b, 0xfeb8, 0x000e, 0x0161, 0x016c, 0x0116, 0x007a,
-	0xff90, 0xff5a, 0xfffd, 0x00d6, 0x014a, 0x00c4, 0xffdc, 0xfe44,
-	0xfd0b, 0xfd46, 0xfe2f, 0xfefd, 0xfefe, 0xfe2e, 0xfd98, 0xfe1b,
-	0xff31, 0x006a, 0x01d3, 0x0297, 0x0246, 0x0185, 0x00b8, 0xffd9,
-	0xff23, 0xfef7, 0xff0a, 0xfef6, 0xfee8, 0xff4d, 0xffc1, 0xff9a,
-	0xff0e, 0xfea3, 0xfe37, 0xfe77, 0xff34, 0xff5d, 0xff90, 0x000e,
-	0x007d, 0x00a8, 0x00a2, 0x00bb, 0x003d, 0xfede, 0xfe0e, 0xfddb,
-	0xfd7a, 0xfdec, 0xfeb5, 0xfe3d, 0xfd13, 0xfc5b, 0xfc7a, 0xfd82,
-	0xff0f, 0x0039, 0x007b, 0x006e, 0x007e, 0x009b, 0x0072, 0x0066,
-	0x0012, 0xff48, 0xfec8, 0xfe84, 0xfe81, 0xff7a, 0x00cb, 0x0167,
-	0x00e2, 0x0002, 0xff50, 0xffd1, 0x0170, 0x0247, 0x0211, 0x00e1,
-	0xff5e, 0xfe48, 0xfe9f, 0xffbf, 0x00c0, 0x00f9, 0x002f, 0xfee3,
-	0xfd02, 0xfc7c, 0xfdd3, 0xff5d, 0x003c, 0xffdc, 0xfe68, 0xfd27,
-	0xfd28, 0xfe51, 0xfff4, 0x00b8, 0x00b7, 0x005a, 0xfff7, 0x0028,
-	0x0128, 0x01e8, 0x01d1, 0x011c, 0xffc3, 0xfe9d, 0xfe94, 0xffba,
-	0x00d8, 0x0103, 0x0041, 0xfefc, 0xfd8f, 0xfd18, 0xfdbf, 0xfeab,
-	0xff18, 0xfefd, 0xfe58, 0xfde5, 0xfe60, 0xff59, 0x0015, 0x007e,
-	0xff93, 0xfe38, 0xfd90, 0xfd8f, 0xfe03, 0xfe6d, 0xfe14, 0xfd3e,
-	0xfcfb, 0xfd60, 0xfebc, 0x0078, 0x0202, 0x02e1, 0x0270, 0x0152,
-	0x00a4, 0x002b, 0x0034, 0x00d1, 0x00ed, 0x0060, 0x001b, 0x0023,
-	0xfff9, 0xff9e, 0xff28, 0xff08, 0xff4c, 0xffba, 0x0046, 0x0057,
-	0xffb9, 0xfefe, 0xfea1, 0xfee3, 0xff98, 0x0037, 0x0069, 0x0035,
-	0xffae, 0xff2b, 0xfeef, 0xfeec, 0xff2c, 0xff1d, 0xfe3e, 0xfd79,
-	0xfda2, 0xfe48, 0xff7d, 0x00a4, 0x0105, 0x010c, 0x00a9, 0x00a2,
-	0x0150, 0x01fc, 0x0214, 0x01b2, 0x004c, 0xfec0, 0xfe3b, 0xfe8c,
-	0xff3d, 0xffc6, 0xff50, 0xfe3c, 0xfd58, 0xfcd0, 0xfd77, 0xfec5,
-	0xff94, 0xffec, 0xff81, 0xff18, 0xff26, 0xffbe, 0x00b3, 0x00f3,
-	0x0040, 0xfed7, 0xfd55, 0xfcc2, 0xfdd0, 0xff33, 0xffb0, 0xfed3,
-	0xfd6b, 0xfc4d, 0xfc24, 0xfd7b, 0xffb6, 0x01c3, 0x02af, 0x0259,
-	0x0126, 0xffab, 0xff2d, 0xffca, 0x0042, 0xfff0, 0xff50, 0xfe55,
-	0xfdf0, 0xfea5, 0xff9c, 0x0081, 0x0101, 0x00c0, 0x0057, 0x0060,
-	0x00bb, 0x0184, 0x01b0, 0x00ba, 0xffa6, 0xfe84, 0xfe04, 0xfec2,
-	0xfff8, 0x00a7, 0x0055, 0xff24, 0xfe41, 0xfe44, 0xfec1, 0xff38,
-	0xff3c, 0xff40, 0xfeef, 0xfea4, 0xff25, 0xffa2, 0x0055, 0x0120,
-	0x013a, 0x00b3, 0x0055, 0x0082, 0x00c3, 0x00bb, 0x007e, 0xffde,
-	0xff0d, 0xff29, 0xff90, 0xff60, 0xff1a, 0xff4b, 0xff8e, 0xff48,
-	0xfea3, 0xfe3e, 0xfdab, 0xfd0d, 0xfd9e, 0xfea0, 0xff53, 0x0073,
-	0x00a9, 0xffd1, 0xff22, 0xfe78, 0xfe18, 0xfed6, 0xffe3, 0x0010,
-	0xfee4, 0xfd0b, 0xfc39, 0xfc8d, 0xfdbb, 0xff52, 0x00be, 0x0156,
-	0x00e6, 0x0049, 0x0015, 0x000e, 0x0030, 0x0052, 0x002b, 0xff6a,
-	0xfeb1, 0xff12, 0x0080, 0x013d, 0x00d3, 0x0061, 0xffc6, 0xff54,
-	0xffb5, 0x0095, 0x013b, 0x0133, 0x0079, 0xff27, 0xfe58, 0xfef4,
-	0xffaf, 0x0061, 0x0115, 0x00a4, 0xff7f, 0xfeb3, 0xfef1, 0xffc4,
-	0x0012, 0xff51, 0xfe60, 0xfdc2, 0xfd05, 0xfcf1, 0xfe45, 0xff9a,
-	0x0087, 0x00f8, 0x0046, 0xff94, 0xffb0, 0x00e9, 0x0290, 0x031f,
-	0x01bc, 0xff7c, 0xfe10, 0xfdd0, 0xfe27, 0xff51, 0x00de, 0x026f,
-	0x01ab, 0xfe35, 0xfc49, 0xfcac, 0xfdbb, 0xfef5, 0xff9e, 0xffbb,
-	0xff8b, 0xff40, 0xff67, 0x000a, 0xfff3, 0xff12, 0xfe72, 0xfe69,
-	0xfe2f, 0xfda1, 0xfcfd, 0xfc85, 0xfc12, 0xfbbd, 0xfbf3, 0xfd43,
-	0x0188, 0x0597, 0x04f3, 0x0290, 0x00d2, 0xff6d, 0xfe06, 0xfce2,
-	0xfe34, 0x01c5, 0x02eb, 0x0159, 0xfff1, 0xff59, 0xff84, 0xffb9,
-	0x001b, 0x00fa, 0x01a3, 0x018c, 0x013d, 0x009a, 0xffc5, 0xffa1,
-	0xff5c, 0xfeb3, 0xfe95, 0xff14, 0xff1c, 0xfe30, 0xfdbc, 0xfe49,
-	0xff04, 0xfe90, 0xfcbf, 0xfc38, 0xfe81, 0x00f0, 0x0157, 0x00ee,
-	0x00f7, 0x00ee, 0xff45, 0xfd40, 0xfe11, 0x022e, 0x0568, 0x04ad,
-	0x029f, 0x00ba, 0xfe7f, 0xfd80, 0xfe5b, 0xff40, 0xfff0, 0x0065,
-	0xffb9, 0xfee4, 0xfe47, 0xfdea, 0xfe15, 0xfe29, 0xfe2b, 0xfedc,
-	0xff65, 0xff51, 0xfed7, 0xfeea, 0xff73, 0xfe8b, 0xfcbc, 0xfc70,
-	0xfed2, 0x01d1, 0x0226, 0x007c, 0xfe9c, 0xfd0f, 0xfbec, 0xfafc,
-	0xfc39, 0x00e0, 0x044c, 0x0346, 0x00cc, 0xff3f, 0xfec2, 0xff67,
-	0x004d, 0x0076, 0x0035, 0x001c, 0x0007, 0xffc6, 0xffb4, 0x0087,
-	0x00ed, 0x0076, 0x0002, 0x0025, 0x00fc, 0x0142, 0x00b5, 0x003c,
-	0xff33, 0xfd8d, 0xfc49, 0xfbbb, 0xfdeb, 0x019b, 0x028b, 0x017a,
-	0x00cf, 0x00a0, 0xff9e, 0xfd91, 0xfc21, 0xfcfb, 0xff09, 0xffb6,
-	0xfed5, 0xfe6c, 0xfefa, 0xff9a, 0xffcf, 0xffbd, 0x0059, 0x021f,
-	0x03b5, 0x03f6, 0x02dc, 0x0105, 0xff75, 0xfe0b, 0xfd16, 0xfdfb,
-	0xffa8, 0x002c, 0xff95, 0xfeae, 0xfe16, 0xfdea, 0xfd91, 0xfd0e,
-	0xfe13, 0x00a0, 0x0211, 0x0162, 0x0063, 0x0045, 0xff92, 0xfdef,
-	0xfd04, 0xfdca, 0xffda, 0x00f2, 0xff68, 0xfd49, 0xfbe3, 0xfb82,
-	0xfc13, 0xfd35, 0xfeeb, 0x0120, 0x0212, 0x00ed, 0xffa8, 0xff9b,
-	0x0038, 0x008f, 0xffef, 0xff26, 0xff1e, 0xff80, 0xffad, 0xffcf,
-	0x0024, 0x0021, 0xff83, 0xfe91, 0xfea6, 0x00fe, 0x034f, 0x03ac,
-	0x02e9, 0x0142, 0xfef6, 0xfcc4, 0xfb59, 0xfc54, 0xff28, 0x0106,
-	0x00f8, 0xffed, 0xff58, 0xffbb, 0xff85, 0xfe6a, 0xfe05, 0xfe4d,
-	0xff2c, 0xff4a, 0xff19, 0xffdf, 0x00d3, 0x00c6, 0xffe0, 0xff77,
-	0x00b5, 0x02f9, 0x0404, 0x03cf, 0x0253, 0xffc4, 0xfda8, 0xfc55,
-	0xfc78, 0xfe9b, 0x0122, 0x0170, 0xfff5, 0xfed8, 0xfe47, 0xfd6f,
-	0xfd41, 0xfe28, 0xff60, 0x001b, 0xff4c, 0xfe3b, 0xfe05, 0xfe94,
-	0xff44, 0xfebf, 0xfe5f, 0xffa6, 0x00b5, 0x002e, 0xff55, 0xfe8b,
-	0xfdbf, 0xfd8d, 0xfd01, 0xfcdd, 0xfe60, 0x0059, 0x0130, 0x0085,
-	0xffe2, 0xffd6, 0xff99, 0xfef3, 0xfe75, 0xfed4, 0x0055, 0x019d,
-	0x0141, 0x0113, 0x0169, 0x00c4, 0xff81, 0xff0f, 0x0008, 0x0184,
-	0x0204, 0x01b2, 0x00c3, 0xffa4, 0xfeb1, 0xfd95, 0xfd17, 0xfe51,
-	0x0049, 0x011e, 0x0083, 0x004e, 0x00a2, 0x001f, 0xfedc, 0xfd4c,
-	0xfccb, 0xfe1f, 0xff4c, 0xff52, 0xff1d, 0xfeff, 0xfec0, 0xfdbe,
-	0xfca1, 0xfe99, 0x025f, 0x04cf, 0x0516, 0x0393, 0x0138, 0xff2c,
-	0xfdc2, 0xfcf5, 0xfdac, 0xff39, 0xffc4, 0xfe83, 0xfdaa, 0xfe0d,
-	0xfec5, 0xffb6, 0x0051, 0x0034, 0x004d, 0x007b, 0xffb8, 0xff63,
-	0x003c, 0x0091, 0xff5c, 0xfdc0, 0xfd9c, 0xfecd, 0xfff4, 0xfff2,
-	0xfea6, 0xfd84, 0xfced, 0xfc07, 0xfb04, 0xfbf7, 0xfede, 0x010f,
-	0x00e9, 0x0017, 0xfff1, 0xffc4, 0xffeb, 0xffe8, 0xff61, 0xffa5,
-	0x0019, 0xffa5, 0xffa3, 0x004b, 0x010f, 0x0164, 0x009a, 0x001f,
-	0x0102, 0x0219, 0x029f, 0x028d, 0x019b, 0x0012, 0xfe06, 0xfbc0,
-	0xfb1c, 0xfce7, 0xffbc, 0x00d5, 0x0065, 0x000b, 0xff35, 0xfdc7,
-	0xfcc2, 0xfca2, 0xfdfd, 0x0008, 0x0041, 0xff8b, 0xff88, 0xffba,
-	0xff66, 0xfef2, 0xffd5, 0x0191, 0x032f, 0x03e4, 0x02ff, 0x0193,
-	0x0107, 0x0092, 0xff7e, 0xfeb3, 0xfefb, 0xffbf, 0xffa9, 0xfef2,
-	0xfea1, 0xfe40, 0xfe70, 0xfeba, 0xfe2a, 0xfe6c, 0xff8e, 0xffa4,
-	0xff15, 0xff0e, 0xfeed, 0xfdf9, 0xfcc6, 0xfcac, 0xfe49, 0x0059,
-	0x00e8, 0x0001, 0xff32, 0xfeda, 0xfe0b, 0xfd22, 0xfce6, 0xfd88,
-	0xfee1, 0xff43, 0xfe86, 0xfea8, 0xffed, 0x0150, 0x01e5, 0x0109,
-	0x002a, 0x0010, 0x0098, 0x0143, 0x0171, 0x0199, 0x00fc, 0xff51,
-	0xfe2c, 0xfeaf, 0x00aa, 0x030b, 0x038e, 0x022b, 0x0084, 0xfdeb,
-	0xfbba, 0xfb45, 0xfcfe, 0x0022, 0x0192, 0x00f0, 0x0024, 0xff6d,
-	0xff14, 0xff0f, 0xfe87, 0xfe63, 0xfebb, 0xfe75, 0xfde1, 0xfe10,
-	0xff2e, 0x001f, 0x001c, 0xffc7, 0x0004, 0x016e, 0x0367, 0x03fc,
-	0x0378, 0x028a, 0x00c6, 0xfecd, 0xfd0e, 0xfc59, 0xfda4, 0xff76,
-	0xff8f, 0xfe69, 0xfdeb, 0xfe38, 0xfe99, 0xff00, 0xffa6, 0x000f,
-	0x0016, 0xffdc, 0xff29, 0xff61, 0x0009, 0xffb3, 0xff09, 0xfec0,
-	0xfeeb, 0xfef9, 0xfea1, 0xfe72, 0xfec3, 0xfeca, 0xfe1e, 0xfd12,
-	0xfc8e, 0xfdf0, 0xff8f, 0xfff9, 0xffbf, 0xff84, 0xff83, 0xff94,
-	0xff11, 0xfe6a, 0xff1b, 0x0119, 0x025b, 0x01f2, 0x0112, 0x0026,
-	0xfed8, 0xfdea, 0xfe50, 0xffe9, 0x020a, 0x0308, 0x0290, 0x0160,
-	0xffec, 0xfe90, 0xfd59, 0xfcf8, 0xfe0a, 0xff57, 0xff65, 0xfeb5,
-	0xfedc, 0xff84, 0xffda, 0xff84, 0xfefe, 0xfe9c, 0xfee8, 0xffe9,
-	0xffc7, 0xff89, 0xfff2, 0xffcd, 0xff33, 0xff54, 0x009b, 0x02bf,
-	0x046e, 0x0454, 0x02ff, 0x0132, 0xff87, 0xfe3a, 0xfd4b, 0xfe3c,
-	0xffc4, 0xff8e, 0xfe6f, 0xfdbb, 0xfdf4, 0xff17, 0xffcc, 0xff48,
-	0xfe67, 0xfe1e, 0xfe22, 0xfde7, 0xfe7e, 0xffe7, 0x002b, 0xff74,
-	0xfec3, 0xfe29, 0xfedd, 0x0063, 0x015e, 0x0126, 0xffb3, 0xfdec,
-	0xfbed, 0xfaab, 0xfc09, 0xfeb1, 0x0047, 0x006d, 0xff93, 0xfeeb,
-	0xff11, 0xff1f, 0xff81, 0x001e, 0x011c, 0x020e, 0x0138, 0x0005,
-	0x005a, 0x00a7, 0x0066, 0xffe4, 0xff85, 0x000f, 0x00f5, 0x0170,
-	0x0164, 0x0097, 0xff9e, 0xfe9b, 0xfda5, 0xfe7b, 0x005b, 0x01a3,
-	0x020a, 0x0118, 0xff98, 0xfe52, 0xfd9e, 0xfd49, 0xfd58, 0xfeb0,
-	0xfffe, 0xff9c, 0xfecf, 0xfec9, 0xfe94, 0xfe8c, 0xfea2, 0xfeee,
-	0x0042, 0x01de, 0x02cd, 0x029c, 0x0231, 0x020a, 0x00bc, 0xfe8d,
-	0xfdb8, 0xfdb6, 0xfdc3, 0xfe10, 0xfe42, 0xfef5, 0xffff, 0x0075,
-	0x004a, 0xff8b, 0xff7f, 0x0045, 0x00a4, 0x0053, 0x0006, 0xff98,
-	0xff0b, 0xfe66, 0xfdc3, 0xfe52, 0xffb1, 0x00ae, 0x0046, 0xfecb,
-	0xfd29, 0xfbbc, 0xfaea, 0xfb74, 0xfd20, 0xfebb, 0xff4a, 0xfeda,
-	0xfec2, 0xff3d, 0xffb0, 0xffd2, 0xffb4, 0x0068, 0x015a, 0x0118,
-	0x00a9, 0x00eb, 0x0107, 0x00bc, 0x0003, 0xff09, 0xff2b, 0x0132,
-	0x03a0, 0x042d, 0x027c, 0x0071, 0xfe43, 0xfc83, 0xfc68, 0xfd9a,
-	0xff5e, 0x00bb, 0x00af, 0xff2f, 0xfe1b, 0xfdec, 0xfe15, 0xfe2e,
-	0xfe58, 0xfeb9, 0xfe74, 0xfe18, 0xfee8, 0x0091, 0x01d0, 0x01c9,
-	0x00ae, 0xffed, 0x0057, 0x016a, 0x0277, 0x033f, 0x032d, 0x0200,
-	0x001c, 0xfe73, 0xfddc, 0xfef9, 0x00a7, 0x00ec, 0xfffb, 0xfeeb,
-	0xfe0f, 0xfdd8, 0xfdd0, 0xfdfe, 0xff3e, 0x000e, 0xffb1, 0xfed2,
-	0xfe52, 0xfe97, 0xfecc, 0xfe32, 0xfd71, 0xfde2, 0xff52, 0x008b,
-	0x00a0, 0x0041, 0xff77, 0xfd7f, 0xfc15, 0xfbce, 0xfc56, 0xfdc7,
-	0xff1c, 0xffe8, 0x002a, 0xfffc, 0xffc0, 0xffb4, 0x0039, 0x0199,
-	0x02d2, 0x02ab, 0x01d4, 0x00e7, 0x005d, 0xfff4, 0xff05, 0xfe9f,
-	0xffad, 0x0177, 0x0282, 0x0190, 0x0018, 0xff32, 0xfeb0, 0xfe89,
-	0xfe0c, 0xfe88, 0x0031, 0x008f, 0x000d, 0xffc6, 0xff24, 0xfee3,
-	0xfe95, 0xfdeb, 0xfd94, 0xfda1, 0xfdde, 0xfe85, 0xff4a, 0x0014,
-	0xffeb, 0xff03, 0xfead, 0xff42, 0x0136, 0x03a0, 0x043d, 0x0388,
-	0x023c, 0x0027, 0xfe2a, 0xfd1d, 0xfd82, 0xff26, 0x0018, 0x0008,
-	0xff3d, 0xfee3, 0xff96, 0xffb5, 0xfed3, 0xfe72, 0xfeae, 0xfed1,
-	0xfeac, 0xff45, 0x0098, 0x00f6, 0x0015, 0xfe83, 0xfd28, 0xfd9c,
-	0xff36, 0x0015, 0xfff6, 0xfee4, 0xfd0a, 0xfbf5, 0xfb80, 0xfc68,
-	0xff00, 0x00b9, 0x0121, 0x0053, 0xfee4, 0xfe3b, 0xfed6, 0xfff1,
-	0x0122, 0x022b, 0x0275, 0x0137, 0xffdd, 0xffdd, 0x0027, 0xffc6,
-	0xfed4, 0xfe1b, 0xfedb, 0x008c, 0x0193, 0x01be, 0x01b5, 0x013a,
-	0xff53, 0xfd42, 0xfc8f, 0xfd62, 0xff02, 0x0042, 0x0045, 0xff2a,
-	0xfe79, 0xfe35, 0xfdb7, 0xfdc3, 0xfe8f, 0xff94, 0x0005, 0x0058,
-	0x00cc, 0x00cc, 0x00e4, 0x00da, 0x002b, 0x0050, 0x019a, 0x0237,
-	0x0215, 0x021d, 0x019d, 0x0052, 0xfe8c, 0xfd32, 0xfd98, 0xfef1,
-	0xff96, 0xffbd, 0xffce, 0xffcc, 0xff78, 0xfe6a, 0xfd95, 0xfdb0,
-	0xfe9f, 0xff44, 0xff36, 0xff1c, 0xfee9, 0xfe67, 0xfded, 0xfdde,
-	0xfecd, 0x00d7, 0x0267, 0x0246, 0x00d4, 0xff1e, 0xfd70, 0xfc72,
-	0xfc66, 0xfd65, 0xfedf, 0xffc2, 0xffbc, 0xfefe, 0xff4f, 0x0047,
-	0x004b, 0xffe1, 0xffce, 0x0030, 0x0034, 0x0040, 0x010e, 0x01c5,
-	0x0150, 0x0070, 0xfed6, 0xfdec, 0xff62, 0x00e8, 0x0191, 0x01d2,
-	0x010a, 0xff93, 0xfe52, 0xfe03, 0xff21, 0x00f2, 0x0221, 0x01a9,
-	0xfff6, 0xfec1, 0xfe6e, 0xfe66, 0xfe30, 0xfde9, 0xfe05, 0xfe57,
-	0xfe2f, 0xfe20, 0xfefc, 0xffd0, 0xffea, 0xfeb3, 0xfdd1, 0xfebb,
-	0x0067, 0x0279, 0x03aa, 0x037a, 0x01d0, 0xff22, 0xfd06, 0xfcc0,
-	0xfe35, 0x000b, 0x010b, 0x0089, 0xffe2, 0xff2b, 0xfe59, 0xfe3a,
-	0xfeaa, 0xffca, 0x0095, 0x003f, 0xffbd, 0xff8a, 0xffb6, 0x0067,
-	0xfff6, 0xfe9c, 0xfe8c, 0xff09, 0xff0d, 0xfed2, 0xfe74, 0xfdfb,
-	0xfd11, 0xfc34, 0xfbe7, 0xfc9a, 0xfe5c, 0xff84, 0xffaa, 0xfff5,
-	0x002c, 0x000a, 0x001b, 0x0056, 0x0114, 0x01ac, 0x016d, 0x007c,
-	0xff72, 0xfef5, 0xfeb2, 0xfe25, 0xfe76, 0xffb0, 0x0132, 0x02a8,
-	0x02f3, 0x021d, 0x0118, 0x0025, 0xff1d, 0xfe6a, 0xfea7, 0xff6f,
-	0xffad, 0xff3d, 0xff35, 0xff75, 0xff27, 0xfe2d, 0xfcac, 0xfc14,
-	0xfcfc, 0xfe45, 0xffa4, 0x0110, 0x0201, 0x0200, 0x00dd, 0xff4f,
-	0xff41, 0x00ea, 0x0295, 0x034a, 0x029a, 0x00d4, 0xfec3, 0xfdbf,
-	0xfdda, 0xfecd, 0x0056, 0x0104, 0x0069, 0xff95, 0xff56, 0xff8a,
-	0xffc6, 0xffb5, 0xff4f, 0xff18, 0xfeb0, 0xfe07, 0xfdd5, 0xfe9e,
-	0xff3c, 0xfe67, 0xfd31, 0xfcfa, 0xfdee, 0xffae, 0x0108, 0x009f,
-	0xff96, 0xfe4b, 0xfca1, 0xfbd1, 0xfcba, 0xfec0, 0x002b, 0x004e,
-	0xffb1, 0xfeef, 0xfea5, 0xff64, 0x003f, 0x00bc, 0x0159, 0x0133,
-	0x0085, 0x0034, 0x0087, 0x0148, 0x0190, 0x00a3, 0xff7c, 0xff40,
-	0xfff6, 0x00ae, 0x0158, 0x01d9, 0x017b, 0x0047, 0xfec4, 0xfdc7,
-	0xfe37, 0xff71, 0x001b, 0xfff2, 0xffaf, 0xff28, 0xfe21, 0xfd38,
-	0xfd47, 0xfe5d, 0xff2e, 0xff4c, 0xfed5, 0xfe5d, 0xfe5f, 0xfe51,
-	0xfe22, 0xfe9f, 0xff9f, 0x0152, 0x02ef, 0x02f4, 0x0236, 0x0190,
-	0x008f, 0xffad, 0xfefe, 0xff2b, 0xffce, 0x001e, 0x0060, 0x0068,
-	0x0043, 0xfffc, 0xff04, 0xfded, 0xfdea, 0xfe76, 0xfed7, 0xff06,
-	0xff6d, 0xffbb, 0xff3d, 0xfe1c, 0xfd9e, 0xfe78, 0xffc1, 0x0037,
-	0xff55, 0xfe50, 0xfd1e, 0xfc6d, 0xfcb9, 0xfd16, 0xfdf7, 0xfeee,
-	0xff6a, 0xff20, 0xff16, 0x0040, 0x01c4, 0x0274, 0x0261, 0x01bc,
-	0x009c, 0x0024, 0xfff3, 0xffc0, 0x0007, 0xffbe, 0xfe35, 0xfcdb,
-	0xfcfc, 0xfed4, 0x0124, 0x0272, 0x02a0, 0x01bd, 0x000c, 0xfe71,
-	0xfd8e, 0xfe8e, 0x0043, 0x0111, 0x00b9, 0xffcf, 0xfed7, 0xfdf1,
-	0xfd68, 0xfd6a, 0xfdae, 0xfe57, 0xff2b, 0xffb0, 0x0069, 0x019b,
-	0x025f, 0x01ba, 0x0068, 0xffa6, 0x0029, 0x0146, 0x0235, 0x025d,
-	0x0197, 0x006d, 0xff25, 0xfdc4, 0xfd57, 0xfe84, 0xfffa, 0x005d,
-	0xffcb, 0xff62, 0xff30, 0xfead, 0xff08, 0xffe2, 0x001c, 0x0006,
-	0xff41, 0xfde9, 0xfd2d, 0xfd36, 0xfd09, 0xfce9, 0xfda0, 0xfeb0,
-	0xff80, 0xffec, 0xffe5, 0xffa2, 0xff7f, 0xff11, 0xfe3c, 0xfdb6,
-	0xfe51, 0xff45, 0xffca, 0x0024, 0x005c, 0x0084, 0x006f, 0xffe5,
-	0xfedf, 0xfeb5, 0xffda, 0x0092, 0x00af, 0x00c7, 0x009b, 0xff56,
-	0xfe2b, 0xfe87, 0xffa5, 0x0164, 0x029e, 0x0292, 0x01a2, 0x007c,
-	0xff9f, 0xfeb5, 0xfe6d, 0xff12, 0xff8d, 0xff90, 0xff55, 0xff6e,
-	0xffe6, 0xffbd, 0xff39, 0xfebd, 0xfe4f, 0xfe9b, 0xff72, 0xffa9,
-	0xff89, 0xff73, 0xfe5c, 0xfcb2, 0xfc49, 0xfd8e, 0x001f, 0x024f,
-	0x02f9, 0x0219, 0x00a4, 0xff96, 0xfeb2, 0xfe9e, 0xfffc, 0x015e,
-	0x0183, 0x00cd, 0xffd9, 0xff56, 0xff40, 0xff64, 0xff2a, 0xfea3,
-	0xfea4, 0xfeaa, 0xfe8e, 0xff72, 0x00a9, 0x0085, 0xff8d, 0xfe73,
-	0xfdb3, 0xfe09, 0xff12, 0xffcc, 0xff9d, 0xff1f, 0xfe3c, 0xfc80,
-	0xfb80, 0xfc47, 0xfdcd, 0xff2a, 0xff9c, 0xff69, 0xffb4, 0x003d,
-	0x009d, 0x0110, 0x0148, 0x018b, 0x0180, 0x00a8, 0xff8a, 0xff07,
-	0xfe97, 0xfda7, 0xfc9d, 0xfcac, 0xfe14, 0xffe8, 0x01bb, 0x02bd,
-	0x02ed, 0x022e, 0x0095, 0xff14, 0xfedb, 0xffc8, 0x0103, 0x017a,
-	0x00f0, 0x002b, 0xfecc, 0xfd72, 0xfc85, 0xfc72, 0xfde0, 0xff73,
-	0xffe5, 0x003f, 0x00ac, 0x008b, 0xffcf, 0xfef7, 0xfef1, 0xffcf,
-	0x015c, 0x024c, 0x01ce, 0x0145, 0x00da, 0xffca, 0xfecb, 0xfe50,
-	0xfe5f, 0xfe9c, 0xfee9, 0xff2f, 0xffbb, 0x0095, 0x011e, 0x00e4,
-	0x005f, 0xffcc, 0xff96, 0xffa1, 0xffa4, 0xff9a, 0xff1d, 0xfdb7,
-	0xfc45, 0xfbe7, 0xfcb7, 0xfe4d, 0xff93, 0xfff7, 0xffaa, 0xfecb,
-	0xfdf5, 0xfd6f, 0xfd82, 0xfe9e, 0xfff2, 0x0035, 0xffd8, 0x0012,
-	0x009e, 0x00c3, 0x006f, 0xff7f, 0xfecb, 0xfeea, 0xff7a, 0x0031,
-	0x010f, 0x01c8, 0x011c, 0xff83, 0xfe25, 0xfe20, 0xffe6, 0x024a,
-	0x03cc, 0x03ce, 0x0295, 0x008c, 0xfe70, 0xfd83, 0xfe32, 0xff4c,
-	0xfff2, 0xffad, 0xfef6, 0xfe67, 0xfe07, 0xfe18, 0xfecb, 0xff26,
-	0xff53, 0xfeff, 0xfe5e, 0xfe5f, 0xfefe, 0xff2e, 0xfe4f, 0xfd3b,
-	0xfd12, 0xfe02, 0xff8e, 0x015c, 0x0292, 0x02d2, 0x0247, 0x0110,
-	0xffea, 0xff94, 0x0093, 0x01ca, 0x01f3, 0x0186, 0x00ea, 0x0004,
-	0xff73, 0xff38, 0xfec5, 0xfebb, 0xfedb, 0xfe8b, 0xfe9a, 0xff1b,
-	0xff8e, 0xff0f, 0xfe1b, 0xfd6f, 0xfcf8, 0xfd5f, 0xfe3d, 0xfee4,
-	0xff72, 0xff73, 0xfe5d, 0xfcb7, 0xfbf4, 0xfc57, 0xfd45, 0xfe5d,
-	0xffad, 0x00ce, 0x018d, 0x01bb, 0x0151, 0x00b8, 0x00fd, 0x018a,
-	0x017f, 0x00eb, 0x005b, 0xff9c, 0xfdcc, 0xfc58, 0xfc14, 0xfcd8,
-	0xfef6, 0x0116, 0x01d3, 0x01b9, 0x0144, 0x008e, 0xfff8, 0xffb4,
-	0x0013, 0x008b, 0x005a, 0x0041, 0x0028, 0xffbd, 0xff7a, 0xfef6,
-	0xfe10, 0xfd85, 0xfd83, 0xfe40, 0xff7d, 0x0112, 0x020b, 0x011f,
-	0xff83, 0xfe91, 0xfea1, 0x001f, 0x01e6, 0x029a, 0x024f, 0x0190,
-	0x005d, 0xfed7, 0xfe25, 0xfe8d, 0xfecd, 0xfebc, 0xfe8f, 0xfe6f,
-	0xff2e, 0x0096, 0x0196, 0x013b, 0x002f, 0xff43, 0xfe75, 0xfe43,
-	0xff2a, 0x0043, 0xffe0, 0xfe62, 0xfcc5, 0xfb67, 0xfbb4, 0xfd6b,
-	0xff2e, 0x0065, 0x00b2, 0xffbf, 0xfe0a, 0xfd54, 0xfe30, 0xffb0,
-	0x00d6, 0x015f, 0x012d, 0x00ab, 0x004a, 0xffdb, 0xff7f, 0xff69,
-	0xff78, 0xff8e, 0xff56, 0xff97, 0x003e, 0x006a, 0xffe9, 0xfee2,
-	0xfe00, 0xfe69, 0xffcb, 0x0141, 0x0229, 0x0292, 0x0207, 0x0052,
-	0xfec3, 0xfe06, 0xfe00, 0xfeb1, 0xff89, 0xffa5, 0xff54, 0xff50,
-	0xff30, 0xfef6, 0xff53, 0xffe2, 0xfff6, 0xffc8, 0xffbc, 0xffbb,
-	0xff18, 0xfe26, 0xfdb3, 0xfd7c, 0xfd94, 0xfec6, 0xffc0, 0x0041,
-	0x0112, 0x017f, 0x0158, 0x00c5, 0x006a, 0x0045, 0x0044, 0x0047,
-	0x005b, 0x00b2, 0x0140, 0x0152, 0x0051, 0xfed0, 0xfddb, 0xfdcd,
-	0xfe66, 0xff56, 0x0016, 0x0050, 0xff5d, 0xfdcd, 0xfc91, 0xfc8c,
-	0xfdff, 0xff8b, 0x0046, 0x0020, 0xff26, 0xfdc0, 0xfcf6, 0xfd27,
-	0xfdb8, 0xfdfd, 0xfe5f, 0xfea6, 0xfef2, 0x002e, 0x0154, 0x019f,
-	0x0174, 0x00ab, 0x0006, 0xffd7, 0xfff4, 0x0096, 0x00d5, 0x0001,
-	0xfe3e, 0xfc8c, 0xfc31, 0xfe2a, 0x007a, 0x01d3, 0x0253, 0x0199,
-	0x005c, 0xff27, 0xff2a, 0x006f, 0x0192, 0x01e6, 0x0120, 0xffcd,
-	0xff0e, 0xfeef, 0xff41, 0xff83, 0xff14, 0xfe63, 0xfe04, 0xfe00,
-	0xff2c, 0x0076, 0x0117, 0x00a4, 0xff5a, 0xfe6d, 0xfe54, 0xff74,
-	0x010a, 0x0224, 0x025a, 0x01a9, 0x000a, 0xfe6b, 0xfdec, 0xfe38,
-	0xff1f, 0xff96, 0xff6e, 0x000c, 0x0091, 0x0060, 0x0025, 0xffd9,
-	0xffd0, 0xffc0, 0xff8f, 0xffc9, 0xffdb, 0xff68, 0xfe64, 0xfcec,
-	0xfbb6, 0xfb7b, 0xfc4d, 0xfdb1, 0xfef3, 0xffcb, 0xffdb, 0xff29,
-	0xfeb2, 0xfe94, 0xfed4, 0xff9c, 0x0069, 0x0102, 0x0151, 0x0147,
-	0x00eb, 0xffed, 0xfeec, 0xfef6, 0xff86, 0xffe8, 0x004c, 0x00bc,
-	0x00bb, 0xffcf, 0xfe9b, 0xfe69, 0xff56, 0x00e5, 0x0217, 0x0203,
-	0x01ae, 0x010b, 0x0037, 0xff89, 0xff3e, 0xfef2, 0xfe64, 0xfde5,
-	0xfdb2, 0xfdf8, 0xff13, 0x0004, 0x0030, 0xffa9, 0xfe75, 0xfde4,
-	0xfe3a, 0xff27, 0x0038, 0x0050, 0xff90, 0xfe09, 0xfc4f, 0xfc3a,
-	0xfe02, 0xffd6, 0x011c, 0x01c0, 0x01cb, 0x00e6, 0xffd7, 0xfff0,
-	0x008d, 0x014d, 0x016a, 0x00e9, 0x0097, 0x00df, 0x0149, 0x00e8,
-	0xffe2, 0xfedb, 0xfdf4, 0xfd75, 0xfe1f, 0xff9d, 0x0083, 0x0056,
-	0xff1e, 0xfcfd, 0xfbaf, 0xfc37, 0xfe38, 0x0025, 0x00af, 0x005b,
-	0xff0f, 0xfd4e, 0xfc90, 0xfcd6, 0xfe04, 0xff51, 0xffa8, 0xff89,
-	0xffec, 0x003e, 0x0092, 0x010a, 0x0162, 0x0156, 0x0097, 0xfff8,
-	0x0015, 0x0069, 0x0081, 0xffa7, 0xfe15, 0xfd18, 0xfd66, 0xfe2f,
-	0xff3c, 0x0078, 0x0178, 0x0157, 0x005e, 0xffb6, 0xff14, 0xff1e,
-	0x0016, 0x00ad, 0x0094, 0x004f, 0x0021, 0xffb5, 0xfeaf, 0xfde8,
-	0xfe24, 0xfe37, 0xfefd, 0xfffd, 0x0098, 0x00f2, 0x0073, 0xff7e,
-	0xfed8, 0xff16, 0x0000, 0x00e3, 0x01a0, 0x0283, 0x0250, 0x00b1,
-	0xff5f, 0xfe55, 0xfdd9, 0xfdf5, 0xfe2f, 0xfef8, 0x001f, 0x00f1,
-	0x010b, 0x0041, 0xff40, 0xfe7f, 0xfe85, 0xff76, 0x003f, 0x0054,
-	0x0008, 0xfec9, 0xfcb9, 0xfb54, 0xfbab, 0xfd4f, 0xfeaa, 0xff5c,
-	0xffb6, 0xff45, 0xfee9, 0xff17, 0xff7a, 0x0025, 0x00a8, 0x008f,
-	0x004c, 0x006b, 0x00fb, 0x0140, 0x00c5, 0x0021, 0xff54, 0xfe41,
-	0xfe12, 0xff2e, 0x00ac, 0x017a, 0x00f5, 0xff94, 0xfe32, 0xfdc7,
-	0xff01, 0x00a2, 0x0193, 0x01e2, 0x0159, 0x0014, 0xfeb2, 0xfdce,
-	0xfe09, 0xfee7, 0xff4b, 0xfec5, 0xfe69, 0xff06, 0xfff0, 0x004c,
-	0x002f, 0xffa4, 0xfec6, 0xfe75, 0xfec7, 0xffbe, 0x00d5, 0x00d9,
-	0xff73, 0xfda7, 0xfcaa, 0xfcc8, 0xfdeb, 0x0007, 0x01f4, 0x023f,
-	0x0134, 0x0008, 0xfee7, 0xfec4, 0xffb5, 0x00c8, 0x0128, 0x011f,
-	0x0123, 0x00ca, 0x000a, 0xff30, 0xfec4, 0xfea5, 0xfebc, 0xfebc,
-	0xfefc, 0xffbf, 0x003b, 0xffac, 0xfe83, 0xfdb9, 0xfdbd, 0xfe4c,
-	0xfefa, 0xffbd, 0x005d, 0x0030, 0xff50, 0xfe6a, 0xfdd4, 0xfd7a,
-	0xfda4, 0xfe22, 0xfefc, 0xffad, 0x0016, 0x004a, 0x0033, 0x0006,
-	0xffb6, 0xffe1, 0x0012, 0x0034, 0x005b, 0x002a, 0xff23, 0xfdfe,
-	0xfd69, 0xfdcd, 0xfec3, 0xff4a, 0xffdb, 0x0028, 0x0063, 0x008d,
-	0x0037, 0x0010, 0x007c, 0x0086, 0x001e, 0x000e, 0x00b1, 0x018e,
-	0x015b, 0x004d, 0xfefa, 0xfdbc, 0xfd71, 0xfe30, 0xff91, 0x00f1,
-	0x0161, 0x008a, 0xff32, 0xfdfa, 0xfdce, 0xff1e, 0x011a, 0x0243,
-	0x0261, 0x017b, 0x0020, 0xfeef, 0xfe51, 0xfe5f, 0xfe89, 0xfe8a,
-	0xfe5b, 0xfecb, 0x0007, 0x00f5, 0x0105, 0x00a1, 0xfff6, 0xff4a,
-	0xfe74, 0xfe64, 0xffcf, 0x00ed, 0x008f, 0xfee3, 0xfce7, 0xfbe0,
-	0xfc3d, 0xfd5a, 0xfeff, 0xfff5, 0xffd2, 0xff79, 0xfeb3, 0xfe59,
-	0xfedf, 0xff88, 0x003a, 0x0015, 0xffa1, 0xffa2, 0xffd3, 0x000f,
-	0x002e, 0xffc2, 0xff38, 0xfea9, 0xfe5e, 0xff0d, 0x0047, 0x0134,
-	0x00f3, 0xffde, 0xff3b, 0xff3b, 0xffac, 0x0055, 0x0185, 0x026a,
-	0x01ba, 0x0006, 0xfebb, 0xfddf, 0xfd9b, 0xfe24, 0xfecb, 0xff7d,
-	0x001f, 0x0034, 0xff99, 0xfecb, 0xfe62, 0xfe6e, 0xfed1, 0xff2c,
-	0xff84, 0xffa7, 0xffa9, 0xff40, 0xfe1d, 0xfd86, 0xfdd6, 0xfeb6,
-	0xffad, 0x0046, 0x00a7, 0x010e, 0x010a, 0x007e, 0x0018, 0xffec,
-	0xffdf, 0xffd1, 0x0097, 0x01cb, 0x021a, 0x0152, 0x0031, 0xff2f,
-	0xfe2a, 0xfdfe, 0xfe3f, 0xff20, 0xfff4, 0x003b, 0xff47, 0xfdcb,
-	0xfd67, 0xfe06, 0xff0b, 0xffad, 0xffca, 0xff80, 0xff54, 0xff4e,
-	0xff33, 0xfec3, 0xfe27, 0xfe0e, 0xfdbd, 0xfd42, 0xfe25, 0xfff8,
-	0x012f, 0x01a7, 0x0115, 0x000f, 0xff46, 0xfefe, 0xff9d, 0x00b8,
-	0x0153, 0x00b7, 0xff07, 0xfdb5, 0xfd84, 0xfde6, 0xff0a, 0x006f,
-	0x00cf, 0x0088, 0xffc3, 0xfef0, 0xfebd, 0xff7c, 0x0050, 0x0066,
-	0x003d, 0x0021, 0x0017, 0x000a, 0x0015, 0xffa9, 0xfedc, 0xfe81,
-	0xfe83, 0xfe6c, 0xff0c, 0x009a, 0x013c, 0x005b, 0xff55, 0xfee4,
-	0xff3d, 0x0072, 0x01c3, 0x0263, 0x0273, 0x0185, 0xfff6, 0xfeb1,
-	0xfdb3, 0xfdae, 0xfe59, 0xfeee, 0xffc5, 0x0020, 0xfffe, 0x0033,
-	0x0041, 0x0029, 0xffe3, 0xff08, 0xfe6d, 0xfe2e, 0xfe5c, 0xff03,
-	0xfef0, 0xfe69, 0xfe22, 0xfdc9, 0xfdcd, 0xfdd3, 0xfdd3, 0xfed6,
-	0xfff0, 0x0045, 0xffcf, 0xff3e, 0xff4a, 0xff69, 0xff77, 0xfff8,
-	0x0079, 0x00a1, 0x00a5, 0x001d, 0xff4a, 0xfec4, 0xff01, 0xffae,
-	0x0009, 0x008a, 0x008d, 0xff8d, 0xff1f, 0xff53, 0xff74, 0x0005,
-	0x00b2, 0x00b3, 0x0074, 0x0038, 0xfffe, 0xff7e, 0xfe9e, 0xfe51,
-	0xfe27, 0xfdc4, 0xfe2c, 0xff1c, 0x002c, 0x00a6, 0x0007, 0xfef1,
-	0xfe4f, 0xfe41, 0xfec1, 0xff69, 0x0053, 0x00d1, 0x0003, 0xfea3,
-	0xfdb3, 0xfde7, 0xff04, 0x0033, 0x00b2, 0x00db, 0x0089, 0x002b,
-	0xffe1, 0xffe3, 0x000e, 0x0005, 0xfffd, 0xffcc, 0xff8d, 0xffb5,
-	0x004e, 0x00ed, 0x00b8, 0xffc2, 0xfec1, 0xfdf6, 0xfd89, 0xfe0c,
-	0xff3f, 0xff81, 0xfef2, 0xfe4f, 0xfdf7, 0xfe42, 0xff29, 0xfffe,
-	0x0092, 0x0127, 0x00b7, 0xff3e, 0xfdb0, 0xfd74, 0xfe0a, 0xfe6d,
-	0xfeae, 0xff0a, 0xff71, 0xffea, 0x0054, 0x007e, 0x0040, 0xffe2,
-	0xff90, 0xff36, 0xff2c, 0xff95, 0xfff9, 0x0010, 0xff97, 0xfebd,
-	0xfe5f, 0xfe59, 0xfec9, 0xffae, 0x006a, 0x008f, 0x0012, 0xff15,
-	0xfe96, 0xff12, 0xffee, 0x00b4, 0x0130, 0x0172, 0x0124, 0xfffb,
-	0xfeb9, 0xfe45, 0xfe98, 0xff3a, 0xff80, 0xff87, 0xffef, 0xfff7,
-	0xff5a, 0xff5a, 0xffc3, 0x0020, 0x00b7, 0x00f2, 0x00a2, 0x00c2,
-	0x00e9, 0x00bd, 0xffce, 0xfec0, 0xfe32, 0xfdb6, 0xfdb8, 0xfe7f,
-	0xff97, 0x00a1, 0x0129, 0x0096, 0xff86, 0xfec9, 0xfeba, 0xfefd,
-	0xff3f, 0xffbb, 0xffb8, 0xff03, 0xfe2f, 0xfda3, 0xfe0b, 0xfe7b,
-	0xfe82, 0xfee4, 0xff5d, 0xffc0, 0xffe9, 0xffd6, 0xffe2, 0xffe3,
-	0xff8c, 0xfefb, 0xfe6e, 0xfeda, 0x0012, 0x00a9, 0x0080, 0xffd4,
-	0xfefa, 0xfec7, 0xff02, 0xff2f, 0xffeb, 0x007b, 0x001d, 0xff47,
-	0xfe7a, 0xfe6a, 0xff36, 0x0099, 0x0196, 0x01e9, 0x01ae, 0x0085,
-	0xfe9b, 0xfd86, 0xfde8, 0xfe83, 0xfee9, 0xff43, 0xff9f, 0xffde,
-	0xffb1, 0xffcb, 0xff8a, 0xff22, 0xff13, 0xfe7e, 0xfdff, 0xfe99,
-	0xffa3, 0x004b, 0x004f, 0xff83, 0xfebe, 0xfe5f, 0xfe8d, 0xff5c,
-	0x0040, 0x0132, 0x0164, 0x0060, 0xff3c, 0xfec9, 0xff1f, 0xffd0,
-	0x0017, 0x008b, 0x011d, 0x011b, 0x00a2, 0x0023, 0xffc4, 0xff87,
-	0xfeef, 0xfe0f, 0xfdd4, 0xfe2c, 0xfe9e, 0xff0e, 0xff4d, 0xff48,
-	0xfef1, 0xfee0, 0xfeee, 0xff64, 0x006f, 0x00ef, 0x003a, 0xff1f,
-	0xfe6b, 0xfdc9, 0xfd8e, 0xfdd5, 0xfedd, 0xffea, 0x0060, 0x005c,
-	0xff33, 0xfe67, 0xff1d, 0xffe3, 0x002e, 0x009a, 0x00ea, 0x008a,
-	0xffbc, 0xfed9, 0xfe66, 0xfeb1, 0xff44, 0xff76, 0xff79, 0xffd4,
-	0xffef, 0xffe5, 0xfff4, 0xffeb, 0xffaf, 0xff5c, 0xff14, 0xff4a,
-	0x0037, 0x011c, 0x0106, 0x002d, 0xff3b, 0xfe7c, 0xfe0d, 0xfe26,
-	0xfed0, 0xffbe, 0x004f, 0x0025, 0xff60, 0xfee6, 0xff42, 0x0035,
-	0x00f1, 0x0150, 0x0188, 0x017e, 0x008f, 0xff75, 0xfeee, 0xfee3,
-	0xfeca, 0xfe88, 0xfeac, 0xff40, 0x0018, 0x010f, 0x0146, 0x0089,
-	0xffc3, 0xfecd, 0xfd7b, 0xfd4b, 0xfe5c, 0xff75, 0x0008, 0xff94,
-	0xfe73, 0xfd81, 0xfd50, 0xfdd0, 0xfedc, 0x002f, 0x00f8, 0x009b,
-	0xff80, 0xfece, 0xfe97, 0xff14, 0xffab, 0xffa8, 0xffe0, 0x0013,
-	0x0003, 0xffc5, 0xffb9, 0x0000, 0xffed, 0xff5e, 0xfee7, 0xfec6,
-	0xff74, 0x002f, 0x001d, 0xffd6, 0xffa6, 0xff52, 0xff4a, 0xff8e,
-	0x0041, 0x011f, 0x00fa, 0x0025, 0xfef5, 0xfdf8, 0xfdd0, 0xfe2a,
-	0xff02, 0xffed, 0x0060, 0x0050, 0xff9b, 0xfe8e, 0xfe3f, 0xfe8d,
-	0xfe7e, 0xfea6, 0xff45, 0xffe7, 0x000b, 0xffde, 0xff99, 0xff67,
-	0xff47, 0xff43, 0xfee7, 0xff15, 0x002c, 0x00d9, 0x00f9, 0x00af,
-	0xfff7, 0xff65, 0xfec5, 0xfe8a, 0xff68, 0x00e9, 0x020c, 0x01f3,
-	0x00d3, 0xff93, 0xfe48, 0xfd95, 0xfdc3, 0xfe0d, 0xfec3, 0xff25,
-	0xfe95, 0xfe0f, 0xfe05, 0xfe92, 0xff59, 0xffbb, 0x003f, 0x008a,
-	0x0067, 0x0007, 0xff88, 0xff34, 0xff1e, 0xfeae, 0xfe33, 0xfe4c,
-	0xff09, 0x0008, 0x00a1, 0x007e, 0xfff2, 0xff82, 0xfef3, 0xfe6a,
-	0xfef0, 0x0030, 0x00e5, 0x009d, 0xffd1, 0xfeb8, 0xfdfb, 0xfe3e,
-	0xfed0, 0xff8b, 0x0056, 0x0083, 0xffd2, 0xff01, 0xfec0, 0xff35,
-	0xffbc, 0xffe6, 0x0000, 0xfffc, 0x003d, 0x004c, 0x004c, 0x0046,
-	0xfff0, 0xff14, 0xfe3e, 0xfdf3, 0xfe93, 0xffdf, 0x00bc, 0x00e9,
-	0x0056, 0xffd1, 0xff4b, 0xff03, 0xff8e, 0x00b1, 0x01a4, 0x0162,
-	0x0046, 0xfedf, 0xfe29, 0xfe4d, 0xfe81, 0xff2b, 0xfffd, 0x0088,
-	0x0093, 0x003c, 0xffa3, 0xff49, 0xfeef, 0xfe48, 0xfe01, 0xfe43,
-	0xfec1, 0xff1e, 0xff6c, 0xff6a, 0xfed8, 0xfe8e, 0xfe6f, 0xfe92,
-	0xff63, 0x0090, 0x0120, 0x00ad, 0xffee, 0xff62, 0xfe76, 0xfe1d,
-	0xfe9c, 0xff5d, 0x003c, 0x00c0, 0x005b, 0xff9c, 0xff26, 0xff08,
-	0xfee8, 0xff15, 0xff7d, 0xffbe, 0xff7b, 0xff17, 0xfed6, 0xff11,
-	0xffb1, 0xffd7, 0xffe2, 0x0007, 0x001c, 0x0011, 0x000c, 0xffff,
-	0xffb9, 0xff65, 0xfec6, 0xfe5b, 0xfe9f, 0xff90, 0x0098, 0x00ea,
-	0x0085, 0xff9c, 0xfe83, 0xfdc4, 0xfdd3, 0xfec7, 0xfffc, 0x009d,
-	0x0097, 0xffde, 0xfef6, 0xfe85, 0xfeb3, 0xff27, 0xffbd, 0x006e,
-	0x00a3, 0xffe7, 0xff56, 0xff9a, 0xff96, 0xff6e, 0xffaa, 0xffc3,
-	0x0031, 0x0107, 0x0174, 0x0142, 0x00a2, 0xffb6, 0xfe4d, 0xfd55,
-	0xfd6a, 0xfe29, 0xff0e, 0xffb5, 0xff96, 0xfebc, 0xfe51, 0xfe56,
-	0xfef5, 0x0031, 0x0134, 0x0138, 0x0082, 0xff69, 0xfe64, 0xfdee,
-	0xfe54, 0xfec9, 0xfedf, 0xff45, 0xffa9, 0xff86, 0xff9b, 0xfff8,
-	0x0021, 0xfff1, 0xff56, 0xfef0, 0xfef8, 0xff58, 0xffe7, 0x000a,
-	0xffe6, 0xff7c, 0xfed4, 0xfe5d, 0xfeb0, 0xff8f, 0x00b0, 0x00fc,
-	0x0097, 0x0021, 0xff6f, 0xfecc, 0xff11, 0xff69, 0xffcf, 0x0062,
-	0x00b6, 0x0057, 0xffab, 0xff4a, 0xff21, 0xfeea, 0xff0d, 0xff50,
-	0xff82, 0xffb9, 0xffd4, 0xffc7, 0xffa6, 0xff9b, 0xff46, 0xff40,
-	0xffd2, 0x0045, 0x007c, 0x009f, 0x001c, 0xff38, 0xfe82, 0xfe13,
-	0xfe49, 0xff84, 0x012d, 0x01d6, 0x017a, 0x009f, 0xff30, 0xfdf8,
-	0xfda2, 0xfe05, 0xfe85, 0xff45, 0xffc1, 0xff55, 0xfe9f, 0xfe52,
-	0xfe9e, 0xff2a, 0xffc1, 0x000f, 0x0004, 0xffe4, 0xffa8, 0xff8e,
-	0xff92, 0xff49, 0xfecb, 0xfe72, 0xfe35, 0xfe8e, 0xff71, 0x002c,
-	0x006f, 0x003a, 0xffdc, 0xff12, 0xfe7e, 0xfed5, 0xff61, 0xffd1,
-	0xffd7, 0xff5a, 0xfeb8, 0xfea0, 0xff10, 0xffaf, 0x005f, 0x00e6,
-	0x00d1, 0x0043, 0xffa5, 0xff1f, 0xff23, 0xff4d, 0xff18, 0xfed6,
-	0xff03, 0xff52, 0xff93, 0xfff1, 0xffd6, 0xff3e, 0xfea1, 0xfe51,
-	0xfe52, 0xfeef, 0x0006, 0x00c5, 0x0068, 0xffb2, 0xfeba, 0xfe17,
-	0xfe4d, 0xff4c, 0x0091, 0x018e, 0x018c, 0x00a9, 0xff9f, 0xfee4,
-	0xfec0, 0xff5d, 0x0018, 0x00ae, 0x0117, 0x00fc, 0x005d, 0xffab,
-	0xff7a, 0xff2a, 0xfe99, 0xfe4c, 0xfe39, 0xfe19, 0xfe55, 0xfea3,
-	0xfebf, 0xfed8, 0xff22, 0xff5b, 0xff48, 0xffaa, 0x0028, 0x0074,
-	0x0072, 0xffce, 0xfecb, 0xfe24, 0xfdea, 0xfe39, 0xff22, 0x002d,
-	0x00d8, 0x00d0, 0x0051, 0xffb9, 0xff42, 0xff50, 0xff81, 0xff78,
-	0xff89, 0xff9f, 0xff31, 0xfed5, 0xff20, 0xff71, 0xffa9, 0xffa7,
-	0xff93, 0xffd0, 0x0006, 0x005e, 0x0051, 0xffe4, 0xff69, 0xfea1,
-	0xfe27, 0xfe2a, 0xff05, 0x0063, 0x00e8, 0x008e, 0xffcc, 0xfeee,
-	0xfe5a, 0xfed9, 0xffd8, 0x0097, 0x0109, 0x00b6, 0xffa4, 0xfe67,
-	0xfe42, 0xfef0, 0xffa0, 0x0077, 0x00ea, 0x00b5, 0x003c, 0xff9c,
-	0xff1c, 0xff32, 0xff77, 0xff70, 0xff5c, 0xffac, 0x0048, 0x00a7,
-	0x0091, 0x0016, 0xff2d, 0xfe4b, 0xfde0, 0xfdd5, 0xfe4e, 0xff5f,
-	0xfffa, 0xff92, 0xff03, 0xfe83, 0xfe3f, 0xfee5, 0xffdd, 0x0075,
-	0x00dc, 0x00cd, 0x0010, 0xff10, 0xfe8c, 0xfea9, 0xfea2, 0xfe93,
-	0xfeb3, 0xff2e, 0xffad, 0xfff4, 0x0041, 0x0051, 0x0017, 0xff87,
-	0xfee4, 0xfe75, 0xfea8, 0xff46, 0xff76, 0xff3c, 0xff18, 0xff02,
-	0xfedd, 0xff4b, 0x002a, 0x00f5, 0x016b, 0x0108, 0xffd8, 0xfe87,
-	0xfdf9, 0xfe05, 0xfe88, 0xff71, 0x0066, 0x00da, 0x0073, 0xff91,
-	0xfed8, 0xfeaf, 0xff35, 0xffb5, 0xffc5, 0x000f, 0x000f, 0xff81,
-	0xff19, 0xfeff, 0xfee8, 0xff0a, 0xff51, 0xffa9, 0x0009, 0x00b7,
-	0x0106, 0x007f, 0xffeb, 0xff4f, 0xfea3, 0xfe77, 0xff30, 0x003e,
-	0x010c, 0x0126, 0x0073, 0xff3d, 0xfe70, 0xfe55, 0xfe8e, 0xfedf,
-	0xff58, 0xff81, 0xff31, 0xfea6, 0xfe66, 0xff00, 0xffbb, 0xffe8,
-	0xfff1, 0xffd0, 0xffb2, 0xffbf, 0xffbe, 0xffab, 0xff9b, 0xff27,
-	0xfe8d, 0xfe57, 0xfef0, 0x0025, 0x00e9, 0x011e, 0x00a0, 0xff9d,
-	0xfec8, 0xfe58, 0xfe6a, 0xff2b, 0xfff1, 0x0006, 0xff75, 0xfe9f,
-	0xfe30, 0xfe85, 0xff7c, 0x006f, 0x00ed, 0x0152, 0x011f, 0x0042,
-	0xff96, 0xff4f, 0xff2a, 0xfeb6, 0xfe7d, 0xfec1, 0xff4a, 0xffd4,
-	0x0044, 0x0060, 0x001e, 0xffe8, 0xff72, 0xff2e, 0xffa7, 0x004b,
-	0x008a, 0x0033, 0xff43, 0xfe66, 0xfe1d, 0xfe46, 0xff1b, 0x002c,
-	0x00e4, 0x00fb, 0x0049, 0xff5d, 0xfe8b, 0xfe7b, 0xff03, 0xff95,
-	0xffea, 0x0081, 0x00d7, 0x006a, 0x0015, 0xffd9, 0xff8b, 0xff37,
-	0xfec1, 0xfe65, 0xfeb7, 0xff3b, 0xff6a, 0xff8e, 0xff93, 0xff6e,
-	0xff1b, 0xfee3, 0xff0e, 0xffd0, 0x00a4, 0x00bf, 0x0038, 0xff71,
-	0xfe7b, 0xfd82, 0xfd52, 0xfe1c, 0xff32, 0x001f, 0x0074, 0x0029,
-	0xff75, 0xff22, 0xff1a, 0xff14, 0xff0f, 0xff20, 0xff5b, 0xff3b,
-	0xff04, 0xff28, 0xffd2, 0x0036, 0x003f, 0x003b, 0x0059, 0x0086,
-	0x007f, 0x002f, 0xffb8, 0xff03, 0xfe70, 0xfdf8, 0xfdfc, 0xff3e,
-	0x0065, 0x0099, 0x0052, 0xffc7, 0xfee6, 0xfe4f, 0xfeba, 0xff94,
-	0x0055, 0x00b3, 0x0049, 0xff15, 0xfe19, 0xfdf2, 0xfe75, 0xff6f,
-	0x0021, 0x007c, 0x00f9, 0x0106, 0x0099, 0x005c, 0x0055, 0x002e,
-	0xff7e, 0xfede, 0xfefe, 0xff86, 0x0055, 0x00dd, 0x0086, 0xfffd,
-	0xff24, 0xfe10, 0xfdc3, 0xfe89, 0xff81, 0xfff4, 0xffbb, 0xff22,
-	0xfe7b, 0xfe05, 0xfe3b, 0xfef7, 0xffac, 0x001a, 0x0026, 0xffa3,
-	0xff12, 0xfeb7, 0xfefb, 0xff2e, 0xff01, 0xff34, 0xffc0, 0x003e,
-	0x00aa, 0x00cd, 0x009d, 0x002d, 0xff76, 0xfeb2, 0xfe43, 0xfedb,
-	0xffb6, 0xffd0, 0xffb5, 0xff75, 0xff30, 0xff25, 0xff93, 0x008e,
-	0x017d, 0x01d0, 0x010b, 0xffb9, 0xfe90, 0xfdd5, 0xfd7b, 0xfdd2,
-	0xfedb, 0xff7c, 0xffdf, 0x0007, 0xffbb, 0xff81, 0xffc4, 0xffe8,
-	0xffe2, 0x0004, 0x000e, 0x000e, 0xffd3, 0xff8b, 0xff72, 0xff56,
-	0xff56, 0xff28, 0xff27, 0xffb6, 0x0073, 0x00a7, 0x0046, 0xffdb,
-	0xff79, 0xfed7, 0xfe7e, 0xff05, 0x0002, 0x00ea, 0x00fe, 0x0068,
-	0xff8d, 0xfeab, 0xfe35, 0xfe5d, 0xfef9, 0xff7b, 0xffa5, 0xff7a,
-	0xff0f, 0xfec8, 0xfecf, 0xff20, 0xff4f, 0xff69, 0xffaa, 0xffe6,
-	0x0015, 0x001c, 0x0013, 0x0004, 0xff75, 0xfe6b, 0xfdfd, 0xfe4c,
-	0xff60, 0x007d, 0x00aa, 0x0033, 0xffa4, 0xfecb, 0xfe13, 0xfe3c,
-	0xff29, 0xffe8, 0x0002, 0xffa6, 0xfee5, 0xfe44, 0xfe95, 0xffa1,
-	0x006a, 0x00ed, 0x00f4, 0x0030, 0xff51, 0xfeb1, 0xfec6, 0xfed7,
-	0xfecc, 0xfea8, 0xfe86, 0xff06, 0xffcc, 0x0038, 0x007f, 0x0080,
-	0x0023, 0xffa5, 0xff19, 0xff43, 0x000c, 0x004e, 0xffff, 0xff41,
-	0xfe57, 0xfe14, 0xfe59, 0xff1f, 0x0091, 0x017d, 0x018f, 0x00cf,
-	0xffd7, 0xff4c, 0xfef3, 0xfef4, 0xff2d, 0xff4e, 0xffb7, 0x001b,
-	0xfff1, 0xffd0, 0xffb8, 0xff8b, 0xff2c, 0xfeae, 0xfe81, 0xfea4,
-	0xff41, 0xffdd, 0x0004, 0xffa0, 0xff23, 0xfe98, 0xfe38, 0xfe96,
-	0xff7b, 0x0047, 0x003d, 0xffd2, 0xff96, 0xfefd, 0xfe81, 0xfe89,
-	0xff3d, 0x0041, 0x00ec, 0x0083, 0xffee, 0xff68, 0xff09, 0xff1e,
-	0xff25, 0xff59, 0xff8a, 0xff5c, 0xff38, 0xff0a, 0xfef4, 0xff65,
-	0xffd0, 0x000a, 0x0033, 0x003b, 0x004c, 0x005d, 0x002e, 0xffd3,
-	0xff46, 0xfea0, 0xfe0e, 0xfdec, 0xfeee, 0x002d, 0x008c, 0x0067,
-	0x001e, 0xffbc, 0xff61, 0xff4d, 0xffd6, 0x0087, 0x00b8, 0x004c,
-	0xff57, 0xfe59, 0xfe27, 0xfe7d, 0xff27, 0xffc0, 0x000b, 0x002f,
-	0xfff5, 0xffcb, 0xffec, 0xffe2, 0xff98, 0xff10, 0xfe6a, 0xfe6f,
-	0xff5f, 0x0058, 0x00d1, 0x00b3, 0x001e, 0xff6f, 0xfe7f, 0xfe2e,
-	0xff19, 0x0044, 0x00c1, 0x004a, 0xff12, 0xfe18, 0xfdc8, 0xfe13,
-	0xff33, 0x0028, 0x00bb, 0x0080, 0xffcd, 0xff2d, 0xfecf, 0xfed9,
-	0xfec7, 0xfea2, 0xfecf, 0xff15, 0xff53, 0xff9f, 0xffd2, 0xffbc,
-	0xff6f, 0xfeba, 0xfe32, 0xfe2c, 0xfeed, 0xffd5, 0x0026, 0xfff8,
-	0xffa8, 0xff7c, 0xff76, 0xffc2, 0x0035, 0x00f6, 0x0114, 0x0045,
-	0xff83, 0xfecc, 0xfe46, 0xfe3f, 0xfeae, 0xff2c, 0xffcc, 0xfff6,
-	0xffdd, 0xffa1, 0xffba, 0xffe5, 0xffbf, 0xffbb, 0xffaa, 0xffa2,
-	0xff6f, 0xff5c, 0xff0f, 0xfedc, 0xfed4, 0xfee1, 0xff12, 0xff72,
-	0x002e, 0x0121, 0x0191, 0x0137, 0x0076, 0xffa8, 0xfeb4, 0xfe29,
-	0xfe9d, 0xffc2, 0x00bd, 0x010b, 0x0076, 0xffa6, 0xff0b, 0xfe74,
-	0xfe8c, 0xff4a, 0xffef, 0x0037, 0xffca, 0xfecb, 0xfe3e, 0xfe1e,
-	0xfe50, 0xfeb1, 0xfec4, 0xff19, 0xff63, 0xff99, 0x0007, 0x0017,
-	0xffd1, 0xff5e, 0xfec2, 0xfe4e, 0xfe96, 0xff8c, 0x008c, 0x00ba,
-	0x0060, 0x0005, 0xff3d, 0xfe89, 0xfeec, 0xffd1, 0x0081, 0x0076,
-	0xffa8, 0xfed7, 0xfe90, 0xff1d, 0xffb4, 0x0044, 0x00e6, 0x00c6,
-	0x0006, 0xff3f, 0xfed4, 0xfeef, 0xff07, 0xfebf, 0xfe90, 0xfe88,
-	0xfed9, 0xffc7, 0x008e, 0x00e6, 0x00ac, 0xffbf, 0xff07, 0xfebf,
-	0xff08, 0x0000, 0x009f, 0x0070, 0xff9f, 0xfeb1, 0xfe4e, 0xfe66,
-	0xff18, 0x0062, 0x015f, 0x0180, 0x00ae, 0xffe0, 0xff1f, 0xfebc,
-	0xfe8b, 0xfe66, 0xfee7, 0xff88, 0xffea, 0xfff6, 0x0003, 0x001e,
-	0xffb3, 0xff1e, 0xfefd, 0xff1a, 0xff6c, 0xffe6, 0x0012, 0xff9f,
-	0xfed7, 0xfe49, 0xfe07, 0xfe20, 0xfec2, 0xffa6, 0x0085, 0x00dd,
-	0x0080, 0xffca, 0xff3b, 0xfe9f, 0xfe4f, 0xfe9f, 0xff6a, 0x0018,
-	0x0028, 0xffbe, 0xff6c, 0xfef9, 0xfe97, 0xfebe, 0xfef4, 0xff61,
-	0xffb2, 0xff7e, 0xff46, 0xff79, 0xffca, 0xffe2, 0xffa7, 0xffa2,
-	0xffad, 0xffb3, 0xfffc, 0x0027, 0xfff8, 0xff81, 0xfede, 0xfe30,
-	0xfddf, 0xfe78, 0xffc3, 0x00ca, 0x0119, 0x00ac, 0xffe6, 0xff32,
-	0xff30, 0xff92, 0x0041, 0x00c2, 0x006b, 0xff6d, 0xfe6c, 0xfe3d,
-	0xfeaa, 0xff4c, 0x0014, 0x00d3, 0x010a, 0x00bc, 0x0045, 0x0002,
-	0x000b, 0xff6c, 0xfe79, 0xfe1d, 0xfe33, 0xff0d, 0x0032, 0x00e7,
-	0x00f0, 0x001c, 0xff13, 0xfe77, 0xfe56, 0xfef2, 0x000e, 0x0091,
-	0x0023, 0xff22, 0xfe0a, 0xfd96, 0xfdcf, 0xfeb6, 0xffb2, 0x0039,
-	0x0088, 0x002d, 0xffee, 0x0010, 0x0008, 0xffb1, 0xff18, 0xfecd,
-	0xfefc, 0xff40, 0xff8e, 0x0024, 0x0052, 0xfff6, 0xff5c, 0xfea9,
-	0xfec5, 0xff3d, 0xffda, 0x004b, 0x004f, 0xffe1, 0xff69, 0xff0e,
-	0xff1e, 0xff8e, 0x0005, 0x007d, 0x005d, 0xffb2, 0xff3a, 0xfeb5,
-	0xfe82, 0xfebf, 0xff29, 0xfff6, 0x00c0, 0x00de, 0x007a, 0x0026,
-	0x0001, 0xffc2, 0xff6d, 0xff67, 0xff9c, 0xffaa, 0xff63, 0xff53,
-	0xff3d, 0xfeed, 0xfebb, 0xfedd, 0xff71, 0xffe4, 0x008a, 0x00f0,
-	0x00e8, 0x007b, 0xff4a, 0xfe23, 0xfd75, 0xfd7c, 0xfe97, 0xffd5,
-	0x007d, 0x0091, 0xfffe, 0xff86, 0xff86, 0xff99, 0xffed, 0x0042,
-	0x0074, 0x0023, 0xff27, 0xfe52, 0xfe5f, 0xfe99, 0xfed1, 0xff09,
-	0xff32, 0xff67, 0xffa0, 0x0011, 0x008a, 0x0054, 0xff73, 0xfe6d,
-	0xfdc2, 0xfdca, 0xfebe, 0xff99, 0x0028, 0x0025, 0xff84, 0xfe97,
-	0xfe08, 0xfe64, 0xff3f, 0x002f, 0x00ac, 0x0057, 0xff79, 0xfeeb,
-	0xff16, 0xffb3, 0x0009, 0x001c, 0x003b, 0xfff0, 0xffa1, 0xffaa,
-	0xffc0, 0xffbf, 0xff4a, 0xfea5, 0xfe93, 0xff21, 0xff9f, 0x0034,
-	0x00a1, 0x006e, 0xffc4, 0xfee3, 0xfe77, 0xfed0, 0xff82, 0x0039,
-	0x0035, 0xff93, 0xfef7, 0xfe94, 0xfedf, 0xffc7, 0x0088, 0x012c,
-	0x015c, 0x00fb, 0x0042, 0xff73, 0xfef7, 0xfed9, 0xfebd, 0xfef8,
-	0xffa0, 0x0024, 0x003b, 0x004d, 0x0066, 0x0040, 0xffb0, 0xff2b,
-	0xfed5, 0xff0e, 0xff65, 0xff41, 0xfeec, 0xfeaa, 0xfe46, 0xfdec,
-	0xfddd, 0xfe2e, 0xff16, 0x0024, 0x00f8, 0x016e, 0x00d1, 0xffc4,
-	0xfee3, 0xfe5c, 0xfe7f, 0xfef5, 0xff73, 0xffd0, 0xffe4, 0xff8d,
-	0xff6a, 0xffaa, 0xfff8, 0x0001, 0x0031, 0x006f, 0x001e, 0xff8f,
-	0xff95, 0xffcb, 0xffc5, 0xff82, 0xfefd, 0xfede, 0xff0f, 0xff8f,
-	0xffe8, 0xffea, 0xff9d, 0xff04, 0xfe5d, 0xfe85, 0xff66, 0x0054,
-	0x00ed, 0x00f2, 0x0078, 0xff69, 0xfea2, 0xfeab, 0xff29, 0xffce,
-	0x0037, 0xffef, 0xff36, 0xfe83, 0xfe55, 0xff0a, 0xffee, 0x002e,
-	0x0073, 0x009a, 0x0079, 0x004c, 0xfffc, 0xffaa, 0xff2a, 0xfe4b,
-	0xfdb2, 0xfde0, 0xfe9c, 0xff97, 0x007c, 0x00dd, 0x0084, 0xffbf,
-	0xff02, 0xfea8, 0xff4c, 0x0041, 0x0036, 0xffb7, 0xff0d, 0xfe50,
-	0xfdf2, 0xfe3b, 0xfef2, 0xff8c, 0x0008, 0x0065, 0x0056, 0xffed,
-	0xffb7, 0xffb0, 0xff72, 0xff00, 0xfe85, 0xfe61, 0xfecd, 0xff54,
-	0xffbe, 0xffef, 0xffb9, 0xff69, 0xfee8, 0xfef4, 0xffb4, 0x000a,
-	0x0019, 0x000a, 0xff97, 0xff27, 0xfeb0, 0xfe77, 0xfefa, 0xffca,
-	0x0031, 0x0032, 0xfff4, 0xff8f, 0xff0d, 0xfefb, 0xff37, 0xff91,
-	0xffee, 0x0017, 0x0011, 0xffd2, 0xff74, 0xff61, 0xff95, 0xffa7,
-	0xffb1, 0xfff1, 0xffea, 0xffbf, 0xffa3, 0xff90, 0xffc4, 0xffd5,
-	0xffaa, 0xffb3, 0x0007, 0x00b6, 0x0126, 0x00af, 0x0017, 0xff4e,
-	0xfe57, 0xfde1, 0xfe2f, 0xff4b, 0x0054, 0x00d6, 0x00b8, 0x0023,
-	0xff6a, 0xff13, 0xff16, 0xff5b, 0xffe0, 0xffbd, 0xff3b, 0xfea3,
-	0xfe28, 0xfe40, 0xfeba, 0xfec9, 0xfef9, 0xff82, 0x0001, 0x0079,
-	0x00d7, 0x00e2, 0x0085, 0xffca, 0xfec4, 0xfdbd, 0xfdb1, 0xfea6,
-	0xffb3, 0x003d, 0x0037, 0xffca, 0xff54, 0xfef2, 0xff32, 0x0023,
-	0x009d, 0x0094, 0x0009, 0xff41, 0xfea7, 0xfe88, 0xfede, 0xff79,
-	0xffbe, 0xffd2, 0xffc2, 0xff54, 0xff48, 0xffb2, 0x0003, 0xfffc,
-	0xffb4, 0xffae, 0xffec, 0x0047, 0x0091, 0x0086, 0x0003, 0xff88,
-	0xfee9, 0xfe6a, 0xfebb, 0xff98, 0x0040, 0x0030, 0xffa4, 0xfefe,
-	0xfe9a, 0xfe75, 0xfef0, 0xffef, 0x00b8, 0x00f6, 0x005e, 0xff9e,
-	0xfece, 0xfe47, 0xfe46, 0xfe42, 0xfe9c, 0xff43, 0xffd3, 0x0021,
-	0x004d, 0x0051, 0x003d, 0xfff6, 0xff96, 0xff60, 0xff57, 0xffb2,
-	0xffef, 0xffc3, 0xff6e, 0xfee2, 0xfe4d, 0xfe22, 0xfe74, 0xff6c,
-	0x009a, 0x00f8, 0x00a5, 0x0023, 0xff4d, 0xfe64, 0xfddb, 0xfdfd,
-	0xfebd, 0xff42, 0xff80, 0xff60, 0xfefe, 0xff16, 0xff92, 0xffc3,
-	0xfff5, 0x002e, 0x0022, 0xffcb, 0xff80, 0xff43, 0xff0e, 0xff02,
-	0xfeed, 0xfeec, 0xff1d, 0xffa0, 0xfff7, 0x0047, 0x004c, 0x0008,
-	0xff92, 0xfef4, 0xfecb, 0xff66, 0x001f, 0x005c, 0x0029, 0xff8a,
-	0xfee1, 0xfe79, 0xfe4c, 0xff04, 0xffdf, 0x0065, 0x0064, 0xffbe,
-	0xff34, 0xff07, 0xff4a, 0xffd6, 0x0038, 0x0071, 0x0091, 0x0039,
-	0xffce, 0xffbc, 0xffa0, 0xff39, 0xfec9, 0xfe89, 0xfed3, 0xff7e,
-	0x008c, 0x0158, 0x012b, 0x0079, 0xffb6, 0xfea5, 0xfe0a, 0xfe9a,
-	0xff75, 0xffdc, 0xffcc, 0xff0c, 0xfe1a, 0xfda5, 0xfdec, 0xfeaa,
-	0xff90, 0x005b, 0x00a0, 0x0040, 0x0004, 0xffe7, 0xff9d, 0xff1c,
-	0xfe86, 0xfe4e, 0xfe70, 0xfecf, 0xff48, 0xffc1, 0x0057, 0x0097,
-	0x001f, 0xffd7, 0xffda, 0x0009, 0x0079, 0x0093, 0x0029, 0xff6b,
-	0xfeb4, 0xfe3d, 0xfe38, 0xfebf, 0xff99, 0x0027, 0x0029, 0x0014,
-	0xffcf, 0xff84, 0xff8a, 0xffe1, 0x0022, 0x002b, 0x0017, 0xffbe,
-	0xff2a, 0xff11, 0xff49, 0xff37, 0xff14, 0xff62, 0xffc8, 0xfff3,
-	0xfffb, 0x0018, 0xffe3, 0xff9c, 0xff60, 0xfef0, 0xfeff, 0xffaa,
-	0x0057, 0x00a5, 0x0064, 0xffc7, 0xfee3, 0xfe02, 0xfdea, 0xfe70,
-	0xff54, 0x0063, 0x00ea, 0x00c4, 0x0055, 0xffcd, 0xff34, 0xff03,
-	0xff25, 0xff41, 0xff95, 0xffab, 0xff1e, 0xfe9f, 0xfe9f, 0xfec5,
-	0xfee0, 0xff18, 0xffa5, 0xfffe, 0x0026, 0x005f, 0x0059, 0x0003,
-	0xff44, 0xfe5e, 0xfdb6, 0xfdc5, 0xfe90, 0xff5c, 0xfff9, 0x0035,
-	0x0013, 0xff8e, 0xff18, 0xff56, 0x0000, 0x006c, 0x006f, 0x0001,
-	0xff08, 0xfe43, 0xfe2f, 0xfe85, 0xfee6, 0xff42, 0xff9c, 0xffb5,
-	0xff98, 0xffa3, 0xfffb, 0x0031, 0x0032, 0xffe0, 0xff60, 0xff35,
-	0xff42, 0xff98, 0xffea, 0xffeb, 0xff42, 0xfe7b, 0xfe69, 0xfef7,
-	0xffe3, 0x00be, 0x00ee, 0x007a, 0xffef, 0xff45, 0xfeb0, 0xff2d,
-	0xffd4, 0x005e, 0x0088, 0x0045, 0xff86, 0xfedc, 0xfeb5, 0xfeff,
-	0xff26, 0xff77, 0xfff1, 0x004d, 0x0068, 0x0064, 0x0040, 0xffed,
-	0xff6a, 0xfeb0, 0xfe74, 0xfeaf, 0xff13, 0xff6e, 0xffa1, 0xff76,
-	0xfee8, 0xfe6e, 0xfe59, 0xfeeb, 0xffe7, 0x00aa, 0x00eb, 0x009b,
-	0x003e, 0xff53, 0xfe63, 0xfe2e, 0xfe4b, 0xfe8d, 0xff3d, 0xffcd,
-	0x001f, 0x003f, 0x0054, 0x0064, 0x004b, 0x0012, 0xffeb, 0xfff7,
-	0xffcb, 0xff50, 0xff3e, 0xff37, 0xff09, 0xfec2, 0xfe96, 0xfebb,
-	0xff4b, 0xfff5, 0x006d, 0x00b6, 0x00aa, 0x004e, 0xff8e, 0xfeff,
-	0xff26, 0xff76, 0xffcb, 0x0003, 0xffb7, 0xfef3, 0xfe63, 0xfe5c,
-	0xfeec, 0xffc9, 0x0041, 0x0060, 0x002a, 0xff9d, 0xfedb, 0xfed2,
-	0xff38, 0xff64, 0xff8d, 0xffb3, 0xff83, 0xff14, 0xff29, 0xff5b,
-	0xff41, 0xfeff, 0xfeb6, 0xfe89, 0xff66, 0x00b3, 0x0149, 0x0148,
-	0x00c3, 0xffbb, 0xfe8e, 0xfdfe, 0xfe64, 0xff41, 0xffe6, 0x0025,
-	0xffa2, 0xfeb3, 0xfe2e, 0xfe52, 0xfefc, 0xffac, 0x0006, 0x001c,
-	0x000a, 0xffc5, 0xff6a, 0xff3d, 0xff17, 0xfe8a, 0xfe0e, 0xfe03,
-	0xfe5e, 0xff3c, 0x0004, 0x0082, 0x009f, 0x0049, 0xff88, 0xff21,
-	0xff43, 0xffba, 0x000b, 0xffd7, 0xff64, 0xfeb5, 0xfe2d, 0xfe1c,
-	0xfeb0, 0xffcb, 0x0061, 0x0083, 0x0085, 0x0051, 0xffd0, 0xffa4,
-	0xffbb, 0xff80, 0xff50, 0xff6b, 0xff57, 0xff05, 0xff01, 0xff24,
-	0xff66, 0xffbe, 0xfff1, 0xffe9, 0x0017, 0x0060, 0x0056, 0x0016,
-	0xffd3, 0xff6d, 0xfedd, 0xfedb, 0xff70, 0xffcf, 0x001a, 0x0042,
-	0x0009, 0xffaf, 0xff39, 0xfebb, 0xfed8, 0xffd3, 0x00bf, 0x0113,
-	0x00f1, 0x0072, 0xff67, 0xfe75, 0xfe5f, 0xfe9b, 0xfeeb, 0xff66,
-	0xffac, 0xff4a, 0xfeca, 0xfeb3, 0xff12, 0xff69, 0xff9b, 0xffa8,
-	0xffc7, 0xffee, 0x0011, 0x003a, 0x000a, 0xff66, 0xfe56, 0xfd6a,
-	0xfd5e, 0xfe7d, 0xffdf, 0x00bf, 0x0166, 0x014f, 0x0089, 0xffd4,
-	0xffbf, 0x0015, 0x003f, 0x0051, 0xffdf, 0xfeeb, 0xfe28, 0xfe15,
-	0xfe73, 0xff18, 0xff88, 0xffb2, 0xffce, 0xffe5, 0x0030, 0x0076,
-	0x00a8, 0x0082, 0xffa0, 0xfeda, 0xfe99, 0xfeb2, 0xff0d, 0xff7d,
-	0xff5b, 0xfefc, 0xfec8, 0xfe91, 0xfee2, 0xfff5, 0x00ee, 0x00e7,
-	0x005b, 0xffb6, 0xfec1, 0xfe20, 0xfe66, 0xff2e, 0xffc2, 0xffea,
-	0xffbe, 0xff6c, 0xff04, 0xfec0, 0xff01, 0xff7b, 0xffdf, 0x0011,
-	0x0046, 0x0073, 0x005f, 0x002d, 0xffcb, 0xff41, 0xfea7, 0xfe3f,
-	0xfe55, 0xff1c, 0xffbc, 0xffbf, 0xffb9, 0xff8d, 0xff36, 0xfebf,
-	0xfeae, 0xff56, 0x001c, 0x0079, 0x005d, 0xffce, 0xff1f, 0xfe3b,
-	0xfda7, 0xfe13, 0xfea9, 0xff19, 0xffb6, 0x002d, 0x0054, 0x0044,
-	0x0027, 0x0035, 0xfffb, 0xffb0, 0xff89, 0xff29, 0xfed2, 0xfee5,
-	0xfede, 0xfeb1, 0xfec2, 0xfeaf, 0xfece, 0xffa0, 0x0076, 0x00bc,
-	0x00c0, 0x00c1, 0x002f, 0xff49, 0xfe9b, 0xfe9d, 0xff36, 0xffcf,
-	0xffb8, 0xff6c, 0xff15, 0xfea3, 0xfecd, 0xff9f, 0x006c, 0x00f5,
-	0x00ef, 0x007b, 0xffc4, 0xfef8, 0xfee3, 0xff1a, 0xff4e, 0xffad,
-	0xffa2, 0xff7a, 0xff8a, 0xffb9, 0xffb6, 0xffdd, 0x000a, 0xffa7,
-	0xff5f, 0xffc9, 0x006f, 0x00ba, 0x008e, 0xffe2, 0xfef6, 0xfe0f,
-	0xfdbb, 0xfe38, 0xff65, 0x0019, 0x0011, 0xffaf, 0xff48, 0xfee8,
-	0xfeab, 0xff0c, 0xffae, 0x0006, 0x0028, 0xffe8, 0xff86, 0xff44,
-	0xfefc, 0xfea1, 0xfe86, 0xfe58, 0xfe7c, 0xff5f, 0x0032, 0x0118,
-	0x0193, 0x0125, 0x0072, 0xffd6, 0xff3a, 0xff0f, 0xff91, 0xffcf,
-	0xffcf, 0xff52, 0xfed7, 0xfe7e, 0xfe19, 0xfeba, 0xffe7, 0x00a1,
-	0x00ef, 0x00b2, 0x0068, 0x0011, 0xffc6, 0xff8a, 0xff43, 0xff44,
-	0xff01, 0xfeb3, 0xfeb9, 0xfeec, 0xff15, 0xff55, 0xffdc, 0xffe6,
-	0xffdd, 0x0010, 0x0015, 0xffe8, 0xff65, 0xfee3, 0xfe7e, 0xfe29,
-	0xfe49, 0xfebc, 0xff5d, 0x0009, 0x0010, 0xffaa, 0xff65, 0xff31,
-	0xfec2, 0xfed5, 0xffb5, 0x00ad, 0x00ff, 0x00b0, 0x0033, 0xff29,
-	0xfe6d, 0xfe3f, 0xfe74, 0xff75, 0x013c, 0x0338, 0x0231, 0xff2d,
-	0xfe19, 0xfdb4, 0xfd32, 0xfd5a, 0xfda7, 0xfde3, 0xfe8c, 0xff35,
-	0xff68, 0xff51, 0xfede, 0xfe2e, 0xfd60, 0xfd88, 0xfedc, 0x0023,
-	0x0106, 0x015e, 0x00f0, 0x004e, 0xffbe, 0xff1d, 0xfea2, 0xfe37,
-	0xfebe, 0x00a4, 0x024a, 0x01dd, 0x000b, 0xff22, 0xff64, 0xff46,
-	0xfe6b, 0xfdfb, 0xfee4, 0x0210, 0x0455, 0x02c7, 0x002c, 0xfe85,
-	0xfdd3, 0xfda5, 0xfdcb, 0xfe8b, 0xff3a, 0xff45, 0xff4d, 0xff7c,
-	0xff0e, 0xff3e, 0x000f, 0x008d, 0x008b, 0xffca, 0xff07, 0xfe79,
-	0xfe9a, 0xfef4, 0xff4d, 0xffe6, 0x0031, 0x002d, 0xff92, 0xfea9,
-	0xfe8f, 0xfff4, 0x01eb, 0x029f, 0x018c, 0x0059, 0xffe1, 0xffca,
-	0xff2f, 0xfd9e, 0xfccd, 0xfe0e, 0x00b0, 0x0199, 0x0091, 0xffd9,
-	0xff8d, 0xff5e, 0xfe98, 0xfdd8, 0xfdb1, 0xfdeb, 0xfeb9, 0xffc8,
-	0x0046, 0xffec, 0xffa9, 0xff04, 0xfe10, 0xfd54, 0xfd50, 0xfe7d,
-	0x0030, 0x01c1, 0x021c, 0x018e, 0x0105, 0x009f, 0xffe2, 0xfee9,
-	0xfe4d, 0xfe64, 0xff9d, 0x011f, 0x0126, 0x0002, 0xff3b, 0xfef1,
-	0xfea6, 0xfe46, 0xfe02, 0xfee0, 0x0124, 0x031a, 0x027e, 0x005d,
-	0xfe8f, 0xfdc6, 0xfe03, 0xfe1a, 0xfe52, 0xfea4, 0xff12, 0xffcb,
-	0xffeb, 0xffb6, 0xffe7, 0x0031, 0x003c, 0x000f, 0xff04, 0xfdfb,
-	0xfe67, 0xff7e, 0x001b, 0x0004, 0xffbd, 0xff77, 0xff5d, 0xff7b,
-	0xff74, 0xff2f, 0xff7f, 0x0092, 0x00fc, 0x0083, 0xffb4, 0xffb3,
-	0x001d, 0xffb9, 0xfe89, 0xfd39, 0xfcf7, 0xfe6d, 0x0001, 0x008e,
-	0x0098, 0x004b, 0xfff5, 0xff43, 0xfe56, 0xfdd2, 0xfdcf, 0xfebf,
-	0x001e, 0x009a, 0x004d, 0xfff2, 0xff8d, 0xff07, 0xfe7a, 0xfd9c,
-	0xfdb3, 0xfeee, 0x0048, 0x0136, 0x018e, 0x0186, 0x00c8, 0xffd5,
-	0xfee5, 0xfd7a, 0xfd05, 0xfe90, 0x0044, 0x00c1, 0x0048, 0xff3f,
-	0xfe9e, 0xfe97, 0xfe9f, 0xfea9, 0xff18, 0x001f, 0x012d, 0x0169,
-	0x00b6, 0xff9f, 0xfed4, 0xfeaa, 0xfe5d, 0xfdec, 0xfdbb, 0xfe5e,
-	0x0006, 0x0176, 0x01b5, 0x0110, 0x005f, 0x0024, 0xffbd, 0xff03,
-	0xfeb9, 0xfee0, 0xff79, 0xfffb, 0xff94, 0xfed5, 0xfec8, 0xff6d,
-	0x004b, 0x005f, 0xff9d, 0xff2e, 0xff98, 0x0039, 0x006b, 0x001c,
-	0xfffb, 0x0023, 0xffef, 0xfef9, 0xfdc4, 0xfd52, 0xfe15, 0xff75,
-	0x0085, 0x00a7, 0x0044, 0x0006, 0xffe3, 0xff84, 0xfea1, 0xfdf3,
-	0xfe5d, 0xff76, 0x002e, 0x0029, 0x0012, 0xffeb, 0xffa6, 0xfeda,
-	0xfdc3, 0xfd1a, 0xfdb3, 0xff95, 0x015f, 0x021d, 0x01bd, 0x00d2,
-	0xfff1, 0xfecb, 0xfde7, 0xfdd4, 0xfe7a, 0xffc3, 0x00c4, 0x0090,
-	0xff9d, 0xff22, 0xff4b, 0xff44, 0xfefb, 0xfedd, 0xff1a, 0x0005,
-	0x0138, 0x01ba, 0x00e4, 0xffbb, 0xfece, 0xfdea, 0xfd29, 0xfd13,
-	0xfdf0, 0xffb7, 0x0166, 0x01b7, 0x00d0, 0xffe9, 0xff99, 0xff8a,
-	0xff7d, 0xfef4, 0xfe5e, 0xfe7e, 0xfedc, 0xfee4, 0xfed5, 0xff15,
-	0xff9b, 0x000b, 0xffe2, 0xff3c, 0xfe8e, 0xff18, 0x0040, 0x00f1,
-	0x007d, 0xffd8, 0xff85, 0xff5c, 0xff1c, 0xfe97, 0xfe2c, 0xfe50,
-	0xff25, 0xfffa, 0x0046, 0x0028, 0x0061, 0x00da, 0x0070, 0xff1f,
-	0xfdc1, 0xfd52, 0xfe3b, 0xffdd, 0x00c4, 0x00a2, 0x002a, 0xffa8,
-	0xfeda, 0xfdb2, 0xfd36, 0xfd9a, 0xfef3, 0x00bc, 0x01a8, 0x014d,
-	0x00a4, 0x0045, 0xffe1, 0xff1e, 0xfe15, 0xfd84, 0xfde4, 0xff19,
-	0x0026, 0x0056, 0x0042, 0x000b, 0xffa1, 0xff1f, 0xfe8b, 0xfe5c,
-	0xff45, 0x00ca, 0x01bd, 0x0163, 0x0015, 0xfee8, 0xfdf6, 0xfd8f,
-	0xfd9a, 0xfdef, 0xfedf, 0x0048, 0x010e, 0x0110, 0x00a2, 0x005a,
-	0x006d, 0x000f, 0xff64, 0xfe78, 0xfde6, 0xfe70, 0xff66, 0xffb5,
-	0xff76, 0xff62, 0xffbb, 0xffd9, 0xff8a, 0xff7f, 0xffc8, 0x004e,
-	0x00eb, 0x0087, 0xff9f, 0xff35, 0xff8b, 0xffd6, 0xff79, 0xfea0,
-	0xfdec, 0xfde7, 0xff01, 0x001f, 0x006a, 0x00a3, 0x00cd, 0x005c,
-	0xff3b, 0xfdce, 0xfd17, 0xfdc7, 0xff40, 0x0062, 0x004a, 0xffc6,
-	0xff97, 0xff6f, 0xff28, 0xfea5, 0xfdd7, 0xfde9, 0xff22, 0x0051,
-	0x00e9, 0x0112, 0x012c, 0x00e0, 0xfff1, 0xfe85, 0xfd3a, 0xfd1f,
-	0xfebb, 0x008d, 0x0133, 0x00d1, 0x0028, 0xffb3, 0xff4b, 0xff02,
-	0xfec8, 0xff0d, 0x0002, 0x010b, 0x00ee, 0x000c, 0xff4b, 0xfedb,
-	0xfe8b, 0xfdf9, 0xfd9f, 0xfdd8, 0xfedd, 0x0092, 0x01b7, 0x0188,
-	0x00c3, 0x000b, 0xff72, 0xfee4, 0xfe46, 0xfdfb, 0xfe66, 0xff36,
-	0xff9d, 0xff57, 0xfef1, 0xff3a, 0xffc3, 0x0004, 0xffe6, 0xff86,
-	0xff7a, 0xffe9, 0x0024, 0x0001, 0xffe3, 0xffdb, 0xffc3, 0xff5e,
-	0xfe75, 0xfd8d, 0xfdad, 0xfee3, 0x0036, 0x00b3, 0x00c8, 0x00b4,
-	0x0053, 0xffb7, 0xfee5, 0xfe10, 0xfde9, 0xfe9f, 0xff74, 0xffbb,
-	0xffb7, 0xfff1, 0x0037, 0x0022, 0xff3e, 0xfdff, 0xfd55, 0xfe04,
-	0xff94, 0x00e5, 0x0152, 0x0137, 0x00b6, 0xffd5, 0xfe62, 0xfd5c,
-	0xfd42, 0xfe51, 0xffdc, 0x00a4, 0x0062, 0xffcb, 0xffb4, 0xfff1,
-	0xffc8, 0xfefc, 0xfe96, 0xfee3, 0xffcb, 0x0097, 0x00a0, 0x002e,
-	0xffa6, 0xfeec, 0xfe07, 0xfd4d, 0xfd45, 0xfea4, 0x009f, 0x01e6,
-	0x01fa, 0x0118, 0x003f, 0xffc6, 0xff96, 0xff49, 0xfebf, 0xfe6e,
-	0xfe8a, 0xfed2, 0xfee8, 0xff13, 0xffa7, 0x006b, 0x00b8, 0x006a,
-	0xff87, 0xff13, 0xff98, 0x0060, 0x009a, 0x001f, 0xff66, 0xff59,
-	0xff2f, 0xfe9d, 0xfe67, 0xfe5a, 0xfee8, 0xffb1, 0x000d, 0x001b,
-	0x0032, 0x00a1, 0x00de, 0x0012, 0xfe9a, 0xfdaa, 0xfd7a, 0xfe45,
-	0xff71, 0x0000, 0x003a, 0x005c, 0x002e, 0xff76, 0xfe6d, 0xfe09,
-	0xfe7c, 0xff94, 0x0086, 0x00bd, 0x008c, 0x0058, 0x002a, 0xffa7,
-	0xfea5, 0xfdb9, 0xfdbc, 0xfec4, 0xfff1, 0x0089, 0x0092, 0x00bd,
-	0x00b6, 0x000a, 0xff18, 0xfe31, 0xfe2c, 0xff5c, 0x00a7, 0x00fa,
-	0x007e, 0xffb5, 0xff11, 0xfe58, 0xfd98, 0xfd9e, 0xfe71, 0xffb6,
-	0x011e, 0x015b, 0x00a3, 0x0029, 0x001f, 0x0012, 0xff7d, 0xfe93,
-	0xfdeb, 0xfdbc, 0xfe52, 0xff35, 0xff8b, 0xff8a, 0xfff6, 0x002b,
-	0xffd4, 0xff6a, 0xff4f, 0xffd9, 0x007c, 0x00b1, 0xffd9, 0xfed8,
-	0xfeb1, 0xff19, 0xff63, 0xff25, 0xfe97, 0xfe6f, 0xff04, 0xffda,
-	0x0058, 0x00b0, 0x0117, 0x0132, 0x0045, 0xfed5, 0xfd8b, 0xfd34,
-	0xfe4e, 0xff85, 0xffe2, 0xffe2, 0x0001, 0x0006, 0xffda, 0xff84,
-	0xff0a, 0xfe9b, 0xfebc, 0xff6b, 0xffd7, 0x0003, 0x0067, 0x00c2,
-	0x0060, 0xff33, 0xfdc3, 0xfcee, 0xfd88, 0xff54, 0x00de, 0x0145,
-	0x0113, 0x00af, 0x0009, 0xff1a, 0xfe52, 0xfe5c, 0xff23, 0x0020,
-	0x00a6, 0x002f, 0xff84, 0xff74, 0xff68, 0xfede, 0xfe3b, 0xfe0f,
-	0xfeb5, 0x000b, 0x0104, 0x016e, 0x016a, 0x00ea, 0x0046, 0xff60,
-	0xfe69, 0xfdfb, 0xfe15, 0xfeee, 0xffc0, 0xffb2, 0xff6d, 0xffa1,
-	0xffe3, 0x0050, 0x0089, 0x002b, 0xffef, 0x0011, 0x0025, 0xffe0,
-	0xff62, 0xff52, 0xff88, 0xff63, 0xff12, 0xfe5c, 0xfdf3, 0xfead,
-	0xfff9, 0x00d1, 0x00d0, 0x00cb, 0x00bc, 0x0041, 0xff4e, 0xfe4b,
-	0xfdd6, 0xfe0f, 0xfe9b, 0xff10, 0xff54, 0xffa5, 0x0048, 0x00c7,
-	0x007b, 0xffab, 0xfea0, 0xfe0e, 0xfe7f, 0xff6a, 0x0051, 0x00ba,
-	0x00b2, 0x005c, 0xff7f, 0xfe36, 0xfd8b, 0xfddd, 0xff35, 0x00a6,
-	0x0126, 0x00e6, 0x006b, 0x000c, 0xffd8, 0xff6b, 0xfeb3, 0xfe82,
-	0xff13, 0xffc7, 0xfffe, 0xfffd, 0x001e, 0xffdf, 0xff08, 0xfe00,
-	0xfd65, 0xfdb4, 0xff41, 0x00db, 0x018a, 0x0159, 0x009e, 0xffda,
-	0xff0f, 0xfea4, 0xfe80, 0xfe3e, 0xfe7d, 0xfef1, 0xff00, 0xff07,
-	0xff54, 0xffeb, 0x0082, 0x0049, 0xffcd, 0xff45, 0xff00, 0xffa0,
-	0x002b, 0x001b, 0xff9e, 0xff26, 0xfee6, 0xfeb1, 0xfe44, 0xfe4a,
-	0xff0f, 0xffe3, 0x007c, 0x004a, 0xffef, 0x0036, 0x0078, 0x003e,
-	0xff58, 0xfe30, 0xfd7f, 0xfd96, 0xfe4d, 0xff3e, 0x0007, 0x00cd,
-	0x012e, 0x00c4, 0xffe0, 0xfeae, 0xfe32, 0xfe97, 0xff70, 0xfffc,
-	0x0005, 0xfff6, 0xffd5, 0xff6c, 0xfedf, 0xfe62, 0xfded, 0xfe4b,
-	0xff84, 0x0080, 0x00e7, 0x0108, 0x00e5, 0x0077, 0xff79, 0xfe3c,
-	0xfd9b, 0xfdf8, 0xff48, 0x0086, 0x00bb, 0x0077, 0x0000, 0xff57,
-	0xfe58, 0xfdff, 0xfe4b, 0xff30, 0x007f, 0x012f, 0x013e, 0x00a7,
-	0x0035, 0x0006, 0xff9e, 0xfef0, 0xfe5f, 0xfe0b, 0xfe42, 0xfefc,
-	0xffac, 0x0017, 0x0077, 0x007b, 0x001c, 0xffc2, 0xff74, 0xff7c,
-	0x0005, 0x0085, 0x0056, 0xff81, 0xfeb6, 0xfe98, 0xfeda, 0xff05,
-	0xff23, 0xff0d, 0xff5c, 0xffeb, 0x0006, 0x0015, 0x00b2, 0x0120,
-	0x00a9, 0xff9d, 0xfe36, 0xfd28, 0xfd4c, 0xfe59, 0xff57, 0xffdb,
-	0x0048, 0x00c3, 0x0096, 0x0033, 0xffcc, 0xff3d, 0xfec6, 0xfefc,
-	0xff2f, 0xff54, 0xffb4, 0x002d, 0x0033, 0xffbf, 0xfeda, 0xfdcc,
-	0xfd75, 0xfea0, 0x004f, 0x0152, 0x019d, 0x0158, 0x009a, 0xff8f,
-	0xfe82, 0xfdfe, 0xfe12, 0xff13, 0x001f, 0x0046, 0x0005, 0xffd8,
-	0xff9a, 0xff65, 0xfeee, 0xfe59, 0xfe37, 0xfed7, 0xfff4, 0x008a,
-	0x00d6, 0x00e4, 0x0072, 0xff82, 0xfea3, 0xfdea, 0xfd92, 0xfe1d,
-	0xff24, 0xffbf, 0xffec, 0xffe2, 0xffb6, 0xff81, 0xffbb, 0xffe2,
-	0xffa2, 0xffa8, 0xfff1, 0xffda, 0xff6c, 0xff1b, 0xff10, 0xff2b,
-	0xff21, 0xfef7, 0xfe7b, 0xfea6, 0xff93, 0x0053, 0x0097, 0x00b1,
-	0x0097, 0x0044, 0xff94, 0xfe9a, 0xfddc, 0xfdaa, 0xfe33, 0xfecb,
-	0xff15, 0xffa5, 0x005f, 0x00f8, 0x0147, 0x00be, 0xff9e, 0xfe8c,
-	0xfe11, 0xfe33, 0xfedb, 0xffa9, 0x002b, 0x0037, 0xffb7, 0xfecc,
-	0xfdbd, 0xfd82, 0xfe7b, 0x0004, 0x011c, 0x017a, 0x0132, 0x008e,
-	0x0003, 0xff6c, 0xfe81, 0xfdef, 0xfe2c, 0xfeec, 0xffa2, 0xfffa,
-	0x005a, 0x009c, 0x006c, 0xffad, 0xfe99, 0xfde4, 0xfe65, 0xffd7,
-	0x00e2, 0x016c, 0x0147, 0x0070, 0xff8e, 0xfed0, 0xfe35, 0xfe1d,
-	0xfe5a, 0xff0f, 0xffb0, 0xffd0, 0xffe3, 0xfffc, 0x0033, 0x006e,
-	0x0046, 0xffb5, 0xff50, 0xff69, 0xffc3, 0xfff1, 0xffdf, 0xff67,
-	0xff06, 0xfee5, 0xfea4, 0xfe7c, 0xfef0, 0xffe3, 0x0088, 0x00ae,
-	0x0042, 0xfffa, 0xffe7, 0xfff5, 0xffb9, 0xfec2, 0xfde4, 0xfd8f,
-	0xfd90, 0xfe36, 0xff4f, 0x0076, 0x014f, 0x0191, 0x00fa, 0xffd2,
-	0xfebf, 0xfe49, 0xfea6, 0xff29, 0xff82, 0xffb7, 0xff9c, 0xff60,
-	0xff2b, 0xfecc, 0xfe7d, 0xfea3, 0xff47, 0x001e, 0x00ba, 0x00f2,
-	0x0100, 0x00ca, 0x0024, 0xff01, 0xfdbc, 0xfd29, 0xfde0, 0xff2d,
-	0x0038, 0x00b0, 0x00ab, 0x0054, 0xffc7, 0xfecc, 0xfe23, 0xfe5d,
-	0xff21, 0x000e, 0x0096, 0x0096, 0x0028, 0xffcb, 0xff9b, 0xff02,
-	0xfe4e, 0xfe05, 0xfe47, 0xfedb, 0xffac, 0x0028, 0x003c, 0x0030,
-	0xfff0, 0xff8b, 0xff04, 0xfeb9, 0xff22, 0xffba, 0x0054, 0x001a,
-	0xff43, 0xfea8, 0xfe96, 0xfee2, 0xff38, 0xff4f, 0xff9a, 0x0000,
-	0x0016, 0xfffb, 0xffbf, 0xffe8, 0x0033, 0xfff7, 0xff2d, 0xfe18,
-	0xfd42, 0xfd80, 0xfe8c, 0xff98, 0x0051, 0x00ea, 0x0145, 0x0118,
-	0x0078, 0xffd3, 0xff3f, 0xfee4, 0xfede, 0xfecf, 0xfee2, 0xff02,
-	0xff57, 0xffbc, 0xff9e, 0xff20, 0xfe87, 0xfe54, 0xff38, 0x0071,
-	0x0169, 0x01b7, 0x0146, 0x0099, 0xff2c, 0xfdd0, 0xfd4b, 0xfdb8,
-	0xfede, 0x0004, 0x007d, 0x007c, 0x0078, 0x0046, 0x0003, 0xff91,
-	0xfeeb, 0xfeb3, 0xff33, 0xffd9, 0x0057, 0x00d1, 0x0107, 0x0090,
-	0xff98, 0xfe7c, 0xfdbe, 0xfddb, 0xfece, 0xffea, 0x0062, 0x0054,
-	0x0013, 0xff9c, 0xff4e, 0xff85, 0xffa1, 0xffbd, 0x0000, 0x001d,
-	0xffe1, 0xff6c, 0xff2e, 0xff4d, 0xff7c, 0xff77, 0xff36, 0xfef4,
-	0xff2e, 0xffbd, 0x003b, 0x0055, 0x0030, 0x0015, 0xffe7, 0xff5a,
-	0xfe94, 0xfdf4, 0xfdfa, 0xfe71, 0xfee2, 0xff66, 0xffee, 0x0099,
-	0x0146, 0x013b, 0x0086, 0xff80, 0xfe87, 0xfe27, 0xfe2c, 0xfe91,
-	0xff39, 0xffd0, 0xfffe, 0xffdc, 0xff43, 0xfe67, 0xfe48, 0xfefe,
-	0x0011, 0x00c9, 0x00ee, 0x00cb, 0x004f, 0xff8c, 0xfed4, 0xfe1d,
-	0xfdb5, 0xfe2d, 0xfeec, 0xff9c, 0x004a, 0x00ca, 0x0101, 0x00a7,
-	0xffec, 0xfeac, 0xfdbe, 0xfdf7, 0xff07, 0x000d, 0x00be, 0x00cf,
-	0x004e, 0xff73, 0xfe88, 0xfe09, 0xfe3d, 0xfef2, 0xffce, 0x0006,
-	0x000a, 0xffa7, 0xff4a, 0xff7a, 0xff9c, 0xff6d, 0xff33, 0xff2a,
-	0xff6c, 0xffbb, 0xffe7, 0xffee, 0xffb9, 0xff61, 0xff0b, 0xfeca,
-	0xfebd, 0xff54, 0x0003, 0x0064, 0x005d, 0xffeb, 0xff8a, 0xff70,
-	0xff89, 0xff6d, 0xfed5, 0xfe4a, 0xfe1c, 0xfe3e, 0xfeb1, 0xff9e,
-	0x00bf, 0x0193, 0x0185, 0x00cb, 0xffa1, 0xfe93, 0xfe4f, 0xfe96,
-	0xfefb, 0xff2b, 0xff1d, 0xff32, 0xff58, 0xff54, 0xff0f, 0xfef9,
-	0xff4a, 0xffc8, 0x001a, 0x006a, 0x00c1, 0x00e0, 0x0087, 0xffbf,
-	0xfe9a, 0xfd8c, 0xfd6c, 0xfe19, 0xff7a, 0x00ad, 0x012b, 0x014b,
-	0x00ea, 0x0011, 0xfee3, 0xfe29, 0xfe62, 0xff2a, 0x0018, 0x0091,
-	0x0094, 0x0049, 0xffec, 0xff9e, 0xff06, 0xfe85, 0xfe7a, 0xfee0,
-	0xffa9, 0x0022, 0x001d, 0x001e, 0x001e, 0xffcc, 0xff3c, 0xfeb1,
-	0xfed0, 0xff9d, 0x004a, 0x0095, 0x005b, 0xffd5, 0xff50, 0xfefe,
-	0xff0f, 0xff38, 0xff69, 0xffad, 0x0002, 0x0010, 0xffbd, 0xffb5,
-	0x001b, 0x0032, 0xfff0, 0xff0b, 0xfe05, 0xfdae, 0xfdf7, 0xfef3,
-	0xffcb, 0x005a, 0x00d0, 0x00e5, 0x008a, 0xffdb, 0xff5e, 0xff03,
-	0xff0d, 0xff1e, 0xfec8, 0xfe99, 0xfef5, 0xffa8, 0x000b, 0xffc4,
-	0xff49, 0xfeeb, 0xfee8, 0xff68, 0x0038, 0x00d0, 0x0124, 0x00be,
-	0xffbd, 0xfe84, 0xfd56, 0xfd11, 0xfdee, 0xff42, 0x0028, 0x0094,
-	0x00db, 0x00e4, 0x006a, 0xffe9, 0xfefa, 0xfe43, 0xfe29, 0xfe93,
-	0xff6a, 0xfff4, 0x0057, 0x008b, 0x0038, 0xff84, 0xfe76, 0xfde0,
-	0xfe88, 0xffb5, 0x0068, 0x0073, 0x0024, 0xffc0, 0xff55, 0xfed0,
-	0xfea0, 0xfee8, 0xff68, 0xffe0, 0x0018, 0xffe9, 0xff8b, 0xff6f,
-	0xff83, 0xff82, 0xff3e, 0xfef1, 0xfee8, 0xff4b, 0xffc3, 0xfff8,
-	0x0003, 0x0008, 0x000b, 0xff9a, 0xfed0, 0xfe46, 0xfe24, 0xfe63,
-	0xff24, 0xffa8, 0xffdb, 0x0022, 0x0071, 0x00c9, 0x00ae, 0xfff1,
-	0xff39, 0xfef7, 0xfea9, 0xfe5e, 0xfe69, 0xff17, 0xffd9, 0x0002,
-	0xffaf, 0xff22, 0xfe92, 0xfebd, 0xff98, 0x005f, 0x00d5, 0x00fe,
-	0x00a9, 0x0014, 0xff42, 0xfe59, 0xfdd3, 0xfdf0, 0xfe95, 0xff46,
-	0xffce, 0x008f, 0x0135, 0x015e, 0x00e1, 0xffc3, 0xfe9a, 0xfdf9,
-	0xfe45, 0xff5b, 0x0064, 0x00d2, 0x00ba, 0x0047, 0xff80, 0xfe73,
-	0xfdfc, 0xfeb9, 0xffcc, 0x0055, 0x0053, 0xffd9, 0xff9d, 0xff87,
-	0xff79, 0xff59, 0xff16, 0xff06, 0xff45, 0xff8d, 0xffdb, 0x002e,
-	0x004b, 0x0035, 0xffbc, 0xfeea, 0xfe3f, 0xfe52, 0xff18, 0xffe7,
-	0x003a, 0x003a, 0x0011, 0xffc3, 0xff7c, 0xff61, 0xff1e, 0xfeb6,
-	0xfe89, 0xfeae, 0xff00, 0xff3d, 0xffd6, 0x008d, 0x0104, 0x00c0,
-	0xffc9, 0xfeee, 0xfe87, 0xfea2, 0xfee3, 0xfef3, 0xff09, 0xff51,
-	0xff96, 0xffa6, 0xff81, 0xff44, 0xff58, 0xff8e, 0xffa9, 0xffd8,
-	0xffe7, 0x0023, 0x0068, 0x000e, 0xff12, 0xfe0e, 0xfd84, 0xfdb1,
-	0xfe6d, 0xff9b, 0x00cb, 0x0175, 0x0174, 0x00db, 0xffbe, 0xfe7a,
-	0xfdd5, 0xfe16, 0xfefe, 0xffe3, 0x0026, 0x0025, 0x0010, 0xffe6,
-	0xff6d, 0xfedf, 0xfec2, 0xff1e, 0xff9e, 0xffdb, 0xfff0, 0x0004,
-	0xffec, 0xffc4, 0xff49, 0xfe8c, 0xfe2b, 0xfe95, 0xff84, 0x0043,
-	0x008f, 0x0073, 0x0042, 0xffbf, 0xfef2, 0xfe97, 0xfeb4, 0xff37,
-	0xffaa, 0xffe1, 0xfff0, 0xffbf, 0xffaa, 0xffe7, 0xfff7, 0xff91,
-	0xfef3, 0xfe66, 0xfe6c, 0xfef4, 0xff99, 0xfffa, 0x0058, 0x00a1,
-	0x006c, 0xffc1, 0xff30, 0xff1a, 0xff40, 0xff5b, 0xff22, 0xfeb5,
-	0xfe8b, 0xff2d, 0xffd6, 0x0012, 0xfffb, 0xff9d, 0xff52, 0xff4c,
-	0xff98, 0xfffc, 0x00a3, 0x012a, 0x009e, 0xff65, 0xfe2b, 0xfd4e,
-	0xfd7d, 0xfe7f, 0xffbd, 0x009f, 0x00f9, 0x0104, 0x00d0, 0x003c,
-	0xffa9, 0xfeea, 0xfe5f, 0xfea6, 0xff1a, 0xff6c, 0xffeb, 0x0057,
-	0x00a5, 0x0043, 0xff45, 0xfe80, 0xfe49, 0xfec9, 0xffc9, 0x0052,
-	0x0059, 0x0017, 0xffc5, 0xff33, 0xfe8c, 0xfe57, 0xfecc, 0xff8f,
-	0x002b, 0x004e, 0x0030, 0x0014, 0xfff8, 0xffb5, 0xff43, 0xfed5,
-	0xfea3, 0xfebd, 0xff3e, 0xffdc, 0x000e, 0x0008, 0x0013, 0xffc8,
-	0xff34, 0xfeb3, 0xfe6e, 0xfec8, 0xff64, 0xffae, 0xffc0, 0xffc8,
-	0xffe3, 0x0015, 0xfffc, 0x0015, 0xffc8, 0xff36, 0xff1c, 0xfec4,
-	0xfe51, 0xfea1, 0xff72, 0x0009, 0x0027, 0xffca, 0xff23, 0xfee2,
-	0xff14, 0xffaa, 0x0009, 0x0059, 0x00b5, 0x006f, 0xffa8, 0xfeb5,
-	0xfdeb, 0xfdc3, 0xfe15, 0xfeb8, 0xff76, 0xfff6, 0x00a5, 0x014f,
-	0x013e, 0x0094, 0xff4e, 0xfe46, 0xfdde, 0xfe1d, 0xfeff, 0xffd6,
-	0x0063, 0x00b1, 0x005a, 0xff76, 0xfea8, 0xfe43, 0xfeef, 0xffe0,
-	0x003a, 0x0027, 0xffdc, 0xffa4, 0xff97, 0xff5b, 0xfee7, 0xfea6,
-	0xfed1, 0xff39, 0xffb0, 0xfffc, 0x0082, 0x00c3, 0x0053, 0xff9d,
-	0xfe9c, 0xfddb, 0xfe13, 0xff0f, 0x0005, 0x004d, 0x0037, 0xffef,
-	0xff6e, 0xff1b, 0xff0a, 0xff0d, 0xff2c, 0xff59, 0xff4a, 0xff29,
-	0xff51, 0xffb4, 0x004c, 0x009e, 0x004d, 0xff87, 0xfecc, 0xfeae,
-	0xfec5, 0xfef6, 0xff2e, 0xff6a, 0xffb4, 0xffdf, 0xff80, 0xff45,
-	0xff71, 0xffa1, 0xffe4, 0xffea, 0xffde, 0xfff5, 0x0028, 0x0040,
-	0xffea, 0xfeef, 0xfe0c, 0xfdce, 0xfe01, 0xfec2, 0xffcc, 0x00e4,
-	0x0199, 0x018b, 0x00ec, 0xffc4, 0xfe9d, 0xfe42, 0xfe8a, 0xff0a,
-	0xffa9, 0xffed, 0x0000, 0x0000, 0xffe4, 0xff98, 0xfef6, 0xfecb,
-	0xff31, 0xff92, 0xffcd, 0xffe6, 0x000c, 0x0044, 0xfff7, 0xff20,
-	0xfe47, 0xfe04, 0xfe8a, 0xff91, 0x0064, 0x00dd, 0x00d9, 0x0075,
-	0xfff7, 0xfeea, 0xfe2a, 0xfe50, 0xfed9, 0xff85, 0xffe0, 0xffd3,
-	0xffa6, 0xff9a, 0xffcb, 0xffd8, 0xff87, 0xff2a, 0xfeea, 0xfecb,
-	0xff1f, 0xff7e, 0xffd5, 0x0028, 0x005b, 0x0044, 0xffa2, 0xfefe,
-	0xfef6, 0xff3a, 0xff51, 0xff2c, 0xfef6, 0xfefc, 0xff4c, 0xffba,
-	0xffff, 0xffd8, 0xff82, 0xff5c, 0xff34, 0xff41, 0xffae, 0x003a,
-	0x00ba, 0x00a0, 0xff74, 0xfe2d, 0xfd76, 0xfd84, 0xfe63, 0xff5f,
-	0x0046, 0x00f6, 0x012c, 0x00cc, 0x0039, 0xffa5, 0xff0a, 0xfe92,
-	0xfe7a, 0xfeb7, 0xff08, 0xff9c, 0x0078, 0x00d9, 0x007a, 0xff78,
-	0xfe7b, 0xfe4e, 0xfebf, 0xff84, 0x0042, 0x0084, 0x0083, 0x0017,
-	0xff15, 0xfe18, 0xfdd9, 0xfe5f, 0xff5f, 0x0001, 0x0047, 0x0037,
-	0x003d, 0x0058, 0xfff4, 0xff37, 0xfe9e, 0xfe75, 0xfeb7, 0xff05,
-	0xff7a, 0xffec, 0x0023, 0x001d, 0xffd5, 0xff31, 0xfebb, 0xfeb3,
-	0xff1e, 0xffbc, 0xffde, 0xff9e, 0xffad, 0xffd8, 0xfff4, 0xffff,
-	0xffbe, 0xff72, 0xff3f, 0xff00, 0xfebf, 0xfea9, 0xff0c, 0xffba,
-	0x0032, 0x003a, 0xffd7, 0xff3c, 0xff0c, 0xff40, 0xff9b, 0xffe0,
-	0x0006, 0x0080, 0x006b, 0xffb9, 0xfef7, 0xfe45, 0xfe34, 0xfe73,
-	0xfee1, 0xff93, 0x0036, 0x00c7, 0x0163, 0x0149, 0x0074, 0xff68,
-	0xfe54, 0xfdee, 0xfe1f, 0xfeae, 0xffa8, 0x0085, 0x00ec, 0x00ad,
-	0xff9c, 0xfec1, 0xfe65, 0xfeb5, 0xff90, 0x0029, 0x0055, 0x0040,
-	0xffe0, 0xff6e, 0xfeee, 0xfe6a, 0xfe60, 0xfef3, 0xff8e, 0xffee,
-	0x003a, 0x00cd, 0x010e, 0x008d, 0xff95, 0xfe83, 0xfe06, 0xfe2a,
-	0xfede, 0xffba, 0x002c, 0x0034, 0xfffa, 0xff9a, 0xff19, 0xfef4,
-	0xff3d, 0xff8f, 0xffcb, 0xffa2, 0xff4e, 0xff59, 0xffb1, 0x0028,
-	0x0039, 0xffce, 0xff39, 0xfec0, 0xfe7b, 0xfeb2, 0xff13, 0xff65,
-	0xffc8, 0xffff, 0xffef, 0xff8c, 0xff20, 0xff60, 0xffb4, 0xffc4,
-	0xff95, 0xff61, 0xff97, 0xfff9, 0x0015, 0xffd4, 0xfefd, 0xfe3c,
-	0xfe08, 0xfe1d, 0xfec2, 0xffab, 0x00b1, 0x0186, 0x0177, 0x0097,
-	0xff77, 0xfe63, 0xfe18, 0xfe43, 0xfebb, 0xff60, 0xffd2, 0x0031,
-	0x0057, 0x000b, 0xffb5, 0xff29, 0xfec9, 0xff11, 0xff67, 0xffb2,
-	0xfffb, 0x001b, 0x0041, 0xff9f, 0xfe88, 0xfdfc, 0xfdff, 0xfea5,
-	0xffb4, 0x007d, 0x00fa, 0x0111, 0x007e, 0xffac, 0xfea8, 0xfe17,
-	0xfe56, 0xfed1, 0xff72, 0xffd4, 0xffd1, 0xffd6, 0xfffd, 0xffda,
-	0xff93, 0xff6c, 0xff51, 0xff4d, 0xff20, 0xff31, 0xff9d, 0xfff6,
-	0x0023, 0x0015, 0xffa9, 0xff29, 0xfed0, 0xff12, 0xff88, 0xffa4,
-	0xff92, 0xff7c, 0xff92, 0xffd2, 0xffca, 0xffb9, 0xffdb, 0xffc2,
-	0xff98, 0xff5d, 0xff31, 0xff9f, 0x005e, 0x00a2, 0x0069, 0xff62,
-	0xfe56, 0xfdf9, 0xfe31, 0xfef7, 0xffc4, 0x005b, 0x010c, 0x0133,
-	0x0087, 0xffc7, 0xff48, 0xfef2, 0xfea7, 0xfe7e, 0xfeab, 0xff2c,
-	0xffe1, 0x00b8, 0x00e3, 0x006e, 0xff7e, 0xfe8e, 0xfe6f, 0xfeed,
-	0xffa7, 0x0054, 0x0093, 0x0074, 0xffc7, 0xfea7, 0xfdda, 0xfdf8,
-	0xfecb, 0xffb4, 0x0069, 0x00b8, 0x00b7, 0x0095, 0x0042, 0xffa3,
-	0xfead, 0xfe26, 0xfe29, 0xfe91, 0xff14, 0xff68, 0xfff1, 0x005a,
-	0x0034, 0xffb2, 0xff1f, 0xfeef, 0xff2d, 0xff8c, 0xffd7, 0xffde,
-	0xffb5, 0xffad, 0xff83, 0xff33, 0xff18, 0xff0a, 0xff0f, 0xff35,
-	0xff4e, 0xff46, 0xff4f, 0xff9e, 0xfff8, 0xfffc, 0xffcf, 0xff95,
-	0xff50, 0xff28, 0xff35, 0xff61, 0xff9c, 0xffd7, 0x0012, 0x000a,
-	0xff44, 0xfe93, 0xfe55, 0xfe81, 0xfee7, 0xff3a, 0xffaf, 0x0042,
-	0x00c2, 0x00e9, 0x0077, 0xffde, 0xff42, 0xfe7a, 0xfe17, 0xfe24,
-	0xfec1, 0xffd8, 0x00ba, 0x00fc, 0x0073, 0xff8e, 0xfe9c, 0xfe7a,
-	0xff0a, 0xffa4, 0x0013, 0x002d, 0x0020, 0xffbc, 0xfeef, 0xfe81,
-	0xfe4a, 0xfe7f, 0xff11, 0xffbb, 0xffff, 0x004a, 0x00d2, 0x00f3,
-	0x006f, 0xff4e, 0xfe32, 0xfdcc, 0xfe19, 0xfee5, 0xffac, 0x0013,
-	0x0045, 0x0027, 0xff9d, 0xff18, 0xff0f, 0xff73, 0xffc8, 0xffe6,
-	0xffa6, 0xff58, 0xff71, 0xffd1, 0xfff7, 0xffd3, 0xff6a, 0xff0c,
-	0xfee1, 0xfeeb, 0xff5a, 0xffdd, 0x0026, 0x002a, 0xffdd, 0xff71,
-	0xff21, 0xff16, 0xff8c, 0xfffd, 0xfff7, 0xffcf, 0xffc8, 0xffe8,
-	0xfff4, 0xffe0, 0xff9a, 0xff1e, 0xfec0, 0xfeb3, 0xfeb1, 0xff10,
-	0xfff8, 0x00f8, 0x014e, 0x00d1, 0xfffa, 0xff2c, 0xfe87, 0xfe5b,
-	0xfea2, 0xff07, 0xff9d, 0x0048, 0x0096, 0x004d, 0xffe5, 0xff7a,
-	0xff27, 0xfede, 0xff00, 0xff6d, 0xffc2, 0xfffd, 0x0038, 0x0002,
-	0xff4a, 0xfe70, 0xfe17, 0xfe73, 0xff4a, 0x0025, 0x00cb, 0x0137,
-	0x013f, 0x008f, 0xff38, 0xfe08, 0xfdd1, 0xfe38, 0xfee1, 0xff5d,
-	0xffc0, 0xfffc, 0x000b, 0x0019, 0xffcc, 0xff84, 0xff80, 0xff7f,
-	0xff66, 0xff29, 0xff1a, 0xff8c, 0xffe9, 0xffe6, 0xff8f, 0xfeeb,
-	0xfe86, 0xfe98, 0xfeff, 0xffa3, 0xfff5, 0xffea, 0xffdf, 0xff93,
-	0xff5c, 0xff54, 0xff5e, 0xff7c, 0xff81, 0xff48, 0xff04, 0xfedc,
-	0xff6a, 0x003c, 0x0059, 0xfff8, 0xff4b, 0xfe7b, 0xfe2f, 0xfe54,
-	0xfef8, 0xffc7, 0x006b, 0x00f5, 0x00ba, 0xfff6, 0xff67, 0xff1e,
-	0xfed5, 0xfe8e, 0xfe75, 0xfec0, 0xff80, 0x003b, 0x00ab, 0x0085,
-	0x000c, 0xff60, 0xfe9d, 0xfe61, 0xfecc, 0xffae, 0x0071, 0x00b6,
-	0x003b, 0xff31, 0xfe27, 0xfdbd, 0xfe29, 0xff1b, 0x0005, 0x00a1,
-	0x00cc, 0x00e5, 0x0088, 0xffc3, 0xff21, 0xfe6f, 0xfe2e, 0xfe56,
-	0xfe92, 0xff13, 0xffb2, 0x005e, 0x00ab, 0x0039, 0xff69, 0xff0c,
-	0xff10, 0xff4c, 0xff92, 0xff71, 0xff67, 0xff85, 0xff72, 0xff8e,
-	0xff8b, 0xff8a, 0xff9a, 0xff84, 0xff78, 0xff75, 0xff7a, 0xff8d,
-	0xffa1, 0xff9a, 0xff99, 0xff88, 0xff81, 0xff80, 0xff8b, 0xff9c,
-	0xff89, 0xff87, 0xff9b, 0xffad, 0xffbd, 0xffa9, 0xff9f, 0xff94,
-	0xff93, 0xff85, 0xff75, 0xff80, 0xff85, 0xff9c, 0xffa6, 0xffa5,
-	0xffa6, 0xff8c, 0xff75, 0xff68, 0xff6d, 0xff88, 0xff9d, 0xffa8,
-	0xffa8, 0xffa4, 0xffaa, 0xffa9, 0xff9f, 0xff99, 0xff8e, 0xff96,
-	0xff9b, 0xffa8, 0xffa9, 0xff9b, 0xffa7, 0xffb7, 0xffb5, 0xffb6,
-	0xffd6, 0xffe3, 0xffc7, 0xffbe, 0xffa6, 0xff9f, 0xff85, 0xff96,
-	0xffae, 0xffb0, 0xffaf, 0xffa1, 0xffaf, 0xff9c, 0xff8b, 0xff8f,
-	0xff94, 0xffa9, 0xffa4, 0xff9f, 0xff99, 0xff82, 0xff7d, 0xff7b,
-	0xff81, 0xff81, 0xff92, 0xffb4, 0xffba, 0xffa8, 0xff92, 0xff6a,
-	0xff72, 0xff6d, 0xff7d, 0xff87, 0xff89, 0xff9a, 0xff95, 0xff89,
-	0xff70, 0xff76, 0xff61, 0xff62, 0xff5e, 0xff59, 0xff61, 0xff62,
-	0xff5e, 0xff68, 0xff59, 0xff58, 0xff57, 0xff5c, 0xff6f, 0xff5c,
-	0xff60, 0xff69, 0xff61, 0xff64, 0xff5f, 0xff5f, 0xff63, 0xff65,
-	0xff67, 0xff66, 0xff75, 0xff70, 0xff6c, 0xff69, 0xff5f, 0xff61,
-	0xff73, 0xff8a, 0xff91, 0xff81, 0xff74, 0xff5c, 0xff4e, 0xff52,
-	0xff4d, 0xff6a, 0xff82, 0xff95, 0xffa5, 0xffa1, 0xff97, 0xff85,
-	0xff80, 0xff8d, 0xff74, 0xff71, 0xff78, 0xff84, 0xffa5, 0xffa5,
-	0xffa1, 0xff8f, 0xff88, 0xff92, 0xff94, 0xff92, 0xff85, 0xff85,
-	0xff83, 0xff83, 0xff76, 0xff72, 0xff80, 0xff8d, 0xff8d, 0xff8a,
-	0xff86, 0xff86, 0xff81, 0xff8c, 0xff81, 0xff80, 0xff8a, 0xff87,
-	0xff7e, 0xff84, 0xff89, 0xff93, 0xff9f, 0xffa2, 0xffaf, 0xffa5,
-	0xff96, 0xff7a, 0xff6e, 0xff6f, 0xff7c, 0xff8c, 0xff7e, 0xff80,
-	0xff8b, 0xff84, 0xff8f, 0xff8a, 0xff86, 0xff81, 0xff7f, 0xff87,
-	0xff90, 0xff92, 0xff93, 0xff9b, 0xff9e, 0xff92, 0xff91, 0xff94,
-	0xff9e, 0xffa4, 0xffad, 0xffaa, 0xffae, 0xffa5, 0xffb2, 0xffaf,
-	0xff98, 0xff8b, 0xff88, 0xff96, 0xff9e, 0xffaa, 0xffac, 0xffa2,
-	0xff9f, 0xff95, 0xff8f, 0xff84, 0xff83, 0xff95, 0xff8c, 0xff91,
-	0xff91, 0xff8d, 0xff83, 0xff80, 0xff81, 0xff7d, 0xff7c, 0xff82,
-	0xff84, 0xff8d, 0xff88, 0xff95, 0xff94, 0xff96, 0xff92, 0xff97,
-	0xff8f, 0xff87, 0xff83, 0xff7a, 0xff7d, 0xff7a, 0xff6c, 0xff63,
-	0xff6a, 0xff6e, 0xff75, 0xff73, 0xff74, 0xff72, 0xff71, 0xff79,
-	0xff7a, 0xff72, 0xff78, 0xff7d, 0xff71, 0xff78, 0xff6f, 0xff5e,
-	0xff5d, 0xff59, 0xff62, 0xff63, 0xff5d, 0xff5c, 0xff5c, 0xff59,
-	0xff5c, 0xff5f, 0xff5e, 0xff5e, 0xff61, 0xff5c, 0xff58, 0xff61,
-	0xff64, 0xff71, 0xff6b, 0xff67, 0xff56, 0xff51, 0xff57, 0xff5e,
-	0xff64, 0xff79, 0xff7a, 0xff89, 0xff86, 0xff8c, 0xff87, 0xff84,
-	0xff83, 0xff8f, 0xff9f, 0xff9b, 0xff8e, 0xff95, 0xff8a, 0xff94,
-	0xff92, 0xffa1, 0xff89, 0xff89, 0xff8b, 0xff8e, 0xff8f, 0xff96,
-	0xff98, 0xff8f, 0xff8f, 0xff8b, 0xff7d, 0xff81, 0xff8d, 0xff8b,
-	0xff72, 0xff64, 0xff5d, 0xff65, 0xff7a, 0xff86, 0xff86, 0xff88,
-	0xff8f, 0xff8c, 0xff9c, 0xffad, 0xffa3, 0xff9f, 0xff95, 0xff99,
-	0xff9d, 0xff9f, 0xff8d, 0xff85, 0xff83, 0xff82, 0xff8f, 0xff9e,
-	0xff98, 0xff99, 0xff96, 0xff87, 0xff8f, 0xff99, 0xff94, 0xff9a,
-	0xff99, 0xff9a, 0xff95, 0xff97, 0xff9b, 0xffa5, 0xff99, 0xffb0,
-	0xff9f, 0xffa0, 0xffae, 0xffac, 0xffc2, 0xffb8, 0xffb7, 0xffc1,
-	0xffcd, 0xffbd, 0xffb3, 0xffa7, 0xffa8, 0xffad, 0xff9d, 0xff9d,
-	0xff9d, 0xff9c, 0xff97, 0xff8a, 0xff84, 0xff87, 0xff86, 0xff8c,
-	0xff85, 0xff7b, 0xff81, 0xff80, 0xff7a, 0xff78, 0xff79, 0xff79,
-	0xff82, 0xff91, 0xff92, 0xff95, 0xff90, 0xff8f, 0xff87, 0xff7f,
-	0xff79, 0xff71, 0xff75, 0xff73, 0xff79, 0xff6d, 0xff77, 0xff70,
-	0xff76, 0xff73, 0xff7a, 0xff72, 0xff77, 0xff69, 0xff6b, 0xff78,
-	0xff7c, 0xff97, 0xff8d, 0xff91, 0xff94, 0xff86, 0xff8f, 0xff87,
-	0xff8e, 0xff84, 0xff7a, 0xff7f, 0xff7a, 0xff7d, 0xff7b, 0xff82,
-	0xff77, 0xff72, 0xff6f, 0xff79, 0xff83, 0xff87, 0xff89, 0xff8e,
-	0xff8c, 0xff8d, 0xff91, 0xff88, 0xff8c, 0xff8f, 0xff8a, 0xff91,
-	0xff88, 0xff93, 0xffa4, 0xff94, 0xffa7, 0xffa7, 0xffa5, 0xffaa,
-	0xffa7, 0xffa8, 0xffab, 0xffad, 0xffbd, 0xffb9, 0xffbb, 0xffb9,
-	0xffb0, 0xffb9, 0xffb5, 0xffbc, 0xffbb, 0xffb6, 0xffb1, 0xffac,
-	0xffaf, 0xffb0, 0xffab, 0xff9f, 0xff95, 0xff94, 0xffa1, 0xffac,
-	0xffa5, 0xffab, 0xffa0, 0xff95, 0xffa1, 0xffb2, 0xffa4, 0xffa8,
-	0xffad, 0xffac, 0xffab, 0xffa7, 0xffad, 0xffb4, 0xffbd, 0xffb1,
-	0xffa6, 0xffa4, 0xff9e, 0xff9a, 0xffa0, 0xff9d, 0xffa4, 0xffa8,
-	0xffae, 0xff9a, 0xffa2, 0xff9c, 0xffa4, 0xffaa, 0xffaa, 0xffaf,
-	0xffae, 0xffb0, 0xffb0, 0xffaf, 0xffb3, 0xffae, 0xffb9, 0xffc6,
-	0xffb5, 0xffc7, 0xffbc, 0xffbf, 0xffbd, 0xffc0, 0xffc9, 0xffcb,
-	0xffc4, 0xffcd, 0xffca, 0xffcd, 0xffc8, 0xffba, 0xffbc, 0xffbd,
-	0xffbf, 0xffba, 0xffab, 0xffb2, 0xffad, 0xffae, 0xffaf, 0xffa5,
-	0xff91, 0xff8c, 0xff8c, 0xff8b, 0xff96, 0xff9f, 0xff93, 0xff9c,
-	0xff99, 0xff98, 0xff9f, 0xffa0, 0xffaf, 0xffac, 0xffad, 0xffa0,
-	0xff92, 0xff99, 0xff93, 0xff9b, 0xff95, 0xff99, 0xff95, 0xff9f,
-	0xff9b, 0xff9d, 0xff97, 0xffa0, 0xff99, 0xff89, 0xff98, 0xff92,
-	0xff93, 0xffa3, 0xff95, 0xff9c, 0xff96, 0xff93, 0xff86, 0xff7f,
-	0xff85, 0xff8d, 0xff86, 0xff7e, 0xff7c, 0xff85, 0xff8a, 0xff8c,
-	0xff7d, 0xff80, 0xff8c, 0xff88, 0xff91, 0xff86, 0xff86, 0xff90,
-	0xff88, 0xff8a, 0xff83, 0xff8d, 0xff85, 0xff82, 0xff7d, 0xff82,
-	0xff7a, 0xff84, 0xff8f, 0xff8b, 0xff95, 0xff9f, 0xff99, 0xffa7,
-	0xffb2, 0xffaa, 0xffa7, 0xffad, 0xffab, 0xffb1, 0xffb7, 0xffa5,
-	0xffac, 0xffa5, 0xffa4, 0xffb0, 0xffa8, 0xffad, 0xffb3, 0xffa1,
-	0xffab, 0xffa7, 0xffaa, 0xff95, 0xff9e, 0xff97, 0xff9c, 0xff9c,
-	0xff9d, 0xff9b, 0xff9a, 0xff9a, 0xff9c, 0xffa8, 0xffae, 0xffae,
-	0xffb1, 0xffaf, 0xffad, 0xffae, 0xffb2, 0xffa9, 0xffac, 0xffac,
-	0xffa0, 0xff90, 0xff87, 0xff80, 0xff8b, 0xff97, 0xffa1, 0xffa0,
-	0xffb6, 0xffac, 0xff9e, 0xffa9, 0xffab, 0xffac, 0xffaf, 0xffae,
-	0xffb4, 0xffc3, 0xffc1, 0xffb7, 0xffb8, 0xffba, 0xffb7, 0xffbc,
-	0xffbf, 0xffbc, 0xffc9, 0xffce, 0xffc8, 0xffc3, 0xffc8, 0xffcb,
-	0xffd1, 0xffd2, 0xffca, 0xffcb, 0xffce, 0xffca, 0xffc6, 0xffbb,
-	0xffb7, 0xffa9, 0xffb3, 0xffa9, 0xffaf, 0xffab, 0xffaa, 0xffad,
-	0xffa8, 0xffa4, 0xffa4, 0xffab, 0xffa9, 0xffad, 0xffaa, 0xff9f,
-	0xffa0, 0xff9a, 0xff9e, 0xffab, 0xffae, 0xffb7, 0xffa2, 0xff95,
-	0xff9d, 0xff9d, 0xff99, 0xff95, 0xff8e, 0xff8e, 0xffa2, 0xff97,
-	0xff8f, 0xff94, 0xff98, 0xff90, 0xff94, 0xff95, 0xff8f, 0xff97,
-	0xff8f, 0xff9b, 0xffa9, 0xff9c, 0xff9c, 0xff88, 0xff86, 0xff7c,
-	0xff89, 0xff94, 0xff8e, 0xff8d, 0xff8c, 0xff93, 0xff8a, 0xff91,
-	0xff85, 0xff83, 0xff8e, 0xff82, 0xff82, 0xff8a, 0xff87, 0xff93,
-};
-
 extern int16_t *outoforder_spl;
 extern int outoforder_size;
 extern int outoforder_max;
 
 void init_announcement(void)
 {
-        outoforder_spl = pattern;
-	outoforder_size = sizeof(pattern) / sizeof(pattern[0]);
-	outoforder_max = outoforder_size;
+	asset_bind("nmt/announcement", &outoforder_spl, &outoforder_size, &outoforder_max);
 }
-
-
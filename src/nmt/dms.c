@@ -28,8 +28,8 @@
 
 #define MUTE_DURATION		0.300	/* 200ms, and about 95ms for the frame itself */
 
-#define DMS_DOTTING		"101010101010101"
-#define DMS_SYNC		"00101000111"
+#define DMS_DOTTING		0x5555	/* 101010101010101 */
+#define DMS_SYNC		0x147	/* 00101000111 */
 
 int dms_allow_loopback = 0;
 
@@ -37,31 +37,62 @@ int dms_allow_loopback = 0;
  * support
  */
 
-/* calculate CRC from the bits of label and data and 16 zeroes.
- * the result is the remainder of the polynomial division and
- * conforms to DMS standard.
+/* The CRC is the remainder of the polynomial division of label, data and 16
+ * zeroes by the generator 0x1021. This is the same as feeding label and data
+ * into a CRC register without appending zeroes. Because DMS words have 7 bits,
+ * crc_table holds the CRC register change for each 7 bit value that is
+ * shifted out of the register, so one word is processed by one table lookup.
  */
-static uint16_t crc16(uint8_t *bits, int len)
+static uint16_t crc_table[128];
+static int crc_table_init = 0;
+
+static void init_crc16(void)
 {
 	uint16_t generator = 0x1021;
-	uint16_t crc = 0; /* init crc register with 0 */
-	int i;
+	uint16_t crc;
+	int i, j;
 
-	for (i = 0; i < len; i++) {
-		/* check if MSB is set */
-		if ((crc & 0x8000)) {   /* MSB set, shift it out of the register */
-			/* shift in next bit of input stream */
-			crc = (crc << 1) | bits[i];
-			/* Perform the 'division' by XORing the crc register with the generator polynomial */
-			crc = crc ^ generator;
-		} else {   /* MSB not set, shift it out and shift in next bit of input stream. Same as above, just no division */
-			crc = (crc << 1) | bits[i];
+	for (i = 0; i < 128; i++) {
+		crc = i << 9;
+		for (j = 0; j < 7; j++) {
+			if ((crc & 0x8000))
+				crc = (crc << 1) ^ generator;
+			else
+				crc <<= 1;
 		}
+		crc_table[i] = crc;
 	}
 
+	crc_table_init = 1;
+}
+
+/* calculate CRC from the 7 bit words of label and data
+ * the result conforms to DMS standard.
+ */
+static uint16_t crc16(const uint8_t *words, int len)
+{
+	uint16_t crc = 0; /* init crc register with 0 */
+	int i;
+
+	if (!crc_table_init)
+		init_crc16();
+
+	for (i = 0; i < len; i++)
+		crc = (crc << 7) ^ crc_table[((crc >> 9) ^ words[i]) & 0x7f];
+
 	return crc;
 }
 
+/* append bits of value to a frame of packed bits (MSB first) */
+static void put_bits(uint8_t *frame, int *pos, uint16_t value, int count)
+{
+	while (count--) {
+		if (((value >> count) & 1))
+			frame[*pos >> 3] |= 0x80 >> (*pos & 7);
+		(*pos)++;
+	}
+}
+
 /*
  * frame handling
  */
@@ -105,51 +136,26 @@ static const char *print_ct_dt(uint8_t s, uint8_t n, uint8_t *data, int eight_bi
 	return text;
 }
 
-/* link DMS frame to list of TX frames */
-static void link_dms_frame(nmt_t *nmt, struct dms_frame *frame)
+/* get DMS frame from ring of TX frames, 0 is the oldest frame */
+static struct dms_frame *dms_frame_get(dms_t *dms, int i)
 {
-	dms_t *dms = &nmt->dms;
-	struct dms_frame **framep;
-
-	LOGP(DDMS, LOGL_DEBUG, "link DMS frame\n");
-
-	/* attach to end of list */
-	framep = &dms->state.frame_list;
-	while (*framep)
-		framep = &((*framep)->next);
-	*framep = frame;
+	if (i >= dms->state.frame_count)
+		return NULL;
+	return &dms->state.frame_ring[(dms->state.frame_head + i) & (DMS_RING_SIZE - 1)];
 }
 
-/* unlink DMS frame from list of TX frames */
-static void unlink_dms_frame(nmt_t *nmt, struct dms_frame *frame)
-{
-	dms_t *dms = &nmt->dms;
-	struct dms_frame **framep;
-
-	LOGP(DDMS, LOGL_DEBUG, "unlink DMS frame\n");
-
-	/* unlink */
-	framep = &dms->state.frame_list;
-	while (*framep && *framep != frame)
-		framep = &((*framep)->next);
-	if (!(*framep)) {
-		LOGP(DTRANS, LOGL_ERROR, "Frame not in list, please fix!!\n");
-		abort();
-	}
-	*framep = frame->next;
-}
-
-/* add DMS frame to list of TX frames */
+/* add DMS frame to ring of TX frames */
 static void dms_frame_add(nmt_t *nmt, int s, const uint8_t *data)
 {
 	dms_t *dms = &nmt->dms;
 	struct dms_frame *dms_frame;
 
-	dms_frame = calloc(1, sizeof(*dms_frame));
-	if (!dms_frame) {
-		LOGP(DDMS, LOGL_ERROR, "No memory!\n");
-			return;
+	if (dms->state.frame_count == DMS_RING_SIZE) {
+		LOGP(DDMS, LOGL_ERROR, "DMS frame ring is full, dropping frame!\n");
+		return;
 	}
+	dms_frame = &dms->state.frame_ring[(dms->state.frame_head + dms->state.frame_count) & (DMS_RING_SIZE - 1)];
+	dms->state.frame_count++;
 
 	dms_frame->s = s;
 	dms_frame->n = dms->state.n_count;
@@ -157,18 +163,18 @@ static void dms_frame_add(nmt_t *nmt, int s, const uint8_t *data)
 	memcpy(dms_frame->data, data, 8);
 
 	LOGP(DDMS, LOGL_DEBUG, "add DMS %cT(%d) frame to queue\n", dms_frame->s + 'C', dms_frame->n);
-
-	link_dms_frame(nmt, dms_frame);
 }
 
-/* delete DMS frame from list of TX frames */
-static void dms_frame_delete(nmt_t *nmt, struct dms_frame *dms_frame)
+/* delete oldest DMS frame from ring of TX frames */
+static void dms_frame_delete(nmt_t *nmt)
 {
-	LOGP(DDMS, LOGL_DEBUG, "delete DMS frame %cT(%d) from queue\n", dms_frame->s + 'C', dms_frame->n);
+	dms_t *dms = &nmt->dms;
+	struct dms_frame *dms_frame = dms_frame_get(dms, 0);
 
-	unlink_dms_frame(nmt, dms_frame);
+	LOGP(DDMS, LOGL_DEBUG, "delete DMS frame %cT(%d) from queue\n", dms_frame->s + 'C', dms_frame->n);
 
-	free(dms_frame);
+	dms->state.frame_head = (dms->state.frame_head + 1) & (DMS_RING_SIZE - 1);
+	dms->state.frame_count--;
 }
 
 /* add DT frame */
@@ -243,52 +249,33 @@ void dms_cleanup_sender(nmt_t *nmt)
 static void dms_encode_dt(nmt_t *nmt, uint8_t d, uint8_t s, uint8_t n, uint8_t *_data)
 {
 	dms_t *dms = &nmt->dms;
-	char frame[127];
 	uint8_t data[12];
-	uint8_t bits[63 + 16];
 	uint16_t crc;
-	int i, j;
+	int i, pos;
 
 	LOGP(DDMS, LOGL_INFO, "Sending DMS frame: %s\n", print_ct_dt(s, n, _data, dms->state.eight_bits));
 
 	/* generate label */
 	data[0] = (d << 6) | (s << 5) | (3 << 3) | n;
 	memcpy(data + 1, _data, 8);
-	for (i = 0; i < 9; i++) {
-		for (j = 0; j < 7; j++)
-			bits[i * 7 + j] = (data[i] >> (6 - j)) & 1;
-	}
-	for (i = 0; i < 16; i++)
-		bits[63 + i] = 0;
-	crc = crc16(bits, 63 + 16);
-	data[9] = crc >> 9;
-	data[10] = crc >> 2;
+	crc = crc16(data, 9);
+	data[9] = (crc >> 9) & 0x7f;
+	data[10] = (crc >> 2) & 0x7f;
 	data[11] = crc & 0x3;
 
-	/* create RR frame */
+	/* create DT frame */
 	// FIXME: no dotting on consecutive frames
-	memcpy(frame, DMS_DOTTING, 15);
-	memcpy(frame + 15, DMS_SYNC, 11);
-	for (i = 0; i < 11; i++) {
-		for (j = 0; j < 7; j++)
-			frame[26 + j + i*9] = ((data[i] >> (6 - j)) & 1) | '0';
-		frame[26 + 7 + i*9] = '1';
-		frame[26 + 8 + i*9] = '1';
-	}
-	frame[125] = ((data[11] >> 1) & 1) | '0';
-	frame[126] = (data[11] & 1) | '0';
-#if 0
-	for (i = 0; i < 127; i++) {
-		if (i == 15 || i == 26 || (i - 26) % 9 == 6 || (i - 26) % 9 == 8)
-			printf(" ");
-		printf("%c", frame[i]);
-	}
-	printf("\n");
-#endif
+	memset(dms->tx_frame, 0, sizeof(dms->tx_frame));
+	pos = 0;
+	put_bits(dms->tx_frame, &pos, DMS_DOTTING, 15);
+	put_bits(dms->tx_frame, &pos, DMS_SYNC, 11);
+	/* each word is followed by '11' */
+	for (i = 0; i < 11; i++)
+		put_bits(dms->tx_frame, &pos, (data[i] << 2) | 0x3, 9);
+	put_bits(dms->tx_frame, &pos, data[11], 2);
 
 	/* store frame */
-	memcpy(dms->tx_frame, frame, 127);
-	dms->tx_frame_length = 127;
+	dms->tx_frame_length = pos;
 	dms->tx_frame_pos = 0;
 	dms->tx_frame_valid = 1;
 }
@@ -298,41 +285,28 @@ static void dms_encode_rr(nmt_t *nmt, uint8_t d, uint8_t s, uint8_t n)
 {
 	dms_t *dms = &nmt->dms;
 	uint8_t data;
-	char frame[77], label[9];
-	int parity, i;
+	int parity = 0, pos, i;
 
 	/* generate label */
 	data = (d << 6) | (s << 5) | (1 << 3) | n;
-	parity = '0';
 	for (i = 0; i < 7; i++) {
-		label[i] = ((data >> (6 - i)) & 1) | '0';
-		if (label[i] == '1')
+		if (((data >> i) & 1))
 			parity ^= 1;
 	}
-	label[7] = '1';
-	label[8] = '1';
-
-	/* create RR frame */
-	memcpy(frame, DMS_DOTTING, 15);
-	memcpy(frame + 15, DMS_SYNC, 11);
-	memcpy(frame + 26, label, 9);
-	memcpy(frame + 35, label, 9);
-	frame[44] = parity; frame[45] = parity;
-	memcpy(frame + 46, frame + 15, 31);
-#if 0
-	for (i = 0; i < 77; i++) {
-		if (i == 15 || i == 26 || i == 33 || i == 35
-		 || i == 42 || i == 44 || i == 46 || i == 57
-		 || i == 64 || i == 66 || i == 73 || i == 75)
-			printf(" ");
-		printf("%c", frame[i]);
+
+	/* create RR frame, sync, label and parity are repeated */
+	memset(dms->tx_frame, 0, sizeof(dms->tx_frame));
+	pos = 0;
+	put_bits(dms->tx_frame, &pos, DMS_DOTTING, 15);
+	for (i = 0; i < 2; i++) {
+		put_bits(dms->tx_frame, &pos, DMS_SYNC, 11);
+		put_bits(dms->tx_frame, &pos, (data << 2) | 0x3, 9);
+		put_bits(dms->tx_frame, &pos, (data << 2) | 0x3, 9);
+		put_bits(dms->tx_frame, &pos, (parity) ? 0x3 : 0x0, 2);
 	}
-	printf("\n");
-#endif
 
 	/* store frame */
-	memcpy(dms->tx_frame, frame, 77);
-	dms->tx_frame_length = 77;
+	dms->tx_frame_length = pos;
 	dms->tx_frame_pos = 0;
 	dms->tx_frame_valid = 1;
 }
@@ -346,7 +320,7 @@ static void dms_encode_rr(nmt_t *nmt, uint8_t d, uint8_t s, uint8_t n)
 void trigger_frame_transmission(nmt_t *nmt)
 {
 	dms_t *dms = &nmt->dms;
-	struct dms_frame *dms_frame;
+	struct dms_frame *dms_frame, *next_frame;
 	int i;
 
 	/* ongoing transmission, so we wait */
@@ -363,15 +337,16 @@ void trigger_frame_transmission(nmt_t *nmt)
 
 	/* get next frame to send */
 	/* loop 4 times, because only 4 unacked frames may be transmitted */
-	dms_frame = dms->state.frame_list;
-	for (i = 0; i < 4 && dms_frame; i++) {
+	for (i = 0; i < 4 && i < dms->state.frame_count; i++) {
+		dms_frame = dms_frame_get(dms, i);
+		next_frame = dms_frame_get(dms, i + 1);
 		/* stop before DT frame, if RAND was not acked */
-		if (dms_frame->next && dms_frame->next->s == 1 && !dms->state.established)
+		if (next_frame && next_frame->s == 1 && !dms->state.established)
 			break;
 		if (dms_frame->n == dms->state.n_s)
 			break;
-		dms_frame = dms_frame->next;
 	}
+	dms_frame = dms_frame_get(dms, i);
 
 	/* check if outstanding frame */
 	if (!dms_frame) {
@@ -389,30 +364,34 @@ void trigger_frame_transmission(nmt_t *nmt)
 	 * if there is no next frame, set it to the first frame (cycle).
 	 * also if RAND was not acked, but next frame is DT, send first frame.
 	 */
-	if (!dms_frame->next) {
-		dms->state.n_s = dms->state.frame_list->n;
+	next_frame = dms_frame_get(dms, i + 1);
+	if (!next_frame) {
+		dms->state.n_s = dms_frame_get(dms, 0)->n;
 		LOGP(DDMS, LOGL_DEBUG, " -> Next sequence number is %d, because this was the last frame in queue.\n", dms->state.n_s);
-	} else if (!dms->state.established && dms_frame->next->s == 1) {
-		dms->state.n_s = dms->state.frame_list->n;
+	} else if (!dms->state.established && next_frame->s == 1) {
+		dms->state.n_s = dms_frame_get(dms, 0)->n;
 		LOGP(DDMS, LOGL_DEBUG, " -> Next sequence number is %d, because this was the last frame before DT queue, and RAND has not been acked yet.\n", dms->state.n_s);
 	} else if (i == 3) {
-		dms->state.n_s = dms->state.frame_list->n;
+		dms->state.n_s = dms_frame_get(dms, 0)->n;
 		LOGP(DDMS, LOGL_DEBUG, " -> Next sequence number is %d, because we reached max number of unacknowledged frames.\n", dms->state.n_s);
-	} else if (!dms->state.established && dms_frame->next->s == 0) {
-		dms->state.n_s = dms_frame->next->n;
+	} else if (!dms->state.established && next_frame->s == 0) {
+		dms->state.n_s = next_frame->n;
 		LOGP(DDMS, LOGL_DEBUG, " -> Next sequence number is %d, because this is the next CT frame in queue.\n", dms->state.n_s);
 	} else {
-		dms->state.n_s = dms_frame->next->n;
+		dms->state.n_s = next_frame->n;
 		LOGP(DDMS, LOGL_DEBUG, " -> Next sequence number is %d, because this is the next frame in queue.\n", dms->state.n_s);
 	}
 
 	dms_encode_dt(nmt, dms->state.dir ^ 1, dms_frame->s, dms_frame->n, dms_frame->data);
 }
 
-/* send data using FSK */
-int dms_send_bit(nmt_t *nmt)
+/* send data using FSK
+ * provide the rest of the current frame as packed bits (MSB first), the next
+ * frame is rendered when its first bit is needed */
+int dms_send_bits(nmt_t *nmt, uint8_t *bits, int max)
 {
 	dms_t *dms = &nmt->dms;
+	int count = 0, pos;
 
 	if (!dms->tx_frame_valid)
 		return -1;
@@ -424,7 +403,14 @@ int dms_send_bit(nmt_t *nmt)
 			return -1;
 	}
 
-	return dms->tx_frame[dms->tx_frame_pos++];
+	memset(bits, 0, (max + 7) / 8);
+	while (count < max && dms->tx_frame_pos < dms->tx_frame_length) {
+		pos = dms->tx_frame_pos++;
+		bits[count >> 3] |= ((dms->tx_frame[pos >> 3] >> (7 - (pos & 7))) & 1) << (7 - (count & 7));
+		count++;
+	}
+
+	return count;
 }
 
 /*
@@ -519,7 +505,7 @@ static void dms_rx_dt(nmt_t *nmt, uint8_t d, uint8_t s, uint8_t n, uint8_t *data
 static void dms_rx_rr(nmt_t *nmt, uint8_t d, uint8_t s, uint8_t n)
 {
 	dms_t *dms = &nmt->dms;
-	struct dms_frame *dms_frame, *dms_frame_next;
+	struct dms_frame *dms_frame;
 	int i, j;
 
 	if (!dms->state.started)
@@ -533,15 +519,13 @@ static void dms_rx_rr(nmt_t *nmt, uint8_t d, uint8_t s, uint8_t n)
 
 	/* check to which entry in the list of frames this ack belongs to */
 	/* loop 4 times, because only 4 unacked frames may have been transmitted */
-	dms_frame = dms->state.frame_list;
-	for (i = 0; i < 4 && dms_frame; i++) {
-		if (dms_frame->n == ((n - 1) & 7))
+	for (i = 0; i < 4 && i < dms->state.frame_count; i++) {
+		if (dms_frame_get(dms, i)->n == ((n - 1) & 7))
 			break;
-		dms_frame = dms_frame->next;
 	}
 
 	/* if we don't find a frame, it must have been already acked, so we ignore RR */
-	if (!dms_frame || i == 4) {
+	if (i == dms->state.frame_count || i == 4) {
 		LOGP(DDMS, LOGL_DEBUG, "Received already acked DMS frame: RR(%d) (s = %d), ignoring\n", n, s);
 		return;
 	}
@@ -549,8 +533,8 @@ static void dms_rx_rr(nmt_t *nmt, uint8_t d, uint8_t s, uint8_t n)
 	LOGP(DDMS, LOGL_INFO, "Received valid DMS frame: RR(%d) (s = %d)\n", n, s);
 
 	/* flush all acked frames. */
-	dms_frame = dms->state.frame_list;
 	for (j = 0; j <= i; j++) {
+		dms_frame = dms_frame_get(dms, 0);
 		if (dms_frame->data[0] == 82) { /* RAND */
 			LOGP(DDMS, LOGL_DEBUG, "RAND frame has been acknowledged, so we can continue to send DT frame\n");
 			dms->state.established = 1;
@@ -563,11 +547,12 @@ static void dms_rx_rr(nmt_t *nmt, uint8_t d, uint8_t s, uint8_t n)
 			LOGP(DDMS, LOGL_DEBUG, "Raising next frame to send to #%d\n", dms->state.n_s);
 		}
 		LOGP(DDMS, LOGL_DEBUG, "Removing acked frame #%d\n", dms_frame->n);
-		dms_frame_next = dms_frame->next;
-		dms_frame_delete(nmt, dms_frame);
-		dms_frame = dms_frame_next;
+		dms_frame_delete(nmt);
 	}
 
+	/* upper layer may fill the ring again */
+	dms_frames_acked(nmt);
+
 	/* now trigger frame transmission */
 	trigger_frame_transmission(nmt);
 }
@@ -689,18 +674,10 @@ void fsk_receive_bit_dms(nmt_t *nmt, int bit, double quality, double level)
 		}
 		if (dms->rx_bit_count == 2) {
 			uint16_t crc_got, crc_calc;
-			uint8_t bits[63 + 16];
-			int i, j;
 			dms->rx_bit_count = 0;
 			LOGP(DDMS, LOGL_DEBUG, "Got DMS CRC 0x%x\n", dms->rx_frame[dms->rx_frame_count]);
 			crc_got = (dms->rx_frame[9] << 9) | (dms->rx_frame[10] << 2) | dms->rx_frame[11];
-			for (i = 0; i < 9; i++) {
-				for (j = 0; j < 7; j++)
-					bits[i * 7 + j] = (dms->rx_frame[i] >> (6 - j)) & 1;
-			}
-			for (i = 0; i < 16; i++)
-				bits[63 + i] = 0;
-			crc_calc = crc16(bits, 63 + 16);
+			crc_calc = crc16(dms->rx_frame, 9);
 			LOGP(DDMS, LOGL_DEBUG, "DMS CRC = 0x%04x %s\n", crc_got, (crc_calc == crc_got) ? "(OK)" : "(CRC error)");
 			if (crc_calc == crc_got)
 				dms_rx_dt(nmt, dms->rx_label.d, dms->rx_label.s, dms->rx_label.n, dms->rx_frame + 1);
@@ -751,6 +728,39 @@ void fsk_receive_bit_dms(nmt_t *nmt, int bit, double quality, double level)
  * calls from upper layer
  */
 
+/* number of frames that dms_send() queues for the given data */
+int dms_frames_required(nmt_t *nmt, const uint8_t *data, int length, int eight_bits)
+{
+	int frames = 0, copied, i;
+
+	if (!nmt->dms.state.started)
+		frames += 2; /* ID + RAND */
+
+	while (length) {
+		copied = (eight_bits) ? 7 : 8;
+		if (copied > length)
+			copied = length;
+		data += copied;
+		length -= copied;
+		/* trailing zeros are put back, like dms_send() does */
+		for (i = 0; i < copied - 1; i++) {
+			if (data[-1] == 0) {
+				data--;
+				length++;
+			}
+		}
+		frames++;
+	}
+
+	return frames;
+}
+
+/* number of frames that can be queued */
+int dms_frames_free(nmt_t *nmt)
+{
+	return DMS_RING_SIZE - nmt->dms.state.frame_count;
+}
+
 /* receive data from upper layer to be sent as DT frames
  * the DT frames are generated */
 void dms_send(nmt_t *nmt, const uint8_t *data, int length, int eight_bits)
@@ -761,6 +771,11 @@ void dms_send(nmt_t *nmt, const uint8_t *data, int length, int eight_bits)
 
 	LOGP(DDMS, LOGL_DEBUG, "Received message with %d digits of %d bits\n", length, (eight_bits) ? 8 : 7);
 
+	if (dms_frames_required(nmt, data, length, eight_bits) > dms_frames_free(nmt)) {
+		LOGP(DDMS, LOGL_ERROR, "Message does not fit into DMS frame ring, dropping!\n");
+		return;
+	}
+
 	/* active connection */
 	if (dms->state.started) {
 		if (dms->state.eight_bits != eight_bits) {
@@ -841,11 +856,9 @@ void dms_reset(nmt_t *nmt)
 	LOGP(DDMS, LOGL_DEBUG, "Resetting DMS states\n");
 
 	dms->rx_in_sync = 0;
+	/* this also empties the ring of TX frames */
 	memset(&dms->state, 0, sizeof(dms->state));
 
 	dms->tx_frame_valid = 0;
-
-	while (dms->state.frame_list)
-		dms_frame_delete(nmt, dms->state.frame_list);
 }
 
@@ -1,6 +1,8 @@
 
+/* frames that can be queued, must be a power of two */
+#define DMS_RING_SIZE		128
+
 struct dms_frame {
-	struct dms_frame	*next;
 	uint8_t			s;			/* CT/DT frame */
 	uint8_t			n;			/* sequence number */
 	uint8_t			data[8];		/* data */
@@ -14,19 +16,21 @@ struct dms_state {
 	uint8_t			n_r;			/* next expected frame to be received */
 	uint8_t			n_s;			/* next frame to be sent */
 	uint8_t			n_a;			/* next frame to be acked */
-	uint8_t			n_count;		/* counts frames that are stored in list */
+	uint8_t			n_count;		/* counts frames that are stored in ring */
 	uint8_t			dir;			/* direction */
 	int			eight_bits;		/* what mode are used for DT frames */
-	struct dms_frame	*frame_list;		/* list of frames to transmit */
+	struct dms_frame	frame_ring[DMS_RING_SIZE]; /* frames to transmit, oldest unacked frame first */
+	int			frame_head;		/* index of oldest frame in ring */
+	int			frame_count;		/* number of frames in ring */
 	int			send_rr;		/* RR must be sent next */
 };
 
 typedef struct dms {
 	/* DMS transmission */
 	int			tx_frame_valid;		/* do we have or had a valid frame? */
-	char			tx_frame[127];		/* carries bits of one frame to transmit */
-	int			tx_frame_length;
-	int			tx_frame_pos;
+	uint8_t			tx_frame[16];		/* carries packed bits (MSB first) of one frame to transmit */
+	int			tx_frame_length;	/* number of bits in frame */
+	int			tx_frame_pos;		/* next bit to transmit */
 	uint16_t		rx_sync;		/* shift register to detect sync */
 	double			rx_sync_level[256];	/* level infos */
 	double			rx_sync_quality[256];	/* quality infos */
@@ -50,11 +54,14 @@ typedef struct dms {
 
 int dms_init_sender(nmt_t *nmt);
 void dms_cleanup_sender(nmt_t *nmt);
-int dms_send_bit(nmt_t *nmt);
+int dms_send_bits(nmt_t *nmt, uint8_t *bits, int max);
 void fsk_receive_bit_dms(nmt_t *nmt, int bit, double quality, double level);
 void dms_reset(nmt_t *nmt);
 
+int dms_frames_required(nmt_t *nmt, const uint8_t *data, int length, int eight_bits);
+int dms_frames_free(nmt_t *nmt);
 void dms_send(nmt_t *nmt, const uint8_t *data, int length, int eight_bits);
+void dms_frames_acked(nmt_t *nmt);
 void dms_all_sent(nmt_t *nmt);
 void dms_receive(nmt_t *nmt, const uint8_t *data, int length, int eight_bits);
 
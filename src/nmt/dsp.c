@@ -101,8 +101,8 @@ void dsp_init(void)
 	compandor_init();
 }
 
-static int fsk_send_bit(void *inst);
-static void fsk_receive_bit(void *inst, int bit, double quality, double level);
+static int fsk_send_bits(void *inst, uint8_t *bits, int max);
+static void fsk_receive_bits(void *inst, fsk_rx_ring_t *ring, int pos, int num);
 
 /* Init FSK of transceiver */
 int dsp_init_sender(nmt_t *nmt, double deviation_factor)
@@ -122,14 +122,20 @@ int dsp_init_sender(nmt_t *nmt, double deviation_factor)
 	LOGP(DDSP, LOGL_DEBUG, "Using Supervisory level of %.3f (%.3f KHz deviation @ 4015 Hz)\n", TX_PEAK_SUPER * deviation_factor, 0.3 * deviation_factor);
 
 	/* init fsk */
-	if (fsk_mod_init(&nmt->fsk_mod, nmt, fsk_send_bit, nmt->sender.samplerate, BIT_RATE, F0, F1, TX_PEAK_FSK, 1, 0) < 0) {
+	if (fsk_mod_init(&nmt->fsk_mod, nmt, NULL, nmt->sender.samplerate, BIT_RATE, F0, F1, TX_PEAK_FSK, 1, 0) < 0) {
 		LOGP_CHAN(DDSP, LOGL_ERROR, "FSK init failed!\n");
 		return -EINVAL;
 	}
-	if (fsk_demod_init(&nmt->fsk_demod, nmt, fsk_receive_bit, nmt->sender.samplerate, BIT_RATE, F0, F1, BIT_ADJUST) < 0) {
+	fsk_mod_set_send_bits(&nmt->fsk_mod, fsk_send_bits);
+	if (fsk_demod_init(&nmt->fsk_demod, nmt, NULL, nmt->sender.samplerate, BIT_RATE, F0, F1, BIT_ADJUST) < 0) {
 		LOGP_CHAN(DDSP, LOGL_ERROR, "FSK init failed!\n");
 		return -EINVAL;
 	}
+	nmt->rx_ring.bits = nmt->rx_ring_bits;
+	nmt->rx_ring.level = nmt->rx_ring_level;
+	nmt->rx_ring.quality = nmt->rx_ring_quality;
+	nmt->rx_ring.size = RX_RING_SIZE;
+	fsk_demod_set_receive_bits(&nmt->fsk_demod, fsk_receive_bits, &nmt->rx_ring);
 
 	/* allocate ring buffer for SAT signal detection
 	 * the bandwidth of the Goertzel filter is the reciprocal of the duration
@@ -181,79 +187,114 @@ void dsp_cleanup_sender(nmt_t *nmt)
 	}
 }
 
-/* Check for SYNC bits, then collect data bits */
-static void fsk_receive_bit(void *inst, int bit, double quality, double level)
+/* Count bits and feed them to the DMS decoder, if DMS is used. */
+static void receive_bits_dms(nmt_t *nmt, fsk_rx_ring_t *ring, int pos, int num)
 {
-	nmt_t *nmt = (nmt_t *)inst;
-	uint64_t frames_elapsed;
-	int i;
+	int bit;
 
-	/* normalize FSK level */
-	level /= TX_PEAK_FSK;
+	if (!nmt->trans || !nmt->trans->dms_call) {
+		nmt->rx_bits_count += num;
+		return;
+	}
 
-	nmt->rx_bits_count++;
+	while (num--) {
+		nmt->rx_bits_count++;
+		/* the transaction may be released by DMS */
+		if (nmt->trans && nmt->trans->dms_call) {
+			bit = (ring->bits[pos >> 3] >> (7 - (pos & 7))) & 1;
+			fsk_receive_bit_dms(nmt, bit, ring->quality[pos], ring->level[pos] / TX_PEAK_FSK);
+		}
+		pos = fsk_rx_ring_pos(ring, pos, 1);
+	}
+}
 
-	if (nmt->trans && nmt->trans->dms_call)
-		fsk_receive_bit_dms(nmt, bit, quality, level);
+/* Search SYNC bits, return number of bits used.
+ * The bits are shifted into the sync register up to 16 bits at a time. Each
+ * position is compared with the sync pattern. Level and quality are only
+ * looked at when the pattern matches.
+ */
+static int receive_sync(nmt_t *nmt, fsk_rx_ring_t *ring, int pos, int num)
+{
+	uint32_t window;
+	double level, quality;
+	int n, chunk, shift, end, i;
+
+	for (n = 0; n < num; n += chunk) {
+		chunk = num - n;
+		if (chunk > 16)
+			chunk = 16;
+		window = ((uint32_t)nmt->rx_sync << chunk) | fsk_rx_ring_word(ring, fsk_rx_ring_pos(ring, pos, n), chunk);
+		for (shift = chunk - 1; shift >= 0; shift--) {
+			/* check if pattern 1010111100010010 matches */
+			if (((window >> shift) & 0xffff) != 0xaf12)
+				continue;
+
+			/* average level and quality */
+			end = fsk_rx_ring_pos(ring, pos, n + chunk - 1 - shift);
+			level = quality = 0;
+			for (i = 0; i < 16; i++) {
+				level += ring->level[fsk_rx_ring_pos(ring, end, -i)] / TX_PEAK_FSK;
+				quality += ring->quality[fsk_rx_ring_pos(ring, end, -i)];
+			}
+			level /= 16.0; quality /= 16.0;
+//			printf("sync (level = %.2f, quality = %.2f\n", level, quality);
 
-//	printf("bit=%d quality=%.4f\n", bit, quality);
-	if (!nmt->rx_in_sync) {
-		nmt->rx_sync = (nmt->rx_sync << 1) | bit;
+			/* do not accept garbage */
+			if (quality < 0.65)
+				continue;
 
-		/* level and quality */
-		nmt->rx_level[nmt->rx_count & 0xff] = level;
-		nmt->rx_quality[nmt->rx_count & 0xff] = quality;
-		nmt->rx_count++;
+			n += chunk - shift;
+			receive_bits_dms(nmt, ring, pos, n);
 
-		/* check if pattern 1010111100010010 matches */
-		if (nmt->rx_sync != 0xaf12)
-			return;
+			/* sync time */
+			nmt->rx_bits_count_last = nmt->rx_bits_count_current;
+			nmt->rx_bits_count_current = nmt->rx_bits_count - 26.0;
 
-		/* average level and quality */
-		level = quality = 0;
-		for (i = 0; i < 16; i++) {
-			level += nmt->rx_level[(nmt->rx_count - 1 - i) & 0xff];
-			quality += nmt->rx_quality[(nmt->rx_count - 1 - i) & 0xff];
-		}
-		level /= 16.0; quality /= 16.0;
-//		printf("sync (level = %.2f, quality = %.2f\n", level, quality);
+			/* rest sync register */
+			nmt->rx_sync = 0;
+			nmt->rx_in_sync = 1;
+			nmt->rx_count = 0;
+			nmt->rx_level_sum = nmt->rx_quality_sum = 0;
 
-		/* do not accept garbage */
-		if (quality < 0.65)
-			return;
+			/* set muting of receive path */
+			nmt->rx_mute = (int)((double)nmt->sender.samplerate * MUTE_DURATION);
+			return n;
+		}
+		nmt->rx_sync = window;
+	}
 
-		/* sync time */
-		nmt->rx_bits_count_last = nmt->rx_bits_count_current;
-		nmt->rx_bits_count_current = nmt->rx_bits_count - 26.0;
+	receive_bits_dms(nmt, ring, pos, num);
+	return num;
+}
 
-		/* rest sync register */
-		nmt->rx_sync = 0;
-		nmt->rx_in_sync = 1;
-		nmt->rx_count = 0;
+/* Collect data bits, return number of bits used. */
+static int receive_frame(nmt_t *nmt, fsk_rx_ring_t *ring, int pos, int num)
+{
+	uint64_t frames_elapsed;
+	double level, quality;
+	int n;
 
-		/* set muting of receive path */
-		nmt->rx_mute = (int)((double)nmt->sender.samplerate * MUTE_DURATION);
-		return;
-	}
+	if (num > 140 - nmt->rx_count)
+		num = 140 - nmt->rx_count;
+	receive_bits_dms(nmt, ring, pos, num);
 
 	/* read bits */
-	nmt->rx_frame[nmt->rx_count] = bit + '0';
-	nmt->rx_level[nmt->rx_count] = level;
-	nmt->rx_quality[nmt->rx_count] = quality;
-	if (++nmt->rx_count != 140)
-		return;
+	for (n = 0; n < num; n++) {
+		nmt->rx_frame[nmt->rx_count++] = ((ring->bits[pos >> 3] >> (7 - (pos & 7))) & 1) + '0';
+		nmt->rx_level_sum += ring->level[pos] / TX_PEAK_FSK;
+		nmt->rx_quality_sum += ring->quality[pos];
+		pos = fsk_rx_ring_pos(ring, pos, 1);
+	}
+	if (nmt->rx_count != 140)
+		return num;
 
 	/* end of frame */
 	nmt->rx_frame[140] = '\0';
 	nmt->rx_in_sync = 0;
 
 	/* average level and quality */
-	level = quality = 0;
-	for (i = 0; i < 140; i++) {
-		level += nmt->rx_level[i];
-		quality += nmt->rx_quality[i];
-	}
-	level /= 140.0; quality /= 140.0;
+	level = nmt->rx_level_sum / 140.0;
+	quality = nmt->rx_quality_sum / 140.0;
 
 	/* update measurements */
 	display_measurements_update(nmt->dmp_frame_level, level * 100.0, 0.0);
@@ -263,6 +304,24 @@ static void fsk_receive_bit(void *inst, int bit, double quality, double level)
 	frames_elapsed = (nmt->rx_bits_count_current - nmt->rx_bits_count_last + 83) / 166; /* round to nearest frame */
 	/* convert level so that received level at TX_PEAK_FSK results in 1.0 (100%) */
 	nmt_receive_frame(nmt, nmt->rx_frame, quality, level, frames_elapsed);
+
+	return num;
+}
+
+/* Search SYNC bits, then collect data bits */
+static void fsk_receive_bits(void *inst, fsk_rx_ring_t *ring, int pos, int num)
+{
+	nmt_t *nmt = (nmt_t *)inst;
+	int n;
+
+	while (num) {
+		if (!nmt->rx_in_sync)
+			n = receive_sync(nmt, ring, pos, num);
+		else
+			n = receive_frame(nmt, ring, pos, num);
+		pos = fsk_rx_ring_pos(ring, pos, n);
+		num -= n;
+	}
 }
 
 /* compare supervisory signal against noise floor around 3895 Hz */
@@ -383,10 +442,13 @@ void sender_receive(sender_t *sender, sample_t *samples, int length, double __at
 		nmt->sender.rxbuf_pos = 0;
 }
 
-static int fsk_send_bit(void *inst)
+/* provide the rest of the current frame as packed bits
+ * the next frame is requested when its first bit is needed */
+static int fsk_send_bits(void *inst, uint8_t *bits, int max)
 {
 	nmt_t *nmt = (nmt_t *)inst;
 	const char *frame;
+	int count = 0;
 
 	/* send frame bit (prio) */
 	if (nmt->dsp_mode == DSP_MODE_FRAME) {
@@ -403,11 +465,16 @@ static int fsk_send_bit(void *inst)
 			nmt->tx_frame_pos = 0;
 		}
 
-		return nmt->tx_frame[nmt->tx_frame_pos++];
+		memset(bits, 0, (max + 7) / 8);
+		while (count < max && nmt->tx_frame_pos < nmt->tx_frame_length) {
+			bits[count >> 3] |= (nmt->tx_frame[nmt->tx_frame_pos++] & 1) << (7 - (count & 7));
+			count++;
+		}
+		return count;
 	}
 
-	/* send dms bit */
-	return dms_send_bit(nmt);
+	/* send dms bits */
+	return dms_send_bits(nmt, bits, max);
 }
 
 /* Generate audio stream with supervisory signal. Keep phase for next call of function. */
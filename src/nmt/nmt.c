@@ -30,6 +30,7 @@
 #include "../libmobile/cause.h"
 #include "../libmobile/get_time.h"
 #include "../libmobile/console.h"
+#include "../libmobile/replay.h"
 #include <osmocom/cc/message.h>
 #include "nmt.h"
 #include "transaction.h"
@@ -50,8 +51,6 @@
  *
  */
 
-static int sms_ref = 0;
-
 /* Timers */
 #define PAGING_TO	1,0	/* wait for paging response: fictive value */
 #define RELEASE_TO	2,0	/* how long do we wait for release guard of the phone */
@@ -312,6 +311,7 @@ int nmt_create(int nmt_system, const char *country, const char *kanal, enum nmt_
 		LOGP(DNMT, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	nmt->sender.destroy = nmt_destroy;
 
 	osmo_timer_setup(&nmt->timer, nmt_timeout, nmt);
 	nmt->sysinfo.system = nmt_system;
@@ -994,7 +994,7 @@ static void rx_mo_dialing(nmt_t *nmt, frame_t *frame)
 			trans->dms_call = 1;
 		} else {
 			LOGP(DNMT, LOGL_INFO, "Setup call to network.\n");
-			trans->callref = call_up_setup(&trans->subscriber.country, nmt->dialing, OSMO_CC_NETWORK_NMT_NONE, "");
+			trans_set_callref(trans, call_up_setup(&trans->subscriber.country, nmt->dialing, OSMO_CC_NETWORK_NMT_NONE, ""));
 		}
 		osmo_timer_del(&nmt->timer);
 		nmt_new_state(nmt, STATE_MO_COMPLETE);
@@ -1132,7 +1132,7 @@ static void tx_mt_channel(nmt_t *nmt, frame_t *frame)
 		LOGP_CHAN(DNMT, LOGL_NOTICE, "TC is not free anymore.\n");
 		LOGP(DNMT, LOGL_INFO, "Release call towards network.\n");
 		call_up_release(trans->callref, CAUSE_NOCHANNEL);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 		nmt_release(nmt);
 		/* send idle for now, then continue with release */
 		tx_idle(nmt, frame);
@@ -1343,7 +1343,7 @@ static void tx_mt_complete(nmt_t *nmt, frame_t *frame)
 		}
 		if (trans->dms_call) {
 			time_t ti = time(NULL);
-			sms_deliver(nmt, sms_ref, trans->caller_id, trans->caller_type, SMS_PLAN_ISDN_TEL, ti, 1, trans->sms_string);
+			sms_deliver(nmt, trans->caller_id, trans->caller_type, SMS_PLAN_ISDN_TEL, ti, 1, trans->sms_string);
 		}
 	}
 }
@@ -1355,7 +1355,7 @@ static void timeout_mt_ringing(nmt_t *nmt)
 	LOGP_CHAN(DNMT, LOGL_NOTICE, "Timeout while waiting for answer of the phone.\n");
 	LOGP(DNMT, LOGL_INFO, "Release call towards network.\n");
 	call_up_release(trans->callref, CAUSE_NOANSWER);
-	trans->callref = 0;
+	trans_set_callref(trans, 0);
 	nmt_release(nmt);
 }
 
@@ -1455,7 +1455,7 @@ static void timeout_active(nmt_t *nmt, int duration)
 		LOGP_CHAN(DNMT, LOGL_NOTICE, "Timeout after %d seconds loosing supervisory signal.\n", duration);
 	LOGP_CHAN(DNMT, LOGL_INFO, "Release call towards network.\n");
 	call_up_release(trans->callref, CAUSE_TEMPFAIL);
-	trans->callref = 0;
+	trans_set_callref(trans, 0);
 	nmt_release(nmt);
 }
 
@@ -1600,6 +1600,8 @@ void nmt_receive_frame(nmt_t *nmt, const char *bits, double quality, double leve
 		return;
 	}
 
+	replay_event(nmt->sender.kanal, "frame %s %s", nmt_frame_name(frame.mt), bits);
+
 	/* frame counter */
 	nmt->rx_frame_count += frames_elapsed;
 
@@ -1632,7 +1634,7 @@ void nmt_receive_frame(nmt_t *nmt, const char *bits, double quality, double leve
 		if (nmt->trans->callref) {
 			LOGP(DNMT, LOGL_INFO, "Release call towards network.\n");
 			call_up_release(nmt->trans->callref, CAUSE_NORMAL);
-			nmt->trans->callref = 0;
+			trans_set_callref(nmt->trans, 0);
 		}
 		return;
 	}
@@ -1846,7 +1848,7 @@ static int _out_setup(int callref, const char *caller_id, enum number_type calle
 		LOGP(DNMT, LOGL_NOTICE, "Failed to create transaction, rejecting!\n");
 		return -CAUSE_TEMPFAIL;
 	}
-	trans->callref = callref;
+	trans_set_callref(trans, callref);
 	if (sms) {
 		strncpy(trans->sms_string, sms, sizeof(trans->sms_string) - 1);
 	}
@@ -1866,6 +1868,28 @@ int call_down_setup(int callref, const char *caller_id, enum number_type caller_
 }
 static int sms_out_setup(char *dialing, const char *caller_id, enum number_type caller_type, const char *sms)
 {
+	nmt_subscriber_t subscr;
+	transaction_t *trans;
+	nmt_t *nmt;
+	char caller[sizeof(trans->caller_id)];
+
+	/* if messages are delivered to the mobile station, queue this message */
+	memset(&subscr, 0, sizeof(subscr));
+	if (!dialstring2number(dialing, &subscr.country, subscr.number)) {
+		trans = get_transaction_by_number(&subscr);
+		nmt = (trans) ? trans->nmt : NULL;
+		if (nmt && trans->dms_call && trans->sms_string[0] && nmt->state == STATE_ACTIVE) {
+			LOGP_CHAN(DNMT, LOGL_INFO, "Queue SMS behind %d messages to this mobile station.\n", sms_queue_depth(nmt));
+			if (caller_type == TYPE_INTERNATIONAL) {
+				caller[0] = '+'; /* not done by phone */
+				strncpy(caller + 1, caller_id, sizeof(caller) - 2);
+			} else
+				strncpy(caller, caller_id, sizeof(caller) - 1);
+			caller[sizeof(caller) - 1] = '\0';
+			return sms_deliver(nmt, caller, caller_type, SMS_PLAN_ISDN_TEL, time(NULL), 1, sms);
+		}
+	}
+
 	return _out_setup(0, caller_id, caller_type, dialing, sms);
 }
 
@@ -1894,7 +1918,7 @@ void call_down_disconnect(int callref, int cause)
 
 	if (!nmt) {
 		call_up_release(callref, cause);
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 		destroy_transaction(trans);
 		return;
 	}
@@ -1905,12 +1929,12 @@ void call_down_disconnect(int callref, int cause)
 	switch (nmt->state) {
 	case STATE_MT_RINGING:
 		LOGP_CHAN(DNMT, LOGL_NOTICE, "Outgoing disconnect, during ringing, releasing!\n");
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 	 	nmt_release(nmt);
 		break;
 	default:
 		LOGP_CHAN(DNMT, LOGL_NOTICE, "Outgoing disconnect, when phone is in call setup, releasing!\n");
-		trans->callref = 0;
+		trans_set_callref(trans, 0);
 	 	nmt_release(nmt);
 		break;
 	}
@@ -1934,7 +1958,7 @@ void call_down_release(int callref, int __attribute__((unused)) cause)
 	}
 	nmt = trans->nmt;
 
-	trans->callref = 0;
+	trans_set_callref(trans, 0);
 
 	if (!nmt) {
 		destroy_transaction(trans);
@@ -1988,10 +2012,8 @@ void sms_deliver_report(nmt_t *nmt, uint8_t ref, int error, uint8_t cause)
 	LOGP_CHAN(DNMT, LOGL_NOTICE, "Got SMS deliver report (ref=%d)\n", ref);
 	if (error)
 		printf("SMS failed! (cause=%d)\n", cause);
-	else {
-		sms_ref++;
+	else
 		printf("SMS sent!\n");
-	}
 }
 
 /* application sends ud a message, we need to deliver */
@@ -2049,5 +2071,11 @@ inval:
 	}
 }
 
-void dump_info(void) {}
+void dump_info(void)
+{
+	sender_t *sender;
+
+	for (sender = sender_head; sender; sender = sender->next)
+		sms_dump_statistics((nmt_t *)sender);
+}
 
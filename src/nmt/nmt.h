@@ -9,6 +9,7 @@ typedef struct nmt nmt_t;
 #include "dms.h"
 #include "sms.h"
 
+#define RX_RING_SIZE		256	/* bits in ring of FSK demodulator */
 
 enum dsp_mode {
 	DSP_MODE_SILENCE,	/* stream nothing */
@@ -117,13 +118,17 @@ struct nmt {
 	int			super_print;		/* counts when to print result */
 	double			dial_phaseshift65536;	/* how much the phase of sine wave changes per sample */
 	double			dial_phase65536;	/* current phase */
-	uint16_t		rx_sync;		/* shift register to detect sync */
+	fsk_rx_ring_t		rx_ring;		/* received bits from FSK demodulator */
+	uint8_t			rx_ring_bits[RX_RING_SIZE / 8];
+	double			rx_ring_level[RX_RING_SIZE];
+	double			rx_ring_quality[RX_RING_SIZE];
+	uint16_t		rx_sync;		/* last 16 bits, to detect sync */
 	int			rx_in_sync;		/* if we are in sync and receive bits */
 	int			rx_mute;		/* mute count down after sync */
 	char			rx_frame[141];		/* receive frame (one extra byte to terminate string) */
 	int			rx_count;		/* next bit to receive */
-	double			rx_level[256];		/* level infos */
-	double			rx_quality[256];	/* quality infos */
+	double			rx_level_sum;		/* sum of level of received frame bits */
+	double			rx_quality_sum;		/* sum of quality of received frame bits */
 	uint64_t		rx_bits_count;		/* sample counter */
 	uint64_t		rx_bits_count_current;	/* sample counter of current frame */
 	uint64_t		rx_bits_count_last;	/* sample counter of last frame */
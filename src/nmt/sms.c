@@ -25,6 +25,7 @@
 #include <errno.h>
 #include "../libsample/sample.h"
 #include "../liblogging/logging.h"
+#include "../libmobile/get_time.h"
 #include "nmt.h"
 
 #define SMS_RECEIVE_TO		5,0
@@ -81,6 +82,9 @@
 #define RP_SM_NO_MESSAGE	0x07	/* SC -> MS */
 #define RP_MTI_MASK		0x07
 
+/* RP-Cause */
+#define RP_CAUSE_TEMP_FAILURE	0x29
+
 /* RP IEs */
 #define RP_IE_USER_DATA		0x41 /* wrong in NMT Doc.450-3 1998-04-03 */
 #define RP_IE_CAUSE		0x42
@@ -285,10 +289,40 @@ static int encode_userdata(uint8_t *data, const char *message)
 	return length;
 }
 
-/* deliver SMS (SC->MS) */
-int sms_deliver(nmt_t *nmt, uint8_t ref, const char *orig_address, uint8_t orig_type, uint8_t orig_plan, time_t timestamp, int local, const char *message)
+/* pass queued messages to DMS layer, as long as there is space for their
+ * frames. so the transmission of the next message follows the previous
+ * message without waiting for its report. */
+static void sms_queue_send(nmt_t *nmt)
+{
+	sms_t *sms = &nmt->sms;
+	struct sms_queue_entry *entry;
+
+	while (sms->queue_sent < sms->queue_count) {
+		entry = &sms->queue[(sms->queue_head + sms->queue_sent) % SMS_QUEUE_SIZE];
+		if (dms_frames_required(nmt, entry->data, entry->length, 1) > dms_frames_free(nmt))
+			break;
+		LOGP(DSMS, LOGL_DEBUG, "Passing SMS (ref=%d) to DMS layer\n", entry->ref);
+		dms_send(nmt, entry->data, entry->length, 1);
+		sms->queue_sent++;
+		/* (re)start timer, the mobile station has the full time for each message */
+		osmo_timer_schedule(&nmt->sms_timer, SMS_RECEIVE_TO);
+	}
+}
+
+/* number of messages that are queued or wait for their report */
+int sms_queue_depth(nmt_t *nmt)
+{
+	return nmt->sms.queue_count;
+}
+
+/* deliver SMS (SC->MS)
+ * the message is queued, if previous messages are not yet reported.
+ * each message gets its own reference, the report is matched against it. */
+int sms_deliver(nmt_t *nmt, const char *orig_address, uint8_t orig_type, uint8_t orig_plan, time_t timestamp, int local, const char *message)
 {
-	uint8_t data[256], *tpdu_length;
+	sms_t *sms = &nmt->sms;
+	struct sms_queue_entry *entry;
+	uint8_t data[256], *tpdu_length, ref;
 	int length = 0;
 	int orig_len;
 	int msg_len;
@@ -306,6 +340,13 @@ int sms_deliver(nmt_t *nmt, uint8_t ref, const char *orig_address, uint8_t orig_
 		LOGP(DSMS, LOGL_NOTICE, "Message too long (%d characters)\n", msg_len);
 		return -EINVAL;
 	}
+	if (sms->queue_count == SMS_QUEUE_SIZE) {
+		LOGP(DSMS, LOGL_NOTICE, "Too many messages queued (%d messages)\n", sms->queue_count);
+		return -EBUSY;
+	}
+
+	/* reference 1..255, because a trailing 0 of the report would be removed by DMS layer */
+	ref = sms->last_ref % 255 + 1;
 
 	/* HEADER */
 	length = encode_header(data);
@@ -328,11 +369,19 @@ int sms_deliver(nmt_t *nmt, uint8_t ref, const char *orig_address, uint8_t orig_
 	*tpdu_length = length - (uint8_t)(tpdu_length - data) - 1;
 	LOGP(DSMS, LOGL_DEBUG, " -> TPDU length = %d\n", *tpdu_length);
 
-	nmt->sms.mt = 1;
-	dms_send(nmt, data, length, 1);
+	/* queue message */
+	entry = &sms->queue[(sms->queue_head + sms->queue_count) % SMS_QUEUE_SIZE];
+	memcpy(entry->data, data, length);
+	entry->length = length;
+	entry->ref = ref;
+	entry->queued = get_time();
+	sms->queue_count++;
+	sms->last_ref = ref;
+	if (sms->queue_count > sms->stat.queue_depth_max)
+		sms->stat.queue_depth_max = sms->queue_count;
 
-	/* start timer */
-	osmo_timer_schedule(&nmt->sms_timer, SMS_RECEIVE_TO);
+	sms->mt = 1;
+	sms_queue_send(nmt);
 
 	return 0;
 }
@@ -576,8 +625,12 @@ static int decode_sms_submit(nmt_t *nmt, const uint8_t *data, int length)
  * return 1 if done, -1 if failed, 0, if more data is required */
 static int decode_deliver_report(nmt_t *nmt, const uint8_t *data, int length)
 {
+	sms_t *sms = &nmt->sms;
+	struct sms_queue_entry entry;
 	uint8_t ref, cause = 0;
 	int error = 0;
+	double latency;
+	int i;
 
 	ref = data[1];
 
@@ -597,6 +650,36 @@ static int decode_deliver_report(nmt_t *nmt, const uint8_t *data, int length)
 	} else
 		LOGP(DSMS, LOGL_INFO, "Received Delivery report: OK\n");
 
+	/* the report of the next message will follow */
+	sms->rx_count = 0;
+
+	/* find the message that has been sent with this reference */
+	for (i = 0; i < sms->queue_sent; i++) {
+		if (sms->queue[(sms->queue_head + i) % SMS_QUEUE_SIZE].ref == ref)
+			break;
+	}
+	if (i == sms->queue_sent) {
+		LOGP(DSMS, LOGL_NOTICE, "Report has ref=%d, but no message with this reference waits for a report, ignoring\n", ref);
+		return 1;
+	}
+	entry = sms->queue[(sms->queue_head + i) % SMS_QUEUE_SIZE];
+	if (i)
+		LOGP(DSMS, LOGL_NOTICE, "Report with ref=%d is out of order, %d older messages wait for a report\n", ref, i);
+
+	/* remove message, the older messages move up */
+	for (; i > 0; i--)
+		sms->queue[(sms->queue_head + i) % SMS_QUEUE_SIZE] = sms->queue[(sms->queue_head + i - 1) % SMS_QUEUE_SIZE];
+	sms->queue_head = (sms->queue_head + 1) % SMS_QUEUE_SIZE;
+	sms->queue_count--;
+	sms->queue_sent--;
+
+	latency = get_time() - entry.queued;
+	sms->stat.delivered++;
+	sms->stat.latency_sum += latency;
+	if (latency > sms->stat.latency_max)
+		sms->stat.latency_max = latency;
+	LOGP(DSMS, LOGL_INFO, "Message delivered after %.3f seconds, %d messages left in queue\n", latency, sms->queue_count);
+
 	sms_deliver_report(nmt, ref, error, cause);
 
 	return 1;
@@ -620,8 +703,8 @@ void dms_receive(nmt_t *nmt, const uint8_t *data, int length, int __attribute__(
 
 	LOGP(DSMS, LOGL_DEBUG, "Received %d bytes from DMS layer:%s\n", length, debug_text);
 
-	if (sms->mt && !sms->data_sent) {
-		LOGP(DSMS, LOGL_NOTICE, "Ignoring data while we transmit data\n");
+	if (sms->mt && !sms->queue_sent) {
+		LOGP(DSMS, LOGL_NOTICE, "Ignoring data while no message waits for a report\n");
 		return;
 	}
 
@@ -645,10 +728,13 @@ release:
 		return;
 	switch (data[0] & RP_MTI_MASK) {
 	case RP_MT_ACK:
-		rc = decode_deliver_report(nmt, data, length);
-		break;
 	case RP_MT_ERROR:
 		rc = decode_deliver_report(nmt, data, length);
+		/* A complete report releases the connection, unless more
+		 * messages are queued. Then the connection is kept and the
+		 * receive timer (restarted above) waits for the next report. */
+		if (rc > 0 && sms->queue_count)
+			rc = 0;
 		break;
 	case RP_MO_DATA:
 		rc = decode_sms_submit(nmt, data, length);
@@ -682,6 +768,13 @@ static void sms_timeout(void *data)
 	sms_release(nmt);
 }
 
+/* DMS layer has space for frames again */
+void dms_frames_acked(nmt_t *nmt)
+{
+	if (nmt->sms.mt)
+		sms_queue_send(nmt);
+}
+
 /* all data has been sent to mobile */
 void dms_all_sent(nmt_t *nmt)
 {
@@ -700,10 +793,33 @@ void dms_all_sent(nmt_t *nmt)
 void sms_reset(nmt_t *nmt)
 {
 	sms_t *sms = &nmt->sms;
+	struct sms_statistics stat;
+	uint8_t ref;
 
 	LOGP(DSMS, LOGL_DEBUG, "Resetting SMS states\n");
 	osmo_timer_del(&nmt->sms_timer);
 
+	/* messages that are accepted, but not reported, fail */
+	while (sms->queue_count) {
+		ref = sms->queue[sms->queue_head].ref;
+		LOGP(DSMS, LOGL_NOTICE, "Message (ref=%d) was not delivered before release\n", ref);
+		sms->queue_head = (sms->queue_head + 1) % SMS_QUEUE_SIZE;
+		sms->queue_count--;
+		sms->stat.undelivered++;
+		sms_deliver_report(nmt, ref, 1, RP_CAUSE_TEMP_FAILURE);
+	}
+	if (sms->stat.delivered || sms->stat.undelivered)
+		sms_dump_statistics(nmt);
+
+	stat = sms->stat;
 	memset(sms, 0, sizeof(*sms));
+	sms->stat = stat;
+}
+
+void sms_dump_statistics(nmt_t *nmt)
+{
+	struct sms_statistics *stat = &nmt->sms.stat;
+
+	LOGP(DSMS, LOGL_NOTICE, "SMS statistics of channel %s: %d delivered, %d undelivered, latency %.3f seconds average, %.3f seconds max, queue depth %d max\n", nmt->sender.kanal, stat->delivered, stat->undelivered, (stat->delivered) ? stat->latency_sum / (double)stat->delivered : 0.0, stat->latency_max, stat->queue_depth_max);
 }
 
@@ -17,18 +17,47 @@
 #define SMS_PLAN_ERMES		0xa
 #define SMS_PLAN_RESERVED	0xf
 
+#define SMS_QUEUE_SIZE		16
+
+/* encoded message to be delivered */
+struct sms_queue_entry {
+	uint8_t			data[256];
+	int			length;
+	uint8_t			ref;
+	double			queued;				/* time when message was queued */
+};
+
+/* statistics of delivered messages, kept across connections */
+struct sms_statistics {
+	int			queue_depth_max;		/* most messages queued at once */
+	int			delivered;			/* messages that got a report */
+	int			undelivered;			/* messages dropped on release */
+	double			latency_sum;			/* time from queueing until report */
+	double			latency_max;
+};
+
 typedef struct sms {
 	uint8_t			rx_buffer[1024];		/* data received from MS */
 	int			rx_count;			/* number of bytes in buffer */
 	int			data_sent;			/* all pending data have been sent and was acked */
 	int			mt;				/* mobile terminating SMS */
+
+	/* messages to deliver, oldest first */
+	struct sms_queue_entry	queue[SMS_QUEUE_SIZE];
+	int			queue_head;			/* index of oldest message */
+	int			queue_count;			/* messages that are not yet reported */
+	int			queue_sent;			/* messages that have been passed to DMS layer */
+	uint8_t			last_ref;			/* reference of last queued message */
+	struct sms_statistics	stat;
 } sms_t;
 
 int sms_init_sender(nmt_t *nmt);
 void sms_cleanup_sender(nmt_t *nmt);
 int sms_submit(nmt_t *nmt, uint8_t ref, const char *orig_address, uint8_t orig_type, uint8_t orig_plan, int msg_ref, const char *dest_address, uint8_t dest_type, uint8_t dest_plan, const char *message);
 void sms_deliver_report(nmt_t *nmt, uint8_t ref, int error, uint8_t cause);
-int sms_deliver(nmt_t *nmt, uint8_t ref, const char *orig_address, uint8_t type, uint8_t plan, time_t timestamp, int local, const char *message);
+int sms_deliver(nmt_t *nmt, const char *orig_address, uint8_t type, uint8_t plan, time_t timestamp, int local, const char *message);
+int sms_queue_depth(nmt_t *nmt);
 void sms_release(nmt_t *nmt);
 void sms_reset(nmt_t *nmt);
+void sms_dump_statistics(nmt_t *nmt);
 
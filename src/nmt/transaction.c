@@ -27,8 +27,21 @@
 #include "transaction.h"
 
 static transaction_t *trans_list = NULL;
+static trans_index_t trans_index;
 static void transaction_timeout(void *data);
 
+/* country digit and number digits as one value */
+static uint64_t subscriber_id(struct nmt_subscriber *subscr)
+{
+	uint64_t id = subscr->country;
+	int i;
+
+	for (i = 0; i < (int)sizeof(subscr->number) && subscr->number[i]; i++)
+		id = (id << 8) | (uint8_t)subscr->number[i];
+
+	return id;
+}
+
 /* link transaction to list */
 static void link_transaction(transaction_t *trans)
 {
@@ -41,6 +54,7 @@ static void link_transaction(transaction_t *trans)
 	while (*transp)
 		transp = &((*transp)->next);
 	*transp = trans;
+	trans_index_link(&trans_index, &trans->index, trans, subscriber_id(&trans->subscriber), trans->callref);
 }
 
 /* unlink transaction from list */
@@ -61,6 +75,7 @@ static void unlink_transaction(transaction_t *trans)
 	}
 	*transp = trans->next;
 	trans->next = NULL;
+	trans_index_unlink(&trans_index, &trans->index);
 
 	/* unbind from channel */
 	trans->nmt = NULL;
@@ -113,32 +128,30 @@ static void transaction_timeout(void *data)
 	timeout_mt_paging(trans);
 }
 
-transaction_t *get_transaction_by_callref(int callref)
+/* set callref and keep index up to date */
+void trans_set_callref(transaction_t *trans, int callref)
 {
-	transaction_t *trans;
-
-	trans = trans_list;
-	while (trans) {
-		if (trans->callref == callref)
-			break;
-		trans = trans->next;
-	}
+	trans->callref = callref;
+	trans_index_callref(&trans_index, &trans->index, callref);
+}
 
-	return trans;
+transaction_t *get_transaction_by_callref(int callref)
+{
+	return trans_index_by_callref(&trans_index, callref);
 }
 
 transaction_t *get_transaction_by_number(struct nmt_subscriber *subscr)
 {
+	trans_index_node_t *node;
 	transaction_t *trans;
 
-	trans = trans_list;
-	while (trans) {
+	for (node = trans_index_first_id(&trans_index, subscriber_id(subscr)); node; node = trans_index_next_id(node)) {
+		trans = node->trans;
 		if (trans->subscriber.country == subscr->country
 		 && !strcmp(trans->subscriber.number, subscr->number))
-			break;
-		trans = trans->next;
+			return trans;
 	}
 
-	return trans;
+	return NULL;
 }
 
@@ -1,3 +1,4 @@
+#include "../libmobile/trans_index.h"
 
 /* info about subscriber */
 typedef struct nmt_subscriber {
@@ -11,6 +12,7 @@ typedef struct nmt_subscriber {
 /* transaction node */
 typedef struct transaction {
 	struct transaction	*next;			/* pointer to next node in list */
+	trans_index_node_t	index;			/* node of transaction index */
 	nmt_t			*nmt;			/* pointer to nmt instance, if bound to a channel */
 	int			callref;		/* callref for transaction */
 	struct nmt_subscriber	subscriber;
@@ -30,4 +32,5 @@ transaction_t *create_transaction(struct nmt_subscriber *subscriber);
 void destroy_transaction(transaction_t *trans);
 transaction_t *get_transaction_by_callref(int callref);
 transaction_t *get_transaction_by_number(struct nmt_subscriber *subscr);
+void trans_set_callref(transaction_t *trans, int callref);
 
@@ -172,14 +172,20 @@ static int fsk_block_encode(pocsag_t *pocsag, uint32_t word)
 
 static void fsk_block_decode(pocsag_t *pocsag, uint8_t bit)
 {
+	int errors;
+
 	if (!pocsag->fsk_rx_sync) {
 		pocsag->fsk_rx_word = (pocsag->fsk_rx_word << 1) | bit;
-		if (pocsag->fsk_rx_word == CODEWORD_SYNC) {
-			put_codeword(pocsag, pocsag->fsk_rx_word, -1, -1);
+		/* accept sync word with up to the given number of bit errors */
+		errors = __builtin_popcount(pocsag->fsk_rx_word ^ CODEWORD_SYNC);
+		if (errors <= pocsag->fsk_rx_sync_distance) {
+			if (errors)
+				LOGP_CHAN(DDSP, LOGL_DEBUG, "Received sync with %d bit error(s).\n", errors);
+			put_codeword(pocsag, CODEWORD_SYNC, -1, -1);
 			pocsag->fsk_rx_sync = 16;
 			pocsag->fsk_rx_index = 0;
 		} else
-		if (pocsag->fsk_rx_word == (uint32_t)(~CODEWORD_SYNC))
+		if (32 - errors <= pocsag->fsk_rx_sync_distance)
 			LOGP_CHAN(DDSP, LOGL_NOTICE, "Received inverted sync, caused by wrong polarity or by radio noise. Verify correct polarity!\n");
 	} else {
 		pocsag->fsk_rx_word = (pocsag->fsk_rx_word << 1) | bit;
@@ -191,7 +197,7 @@ static void fsk_block_decode(pocsag_t *pocsag, uint8_t bit)
 	}
 }
 
-static void fsk_decode(pocsag_t *pocsag, sample_t *spl, int length)
+void fsk_decode(pocsag_t *pocsag, sample_t *spl, int length)
 {
 	double phase, bitstep, polarity;
 	int i;
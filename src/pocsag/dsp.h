@@ -1,4 +1,5 @@
 
 int dsp_init_sender(pocsag_t *pocsag, int samplerate, int baudrate, double deviation, double polarity);
 void dsp_cleanup_sender(pocsag_t *pocsag);
+void fsk_decode(pocsag_t *pocsag, sample_t *spl, int length);
 
@@ -34,6 +34,7 @@
 #define CODEWORD_SYNC		0x7cd215d8
 #define CODEWORD_IDLE		0x7a89c197
 #define IDLE_BATCHES		2
+#define SELECT_CANDIDATES	8	/* number of msgs that are checked for best packing */
 
 static const char numeric[16] = "0123456789RU -][";
 static const char hex[16] = "0123456789abcdef";
@@ -174,26 +175,102 @@ static uint32_t pocsag_parity(uint32_t word)
 	return word & 1;
 }
 
-static int debug_word(uint32_t word, int slot)
+/* BCH(31,21) generator polynomial x^10 + x^9 + x^8 + x^6 + x^5 + x^3 + 1 */
+#define BCH_POLY		0x769
+
+static uint16_t bch_syndrome_tab[4][256];	/* syndrome of each byte of the 31 bit code word */
+static uint32_t bch_error_tab[1024];		/* error pattern of each syndrome, 0 if not correctable */
+static int bch_init = 0;
+
+/* remainder of 31 bit code word (without parity bit) */
+static uint16_t bch_remainder(uint32_t word)
+{
+	int i;
+
+	for (i = 30; i >= 10; i--) {
+		if ((word >> i) & 1)
+			word ^= BCH_POLY << (i - 10);
+	}
+
+	return word & 0x3ff;
+}
+
+/* Create syndrome tables, so that codewords can be corrected by lookup. */
+void init_frame(void)
+{
+	uint32_t error;
+	uint16_t syndrome;
+	int i, j, b;
+
+	for (i = 0; i < 4; i++) {
+		for (b = 0; b < 256; b++)
+			bch_syndrome_tab[i][b] = bch_remainder((uint32_t)b << (i * 8));
+	}
+
+	/* every single and double bit error has a unique syndrome */
+	memset(bch_error_tab, 0, sizeof(bch_error_tab));
+	for (i = 0; i < 31; i++) {
+		for (j = i; j < 31; j++) {
+			error = (1 << i) | (1 << j);
+			syndrome = bch_remainder(error);
+			if (bch_error_tab[syndrome]) {
+				LOGP(DPOCSAG, LOGL_ERROR, "Syndrome 0x%03x is not unique, please fix!\n", syndrome);
+				abort();
+			}
+			bch_error_tab[syndrome] = error << 1;
+		}
+	}
+
+	bch_init = 1;
+}
+
+/* Correct up to two bit errors in codeword.
+ * return number of corrected bits or -EINVAL if not correctable */
+int correct_codeword(uint32_t *word)
 {
-	if (pocsag_crc(word >> 11) != ((word >> 1) & 0x3ff)) {
-		LOGP(DPOCSAG, LOGL_NOTICE, "CRC error in codeword 0x%08x.\n", word);
-		return -EINVAL;
+	uint32_t w = *word, error;
+	uint16_t syndrome;
+	int errors = 0;
+
+	if (!bch_init) {
+		LOGP(DPOCSAG, LOGL_ERROR, "Syndrome tables are not initialized, please fix!\n");
+		abort();
+	}
+
+	syndrome = bch_syndrome_tab[0][(w >> 1) & 0xff]
+		 ^ bch_syndrome_tab[1][(w >> 9) & 0xff]
+		 ^ bch_syndrome_tab[2][(w >> 17) & 0xff]
+		 ^ bch_syndrome_tab[3][w >> 25];
+	if (syndrome) {
+		error = bch_error_tab[syndrome];
+		if (!error)
+			return -EINVAL;
+		w ^= error;
+		errors = (error & (error - 1)) ? 2 : 1;
 	}
 
-	if (pocsag_parity(word)) {
-		LOGP(DPOCSAG, LOGL_NOTICE, "Parity error in codeword 0x%08x.\n", word);
-		return -EINVAL;
+	/* if parity fails, the parity bit itself is wrong */
+	if (pocsag_parity(w)) {
+		if (errors == 2)
+			return -EINVAL;
+		w ^= 1;
+		errors++;
 	}
 
+	*word = w;
+	return errors;
+}
+
+static void debug_word(uint32_t word, int slot)
+{
 	if (word == CODEWORD_SYNC) {
 		LOGP(DPOCSAG, LOGL_DEBUG, "-> valid sync word\n");
-		return 0;
+		return;
 	}
 
 	if (word == CODEWORD_IDLE) {
 		LOGP(DPOCSAG, LOGL_DEBUG, "-> valid idle word\n");
-		return 0;
+		return;
 	}
 
 	if (!(word & 0x80000000)) {
@@ -201,8 +278,6 @@ static int debug_word(uint32_t word, int slot)
 	} else {
 		LOGP(DPOCSAG, LOGL_DEBUG, "-> valid message word: message = '0x%05x'\n", (word >> 11) & 0xfffff);
 	}
-
-	return 0;
 }
 
 static uint32_t encode_address(pocsag_msg_t *msg)
@@ -359,49 +434,105 @@ static void decode_hex(pocsag_t *pocsag, uint32_t word)
 	}
 }
 
-/* get codeword from scheduler */
-int64_t get_codeword(pocsag_t *pocsag)
+/* number of codewords to transmit msg, including address codeword */
+static int msg_words(pocsag_msg_t *msg)
 {
-	pocsag_msg_t *msg;
-	uint32_t word = 0; // make GCC happy
-	uint8_t slot = (pocsag->word_count - 1) >> 1;
-	uint8_t subslot = (pocsag->word_count - 1) & 1;
+	int i, count = 0;
 
-	/* no codeword, if not transmitting */
-	if (!pocsag->tx)
-		return -1;
+	if (msg->words)
+		return msg->words;
 
-	/* transmitter state */
-	switch (pocsag->state) {
-	case POCSAG_IDLE:
-		return -1;
-	case POCSAG_PREAMBLE:
-		if (!pocsag->word_count)
-			LOGP_CHAN(DPOCSAG, LOGL_INFO, "Sending preamble.\n");
-		/* transmit preamble */
-		LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Sending 32 bits of preamble pattern 0x%08x.\n", CODEWORD_PREAMBLE);
-		if (++pocsag->word_count == PREAMBLE_COUNT) {
-			pocsag_new_state(pocsag, POCSAG_MESSAGE);
-			pocsag->word_count = 0; 
-			pocsag->idle_count = 0;
+	switch (msg->function) {
+	case POCSAG_FUNCTION_NUMERIC:
+		for (i = 0; i < msg->data_length; i++) {
+			if (memchr(numeric, msg->data[i], sizeof(numeric)))
+				count++;
 		}
-		word =  CODEWORD_PREAMBLE;
+		msg->words = 1 + ((count) ? (count + 4) / 5 : 1);
 		break;
-	case POCSAG_MESSAGE:
-		if (!pocsag->word_count)
-			LOGP_CHAN(DPOCSAG, LOGL_INFO, "Sending batch.\n");
-		/* send sync */
-		if (pocsag->word_count == 0) {
-			LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Sending 32 bits of sync pattern 0x%08x.\n", CODEWORD_SYNC);
-			/* count codewords */
-			++pocsag->word_count;
-			word = CODEWORD_SYNC;
+	case POCSAG_FUNCTION_ALPHA:
+		for (i = 0; i < msg->data_length; i++) {
+			if (!(msg->data[i] & 0x80))
+				count++;
+		}
+		msg->words = 1 + ((count) ? (count * 7 + 19) / 20 : 1);
+		break;
+	default:
+		msg->words = 1;
+	}
+
+	return msg->words;
+}
+
+/* Count idle codewords until end of batch, if given msg starts at given
+ * position and all following positions are filled first come, first served.
+ */
+static int simulate_batch(pocsag_t *pocsag, int position, pocsag_msg_t *first)
+{
+	pocsag_msg_t *next[8];
+	int busy, idle = 0, frame;
+
+	memcpy(next, pocsag->frame_queue, sizeof(next));
+	busy = msg_words(first);
+	for (; position <= 16; position++) {
+		if (busy) {
+			busy--;
+			continue;
+		}
+		frame = (position - 1) >> 1;
+		while (next[frame] == first)
+			next[frame] = first->frame_next;
+		if (!next[frame]) {
+			idle++;
+			continue;
+		}
+		busy = msg_words(next[frame]) - 1;
+		next[frame] = next[frame]->frame_next;
+	}
+
+	return idle;
+}
+
+/* Select msg to start at given position of batch. If packing is enabled,
+ * all msgs with the highest priority of this frame are candidates. The one
+ * that leaves fewest idle codewords in the rest of the batch is selected.
+ */
+static pocsag_msg_t *select_msg(pocsag_t *pocsag, int position)
+{
+	pocsag_msg_t *head, *msg, *best;
+	int idle, best_idle, n;
+
+	head = pocsag->frame_queue[(position - 1) >> 1];
+	if (!head || !pocsag->packing)
+		return head;
+
+	best = head;
+	best_idle = simulate_batch(pocsag, position, head);
+	for (msg = head->frame_next, n = 1; msg && msg->priority == head->priority && n < SELECT_CANDIDATES; msg = msg->frame_next, n++) {
+		if (!best_idle)
 			break;
+		idle = simulate_batch(pocsag, position, msg);
+		if (idle < best_idle) {
+			best = msg;
+			best_idle = idle;
 		}
+	}
+
+	return best;
+}
+
+/* compose sync and 16 codewords of next batch */
+static void encode_batch(pocsag_t *pocsag)
+{
+	pocsag_msg_t *msg, **msgp;
+	uint32_t word;
+	int position, used = 0;
+
+	pocsag->tx_batch[0] = CODEWORD_SYNC;
+
+	for (position = 1; position <= 16; position++) {
 		/* send message data, if there is an ongoing message */
 		if ((msg = pocsag->current_msg)) {
-			/* reset idle counter */
-			pocsag->idle_count = 0;
 			/* encode data */
 			switch (msg->function) {
 			case POCSAG_FUNCTION_NUMERIC:
@@ -422,24 +553,23 @@ int64_t get_codeword(pocsag_t *pocsag)
 			}
 			/* prevent 'use-after-free' from this point on */
 			msg = NULL;
-			LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Sending 32 bits of message codeword 0x%08x (frame %d.%d).\n", word, slot, subslot);
-			/* count codewords */
-			if (++pocsag->word_count == 17)
-				pocsag->word_count = 0;
-			break;
-		}
-		/* if we are about to send an address codeword, we search for a pending message */
-		for (msg = pocsag->msg_list; msg; msg = msg->next) {
-			/* if a message matches the right time slot */
-			if ((msg->ric & 7) == slot)
-				break;
+			pocsag->tx_batch[position] = word;
+			used++;
+			continue;
 		}
+		/* if we are about to send an address codeword, we search for a pending message of this frame */
+		msg = select_msg(pocsag, position);
 		if (msg) {
 			LOGP_CHAN(DPOCSAG, LOGL_INFO, "Sending message to RIC '%d' / function '%d' (%s)\n", msg->ric, msg->function, pocsag_function_name[msg->function]);
-			/* reset idle counter */
-			pocsag->idle_count = 0;
+			/* remove from frame queue */
+			msgp = &pocsag->frame_queue[msg->ric & 7];
+			while ((*msgp) != msg)
+				msgp = &(*msgp)->frame_next;
+			(*msgp) = msg->frame_next;
+			msg->frame_next = NULL;
 			/* encode address */
-			word = encode_address(msg);
+			pocsag->tx_batch[position] = encode_address(msg);
+			used++;
 			/* link message, if there is data to be sent */
 			if (msg->function == POCSAG_FUNCTION_NUMERIC || msg->function == POCSAG_FUNCTION_ALPHA) {
 				LOGP_CHAN(DPOCSAG, LOGL_INFO, " -> Message text is \"%s\".\n", print_message(msg->data, msg->data_length));
@@ -453,25 +583,70 @@ int64_t get_codeword(pocsag_t *pocsag)
 				/* prevent 'use-after-free' from this point on */
 				msg = NULL;
 			}
-			LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Sending 32 bits of address codeword 0x%08x (frame %d.%d).\n", word, slot, subslot);
-			/* count codewords */
-			if (++pocsag->word_count == 17)
-				pocsag->word_count = 0;
-			break;
+			continue;
 		}
 		/* no message, so we send idle pattern */
-		LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Sending 32 bits of idle pattern 0x%08x (frame %d.%d).\n", CODEWORD_IDLE, slot, subslot);
+		pocsag->tx_batch[position] = CODEWORD_IDLE;
+	}
+
+	/* reset idle counter */
+	if (used)
+		pocsag->idle_count = 0;
+
+	pocsag->tx_batch_used = used;
+	pocsag->tx_words_used += used;
+	pocsag->tx_words_idle += 16 - used;
+	LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Composed batch with %d codewords of traffic and %d idle codewords.\n", used, 16 - used);
+}
+
+/* get codeword from scheduler */
+int64_t get_codeword(pocsag_t *pocsag)
+{
+	uint32_t word = 0; // make GCC happy
+	uint8_t slot = (pocsag->word_count - 1) >> 1;
+	uint8_t subslot = (pocsag->word_count - 1) & 1;
+
+	/* no codeword, if not transmitting */
+	if (!pocsag->tx)
+		return -1;
+
+	/* transmitter state */
+	switch (pocsag->state) {
+	case POCSAG_IDLE:
+		return -1;
+	case POCSAG_PREAMBLE:
+		if (!pocsag->word_count)
+			LOGP_CHAN(DPOCSAG, LOGL_INFO, "Sending preamble.\n");
+		/* transmit preamble */
+		LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Sending 32 bits of preamble pattern 0x%08x.\n", CODEWORD_PREAMBLE);
+		if (++pocsag->word_count == PREAMBLE_COUNT) {
+			pocsag_new_state(pocsag, POCSAG_MESSAGE);
+			pocsag->word_count = 0; 
+			pocsag->idle_count = 0;
+		}
+		word =  CODEWORD_PREAMBLE;
+		break;
+	case POCSAG_MESSAGE:
+		/* the whole batch is composed ahead of transmission */
+		if (pocsag->word_count == 0) {
+			LOGP_CHAN(DPOCSAG, LOGL_INFO, "Sending batch.\n");
+			encode_batch(pocsag);
+		}
+		word = pocsag->tx_batch[pocsag->word_count];
+		if (pocsag->word_count == 0)
+			LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Sending 32 bits of sync pattern 0x%08x.\n", word);
+		else
+			LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Sending 32 bits of codeword 0x%08x (frame %d.%d).\n", word, slot, subslot);
 		/* count codewords */
 		if (++pocsag->word_count == 17) {
 			pocsag->word_count = 0;
 			/* if no message has been scheduled during transmission and idle counter is reached, stop transmitter */
-			if (!pocsag->msg_list && pocsag->idle_count++ == IDLE_BATCHES) {
+			if (word == CODEWORD_IDLE && !pocsag->msg_list && pocsag->idle_count++ == IDLE_BATCHES) {
 				LOGP_CHAN(DPOCSAG, LOGL_INFO, "Transmission done.\n");
 				LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Reached %d of idle batches, turning transmitter off.\n", IDLE_BATCHES);
 				pocsag_new_state(pocsag, POCSAG_IDLE);
 			}
 		}
-		word = CODEWORD_IDLE;
 		break;
 	}
 
@@ -499,6 +674,7 @@ static void done_rx_msg(pocsag_t *pocsag)
 
 void put_codeword(pocsag_t *pocsag, uint32_t word, int8_t slot, int8_t subslot)
 {
+	uint32_t received = word;
 	int rc;
 
 	if (slot < 0 && word == CODEWORD_SYNC) {
@@ -506,6 +682,20 @@ void put_codeword(pocsag_t *pocsag, uint32_t word, int8_t slot, int8_t subslot)
 		return;
 	}
 
+	pocsag->rx_words++;
+	rc = correct_codeword(&word);
+	if (rc < 0) {
+		pocsag->rx_words_failed++;
+		LOGP_CHAN(DPOCSAG, LOGL_NOTICE, "Received codeword 0x%08x with more than two bit errors, dropping.\n", received);
+		done_rx_msg(pocsag);
+		return;
+	}
+	if (rc > 0) {
+		pocsag->rx_words_corrected++;
+		pocsag->rx_bits_corrected += rc;
+		LOGP_CHAN(DPOCSAG, LOGL_INFO, "Corrected %d bit error(s) in received codeword 0x%08x.\n", rc, received);
+	}
+
 	if (word == CODEWORD_IDLE) {
 		LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Received 32 bits of idle pattern 0x%08x.\n", CODEWORD_IDLE);
 	} else
@@ -513,11 +703,7 @@ void put_codeword(pocsag_t *pocsag, uint32_t word, int8_t slot, int8_t subslot)
 		LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Received 32 bits of address codeword 0x%08x (frame %d.%d).\n", word, slot, subslot);
 	else
 		LOGP_CHAN(DPOCSAG, LOGL_DEBUG, "Received 32 bits of message codeword 0x%08x (frame %d.%d).\n", word, slot, subslot);
-	rc = debug_word(word, slot);
-	if (rc < 0) {
-		done_rx_msg(pocsag);
-		return;
-	}
+	debug_word(word, slot);
 
 	if (word == CODEWORD_IDLE) {
 		done_rx_msg(pocsag);
@@ -547,3 +733,11 @@ void put_codeword(pocsag_t *pocsag, uint32_t word, int8_t slot, int8_t subslot)
 	}
 }
 
+/* Log receive statistics of codewords. */
+void frame_rx_statistics(pocsag_t *pocsag)
+{
+	if (!pocsag->rx_words)
+		return;
+
+	LOGP_CHAN(DPOCSAG, LOGL_NOTICE, "Received %u codewords, %u with corrected bit errors (%u bits), %u uncorrectable.\n", pocsag->rx_words, pocsag->rx_words_corrected, pocsag->rx_bits_corrected, pocsag->rx_words_failed);
+}
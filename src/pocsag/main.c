@@ -35,6 +35,7 @@
 #include "../anetz/besetztton.h"
 #include "pocsag.h"
 #include "dsp.h"
+#include "wideband.h"
 
 #define MSG_SEND "/tmp/pocsag_msg_send"
 #define MSG_RECEIVED "/tmp/pocsag_msg_received"
@@ -54,6 +55,9 @@ static char padding = 4;
 static enum pocsag_language language = LANGUAGE_DEFAULT;
 static uint32_t scan_from = 0;
 static uint32_t scan_to = 0;
+static int sync_distance = 2;
+static const char *wideband_file = NULL;
+static double wideband_center = 0.0;
 
 void print_help(const char *arg0)
 {
@@ -90,10 +94,21 @@ void print_help(const char *arg0)
 	printf("        message (2 digits hexadecimal), if alphanumeric function was selected.\n");
 	printf("    --padding 4 | 0 | ...\n");
 	printf("        Text message padding uses 4 (EOT) by default. Old pagers want 0 (NUL).\n");
+	printf("    --sync-distance 0..4\n");
+	printf("        Number of bit errors that are allowed when detecting the sync word.\n");
+	printf("        (default %d)\n", sync_distance);
+	printf("    --wideband <file>\n");
+	printf("        Receive only: Read IQ wave file, as recorded with --write-iq-rx-wave,\n");
+	printf("        and decode all given channels at the same time. Received messages are\n");
+	printf("        tagged with the channel frequency.\n");
+	printf("    --wideband-center <MHz>\n");
+	printf("        Center frequency of the IQ wave file. (default: middle of channels)\n");
 	printf("\n");
 	printf("File: %s\n", MSG_SEND);
 	printf("        Write \"<ric>,0,message\" to it to send a numerical message.\n");
 	printf("        Write \"<ric>,3,message\" to it to send an alphanumerical message.\n");
+	printf("        Write \"<ric>:<priority>,...\" to send messages with higher priority\n");
+	printf("        first. (default priority is 0)\n");
 	printf("        alphanumeric messages may contain any character except LF and CR.\n");
 	printf("        Any control character can be sent by using pointed brackets:\n");
 	printf("          '<NUL>' '<SOH>' '<STX>' '<ETX>' '<EOT>' '<ENQ>' '<ACK>' '<BEL>'\n");
@@ -109,6 +124,9 @@ void print_help(const char *arg0)
 }
 
 #define OPT_PADDING	256
+#define OPT_WIDEBAND	257
+#define OPT_WIDEBAND_CENTER	258
+#define OPT_SYNC_DISTANCE	259
 
 static void add_options(void)
 {
@@ -123,6 +141,9 @@ static void add_options(void)
 	option_add('L', "language", 0);
 	option_add('S', "scan", 2);
 	option_add(OPT_PADDING, "padding", 1);
+	option_add(OPT_SYNC_DISTANCE, "sync-distance", 1);
+	option_add(OPT_WIDEBAND, "wideband", 1);
+	option_add(OPT_WIDEBAND_CENTER, "wideband-center", 1);
 }
 
 static int handle_options(int short_option, int argi, char **argv)
@@ -205,6 +226,19 @@ static int handle_options(int short_option, int argi, char **argv)
 	case OPT_PADDING:
 		padding = atoi(argv[argi++]);
 		break;
+	case OPT_SYNC_DISTANCE:
+		sync_distance = atoi(argv[argi]);
+		if (sync_distance < 0 || sync_distance > 4) {
+			fprintf(stderr, "Given sync distance is out of range, use '-h' for help.\n");
+			return -EINVAL;
+		}
+		break;
+	case OPT_WIDEBAND:
+		wideband_file = options_strdup(argv[argi]);
+		break;
+	case OPT_WIDEBAND_CENTER:
+		wideband_center = atof(argv[argi]) * 1e6;
+		break;
 	default:
 		return main_mobile_handle_options(short_option, argi, argv);
 	}
@@ -258,6 +292,54 @@ int msg_receive(const char *text)
 	return 0;
 }
 
+/* decode all channels from one IQ wave file, no transceiver is created */
+static int wideband_receive(void)
+{
+	wideband_t wb;
+	wave_play_t play;
+	double frequency[num_kanal], min = 0.0, max = 0.0;
+	int samplerate = 0, channels = 2;
+	int i, rc;
+
+	memset(&wb, 0, sizeof(wb));
+	memset(&play, 0, sizeof(play));
+
+	for (i = 0; i < num_kanal; i++) {
+		frequency[i] = pocsag_channel2freq(kanal[i], (deviation_given) ? NULL : &deviation, (polarity_given) ? NULL : &polarity, (baudrate_given) ? NULL : &baudrate);
+		if (frequency[i] == 0.0) {
+			printf("Invalid channel '%s', Use '-k list' to get a list of all channels.\n\n", kanal[i]);
+			return -EINVAL;
+		}
+		if (i == 0 || frequency[i] < min)
+			min = frequency[i];
+		if (i == 0 || frequency[i] > max)
+			max = frequency[i];
+	}
+	if (wideband_center == 0.0)
+		wideband_center = (min + max) / 2.0;
+
+	rc = wave_create_playback(&play, wideband_file, &samplerate, &channels, 1.0);
+	if (rc < 0) {
+		fprintf(stderr, "Failed to open IQ wave file '%s'. Note that it must have two channels (I and Q).\n", wideband_file);
+		return rc;
+	}
+
+	rc = wideband_init(&wb, samplerate, wideband_center, num_kanal, frequency, language, baudrate, deviation, polarity, sync_distance);
+	if (rc < 0) {
+		fprintf(stderr, "Failed to create wideband receiver. Quitting!\n");
+		goto out;
+	}
+
+	printf("Decoding %d channel(s) from '%s', received messages are written to '%s'.\n", num_kanal, wideband_file, MSG_RECEIVED);
+	rc = wideband_read_wave(&wb, &play);
+
+out:
+	wideband_exit(&wb);
+	wave_destroy_playback(&play);
+
+	return rc;
+}
+
 static const struct number_lengths number_lengths[] = {
 	{ 7, "RIC with default function" },
 	{ 8, "RIC with function (append 0..3 or A..D)" },
@@ -266,7 +348,7 @@ static const struct number_lengths number_lengths[] = {
 
 int main(int argc, char *argv[])
 {
-	int rc, argi;
+	int rc = 0, argi;
 	const char *station_id = "";
 	int i;
 	double frequency;
@@ -307,6 +389,12 @@ int main(int argc, char *argv[])
 			goto fail;
 		}
 	}
+	if (wideband_file) {
+		fm_init(fast_math);
+		pocsag_init();
+		rc = wideband_receive();
+		goto fail;
+	}
 	if (use_sdr) {
 		/* set device */
 		for (i = 0; i < num_kanal; i++)
@@ -359,7 +447,7 @@ int main(int argc, char *argv[])
 			printf("Invalid channel '%s', Use '-k list' to get a list of all channels.\n\n", kanal[i]);
 			goto fail;
 		}
-		rc = pocsag_create(kanal[i], frequency, dsp_device[i], use_sdr, dsp_samplerate, rx_gain, tx_gain, tx, rx, language, baudrate, deviation, polarity, function, message, padding, scan_from, scan_to, write_rx_wave, write_tx_wave, read_rx_wave, read_tx_wave, loopback);
+		rc = pocsag_create(kanal[i], frequency, dsp_device[i], use_sdr, dsp_samplerate, rx_gain, tx_gain, tx, rx, language, baudrate, deviation, polarity, function, message, padding, scan_from, scan_to, sync_distance, write_rx_wave, write_tx_wave, read_rx_wave, read_tx_wave, loopback);
 		if (rc < 0) {
 			fprintf(stderr, "Failed to create \"Sender\" instance. Quitting!\n");
 			goto fail;
@@ -386,6 +474,6 @@ fail:
 
 	options_free();
 
-	return 0;
+	return (rc < 0) ? 1 : 0;
 }
 
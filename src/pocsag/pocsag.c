@@ -31,6 +31,7 @@
 #include "../liblogging/logging.h"
 #include "../libmobile/call.h"
 #include "../libmobile/cause.h"
+#include "../libmobile/replay.h"
 #include <osmocom/cc/message.h>
 #include "pocsag.h"
 #include "frame.h"
@@ -162,6 +163,8 @@ const char *pocsag_number_valid(const char *number)
 
 int pocsag_init(void)
 {
+	init_frame();
+
 	return 0;
 }
 
@@ -204,11 +207,11 @@ void pocsag_new_state(pocsag_t *pocsag, enum pocsag_state new_state)
 }
 
 /* Create msg instance */
-static pocsag_msg_t *pocsag_msg_create(pocsag_t *pocsag, uint32_t callref, uint32_t ric, enum pocsag_function function, const char *message, size_t message_length)
+pocsag_msg_t *pocsag_msg_create(pocsag_t *pocsag, uint32_t callref, uint32_t ric, enum pocsag_function function, const char *message, size_t message_length, int priority)
 {
 	pocsag_msg_t *msg, **msgp;
 
-	LOGP(DPOCSAG, LOGL_INFO, "Creating msg instance to page RIC '%d' / function '%d' (%s).\n", ric, function, pocsag_function_name[function]);
+	LOGP(DPOCSAG, LOGL_INFO, "Creating msg instance to page RIC '%d' / function '%d' (%s) with priority %d.\n", ric, function, pocsag_function_name[function], priority);
 
 	/* create */
 	msg = calloc(1, sizeof(*msg));
@@ -223,6 +226,7 @@ static pocsag_msg_t *pocsag_msg_create(pocsag_t *pocsag, uint32_t callref, uint3
 
 	/* init */
 	msg->callref = callref;
+	msg->priority = priority;
 	msg->ric = ric;
 	msg->function = function;
 	memcpy(msg->data, message, message_length);
@@ -236,6 +240,13 @@ static pocsag_msg_t *pocsag_msg_create(pocsag_t *pocsag, uint32_t callref, uint3
 		msgp = &(*msgp)->next;
 	(*msgp) = msg;
 
+	/* queue behind all msgs of same frame with equal or higher priority */
+	msgp = &pocsag->frame_queue[ric & 7];
+	while ((*msgp) && (*msgp)->priority >= priority)
+		msgp = &(*msgp)->frame_next;
+	msg->frame_next = *msgp;
+	(*msgp) = msg;
+
 	/* kick transmitter */
 	if (pocsag->state == POCSAG_IDLE) {
 		pocsag_new_state(pocsag, POCSAG_PREAMBLE);
@@ -257,6 +268,13 @@ void pocsag_msg_destroy(pocsag_msg_t *msg)
 		msgp = &(*msgp)->next;
 	(*msgp) = msg->next;
 
+	/* unlink from frame queue, if not already removed when transmission started */
+	msgp = &msg->pocsag->frame_queue[msg->ric & 7];
+	while ((*msgp) && (*msgp) != msg)
+		msgp = &(*msgp)->frame_next;
+	if ((*msgp))
+		(*msgp) = msg->frame_next;
+
 	/* remove from current transmitting message */
 	if (msg == msg->pocsag->current_msg)
 		msg->pocsag->current_msg = NULL;
@@ -284,14 +302,14 @@ static int pocsag_scan_or_loopback(pocsag_t *pocsag)
 			message[0] = '\0';
 		}
 		LOGP_CHAN(DPOCSAG, LOGL_NOTICE, "Transmitting %s message '%s' with RIC '%d'.\n", pocsag_function_name[pocsag->default_function], message, pocsag->scan_from);
-		pocsag_msg_create(pocsag, 0, pocsag->scan_from, pocsag->default_function, message, strlen(message));
+		pocsag_msg_create(pocsag, 0, pocsag->scan_from, pocsag->default_function, message, strlen(message), 0);
 		pocsag->scan_from++;
 		return 1;
 	}
 
 	if (pocsag->sender.loopback) {
 		LOGP(DPOCSAG, LOGL_INFO, "Sending message for loopback test.\n");
-		pocsag_msg_create(pocsag, 0, 1234567, POCSAG_FUNCTION_NUMERIC, "1234", 4);
+		pocsag_msg_create(pocsag, 0, 1234567, POCSAG_FUNCTION_NUMERIC, "1234", 4, 0);
 		return 1;
 	}
 
@@ -305,6 +323,8 @@ void pocsag_msg_receive(enum pocsag_language language, const char *channel, uint
 	struct tm *tm;
 	int i, j;
 
+	replay_event(channel, "message ric %u function %s '%s'", ric, pocsag_function_name[function], message);
+
 	gettimeofday(&tv, NULL);
 	tm = localtime(&tv.tv_sec);
 
@@ -340,7 +360,7 @@ void pocsag_msg_receive(enum pocsag_language language, const char *channel, uint
 }
 
 /* Create transceiver instance and link to a list. */
-int pocsag_create(const char *kanal, double frequency, const char *device, int use_sdr, int samplerate, double rx_gain, double tx_gain, int tx, int rx, enum pocsag_language language, int baudrate, double deviation, double polarity, enum pocsag_function function, const char *message, char padding, uint32_t scan_from, uint32_t scan_to, const char *write_rx_wave, const char *write_tx_wave, const char *read_rx_wave, const char *read_tx_wave, int loopback)
+int pocsag_create(const char *kanal, double frequency, const char *device, int use_sdr, int samplerate, double rx_gain, double tx_gain, int tx, int rx, enum pocsag_language language, int baudrate, double deviation, double polarity, enum pocsag_function function, const char *message, char padding, uint32_t scan_from, uint32_t scan_to, int sync_distance, const char *write_rx_wave, const char *write_tx_wave, const char *read_rx_wave, const char *read_tx_wave, int loopback)
 {
 	pocsag_t *pocsag;
 	int rc;
@@ -359,6 +379,7 @@ int pocsag_create(const char *kanal, double frequency, const char *device, int u
 		LOGP(DPOCSAG, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	pocsag->sender.destroy = pocsag_destroy;
 
 	/* init audio processing */
 	rc = dsp_init_sender(pocsag, samplerate, (double)baudrate, deviation, polarity);
@@ -375,6 +396,8 @@ int pocsag_create(const char *kanal, double frequency, const char *device, int u
 	pocsag->scan_from = scan_from;
 	pocsag->scan_to = scan_to;
 	pocsag->padding = padding;
+	pocsag->packing = 1;
+	pocsag->fsk_rx_sync_distance = sync_distance;
 
 	pocsag_display_status();
 
@@ -397,6 +420,8 @@ void pocsag_destroy(sender_t *sender)
 
 	LOGP(DPOCSAG, LOGL_DEBUG, "Destroying 'POCSAG' instance for 'Kanal' = %s.\n", sender->kanal);
 
+	if (pocsag->rx)
+		frame_rx_statistics(pocsag);
 	while (pocsag->msg_list)
 		pocsag_msg_destroy(pocsag->msg_list);
 	dsp_cleanup_sender(pocsag);
@@ -413,6 +438,7 @@ void pocsag_msg_send(enum pocsag_language language, const char *text, size_t tex
 	uint32_t ric;
 	uint8_t function;
 	pocsag_t *pocsag;
+	int priority = 0;
 	int message_length = 0;
 	int i, ii, j, k;
 	int rc;
@@ -426,7 +452,7 @@ void pocsag_msg_send(enum pocsag_language language, const char *text, size_t tex
 	ric_string[i] = '\0';
 	if (!text_length) {
 inval:
-		LOGP(DNMT, LOGL_NOTICE, "Given message MUST be in the following format: RIC,function[,<message with comma and spaces>] (function must be A = 0 = numeric, B = 1 or C = 2 = beep, D = 3 = alphanumeric)\n");
+		LOGP(DNMT, LOGL_NOTICE, "Given message MUST be in the following format: RIC[:priority],function[,<message with comma and spaces>] (function must be A = 0 = numeric, B = 1 or C = 2 = beep, D = 3 = alphanumeric)\n");
 		return;
 	}
 	text++;
@@ -445,6 +471,8 @@ inval:
 	}
 
 	ric = atoi(ric_string);
+	if (strchr(ric_string, ':'))
+		priority = atoi(strchr(ric_string, ':') + 1);
 	if (ric > 2097151) {
 		LOGP(DNMT, LOGL_NOTICE, "Illegal RIC %d. Maximum allowed RIC is (2^21)-1. (2097151)\n", ric);
 		goto inval;
@@ -498,7 +526,7 @@ inval:
 	LOGP(DNMT, LOGL_INFO, "Message for ID '%d/%d' with text '%s'\n", ric, function, print_message(message, message_length));
 
 	pocsag = (pocsag_t *) sender_head;
-	pocsag_msg_create(pocsag, 0, ric, function, message, message_length);
+	pocsag_msg_create(pocsag, 0, ric, function, message, message_length, priority);
 }
 
 void call_down_clock(void)
@@ -555,7 +583,7 @@ int call_down_setup(int callref, const char *caller_id, enum number_type __attri
 		message = pocsag->default_message;
 
 	/* create call process to page station */
-	msg = pocsag_msg_create(pocsag, callref, ric, function, message, strlen(message));
+	msg = pocsag_msg_create(pocsag, callref, ric, function, message, strlen(message), 0);
 	if (!msg)
 		return -CAUSE_INVALNUMBER;
 	return -CAUSE_NORMAL;
@@ -25,8 +25,10 @@ struct pocsag;
 /* instance of outgoing message */
 typedef struct pocsag_msg {
 	struct pocsag_msg	*next;
+	struct pocsag_msg	*frame_next;		/* next msg in queue of same frame */
 	struct pocsag		*pocsag;
 	int			callref;		/* call reference */
+	int			priority;		/* higher priority is sent first */
 	uint32_t		ric;			/* current pager ID */
 	enum pocsag_function	function;		/* current function */
 	char			data[256];		/* message to be transmitted */
@@ -34,6 +36,7 @@ typedef struct pocsag_msg {
 	int			data_index;		/* current character transmitting */
 	int			bit_index;		/* current bit transmitting */
 	char			padding;		/* EOT or other padding */
+	int			words;			/* codewords required, 0 if not yet calculated */
 } pocsag_msg_t;
 
 /* instance of pocsag transmitter/receiver */
@@ -54,6 +57,11 @@ typedef struct pocsag {
 	int			word_count;		/* counter for codewords */
 	int			idle_count;		/* counts when to go idle */
 	uint32_t		scan_from, scan_to;	/* if not equal: scnning mode */
+	int			packing;		/* select msg to fill batch (0 = first come, first served) */
+	uint32_t		tx_batch[17];		/* sync and codewords of current batch */
+	int			tx_batch_used;		/* codewords carrying traffic in current batch */
+	unsigned int		tx_words_used;		/* statistics: codewords carrying traffic */
+	unsigned int		tx_words_idle;		/* statistics: idle codewords */
 
 	/* rx states */
 	int			rx_msg_valid;		/* currently in receiving message state */
@@ -62,9 +70,14 @@ typedef struct pocsag {
 	char			rx_msg_data[256];	/* data buffer */
 	int			rx_msg_data_length;	/* complete characters received */
 	int			rx_msg_bit_index;	/* current bit received for alphanumeric */
+	unsigned int		rx_words;		/* statistics: received codewords */
+	unsigned int		rx_words_corrected;	/* statistics: codewords with corrected bit errors */
+	unsigned int		rx_bits_corrected;	/* statistics: corrected bits */
+	unsigned int		rx_words_failed;	/* statistics: uncorrectable codewords */
 
 	/* calls */
 	pocsag_msg_t		*msg_list;		/* linked list of all calls */
+	pocsag_msg_t		*frame_queue[8];	/* msg per frame, ordered by priority */
 
 	/* dsp states */
 	double			fsk_deviation;		/* deviation of FSK signal on sound card */
@@ -84,6 +97,7 @@ typedef struct pocsag {
 	uint32_t		fsk_rx_word;		/* shift register to receive codeword */
 	int			fsk_rx_sync;		/* counts down to next sync */
 	int			fsk_rx_index;		/* counts bits of received codeword */
+	int			fsk_rx_sync_distance;	/* number of bit errors allowed in sync word */
 } pocsag_t;
 
 int msg_receive(const char *text);
@@ -99,9 +113,10 @@ int pocsag_init(void);
 void pocsag_exit(void);
 void pocsag_new_state(pocsag_t *pocsag, enum pocsag_state new_state);
 void pocsag_msg_receive(enum pocsag_language language, const char *channel, uint32_t ric, enum pocsag_function function, const char *message);
-int pocsag_create(const char *kanal, double frequency, const char *device, int use_sdr, int samplerate, double rx_gain, double tx_gain, int tx, int rx, enum pocsag_language language, int baudrate, double deviation, double polarity, enum pocsag_function function, const char *message, char padding, uint32_t scan_from, uint32_t scan_to, const char *write_rx_wave, const char *write_tx_wave, const char *read_rx_wave, const char *read_tx_wave, int loopback);
+int pocsag_create(const char *kanal, double frequency, const char *device, int use_sdr, int samplerate, double rx_gain, double tx_gain, int tx, int rx, enum pocsag_language language, int baudrate, double deviation, double polarity, enum pocsag_function function, const char *message, char padding, uint32_t scan_from, uint32_t scan_to, int sync_distance, const char *write_rx_wave, const char *write_tx_wave, const char *read_rx_wave, const char *read_tx_wave, int loopback);
 void pocsag_destroy(sender_t *sender);
 void pocsag_msg_send(enum pocsag_language language, const char *text, size_t text_length);
+pocsag_msg_t *pocsag_msg_create(pocsag_t *pocsag, uint32_t callref, uint32_t ric, enum pocsag_function function, const char *message, size_t message_length, int priority);
 void pocsag_msg_destroy(pocsag_msg_t *msg);
 void pocsag_get_id(pocsag_t *euro, char *id);
 void pocsag_receive_id(pocsag_t *euro, char *id);
@@ -0,0 +1,305 @@
+/* POCSAG wideband receiver
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* One IQ stream covers several paging channels. Each channel is mixed down
+ * to DC by its own oscillator, low pass filtered by a FIR filter that is
+ * only calculated at the decimated samples, filtered again and FM demodulated.
+ * The FIR filter rejects all frequencies that would alias into the channel,
+ * so a strong channel nearby does not appear on top of a weak one. The result is fed into an independent decoder
+ * instance, so every channel keeps its own sync and message state.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <unistd.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "pocsag.h"
+#include "frame.h"
+#include "dsp.h"
+#include "wideband.h"
+
+static void wideband_chan_cleanup(wideband_chan_t *chan)
+{
+	if (chan->pocsag) {
+		frame_rx_statistics(chan->pocsag);
+		dsp_cleanup_sender(chan->pocsag);
+		free(chan->pocsag);
+		chan->pocsag = NULL;
+	}
+	fm_demod_exit(&chan->demod);
+	free(chan->mixed);
+	chan->mixed = NULL;
+	free(chan->baseband);
+	chan->baseband = NULL;
+	free(chan->I);
+	chan->I = NULL;
+	free(chan->Q);
+	chan->Q = NULL;
+	free(chan->spl);
+	chan->spl = NULL;
+}
+
+/* Blackman windowed sinc low pass, pass band is kept, everything from stop
+ * frequency on is attenuated, so it cannot alias into the pass band.
+ */
+static int wideband_design_filter(wideband_t *wb, double pass, double stop)
+{
+	double cutoff, x, w, sum = 0.0;
+	int ntaps, i;
+
+	if (wb->decimation == 1)
+		ntaps = 1;
+	else {
+		/* the Blackman window requires a transition width of about 5.5 / ntaps */
+		ntaps = (int)ceil(5.5 * wb->samplerate / (stop - pass)) | 1;
+	}
+	wb->dec_taps = calloc(ntaps, sizeof(*wb->dec_taps));
+	if (!wb->dec_taps) {
+		LOGP(DDSP, LOGL_ERROR, "No memory!\n");
+		return -ENOMEM;
+	}
+	wb->dec_ntaps = ntaps;
+	if (ntaps == 1) {
+		wb->dec_taps[0] = 1.0;
+		return 0;
+	}
+
+	cutoff = (pass + stop) / 2.0 / wb->samplerate;
+	for (i = 0; i < ntaps; i++) {
+		x = (double)(i - (ntaps - 1) / 2);
+		w = 0.42 - 0.5 * cos(2.0 * M_PI * (double)i / (double)(ntaps - 1)) + 0.08 * cos(4.0 * M_PI * (double)i / (double)(ntaps - 1));
+		wb->dec_taps[i] = w * ((x == 0.0) ? 2.0 * cutoff : sin(2.0 * M_PI * cutoff * x) / (M_PI * x));
+		sum += wb->dec_taps[i];
+	}
+	/* unity gain at DC */
+	for (i = 0; i < ntaps; i++)
+		wb->dec_taps[i] /= sum;
+
+	LOGP(DDSP, LOGL_DEBUG, "Decimation filter has %d taps, passing %.0f Hz, stopping at %.0f Hz.\n", ntaps, pass, stop);
+
+	return 0;
+}
+
+/* Init wideband receiver with given channel frequencies. */
+int wideband_init(wideband_t *wb, int samplerate, double center_frequency, int num_chan, const double *frequency, enum pocsag_language language, int baudrate, double deviation, double polarity, int sync_distance)
+{
+	wideband_chan_t *chan;
+	double chan_rate, offset;
+	int size, c, rc;
+
+	memset(wb, 0, sizeof(*wb));
+
+	wb->samplerate = samplerate;
+	wb->center_frequency = center_frequency;
+	wb->decimation = samplerate / WIDEBAND_CHAN_RATE;
+	if (wb->decimation < 1)
+		wb->decimation = 1;
+	chan_rate = (double)samplerate / (double)wb->decimation;
+	LOGP(DDSP, LOGL_INFO, "Wideband receiver with %d channel(s) at %.4f MHz, decimating by %d to %.0f Hz.\n", num_chan, center_frequency / 1e6, wb->decimation, chan_rate);
+
+	/* keep the channel, remove what folds onto it after decimation */
+	rc = wideband_design_filter(wb, deviation + baudrate, chan_rate - (deviation + baudrate));
+	if (rc < 0)
+		return rc;
+
+	wb->chan = calloc(num_chan, sizeof(*wb->chan));
+	if (!wb->chan) {
+		LOGP(DDSP, LOGL_ERROR, "No memory!\n");
+		rc = -ENOMEM;
+		goto error;
+	}
+	wb->num_chan = num_chan;
+
+	size = WIDEBAND_CHUNK / wb->decimation + 1;
+	for (c = 0; c < num_chan; c++) {
+		chan = &wb->chan[c];
+		chan->frequency = frequency[c];
+		snprintf(chan->kanal, sizeof(chan->kanal), "%.4f", frequency[c] / 1e6);
+		offset = frequency[c] - center_frequency;
+		/* the decimated channel must fit into the spectrum */
+		if (fabs(offset) + deviation + baudrate > wb->samplerate / 2.0) {
+			LOGP(DDSP, LOGL_ERROR, "Frequency %.4f MHz is outside the wideband signal of %.4f MHz +- %.0f KHz.\n", frequency[c] / 1e6, center_frequency / 1e6, wb->samplerate / 2000.0);
+			rc = -EINVAL;
+			goto error;
+		}
+		LOGP(DDSP, LOGL_DEBUG, "Channel %s has an offset of %.1f KHz.\n", chan->kanal, offset / 1e3);
+		chan->rot_I = 1.0;
+		chan->rot_Q = 0.0;
+		chan->step_I = cos(2.0 * M_PI * -offset / wb->samplerate);
+		chan->step_Q = sin(2.0 * M_PI * -offset / wb->samplerate);
+		chan->mixed = calloc((wb->dec_ntaps - 1 + WIDEBAND_CHUNK) * 2, sizeof(*chan->mixed));
+		chan->baseband = calloc(size * 2, sizeof(*chan->baseband));
+		chan->I = calloc(size, sizeof(*chan->I));
+		chan->Q = calloc(size, sizeof(*chan->Q));
+		chan->spl = calloc(size, sizeof(*chan->spl));
+		chan->pocsag = calloc(1, sizeof(*chan->pocsag));
+		if (!chan->mixed || !chan->baseband || !chan->I || !chan->Q || !chan->spl || !chan->pocsag) {
+			LOGP(DDSP, LOGL_ERROR, "No memory!\n");
+			rc = -ENOMEM;
+			goto error;
+		}
+		/* bandwidth are deviation and both sidebands */
+		rc = fm_demod_init(&chan->demod, chan_rate, 0.0, 2.0 * (deviation + baudrate));
+		if (rc < 0)
+			goto error;
+		chan->deviation = deviation;
+		/* decoder instance, only the receiver part is used */
+		chan->pocsag->sender.kanal = chan->kanal;
+		chan->pocsag->rx = 1;
+		chan->pocsag->language = language;
+		chan->pocsag->fsk_rx_sync_distance = sync_distance;
+		rc = dsp_init_sender(chan->pocsag, chan_rate, baudrate, deviation, polarity);
+		if (rc < 0)
+			goto error;
+	}
+
+	return 0;
+
+error:
+	wideband_exit(wb);
+
+	return rc;
+}
+
+/* Cleanup wideband receiver. */
+void wideband_exit(wideband_t *wb)
+{
+	int c;
+
+	if (wb->chan) {
+		for (c = 0; c < wb->num_chan; c++)
+			wideband_chan_cleanup(&wb->chan[c]);
+		free(wb->chan);
+		wb->chan = NULL;
+	}
+	wb->num_chan = 0;
+	free(wb->dec_taps);
+	wb->dec_taps = NULL;
+	wb->dec_ntaps = 0;
+}
+
+/* mix one channel down and decimate, return number of decimated samples */
+static int wideband_mix(wideband_t *wb, wideband_chan_t *chan, sample_t *I, sample_t *Q, int length)
+{
+	double rot_I = chan->rot_I, rot_Q = chan->rot_Q;
+	double step_I = chan->step_I, step_Q = chan->step_Q;
+	double tmp, sum_I, sum_Q;
+	const float *taps = wb->dec_taps, *m;
+	int ntaps = wb->dec_ntaps;
+	float *mixed = chan->mixed + (ntaps - 1) * 2;
+	float *bb = chan->baseband;
+	int decimation = wb->decimation;
+	int s, t, n = 0;
+
+	/* mix behind the history of the previous chunk */
+	for (s = 0; s < length; s++) {
+		mixed[s * 2] = I[s] * rot_I - Q[s] * rot_Q;
+		mixed[s * 2 + 1] = I[s] * rot_Q + Q[s] * rot_I;
+		tmp = rot_I * step_I - rot_Q * step_Q;
+		rot_Q = rot_I * step_Q + rot_Q * step_I;
+		rot_I = tmp;
+	}
+
+	/* filter only at the samples that are kept */
+	for (s = decimation - 1 - wb->dec_count; s < length; s += decimation) {
+		m = mixed + (s - ntaps + 1) * 2;
+		sum_I = sum_Q = 0.0;
+		for (t = 0; t < ntaps; t++) {
+			sum_I += taps[t] * m[t * 2];
+			sum_Q += taps[t] * m[t * 2 + 1];
+		}
+		bb[n * 2] = sum_I;
+		bb[n * 2 + 1] = sum_Q;
+		n++;
+	}
+
+	/* keep the last samples as history for the next chunk */
+	memmove(chan->mixed, chan->mixed + length * 2, (ntaps - 1) * 2 * sizeof(*mixed));
+
+	/* the recursive oscillator drifts in amplitude, so normalize it once per block */
+	tmp = 1.0 / sqrt(rot_I * rot_I + rot_Q * rot_Q);
+	chan->rot_I = rot_I * tmp;
+	chan->rot_Q = rot_Q * tmp;
+
+	return n;
+}
+
+/* Process wideband IQ samples and decode all channels. */
+void wideband_process(wideband_t *wb, sample_t *I, sample_t *Q, int length)
+{
+	wideband_chan_t *chan;
+	int chunk, c, n, s;
+
+	while (length) {
+		chunk = length;
+		if (chunk > WIDEBAND_CHUNK)
+			chunk = WIDEBAND_CHUNK;
+		for (c = 0; c < wb->num_chan; c++) {
+			chan = &wb->chan[c];
+			n = wideband_mix(wb, chan, I, Q, chunk);
+			if (!n)
+				continue;
+			fm_demodulate_complex(&chan->demod, chan->spl, n, chan->baseband, chan->I, chan->Q);
+			for (s = 0; s < n; s++)
+				chan->spl[s] /= chan->deviation;
+			fsk_decode(chan->pocsag, chan->spl, n);
+		}
+		/* all channels share the same decimation phase */
+		wb->dec_count = (wb->dec_count + chunk) % wb->decimation;
+		I += chunk;
+		Q += chunk;
+		length -= chunk;
+	}
+}
+
+/* Read wideband IQ wave file (as recorded by SDR) and decode all channels. */
+int wideband_read_wave(wideband_t *wb, wave_play_t *play)
+{
+	sample_t *buffer[2];
+	int got, rc = 0;
+
+	buffer[0] = calloc(WIDEBAND_CHUNK, sizeof(*buffer[0]));
+	buffer[1] = calloc(WIDEBAND_CHUNK, sizeof(*buffer[1]));
+	if (!buffer[0] || !buffer[1]) {
+		LOGP(DDSP, LOGL_ERROR, "No memory!\n");
+		rc = -ENOMEM;
+		goto out;
+	}
+
+	while (play->left) {
+		got = wave_read(play, buffer, WIDEBAND_CHUNK);
+		/* reader thread has not yet filled its buffer */
+		if (!got) {
+			usleep(1000);
+			continue;
+		}
+		wideband_process(wb, buffer[0], buffer[1], got);
+	}
+
+out:
+	free(buffer[0]);
+	free(buffer[1]);
+
+	return rc;
+}
@@ -0,0 +1,36 @@
+#include "../libfm/fm.h"
+
+#define WIDEBAND_CHAN_RATE	48000	/* minimum sample rate of each narrowband channel */
+#define WIDEBAND_CHUNK		65536	/* input samples processed at once */
+
+/* one narrowband channel within the wideband signal */
+typedef struct wideband_chan {
+	double		frequency;		/* frequency of channel */
+	char		kanal[32];		/* frequency as text, to tag received messages */
+	pocsag_t	*pocsag;		/* decoder state of this channel */
+	double		rot_I, rot_Q;		/* current vector of oscillator to mix channel down */
+	double		step_I, step_Q;		/* rotation of oscillator each sample */
+	float		*mixed;			/* mixed IQ samples (interleaved), preceded by filter history */
+	float		*baseband;		/* decimated IQ samples (interleaved) */
+	sample_t	*I, *Q;			/* buffers for demodulator */
+	sample_t	*spl;			/* demodulated signal */
+	fm_demod_t	demod;			/* FM demodulator at decimated rate */
+	double		deviation;		/* to normalize demodulated signal */
+} wideband_chan_t;
+
+/* instance of wideband receiver */
+typedef struct wideband {
+	double		samplerate;		/* sample rate of wideband signal */
+	double		center_frequency;	/* frequency at DC of wideband signal */
+	int		decimation;		/* wideband samples per channel sample */
+	int		dec_count;		/* samples since last decimated sample */
+	float		*dec_taps;		/* coefficients of decimation filter */
+	int		dec_ntaps;		/* number of coefficients */
+	int		num_chan;		/* number of channels */
+	wideband_chan_t	*chan;			/* list of channels */
+} wideband_t;
+
+int wideband_init(wideband_t *wb, int samplerate, double center_frequency, int num_chan, const double *frequency, enum pocsag_language language, int baudrate, double deviation, double polarity, int sync_distance);
+void wideband_exit(wideband_t *wb);
+void wideband_process(wideband_t *wb, sample_t *I, sample_t *Q, int length);
+int wideband_read_wave(wideband_t *wb, wave_play_t *play);
@@ -419,6 +419,7 @@ int r2000_create(int band, const char *kanal, enum r2000_chan_type chan_type, co
 		LOGP(DR2000, LOGL_ERROR, "Failed to init transceiver process!\n");
 		goto error;
 	}
+	r2000->sender.destroy = r2000_destroy;
 
 	osmo_timer_setup(&r2000->timer, r2000_timeout, r2000);
 	r2000->sysinfo.relais = relais;
@@ -34,9 +34,62 @@
 #define STEREO_BW	15000.0
 #define PILOT_FREQ	19000.0
 #define PILOT_BW	5.0
+#define PILOT_PULL	5.0	/* maximum frequency offset the pilot PLL follows */
+#define PILOT_MIN	0.01	/* minimum amplitude of pilot I/Q to run the PLL */
+#define PLL_KP		8.8	/* proportional gain of PLL (natural frequency 1 Hz, damping 0.7) */
+#define PLL_KI		39.5	/* integral gain of PLL */
 
 static char freq_name[2][64];
 
+static void nco_set_frequency(stereo_nco_t *nco, double phasestep)
+{
+	nco->step_cos = cos(phasestep);
+	nco->step_sin = sin(phasestep);
+}
+
+static void nco_init(stereo_nco_t *nco, double phasestep)
+{
+	nco->cos = 1.0;
+	nco->sin = 0.0;
+	nco_set_frequency(nco, phasestep);
+}
+
+/* rotate current phase of oscillator, used by PLL */
+static void nco_rotate(stereo_nco_t *nco, double phase)
+{
+	double c = cos(phase), s = sin(phase);
+	double t;
+
+	t = nco->cos * c - nco->sin * s;
+	nco->sin = nco->sin * c + nco->cos * s;
+	nco->cos = t;
+}
+
+/* render the phasor for each sample of a block
+ *
+ * The recursion accumulates rounding errors, so the amplitude is corrected
+ * once per block.
+ */
+static void nco_generate(stereo_nco_t *nco, sample_t *cos_buf, sample_t *sin_buf, int num)
+{
+	double c = nco->cos, s = nco->sin;
+	double step_c = nco->step_cos, step_s = nco->step_sin;
+	double t, g;
+	int i;
+
+	for (i = 0; i < num; i++) {
+		cos_buf[i] = c;
+		sin_buf[i] = s;
+		t = c * step_c - s * step_s;
+		s = s * step_c + c * step_s;
+		c = t;
+	}
+
+	g = 1.0 / sqrt(c * c + s * s);
+	nco->cos = c * g;
+	nco->sin = s * g;
+}
+
 int radio_init(radio_t *radio, int buffer_size, int samplerate, double frequency, const char *tx_wave_file, const char *rx_wave_file, const char *tx_audiodev, const char *rx_audiodev, enum modulation modulation, double bandwidth, double deviation, double modulation_index, double time_constant_us, double volume, int stereo, int rds, int rds2)
 {
 	int rc = -EINVAL;
@@ -207,8 +260,10 @@ int radio_init(radio_t *radio, int buffer_size, int samplerate, double frequency
 	iir_highpass_init(&radio->tx_dc_removal[0], DC_CUTOFF, radio->tx_audio_samplerate, 1);
 	iir_highpass_init(&radio->tx_dc_removal[1], DC_CUTOFF, radio->tx_audio_samplerate, 1);
 
-	/* stereo pilot tone phase */
-	radio->pilot_phasestep = 2.0 * M_PI * PILOT_FREQ / radio->signal_samplerate;
+	/* stereo pilot tone oscillators */
+	nco_init(&radio->tx_nco, 2.0 * M_PI * PILOT_FREQ / radio->signal_samplerate);
+	nco_init(&radio->rx_nco, 2.0 * M_PI * PILOT_FREQ / radio->signal_samplerate);
+	radio->rx_pll_offset = 0.0;
 
 	/* stere decoding filters */
 	iir_lowpass_init(&radio->rx_lp_pilot_I, PILOT_BW, radio->signal_samplerate, 2);
@@ -338,7 +393,9 @@ int radio_init(radio_t *radio, int buffer_size, int samplerate, double frequency
 	radio->I_buffer = calloc(buffer_size, sizeof(*radio->I_buffer));
 	radio->Q_buffer = calloc(buffer_size, sizeof(*radio->Q_buffer));
 	radio->carrier_buffer = calloc(buffer_size, sizeof(*radio->carrier_buffer));
-	if (!radio->I_buffer || !radio->Q_buffer || !radio->carrier_buffer) {
+	radio->nco_cos_buffer = calloc(buffer_size, sizeof(*radio->nco_cos_buffer));
+	radio->nco_sin_buffer = calloc(buffer_size, sizeof(*radio->nco_sin_buffer));
+	if (!radio->I_buffer || !radio->Q_buffer || !radio->carrier_buffer || !radio->nco_cos_buffer || !radio->nco_sin_buffer) {
 		LOGP(DRADIO, LOGL_ERROR, "No memory!!\n");
 		rc = -ENOMEM;
 		goto error;
@@ -377,6 +434,14 @@ void radio_exit(radio_t *radio)
 		free(radio->carrier_buffer);
 		radio->carrier_buffer = NULL;
 	}
+	if (radio->nco_cos_buffer) {
+		free(radio->nco_cos_buffer);
+		radio->nco_cos_buffer = NULL;
+	}
+	if (radio->nco_sin_buffer) {
+		free(radio->nco_sin_buffer);
+		radio->nco_sin_buffer = NULL;
+	}
 	if (radio->tx_audio_mode == AUDIO_MODE_WAVEFILE) {
 		wave_destroy_playback(&radio->wave_tx_play);
 		radio->tx_audio_mode = AUDIO_MODE_NONE;
@@ -592,17 +657,11 @@ int radio_tx(radio_t *radio, float *baseband, int signal_num)
 			if (radio->emphasis)
 				pre_emphasis(&radio->fm_emphasis[1], signal_samples[1], signal_num);
 			clipper_process(signal_samples[1], signal_num);
-			/* add pilot tone */
-			double phasestep = radio->pilot_phasestep;
-			double phase = radio->tx_pilot_phase;
-			for (i = 0; i < signal_num; i++) {
-				signal_samples[0][i] += sin(phase) * 0.1;
-				signal_samples[0][i] += signal_samples[1][i] * sin(phase * 2);
-				phase += phasestep;
-				if (phase >= 2.0 * M_PI)
-					phase -= 2.0 * M_PI;
-			}
-			radio->tx_pilot_phase = phase;
+			/* add pilot tone and differential signal on 38 kHz (sin(2p) = 2 * sin(p) * cos(p)) */
+			sample_t *c = radio->nco_cos_buffer, *s = radio->nco_sin_buffer;
+			nco_generate(&radio->tx_nco, c, s, signal_num);
+			for (i = 0; i < signal_num; i++)
+				signal_samples[0][i] += s[i] * 0.1 + signal_samples[1][i] * 2.0 * s[i] * c[i];
 		}
 		for (i = 0; i < signal_num; i++)
 			signal_samples[0][i] *= radio->fm_deviation;
@@ -657,25 +716,42 @@ int radio_rx(radio_t *radio, float *baseband, int signal_num)
 		for (i = 0; i < signal_num; i++)
 			samples[0][i] /= radio->fm_deviation;
 		if (radio->stereo) {
+			sample_t *c = radio->nco_cos_buffer, *s = radio->nco_sin_buffer;
+			double I, Q, e, sd, cd;
 			/* filter pilot tone */
-			p = radio->rx_pilot_phase; /* don't increment in radio structure, will be done later */
+			nco_generate(&radio->rx_nco, c, s, signal_num);
 			for (i = 0; i < signal_num; i++) {
-				samples[1][i] = samples[0][i] * cos(p); /* I */
-				samples[2][i] = samples[0][i] * sin(p); /* Q */
-				p += radio->pilot_phasestep;
-				if (p >= 2.0 * M_PI)
-				p -= 2.0 * M_PI;
+				samples[1][i] = samples[0][i] * c[i]; /* I */
+				samples[2][i] = samples[0][i] * s[i]; /* Q */
 			}
 			iir_process(&radio->rx_lp_pilot_I, samples[1], signal_num);
 			iir_process(&radio->rx_lp_pilot_Q, samples[2], signal_num);
-			/* mix pilot tone (double phase) with differential signal */
+			/* feed measured pilot phase into PLL, once per block */
+			I = samples[1][signal_num - 1];
+			Q = samples[2][signal_num - 1];
+			if (I * I + Q * Q > PILOT_MIN * PILOT_MIN) {
+				/* phase of pilot relative to oscillator */
+				p = atan2(I, Q) * (double)signal_num / radio->signal_samplerate;
+				nco_rotate(&radio->rx_nco, p * PLL_KP);
+				radio->rx_pll_offset += p * PLL_KI;
+				if (radio->rx_pll_offset > 2.0 * M_PI * PILOT_PULL)
+					radio->rx_pll_offset = 2.0 * M_PI * PILOT_PULL;
+				if (radio->rx_pll_offset < -2.0 * M_PI * PILOT_PULL)
+					radio->rx_pll_offset = -2.0 * M_PI * PILOT_PULL;
+				nco_set_frequency(&radio->rx_nco, (2.0 * M_PI * PILOT_FREQ + radio->rx_pll_offset) / radio->signal_samplerate);
+			}
+			/* mix pilot tone (double phase) with differential signal
+			 * the remaining phase error p_m = atan2(Q, I) is removed without trigonometry:
+			 * sin(2 * (p - p_m)) = 2 * (sin(p) * I - cos(p) * Q) * (cos(p) * I + sin(p) * Q) / (I^2 + Q^2)
+			 */
 			for (i = 0; i < signal_num; i++) {
-				p = atan2(samples[2][i], samples[1][i]);
-				/* subtract measured phase difference (use double amplitude, because we filter later) */
-			        samples[1][i] = samples[0][i] * sin((radio->rx_pilot_phase - p) * 2.0) * 2.0;
-				radio->rx_pilot_phase += radio->pilot_phasestep;
-				if (radio->rx_pilot_phase >= 2.0 * M_PI)
-				radio->rx_pilot_phase -= 2.0 * M_PI;
+				I = samples[1][i];
+				Q = samples[2][i];
+				e = I * I + Q * Q;
+				sd = s[i] * I - c[i] * Q;
+				cd = c[i] * I + s[i] * Q;
+				/* use double amplitude, because we filter later */
+				samples[1][i] = (e > 0.0) ? samples[0][i] * 4.0 * sd * cd / e : 0.0;
 			}
 			/* filter to match bandwidth */
 			iir_process(&radio->rx_lp_sum, samples[0], signal_num);
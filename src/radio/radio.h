@@ -18,6 +18,17 @@ enum audio_mode {
 	AUDIO_MODE_TESTTONE = 4,
 };
 
+/* numerically controlled oscillator for stereo pilot tone
+ *
+ * The phasor (cos, sin) is rotated by a fixed step for every sample, so no
+ * trigonometric function is needed. 38 kHz (and 57 kHz for RDS) are derived
+ * from the pilot phasor, so they are always phase locked to the pilot.
+ */
+typedef struct stereo_nco {
+	double		step_cos, step_sin;	/* rotation for each sample */
+	double		cos, sin;		/* current phasor */
+} stereo_nco_t;
+
 typedef struct radio {
 	/* modes */
 	int		buffer_size;		/* maximum number of samples */
@@ -59,9 +70,9 @@ typedef struct radio {
 	double		fm_deviation;		/* deviation of fm signal */
 	fm_mod_t	fm_mod;			/* FM modulation */
 	fm_demod_t	fm_demod;		/* FM modulation */
-	double		pilot_phasestep;	/* phase change of pilot tone for each sample */
-	double		tx_pilot_phase;		/* current phase of tx sine */
-	double		rx_pilot_phase;		/* current phase of rx mixer */
+	stereo_nco_t	tx_nco;			/* oscillator for pilot tone and stereo subcarrier */
+	stereo_nco_t	rx_nco;			/* oscillator of pilot PLL */
+	double		rx_pll_offset;		/* frequency offset of pilot PLL (rad/s) */
 	iir_filter_t	tx_dc_removal[2];	/* AM/FM DC level removal */
 	iir_filter_t	tx_am_bw_limit;		/* AM bandwidth limiter */
 	iir_filter_t	rx_lp_pilot_I;		/* low pass filter for pilot tone extraction */
@@ -79,6 +90,8 @@ typedef struct radio {
 	sample_t	*I_buffer;
 	sample_t	*Q_buffer;
 	sample_t	*carrier_buffer;
+	sample_t	*nco_cos_buffer;	/* phasor of pilot oscillator */
+	sample_t	*nco_sin_buffer;
 } radio_t;
 
 int radio_init(radio_t *radio, int buffer_size, int samplerate, double frequency, const char *tx_wave_file, const char *rx_wave_file, const char *tx_audiodev, const char *rx_audiodev, enum modulation modulation, double bandwidth, double deviation, double modulation_index, double time_constant, double volume, int stereo, int rds, int rds2);
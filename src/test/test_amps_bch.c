@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include "../amps/bch.h"
+
+/* bit serial reference implementation, as it was used by AMPS frame coding */
+static char gp[12] = { 0, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1 };
+
+static uint16_t encode_bch_serial(uint64_t value, int length)
+{
+	char redun[12];
+	uint16_t p = 0;
+	int i, j, feedback;
+
+	for (i = 0; i < 12; i++)
+		redun[i] = 0;
+
+	for (i = 0; i < length; i++) {
+		feedback = ((value >> (length - 1 - i)) & 1) ^ redun[0];
+		if (feedback) {
+			for (j = 11; j > 0; j--) {
+				if (gp[11 - j])
+					redun[11 - j] = redun[12 - j] ^ feedback;
+				else
+					redun[11 - j] = redun[12 - j];
+			}
+			redun[11] = gp[11];
+		} else {
+			for (j = 11; j > 0; j--)
+				redun[11 - j] = redun[12 - j];
+			redun[11] = 0;
+		}
+	}
+
+	for (i = 0; i < 12; i++)
+		p = (p << 1) | redun[i];
+
+	return p;
+}
+
+static uint64_t rand_word(int length)
+{
+	uint64_t value;
+
+	value = ((uint64_t)random() << 32) ^ ((uint64_t)random() << 16) ^ random();
+	return value & (((uint64_t)1 << length) - 1);
+}
+
+static double get_time(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (double)tv.tv_sec + (double)tv.tv_usec / 1e6;
+}
+
+/* check all 1 and 2 bit errors of a code word */
+static int check_correction(uint64_t data, int length)
+{
+	uint64_t code, word;
+	int n = length + 12;
+	int i, j, rc;
+
+	code = (data << 12) | bch_encode(data, length);
+	if (bch_syndrome(code, length) != 0)
+		return -1;
+	for (i = 0; i < n; i++) {
+		word = code ^ ((uint64_t)1 << i);
+		rc = bch_correct(&word, length);
+		if (rc != 1 || word != code)
+			return -1;
+		for (j = i + 1; j < n; j++) {
+			word = code ^ ((uint64_t)1 << i) ^ ((uint64_t)1 << j);
+			rc = bch_correct(&word, length);
+			if (rc != 2 || word != code)
+				return -1;
+		}
+	}
+
+	return 0;
+}
+
+#define BENCH_WORDS 1000000
+
+int main(void)
+{
+	uint64_t value, *words;
+	uint16_t sum;
+	double start;
+	int i;
+
+	if (init_bch() < 0) {
+		printf("Failed to init BCH tables!\n");
+		return 1;
+	}
+
+	/* BCH(40,28): all possible data words */
+	printf("Comparing BCH(40,28) with bit serial encoder for all data words...\n");
+	for (value = 0; value < ((uint64_t)1 << 28); value++) {
+		if (bch_encode(value, 28) != encode_bch_serial(value, 28)) {
+			printf("Mismatch at data 0x%07llx, please fix!\n", (unsigned long long)value);
+			return 1;
+		}
+	}
+
+	/* BCH(48,36): the code is linear, so all single bits and a random set of words */
+	printf("Comparing BCH(48,36) with bit serial encoder...\n");
+	for (i = 0; i < 36; i++) {
+		value = (uint64_t)1 << i;
+		if (bch_encode(value, 36) != encode_bch_serial(value, 36)) {
+			printf("Mismatch at data 0x%09llx, please fix!\n", (unsigned long long)value);
+			return 1;
+		}
+	}
+	for (i = 0; i < 10000000; i++) {
+		value = rand_word(36);
+		if (bch_encode(value, 36) != encode_bch_serial(value, 36)) {
+			printf("Mismatch at data 0x%09llx, please fix!\n", (unsigned long long)value);
+			return 1;
+		}
+	}
+
+	/* correction of all 1 and 2 bit error patterns */
+	printf("Checking correction of all 1 and 2 bit errors...\n");
+	for (i = 0; i < 1000; i++) {
+		if (check_correction(rand_word(28), 28) < 0 || check_correction(rand_word(36), 36) < 0) {
+			printf("Correction failed, please fix!\n");
+			return 1;
+		}
+	}
+
+	printf("All checks passed.\n");
+
+	/* benchmark */
+	words = malloc(BENCH_WORDS * sizeof(*words));
+	if (!words)
+		return 1;
+	for (i = 0; i < BENCH_WORDS; i++)
+		words[i] = rand_word(36);
+
+	sum = 0;
+	start = get_time();
+	for (i = 0; i < BENCH_WORDS; i++)
+		sum ^= encode_bch_serial(words[i], 36);
+	printf("bit serial encoder: %.3f mega words/sec\n", (double)BENCH_WORDS / (get_time() - start) / 1e6);
+
+	start = get_time();
+	for (i = 0; i < BENCH_WORDS; i++)
+		sum ^= bch_encode(words[i], 36);
+	printf("table encoder: %.3f mega words/sec\n", (double)BENCH_WORDS / (get_time() - start) / 1e6);
+
+	start = get_time();
+	for (i = 0; i < BENCH_WORDS; i++) {
+		value = (words[i] << 12) ^ 0x5;
+		sum ^= bch_correct(&value, 36);
+	}
+	printf("table syndrome correction: %.3f mega words/sec (%d)\n", (double)BENCH_WORDS / (get_time() - start) / 1e6, sum & 1);
+
+	free(words);
+
+	return 0;
+}
+
@@ -0,0 +1,219 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "../liblogging/logging.h"
+#include "../libmobile/asset.h"
+#include "../libmobile/rice.h"
+
+#define SAMPLES		80000	/* 10 seconds at 8000 Hz */
+#define PACK_FILE	"test_asset.assets"
+
+static int16_t source[SAMPLES];
+
+/* tone sequence with changing amplitudes, like ringback tones and speech */
+static void generate(void)
+{
+	double phase = 0.0, amplitude;
+	int s;
+
+	for (s = 0; s < SAMPLES; s++) {
+		amplitude = 4000.0 + 20000.0 * fabs(sin((double)s / 4000.0));
+		phase += 2.0 * M_PI * (300.0 + (s / 800) % 30 * 100.0) / 8000.0;
+		source[s] = amplitude * sin(phase);
+	}
+}
+
+static void put_le32(uint8_t *p, uint32_t value)
+{
+	p[0] = value;
+	p[1] = value >> 8;
+	p[2] = value >> 16;
+	p[3] = value >> 24;
+}
+
+/* write pack with the source as "test/rice" and "test/pcm" */
+static int write_pack(int corrupt)
+{
+	uint8_t *pack, *entry;
+	int offset, length, s;
+	FILE *fp;
+
+	offset = ASSET_HEADER_SIZE + 2 * ASSET_ENTRY_SIZE;
+	pack = calloc(1, offset + RICE_MAX_BYTES(SAMPLES) + SAMPLES * 2);
+	if (!pack) {
+		fprintf(stderr, "No memory!\n");
+		abort();
+	}
+	memcpy(pack, ASSET_MAGIC, 8);
+	put_le32(pack + 8, ASSET_VERSION);
+	put_le32(pack + 12, 2);
+
+	entry = pack + ASSET_HEADER_SIZE;
+	strcpy((char *)entry, "test/rice");
+	length = rice_encode(source, SAMPLES, pack + offset);
+	put_le32(entry + 32, ASSET_CODEC_RICE);
+	put_le32(entry + 36, SAMPLES);
+	put_le32(entry + 40, 8000);
+	put_le32(entry + 44, offset);
+	put_le32(entry + 48, length);
+	offset += length;
+	/* PCM samples are used from the pack, if aligned */
+	offset = (offset + 1) & ~1;
+
+	entry += ASSET_ENTRY_SIZE;
+	strcpy((char *)entry, "test/pcm");
+	for (s = 0; s < SAMPLES; s++) {
+		pack[offset + s * 2] = source[s];
+		pack[offset + s * 2 + 1] = source[s] >> 8;
+	}
+	put_le32(entry + 32, ASSET_CODEC_PCM);
+	put_le32(entry + 36, SAMPLES);
+	put_le32(entry + 40, SAMPLES);
+	put_le32(entry + 44, offset);
+	/* the corrupt pack claims more data than it has */
+	put_le32(entry + 48, (corrupt) ? SAMPLES * 4 : SAMPLES * 2);
+	offset += SAMPLES * 2;
+
+	fp = fopen(PACK_FILE, "w");
+	if (!fp) {
+		printf("Failed to create '%s'!\n", PACK_FILE);
+		free(pack);
+		return -1;
+	}
+	fwrite(pack, offset, 1, fp);
+	fclose(fp);
+	free(pack);
+
+	return 0;
+}
+
+/* round trip must be lossless, also for full scale and noise */
+static int check_rice(void)
+{
+	static int16_t test[SAMPLES], decoded[SAMPLES];
+	static uint8_t data[RICE_MAX_BYTES(SAMPLES)];
+	const char *name[3] = { "tones", "full scale", "noise" };
+	int i, s, length;
+
+	for (i = 0; i < 3; i++) {
+		for (s = 0; s < SAMPLES; s++) {
+			switch (i) {
+			case 0:
+				test[s] = source[s];
+				break;
+			case 1:
+				test[s] = ((s / 3) & 1) ? 32767 : -32768;
+				break;
+			default:
+				test[s] = rand();
+			}
+		}
+		length = rice_encode(test, SAMPLES, data);
+		if (rice_decode(data, length, SAMPLES, decoded) < 0 || memcmp(test, decoded, sizeof(test))) {
+			printf("Round trip of %s is not lossless!\n", name[i]);
+			return -1;
+		}
+		printf("Lossless round trip of %s: %d samples coded into %d bytes (%.2f bits per sample)\n", name[i], SAMPLES, length, (double)length * 8.0 / SAMPLES);
+		/* truncated data must be refused */
+		if (rice_decode(data, length / 2, SAMPLES, decoded) == 0) {
+			printf("Truncated data of %s was decoded!\n", name[i]);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static int check_pack(void)
+{
+	int16_t *rice_spl, *pcm_spl, *second_spl, *spl;
+	int rice_size, pcm_size, second_size, rice_max, pcm_max, second_max;
+	struct timeval start_tv, tv;
+	double duration;
+
+	if (write_pack(0))
+		return -1;
+	if (asset_open(PACK_FILE)) {
+		printf("Failed to open asset pack!\n");
+		return -1;
+	}
+
+	/* lossless asset is decoded when it is bound */
+	gettimeofday(&start_tv, NULL);
+	if (asset_bind("test/rice", &rice_spl, &rice_size, &rice_max)) {
+		printf("Failed to bind lossless asset!\n");
+		return -1;
+	}
+	gettimeofday(&tv, NULL);
+	duration = (double)tv.tv_sec + (double)tv.tv_usec / 1e6;
+	duration -= (double)start_tv.tv_sec + (double)start_tv.tv_usec / 1e6;
+	if (!rice_spl || rice_size != SAMPLES || rice_max != 8000) {
+		printf("Lossless asset not decoded when bound!\n");
+		return -1;
+	}
+	printf("Binding %.1f seconds of lossless asset took %.3f ms.\n", (double)SAMPLES / 8000.0, duration * 1e3);
+	if (memcmp(rice_spl, source, sizeof(source))) {
+		printf("Lossless asset decoded wrong!\n");
+		return -1;
+	}
+
+	if (asset_bind("test/pcm", &pcm_spl, &pcm_size, &pcm_max)
+	 || asset_bind("test/rice", &second_spl, &second_size, &second_max)) {
+		printf("Failed to bind assets!\n");
+		return -1;
+	}
+	if (asset_bind("test/missing", &spl, &second_size, &second_max) != -ENOENT) {
+		printf("Missing asset was bound!\n");
+		return -1;
+	}
+
+	/* second binding shares the decoded samples */
+	if (second_spl != rice_spl || second_size != SAMPLES) {
+		printf("Second binding does not share decoded samples!\n");
+		return -1;
+	}
+
+	if (!pcm_spl || pcm_size != SAMPLES || pcm_max != SAMPLES || memcmp(pcm_spl, source, sizeof(source))) {
+		printf("PCM asset bound wrong!\n");
+		return -1;
+	}
+
+	asset_exit();
+	if (rice_spl || second_spl || pcm_spl) {
+		printf("Bindings not reset on exit!\n");
+		return -1;
+	}
+
+	/* corrupt pack must be refused */
+	if (write_pack(1))
+		return -1;
+	if (asset_open(PACK_FILE) != -EINVAL) {
+		printf("Corrupt asset pack was accepted!\n");
+		return -1;
+	}
+	asset_exit();
+	unlink(PACK_FILE);
+	printf("Asset pack loaded, shared and refused as expected.\n");
+
+	return 0;
+}
+
+int main(void)
+{
+	loglevel = LOGL_FATAL;
+
+	generate();
+
+	if (check_rice())
+		return 1;
+
+	if (check_pack())
+		return 1;
+
+	return 0;
+}
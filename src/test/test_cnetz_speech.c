@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include "../libsample/sample.h"
+#include "../libcompandor/compandor.h"
+#include "../libsamplerate/samplerate.h"
+#include "../libscrambler/scrambler.h"
+#include "../libemphasis/emphasis.h"
+#include "../cnetz/speech.h"
+
+#define BLOCK		100	/* 12.5 ms at 8000 Hz */
+#define BLOCKS		800	/* 10 seconds */
+#define BENCH_BLOCKS	8000
+#define CUT_OFF_EMPHASIS_CNETZ	796.0
+
+/* all states of one speech chain, as cnetz_t has them */
+struct chain {
+	compandor_t	cstate;
+	samplerate_t	srstate;
+	scrambler_t	scrambler_tx, scrambler_rx;
+	emphasis_t	estate;
+};
+
+static void chain_init(struct chain *c, int samplerate, double clock_speed)
+{
+	init_samplerate(&c->srstate, 8000.0, (double)samplerate / (1.1 / (1.0 + clock_speed / 1000000.0)), 3300.0);
+	scrambler_setup(&c->scrambler_tx, (double)samplerate / 1.1);
+	scrambler_setup(&c->scrambler_rx, (double)samplerate / 1.1);
+	setup_compandor(&c->cstate, 8000, 5.0, 22.5);
+	init_emphasis(&c->estate, samplerate, CUT_OFF_EMPHASIS_CNETZ, CUT_OFF_HIGHPASS_DEFAULT, CUT_OFF_LOWPASS_DEFAULT);
+}
+
+static uint32_t rand_state = 1;
+
+static double noise(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (double)((rand_state >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+/* synthetic speech: voiced sound with varying pitch and syllables, pauses,
+ * unvoiced noise and overdriven parts
+ */
+static void gen_speech(int16_t *spl, int num)
+{
+	double pitch_phase = 0, t, f0, env, v;
+	int i, h;
+
+	for (i = 0; i < num; i++) {
+		t = (double)i / 8000.0;
+		f0 = 120.0 + 40.0 * sin(2.0 * M_PI * 0.7 * t);
+		pitch_phase += 2.0 * M_PI * f0 / 8000.0;
+		/* syllables with 4 Hz, a pause every 3 seconds */
+		env = 0.5 - 0.5 * cos(2.0 * M_PI * 4.0 * t);
+		if (fmod(t, 3.0) > 2.5)
+			env = 0.001;
+		v = 0;
+		if (fmod(t, 1.3) < 0.2) {
+			/* unvoiced */
+			v = noise() * 0.3;
+		} else {
+			for (h = 1; h * f0 < 3400.0; h++)
+				v += sin(pitch_phase * h) / h * (1.0 + cos(h * f0 / 700.0));
+			v *= 0.2;
+		}
+		/* overdrive in the 7th second */
+		if (t >= 6.0 && t < 7.0)
+			env *= 4.0;
+		v = v * env * 32767.0;
+		if (v > 32767.0)
+			v = 32767.0;
+		if (v < -32768.0)
+			v = -32768.0;
+		spl[i] = (int16_t)v;
+	}
+}
+
+static double get_time(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+/* process speech with both chains, they must give identical results */
+static int check(int16_t *speech, int samplerate, double clock_speed, int scramble, int emphasis)
+{
+	struct chain *a, *b;
+	sample_t buffer_a[2048], buffer_b[2048];
+	int len_a, len_b, n, i;
+
+	a = calloc(1, sizeof(*a));
+	b = calloc(1, sizeof(*b));
+	if (!a || !b)
+		abort();
+	chain_init(a, samplerate, clock_speed);
+	chain_init(b, samplerate, clock_speed);
+
+	for (n = 0; n < BLOCKS; n++) {
+		len_a = speech_shrink_multipass(&a->cstate, &a->srstate, (scramble) ? &a->scrambler_tx : NULL, (emphasis && !scramble) ? &a->estate : NULL, speech + n * BLOCK, BLOCK, buffer_a);
+		len_b = speech_shrink(&b->cstate, &b->srstate, (scramble) ? &b->scrambler_tx : NULL, (emphasis && !scramble) ? &b->estate : NULL, speech + n * BLOCK, BLOCK, buffer_b);
+		if (len_a != len_b || memcmp(buffer_a, buffer_b, len_a * sizeof(*buffer_a))) {
+			for (i = 0; i < len_a && i < len_b; i++) {
+				if (buffer_a[i] != buffer_b[i])
+					break;
+			}
+			printf("Shrink at %d Hz differs in block %d: length %d / %d, first difference at sample %d\n", samplerate, n, len_a, len_b, i);
+			goto error;
+		}
+		/* the compressed speech is received again, like a loopback */
+		len_a = speech_unshrink_multipass(&a->cstate, &a->srstate, (scramble) ? &a->scrambler_rx : NULL, (emphasis) ? &a->estate : NULL, buffer_a, len_a);
+		len_b = speech_unshrink(&b->cstate, &b->srstate, (scramble) ? &b->scrambler_rx : NULL, (emphasis) ? &b->estate : NULL, buffer_b, len_b);
+		if (len_a != len_b || memcmp(buffer_a, buffer_b, len_a * sizeof(*buffer_a))) {
+			for (i = 0; i < len_a && i < len_b; i++) {
+				if (buffer_a[i] != buffer_b[i])
+					break;
+			}
+			printf("Unshrink at %d Hz differs in block %d: length %d / %d, first difference at sample %d\n", samplerate, n, len_a, len_b, i);
+			goto error;
+		}
+	}
+
+	free(a);
+	free(b);
+	return 0;
+
+error:
+	free(a);
+	free(b);
+	return -1;
+}
+
+static void benchmark(int16_t *speech, int samplerate, int scramble, int emphasis)
+{
+	struct chain *c;
+	sample_t buffer[2048];
+	double start, t_shrink[2], t_unshrink[2];
+	int len, n, fused;
+
+	c = calloc(1, sizeof(*c));
+	if (!c)
+		abort();
+	for (fused = 0; fused < 2; fused++) {
+		chain_init(c, samplerate, 0.0);
+		t_shrink[fused] = t_unshrink[fused] = 0.0;
+		for (n = 0; n < BENCH_BLOCKS; n++) {
+			start = get_time();
+			if (fused)
+				len = speech_shrink(&c->cstate, &c->srstate, (scramble) ? &c->scrambler_tx : NULL, (emphasis && !scramble) ? &c->estate : NULL, speech + (n % BLOCKS) * BLOCK, BLOCK, buffer);
+			else
+				len = speech_shrink_multipass(&c->cstate, &c->srstate, (scramble) ? &c->scrambler_tx : NULL, (emphasis && !scramble) ? &c->estate : NULL, speech + (n % BLOCKS) * BLOCK, BLOCK, buffer);
+			t_shrink[fused] += get_time() - start;
+			start = get_time();
+			if (fused)
+				speech_unshrink(&c->cstate, &c->srstate, (scramble) ? &c->scrambler_rx : NULL, (emphasis) ? &c->estate : NULL, buffer, len);
+			else
+				speech_unshrink_multipass(&c->cstate, &c->srstate, (scramble) ? &c->scrambler_rx : NULL, (emphasis) ? &c->estate : NULL, buffer, len);
+			t_unshrink[fused] += get_time() - start;
+		}
+	}
+	free(c);
+
+	printf("%d Hz, scrambler %s, emphasis %s: shrink %.2f -> %.2f us, unshrink %.2f -> %.2f us per block\n",
+		samplerate, (scramble) ? "on " : "off", (emphasis) ? "on " : "off",
+		t_shrink[0] / BENCH_BLOCKS * 1e6, t_shrink[1] / BENCH_BLOCKS * 1e6,
+		t_unshrink[0] / BENCH_BLOCKS * 1e6, t_unshrink[1] / BENCH_BLOCKS * 1e6);
+}
+
+int main(void)
+{
+	static int16_t speech[BLOCKS * BLOCK];
+	static const int samplerates[] = { 48000, 44100, 96000 };
+	int s, mode;
+
+	compandor_init();
+	scrambler_init();
+
+	gen_speech(speech, BLOCKS * BLOCK);
+
+	for (s = 0; s < 3; s++) {
+		for (mode = 0; mode < 4; mode++) {
+			/* use clock correction, so the interpolation is not periodic */
+			if (check(speech, samplerates[s], (s == 1) ? 37.5 : 0.0, mode & 1, mode >> 1))
+				return 1;
+		}
+	}
+	printf("Single pass and multipass speech chain give identical results.\n");
+
+	printf("Time per speech block of 12.5 ms, multipass -> single pass:\n");
+	for (mode = 0; mode < 4; mode++)
+		benchmark(speech, 48000, mode & 1, mode >> 1);
+
+	return 0;
+}
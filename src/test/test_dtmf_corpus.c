@@ -0,0 +1,282 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include "../libsample/sample.h"
+#include "../libdtmf/dtmf_decode.h"
+
+#define db2level(db)		pow(10, (double)db / 20.0)
+
+#define SAMPLERATE		8000
+#define CHUNK			160	/* 20 ms, as received from call */
+#define MAX_SAMPLES		(SAMPLERATE * 120)
+#define MAX_DIGITS		4096
+
+static const char *digits = "123A456B789C*0#D";
+static const double freq_low[4] = { 697.0, 770.0, 852.0, 941.0 };
+static const double freq_high[4] = { 1209.0, 1336.0, 1477.0, 1633.0 };
+
+static sample_t signal[MAX_SAMPLES];
+static int signal_length;
+
+/* expected digits and where their segment (tone and pause) ends */
+static char expect_digit[MAX_DIGITS];
+static int expect_end[MAX_DIGITS];
+static int expect_count;
+
+/* received digits and when they were received */
+static char got_digit[MAX_DIGITS];
+static int got_pos[MAX_DIGITS];
+static int got_count;
+static int decode_pos;
+
+static uint32_t rand_state = 1;
+
+/* uniform noise -1 .. 1 */
+static double noise(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (double)((rand_state >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+static void recv_digit(void __attribute__((unused)) *priv, char digit, dtmf_meas_t __attribute__((unused)) *meas)
+{
+	if (got_count == MAX_DIGITS)
+		return;
+	got_digit[got_count] = digit;
+	got_pos[got_count] = decode_pos;
+	got_count++;
+}
+
+static void add_silence(double duration, double noise_db)
+{
+	int n = (int)(duration * SAMPLERATE), i;
+	double level = (noise_db > -100.0) ? db2level(noise_db) * sqrt(3.0) : 0.0;
+
+	for (i = 0; i < n && signal_length < MAX_SAMPLES; i++)
+		signal[signal_length++] = noise() * level;
+}
+
+/* add digit with frequency offset (percent), level of tones (dBm) and noise */
+static void add_digit(char digit, int expect, double duration, double pause, double offset, double low_db, double high_db, double noise_db)
+{
+	int n = (int)(duration * SAMPLERATE), d, i;
+	double f1, f2, a1, a2, p1, p2;
+
+	d = strchr(digits, digit) - digits;
+	f1 = freq_low[d / 4] * (1.0 + offset / 100.0);
+	f2 = freq_high[d % 4] * (1.0 - offset / 100.0);
+	a1 = db2level(low_db);
+	a2 = db2level(high_db);
+	p1 = noise() * M_PI;
+	p2 = noise() * M_PI;
+	for (i = 0; i < n && signal_length < MAX_SAMPLES; i++) {
+		signal[signal_length] = sin(2.0 * M_PI * f1 * i / SAMPLERATE + p1) * a1 + sin(2.0 * M_PI * f2 * i / SAMPLERATE + p2) * a2;
+		if (noise_db > -100.0)
+			signal[signal_length] += noise() * db2level(noise_db) * sqrt(3.0);
+		signal_length++;
+	}
+	add_silence(pause, noise_db);
+	expect_digit[expect_count] = (expect) ? digit : 0;
+	expect_end[expect_count] = signal_length;
+	expect_count++;
+}
+
+/* speech-like signal: voiced sound with moving pitch and formants, syllables and unvoiced parts */
+static void add_speech(double duration, double level_db)
+{
+	int n = (int)(duration * SAMPLERATE), i, h;
+	double t, f0, pitch_phase = 0.0, formant1, formant2, env, v, f;
+
+	for (i = 0; i < n && signal_length < MAX_SAMPLES; i++) {
+		t = (double)i / SAMPLERATE;
+		f0 = 110.0 + 50.0 * sin(2.0 * M_PI * 0.3 * t) + 20.0 * sin(2.0 * M_PI * 2.1 * t);
+		pitch_phase += 2.0 * M_PI * f0 / SAMPLERATE;
+		formant1 = 500.0 + 300.0 * sin(2.0 * M_PI * 1.7 * t);
+		formant2 = 1500.0 + 700.0 * sin(2.0 * M_PI * 1.1 * t + 1.0);
+		env = 0.5 - 0.5 * cos(2.0 * M_PI * 3.5 * t);
+		v = 0.0;
+		if (fmod(t, 1.7) < 0.15)
+			v = noise() * 0.3;
+		else {
+			for (h = 1; h * f0 < 3400.0; h++) {
+				f = h * f0;
+				v += sin(pitch_phase * h) * (1.0 / (1.0 + pow((f - formant1) / 150.0, 2)) + 0.7 / (1.0 + pow((f - formant2) / 200.0, 2)) + 0.05);
+			}
+			v *= 0.3;
+		}
+		signal[signal_length++] = v * env * db2level(level_db);
+	}
+}
+
+static void reset_corpus(void)
+{
+	signal_length = 0;
+	expect_count = 0;
+}
+
+static double get_time(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+struct result {
+	int correct, missed, wrong;
+	double seconds;
+};
+
+/* decode corpus and grade the digits received within each segment */
+static void decode_corpus(int goertzel, struct result *r)
+{
+	dtmf_dec_t dtmf;
+	double start;
+	int pos, seg, g, n;
+
+	dtmf_decode_init(&dtmf, NULL, recv_digit, SAMPLERATE, db2level(6.0), db2level(-30.0), DTMF_FREQ_MARGIN_PERCENT_DEFAULT);
+	got_count = 0;
+	start = get_time();
+	for (pos = 0; pos < signal_length; pos += CHUNK) {
+		n = signal_length - pos;
+		if (n > CHUNK)
+			n = CHUNK;
+		decode_pos = pos + n;
+		if (goertzel)
+			dtmf_decode(&dtmf, signal + pos, n);
+		else
+			dtmf_decode_fm(&dtmf, signal + pos, n);
+	}
+	r->seconds += get_time() - start;
+	dtmf_decode_exit(&dtmf);
+
+	g = 0;
+	for (seg = 0; seg < expect_count; seg++) {
+		n = 0;
+		for (; g < got_count && got_pos[g] <= expect_end[seg]; g++) {
+			if (got_digit[g] == expect_digit[seg] && !n)
+				r->correct++;
+			else
+				r->wrong++;
+			n++;
+		}
+		if (expect_digit[seg] && !n)
+			r->missed++;
+	}
+	/* anything after last segment */
+	r->wrong += got_count - g;
+}
+
+static void run(const char *name, struct result *res, int *expected)
+{
+	struct result r[2];
+	int i;
+
+	memset(r, 0, sizeof(r));
+	decode_corpus(0, &r[0]);
+	decode_corpus(1, &r[1]);
+	for (i = 0, *expected = 0; i < expect_count; i++) {
+		if (expect_digit[i])
+			(*expected)++;
+	}
+	printf("%-34s %5d | %5d %5d %5d %7.1f | %5d %5d %5d %7.1f\n", name, *expected,
+		r[0].correct, r[0].missed, r[0].wrong, r[0].seconds * 1e6 / ((double)signal_length / SAMPLERATE),
+		r[1].correct, r[1].missed, r[1].wrong, r[1].seconds * 1e6 / ((double)signal_length / SAMPLERATE));
+	*res = r[1];
+}
+
+int main(void)
+{
+	static const double offsets[] = { 0.0, 1.5, -1.5 };
+	static const double levels[][2] = { { -11.0, -9.0 }, { -25.0, -23.0 }, { -5.0, -2.0 }, { -8.0, -10.0 } };
+	struct result r;
+	int expected, errors = 0;
+	int d, o, l, i;
+
+	fm_init(0);
+
+	printf("%-34s %5s | %-31s | %-31s\n", "", "", "FM demodulators", "Goertzel bank");
+	printf("%-34s %5s | %5s %5s %5s %7s | %5s %5s %5s %7s\n", "corpus", "tones", "ok", "miss", "false", "us/s", "ok", "miss", "false", "us/s");
+
+	/* valid digits, must all be detected */
+	reset_corpus();
+	for (d = 0; d < 16; d++) {
+		for (o = 0; o < 3; o++) {
+			for (l = 0; l < 4; l++) {
+				add_digit(digits[d], 1, 0.040, 0.040, offsets[o], levels[l][0], levels[l][1], -200.0);
+				add_digit(digits[d], 1, 0.060, 0.060, offsets[o], levels[l][0], levels[l][1], -200.0);
+			}
+		}
+	}
+	run("valid digits", &r, &expected);
+	if (r.correct != expected || r.wrong)
+		errors++;
+
+	reset_corpus();
+	for (d = 0; d < 16; d++) {
+		for (i = 0; i < 6; i++)
+			add_digit(digits[d], 1, 0.050, 0.050, offsets[i % 3], -11.0, -9.0, -35.0);
+	}
+	run("valid digits, SNR 25 dB", &r, &expected);
+	if (r.correct != expected || r.wrong)
+		errors++;
+
+	/* invalid digits, must not be detected */
+	reset_corpus();
+	for (d = 0; d < 16; d++) {
+		add_digit(digits[d], 0, 0.060, 0.060, 4.0, -11.0, -9.0, -200.0);
+		add_digit(digits[d], 0, 0.060, 0.060, -4.0, -11.0, -9.0, -200.0);
+	}
+	run("frequency offset 4 %", &r, &expected);
+	if (r.wrong)
+		errors++;
+
+	reset_corpus();
+	for (d = 0; d < 16; d++) {
+		add_digit(digits[d], 0, 0.060, 0.060, 0.0, -20.0, -10.0, -200.0);
+		add_digit(digits[d], 0, 0.060, 0.060, 0.0, -5.0, -18.0, -200.0);
+	}
+	run("twist out of range", &r, &expected);
+	if (r.wrong)
+		errors++;
+
+	reset_corpus();
+	for (d = 0; d < 16; d++)
+		add_digit(digits[d], 0, 0.060, 0.060, 0.0, -40.0, -38.0, -200.0);
+	run("level too low", &r, &expected);
+	if (r.wrong)
+		errors++;
+
+	reset_corpus();
+	for (d = 0; d < 16; d++)
+		add_digit(digits[d], 0, 0.015, 0.060, 0.0, -11.0, -9.0, -200.0);
+	run("too short (15 ms)", &r, &expected);
+	if (r.wrong)
+		errors++;
+
+	/* no digits, count false detections */
+	reset_corpus();
+	add_silence(60.0, -10.0);
+	run("white noise -10 dBm, 60 s", &r, &expected);
+	if (r.wrong)
+		errors++;
+
+	reset_corpus();
+	add_speech(60.0, -6.0);
+	run("speech-like, 60 s", &r, &expected);
+	if (r.wrong)
+		errors++;
+
+	fm_exit();
+
+	if (errors) {
+		printf("Goertzel bank failed %d corpus(es)!\n", errors);
+		return 1;
+	}
+	printf("Goertzel bank passed all corpora.\n");
+
+	return 0;
+}
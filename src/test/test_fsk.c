@@ -0,0 +1,178 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../libsample/sample.h"
+#include "../libfm/fm.h"
+#include "../libfsk/fsk.h"
+
+#define SAMPLERATE	48000
+#define BITS		2000
+#define SAMPLES		(BITS * SAMPLERATE / 1200 + 1000)
+
+static uint8_t pattern[BITS];
+static int tx_pos;
+
+static int rx_bit_count;
+static uint8_t rx_bit[BITS * 2];
+static double rx_quality[BITS * 2];
+static double rx_level[BITS * 2];
+
+static int ring_count;
+static uint8_t ring_bit[BITS * 2];
+static double ring_quality[BITS * 2];
+static double ring_level[BITS * 2];
+static uint8_t ring_soft[BITS * 2];
+static uint64_t ring_time[BITS * 2];
+static int ring_error;
+
+static uint8_t ring_bits[64 / 8], ring_soft_buffer[64];
+static double ring_quality_buffer[64], ring_level_buffer[64];
+static uint64_t ring_time_buffer[64];
+static fsk_rx_ring_t ring = {
+	.bits = ring_bits,
+	.soft = ring_soft_buffer,
+	.quality = ring_quality_buffer,
+	.level = ring_level_buffer,
+	.time = ring_time_buffer,
+	.size = 64,
+};
+
+static int send_bit(void __attribute__((unused)) *inst)
+{
+	if (tx_pos == BITS)
+		return -1;
+	return pattern[tx_pos++];
+}
+
+static void receive_bit(void __attribute__((unused)) *inst, int bit, double quality, double level)
+{
+	if (rx_bit_count == BITS * 2)
+		return;
+	rx_quality[rx_bit_count] = quality;
+	rx_level[rx_bit_count] = level;
+	rx_bit[rx_bit_count++] = bit;
+}
+
+static void receive_bits(void __attribute__((unused)) *inst, fsk_rx_ring_t *r, int pos, int num)
+{
+	uint32_t word, expect;
+	int i, n;
+
+	if (num > r->size / 2)
+		ring_error = 1;
+
+	/* previous bits are kept before the new bits */
+	n = (ring_count < r->size / 2) ? ring_count : r->size / 2;
+	if (n > 32)
+		n = 32;
+	if (n) {
+		word = fsk_rx_ring_word(r, fsk_rx_ring_pos(r, pos, -n), n);
+		for (i = 0, expect = 0; i < n; i++)
+			expect = (expect << 1) | ring_bit[ring_count - n + i];
+		if (word != expect)
+			ring_error = 1;
+	}
+
+	/* new bits, read by word and by bit */
+	word = fsk_rx_ring_word(r, pos, (num > 32) ? 32 : num);
+	for (i = 0; i < num; i++, pos = fsk_rx_ring_pos(r, pos, 1)) {
+		if (i < 32 && ((word >> (((num > 32) ? 32 : num) - 1 - i)) & 1) != ((r->bits[pos >> 3] >> (7 - (pos & 7))) & 1))
+			ring_error = 1;
+		if (ring_count == BITS * 2)
+			continue;
+		ring_bit[ring_count] = (r->bits[pos >> 3] >> (7 - (pos & 7))) & 1;
+		ring_quality[ring_count] = r->quality[pos];
+		ring_level[ring_count] = r->level[pos];
+		ring_soft[ring_count] = r->soft[pos];
+		ring_time[ring_count] = r->time[pos];
+		ring_count++;
+	}
+}
+
+static sample_t samples[SAMPLES];
+
+int main(void)
+{
+	fsk_mod_t mod;
+	fsk_demod_t demod1, demod2;
+	int length, i, j, chunk;
+
+	fm_init(0);
+
+	/* pseudo random pattern */
+	for (i = 0; i < BITS; i++)
+		pattern[i] = (i * 2654435761u) >> 31;
+
+	/* modulate (NMT parameters) */
+	fsk_mod_init(&mod, NULL, send_bit, SAMPLERATE, 1200.0, 1800.0, 1200.0, 1.0, 1, 0);
+	length = fsk_mod_send(&mod, samples, SAMPLES, 0);
+	fsk_mod_cleanup(&mod);
+	printf("Modulated %d bits into %d samples.\n", BITS, length);
+
+	/* demodulate with per bit callback and with ring buffer, use odd chunk sizes */
+	fsk_demod_init(&demod1, NULL, receive_bit, SAMPLERATE, 1200.0, 1800.0, 1200.0, 0.1);
+	fsk_demod_init(&demod2, NULL, NULL, SAMPLERATE, 1200.0, 1800.0, 1200.0, 0.1);
+	fsk_demod_set_receive_bits(&demod2, receive_bits, &ring);
+	for (i = 0; i < length; i += chunk) {
+		chunk = 1234;
+		if (chunk > length - i)
+			chunk = length - i;
+		fsk_demod_receive(&demod1, samples + i, chunk);
+		fsk_demod_receive(&demod2, samples + i, chunk);
+	}
+	fsk_demod_cleanup(&demod1);
+	fsk_demod_cleanup(&demod2);
+	printf("Demodulated %d bits.\n", rx_bit_count);
+
+	/* both modes must agree bit for bit */
+	if (ring_error) {
+		printf("Bits in ring buffer are not delivered as documented, please fix!\n");
+		return 1;
+	}
+	if (rx_bit_count != ring_count) {
+		printf("Number of bits differ: %d bits by callback, %d bits by ring buffer, please fix!\n", rx_bit_count, ring_count);
+		return 1;
+	}
+	for (i = 0; i < rx_bit_count; i++) {
+		if (rx_bit[i] != ring_bit[i] || rx_quality[i] != ring_quality[i] || rx_level[i] != ring_level[i]) {
+			printf("Bit %d differs, please fix!\n", i);
+			return 1;
+		}
+		if (i && ring_time[i] <= ring_time[i - 1]) {
+			printf("Time stamp of bit %d does not increase, please fix!\n", i);
+			return 1;
+		}
+		if (rx_quality[i] > 0.5 && (ring_soft[i] < 128) != (rx_bit[i] == 0)) {
+			printf("Soft value %d of bit %d does not match, please fix!\n", ring_soft[i], i);
+			return 1;
+		}
+	}
+	printf("Both modes received the same %d bits.\n", rx_bit_count);
+
+	/* a part of the transmitted pattern must be found in the received bits */
+	for (j = 0; j <= rx_bit_count - BITS / 2; j++) {
+		for (i = 0; i < BITS / 2; i++) {
+			if (rx_bit[j + i] != pattern[BITS / 4 + i])
+				break;
+		}
+		if (i == BITS / 2)
+			break;
+	}
+	if (j > rx_bit_count - BITS / 2) {
+		printf("Transmitted bits not found in received bits, please fix!\n");
+		return 1;
+	}
+	for (i = 0; i < BITS / 2; i++) {
+		if (rx_quality[j + i] < 0.5) {
+			printf("Quality %.3f of bit %d is too low, please fix!\n", rx_quality[j + i], j + i);
+			return 1;
+		}
+	}
+	printf("Transmitted bits are received correctly.\n");
+
+	fm_exit();
+
+	return 0;
+}
+
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include <osmocom/core/timer.h>
+#include "../libmobile/main_mobile.h"
+#include "../libmobile/get_time.h"
+#include "../libmobile/timer_wheel.h"
+#include "../mpt1327/mpt1327.h"
+#include "../mpt1327/message.h"
+
+#define DB_FILE		"test_mpt1327_units.db"
+#define UNITS		50000
+#define BATCH		10000
+#define BURST		1000
+
+const char *aaimage[] = { NULL };
+
+void print_help(const char __attribute__((unused)) *arg0) { }
+
+static mpt1327_t cc;
+static int acks;
+static uint8_t ack_prefix[BURST];
+static uint16_t ack_ident[BURST];
+
+/* the i-th unit of the test, all units are different */
+static void unit_id(int i, uint8_t *prefix, uint16_t *ident)
+{
+	*prefix = i % 128;
+	*ident = 1 + i / 128;
+}
+
+static void receive_rqr(uint8_t prefix, uint16_t ident)
+{
+	mpt1327_codeword_t codeword;
+
+	memset(&codeword, 0, sizeof(codeword));
+	codeword.type = MPT_RQR;
+	codeword.params[MPT_PFIX] = prefix;
+	codeword.params[MPT_IDENT1] = ident;
+	mpt1327_receive_codeword(&cc, mpt1327_encode_codeword(&codeword), 1.0, 1.0);
+}
+
+/* send codewords of control channel, record acknowledged registrations */
+static void send_slots(int slots)
+{
+	mpt1327_codeword_t codeword;
+	uint64_t bits;
+
+	while (slots--) {
+		if (!mpt1327_send_codeword(&cc, &bits))
+			continue;
+		if (mpt1327_decode_codeword(&codeword, -1, MPT_DOWN, bits) < 0)
+			continue;
+		if (codeword.type != MPT_ACK || codeword.params[MPT_IDENT1] != IDENT_REGI)
+			continue;
+		if (acks < BURST) {
+			ack_prefix[acks] = codeword.params[MPT_PFIX];
+			ack_ident[acks] = codeword.params[MPT_IDENT2];
+		}
+		acks++;
+	}
+}
+
+static void init_cc(void)
+{
+	memset(&cc, 0, sizeof(cc));
+	cc.sender.kanal = "1";
+	cc.band = BAND_REGIONET43_SUB1;
+	cc.chan_type = CHAN_TYPE_CC_TC;
+	cc.dsp_mode = DSP_MODE_CONTROL;
+	cc.tx_sched.state = SCHED_STATE_CC_IDLE;
+	/* get through startup sequence */
+	send_slots(100);
+	acks = 0;
+}
+
+/* registrations that arrive at once are acknowledged in the order of arrival */
+static int test_burst(void)
+{
+	uint8_t prefix;
+	uint16_t ident;
+	int i;
+
+	for (i = 0; i < BURST; i++) {
+		unit_id(i * 37 % UNITS, &prefix, &ident);
+		receive_rqr(prefix, ident);
+	}
+	send_slots(BURST * 3);
+	if (acks != BURST) {
+		printf("Burst: %d of %d registrations acknowledged!\n", acks, BURST);
+		return -1;
+	}
+	for (i = 0; i < BURST; i++) {
+		unit_id(i * 37 % UNITS, &prefix, &ident);
+		if (ack_prefix[i] != prefix || ack_ident[i] != ident) {
+			printf("Burst: acknowledge %d is for unit %03d%04d, expecting %03d%04d!\n", i, ack_prefix[i], ack_ident[i], prefix, ident);
+			return -1;
+		}
+	}
+	printf("%d registrations at once are acknowledged in order.\n", BURST);
+
+	return 0;
+}
+
+/* each registration is answered in the next address slot, one CCSC slot in between */
+static int run_registrations(const char *what, int random_units)
+{
+	uint8_t prefix;
+	uint16_t ident;
+	uint32_t r = 1;
+	double start, duration;
+	int i, b;
+
+	printf("%s:\n", what);
+	for (b = 0; b < UNITS; b += BATCH) {
+		acks = 0;
+		start = get_time();
+		for (i = b; i < b + BATCH; i++) {
+			if (random_units) {
+				r = r * 1103515245 + 12345;
+				unit_id((r >> 8) % UNITS, &prefix, &ident);
+			} else
+				unit_id(i, &prefix, &ident);
+			receive_rqr(prefix, ident);
+			send_slots(2);
+		}
+		duration = get_time() - start;
+		if (acks != BATCH) {
+			printf("%d of %d registrations acknowledged!\n", acks, BATCH);
+			return -1;
+		}
+		printf(" units %5d..%5d: %.2f us per registration (one codeword received, two sent)\n", b, b + BATCH - 1, duration / BATCH * 1e6);
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	int rc;
+
+	loglevel = LOGL_ERROR;
+	unlink(DB_FILE);
+
+	init_codeword();
+	init_sysdef(0x2123, 10, 5, 1, 30);
+	init_cc();
+
+	rc = load_units(DB_FILE);
+	if (rc != 0) {
+		printf("Loading empty snapshot returned %d!\n", rc);
+		return 1;
+	}
+
+	if (test_burst())
+		return 1;
+	if (run_registrations("Registration of new units", 0))
+		return 1;
+	if (run_registrations("Registration of known units", 1))
+		return 1;
+
+	/* all units are kept in the snapshot */
+	flush_units();
+	rc = load_units(DB_FILE);
+	if (rc != UNITS) {
+		printf("Loaded %d units from snapshot, expecting %d!\n", rc, UNITS);
+		return 1;
+	}
+	printf("%d units restored from snapshot.\n", rc);
+	flush_units();
+
+	unlink(DB_FILE);
+
+	return 0;
+}
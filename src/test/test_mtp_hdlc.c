@@ -0,0 +1,372 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <osmocom/core/timer.h>
+#include "../liblogging/logging.h"
+#include "../libmtp/mtp.h"
+#include "../libmtp/crc16.h"
+
+#define ROUNDS		200
+#define MSUS		20
+#define ROUND_BYTES	8000
+#define BENCH_BYTES	1000000
+#define BLOCK		60	/* 100 ms at 4800 bit/s */
+
+/* received frames are written to a log, so that receivers can be compared */
+struct rx_log {
+	uint8_t		*data;
+	int		len, size;
+	int		msu, lssu, fisu;
+};
+
+static void log_append(struct rx_log *log, uint8_t *data, int len)
+{
+	if (log->len + len > log->size) {
+		log->size = (log->len + len) * 2;
+		log->data = realloc(log->data, log->size);
+		if (!log->data) {
+			fprintf(stderr, "No memory!\n");
+			abort();
+		}
+	}
+	memcpy(log->data + log->len, data, len);
+	log->len += len;
+}
+
+static void log_msu(struct rx_log *log, uint8_t sio, uint8_t *data, int len)
+{
+	uint8_t header[3] = { sio, len, len >> 8 };
+
+	log_append(log, header, 3);
+	log_append(log, data, len);
+}
+
+static void receive_lssu(mtp_t *mtp, uint8_t __attribute__((unused)) fsn, uint8_t __attribute__((unused)) bib, uint8_t __attribute__((unused)) status)
+{
+	struct rx_log *log = mtp->inst;
+
+	log->lssu++;
+}
+
+static void receive_fisu(mtp_t *mtp, uint8_t __attribute__((unused)) bsn, uint8_t __attribute__((unused)) bib, uint8_t __attribute__((unused)) fsn, uint8_t __attribute__((unused)) fib)
+{
+	struct rx_log *log = mtp->inst;
+
+	log->fisu++;
+}
+
+static void receive_msu(mtp_t *mtp, uint8_t __attribute__((unused)) bsn, uint8_t __attribute__((unused)) bib, uint8_t __attribute__((unused)) fsn, uint8_t __attribute__((unused)) fib, uint8_t sio, uint8_t *data, int len)
+{
+	struct rx_log *log = mtp->inst;
+
+	log->msu++;
+	log_msu(log, sio, data, len);
+}
+
+/* reference implementation, independent from the table driven CRC */
+static uint16_t crc16_bitwise(uint8_t *data, int length)
+{
+	uint16_t crc = 0xffff;
+	int i;
+
+	while (length--) {
+		crc ^= *data++;
+		for (i = 0; i < 8; i++)
+			crc = (crc & 1) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+	}
+
+	return ~crc;
+}
+
+static double now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+
+	return (double)tv.tv_sec + (double)tv.tv_usec / 1e6;
+}
+
+static void init_link(mtp_t *mtp, const char *name, void *inst)
+{
+	mtp_init(mtp, name, inst, NULL, 4800, 1, 0, 0, 0);
+	/* no alignment procedure, send MSUs and FISUs right away */
+	mtp->l2_state = MTP_L2STATE_IN_SERVICE;
+	mtp->tx_lssu = -1;
+}
+
+/* random MSU with long runs of '1' and flag patterns, to force bit stuffing */
+static int random_msu(uint8_t *data)
+{
+	int len, i;
+
+	/* an MSU with one octet would be taken as an LSSU */
+	len = 2 + random() % 199;
+	for (i = 0; i < len; i++) {
+		switch (random() % 4) {
+		case 0:
+			data[i] = 0xff;
+			break;
+		case 1:
+			data[i] = 0x7e;
+			break;
+		default:
+			data[i] = random();
+		}
+	}
+
+	return len;
+}
+
+static void send_serial(mtp_t *mtp, uint8_t *data, int len)
+{
+	int i, j;
+
+	for (i = 0; i < len; i++) {
+		data[i] = 0;
+		for (j = 0; j < 8; j++)
+			data[i] |= mtp_send_bit(mtp) << j;
+	}
+}
+
+static void receive_serial(mtp_t *mtp, uint8_t *data, int len)
+{
+	int i, j;
+
+	for (i = 0; i < len; i++) {
+		for (j = 0; j < 8; j++)
+			mtp_receive_bit(mtp, (data[i] >> j) & 1);
+	}
+}
+
+/* send in random blocks, sometimes interrupted by bitwise transmission */
+static void send_bulk(mtp_t *mtp, uint8_t *data, int len)
+{
+	int i, chunk;
+
+	for (i = 0; i < len; i += chunk) {
+		chunk = 1 + random() % 300;
+		if (chunk > len - i)
+			chunk = len - i;
+		if (random() % 8 == 0)
+			send_serial(mtp, data + i, chunk);
+		else
+			mtp_send_block(mtp, data + i, chunk);
+	}
+}
+
+static void receive_bulk(mtp_t *mtp, uint8_t *data, int len)
+{
+	int i, chunk;
+
+	for (i = 0; i < len; i += chunk) {
+		chunk = 1 + random() % 300;
+		if (chunk > len - i)
+			chunk = len - i;
+		if (random() % 8 == 0)
+			receive_serial(mtp, data + i, chunk);
+		else
+			mtp_receive_block(mtp, data + i, chunk);
+	}
+}
+
+/* distort stream: bit errors, aborts and long frames without flags */
+static void distort(uint8_t *data, int len)
+{
+	int i, j;
+
+	for (i = 0; i < len; i++) {
+		switch (random() % 2000) {
+		case 0:
+			data[i] = 0xff;
+			break;
+		case 1:
+			for (j = 0; j < 400 && i < len; j++, i++)
+				data[i] = 0x55;
+			break;
+		case 2:
+		case 3:
+		case 4:
+		case 5:
+			data[i] ^= 1 << (random() & 7);
+			break;
+		}
+	}
+}
+
+static int compare_log(struct rx_log *a, struct rx_log *b)
+{
+	if (a->len != b->len || memcmp(a->data, b->data, a->len)
+	 || a->msu != b->msu || a->lssu != b->lssu || a->fisu != b->fisu)
+		return -1;
+	return 0;
+}
+
+static int check_crc(void)
+{
+	uint8_t data[300];
+	int i, j, len;
+
+	for (i = 0; i < 100000; i++) {
+		len = random() % sizeof(data);
+		for (j = 0; j < len; j++)
+			data[j] = random();
+		if (calc_crc16(data, len) != crc16_bitwise(data, len)) {
+			printf("CRC of %d bytes differs from reference!\n", len);
+			return -1;
+		}
+	}
+	printf("CRC is identical to reference implementation.\n");
+
+	return 0;
+}
+
+static int check_round_trip(void)
+{
+	static uint8_t serial[ROUND_BYTES], bulk[ROUND_BYTES];
+	struct rx_log sent = { NULL, 0, 0, 0, 0, 0 };
+	struct rx_log rx_serial = { NULL, 0, 0, 0, 0, 0 }, rx_bulk = { NULL, 0, 0, 0, 0, 0 };
+	struct rx_log err_serial = { NULL, 0, 0, 0, 0, 0 }, err_bulk = { NULL, 0, 0, 0, 0, 0 };
+	mtp_t tx_serial, tx_bulk, rx_serial_mtp, rx_bulk_mtp, err_serial_mtp, err_bulk_mtp;
+	uint8_t data[272], sio;
+	int round, i, len, rc = -1;
+
+	init_link(&tx_serial, "tx serial", NULL);
+	init_link(&tx_bulk, "tx bulk", NULL);
+	init_link(&rx_serial_mtp, "rx serial", &rx_serial);
+	init_link(&rx_bulk_mtp, "rx bulk", &rx_bulk);
+	init_link(&err_serial_mtp, "rx serial distorted", &err_serial);
+	init_link(&err_bulk_mtp, "rx bulk distorted", &err_bulk);
+
+	for (round = 0; round < ROUNDS; round++) {
+		for (i = 0; i < MSUS; i++) {
+			len = random_msu(data);
+			sio = random();
+			mtp_l3l2(&tx_serial, MTP_PRIM_DATA, sio, data, len);
+			mtp_l3l2(&tx_bulk, MTP_PRIM_DATA, sio, data, len);
+			log_msu(&sent, sio, data, len);
+		}
+
+		/* both transmitters must generate the same bit stream */
+		send_serial(&tx_serial, serial, ROUND_BYTES);
+		send_bulk(&tx_bulk, bulk, ROUND_BYTES);
+		if (memcmp(serial, bulk, ROUND_BYTES)) {
+			printf("Bulk transmission differs from bitwise transmission in round %d!\n", round);
+			goto out;
+		}
+		/* all messages have been sent, no acknowledge required */
+		mtp_flush(&tx_serial);
+		mtp_flush(&tx_bulk);
+
+		/* both receivers must receive the same frames */
+		receive_serial(&rx_serial_mtp, serial, ROUND_BYTES);
+		receive_bulk(&rx_bulk_mtp, bulk, ROUND_BYTES);
+
+		/* same with distorted stream, including aborts and oversized frames */
+		distort(serial, ROUND_BYTES);
+		memcpy(bulk, serial, ROUND_BYTES);
+		receive_serial(&err_serial_mtp, serial, ROUND_BYTES);
+		receive_bulk(&err_bulk_mtp, bulk, ROUND_BYTES);
+		if (err_serial_mtp.rx_octet_counting != err_bulk_mtp.rx_octet_counting
+		 || err_serial_mtp.rx_octet_count != err_bulk_mtp.rx_octet_count) {
+			printf("Octet counting of bulk reception differs in round %d!\n", round);
+			goto out;
+		}
+	}
+
+	if (compare_log(&rx_serial, &rx_bulk) || sent.len != rx_serial.len || memcmp(sent.data, rx_serial.data, sent.len)) {
+		printf("Received MSUs differ from transmitted MSUs!\n");
+		goto out;
+	}
+	printf("Round trip of %d MSUs: bitwise and bulk transmission/reception are identical (%d FISUs).\n", rx_serial.msu, rx_serial.fisu);
+	if (compare_log(&err_serial, &err_bulk)) {
+		printf("Bulk reception of distorted stream differs from bitwise reception!\n");
+		goto out;
+	}
+	printf("Distorted stream: bitwise and bulk reception are identical (%d of %d MSUs received).\n", err_serial.msu, rx_serial.msu);
+
+	rc = 0;
+
+out:
+	mtp_exit(&tx_serial);
+	mtp_exit(&tx_bulk);
+	free(sent.data);
+	free(rx_serial.data);
+	free(rx_bulk.data);
+	free(err_serial.data);
+	free(err_bulk.data);
+
+	return rc;
+}
+
+static void benchmark(void)
+{
+	static uint8_t stream[BENCH_BYTES];
+	struct rx_log log = { NULL, 0, 0, 0, 0, 0 };
+	mtp_t tx, rx;
+	uint8_t data[272];
+	double start, serial, bulk;
+	int i, len;
+	uint16_t crc = 0;
+
+	init_link(&tx, "tx", NULL);
+	init_link(&rx, "rx", &log);
+
+	/* prepare a stream of MSUs */
+	for (i = 0; i < 100; i++) {
+		len = random_msu(data);
+		mtp_l3l2(&tx, MTP_PRIM_DATA, 0x83, data, len);
+	}
+
+	start = now();
+	send_serial(&tx, stream, BENCH_BYTES);
+	serial = now() - start;
+	start = now();
+	for (i = 0; i < BENCH_BYTES; i += BLOCK)
+		mtp_send_block(&tx, stream + i, BLOCK);
+	bulk = now() - start;
+	printf("Transmission: bitwise %.1f Mbit/s, bulk %.1f Mbit/s\n", BENCH_BYTES * 8 / serial / 1e6, BENCH_BYTES * 8 / bulk / 1e6);
+
+	start = now();
+	receive_serial(&rx, stream, BENCH_BYTES);
+	serial = now() - start;
+	start = now();
+	for (i = 0; i < BENCH_BYTES; i += BLOCK)
+		mtp_receive_block(&rx, stream + i, BLOCK);
+	bulk = now() - start;
+	printf("Reception: bitwise %.1f Mbit/s, bulk %.1f Mbit/s\n", BENCH_BYTES * 8 / serial / 1e6, BENCH_BYTES * 8 / bulk / 1e6);
+
+	start = now();
+	for (i = 0; i + 272 <= BENCH_BYTES; i += 272)
+		crc ^= crc16_bitwise(stream + i, 272);
+	serial = now() - start;
+	start = now();
+	for (i = 0; i + 272 <= BENCH_BYTES; i += 272)
+		crc += calc_crc16(stream + i, 272);
+	bulk = now() - start;
+	printf("CRC: bitwise %.1f Mbit/s, slicing-by-8 %.1f Mbit/s (checksum 0x%04x)\n", BENCH_BYTES * 8 / serial / 1e6, BENCH_BYTES * 8 / bulk / 1e6, crc);
+
+	mtp_exit(&tx);
+	free(log.data);
+}
+
+int main(void)
+{
+	loglevel = LOGL_ERROR;
+
+	func_mtp_receive_lssu = receive_lssu;
+	func_mtp_receive_fisu = receive_fisu;
+	func_mtp_receive_msu = receive_msu;
+
+	if (check_crc())
+		return 1;
+
+	if (check_round_trip())
+		return 1;
+
+	benchmark();
+
+	return 0;
+}
@@ -1,16 +1,20 @@
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <math.h>
 #include <string.h>
 #include <sys/time.h>
 #include "../libsample/sample.h"
 #include "../libfilter/iir_filter.h"
 #include "../libfm/fm.h"
+#include "../libfsk/fsk.h"
+#include "../tv/bas.h"
+#include "../tv/tv_modulate.h"
 #include "../liblogging/logging.h"
 
 struct timeval start_tv, tv;
 double duration;
-int tot_samples;
+double tot_samples;
 
 #define T_START() \
 	gettimeofday(&start_tv, NULL); \
@@ -31,10 +35,139 @@ int tot_samples;
 #define SAMPLES 1000
 sample_t samples[SAMPLES], I[SAMPLES], Q[SAMPLES];
 uint8_t power[SAMPLES];
+uint8_t power_tv[20000];
 float buff[SAMPLES * 2];
 fm_mod_t mod;
 fm_demod_t demod;
 iir_filter_t lp;
+fsk_mod_t fsk;
+int fsk_pos;
+
+static int fsk_send_bit(void __attribute__((unused)) *inst)
+{
+	return (fsk_pos++ * 2654435761u) >> 31;
+}
+
+static int fsk_send_bits(void __attribute__((unused)) *inst, uint8_t *bits, int max)
+{
+	int i;
+
+	for (i = 0; i < max / 8; i++)
+		bits[i] = (fsk_pos++ * 2654435761u) >> 24;
+	return max / 8 * 8;
+}
+
+/* compare the cached modulator with sample by sample rendering, then measure both */
+static int fsk_benchmark(const char *name, double bitrate, double f0, double f1, int ffsk)
+{
+	static sample_t ref[48000];
+	char what[128];
+	int cached, i, j;
+
+	fsk_mod_init(&fsk, NULL, fsk_send_bit, 48000, bitrate, f0, f1, 1.0, ffsk, 0);
+	fsk.cache_samples = 0; /* force rendering sample by sample */
+	fsk_pos = 0;
+	for (i = 0; i < 48000; i += SAMPLES)
+		fsk_mod_send(&fsk, ref + i, SAMPLES, 0);
+	fsk_mod_cleanup(&fsk);
+	fsk_mod_init(&fsk, NULL, fsk_send_bit, 48000, bitrate, f0, f1, 1.0, ffsk, 0);
+	if (!fsk.cache_samples) {
+		printf("%s: waveform cache is not used!\n", name);
+		return -1;
+	}
+	fsk_pos = 0;
+	for (i = 0; i < 48000; i += SAMPLES) {
+		fsk_mod_send(&fsk, samples, SAMPLES, 0);
+		for (j = 0; j < SAMPLES; j++) {
+			/* the start phase of a cached waveform may differ by a fraction of the sine table */
+			if (fabs(samples[j] - ref[i + j]) > 0.001) {
+				printf("%s: sample %d of cached waveform is %.4f, expecting %.4f!\n", name, i + j, samples[j], ref[i + j]);
+				return -1;
+			}
+		}
+	}
+	fsk_mod_cleanup(&fsk);
+
+	fsk_mod_init(&fsk, NULL, fsk_send_bit, 48000, bitrate, f0, f1, 1.0, ffsk, 0);
+	fsk.cache_samples = 0; /* force rendering sample by sample */
+	sprintf(what, "%s modulate (per bit, no cache)", name);
+	T_START()
+	fsk_mod_send(&fsk, samples, SAMPLES, 0);
+	T_STOP(what, SAMPLES)
+	fsk_mod_cleanup(&fsk);
+
+	fsk_mod_init(&fsk, NULL, fsk_send_bit, 48000, bitrate, f0, f1, 1.0, ffsk, 0);
+	sprintf(what, "%s modulate (per bit, waveform cache)", name);
+	T_START()
+	fsk_mod_send(&fsk, samples, SAMPLES, 0);
+	T_STOP(what, SAMPLES)
+	/* if the cache is full, waveforms are rendered for every bit */
+	cached = fsk.cache_num[0][0] + fsk.cache_num[0][1];
+	printf("%s: %d waveforms cached, cache is %s\n", name, cached, (fsk.cache_num[0][0] < FSK_CACHE_PHASES && fsk.cache_num[0][1] < FSK_CACHE_PHASES) ? "not full" : "full");
+	fsk_mod_cleanup(&fsk);
+
+	fsk_mod_init(&fsk, NULL, NULL, 48000, bitrate, f0, f1, 1.0, ffsk, 0);
+	fsk_mod_set_send_bits(&fsk, fsk_send_bits);
+	sprintf(what, "%s modulate (batch bits, waveform cache)", name);
+	T_START()
+	fsk_mod_send(&fsk, samples, SAMPLES, 0);
+	T_STOP(what, SAMPLES)
+	fsk_mod_cleanup(&fsk);
+
+	return 0;
+}
+
+/* PAL video carrier and sound carrier with test tone at given sample rate */
+static void tv_benchmark(double samplerate)
+{
+	int frame = samplerate / 25.0 + 10.0, chunk = samplerate / 1000.0;
+	sample_t *bas, *tone;
+	float *iq;
+	bas_t gen;
+	tv_mod_t tvmod;
+	char what[64];
+	int count, pos, n, i;
+
+	bas = calloc(frame, sizeof(*bas));
+	tone = calloc(chunk, sizeof(*tone));
+	iq = calloc(frame * 2, sizeof(*iq));
+	if (!bas || !tone || !iq)
+		abort();
+	bas_init(&gen, samplerate, BAS_FUBK, 1, 6.7, 0, 0, "Jolly  Roger", 0, NULL, 0, 0);
+	count = bas_generate(&gen, bas);
+	for (i = 0; i < chunk; i++)
+		tone[i] = sin((double)i * 2.0 * M_PI * 1000.0 / samplerate) * 50000.0;
+
+	sprintf(what, "TV modulate video (%.1f MS/s)", samplerate / 1e6);
+	T_START()
+	tv_modulate(iq, count, bas, 0.7);
+	T_STOP(what, count)
+
+	/* static picture: video from cache, sound carrier mixed to it */
+	tv_mod_init(&tvmod, samplerate, 0.7, count, chunk, 5500000.0, 0.07);
+	tv_mod_video(&tvmod, bas, count);
+	sprintf(what, "TV cached video + FM sound (%.1f MS/s)", samplerate / 1e6);
+	T_START()
+	tvmod.video_pos = 0;
+	for (pos = 0; pos < count; pos += n)
+		n = tv_mod_read(&tvmod, iq + pos * 2, chunk, tone);
+	T_STOP(what, count)
+	tv_mod_exit(&tvmod);
+
+	/* sound carrier with FM modulator of libfm */
+	fm_mod_init(&mod, samplerate, 5500000.0, 0.07);
+	mod.state = MOD_STATE_ON;
+	sprintf(what, "TV FM sound with libfm (%.1f MS/s)", samplerate / 1e6);
+	T_START()
+	for (pos = 0; pos < count; pos += chunk)
+		fm_modulate_complex(&mod, tone, power_tv, (count - pos < chunk) ? count - pos : chunk, iq + pos * 2);
+	T_STOP(what, count)
+	fm_mod_exit(&mod);
+
+	free(bas);
+	free(tone);
+	free(iq);
+}
 
 int main(void)
 {
@@ -84,6 +217,17 @@ int main(void)
 	iir_process(&lp, samples, SAMPLES);
 	T_STOP("low-pass filter (eighth order)", SAMPLES)
 
+	/* NMT like FFSK, 1200 baud */
+	if (fsk_benchmark("NMT FFSK", 1200.0, 1800.0, 1200.0, 1))
+		return 1;
+	/* B-Netz like FSK, 100 baud, start phase of a bit is not rounded */
+	if (fsk_benchmark("B-Netz FSK", 100.0, 2070.0, 1950.0, 0))
+		return 1;
+
+	memset(power_tv, 1, sizeof(power_tv));
+	tv_benchmark(13500000.0);
+	tv_benchmark(20000000.0);
+
 	fm_exit();
 
 	return 0;
@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../libmobile/main_mobile.h"
+#include "../pocsag/pocsag.h"
+#include "../pocsag/frame.h"
+#include "../pocsag/dsp.h"
+
+#define SAMPLERATE	12000
+#define BAUDRATE	1200
+#define MESSAGES	200
+#define WORDS		1000000
+
+static char rx_text[256];
+static int rx_count;
+
+/* used by pocsag_msg_receive() */
+int msg_receive(const char *text)
+{
+	strncpy(rx_text, text, sizeof(rx_text) - 1);
+	rx_count++;
+	return 0;
+}
+
+void print_help(const char __attribute__((unused)) *arg0) { }
+
+/* reference encoder, independent from the implementation */
+static uint32_t encode(uint32_t data)
+{
+	uint32_t word = data << 10;
+	int i, parity = 0;
+
+	for (i = 30; i >= 10; i--) {
+		if ((word >> i) & 1)
+			word ^= 0x769 << (i - 10);
+	}
+	word = (data << 10) | word;
+	word <<= 1;
+	for (i = 1; i < 32; i++)
+		parity ^= (word >> i) & 1;
+
+	return word | parity;
+}
+
+static uint32_t random_error(int bits)
+{
+	uint32_t error = 0;
+
+	while (__builtin_popcount(error) < bits)
+		error |= 1u << (random() & 31);
+
+	return error;
+}
+
+static int check_correction(void)
+{
+	uint32_t word, received, error;
+	int i, j, bits, rc;
+
+	/* every single and double bit error at every position */
+	word = encode(0x12345);
+	for (i = 0; i < 32; i++) {
+		for (j = i; j < 32; j++) {
+			error = (1u << i) | (1u << j);
+			received = word ^ error;
+			rc = correct_codeword(&received);
+			if (rc != ((i == j) ? 1 : 2) || received != word) {
+				printf("Error pattern 0x%08x not corrected!\n", error);
+				return -1;
+			}
+		}
+	}
+
+	/* random codewords with up to three bit errors */
+	for (i = 0; i < WORDS; i++) {
+		word = encode(random() & 0x1fffff);
+		bits = i & 3;
+		received = word ^ random_error(bits);
+		rc = correct_codeword(&received);
+		if (bits < 3 && (rc != bits || received != word)) {
+			printf("Codeword 0x%08x with %d bit error(s) not corrected!\n", word, bits);
+			return -1;
+		}
+		if (bits == 3 && rc >= 0) {
+			printf("Codeword 0x%08x with 3 bit errors not detected!\n", word);
+			return -1;
+		}
+	}
+	printf("Corrected all single and double bit errors, detected all triple bit errors.\n");
+
+	return 0;
+}
+
+static void benchmark(void)
+{
+	static uint32_t words[4096];
+	struct timeval start_tv, tv;
+	double duration;
+	uint32_t word;
+	int i, j, rc, sum = 0;
+
+	for (i = 0; i < 4096; i++)
+		words[i] = encode(random() & 0x1fffff) ^ random_error(i % 3);
+
+	gettimeofday(&start_tv, NULL);
+	for (j = 0; j < WORDS / 4096 * 10; j++) {
+		for (i = 0; i < 4096; i++) {
+			word = words[i];
+			rc = correct_codeword(&word);
+			sum += rc;
+		}
+	}
+	gettimeofday(&tv, NULL);
+	duration = (double)tv.tv_sec + (double)tv.tv_usec / 1e6;
+	duration -= (double)start_tv.tv_sec + (double)start_tv.tv_usec / 1e6;
+	printf("Decoding: %.1f ns/codeword (checksum %d)\n", duration * 1e9 / (double)(j * 4096), sum);
+}
+
+/* send one message through the decoder with given bit error rate, return 1 if received correctly */
+static int transfer_message(pocsag_t *tx, pocsag_t *rx, int number, double ber)
+{
+	static sample_t spl[32 * SAMPLERATE / BAUDRATE];
+	char text[128], expect[160];
+	int64_t word;
+	int i, s, bit, n;
+
+	sprintf(text, "Message %d: The quick brown fox jumps over the lazy dog.", number);
+	pocsag_msg_create(tx, 0, 1000000 + number, POCSAG_FUNCTION_ALPHA, text, strlen(text), 0);
+	sprintf(expect, " %d,alphanumeric,%s", 1000000 + number, text);
+
+	rx_count = 0;
+	rx_text[0] = '\0';
+	while ((word = get_codeword(tx)) >= 0) {
+		for (i = 31, n = 0; i >= 0; i--) {
+			bit = (word >> i) & 1;
+			if ((double)random() / (double)RAND_MAX < ber)
+				bit = !bit;
+			/* negative polarity */
+			for (s = 0; s < SAMPLERATE / BAUDRATE; s++)
+				spl[n++] = (bit) ? -1.0 : 1.0;
+		}
+		fsk_decode(rx, spl, n);
+	}
+
+	return (rx_count == 1 && strstr(rx_text, expect));
+}
+
+int main(void)
+{
+	static const double ber[] = { 0.0, 0.001, 0.005, 0.01, 0.02, 0.03 };
+	pocsag_t tx, rx;
+	int b, distance, i, ok;
+
+	loglevel = LOGL_ERROR;
+	pocsag_init();
+
+	if (check_correction())
+		return 1;
+
+	benchmark();
+
+	memset(&tx, 0, sizeof(tx));
+	tx.sender.kanal = "tx";
+	tx.tx = 1;
+	tx.padding = 4;
+	dsp_init_sender(&tx, SAMPLERATE, BAUDRATE, 4500.0, -1.0);
+
+	for (distance = 0; distance <= 2; distance += 2) {
+		printf("Sync distance %d:\n", distance);
+		for (b = 0; b < (int)(sizeof(ber) / sizeof(ber[0])); b++) {
+			memset(&rx, 0, sizeof(rx));
+			rx.sender.kanal = "rx";
+			rx.rx = 1;
+			rx.fsk_rx_sync_distance = distance;
+			dsp_init_sender(&rx, SAMPLERATE, BAUDRATE, 4500.0, -1.0);
+			for (i = 0, ok = 0; i < MESSAGES; i++)
+				ok += transfer_message(&tx, &rx, i, ber[b]);
+			printf(" bit error rate %.3f: %3d of %d messages received (%5.1f%%), %u codewords, %u corrected, %u uncorrectable\n", ber[b], ok, MESSAGES, (double)ok * 100.0 / MESSAGES, rx.rx_words, rx.rx_words_corrected, rx.rx_words_failed);
+			if (ber[b] == 0.0 && ok != MESSAGES) {
+				printf("Messages lost without bit errors!\n");
+				return 1;
+			}
+			dsp_cleanup_sender(&rx);
+		}
+	}
+
+	dsp_cleanup_sender(&tx);
+
+	return 0;
+}
@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../libmobile/main_mobile.h"
+#include "../pocsag/pocsag.h"
+#include "../pocsag/frame.h"
+
+#define BAUDRATE	1200
+#define PAGES		5000
+#define URGENT_RIC	1500000
+
+int msg_receive(const char __attribute__((unused)) *text)
+{
+	return 0;
+}
+
+void print_help(const char __attribute__((unused)) *arg0) { }
+
+/* queue pages, clustered > 0 puts given percentage of pages into frame 0 */
+static void queue_pages(pocsag_t *pocsag, int clustered)
+{
+	char text[128];
+	uint32_t ric;
+	int i, j, length, priority;
+	enum pocsag_function function;
+
+	srandom(1);
+	for (i = 0; i < PAGES; i++) {
+		ric = 100000 + (random() % 1000000);
+		if (random() % 100 < clustered)
+			ric &= ~7;
+		/* some urgent pages are queued last */
+		priority = 0;
+		if (i >= PAGES - PAGES / 20) {
+			ric = URGENT_RIC + ric % 500000;
+			priority = 1;
+		}
+		switch (random() % 5) {
+		case 0:
+		case 1:
+			function = POCSAG_FUNCTION_NUMERIC;
+			length = 5 + random() % 11;
+			for (j = 0; j < length; j++)
+				text[j] = '0' + random() % 10;
+			break;
+		case 2:
+		case 3:
+			function = POCSAG_FUNCTION_ALPHA;
+			length = 10 + random() % 71;
+			for (j = 0; j < length; j++)
+				text[j] = 'a' + random() % 26;
+			break;
+		default:
+			function = POCSAG_FUNCTION_BEEP1;
+			length = 0;
+		}
+		pocsag_msg_create(pocsag, 0, ric, function, text, length, priority);
+	}
+}
+
+/* transmit all pages, return number of codewords on air */
+static int transmit(pocsag_t *pocsag, int *pages)
+{
+	int64_t word;
+	int count = 0, position = 0, frame;
+	int urgent_left[8] = { 0 }, i;
+	pocsag_msg_t *msg;
+
+	for (msg = pocsag->msg_list; msg; msg = msg->next) {
+		if (msg->ric >= URGENT_RIC)
+			urgent_left[msg->ric & 7]++;
+	}
+
+	*pages = 0;
+	while ((word = get_codeword(pocsag)) >= 0) {
+		count++;
+		/* wait for sync word, skip preamble */
+		if (position == 0) {
+			if (word == 0x7cd215d8)
+				position = 1;
+			continue;
+		}
+		frame = (position - 1) >> 1;
+		if (++position == 17)
+			position = 0;
+		if ((word & 0x80000000) || word == 0x7a89c197)
+			continue;
+		/* address codeword */
+		(*pages)++;
+		if ((uint32_t)(((word >> 10) & 0x1ffff8) + frame) >= URGENT_RIC)
+			urgent_left[frame]--;
+		else if (urgent_left[frame]) {
+			printf("Page of normal priority sent before urgent page in frame %d!\n", frame);
+			return -1;
+		}
+	}
+
+	for (i = 0; i < 8; i++) {
+		if (urgent_left[i]) {
+			printf("Urgent pages were not sent in frame %d!\n", i);
+			return -1;
+		}
+	}
+
+	return count;
+}
+
+static int run(const char *name, int clustered)
+{
+	pocsag_t pocsag;
+	int packing, count, pages;
+	double airtime;
+
+	printf("%s:\n", name);
+	for (packing = 0; packing <= 1; packing++) {
+		memset(&pocsag, 0, sizeof(pocsag));
+		pocsag.sender.kanal = "tx";
+		pocsag.tx = 1;
+		pocsag.padding = 4;
+		pocsag.packing = packing;
+		queue_pages(&pocsag, clustered);
+		count = transmit(&pocsag, &pages);
+		if (count < 0)
+			return -1;
+		if (pages != PAGES || pocsag.msg_list) {
+			printf("Only %d of %d pages were sent!\n", pages, PAGES);
+			return -1;
+		}
+		airtime = (double)count * 32.0 / (double)BAUDRATE;
+		printf(" %s: %d pages in %.1f seconds of air time = %.1f pages/minute, %u codewords used, %u idle (%.1f%%)\n", (packing) ? "packed batches    " : "first come, served", pages, airtime, (double)pages / airtime * 60.0, pocsag.tx_words_used, pocsag.tx_words_idle, (double)pocsag.tx_words_idle * 100.0 / (double)(pocsag.tx_words_used + pocsag.tx_words_idle));
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	loglevel = LOGL_ERROR;
+	pocsag_init();
+
+	if (run("Pages with uniformly distributed RICs", 0))
+		return 1;
+	if (run("Pages with 50% of RICs in frame 0", 50))
+		return 1;
+	if (run("Pages with 90% of RICs in frame 0", 90))
+		return 1;
+
+	return 0;
+}
@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../libfm/fm.h"
+#include "../libmobile/main_mobile.h"
+#include "../pocsag/pocsag.h"
+#include "../pocsag/dsp.h"
+#include "../pocsag/wideband.h"
+
+#define SAMPLERATE	1200000
+#define CENTER		466000000.0
+#define SPACING		25000.0
+#define CHANNELS	8
+#define DEVIATION	4500.0
+#define BAUDRATE	1200
+#define CHUNK		4096
+#define WEAK		3		/* channel next to strong ones */
+#define STRONG_DB	40.0		/* strong channels above weak channel */
+
+static sample_t *I, *Q;
+static int length;
+
+static char rx_text[CHANNELS * 2][256];
+static int rx_count;
+
+/* used by pocsag_msg_receive() */
+int msg_receive(const char *text)
+{
+	if (rx_count < CHANNELS * 2)
+		strncpy(rx_text[rx_count++], text, sizeof(rx_text[0]) - 1);
+	return 0;
+}
+
+void print_help(const char __attribute__((unused)) *arg0) { }
+
+static double chan_frequency(int c)
+{
+	return CENTER + ((double)c - (double)(CHANNELS - 1) / 2.0) * SPACING;
+}
+
+static void chan_message(int c, char *text)
+{
+	sprintf(text, "Page on channel %d", c);
+}
+
+/* render one transmitter per channel and add them to the wideband signal
+ * a channel with amplitude 0 is not transmitted
+ */
+static void generate(const double *amplitude)
+{
+	pocsag_t tx;
+	char text[64];
+	sample_t spl[CHUNK];
+	uint8_t power[CHUNK];
+	double phase, offset;
+	int c, s, n, pos;
+
+	/* preamble, one batch with message, idle batches */
+	length = SAMPLERATE * 3;
+	free(I);
+	free(Q);
+	I = calloc(length, sizeof(*I));
+	Q = calloc(length, sizeof(*Q));
+	if (!I || !Q) {
+		fprintf(stderr, "No memory!\n");
+		abort();
+	}
+
+	for (c = 0; c < CHANNELS; c++) {
+		if (!amplitude[c])
+			continue;
+		memset(&tx, 0, sizeof(tx));
+		tx.sender.kanal = "tx";
+		tx.tx = 1;
+		tx.padding = 4;
+		if (dsp_init_sender(&tx, SAMPLERATE, BAUDRATE, DEVIATION, -1.0) < 0)
+			abort();
+		chan_message(c, text);
+		pocsag_msg_create(&tx, 0, 1000000 + c, POCSAG_FUNCTION_ALPHA, text, strlen(text), 0);
+
+		offset = chan_frequency(c) - CENTER;
+		/* start transmitters at different times */
+		pos = c * SAMPLERATE / 50;
+		phase = 0.0;
+		while (pos < length) {
+			n = length - pos;
+			if (n > CHUNK)
+				n = CHUNK;
+			sender_send(&tx.sender, spl, power, n);
+			for (s = 0; s < n; s++, pos++) {
+				if (!power[s])
+					continue;
+				phase += 2.0 * M_PI * (offset + spl[s] * DEVIATION) / SAMPLERATE;
+				if (phase >= M_PI)
+					phase -= 2.0 * M_PI;
+				else if (phase < -M_PI)
+					phase += 2.0 * M_PI;
+				I[pos] += amplitude[c] * cos(phase);
+				Q[pos] += amplitude[c] * sin(phase);
+			}
+		}
+		if (tx.state != POCSAG_IDLE) {
+			fprintf(stderr, "Transmitter of channel %d did not finish!\n", c);
+			abort();
+		}
+		dsp_cleanup_sender(&tx);
+	}
+
+	/* add some noise */
+	for (s = 0; s < length; s++) {
+		I[s] += ((double)random() / (double)RAND_MAX - 0.5) * 0.1;
+		Q[s] += ((double)random() / (double)RAND_MAX - 0.5) * 0.1;
+	}
+}
+
+/* check messages of channels first .. first + channels - 1 */
+static int check(int first, int channels)
+{
+	char expect[64], message[64];
+	int c, i, found, failed = 0;
+
+	for (c = first; c < first + channels; c++) {
+		sprintf(expect, "@%.4f %d,", chan_frequency(c) / 1e6, 1000000 + c);
+		chan_message(c, message);
+		found = 0;
+		for (i = 0; i < rx_count; i++) {
+			if (strstr(rx_text[i], expect) && strstr(rx_text[i], message))
+				found++;
+		}
+		if (found != 1) {
+			printf("Message of channel %d received %d times, expecting once!\n", c, found);
+			failed = 1;
+		}
+	}
+	if (rx_count != channels) {
+		printf("Received %d messages, expecting %d!\n", rx_count, channels);
+		failed = 1;
+	}
+
+	return failed;
+}
+
+int main(void)
+{
+	wideband_t wb;
+	double frequency[CHANNELS], amplitude[CHANNELS];
+	struct timeval start_tv, tv;
+	double duration;
+	int channels, c, i;
+
+	loglevel = LOGL_NOTICE;
+	fm_init(1);
+	pocsag_init();
+
+	for (c = 0; c < CHANNELS; c++)
+		amplitude[c] = 0.1;
+	generate(amplitude);
+	printf("Generated %.1f seconds of IQ data with %d channels at %d Hz.\n", (double)length / SAMPLERATE, CHANNELS, SAMPLERATE);
+
+	for (c = 0; c < CHANNELS; c++)
+		frequency[c] = chan_frequency(c);
+
+	for (channels = 1; channels <= CHANNELS; channels <<= 1) {
+		rx_count = 0;
+		if (wideband_init(&wb, SAMPLERATE, CENTER, channels, frequency, LANGUAGE_DEFAULT, BAUDRATE, DEVIATION, -1.0, 2) < 0)
+			return 1;
+		gettimeofday(&start_tv, NULL);
+		/* feed like a receiver would do */
+		for (i = 0; i < length; i += CHUNK)
+			wideband_process(&wb, I + i, Q + i, (length - i < CHUNK) ? length - i : CHUNK);
+		gettimeofday(&tv, NULL);
+		wideband_exit(&wb);
+		duration = (double)tv.tv_sec + (double)tv.tv_usec / 1e6;
+		duration -= (double)start_tv.tv_sec + (double)start_tv.tv_usec / 1e6;
+		printf("%d channel(s): %.3f mega samples/sec wideband, %.3f mega channel samples/sec, %.1f times real time\n", channels, (double)length / duration / 1e6, (double)length * channels / duration / 1e6, (double)length / SAMPLERATE / duration);
+		for (i = 0; i < rx_count; i++)
+			printf(" -> %s\n", rx_text[i]);
+		if (check(0, channels))
+			return 1;
+	}
+
+	/* a weak channel next to strong ones, the strong ones must not leak or alias into the weak one
+	 * the channel two steps away is decimated onto the weak channel, if the decimation filter does not reject it
+	 */
+	for (c = 0; c < CHANNELS; c++)
+		amplitude[c] = 0.0;
+	amplitude[WEAK] = 0.02;
+	amplitude[WEAK + 1] = amplitude[WEAK + 2] = amplitude[WEAK] * pow(10.0, STRONG_DB / 20.0);
+	generate(amplitude);
+	printf("Generated channels %d and %d with %.0f dB above channel %d.\n", WEAK + 1, WEAK + 2, STRONG_DB, WEAK);
+	rx_count = 0;
+	if (wideband_init(&wb, SAMPLERATE, CENTER, 1, frequency + WEAK, LANGUAGE_DEFAULT, BAUDRATE, DEVIATION, -1.0, 2) < 0)
+		return 1;
+	for (i = 0; i < length; i += CHUNK)
+		wideband_process(&wb, I + i, Q + i, (length - i < CHUNK) ? length - i : CHUNK);
+	wideband_exit(&wb);
+	for (i = 0; i < rx_count; i++)
+		printf(" -> %s\n", rx_text[i]);
+	if (check(WEAK, 1))
+		return 1;
+
+	free(I);
+	free(Q);
+	fm_exit();
+
+	return 0;
+}
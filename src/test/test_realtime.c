@@ -0,0 +1,208 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/wait.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../librealtime/realtime.h"
+
+/*
+ * Run a network program in replay mode, so that a recording streams through
+ * the wave reader, the main loop and the DSP of the network, like audio of a
+ * sound device does. The recording is generated by the transmitter of the
+ * network first. The program is bound to a CPU and memory is locked, if
+ * possible, so the main loop reports page faults and context switches every
+ * minute of (virtual) time. The first report includes the start of
+ * streaming, so it is the warm-up. After warm-up, no major page fault may
+ * happen. If memory can be locked, no minor page fault may happen either.
+ *
+ * If the program is not built, the test exits with 77 (SKIP).
+ */
+
+#ifndef PROGRAM_DIR
+#define PROGRAM_DIR	".."
+#endif
+#ifndef OUTPUT_DIR
+#define OUTPUT_DIR	"."
+#endif
+
+#define EXIT_SKIP	77
+
+#define PROGRAM		"nmt/nmt"
+#define SECONDS		"200"		/* warm-up minute and two minutes to check */
+#define RESERVE_MB	"16"
+#define REPORT		"Per minute: "
+
+/* run program with output to log file, return exit code */
+static int run(char *argv[], const char *log)
+{
+	pid_t pid;
+	int status, fd;
+
+	pid = fork();
+	if (pid < 0)
+		return -errno;
+	if (pid == 0) {
+		fd = open(log, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd >= 0) {
+			dup2(fd, 1);
+			dup2(fd, 2);
+			close(fd);
+		}
+		/* no key presses */
+		fd = open("/dev/null", O_RDONLY);
+		if (fd >= 0) {
+			dup2(fd, 0);
+			close(fd);
+		}
+		execv(argv[0], argv);
+		fprintf(stderr, "Failed to execute '%s'!\n", argv[0]);
+		_exit(127);
+	}
+	if (waitpid(pid, &status, 0) < 0)
+		return -errno;
+
+	if (WIFSIGNALED(status)) {
+		printf("'%s' was killed by signal %d, see '%s'\n", argv[0], WTERMSIG(status), log);
+		return -EINTR;
+	}
+	if (WEXITSTATUS(status)) {
+		printf("'%s' exited with %d, see '%s'\n", argv[0], WEXITSTATUS(status), log);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	char path[256], wave[256], log[256], cpu[16];
+	char *argv[32];
+	cpu_set_t set;
+	FILE *fp;
+	char line[1024], *p;
+	double minflt, majflt, nivcsw;
+	int locked, reports = 0, failed = 0;
+	int n, c, rc;
+
+	loglevel = LOGL_ERROR;
+
+	snprintf(path, sizeof(path), "%s/%s", PROGRAM_DIR, PROGRAM);
+	if (access(path, X_OK)) {
+		printf("SKIP, '%s' is not built\n", path);
+		return EXIT_SKIP;
+	}
+
+	/* the program can lock memory, if this test can */
+	locked = (rt_lock_memory(0) == 0);
+	if (locked)
+		rt_unlock_memory();
+	else
+		printf("Cannot lock memory, checking major page faults only.\n");
+
+	/* bind to the first CPU this test may use */
+	if (sched_getaffinity(0, sizeof(set), &set) < 0) {
+		printf("Failed to get CPU affinity!\n");
+		return 1;
+	}
+	for (c = 0; c < CPU_SETSIZE; c++) {
+		if (CPU_ISSET(c, &set))
+			break;
+	}
+	snprintf(cpu, sizeof(cpu), "%d", c);
+
+	/* generate recording by the transmitter */
+	snprintf(wave, sizeof(wave), "%s/realtime.wav", OUTPUT_DIR);
+	snprintf(log, sizeof(log), "%s/realtime_tx.log", OUTPUT_DIR);
+	n = 0;
+	argv[n++] = path;
+	argv[n++] = "-k";
+	argv[n++] = "1";
+	argv[n++] = "-Y";
+	argv[n++] = "SE,1";
+	argv[n++] = "-l";
+	argv[n++] = "2";
+	argv[n++] = "--replay";
+	argv[n++] = SECONDS;
+	argv[n++] = "--write-tx-wave";
+	argv[n++] = wave;
+	argv[n] = NULL;
+	if (run(argv, log)) {
+		printf("Failed to generate recording!\n");
+		return 1;
+	}
+
+	/* replay recording with real-time options */
+	snprintf(log, sizeof(log), "%s/realtime_rx.log", OUTPUT_DIR);
+	n = 0;
+	argv[n++] = path;
+	argv[n++] = "-k";
+	argv[n++] = "1";
+	argv[n++] = "-Y";
+	argv[n++] = "SE,1";
+	argv[n++] = "-l";
+	argv[n++] = "2";
+	argv[n++] = "--cpu-affinity";
+	argv[n++] = cpu;
+	if (locked) {
+		argv[n++] = "--mem-reserve";
+		argv[n++] = RESERVE_MB;
+	}
+	argv[n++] = "--replay";
+	argv[n++] = "0";
+	argv[n++] = "--read-rx-wave";
+	argv[n++] = wave;
+	argv[n] = NULL;
+	if (run(argv, log)) {
+		printf("Failed to replay recording!\n");
+		return 1;
+	}
+
+	/* check the reports after warm-up */
+	fp = fopen(log, "r");
+	if (!fp) {
+		printf("Failed to read '%s'!\n", log);
+		return 1;
+	}
+	while (fgets(line, sizeof(line), fp)) {
+		p = strstr(line, REPORT);
+		if (!p)
+			continue;
+		rc = sscanf(p + strlen(REPORT), "%lf minor page faults, %lf major page faults, %lf involuntary context switches", &minflt, &majflt, &nivcsw);
+		if (rc != 3)
+			continue;
+		if (reports++ == 0) {
+			printf("Warm-up: %.0f minor page faults, %.0f major page faults, %.0f involuntary context switches per minute\n", minflt, majflt, nivcsw);
+			continue;
+		}
+		printf("After warm-up: %.0f minor page faults, %.0f major page faults, %.0f involuntary context switches per minute\n", minflt, majflt, nivcsw);
+		if (majflt) {
+			printf("Major page faults after warm-up!\n");
+			failed = 1;
+		}
+		if (locked && minflt) {
+			printf("Minor page faults after warm-up, although memory is locked!\n");
+			failed = 1;
+		}
+	}
+	fclose(fp);
+
+	if (reports < 2) {
+		printf("Program did not report page faults after warm-up, see '%s'!\n", log);
+		return 1;
+	}
+	if (failed)
+		return 1;
+
+	unlink(wave);
+
+	return 0;
+}
@@ -0,0 +1,349 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../libwave/wave.h"
+
+/*
+ * Replay each recording of the corpus through the receiver of its network and
+ * compare the event log with the expected one. The network program runs with
+ * '--replay', so it processes the recording as fast as possible, using virtual
+ * time. Recordings that are not in the corpus are generated by the transmitter
+ * of the network first. See corpus/corpus.list for the format.
+ *
+ * Usage: test_replay_corpus [-u] [<name> ...]
+ *
+ * -u records the expected event logs into the corpus. Without it, a missing
+ * expected event log fails. Recordings, event logs and program output are
+ * written to OUTPUT_DIR. If a program is not built, its entry is skipped and
+ * the test exits with 77, so 'make check' reports SKIP rather than PASS.
+ */
+
+#ifndef CORPUS_DIR
+#define CORPUS_DIR	"corpus"
+#endif
+#ifndef PROGRAM_DIR
+#define PROGRAM_DIR	".."
+#endif
+#ifndef OUTPUT_DIR
+#define OUTPUT_DIR	"."
+#endif
+
+#define EXIT_SKIP	77
+
+#define MAX_ARGS	64
+#define MAX_DIFFS	10
+
+static int update = 0;
+
+/* run program with output to log file, return exit code */
+static int run(char *argv[], const char *log, double *wall, double *cpu)
+{
+	struct timespec t1, t2;
+	struct rusage r1, r2;
+	pid_t pid;
+	int status, fd;
+
+	getrusage(RUSAGE_CHILDREN, &r1);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	pid = fork();
+	if (pid < 0)
+		return -errno;
+	if (pid == 0) {
+		fd = open(log, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd >= 0) {
+			dup2(fd, 1);
+			dup2(fd, 2);
+			close(fd);
+		}
+		/* no key presses */
+		fd = open("/dev/null", O_RDONLY);
+		if (fd >= 0) {
+			dup2(fd, 0);
+			close(fd);
+		}
+		execv(argv[0], argv);
+		fprintf(stderr, "Failed to execute '%s'!\n", argv[0]);
+		_exit(127);
+	}
+	if (waitpid(pid, &status, 0) < 0)
+		return -errno;
+
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	getrusage(RUSAGE_CHILDREN, &r2);
+	*wall = (double)(t2.tv_sec - t1.tv_sec) + (double)(t2.tv_nsec - t1.tv_nsec) / 1000000000.0;
+	*cpu = (double)(r2.ru_utime.tv_sec - r1.ru_utime.tv_sec + r2.ru_stime.tv_sec - r1.ru_stime.tv_sec)
+	     + (double)(r2.ru_utime.tv_usec - r1.ru_utime.tv_usec + r2.ru_stime.tv_usec - r1.ru_stime.tv_usec) / 1000000.0;
+
+	if (WIFSIGNALED(status)) {
+		printf("  '%s' was killed by signal %d, see '%s'\n", argv[0], WTERMSIG(status), log);
+		return -EINTR;
+	}
+	if (WEXITSTATUS(status)) {
+		printf("  '%s' exited with %d, see '%s'\n", argv[0], WEXITSTATUS(status), log);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+/* duration of wave file in seconds */
+static double wave_duration(const char *filename)
+{
+	wave_play_t play;
+	int samplerate = 0, channels = 0;
+	double duration;
+
+	memset(&play, 0, sizeof(play));
+	if (wave_create_playback(&play, filename, &samplerate, &channels, 1.0) < 0)
+		return -1.0;
+	duration = (double)play.left / (double)samplerate;
+	wave_destroy_playback(&play);
+
+	return duration;
+}
+
+static char *read_file(const char *filename, long *size)
+{
+	FILE *fp;
+	char *data;
+
+	fp = fopen(filename, "r");
+	if (!fp)
+		return NULL;
+	fseek(fp, 0, SEEK_END);
+	*size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	data = calloc(*size + 1, 1);
+	if (data && fread(data, 1, *size, fp) != (size_t)*size) {
+		free(data);
+		data = NULL;
+	}
+	fclose(fp);
+
+	return data;
+}
+
+static int write_file(const char *filename, const char *data, long size)
+{
+	FILE *fp;
+
+	fp = fopen(filename, "w");
+	if (!fp)
+		return -errno;
+	fwrite(data, 1, size, fp);
+	fclose(fp);
+
+	return 0;
+}
+
+/* compare event logs line by line, return number of different lines */
+static int diff_events(char *expect, char *got)
+{
+	char *e, *g, *e_next, *g_next;
+	int line, diffs = 0;
+
+	for (line = 1, e = expect, g = got; *e || *g; line++, e = e_next, g = g_next) {
+		e_next = strchr(e, '\n');
+		if (e_next)
+			*e_next++ = '\0';
+		else
+			e_next = strchr(e, '\0');
+		g_next = strchr(g, '\n');
+		if (g_next)
+			*g_next++ = '\0';
+		else
+			g_next = strchr(g, '\0');
+		if (!strcmp(e, g))
+			continue;
+		if (diffs++ < MAX_DIFFS) {
+			printf("  line %d expected: %s\n", line, (*e) ? e : "(end of log)");
+			printf("  line %d got:      %s\n", line, (*g) ? g : "(end of log)");
+		}
+	}
+	if (diffs > MAX_DIFFS)
+		printf("  ... %d more lines differ\n", diffs - MAX_DIFFS);
+
+	return diffs;
+}
+
+/* replay one entry of the corpus, return 0 on success, 1 if skipped */
+static int replay(char *name, char *program, double seconds, int argc, char *args[])
+{
+	char path[256], wave[256], events[256], expect[256], log[256], duration_arg[32];
+	char *argv[MAX_ARGS + 10];
+	char *expect_data, *got_data;
+	long expect_size, got_size;
+	double duration, wall, cpu;
+	int n, i, diffs, rc;
+
+	snprintf(path, sizeof(path), "%s/%s", PROGRAM_DIR, program);
+	if (access(path, X_OK)) {
+		printf("%-12s SKIP, '%s' is not built\n", name, path);
+		return 1;
+	}
+
+	/* use recording of corpus or generate it by the transmitter */
+	snprintf(wave, sizeof(wave), "%s/%s.wav", CORPUS_DIR, name);
+	if (access(wave, R_OK)) {
+		snprintf(wave, sizeof(wave), "%s/replay_%s.wav", OUTPUT_DIR, name);
+		snprintf(log, sizeof(log), "%s/replay_%s_tx.log", OUTPUT_DIR, name);
+		snprintf(duration_arg, sizeof(duration_arg), "%.3f", seconds);
+		n = 0;
+		argv[n++] = path;
+		for (i = 0; i < argc; i++)
+			argv[n++] = args[i];
+		argv[n++] = "--replay";
+		argv[n++] = duration_arg;
+		argv[n++] = "--write-tx-wave";
+		argv[n++] = wave;
+		argv[n] = NULL;
+		rc = run(argv, log, &wall, &cpu);
+		if (rc) {
+			printf("%-12s FAILED to generate recording\n", name);
+			return rc;
+		}
+	}
+	duration = wave_duration(wave);
+	if (duration <= 0.0) {
+		printf("%-12s FAILED to read recording '%s'\n", name, wave);
+		return -EIO;
+	}
+
+	/* replay */
+	snprintf(events, sizeof(events), "%s/replay_%s.events", OUTPUT_DIR, name);
+	snprintf(log, sizeof(log), "%s/replay_%s_rx.log", OUTPUT_DIR, name);
+	n = 0;
+	argv[n++] = path;
+	for (i = 0; i < argc; i++)
+		argv[n++] = args[i];
+	argv[n++] = "--replay";
+	argv[n++] = "0";
+	argv[n++] = "--read-rx-wave";
+	argv[n++] = wave;
+	argv[n++] = "--event-log";
+	argv[n++] = events;
+	argv[n] = NULL;
+	rc = run(argv, log, &wall, &cpu);
+	if (rc) {
+		printf("%-12s FAILED to replay recording\n", name);
+		return rc;
+	}
+
+	got_data = read_file(events, &got_size);
+	if (!got_data) {
+		printf("%-12s FAILED, no event log written\n", name);
+		return -EIO;
+	}
+
+	printf("%-12s %6.1f s replayed in %6.3f s (cpu %6.3f s) = %7.1f x real time\n", name, duration, wall, cpu, (wall > 0.0) ? duration / wall : 0.0);
+
+	/* compare or record expected events */
+	snprintf(expect, sizeof(expect), "%s/%s.events", CORPUS_DIR, name);
+	if (update) {
+		rc = write_file(expect, got_data, got_size);
+		free(got_data);
+		if (rc < 0) {
+			printf("  FAILED to record '%s'\n", expect);
+			return rc;
+		}
+		printf("  event log recorded to '%s'\n", expect);
+		return 0;
+	}
+	expect_data = read_file(expect, &expect_size);
+	if (!expect_data) {
+		free(got_data);
+		printf("  FAILED, no expected event log '%s', use '-u' to record it\n", expect);
+		return -ENOENT;
+	}
+	diffs = diff_events(expect_data, got_data);
+	free(expect_data);
+	free(got_data);
+	if (diffs) {
+		printf("  FAILED, %d lines of event log differ\n", diffs);
+		return -EINVAL;
+	}
+	printf("  events match\n");
+
+	return 0;
+}
+
+static int selected(const char *name, int argc, char *argv[])
+{
+	int i;
+
+	if (!argc)
+		return 1;
+	for (i = 0; i < argc; i++) {
+		if (!strcmp(argv[i], name))
+			return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	char list[256], line[1024];
+	char *field[MAX_ARGS + 3], *p;
+	FILE *fp;
+	int n, failed = 0, skipped = 0, rc;
+
+	loglevel = LOGL_ERROR;
+
+	/* DCF77 transmits local time of Germany, so the event logs do not depend
+	 * on the time zone of the machine */
+	setenv("TZ", "Europe/Berlin", 1);
+
+	argc--;
+	argv++;
+	if (argc && !strcmp(argv[0], "-u")) {
+		update = 1;
+		argc--;
+		argv++;
+	}
+
+	snprintf(list, sizeof(list), "%s/corpus.list", CORPUS_DIR);
+	fp = fopen(list, "r");
+	if (!fp) {
+		printf("Failed to open '%s'!\n", list);
+		return 1;
+	}
+	while (fgets(line, sizeof(line), fp)) {
+		if (line[0] == '#')
+			continue;
+		n = 0;
+		for (p = strtok(line, " \t\r\n"); p && n < MAX_ARGS + 3; p = strtok(NULL, " \t\r\n"))
+			field[n++] = p;
+		if (n == 0)
+			continue;
+		if (n < 3) {
+			printf("Line of '%s' needs name, program and duration!\n", list);
+			failed = 1;
+			continue;
+		}
+		if (!selected(field[0], argc, argv))
+			continue;
+		rc = replay(field[0], field[1], atof(field[2]), n - 3, field + 3);
+		if (rc < 0)
+			failed = 1;
+		if (rc > 0)
+			skipped = 1;
+	}
+	fclose(fp);
+
+	if (failed)
+		return 1;
+	if (skipped)
+		return EXIT_SKIP;
+	return 0;
+}
@@ -0,0 +1,568 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <SoapySDR/Device.h>
+#include <SoapySDR/Formats.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../libmobile/get_time.h"
+#include "../libsdr/sdr_config.h"
+#include "../libsdr/sdr.h"
+#include "../libsdr/soapy.h"
+
+/*
+ * This test does not use a real SoapySDR module. The C API of the SoapySDR
+ * library is replaced by a device that has a ring of DMA buffers in CS16
+ * format, like most SDR drivers have. With the device argument "direct=0",
+ * the device does not support direct buffer access.
+ *
+ * The samples are received through sdr.c, so its read thread and sdr_read()
+ * are tested together with the stream handling of soapy.c.
+ */
+
+#define SAMPLERATE	1000000.0	/* a sample is one microsecond */
+#define MTU		4096		/* samples per DMA buffer */
+#define NUM_BUFFS	8		/* buffers of DMA ring */
+#define FULL_SCALE	32768.0
+#define BUFFER_SIZE	32768		/* read buffer of sdr.c in samples */
+#define TX_SAMPLES	10000
+#define BENCH_SAMPLES	20000000
+
+int use_sdr = 1;
+
+/*
+ * stub of SoapySDR library
+ */
+
+struct SoapySDRDevice {
+	int		direct;			/* direct buffer access supported */
+	double		rate[2], frequency[2], gain[2], bandwidth[2];
+};
+
+struct SoapySDRStream {
+	int		direction;
+	int		cs16;			/* stream format, otherwise CF32 */
+	int		active;
+	int		acquired;		/* direct buffer is acquired */
+	size_t		handle;
+};
+
+static struct SoapySDRDevice device;
+static struct SoapySDRStream streams[2];
+static int16_t rx_dma[NUM_BUFFS][MTU * 2];
+static int16_t tx_dma[NUM_BUFFS][MTU * 2];
+static int rx_dma_buff, rx_dma_pos;		/* buffer that the driver reads from */
+static int tx_dma_buff;
+static long long rx_sample, tx_sample = -1;	/* sample counter of hardware */
+static long long tx_first;			/* first sample transmitted */
+static int verify_tx = 1, tx_errors;
+static const int16_t *expect_tx;		/* expected TX samples, instead of ramp */
+static long long driver_copies;			/* samples converted by driver */
+
+/* the hardware receives a ramp, so every sample can be verified */
+static int16_t rx_value(long long sample, int q)
+{
+	return (int16_t)((sample * 7 + q * 12345) & 0x7fff) - 16384;
+}
+
+static void init_rx_dma(void)
+{
+	int b, i;
+
+	for (b = 0; b < NUM_BUFFS; b++) {
+		for (i = 0; i < MTU; i++) {
+			rx_dma[b][i * 2] = rx_value((long long)b * MTU + i, 0);
+			rx_dma[b][i * 2 + 1] = rx_value((long long)b * MTU + i, 1);
+		}
+	}
+}
+
+int SoapySDRKwargs_set(SoapySDRKwargs __attribute__((unused)) *args, const char *key, const char *val)
+{
+	if (!strcmp(key, "direct"))
+		device.direct = atoi(val);
+	return 0;
+}
+
+void SoapySDR_free(void *ptr)
+{
+	free(ptr);
+}
+
+SoapySDRDevice *SoapySDRDevice_make(const SoapySDRKwargs __attribute__((unused)) *args)
+{
+	return &device;
+}
+
+int SoapySDRDevice_unmake(SoapySDRDevice __attribute__((unused)) *dev)
+{
+	return 0;
+}
+
+/* clock source and antennas are not given by the test */
+char **SoapySDRDevice_listClockSources(const SoapySDRDevice __attribute__((unused)) *dev, size_t *length)
+{
+	*length = 0;
+	return NULL;
+}
+
+int SoapySDRDevice_setClockSource(SoapySDRDevice __attribute__((unused)) *dev, const char __attribute__((unused)) *source)
+{
+	return -1;
+}
+
+char *SoapySDRDevice_getClockSource(const SoapySDRDevice __attribute__((unused)) *dev)
+{
+	return NULL;
+}
+
+char **SoapySDRDevice_listAntennas(const SoapySDRDevice __attribute__((unused)) *dev, const int __attribute__((unused)) direction, const size_t __attribute__((unused)) channel, size_t *length)
+{
+	*length = 0;
+	return NULL;
+}
+
+int SoapySDRDevice_setAntenna(SoapySDRDevice __attribute__((unused)) *dev, const int __attribute__((unused)) direction, const size_t __attribute__((unused)) channel, const char __attribute__((unused)) *name)
+{
+	return -1;
+}
+
+char *SoapySDRDevice_getAntenna(const SoapySDRDevice __attribute__((unused)) *dev, const int __attribute__((unused)) direction, const size_t __attribute__((unused)) channel)
+{
+	return NULL;
+}
+
+size_t SoapySDRDevice_getNumChannels(const SoapySDRDevice __attribute__((unused)) *dev, const int __attribute__((unused)) direction)
+{
+	return 1;
+}
+
+int SoapySDRDevice_setSampleRate(SoapySDRDevice *dev, const int direction, const size_t __attribute__((unused)) channel, const double rate)
+{
+	dev->rate[direction] = rate;
+	return 0;
+}
+
+double SoapySDRDevice_getSampleRate(const SoapySDRDevice *dev, const int direction, const size_t __attribute__((unused)) channel)
+{
+	return dev->rate[direction];
+}
+
+int SoapySDRDevice_setGain(SoapySDRDevice *dev, const int direction, const size_t __attribute__((unused)) channel, const double value)
+{
+	dev->gain[direction] = value;
+	return 0;
+}
+
+double SoapySDRDevice_getGain(const SoapySDRDevice *dev, const int direction, const size_t __attribute__((unused)) channel)
+{
+	return dev->gain[direction];
+}
+
+int SoapySDRDevice_setFrequency(SoapySDRDevice *dev, const int direction, const size_t __attribute__((unused)) channel, const double frequency, const SoapySDRKwargs __attribute__((unused)) *args)
+{
+	dev->frequency[direction] = frequency;
+	return 0;
+}
+
+double SoapySDRDevice_getFrequency(const SoapySDRDevice *dev, const int direction, const size_t __attribute__((unused)) channel)
+{
+	return dev->frequency[direction];
+}
+
+int SoapySDRDevice_setBandwidth(SoapySDRDevice *dev, const int direction, const size_t __attribute__((unused)) channel, const double bw)
+{
+	dev->bandwidth[direction] = bw;
+	return 0;
+}
+
+double SoapySDRDevice_getBandwidth(const SoapySDRDevice *dev, const int direction, const size_t __attribute__((unused)) channel)
+{
+	return dev->bandwidth[direction];
+}
+
+char *SoapySDRDevice_getNativeStreamFormat(const SoapySDRDevice __attribute__((unused)) *dev, const int __attribute__((unused)) direction, const size_t __attribute__((unused)) channel, double *fullScale)
+{
+	*fullScale = FULL_SCALE;
+	return strdup(SOAPY_SDR_CS16);
+}
+
+#ifdef SOAPY_0_8_0_OR_HIGHER
+SoapySDRStream *SoapySDRDevice_setupStream(SoapySDRDevice __attribute__((unused)) *dev, const int direction, const char *format, const size_t __attribute__((unused)) *channels, const size_t __attribute__((unused)) numChans, const SoapySDRKwargs __attribute__((unused)) *args)
+#else
+int SoapySDRDevice_setupStream(SoapySDRDevice __attribute__((unused)) *dev, SoapySDRStream **stream, const int direction, const char *format, const size_t __attribute__((unused)) *channels, const size_t __attribute__((unused)) numChans, const SoapySDRKwargs __attribute__((unused)) *args)
+#endif
+{
+	struct SoapySDRStream *s = &streams[direction];
+
+	memset(s, 0, sizeof(*s));
+	s->direction = direction;
+	s->cs16 = !strcmp(format, SOAPY_SDR_CS16);
+#ifdef SOAPY_0_8_0_OR_HIGHER
+	return s;
+#else
+	*stream = s;
+	return 0;
+#endif
+}
+
+int SoapySDRDevice_closeStream(SoapySDRDevice __attribute__((unused)) *dev, SoapySDRStream __attribute__((unused)) *stream)
+{
+	return 0;
+}
+
+size_t SoapySDRDevice_getStreamMTU(const SoapySDRDevice __attribute__((unused)) *dev, SoapySDRStream __attribute__((unused)) *stream)
+{
+	return MTU;
+}
+
+int SoapySDRDevice_activateStream(SoapySDRDevice __attribute__((unused)) *dev, SoapySDRStream *stream, const int __attribute__((unused)) flags, const long long __attribute__((unused)) timeNs, const size_t __attribute__((unused)) numElems)
+{
+	stream->active = 1;
+	return 0;
+}
+
+int SoapySDRDevice_deactivateStream(SoapySDRDevice __attribute__((unused)) *dev, SoapySDRStream *stream, const int __attribute__((unused)) flags, const long long __attribute__((unused)) timeNs)
+{
+	stream->active = 0;
+	return 0;
+}
+
+size_t SoapySDRDevice_getNumDirectAccessBuffers(SoapySDRDevice *dev, SoapySDRStream *stream)
+{
+	if (!dev->direct || !stream->cs16)
+		return 0;
+	return NUM_BUFFS;
+}
+
+/* the hardware has always filled the next buffer, so the maximum rate is measured */
+int SoapySDRDevice_acquireReadBuffer(SoapySDRDevice *dev, SoapySDRStream *stream, size_t *handle, const void **buffs, int *flags, long long *timeNs, const long __attribute__((unused)) timeoutUs)
+{
+	if (!dev->direct || !stream->cs16)
+		return SOAPY_SDR_NOT_SUPPORTED;
+	if (!stream->active)
+		return SOAPY_SDR_TIMEOUT;
+	if (stream->acquired) {
+		printf("RX buffer acquired twice!\n");
+		exit(1);
+	}
+	stream->acquired = 1;
+	stream->handle = rx_dma_buff;
+	*handle = rx_dma_buff;
+	buffs[0] = rx_dma[rx_dma_buff];
+	*flags = SOAPY_SDR_HAS_TIME;
+	*timeNs = rx_sample * 1000LL;
+	rx_dma_buff = (rx_dma_buff + 1) % NUM_BUFFS;
+	rx_sample += MTU;
+	return MTU;
+}
+
+void SoapySDRDevice_releaseReadBuffer(SoapySDRDevice __attribute__((unused)) *dev, SoapySDRStream *stream, const size_t handle)
+{
+	if (!stream->acquired || stream->handle != handle) {
+		printf("Released RX buffer %d was not acquired!\n", (int)handle);
+		exit(1);
+	}
+	stream->acquired = 0;
+}
+
+/* driver converts its DMA buffer into CF32, it keeps the rest of a buffer */
+int SoapySDRDevice_readStream(SoapySDRDevice __attribute__((unused)) *dev, SoapySDRStream *stream, void * const *buffs, const size_t numElems, int *flags, long long *timeNs, const long __attribute__((unused)) timeoutUs)
+{
+	float *buff = buffs[0];
+	int count, i;
+
+	if (!stream->active)
+		return SOAPY_SDR_TIMEOUT;
+	count = MTU - rx_dma_pos;
+	if (count > (int)numElems)
+		count = numElems;
+	for (i = rx_dma_pos * 2; i < (rx_dma_pos + count) * 2; i++)
+		*buff++ = rx_dma[rx_dma_buff][i] / FULL_SCALE;
+	*flags = SOAPY_SDR_HAS_TIME;
+	*timeNs = (rx_sample + rx_dma_pos) * 1000LL;
+	rx_dma_pos += count;
+	if (rx_dma_pos == MTU) {
+		rx_dma_pos = 0;
+		rx_dma_buff = (rx_dma_buff + 1) % NUM_BUFFS;
+		rx_sample += MTU;
+	}
+	driver_copies += count;
+	return count;
+}
+
+static void check_tx(const int16_t *native, int count, int flags, long long timeNs)
+{
+	int i;
+
+	if (!(flags & SOAPY_SDR_HAS_TIME) || (tx_sample >= 0 && timeNs != tx_sample * 1000LL)) {
+		printf("TX time stamp %lld is not continuous, expecting %lld!\n", timeNs, tx_sample * 1000LL);
+		tx_errors++;
+	}
+	if (tx_sample < 0)
+		tx_first = timeNs / 1000LL;
+	tx_sample = timeNs / 1000LL + count;
+	if (!verify_tx)
+		return;
+	if (expect_tx) {
+		for (i = 0; i < count * 2; i++) {
+			if (native[i] != expect_tx[i]) {
+				printf("TX sample %d has value %d, expecting %d!\n", i / 2, native[i], expect_tx[i]);
+				tx_errors++;
+				return;
+			}
+		}
+		expect_tx += count * 2;
+		return;
+	}
+	for (i = 0; i < count * 2; i++) {
+		if (native[i] != rx_value(timeNs / 1000LL - tx_first + i / 2, i & 1)) {
+			printf("TX sample %d has value %d, expecting %d!\n", i / 2, native[i], rx_value(timeNs / 1000LL - tx_first + i / 2, i & 1));
+			tx_errors++;
+			return;
+		}
+	}
+}
+
+int SoapySDRDevice_acquireWriteBuffer(SoapySDRDevice *dev, SoapySDRStream *stream, size_t *handle, void **buffs, const long __attribute__((unused)) timeoutUs)
+{
+	if (!dev->direct || !stream->cs16)
+		return SOAPY_SDR_NOT_SUPPORTED;
+	if (stream->acquired) {
+		printf("TX buffer acquired twice!\n");
+		exit(1);
+	}
+	stream->acquired = 1;
+	stream->handle = tx_dma_buff;
+	*handle = tx_dma_buff;
+	buffs[0] = tx_dma[tx_dma_buff];
+	tx_dma_buff = (tx_dma_buff + 1) % NUM_BUFFS;
+	return MTU;
+}
+
+void SoapySDRDevice_releaseWriteBuffer(SoapySDRDevice __attribute__((unused)) *dev, SoapySDRStream *stream, const size_t handle, const size_t numElems, int *flags, const long long timeNs)
+{
+	if (!stream->acquired || stream->handle != handle) {
+		printf("Released TX buffer %d was not acquired!\n", (int)handle);
+		exit(1);
+	}
+	stream->acquired = 0;
+	check_tx(tx_dma[handle], numElems, *flags, timeNs);
+}
+
+int SoapySDRDevice_writeStream(SoapySDRDevice __attribute__((unused)) *dev, SoapySDRStream __attribute__((unused)) *stream, const void * const *buffs, const size_t numElems, int *flags, const long long timeNs, const long __attribute__((unused)) timeoutUs)
+{
+	const float *buff = buffs[0];
+	int16_t *native = tx_dma[tx_dma_buff];
+	int count = numElems, i;
+
+	if (count > MTU)
+		count = MTU;
+	for (i = 0; i < count * 2; i++)
+		native[i] = buff[i] * FULL_SCALE;
+	tx_dma_buff = (tx_dma_buff + 1) % NUM_BUFFS;
+	driver_copies += count;
+	check_tx(native, count, *flags, timeNs);
+	return count;
+}
+
+/*
+ * test
+ */
+
+static void *sdr;
+static float chunk[BUFFER_SIZE * 2];
+static float buffer2[TX_SAMPLES * 2];
+
+/* open the device via sdr.c, its read thread receives from the stub device */
+static int open_device(int direct, int use_direct, double interval)
+{
+	double tx_frequency = 440000000.0, rx_frequency = 430000000.0;
+	int rc;
+
+	sdr_config_init(0.0);
+	sdr_config->soapy = 1;
+	sdr_config->device_args = (direct) ? "direct=1" : "direct=0";
+	sdr_config->samplerate = SAMPLERATE;
+	sdr_config->bandwidth = 100000.0;
+	sdr_config->direct = use_direct;
+	init_rx_dma();
+	rx_dma_buff = rx_dma_pos = 0;
+	rx_sample = 0;
+	tx_dma_buff = 0;
+	sdr = sdr_open(0, NULL, &tx_frequency, &rx_frequency, NULL, 0, 0.0, SAMPLERATE, BUFFER_SIZE, interval, 0.0, 0.0, 0.0);
+	if (!sdr) {
+		printf("Failed to open device!\n");
+		return -1;
+	}
+	rc = sdr_start(sdr);
+	if (rc)
+		return rc;
+	return 0;
+}
+
+static void close_device(void)
+{
+	sdr_close(sdr);
+	free(sdr_config);
+	sdr_config = NULL;
+}
+
+/* read a chunk of IQ samples with sdr_read(), as the main loop does */
+static int read_chunk(int num)
+{
+	double timeout = get_time() + 1.0;
+	int got = 0, count;
+
+	while (got < num) {
+		/* without channels, IQ samples are returned as they are */
+		count = sdr_read(sdr, (sample_t **)(chunk + got * 2), num - got, 0, NULL);
+		if (count < 0)
+			return count;
+		got += count;
+		if (!count && get_time() > timeout)
+			break;
+	}
+	return got;
+}
+
+/* check that chunk holds continuous ramp of hardware */
+static int check_chunk(int count, long long first)
+{
+	int i;
+
+	for (i = 0; i < count; i++) {
+		if (chunk[i * 2] != rx_value((first + i) % (NUM_BUFFS * MTU), 0) / FULL_SCALE
+		 || chunk[i * 2 + 1] != rx_value((first + i) % (NUM_BUFFS * MTU), 1) / FULL_SCALE) {
+			printf("RX sample %lld is %.6f, expecting %.6f!\n", first + i, chunk[i * 2], rx_value((first + i) % (NUM_BUFFS * MTU), 0) / FULL_SCALE);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/* receive in chunks of different size, then transmit */
+static int test_path(const char *what, int direct, int use_direct, int expect_direct)
+{
+	long long first = 0;
+	int i, count, sent;
+	int chunks[] = { 100, 4096, 1000, 5000, 333, 20000, 7 };
+
+	printf("%s:\n", what);
+	if (open_device(direct, use_direct, 1.0))
+		return -1;
+	if (soapy_receive_direct_access() != expect_direct) {
+		printf(" direct access is %d, expecting %d!\n", soapy_receive_direct_access(), expect_direct);
+		return -1;
+	}
+
+	for (i = 0; i < (int)(sizeof(chunks) / sizeof(chunks[0])); i++) {
+		count = read_chunk(chunks[i]);
+		if (count != chunks[i]) {
+			printf(" received %d of %d samples!\n", count, chunks[i]);
+			return -1;
+		}
+		if (check_chunk(count, first))
+			return -1;
+		first += count;
+	}
+	printf(" %lld samples received through sdr.c in chunks of different size\n", first);
+
+	/* transmit a ramp, the hardware starts at first time stamp given */
+	tx_sample = -1;
+	tx_errors = 0;
+	soapy_get_tosend(TX_SAMPLES);
+	for (i = 0; i < TX_SAMPLES * 2; i++)
+		buffer2[i] = rx_value(i / 2, i & 1) / FULL_SCALE;
+	sent = soapy_send(buffer2, TX_SAMPLES);
+	close_device();
+	if (sent != TX_SAMPLES || tx_errors) {
+		printf(" sent %d of %d samples with %d errors!\n", sent, TX_SAMPLES, tx_errors);
+		return -1;
+	}
+	printf(" %d samples transmitted with continuous time stamps\n", sent);
+
+	return 0;
+}
+
+/* transmit samples beyond full scale, they must be clipped and rounded */
+static int test_tx_clip(void)
+{
+	float samples[] = { 1.5, -1.5, 1.0, -1.0, 100.6 / FULL_SCALE, -100.6 / FULL_SCALE, 0.4 / FULL_SCALE, 32766.7 / FULL_SCALE };
+	int16_t expect[] = { 32767, -32768, 32767, -32768, 101, -101, 0, 32767 };
+	int sent;
+
+	printf("Clipping of samples in driver's buffers:\n");
+	if (open_device(1, 1, 1.0))
+		return -1;
+	tx_sample = -1;
+	tx_errors = 0;
+	expect_tx = expect;
+	soapy_get_tosend(4);
+	sent = soapy_send(samples, 4);
+	close_device();
+	expect_tx = NULL;
+	if (sent != 4 || tx_errors) {
+		printf(" sent %d of %d samples with %d errors!\n", sent, 4, tx_errors);
+		return -1;
+	}
+	printf(" samples beyond full scale are clipped\n");
+
+	return 0;
+}
+
+static int bench_path(const char *what, int direct)
+{
+	double start, duration;
+	long long got = 0;
+	int count;
+
+	/* the read thread does not sleep, so the rate of the path is measured */
+	if (open_device(direct, direct, 0.0))
+		return -1;
+	driver_copies = 0;
+	start = get_time();
+	while (got < BENCH_SAMPLES) {
+		/* the main loop reads what it needs, here about 10 ms of samples */
+		count = read_chunk(10000);
+		if (count <= 0) {
+			printf("No samples received!\n");
+			return -1;
+		}
+		got += count;
+	}
+	duration = get_time() - start;
+	close_device();
+
+	/* besides the driver's conversion, samples are written into the read buffer of sdr.c and read from it */
+	printf("%s: %.1f MS/s sustained RX rate, %.2f copies per sample\n", what, (double)got / duration / 1e6, (double)driver_copies / (double)got + 2.0);
+
+	return 0;
+}
+
+int main(void)
+{
+	/* The stub device has always samples ready, so the copying path
+	 * reports an overflow whenever the read buffer of sdr.c is full.
+	 */
+	loglevel = LOGL_FATAL;
+
+	if (test_path("Direct access to driver's buffers", 1, 1, 1))
+		return 1;
+	if (test_path("Driver without direct access falls back to copying", 0, 1, 0))
+		return 1;
+	if (test_path("Direct access disabled by option", 1, 0, 0))
+		return 1;
+	if (test_tx_clip())
+		return 1;
+
+	verify_tx = 0;
+	printf("Receiving %d samples from a driver with %d buffers of %d samples:\n", BENCH_SAMPLES, NUM_BUFFS, MTU);
+	if (bench_path(" copy via intermediate buffer", 0))
+		return 1;
+	if (bench_path(" direct access              ", 1))
+		return 1;
+
+	return 0;
+}
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../libsdr/tx_sched.h"
+
+/*
+ * The fake device consumes TX samples at the sample rate. The main loop wakes
+ * up every interval, but it is delayed by jitter: Most wake-ups are a little
+ * late. When the system is busy, some are late by some milliseconds and a few
+ * are late by tens of milliseconds. Time is simulated, so the result does not
+ * depend on the machine that runs the test.
+ */
+
+#define SAMPLERATE	100000		/* samples per second */
+#define INTERVAL	1.0		/* main loop interval in ms */
+#define DURATION	600		/* simulated seconds */
+
+static uint32_t rand_state;
+
+static double rnd(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (double)(rand_state >> 8) / 16777216.0;
+}
+
+/* delay of main loop in ms, the system is busy for 20 seconds every 2 minutes */
+static double jitter(double now)
+{
+	double r = rnd();
+
+	if (((int)now / 1000) % 120 < 20) {
+		if (r < 0.0005)
+			return 20.0 + rnd() * 20.0;
+		if (r < 0.01)
+			return 2.0 + rnd() * 6.0;
+	} else {
+		if (r < 0.0001)
+			return 2.0 + rnd() * 6.0;
+	}
+	return rnd() * 0.3;
+}
+
+struct result {
+	int		underruns;
+	int		late;		/* late bursts (scheduler only) */
+	double		lost_ms;	/* duration of samples that were not sent in time */
+	double		lead_ms;	/* average lead time */
+	int		max_lead;	/* maximum lead time in samples */
+	int		old_sent;	/* samples sent with time stamps of the past */
+};
+
+/* Run the main loop with the fake device. If sched is NULL, the lead time is
+ * fixed to the buffer size, like without scheduler.
+ */
+static void run(struct result *res, int buffer_size, sdr_tx_sched_t *sched)
+{
+	long long rx, tx, lead_sum = 0;
+	int advance, tosend, skip, loops = 0;
+	double now = 0.0;
+
+	memset(res, 0, sizeof(*res));
+	rand_state = 1;
+	tx = (sched) ? sdr_tx_sched_lead(sched) : buffer_size;
+
+	while (now < DURATION * 1000.0) {
+		now += INTERVAL + jitter(now);
+		/* samples the device has consumed until now */
+		rx = (long long)(now * SAMPLERATE / 1000.0);
+		advance = tx - rx;
+		if (sched) {
+			tosend = sdr_tx_sched_tosend(sched, advance, &skip);
+			tx += skip;
+		} else {
+			/* what soapy_get_tosend() and uhd_get_tosend() do */
+			tosend = buffer_size - advance;
+			if (tosend > buffer_size) {
+				res->underruns++;
+				tosend = buffer_size;
+			}
+			if (tosend < 0)
+				tosend = 0;
+		}
+		if (tx < rx) {
+			/* these samples have an old time stamp, the device drops them */
+			res->old_sent += (rx - tx < tosend) ? rx - tx : tosend;
+		}
+		if (advance < 0)
+			res->lost_ms += (double)-advance / SAMPLERATE * 1000.0;
+		tx += tosend;
+		if (tx - rx > res->max_lead)
+			res->max_lead = tx - rx;
+		lead_sum += tx - rx;
+		loops++;
+	}
+
+	res->lead_ms = (double)lead_sum / loops / SAMPLERATE * 1000.0;
+	if (sched) {
+		res->underruns = sched->underruns;
+		res->late = sched->late;
+	}
+}
+
+static void print_result(const char *what, struct result *res)
+{
+	printf("%-26s %8.2f %9.2f %9.1f %9.1f\n", what, (double)res->underruns / (DURATION / 60.0), res->lost_ms / (DURATION / 60.0), res->lead_ms, (double)res->max_lead / SAMPLERATE * 1000.0);
+}
+
+int main(void)
+{
+	int latencies[] = { 5, 10, 20, 30, 50 };
+	int bursts[] = { 1, 3, 5, 10 };
+	int burst = SAMPLERATE * INTERVAL / 1000.0;
+	int max_buffer = SAMPLERATE * 50 / 1000;
+	sdr_tx_sched_t sched;
+	struct result res, fixed30;
+	char what[64];
+	int i;
+
+	memset(&fixed30, 0, sizeof(fixed30));
+	printf("%d seconds of main loop with jitter, interval of %.1f ms:\n\n", DURATION, INTERVAL);
+	printf("%-26s %8s %9s %9s %9s\n", "", "under-", "lost ms", "avg lead", "max lead");
+	printf("%-26s %8s %9s %9s %9s\n", "", "runs/min", "per min", "ms", "ms");
+
+	for (i = 0; i < (int)(sizeof(latencies) / sizeof(latencies[0])); i++) {
+		run(&res, SAMPLERATE * latencies[i] / 1000, NULL);
+		snprintf(what, sizeof(what), "fixed lead %d ms", latencies[i]);
+		print_result(what, &res);
+		if (latencies[i] == 30)
+			fixed30 = res;
+		/* the fixed lead time sends samples with old time stamps after each underrun */
+		if (res.underruns && !res.old_sent) {
+			printf("Expecting samples with old time stamps after underrun!\n");
+			return 1;
+		}
+	}
+
+	for (i = 0; i < (int)(sizeof(bursts) / sizeof(bursts[0])); i++) {
+		sdr_tx_sched_init(&sched, SAMPLERATE, burst, bursts[i], max_buffer);
+		run(&res, max_buffer, &sched);
+		snprintf(what, sizeof(what), "scheduler %d bursts, 50 ms", bursts[i]);
+		print_result(what, &res);
+		if (res.old_sent) {
+			printf("Scheduler sent %d samples with old time stamps!\n", res.old_sent);
+			return 1;
+		}
+		if (res.max_lead > max_buffer) {
+			printf("Scheduler exceeds buffer size!\n");
+			return 1;
+		}
+		if (sdr_tx_sched_lead(&sched) < bursts[i] * burst) {
+			printf("Lead time below configured number of bursts!\n");
+			return 1;
+		}
+		if (res.underruns + res.late == 0) {
+			printf("Jitter must cause late bursts!\n");
+			return 1;
+		}
+	}
+
+	/* the scheduler must not do worse than a fixed lead time with the same average latency */
+	if (res.underruns > fixed30.underruns || res.lost_ms > fixed30.lost_ms || res.lead_ms > fixed30.lead_ms) {
+		printf("Scheduler with %d bursts is worse than fixed lead of 30 ms!\n", bursts[i - 1]);
+		return 1;
+	}
+
+	return 0;
+}
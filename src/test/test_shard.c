@@ -0,0 +1,571 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <osmocom/core/timer.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../libmobile/sender.h"
+#include "../libmobile/call.h"
+#include "../libmobile/cause.h"
+#include "../libmobile/shard.h"
+#include "../libmobile/replay.h"
+#include "../libmobile/get_time.h"
+
+/*
+ * Two senders of a fake network, each with its own device, are split into two
+ * workers. The sound devices are replaced by replay, so each sender receives
+ * the audio of its mobile station from a wave file. A tone in the audio means
+ * that the mobile station transmits:
+ *
+ * - Channel 2 (worker 1): A short tone registers subscriber 2002, after more
+ *   subscribers than fit into the call control ring at once.
+ * - Channel 1 (worker 0): A long tone is a call from subscriber 1001 to 2002.
+ *   The call is released when the tone stops, after a burst of audio that
+ *   overflows the audio rings.
+ *
+ * Each process must destroy the senders it does not process, so their timers
+ * must not run there. The supervisor destroys both senders.
+ *
+ * The supervisor replaces OSMO-CC by a simple exchange that connects a call
+ * from a worker to the dialed subscriber, like built-in call forwarding does.
+ * The call must reach worker 1 through the registry, audio must pass both
+ * ways. The registry must be broadcast to all workers. No call control
+ * message must be lost when the rings are full. A call from the exchange to an
+ * unknown subscriber must be offered to all workers and rejected with the
+ * cause of the workers.
+ */
+
+#define SAMPLERATE	8000
+#define BLOCK		8		/* samples per ms */
+#define BUFFER_SIZE	(BLOCK * 10)
+#define FILE_MS		1200		/* length of wave files */
+#define TIMEOUT		10.0		/* seconds */
+#define UNKNOWN_CALLREF	99
+#define SUPERVISOR	2		/* index of supervisor in results */
+#define BURST_SUBSCR	100		/* registrations before 2002 */
+#define BURST_AUDIO	600		/* audio frames before release */
+
+static const char *kanal[2] = { "1", "2" };
+static const char *device[2] = { "fake1", "fake2" };
+static const char *wave_file[2] = { "test_shard_1.wav", "test_shard_2.wav" };
+static const char *number[2] = { "1001", "2002" };
+
+/* tone of each mobile station in ms */
+static const int tone_on[2] = { 200, 50 };
+static const int tone_off[2] = { 900, 100 };
+
+/* results in shared memory, so the supervisor can check the workers */
+struct result {
+	int	kept;			/* channel index of the only sender left after start */
+	int	destroyed[2];		/* senders destroyed, per channel index */
+	int	timer[2];		/* timer expiries, per channel index */
+	int	setup;			/* setups received for own subscriber */
+	int	rejected;		/* setups rejected for unknown subscriber */
+	int	registry;		/* registrations received by broadcast */
+	int	answered;
+	int	audio_rx;		/* audio frames received */
+	int	released;
+};
+
+struct shared {
+	volatile int	registered;	/* supervisor knows worker of 2002 */
+	struct result	result[3];	/* worker 0, worker 1, supervisor */
+};
+
+static struct shared *shared;
+
+static struct result *my_result(void)
+{
+	return &shared->result[(shard_worker >= 0) ? shard_worker : SUPERVISOR];
+}
+
+/*
+ * fake network with one mobile station per sender
+ */
+
+typedef struct fake {
+	sender_t	sender;
+	int		index;			/* index of channel */
+	struct osmo_timer_list timer;
+	int		ms;			/* received audio in ms */
+	double		power;			/* power of current ms */
+	int		power_count;
+	int		tone;			/* mobile station transmits */
+	int		dialed;
+	int		callref;
+	int		connected;
+	int		answer_ms;
+	sample_t	frame[160];		/* audio towards call */
+	int		frame_pos;
+} fake_t;
+
+static void fake_timeout(void *data)
+{
+	fake_t *fake = data;
+
+	my_result()->timer[fake->index]++;
+	osmo_timer_schedule(&fake->timer, 0, 10000);
+}
+
+static void fake_destroy(sender_t *sender)
+{
+	fake_t *fake = (fake_t *)sender;
+
+	my_result()->destroyed[fake->index]++;
+	osmo_timer_del(&fake->timer);
+	sender_destroy(&fake->sender);
+	free(fake);
+}
+
+static fake_t *fake_create(int index)
+{
+	fake_t *fake;
+	int rc;
+
+	fake = calloc(1, sizeof(*fake));
+	if (!fake)
+		return NULL;
+	fake->index = index;
+	fake->answer_ms = -1;
+	rc = sender_create(&fake->sender, kanal[index], 0.0, 0.0, device[index], 0, SAMPLERATE, 1.0, 1.0, 0, 0, NULL, NULL, wave_file[index], NULL, 0, PAGING_SIGNAL_NONE);
+	if (rc < 0) {
+		free(fake);
+		return NULL;
+	}
+	fake->sender.destroy = fake_destroy;
+	sender_set_fm(&fake->sender, 1.0, 1.0, 1.0, 1.0);
+	osmo_timer_setup(&fake->timer, fake_timeout, fake);
+	osmo_timer_schedule(&fake->timer, 0, 10000);
+
+	return fake;
+}
+
+static fake_t *get_fake_by_number(const char *dialing)
+{
+	sender_t *sender;
+
+	for (sender = sender_head; sender; sender = sender->next) {
+		if (!strcmp(number[((fake_t *)sender)->index], dialing))
+			return (fake_t *)sender;
+	}
+	return NULL;
+}
+
+static fake_t *get_fake_by_callref(int callref)
+{
+	sender_t *sender;
+
+	for (sender = sender_head; sender; sender = sender->next) {
+		if (callref && ((fake_t *)sender)->callref == callref)
+			return (fake_t *)sender;
+	}
+	return NULL;
+}
+
+/* process one ms of received audio */
+static void fake_ms(fake_t *fake, int tone)
+{
+	char dummy[16];
+	int i;
+
+	if (fake->index == 1) {
+		/* register, when tone ends (what console_inscription() does in a worker) */
+		if (fake->tone && !tone) {
+			for (i = 0; i < BURST_SUBSCR; i++) {
+				sprintf(dummy, "%d", 5000 + i);
+				shard_up_inscription(dummy);
+			}
+			shard_up_inscription(number[1]);
+		}
+		/* answer after 100 ms */
+		if (fake->callref && fake->answer_ms < 0)
+			fake->answer_ms = fake->ms + 100;
+		if (fake->callref && fake->ms == fake->answer_ms) {
+			call_up_alerting(fake->callref);
+			call_up_answer(fake->callref, number[1]);
+			fake->connected = 1;
+		}
+	} else {
+		/* dial, when tone starts and the called subscriber has registered */
+		if (tone && !fake->dialed && shared->registered) {
+			fake->callref = call_up_setup(number[0], number[1], 0, NULL);
+			fake->dialed = 1;
+		}
+		/* release, when tone stops */
+		if (fake->tone && !tone && fake->callref) {
+			for (i = 0; i < BURST_AUDIO; i++)
+				call_up_audio(fake->callref, fake->frame, 160);
+			call_up_release(fake->callref, CAUSE_NORMAL);
+			fake->callref = 0;
+			fake->connected = 0;
+		}
+	}
+	fake->tone = tone;
+	fake->ms++;
+}
+
+void sender_receive(sender_t *sender, sample_t *samples, int count, double __attribute__((unused)) rf_level_db)
+{
+	fake_t *fake = (fake_t *)sender;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		fake->power += samples[i] * samples[i];
+		if (++fake->power_count == BLOCK) {
+			fake_ms(fake, fake->power / BLOCK > 0.1);
+			fake->power = 0.0;
+			fake->power_count = 0;
+		}
+		/* forward received audio, when connected */
+		if (!fake->connected)
+			continue;
+		fake->frame[fake->frame_pos++] = samples[i];
+		if (fake->frame_pos == 160) {
+			call_up_audio(fake->callref, fake->frame, 160);
+			fake->frame_pos = 0;
+		}
+	}
+}
+
+void sender_send(sender_t __attribute__((unused)) *sender, sample_t *samples, uint8_t *power, int count)
+{
+	memset(samples, 0, count * sizeof(*samples));
+	memset(power, 1, count);
+}
+
+int call_down_setup(int callref, const char __attribute__((unused)) *caller_id, enum number_type __attribute__((unused)) caller_type, const char *dialing)
+{
+	fake_t *fake = get_fake_by_number(dialing);
+
+	if (!fake) {
+		my_result()->rejected++;
+		return -CAUSE_INVALNUMBER;
+	}
+	if (fake->callref)
+		return -CAUSE_BUSY;
+	my_result()->setup++;
+	fake->callref = callref;
+	return 0;
+}
+
+void call_down_answer(int callref, struct timeval __attribute__((unused)) *tv_meter)
+{
+	fake_t *fake = get_fake_by_callref(callref);
+
+	if (!fake)
+		return;
+	my_result()->answered++;
+	fake->connected = 1;
+}
+
+void call_down_disconnect(int callref, int cause)
+{
+	call_down_release(callref, cause);
+}
+
+void call_down_release(int callref, int __attribute__((unused)) cause)
+{
+	fake_t *fake = get_fake_by_callref(callref);
+
+	if (!fake)
+		return;
+	my_result()->released++;
+	fake->callref = 0;
+	fake->connected = 0;
+}
+
+void call_down_audio(void __attribute__((unused)) *decoder, void __attribute__((unused)) *decoder_priv, int callref, uint16_t __attribute__((unused)) sequence, uint8_t __attribute__((unused)) marker, uint32_t __attribute__((unused)) timestamp, uint32_t __attribute__((unused)) ssrc, uint8_t __attribute__((unused)) *payload, int payload_len)
+{
+	/* one frame of 20 ms L16 */
+	if (get_fake_by_callref(callref) && payload_len == 160 * 2)
+		my_result()->audio_rx++;
+}
+
+void call_down_clock(void) { }
+
+static int worker(void)
+{
+	sample_t *samples[1];
+	uint8_t *power[1];
+	sender_t *sender;
+	int quit = 0;
+
+	/* only the sender of this worker is left */
+	sender = sender_head;
+	my_result()->kept = (sender && !sender->next) ? ((fake_t *)sender)->index : -1;
+
+	samples[0] = calloc(BUFFER_SIZE, sizeof(**samples));
+	power[0] = calloc(BUFFER_SIZE, sizeof(**power));
+	if (!samples[0] || !power[0])
+		return 1;
+	if (sender_open_audio(BUFFER_SIZE, 1.0) || sender_start_audio())
+		return 1;
+
+	while (!shard_quit()) {
+		replay_tick(0.001);
+		/* stop processing at the end of the wave file, but keep the bridge */
+		for (sender = sender_head; sender && !quit; sender = sender->next) {
+			if (!sender->master)
+				process_sender_audio(sender, &quit, samples, power, BUFFER_SIZE);
+		}
+		osmo_timers_prepare();
+		osmo_timers_update();
+		shard_handle();
+		if (shard_registry_lookup(number[1]) == 1 && shard_registry_lookup("5099") == 1)
+			my_result()->registry = 1;
+		usleep(1000);
+	}
+
+	while (sender_head)
+		sender_head->destroy(sender_head);
+	free(samples[0]);
+	free(power[0]);
+	shard_exit();
+
+	return 0;
+}
+
+/*
+ * supervisor: exchange that connects calls between workers
+ */
+
+static int a_callref, b_callref, next_callref = 1;
+static int unknown_cause = 0, call_released = 0;
+
+/* in the worker, call control messages go to the supervisor */
+int call_up_setup(const char *callerid, const char *dialing, uint8_t network, const char *network_id)
+{
+	int rc;
+
+	if (shard_worker >= 0)
+		return shard_up_setup(callerid, dialing, network, network_id);
+
+	a_callref = next_callref++;
+	b_callref = next_callref++;
+	rc = shard_down_setup(b_callref, callerid, TYPE_SUBSCRIBER, dialing);
+	if (rc < 0)
+		printf("Setup to '%s' failed with cause %d!\n", dialing, -rc);
+	return a_callref;
+}
+
+void call_up_alerting(int callref)
+{
+	if (shard_worker >= 0)
+		shard_up_alerting(callref);
+}
+
+void call_up_early(int callref)
+{
+	if (shard_worker >= 0)
+		shard_up_early(callref);
+}
+
+void call_up_answer(int callref, const char *connect_id)
+{
+	struct timeval tv_meter = { 0, 0 };
+
+	if (shard_worker >= 0) {
+		shard_up_answer(callref, connect_id);
+		return;
+	}
+	if (callref == b_callref)
+		shard_down_answer(a_callref, &tv_meter);
+}
+
+void call_up_release(int callref, int cause)
+{
+	int16_t spl[160];
+	int i;
+
+	if (shard_worker >= 0) {
+		shard_up_release(callref, cause);
+		return;
+	}
+	if (callref == UNKNOWN_CALLREF) {
+		unknown_cause = cause;
+		return;
+	}
+	/* the release follows a burst of audio */
+	memset(spl, 0, sizeof(spl));
+	for (i = 0; i < BURST_AUDIO; i++)
+		shard_down_audio(NULL, NULL, (callref == a_callref) ? b_callref : a_callref, 0, 0, 0, 0, (uint8_t *)spl, sizeof(spl));
+	if (callref == a_callref)
+		shard_down_release(b_callref, cause);
+	if (callref == b_callref)
+		shard_down_release(a_callref, cause);
+	call_released = 1;
+}
+
+void call_tone_recall(int callref, int on)
+{
+	if (shard_worker >= 0)
+		shard_up_tone_recall(callref, on);
+}
+
+void call_up_audio(int callref, sample_t *samples, int count)
+{
+	int16_t spl[count];
+	int i;
+
+	if (shard_worker >= 0) {
+		shard_up_audio(callref, samples, count);
+		return;
+	}
+	/* the exchange forwards decoded L16 */
+	for (i = 0; i < count; i++)
+		spl[i] = samples[i] * 32767.0;
+	if (callref == a_callref)
+		shard_down_audio(NULL, NULL, b_callref, 0, 0, 0, 0, (uint8_t *)spl, count * 2);
+	if (callref == b_callref)
+		shard_down_audio(NULL, NULL, a_callref, 0, 0, 0, 0, (uint8_t *)spl, count * 2);
+}
+
+static int write_wave_file(int index)
+{
+	wave_rec_t rec;
+	sample_t buff[BLOCK], *samples[1] = { buff };
+	double phase = 0.0, amplitude;
+	int ms, i, rc;
+
+	memset(&rec, 0, sizeof(rec));
+	rc = wave_create_record(&rec, wave_file[index], SAMPLERATE, 1, 1.0);
+	if (rc < 0)
+		return rc;
+	for (ms = 0; ms < FILE_MS; ms++) {
+		amplitude = (ms >= tone_on[index] && ms < tone_off[index]) ? 0.8 : 0.01;
+		for (i = 0; i < BLOCK; i++) {
+			buff[i] = sin(phase) * amplitude;
+			phase += 2.0 * M_PI * 1500.0 / SAMPLERATE;
+		}
+		wave_write(&rec, samples, BLOCK);
+	}
+	wave_destroy_record(&rec);
+
+	return 0;
+}
+
+static void print_result(const char *name, struct result *r)
+{
+	printf("%s: kept=%d destroyed=%d,%d timer=%d,%d setup=%d answered=%d audio frames=%d released=%d rejected=%d registry=%d\n", name, r->kept, r->destroyed[0], r->destroyed[1], r->timer[0], r->timer[1], r->setup, r->answered, r->audio_rx, r->released, r->rejected, r->registry);
+}
+
+int main(void)
+{
+	const char *spec[2] = { "1", "2" };
+	struct result *w0, *w1, *sv;
+	int unknown_sent = 0;
+	double start;
+	int rc, i;
+
+	loglevel = LOGL_ERROR;
+
+	for (i = 0; i < 2; i++) {
+		if (write_wave_file(i) < 0) {
+			printf("Failed to write wave file!\n");
+			return 1;
+		}
+	}
+
+	shared = mmap(NULL, sizeof(*shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (shared == MAP_FAILED)
+		return 1;
+	memset(shared, 0, sizeof(*shared));
+	w0 = &shared->result[0];
+	w1 = &shared->result[1];
+	sv = &shared->result[SUPERVISOR];
+	w0->kept = w1->kept = sv->kept = -1;
+
+	/* senders use replay instead of a sound device */
+	replay_init(0.0);
+	for (i = 0; i < 2; i++) {
+		if (!fake_create(i)) {
+			printf("Failed to create sender!\n");
+			return 1;
+		}
+	}
+
+	rc = shard_start(2, spec);
+	if (rc < 0) {
+		printf("Failed to start workers!\n");
+		return 1;
+	}
+	if (shard_worker >= 0)
+		return worker();
+
+	start = get_time();
+	while (get_time() - start < TIMEOUT) {
+		replay_tick(0.001);
+		osmo_timers_prepare();
+		osmo_timers_update();
+		shard_handle();
+		if (shard_quit()) {
+			printf("Worker terminated unexpectedly!\n");
+			break;
+		}
+		shared->registered = (shard_registry_lookup(number[1]) == 1);
+		/* call to unknown subscriber, after the workers are running */
+		if (!unknown_sent && shared->registered) {
+			shard_down_setup(UNKNOWN_CALLREF, "", TYPE_UNKNOWN, "3003");
+			unknown_sent = 1;
+		}
+		if (call_released && unknown_cause)
+			break;
+		usleep(1000);
+	}
+	/* let the release reach the worker */
+	for (i = 0; i < 50; i++) {
+		shard_handle();
+		usleep(1000);
+	}
+	shard_exit();
+
+	for (i = 0; i < 2; i++)
+		unlink(wave_file[i]);
+
+	print_result("worker 0", w0);
+	print_result("worker 1", w1);
+	print_result("supervisor", sv);
+	printf("call to unknown subscriber released with cause %d\n", unknown_cause);
+
+	if (w0->kept != 0 || w1->kept != 1 || sender_head) {
+		printf("Senders were not split between workers!\n");
+		return 1;
+	}
+	for (i = 0; i < 2; i++) {
+		if (w0->destroyed[i] != 1 || w1->destroyed[i] != 1 || sv->destroyed[i] != 1) {
+			printf("Sender of channel %s was not destroyed once in each process!\n", kanal[i]);
+			return 1;
+		}
+	}
+	if (!w0->timer[0] || w0->timer[1] || !w1->timer[1] || w1->timer[0] || sv->timer[0] || sv->timer[1]) {
+		printf("Timers of destroyed senders are still running!\n");
+		return 1;
+	}
+	if (w1->setup != 1 || w0->answered != 1) {
+		printf("Call was not routed from worker 0 to worker 1!\n");
+		return 1;
+	}
+	if (w0->audio_rx < 10 || w1->audio_rx < 10) {
+		printf("Audio did not pass between workers!\n");
+		return 1;
+	}
+	if (!call_released || w1->released != 1) {
+		printf("Release did not reach worker 1!\n");
+		return 1;
+	}
+	if (!w0->registry || !w1->registry) {
+		printf("Registry was not broadcast to all workers!\n");
+		return 1;
+	}
+	if (w0->rejected != 1 || w1->rejected != 1 || unknown_cause != CAUSE_INVALNUMBER) {
+		printf("Call to unknown subscriber was not offered to all workers!\n");
+		return 1;
+	}
+
+	return 0;
+}
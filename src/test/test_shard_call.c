@@ -0,0 +1,409 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <osmocom/core/select.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../libmobile/sender.h"
+#include "../libmobile/call.h"
+#include "../libmobile/cause.h"
+#include "../libmobile/console.h"
+#include "../libmobile/shard.h"
+#include "../libmobile/get_time.h"
+
+/*
+ * Calls between two workers pass the real call control of the supervisor,
+ * like built-in call forwarding (-x) does. Each worker has its own call
+ * control instance for calls between its own subscribers. Mobile stations
+ * are simulated by this test, no sender is needed.
+ *
+ * - Worker 0 serves 1001, worker 1 serves 2002 and 2004. They register with
+ *   console_inscription(), like the networks do.
+ * - 1001 calls unknown 3003: The supervisor receives the setup from the
+ *   crossover and offers it to one worker after another. Both reject it, the
+ *   caller must be released with the cause of the workers.
+ * - 1001 calls 2002: The call must reach worker 1 through the registry. The
+ *   audio is encoded by the supervisor's call control and decoded by
+ *   shard_down_audio() before it reaches the other worker.
+ * - 2002 calls 2004: The call must be connected by worker 1, so the
+ *   supervisor does not see it.
+ */
+
+#define PORT		4310		/* crossover of supervisor, workers use the next ports */
+#define TIMEOUT		10.0		/* seconds */
+#define ANSWER_MS	100
+#define CALL_FRAMES	25		/* audio frames to receive before release */
+
+static const struct number_lengths number_lengths[] = {
+	{ 4, "subscriber number" },
+	{ 0, NULL }
+};
+
+/* one mobile station */
+struct mobile {
+	const char	*number;
+	int		worker;
+	int		callref;
+	int		incoming;		/* mobile station is called */
+	int		connected;
+	int		answer_ms;
+	int		setup;			/* setups received */
+	int		local;			/* setups received from call control of worker */
+	int		answered;		/* answers received */
+	int		audio_rx;		/* frames received with tone, when connected */
+	int		released;
+	int		cause;			/* cause of last release */
+};
+
+/* results in shared memory, so the supervisor can check the workers */
+struct shared {
+	struct mobile	mobile[3];
+	int		rejected[2];		/* setups rejected, per worker */
+	int		unknown_cause;		/* cause of call to unknown subscriber */
+	volatile int	done[2];		/* worker has done its calls */
+};
+
+static struct shared *shared;
+static sample_t tone[160];
+
+static struct mobile *get_mobile_by_number(const char *dialing)
+{
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		if (shared->mobile[i].worker == shard_worker && !strcmp(shared->mobile[i].number, dialing))
+			return &shared->mobile[i];
+	}
+	return NULL;
+}
+
+static struct mobile *get_mobile_by_callref(int callref)
+{
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		if (shared->mobile[i].worker == shard_worker && callref && shared->mobile[i].callref == callref)
+			return &shared->mobile[i];
+	}
+	return NULL;
+}
+
+/*
+ * network of the workers
+ */
+
+int call_down_setup(int callref, const char __attribute__((unused)) *caller_id, enum number_type __attribute__((unused)) caller_type, const char *dialing)
+{
+	struct mobile *mobile = get_mobile_by_number(dialing);
+
+	if (!mobile) {
+		shared->rejected[shard_worker]++;
+		return -CAUSE_INVALNUMBER;
+	}
+	if (mobile->callref)
+		return -CAUSE_BUSY;
+	mobile->setup++;
+	/* callrefs of the supervisor have bit 30 set, see shard_down_setup() */
+	if (!(callref & 0x40000000))
+		mobile->local++;
+	mobile->callref = callref;
+	mobile->incoming = 1;
+	mobile->answer_ms = -1;
+	return 0;
+}
+
+void call_down_answer(int callref, struct timeval __attribute__((unused)) *tv_meter)
+{
+	struct mobile *mobile = get_mobile_by_callref(callref);
+
+	if (!mobile)
+		return;
+	mobile->answered++;
+	mobile->connected = 1;
+}
+
+void call_down_disconnect(int callref, int cause)
+{
+	call_down_release(callref, cause);
+}
+
+void call_down_release(int callref, int cause)
+{
+	struct mobile *mobile = get_mobile_by_callref(callref);
+
+	if (!mobile)
+		return;
+	mobile->released++;
+	mobile->cause = cause;
+	mobile->callref = 0;
+	mobile->incoming = 0;
+	mobile->connected = 0;
+}
+
+void call_down_audio(void *decoder, void *decoder_priv, int callref, uint16_t __attribute__((unused)) sequence, uint8_t __attribute__((unused)) marker, uint32_t __attribute__((unused)) timestamp, uint32_t __attribute__((unused)) ssrc, uint8_t *payload, int payload_len)
+{
+	void (*decode)(uint8_t *src_data, int src_len, uint8_t **dst_data, int *dst_len, void *priv) = decoder;
+	struct mobile *mobile = get_mobile_by_callref(callref);
+	uint8_t *data = payload;
+	int len = payload_len;
+	int16_t *spl;
+	int i, peak = 0;
+
+	if (!mobile || !mobile->connected)
+		return;
+	/* audio of the supervisor is decoded already, audio of a local call is not */
+	if (decode)
+		decode(payload, payload_len, &data, &len, decoder_priv);
+	spl = (int16_t *)data;
+	for (i = 0; i < len / 2; i++) {
+		if (abs(spl[i]) > peak)
+			peak = abs(spl[i]);
+	}
+	/* one frame of 20 ms L16 with the tone */
+	if (len == 160 * 2 && peak > 1000)
+		mobile->audio_rx++;
+	if (data != payload)
+		free(data);
+}
+
+void call_down_clock(void) { }
+
+void sender_receive(sender_t __attribute__((unused)) *sender, sample_t __attribute__((unused)) *samples, int __attribute__((unused)) count, double __attribute__((unused)) rf_level_db) { }
+void sender_send(sender_t __attribute__((unused)) *sender, sample_t __attribute__((unused)) *samples, uint8_t __attribute__((unused)) *power, int __attribute__((unused)) count) { }
+void print_help(const char __attribute__((unused)) *arg0) { }
+void dump_info(void) { }
+
+/* return 1, if the call is done */
+static int mobile_call(struct mobile *caller, const char *dialing, int *state)
+{
+	switch (*state) {
+	case 0:
+		caller->callref = call_up_setup(caller->number, dialing, 0, NULL);
+		(*state)++;
+		break;
+	case 1:
+		/* release after the call has been released or has received enough audio */
+		if (!caller->callref)
+			return 1;
+		if (caller->audio_rx >= CALL_FRAMES) {
+			call_up_release(caller->callref, CAUSE_NORMAL);
+			caller->callref = 0;
+			caller->connected = 0;
+			return 1;
+		}
+		break;
+	}
+	return 0;
+}
+
+/* answer incoming calls and send the tone every 20 ms */
+static void mobile_clock(int ms)
+{
+	struct mobile *mobile;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		mobile = &shared->mobile[i];
+		if (mobile->worker != shard_worker || !mobile->callref)
+			continue;
+		if (mobile->incoming && mobile->answer_ms < 0)
+			mobile->answer_ms = ms + ANSWER_MS;
+		if (mobile->incoming && ms == mobile->answer_ms) {
+			call_up_alerting(mobile->callref);
+			call_up_answer(mobile->callref, mobile->number);
+			mobile->connected = 1;
+		}
+		if (mobile->connected && (ms % 20) == 0)
+			call_up_audio(mobile->callref, tone, 160);
+	}
+}
+
+static int worker(void)
+{
+	struct mobile *m1001 = &shared->mobile[0], *m2002 = &shared->mobile[1], *m2004 = &shared->mobile[2];
+	const char *cc_argv[2];
+	char local[64], remote[64];
+	int step = 0, state = 0;
+	int ms = 0;
+	int rc;
+
+	/* each worker connects calls between its own subscribers on its own port */
+	sprintf(local, "local 127.0.0.1:%d", PORT + 1 + shard_worker);
+	sprintf(remote, "remote 127.0.0.1:%d", PORT + 1 + shard_worker);
+	cc_argv[0] = local;
+	cc_argv[1] = remote;
+	rc = call_init("test", 0, 1, 1, 2, cc_argv, 1);
+	if (rc < 0) {
+		printf("Worker %d failed to create call control instance!\n", shard_worker);
+		return 1;
+	}
+
+	if (shard_worker == 0)
+		console_inscription(m1001->number);
+	else {
+		console_inscription(m2002->number);
+		console_inscription(m2004->number);
+	}
+
+	while (!shard_quit()) {
+		while (call_handle() | osmo_select_main(1) | shard_handle());
+		if ((ms % 20) == 0)
+			call_clock();
+		mobile_clock(ms);
+
+		switch (step) {
+		case 0:
+			/* wait for the broadcast of the registry */
+			if (shard_registry_lookup(m1001->number) == 0 && shard_registry_lookup(m2002->number) == 1 && shard_registry_lookup(m2004->number) == 1)
+				step = (shard_worker == 0) ? 1 : 3;
+			break;
+		case 1:
+			/* 1001 calls unknown subscriber */
+			if (mobile_call(m1001, "3003", &state)) {
+				shared->unknown_cause = m1001->cause;
+				state = 0;
+				step++;
+			}
+			break;
+		case 2:
+			/* 1001 calls 2002 at worker 1 */
+			if (mobile_call(m1001, m2002->number, &state))
+				step = 5;
+			break;
+		case 3:
+			/* 2002 waits for the call from 1001 */
+			if (m2002->released)
+				step++;
+			break;
+		case 4:
+			/* 2002 calls 2004 at the same worker */
+			if (mobile_call(m2002, m2004->number, &state))
+				step++;
+			break;
+		case 5:
+			shared->done[shard_worker] = 1;
+			break;
+		}
+
+		usleep(1000);
+		ms++;
+	}
+
+	call_exit();
+	shard_exit();
+
+	return 0;
+}
+
+static void print_mobile(struct mobile *m)
+{
+	printf("%s (worker %d): setup=%d local=%d answered=%d audio frames=%d released=%d cause=%d\n", m->number, m->worker, m->setup, m->local, m->answered, m->audio_rx, m->released, m->cause);
+}
+
+int main(void)
+{
+	const char *spec[2] = { "1", "2" };
+	const char *cc_argv[2];
+	char local[64], remote[64];
+	struct mobile *m1001, *m2002, *m2004;
+	double start, last_clock;
+	int rc, i;
+
+	main_mobile_init("0123456789", number_lengths, NULL, NULL);
+	loglevel = LOGL_ERROR;
+
+	shared = mmap(NULL, sizeof(*shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (shared == MAP_FAILED)
+		return 1;
+	memset(shared, 0, sizeof(*shared));
+	m1001 = &shared->mobile[0];
+	m2002 = &shared->mobile[1];
+	m2004 = &shared->mobile[2];
+	m1001->number = "1001";
+	m2002->number = "2002";
+	m2004->number = "2004";
+	m2002->worker = m2004->worker = 1;
+
+	for (i = 0; i < 160; i++)
+		tone[i] = sin(2.0 * M_PI * 1000.0 * i / 8000.0) * 0.5;
+
+	rc = shard_start(2, spec);
+	if (rc < 0) {
+		printf("Failed to start workers!\n");
+		return 1;
+	}
+	if (shard_worker >= 0)
+		return worker();
+
+	/* the supervisor forwards calls between its own crossover and the workers */
+	sprintf(local, "local 127.0.0.1:%d", PORT);
+	sprintf(remote, "remote 127.0.0.1:%d", PORT);
+	cc_argv[0] = local;
+	cc_argv[1] = remote;
+	rc = call_init("test", 0, 1, 1, 2, cc_argv, 1);
+	if (rc < 0) {
+		printf("Failed to create call control instance!\n");
+		shard_exit();
+		return 1;
+	}
+
+	start = last_clock = get_time();
+	while (get_time() - start < TIMEOUT) {
+		while (call_handle() | osmo_select_main(1) | shard_handle());
+		if (get_time() - last_clock >= 0.020) {
+			last_clock += 0.020;
+			call_clock();
+		}
+		if (shard_quit()) {
+			printf("Worker terminated unexpectedly!\n");
+			break;
+		}
+		if (shared->done[0] && shared->done[1])
+			break;
+		usleep(1000);
+	}
+	/* let the releases reach the other side */
+	for (i = 0; i < 100; i++) {
+		while (call_handle() | osmo_select_main(1) | shard_handle());
+		usleep(1000);
+	}
+	call_exit();
+	shard_exit();
+
+	print_mobile(m1001);
+	print_mobile(m2002);
+	print_mobile(m2004);
+	printf("call to unknown subscriber rejected by worker 0: %d, by worker 1: %d, released with cause %d\n", shared->rejected[0], shared->rejected[1], shared->unknown_cause);
+
+	if (!shared->done[0] || !shared->done[1]) {
+		printf("Calls were not completed in time!\n");
+		return 1;
+	}
+	if (shared->rejected[0] != 1 || shared->rejected[1] != 1 || shared->unknown_cause != CAUSE_INVALNUMBER) {
+		printf("Call to unknown subscriber was not offered to all workers!\n");
+		return 1;
+	}
+	if (m2002->setup != 1 || m2002->local || m1001->answered != 1) {
+		printf("Call was not routed from worker 0 to worker 1 through the supervisor!\n");
+		return 1;
+	}
+	if (m1001->audio_rx < CALL_FRAMES) {
+		printf("Decoded audio did not pass between workers!\n");
+		return 1;
+	}
+	if (m2004->setup != 1 || m2004->local != 1 || m2004->audio_rx < 10) {
+		printf("Call between subscribers of worker 1 was not connected by worker 1!\n");
+		return 1;
+	}
+	if (m2002->released != 1 || m2004->released != 1) {
+		printf("Releases did not reach the called subscribers!\n");
+		return 1;
+	}
+
+	return 0;
+}
@@ -61,6 +61,16 @@ static void ok(void)
 
 static uint8_t dms_buffer[256];
 static int dms_buffer_count;
+int dms_frames_required(nmt_t __attribute__((unused)) *nmt, const uint8_t __attribute__((unused)) *data, int __attribute__((unused)) length, int __attribute__((unused)) eight_bits)
+{
+	return 1;
+}
+
+int dms_frames_free(nmt_t __attribute__((unused)) *nmt)
+{
+	return 1;
+}
+
 void dms_send(nmt_t __attribute__((unused)) *nmt, const uint8_t *data, int length, int __attribute__((unused)) eight_bits)
 {
 	int i;
@@ -118,7 +128,7 @@ int main(void)
 
 	/* deliver */
 	printf("(delivering SMS)\n");
-	rc = sms_deliver(nmt, 1, test_mt_sms_tel, SMS_TYPE_INTERNATIONAL, SMS_PLAN_ISDN_TEL, test_mt_sms_time, 0, test_mt_sms_text);
+	rc = sms_deliver(nmt, test_mt_sms_tel, SMS_TYPE_INTERNATIONAL, SMS_PLAN_ISDN_TEL, test_mt_sms_time, 0, test_mt_sms_text);
 	assert(rc == 0, "Expecting sms_deliver() to return 0");
 
 	sms_cleanup_sender(nmt);
@@ -0,0 +1,300 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/resource.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../libmobile/get_time.h"
+#include "../nmt/nmt.h"
+
+/*
+ * Deliver messages from the SMS queue of the base station to a mobile station
+ * that is emulated by this test. The mobile station has its own DMS instance.
+ * It takes each delivered message from the receive buffer of its SMS instance
+ * and replies with a deliver report. The bits of both directions are
+ * exchanged at the same time and at the bit rate of NMT, so the virtual time
+ * is the air time that the messages take.
+ */
+
+#define MESSAGES	1000
+#define BIT_RATE	1200.0
+#define STEP		8		/* bits per direction and step */
+#define TIMEOUT		86400.0		/* seconds of air time */
+
+static nmt_t *sc, *ms;
+static int received = 0, reported = 0, failed = 0;
+static uint8_t report_ref[MESSAGES + 16];
+static double air_time = 0.0;
+static int expect_error = 0;		/* reports are expected to fail */
+
+/* the mobile station holds back the reports, to send them in different order */
+static int hold_reports = 0;
+static uint8_t held_ref[16];
+static int held_count = 0;
+
+/* references are assigned by the SMS layer, 0 is not used */
+static uint8_t msg_ref(int i)
+{
+	return i % 255 + 1;
+}
+
+static void msg_text(int i, char *text)
+{
+	sprintf(text, "Message %d of loopback test", i);
+}
+
+int sms_submit(nmt_t __attribute__((unused)) *nmt, uint8_t __attribute__((unused)) ref, const char __attribute__((unused)) *orig_address, uint8_t __attribute__((unused)) orig_type, uint8_t __attribute__((unused)) orig_plan, int __attribute__((unused)) msg_ref, const char __attribute__((unused)) *dest_address, uint8_t __attribute__((unused)) dest_type, uint8_t __attribute__((unused)) dest_plan, const char __attribute__((unused)) *message)
+{
+	return 0;
+}
+
+void sms_deliver_report(nmt_t __attribute__((unused)) *nmt, uint8_t ref, int error, uint8_t cause)
+{
+	if (error != expect_error) {
+		printf("Report %d has ref=%d error=%d cause=%d!\n", reported, ref, error, cause);
+		failed++;
+	}
+	report_ref[reported++] = ref;
+}
+
+void sms_release(nmt_t __attribute__((unused)) *nmt)
+{
+}
+
+static nmt_t *alloc_nmt(void)
+{
+	nmt_t *nmt;
+
+	nmt = calloc(sizeof(*nmt), 1);
+	nmt->sender.samplerate = 40 * 1200;
+	dms_init_sender(nmt);
+	sms_init_sender(nmt);
+	dms_reset(nmt);
+	sms_reset(nmt);
+
+	return nmt;
+}
+
+static void free_nmt(nmt_t *nmt)
+{
+	sms_cleanup_sender(nmt);
+	dms_cleanup_sender(nmt);
+	free(nmt);
+}
+
+/* send the bits of one step from one DMS instance to the other */
+static void transmit(nmt_t *from, nmt_t *to)
+{
+	uint8_t bits[(STEP + 7) / 8];
+	int count = 0, rc, i;
+
+	while (count < STEP) {
+		rc = dms_send_bits(from, bits, STEP - count);
+		if (rc < 0)
+			break;
+		for (i = 0; i < rc; i++)
+			fsk_receive_bit_dms(to, (bits[i >> 3] >> (7 - (i & 7))) & 1, 1.0, 1.0);
+		count += rc;
+	}
+}
+
+/* decode 7-bit characters, like the mobile station does */
+static void decode_text(const uint8_t *data, int chars, char *text)
+{
+	int i, bit;
+
+	for (i = 0; i < chars; i++) {
+		bit = i * 7;
+		text[i] = ((data[bit >> 3] | (data[(bit >> 3) + 1] << 8)) >> (bit & 7)) & 0x7f;
+	}
+	text[chars] = '\0';
+}
+
+/* take delivered messages from the SMS instance of the mobile station */
+static void ms_receive(void)
+{
+	sms_t *sms = &ms->sms;
+	uint8_t *data = sms->rx_buffer, *tpdu, *ud, report[2];
+	char text[256], expect[256];
+	int length;
+
+	/* header, RP-MTI, RP-MR, user data IE, TPDU length */
+	while (sms->rx_count >= 15 && sms->rx_count >= 15 + data[14]) {
+		length = 15 + data[14];
+		tpdu = data + 15;
+		/* TP-MTI, TP-OA, TP-PID, TP-DCS, TP-SCTS, TP-UDL */
+		ud = tpdu + 3 + ((tpdu[1] + 1) >> 1) + 2 + 7;
+		decode_text(ud + 1, ud[0], text);
+		msg_text(received, expect);
+		if (data[11] != 0x01 || data[12] != msg_ref(received) || strcmp(text, expect)) {
+			printf("Message %d has ref=%d text='%s', expecting ref=%d text='%s'!\n", received, data[12], text, msg_ref(received), expect);
+			failed++;
+		}
+		received++;
+
+		report[0] = 0x02; /* RP-ACK */
+		report[1] = data[12];
+		memmove(data, data + length, sms->rx_count - length);
+		sms->rx_count -= length;
+		if (hold_reports)
+			held_ref[held_count++] = report[1];
+		else
+			dms_send(ms, report, 2, 1);
+	}
+}
+
+/* exchange bits of both directions for one step */
+static void step(void)
+{
+	transmit(sc, ms);
+	transmit(ms, sc);
+	ms_receive();
+
+	air_time += STEP / BIT_RATE;
+	set_virtual_time(air_time);
+}
+
+/* send reports held back by the mobile station in the given order, then wait until they are processed */
+static void send_held_reports(const int *order, int count)
+{
+	uint8_t report[2];
+	double timeout = air_time + 60.0;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		report[0] = 0x02; /* RP-ACK */
+		report[1] = held_ref[order[i]];
+		dms_send(ms, report, 2, 1);
+	}
+	while (air_time < timeout && (ms->dms.state.frame_count || ms->dms.tx_frame_valid))
+		step();
+	/* let the last RR reach the mobile station */
+	for (i = 0; i < 100; i++)
+		step();
+}
+
+extern void main_mobile_loop();
+
+int main(void)
+{
+	struct rusage r1, r2;
+	char text[256];
+	double cpu;
+	int queued = 0;
+	const int unknown[1] = { 3 }, reverse[3] = { 2, 1, 0 };
+	int rc, i;
+
+	/* this is never called, it forces the linker to add mobile functions */
+	if (loglevel == -1000) main_mobile_loop();
+
+	loglevel = LOGL_ERROR;
+	logging_init();
+	set_virtual_time(air_time);
+
+	sc = alloc_nmt();
+	ms = alloc_nmt();
+
+	getrusage(RUSAGE_SELF, &r1);
+
+	while (reported < MESSAGES && air_time < TIMEOUT) {
+		/* keep the queue of the base station filled */
+		while (queued < MESSAGES) {
+			msg_text(queued, text);
+			rc = sms_deliver(sc, "4948416068", SMS_TYPE_INTERNATIONAL, SMS_PLAN_ISDN_TEL, 851430904, 0, text);
+			if (rc == -EBUSY)
+				break;
+			if (rc < 0) {
+				printf("Failed to deliver message %d!\n", queued);
+				return 1;
+			}
+			queued++;
+		}
+
+		step();
+	}
+
+	getrusage(RUSAGE_SELF, &r2);
+	cpu = (double)(r2.ru_utime.tv_sec - r1.ru_utime.tv_sec + r2.ru_stime.tv_sec - r1.ru_stime.tv_sec)
+	    + (double)(r2.ru_utime.tv_usec - r1.ru_utime.tv_usec + r2.ru_stime.tv_usec - r1.ru_stime.tv_usec) / 1000000.0;
+
+	printf("%d messages received, %d reported in %.1f s air time = %.1f messages per minute\n", received, reported, air_time, (air_time > 0.0) ? reported * 60.0 / air_time : 0.0);
+	printf("queue depth max %d, latency average %.3f s, max %.3f s\n", sc->sms.stat.queue_depth_max, (sc->sms.stat.delivered) ? sc->sms.stat.latency_sum / sc->sms.stat.delivered : 0.0, sc->sms.stat.latency_max);
+	printf("CPU time %.3f s = %.0f messages per CPU second\n", cpu, (cpu > 0.0) ? reported / cpu : 0.0);
+
+	rc = 0;
+	if (received != MESSAGES || reported != MESSAGES || sc->sms.stat.delivered != MESSAGES) {
+		printf("Not all messages were delivered!\n");
+		rc = 1;
+	}
+	for (i = 0; i < reported; i++) {
+		if (report_ref[i] != msg_ref(i)) {
+			printf("Report %d has ref=%d, expecting ref=%d!\n", i, report_ref[i], msg_ref(i));
+			failed++;
+		}
+	}
+
+	/* reports in reverse order and a report with unknown reference */
+	hold_reports = 1;
+	for (i = 0; i < 3; i++) {
+		msg_text(MESSAGES + i, text);
+		sms_deliver(sc, "4948416068", SMS_TYPE_INTERNATIONAL, SMS_PLAN_ISDN_TEL, 851430904, 0, text);
+	}
+	while (held_count < 3 && air_time < TIMEOUT)
+		step();
+	held_ref[3] = 0x77;
+	send_held_reports(unknown, 1);
+	if (sc->sms.queue_count != 3 || reported != MESSAGES) {
+		printf("Report with unknown reference was not ignored!\n");
+		rc = 1;
+	}
+	send_held_reports(reverse, 3);
+	printf("reports in reverse order: %d of 3 reported, %d messages left in queue\n", reported - MESSAGES, sc->sms.queue_count);
+	if (sc->sms.queue_count != 0 || reported != MESSAGES + 3 || sc->sms.stat.delivered != MESSAGES + 3) {
+		printf("Reports in reverse order were not matched with their messages!\n");
+		rc = 1;
+	}
+	for (i = 0; i < 3; i++) {
+		if (report_ref[MESSAGES + i] != msg_ref(MESSAGES + reverse[i])) {
+			printf("Report %d has ref=%d, expecting ref=%d!\n", MESSAGES + i, report_ref[MESSAGES + i], msg_ref(MESSAGES + reverse[i]));
+			failed++;
+		}
+	}
+
+	/* release with messages that wait for their reports, they must be reported as failed */
+	held_count = 0;
+	for (i = 0; i < 2; i++) {
+		msg_text(MESSAGES + 3 + i, text);
+		sms_deliver(sc, "4948416068", SMS_TYPE_INTERNATIONAL, SMS_PLAN_ISDN_TEL, 851430904, 0, text);
+	}
+	while (held_count < 2 && air_time < TIMEOUT)
+		step();
+	expect_error = 1;
+	dms_reset(sc);
+	sms_reset(sc);
+	expect_error = 0;
+	printf("release with queued messages: %d of 2 reported as failed\n", reported - MESSAGES - 3);
+	if (reported != MESSAGES + 5 || sc->sms.stat.undelivered != 2) {
+		printf("Queued messages were not reported on release!\n");
+		rc = 1;
+	}
+	if (sc->sms.stat.delivered != MESSAGES + 3 || sc->sms.stat.queue_depth_max == 0) {
+		printf("Statistics were not kept on release!\n");
+		rc = 1;
+	}
+
+	if (failed) {
+		printf("%d messages or reports did not match!\n", failed);
+		rc = 1;
+	}
+
+	free_nmt(sc);
+	free_nmt(ms);
+
+	return rc;
+}
+
+void call_down_clock(void) {}
+
+const char *aaimage[] = { NULL };
@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include "../libsample/sample.h"
+#include "../liblogging/logging.h"
+#include "../libsound/sound.h"
+
+/*
+ * Stream audio through an ALSA device with mmap access and with
+ * snd_pcm_readi()/snd_pcm_writei(), and compare CPU time per second of audio.
+ * The 'null' device (default) consumes and delivers samples as fast as they
+ * are processed, so only the CPU time is measured. A real device (e.g.
+ * 'hw:Loopback,0') runs at the sample rate, so the lowest buffer size that
+ * streams without xrun is measured also.
+ */
+
+#define SAMPLERATE	48000
+#define SECONDS		20		/* seconds of audio to stream through unpaced device */
+#define PACED_SECONDS	2		/* seconds of audio for each latency probe */
+
+static const char *audiodev = "null";
+
+static double get_clock(clockid_t id)
+{
+	struct timespec ts;
+
+	clock_gettime(id, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+struct result {
+	double		cpu;		/* CPU seconds per second of audio */
+	double		real;		/* real seconds per second of audio */
+	int		xruns;
+};
+
+/* stream the given duration of audio, return -1 if device cannot be opened, -2 if it stalls */
+static int run(struct result *res, int mmap, int buffer_size, double seconds)
+{
+	sample_t buff[2][buffer_size], *samples[2] = { buff[0], buff[1] };
+	uint8_t power[buffer_size], *powers[2] = { power, power };
+	struct pollfd fds[8];
+	double cpu, real;
+	long long written = 0, read = 0, total = seconds * SAMPLERATE;
+	void *sound;
+	int nfds, generation, rc, i;
+
+	setenv("ALSA_MMAP", (mmap) ? "1" : "0", 1);
+	sound = sound_open(SOUND_DIR_DUPLEX, audiodev, NULL, NULL, NULL, 1, 0.0, SAMPLERATE, buffer_size, 1.0, 1.0, 1.0, 1.0);
+	if (!sound)
+		return -1;
+	generation = sound_poll_generation(sound);
+	nfds = sound_get_poll_fds(sound, fds, 8);
+	sound_start(sound);
+
+	for (i = 0; i < buffer_size; i++) {
+		buff[0][i] = (double)((i * 7919) % 60000 - 30000) / 32767.0;
+		power[i] = 1;
+	}
+
+	memset(res, 0, sizeof(*res));
+	cpu = get_clock(CLOCK_PROCESS_CPUTIME_ID);
+	real = get_clock(CLOCK_MONOTONIC);
+	while (written < total || read < total) {
+		rc = sound_get_tosend(sound, buffer_size);
+		if (rc > 0)
+			rc = sound_write(sound, samples, powers, rc, NULL, NULL, 1);
+		if (rc == -EPIPE)
+			res->xruns++;
+		else if (rc > 0)
+			written += rc;
+		rc = sound_read(sound, samples, buffer_size, 1, NULL);
+		if (rc == -EPIPE)
+			res->xruns++;
+		else if (rc > 0)
+			read += rc;
+		/* device was opened again after xrun */
+		if (sound_poll_generation(sound) != generation) {
+			generation = sound_poll_generation(sound);
+			nfds = sound_get_poll_fds(sound, fds, 8);
+		}
+		/* wait for the next period, if nothing was received */
+		if (rc == 0 && nfds > 0) {
+			poll(fds, nfds, 100);
+			if (sound_poll_revents(sound, fds, nfds) < 0)
+				res->xruns++;
+		}
+		/* device does not deliver or consume samples */
+		if (get_clock(CLOCK_MONOTONIC) - real > seconds * 3 + 5) {
+			printf("Device stalls after %lld samples written and %lld samples read!\n", written, read);
+			sound_close(sound);
+			return -2;
+		}
+	}
+	res->cpu = (get_clock(CLOCK_PROCESS_CPUTIME_ID) - cpu) / seconds;
+	res->real = (get_clock(CLOCK_MONOTONIC) - real) / seconds;
+
+	sound_close(sound);
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	int buffer_ms[] = { 1, 2, 5, 10, 20, 50 };
+	struct result res;
+	int mmap, i, rc;
+
+	loglevel = LOGL_ERROR;
+
+	if (argc > 1)
+		audiodev = argv[1];
+
+	printf("Device '%s', %d Hz:\n\n", audiodev, SAMPLERATE);
+	for (mmap = 1; mmap >= 0; mmap--) {
+		rc = run(&res, mmap, SAMPLERATE / 100, SECONDS);
+		if (rc == -1) {
+			printf("Cannot open device '%s', skipping test.\n", audiodev);
+			return 0;
+		}
+		if (rc < 0)
+			return 1;
+		printf("%-12s %8.3f ms CPU per second of audio\n", (mmap) ? "mmap:" : "readi/writei:", res.cpu * 1000.0);
+	}
+
+	/* a device that is not paced has no latency */
+	if (res.real < 0.5)
+		return 0;
+
+	printf("\nLowest buffer size without xrun:\n");
+	for (mmap = 1; mmap >= 0; mmap--) {
+		for (i = 0; i < (int)(sizeof(buffer_ms) / sizeof(buffer_ms[0])); i++) {
+			if (run(&res, mmap, SAMPLERATE * buffer_ms[i] / 1000, PACED_SECONDS) < 0)
+				return 1;
+			if (!res.xruns)
+				break;
+		}
+		if (i == (int)(sizeof(buffer_ms) / sizeof(buffer_ms[0])))
+			printf("%-12s xruns with all buffer sizes\n", (mmap) ? "mmap:" : "readi/writei:");
+		else
+			printf("%-12s %d ms\n", (mmap) ? "mmap:" : "readi/writei:", buffer_ms[i]);
+	}
+
+	return 0;
+}
@@ -0,0 +1,294 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <sys/time.h>
+#include <osmocom/core/timer.h>
+#include "../libmobile/get_time.h"
+#include "../libmobile/timer_wheel.h"
+
+#define INTERVAL	0.010	/* DSP interval of the main loop */
+
+#define NUM_ORDER	2000
+#define NUM_BENCH	100000
+#define BENCH_SECONDS	120	/* simulated time */
+#define BENCH_REARM	500	/* timers re-armed by traffic in each interval */
+#define BENCH_DELAY	300000	/* maximum delay in milliseconds */
+
+static uint32_t rand_state = 1;
+
+static uint32_t rnd(uint32_t max)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (rand_state >> 8) % max;
+}
+
+/*
+ * correctness
+ */
+
+struct test_timer {
+	wheel_timer_t	timer;
+	double		scheduled;	/* time when scheduled */
+	int		delay_ms;	/* delay in milliseconds */
+	int		fired;
+	int		rearm;		/* schedule again from callback */
+};
+
+static double now;
+static int errors;
+static int fired_total;
+
+static void test_schedule(struct test_timer *t, int delay_ms)
+{
+	t->scheduled = now;
+	t->delay_ms = delay_ms;
+	wheel_timer_schedule(&t->timer, delay_ms / 1000, (delay_ms % 1000) * 1000);
+}
+
+static void test_cb(void *data)
+{
+	struct test_timer *t = data;
+	double expiry = t->scheduled + (double)t->delay_ms / 1000.0;
+
+	/* the wheel may round down by one tick, it may fire one interval late */
+	if (now < expiry - 0.0011 || now > expiry + INTERVAL + 0.0011) {
+		printf("Timer with delay %d ms fired at %.3f, expecting %.3f!\n", t->delay_ms, now, expiry);
+		errors++;
+	}
+	if (wheel_timer_pending(&t->timer)) {
+		printf("Timer is still pending in its callback!\n");
+		errors++;
+	}
+	t->fired++;
+	fired_total++;
+	if (t->rearm) {
+		t->rearm--;
+		test_schedule(t, 1 + rnd(70000));
+	}
+}
+
+static void run_until(double end)
+{
+	while (now < end) {
+		now += INTERVAL;
+		timer_wheel_work(now);
+	}
+}
+
+static int test_order(void)
+{
+	static struct test_timer t[NUM_ORDER];
+	int i, expect = 0;
+
+	timer_wheel_init(now);
+	memset(t, 0, sizeof(t));
+	for (i = 0; i < NUM_ORDER; i++) {
+		wheel_timer_setup(&t[i].timer, test_cb, &t[i]);
+		/* delays up to 100 seconds cross the boundaries of level 0, 1 and 2 */
+		test_schedule(&t[i], 1 + rnd(100000));
+		/* every fourth timer is scheduled again from its callback */
+		if ((i & 3) == 1)
+			t[i].rearm = 2;
+	}
+	/* re-scheduling a pending timer must not count it twice */
+	for (i = 0; i < NUM_ORDER; i += 8)
+		test_schedule(&t[i], 1 + rnd(100000));
+	/* cancel every fourth timer, deleting twice must do no harm */
+	for (i = 2; i < NUM_ORDER; i += 4) {
+		wheel_timer_del(&t[i].timer);
+		wheel_timer_del(&t[i].timer);
+	}
+	if (timer_wheel_count() != NUM_ORDER * 3 / 4) {
+		printf("%d timers scheduled, expecting %d!\n", timer_wheel_count(), NUM_ORDER * 3 / 4);
+		return -1;
+	}
+
+	run_until(now + 250.0);
+
+	for (i = 0; i < NUM_ORDER; i++) {
+		expect = ((i & 3) == 2) ? 0 : (((i & 3) == 1) ? 3 : 1);
+		if (t[i].fired != expect) {
+			printf("Timer %d fired %d times, expecting %d!\n", i, t[i].fired, expect);
+			return -1;
+		}
+	}
+	if (timer_wheel_count()) {
+		printf("%d timers left in wheel!\n", timer_wheel_count());
+		return -1;
+	}
+	if (errors)
+		return -1;
+
+	printf("%d timers fired in order, cancelled timers did not fire.\n", fired_total);
+	return 0;
+}
+
+/* a timer of some hours is stored in the top level and cascades down three times */
+static int test_long(void)
+{
+	struct test_timer t;
+
+	memset(&t, 0, sizeof(t));
+	wheel_timer_setup(&t.timer, test_cb, &t);
+	test_schedule(&t, 5 * 3600 * 1000 + 123);
+	run_until(now + 5 * 3600 - 1.0);
+	if (t.fired) {
+		printf("Long timer fired too early!\n");
+		return -1;
+	}
+	run_until(now + 2.0);
+	if (t.fired != 1 || errors) {
+		printf("Long timer did not fire!\n");
+		return -1;
+	}
+
+	printf("Timer of 5 hours fired in time.\n");
+	return 0;
+}
+
+/*
+ * benchmark
+ */
+
+static int bench_delay(int *microseconds)
+{
+	int delay_ms = 1 + rnd(BENCH_DELAY);
+
+	*microseconds = (delay_ms % 1000) * 1000;
+	return delay_ms / 1000;
+}
+
+static wheel_timer_t *wheel_bench;
+static struct osmo_timer_list *osmo_bench;
+static int bench_expired;
+
+static void wheel_bench_cb(void *data)
+{
+	wheel_timer_t *timer = data;
+	int seconds, microseconds;
+
+	bench_expired++;
+	seconds = bench_delay(&microseconds);
+	wheel_timer_schedule(timer, seconds, microseconds);
+}
+
+static void osmo_bench_cb(void *data)
+{
+	struct osmo_timer_list *timer = data;
+	int seconds, microseconds;
+
+	bench_expired++;
+	seconds = bench_delay(&microseconds);
+	osmo_timer_schedule(timer, seconds, microseconds);
+}
+
+static double bench_wheel(void)
+{
+	double start, duration;
+	int seconds, microseconds;
+	int i, j;
+
+	wheel_bench = calloc(NUM_BENCH, sizeof(*wheel_bench));
+	if (!wheel_bench) {
+		printf("No mem!\n");
+		exit(1);
+	}
+	rand_state = 1;
+	bench_expired = 0;
+	timer_wheel_init(now);
+	for (i = 0; i < NUM_BENCH; i++) {
+		wheel_timer_setup(&wheel_bench[i], wheel_bench_cb, &wheel_bench[i]);
+		seconds = bench_delay(&microseconds);
+		wheel_timer_schedule(&wheel_bench[i], seconds, microseconds);
+	}
+
+	start = get_time();
+	for (i = 0; i < (int)(BENCH_SECONDS / INTERVAL); i++) {
+		for (j = 0; j < BENCH_REARM; j++) {
+			seconds = bench_delay(&microseconds);
+			wheel_timer_schedule(&wheel_bench[rnd(NUM_BENCH)], seconds, microseconds);
+		}
+		now += INTERVAL;
+		timer_wheel_work(now);
+	}
+	duration = get_time() - start;
+
+	for (i = 0; i < NUM_BENCH; i++)
+		wheel_timer_del(&wheel_bench[i]);
+	free(wheel_bench);
+
+	return duration;
+}
+
+static double bench_osmo(void)
+{
+	double start, duration;
+	int seconds, microseconds;
+	int i, j;
+
+	osmo_bench = calloc(NUM_BENCH, sizeof(*osmo_bench));
+	if (!osmo_bench) {
+		printf("No mem!\n");
+		exit(1);
+	}
+	rand_state = 1;
+	bench_expired = 0;
+	/* osmo timers use the same simulated time */
+	osmo_gettimeofday_override = true;
+	osmo_gettimeofday_override_time.tv_sec = 1000000;
+	osmo_gettimeofday_override_time.tv_usec = 0;
+	for (i = 0; i < NUM_BENCH; i++) {
+		osmo_timer_setup(&osmo_bench[i], osmo_bench_cb, &osmo_bench[i]);
+		seconds = bench_delay(&microseconds);
+		osmo_timer_schedule(&osmo_bench[i], seconds, microseconds);
+	}
+
+	start = get_time();
+	for (i = 0; i < (int)(BENCH_SECONDS / INTERVAL); i++) {
+		for (j = 0; j < BENCH_REARM; j++) {
+			seconds = bench_delay(&microseconds);
+			osmo_timer_schedule(&osmo_bench[rnd(NUM_BENCH)], seconds, microseconds);
+		}
+		osmo_gettimeofday_override_add(0, INTERVAL * 1000000);
+		osmo_timers_update();
+	}
+	duration = get_time() - start;
+
+	for (i = 0; i < NUM_BENCH; i++)
+		osmo_timer_del(&osmo_bench[i]);
+	free(osmo_bench);
+	osmo_gettimeofday_override = false;
+
+	return duration;
+}
+
+static void benchmark(void)
+{
+	int intervals = (int)(BENCH_SECONDS / INTERVAL);
+	double duration;
+	int expired;
+
+	printf("%d timers, %d re-armed every %.0f ms, %d seconds simulated:\n", NUM_BENCH, BENCH_REARM, INTERVAL * 1000.0, BENCH_SECONDS);
+
+	duration = bench_wheel();
+	expired = bench_expired;
+	printf("timer wheel: %.2f us per interval, %d expired, %d bytes per timer + %d bytes of wheel\n", duration / intervals * 1e6, expired, (int)sizeof(wheel_timer_t), (int)(sizeof(wheel_timer_t *) * 4 * 256));
+
+	duration = bench_osmo();
+	expired = bench_expired;
+	printf("osmo timer:  %.2f us per interval, %d expired, %d bytes per timer\n", duration / intervals * 1e6, expired, (int)sizeof(struct osmo_timer_list));
+}
+
+int main(void)
+{
+	if (test_order())
+		return 1;
+	if (test_long())
+		return 1;
+
+	benchmark();
+
+	return 0;
+}
@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "../libsample/sample.h"
+#include "../libfilter/iir_filter.h"
+#include "../tv/bas.h"
+#include "../tv/live.h"
+
+#define Y4M_FILE	"test_tv_live.y4m"
+#define WIDTH		320
+#define HEIGHT		240
+#define FRAMES		50
+#define SAMPLERATE	10000010.0	/* not a multiple of the frame rate */
+#define BLACK_LEVEL	0.32
+#define WHITE_LEVEL	1.0
+#define MAX_DEVIATION	0.0001	/* from rendering line by line */
+
+/* every frame has a different gray level, so it can be identified */
+static int frame_luma(int frame)
+{
+	return 32 + frame * 3;
+}
+
+static int write_clip(void)
+{
+	static uint8_t plane[WIDTH * HEIGHT];
+	FILE *fp;
+	int f;
+
+	fp = fopen(Y4M_FILE, "w");
+	if (!fp) {
+		printf("Failed to create '%s'!\n", Y4M_FILE);
+		return -1;
+	}
+	fprintf(fp, "YUV4MPEG2 W%d H%d F25:1 Ip A1:1 C420jpeg\n", WIDTH, HEIGHT);
+	for (f = 0; f < FRAMES; f++) {
+		fprintf(fp, "FRAME\n");
+		memset(plane, frame_luma(f), WIDTH * HEIGHT);
+		fwrite(plane, WIDTH * HEIGHT, 1, fp);
+		memset(plane, 128, WIDTH * HEIGHT / 2);
+		fwrite(plane, WIDTH * HEIGHT / 2, 1, fp);
+	}
+	fclose(fp);
+
+	return 0;
+}
+
+/* get frame number from the level in the middle of line 100 */
+static int decode_frame(sample_t *sample)
+{
+	double level = 0.0, luma;
+	int start = (int)((100.0 * 64e-6 + 30e-6) * SAMPLERATE);
+	int i;
+
+	for (i = 0; i < 100; i++)
+		level += sample[start + i];
+	level /= 100.0;
+	luma = (level - BLACK_LEVEL) / (WHITE_LEVEL - BLACK_LEVEL) * 219.0 + 16.0;
+
+	return (int)floor((luma - 32.0) / 3.0 + 0.5);
+}
+
+/* render frame line by line with one filter, the way bas_generate() does */
+static int render_reference(bas_t *bas, unsigned short *img, int frame, sample_t *sample)
+{
+	double value = ((double)frame_luma(frame) - 16.0) / 219.0 * 65535.0;
+	int i;
+
+	for (i = 0; i < WIDTH * LIVE_LINES * 3; i++)
+		img[i] = value;
+
+	return bas_generate(bas, sample);
+}
+
+/* the reference slows down the modulator, so the throughput is not shown */
+static int run(int workers, uint32_t *checksum, int reference)
+{
+	live_t live;
+	bas_t ref;
+	unsigned short *img = NULL;
+	sample_t *sample, *ref_sample = NULL;
+	struct timeval start_tv, tv;
+	double duration, exact, deviation, max_deviation = 0.0;
+	int64_t total = 0;
+	int count, frame, last = -1, n = 0, repeated = 0, i;
+
+	img = calloc(WIDTH * LIVE_LINES * 3, sizeof(*img));
+	ref_sample = calloc(SAMPLERATE / 25.0 + 10.0, sizeof(*ref_sample));
+	if (!img || !ref_sample)
+		return -1;
+	bas_init(&ref, SAMPLERATE, BAS_IMAGE, 1, 0.0, 0, 0, NULL, 0, img, WIDTH, LIVE_LINES);
+
+	gettimeofday(&start_tv, NULL);
+	if (live_init(&live, Y4M_FILE, SAMPLERATE, 1, workers))
+		return -1;
+	while (live_get_frame(&live, &sample, &count, 1) > 0) {
+		/* every frame has the duration of a frame period */
+		n++;
+		total += count;
+		exact = (double)n * SAMPLERATE / 25.0;
+		if (count < (int)floor(SAMPLERATE / 25.0) || count > (int)ceil(SAMPLERATE / 25.0) || fabs((double)total - exact) > 1.0) {
+			printf("Frame %d has %d samples, total %lld samples, expecting %.1f!\n", n, count, (long long)total, exact);
+			goto error;
+		}
+		/* frames are in order and none is dropped */
+		frame = decode_frame(sample);
+		if (frame == last)
+			repeated++;
+		else if (frame != last + 1) {
+			printf("Frame %d follows frame %d!\n", frame, last);
+			goto error;
+		}
+		last = frame;
+		if (checksum && n <= FRAMES) {
+			for (i = 0; i < count; i++)
+				checksum[n - 1] = checksum[n - 1] * 31 + (uint32_t)(int32_t)(sample[i] * 1e6);
+		}
+		if (!reference)
+			continue;
+		/* batches of lines continue the filters, as if the frame was rendered line by line */
+		if (render_reference(&ref, img, frame, ref_sample) != count) {
+			printf("Frame %d has %d samples, but reference has a different number!\n", n, count);
+			goto error;
+		}
+		for (i = 0; i < count; i++) {
+			deviation = fabs(sample[i] - ref_sample[i]);
+			if (deviation > max_deviation)
+				max_deviation = deviation;
+		}
+	}
+	gettimeofday(&tv, NULL);
+	live_exit(&live);
+	free(img);
+	free(ref_sample);
+	if (last != FRAMES - 1) {
+		printf("Stream ended with frame %d, expecting %d!\n", last, FRAMES - 1);
+		return -1;
+	}
+	if (reference) {
+		printf("%d worker(s): largest deviation from rendering line by line is %.7f\n", workers, max_deviation);
+		if (max_deviation > MAX_DEVIATION) {
+			printf("Lines rendered in batches differ from lines rendered line by line!\n");
+			return -1;
+		}
+		return repeated;
+	}
+	duration = (double)tv.tv_sec + (double)tv.tv_usec / 1e6;
+	duration -= (double)start_tv.tv_sec + (double)start_tv.tv_usec / 1e6;
+	printf("%d worker(s): %d frames (%d repeated) at %.0f Hz in %.3f seconds = %.1f frames/s, %.2f times real time\n", workers, n, repeated, SAMPLERATE, duration, (double)n / duration, (double)n / 25.0 / duration);
+
+	return repeated;
+
+error:
+	live_exit(&live);
+	free(img);
+	free(ref_sample);
+	return -1;
+}
+
+int main(void)
+{
+	static uint32_t checksum[2][FRAMES];
+	int rc1, rc2, f;
+
+	if (write_clip())
+		return 1;
+
+	rc1 = run(1, checksum[0], 0);
+	if (rc1 < 0)
+		return 1;
+	rc2 = run(4, checksum[1], 0);
+	if (rc2 < 0)
+		return 1;
+	if (run(4, NULL, 1) < 0)
+		return 1;
+
+	/* output must not depend on the number of workers, unless frames were repeated */
+	if (!rc1 && !rc2) {
+		for (f = 0; f < FRAMES; f++) {
+			if (checksum[0][f] != checksum[1][f]) {
+				printf("Frame %d differs between one and four workers!\n", f);
+				return 1;
+			}
+		}
+		printf("Output is identical with one and four workers.\n");
+	}
+
+	unlink(Y4M_FILE);
+
+	return 0;
+}
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 #include <math.h>
@@ -68,11 +70,72 @@ void bas_init(bas_t *bas, double samplerate, enum bas_type type, int fbas, doubl
 	bas->img_width = width;
 	bas->img_height = height;
 
+	bas_filter_init(bas, &bas->filter);
+}
+
+/* set filter states as if the previous line ended with porch level */
+static void bas_filter_settle(bas_filter_t *filter)
+{
+	iir_filter_t *lp = &filter->lp_y;
+	int j;
+
+	memset(filter->lp_u.z1, 0, sizeof(filter->lp_u.z1));
+	memset(filter->lp_u.z2, 0, sizeof(filter->lp_u.z2));
+	memset(filter->lp_v.z1, 0, sizeof(filter->lp_v.z1));
+	memset(filter->lp_v.z2, 0, sizeof(filter->lp_v.z2));
+	for (j = 0; j < lp->iter; j++) {
+		lp->z2[j] = PORCH_LEVEL * (lp->a2 - lp->b2);
+		lp->z1[j] = PORCH_LEVEL * (lp->a1 - lp->b1) + lp->z2[j];
+	}
+}
+
+/* init filters of a line renderer */
+void bas_filter_init(bas_t *bas, bas_filter_t *filter)
+{
 	/* filter color signal */
-	iir_lowpass_init(&bas->lp_u, 1300000.0, samplerate, COLOR_FILTER_ITER);
-	iir_lowpass_init(&bas->lp_v, 1300000.0, samplerate, COLOR_FILTER_ITER);
+	iir_lowpass_init(&filter->lp_u, 1300000.0, bas->samplerate, COLOR_FILTER_ITER);
+	iir_lowpass_init(&filter->lp_v, 1300000.0, bas->samplerate, COLOR_FILTER_ITER);
 	/* filter final FBAS, so we prevent from being in the audio carrier spectrum */
-	iir_lowpass_init(&bas->lp_y, 4500000.0, samplerate, COLOR_FILTER_ITER);
+	iir_lowpass_init(&filter->lp_y, 4500000.0, bas->samplerate, COLOR_FILTER_ITER);
+	bas_filter_settle(filter);
+}
+
+/* Get position of all lines of the next frame, return number of samples.
+ * Time and color carrier are continued from the previous frame, so that the
+ * frames have exactly the frame duration on average.
+ */
+int bas_layout(bas_t *bas, bas_line_t *layout)
+{
+	double step = 1.0 / bas->samplerate;
+	double color_step = COLOR_CARRIER / bas->samplerate * 2 * M_PI;
+	int color_offset = (int)(bas->samplerate * COLOR_OFFSET);
+	double x = bas->x;
+	int total_i = 0, i, c, line;
+
+	for (line = 0; line < BAS_LINES; line++) {
+		layout[line].offset = total_i;
+		layout[line].x = x;
+		layout[line].color_phase = bas->color_phase;
+		layout[line].v_polarity = bas->v_polarity;
+		/* step through the line the same way as the renderer does */
+		for (i = 0; x < H_LINE_END; i++)
+			x += step;
+		layout[line].count = i;
+		if (bas->fbas) {
+			bas->color_phase = fmod(bas->color_phase + color_step * (double)color_offset, 2.0 * M_PI);
+			for (c = color_offset; c < i; c++) {
+				bas->color_phase += color_step;
+				if (bas->color_phase >= 2.0 * M_PI)
+					bas->color_phase -= 2.0 * M_PI;
+			}
+		}
+		bas->v_polarity = -bas->v_polarity;
+		x -= H_LINE_END;
+		total_i += i;
+	}
+	bas->x = x;
+
+	return total_i;
 }
 
 static inline double ramp(double x)
@@ -80,11 +143,12 @@ static inline double ramp(double x)
 	return 0.5 - 0.5 * cos(x * M_PI);
 }
 
-int bas_generate(bas_t *bas, sample_t *sample)
+/* render one line, return number of samples */
+static int bas_render_line(bas_t *bas, bas_filter_t *filter, int line, double x, double color_phase, int v_polarity, sample_t *sample)
 {
 	double step = 1.0 / bas->samplerate;
-	int total_i = 0, i, c, line, middlefield_line;
-	double x = 0, render_start, render_end;
+	int i, c, middlefield_line;
+	double render_start, render_end;
 	int have_image;
 	sample_t color_u[(int)(bas->samplerate / 15625.0) + 10];
 	sample_t color_v[(int)(bas->samplerate / 15625.0) + 10];
@@ -94,214 +158,240 @@ int bas_generate(bas_t *bas, sample_t *sample)
 // additianlly we compensate the delay caused by the color filter, that is 2 samples per iteration */
 	int color_offset = (int)(bas->samplerate * COLOR_OFFSET); // + 2 * COLOR_FILTER_ITER;
 
-	for (line = 0; line < 625; line++) {
-		/* reset color */
-		memset(color_u, 0, sizeof(color_u));
-		memset(color_v, 0, sizeof(color_v));
+	/* reset color */
+	memset(color_u, 0, sizeof(color_u));
+	memset(color_v, 0, sizeof(color_v));
 
-		/* render image interlaced */
-		have_image = 1;
+	/* render image interlaced */
+	have_image = 1;
 /* switch off to have black image */
 #if 1
-		if (line >= 24-1 && line <= 310-1)
-			middlefield_line = (line - (24-1)) * 2 + 1;
-		else if (line >= 336-1 && line <= 622-1)
-			middlefield_line = (line - (336-1)) * 2;
-		else
-			have_image = 0;
-		if (have_image) {
-			switch (bas->type) {
-			case BAS_FUBK:
-				/* render FUBK test image */
-				fubk_gen_line(sample, x, bas->samplerate, color_u, color_v, bas->v_polarity, H_LINE_START, H_LINE_END, middlefield_line, bas->circle_radius, bas->color_bar, bas->grid_only, bas->station_id);
-				break;
-			case BAS_CONVERGENCE:
-				/* render color convergence test image */
-				convergence_gen_line(sample, x, bas->samplerate, H_LINE_START, H_LINE_END, middlefield_line, (bas->grid_width) > 1 ? 1.0: 0.5);
-				break;
-			case BAS_BLACK:
-			case BAS_BLUE:
-			case BAS_RED:
-			case BAS_MAGENTA:
-			case BAS_GREEN:
-			case BAS_CYAN:
-			case BAS_YELLOW:
-			case BAS_WHITE:
-				/* single color test image */
-				color_gen_line(sample, x, bas->samplerate, color_u, color_v, bas->v_polarity, H_LINE_START, H_LINE_END, bas->type);
-				break;
-			case BAS_EBU:
-				/* EBU test image */
-				ebu_gen_line(sample, x, bas->samplerate, color_u, color_v, bas->v_polarity, H_LINE_START, H_LINE_END);
-				break;
-			case BAS_IMAGE: {
-				/* 574 lines of image are to be rendered */
-				int img_line = middlefield_line - (574 - bas->img_height) / 2;
-				if (img_line >= 0 && img_line < bas->img_height) {
-					/* render image data */
-					image_gen_line(sample, x, bas->samplerate, color_u, color_v, bas->v_polarity, H_LINE_START, H_LINE_END, bas->img + bas->img_width * img_line * 3, bas->img_width);
-				}
-			    }
-			    	break;
-			case BAS_VCR:
-				/* render VCR test image */
-				vcr_gen_line(sample, x, bas->samplerate, color_u, color_v, bas->v_polarity, H_LINE_START, H_LINE_END, middlefield_line / 2);
-				break;
+	if (line >= 24-1 && line <= 310-1)
+		middlefield_line = (line - (24-1)) * 2 + 1;
+	else if (line >= 336-1 && line <= 622-1)
+		middlefield_line = (line - (336-1)) * 2;
+	else
+		have_image = 0;
+	if (have_image) {
+		switch (bas->type) {
+		case BAS_FUBK:
+			/* render FUBK test image */
+			fubk_gen_line(sample, x, bas->samplerate, color_u, color_v, v_polarity, H_LINE_START, H_LINE_END, middlefield_line, bas->circle_radius, bas->color_bar, bas->grid_only, bas->station_id);
+			break;
+		case BAS_CONVERGENCE:
+			/* render color convergence test image */
+			convergence_gen_line(sample, x, bas->samplerate, H_LINE_START, H_LINE_END, middlefield_line, (bas->grid_width) > 1 ? 1.0: 0.5);
+			break;
+		case BAS_BLACK:
+		case BAS_BLUE:
+		case BAS_RED:
+		case BAS_MAGENTA:
+		case BAS_GREEN:
+		case BAS_CYAN:
+		case BAS_YELLOW:
+		case BAS_WHITE:
+			/* single color test image */
+			color_gen_line(sample, x, bas->samplerate, color_u, color_v, v_polarity, H_LINE_START, H_LINE_END, bas->type);
+			break;
+		case BAS_EBU:
+			/* EBU test image */
+			ebu_gen_line(sample, x, bas->samplerate, color_u, color_v, v_polarity, H_LINE_START, H_LINE_END);
+			break;
+		case BAS_IMAGE: {
+			/* 574 lines of image are to be rendered */
+			int img_line = middlefield_line - (574 - bas->img_height) / 2;
+			if (img_line >= 0 && img_line < bas->img_height) {
+				/* render image data */
+				image_gen_line(sample, x, bas->samplerate, color_u, color_v, v_polarity, H_LINE_START, H_LINE_END, bas->img + bas->img_width * img_line * 3, bas->img_width);
 			}
+		    }
+		    	break;
+		case BAS_VCR:
+			/* render VCR test image */
+			vcr_gen_line(sample, x, bas->samplerate, color_u, color_v, v_polarity, H_LINE_START, H_LINE_END, middlefield_line / 2);
+			break;
 		}
+	}
 #endif
 
-		i = 0;
+	i = 0;
 
-		/* porch before sync */
-		render_start = H_SYNC_START - SYNC_RAMP / 2;
+	/* porch before sync */
+	render_start = H_SYNC_START - SYNC_RAMP / 2;
+	while (x < render_start) {
+		sample[i++] = PORCH_LEVEL;
+		x += step;
+	}
+	/* ramp to sync level */
+	render_end = render_start + SYNC_RAMP;
+	while (x < render_end) {
+		sample[i++] = ramp((x - render_start) / SYNC_RAMP) * (SYNC_LEVEL - PORCH_LEVEL) + PORCH_LEVEL;
+		x += step;
+	}
+	/* sync (long sync for vertical blank) */
+	if (line <= 3-1 || line == 314-1 || line == 315-1)
+		render_start = V_SYNC_STOP - SYNC_RAMP / 2;
+	else
+		render_start = H_SYNC_STOP - SYNC_RAMP / 2;
+	while (x < render_start) {
+		sample[i++] = SYNC_LEVEL;
+		x += step;
+	}
+	/* ramp to porch level */
+	render_end = render_start + SYNC_RAMP;
+	while (x < render_end) {
+		sample[i++] = ramp((x - render_start) / SYNC_RAMP) * (PORCH_LEVEL - SYNC_LEVEL) + SYNC_LEVEL;
+		x += step;
+	}
+	if (have_image) {
+		/* porch after sync, before color burst */
+		render_start = H_CBURST_START;
+		while (x < render_start) {
+			sample[i++] = PORCH_LEVEL;
+			x += step;
+		}
+		/* porch after sync, color burst */
+		render_start = H_CBURST_STOP;
+		while (x < render_start) {
+			/* shift color burst to the right, it is shifted back when modulating */
+			color_u[i+color_offset] = -0.5 * BURST_AMPLITUDE; /* - 180 degrees */
+			color_v[i+color_offset] = 0.5 * BURST_AMPLITUDE * (double)v_polarity; /* +- 90 degrees */
+			sample[i++] = PORCH_LEVEL;
+			x += step;
+		}
+		/* porch after sync, after color burst */
+		render_start = H_LINE_START;
 		while (x < render_start) {
 			sample[i++] = PORCH_LEVEL;
 			x += step;
 		}
-		/* ramp to sync level */
-		render_end = render_start + SYNC_RAMP;
+		/* ramp to image */
+		render_end = render_start + IMAGE_RAMP;
 		while (x < render_end) {
-			sample[i++] = ramp((x - render_start) / SYNC_RAMP) * (SYNC_LEVEL - PORCH_LEVEL) + PORCH_LEVEL;
+			/* scale level of image to range of BAS signal */
+			sample[i] = sample[i] * (WHITE_LEVEL - BLACK_LEVEL) + BLACK_LEVEL;
+			/* ramp from porch level to image level */
+			sample[i] = ramp((x - render_start) / IMAGE_RAMP) * (sample[i] - PORCH_LEVEL) + PORCH_LEVEL;
+			i++;
 			x += step;
 		}
-		/* sync (long sync for vertical blank) */
-		if (line <= 3-1 || line == 314-1 || line == 315-1)
-			render_start = V_SYNC_STOP - SYNC_RAMP / 2;
-		else
-			render_start = H_SYNC_STOP - SYNC_RAMP / 2;
+		/* image */
+		render_start = H_LINE_END - IMAGE_RAMP;
 		while (x < render_start) {
-			sample[i++] = SYNC_LEVEL;
+			/* scale level of image to range of BAS signal */
+			sample[i] = sample[i] * (WHITE_LEVEL - BLACK_LEVEL) + BLACK_LEVEL;
+			i++;
 			x += step;
 		}
 		/* ramp to porch level */
-		render_end = render_start + SYNC_RAMP;
+		render_end = H_LINE_END;
 		while (x < render_end) {
-			sample[i++] = ramp((x - render_start) / SYNC_RAMP) * (PORCH_LEVEL - SYNC_LEVEL) + SYNC_LEVEL;
+			/* scale level of image to range of BAS signal */
+			sample[i] = sample[i] * (WHITE_LEVEL - BLACK_LEVEL) + BLACK_LEVEL;
+			/* ramp from image level to porch level */
+			sample[i] = ramp((x - render_start) / IMAGE_RAMP) * (PORCH_LEVEL - sample[i]) + sample[i];
+			i++;
 			x += step;
 		}
-		if (have_image) {
-			/* porch after sync, before color burst */
-			render_start = H_CBURST_START;
+	} else {
+		/* draw porch to second sync */
+		if (line <= 5-1 || (line >= 311-1 && line <= 317-1) || line >= 623-1) {
+			/* porch before sync */
+			render_start = H_SYNC2_START - SYNC_RAMP / 2;
 			while (x < render_start) {
 				sample[i++] = PORCH_LEVEL;
 				x += step;
 			}
-			/* porch after sync, color burst */
-			render_start = H_CBURST_STOP;
-			while (x < render_start) {
-				/* shift color burst to the right, it is shifted back when modulating */
-				color_u[i+color_offset] = -0.5 * BURST_AMPLITUDE; /* - 180 degrees */
-				color_v[i+color_offset] = 0.5 * BURST_AMPLITUDE * (double)bas->v_polarity; /* +- 90 degrees */
-				sample[i++] = PORCH_LEVEL;
-				x += step;
-			}
-			/* porch after sync, after color burst */
-			render_start = H_LINE_START;
-			while (x < render_start) {
-				sample[i++] = PORCH_LEVEL;
-				x += step;
-			}
-			/* ramp to image */
-			render_end = render_start + IMAGE_RAMP;
+			/* ramp to sync level */
+			render_end = render_start + SYNC_RAMP;
 			while (x < render_end) {
-				/* scale level of image to range of BAS signal */
-				sample[i] = sample[i] * (WHITE_LEVEL - BLACK_LEVEL) + BLACK_LEVEL;
-				/* ramp from porch level to image level */
-				sample[i] = ramp((x - render_start) / IMAGE_RAMP) * (sample[i] - PORCH_LEVEL) + PORCH_LEVEL;
-				i++;
+				sample[i++] = ramp((x - render_start) / SYNC_RAMP) * (SYNC_LEVEL - PORCH_LEVEL) + PORCH_LEVEL;
 				x += step;
 			}
-			/* image */
-			render_start = H_LINE_END - IMAGE_RAMP;
+			/* sync (long sync for vertical blank) */
+			if (line <= 2-1 || line == 313-1 || line == 314-1 || line == 315-1)
+				render_start = V_SYNC2_STOP - SYNC_RAMP / 2;
+			else
+				render_start = H_SYNC2_STOP - SYNC_RAMP / 2;
 			while (x < render_start) {
-				/* scale level of image to range of BAS signal */
-				sample[i] = sample[i] * (WHITE_LEVEL - BLACK_LEVEL) + BLACK_LEVEL;
-				i++;
+				sample[i++] = SYNC_LEVEL;
 				x += step;
 			}
 			/* ramp to porch level */
-			render_end = H_LINE_END;
-			while (x < render_end) {
-				/* scale level of image to range of BAS signal */
-				sample[i] = sample[i] * (WHITE_LEVEL - BLACK_LEVEL) + BLACK_LEVEL;
-				/* ramp from image level to porch level */
-				sample[i] = ramp((x - render_start) / IMAGE_RAMP) * (PORCH_LEVEL - sample[i]) + sample[i];
-				i++;
-				x += step;
-			}
-		} else {
-			/* draw porch to second sync */
-			if (line <= 5-1 || (line >= 311-1 && line <= 317-1) || line >= 623-1) {
-				/* porch before sync */
-				render_start = H_SYNC2_START - SYNC_RAMP / 2;
-				while (x < render_start) {
-					sample[i++] = PORCH_LEVEL;
-					x += step;
-				}
-				/* ramp to sync level */
-				render_end = render_start + SYNC_RAMP;
-				while (x < render_end) {
-					sample[i++] = ramp((x - render_start) / SYNC_RAMP) * (SYNC_LEVEL - PORCH_LEVEL) + PORCH_LEVEL;
-					x += step;
-				}
-				/* sync (long sync for vertical blank) */
-				if (line <= 2-1 || line == 313-1 || line == 314-1 || line == 315-1)
-					render_start = V_SYNC2_STOP - SYNC_RAMP / 2;
-				else
-					render_start = H_SYNC2_STOP - SYNC_RAMP / 2;
-				while (x < render_start) {
-					sample[i++] = SYNC_LEVEL;
-					x += step;
-				}
-				/* ramp to porch level */
-				render_end = render_start + SYNC_RAMP;
-				while (x < render_end) {
-					sample[i++] = ramp((x - render_start) / SYNC_RAMP) * (PORCH_LEVEL - SYNC_LEVEL) + SYNC_LEVEL;
-					x += step;
-				}
-			}
-			/* porch to end of line */
-			render_end = H_LINE_END;
+			render_end = render_start + SYNC_RAMP;
 			while (x < render_end) {
-				sample[i++] = PORCH_LEVEL;
+				sample[i++] = ramp((x - render_start) / SYNC_RAMP) * (PORCH_LEVEL - SYNC_LEVEL) + SYNC_LEVEL;
 				x += step;
 			}
 		}
+		/* porch to end of line */
+		render_end = H_LINE_END;
+		while (x < render_end) {
+			sample[i++] = PORCH_LEVEL;
+			x += step;
+		}
+	}
 
-		if (bas->fbas) {
-			/* filter color carrier */
-			iir_process(&bas->lp_u, color_u, i);
-			iir_process(&bas->lp_v, color_v, i);
-
-			/* modulate color to sample */
-			bas->color_phase = fmod(bas->color_phase + color_step * (double)color_offset, 2.0 * M_PI);
-			for (c = color_offset; c < i; c++) {
-				bas->color_phase += color_step;
-				if (bas->color_phase >= 2.0 * M_PI)
-					bas->color_phase -= 2.0 * M_PI;
-				_sin = sin(bas->color_phase);
-				_cos = cos(bas->color_phase);
-				chroma = color_u[c] * _cos - color_v[c] * _sin;
-				/* scale level of chroma to range of BAS signal */
-				sample[c-color_offset] += chroma * (WHITE_LEVEL - BLACK_LEVEL);
-			}
+	if (bas->fbas) {
+		/* filter color carrier */
+		iir_process(&filter->lp_u, color_u, i);
+		iir_process(&filter->lp_v, color_v, i);
 
-			/* filter bas signal */
-			iir_process(&bas->lp_y, sample, i);
+		/* modulate color to sample */
+		color_phase = fmod(color_phase + color_step * (double)color_offset, 2.0 * M_PI);
+		for (c = color_offset; c < i; c++) {
+			color_phase += color_step;
+			if (color_phase >= 2.0 * M_PI)
+				color_phase -= 2.0 * M_PI;
+			_sin = sin(color_phase);
+			_cos = cos(color_phase);
+			chroma = color_u[c] * _cos - color_v[c] * _sin;
+			/* scale level of chroma to range of BAS signal */
+			sample[c-color_offset] += chroma * (WHITE_LEVEL - BLACK_LEVEL);
 		}
 
-		/* flip polarity of V signal */
-		bas->v_polarity = -bas->v_polarity;
+		/* filter bas signal */
+		iir_process(&filter->lp_y, sample, i);
+	}
 
-		/* increment sample buffer to next line */
-		sample += i;
-		/* return x */
-		x -= H_LINE_END;
-		/* sum total i */
-		total_i += i;
+	return i;
+}
+
+/* Render one line of the frame, the given filters are continued.
+ * Different lines may be rendered by different threads at the same time.
+ */
+void bas_generate_line(bas_t *bas, bas_filter_t *filter, const bas_line_t *layout, int line, sample_t *sample)
+{
+	int i;
+
+	sample += layout[line].offset;
+	/* image renderers leave samples untouched outside the image */
+	memset(sample, 0, layout[line].count * sizeof(*sample));
+	i = bas_render_line(bas, filter, line, layout[line].x, layout[line].color_phase, layout[line].v_polarity, sample);
+	if (i != layout[line].count) {
+		fprintf(stderr, "Line %d has %d samples, but layout has %d samples, please fix!\n", line, i, layout[line].count);
+		abort();
 	}
+}
 
-	return total_i;
+/* render a line into a scratch buffer of one line, only to bring the filters
+ * into the state they have at the end of this line */
+void bas_warm_up_line(bas_t *bas, bas_filter_t *filter, const bas_line_t *layout, int line, sample_t *scratch)
+{
+	memset(scratch, 0, layout[line].count * sizeof(*scratch));
+	bas_render_line(bas, filter, line, layout[line].x, layout[line].color_phase, layout[line].v_polarity, scratch);
+}
+
+/* render next frame, return number of samples */
+int bas_generate(bas_t *bas, sample_t *sample)
+{
+	bas_line_t layout[BAS_LINES];
+	int count, line;
+
+	count = bas_layout(bas, layout);
+	for (line = 0; line < BAS_LINES; line++)
+		bas_generate_line(bas, &bas->filter, layout, line, sample);
+
+	return count;
 }
 
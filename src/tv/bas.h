@@ -15,6 +15,22 @@ enum bas_type {
 	BAS_IMAGE,
 };
 
+#define BAS_LINES	625
+
+/* position of a line within a frame, so that lines can be rendered independently */
+typedef struct bas_line {
+	int		offset;			/* first sample of line within frame */
+	int		count;			/* number of samples of line */
+	double		x;			/* time of first sample, relative to line start */
+	double		color_phase;		/* phase of color carrier at line start */
+	int		v_polarity;		/* polarity of V color vector */
+} bas_line_t;
+
+/* filters of line renderer, each rendering thread needs its own */
+typedef struct bas_filter {
+	iir_filter_t	lp_y, lp_u, lp_v;	/* low pass filters */
+} bas_filter_t;
+
 typedef struct bas {
 	double		samplerate;
 	enum bas_type	type;
@@ -24,13 +40,18 @@ typedef struct bas {
 	int		grid_only;		/* show only the grid */
 	const char	*station_id;		/* text to display as station id */
 	int		grid_width;		/* width of the grid (convergence test) */
+	double		x;			/* time of next sample, relative to line start */
 	double		color_phase;		/* current phase of color carrier */
 	int		v_polarity;		/* polarity of V color vector */
 	unsigned short	*img;			/* image data, if it should be used */
 	int		img_width, img_height;	/* size of image */
-	iir_filter_t	lp_y, lp_u, lp_v;	/* low pass filters */
+	bas_filter_t	filter;			/* filters of bas_generate() */
 } bas_t;
 
 void bas_init(bas_t *bas, double samplerate, enum bas_type type, int fbas, double circle_radius, int color_bar, int grid_only, const char *station_id, int grid_width, unsigned short *img, int width, int height);
+void bas_filter_init(bas_t *bas, bas_filter_t *filter);
+int bas_layout(bas_t *bas, bas_line_t *layout);
+void bas_generate_line(bas_t *bas, bas_filter_t *filter, const bas_line_t *layout, int line, sample_t *sample);
+void bas_warm_up_line(bas_t *bas, bas_filter_t *filter, const bas_line_t *layout, int line, sample_t *scratch);
 int bas_generate(bas_t *bas, sample_t *sample);
 
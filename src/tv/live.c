@@ -0,0 +1,488 @@
+/* live video source for the TV transmitter
+ *
+ * (C) 2026 by Andreas Eversberg <jolly@eversberg.eu>
+ * All Rights Reserved
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Frames are read from a Y4M stream by a reader thread and scaled to the
+ * image lines of the raster. A pool of workers renders the BAS lines of a
+ * frame in batches, while the modulator transmits the previous frame from
+ * the other buffer. Each worker renders the line before its batch first, so
+ * its filters are in the same state as if the frame was rendered line by
+ * line. If the input is late, the last image is rendered again. If rendering
+ * is late, the modulator transmits the previous frame again, so the
+ * transmitted signal never stalls. The input is never dropped, so a file is
+ * transmitted frame by frame, even if it is read faster than real time.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include "../libsample/sample.h"
+#include "../libfilter/iir_filter.h"
+#include "bas.h"
+#include "live.h"
+
+#define LIVE_BATCH	16	/* lines rendered by a worker at once */
+#define Y4M_LINE_MAX	4096	/* maximum length of header lines */
+
+/* read header line without newline, return length or -1 on end of stream */
+static int read_line(FILE *fp, char *line, int size)
+{
+	int c, len = 0;
+
+	while ((c = fgetc(fp)) != EOF) {
+		if (c == '\n') {
+			line[len] = '\0';
+			return len;
+		}
+		if (len < size - 1)
+			line[len++] = c;
+	}
+
+	return -1;
+}
+
+static int parse_header(live_t *live, char *line)
+{
+	const char *colorspace = "420";
+	int chroma_width, chroma_height;
+	int rate_num = 0, rate_den = 0;
+	char *token;
+
+	if (strncmp(line, "YUV4MPEG2 ", 10)) {
+		fprintf(stderr, "Input is not a Y4M stream.\n");
+		return -EINVAL;
+	}
+
+	for (token = strtok(line + 10, " "); token; token = strtok(NULL, " ")) {
+		switch (token[0]) {
+		case 'W':
+			live->width = atoi(token + 1);
+			break;
+		case 'H':
+			live->height = atoi(token + 1);
+			break;
+		case 'F':
+			sscanf(token + 1, "%d:%d", &rate_num, &rate_den);
+			break;
+		case 'C':
+			colorspace = token + 1;
+			break;
+		}
+	}
+	if (live->width <= 0 || live->height <= 0) {
+		fprintf(stderr, "Y4M stream has no valid frame size.\n");
+		return -EINVAL;
+	}
+
+	if (!strcmp(colorspace, "420") || !strcmp(colorspace, "420jpeg") || !strcmp(colorspace, "420paldv") || !strcmp(colorspace, "420mpeg2")) {
+		live->shift_x = 1;
+		live->shift_y = 1;
+	} else if (!strcmp(colorspace, "422")) {
+		live->shift_x = 1;
+		live->shift_y = 0;
+	} else if (!strcmp(colorspace, "444")) {
+		live->shift_x = 0;
+		live->shift_y = 0;
+	} else if (!strcmp(colorspace, "mono")) {
+		live->mono = 1;
+	} else {
+		fprintf(stderr, "Y4M color space '%s' is not supported, use 420, 422, 444 or mono with 8 bits.\n", colorspace);
+		return -EINVAL;
+	}
+
+	live->frame_size = live->width * live->height;
+	if (!live->mono) {
+		chroma_width = (live->width + (1 << live->shift_x) - 1) >> live->shift_x;
+		chroma_height = (live->height + (1 << live->shift_y) - 1) >> live->shift_y;
+		live->frame_size += 2 * chroma_width * chroma_height;
+	}
+
+	printf("Y4M stream with %dx%d pixels, color space '%s'.\n", live->width, live->height, colorspace);
+	if (rate_num && rate_den && rate_num != rate_den * 25)
+		printf("Stream has %.2f frames per second, but frames are transmitted at 25 frames per second.\n", (double)rate_num / (double)rate_den);
+
+	return 0;
+}
+
+/* scale frame to the image lines of the raster and convert to RGB */
+static void convert_frame(live_t *live)
+{
+	int width = live->width, height = live->height;
+	int chroma_width = (width + (1 << live->shift_x) - 1) >> live->shift_x;
+	int chroma_height = (height + (1 << live->shift_y) - 1) >> live->shift_y;
+	const uint8_t *y_plane = live->yuv;
+	const uint8_t *u_plane = y_plane + width * height;
+	const uint8_t *v_plane = u_plane + chroma_width * chroma_height;
+	const uint8_t *y_row, *u_row = NULL, *v_row = NULL;
+	unsigned short *dst;
+	int row, src_row, last_row = -1, x;
+	double Y, U = 0.0, V = 0.0, R, G, B;
+
+	for (row = 0; row < LIVE_LINES; row++) {
+		dst = live->img_next + row * width * 3;
+		src_row = row * height / LIVE_LINES;
+		/* scaling up repeats lines */
+		if (src_row == last_row) {
+			memcpy(dst, dst - width * 3, width * 3 * sizeof(*dst));
+			continue;
+		}
+		last_row = src_row;
+		y_row = y_plane + src_row * width;
+		if (!live->mono) {
+			u_row = u_plane + (src_row >> live->shift_y) * chroma_width;
+			v_row = v_plane + (src_row >> live->shift_y) * chroma_width;
+		}
+		for (x = 0; x < width; x++) {
+			/* ITU-R BT.601 with studio range */
+			Y = ((double)y_row[x] - 16.0) / 219.0;
+			if (!live->mono) {
+				U = ((double)u_row[x >> live->shift_x] - 128.0) / 224.0;
+				V = ((double)v_row[x >> live->shift_x] - 128.0) / 224.0;
+			}
+			R = Y + 1.402 * V;
+			G = Y - 0.344136 * U - 0.714136 * V;
+			B = Y + 1.772 * U;
+			if (R < 0.0) R = 0.0; else if (R > 1.0) R = 1.0;
+			if (G < 0.0) G = 0.0; else if (G > 1.0) G = 1.0;
+			if (B < 0.0) B = 0.0; else if (B > 1.0) B = 1.0;
+			*dst++ = R * 65535.0;
+			*dst++ = G * 65535.0;
+			*dst++ = B * 65535.0;
+		}
+	}
+}
+
+/* read next frame, return -1 on end of stream */
+static int read_frame(live_t *live)
+{
+	char line[Y4M_LINE_MAX];
+	int rc;
+
+	/* reading may block, so the thread can be cancelled here */
+	pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+	rc = read_line(live->fp, line, sizeof(line));
+	if (rc >= 0 && strncmp(line, "FRAME", 5)) {
+		fprintf(stderr, "Y4M stream has no valid frame header.\n");
+		rc = -1;
+	}
+	if (rc >= 0 && fread(live->yuv, live->frame_size, 1, live->fp) != 1)
+		rc = -1;
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+	if (rc < 0)
+		return -1;
+
+	convert_frame(live);
+
+	return 0;
+}
+
+static void *reader_child(void *arg)
+{
+	live_t *live = arg;
+	int rc;
+
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+	while (1) {
+		/* img_next belongs to the reader until it is pending */
+		rc = read_frame(live);
+		pthread_mutex_lock(&live->lock);
+		if (rc < 0) {
+			live->eof = 1;
+			pthread_cond_broadcast(&live->work_cond);
+			pthread_mutex_unlock(&live->lock);
+			break;
+		}
+		live->img_pending = 1;
+		live->frames++;
+		pthread_cond_broadcast(&live->work_cond);
+		while (live->img_pending && !live->finish)
+			pthread_cond_wait(&live->reader_cond, &live->lock);
+		if (live->finish) {
+			pthread_mutex_unlock(&live->lock);
+			break;
+		}
+		pthread_mutex_unlock(&live->lock);
+	}
+
+	return NULL;
+}
+
+/* set up next frame for rendering, must be called with lock held */
+static void load_frame(live_t *live)
+{
+	live_buffer_t *buf = &live->buffer[live->load];
+	unsigned short *img;
+
+	if (live->img_pending) {
+		img = live->img_render;
+		live->img_render = live->img_next;
+		live->img_next = img;
+		live->bas.img = live->img_render;
+		live->img_pending = 0;
+		pthread_cond_signal(&live->reader_cond);
+	} else if (live->eof) {
+		buf->state = LIVE_END;
+		live->load ^= 1;
+		pthread_cond_broadcast(&live->done_cond);
+		return;
+	} else
+		live->repeated++;
+
+	buf->count = bas_layout(&live->bas, buf->layout);
+	live->render = live->load;
+	live->load ^= 1;
+	live->next_line = 0;
+	live->lines_done = 0;
+	pthread_cond_broadcast(&live->work_cond);
+}
+
+static void *worker_child(void *arg)
+{
+	live_t *live = arg;
+	bas_filter_t filter;
+	live_buffer_t *buf;
+	sample_t *scratch;
+	int line, n, i;
+
+	/* one line to warm up the filters */
+	scratch = calloc((int)(live->bas.samplerate / 15625.0) + 10, sizeof(*scratch));
+	if (!scratch) {
+		fprintf(stderr, "No mem!\n");
+		abort();
+	}
+
+	pthread_mutex_lock(&live->lock);
+	while (!live->finish) {
+		/* render a batch of lines of the current frame */
+		if (live->render >= 0 && live->next_line < BAS_LINES) {
+			buf = &live->buffer[live->render];
+			line = live->next_line;
+			n = BAS_LINES - line;
+			if (n > LIVE_BATCH)
+				n = LIVE_BATCH;
+			live->next_line += n;
+			pthread_mutex_unlock(&live->lock);
+			/* filters continue from the line before the batch, the first line follows the last line */
+			bas_filter_init(&live->bas, &filter);
+			bas_warm_up_line(&live->bas, &filter, buf->layout, (line + BAS_LINES - 1) % BAS_LINES, scratch);
+			for (i = 0; i < n; i++)
+				bas_generate_line(&live->bas, &filter, buf->layout, line + i, buf->sample);
+			pthread_mutex_lock(&live->lock);
+			live->lines_done += n;
+			if (live->lines_done == BAS_LINES) {
+				buf->state = LIVE_READY;
+				live->render = -1;
+				pthread_cond_broadcast(&live->done_cond);
+				pthread_cond_broadcast(&live->work_cond);
+			}
+			continue;
+		}
+		/* start next frame, but not before there is a first image */
+		if (live->render < 0 && live->buffer[live->load].state == LIVE_EMPTY
+		 && (live->img_pending || live->eof || live->bas.img)) {
+			load_frame(live);
+			continue;
+		}
+		pthread_cond_wait(&live->work_cond, &live->lock);
+	}
+	pthread_mutex_unlock(&live->lock);
+
+	free(scratch);
+
+	return NULL;
+}
+
+/* Open Y4M stream ("-" for stdin) and start reader and rendering workers. */
+int live_init(live_t *live, const char *filename, double samplerate, int fbas, int num_workers)
+{
+	char line[Y4M_LINE_MAX];
+	int img_size, b, rc;
+
+	memset(live, 0, sizeof(*live));
+	live->render = -1;
+	live->current = -1;
+	pthread_mutex_init(&live->lock, NULL);
+	pthread_cond_init(&live->work_cond, NULL);
+	pthread_cond_init(&live->done_cond, NULL);
+	pthread_cond_init(&live->reader_cond, NULL);
+
+	if (!strcmp(filename, "-"))
+		live->fp = stdin;
+	else
+		live->fp = fopen(filename, "r");
+	if (!live->fp) {
+		fprintf(stderr, "Failed to open Y4M file '%s'! (errno %d)\n", filename, errno);
+		rc = -EIO;
+		goto error;
+	}
+	if (read_line(live->fp, line, sizeof(line)) < 0) {
+		fprintf(stderr, "Y4M stream has no header.\n");
+		rc = -EINVAL;
+		goto error;
+	}
+	rc = parse_header(live, line);
+	if (rc < 0)
+		goto error;
+
+	img_size = live->width * LIVE_LINES * 3;
+	live->yuv = malloc(live->frame_size);
+	live->img_next = calloc(img_size, sizeof(*live->img_next));
+	live->img_render = calloc(img_size, sizeof(*live->img_render));
+	if (!live->yuv || !live->img_next || !live->img_render) {
+		fprintf(stderr, "No mem!\n");
+		rc = -ENOMEM;
+		goto error;
+	}
+	/* the image is set when the first frame has been read */
+	bas_init(&live->bas, samplerate, BAS_IMAGE, fbas, 0.0, 0, 0, NULL, 0, NULL, live->width, LIVE_LINES);
+
+	for (b = 0; b < 2; b++) {
+		/* add some samples in case of overflow due to rounding errors */
+		live->buffer[b].sample = calloc(samplerate / 25.0 + 10.0, sizeof(sample_t));
+		if (!live->buffer[b].sample) {
+			fprintf(stderr, "No mem!\n");
+			rc = -ENOMEM;
+			goto error;
+		}
+		live->buffer[b].state = LIVE_EMPTY;
+	}
+
+	if (num_workers < 1)
+		num_workers = 1;
+	live->worker = calloc(num_workers, sizeof(*live->worker));
+	if (!live->worker) {
+		fprintf(stderr, "No mem!\n");
+		rc = -ENOMEM;
+		goto error;
+	}
+	for (live->num_workers = 0; live->num_workers < num_workers; live->num_workers++) {
+		rc = pthread_create(&live->worker[live->num_workers], NULL, worker_child, live);
+		if (rc) {
+			fprintf(stderr, "Failed to create rendering thread! (errno %d)\n", rc);
+			rc = -rc;
+			goto error;
+		}
+	}
+	rc = pthread_create(&live->reader, NULL, reader_child, live);
+	if (rc) {
+		fprintf(stderr, "Failed to create Y4M reader thread! (errno %d)\n", rc);
+		rc = -rc;
+		goto error;
+	}
+	live->reader_started = 1;
+
+	printf("Rendering live video with %d thread(s).\n", live->num_workers);
+
+	return 0;
+
+error:
+	live_exit(live);
+	return rc;
+}
+
+/* Stop threads and free everything. */
+void live_exit(live_t *live)
+{
+	int w, b;
+
+	pthread_mutex_lock(&live->lock);
+	live->finish = 1;
+	pthread_cond_broadcast(&live->work_cond);
+	pthread_cond_broadcast(&live->done_cond);
+	pthread_cond_broadcast(&live->reader_cond);
+	pthread_mutex_unlock(&live->lock);
+
+	if (live->reader_started) {
+		/* the reader may wait for input */
+		pthread_cancel(live->reader);
+		pthread_join(live->reader, NULL);
+		live->reader_started = 0;
+	}
+	for (w = 0; w < live->num_workers; w++)
+		pthread_join(live->worker[w], NULL);
+	live->num_workers = 0;
+	free(live->worker);
+	live->worker = NULL;
+
+	if (live->frames)
+		printf("Live video: %d frames read, %d frames repeated, %d frames late.\n", live->frames, live->repeated, live->late);
+
+	for (b = 0; b < 2; b++) {
+		free(live->buffer[b].sample);
+		live->buffer[b].sample = NULL;
+	}
+	free(live->yuv);
+	live->yuv = NULL;
+	free(live->img_next);
+	live->img_next = NULL;
+	free(live->img_render);
+	live->img_render = NULL;
+	if (live->fp && live->fp != stdin)
+		fclose(live->fp);
+	live->fp = NULL;
+
+	pthread_cond_destroy(&live->work_cond);
+	pthread_cond_destroy(&live->done_cond);
+	pthread_cond_destroy(&live->reader_cond);
+	pthread_mutex_destroy(&live->lock);
+}
+
+/*
+ * Get next frame for the modulator, the previous frame is given back.
+ * Return 1 and the frame, or -1 at end of stream.
+ * If wait is not set and the next frame is not rendered yet, 0 is returned
+ * and the modulator keeps the previous frame.
+ */
+int live_get_frame(live_t *live, sample_t **sample, int *count, int wait)
+{
+	live_buffer_t *buf;
+
+	pthread_mutex_lock(&live->lock);
+	buf = &live->buffer[live->next];
+	if (buf->state == LIVE_EMPTY && !live->finish) {
+		/* the first frame is not late */
+		if (live->current >= 0)
+			live->late++;
+		if (!wait && live->current >= 0) {
+			pthread_mutex_unlock(&live->lock);
+			return 0;
+		}
+	}
+	if (live->current >= 0) {
+		live->buffer[live->current].state = LIVE_EMPTY;
+		live->current = -1;
+		pthread_cond_broadcast(&live->work_cond);
+	}
+	while (buf->state == LIVE_EMPTY && !live->finish)
+		pthread_cond_wait(&live->done_cond, &live->lock);
+	if (buf->state != LIVE_READY) {
+		pthread_mutex_unlock(&live->lock);
+		return -1;
+	}
+	live->current = live->next;
+	live->next ^= 1;
+	*sample = buf->sample;
+	*count = buf->count;
+	pthread_mutex_unlock(&live->lock);
+
+	return 1;
+}
+
@@ -0,0 +1,59 @@
+#include <pthread.h>
+
+#define LIVE_LINES	574	/* lines of image in the 625 line raster */
+
+enum live_buffer_state {
+	LIVE_EMPTY,		/* buffer can be rendered */
+	LIVE_READY,		/* frame is rendered */
+	LIVE_END,		/* end of stream, no frame */
+};
+
+typedef struct live_buffer {
+	enum live_buffer_state state;
+	sample_t	*sample;		/* BAS signal of one frame */
+	int		count;			/* number of samples */
+	bas_line_t	layout[BAS_LINES];	/* position of lines within frame */
+} live_buffer_t;
+
+typedef struct live {
+	/* Y4M input */
+	FILE		*fp;
+	int		width, height;		/* size of input frames */
+	int		shift_x, shift_y;	/* subsampling of chroma planes */
+	int		mono;			/* no chroma planes */
+	int		frame_size;		/* size of frame data */
+	uint8_t		*yuv;			/* frame data */
+	unsigned short	*img_next;		/* next image, written by reader */
+	unsigned short	*img_render;		/* image that is rendered */
+	int		img_pending;		/* img_next holds a new image */
+	int		eof;			/* reader reached end of stream */
+	pthread_t	reader;
+	int		reader_started;
+
+	/* line renderer */
+	bas_t		bas;
+	int		num_workers;
+	pthread_t	*worker;
+	live_buffer_t	buffer[2];		/* double buffer against modulator */
+	int		render;			/* buffer that is rendered, -1 if none */
+	int		load;			/* buffer that is rendered next */
+	int		next_line;		/* next line to be rendered */
+	int		lines_done;		/* number of lines rendered */
+	int		current;		/* buffer used by modulator, -1 if none */
+	int		next;			/* buffer used by modulator next */
+	int		finish;			/* threads shall exit */
+	pthread_mutex_t	lock;
+	pthread_cond_t	work_cond;		/* signals workers */
+	pthread_cond_t	done_cond;		/* signals modulator */
+	pthread_cond_t	reader_cond;		/* signals reader */
+
+	/* statistics */
+	int		frames;			/* frames from input */
+	int		repeated;		/* frames repeated, because input was late */
+	int		late;			/* frames that were not rendered in time */
+} live_t;
+
+int live_init(live_t *live, const char *filename, double samplerate, int fbas, int num_workers);
+void live_exit(live_t *live);
+int live_get_frame(live_t *live, sample_t **sample, int *count, int wait);
+
@@ -41,6 +41,7 @@ enum paging_signal;
 #include "../liboptions/options.h"
 #include <osmocom/cc/misc.h>
 #include "bas.h"
+#include "live.h"
 #include "tv_modulate.h"
 #include "channels.h"
 
@@ -65,6 +66,7 @@ static int grid_width = 0;
 static int __attribute__((__unused__)) dsp_buffer = 200;
 static double dsp_samplerate = 10e6;
 static const char *wave_file = NULL;
+static int render_threads = 2;
 
 /* global variable to quit main loop */
 int quit = 0;
@@ -102,6 +104,9 @@ static void print_help(const char *arg0)
 	printf("        tx-vcr           Transmit Jolly's VCR test pattern\n");
 	printf("        tx-img [<image>] Transmit natural image or given image file\n");
 	printf("                         Use 4:3 image with 574 lines for best result.\n");
+	printf("        tx-live <file> | - Transmit live video from Y4M file or stdin ('-')\n");
+	printf("                         Example: ffmpeg -i <video> -f yuv4mpegpipe -r 25 - |\n");
+	printf("                                  osmotv ... tx-live -\n");
 	printf("\ngeneral options:\n");
 	printf(" -h --help\n");
 	printf("        This help\n");
@@ -119,6 +124,8 @@ static void print_help(const char *arg0)
 	printf("        Output to wave file instead of SDR\n");
 	printf(" -r --realtime <prio>\n");
 	printf("        Set prio: 0 to disable, 99 for maximum (default = %d)\n", rt_prio);
+	printf(" -t --threads <number>\n");
+	printf("        Number of threads to render lines of live video. (default = %d)\n", render_threads);
 	printf("\nsignal options:\n");
 	printf(" -F --fbas 1 | 0\n");
 	printf("        Turn color on or off. (default = %d)\n", fbas);
@@ -158,6 +165,7 @@ static void add_options(void)
 	option_add('s', "samplerate", 1);
 	option_add('w', "wave-file", 1);
 	option_add('r', "realtime", 1);
+	option_add('t', "threads", 1);
 	option_add('F', "fbas", 1);
 	option_add('T', "tone", 1);
 	option_add('R', "circle-radius", 1);
@@ -202,6 +210,13 @@ static int handle_options(int short_option, int argi, char **argv)
 	case 'r':
 		rt_prio = atoi(argv[argi]);
 		break;
+	case 't':
+		render_threads = atoi(argv[argi]);
+		if (render_threads < 1) {
+			fprintf(stderr, "Number of threads must be 1 or more.\n");
+			return -EINVAL;
+		}
+		break;
 	case 'F':
 		fbas = atoi(argv[argi]);
 		break;
@@ -267,7 +282,31 @@ static int handle_options(int short_option, int argi, char **argv)
 	return 1;
 }
 
-static void tx_bas(sample_t *sample_bas, __attribute__((__unused__)) sample_t *sample_tone, __attribute__((__unused__)) uint8_t *power_tone, int samples)
+#define TONE_FREQUENCY	1000.0
+#define TONE_DEVIATION	50000.0
+
+/* test tone for the sound carrier, the oscillator is a rotating vector */
+static void __attribute__((__unused__)) gen_tone(sample_t *spl, int count, double *tone_I, double *tone_Q)
+{
+	double step_I = cos(2.0 * M_PI * TONE_FREQUENCY / dsp_samplerate);
+	double step_Q = sin(2.0 * M_PI * TONE_FREQUENCY / dsp_samplerate);
+	double I = *tone_I, Q = *tone_Q, tmp;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		spl[i] = Q * TONE_DEVIATION;
+		tmp = I * step_I - Q * step_Q;
+		Q = I * step_Q + Q * step_I;
+		I = tmp;
+	}
+	/* normalize amplitude once per chunk */
+	tmp = 1.0 / sqrt(I * I + Q * Q);
+	*tone_I = I * tmp;
+	*tone_Q = Q * tmp;
+}
+
+/* transmit static frames in a loop or frames from live source */
+static void tx_bas(sample_t *sample_bas, int samples, __attribute__((__unused__)) int with_tone, live_t *live)
 {
 	/* catch signals */
 	signal(SIGINT, sighandler);
@@ -278,7 +317,6 @@ static void tx_bas(sample_t *sample_bas, __attribute__((__unused__)) sample_t *s
 	if (wave_file) {
 		wave_rec_t rec;
 		int rc;
-		sample_t *buffers[1];
 
 		rc = wave_create_record(&rec, wave_file, dsp_samplerate, 1, 1.0);
 		if (rc < 0) {
@@ -286,16 +324,25 @@ static void tx_bas(sample_t *sample_bas, __attribute__((__unused__)) sample_t *s
 			exit(0);
 		}
 
-		buffers[0] = sample_bas;
-		wave_write(&rec, buffers, samples);
+		if (live) {
+			/* write frames until end of stream, a file can wait for each frame */
+			while (!quit && live_get_frame(live, &sample_bas, &samples, 1) > 0)
+				wave_write_wait(&rec, &sample_bas, samples);
+		} else
+			wave_write_wait(&rec, &sample_bas, samples);
 
 		wave_destroy_record(&rec);
 	} else {
 #ifdef HAVE_SDR
-		float *buff = NULL;
+		tv_mod_t mod;
 		void *sdr = NULL;
 		int buffer_size = dsp_samplerate * dsp_buffer / 1000;
 		float *sendbuff = NULL;
+		sample_t *tone_buff = NULL;
+		double tone_I = 1.0, tone_Q = 0.0;
+		int s, n, tosend, rc;
+
+		memset(&mod, 0, sizeof(mod));
 
 		if ((sdr_config->uhd == 0 && sdr_config->soapy == 0)) {
 			fprintf(stderr, "You must choose SDR API you want: --sdr-uhd or --sdr-soapy or -w <file> to generate wave file.\n");
@@ -303,26 +350,22 @@ static void tx_bas(sample_t *sample_bas, __attribute__((__unused__)) sample_t *s
 		}
 
 		sendbuff = calloc(buffer_size * 2, sizeof(*sendbuff));
-		if (!sendbuff) {
+		tone_buff = calloc(buffer_size, sizeof(*tone_buff));
+		if (!sendbuff || !tone_buff) {
 			fprintf(stderr, "No mem!\n");
 			goto error;
 		}
 
-		/* modulate */
-		buff = calloc(samples + 10.0, sizeof(sample_t) * 2);
-		if (!buff) {
-			fprintf(stderr, "No mem!\n");
+		/* the modulated video is cached, live frames are modulated when they are transmitted */
+		/* bandwidth of sound is 2*(deviation + 2*f(sig)) = 2 * (50 + 2*15) = 160khz */
+		if (tv_mod_init(&mod, dsp_samplerate, modulation, (live) ? dsp_samplerate / 25.0 + 10.0 : samples, buffer_size, audio_offset, (with_tone) ? modulation * 0.1 : 0.0) < 0)
 			goto error;
+		if (live) {
+			/* wait for the first frame, before transmission starts */
+			if (live_get_frame(live, &sample_bas, &samples, 1) < 0)
+				goto error;
 		}
-		tv_modulate(buff, samples, sample_bas, modulation);
-
-		if (sample_tone) {
-			/* bandwidth is 2*(deviation + 2*f(sig)) = 2 * (50 + 2*15) = 160khz */
-			fm_mod_t mod;
-			fm_mod_init(&mod, dsp_samplerate, audio_offset, modulation * 0.1);
-			mod.state = MOD_STATE_ON; /* do not ramp up */
-			fm_modulate_complex(&mod, sample_tone, power_tone, samples, buff);
-		}
+		tv_mod_video(&mod, sample_bas, samples);
 
 		/* real time priority */
 		if (rt_prio > 0) {
@@ -348,8 +391,6 @@ static void tx_bas(sample_t *sample_bas, __attribute__((__unused__)) sample_t *s
 			goto error;
 		sdr_start(sdr);
 
-		int pos = 0, max = samples * 2;
-		int s, ss, tosend;
 		while (!quit) {
 			usleep(1000);
 			sdr_read(sdr, (void *)sendbuff, buffer_size, 0, NULL);
@@ -359,14 +400,26 @@ static void tx_bas(sample_t *sample_bas, __attribute__((__unused__)) sample_t *s
 			if (tosend == 0) {
 				continue;
 			}
-			for (s = 0, ss = 0; s < tosend; s++) {
-				sendbuff[ss++] = buff[pos++];
-				sendbuff[ss++] = buff[pos++];
-				if (pos == max) {
-					pos = 0;
+			if (with_tone)
+				gen_tone(tone_buff, tosend, &tone_I, &tone_Q);
+			for (s = 0; s < tosend; s += n) {
+				if (mod.video_pos == mod.video_count) {
+					/* the next frame has been rendered while this frame was transmitted,
+					 * if not, the modulated frame is transmitted again */
+					rc = (live) ? live_get_frame(live, &sample_bas, &samples, 0) : 0;
+					if (rc < 0) {
+						quit = 1;
+						break;
+					}
+					if (rc > 0)
+						tv_mod_video(&mod, sample_bas, samples);
+					else
+						mod.video_pos = 0;
 				}
+				/* only the sound carrier is mixed to the cached video */
+				n = tv_mod_read(&mod, sendbuff + s * 2, tosend - s, (with_tone) ? tone_buff + s : NULL);
 			}
-			sdr_write(sdr, (void *)sendbuff, NULL, tosend, NULL, NULL, 0);
+			sdr_write(sdr, (void *)sendbuff, NULL, s, NULL, NULL, 0);
 		}
 
 	error:
@@ -381,7 +434,8 @@ static void tx_bas(sample_t *sample_bas, __attribute__((__unused__)) sample_t *s
 		}
 
 		free(sendbuff);
-		free(buff);
+		free(tone_buff);
+		tv_mod_exit(&mod);
 		if (sdr)
 			sdr_close(sdr);
 #endif
@@ -398,9 +452,6 @@ static int tx_test_picture(enum bas_type type)
 {
 	bas_t bas;
 	sample_t *test_bas = NULL;
-	sample_t *test_tone = NULL;
-	uint8_t *test_power = NULL;
-	int i;
 	int ret = -1;
 	int count;
 
@@ -416,31 +467,13 @@ static int tx_test_picture(enum bas_type type)
 	count += bas_generate(&bas, test_bas + count);
 	count += bas_generate(&bas, test_bas + count);
 
-	if (tone) {
-		/* for more about audio modulation on tv, see: http://elektroniktutor.de/geraetetechnik/fston.html */
-		test_tone = calloc(count, sizeof(sample_t));
-		if (!test_tone) {
-			fprintf(stderr, "No mem!\n");
-			goto error;
-		}
-		test_power = calloc(count, sizeof(uint8_t));
-		if (!test_power) {
-			fprintf(stderr, "No mem!\n");
-			goto error;
-		}
-		/* emphasis 50us, but 1000Hz does not change level */
-		for (i = 0; i < count; i++)
-			test_tone[i] = sin((double)i * 2.0 * M_PI * 1000.0 / dsp_samplerate) * 50000;
-		memset(test_power, 1, count);
-	}
-
-	tx_bas(test_bas, test_tone, test_power, count);
+	/* for more about audio modulation on tv, see: http://elektroniktutor.de/geraetetechnik/fston.html */
+	/* emphasis 50us, but 1000Hz does not change level */
+	tx_bas(test_bas, count, tone, NULL);
 
 	ret = 0;
 error:
 	free(test_bas);
-	free(test_tone);
-	free(test_power);
 	return ret;
 }
 
@@ -484,7 +517,7 @@ static int tx_img(const char *filename)
 	count += bas_generate(&bas, img_bas + count);
 	count += bas_generate(&bas, img_bas + count);
 
-	tx_bas(img_bas, NULL, NULL, count);
+	tx_bas(img_bas, count, 0, NULL);
 
 	ret = 0;
 error:
@@ -494,6 +527,22 @@ error:
 	return ret;
 }
 
+static int tx_live(const char *filename)
+{
+	live_t live;
+	int rc;
+
+	rc = live_init(&live, filename, dsp_samplerate, fbas, render_threads);
+	if (rc < 0)
+		return rc;
+
+	tx_bas(NULL, 0, 0, &live);
+
+	live_exit(&live);
+
+	return 0;
+}
+
 int main(int argc, char *argv[])
 {
 	int __attribute__((__unused__)) rc, argi;
@@ -559,6 +608,12 @@ int main(int argc, char *argv[])
 		tx_test_picture(BAS_VCR);
 	} else if (!strcmp(argv[argi], "tx-img")) {
 		tx_img((argi + 1 < argc) ? argv[argi + 1] : NULL);
+	} else if (!strcmp(argv[argi], "tx-live")) {
+		if (argi + 1 >= argc) {
+			fprintf(stderr, "Expecting Y4M file or '-' for stdin, use '-h' for help!\n");
+			return -EINVAL;
+		}
+		tx_live(argv[argi + 1]);
 	} else {
 		fprintf(stderr, "Unknown command '%s', use '-h' for help!\n", argv[argi]);
 		return -EINVAL;
@@ -17,19 +17,197 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <math.h>
+/* The video carrier and the sound carrier are processed with vectors of four
+ * floats (GCC vector extension), so the compiler uses SSE or NEON without
+ * depending on a certain architecture.
+ *
+ * The modulated video is kept in a cache. A static picture is modulated only
+ * once, then it is read from cache over and over. Only the sound carrier is
+ * mixed to it, when it is read.
+ */
+
+#include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
 #include "../libsample/sample.h"
 #include "tv_modulate.h"
 
 #define WHITE_MODULATION	0.1
 
-void tv_modulate(float *buff, int count, sample_t *bas, double amplitude)
+typedef float v4sf __attribute__((vector_size(16)));
+typedef int32_t v4si __attribute__((vector_size(16)));
+
+/* taylor series of sin(pi * z) up to z^9, error is below 4e-6 for |z| <= 0.5 */
+#define SIN_C1	3.14159265f
+#define SIN_C3	-5.16771278f
+#define SIN_C5	2.55016404f
+#define SIN_C7	-0.59926453f
+#define SIN_C9	0.08214589f
+
+/* sine of phase, where the full circle is 2^32 */
+static inline v4sf sin_v4(v4si phase)
+{
+	const v4si sign_mask = { INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN };
+	v4sf y, a, z, z2, r;
+	v4si sign, fold;
+
+	/* y = -1 .. 1 is half of a circle each */
+	y = __builtin_convertvector(phase, v4sf) * (1.0f / 2147483648.0f);
+	sign = (v4si)y & sign_mask;
+	a = (v4sf)((v4si)y & ~sign_mask);
+	/* sin(pi * a) == sin(pi * (1 - a)), so fold a into 0 .. 0.5 */
+	z = 1.0f - a;
+	fold = a > z;
+	z = (v4sf)((fold & (v4si)z) | (~fold & (v4si)a));
+	z2 = z * z;
+	r = z * (SIN_C1 + z2 * (SIN_C3 + z2 * (SIN_C5 + z2 * (SIN_C7 + z2 * SIN_C9))));
+
+	return (v4sf)((v4si)r | sign);
+}
+
+static inline v4sf load_v4(const float *p)
+{
+	v4sf v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline void store_v4(float *p, v4sf v)
+{
+	memcpy(p, &v, sizeof(v));
+}
+
+/* amplitude modulation of the video carrier, the white level has lowest amplitude */
+void tv_modulate(float *buff, int count, const sample_t *bas, double amplitude)
+{
+	const v4sf zero = { 0.0f, 0.0f, 0.0f, 0.0f };
+	const v4si low = { 0, 4, 1, 5 }, high = { 2, 6, 3, 7 };
+	/* ((1 - bas) * (1 - WHITE) + WHITE) * amplitude */
+	float scale = -(1.0 - WHITE_MODULATION) * amplitude;
+	float offset = amplitude;
+	v4sf v;
+	int i;
+
+	for (i = 0; i + 4 <= count; i += 4) {
+		v = (v4sf){ bas[i], bas[i + 1], bas[i + 2], bas[i + 3] };
+		v = v * scale + offset;
+		/* interleave with Q = 0 */
+		store_v4(buff + i * 2, __builtin_shuffle(v, zero, low));
+		store_v4(buff + i * 2 + 4, __builtin_shuffle(v, zero, high));
+	}
+	for (; i < count; i++) {
+		buff[i * 2] = (float)bas[i] * scale + offset;
+		buff[i * 2 + 1] = 0.0f;
+	}
+}
+
+/* Add FM modulated sound carrier. The audio gives the deviation in Hertz,
+ * if NULL, the carrier is not modulated.
+ */
+static void sound_modulate(tv_mod_t *mod, float *buff, int count, const sample_t *audio)
 {
-	int i, ss = 0;
+	const v4si quarter = { 1 << 30, 1 << 30, 1 << 30, 1 << 30 };
+	const v4si low = { 0, 4, 1, 5 }, high = { 2, 6, 3, 7 };
+	float amplitude = mod->sound_amplitude;
+	uint32_t phase = mod->sound_phase;
+	int32_t *phases = mod->sound_phases;
+	v4si p;
+	v4sf c, s;
+	int i;
+
+	/* the phase is accumulated with integers, so it does not drift */
+	if (audio) {
+		for (i = 0; i < count; i++) {
+			phase += (uint32_t)(int64_t)((mod->sound_offset + audio[i]) * mod->phase_scale);
+			phases[i] = phase;
+		}
+	} else {
+		for (i = 0; i < count; i++) {
+			phase += mod->sound_step;
+			phases[i] = phase;
+		}
+	}
+	mod->sound_phase = phase;
 
-	for (i = 0; i < count; i++) {
-		buff[ss++] = ((1.0 - bas[i]) * (1.0 - WHITE_MODULATION) + WHITE_MODULATION) * amplitude;
-		buff[ss++] = 0;
+	for (i = 0; i + 4 <= count; i += 4) {
+		memcpy(&p, phases + i, sizeof(p));
+		c = sin_v4(p + quarter) * amplitude;
+		s = sin_v4(p) * amplitude;
+		store_v4(buff + i * 2, load_v4(buff + i * 2) + __builtin_shuffle(c, s, low));
+		store_v4(buff + i * 2 + 4, load_v4(buff + i * 2 + 4) + __builtin_shuffle(c, s, high));
+	}
+	for (; i < count; i++) {
+		buff[i * 2] += cos((double)phases[i] * M_PI / 2147483648.0) * amplitude;
+		buff[i * 2 + 1] += sin((double)phases[i] * M_PI / 2147483648.0) * amplitude;
 	}
 }
+
+/* Init modulator with cache of given number of samples. If sound amplitude
+ * is 0, no sound carrier is added.
+ */
+int tv_mod_init(tv_mod_t *mod, double samplerate, double amplitude, int cache_size, int chunk_size, double sound_offset, double sound_amplitude)
+{
+	memset(mod, 0, sizeof(*mod));
+	mod->amplitude = amplitude;
+	mod->video = calloc(cache_size * 2, sizeof(*mod->video));
+	mod->sound_phases = calloc(chunk_size, sizeof(*mod->sound_phases));
+	if (!mod->video || !mod->sound_phases) {
+		fprintf(stderr, "No mem!\n");
+		tv_mod_exit(mod);
+		return -ENOMEM;
+	}
+	mod->video_size = cache_size;
+	mod->chunk_size = chunk_size;
+	mod->sound_offset = sound_offset;
+	mod->sound_amplitude = sound_amplitude;
+	mod->phase_scale = 4294967296.0 / samplerate;
+	mod->sound_step = (uint32_t)(int64_t)(sound_offset * mod->phase_scale);
+
+	return 0;
+}
+
+void tv_mod_exit(tv_mod_t *mod)
+{
+	free(mod->video);
+	mod->video = NULL;
+	free(mod->sound_phases);
+	mod->sound_phases = NULL;
+}
+
+/* Modulate video and replace the cache, reading starts at the beginning. */
+void tv_mod_video(tv_mod_t *mod, const sample_t *bas, int count)
+{
+	if (count > mod->video_size) {
+		fprintf(stderr, "Video exceeds modulator cache, please fix!\n");
+		abort();
+	}
+	tv_modulate(mod->video, count, bas, mod->amplitude);
+	mod->video_count = count;
+	mod->video_pos = 0;
+}
+
+/*
+ * Read modulated IQ from cache and add sound carrier. Reading stops at the
+ * end of the cache, return number of samples read.
+ * Set video_pos to 0 to repeat the cache.
+ */
+int tv_mod_read(tv_mod_t *mod, float *buff, int count, const sample_t *audio)
+{
+	if (count > mod->video_count - mod->video_pos)
+		count = mod->video_count - mod->video_pos;
+	if (count > mod->chunk_size)
+		count = mod->chunk_size;
+
+	memcpy(buff, mod->video + mod->video_pos * 2, count * 2 * sizeof(*buff));
+	mod->video_pos += count;
+
+	if (mod->sound_amplitude)
+		sound_modulate(mod, buff, count, audio);
+
+	return count;
+}
+
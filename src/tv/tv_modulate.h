@@ -1,3 +1,22 @@
 
-void tv_modulate(float *buff, int count, sample_t *bas, double amplitude);
+typedef struct tv_mod {
+	double		amplitude;		/* amplitude of video carrier */
+	float		*video;			/* cache of modulated video (IQ) */
+	int		video_size;		/* size of cache in samples */
+	int		video_count;		/* samples in cache */
+	int		video_pos;		/* next sample to be read */
+	int		chunk_size;		/* maximum samples to read at once */
+	double		sound_offset;		/* frequency of sound carrier */
+	float		sound_amplitude;	/* amplitude of sound carrier, 0 if off */
+	double		phase_scale;		/* converts Hertz to phase step */
+	uint32_t	sound_step;		/* phase step of unmodulated carrier */
+	uint32_t	sound_phase;		/* phase of sound carrier, 2^32 is a full circle */
+	int32_t		*sound_phases;		/* phase of each sample in chunk */
+} tv_mod_t;
+
+void tv_modulate(float *buff, int count, const sample_t *bas, double amplitude);
+int tv_mod_init(tv_mod_t *mod, double samplerate, double amplitude, int cache_size, int chunk_size, double sound_offset, double sound_amplitude);
+void tv_mod_exit(tv_mod_t *mod);
+void tv_mod_video(tv_mod_t *mod, const sample_t *bas, int count);
+int tv_mod_read(tv_mod_t *mod, float *buff, int count, const sample_t *audio);
 